@@ -171,15 +171,13 @@ pylith::bc::AbsorbingDampers::createAuxiliaryField(const pylith::topology::Field
     // acceleration will have a scale of pressure divided by length and should be within a few orders
     // of magnitude of 1.
 
-    _auxiliaryFactory->addDensity(); // 0
-    _auxiliaryFactory->addVp(); // 1
-    _auxiliaryFactory->addVs(); // 2
+    _auxiliaryFactory->addPWaveImpedance(); // 0
+    _auxiliaryFactory->addSWaveImpedance(); // 1
 
     auxiliaryField->subfieldsSetup();
     auxiliaryField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
     auxiliaryField->allocate();
-    auxiliaryField->createOutputVector();
 
     assert(_auxiliaryFactory);
     _auxiliaryFactory->setValuesFromDB();
@@ -29,6 +29,48 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL*
 
 #include <cassert>
+#include <sstream> // USES std::ostringstream
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace bc {
+        class _AbsorbingDampersAuxiliaryFactory {
+public:
+
+            /** Compute impedance from density and wave speed.
+             *
+             * @param[out] valueSubfield Impedance.
+             * @param[in] numComponents Number of components in subfield.
+             * @param[in] dbValues Values from spatial database.
+             * @param[in] dbIndices Indices of density and wave speed in values from spatial database.
+             * @returns Error code (0 if successful).
+             */
+            static
+            int impedance(PylithScalar valueSubfield[],
+                          const PylithInt numComponents,
+                          const double dbValues[],
+                          const PylithInt dbIndices[]);
+
+            /// Compute impedance from density and wave speed at many points.
+            static
+            int impedanceArray(PylithScalar valueSubfield[],
+                               const PylithInt numComponents,
+                               const size_t numPoints,
+                               const double dbValues[],
+                               const size_t numDBValues,
+                               const PylithInt dbIndices[],
+                               size_t* failedPoint);
+
+            /// Create error message for failed conversion to impedance.
+            static
+            std::string impedanceMsg(const int code,
+                                     const PylithInt numComponents,
+                                     const double dbValues[],
+                                     const PylithInt dbIndices[]);
+
+        }; // _AbsorbingDampersAuxiliaryFactory
+    } // bc
+} // pylith
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
@@ -43,14 +85,14 @@ pylith::bc::AbsorbingDampersAuxiliaryFactory::~AbsorbingDampersAuxiliaryFactory(
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Add density field to auxiliary fields.
+// Add dilatational (P) wave impedance field to auxiliary fields.
 void
-pylith::bc::AbsorbingDampersAuxiliaryFactory::addDensity(void) {
+pylith::bc::AbsorbingDampersAuxiliaryFactory::addPWaveImpedance(void) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("addDensity(void)");
+    PYLITH_JOURNAL_DEBUG("addPWaveImpedance(void)");
 
-    const char* subfieldName = "density";
-    const PylithReal densityScale = _normalizer->getDensityScale();
+    const char* subfieldName = "p_wave_impedance";
+    const PylithReal impedanceScale = _normalizer->getDensityScale() * _normalizer->getLengthScale() / _normalizer->getTimeScale();
 
     pylith::topology::Field::Description description;
     description.label = subfieldName;
@@ -59,25 +101,31 @@ pylith::bc::AbsorbingDampersAuxiliaryFactory::addDensity(void) {
     description.numComponents = 1;
     description.componentNames.resize(1);
     description.componentNames[0] = subfieldName;
-    description.scale = densityScale;
-    description.validator = pylith::topology::FieldQuery::validatorPositive;
+    description.scale = impedanceScale;
+    description.validator = NULL;
 
     _field->subfieldAdd(description, getSubfieldDiscretization(subfieldName));
-    this->setSubfieldQuery(subfieldName);
+
+    const size_t numDBValues = 2;
+    const char* dbValues[numDBValues] = { "density", "vp" };
+    const pylith::topology::FieldQuery::Converter converter(_AbsorbingDampersAuxiliaryFactory::impedance,
+                                                            _AbsorbingDampersAuxiliaryFactory::impedanceArray,
+                                                            _AbsorbingDampersAuxiliaryFactory::impedanceMsg);
+    this->setSubfieldQuery(subfieldName, dbValues, numDBValues, converter);
 
     PYLITH_METHOD_END;
-} // addDensity
+} // addPWaveImpedance
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Add shear wave speed field to auxiliary fields.
+// Add shear (S) wave impedance field to auxiliary fields.
 void
-pylith::bc::AbsorbingDampersAuxiliaryFactory::addVs(void) {
+pylith::bc::AbsorbingDampersAuxiliaryFactory::addSWaveImpedance(void) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("addVs(void)");
+    PYLITH_JOURNAL_DEBUG("addSWaveImpedance(void)");
 
-    const char* subfieldName = "vs";
-    const PylithReal velocityScale = _normalizer->getLengthScale() / _normalizer->getTimeScale();
+    const char* subfieldName = "s_wave_impedance";
+    const PylithReal impedanceScale = _normalizer->getDensityScale() * _normalizer->getLengthScale() / _normalizer->getTimeScale();
 
     pylith::topology::Field::Description description;
     description.label = subfieldName;
@@ -86,41 +134,88 @@ pylith::bc::AbsorbingDampersAuxiliaryFactory::addVs(void) {
     description.numComponents = 1;
     description.componentNames.resize(1);
     description.componentNames[0] = subfieldName;
-    description.scale = velocityScale;
+    description.scale = impedanceScale;
     description.validator = NULL;
 
     _field->subfieldAdd(description, getSubfieldDiscretization(subfieldName));
-    this->setSubfieldQuery(subfieldName);
+
+    const size_t numDBValues = 2;
+    const char* dbValues[numDBValues] = { "density", "vs" };
+    const pylith::topology::FieldQuery::Converter converter(_AbsorbingDampersAuxiliaryFactory::impedance,
+                                                            _AbsorbingDampersAuxiliaryFactory::impedanceArray,
+                                                            _AbsorbingDampersAuxiliaryFactory::impedanceMsg);
+    this->setSubfieldQuery(subfieldName, dbValues, numDBValues, converter);
 
     PYLITH_METHOD_END;
-} // addVs
+} // addSWaveImpedance
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Add dilatational wave speed field to auxiliary fields.
-void
-pylith::bc::AbsorbingDampersAuxiliaryFactory::addVp(void) {
-    PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("addVp(void)");
+// Compute impedance from density and wave speed.
+int
+pylith::bc::_AbsorbingDampersAuxiliaryFactory::impedance(PylithScalar valueSubfield[],
+                                                         const PylithInt numComponents,
+                                                         const double dbValues[],
+                                                         const PylithInt dbIndices[]) {
+    assert(valueSubfield);
+    assert(1 == numComponents);
+    assert(dbValues);
+    assert(dbIndices);
 
-    const char* subfieldName = "vp";
-    const PylithReal velocityScale = _normalizer->getLengthScale() / _normalizer->getTimeScale();
+    const PylithScalar density = dbValues[dbIndices[0]];
+    const PylithScalar speed = dbValues[dbIndices[1]];
+    valueSubfield[0] = density * speed;
 
-    pylith::topology::Field::Description description;
-    description.label = subfieldName;
-    description.alias = subfieldName;
-    description.vectorFieldType = pylith::topology::Field::SCALAR;
-    description.numComponents = 1;
-    description.componentNames.resize(1);
-    description.componentNames[0] = subfieldName;
-    description.scale = velocityScale;
-    description.validator = NULL;
+    return (density <= 0 ? 0x1 : 0) | (speed <= 0 ? 0x2 : 0);
+} // impedance
 
-    _field->subfieldAdd(description, getSubfieldDiscretization(subfieldName));
-    this->setSubfieldQuery(subfieldName);
 
-    PYLITH_METHOD_END;
-} // addVp
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute impedance from density and wave speed at many points.
+int
+pylith::bc::_AbsorbingDampersAuxiliaryFactory::impedanceArray(PylithScalar valueSubfield[],
+                                                              const PylithInt numComponents,
+                                                              const size_t numPoints,
+                                                              const double dbValues[],
+                                                              const size_t numDBValues,
+                                                              const PylithInt dbIndices[],
+                                                              size_t* failedPoint) {
+    assert(failedPoint);
+
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        const int code = impedance(&valueSubfield[iPoint*numComponents], numComponents,
+                                   &dbValues[iPoint*numDBValues], dbIndices);
+        if (code) {
+            *failedPoint = iPoint;
+            return code;
+        } // if
+    } // for
+    *failedPoint = numPoints;
+
+    return 0;
+} // impedanceArray
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create error message for failed conversion to impedance.
+std::string
+pylith::bc::_AbsorbingDampersAuxiliaryFactory::impedanceMsg(const int code,
+                                                            const PylithInt numComponents,
+                                                            const double dbValues[],
+                                                            const PylithInt dbIndices[]) {
+    const PylithScalar density = dbValues[dbIndices[0]];
+    const PylithScalar speed = dbValues[dbIndices[1]];
+
+    std::ostringstream msg;
+    if (code & 0x1) {
+        msg << "Found nonpositive density (" << density << ").";
+    } // if
+    if (code & 0x2) {
+        msg << "Found nonpositive wave speed (" << speed << ").";
+    } // if
+
+    return msg.str();
+} // impedanceMsg
 
 
 // End of file
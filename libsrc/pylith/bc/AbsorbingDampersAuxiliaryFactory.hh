@@ -39,14 +39,18 @@ public:
     /// Destructor.
     virtual ~AbsorbingDampersAuxiliaryFactory(void);
 
-    /// Add density field to auxiliary fields.
-    void addDensity(void);
+    /** Add dilatational (P) wave impedance field to auxiliary fields.
+     *
+     * The impedance, density times Vp, is computed from the density and Vp in the spatial database when the
+     * auxiliary field is set, so the kernels do not recompute it at every quadrature point.
+     */
+    void addPWaveImpedance(void);
 
-    /// Add shear wave speed field to auxiliary fields.
-    void addVs(void);
-
-    /// Add dilatational wave speed field to auxiliary fields.
-    void addVp(void);
+    /** Add shear (S) wave impedance field to auxiliary fields.
+     *
+     * The impedance, density times Vs, is computed from the density and Vs in the spatial database.
+     */
+    void addSWaveImpedance(void);
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -25,6 +25,7 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/FieldOps.hh" // USES FieldOps
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/TimeHistoryQuery.hh" // USES TimeHistoryQuery
 
 #include "pylith/fekernels/TimeDependentFn.hh" // USES TimeDependentFn kernels
 
@@ -69,6 +70,7 @@ public:
 // Default constructor.
 pylith::bc::DirichletTimeDependent::DirichletTimeDependent(void) :
     _dbTimeHistory(NULL),
+    _timeHistoryQuery(NULL),
     _auxiliaryFactory(new pylith::bc::TimeDependentAuxiliaryFactory),
     _useInitial(true),
     _useRate(false),
@@ -94,6 +96,7 @@ pylith::bc::DirichletTimeDependent::deallocate(void) {
 
     delete _auxiliaryFactory;_auxiliaryFactory = NULL;
     _dbTimeHistory = NULL; // :KLUDGE: Use shared pointer.
+    delete _timeHistoryQuery;_timeHistoryQuery = NULL;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -250,6 +253,8 @@ pylith::bc::DirichletTimeDependent::createConstraints(const pylith::topology::Fi
     constraint->setLabelName(getLabelName());
     constraint->setLabelValue(getLabelValue());
     constraint->setConstrainedDOF(&_constrainedDOF[0], _constrainedDOF.size());
+    constraint->setTimeDependent(_useRate || _useTimeHistory);
+    constraint->useDirectInsertion(true);
 
     _DirichletTimeDependent::setKernelConstraint(constraint, *this, solution);
 
@@ -292,13 +297,14 @@ pylith::bc::DirichletTimeDependent::createAuxiliaryField(const pylith::topology:
         if (_dbTimeHistory) {
             _dbTimeHistory->open();
         } // if
+        delete _timeHistoryQuery;
+        _timeHistoryQuery = new pylith::topology::TimeHistoryQuery("time_history_start_time", "time_history_value");
     } // _useTimeHistory
 
     auxiliaryField->subfieldsSetup();
     auxiliaryField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
     auxiliaryField->allocate();
-    auxiliaryField->createOutputVector();
 
     assert(_auxiliaryFactory);
     _auxiliaryFactory->setValuesFromDB();
@@ -330,7 +336,7 @@ pylith::bc::DirichletTimeDependent::updateAuxiliaryField(pylith::topology::Field
     if (_useTimeHistory) {
         assert(_normalizer);
         const PylithScalar timeScale = _normalizer->getTimeScale();
-        TimeDependentAuxiliaryFactory::updateAuxiliaryField(auxiliaryField, t, timeScale, _dbTimeHistory);
+        TimeDependentAuxiliaryFactory::updateAuxiliaryField(auxiliaryField, t, timeScale, _dbTimeHistory, _timeHistoryQuery);
     } // if
 
     PYLITH_METHOD_END;
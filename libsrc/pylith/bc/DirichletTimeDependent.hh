@@ -191,6 +191,7 @@ private:
 
     int_array _constrainedDOF; ///< List of constrained degrees of freedom at each location.
     spatialdata::spatialdb::TimeHistory* _dbTimeHistory; ///< Time history database.
+    pylith::topology::TimeHistoryQuery* _timeHistoryQuery; ///< Cached query of time history database.
     pylith::bc::TimeDependentAuxiliaryFactory* _auxiliaryFactory; ///< Factory for auxiliary subfields.
 
     bool _useInitial; ///< Use initial value term.
@@ -25,9 +25,11 @@
 #include "pylith/fekernels/NeumannTimeDependent.hh" // USES NeumannTimeDependent kernels
 
 #include "pylith/feassemble/IntegratorBoundary.hh" // USES IntegratorBoundary
+#include "pylith/meshio/TimeSlicesHDF5.hh" // USES TimeSlicesHDF5
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/FieldOps.hh" // USES FieldOps
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/TimeHistoryQuery.hh" // USES TimeHistoryQuery
 
 #include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -36,6 +38,7 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
 #include <cassert> // USES assert()
+#include <cstring> // USES strlen()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <typeinfo> // USES typeid()
@@ -75,6 +78,8 @@ public:
 // Default constructor.
 pylith::bc::NeumannTimeDependent::NeumannTimeDependent(void) :
     _dbTimeHistory(NULL),
+    _timeHistoryQuery(NULL),
+    _timeSlices(NULL),
     _auxiliaryFactory(new pylith::bc::TimeDependentAuxiliaryFactory(pylith::bc::TimeDependentAuxiliaryFactory::TANGENTIAL_NORMAL)),
     _scaleName("pressure"),
     _useInitial(true),
@@ -101,6 +106,8 @@ pylith::bc::NeumannTimeDependent::deallocate(void) {
 
     delete _auxiliaryFactory;_auxiliaryFactory = NULL;
     _dbTimeHistory = NULL; // :KLUDGE: Use shared pointer.
+    delete _timeHistoryQuery;_timeHistoryQuery = NULL;
+    delete _timeSlices;_timeSlices = NULL;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -178,6 +185,28 @@ pylith::bc::NeumannTimeDependent::useTimeHistory(void) const { // useTimeHistory
 } // useTimeHistory
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of HDF5 file with time slices of amplitude.
+void
+pylith::bc::NeumannTimeDependent::setTimeSlicesFilename(const char* value) {
+    PYLITH_COMPONENT_DEBUG("setTimeSlicesFilename(value="<<value<<")");
+
+    delete _timeSlices;_timeSlices = NULL;
+    if (value && strlen(value) > 0) {
+        _timeSlices = new pylith::meshio::TimeSlicesHDF5();
+        _timeSlices->setFilename(value);
+    } // if
+} // setTimeSlicesFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag associated with using time slices for the amplitude in time history expression.
+bool
+pylith::bc::NeumannTimeDependent::useTimeSlices(void) const {
+    return _timeSlices != NULL;
+} // useTimeSlices
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Name of scale associated with Neumann boundary condition (e.g., pressure for elasticity).
 void
@@ -262,9 +291,17 @@ pylith::bc::NeumannTimeDependent::createAuxiliaryField(const pylith::topology::F
 
     // :ATTENTION: The order of the factory methods must match the order of the auxiliary subfields in the FE kernels.
 
+    if (_useInitial && _timeSlices) {
+        std::ostringstream msg;
+        msg << "Cannot use both initial value term and time slices in Neumann boundary condition for '"
+            << getLabelName() << "'. Time slices replace the initial value term.";
+        throw std::runtime_error(msg.str());
+    } // if
     if (_useInitial) {
         _auxiliaryFactory->addInitialAmplitude();
-    } // if
+    } else if (_timeSlices) {
+        _auxiliaryFactory->addTimeSlicesAmplitude();
+    } // if/else
     if (_useRate) {
         _auxiliaryFactory->addRateAmplitude();
         _auxiliaryFactory->addRateStartTime();
@@ -276,16 +313,20 @@ pylith::bc::NeumannTimeDependent::createAuxiliaryField(const pylith::topology::F
         if (_dbTimeHistory) {
             _dbTimeHistory->open();
         } // if
+        delete _timeHistoryQuery;
+        _timeHistoryQuery = new pylith::topology::TimeHistoryQuery("time_history_start_time", "time_history_value");
     } // _useTimeHistory
 
     auxiliaryField->subfieldsSetup();
     auxiliaryField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
     auxiliaryField->allocate();
-    auxiliaryField->createOutputVector();
 
     assert(_auxiliaryFactory);
     _auxiliaryFactory->setValuesFromDB();
+    if (_timeSlices) {
+        _timeSlices->open(*auxiliaryField, "time_slices_amplitude", *_normalizer);
+    } // if
 
     pythia::journal::debug_t debug(PyreComponent::getName());
     if (debug.state()) {
@@ -320,7 +361,10 @@ pylith::bc::NeumannTimeDependent::updateAuxiliaryField(pylith::topology::Field*
     if (_useTimeHistory) {
         assert(_normalizer);
         const PylithScalar timeScale = _normalizer->getTimeScale();
-        TimeDependentAuxiliaryFactory::updateAuxiliaryField(auxiliaryField, t, timeScale, _dbTimeHistory);
+        TimeDependentAuxiliaryFactory::updateAuxiliaryField(auxiliaryField, t, timeScale, _dbTimeHistory, _timeHistoryQuery);
+    } // if
+    if (_timeSlices) {
+        _timeSlices->update(auxiliaryField, t);
     } // if
 
     PYLITH_METHOD_END;
@@ -371,7 +415,8 @@ pylith::bc::_NeumannTimeDependent::setKernelsResidual(pylith::feassemble::Integr
     const pylith::topology::Field::VectorFieldEnum fieldType = solution.getSubfieldInfo(bc.getSubfieldName()).description.vectorFieldType;
     const bool isScalarField = fieldType == pylith::topology::Field::SCALAR;
 
-    const int bitInitial = bc.useInitial() ? 0x1 : 0x0;
+    // Time slices amplitude replaces the initial amplitude.
+    const int bitInitial = (bc.useInitial() || bc.useTimeSlices()) ? 0x1 : 0x0;
     const int bitRate = bc.useRate() ? 0x2 : 0x0;
     const int bitTimeHistory = bc.useTimeHistory() ? 0x4 : 0x0;
     const int bitUse = bitInitial | bitRate | bitTimeHistory;
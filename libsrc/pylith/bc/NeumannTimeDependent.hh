@@ -33,6 +33,10 @@
  *        time history amplitude (scalar or vector) f_2(x)
  *        time history start (scalar) t_2(x)
  *        time history value (scalar) a(t-t_2(x))
+ *
+ * With time slices, the time slices amplitude f_0(x,t) replaces the initial amplitude. Its values are interpolated
+ * in time from a space-time field in an HDF5 file at the beginning of each time step (see
+ * pylith::meshio::TimeSlicesHDF5).
  */
 
 #if !defined(pylith_bc_neumanntimedependent_hh)
@@ -41,6 +45,7 @@
 #include "pylith/bc/BoundaryCondition.hh" // ISA BoundaryCondition
 
 #include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/meshio/meshiofwd.hh" // HOLDSA TimeSlicesHDF5
 
 class pylith::bc::NeumannTimeDependent : public pylith::bc::BoundaryCondition {
     friend class TestNeumannTimeDependent; // unit testing
@@ -105,6 +110,20 @@ public:
      */
     bool useTimeHistory(void) const;
 
+    /** Set name of HDF5 file with time slices of amplitude.
+     *
+     * The time slices replace the initial value term, so they cannot be used together with it.
+     *
+     * @param[in] value Name of HDF5 file (empty for no time slices).
+     */
+    void setTimeSlicesFilename(const char* value);
+
+    /** Get flag associated with using time slices for the amplitude in time history expression.
+     *
+     * @returns True if using time slices, false otherwise.
+     */
+    bool useTimeSlices(void) const;
+
     /** Set name of scale associated with Neumann boundary
      * condition (e.g., 'pressure' for elasticity).
      *
@@ -179,6 +198,8 @@ protected:
 private:
 
     spatialdata::spatialdb::TimeHistory* _dbTimeHistory; ///< Time history database.
+    pylith::topology::TimeHistoryQuery* _timeHistoryQuery; ///< Cached query of time history database.
+    pylith::meshio::TimeSlicesHDF5* _timeSlices; ///< Time slices of amplitude.
     pylith::bc::TimeDependentAuxiliaryFactory* _auxiliaryFactory; ///< Factory for auxiliary subfields.
     std::string _scaleName; ///< Name of scale associated with Neumann boundary condition.
 
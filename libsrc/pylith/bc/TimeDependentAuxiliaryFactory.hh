@@ -70,18 +70,23 @@ public:
     /// Add time history value field to auxiliary fields.
     void addTimeHistoryValue(void);
 
+    /// Add time slices amplitude field (used in place of initial amplitude) to auxiliary fields.
+    void addTimeSlicesAmplitude(void);
+
     /** Update auxiliary field for current time.
      *
      * @param[inout] auxiliaryField Auxiliary field to update.
      * @param[in] t Current time.
      * @param[in] timeScale Time scale for nondimensionalization.
      * @param[in] dbTimeHistory Time history database.
+     * @param[inout] timeHistoryQuery Cached time history query for auxiliary field (optional).
      */
     static
     void updateAuxiliaryField(pylith::topology::Field* auxiliaryField,
                               const PylithReal t,
                               const PylithReal timeScale,
-                              spatialdata::spatialdb::TimeHistory* const dbTimeHistory);
+                              spatialdata::spatialdb::TimeHistory* const dbTimeHistory,
+                              pylith::topology::TimeHistoryQuery* const timeHistoryQuery=NULL);
 
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
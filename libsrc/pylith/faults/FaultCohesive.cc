@@ -31,6 +31,7 @@
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/SetupProfiler.hh" // USES SetupProfiler
 
 #include <utility> // USES std::pair
 #include <map> // USES std::map
@@ -235,11 +236,15 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh) {
         PetscBool hasLabel = PETSC_FALSE;
         PetscInt depth, gdepth, dim;
         PetscMPIInt rank;
+        PetscBool isDistributed = PETSC_FALSE;
         PetscErrorCode err;
-        // We do not have labels on all ranks until after distribution
+        // We do not have labels on all ranks until after distribution. Cohesive cells may be created either on the
+        // serial mesh before distribution or on each partition after distribution.
         err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
+        err = DMPlexIsDistributed(dmMesh, &isDistributed);PYLITH_CHECK_ERROR(err);
+        const bool hasLabels = !rank || isDistributed;
         err = DMHasLabel(dmMesh, _surfaceLabelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
-        if (!hasLabel && !rank) {
+        if (!hasLabel && hasLabels) {
             std::ostringstream msg;
             msg << "Mesh missing group of vertices '" << _surfaceLabelName
                 << "' for fault interface condition.";
@@ -253,7 +258,7 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh) {
         PetscDMLabel buriedEdgesLabel = NULL;
 
         // We do not have labels on all ranks until after distribution
-        if ((_buriedEdgesLabelName.length() > 0) && !rank) {
+        if ((_buriedEdgesLabelName.length() > 0) && hasLabels) {
             err = DMGetLabel(dmMesh, _buriedEdgesLabelName.c_str(), &buriedEdgesLabel);PYLITH_CHECK_ERROR(err);
             if (!buriedEdgesLabel) {
                 std::ostringstream msg;
@@ -261,7 +266,13 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh) {
                 throw std::runtime_error(msg.str());
             } // if
         } // if
+        const std::string phase = "Create cohesive cells for '" + std::string(getIdentifier()) + "'";
+        pylith::utils::SetupProfiler::begin(phase.c_str());
         TopologyOps::create(mesh, faultMesh, buriedEdgesLabel, _buriedEdgesLabelValue, getCohesiveLabelValue());
+        pylith::utils::SetupProfiler::end(phase.c_str());
+        if (isDistributed) {
+            err = DMPlexReorderCohesiveSupports(mesh->getDM());PYLITH_CHECK_ERROR(err);
+        } // if
 
         // Check consistency of mesh.
         pylith::topology::MeshOps::checkTopology(*mesh);
@@ -388,6 +399,7 @@ pylith::faults::FaultCohesive::createConstraints(const pylith::topology::Field&
     constraint->setConstrainedDOF(&constrainedDOF[0], constrainedDOF.size());
     constraint->setSubfieldName(lagrangeName);
     constraint->setUserFn(_zero);
+    constraint->setTimeDependent(false);
 
     constraintArray.resize(1);
     constraintArray[0] = constraint;
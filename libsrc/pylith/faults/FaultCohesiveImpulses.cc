@@ -28,9 +28,11 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/FieldOps.hh" // USES FieldOps::checkDiscretization()
+#include "pylith/topology/FieldQuery.hh" // USES FieldQuery
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
 #include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/fekernels/KernelMultiversion.hh" // USES PYLITH_KERNELS
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
@@ -39,12 +41,14 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensionalizer
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 
-#include <cmath> // USES pow(), sqrt()
+#include <algorithm> // USES std::sort(), std::unique()
+#include <cmath> // USES pow(), sqrt(), floor()
 #include <cstdlib> // USES atoi()
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 #include <typeinfo> // USES typeid()
+#include <vector> // USES std::vector
 
 // ------------------------------------------------------------------------------------------------
 typedef pylith::feassemble::IntegratorInterface::ResidualKernels ResidualKernels;
@@ -70,6 +74,17 @@ public:
                                    const pylith::topology::Field& auxiliaryField,
                                    const double threshold);
 
+            /** Find ghost points with impulse amplitude greater than threshold.
+             *
+             * @param[out] ghostPoints Array of ghost points with impulses on other processes.
+             * @param[in] auxiliaryField Auxiliary field with impulse amplitude.
+             * @param[in] threshold Threshold for impulses.
+             */
+            static
+            void findImpulseGhostPoints(int_array* ghostPoints,
+                                        const pylith::topology::Field& auxiliaryField,
+                                        const double threshold);
+
         };
         const char* _FaultCohesiveImpulses::pyreComponent = "faultcohesiveimpulses";
 
@@ -82,7 +97,11 @@ public:
 // Default constructor.
 pylith::faults::FaultCohesiveImpulses::FaultCohesiveImpulses(void) :
     _auxiliaryFactory(new pylith::faults::AuxiliaryFactoryKinematic),
-    _threshold(1.0e-6) {
+    _threshold(1.0e-6),
+    _patchDB(NULL),
+    _impulseStepCurrent(-1),
+    _resetSlip(true),
+    _holdImpulse(false) {
     pylith::utils::PyreComponent::setName(_FaultCohesiveImpulses::pyreComponent);
 } // constructor
 
@@ -101,6 +120,7 @@ pylith::faults::FaultCohesiveImpulses::deallocate(void) {
     FaultCohesive::deallocate();
 
     delete _auxiliaryFactory;_auxiliaryFactory = NULL;
+    _patchDB = NULL; // Memory handle in Python. :TODO: Use shared pointer.
 } // deallocate
 
 
@@ -138,14 +158,160 @@ pylith::faults::FaultCohesiveImpulses::setThreshold(const double value) {
 } // setThreshold
 
 
+// ------------------------------------------------------------------------------------------------
+// Set spatial database with patches for impulses.
+void
+pylith::faults::FaultCohesiveImpulses::setPatchDB(spatialdata::spatialdb::SpatialDB* db) {
+    PYLITH_COMPONENT_DEBUG("setPatchDB(db="<<db<<")");
+
+    _patchDB = db; // :KLUDGE: :TODO: Use shared pointer.
+} // setPatchDB
+
+
+// ------------------------------------------------------------------------------------------------
+// Are impulses applied over patches that every process contributes to?
+bool
+pylith::faults::FaultCohesiveImpulses::hasImpulsePatches(void) const {
+    return _patchDB != NULL;
+} // hasImpulsePatches
+
+
 // ------------------------------------------------------------------------------------------------
 // Return the number of impulses on this process.
 size_t
 pylith::faults::FaultCohesiveImpulses::getNumImpulsesLocal(void) {
-    return _impulsePoints.size()*_impulseDOF.size();
+    return (_patchDB ? _patchIds.size() : _impulsePoints.size())*_impulseDOF.size();
 } // getNumImpulses
 
 
+// ------------------------------------------------------------------------------------------------
+// Get amplitudes of local impulses for a slip distribution.
+void
+pylith::faults::FaultCohesiveImpulses::getImpulseAmplitudes(pylith::scalar_array* amplitudes,
+                                                            pylith::topology::Field* auxiliaryField,
+                                                            spatialdata::spatialdb::SpatialDB* db) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("getImpulseAmplitudes(amplitudes="<<amplitudes<<", auxiliaryField="<<auxiliaryField<<", db="<<typeid(*db).name()<<")");
+
+    assert(amplitudes);
+    assert(auxiliaryField);
+    assert(db);
+    assert(_normalizer);
+
+    auxiliaryField->zeroLocal();
+    pylith::topology::FieldQuery query(*auxiliaryField);
+    query.initializeWithDefaultQueries();
+    query.openDB(db, _normalizer->getLengthScale());
+    query.queryDB();
+    query.closeDB(db);
+    _resetSlip = true;
+
+    PetscErrorCode err = VecSet(auxiliaryField->getGlobalVector(), 0.0);PYLITH_CHECK_ERROR(err);
+    auxiliaryField->scatterLocalToVector(auxiliaryField->getGlobalVector(), INSERT_VALUES);
+    auxiliaryField->scatterVectorToLocal(auxiliaryField->getGlobalVector(), INSERT_VALUES);
+
+    // Impulses have unit dimensional slip (see _updateSlip()).
+    const size_t numComponents = _impulseDOF.size();
+    const size_t numImpulses = getNumImpulsesLocal();
+    amplitudes->resize(numImpulses);
+    if (numImpulses > 0) {
+        pylith::topology::VecVisitorMesh auxiliaryVisitor(*auxiliaryField, "slip");
+        const PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+        const PylithScalar lengthScale = _normalizer->getLengthScale();
+        for (size_t impulseStep = 0; impulseStep < numImpulses; ++impulseStep) {
+            const PetscInt pImpulse = _impulsePoints[impulseStep / numComponents];
+            const PetscInt dof = _impulseDOF[impulseStep % numComponents];
+            const PetscInt slipOff = auxiliaryVisitor.sectionOffset(pImpulse);
+            (*amplitudes)[impulseStep] = auxiliaryArray[slipOff+dof] * lengthScale;
+        } // for
+    } // if
+
+    PYLITH_METHOD_END;
+} // getImpulseAmplitudes
+
+
+// ------------------------------------------------------------------------------------------------
+// Set slip subfield for an impulse and hold it fixed in updateAuxiliaryField().
+void
+pylith::faults::FaultCohesiveImpulses::holdImpulse(pylith::topology::Field* auxiliaryField,
+                                                   const long impulse) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("holdImpulse(auxiliaryField="<<auxiliaryField<<", impulse="<<impulse<<")");
+
+    assert(auxiliaryField);
+    if (QUASISTATIC != _formulation) {
+        PYLITH_COMPONENT_LOGICERROR("Green's functions for dynamic simulations is not yet supported.");
+    } // if
+
+    _resetSlip = true;
+    if (_patchDB) {
+        _updateSlipPatches(auxiliaryField, impulse);
+    } else {
+        _updateSlip(auxiliaryField, impulse);
+    } // if/else
+    _holdImpulse = true;
+
+    PYLITH_METHOD_END;
+} // holdImpulse
+
+
+// ------------------------------------------------------------------------------------------------
+// Release impulse held fixed.
+void
+pylith::faults::FaultCohesiveImpulses::releaseImpulse(void) {
+    _holdImpulse = false;
+} // releaseImpulse
+
+
+// ------------------------------------------------------------------------------------------------
+// Get points with nonzero slip for the current impulse.
+void
+pylith::faults::FaultCohesiveImpulses::getImpulseSupport(pylith::int_array* points,
+                                                         const pylith::topology::Field& auxiliaryField) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("getImpulseSupport(points="<<points<<", auxiliaryField="<<auxiliaryField.getLabel()<<")");
+
+    assert(points);
+    assert(!_resetSlip);
+
+    std::vector<PylithInt> supportPoints;
+    if (_patchDB) {
+        if (_impulseStepCurrent >= 0) {
+            const int patchId = _patchIds[_impulseStepCurrent / _impulseDOF.size()];
+            for (size_t i = 0; i < _patchPoints.size(); ++i) {
+                if (_patchPointIds[i] == patchId) {
+                    supportPoints.push_back(_patchPoints[i]);
+                } // if
+            } // for
+        } // if
+    } else if (_impulseStepCurrent >= 0) {
+        supportPoints.push_back(_impulsePoints[_impulseStepCurrent / _impulseDOF.size()]);
+    } // if
+    if (!_patchDB && (_impulseGhostPoints.size() > 0)) {
+        pylith::topology::VecVisitorMesh auxiliaryVisitor(auxiliaryField, "slip");
+        const PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+        for (size_t i = 0; i < _impulseGhostPoints.size(); ++i) {
+            const PetscInt point = _impulseGhostPoints[i];
+            const PetscInt slipDof = auxiliaryVisitor.sectionDof(point);
+            const PetscInt slipOff = auxiliaryVisitor.sectionOffset(point);
+            for (PetscInt iDOF = 0; iDOF < slipDof; ++iDOF) {
+                if (auxiliaryArray[slipOff+iDOF] != 0.0) {
+                    supportPoints.push_back(point);
+                    break;
+                } // if
+            } // for
+        } // for
+    } // if
+
+    points->resize(supportPoints.size());
+    for (size_t i = 0; i < supportPoints.size(); ++i) {
+        (*points)[i] = supportPoints[i];
+    } // for
+
+    PYLITH_METHOD_END;
+} // getImpulseSupport
+
+
 // ------------------------------------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
@@ -225,12 +391,17 @@ pylith::faults::FaultCohesiveImpulses::createAuxiliaryField(const pylith::topolo
     auxiliaryField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
     auxiliaryField->allocate();
-    auxiliaryField->createOutputVector();
     auxiliaryField->createGlobalVector();
 
     assert(_auxiliaryFactory);
     _auxiliaryFactory->setValuesFromDB();
     _FaultCohesiveImpulses::findImpulsePoints(&_impulsePoints, *auxiliaryField, _threshold);
+    _FaultCohesiveImpulses::findImpulseGhostPoints(&_impulseGhostPoints, *auxiliaryField, _threshold);
+    if (_patchDB) {
+        _findImpulsePatches(*auxiliaryField);
+    } // if
+    _impulseStepCurrent = -1;
+    _resetSlip = true;
 
     pythia::journal::debug_t debug(PyreComponent::getName());
     if (debug.state()) {
@@ -253,9 +424,17 @@ pylith::faults::FaultCohesiveImpulses::updateAuxiliaryField(pylith::topology::Fi
     assert(auxiliaryField);
     assert(_normalizer);
 
+    if (_holdImpulse) {
+        PYLITH_METHOD_END;
+    } // if
+
     switch (_formulation) {
     case QUASISTATIC:
-        this->_updateSlip(auxiliaryField, long(impulseReal));
+        if (_patchDB) {
+            this->_updateSlipPatches(auxiliaryField, long(impulseReal));
+        } else {
+            this->_updateSlip(auxiliaryField, long(impulseReal));
+        } // if/else
         break;
     case DYNAMIC_IMEX:
     case DYNAMIC:
@@ -289,20 +468,51 @@ pylith::faults::FaultCohesiveImpulses::_updateSlip(pylith::topology::Field* auxi
     assert(_normalizer);
 
     const size_t numComponents = _impulseDOF.size();
-    const size_t iComponent = impulseStep % numComponents;
-    const size_t iImpulse = impulseStep / numComponents;
+    const long impulseStepNew = ((impulseStep >= 0) && (_impulsePoints.size() > 0)) ? impulseStep : -1;
+    const PylithScalar impulseAmplitude = 1.0 / _normalizer->getLengthScale();
 
     PetscErrorCode err;
-    err = VecSet(auxiliaryField->getLocalVector(), 0.0);PYLITH_CHECK_ERROR(err);
+    PetscVec globalVec = auxiliaryField->getGlobalVector();assert(globalVec);
+    if (_resetSlip) {
+        err = VecSet(auxiliaryField->getLocalVector(), 0.0);PYLITH_CHECK_ERROR(err);
+        err = VecSet(globalVec, 0.0);PYLITH_CHECK_ERROR(err);
+        _impulseStepCurrent = -1;
+        _resetSlip = false;
+    } // if
 
-    if ((impulseStep >= 0) && (_impulsePoints.size() > 0)) {
+    // Only the previous and new impulses change, so we update those degrees of freedom in place rather than
+    // rewriting the slip subfield over the entire fault.
+    if (impulseStepNew != _impulseStepCurrent) {
         pylith::topology::VecVisitorMesh auxiliaryVisitor(*auxiliaryField, "slip");
         PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
-        const PetscInt pImpulse = _impulsePoints[iImpulse];
-        const PetscInt dof = _impulseDOF[iComponent];
-        const PetscInt slipDof = auxiliaryVisitor.sectionDof(pImpulse);assert(iComponent < size_t(slipDof));
-        const PetscInt slipOff = auxiliaryVisitor.sectionOffset(pImpulse);
-        auxiliaryArray[slipOff+dof] = 1.0 / _normalizer->getLengthScale();
+        PetscSection globalSection = auxiliaryField->getGlobalSection();assert(globalSection);
+        const PetscInt slipIndex = auxiliaryField->getSubfieldInfo("slip").index;
+
+        const long impulseSteps[2] = { _impulseStepCurrent, impulseStepNew };
+        const PylithScalar values[2] = { 0.0, impulseAmplitude };
+        for (int i = 0; i < 2; ++i) {
+            if (impulseSteps[i] < 0) {
+                continue;
+            } // if
+            const PetscInt pImpulse = _impulsePoints[impulseSteps[i] / numComponents];
+            const PetscInt dof = _impulseDOF[impulseSteps[i] % numComponents];
+            assert(dof < auxiliaryVisitor.sectionDof(pImpulse));
+            auxiliaryArray[auxiliaryVisitor.sectionOffset(pImpulse)+dof] = values[i];
+
+            PetscInt globalOff = 0;
+            err = PetscSectionGetFieldOffset(globalSection, pImpulse, slipIndex, &globalOff);PYLITH_CHECK_ERROR(err);
+            err = VecSetValue(globalVec, globalOff+dof, values[i], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        } // for
+        _impulseStepCurrent = impulseStepNew;
+    } // if
+    err = VecAssemblyBegin(globalVec);PYLITH_CHECK_ERROR(err);
+    err = VecAssemblyEnd(globalVec);PYLITH_CHECK_ERROR(err);
+
+    // Ghost copies of the impulse point on other processes are refreshed from the owner.
+    int numProcs = 1;
+    err = MPI_Comm_size(PetscObjectComm((PetscObject)globalVec), &numProcs);PYLITH_CHECK_ERROR(err);
+    if (numProcs > 1) {
+        auxiliaryField->scatterVectorToLocal(globalVec, INSERT_VALUES);
     } // if
 
     pythia::journal::debug_t debug(pylith::utils::PyreComponent::getName());
@@ -310,14 +520,161 @@ pylith::faults::FaultCohesiveImpulses::_updateSlip(pylith::topology::Field* auxi
         auxiliaryField->view("Fault auxiliary field after setting impulse.");
     } // if
 
-    err = VecSet(auxiliaryField->getGlobalVector(), 0.0);PYLITH_CHECK_ERROR(err);
-    auxiliaryField->scatterLocalToVector(auxiliaryField->getGlobalVector(), ADD_VALUES);
-    auxiliaryField->scatterVectorToLocal(auxiliaryField->getGlobalVector(), INSERT_VALUES);
-
     PYLITH_METHOD_END;
 } // _updateSlip
 
 
+// ------------------------------------------------------------------------------------------------
+// Update slip subfield in auxiliary field for patch impulse.
+void
+pylith::faults::FaultCohesiveImpulses::_updateSlipPatches(pylith::topology::Field* auxiliaryField,
+                                                          const long impulseStep) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_updateSlipPatches(auxiliaryField="<<auxiliaryField<<", impulseStep="<<impulseStep<<")");
+
+    assert(auxiliaryField);
+    assert(_normalizer);
+
+    const size_t numComponents = _impulseDOF.size();
+    const long impulseStepNew = ((impulseStep >= 0) && (_patchIds.size() > 0)) ? impulseStep : -1;
+    const PylithScalar impulseAmplitude = 1.0 / _normalizer->getLengthScale();
+
+    PetscErrorCode err;
+    PetscVec globalVec = auxiliaryField->getGlobalVector();assert(globalVec);
+    if (_resetSlip) {
+        err = VecSet(auxiliaryField->getLocalVector(), 0.0);PYLITH_CHECK_ERROR(err);
+        err = VecSet(globalVec, 0.0);PYLITH_CHECK_ERROR(err);
+        _impulseStepCurrent = -1;
+        _resetSlip = false;
+    } // if
+
+    // Every process updates its own points in the previous and new patches, including ghost points, so we do not
+    // need to scatter the global vector to the local vector.
+    if (impulseStepNew != _impulseStepCurrent) {
+        pylith::topology::VecVisitorMesh auxiliaryVisitor(*auxiliaryField, "slip");
+        PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+        PetscSection globalSection = auxiliaryField->getGlobalSection();assert(globalSection);
+        const PetscInt slipIndex = auxiliaryField->getSubfieldInfo("slip").index;
+
+        const long impulseSteps[2] = { _impulseStepCurrent, impulseStepNew };
+        const PylithScalar values[2] = { 0.0, impulseAmplitude };
+        for (int i = 0; i < 2; ++i) {
+            if (impulseSteps[i] < 0) {
+                continue;
+            } // if
+            const int patchId = _patchIds[impulseSteps[i] / numComponents];
+            const PetscInt dof = _impulseDOF[impulseSteps[i] % numComponents];
+            for (size_t iPoint = 0; iPoint < _patchPoints.size(); ++iPoint) {
+                if (_patchPointIds[iPoint] != patchId) {
+                    continue;
+                } // if
+                const PetscInt point = _patchPoints[iPoint];
+                assert(dof < auxiliaryVisitor.sectionDof(point));
+                auxiliaryArray[auxiliaryVisitor.sectionOffset(point)+dof] = values[i];
+
+                PetscInt globalDof = 0;
+                err = PetscSectionGetFieldDof(globalSection, point, slipIndex, &globalDof);PYLITH_CHECK_ERROR(err);
+                if (globalDof > 0) {
+                    PetscInt globalOff = 0;
+                    err = PetscSectionGetFieldOffset(globalSection, point, slipIndex, &globalOff);PYLITH_CHECK_ERROR(err);
+                    err = VecSetValue(globalVec, globalOff+dof, values[i], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+                } // if
+            } // for
+        } // for
+        _impulseStepCurrent = impulseStepNew;
+    } // if
+    err = VecAssemblyBegin(globalVec);PYLITH_CHECK_ERROR(err);
+    err = VecAssemblyEnd(globalVec);PYLITH_CHECK_ERROR(err);
+
+    pythia::journal::debug_t debug(pylith::utils::PyreComponent::getName());
+    if (debug.state()) {
+        auxiliaryField->view("Fault auxiliary field after setting patch impulse.");
+    } // if
+
+    PYLITH_METHOD_END;
+} // _updateSlipPatches
+
+
+// ------------------------------------------------------------------------------------------------
+// Find patch of each point with impulses using spatial database with patch identifiers.
+void
+pylith::faults::FaultCohesiveImpulses::_findImpulsePatches(const pylith::topology::Field& auxiliaryField) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_findImpulsePatches(auxiliaryField="<<auxiliaryField.getLabel()<<")");
+
+    assert(_patchDB);
+    assert(_normalizer);
+
+    // Query patch identifiers into a scalar field with the same discretization as the slip subfield.
+    pylith::topology::Field patchField(auxiliaryField.getMesh());
+    patchField.setLabel("FaultCohesiveImpulses patches");
+    const pylith::topology::FieldBase::Description description("patch_id", "patch_id",
+                                                               pylith::string_vector(1, "patch_id"), 1,
+                                                               pylith::topology::FieldBase::SCALAR);
+    patchField.subfieldAdd(description, auxiliaryField.getSubfieldInfo("slip").fe);
+    patchField.subfieldsSetup();
+    patchField.createDiscretization();
+    patchField.allocate();
+
+    pylith::topology::FieldQuery query(patchField);
+    query.initializeWithDefaultQueries();
+    query.openDB(_patchDB, _normalizer->getLengthScale());
+    query.queryDB();
+    query.closeDB(_patchDB);
+
+    // Points with impulses on this process, including ghost points, so that each process sets all of its local
+    // values for a patch impulse.
+    pylith::topology::VecVisitorMesh patchVisitor(patchField, "patch_id");
+    const PylithScalar* patchArray = patchVisitor.localArray();
+    const size_t numPointsOwned = _impulsePoints.size();
+    const size_t numPoints = numPointsOwned + _impulseGhostPoints.size();
+    std::vector<int> points;
+    std::vector<int> pointIds;
+    for (size_t i = 0; i < numPoints; ++i) {
+        const PetscInt point = (i < numPointsOwned) ? _impulsePoints[i] : _impulseGhostPoints[i-numPointsOwned];
+        const int patchId = int(floor(patchArray[patchVisitor.sectionOffset(point)] + 0.5));
+        if (patchId >= 0) {
+            points.push_back(point);
+            pointIds.push_back(patchId);
+        } // if
+    } // for
+    _patchPoints.resize(points.size());
+    _patchPointIds.resize(pointIds.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        _patchPoints[i] = points[i];
+        _patchPointIds[i] = pointIds[i];
+    } // for
+
+    // Gather patch identifiers over all processes, so that every process uses the same order of impulses.
+    std::vector<int> patchIdsLocal(pointIds);
+    std::sort(patchIdsLocal.begin(), patchIdsLocal.end());
+    patchIdsLocal.erase(std::unique(patchIdsLocal.begin(), patchIdsLocal.end()), patchIdsLocal.end());
+
+    PetscErrorCode err;
+    MPI_Comm comm = PetscObjectComm((PetscObject)patchField.getDM());
+    int numProcs = 1;
+    err = MPI_Comm_size(comm, &numProcs);PYLITH_CHECK_ERROR(err);
+    int numIdsLocal = patchIdsLocal.size();
+    std::vector<int> numIds(numProcs);
+    std::vector<int> offsets(numProcs+1, 0);
+    err = MPI_Allgather(&numIdsLocal, 1, MPI_INT, &numIds[0], 1, MPI_INT, comm);PYLITH_CHECK_ERROR(err);
+    for (int iProc = 0; iProc < numProcs; ++iProc) {
+        offsets[iProc+1] = offsets[iProc] + numIds[iProc];
+    } // for
+    std::vector<int> patchIds(std::max(offsets[numProcs], 1));
+    err = MPI_Allgatherv(numIdsLocal > 0 ? &patchIdsLocal[0] : NULL, numIdsLocal, MPI_INT, &patchIds[0], &numIds[0],
+                         &offsets[0], MPI_INT, comm);PYLITH_CHECK_ERROR(err);
+    patchIds.resize(offsets[numProcs]);
+    std::sort(patchIds.begin(), patchIds.end());
+    patchIds.erase(std::unique(patchIds.begin(), patchIds.end()), patchIds.end());
+    _patchIds = patchIds;
+
+    PYLITH_COMPONENT_INFO_ROOT("Using " << _patchIds.size() << " patches for impulses on fault.");
+
+    PYLITH_METHOD_END;
+} // _findImpulsePatches
+
+
 // ------------------------------------------------------------------------------------------------
 // Set kernels for residual.
 void
@@ -332,15 +689,15 @@ pylith::faults::FaultCohesiveImpulses::_setKernelsResidual(pylith::feassemble::I
     switch (_formulation) {
     case pylith::problems::Physics::QUASISTATIC: {
         // Elasticity equation (displacement) for negative side of the fault.
-        const PetscBdPointFunc f0u_neg = pylith::fekernels::FaultCohesiveKin::f0u_neg;
+        const PetscBdPointFunc f0u_neg = PYLITH_KERNELS(FaultCohesiveKin)::f0u_neg;
         const PetscBdPointFunc f1u_neg = NULL;
 
         // Elasticity equation (displacement) for positive side of the fault.
-        const PetscBdPointFunc f0u_pos = pylith::fekernels::FaultCohesiveKin::f0u_pos;
+        const PetscBdPointFunc f0u_pos = PYLITH_KERNELS(FaultCohesiveKin)::f0u_pos;
         const PetscBdPointFunc f1u_pos = NULL;
 
         // Fault slip constraint equation.
-        const PetscBdPointFunc f0l = pylith::fekernels::FaultCohesiveKin::f0l_slip;
+        const PetscBdPointFunc f0l = PYLITH_KERNELS(FaultCohesiveKin)::f0l_slip;
         const PetscBdPointFunc f1l = NULL;
 
         kernels.resize(3);
@@ -380,17 +737,17 @@ pylith::faults::FaultCohesiveImpulses::_setKernelsJacobian(pylith::feassemble::I
     std::vector<JacobianKernels> kernels;
     switch (_formulation) {
     case QUASISTATIC: {
-        const PetscBdPointJac Jf0ul_neg = pylith::fekernels::FaultCohesiveKin::Jf0ul_neg;
+        const PetscBdPointJac Jf0ul_neg = PYLITH_KERNELS(FaultCohesiveKin)::Jf0ul_neg;
         const PetscBdPointJac Jf1ul_neg = NULL;
         const PetscBdPointJac Jf2ul_neg = NULL;
         const PetscBdPointJac Jf3ul_neg = NULL;
 
-        const PetscBdPointJac Jf0ul_pos = pylith::fekernels::FaultCohesiveKin::Jf0ul_pos;
+        const PetscBdPointJac Jf0ul_pos = PYLITH_KERNELS(FaultCohesiveKin)::Jf0ul_pos;
         const PetscBdPointJac Jf1ul_pos = NULL;
         const PetscBdPointJac Jf2ul_pos = NULL;
         const PetscBdPointJac Jf3ul_pos = NULL;
 
-        const PetscBdPointJac Jf0lu = pylith::fekernels::FaultCohesiveKin::Jf0lu;
+        const PetscBdPointJac Jf0lu = PYLITH_KERNELS(FaultCohesiveKin)::Jf0lu;
         const PetscBdPointJac Jf1lu = NULL;
         const PetscBdPointJac Jf2lu = NULL;
         const PetscBdPointJac Jf3lu = NULL;
@@ -480,4 +837,58 @@ pylith::faults::_FaultCohesiveImpulses::findImpulsePoints(int_array* impulsePoin
 } // findImpulsePoints
 
 
+// ------------------------------------------------------------------------------------------------
+// Find ghost points with impulse amplitude greater than threshold.
+void
+pylith::faults::_FaultCohesiveImpulses::findImpulseGhostPoints(int_array* ghostPoints,
+                                                               const pylith::topology::Field& auxiliaryField,
+                                                               const double threshold) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(ghostPoints);
+    PetscErrorCode err = 0;
+
+    PetscSection auxiliaryFieldSection = auxiliaryField.getGlobalSection();assert(auxiliaryFieldSection);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(auxiliaryFieldSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    ghostPoints->resize(0);
+    if (pStart == pEnd) {
+        PYLITH_METHOD_END;
+    } // if
+
+    pylith::topology::VecVisitorMesh auxiliaryVisitor(auxiliaryField, "slip");
+    const PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();assert(auxiliaryArray);
+
+    // Ghost points have negative number of degrees of freedom in the global section.
+    PetscSection slipSectionGlobal = NULL;
+    const int slipIndex = auxiliaryField.getSubfieldInfo("slip").index;
+    err = PetscSectionGetField(auxiliaryFieldSection, slipIndex, &slipSectionGlobal);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PylithInt> points;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt slipDof = 0;
+        err = PetscSectionGetDof(slipSectionGlobal, point, &slipDof);PYLITH_CHECK_ERROR(err);
+        if (slipDof >= 0) {
+            continue;
+        } // if
+
+        const PetscInt slipOff = auxiliaryVisitor.sectionOffset(point);
+        const PetscInt slipDofLocal = auxiliaryVisitor.sectionDof(point);
+        for (PetscInt iDOF = 0; iDOF < slipDofLocal; ++iDOF) {
+            if (auxiliaryArray[slipOff+iDOF] >= threshold) {
+                points.push_back(point);
+                break;
+            } // if
+        } // for
+    } // for
+
+    ghostPoints->resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        (*ghostPoints)[i] = points[i];
+    } // for
+
+    PYLITH_METHOD_END;
+} // findImpulseGhostPoints
+
+
 // End of file
@@ -57,12 +57,71 @@ public:
      */
     void setThreshold(const double value);
 
+    /** Set spatial database with patches for impulses.
+     *
+     * When a spatial database is given, each impulse is unit slip over all points in a patch (coarse basis) rather
+     * than at a single point, so the number of impulses does not grow with refinement of the fault mesh. The
+     * database provides the integer patch identifier, 'patch_id', at each point; points with a negative identifier
+     * or an amplitude below the threshold do not belong to any patch. Patches may span processes, so every process
+     * contributes to every patch impulse.
+     *
+     * @param[in] db Spatial database with patch identifiers.
+     */
+    void setPatchDB(spatialdata::spatialdb::SpatialDB* db);
+
+    /** Are impulses applied over patches that every process contributes to?
+     *
+     * @returns True if using patch impulses, false otherwise.
+     */
+    bool hasImpulsePatches(void) const;
+
     /** Get the total number of impulses that will be applied on this process.
+     *
+     * With patch impulses, this is the total number of impulses, because every process contributes to each one.
      *
      * @returns Number of impulses.
      */
     size_t getNumImpulsesLocal(void);
 
+    /** Get amplitudes of local impulses for a slip distribution.
+     *
+     * The slip subfield of the auxiliary field is set to the slip distribution in the spatial database, and the
+     * amplitude of each impulse is the slip at the impulse point and component relative to a unit impulse, so that
+     * the response to the slip distribution is the sum of the impulse responses weighted by the amplitudes.
+     *
+     * @param[out] amplitudes Amplitude of each local impulse in order of impulses.
+     * @param[inout] auxiliaryField Auxiliary field for fault.
+     * @param[in] db Spatial database with slip distribution.
+     */
+    void getImpulseAmplitudes(pylith::scalar_array* amplitudes,
+                              pylith::topology::Field* auxiliaryField,
+                              spatialdata::spatialdb::SpatialDB* db);
+
+    /** Set slip subfield for an impulse and hold it fixed in updateAuxiliaryField().
+     *
+     * Time-dependent problems call updateAuxiliaryField() with the current time, so an impulse applied before time
+     * stepping is held fixed while stepping. The entire slip subfield is reset, so the auxiliary field may have been
+     * restored from a copy.
+     *
+     * @param[inout] auxiliaryField Auxiliary field for fault.
+     * @param[in] impulse Index of local impulse (-1 for no impulse on this process).
+     */
+    void holdImpulse(pylith::topology::Field* auxiliaryField,
+                     const long impulse);
+
+    /// Release impulse held fixed, so updateAuxiliaryField() sets the slip for the impulse given by its time argument.
+    void releaseImpulse(void);
+
+    /** Get points with nonzero slip for the current impulse.
+     *
+     * Includes ghost copies of the impulse point when the impulse is applied on another process.
+     *
+     * @param[out] points Points in fault mesh with nonzero slip.
+     * @param[in] auxiliaryField Auxiliary field for fault.
+     */
+    void getImpulseSupport(pylith::int_array* points,
+                           const pylith::topology::Field& auxiliaryField) const;
+
     /** Verify configuration is acceptable.
      *
      * @param[in] solution Solution field.
@@ -104,6 +163,20 @@ protected:
     void _updateSlip(pylith::topology::Field* auxiliaryField,
                      const long impulseIndex);
 
+    /** Update slip subfield in auxiliary field for patch impulse.
+     *
+     * @param[out] auxiliaryField Auxiliary field.
+     * @param[in] impulseIndex Index of impulse (-1 indicates no impulse).
+     */
+    void _updateSlipPatches(pylith::topology::Field* auxiliaryField,
+                            const long impulseIndex);
+
+    /** Find patch of each point with impulses using spatial database with patch identifiers.
+     *
+     * @param[in] auxiliaryField Auxiliary field.
+     */
+    void _findImpulsePatches(const pylith::topology::Field& auxiliaryField);
+
     /** Set kernels for residual.
      *
      * @param[out] integrator Integrator for material.
@@ -131,6 +204,14 @@ private:
     PylithReal _threshold; ///< Threshold for nonzero impulse amplitude.
     int_array _impulseDOF; ///< Degrees of freedom with impulses.
     int_array _impulsePoints; ///< Points with nonzero threshold.
+    int_array _impulseGhostPoints; ///< Ghost points with nonzero threshold (impulses applied on other processes).
+    spatialdata::spatialdb::SpatialDB* _patchDB; ///< Spatial database with patch identifiers for impulses.
+    int_array _patchPoints; ///< Local points (including ghost points) in patches.
+    int_array _patchPointIds; ///< Patch identifier of each local point in patches.
+    int_vector _patchIds; ///< Sorted identifiers of patches over all processes.
+    long _impulseStepCurrent; ///< Local impulse currently in slip subfield (-1 for none).
+    bool _resetSlip; ///< True if slip subfield must be reset before applying next impulse.
+    bool _holdImpulse; ///< True if slip subfield is held fixed in updateAuxiliaryField().
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
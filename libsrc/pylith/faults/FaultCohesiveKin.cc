@@ -32,9 +32,11 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
 #include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/fekernels/KernelMultiversion.hh" // USES PYLITH_KERNELS
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensionalizer
@@ -46,8 +48,10 @@
 #include <cstdlib> // USES atoi()
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
-#include <stdexcept> // USES std::runtime_error
+#include <stdexcept> // USES std::runtime_error, std::out_of_range
 #include <typeinfo> // USES typeid()
+#include <iterator> // USES std::advance()
+#include <vector> // USES std::vector
 
 // ------------------------------------------------------------------------------------------------
 typedef pylith::feassemble::IntegratorInterface::ResidualKernels ResidualKernels;
@@ -75,7 +79,13 @@ public:
 pylith::faults::FaultCohesiveKin::FaultCohesiveKin(void) :
     _auxiliaryFactory(new pylith::faults::AuxiliaryFactoryKinematic),
     _slipVecRupture(NULL),
-    _slipVecTotal(NULL) {
+    _slipVecTotal(NULL),
+    _slipVecFinal(NULL),
+    _bitSlipSubfieldsFinal(0),
+    _superposedAuxField(NULL),
+    _slipScatterPlan(NULL),
+    _bitSlipSubfieldsPlan(0),
+    _scenarioRupture(-1) {
     pylith::utils::PyreComponent::setName(_FaultCohesiveKin::pyreComponent);
 } // constructor
 
@@ -95,6 +105,10 @@ pylith::faults::FaultCohesiveKin::deallocate(void) {
 
     PetscErrorCode err = VecDestroy(&_slipVecRupture);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_slipVecTotal);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_slipVecFinal);PYLITH_CHECK_ERROR(err);
+    _rupturesFinal.clear();
+    delete _superposedAuxField;_superposedAuxField = NULL;
+    delete _slipScatterPlan;_slipScatterPlan = NULL;
     delete _auxiliaryFactory;_auxiliaryFactory = NULL;
     _ruptures.clear(); // :TODO: Use shared pointers for earthquake ruptures
 } // deallocate
@@ -127,6 +141,30 @@ pylith::faults::FaultCohesiveKin::setEqRuptures(const char* const * names,
 } // setEqRuptures
 
 
+// ------------------------------------------------------------------------------------------------
+// Get number of kinematic earthquake ruptures.
+size_t
+pylith::faults::FaultCohesiveKin::getNumRuptures(void) const {
+    return _ruptures.size();
+} // getNumRuptures
+
+
+// ------------------------------------------------------------------------------------------------
+// Set kinematic earthquake rupture used as a static slip scenario.
+void
+pylith::faults::FaultCohesiveKin::setScenarioRupture(const int value) {
+    PYLITH_COMPONENT_DEBUG("setScenarioRupture(value="<<value<<")");
+
+    if ((value < -1) || (value >= int(_ruptures.size()))) {
+        std::ostringstream msg;
+        msg << "Index of scenario rupture (" << value << ") for fault '" << getSurfaceLabelName()
+            << "' must be in range [-1, " << _ruptures.size() << ").";
+        throw std::out_of_range(msg.str());
+    } // if
+    _scenarioRupture = value;
+} // setScenarioRupture
+
+
 // ------------------------------------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
@@ -216,7 +254,6 @@ pylith::faults::FaultCohesiveKin::createAuxiliaryField(const pylith::topology::F
     auxiliaryField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
     auxiliaryField->allocate();
-    auxiliaryField->createOutputVector();
 
     // We don't populate the auxiliary field via a spatial database, because they will be set from
     // the earthquake rupture.
@@ -234,6 +271,11 @@ pylith::faults::FaultCohesiveKin::createAuxiliaryField(const pylith::topology::F
     PetscErrorCode err = 0;
     err = DMCreateLocalVector(auxiliaryField->getDM(), &_slipVecRupture);PYLITH_CHECK_ERROR(err);
     err = DMCreateLocalVector(auxiliaryField->getDM(), &_slipVecTotal);PYLITH_CHECK_ERROR(err);
+    err = DMCreateLocalVector(auxiliaryField->getDM(), &_slipVecFinal);PYLITH_CHECK_ERROR(err);
+    err = VecSet(_slipVecFinal, 0.0);PYLITH_CHECK_ERROR(err);
+    _rupturesFinal.clear();
+
+    _setupSuperposedRuptures();
 
     PYLITH_METHOD_RETURN(auxiliaryField);
 } // createAuxiliaryField
@@ -265,7 +307,11 @@ pylith::faults::FaultCohesiveKin::updateAuxiliaryField(pylith::topology::Field*
         PYLITH_COMPONENT_LOGICERROR("Unknown formulation for equations (" << _formulation << ").");
     } // switch
 
-    this->_updateSlip(auxiliaryField, t, bitSlipSubfields);
+    if (_scenarioRupture >= 0) {
+        this->_updateScenarioSlip(auxiliaryField, bitSlipSubfields);
+    } else {
+        this->_updateSlip(auxiliaryField, t, bitSlipSubfields);
+    } // if/else
 
     PYLITH_METHOD_END;
 } // updateAuxiliaryField
@@ -291,48 +337,267 @@ pylith::faults::FaultCohesiveKin::_updateSlip(pylith::topology::Field* auxiliary
     assert(auxiliaryField);
     assert(_normalizer);
 
-    // Update slip subfield at current time step
-    PetscErrorCode err = VecSet(_slipVecTotal, 0.0);PYLITH_CHECK_ERROR(err);
+    // Discard cached slip of ruptures with final slip if the requested subfields change or time moves backward.
+    PetscErrorCode err = 0;
     const srcs_type::const_iterator rupturesEnd = _ruptures.end();
-    for (srcs_type::iterator r_iter = _ruptures.begin(); r_iter != rupturesEnd; ++r_iter) {
-        err = VecSet(_slipVecRupture, 0.0);PYLITH_CHECK_ERROR(err);
+    bool resetFinal = bitSlipSubfields != _bitSlipSubfieldsFinal;
+    for (srcs_type::iterator r_iter = _ruptures.begin(); r_iter != rupturesEnd && !resetFinal; ++r_iter) {
+        resetFinal = _rupturesFinal.count(r_iter->first) && (t <= r_iter->second->getFinalSlipTime());
+    } // for
+    if (resetFinal) {
+        err = VecSet(_slipVecFinal, 0.0);PYLITH_CHECK_ERROR(err);
+        _rupturesFinal.clear();
+        _bitSlipSubfieldsFinal = bitSlipSubfields;
+    } // if
 
+    // Update slip subfield at current time step. Ruptures that have not started contribute nothing, and the
+    // contributions of ruptures that have reached their final slip are cached. When superposing ruptures, slip for
+    // ruptures that are still in progress is computed in a single projection; ruptures reaching their final slip
+    // during this time step are computed individually so that their contribution can be cached.
+    err = VecCopy(_slipVecFinal, _slipVecTotal);PYLITH_CHECK_ERROR(err);
+    for (srcs_type::iterator r_iter = _ruptures.begin(); r_iter != rupturesEnd; ++r_iter) {
         KinSrc* src = r_iter->second;assert(src);
+        if ((t < src->getOriginTime()) || _rupturesFinal.count(r_iter->first)) {
+            continue;
+        } // if
+        if (_superposedAuxField && (t <= src->getFinalSlipTime())) {
+            continue;
+        } // if
+
+        err = VecSet(_slipVecRupture, 0.0);PYLITH_CHECK_ERROR(err);
         src->getSlipSubfields(_slipVecRupture, auxiliaryField, t, _normalizer->getTimeScale(), bitSlipSubfields);
-        err = VecAYPX(_slipVecTotal, 1.0, _slipVecRupture);
+        err = VecAXPY(_slipVecTotal, 1.0, _slipVecRupture);PYLITH_CHECK_ERROR(err);
+
+        if (t > src->getFinalSlipTime()) {
+            PYLITH_COMPONENT_DEBUG("Caching final slip for rupture '"<<r_iter->first<<"'.");
+            err = VecAXPY(_slipVecFinal, 1.0, _slipVecRupture);PYLITH_CHECK_ERROR(err);
+            _rupturesFinal.insert(r_iter->first);
+        } // if
+    } // for
+    if (_superposedAuxField) {
+        _computeSuperposedSlip(*auxiliaryField, t, bitSlipSubfields);
+    } // if
+
+    _setSlipSubfields(auxiliaryField, bitSlipSubfields);
+
+    PYLITH_METHOD_END;
+} // _updateSlip
+
+
+// ------------------------------------------------------------------------------------------------
+// Setup auxiliary field with subfields of all kinematic ruptures for superposing slip in a single projection.
+void
+pylith::faults::FaultCohesiveKin::_setupSuperposedRuptures(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupSuperposedRuptures()");
+
+    delete _superposedAuxField;_superposedAuxField = NULL;
+    if (_ruptures.size() < 2) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // All ruptures must use the same slip time function that supports superposition.
+    const srcs_type::const_iterator rupturesBegin = _ruptures.begin();
+    const srcs_type::const_iterator rupturesEnd = _ruptures.end();
+    assert(rupturesBegin->second);
+    const PetscPointFunc superposedKernel = rupturesBegin->second->getSuperposedKernel(KinSrc::GET_SLIP);
+    if (!superposedKernel) {
+        PYLITH_METHOD_END;
+    } // if
+    for (srcs_type::const_iterator r_iter = rupturesBegin; r_iter != rupturesEnd; ++r_iter) {
+        assert(r_iter->second);
+        if (r_iter->second->getSuperposedKernel(KinSrc::GET_SLIP) != superposedKernel) {
+            PYLITH_METHOD_END;
+        } // if
+    } // for
+    PYLITH_COMPONENT_DEBUG("Superposing slip of "<<_ruptures.size()<<" kinematic ruptures.");
+
+    // Add subfields of each rupture in the same order as the ruptures.
+    const pylith::topology::Field& srcAuxField = rupturesBegin->second->auxField();
+    _superposedAuxField = new pylith::topology::Field(srcAuxField.getMesh());assert(_superposedAuxField);
+    _superposedAuxField->setLabel("FaultCohesiveKin superposed rupture auxiliary field");
+    for (srcs_type::const_iterator r_iter = rupturesBegin; r_iter != rupturesEnd; ++r_iter) {
+        const pylith::topology::Field& auxField = r_iter->second->auxField();
+        const pylith::string_vector& subfieldNames = auxField.getSubfieldNames();
+        for (size_t i = 0; i < subfieldNames.size(); ++i) {
+            const pylith::topology::Field::SubfieldInfo& info = auxField.getSubfieldInfo(subfieldNames[i].c_str());
+            pylith::topology::Field::Description description = info.description;
+            description.label = r_iter->first + "_" + info.description.label;
+            description.alias = r_iter->first + "_" + info.description.alias;
+            _superposedAuxField->subfieldAdd(description, info.fe);
+        } // for
+    } // for
+    _superposedAuxField->subfieldsSetup();
+    _superposedAuxField->createDiscretization();
+    _superposedAuxField->allocate();
+
+    // Copy values of auxiliary subfields from ruptures.
+    pylith::topology::VecVisitorMesh superposedVisitor(*_superposedAuxField);
+    PylithScalar* superposedArray = superposedVisitor.localArray();
+    pylith::topology::VecScatterPlanMesh superposedPlan;
+    pylith::topology::VecScatterPlanMesh auxPlan;
+    pylith::scalar_array values;
+    PetscInt superposedIndex = 0;
+    for (srcs_type::const_iterator r_iter = rupturesBegin; r_iter != rupturesEnd; ++r_iter) {
+        const pylith::topology::Field& auxField = r_iter->second->auxField();
+        const PetscInt numSubfields = auxField.getSubfieldNames().size();
+        pylith::topology::VecVisitorMesh auxVisitor(auxField);
+        const PylithScalar* auxArray = auxVisitor.localArray();
+        for (PetscInt iSubfield = 0; iSubfield < numSubfields; ++iSubfield, ++superposedIndex) {
+            auxPlan.initialize(auxField, &iSubfield, 1);
+            superposedPlan.initialize(*_superposedAuxField, &superposedIndex, 1);
+            assert(auxPlan.size() == superposedPlan.size());
+            values.resize(auxPlan.size());
+            if (values.size() > 0) {
+                auxPlan.gather(&values[0], auxArray);
+                superposedPlan.scatter(superposedArray, &values[0]);
+            } // if
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setupSuperposedRuptures
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute slip of active ruptures using a single projection of the superposed slip time functions.
+void
+pylith::faults::FaultCohesiveKin::_computeSuperposedSlip(const pylith::topology::Field& auxiliaryField,
+                                                         const double t,
+                                                         const int bitSlipSubfields) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_computeSuperposedSlip(auxiliaryField="<<auxiliaryField.getLabel()<<", t="<<t<<", bitSlipSubfields="<<bitSlipSubfields<<")");
+
+    assert(_superposedAuxField);
+
+    // Ruptures that have not started or that were computed individually get an origin time in the distant future,
+    // so they contribute nothing.
+    const srcs_type::const_iterator rupturesEnd = _ruptures.end();
+    std::vector<PylithScalar> constants(_ruptures.size());
+    bool hasActiveRupture = false;
+    size_t iRupture = 0;
+    for (srcs_type::const_iterator r_iter = _ruptures.begin(); r_iter != rupturesEnd; ++r_iter, ++iRupture) {
+        const KinSrc* src = r_iter->second;assert(src);
+        const bool isActive = (t >= src->getOriginTime()) && (t <= src->getFinalSlipTime()) && !_rupturesFinal.count(r_iter->first);
+        constants[iRupture] = isActive ? src->getOriginTime() : pylith::PYLITH_MAXSCALAR;
+        hasActiveRupture = hasActiveRupture || isActive;
     } // for
+    if (!hasActiveRupture) {
+        PYLITH_METHOD_END;
+    } // if
 
-    // Transfer slip values from local PETSc slip vector to fault auxiliary field.
-    PetscInt pStart = 0, pEnd = 0;
-    err = PetscSectionGetChart(auxiliaryField->getLocalSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
-    PetscInt subfieldIndices[3];
-    PetscInt numSubfields = 0;
+    const KinSrc* src = _ruptures.begin()->second;assert(src);
+    PetscPointFunc subfieldKernels[3];
+    size_t numSubfields = 0;
     if (bitSlipSubfields & KinSrc::GET_SLIP) {
-        subfieldIndices[numSubfields++] = auxiliaryField->getSubfieldInfo("slip").index;
+        subfieldKernels[numSubfields++] = src->getSuperposedKernel(KinSrc::GET_SLIP);
     } // if
     if (bitSlipSubfields & KinSrc::GET_SLIP_RATE) {
-        subfieldIndices[numSubfields++] = auxiliaryField->getSubfieldInfo("slip_rate").index;
+        subfieldKernels[numSubfields++] = src->getSuperposedKernel(KinSrc::GET_SLIP_RATE);
     } // if
     if (bitSlipSubfields & KinSrc::GET_SLIP_ACC) {
-        subfieldIndices[numSubfields++] = auxiliaryField->getSubfieldInfo("slip_acceleration").index;
+        subfieldKernels[numSubfields++] = src->getSuperposedKernel(KinSrc::GET_SLIP_ACC);
+    } // if
+    assert(auxiliaryField.getSubfieldNames().size() == numSubfields);
+
+    // :KLUDGE: Potentially we may have multiple PetscDS objects. This assumes that the first one (with a NULL label) is
+    // the correct one.
+    PetscErrorCode err = 0;
+    PetscDM faultAuxiliaryDM = auxiliaryField.getDM();
+    PetscDS ds = NULL;
+    err = DMGetDS(faultAuxiliaryDM, &ds);PYLITH_CHECK_ERROR(err);assert(ds);
+    err = PetscDSSetConstants(ds, constants.size(), &constants[0]);PYLITH_CHECK_ERROR(err);
+
+    PetscDMLabel dmLabel = NULL;
+    PetscInt labelValue = 0;
+    const PetscInt part = 0;
+    err = VecSet(_slipVecRupture, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMSetAuxiliaryVec(faultAuxiliaryDM, dmLabel, labelValue, part,
+                            _superposedAuxField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    err = DMProjectFieldLocal(faultAuxiliaryDM, t, _slipVecRupture, subfieldKernels, INSERT_VALUES,
+                              _slipVecRupture);PYLITH_CHECK_ERROR(err);
+    err = VecAXPY(_slipVecTotal, 1.0, _slipVecRupture);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _computeSuperposedSlip
+
+
+// ------------------------------------------------------------------------------------------------
+// Update slip subfield in auxiliary field with final slip of scenario rupture.
+void
+pylith::faults::FaultCohesiveKin::_updateScenarioSlip(pylith::topology::Field* auxiliaryField,
+                                                      const int bitSlipSubfields) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_updateScenarioSlip(auxiliaryField="<<auxiliaryField<<", bitSlipSubfields="<<bitSlipSubfields<<")");
+
+    assert(auxiliaryField);
+    assert(_normalizer);
+    assert(_scenarioRupture >= 0 && size_t(_scenarioRupture) < _ruptures.size());
+
+    srcs_type::iterator r_iter = _ruptures.begin();
+    std::advance(r_iter, _scenarioRupture);
+    KinSrc* src = r_iter->second;assert(src);
+    const PylithReal tFinal = src->getFinalSlipTime();
+    if (tFinal >= pylith::PYLITH_MAXSCALAR) {
+        std::ostringstream msg;
+        msg << "Slip time function of rupture '" << r_iter->first << "' on fault '" << getSurfaceLabelName()
+            << "' does not reach its final slip in a finite time. Static slip scenarios require a slip time function with "
+            << "a finite duration, such as a step, ramp, or Liu cosine.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Discard cached slip from ruptures as a function of time.
+    PetscErrorCode err = 0;
+    err = VecSet(_slipVecFinal, 0.0);PYLITH_CHECK_ERROR(err);
+    _rupturesFinal.clear();
+    _bitSlipSubfieldsFinal = 0;
+
+    err = VecSet(_slipVecTotal, 0.0);PYLITH_CHECK_ERROR(err);
+    src->getSlipSubfields(_slipVecTotal, auxiliaryField, tFinal, _normalizer->getTimeScale(), bitSlipSubfields);
+    _setSlipSubfields(auxiliaryField, bitSlipSubfields);
+
+    PYLITH_METHOD_END;
+} // _updateScenarioSlip
+
+
+// ------------------------------------------------------------------------------------------------
+// Transfer slip values from local PETSc slip vector to auxiliary field.
+void
+pylith::faults::FaultCohesiveKin::_setSlipSubfields(pylith::topology::Field* auxiliaryField,
+                                                    const int bitSlipSubfields) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setSlipSubfields(auxiliaryField="<<auxiliaryField<<", bitSlipSubfields="<<bitSlipSubfields<<")");
+
+    assert(auxiliaryField);
+
+    // Compute the plan for copying slip into the auxiliary field only when the slip subfields or the layout of the
+    // auxiliary field change.
+    if (!_slipScatterPlan) {
+        _slipScatterPlan = new pylith::topology::VecScatterPlanMesh();assert(_slipScatterPlan);
+    } // if
+    if ((bitSlipSubfields != _bitSlipSubfieldsPlan) || !_slipScatterPlan->isCurrent(*auxiliaryField)) {
+        PetscInt subfieldIndices[3];
+        PetscInt numSubfields = 0;
+        if (bitSlipSubfields & KinSrc::GET_SLIP) {
+            subfieldIndices[numSubfields++] = auxiliaryField->getSubfieldInfo("slip").index;
+        } // if
+        if (bitSlipSubfields & KinSrc::GET_SLIP_RATE) {
+            subfieldIndices[numSubfields++] = auxiliaryField->getSubfieldInfo("slip_rate").index;
+        } // if
+        if (bitSlipSubfields & KinSrc::GET_SLIP_ACC) {
+            subfieldIndices[numSubfields++] = auxiliaryField->getSubfieldInfo("slip_acceleration").index;
+        } // if
+        _slipScatterPlan->initialize(*auxiliaryField, subfieldIndices, numSubfields);
+        _bitSlipSubfieldsPlan = bitSlipSubfields;
     } // if
 
     pylith::topology::VecVisitorMesh auxiliaryVisitor(*auxiliaryField);
     PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
 
+    PetscErrorCode err = 0;
     const PylithScalar* slipArray = NULL;
     err = VecGetArrayRead(_slipVecTotal, &slipArray);PYLITH_CHECK_ERROR(err);
-
-    for (PetscInt point = pStart, iSlip = 0; point < pEnd; ++point) {
-        for (PetscInt iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
-            const PetscInt subfieldIndex = subfieldIndices[iSubfield];
-            const PetscInt subfieldDof = auxiliaryVisitor.sectionSubfieldDof(subfieldIndex, point);
-            const PetscInt subfieldOff = auxiliaryVisitor.sectionSubfieldOffset(subfieldIndex, point);
-            for (PetscInt iDof = 0; iDof < subfieldDof; ++iDof, ++iSlip) {
-                auxiliaryArray[subfieldOff+iDof] = slipArray[iSlip];
-            } // for
-        } // for
-    } // for
+    _slipScatterPlan->scatter(auxiliaryArray, slipArray);
     err = VecRestoreArrayRead(_slipVecTotal, &slipArray);PYLITH_CHECK_ERROR(err);
 
     pythia::journal::debug_t debug(pylith::utils::PyreComponent::getName());
@@ -341,7 +606,7 @@ pylith::faults::FaultCohesiveKin::_updateSlip(pylith::topology::Field* auxiliary
     } // if
 
     PYLITH_METHOD_END;
-} // _updateSlip
+} // _setSlipSubfields
 
 
 // ------------------------------------------------------------------------------------------------
@@ -358,15 +623,15 @@ pylith::faults::FaultCohesiveKin::_setKernelsResidual(pylith::feassemble::Integr
     switch (_formulation) {
     case pylith::problems::Physics::QUASISTATIC: {
         // Elasticity equation (displacement) for negative side of the fault.
-        const PetscBdPointFunc f0u_neg = pylith::fekernels::FaultCohesiveKin::f0u_neg;
+        const PetscBdPointFunc f0u_neg = PYLITH_KERNELS(FaultCohesiveKin)::f0u_neg;
         const PetscBdPointFunc f1u_neg = NULL;
 
         // Elasticity equation (displacement) for positive side of the fault.
-        const PetscBdPointFunc f0u_pos = pylith::fekernels::FaultCohesiveKin::f0u_pos;
+        const PetscBdPointFunc f0u_pos = PYLITH_KERNELS(FaultCohesiveKin)::f0u_pos;
         const PetscBdPointFunc f1u_pos = NULL;
 
         // Fault slip constraint equation.
-        const PetscBdPointFunc f0l = pylith::fekernels::FaultCohesiveKin::f0l_slip;
+        const PetscBdPointFunc f0l = PYLITH_KERNELS(FaultCohesiveKin)::f0l_slip;
         const PetscBdPointFunc f1l = NULL;
 
         kernels.resize(3);
@@ -381,19 +646,19 @@ pylith::faults::FaultCohesiveKin::_setKernelsResidual(pylith::feassemble::Integr
     } // QUASISTATIC
     case pylith::problems::Physics::DYNAMIC_IMEX: {
         // Elasticity equation (displacement) for negative side of the fault.
-        const PetscBdPointFunc g0v_neg = pylith::fekernels::FaultCohesiveKin::f0u_neg;
+        const PetscBdPointFunc g0v_neg = PYLITH_KERNELS(FaultCohesiveKin)::f0u_neg;
         const PetscBdPointFunc g1v_neg = NULL;
 
         // Elasticity equation (displacement) for positive side of the fault.
-        const PetscBdPointFunc g0v_pos = pylith::fekernels::FaultCohesiveKin::f0u_pos;
+        const PetscBdPointFunc g0v_pos = PYLITH_KERNELS(FaultCohesiveKin)::f0u_pos;
         const PetscBdPointFunc g1v_pos = NULL;
 
         // Fault slip constraint equation.
-        const PetscBdPointFunc f0l_slip = pylith::fekernels::FaultCohesiveKin::f0l_slip;
+        const PetscBdPointFunc f0l_slip = PYLITH_KERNELS(FaultCohesiveKin)::f0l_slip;
         const PetscBdPointFunc f1l_slip = NULL;
 
         // Fault DAE equation.
-        const PetscBdPointFunc f0l_dae = pylith::fekernels::FaultCohesiveKin::f0l_slipAcc;
+        const PetscBdPointFunc f0l_dae = PYLITH_KERNELS(FaultCohesiveKin)::f0l_slipAcc;
         const PetscBdPointFunc f1l_dae = NULL;
 
         kernels.resize(4);
@@ -429,17 +694,17 @@ pylith::faults::FaultCohesiveKin::_setKernelsJacobian(pylith::feassemble::Integr
     std::vector<JacobianKernels> kernels;
     switch (_formulation) {
     case QUASISTATIC: {
-        const PetscBdPointJac Jf0ul_neg = pylith::fekernels::FaultCohesiveKin::Jf0ul_neg;
+        const PetscBdPointJac Jf0ul_neg = PYLITH_KERNELS(FaultCohesiveKin)::Jf0ul_neg;
         const PetscBdPointJac Jf1ul_neg = NULL;
         const PetscBdPointJac Jf2ul_neg = NULL;
         const PetscBdPointJac Jf3ul_neg = NULL;
 
-        const PetscBdPointJac Jf0ul_pos = pylith::fekernels::FaultCohesiveKin::Jf0ul_pos;
+        const PetscBdPointJac Jf0ul_pos = PYLITH_KERNELS(FaultCohesiveKin)::Jf0ul_pos;
         const PetscBdPointJac Jf1ul_pos = NULL;
         const PetscBdPointJac Jf2ul_pos = NULL;
         const PetscBdPointJac Jf3ul_pos = NULL;
 
-        const PetscBdPointJac Jf0lu = pylith::fekernels::FaultCohesiveKin::Jf0lu;
+        const PetscBdPointJac Jf0lu = PYLITH_KERNELS(FaultCohesiveKin)::Jf0lu;
         const PetscBdPointJac Jf1lu = NULL;
         const PetscBdPointJac Jf2lu = NULL;
         const PetscBdPointJac Jf3lu = NULL;
@@ -456,7 +721,7 @@ pylith::faults::FaultCohesiveKin::_setKernelsJacobian(pylith::feassemble::Integr
         break;
     } // QUASISTATIC
     case pylith::problems::Physics::DYNAMIC_IMEX: {
-        const PetscBdPointJac Jf0lu = pylith::fekernels::FaultCohesiveKin::Jf0lu;
+        const PetscBdPointJac Jf0lu = PYLITH_KERNELS(FaultCohesiveKin)::Jf0lu;
         const PetscBdPointJac Jf1lu = NULL;
         const PetscBdPointJac Jf2lu = NULL;
         const PetscBdPointJac Jf3lu = NULL;
@@ -477,6 +742,9 @@ pylith::faults::FaultCohesiveKin::_setKernelsJacobian(pylith::feassemble::Integr
     assert(integrator);
     integrator->setKernels(kernels, solution, materials);
 
+    // Jacobian kernels depend only on the geometry.
+    integrator->useLHSJacobianCache(true);
+
     PYLITH_METHOD_END;
 } // _setKernelsJacobian
 
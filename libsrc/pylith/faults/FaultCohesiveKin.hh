@@ -30,6 +30,7 @@
 
 #include <string> // HASA std::string
 #include <map> // HASA std::map
+#include <set> // HASA std::set
 
 class pylith::faults::FaultCohesiveKin : public pylith::faults::FaultCohesive {
     friend class TestFaultCohesiveKin; // unit testing
@@ -58,6 +59,21 @@ public:
                        KinSrc** ruptures,
                        const int numRuptures);
 
+    /** Get number of kinematic earthquake ruptures.
+     *
+     * @returns Number of earthquake ruptures.
+     */
+    size_t getNumRuptures(void) const;
+
+    /** Set kinematic earthquake rupture used as a static slip scenario.
+     *
+     * When a scenario rupture is set, the slip subfield contains only the final slip of that rupture, independent of
+     * time. This allows solving a sequence of static slip scenarios with the same mesh and operator.
+     *
+     * @param[in] value Index of rupture (in order of rupture names), -1 to use all ruptures as a function of time.
+     */
+    void setScenarioRupture(const int value);
+
     /** Verify configuration is acceptable.
      *
      * @param[in] solution Solution field.
@@ -101,6 +117,39 @@ protected:
                      const double t,
                      const int bitSlipSubfields);
 
+    /** Setup auxiliary field with subfields of all kinematic ruptures for superposing slip in a single projection.
+     *
+     * The field is created only if there are multiple ruptures and all of them use the same slip time function, which
+     * supports superposition.
+     */
+    void _setupSuperposedRuptures(void);
+
+    /** Compute slip of active ruptures using a single projection of the superposed slip time functions.
+     *
+     * @param[in] auxiliaryField Auxiliary field.
+     * @param[in] t Current time.
+     * @param[in] bitSlipSubfields Slip subfields to compute.
+     */
+    void _computeSuperposedSlip(const pylith::topology::Field& auxiliaryField,
+                                const double t,
+                                const int bitSlipSubfields);
+
+    /** Update slip subfield in auxiliary field with final slip of scenario rupture.
+     *
+     * @param[out] auxiliaryField Auxiliary field.
+     * @param[in] bitSlipSubfields Slip subfields to update.
+     */
+    void _updateScenarioSlip(pylith::topology::Field* auxiliaryField,
+                             const int bitSlipSubfields);
+
+    /** Transfer slip values from local PETSc slip vector to auxiliary field.
+     *
+     * @param[out] auxiliaryField Auxiliary field.
+     * @param[in] bitSlipSubfields Slip subfields to update.
+     */
+    void _setSlipSubfields(pylith::topology::Field* auxiliaryField,
+                           const int bitSlipSubfields);
+
     /** Set kernels for residual.
      *
      * @param[out] integrator Integrator for material.
@@ -133,6 +182,13 @@ protected:
     srcs_type _ruptures; ///< Array of kinematic earthquake ruptures.
     PetscVec _slipVecRupture; ///< PETSc local Vec to hold slip for one kinematic rupture.
     PetscVec _slipVecTotal; ///< PETSc local Vec to hold slip for all kinematic ruptures.
+    PetscVec _slipVecFinal; ///< PETSc local Vec to hold slip for kinematic ruptures with final slip.
+    std::set<std::string> _rupturesFinal; ///< Names of kinematic ruptures included in _slipVecFinal.
+    int _bitSlipSubfieldsFinal; ///< Slip subfields in _slipVecFinal.
+    pylith::topology::Field* _superposedAuxField; ///< Auxiliary subfields of all ruptures for superposing slip.
+    pylith::topology::VecScatterPlanMesh* _slipScatterPlan; ///< Plan for copying slip into auxiliary field.
+    int _bitSlipSubfieldsPlan; ///< Slip subfields in _slipScatterPlan.
+    int _scenarioRupture; ///< Index of rupture used as static slip scenario (-1 for all ruptures).
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
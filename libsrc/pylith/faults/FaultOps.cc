@@ -36,13 +36,15 @@ pylith::faults::FaultOps::createDAEMassWeighting(pylith::feassemble::Integration
     PYLITH_METHOD_BEGIN;
 
     assert(integrationData);
-    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
     const pylith::topology::Field::SubfieldInfo& velocityInfo = solution->getSubfieldInfo("velocity");
     const pylith::topology::Field::SubfieldInfo& lagrangeInfo = solution->getSubfieldInfo("lagrange_multiplier_fault");
 
-    pylith::topology::Mesh* wtMesh = solution->getMesh().clone();
-    pylith::topology::Field* wtField = new pylith::topology::Field(*wtMesh);
+    // The weighting field needs its own layout (velocity and Lagrange multiplier subfields) for the weighted
+    // kernels. The field constructor clones the DM of the solution mesh, which shares the topology and coordinates
+    // with the solution, so only the section and vectors are new.
+    pylith::topology::Field* wtField = new pylith::topology::Field(solution->getMesh());
     wtField->setName("dae_mass_weighting");
     wtField->subfieldAdd(velocityInfo.description, velocityInfo.fe);
     wtField->subfieldAdd(lagrangeInfo.description, lagrangeInfo.fe);
@@ -50,30 +52,28 @@ pylith::faults::FaultOps::createDAEMassWeighting(pylith::feassemble::Integration
     wtField->createDiscretization();
     wtField->allocate();
 
+    // Weights for the Lagrange multiplier subfield are always 1; updateDAEMassWeighting() only sets the weights for
+    // the velocity subfield.
+    PetscErrorCode err = VecSet(wtField->getLocalVector(), 1.0);PYLITH_CHECK_ERROR(err);
+
     const char* dae_mass_weighting = pylith::feassemble::IntegrationData::dae_mass_weighting.c_str();
-    integrationData->setMesh(dae_mass_weighting, wtMesh);
     integrationData->setField(dae_mass_weighting, wtField);
 
-    { // TEMPORARY DEBUGGING
-        solution->view("SOLUTION", pylith::topology::Field::VIEW_LAYOUT);
-        wtField->view("DAE WEIGHTING", pylith::topology::Field::VIEW_LAYOUT);
-    } // TEMPORARY DEBUGGING
-
     PYLITH_METHOD_END;
 } // createDAEMassWeighting
 
 
 // ------------------------------------------------------------------------------------------------
-// Create weighting vector for dynamic prescribed slip DAE.
+// Update weighting vector for dynamic prescribed slip DAE.
 void
 pylith::faults::FaultOps::updateDAEMassWeighting(pylith::feassemble::IntegrationData* integrationData) {
     PYLITH_METHOD_BEGIN;
     PetscErrorCode err;
 
     const pylith::topology::Field* jacobianLumpedInv =
-        integrationData->getField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);assert(jacobianLumpedInv);
+        integrationData->getField(pylith::feassemble::IntegrationData::FIELD_LUMPED_JACOBIAN_INVERSE);assert(jacobianLumpedInv);
     const pylith::topology::Field* weighting =
-        integrationData->getField(pylith::feassemble::IntegrationData::dae_mass_weighting);assert(jacobianLumpedInv);
+        integrationData->getField(pylith::feassemble::IntegrationData::FIELD_DAE_MASS_WEIGHTING);assert(weighting);
 
     const char* velocity = "velocity";
     pylith::topology::VecVisitorMesh domainVisitor(*jacobianLumpedInv, velocity);
@@ -81,7 +81,6 @@ pylith::faults::FaultOps::updateDAEMassWeighting(pylith::feassemble::Integration
     PetscScalar* domainArray = domainVisitor.localArray();
     PetscScalar* faultsArray = faultsVisitor.localArray();
 
-    err = VecSet(weighting->getLocalVector(), 1.0);PYLITH_CHECK_ERROR(err);
     PetscInt pStart = 0;
     PetscInt pEnd = 0;
     err = PetscSectionGetChart(faultsVisitor.selectedSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
@@ -94,14 +93,9 @@ pylith::faults::FaultOps::updateDAEMassWeighting(pylith::feassemble::Integration
             for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
                 faultsArray[faultsOff+iDof] = domainArray[domainOff+iDof];
             } // for
-
         } // if
     } // for
 
-    { // TEMPORARY DEBUGGING
-        weighting->view("DAE WEIGHTING", pylith::topology::Field::VIEW_ALL);
-    } // TEMPORARY DEBUGGING
-
     PYLITH_METHOD_END;
 } // updateDAEMassWeighting
 
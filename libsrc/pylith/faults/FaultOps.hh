@@ -45,6 +45,8 @@ public:
     void createDAEMassWeighting(pylith::feassemble::IntegrationData* integrationData);
 
     /** Update weighting vector for dynamic prescribed slip integration.
+     *
+     * Called only when the inverse of the lumped LHS Jacobian is recomputed.
      *
      * @param[in] integrationData Data for finite-element integration.
      */
@@ -23,12 +23,15 @@
 #include "pylith/faults/KinSrcAuxiliaryFactory.hh" // USES KinSrcAuxiliaryFactory
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/FieldOps.hh" // USES FieldOps::checkDisretization()
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::max()
 #include <typeinfo> // USES typeid()
 #include <cassert> // USES assert()
 
@@ -44,8 +47,12 @@ pylith::faults::KinSrc::KinSrc(void) :
     _slipFnKernel(NULL),
     _slipRateFnKernel(NULL),
     _slipAccFnKernel(NULL),
+    _superposedSlipFnKernel(NULL),
+    _superposedSlipRateFnKernel(NULL),
+    _superposedSlipAccFnKernel(NULL),
     _auxiliaryField(NULL),
-    _originTime(0.0) {}
+    _originTime(0.0),
+    _slipDuration(pylith::PYLITH_MAXSCALAR) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -80,6 +87,14 @@ pylith::faults::KinSrc::getOriginTime(void) const {
 } // originTime
 
 
+// ------------------------------------------------------------------------------------------------
+// Get time when slip reaches its final value at all points of the fault on this process.
+PylithReal
+pylith::faults::KinSrc::getFinalSlipTime(void) const {
+    return (_slipDuration < pylith::PYLITH_MAXSCALAR) ? _originTime + _slipDuration : pylith::PYLITH_MAXSCALAR;
+} // getFinalSlipTime
+
+
 // ------------------------------------------------------------------------------------------------
 // Get auxiliary field.
 const pylith::topology::Field&
@@ -132,6 +147,7 @@ pylith::faults::KinSrc::initialize(const pylith::topology::Field& faultAuxField,
     _auxiliaryField->allocate();
 
     _auxiliaryFactory->setValuesFromDB();
+    _slipDuration = _computeSlipDuration();
 
     pythia::journal::debug_t debug(PyreComponent::getName());
     if (debug.state()) {
@@ -192,6 +208,26 @@ pylith::faults::KinSrc::getSlipSubfields(PetscVec slipLocalVec,
 } // getSlipSubfields
 
 
+// ------------------------------------------------------------------------------------------------
+// Get kernel for superposing slip time function of multiple sources of this type.
+PetscPointFunc
+pylith::faults::KinSrc::getSuperposedKernel(const int bitSlipSubfield) const {
+    if (!_superposedSlipFnKernel) {
+        return NULL;
+    } // if
+
+    PetscPointFunc kernel = NULL;
+    if (bitSlipSubfield == GET_SLIP) {
+        kernel = _superposedSlipFnKernel;
+    } else if (bitSlipSubfield == GET_SLIP_RATE) {
+        kernel = _superposedSlipRateFnKernel;
+    } else if (bitSlipSubfield == GET_SLIP_ACC) {
+        kernel = _superposedSlipAccFnKernel;
+    } // if/else
+    return kernel;
+} // getSuperposedKernel
+
+
 // ------------------------------------------------------------------------------------------------
 // Set constants used in finite-element integrations.
 void
@@ -215,4 +251,46 @@ pylith::faults::KinSrc::_setFEConstants(const pylith::topology::Field& faultAuxF
 } // _setFEConstants
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute maximum time after the origin time when slip reaches its final value on this process.
+PylithReal
+pylith::faults::KinSrc::_computeSlipDuration(void) const {
+    return pylith::PYLITH_MAXSCALAR;
+} // _computeSlipDuration
+
+
+// ------------------------------------------------------------------------------------------------
+// Get maximum over this process of the sum of values of two scalar auxiliary subfields.
+PylithReal
+pylith::faults::KinSrc::_getMaxSubfieldSum(const char* subfieldA,
+                                           const char* subfieldB) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_auxiliaryField);
+    assert(subfieldA);
+
+    PetscErrorCode err = 0;
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(_auxiliaryField->getLocalSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    const PetscInt indexA = _auxiliaryField->getSubfieldInfo(subfieldA).index;
+    const PetscInt indexB = subfieldB ? _auxiliaryField->getSubfieldInfo(subfieldB).index : -1;
+
+    pylith::topology::VecVisitorMesh auxiliaryVisitor(*_auxiliaryField);
+    const PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+
+    PylithReal maxValue = 0.0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt dofA = auxiliaryVisitor.sectionSubfieldDof(indexA, point);
+        const PetscInt offA = auxiliaryVisitor.sectionSubfieldOffset(indexA, point);
+        const PetscInt offB = (indexB >= 0) ? auxiliaryVisitor.sectionSubfieldOffset(indexB, point) : 0;
+        assert(indexB < 0 || dofA == auxiliaryVisitor.sectionSubfieldDof(indexB, point));
+        for (PetscInt iDof = 0; iDof < dofA; ++iDof) {
+            const PylithReal value = auxiliaryArray[offA+iDof] + ((indexB >= 0) ? auxiliaryArray[offB+iDof] : 0.0);
+            maxValue = std::max(maxValue, value);
+        } // for
+    } // for
+
+    PYLITH_METHOD_RETURN(maxValue);
+} // _getMaxSubfieldSum
+
+
 // End of file
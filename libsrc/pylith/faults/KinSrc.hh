@@ -38,6 +38,8 @@
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
 #include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
 
+#include <cassert> // USES assert()
+
 // KinSrc -------------------------------------------------------------
 /** @brief Kinematic earthquake source.
  *
@@ -82,6 +84,14 @@ public:
      */
     PylithReal getOriginTime(void) const;
 
+    /** Get time when slip reaches its final value at all points of the fault on this process.
+     *
+     * After this time the slip is constant and the slip rate and slip acceleration are zero.
+     *
+     * @returns Time when slip reaches final value (PYLITH_MAXSCALAR if slip never reaches a final value).
+     */
+    PylithReal getFinalSlipTime(void) const;
+
     /** Get auxiliary field associated with the kinematic source.
      *
      * @return field Auxiliary field for the kinematic source.
@@ -119,6 +129,58 @@ public:
                           const PylithScalar timeScale,
                           const int bitSlipSubfields);
 
+    /** Get kernel for superposing slip time function of multiple sources of this type.
+     *
+     * @param[in] bitSlipSubfield Slip subfield (GET_SLIP, GET_SLIP_RATE, or GET_SLIP_ACC).
+     *
+     * @returns Kernel for superposing slip time function (NULL if slip of source cannot be superposed).
+     */
+    PetscPointFunc getSuperposedKernel(const int bitSlipSubfield) const;
+
+    /** Superpose slip time function of multiple sources of the same type.
+     *
+     * The auxiliary field contains the subfields of each source in turn, and the constants contain the origin time
+     * of each source. The result is the sum of the slip time function kernel `fn` over the sources.
+     */
+    template<PetscPointFunc fn>
+    static
+    void superposeFn(const PylithInt dim,
+                     const PylithInt numS,
+                     const PylithInt numA,
+                     const PylithInt sOff[],
+                     const PylithInt sOff_x[],
+                     const PylithScalar s[],
+                     const PylithScalar s_t[],
+                     const PylithScalar s_x[],
+                     const PylithInt aOff[],
+                     const PylithInt aOff_x[],
+                     const PylithScalar a[],
+                     const PylithScalar a_t[],
+                     const PylithScalar a_x[],
+                     const PylithReal t,
+                     const PylithScalar x[],
+                     const PylithInt numConstants,
+                     const PylithScalar constants[],
+                     PylithScalar slip[]) {
+        assert(numConstants > 0);
+        assert(0 == numA % numConstants);
+        assert(dim <= 3);
+
+        const PylithInt numASource = numA / numConstants;
+        PylithScalar slipSource[3];
+        for (PylithInt i = 0; i < dim; ++i) {
+            slip[i] = 0.0;
+        } // for
+        for (PylithInt iSource = 0; iSource < numConstants; ++iSource) {
+            const PylithInt offset = iSource * numASource;
+            fn(dim, numS, numASource, sOff, sOff_x, s, s_t, s_x, &aOff[offset], aOff_x ? &aOff_x[offset] : NULL,
+               a, a_t, a_x, t, x, 1, &constants[iSource], slipSource);
+            for (PylithInt i = 0; i < dim; ++i) {
+                slip[i] += slipSource[i];
+            } // for
+        } // for
+    } // superposeFn
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -145,6 +207,25 @@ protected:
      */
     void _setFEConstants(const pylith::topology::Field& auxField) const;
 
+    /** Compute maximum time after the origin time when slip reaches its final value on this process.
+     *
+     * Default is that slip never reaches a final value.
+     *
+     * @returns Maximum time relative to origin time when slip reaches final value.
+     */
+    virtual
+    PylithReal _computeSlipDuration(void) const;
+
+    /** Get maximum over this process of the sum of values of two scalar auxiliary subfields.
+     *
+     * @param[in] subfieldA Name of first subfield.
+     * @param[in] subfieldB Name of second subfield (NULL if only using first subfield).
+     *
+     * @returns Maximum of sum of subfield values (0 if no points on this process).
+     */
+    PylithReal _getMaxSubfieldSum(const char* subfieldA,
+                                  const char* subfieldB) const;
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -152,12 +233,16 @@ protected:
     PetscPointFunc _slipFnKernel; ///< Kernel for slip time function.
     PetscPointFunc _slipRateFnKernel; ///< Kernel for slip rate time function.
     PetscPointFunc _slipAccFnKernel; ///< Kernel for slip acceleration time function.
+    PetscPointFunc _superposedSlipFnKernel; ///< Kernel for superposed slip time function.
+    PetscPointFunc _superposedSlipRateFnKernel; ///< Kernel for superposed slip rate time function.
+    PetscPointFunc _superposedSlipAccFnKernel; ///< Kernel for superposed slip acceleration time function.
     pylith::topology::Field* _auxiliaryField; ///< Auxiliary field for this integrator.
 
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
     PylithReal _originTime; ///< Origin time for earthquake source
+    PylithReal _slipDuration; ///< Time after origin time when slip reaches final value.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
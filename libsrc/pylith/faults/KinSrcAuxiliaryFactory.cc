@@ -23,6 +23,7 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/FieldQuery.hh" // HOLDSA FieldQuery
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/TimeHistoryQuery.hh" // USES TimeHistoryQuery
 
 #include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -217,55 +218,25 @@ void
 pylith::faults::KinSrcAuxiliaryFactory::updateTimeHistoryValue(pylith::topology::Field* auxiliaryField,
                                                                const PylithReal t,
                                                                const PylithReal timeScale,
-                                                               spatialdata::spatialdb::TimeHistory* const dbTimeHistory) {
+                                                               spatialdata::spatialdb::TimeHistory* const dbTimeHistory,
+                                                               pylith::topology::TimeHistoryQuery* const timeHistoryQuery) {
     PYLITH_METHOD_BEGIN;
     pythia::journal::debug_t debug("kinsrcauxiliaryfactory");
     debug << pythia::journal::at(__HERE__)
           << "KinSrcAuxiliaryFactory::updateTimeHistoryValue(auxiliaryField="<<auxiliaryField<<", t="<<t
-          <<", timeScale="<<timeScale<<", dbTimeHistory="<<dbTimeHistory<<")"
+          <<", timeScale="<<timeScale<<", dbTimeHistory="<<dbTimeHistory<<", timeHistoryQuery="<<timeHistoryQuery<<")"
           << pythia::journal::endl;
 
     assert(auxiliaryField);
     assert(dbTimeHistory);
 
-    PetscErrorCode err = 0;
-
-    PetscSection auxiliaryFieldSection = auxiliaryField->getLocalSection();assert(auxiliaryFieldSection);
-    PetscInt pStart = 0, pEnd = 0;
-    err = PetscSectionGetChart(auxiliaryFieldSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
-    pylith::topology::VecVisitorMesh auxiliaryFieldVisitor(*auxiliaryField);
-    PetscScalar* auxiliaryFieldArray = auxiliaryFieldVisitor.localArray();assert(auxiliaryFieldArray);
-
-    // Compute offset of time history subfields in auxiliary field.
-    const PetscInt i_startTime = auxiliaryField->getSubfieldInfo("initiation_time").index;
-    const PetscInt i_value = auxiliaryField->getSubfieldInfo("time_history_value").index;
-
-    // Loop over all points in section.
-    for (PetscInt p = pStart; p < pEnd; ++p) {
-        // Skip points without values in section.
-        if (!auxiliaryFieldVisitor.sectionDof(p)) {continue;}
-
-        // Get starting time and compute relative time for point.
-        const PetscInt offStartTime = auxiliaryFieldVisitor.sectionSubfieldOffset(i_startTime, p);
-        const PylithScalar tStart = auxiliaryFieldArray[offStartTime];
-        const PylithScalar tRel = t - tStart;
-
-        // Query time history for value (normalized amplitude).
-        PylithScalar value = 0.0;
-        if (tRel >= 0.0) {
-            PylithScalar tDim = tRel * timeScale;
-            const int err = dbTimeHistory->query(&value, tDim);
-            if (err) {
-                std::ostringstream msg;
-                msg << "Error querying for time '" << tDim << "' in time history database '" << dbTimeHistory->getDescription() << "'.";
-                throw std::runtime_error(msg.str());
-            } // if
-        } // if
-
-        // Update value (normalized amplitude) in auxiliary field.
-        const PetscInt offValue = auxiliaryFieldVisitor.sectionSubfieldOffset(i_value, p);
-        auxiliaryFieldArray[offValue] = value;
-    } // for
+    // Queries of time history are cached across time steps if a cached time history query is provided.
+    if (timeHistoryQuery) {
+        timeHistoryQuery->update(auxiliaryField, t, timeScale, dbTimeHistory);
+    } else {
+        pylith::topology::TimeHistoryQuery query("initiation_time", "time_history_value");
+        query.update(auxiliaryField, t, timeScale, dbTimeHistory);
+    } // if/else
 
     PYLITH_METHOD_END;
 } // updateAuilixaryField
@@ -63,12 +63,14 @@ public:
      * @param[in] t Current time.
      * @param[in] timeScale Time scale for nondimensionalization.
      * @param[in] dbTimeHistory Time history database.
+     * @param[inout] timeHistoryQuery Cached time history query for auxiliary field (optional).
      */
     static
     void updateTimeHistoryValue(pylith::topology::Field* auxiliaryField,
                                 const PylithReal t,
                                 const PylithReal timeScale,
-                                spatialdata::spatialdb::TimeHistory* const dbTimeHistory);
+                                spatialdata::spatialdb::TimeHistory* const dbTimeHistory,
+                                pylith::topology::TimeHistoryQuery* const timeHistoryQuery=NULL);
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
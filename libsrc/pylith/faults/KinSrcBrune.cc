@@ -234,6 +234,9 @@ pylith::faults::KinSrcBrune::_auxiliaryFieldSetup(const spatialdata::units::Nond
     _slipFnKernel = pylith::faults::KinSrcBrune::slipFn;
     _slipRateFnKernel = pylith::faults::KinSrcBrune::slipRateFn;
 
+    _superposedSlipFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcBrune::slipFn>;
+    _superposedSlipRateFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcBrune::slipRateFn>;
+
     PYLITH_METHOD_END;
 } // _auxiliaryFieldSetup
 
@@ -196,6 +196,10 @@ pylith::faults::KinSrcConstRate::_auxiliaryFieldSetup(const spatialdata::units::
     _slipRateFnKernel = pylith::faults::KinSrcConstRate::slipRateFn;
     _slipAccFnKernel = pylith::faults::KinSrcConstRate::slipAccFn;
 
+    _superposedSlipFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcConstRate::slipFn>;
+    _superposedSlipRateFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcConstRate::slipRateFn>;
+    _superposedSlipAccFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcConstRate::slipAccFn>;
+
     PYLITH_METHOD_END;
 } // _auxiliaryFieldSetup
 
@@ -298,8 +298,21 @@ pylith::faults::KinSrcLiuCos::_auxiliaryFieldSetup(const spatialdata::units::Non
     _slipRateFnKernel = pylith::faults::KinSrcLiuCos::slipRateFn;
     _slipAccFnKernel = pylith::faults::KinSrcLiuCos::slipAccFn;
 
+    _superposedSlipFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcLiuCos::slipFn>;
+    _superposedSlipRateFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcLiuCos::slipRateFn>;
+    _superposedSlipAccFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcLiuCos::slipAccFn>;
+
     PYLITH_METHOD_END;
 } // _auxiliaryFieldSetup
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute maximum time after the origin time when slip reaches its final value on this process.
+PylithReal
+pylith::faults::KinSrcLiuCos::_computeSlipDuration(void) const {
+    // Slip reaches its final value at the initiation time plus the rise time.
+    return _getMaxSubfieldSum("initiation_time", "rise_time");
+} // _computeSlipDuration
+
+
 // End of file
@@ -321,10 +321,23 @@ pylith::faults::KinSrcRamp::_auxiliaryFieldSetup(const spatialdata::units::Nondi
     _slipRateFnKernel = pylith::faults::KinSrcRamp::slipRateFn;
     _slipAccFnKernel = pylith::faults::KinSrcRamp::slipAccFn;
 
+    _superposedSlipFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcRamp::slipFn>;
+    _superposedSlipRateFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcRamp::slipRateFn>;
+    _superposedSlipAccFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcRamp::slipAccFn>;
+
     PYLITH_METHOD_END;
 } // _auxiliaryFieldSetup
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute maximum time after the origin time when slip reaches its final value on this process.
+PylithReal
+pylith::faults::KinSrcRamp::_computeSlipDuration(void) const {
+    // Slip reaches its final value at the initiation time plus the rise time.
+    return _getMaxSubfieldSum("initiation_time", "rise_time");
+} // _computeSlipDuration
+
+
 // ------------------------------------------------------------------------------------------------
 // Maximum value of acceleration impulse in smoothed ramp slip time function.
 double
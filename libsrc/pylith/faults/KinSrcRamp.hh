@@ -192,6 +192,12 @@ protected:
     void _auxiliaryFieldSetup(const spatialdata::units::Nondimensional& normalizer,
                               const spatialdata::geocoords::CoordSys* cs);
 
+    /** Compute maximum time after the origin time when slip reaches its final value on this process.
+     *
+     * @returns Maximum time relative to origin time when slip reaches final value.
+     */
+    PylithReal _computeSlipDuration(void) const;
+
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
@@ -114,8 +114,19 @@ pylith::faults::KinSrcStep::_auxiliaryFieldSetup(const spatialdata::units::Nondi
     _slipRateFnKernel = NULL; // Undefined for step function.
     _slipAccFnKernel = NULL; // Undefined for step function.
 
+    _superposedSlipFnKernel = pylith::faults::KinSrc::superposeFn<pylith::faults::KinSrcStep::slipFn>;
+
     PYLITH_METHOD_END;
 } // _auxiliaryFieldSetup
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute maximum time after the origin time when slip reaches its final value on this process.
+PylithReal
+pylith::faults::KinSrcStep::_computeSlipDuration(void) const {
+    // Slip reaches its final value at the initiation time.
+    return _getMaxSubfieldSum("initiation_time", NULL);
+} // _computeSlipDuration
+
+
 // End of file
@@ -21,6 +21,7 @@
 #include "KinSrcTimeHistory.hh" // implementation of object methods
 
 #include "pylith/faults/KinSrcAuxiliaryFactory.hh" // USES KinSrcAuxiliaryFactory
+#include "pylith/topology/TimeHistoryQuery.hh" // USES TimeHistoryQuery
 
 #include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory#include <cassert> // USES assert()
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
@@ -31,7 +32,8 @@
 // ------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::faults::KinSrcTimeHistory::KinSrcTimeHistory(void) :
-    _dbTimeHistory(NULL) {
+    _dbTimeHistory(NULL),
+    _timeHistoryQuery(NULL) {
     pylith::utils::PyreComponent::setName("kinsrctimehistory");
 } // constructor
 
@@ -40,6 +42,7 @@ pylith::faults::KinSrcTimeHistory::KinSrcTimeHistory(void) :
 // Destructor.
 pylith::faults::KinSrcTimeHistory::~KinSrcTimeHistory(void) {
     _dbTimeHistory = NULL; // :KLUDGE: Use shared pointer.
+    delete _timeHistoryQuery;_timeHistoryQuery = NULL;
 } // destructor
 
 
@@ -73,7 +76,7 @@ pylith::faults::KinSrcTimeHistory::getSlipSubfields(PetscVec slipLocalVec,
     PYLITH_COMPONENT_DEBUG("getSlipSubfields="<<slipLocalVec<<", faultAuxiliaryField="<<faultAuxiliaryField
                                               <<", t="<<t<<", timeScale="<<timeScale
                                               <<", bitSlipSubfields="<<bitSlipSubfields<<")");
-    KinSrcAuxiliaryFactory::updateTimeHistoryValue(_auxiliaryField, t, timeScale, _dbTimeHistory);
+    KinSrcAuxiliaryFactory::updateTimeHistoryValue(_auxiliaryField, t, timeScale, _dbTimeHistory, _timeHistoryQuery);
     KinSrc::getSlipSubfields(slipLocalVec, faultAuxiliaryField, t, timeScale, bitSlipSubfields);
 
     PYLITH_METHOD_END;
@@ -257,6 +260,8 @@ pylith::faults::KinSrcTimeHistory::_auxiliaryFieldSetup(const spatialdata::units
 
     assert(_dbTimeHistory);
     _dbTimeHistory->open();
+    delete _timeHistoryQuery;
+    _timeHistoryQuery = new pylith::topology::TimeHistoryQuery("initiation_time", "time_history_value");
 
     _slipFnKernel = pylith::faults::KinSrcTimeHistory::slipFn;
     _slipRateFnKernel = pylith::faults::KinSrcTimeHistory::slipRateFn;
@@ -208,6 +208,7 @@ protected:
 private:
 
     spatialdata::spatialdb::TimeHistory* _dbTimeHistory; ///< Time history database.
+    pylith::topology::TimeHistoryQuery* _timeHistoryQuery; ///< Cached query of time history database.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
@@ -25,8 +25,33 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
 #include <iostream> // USES std::cout
+#include <algorithm> // USES std::find()
+#include <vector> // USES std::vector
 #include <cassert> // USES assert()
 
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace faults {
+        class _TopologyOps {
+public:
+
+            /** Create chart-sized bitmap of points with a nonnegative value in a label.
+             *
+             * @param[out] bt Bitmap with bit (point - pStart) set for points in label.
+             * @param[in] label PETSc DM label.
+             * @param[in] pStart First point in chart.
+             * @param[in] pEnd Upper bound of points in chart.
+             */
+            static
+            void createLabelBitmap(PetscBT* bt,
+                                   PetscDMLabel label,
+                                   const PetscInt pStart,
+                                   const PetscInt pEnd);
+
+        }; // _TopologyOps
+    } // faults
+} // pylith
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::faults::TopologyOps::createFault(pylith::topology::Mesh* faultMesh,
@@ -140,6 +165,14 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
         const PetscInt *bd;
         PetscInt fStart, fEnd, n, i;
 
+        // Membership in the labels is checked for every edge around the vertices of each boundary face, so we use
+        // chart-sized bitmaps instead of label queries.
+        PetscInt pStart = 0, pEnd = 0;
+        PetscBT inLabel = NULL, inBdLabel = NULL;
+        err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        _TopologyOps::createLabelBitmap(&inLabel, label, pStart, pEnd);
+        _TopologyOps::createLabelBitmap(&inBdLabel, faultBdLabel, pStart, pEnd);
+
         err = DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
         err = DMLabelGetStratumIS(faultBdLabel, faultBdLabelValue, &bdIS);PYLITH_CHECK_ERROR(err);
         err = ISGetLocalSize(bdIS, &n);PYLITH_CHECK_ERROR(err);
@@ -150,10 +183,11 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
             // Remove faces
             if ((p >= fStart) && (p < fEnd)) {
                 const PetscInt *edges,   *verts, *supportA, *supportB;
-                PetscInt numEdges, numVerts, supportSizeA, sA, supportSizeB, sB, val, bval, e, s;
+                PetscInt numEdges, numVerts, supportSizeA, sA, supportSizeB, sB, e, s;
                 PetscBool found = PETSC_FALSE;
 
                 err = DMLabelClearValue(faultBdLabel, p, faultBdLabelValue);PYLITH_CHECK_ERROR(err);
+                err = PetscBTClear(inBdLabel, p-pStart);PYLITH_CHECK_ERROR(err);
                 // Remove the cross edge
                 err = DMPlexGetCone(dm, p, &edges);PYLITH_CHECK_ERROR(err);
                 err = DMPlexGetConeSize(dm, p, &numEdges);PYLITH_CHECK_ERROR(err);
@@ -173,19 +207,20 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
                     err = DMPlexGetSupportSize(dm, verts[0], &supportSizeA);PYLITH_CHECK_ERROR(err);
                     err = DMPlexGetSupport(dm, verts[0], &supportA);PYLITH_CHECK_ERROR(err);
                     for (s = 0, sA = 0; s < supportSizeA; ++s) {
-                        err = DMLabelGetValue(label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
-                        err = DMLabelGetValue(faultBdLabel, supportA[s], &bval);PYLITH_CHECK_ERROR(err);
-                        if (( val >= 0) && ( bval >= 0) ) { ++sA;}
+                        if (PetscBTLookup(inLabel, supportA[s]-pStart) && PetscBTLookup(inBdLabel, supportA[s]-pStart)) { ++sA;}
                     }
                     err = DMPlexGetSupportSize(dm, verts[1], &supportSizeB);PYLITH_CHECK_ERROR(err);
                     err = DMPlexGetSupport(dm, verts[1], &supportB);PYLITH_CHECK_ERROR(err);
                     for (s = 0, sB = 0; s < supportSizeB; ++s) {
-                        err = DMLabelGetValue(label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
-                        err = DMLabelGetValue(faultBdLabel, supportB[s], &bval);PYLITH_CHECK_ERROR(err);
-                        if (( val >= 0) && ( bval >= 0) ) { ++sB;}
+                        if (PetscBTLookup(inLabel, supportB[s]-pStart) && PetscBTLookup(inBdLabel, supportB[s]-pStart)) { ++sB;}
                     }
                     if ((sA > 2) && (sB > 2)) {
+                        PetscInt bval = -1;
+                        err = DMLabelGetValue(faultBdLabel, edges[e], &bval);PYLITH_CHECK_ERROR(err);
                         err = DMLabelClearValue(faultBdLabel, edges[e], faultBdLabelValue);PYLITH_CHECK_ERROR(err);
+                        if (bval == faultBdLabelValue) {
+                            err = PetscBTClear(inBdLabel, edges[e]-pStart);PYLITH_CHECK_ERROR(err);
+                        } // if
                         found = PETSC_TRUE;
                         break;
                     }
@@ -199,6 +234,8 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
         }
         err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
         err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
+        err = PetscBTDestroy(&inLabel);PYLITH_CHECK_ERROR(err);
+        err = PetscBTDestroy(&inBdLabel);PYLITH_CHECK_ERROR(err);
     }
     // Completes the set of cells scheduled to be replaced
     err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, faultBdLabelValue, PETSC_FALSE, faultMesh.getDM());PYLITH_CHECK_ERROR(err);
@@ -277,9 +314,10 @@ pylith::faults::TopologyOps::classifyCellsDM(PetscDM dmMesh,
                                              PointSet& replaceCells,
                                              PointSet& noReplaceCells,
                                              const int debug) {
-    // Replace all cells on a given side of the fault with a vertex on the fault
-    PointSet vReplaceCells;
-    PointSet vNoReplaceCells;
+    // Replace all cells on a given side of the fault with a vertex on the fault. The cells classified for this
+    // vertex are limited to its support, so small unsorted vectors are faster than tree-based sets.
+    std::vector<PetscInt> vReplaceCells;
+    std::vector<PetscInt> vNoReplaceCells;
     const PetscInt *support;
     PetscInt supportSize, s, classifyTotal = 0;
     PetscBool modified = PETSC_FALSE;
@@ -292,8 +330,8 @@ pylith::faults::TopologyOps::classifyCellsDM(PetscDM dmMesh,
         const PetscInt point = support[s];
 
         if (point >= firstCohesiveCell) { return;}
-        if (replaceCells.find(point)   != replaceCells.end()) {vReplaceCells.insert(point);}
-        if (noReplaceCells.find(point) != noReplaceCells.end()) { vNoReplaceCells.insert(point);}
+        if (replaceCells.find(point)   != replaceCells.end()) {vReplaceCells.push_back(point);}
+        if (noReplaceCells.find(point) != noReplaceCells.end()) { vNoReplaceCells.push_back(point);}
         modified = PETSC_TRUE;
         ++classifyTotal;
     }
@@ -316,11 +354,11 @@ pylith::faults::TopologyOps::classifyCellsDM(PetscDM dmMesh,
                     std::cout << "  cone point " << cone[c] << std::endl;
                 }
             }
-            if (vReplaceCells.find(point) != vReplaceCells.end()) {
+            if (std::find(vReplaceCells.begin(), vReplaceCells.end(), point) != vReplaceCells.end()) {
                 if (debug) { std::cout << "  already in replaceCells" << std::endl;}
                 continue;
             } // if
-            if (vNoReplaceCells.find(point) != vNoReplaceCells.end()) {
+            if (std::find(vNoReplaceCells.begin(), vNoReplaceCells.end(), point) != vNoReplaceCells.end()) {
                 if (debug) { std::cout << "  already in noReplaceCells" << std::endl;}
                 continue;
             } // if
@@ -329,7 +367,7 @@ pylith::faults::TopologyOps::classifyCellsDM(PetscDM dmMesh,
                 continue;
             } // if
               // If neighbor shares a face with anyone in replaceCells, then add
-            for (PointSet::const_iterator c_iter = vReplaceCells.begin(); c_iter != vReplaceCells.end(); ++c_iter) {
+            for (std::vector<PetscInt>::const_iterator c_iter = vReplaceCells.begin(); c_iter != vReplaceCells.end(); ++c_iter) {
                 const PetscInt *coveringPoints;
                 PetscInt numCoveringPoints, points[2];
 
@@ -338,7 +376,7 @@ pylith::faults::TopologyOps::classifyCellsDM(PetscDM dmMesh,
                 err = DMPlexRestoreMeet(dmMesh, 2, points, &numCoveringPoints, &coveringPoints);PYLITH_CHECK_ERROR(err);
                 if (numCoveringPoints == faceSize) {
                     if (debug) { std::cout << "    Scheduling " << point << " for replacement" << std::endl;}
-                    vReplaceCells.insert(point);
+                    vReplaceCells.push_back(point);
                     modified = PETSC_TRUE;
                     classified = PETSC_TRUE;
                     break;
@@ -346,7 +384,7 @@ pylith::faults::TopologyOps::classifyCellsDM(PetscDM dmMesh,
             } // for
             if (classified) { continue;}
             // It is unclear whether taking out the noReplace cells will speed this up
-            for (PointSet::const_iterator c_iter = vNoReplaceCells.begin(); c_iter != vNoReplaceCells.end(); ++c_iter) {
+            for (std::vector<PetscInt>::const_iterator c_iter = vNoReplaceCells.begin(); c_iter != vNoReplaceCells.end(); ++c_iter) {
                 const PetscInt *coveringPoints;
                 PetscInt numCoveringPoints, points[2];
 
@@ -355,7 +393,7 @@ pylith::faults::TopologyOps::classifyCellsDM(PetscDM dmMesh,
                 err = DMPlexRestoreMeet(dmMesh, 2, points, &numCoveringPoints, &coveringPoints);PYLITH_CHECK_ERROR(err);
                 if (numCoveringPoints == faceSize) {
                     if (debug) { std::cout << "    Scheduling " << point << " for no replacement" << std::endl;}
-                    vNoReplaceCells.insert(point);
+                    vNoReplaceCells.push_back(point);
                     modified = PETSC_TRUE;
                     classified = PETSC_TRUE;
                     break;
@@ -464,4 +502,47 @@ pylith::faults::TopologyOps::getAdjacentCells(PylithInt* adjacentCellNegative,
 } // getAdjacentCells
 
 
+// ------------------------------------------------------------------------------------------------
+// Create chart-sized bitmap of points with a nonnegative value in a label.
+void
+pylith::faults::_TopologyOps::createLabelBitmap(PetscBT* bt,
+                                                PetscDMLabel label,
+                                                const PetscInt pStart,
+                                                const PetscInt pEnd) {
+    PYLITH_METHOD_BEGIN;
+    assert(bt);
+    assert(label);
+
+    PetscErrorCode err = PetscBTCreate(pEnd-pStart, bt);PYLITH_CHECK_ERROR(err);
+    PetscIS valuesIS = NULL;
+    PetscInt numValues = 0;
+    const PetscInt* values = NULL;
+    err = DMLabelGetValueIS(label, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue = 0; iValue < numValues; ++iValue) {
+        if (values[iValue] < 0) { continue; }
+
+        PetscIS pointsIS = NULL;
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = DMLabelGetStratumIS(label, values[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+        if (!pointsIS) { continue; }
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            if ((points[iPoint] >= pStart) && (points[iPoint] < pEnd)) {
+                err = PetscBTSet(*bt, points[iPoint]-pStart);PYLITH_CHECK_ERROR(err);
+            } // if
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // createLabelBitmap
+
+
 // End of file
@@ -28,13 +28,61 @@
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD*
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL*
 
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5
+
 #include <cassert>
+#include <fstream> // USES std::ifstream
+#include <iomanip> // USES std::setw()
+#include <sstream> // USES std::ostringstream
+#include <stdint.h> // USES uint64_t
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace feassemble {
+        class _AuxiliaryFactory {
+public:
+
+            /** Update 64-bit FNV-1a hash with bytes.
+             *
+             * @param[inout] hash Current hash value.
+             * @param[in] data Bytes to add to hash.
+             * @param[in] numBytes Number of bytes.
+             */
+            static
+            void hashBytes(uint64_t* hash,
+                           const void* data,
+                           const size_t numBytes);
+
+            /** Update 64-bit FNV-1a hash with string (including length).
+             *
+             * @param[inout] hash Current hash value.
+             * @param[in] value String to add to hash.
+             */
+            static
+            void hashString(uint64_t* hash,
+                            const std::string& value);
+
+            static const uint64_t hashOffset; ///< FNV-1a offset basis.
+            static const uint64_t hashPrime; ///< FNV-1a prime.
+            static const char* datasetName; ///< Name of dataset with subfield values in cache file.
+            static const char* keyName; ///< Name of attribute with cache key.
+
+        }; // _AuxiliaryFactory
+    } // feassemble
+} // pylith
+
+const uint64_t pylith::feassemble::_AuxiliaryFactory::hashOffset = 14695981039346656037ULL;
+const uint64_t pylith::feassemble::_AuxiliaryFactory::hashPrime = 1099511628211ULL;
+const char* pylith::feassemble::_AuxiliaryFactory::datasetName = "auxiliary_field";
+const char* pylith::feassemble::_AuxiliaryFactory::keyName = "cache_key";
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::feassemble::AuxiliaryFactory::AuxiliaryFactory(void) :
     _queryDB(NULL),
-    _fieldQuery(NULL) {
+    _fieldQuery(NULL),
+    _cacheFilename(""),
+    _cacheDBKey("") {
     GenericComponent::setName("auxiliaryfactory");
 } // constructor
 
@@ -64,6 +112,29 @@ pylith::feassemble::AuxiliaryFactory::getQueryDB(void) const {
 } // getQueryDB
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set file for caching auxiliary subfield values.
+void
+pylith::feassemble::AuxiliaryFactory::setCache(const char* filename,
+                                               const char* dbKey) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setCache(filename="<<filename<<", dbKey="<<dbKey<<")");
+
+    _cacheFilename = filename ? filename : "";
+    _cacheDBKey = dbKey ? dbKey : "";
+
+    PYLITH_METHOD_END;
+} // setCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get file for caching auxiliary subfield values.
+const char*
+pylith::feassemble::AuxiliaryFactory::getCacheFilename(void) const {
+    return _cacheFilename.c_str();
+} // getCacheFilename
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialie factory for setting up auxiliary subfields.
 void
@@ -92,9 +163,15 @@ pylith::feassemble::AuxiliaryFactory::setValuesFromDB(void) {
 
     if (_queryDB) {
         assert(_fieldQuery);
-        _fieldQuery->openDB(_queryDB, _normalizer->getLengthScale());
-        _fieldQuery->queryDB();
-        _fieldQuery->closeDB(_queryDB);
+        const std::string cacheKey = _cacheFilename.length() > 0 ? _getCacheKey() : "";
+        if (cacheKey.empty() || !_readCache(cacheKey)) {
+            _fieldQuery->openDB(_queryDB, _normalizer->getLengthScale());
+            _fieldQuery->queryDB();
+            _fieldQuery->closeDB(_queryDB);
+            if (!cacheKey.empty()) {
+                _writeCache(cacheKey);
+            } // if
+        } // if
     } else {
         PYLITH_JOURNAL_ERROR("Unknown case for filling auxiliary subfields.");
         throw std::logic_error("Unknown case for filling auxiliary subfields.");
@@ -127,4 +204,221 @@ pylith::feassemble::AuxiliaryFactory::setSubfieldQuery(const char* subfieldName,
 } // _setSubfieldQueryFn
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set query function for subfield using converter functions that report errors via codes.
+void
+pylith::feassemble::AuxiliaryFactory::setSubfieldQuery(const char* subfieldName,
+                                                       const char* namesDBValues[],
+                                                       const size_t numDBValues,
+                                                       const pylith::topology::FieldQuery::Converter& converter,
+                                                       spatialdata::spatialdb::SpatialDB* db) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setSubfieldQuery(subfieldName="<<subfieldName<<", namesDBValues="<<namesDBValues<<", numDBValues="<<numDBValues<<", converter="<<converter.point<<", db="<<db<<")");
+
+    assert(_fieldQuery);
+    _fieldQuery->setQuery(subfieldName, namesDBValues, numDBValues, converter, db);
+
+    PYLITH_METHOD_END;
+} // setSubfieldQuery
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute key identifying cached subfield values.
+std::string
+pylith::feassemble::AuxiliaryFactory::_getCacheKey(void) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+    assert(_normalizer);
+
+    uint64_t hash = _AuxiliaryFactory::hashOffset;
+    _AuxiliaryFactory::hashString(&hash, _cacheDBKey);
+
+    const PylithReal scales[5] = {
+        _normalizer->getLengthScale(),
+        _normalizer->getTimeScale(),
+        _normalizer->getPressureScale(),
+        _normalizer->getDensityScale(),
+        _normalizer->getTemperatureScale(),
+    };
+    _AuxiliaryFactory::hashBytes(&hash, scales, sizeof(scales));
+
+    const pylith::string_vector& subfieldNames = _field->getSubfieldNames();
+    for (size_t i = 0; i < subfieldNames.size(); ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = _field->getSubfieldInfo(subfieldNames[i].c_str());
+        const pylith::topology::FieldBase::Discretization& fe = info.fe;
+        const int intValues[9] = {
+            info.index,
+            int(info.description.numComponents),
+            fe.basisOrder,
+            fe.quadOrder,
+            fe.dimension,
+            int(fe.cellBasis),
+            int(fe.feSpace),
+            int(fe.isBasisContinuous),
+            int(fe.isFaultOnly),
+        };
+        _AuxiliaryFactory::hashString(&hash, subfieldNames[i]);
+        _AuxiliaryFactory::hashBytes(&hash, intValues, sizeof(intValues));
+        _AuxiliaryFactory::hashBytes(&hash, &info.description.scale, sizeof(info.description.scale));
+    } // for
+
+    // Local layout and vertex coordinates identify the mesh and its partition.
+    PetscErrorCode err;
+    PetscDM dm = _field->getDM();
+    MPI_Comm comm = PetscObjectComm((PetscObject) dm);
+    PetscMPIInt commRank = 0, commSize = 0;
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+    uint64_t hashLocal = _AuxiliaryFactory::hashOffset;
+    _AuxiliaryFactory::hashBytes(&hashLocal, &commRank, sizeof(commRank));
+    const PylithInt storageSize = _field->getStorageSize();
+    _AuxiliaryFactory::hashBytes(&hashLocal, &storageSize, sizeof(storageSize));
+
+    PetscVec coordsVec = NULL;
+    PetscInt coordsSize = 0;
+    const PetscScalar* coordsArray = NULL;
+    err = DMGetCoordinatesLocal(dm, &coordsVec);PYLITH_CHECK_ERROR(err);
+    if (coordsVec) {
+        err = VecGetLocalSize(coordsVec, &coordsSize);PYLITH_CHECK_ERROR(err);
+        err = VecGetArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+        _AuxiliaryFactory::hashBytes(&hashLocal, coordsArray, coordsSize*sizeof(PetscScalar));
+        err = VecRestoreArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    uint64_t hashGlobal = 0;
+    err = MPI_Allreduce(&hashLocal, &hashGlobal, 1, MPI_UINT64_T, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    _AuxiliaryFactory::hashBytes(&hash, &hashGlobal, sizeof(hashGlobal));
+    _AuxiliaryFactory::hashBytes(&hash, &commSize, sizeof(commSize));
+
+    std::ostringstream key;
+    key << std::hex << std::setfill('0') << std::setw(16) << hash;
+
+    PYLITH_METHOD_RETURN(key.str());
+} // _getCacheKey
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read subfield values from cache.
+bool
+pylith::feassemble::AuxiliaryFactory::_readCache(const std::string& key) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+
+    PetscErrorCode err;
+    PetscDM dm = _field->getDM();
+    MPI_Comm comm = PetscObjectComm((PetscObject) dm);
+    PetscMPIInt commRank = 0;
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+
+    int fileExists = 0;
+    if (0 == commRank) {
+        std::ifstream fin(_cacheFilename.c_str());
+        fileExists = fin.good() ? 1 : 0;
+    } // if
+    err = MPI_Bcast(&fileExists, 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    if (!fileExists) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(comm, _cacheFilename.c_str(), FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+    PetscBool hasKey = PETSC_FALSE;
+    err = PetscViewerHDF5HasAttribute(viewer, _AuxiliaryFactory::datasetName, _AuxiliaryFactory::keyName, &hasKey);PYLITH_CHECK_ERROR(err);
+    bool isMatch = false;
+    if (hasKey) {
+        char* cacheKey = NULL;
+        err = PetscViewerHDF5ReadAttribute(viewer, _AuxiliaryFactory::datasetName, _AuxiliaryFactory::keyName, PETSC_STRING, NULL, &cacheKey);PYLITH_CHECK_ERROR(err);
+        isMatch = key == std::string(cacheKey);
+        err = PetscFree(cacheKey);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (isMatch) {
+        PetscVec globalVector = NULL;
+        PetscVec cacheVector = NULL;
+        PetscInt localSize = 0;
+        err = DMGetGlobalVector(dm, &globalVector);PYLITH_CHECK_ERROR(err);
+        err = VecGetLocalSize(globalVector, &localSize);PYLITH_CHECK_ERROR(err);
+        // Vector without a DM, so PETSc reads a plain dataset.
+        err = VecCreateMPI(comm, localSize, PETSC_DETERMINE, &cacheVector);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectSetName((PetscObject) cacheVector, _AuxiliaryFactory::datasetName);PYLITH_CHECK_ERROR(err);
+        err = VecLoad(cacheVector, viewer);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(cacheVector, globalVector);PYLITH_CHECK_ERROR(err);
+        err = DMGlobalToLocalBegin(dm, globalVector, INSERT_VALUES, _field->getLocalVector());PYLITH_CHECK_ERROR(err);
+        err = DMGlobalToLocalEnd(dm, globalVector, INSERT_VALUES, _field->getLocalVector());PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&cacheVector);PYLITH_CHECK_ERROR(err);
+        err = DMRestoreGlobalVector(dm, &globalVector);PYLITH_CHECK_ERROR(err);
+
+        PYLITH_JOURNAL_INFO_ROOT("Using values of auxiliary subfields from cache '" << _cacheFilename << "'.");
+    } // if
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(isMatch);
+} // _readCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write subfield values to cache.
+void
+pylith::feassemble::AuxiliaryFactory::_writeCache(const std::string& key) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+
+    PetscErrorCode err;
+    PetscDM dm = _field->getDM();
+    MPI_Comm comm = PetscObjectComm((PetscObject) dm);
+
+    PetscVec globalVector = NULL;
+    PetscVec cacheVector = NULL;
+    PetscInt localSize = 0;
+    err = DMGetGlobalVector(dm, &globalVector);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalBegin(dm, _field->getLocalVector(), INSERT_VALUES, globalVector);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dm, _field->getLocalVector(), INSERT_VALUES, globalVector);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(globalVector, &localSize);PYLITH_CHECK_ERROR(err);
+    // Vector without a DM, so PETSc writes a plain dataset.
+    err = VecCreateMPI(comm, localSize, PETSC_DETERMINE, &cacheVector);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(globalVector, cacheVector);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreGlobalVector(dm, &globalVector);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) cacheVector, _AuxiliaryFactory::datasetName);PYLITH_CHECK_ERROR(err);
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(comm, _cacheFilename.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+    err = VecView(cacheVector, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5WriteAttribute(viewer, _AuxiliaryFactory::datasetName, _AuxiliaryFactory::keyName, PETSC_STRING, key.c_str());PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&cacheVector);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_JOURNAL_INFO_ROOT("Wrote values of auxiliary subfields to cache '" << _cacheFilename << "'.");
+
+    PYLITH_METHOD_END;
+} // _writeCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update 64-bit FNV-1a hash with bytes.
+void
+pylith::feassemble::_AuxiliaryFactory::hashBytes(uint64_t* hash,
+                                                 const void* data,
+                                                 const size_t numBytes) {
+    assert(hash);
+    assert(data || !numBytes);
+
+    const unsigned char* bytes = (const unsigned char*) data;
+    for (size_t i = 0; i < numBytes; ++i) {
+        *hash ^= uint64_t(bytes[i]);
+        *hash *= hashPrime;
+    } // for
+} // hashBytes
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update 64-bit FNV-1a hash with string (including length).
+void
+pylith::feassemble::_AuxiliaryFactory::hashString(uint64_t* hash,
+                                                  const std::string& value) {
+    const uint64_t length = value.length();
+    hashBytes(hash, &length, sizeof(length));
+    hashBytes(hash, value.c_str(), value.length());
+} // hashString
+
+
 // End of file
@@ -33,6 +33,8 @@
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
 #include "spatialdata/units/unitsfwd.hh" // HOLDSA Normalizer
 
+#include <string> // HASA std::string
+
 class pylith::feassemble::AuxiliaryFactory : public pylith::topology::FieldFactory {
     friend class TestAuxiliaryFactory; // unit testing
 
@@ -69,6 +71,24 @@ public:
                     const int spaceDim,
                     const pylith::topology::FieldBase::Description* defaultDescription=NULL);
 
+    /** Set file for caching auxiliary subfield values.
+     *
+     * The cache is used in setValuesFromDB() if the cache key of the file matches the key computed from the
+     * spatial database key, the mesh, the discretization of the subfields, and the scales for nondimensionalization;
+     * otherwise the spatial database is queried and the values are written to the cache file.
+     *
+     * @param[in] filename Name of HDF5 file for cache (empty string disables cache).
+     * @param[in] dbKey Key identifying spatial database and its parameters, including contents of data files.
+     */
+    void setCache(const char* filename,
+                  const char* dbKey);
+
+    /** Get file for caching auxiliary subfield values.
+     *
+     * @returns Name of HDF5 file for cache.
+     */
+    const char* getCacheFilename(void) const;
+
     /// Set subfield values using spatial database.
     void setValuesFromDB(void);
 
@@ -86,6 +106,20 @@ public:
                           pylith::topology::FieldQuery::convertfn_type convertFn=NULL,
                           spatialdata::spatialdb::SpatialDB* db=NULL);
 
+    /** Set query function for subfield using converter functions that report errors via codes.
+     *
+     * @param[in] subfieldName Name of subfield.
+     * @param[in] namesDBValues Array of names of values to use from spatial database.
+     * @param[in] numDBValues Size of names array.
+     * @param[in] converter Functions to convert spatial database values to subfield values.
+     * @param[in] db Spatial database to query.
+     */
+    void setSubfieldQuery(const char* subfieldName,
+                          const char* namesDBValues[],
+                          const size_t numDBValues,
+                          const pylith::topology::FieldQuery::Converter& converter,
+                          spatialdata::spatialdb::SpatialDB* db=NULL);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -99,6 +133,31 @@ protected:
     /// Field query for filling subfield values via spatial database.
     pylith::topology::FieldQuery* _fieldQuery;
 
+    std::string _cacheFilename; ///< Name of HDF5 file for caching subfield values.
+    std::string _cacheDBKey; ///< Key identifying spatial database.
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Compute key identifying cached subfield values.
+     *
+     * @returns Hexadecimal string of hash over database key, scales, discretization, and mesh.
+     */
+    std::string _getCacheKey(void) const;
+
+    /** Read subfield values from cache.
+     *
+     * @param[in] key Key identifying subfield values.
+     * @returns True if cache file exists and matches key, false otherwise.
+     */
+    bool _readCache(const std::string& key);
+
+    /** Write subfield values to cache.
+     *
+     * @param[in] key Key identifying subfield values.
+     */
+    void _writeCache(const std::string& key) const;
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -42,7 +42,8 @@ pylith::feassemble::Constraint::Constraint(pylith::problems::Physics* const phys
     _subfieldName(""),
     _labelName(""),
     _labelValue(1),
-    _boundaryMesh(NULL) {}
+    _boundaryMesh(NULL),
+    _isTimeDependent(true) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -160,6 +161,22 @@ pylith::feassemble::Constraint::getConstrainedDOF(void) const {
 } // getConstrainedDOF
 
 
+// ------------------------------------------------------------------------------------------------
+// Set flag indicating whether constrained values depend on time.
+void
+pylith::feassemble::Constraint::setTimeDependent(const bool value) {
+    _isTimeDependent = value;
+} // setTimeDependent
+
+
+// ------------------------------------------------------------------------------------------------
+// Do constrained values depend on time?
+bool
+pylith::feassemble::Constraint::isTimeDependent(void) const {
+    return _isTimeDependent;
+} // isTimeDependent
+
+
 // ------------------------------------------------------------------------------------------------
 // Get mesh associated with constrained boundary.
 const pylith::topology::Mesh&
@@ -199,7 +216,7 @@ pylith::feassemble::Constraint::poststep(const PylithReal t,
                                          const PylithReal dt,
                                          const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("poststep(t="<<t<<", dt="<<dt<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("poststep(t="<<t<<", dt="<<dt<<")");
 
     notifyObservers(t, tindex, solution);
 
@@ -212,7 +229,7 @@ pylith::feassemble::Constraint::poststep(const PylithReal t,
 void
 pylith::feassemble::Constraint::setState(const PylithReal t) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("setState(t="<<t<<") empty method");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("setState(t="<<t<<") empty method");
 
     // Default is to do nothing.
 
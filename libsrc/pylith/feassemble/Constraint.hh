@@ -105,6 +105,18 @@ public:
      */
     const pylith::int_array& getConstrainedDOF(void) const;
 
+    /** Set flag indicating whether constrained values depend on time.
+     *
+     * @param[in] value True if constrained values depend on time, false otherwise.
+     */
+    void setTimeDependent(const bool value);
+
+    /** Do constrained values depend on time?
+     *
+     * @returns True if constrained values depend on time, false otherwise.
+     */
+    bool isTimeDependent(void) const;
+
     /** Get mesh associated with constrained boundary.
      *
      * @returns Mesh associated with constrained boundary.
@@ -155,6 +167,7 @@ protected:
     int_array _constrainedDOF; ///< List of constrained degrees of freedom at each location.
     pylith::topology::Mesh* _boundaryMesh; ///< Boundary mesh.
     PylithReal _tSolution; ///< Time used for current solution.
+    bool _isTimeDependent; ///< True if constrained values depend on time.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -143,11 +143,11 @@ void
 pylith::feassemble::ConstraintSimple::setSolution(pylith::feassemble::IntegrationData* integrationData) {
     assert(integrationData);
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("setSolution(integrationData="<<integrationData->str()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("setSolution(integrationData="<<integrationData->str()<<")");
 
-    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
-    const PylithReal t = integrationData->getScalar(pylith::feassemble::IntegrationData::time);
+    const PylithReal t = integrationData->getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
 
     PetscErrorCode err = 0;
     PetscDM dmSoln = solution->getDM();
@@ -30,6 +30,7 @@
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
+#include <algorithm> // USES std::equal()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 
@@ -37,7 +38,9 @@
 // Default constructor.
 pylith::feassemble::ConstraintSpatialDB::ConstraintSpatialDB(pylith::problems::Physics* const physics) :
     Constraint(physics),
-    _kernelConstraint(NULL) {
+    _kernelConstraint(NULL),
+    _useDirectInsertion(false),
+    _haveDirectInsertion(false) {
     GenericComponent::setName("constraintspatialdb");
 } // constructor
 
@@ -57,6 +60,15 @@ pylith::feassemble::ConstraintSpatialDB::setKernelConstraint(const PetscBdPointF
 } // setkernelConstraint
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Allow constrained values to be written directly into the solution at points.
+void
+pylith::feassemble::ConstraintSpatialDB::useDirectInsertion(const bool value) {
+    _useDirectInsertion = value;
+    _haveDirectInsertion = false;
+} // useDirectInsertion
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize constraint domain, auxiliary field, and derived field. Update observers.
 void
@@ -99,7 +111,7 @@ pylith::feassemble::ConstraintSpatialDB::initialize(const pylith::topology::Fiel
 void
 pylith::feassemble::ConstraintSpatialDB::setState(const double t) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setState(t="<<t<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" setState(t="<<t<<")");
 
     assert(_physics);
     _physics->updateAuxiliaryField(_auxiliaryField, t);
@@ -123,14 +135,23 @@ void
 pylith::feassemble::ConstraintSpatialDB::setSolution(pylith::feassemble::IntegrationData* integrationData) {
     assert(integrationData);
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setSolution(integrationData="<<integrationData->str()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" setSolution(integrationData="<<integrationData->str()<<")");
 
     assert(_auxiliaryField);
     assert(_physics);
 
-    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
-    const PylithReal t = integrationData->getScalar(pylith::feassemble::IntegrationData::time);
+    const PylithReal t = integrationData->getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
+
+    if (_useDirectInsertion && !_haveDirectInsertion) {
+        _useDirectInsertion = _setupDirectInsertion(*solution);
+        _haveDirectInsertion = true;
+    } // if
+    if (_useDirectInsertion) {
+        _setSolutionDirect(integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION), t);
+        PYLITH_METHOD_END;
+    } // if
 
     PetscErrorCode err = 0;
     PetscDM dmSoln = solution->getDM();
@@ -183,6 +204,18 @@ pylith::feassemble::ConstraintSpatialDB::_setKernelConstants(const pylith::topol
     // :KLUDGE: Potentially we may have multiple PetscDS objects. This assumes that the first one (with a NULL label) is
     // the correct one.
     PetscErrorCode err = DMGetDS(dmSoln, &prob);PYLITH_CHECK_ERROR(err);assert(prob);
+
+    // Skip the update if the DS already holds the constants.
+    const PetscInt numConstants = constants.size();
+    PetscInt numConstantsDS = 0;
+    const PetscScalar* constantsDS = NULL;
+    err = PetscDSGetConstants(prob, &numConstantsDS, &constantsDS);PYLITH_CHECK_ERROR(err);
+    const bool isCurrent = (numConstantsDS == numConstants) &&
+                           (!numConstants || std::equal(&constants[0], &constants[0]+numConstants, constantsDS));
+    if (isCurrent) {
+        PYLITH_METHOD_END;
+    } // if
+
     if (constants.size() > 0) {
         err = PetscDSSetConstants(prob, constants.size(), const_cast<double*>(&constants[0]));PYLITH_CHECK_ERROR(err);
     } else {
@@ -193,4 +226,135 @@ pylith::feassemble::ConstraintSpatialDB::_setKernelConstants(const pylith::topol
 } // _setKernelConstants
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Setup offsets of constrained points in the solution and auxiliary field for direct insertion.
+bool
+pylith::feassemble::ConstraintSpatialDB::_setupDirectInsertion(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("_setupDirectInsertion(solution="<<solution.getLabel()<<")");
+
+    assert(_auxiliaryField);
+
+    _directSolnOffsets.clear();
+    _directAuxOffsets.clear();
+
+    // Auxiliary subfields in the order of the subfields in the kernels.
+    const pylith::string_vector& auxSubfieldNames = _auxiliaryField->getSubfieldNames();
+    const size_t numAuxSubfields = auxSubfieldNames.size();
+    _directAuxNumComponents.resize(numAuxSubfields);
+    for (size_t i = 0; i < numAuxSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = _auxiliaryField->getSubfieldInfo(auxSubfieldNames[i].c_str());
+        assert(size_t(info.index) < numAuxSubfields);
+        _directAuxNumComponents[info.index] = info.description.numComponents;
+    } // for
+
+    const pylith::topology::Field::SubfieldInfo& solnInfo = solution.getSubfieldInfo(_subfieldName.c_str());
+    const PetscInt solnField = solnInfo.index;
+    const PetscInt solnNumComponents = solnInfo.description.numComponents;
+
+    PetscErrorCode err = 0;
+    PetscSection solnSection = solution.getLocalSection();assert(solnSection);
+    PetscSection auxSection = _auxiliaryField->getLocalSection();assert(auxSection);
+    PetscIS subpointIS = NULL;
+    err = DMPlexGetSubpointIS(_auxiliaryField->getDM(), &subpointIS);PYLITH_CHECK_ERROR(err);
+    if (!subpointIS) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    const PetscInt* subpoints = NULL;
+    PetscInt numSubpoints = 0;
+    err = ISGetSize(subpointIS, &numSubpoints);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(auxSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    bool isDirect = _kernelConstraint && numAuxSubfields > 0 && pEnd <= numSubpoints;
+    std::vector<PetscInt> auxOffsets(numAuxSubfields);
+    for (PetscInt point = pStart; point < pEnd && isDirect; ++point) {
+        PetscInt solnDof = 0, solnOff = 0;
+        err = PetscSectionGetFieldDof(solnSection, subpoints[point], solnField, &solnDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldOffset(solnSection, subpoints[point], solnField, &solnOff);PYLITH_CHECK_ERROR(err);
+
+        // Require exactly one node at each point with degrees of freedom in both the solution and auxiliary field.
+        for (size_t i = 0; i < numAuxSubfields; ++i) {
+            PetscInt auxDof = 0;
+            err = PetscSectionGetFieldDof(auxSection, point, i, &auxDof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(auxSection, point, i, &auxOffsets[i]);PYLITH_CHECK_ERROR(err);
+            isDirect = isDirect && (auxDof == (solnDof ? _directAuxNumComponents[i] : 0));
+        } // for
+        isDirect = isDirect && (!solnDof || solnDof == solnNumComponents);
+        if (isDirect && solnDof) {
+            _directSolnOffsets.push_back(solnOff);
+            _directAuxOffsets.insert(_directAuxOffsets.end(), auxOffsets.begin(), auxOffsets.end());
+        } // if
+    } // for
+    err = ISRestoreIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+
+    if (!isDirect) {
+        _directSolnOffsets.clear();
+        _directAuxOffsets.clear();
+    } // if
+    PYLITH_JOURNAL_DEBUG("Direct insertion of constrained values "<<(isDirect ? "enabled" : "disabled")
+                                                                   <<" for "<<_directSolnOffsets.size()<<" points.");
+
+    PYLITH_METHOD_RETURN(isDirect);
+} // _setupDirectInsertion
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write constrained values directly into the solution at points.
+void
+pylith::feassemble::ConstraintSpatialDB::_setSolutionDirect(pylith::topology::Field* solution,
+                                                            const PylithReal t) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG_CALLBACK("_setSolutionDirect(solution="<<solution<<", t="<<t<<")");
+
+    assert(solution);
+    assert(_auxiliaryField);
+    assert(_kernelConstraint);
+
+    PetscErrorCode err = 0;
+    PetscDS prob = NULL;
+    err = DMGetDS(solution->getDM(), &prob);PYLITH_CHECK_ERROR(err);assert(prob);
+    PetscInt numConstants = 0;
+    const PetscScalar* constants = NULL;
+    err = PetscDSGetConstants(prob, &numConstants, &constants);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt dim = solution->getSpaceDim();
+    const PetscInt solnNumComponents = solution->getSubfieldInfo(_subfieldName.c_str()).description.numComponents;
+    const size_t numAuxSubfields = _directAuxNumComponents.size();
+    std::vector<PetscInt> aOff(numAuxSubfields+1, 0);
+    for (size_t i = 0; i < numAuxSubfields; ++i) {
+        aOff[i+1] = aOff[i] + _directAuxNumComponents[i];
+    } // for
+    std::vector<PetscScalar> auxValues(aOff[numAuxSubfields]+1);
+    std::vector<PetscScalar> values(solnNumComponents);
+    const size_t numConstrained = _constrainedDOF.size();
+
+    const PetscScalar* auxArray = NULL;
+    PetscScalar* solnArray = NULL;
+    err = VecGetArrayRead(_auxiliaryField->getLocalVector(), &auxArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(solution->getLocalVector(), &solnArray);PYLITH_CHECK_ERROR(err);
+    const size_t numPoints = _directSolnOffsets.size();
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        const PetscInt* auxOffsets = &_directAuxOffsets[iPoint*numAuxSubfields];
+        for (size_t i = 0; i < numAuxSubfields; ++i) {
+            for (PetscInt iComp = 0; iComp < _directAuxNumComponents[i]; ++iComp) {
+                auxValues[aOff[i]+iComp] = auxArray[auxOffsets[i]+iComp];
+            } // for
+        } // for
+        _kernelConstraint(dim, 1, numAuxSubfields, NULL, NULL, NULL, NULL, NULL, &aOff[0], NULL, &auxValues[0], NULL, NULL,
+                          t, NULL, NULL, numConstants, constants, &values[0]);
+
+        PetscScalar* solnPoint = &solnArray[_directSolnOffsets[iPoint]];
+        for (size_t iConstrained = 0; iConstrained < numConstrained; ++iConstrained) {
+            solnPoint[_constrainedDOF[iConstrained]] = values[_constrainedDOF[iConstrained]];
+        } // for
+    } // for
+    err = VecRestoreArray(solution->getLocalVector(), &solnArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(_auxiliaryField->getLocalVector(), &auxArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setSolutionDirect
+
+
 // End of file
@@ -33,6 +33,8 @@
 #include "pylith/utils/array.hh" // HASA int_array
 #include "pylith/utils/utilsfwd.hh" // HOLDSA Logger
 
+#include <vector> // HASA std::vector
+
 class pylith::feassemble::ConstraintSpatialDB : public pylith::feassemble::Constraint {
     friend class TestConstraintSpatialDB; // unit testing
 
@@ -54,6 +56,17 @@ public:
      */
     void setKernelConstraint(const PetscBdPointFunc kernel);
 
+    /** Allow constrained values to be written directly into the solution at points.
+     *
+     * Use only if the constraint kernel depends only on the auxiliary field and time. The values are written directly
+     * if the solution subfield and each auxiliary subfield have exactly one node at each point with degrees of freedom
+     * (for example, Lagrange basis functions of order 1 and 2 on simplex cells). Otherwise, the constrained values are
+     * computed by projection over the boundary.
+     *
+     * @param[in] value True if constrained values may be written directly, false otherwise.
+     */
+    void useDirectInsertion(const bool value);
+
     /** Initialize constraint.
      *
      * @param[in] solution Solution field (layout).
@@ -83,11 +96,32 @@ protected:
     void _setKernelConstants(const pylith::topology::Field& solution,
                              const PylithReal dt) const;
 
+    /** Setup offsets of constrained points in the solution and auxiliary field for direct insertion.
+     *
+     * @param[in] solution Solution field.
+     * @returns True if constrained values can be written directly, false otherwise.
+     */
+    bool _setupDirectInsertion(const pylith::topology::Field& solution);
+
+    /** Write constrained values directly into the solution at points.
+     *
+     * @param[inout] solution Solution field.
+     * @param[in] t Current time.
+     */
+    void _setSolutionDirect(pylith::topology::Field* solution,
+                            const PylithReal t);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
     PetscBdPointFunc _kernelConstraint; ///< Kernel for computing constrained values from auxiliary field.
 
+    bool _useDirectInsertion; ///< True if constrained values may be written directly at points.
+    bool _haveDirectInsertion; ///< True if offsets for direct insertion have been setup.
+    std::vector<PetscInt> _directSolnOffsets; ///< Offsets of constrained points in local solution vector.
+    std::vector<PetscInt> _directAuxOffsets; ///< Offsets of auxiliary subfields at constrained points in local auxiliary vector.
+    std::vector<PetscInt> _directAuxNumComponents; ///< Number of components in each auxiliary subfield.
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
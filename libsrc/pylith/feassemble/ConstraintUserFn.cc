@@ -117,16 +117,16 @@ void
 pylith::feassemble::ConstraintUserFn::setSolution(pylith::feassemble::IntegrationData* integrationData) {
     assert(integrationData);
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setSolution(integrationData="<<integrationData->str()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" setSolution(integrationData="<<integrationData->str()<<")");
 
-    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
-    const PylithReal t = integrationData->getScalar(pylith::feassemble::IntegrationData::time);
+    const PylithReal t = integrationData->getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
 
     _ConstraintUserFn::setSolution(solution, t, _fn, *this);
 
-    if (_fnDot && integrationData->hasField(pylith::feassemble::IntegrationData::solution_dot)) {
-        const pylith::topology::Field* solutionDot = integrationData->getField(pylith::feassemble::IntegrationData::solution_dot);
+    if (_fnDot && integrationData->hasField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT)) {
+        const pylith::topology::Field* solutionDot = integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);
         assert(solutionDot);
         _ConstraintUserFn::setSolution(solutionDot, t, _fnDot, *this);
     } // if
@@ -44,10 +44,37 @@ const std::string pylith::feassemble::IntegrationData::residual = "residual";
 const std::string pylith::feassemble::IntegrationData::lumped_jacobian_inverse = "lumped_jacobian_inverse";
 const std::string pylith::feassemble::IntegrationData::dae_mass_weighting = "dae_mass_weighting";
 
+const std::string* const pylith::feassemble::IntegrationData::_scalarNames[NUM_SCALARS] = {
+    &pylith::feassemble::IntegrationData::time,
+    &pylith::feassemble::IntegrationData::time_step,
+    &pylith::feassemble::IntegrationData::s_tshift,
+    &pylith::feassemble::IntegrationData::t_state,
+    &pylith::feassemble::IntegrationData::dt_residual,
+    &pylith::feassemble::IntegrationData::dt_jacobian,
+    &pylith::feassemble::IntegrationData::dt_lumped_jacobian_inverse,
+};
+
+const std::string* const pylith::feassemble::IntegrationData::_fieldNames[NUM_FIELDS] = {
+    &pylith::feassemble::IntegrationData::solution,
+    &pylith::feassemble::IntegrationData::solution_dot,
+    &pylith::feassemble::IntegrationData::residual,
+    &pylith::feassemble::IntegrationData::lumped_jacobian_inverse,
+    &pylith::feassemble::IntegrationData::dae_mass_weighting,
+};
+
 // ------------------------------------------------------------------------------------------------
 // Constructor
 pylith::feassemble::IntegrationData::IntegrationData(void) {
     GenericComponent::setName("integrationdata");
+
+    for (int i = 0; i < NUM_SCALARS; ++i) {
+        _scalarSlots[i] = 0.0;
+        _hasScalarSlots[i] = false;
+    } // for
+    for (int i = 0; i < NUM_FIELDS; ++i) {
+        _fieldSlots[i] = NULL;
+        _hasFieldSlots[i] = false;
+    } // for
 }
 
 
@@ -64,6 +91,17 @@ pylith::feassemble::IntegrationData::~IntegrationData(void) {
 void
 pylith::feassemble::IntegrationData::deallocate(void) {
     _scalars.clear();
+    for (int i = 0; i < NUM_SCALARS; ++i) {
+        _hasScalarSlots[i] = false;
+    } // for
+
+    for (int i = 0; i < NUM_FIELDS; ++i) {
+        if (i != FIELD_SOLUTION) { // Solution memory management handled by Python.
+            delete _fieldSlots[i];
+        } // if
+        _fieldSlots[i] = NULL;
+        _hasFieldSlots[i] = false;
+    } // for
 
     for (fields_map_t::iterator iter = _fields.begin(); iter != _fields.end(); ++iter) {
         if (iter->first != solution) { // Solution memory management handled by Python.
@@ -87,7 +125,12 @@ pylith::feassemble::IntegrationData::setScalar(const std::string& name,
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("setScalar(name="<<name<<", value="<<value<<")");
 
-    _scalars[name] = value;
+    const int slot = _getScalarSlot(name);
+    if (slot >= 0) {
+        setScalar(ScalarEnum(slot), value);
+    } else {
+        _scalars[name] = value;
+    } // if/else
 
     PYLITH_METHOD_END;
 }
@@ -100,6 +143,11 @@ pylith::feassemble::IntegrationData::getScalar(const std::string& name) const {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("getScalar(name="<<name<<")");
 
+    const int slot = _getScalarSlot(name);
+    if (slot >= 0) {
+        PYLITH_METHOD_RETURN(getScalar(ScalarEnum(slot)));
+    } // if
+
     scalars_map_t::const_iterator iter = _scalars.find(name);
     if (iter == _scalars.end()) {
         PYLITH_JOURNAL_LOGICERROR("No scalar value '" << name << "' in integration data.");
@@ -116,9 +164,12 @@ pylith::feassemble::IntegrationData::removeScalar(const std::string& name) {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("removeScalar(name="<<name<<")");
 
-    if (_scalars.count(name)) {
+    const int slot = _getScalarSlot(name);
+    if (slot >= 0) {
+        _hasScalarSlots[slot] = false;
+    } else if (_scalars.count(name)) {
         _scalars.erase(name);
-    } // if
+    } // if/else
 
     PYLITH_METHOD_END;
 }
@@ -128,7 +179,8 @@ pylith::feassemble::IntegrationData::removeScalar(const std::string& name) {
 // Check if we have field with given name.
 bool
 pylith::feassemble::IntegrationData::hasField(const std::string& name) const {
-    return _fields.count(name) > 0;
+    const int slot = _getFieldSlot(name);
+    return (slot >= 0) ? _hasFieldSlots[slot] : _fields.count(name) > 0;
 }
 
 
@@ -140,11 +192,17 @@ pylith::feassemble::IntegrationData::setField(const std::string& name,
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("setField(name="<<name<<", field="<<typeid(field).name()<<")");
 
-    fields_map_t::iterator iter = _fields.find(name);
-    if (iter != _fields.end()) {
-        delete iter->second;iter->second = field;
+    const int slot = _getFieldSlot(name);
+    if (slot >= 0) {
+        delete _fieldSlots[slot];_fieldSlots[slot] = field;
+        _hasFieldSlots[slot] = true;
     } else {
-        _fields[name] = field;
+        fields_map_t::iterator iter = _fields.find(name);
+        if (iter != _fields.end()) {
+            delete iter->second;iter->second = field;
+        } else {
+            _fields[name] = field;
+        } // if/else
     } // if/else
 
     PYLITH_METHOD_END;
@@ -158,6 +216,11 @@ pylith::feassemble::IntegrationData::getField(const std::string& name) const {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("getField(name="<<name<<")");
 
+    const int slot = _getFieldSlot(name);
+    if (slot >= 0) {
+        PYLITH_METHOD_RETURN(getField(FieldEnum(slot)));
+    } // if
+
     fields_map_t::const_iterator iter = _fields.find(name);
     if (iter == _fields.end()) {
         PYLITH_JOURNAL_LOGICERROR("No field '" << name << "' in integration data.");
@@ -174,7 +237,11 @@ pylith::feassemble::IntegrationData::removeField(const std::string& name) {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("removeField(name="<<name<<")");
 
-    if (_fields.count(name)) {
+    const int slot = _getFieldSlot(name);
+    if (slot >= 0) {
+        delete _fieldSlots[slot];_fieldSlots[slot] = NULL;
+        _hasFieldSlots[slot] = false;
+    } else if (_fields.count(name)) {
         fields_map_t::iterator iter = _fields.find(name);
         delete iter->second;iter->second = NULL;
         _fields.erase(name);
@@ -225,12 +292,22 @@ std::string
 pylith::feassemble::IntegrationData::str(void) const {
     std::ostringstream info;
     info << "Scalars:";
+    for (int i = 0; i < NUM_SCALARS; ++i) {
+        if (_hasScalarSlots[i]) {
+            info << " " << *_scalarNames[i] << "=" << _scalarSlots[i];
+        } // if
+    } // for
     for (scalars_map_t::const_iterator iter = _scalars.begin(); iter != _scalars.end(); ++iter) {
         info << " " << iter->first << "=" << iter->second;
     } // for
     info << "; ";
 
     info << "Fields:";
+    for (int i = 0; i < NUM_FIELDS; ++i) {
+        if (_hasFieldSlots[i]) {
+            info << " " << *_fieldNames[i];
+        } // if
+    } // for
     for (fields_map_t::const_iterator iter = _fields.begin(); iter != _fields.end(); ++iter) {
         info << " " << iter->first;
     } // for
@@ -240,4 +317,42 @@ pylith::feassemble::IntegrationData::str(void) const {
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Get fixed slot of scalar.
+int
+pylith::feassemble::IntegrationData::_getScalarSlot(const std::string& name) {
+    for (int i = 0; i < NUM_SCALARS; ++i) {
+        if (name == *_scalarNames[i]) {
+            return i;
+        } // if
+    } // for
+    return -1;
+} // _getScalarSlot
+
+
+// ------------------------------------------------------------------------------------------------
+// Get fixed slot of field.
+int
+pylith::feassemble::IntegrationData::_getFieldSlot(const std::string& name) {
+    for (int i = 0; i < NUM_FIELDS; ++i) {
+        if (name == *_fieldNames[i]) {
+            return i;
+        } // if
+    } // for
+    return -1;
+} // _getFieldSlot
+
+
+// ------------------------------------------------------------------------------------------------
+// Report missing scalar or field with fixed slot.
+void
+pylith::feassemble::IntegrationData::_missing(const std::string& name) const {
+    PYLITH_METHOD_BEGIN;
+
+    PYLITH_JOURNAL_LOGICERROR("No scalar value or field '" << name << "' in integration data.");
+
+    PYLITH_METHOD_END;
+} // _missing
+
+
 // End of file
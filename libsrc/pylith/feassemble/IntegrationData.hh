@@ -53,6 +53,31 @@ public:
     static const std::string lumped_jacobian_inverse;
     static const std::string dae_mass_weighting;
 
+    // PUBLIC ENUMS ///////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Scalars stored in fixed slots for fast access in residual and Jacobian callbacks.
+    enum ScalarEnum {
+        SCALAR_TIME=0, ///< Time (time).
+        SCALAR_TIME_STEP=1, ///< Time step (time_step).
+        SCALAR_S_TSHIFT=2, ///< Shift for time derivative in Jacobian (s_tshift).
+        SCALAR_T_STATE=3, ///< Time of current state (t_state).
+        SCALAR_DT_RESIDUAL=4, ///< Time step of current residual (dt_residual).
+        SCALAR_DT_JACOBIAN=5, ///< Time step of current Jacobian (dt_jacobian).
+        SCALAR_DT_LUMPED_JACOBIAN_INVERSE=6, ///< Time step of current lumped Jacobian (dt_lumped_jacobian_inverse).
+        NUM_SCALARS=7, ///< Number of scalars with fixed slots.
+    }; // ScalarEnum
+
+    /// Fields stored in fixed slots for fast access in residual and Jacobian callbacks.
+    enum FieldEnum {
+        FIELD_SOLUTION=0, ///< Solution field (solution).
+        FIELD_SOLUTION_DOT=1, ///< Time derivative of solution field (solution_dot).
+        FIELD_RESIDUAL=2, ///< Residual field (residual).
+        FIELD_LUMPED_JACOBIAN_INVERSE=3, ///< Inverse of lumped Jacobian (lumped_jacobian_inverse).
+        FIELD_DAE_MASS_WEIGHTING=4, ///< Weighting for DAE mass matrix (dae_mass_weighting).
+        NUM_FIELDS=5, ///< Number of fields with fixed slots.
+    }; // FieldEnum
+
     // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -80,6 +105,21 @@ public:
      */
     PylithReal getScalar(const std::string& name) const;
 
+    /** Set scalar quantity with fixed slot.
+     *
+     * @param[in] key Slot of scalar.
+     * @param[in] value Value of scalar.
+     */
+    void setScalar(const ScalarEnum key,
+                   const PylithReal value);
+
+    /** Get scalar quantity with fixed slot.
+     *
+     * @param[in] key Slot of scalar.
+     * @returns Value of scalar.
+     */
+    PylithReal getScalar(const ScalarEnum key) const;
+
     /** Remove scalar quantity.
      *
      * @param[in] name Name of scalar.
@@ -93,6 +133,13 @@ public:
      */
     bool hasField(const std::string& name) const;
 
+    /** Check if we have field with fixed slot.
+     *
+     * @param[in] key Slot of field.
+     * @returns True if we have field, otherwise false.
+     */
+    bool hasField(const FieldEnum key) const;
+
     /** Set field.
      *
      * @param[in] name Name of field.
@@ -108,6 +155,13 @@ public:
      */
     pylith::topology::Field* getField(const std::string& name) const;
 
+    /** Get field with fixed slot.
+     *
+     * @param[in] key Slot of field.
+     * @returns Field over the domain.
+     */
+    pylith::topology::Field* getField(const FieldEnum key) const;
+
     /** Remove field.
      *
      * @param[in] name Name of field.
@@ -135,6 +189,31 @@ public:
      */
     std::string str(void) const;
 
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Get fixed slot of scalar.
+     *
+     * @param[in] name Name of scalar.
+     * @returns Slot of scalar or -1 if scalar does not have a fixed slot.
+     */
+    static
+    int _getScalarSlot(const std::string& name);
+
+    /** Get fixed slot of field.
+     *
+     * @param[in] name Name of field.
+     * @returns Slot of field or -1 if field does not have a fixed slot.
+     */
+    static
+    int _getFieldSlot(const std::string& name);
+
+    /** Report missing scalar or field with fixed slot.
+     *
+     * @param[in] name Name of scalar or field.
+     */
+    void _missing(const std::string& name) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -142,8 +221,16 @@ private:
     typedef std::map<std::string, pylith::topology::Field*> fields_map_t;
     typedef std::map<std::string, pylith::topology::Mesh*> meshes_map_t;
 
-    scalars_map_t _scalars;
-    fields_map_t _fields;
+    static const std::string* const _scalarNames[NUM_SCALARS]; ///< Names of scalars with fixed slots.
+    static const std::string* const _fieldNames[NUM_FIELDS]; ///< Names of fields with fixed slots.
+
+    PylithReal _scalarSlots[NUM_SCALARS]; ///< Values of scalars with fixed slots.
+    bool _hasScalarSlots[NUM_SCALARS]; ///< True if scalar with fixed slot has been set.
+    pylith::topology::Field* _fieldSlots[NUM_FIELDS]; ///< Fields with fixed slots.
+    bool _hasFieldSlots[NUM_FIELDS]; ///< True if field with fixed slot has been set.
+
+    scalars_map_t _scalars; ///< Other scalars.
+    fields_map_t _fields; ///< Other fields.
     meshes_map_t _meshes;
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
@@ -154,6 +241,8 @@ private:
 
 }; // IntegrationData
 
+#include "IntegrationData.icc" // inline methods
+
 #endif // pylith_feassemble_integrationdata_hh
 
 // End of file
@@ -24,15 +24,25 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
 #include "pylith/problems/Physics.hh" // USES Physics
+#include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/HardwareCounters.hh" // USES HardwareCounters
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
+#include "petscis.h" // USES PetscIS
+#include "petsctime.h" // USES PetscTime()
+#include "petsclog.h" // USES PetscGetFlops()
+
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::equal()
 #include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
 #include <typeinfo> // USES typeid()
+#include <vector> // USES std::vector
 #include <stdexcept> // USES std::runtime_error
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -43,12 +53,21 @@ pylith::feassemble::Integrator::Integrator(pylith::problems::Physics* const phys
     _labelValue(1),
     _lhsJacobianTriggers(NEW_JACOBIAN_NEVER),
     _lhsJacobianLumpedTriggers(NEW_JACOBIAN_NEVER),
+    _assemblyChunkSize(0),
+    _cacheGeometry(true),
     _hasRHSResidual(false),
     _hasLHSResidual(false),
     _hasLHSJacobian(false),
     _hasLHSJacobianLumped(false),
     _needNewLHSJacobian(true),
-    _needNewLHSJacobianLumped(true) {}
+    _needNewLHSJacobianLumped(true),
+    _profileName(""),
+    _profileNumCells(0),
+    _profileNumDOF(0) {
+    for (int i = 0; i < PROFILE_NUM_EVENTS; ++i) {
+        _profileStats[i] = ProfileStats();
+    } // for
+} // constructor
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -97,6 +116,40 @@ pylith::feassemble::Integrator::getLabelValue(void) const {
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set maximum number of cells assembled in each call to the PETSc assembly routines.
+void
+pylith::feassemble::Integrator::setAssemblyChunkSize(const size_t value) {
+    PYLITH_JOURNAL_DEBUG("setAssemblyChunkSize(value="<<value<<")");
+    _assemblyChunkSize = value;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get maximum number of cells assembled in each call to the PETSc assembly routines.
+size_t
+pylith::feassemble::Integrator::getAssemblyChunkSize(void) const {
+    return _assemblyChunkSize;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for caching cell geometry between assembly calls.
+void
+pylith::feassemble::Integrator::setCacheGeometry(const bool value) {
+    PYLITH_JOURNAL_DEBUG("setCacheGeometry(value="<<value<<")");
+    _cacheGeometry = value;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag for caching cell geometry between assembly calls.
+bool
+pylith::feassemble::Integrator::getCacheGeometry(void) const {
+    return _cacheGeometry;
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Check whether LHS Jacobian needs to be recomputed.
 bool
@@ -141,6 +194,63 @@ pylith::feassemble::Integrator::setLHSJacobianLumpedTriggers(const int value) {
 } // setLHSJacobianLumpedTriggers
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name identifying integrator in performance instrumentation.
+const char*
+pylith::feassemble::Integrator::getProfileName(void) const {
+    return _profileName.c_str();
+} // getProfileName
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of cells in the integration domain on this process.
+size_t
+pylith::feassemble::Integrator::getProfileNumCells(void) const {
+    return _profileNumCells;
+} // getProfileNumCells
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of solution degrees of freedom in the integration domain on this process.
+size_t
+pylith::feassemble::Integrator::getProfileNumDOF(void) const {
+    return _profileNumDOF;
+} // getProfileNumDOF
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get accumulated statistics for instrumented operation.
+const pylith::feassemble::Integrator::ProfileStats&
+pylith::feassemble::Integrator::getProfileStats(const ProfileEvent event) const {
+    assert(event >= 0 && event < PROFILE_NUM_EVENTS);
+    return _profileStats[event];
+} // getProfileStats
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of instrumented operation.
+const char*
+pylith::feassemble::Integrator::getProfileEventName(const ProfileEvent event) {
+    switch (event) {
+    case PROFILE_RHS_RESIDUAL:
+        return "rhs_residual";
+    case PROFILE_LHS_RESIDUAL:
+        return "lhs_residual";
+    case PROFILE_LHS_JACOBIAN:
+        return "lhs_jacobian";
+    case PROFILE_LHS_JACOBIAN_LUMPED_INV:
+        return "lhs_jacobian_lumped_inv";
+    case PROFILE_UPDATE_STATE_VARS:
+        return "update_state_vars";
+    case PROFILE_DERIVED_FIELD:
+        return "derived_field";
+    default:
+        PYLITH_JOURNAL_LOGICERROR("Unknown instrumented operation '" << event << "'.");
+    } // switch
+    return NULL;
+} // getProfileEventName
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize integration domain, auxiliary field, and derived field. Update observers.
 void
@@ -159,21 +269,111 @@ pylith::feassemble::Integrator::initialize(const pylith::topology::Field& soluti
     _observers->notifyObservers(0.0, 0, solution, infoOnly);
     _observers->setTimeScale(_physics->getNormalizer().getTimeScale());
 
+    _initializeProfiling(solution);
+
+    // Attribute memory of auxiliary and derived fields to this integrator.
+    if (_auxiliaryField) {
+        const std::string& group = std::string("auxiliary field ") + _profileName;
+        pylith::utils::MemoryLogger::setGroup(_auxiliaryField, group.c_str());
+    } // if
+    if (_derivedField) {
+        const std::string& group = std::string("derived field ") + _profileName;
+        pylith::utils::MemoryLogger::setGroup(_derivedField, group.c_str());
+    } // if
+
     PYLITH_METHOD_END;
 } // initialize
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Recompute values of auxiliary field from spatial databases and require new LHS Jacobians.
+void
+pylith::feassemble::Integrator::reinitialize(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("reinitialize(solution="<<solution.getLabel()<<")");
+
+    PhysicsImplementation::reinitialize(solution);
+    _needNewLHSJacobian = true;
+    _needNewLHSJacobianLumped = true;
+
+    PYLITH_METHOD_END;
+} // reinitialize
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set auxiliary field values for current time.
 void
 pylith::feassemble::Integrator::setState(const PylithReal t) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("setState(t="<<t<<") empty method");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("setState(t="<<t<<") empty method");
 
     PYLITH_METHOD_END;
 } // setState
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Can the action of the LHS Jacobian be computed without assembling the Jacobian?
+bool
+pylith::feassemble::Integrator::hasLHSJacobianAction(void) const {
+    // Integrators without LHS Jacobian kernels contribute nothing to the action.
+    return !_hasLHSJacobian;
+} // hasLHSJacobianAction
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute RHS residual at the degrees of freedom in the fast rate group of local time stepping.
+void
+pylith::feassemble::Integrator::computeRHSResidualFast(pylith::topology::Field* residual,
+                                                       const pylith::feassemble::IntegrationData& integrationData) {
+    computeRHSResidual(residual, integrationData);
+} // computeRHSResidualFast
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute LHS residual over cells that do not depend on ghost or constrained values.
+void
+pylith::feassemble::Integrator::computeLHSResidualInterior(pylith::topology::Field* residual,
+                                                           const pylith::feassemble::IntegrationData& integrationData) {
+} // computeLHSResidualInterior
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute remaining LHS residual after computeLHSResidualInterior().
+void
+pylith::feassemble::Integrator::computeLHSResidualBoundary(pylith::topology::Field* residual,
+                                                           const pylith::feassemble::IntegrationData& integrationData) {
+    computeLHSResidual(residual, integrationData);
+} // computeLHSResidualBoundary
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Is the LHS residual linear in the solution with a Jacobian and load that do not depend on time?
+bool
+pylith::feassemble::Integrator::hasTimeIndependentLHSResidual(void) const {
+    return false;
+} // hasTimeIndependentLHSResidual
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector without assembling the Jacobian.
+void
+pylith::feassemble::Integrator::computeLHSJacobianAction(PetscVec actionVec,
+                                                         PetscVec vectorVec,
+                                                         const pylith::feassemble::IntegrationData& integrationData) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG_CALLBACK("computeLHSJacobianAction(actionVec="<<actionVec<<", vectorVec="<<vectorVec<<", integrationData="<<integrationData.str()<<")");
+
+    if (_hasLHSJacobian) {
+        std::ostringstream msg;
+        msg << "Matrix-free action of LHS Jacobian not implemented for integrator '" << _labelName << "="
+            << _labelValue << "'.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // computeLHSJacobianAction
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Update auxiliary fields at end of time step.
 void
@@ -182,27 +382,56 @@ pylith::feassemble::Integrator::poststep(const PylithReal t,
                                          const PylithReal dt,
                                          const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("poststep(t="<<t<<", dt="<<dt<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("poststep(t="<<t<<", dt="<<dt<<")");
 
-    _updateStateVars(t, dt, solution);
+    { // update state variables
+        ProfileScope profile(this, PROFILE_UPDATE_STATE_VARS);
+        _updateStateVars(t, dt, solution);
+    } // update state variables
 
-    _computeDerivedField(t, dt, solution);
+    // Derived field is only used for output, so skip it on steps without output.
+    if (needsObserverUpdate(t, tindex)) {
+        ProfileScope profile(this, PROFILE_DERIVED_FIELD);
+        _computeDerivedField(t, dt, solution);
+    } // if
     notifyObservers(t, tindex, solution);
 
     PYLITH_METHOD_END;
 } // poststep
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Notify observers of solution corresponding to initial conditions.
+void
+pylith::feassemble::Integrator::notifyObserversInitialSoln(const PylithReal t,
+                                                           const PylithInt tindex,
+                                                           const PylithReal dt,
+                                                           const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG_CALLBACK("notifyObserversInitialSoln(t="<<t<<", dt="<<dt<<")");
+
+    // Observers of derived subfields need the derived field for the initial conditions.
+    if (needsObserverUpdate(t, tindex)) {
+        ProfileScope profile(this, PROFILE_DERIVED_FIELD);
+        _computeDerivedField(t, dt, solution);
+    } // if
+    notifyObservers(t, tindex, solution);
+
+    PYLITH_METHOD_END;
+} // notifyObserversInitialSoln
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set constants used in finite-element kernels (point-wise functions).
 void
 pylith::feassemble::Integrator::_setKernelConstants(const pylith::topology::Field& solution,
                                                     const PylithReal dt) const {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("_setKernelConstants(solution="<<solution.getLabel()<<", dt="<<dt<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("_setKernelConstants(solution="<<solution.getLabel()<<", dt="<<dt<<")");
 
     assert(_physics);
     const pylith::real_array& constants = _physics->getKernelConstants(dt);
+    const PetscInt numConstants = constants.size();
 
     PetscDM dmSoln = solution.getDM();assert(dmSoln);
     PetscInt numDS = 0;
@@ -212,6 +441,17 @@ pylith::feassemble::Integrator::_setKernelConstants(const pylith::topology::Fiel
         PetscIS* fields = NULL;
         PetscDS ds = NULL;
         err = DMGetRegionNumDS(dmSoln, i, label, fields, &ds, NULL);PYLITH_CHECK_ERROR(err);
+
+        // Integrators sharing a DS often have the same constants, so skip the update if nothing changed.
+        PetscInt numConstantsDS = 0;
+        const PetscScalar* constantsDS = NULL;
+        err = PetscDSGetConstants(ds, &numConstantsDS, &constantsDS);PYLITH_CHECK_ERROR(err);
+        const bool isCurrent = (numConstantsDS == numConstants) &&
+                               (!numConstants || std::equal(&constants[0], &constants[0]+numConstants, constantsDS));
+        if (isCurrent) {
+            continue;
+        } // if
+
         if (constants.size() > 0) {
             err = PetscDSSetConstants(ds, constants.size(), const_cast<double*>(&constants[0]));PYLITH_CHECK_ERROR(err);
         } else {
@@ -230,7 +470,7 @@ pylith::feassemble::Integrator::_updateStateVars(const PylithReal t,
                                                  const PylithReal dt,
                                                  const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("_updateStateVars(t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<") empty method");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("_updateStateVars(t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<") empty method");
 
     // Default is to do nothing.
 
@@ -245,7 +485,7 @@ pylith::feassemble::Integrator::_computeDerivedField(const PylithReal t,
                                                      const PylithReal dt,
                                                      const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("_computeDerivedField(t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<") empty method");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("_computeDerivedField(t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<") empty method");
 
     // Default is to do nothing.
 
@@ -253,4 +493,181 @@ pylith::feassemble::Integrator::_computeDerivedField(const PylithReal t,
 } // _computeDerivedField
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Split cells into chunks for assembly.
+void
+pylith::feassemble::Integrator::_createCellChunks(std::vector<PetscIS>* chunks,
+                                                  PetscIS cellsIS) const {
+    PYLITH_METHOD_BEGIN;
+    assert(chunks);
+
+    chunks->clear();
+    if (!cellsIS) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscErrorCode err;
+    PetscInt numCells = 0;
+    err = ISGetLocalSize(cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+    if (!_assemblyChunkSize || (size_t(numCells) <= _assemblyChunkSize)) {
+        // Use a copy, so the cell geometry PETSc attaches to the chunk is destroyed with the chunk.
+        PetscIS chunkIS = NULL;
+        err = ISDuplicate(cellsIS, &chunkIS);PYLITH_CHECK_ERROR(err);
+        chunks->push_back(chunkIS);
+        PYLITH_METHOD_END;
+    } // if
+
+    const PetscInt chunkSize = _assemblyChunkSize;
+    const PetscInt* cells = NULL;
+    err = ISGetIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+    for (PetscInt offset = 0; offset < numCells; offset += chunkSize) {
+        const PetscInt numChunkCells = PetscMin(chunkSize, numCells-offset);
+        PetscIS chunkIS = NULL;
+        err = ISCreateGeneral(PETSC_COMM_SELF, numChunkCells, &cells[offset], PETSC_COPY_VALUES, &chunkIS);PYLITH_CHECK_ERROR(err);
+        chunks->push_back(chunkIS);
+    } // for
+    err = ISRestoreIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _createCellChunks
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destroy chunks of cells for assembly.
+void
+pylith::feassemble::Integrator::_destroyCellChunks(std::vector<PetscIS>* chunks) {
+    PYLITH_METHOD_BEGIN;
+    assert(chunks);
+
+    PetscErrorCode err;
+    for (size_t i = 0; i < chunks->size(); ++i) {
+        err = ISDestroy(&(*chunks)[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    chunks->clear();
+
+    PYLITH_METHOD_END;
+} // _destroyCellChunks
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Setup performance instrumentation.
+void
+pylith::feassemble::Integrator::_initializeProfiling(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("_initializeProfiling(solution="<<solution.getLabel()<<")");
+
+    assert(_physics);
+    std::ostringstream name;
+    name << _physics->getIdentifier() << " (" << _labelName << "=" << _labelValue << ")";
+    _profileName = name.str();
+
+    delete _logger;_logger = new pylith::utils::EventLogger;assert(_logger);
+    _logger->setClassName(_physics->getIdentifier());
+    _logger->initialize();
+    for (int i = 0; i < PROFILE_NUM_EVENTS; ++i) {
+        std::ostringstream eventName;
+        eventName << "Py-" << _physics->getIdentifier() << "-" << getProfileEventName(ProfileEvent(i));
+        _logger->registerEvent(eventName.str().c_str());
+        _profileEvents[i] = _logger->getEvent(eventName.str().c_str());
+        _profileStats[i] = ProfileStats();
+    } // for
+
+    PetscErrorCode err = 0;
+    PetscDM dmDomain = getPhysicsDomainMesh().getDM();assert(dmDomain);
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmDomain, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    _profileNumCells = cEnd - cStart;
+
+    // Count each solution degree of freedom in the closure of the points in the integration domain once.
+    _profileNumDOF = 0;
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+    PetscSection section = solution.getLocalSection();assert(section);
+    PetscIS pointsIS = NULL;
+    err = DMGetStratumIS(dmSoln, _labelName.c_str(), _labelValue, &pointsIS);PYLITH_CHECK_ERROR(err);
+    if (pointsIS) {
+        PetscInt pStart = 0, pEnd = 0;
+        err = DMPlexGetChart(dmSoln, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        std::vector<bool> isCounted(pEnd-pStart, false);
+
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            PetscInt closureSize = 0;
+            PetscInt* closure = NULL;
+            err = DMPlexGetTransitiveClosure(dmSoln, points[iPoint], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iClosure = 0; iClosure < 2*closureSize; iClosure += 2) {
+                const PetscInt point = closure[iClosure];
+                if (isCounted[point-pStart]) { continue; }
+                isCounted[point-pStart] = true;
+
+                PetscInt numDOF = 0;
+                err = PetscSectionGetDof(section, point, &numDOF);PYLITH_CHECK_ERROR(err);
+                _profileNumDOF += numDOF;
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dmSoln, points[iPoint], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _initializeProfiling
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor. Begin event.
+pylith::feassemble::Integrator::ProfileScope::ProfileScope(Integrator* const integrator,
+                                                           const ProfileEvent event,
+                                                           const bool countCall) :
+    _integrator(integrator),
+    _event(event),
+    _countCall(countCall),
+    _timeBegin(0.0),
+    _flopsBegin(0.0) {
+    assert(_integrator);
+    assert(event >= 0 && event < PROFILE_NUM_EVENTS);
+
+#if !defined(PYLITH_DISABLE_EVENT_LOGGING)
+    // Events are not registered until initialize().
+    if (_integrator->_profileEvents[_event].isRegistered()) {
+        _integrator->_profileEvents[_event].begin();
+    } // if
+    pylith::utils::HardwareCounters::read(_countersBegin);
+    PetscGetFlops(&_flopsBegin);
+    PetscTime(&_timeBegin);
+#endif
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor. End event.
+pylith::feassemble::Integrator::ProfileScope::~ProfileScope(void) {
+#if !defined(PYLITH_DISABLE_EVENT_LOGGING)
+    // Errors are ignored, because the event may end while unwinding the stack for an exception.
+    PetscLogDouble timeEnd = 0.0;
+    PetscTime(&timeEnd);
+    double countersEnd[pylith::utils::HardwareCounters::NUM_COUNTERS];
+    pylith::utils::HardwareCounters::read(countersEnd);
+    PetscLogDouble flopsEnd = 0.0;
+    PetscGetFlops(&flopsEnd);
+
+    ProfileStats& stats = _integrator->_profileStats[_event];
+    stats.time += timeEnd - _timeBegin;
+    for (int i = 0; i < pylith::utils::HardwareCounters::NUM_COUNTERS; ++i) {
+        stats.counters[i] += countersEnd[i] - _countersBegin[i];
+    } // for
+    stats.flops += flopsEnd - _flopsBegin;
+    if (_countCall) {
+        ++stats.numCalls;
+    } // if
+
+    if (_integrator->_profileEvents[_event].isRegistered()) {
+        _integrator->_profileEvents[_event].end();
+    } // if
+#endif
+} // destructor
+
+
 // End of file
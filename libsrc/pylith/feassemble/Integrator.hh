@@ -32,6 +32,11 @@
 
 #include "pylith/utils/petscfwd.h" // USES PetscMat, PetscVec
 #include "pylith/utils/utilsfwd.hh" // HOLDSA Logger
+#include "pylith/utils/EventLogger.hh" // HASA EventLogger::Event
+#include "pylith/utils/HardwareCounters.hh" // USES HardwareCounters::NUM_COUNTERS
+
+#include <vector> // USES std::vector
+#include <string> // HASA std::string
 
 class pylith::feassemble::Integrator : public pylith::feassemble::PhysicsImplementation {
     friend class TestIntegrator; // unit testing
@@ -44,6 +49,9 @@ public:
         RHS=1,
         LHS_LUMPED_INV=2,
         LHS_WEIGHTED=3,
+        LHS_CONSTANT=4, // LHS terms independent of solution and time.
+        RHS_CONSTANT=5, // RHS terms independent of solution and time.
+        LHS_PRECONDITIONER=6, // LHS Jacobian terms used only in the preconditioner.
     };
 
     enum NewJacobianTriggers {
@@ -53,6 +61,25 @@ public:
         NEW_JACOBIAN_UPDATE_STATE_VARS=0x4, // Needs new Jacobian after updating state variables.
     };
 
+    /// Operations with performance instrumentation.
+    enum ProfileEvent {
+        PROFILE_RHS_RESIDUAL=0,
+        PROFILE_LHS_RESIDUAL=1,
+        PROFILE_LHS_JACOBIAN=2,
+        PROFILE_LHS_JACOBIAN_LUMPED_INV=3,
+        PROFILE_UPDATE_STATE_VARS=4,
+        PROFILE_DERIVED_FIELD=5,
+        PROFILE_NUM_EVENTS=6,
+    };
+
+    /// Accumulated statistics for an instrumented operation on this process.
+    struct ProfileStats {
+        size_t numCalls; ///< Number of calls.
+        double time; ///< Elapsed wall clock time (s).
+        double counters[pylith::utils::HardwareCounters::NUM_COUNTERS]; ///< Hardware counters (zero if not active).
+        double flops; ///< Floating point operations logged by PETSc.
+    };
+
     // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -89,6 +116,37 @@ public:
      */
     int getLabelValue(void) const;
 
+    /** Set maximum number of cells assembled in each call to the PETSc assembly routines.
+     *
+     * PETSc allocates element work arrays for all cells passed to an assembly routine, so assembling the cells in
+     * chunks limits the memory for the work arrays (especially the element matrices for the Jacobian).
+     *
+     * @param[in] value Maximum number of cells in chunk (0 for all cells).
+     */
+    void setAssemblyChunkSize(const size_t value);
+
+    /** Get maximum number of cells assembled in each call to the PETSc assembly routines.
+     *
+     * @returns Maximum number of cells in chunk (0 for all cells).
+     */
+    size_t getAssemblyChunkSize(void) const;
+
+    /** Set flag for caching cell geometry between assembly calls.
+     *
+     * PETSc attaches the cell geometry (Jacobians, determinants, and coordinates of quadrature points) to the index
+     * set of cells passed to the assembly routines. Keeping the same index sets across residual and Jacobian
+     * evaluations reuses the geometry until the coordinates change.
+     *
+     * @param[in] value True to cache cell geometry, false to recompute it in every assembly call.
+     */
+    void setCacheGeometry(const bool value);
+
+    /** Get flag for caching cell geometry between assembly calls.
+     *
+     * @returns True if cell geometry is cached, false otherwise.
+     */
+    bool getCacheGeometry(void) const;
+
     /** Check whether LHS Jacobian needs to be recomputed.
      *
      * @param[in] dtChanged True if time step has changed since previous Jacobian computation.
@@ -115,6 +173,39 @@ public:
      */
     void setLHSJacobianLumpedTriggers(const int value);
 
+    /** Get name identifying integrator in performance instrumentation.
+     *
+     * @returns Physics identifier with label name and value.
+     */
+    const char* getProfileName(void) const;
+
+    /** Get number of cells in the integration domain on this process.
+     *
+     * @returns Number of cells.
+     */
+    size_t getProfileNumCells(void) const;
+
+    /** Get number of solution degrees of freedom in the integration domain on this process.
+     *
+     * @returns Number of degrees of freedom.
+     */
+    size_t getProfileNumDOF(void) const;
+
+    /** Get accumulated statistics for instrumented operation.
+     *
+     * @param[in] event Instrumented operation.
+     * @returns Number of calls and elapsed time.
+     */
+    const ProfileStats& getProfileStats(const ProfileEvent event) const;
+
+    /** Get name of instrumented operation.
+     *
+     * @param[in] event Instrumented operation.
+     * @returns Name of operation.
+     */
+    static
+    const char* getProfileEventName(const ProfileEvent event);
+
     /** Initialize integration domain, auxiliary field, and derived field. Update observers.
      *
      * @param[in] solution Solution field (layout).
@@ -122,6 +213,13 @@ public:
     virtual
     void initialize(const pylith::topology::Field& solution);
 
+    /** Recompute values of auxiliary field from spatial databases and require new LHS Jacobians.
+     *
+     * @param[in] solution Solution field (layout).
+     */
+    virtual
+    void reinitialize(const pylith::topology::Field& solution);
+
     /** Update at end of time step.
      *
      * @param[in] t Current time.
@@ -135,6 +233,20 @@ public:
                   const PylithReal dt,
                   const pylith::topology::Field& solution);
 
+    /** Notify observers of solution corresponding to initial conditions.
+     *
+     * Computes the derived field first if any observer needs an update.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] dt Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void notifyObserversInitialSoln(const PylithReal t,
+                                    const PylithInt tindex,
+                                    const PylithReal dt,
+                                    const pylith::topology::Field& solution);
+
     /** Set auxiliary field values for current time.
      *
      * @param[in] t Current time.
@@ -151,6 +263,18 @@ public:
     void computeRHSResidual(pylith::topology::Field* residual,
                             const pylith::feassemble::IntegrationData& integrationData) = 0;
 
+    /** Compute RHS residual for G(t,s) at the degrees of freedom in the fast rate group of local time stepping.
+     *
+     * The residual is only correct at the degrees of freedom in the fast rate group. Default is to compute the
+     * entire residual via computeRHSResidual().
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    virtual
+    void computeRHSResidualFast(pylith::topology::Field* residual,
+                                const pylith::feassemble::IntegrationData& integrationData);
+
     /** Compute LHS residual for F(t,s,\dot{s}).
      *
      * @param[out] residual Field for residual.
@@ -160,6 +284,31 @@ public:
     void computeLHSResidual(pylith::topology::Field* residual,
                             const pylith::feassemble::IntegrationData& integrationData) = 0;
 
+    /** Compute LHS residual for F(t,s,\dot{s}) over cells that do not depend on ghost or constrained values.
+     *
+     * Used to overlap assembly with the exchange of ghost values of the solution. Together with
+     * computeLHSResidualBoundary() it computes the same residual as computeLHSResidual(). Default is to compute nothing
+     * here.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    virtual
+    void computeLHSResidualInterior(pylith::topology::Field* residual,
+                                    const pylith::feassemble::IntegrationData& integrationData);
+
+    /** Compute remaining LHS residual for F(t,s,\dot{s}) after computeLHSResidualInterior().
+     *
+     * Called after the ghost values of the solution and the constrained values are available. Default is to compute
+     * the entire residual via computeLHSResidual().
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    virtual
+    void computeLHSResidualBoundary(pylith::topology::Field* residual,
+                                    const pylith::feassemble::IntegrationData& integrationData);
+
     /** Compute LHS Jacobian and preconditioner for F(t,s,\dot{s}) with implicit time-stepping.
      *
      * @param[out] jacobianMat PETSc Mat with Jacobian sparse matrix.
@@ -180,9 +329,84 @@ public:
     void computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                      const pylith::feassemble::IntegrationData& integrationData) = 0;
 
+    /** Can the action of the LHS Jacobian be computed without assembling the Jacobian?
+     *
+     * @returns True if computeLHSJacobianAction() is supported, false otherwise.
+     */
+    virtual
+    bool hasLHSJacobianAction(void) const;
+
+    /** Is the LHS residual linear in the solution with a Jacobian and load that do not depend on time?
+     *
+     * Such residuals can be formed from the stored Jacobian and a cached load vector in linear problems.
+     *
+     * @returns True if LHS residual is linear and independent of time, false otherwise.
+     */
+    virtual
+    bool hasTimeIndependentLHSResidual(void) const;
+
+    /** Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector without assembling the Jacobian.
+     *
+     * Contributions are added to the action vector.
+     *
+     * @param[inout] actionVec Local PETSc Vec with action of Jacobian, J*v.
+     * @param[in] vectorVec Local PETSc Vec with vector, v, on which the Jacobian acts.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    virtual
+    void computeLHSJacobianAction(PetscVec actionVec,
+                                  PetscVec vectorVec,
+                                  const pylith::feassemble::IntegrationData& integrationData);
+
+    // PROTECTED CLASSES //////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Log PETSc event and accumulate statistics for an instrumented operation over the lifetime of the object.
+     *
+     * The PETSc events of each integrator are registered in a separate logging class named by the physics
+     * identifier, so the PETSc events of the finite-element assembly (and the kernels) are nested within them.
+     */
+    class ProfileScope {
+public:
+
+        /** Constructor. Begin event.
+         *
+         * @param[in] integrator Integrator with operation.
+         * @param[in] event Instrumented operation.
+         * @param[in] countCall Count call to operation (false if operation is split over several calls).
+         */
+        ProfileScope(Integrator* const integrator,
+                     const ProfileEvent event,
+                     const bool countCall=true);
+
+        /// Destructor. End event.
+        ~ProfileScope(void);
+
+private:
+
+        Integrator* const _integrator; ///< Integrator with operation.
+        const ProfileEvent _event; ///< Instrumented operation.
+        const bool _countCall; ///< True if call should be counted.
+        double _timeBegin; ///< Wall clock time at beginning of event.
+        double _countersBegin[pylith::utils::HardwareCounters::NUM_COUNTERS]; ///< Hardware counters at beginning.
+        double _flopsBegin; ///< Floating point operations logged by PETSc at beginning of event.
+
+        ProfileScope(const ProfileScope&); ///< Not implemented.
+        const ProfileScope& operator=(const ProfileScope&); ///< Not implemented.
+    }; // ProfileScope
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
+    /** Setup performance instrumentation.
+     *
+     * Registers PETSc events for each instrumented operation and counts the cells and solution degrees of
+     * freedom in the integration domain.
+     *
+     * @param[in] solution Solution field.
+     */
+    void _initializeProfiling(const pylith::topology::Field& solution);
+
     /** Set constants used in finite-element kernels.
      *
      * @param[in] solution Solution field.
@@ -214,6 +438,21 @@ protected:
                               const PylithReal dt,
                               const pylith::topology::Field& solution);
 
+    /** Split cells into chunks for assembly.
+     *
+     * @param[out] chunks Index sets of cells in each chunk (caller is responsible for destroying them).
+     * @param[in] cellsIS Index set of cells.
+     */
+    void _createCellChunks(std::vector<PetscIS>* chunks,
+                           PetscIS cellsIS) const;
+
+    /** Destroy chunks of cells for assembly.
+     *
+     * @param[inout] chunks Index sets of cells in each chunk.
+     */
+    static
+    void _destroyCellChunks(std::vector<PetscIS>* chunks);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -222,6 +461,8 @@ protected:
 
     int _lhsJacobianTriggers; // Triggers for needing new LHS Jacobian.
     int _lhsJacobianLumpedTriggers; // Triggers for needing new LHS lumped Jacobian.
+    size_t _assemblyChunkSize; ///< Maximum number of cells in each chunk for assembly (0 for all cells).
+    bool _cacheGeometry; ///< True if cell geometry is cached between assembly calls.
 
     /// True if we have kernels for operation, false otherwise.
     bool _hasRHSResidual;
@@ -234,6 +475,12 @@ protected:
     bool _needNewLHSJacobian;
     bool _needNewLHSJacobianLumped;
 
+    std::string _profileName; ///< Name identifying integrator in performance instrumentation.
+    pylith::utils::EventLogger::Event _profileEvents[PROFILE_NUM_EVENTS]; ///< Event handles for instrumented operations.
+    ProfileStats _profileStats[PROFILE_NUM_EVENTS]; ///< Accumulated statistics for instrumented operations.
+    size_t _profileNumCells; ///< Number of cells in integration domain on this process.
+    size_t _profileNumDOF; ///< Number of solution degrees of freedom in integration domain on this process.
+
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
 
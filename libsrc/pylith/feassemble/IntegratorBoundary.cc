@@ -144,7 +144,7 @@ pylith::feassemble::IntegratorBoundary::setKernelsResidual(const std::vector<Res
         } // switch
     } // for
 
-    pythia::journal::debug_t debug(GenericComponent::getName());
+    pythia::journal::debug_t& debug = GenericComponent::getDebugJournal();
     if (debug.state()) {
         err = PetscDSView(dsLabel.ds(), PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
     } // if
@@ -175,7 +175,7 @@ pylith::feassemble::IntegratorBoundary::initialize(const pylith::topology::Field
     err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, LHS, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
     err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, RHS, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
 
-    pythia::journal::debug_t debug(GenericComponent::getName());
+    pythia::journal::debug_t& debug = GenericComponent::getDebugJournal();
     if (debug.state()) {
         PYLITH_JOURNAL_DEBUG("Viewing auxiliary field.");
         _auxiliaryField->view("Auxiliary field");
@@ -190,14 +190,15 @@ pylith::feassemble::IntegratorBoundary::initialize(const pylith::topology::Field
 void
 pylith::feassemble::IntegratorBoundary::setState(const double t) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setState(t="<<t<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" setState(t="<<t<<")");
 
     Integrator::setState(t);
 
     assert(_physics);
     _physics->updateAuxiliaryField(_auxiliaryField, t);
 
-    pythia::journal::debug_t debug(GenericComponent::getName());
+#if !defined(PYLITH_DISABLE_CALLBACK_DEBUG)
+    pythia::journal::debug_t& debug = GenericComponent::getDebugJournal();
     if (debug.state()) {
         assert(_auxiliaryField);
         PYLITH_JOURNAL_DEBUG("IntegratorInterface component '" << GenericComponent::getName() << "' for '"
@@ -205,6 +206,7 @@ pylith::feassemble::IntegratorBoundary::setState(const double t) {
                                                                << "': viewing auxiliary field.");
         _auxiliaryField->view("IntegratorInterface auxiliary field", pylith::topology::Field::VIEW_ALL);
     } // if
+#endif
 
     PYLITH_METHOD_END;
 } // setState
@@ -216,14 +218,15 @@ void
 pylith::feassemble::IntegratorBoundary::computeRHSResidual(pylith::topology::Field* residual,
                                                            const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasRHSResidual) { PYLITH_METHOD_END;}
     assert(residual);
+    ProfileScope profile(this, PROFILE_RHS_RESIDUAL);
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
+    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
+    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP);
 
     DSLabelAccess dsLabel(solution->getDM(), _labelName.c_str(), _labelValue);
     _setKernelConstants(*solution, dt);
@@ -251,16 +254,17 @@ void
 pylith::feassemble::IntegratorBoundary::computeLHSResidual(pylith::topology::Field* residual,
                                                            const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasLHSResidual) { PYLITH_METHOD_END;}
     assert(residual);
+    ProfileScope profile(this, PROFILE_LHS_RESIDUAL);
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
-    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::solution_dot);
+    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);
     assert(solutionDot);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
+    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
+    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP);
 
     DSLabelAccess dsLabel(solution->getDM(), _labelName.c_str(), _labelValue);
     _setKernelConstants(*solution, dt);
@@ -288,7 +292,7 @@ pylith::feassemble::IntegratorBoundary::computeLHSJacobian(PetscMat jacobianMat,
                                                            PetscMat precondMat,
                                                            const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSJacobian(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", integrationData="<<integrationData.str()<<") empty method");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSJacobian(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", integrationData="<<integrationData.str()<<") empty method");
 
     _needNewLHSJacobian = false;
     // No implementation needed for boundary.
@@ -303,7 +307,7 @@ void
 pylith::feassemble::IntegratorBoundary::computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                                                     const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSJacobianLumpedInv(jacobianInv="<<jacobianInv<<", integrationData="<<integrationData.str()<<") empty method");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSJacobianLumpedInv(jacobianInv="<<jacobianInv<<", integrationData="<<integrationData.str()<<") empty method");
 
     _needNewLHSJacobianLumped = false;
     // No implementation needed for boundary.
@@ -30,13 +30,19 @@
 #include "pylith/topology/MeshOps.hh" // USES createSubdomainMesh()
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
 
 #include "spatialdata/spatialdb/GravityField.hh" // HASA GravityField
 #include "petscds.h" // USES PetscDS
 
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
+#include <algorithm> // USES std::max()
 #include <cassert> // USES assert()
+#include <cmath> // USES sqrt()
+#include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
 extern "C" PetscErrorCode DMPlexComputeResidual_Internal(PetscDM dm,
@@ -94,10 +100,23 @@ public:
 // Default constructor.
 pylith::feassemble::IntegratorDomain::IntegratorDomain(pylith::problems::Physics* const physics) :
     Integrator(physics),
+    _stateVarsAuxiliaryVec(NULL),
+    _derivedFieldAuxiliaryVec(NULL),
     _materialMesh(NULL),
     _updateState(NULL),
     _jacobianValues(NULL),
-    _dsLabel(NULL) {
+    _dsLabel(NULL),
+    _haveInteriorBoundaryChunks(false),
+    _haveFastCellChunks(false),
+    _geometryCoordinates(NULL),
+    _geometryCoordinatesState(-1),
+    _hasTimeDependentLHSResidual(false),
+    _hasLHSResidualConstant(false),
+    _hasRHSResidualConstant(false),
+    _lhsResidualConstant(NULL),
+    _rhsResidualConstant(NULL),
+    _lhsResidualConstantState(-1),
+    _rhsResidualConstantState(-1) {
     GenericComponent::setName("integratordomain");
 } // constructor
 
@@ -121,6 +140,19 @@ pylith::feassemble::IntegratorDomain::deallocate(void) {
     delete _updateState;_updateState = NULL;
     delete _jacobianValues;_jacobianValues = NULL;
     delete _dsLabel;_dsLabel = NULL;
+    _stateVarsAuxiliaryVec = NULL;
+    _derivedFieldAuxiliaryVec = NULL;
+    _destroyCellChunks(&_cellChunks);
+    _destroyCellChunks(&_interiorCellChunks);
+    _destroyCellChunks(&_boundaryCellChunks);
+    _haveInteriorBoundaryChunks = false;
+    _destroyCellChunks(&_fastCellChunks);
+    _haveFastCellChunks = false;
+    _geometryCoordinates = NULL;
+
+    PetscErrorCode err;
+    err = VecDestroy(&_lhsResidualConstant);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_rhsResidualConstant);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -159,12 +191,20 @@ pylith::feassemble::IntegratorDomain::setKernelsResidual(const std::vector<Resid
         case RHS:
             _hasRHSResidual = true;
             break;
+        case LHS_CONSTANT:
+            _hasLHSResidual = true;
+            _hasLHSResidualConstant = true;
+            break;
+        case RHS_CONSTANT:
+            _hasRHSResidual = true;
+            _hasRHSResidualConstant = true;
+            break;
         default:
             PYLITH_JOURNAL_LOGICERROR("Unknown residual part " << kernels[i].part <<".");
         } // switch
     } // for
 
-    pythia::journal::debug_t debug(GenericComponent::getName());
+    pythia::journal::debug_t& debug = GenericComponent::getDebugJournal();
     if (debug.state()) {
         err = PetscDSView(dsLabel.ds(), PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
     } // if
@@ -186,13 +226,19 @@ pylith::feassemble::IntegratorDomain::setKernelsJacobian(const std::vector<Jacob
         const PetscInt i_fieldTrial = solution.getSubfieldInfo(kernels[i].subfieldTrial.c_str()).index;
         const PetscInt i_fieldBasis = solution.getSubfieldInfo(kernels[i].subfieldBasis.c_str()).index;
         const PetscInt i_part = kernels[i].part;
-        if (dsLabel.weakForm()) {
+        if (dsLabel.weakForm() && (LHS_PRECONDITIONER == kernels[i].part)) {
+            // Preconditioner terms use the same key as the LHS Jacobian.
+            err = PetscWeakFormAddJacobianPreconditioner(dsLabel.weakForm(), dsLabel.label(), dsLabel.value(), i_fieldTrial,
+                                                         i_fieldBasis, LHS, kernels[i].j0, kernels[i].j1, kernels[i].j2,
+                                                         kernels[i].j3);PYLITH_CHECK_ERROR(err);
+        } else if (dsLabel.weakForm()) {
             err = PetscWeakFormAddJacobian(dsLabel.weakForm(), dsLabel.label(), dsLabel.value(), i_fieldTrial, i_fieldBasis,
                                            i_part, kernels[i].j0, kernels[i].j1, kernels[i].j2, kernels[i].j3);PYLITH_CHECK_ERROR(err);
-        } // if
+        } // if/else
 
         switch (kernels[i].part) {
         case LHS:
+        case LHS_PRECONDITIONER:
             _hasLHSJacobian = true;
             break;
         case LHS_LUMPED_INV:
@@ -203,7 +249,7 @@ pylith::feassemble::IntegratorDomain::setKernelsJacobian(const std::vector<Jacob
         } // switch
     } // for
 
-    pythia::journal::debug_t debug(GenericComponent::getName());
+    pythia::journal::debug_t& debug = GenericComponent::getDebugJournal();
     if (debug.state()) {
         err = PetscDSView(dsLabel.ds(), PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
     } // if
@@ -231,6 +277,14 @@ pylith::feassemble::IntegratorDomain::setKernelsUpdateStateVars(const std::vecto
 
     _kernelsUpdateStateVars = kernels;
 
+    // We assume order of the update state variable kernels matches the order of the corresponding subfields in the
+    // auxiliary field.
+    const size_t numKernels = kernels.size();
+    _kernelsArrayUpdateStateVars.resize(numKernels);
+    for (size_t iKernel = 0; iKernel < numKernels; ++iKernel) {
+        _kernelsArrayUpdateStateVars[iKernel] = kernels[iKernel].f;
+    } // for
+
     PYLITH_METHOD_END;
 } // setKernelsUpdateStateVars
 
@@ -242,11 +296,24 @@ pylith::feassemble::IntegratorDomain::setKernelsDerivedField(const std::vector<P
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setKernelsDerivedField(# kernels="<<kernels.size()<<")");
 
     _kernelsDerivedField = kernels;
+    if (_derivedField) {
+        _setKernelsArrayDerivedField();
+    } // if
 
     PYLITH_METHOD_END;
 } // setKernelsDerivedField
 
 
+// ------------------------------------------------------------------------------------------------
+// Set whether the LHS residual kernels depend explicitly on time.
+void
+pylith::feassemble::IntegratorDomain::setTimeDependentLHSResidual(const bool value) {
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setTimeDependentLHSResidual(value="<<value<<")");
+
+    _hasTimeDependentLHSResidual = value;
+} // setTimeDependentLHSResidual
+
+
 // ------------------------------------------------------------------------------------------------
 // Initialize integration domain, auxiliary field, and derived field. Update observers.
 void
@@ -259,6 +326,10 @@ pylith::feassemble::IntegratorDomain::initialize(const pylith::topology::Field&
     pylith::topology::CoordsVisitor::optimizeClosure(_materialMesh->getDM());
 
     Integrator::initialize(solution);
+    _derivedFieldAuxiliaryVec = NULL;
+    if (_derivedField) {
+        _setKernelsArrayDerivedField();
+    } // if
 
     assert(_auxiliaryField);
     PetscErrorCode err;
@@ -268,16 +339,29 @@ pylith::feassemble::IntegratorDomain::initialize(const pylith::topology::Field&
     err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, LHS, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
     err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, RHS, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
     err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, LHS_LUMPED_INV, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, LHS_CONSTANT, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, RHS_CONSTANT, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
 
     if (_kernelsUpdateStateVars.size() > 0) {
         delete _updateState;_updateState = new pylith::feassemble::UpdateStateVars;assert(_updateState);
         _updateState->initialize(*_auxiliaryField);
+        _stateVarsAuxiliaryVec = NULL;
+        const std::string& group = std::string("update state variables ") + getProfileName();
+        pylith::utils::MemoryLogger::setGroup(_updateState, group.c_str());
     } // if
 
     delete _dsLabel;_dsLabel = new DSLabelAccess(solution.getDM(), _labelName.c_str(), _labelValue);assert(_dsLabel);
     _dsLabel->removeOverlap();
-
-    pythia::journal::debug_t debug(GenericComponent::getName());
+    _destroyCellChunks(&_cellChunks);
+    _createCellChunks(&_cellChunks, _dsLabel->cellsIS());
+    _destroyCellChunks(&_interiorCellChunks);
+    _destroyCellChunks(&_boundaryCellChunks);
+    _haveInteriorBoundaryChunks = false;
+    _destroyCellChunks(&_fastCellChunks);
+    _haveFastCellChunks = false;
+    _geometryCoordinates = NULL;
+
+    pythia::journal::debug_t& debug = GenericComponent::getDebugJournal();
     if (debug.state()) {
         PYLITH_JOURNAL_DEBUG("Viewing auxiliary field.");
         _auxiliaryField->view("Auxiliary field");
@@ -333,7 +417,7 @@ pylith::feassemble::IntegratorDomain::setInterfaceData(const pylith::topology::F
             } // if
 
             if (faceCount > 0) { // JOURNAL DEBUGGING
-                pythia::journal::debug_t debug(GenericComponent::getName());
+                pythia::journal::debug_t& debug = GenericComponent::getDebugJournal();
                 debug << pythia::journal::at(__HERE__) \
                       << "    Found matching interface patch "
                       << patches->getLabelName() << "=" << iter->first << ":";
@@ -371,14 +455,15 @@ pylith::feassemble::IntegratorDomain::setInterfaceData(const pylith::topology::F
 void
 pylith::feassemble::IntegratorDomain::setState(const PylithReal t) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("setState(t="<<t<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("setState(t="<<t<<")");
 
     Integrator::setState(t);
 
     assert(_physics);
     _physics->updateAuxiliaryField(_auxiliaryField, t);
 
-    pythia::journal::debug_t debug(GenericComponent::getName());
+#if !defined(PYLITH_DISABLE_CALLBACK_DEBUG)
+    pythia::journal::debug_t& debug = GenericComponent::getDebugJournal();
     if (debug.state()) {
         assert(_auxiliaryField);
         PYLITH_JOURNAL_DEBUG("IntegratorInterface component '" << GenericComponent::getName() << "' for '"
@@ -386,43 +471,220 @@ pylith::feassemble::IntegratorDomain::setState(const PylithReal t) {
                                                                << "': viewing auxiliary field.");
         _auxiliaryField->view("IntegratorInterface auxiliary field", pylith::topology::Field::VIEW_ALL);
     } // if
+#endif
 
     PYLITH_METHOD_END;
 } // setState
 
 
+// ------------------------------------------------------------------------------------------------
+// Set subfield of auxiliary field by projecting a kernel for the derived field.
+void
+pylith::feassemble::IntegratorDomain::setAuxiliarySubfieldFromDerived(const char* auxiliarySubfieldName,
+                                                                      const char* derivedSubfieldName,
+                                                                      const PylithReal t,
+                                                                      const PylithReal dt,
+                                                                      const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setAuxiliarySubfieldFromDerived(auxiliarySubfieldName="<<auxiliarySubfieldName<<", derivedSubfieldName="<<derivedSubfieldName<<", t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<")");
+
+    assert(_auxiliaryField);
+    assert(_physics);
+    PetscPointFunc kernel = NULL;
+    for (size_t i = 0; i < _kernelsDerivedField.size(); ++i) {
+        if (_kernelsDerivedField[i].subfield == derivedSubfieldName) {
+            kernel = _kernelsDerivedField[i].f;
+            break;
+        } // if
+    } // for
+    if (!kernel || !_auxiliaryField->hasSubfield(auxiliarySubfieldName)) {
+        std::ostringstream msg;
+        msg << "Cannot set auxiliary subfield '" << auxiliarySubfieldName << "' from derived subfield '"
+            << derivedSubfieldName << "' for '" << _physics->getIdentifier() << "'.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    _setKernelConstants(solution, dt);
+
+    pylith::feassemble::UpdateStateVars updateSubfield;
+    updateSubfield.initialize(*_auxiliaryField, pylith::string_vector(1, auxiliarySubfieldName));
+    updateSubfield.prepare(_auxiliaryField);
+
+    PetscErrorCode err = 0;
+    PetscDM subfieldDM = updateSubfield.stateVarsDM();
+    PetscDMLabel dmLabel = NULL;
+    PetscInt labelValue = 0;
+    const PetscInt part = 0;
+    err = DMSetAuxiliaryVec(subfieldDM, dmLabel, labelValue, part, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    err = DMProjectFieldLocal(subfieldDM, t, solution.getLocalVector(), &kernel, INSERT_VALUES,
+                              updateSubfield.stateVarsLocalVector());PYLITH_CHECK_ERROR(err);
+    updateSubfield.restore(_auxiliaryField);
+
+    PYLITH_METHOD_END;
+} // setAuxiliarySubfieldFromDerived
+
+
 // ------------------------------------------------------------------------------------------------
 // Compute RHS residual for G(t,s).
 void
 pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field* residual,
                                                          const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
-    if (!_hasRHSResidual) { PYLITH_METHOD_END;}
-    assert(residual);
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
-    assert(solution);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
+    _updateGeometryCache();
+    _computeRHSResidual(residual, integrationData, _cellChunks);
+
+    PYLITH_METHOD_END;
+} // computeRHSResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute RHS residual for G(t,s) over cells with points in the fast rate group of local time stepping.
+void
+pylith::feassemble::IntegratorDomain::computeRHSResidualFast(pylith::topology::Field* residual,
+                                                             const pylith::feassemble::IntegrationData& integrationData) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeRHSResidualFast(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
+
+    _updateGeometryCache();
+    _computeRHSResidual(residual, integrationData, _haveFastCellChunks ? _fastCellChunks : _cellChunks);
+
+    PYLITH_METHOD_END;
+} // computeRHSResidualFast
 
-    _setKernelConstants(*solution, dt);
 
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for explicit time stepping in each cell.
+void
+pylith::feassemble::IntegratorDomain::computeStableTimeSteps(std::vector<PetscInt>* cells,
+                                                             std::vector<PylithReal>* dtStable) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeStableTimeSteps(cells="<<cells<<", dtStable="<<dtStable<<")");
+    assert(cells);
+    assert(dtStable);
     assert(_dsLabel);
-    PetscFormKey key;
-    key.label = _dsLabel->label();
-    key.value = _dsLabel->value();
-    key.part = pylith::feassemble::Integrator::RHS;
 
-    PetscErrorCode err;
-    assert(solution->getLocalVector());
-    assert(residual->getLocalVector());
-    PetscVec solutionDotVec = NULL;
-    err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
-                                         solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    PetscErrorCode err = 0;
+    const PetscInt numCells = _dsLabel->numCells();
+    const PetscInt* cellsLabel = NULL;
+    err = ISGetIndices(_dsLabel->cellsIS(), &cellsLabel);PYLITH_CHECK_ERROR(err);
+    cells->assign(cellsLabel, cellsLabel+numCells);
+    err = ISRestoreIndices(_dsLabel->cellsIS(), &cellsLabel);PYLITH_CHECK_ERROR(err);
+    dtStable->assign(numCells, PYLITH_MAXSCALAR);
+
+    if (!_auxiliaryField || !_auxiliaryField->hasSubfield("density") || !_auxiliaryField->hasSubfield("shear_modulus")
+        || !_auxiliaryField->hasSubfield("bulk_modulus")) {
+        PYLITH_METHOD_END;
+    } // if
+
+    const PetscInt i_density = _auxiliaryField->getSubfieldInfo("density").index;
+    const PetscInt i_shearModulus = _auxiliaryField->getSubfieldInfo("shear_modulus").index;
+    const PetscInt i_bulkModulus = _auxiliaryField->getSubfieldInfo("bulk_modulus").index;
+    pylith::topology::VecVisitorMesh auxiliaryVisitor(*_auxiliaryField);
+    const PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+
+    PetscDM dm = _dsLabel->dm();assert(dm);
+    PetscInt dim = 0;
+    PetscDM dmCoord = NULL;
+    PetscSection coordSection = NULL;
+    PetscVec coordVec = NULL;
+    err = DMGetCoordinateDim(dm, &dim);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinateDM(dm, &dmCoord);PYLITH_CHECK_ERROR(err);
+    err = DMGetLocalSection(dmCoord, &coordSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinatesLocal(dm, &coordVec);PYLITH_CHECK_ERROR(err);
+
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = (*cells)[iCell];
+
+        // Maximum dilatational wave speed over points in closure with auxiliary values.
+        PylithReal vpMax = 0.0;
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+            const PetscInt point = closure[2*iPoint];
+            if (!auxiliaryVisitor.sectionSubfieldDof(i_density, point)) { continue; }
+            const PylithScalar density = auxiliaryArray[auxiliaryVisitor.sectionSubfieldOffset(i_density, point)];
+            const PylithScalar shearModulus = auxiliaryArray[auxiliaryVisitor.sectionSubfieldOffset(i_shearModulus, point)];
+            const PylithScalar bulkModulus = auxiliaryArray[auxiliaryVisitor.sectionSubfieldOffset(i_bulkModulus, point)];
+            if (density > 0.0) {
+                vpMax = std::max(vpMax, sqrt((bulkModulus + 4.0/3.0*shearModulus) / density));
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        if (vpMax <= 0.0) { continue; }
+
+        // Minimum distance between vertices of cell.
+        PetscScalar* coords = NULL;
+        PetscInt coordsSize = 0;
+        err = DMPlexVecGetClosure(dmCoord, coordSection, coordVec, cell, &coordsSize, &coords);PYLITH_CHECK_ERROR(err);
+        const PetscInt numVertices = coordsSize / dim;
+        PylithReal distMin = PYLITH_MAXSCALAR;
+        for (PetscInt iVertex = 0; iVertex < numVertices; ++iVertex) {
+            for (PetscInt jVertex = iVertex+1; jVertex < numVertices; ++jVertex) {
+                PylithReal distSquared = 0.0;
+                for (PetscInt iDim = 0; iDim < dim; ++iDim) {
+                    const PylithReal delta = PetscRealPart(coords[iVertex*dim+iDim] - coords[jVertex*dim+iDim]);
+                    distSquared += delta*delta;
+                } // for
+                distMin = std::min(distMin, sqrt(distSquared));
+            } // for
+        } // for
+        err = DMPlexVecRestoreClosure(dmCoord, coordSection, coordVec, cell, &coordsSize, &coords);PYLITH_CHECK_ERROR(err);
+
+        (*dtStable)[iCell] = distMin / vpMax;
+    } // for
 
     PYLITH_METHOD_END;
-} // computeRHSResidual
+} // computeStableTimeSteps
+
+
+// ------------------------------------------------------------------------------------------------
+// Set points in the fast rate group of local time stepping.
+void
+pylith::feassemble::IntegratorDomain::setFastPoints(const std::vector<bool>& isFastPoint) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setFastPoints(isFastPoint="<<&isFastPoint<<")");
+    assert(_dsLabel);
+
+    PetscErrorCode err = 0;
+    PetscDM dm = _dsLabel->dm();assert(dm);
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(size_t(pEnd-pStart) == isFastPoint.size());
+
+    const PetscInt numCells = _dsLabel->numCells();
+    const PetscInt* cells = NULL;
+    std::vector<PetscInt> fastCells;
+    err = ISGetIndices(_dsLabel->cellsIS(), &cells);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = cells[iCell];
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        bool isFast = false;
+        err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize && !isFast; ++iPoint) {
+            isFast = isFastPoint[closure[2*iPoint]-pStart];
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        if (isFast) {
+            fastCells.push_back(cell);
+        } // if
+    } // for
+    err = ISRestoreIndices(_dsLabel->cellsIS(), &cells);PYLITH_CHECK_ERROR(err);
+    PYLITH_JOURNAL_DEBUG_CALLBACK("Integrating "<<fastCells.size()<<" of "<<numCells<<" cells in fast rate group.");
+
+    PetscIS fastIS = NULL;
+    err = ISCreateGeneral(PETSC_COMM_SELF, fastCells.size(), fastCells.size() ? &fastCells[0] : NULL,
+                          PETSC_COPY_VALUES, &fastIS);PYLITH_CHECK_ERROR(err);
+    _destroyCellChunks(&_fastCellChunks);
+    _createCellChunks(&_fastCellChunks, fastIS);
+    err = ISDestroy(&fastIS);PYLITH_CHECK_ERROR(err);
+    _haveFastCellChunks = true;
+
+    PYLITH_METHOD_END;
+} // setFastPoints
 
 
 // ------------------------------------------------------------------------------------------------
@@ -431,33 +693,45 @@ void
 pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field* residual,
                                                          const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
-    if (!_hasLHSResidual) { PYLITH_METHOD_END; }
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
-    assert(solution);
-    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::solution_dot);
-    assert(solutionDot);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
+    _updateGeometryCache();
+    _computeLHSResidual(residual, integrationData, _cellChunks, true);
 
-    _setKernelConstants(*solution, dt);
+    PYLITH_METHOD_END;
+} // computeLHSResidual
 
-    assert(_dsLabel);
-    PetscFormKey key;
-    key.label = _dsLabel->label();
-    key.value = _dsLabel->value();
-    key.part = pylith::feassemble::Integrator::LHS;
 
-    PetscErrorCode err;
-    assert(solution->getLocalVector());
-    assert(solutionDot->getLocalVector());
-    assert(residual->getLocalVector());
-    err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
-                                         solutionDot->getLocalVector(), t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+// ------------------------------------------------------------------------------------------------
+// Compute LHS residual for F(t,s,\dot{s}) over cells without ghost or constrained points in their closure.
+void
+pylith::feassemble::IntegratorDomain::computeLHSResidualInterior(pylith::topology::Field* residual,
+                                                                 const pylith::feassemble::IntegrationData& integrationData) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSResidualInterior(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
+
+    _updateGeometryCache();
+    if (!_haveInteriorBoundaryChunks) { _createInteriorBoundaryChunks(); }
+    _computeLHSResidual(residual, integrationData, _interiorCellChunks, false);
 
     PYLITH_METHOD_END;
-} // computeLHSResidual
+} // computeLHSResidualInterior
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute LHS residual for F(t,s,\dot{s}) over cells with ghost or constrained points in their closure.
+void
+pylith::feassemble::IntegratorDomain::computeLHSResidualBoundary(pylith::topology::Field* residual,
+                                                                 const pylith::feassemble::IntegrationData& integrationData) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSResidualBoundary(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
+
+    _updateGeometryCache();
+    if (!_haveInteriorBoundaryChunks) { _createInteriorBoundaryChunks(); }
+    _computeLHSResidual(residual, integrationData, _boundaryCellChunks, true);
+
+    PYLITH_METHOD_END;
+} // computeLHSResidualBoundary
 
 
 // ------------------------------------------------------------------------------------------------
@@ -467,20 +741,22 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobian(PetscMat jacobianMat,
                                                          PetscMat precondMat,
                                                          const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSJacobian(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", integrationData="<<integrationData.str()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSJacobian(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", integrationData="<<integrationData.str()<<")");
 
     _needNewLHSJacobian = false;
     if (!_hasLHSJacobian) { PYLITH_METHOD_END;}
+    ProfileScope profile(this, PROFILE_LHS_JACOBIAN);
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
-    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::solution_dot);
+    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);
     assert(solutionDot);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
-    const PylithReal s_tshift = integrationData.getScalar(pylith::feassemble::IntegrationData::s_tshift);
+    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
+    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP);
+    const PylithReal s_tshift = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_S_TSHIFT);
 
     _setKernelConstants(*solution, dt);
+    _updateGeometryCache();
 
     assert(_dsLabel);
     PetscFormKey key;
@@ -493,8 +769,10 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobian(PetscMat jacobianMat,
     assert(solutionDot->getLocalVector());
     assert(jacobianMat);
     assert(precondMat);
-    err = DMPlexComputeJacobian_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), t, s_tshift, solution->getLocalVector(),
-                                         solutionDot->getLocalVector(), jacobianMat, precondMat, NULL);PYLITH_CHECK_ERROR(err);
+    for (size_t iChunk = 0; iChunk < _cellChunks.size(); ++iChunk) {
+        err = DMPlexComputeJacobian_Internal(_dsLabel->dm(), key, _cellChunks[iChunk], t, s_tshift, solution->getLocalVector(),
+                                             solutionDot->getLocalVector(), jacobianMat, precondMat, NULL);PYLITH_CHECK_ERROR(err);
+    } // for
 
     if (_jacobianValues) {
         _jacobianValues->computeLHSJacobian(jacobianMat, precondMat, t, dt, s_tshift, *solution, *_dsLabel);
@@ -516,18 +794,20 @@ void
 pylith::feassemble::IntegratorDomain::computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                                                   const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSJacobianLumpedInv(jacobianInv="<<jacobianInv<<", integrationData="<<integrationData.str()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSJacobianLumpedInv(jacobianInv="<<jacobianInv<<", integrationData="<<integrationData.str()<<")");
 
     _needNewLHSJacobianLumped = false;
     if (!_hasLHSJacobianLumped) { PYLITH_METHOD_END;}
+    ProfileScope profile(this, PROFILE_LHS_JACOBIAN_LUMPED_INV);
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
-    const PylithReal s_tshift = integrationData.getScalar(pylith::feassemble::IntegrationData::s_tshift);
+    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
+    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP);
+    const PylithReal s_tshift = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_S_TSHIFT);
 
     _setKernelConstants(*solution, dt);
+    _updateGeometryCache();
 
     assert(_dsLabel);
     PetscFormKey key;
@@ -542,8 +822,10 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobianLumpedInv(pylith::topolo
 
     assert(jacobianInv);
     assert(jacobianInv->getLocalVector());
-    err = DMPlexComputeJacobian_Action_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), t, s_tshift, vecRowSum, NULL,
-                                                vecRowSum, jacobianInv->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    for (size_t iChunk = 0; iChunk < _cellChunks.size(); ++iChunk) {
+        err = DMPlexComputeJacobian_Action_Internal(_dsLabel->dm(), key, _cellChunks[iChunk], t, s_tshift, vecRowSum, NULL,
+                                                    vecRowSum, jacobianInv->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    } // for
 
     err = DMRestoreLocalVector(_dsLabel->dm(), &vecRowSum);PYLITH_CHECK_ERROR(err);
     // Compute the Jacobian inverse.
@@ -553,6 +835,70 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobianLumpedInv(pylith::topolo
 } // computeLHSJacobianLumpedInv
 
 
+// ------------------------------------------------------------------------------------------------
+// Can the action of the LHS Jacobian be computed without assembling the Jacobian?
+bool
+pylith::feassemble::IntegratorDomain::hasLHSJacobianAction(void) const {
+    // Jacobian values inserted directly into the matrix have no finite-element action.
+    return !_hasLHSJacobian || !_jacobianValues;
+} // hasLHSJacobianAction
+
+
+// ------------------------------------------------------------------------------------------------
+// Is the LHS residual linear in the solution with a Jacobian and load that do not depend on time?
+bool
+pylith::feassemble::IntegratorDomain::hasTimeIndependentLHSResidual(void) const {
+    // A Jacobian that is never reformed and no state variables imply a linear, time-independent residual.
+    return !_hasRHSResidual && !_hasTimeDependentLHSResidual && (NEW_JACOBIAN_NEVER == _lhsJacobianTriggers)
+           && _kernelsUpdateStateVars.empty();
+} // hasTimeIndependentLHSResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector without assembling the Jacobian.
+void
+pylith::feassemble::IntegratorDomain::computeLHSJacobianAction(PetscVec actionVec,
+                                                               PetscVec vectorVec,
+                                                               const pylith::feassemble::IntegrationData& integrationData) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSJacobianAction(actionVec="<<actionVec<<", vectorVec="<<vectorVec<<", integrationData="<<integrationData.str()<<")");
+
+    if (!_hasLHSJacobian) { PYLITH_METHOD_END;}
+    if (_jacobianValues) {
+        PYLITH_JOURNAL_LOGICERROR("Matrix-free action of LHS Jacobian not supported with Jacobian values inserted without finite-element integration.");
+    } // if
+
+    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);
+    assert(solutionDot);
+    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
+    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP);
+    const PylithReal s_tshift = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_S_TSHIFT);
+
+    _setKernelConstants(*solution, dt);
+    _updateGeometryCache();
+
+    assert(_dsLabel);
+    PetscFormKey key;
+    key.label = _dsLabel->label();
+    key.value = _dsLabel->value();
+    key.part = pylith::feassemble::Integrator::LHS;
+
+    PetscErrorCode err;
+    assert(solution->getLocalVector());
+    assert(solutionDot->getLocalVector());
+    assert(actionVec);
+    assert(vectorVec);
+    for (size_t iChunk = 0; iChunk < _cellChunks.size(); ++iChunk) {
+        err = DMPlexComputeJacobian_Action_Internal(_dsLabel->dm(), key, _cellChunks[iChunk], t, s_tshift, solution->getLocalVector(),
+                                                    solutionDot->getLocalVector(), vectorVec, actionVec, NULL);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // computeLHSJacobianAction
+
+
 // ------------------------------------------------------------------------------------------------
 // Update state variables as needed.
 void
@@ -560,7 +906,7 @@ pylith::feassemble::IntegratorDomain::_updateStateVars(const PylithReal t,
                                                        const PylithReal dt,
                                                        const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("_updateStateVars(t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("_updateStateVars(t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<")");
 
     if (0 == _kernelsUpdateStateVars.size()) {
         PYLITH_METHOD_END;
@@ -571,27 +917,20 @@ pylith::feassemble::IntegratorDomain::_updateStateVars(const PylithReal t,
     _updateState->prepare(_auxiliaryField);
     _setKernelConstants(solution, dt);
 
-    // We assume order of the update state variable kernels matches
-    // the order of the correspoinding subfields in the auxiliary
-    // field.
-    const size_t numKernels = _kernelsUpdateStateVars.size();
-    PetscPointFunc* kernelsStateVars = (numKernels > 0) ? new PetscPointFunc[numKernels] : NULL;
-    for (size_t iKernel = 0; iKernel < numKernels; ++iKernel) {
-        kernelsStateVars[iKernel] = _kernelsUpdateStateVars[iKernel].f;
-    } // for
-
     PetscErrorCode err = 0;
     PetscDM stateVarsDM = _updateState->stateVarsDM();
-    PetscDMLabel dmLabel = NULL;
-    PetscInt labelValue = 0;
-    const PetscInt part = 0;
-    err = DMSetAuxiliaryVec(stateVarsDM, dmLabel, labelValue, part, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
-    err = DMProjectFieldLocal(stateVarsDM, t, solution.getLocalVector(), kernelsStateVars, INSERT_VALUES,
+    PetscVec auxiliaryVec = _auxiliaryField->getLocalVector();
+    if (auxiliaryVec != _stateVarsAuxiliaryVec) {
+        PetscDMLabel dmLabel = NULL;
+        PetscInt labelValue = 0;
+        const PetscInt part = 0;
+        err = DMSetAuxiliaryVec(stateVarsDM, dmLabel, labelValue, part, auxiliaryVec);PYLITH_CHECK_ERROR(err);
+        _stateVarsAuxiliaryVec = auxiliaryVec;
+    } // if
+    err = DMProjectFieldLocal(stateVarsDM, t, solution.getLocalVector(), &_kernelsArrayUpdateStateVars[0], INSERT_VALUES,
                               _updateState->stateVarsLocalVector());PYLITH_CHECK_ERROR(err);
     _updateState->restore(_auxiliaryField);
 
-    delete[] kernelsStateVars;kernelsStateVars = NULL;
-
     PYLITH_METHOD_END;
 } // _updateStateVars
 
@@ -603,7 +942,7 @@ pylith::feassemble::IntegratorDomain::_computeDerivedField(const PylithReal t,
                                                            const PylithReal dt,
                                                            const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("_computeDerivedField(t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK("_computeDerivedField(t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<")");
 
     if (!_derivedField) {
         PYLITH_METHOD_END;
@@ -612,32 +951,299 @@ pylith::feassemble::IntegratorDomain::_computeDerivedField(const PylithReal t,
     assert(_derivedField);
     _setKernelConstants(solution, dt);
 
-    const size_t numKernels = _kernelsDerivedField.size();
-    PetscPointFunc* kernelsArray = (numKernels > 0) ? new PetscPointFunc[numKernels] : NULL;
-    for (size_t iKernel = 0; iKernel < numKernels; ++iKernel) {
-        const pylith::topology::Field::SubfieldInfo& sinfo = _derivedField->getSubfieldInfo(_kernelsDerivedField[iKernel].subfield.c_str());
-        kernelsArray[sinfo.index] = _kernelsDerivedField[iKernel].f;
-    } // for
-
     PetscErrorCode err = 0;
 
     PetscDM derivedDM = _derivedField->getDM();
     assert(_auxiliaryField);
-    PetscDMLabel dmLabel = NULL;
-    PetscInt labelValue = 0;
-    const PetscInt part = 0;
-    err = DMSetAuxiliaryVec(derivedDM, dmLabel, labelValue, part, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
-    err = DMProjectFieldLocal(derivedDM, t, solution.getLocalVector(), kernelsArray, INSERT_VALUES, _derivedField->getLocalVector());PYLITH_CHECK_ERROR(err);
-    delete[] kernelsArray;kernelsArray = NULL;
+    PetscVec auxiliaryVec = _auxiliaryField->getLocalVector();
+    if (auxiliaryVec != _derivedFieldAuxiliaryVec) {
+        PetscDMLabel dmLabel = NULL;
+        PetscInt labelValue = 0;
+        const PetscInt part = 0;
+        err = DMSetAuxiliaryVec(derivedDM, dmLabel, labelValue, part, auxiliaryVec);PYLITH_CHECK_ERROR(err);
+        _derivedFieldAuxiliaryVec = auxiliaryVec;
+    } // if
+    err = DMProjectFieldLocal(derivedDM, t, solution.getLocalVector(), &_kernelsArrayDerivedField[0], INSERT_VALUES,
+                              _derivedField->getLocalVector());PYLITH_CHECK_ERROR(err);
 
-    pythia::journal::debug_t debug(GenericComponent::getName());
+#if !defined(PYLITH_DISABLE_CALLBACK_DEBUG)
+    pythia::journal::debug_t& debug = GenericComponent::getDebugJournal();
     if (debug.state()) {
         PYLITH_JOURNAL_DEBUG("Viewing derived field.");
         _derivedField->view("Derived field");
     } // if
+#endif
 
     PYLITH_METHOD_END;
 } // _computeDerivedField
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute RHS residual for G(t,s) over chunks of cells.
+void
+pylith::feassemble::IntegratorDomain::_computeRHSResidual(pylith::topology::Field* residual,
+                                                          const pylith::feassemble::IntegrationData& integrationData,
+                                                          const std::vector<PetscIS>& cellChunks) {
+    PYLITH_METHOD_BEGIN;
+    if (!_hasRHSResidual) { PYLITH_METHOD_END;}
+    assert(residual);
+    ProfileScope profile(this, PROFILE_RHS_RESIDUAL);
+
+    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
+    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP);
+
+    _setKernelConstants(*solution, dt);
+
+    assert(_dsLabel);
+    PetscFormKey key;
+    key.label = _dsLabel->label();
+    key.value = _dsLabel->value();
+    key.part = pylith::feassemble::Integrator::RHS;
+
+    PetscErrorCode err;
+    assert(solution->getLocalVector());
+    assert(residual->getLocalVector());
+    PetscVec solutionDotVec = NULL;
+    for (size_t iChunk = 0; iChunk < cellChunks.size(); ++iChunk) {
+        err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, cellChunks[iChunk], PETSC_MIN_REAL, solution->getLocalVector(),
+                                             solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    } // for
+    if (_hasRHSResidualConstant) {
+        _addResidualConstant(residual, &_rhsResidualConstant, &_rhsResidualConstantState, RHS_CONSTANT, t,
+                             solution->getLocalVector(), solutionDotVec);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _computeRHSResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute LHS residual for F(t,s,\dot{s}) over chunks of cells.
+void
+pylith::feassemble::IntegratorDomain::_computeLHSResidual(pylith::topology::Field* residual,
+                                                          const pylith::feassemble::IntegrationData& integrationData,
+                                                          const std::vector<PetscIS>& cellChunks,
+                                                          const bool addConstant) {
+    PYLITH_METHOD_BEGIN;
+    if (!_hasLHSResidual) { PYLITH_METHOD_END; }
+    // Interior cells are always followed by boundary cells, so count the call only once.
+    ProfileScope profile(this, PROFILE_LHS_RESIDUAL, addConstant);
+
+    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);
+    assert(solutionDot);
+    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
+    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP);
+
+    _setKernelConstants(*solution, dt);
+
+    assert(_dsLabel);
+    PetscFormKey key;
+    key.label = _dsLabel->label();
+    key.value = _dsLabel->value();
+    key.part = pylith::feassemble::Integrator::LHS;
+
+    PetscErrorCode err;
+    assert(solution->getLocalVector());
+    assert(solutionDot->getLocalVector());
+    assert(residual->getLocalVector());
+    for (size_t iChunk = 0; iChunk < cellChunks.size(); ++iChunk) {
+        err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, cellChunks[iChunk], PETSC_MIN_REAL, solution->getLocalVector(),
+                                             solutionDot->getLocalVector(), t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    } // for
+    if (addConstant && _hasLHSResidualConstant) {
+        _addResidualConstant(residual, &_lhsResidualConstant, &_lhsResidualConstantState, LHS_CONSTANT, t,
+                             solution->getLocalVector(), solutionDot->getLocalVector());
+    } // if
+
+    PYLITH_METHOD_END;
+} // _computeLHSResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Split cells into interior cells, without ghost or constrained points in their closure, and boundary cells.
+void
+pylith::feassemble::IntegratorDomain::_createInteriorBoundaryChunks(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" _createInteriorBoundaryChunks()");
+
+    assert(_dsLabel);
+    PetscErrorCode err = 0;
+    PetscDM dm = _dsLabel->dm();assert(dm);
+
+    // Mark ghost points (leaves of point SF) and points with constrained degrees of freedom.
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    std::vector<bool> isBoundaryPoint(pEnd-pStart, false);
+
+    PetscSF sf = NULL;
+    PetscInt numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+    if (sf) {
+        err = PetscSFGetGraph(sf, NULL, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+            const PetscInt point = leaves ? leaves[iLeaf] : iLeaf;
+            isBoundaryPoint[point-pStart] = true;
+        } // for
+    } // if
+
+    PetscSection section = NULL;
+    err = DMGetLocalSection(dm, &section);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt numConstrained = 0;
+        err = PetscSectionGetConstraintDof(section, point, &numConstrained);PYLITH_CHECK_ERROR(err);
+        if (numConstrained > 0) {
+            isBoundaryPoint[point-pStart] = true;
+        } // if
+    } // for
+
+    // Split cells using closure.
+    const PetscInt numCells = _dsLabel->numCells();
+    const PetscInt* cells = NULL;
+    std::vector<PetscInt> interiorCells, boundaryCells;
+    interiorCells.reserve(numCells);
+    err = ISGetIndices(_dsLabel->cellsIS(), &cells);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = cells[iCell];
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        bool isBoundary = false;
+        err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize && !isBoundary; ++iPoint) {
+            isBoundary = isBoundaryPoint[closure[2*iPoint]-pStart];
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        if (isBoundary) {
+            boundaryCells.push_back(cell);
+        } else {
+            interiorCells.push_back(cell);
+        } // if/else
+    } // for
+    err = ISRestoreIndices(_dsLabel->cellsIS(), &cells);PYLITH_CHECK_ERROR(err);
+    PYLITH_JOURNAL_DEBUG("Split "<<numCells<<" cells into "<<interiorCells.size()<<" interior cells and "
+                                 <<boundaryCells.size()<<" boundary cells.");
+
+    PetscIS interiorIS = NULL, boundaryIS = NULL;
+    err = ISCreateGeneral(PETSC_COMM_SELF, interiorCells.size(), interiorCells.size() ? &interiorCells[0] : NULL,
+                          PETSC_COPY_VALUES, &interiorIS);PYLITH_CHECK_ERROR(err);
+    err = ISCreateGeneral(PETSC_COMM_SELF, boundaryCells.size(), boundaryCells.size() ? &boundaryCells[0] : NULL,
+                          PETSC_COPY_VALUES, &boundaryIS);PYLITH_CHECK_ERROR(err);
+    _destroyCellChunks(&_interiorCellChunks);
+    _destroyCellChunks(&_boundaryCellChunks);
+    _createCellChunks(&_interiorCellChunks, interiorIS);
+    _createCellChunks(&_boundaryCellChunks, boundaryIS);
+    err = ISDestroy(&interiorIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&boundaryIS);PYLITH_CHECK_ERROR(err);
+    _haveInteriorBoundaryChunks = true;
+
+    PYLITH_METHOD_END;
+} // _createInteriorBoundaryChunks
+
+
+// ------------------------------------------------------------------------------------------------
+// Discard cell geometry cached on the chunks of cells if the coordinates changed or caching is turned off.
+void
+pylith::feassemble::IntegratorDomain::_updateGeometryCache(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_dsLabel);
+
+    PetscErrorCode err;
+    PetscVec coordinatesVec = NULL;
+    PetscObjectState coordinatesState = 0;
+    err = DMGetCoordinatesLocal(_dsLabel->dm(), &coordinatesVec);PYLITH_CHECK_ERROR(err);assert(coordinatesVec);
+    err = PetscObjectStateGet((PetscObject) coordinatesVec, &coordinatesState);PYLITH_CHECK_ERROR(err);
+    const bool isCurrent = (coordinatesVec == _geometryCoordinates) && (coordinatesState == _geometryCoordinatesState);
+    if (!_geometryCoordinates || (_cacheGeometry && isCurrent)) {
+        // Chunks were just created, so they do not carry any geometry yet, or cached geometry is current.
+        _geometryCoordinates = coordinatesVec;
+        _geometryCoordinatesState = coordinatesState;
+        PYLITH_METHOD_END;
+    } // if
+
+    PYLITH_JOURNAL_DEBUG("Discarding cell geometry cached on chunks of cells.");
+    std::vector<PetscIS>* allChunks[4] = { &_cellChunks, &_interiorCellChunks, &_boundaryCellChunks, &_fastCellChunks };
+    for (size_t iChunks = 0; iChunks < 4; ++iChunks) {
+        std::vector<PetscIS>& chunks = *allChunks[iChunks];
+        for (size_t iChunk = 0; iChunk < chunks.size(); ++iChunk) {
+            PetscIS chunkIS = NULL;
+            err = ISDuplicate(chunks[iChunk], &chunkIS);PYLITH_CHECK_ERROR(err);
+            err = ISDestroy(&chunks[iChunk]);PYLITH_CHECK_ERROR(err);
+            chunks[iChunk] = chunkIS;
+        } // for
+    } // for
+    _geometryCoordinates = coordinatesVec;
+    _geometryCoordinatesState = coordinatesState;
+
+    PYLITH_METHOD_END;
+} // _updateGeometryCache
+
+
+// ------------------------------------------------------------------------------------------------
+// Set array of kernels for computing derived field ordered by subfield index.
+void
+pylith::feassemble::IntegratorDomain::_setKernelsArrayDerivedField(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_derivedField);
+
+    const size_t numKernels = _kernelsDerivedField.size();
+    const size_t numSubfields = _derivedField->getSubfieldNames().size();
+    _kernelsArrayDerivedField.assign(std::max(numKernels, numSubfields), NULL);
+    for (size_t iKernel = 0; iKernel < numKernels; ++iKernel) {
+        const pylith::topology::Field::SubfieldInfo& sinfo = _derivedField->getSubfieldInfo(_kernelsDerivedField[iKernel].subfield.c_str());
+        _kernelsArrayDerivedField[sinfo.index] = _kernelsDerivedField[iKernel].f;
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setKernelsArrayDerivedField
+
+
+// ------------------------------------------------------------------------------------------------
+// Add cached residual terms that are independent of the solution and time.
+void
+pylith::feassemble::IntegratorDomain::_addResidualConstant(pylith::topology::Field* residual,
+                                                           PetscVec* cache,
+                                                           PetscObjectState* cacheState,
+                                                           const EquationPart part,
+                                                           const PylithReal t,
+                                                           PetscVec solutionVec,
+                                                           PetscVec solutionDotVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" _addResidualConstant(residual="<<residual<<", part="<<part<<", t="<<t<<")");
+    assert(residual);
+    assert(cache);
+    assert(cacheState);
+    assert(_auxiliaryField);
+    assert(_dsLabel);
+
+    PetscErrorCode err;
+    PetscObjectState auxiliaryState = 0;
+    err = PetscObjectStateGet((PetscObject) _auxiliaryField->getLocalVector(), &auxiliaryState);PYLITH_CHECK_ERROR(err);
+    if (!*cache || (auxiliaryState != *cacheState)) {
+        PYLITH_JOURNAL_DEBUG("Integrating residual terms independent of solution and time for part "<<part<<".");
+        if (!*cache) {
+            err = VecDuplicate(residual->getLocalVector(), cache);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = VecSet(*cache, 0.0);PYLITH_CHECK_ERROR(err);
+
+        PetscFormKey key;
+        key.label = _dsLabel->label();
+        key.value = _dsLabel->value();
+        key.part = part;
+        for (size_t iChunk = 0; iChunk < _cellChunks.size(); ++iChunk) {
+            err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _cellChunks[iChunk], PETSC_MIN_REAL, solutionVec,
+                                                 solutionDotVec, t, *cache, NULL);PYLITH_CHECK_ERROR(err);
+        } // for
+        *cacheState = auxiliaryState;
+    } // if
+
+    err = VecAXPY(residual->getLocalVector(), 1.0, *cache);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _addResidualConstant
+
+
 // End of file
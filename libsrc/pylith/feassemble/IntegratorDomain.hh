@@ -175,6 +175,12 @@ public:
      */
     void setKernelsDerivedField(const std::vector<ProjectKernels>& kernels);
 
+    /** Set whether the LHS residual kernels depend explicitly on time.
+     *
+     * @param[in] value True if the LHS residual kernels depend on time (for example, body forces in MMS tests).
+     */
+    void setTimeDependentLHSResidual(const bool value);
+
     /** Initialize integration domain, auxiliary field, and derived field. Update observers.
      *
      * @param[in] solution Solution field (layout).
@@ -195,6 +201,24 @@ public:
      */
     void setState(const PylithReal t);
 
+    /** Set subfield of auxiliary field by projecting a kernel for the derived field.
+     *
+     * Used to store the stress and strain of a solution in the reference state of the auxiliary field. The kernel is
+     * evaluated with the current auxiliary field, and the values at points shared among processes match those from
+     * the owning process.
+     *
+     * @param[in] auxiliarySubfieldName Name of subfield in auxiliary field to set.
+     * @param[in] derivedSubfieldName Name of subfield in derived field with kernel used to compute the values.
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] solution Solution field.
+     */
+    void setAuxiliarySubfieldFromDerived(const char* auxiliarySubfieldName,
+                                         const char* derivedSubfieldName,
+                                         const PylithReal t,
+                                         const PylithReal dt,
+                                         const pylith::topology::Field& solution);
+
     /** Compute RHS residual for G(t,s).
      *
      * @param[out] residual Field for residual.
@@ -203,6 +227,35 @@ public:
     void computeRHSResidual(pylith::topology::Field* residual,
                             const pylith::feassemble::IntegrationData& integrationData);
 
+    /** Compute RHS residual for G(t,s) over cells with points in the fast rate group of local time stepping.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    void computeRHSResidualFast(pylith::topology::Field* residual,
+                                const pylith::feassemble::IntegrationData& integrationData);
+
+    /** Compute stable time step for explicit time stepping in each cell.
+     *
+     * The stable time step is the minimum distance between the vertices of the cell divided by the maximum
+     * dilatational wave speed in the cell, computed from the density, shear modulus, and bulk modulus subfields of
+     * the auxiliary field.
+     *
+     * @param[out] cells Cells integrated by this process.
+     * @param[out] dtStable Nondimensional stable time step for each cell (PYLITH_MAXSCALAR if the auxiliary field
+     * does not have the subfields).
+     */
+    void computeStableTimeSteps(std::vector<PetscInt>* cells,
+                                std::vector<PylithReal>* dtStable) const;
+
+    /** Set points in the fast rate group of local time stepping.
+     *
+     * Cells with any of these points in their closure are integrated in computeRHSResidualFast().
+     *
+     * @param[in] isFastPoint True for points in the fast rate group, indexed by point in the chart of the solution DM.
+     */
+    void setFastPoints(const std::vector<bool>& isFastPoint);
+
     /** Compute LHS residual for F(t,s,\dot{s}).
      *
      * @param[out] residual Field for residual.
@@ -211,6 +264,22 @@ public:
     void computeLHSResidual(pylith::topology::Field* residual,
                             const pylith::feassemble::IntegrationData& integrationData);
 
+    /** Compute LHS residual for F(t,s,\dot{s}) over cells without ghost or constrained points in their closure.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    void computeLHSResidualInterior(pylith::topology::Field* residual,
+                                    const pylith::feassemble::IntegrationData& integrationData);
+
+    /** Compute LHS residual for F(t,s,\dot{s}) over cells with ghost or constrained points in their closure.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    void computeLHSResidualBoundary(pylith::topology::Field* residual,
+                                    const pylith::feassemble::IntegrationData& integrationData);
+
     /** Compute LHS Jacobian and preconditioner for F(t,s,\dot{s}) with implicit time-stepping.
      *
      * @param[out] jacobianMat PETSc Mat with Jacobian sparse matrix.
@@ -229,6 +298,30 @@ public:
     void computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                      const pylith::feassemble::IntegrationData& integrationData);
 
+    /** Can the action of the LHS Jacobian be computed without assembling the Jacobian?
+     *
+     * @returns True if computeLHSJacobianAction() is supported, false otherwise.
+     */
+    bool hasLHSJacobianAction(void) const;
+
+    /** Is the LHS residual linear in the solution with a Jacobian and load that do not depend on time?
+     *
+     * @returns True if LHS residual is linear and independent of time, false otherwise.
+     */
+    bool hasTimeIndependentLHSResidual(void) const;
+
+    /** Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector without assembling the Jacobian.
+     *
+     * Contributions are added to the action vector.
+     *
+     * @param[inout] actionVec Local PETSc Vec with action of Jacobian, J*v.
+     * @param[in] vectorVec Local PETSc Vec with vector, v, on which the Jacobian acts.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    void computeLHSJacobianAction(PetscVec actionVec,
+                                  PetscVec vectorVec,
+                                  const pylith::feassemble::IntegrationData& integrationData);
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -252,17 +345,99 @@ protected:
                               const PylithReal dt,
                               const pylith::topology::Field& solution);
 
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Compute RHS residual for G(t,s) over chunks of cells.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     * @param[in] cellChunks Chunks of cells to integrate over.
+     */
+    void _computeRHSResidual(pylith::topology::Field* residual,
+                             const pylith::feassemble::IntegrationData& integrationData,
+                             const std::vector<PetscIS>& cellChunks);
+
+    /** Compute LHS residual for F(t,s,\dot{s}) over chunks of cells.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     * @param[in] cellChunks Chunks of cells to integrate over.
+     * @param[in] addConstant True if adding cached residual terms independent of the solution and time.
+     */
+    void _computeLHSResidual(pylith::topology::Field* residual,
+                             const pylith::feassemble::IntegrationData& integrationData,
+                             const std::vector<PetscIS>& cellChunks,
+                             const bool addConstant);
+
+    /** Split cells into interior cells, without ghost or constrained points in their closure, and boundary cells.
+     *
+     * Residual of interior cells can be computed before the ghost values and constrained values of the solution are
+     * available.
+     */
+    void _createInteriorBoundaryChunks(void);
+
+    /** Discard cell geometry cached on the chunks of cells if the coordinates changed or caching is turned off.
+     *
+     * PETSc attaches the cell geometry to the index set of each chunk, so replacing the chunks with copies forces
+     * PETSc to recompute the geometry in the next assembly call.
+     */
+    void _updateGeometryCache(void);
+
+    /// Set array of kernels for computing derived field ordered by subfield index.
+    void _setKernelsArrayDerivedField(void);
+
+    /** Add cached residual terms that are independent of the solution and time.
+     *
+     * The cached terms are integrated the first time they are needed and again only after the auxiliary field changes.
+     *
+     * @param[inout] residual Field for residual.
+     * @param[inout] cache Local PETSc Vec with cached residual terms.
+     * @param[inout] cacheState State of auxiliary field when cached residual terms were integrated.
+     * @param[in] part Residual part with terms independent of the solution and time (LHS_CONSTANT or RHS_CONSTANT).
+     * @param[in] t Current time.
+     * @param[in] solutionVec Local PETSc Vec with solution.
+     * @param[in] solutionDotVec Local PETSc Vec with time derivative of solution.
+     */
+    void _addResidualConstant(pylith::topology::Field* residual,
+                              PetscVec* cache,
+                              PetscObjectState* cacheState,
+                              const EquationPart part,
+                              const PylithReal t,
+                              PetscVec solutionVec,
+                              PetscVec solutionDotVec);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
     std::vector<ProjectKernels> _kernelsUpdateStateVars; ///< kernels for updating state variables.
     std::vector<ProjectKernels> _kernelsDerivedField; ///< kernels for computing derived field.
+    std::vector<PetscPointFunc> _kernelsArrayUpdateStateVars; ///< Array of kernels for updating state variables.
+    std::vector<PetscPointFunc> _kernelsArrayDerivedField; ///< Array of kernels for derived field by subfield index.
+    PetscVec _stateVarsAuxiliaryVec; ///< Auxiliary vector attached to DM for state variables (not owned).
+    PetscVec _derivedFieldAuxiliaryVec; ///< Auxiliary vector attached to DM for derived field (not owned).
 
     pylith::topology::Mesh* _materialMesh; ///< Mesh associated with material.
 
     pylith::feassemble::UpdateStateVars* _updateState; ///< Data structure for layout needed to update state vars.
     pylith::feassemble::JacobianValues* _jacobianValues; ///< Jacobian values without finite-element integration.
     pylith::feassemble::DSLabelAccess* _dsLabel; ///< Information about integration (PETSc DS, Label, label value, etc).
+    std::vector<PetscIS> _cellChunks; ///< Chunks of cells for assembly.
+    std::vector<PetscIS> _interiorCellChunks; ///< Chunks of cells without ghost or constrained points in closure.
+    std::vector<PetscIS> _boundaryCellChunks; ///< Chunks of cells with ghost or constrained points in closure.
+    bool _haveInteriorBoundaryChunks; ///< True if cells have been split into interior and boundary cells.
+    std::vector<PetscIS> _fastCellChunks; ///< Chunks of cells with points in fast rate group of local time stepping.
+    bool _haveFastCellChunks; ///< True if cells with points in fast rate group have been set.
+    PetscVec _geometryCoordinates; ///< Local coordinates vector for cell geometry cached on chunks (not owned).
+    PetscObjectState _geometryCoordinatesState; ///< State of coordinates for cell geometry cached on chunks.
+
+    bool _hasTimeDependentLHSResidual; ///< LHS residual kernels depend explicitly on time.
+    bool _hasLHSResidualConstant; ///< Has LHS residual terms independent of solution and time.
+    bool _hasRHSResidualConstant; ///< Has RHS residual terms independent of solution and time.
+    PetscVec _lhsResidualConstant; ///< Cached LHS residual terms independent of solution and time.
+    PetscVec _rhsResidualConstant; ///< Cached RHS residual terms independent of solution and time.
+    PetscObjectState _lhsResidualConstantState; ///< Auxiliary field state for cached LHS residual terms.
+    PetscObjectState _rhsResidualConstantState; ///< Auxiliary field state for cached RHS residual terms.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -36,6 +36,7 @@
 
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
+#include <algorithm> // USES std::sort(), std::unique()
 #include <cassert> // USES assert()
 #include <typeinfo> // USES typeid()
 #include <stdexcept> // USES std::runtime_error
@@ -77,12 +78,14 @@ public:
              * @param[in] integrator Integrator for boundary.
              * @param[in] equationPart Equation part to compute.
              * @param[in] integrationData Data needed to integrate governing equations.
+             * @param[in] patchCells Cohesive cells to integrate for each patch (NULL for all cells).
              */
             static
             void computeResidual(pylith::topology::Field* residual,
                                  const pylith::feassemble::IntegratorInterface* integrator,
                                  pylith::feassemble::Integrator::EquationPart equationPart,
-                                 const pylith::feassemble::IntegrationData& integrationData);
+                                 const pylith::feassemble::IntegrationData& integrationData,
+                                 const std::vector<PetscIS>* patchCells=NULL);
 
             /** Compute Jacobian using current kernels.
              *
@@ -168,7 +171,10 @@ pylith::feassemble::IntegratorInterface::IntegratorInterface(pylith::problems::P
     _weightingDM(NULL),
     _weightingVec(NULL),
     _hasLHSResidualWeighted(false),
-    _hasLHSJacobianWeighted(false) {
+    _hasLHSJacobianWeighted(false),
+    _hasMaterialKernelsJacobian(false),
+    _useLHSJacobianCache(false),
+    _hasLHSJacobianCache(false) {
     GenericComponent::setName(_IntegratorInterface::genericComponent);
     _labelValue = 100;
     _labelName = pylith::topology::Mesh::cells_label_name;
@@ -192,9 +198,15 @@ pylith::feassemble::IntegratorInterface::deallocate(void) {
 
     delete _interfaceMesh;_interfaceMesh = NULL;
     delete _integrationPatches;_integrationPatches = NULL;
+    _destroyPatchAssembly();
     DMDestroy(&_weightingDM);
     VecDestroy(&_weightingVec);
 
+    _lhsJacobianCache.rows.clear();
+    _lhsJacobianCache.cols.clear();
+    _lhsJacobianCache.values.clear();
+    _hasLHSJacobianCache = false;
+
     PYLITH_METHOD_END;
 } // deallocate
 
@@ -357,6 +369,9 @@ pylith::feassemble::IntegratorInterface::setKernels(const std::vector<JacobianKe
                                                  iter->second.negative, solution, materials);
         _IntegratorInterface::addMaterialKernels(&patchKernels, pylith::feassemble::IntegratorInterface::POSITIVE_FACE,
                                                  iter->second.positive, solution, materials);
+        if (patchKernels.size() > kernels.size()) {
+            _hasMaterialKernelsJacobian = true;
+        } // if
 
         PetscInt numFields = 0;
         err = PetscWeakFormGetNumFields(weakForm, &numFields);PYLITH_CHECK_ERROR(err);
@@ -414,6 +429,16 @@ pylith::feassemble::IntegratorInterface::setKernels(const std::vector<JacobianKe
 } // setKernels
 
 
+// ------------------------------------------------------------------------------------------------
+// Use cache of LHS Jacobian.
+void
+pylith::feassemble::IntegratorInterface::useLHSJacobianCache(const bool value) {
+    PYLITH_JOURNAL_DEBUG("useLHSJacobianCache(value="<<value<<")");
+
+    _useLHSJacobianCache = value;
+} // useLHSJacobianCache
+
+
 // ------------------------------------------------------------------------------------------------
 // Compute weak form key part for face.
 PetscInt
@@ -465,6 +490,8 @@ pylith::feassemble::IntegratorInterface::initialize(const pylith::topology::Fiel
         } // for
     } // for
 
+    _createPatchAssembly(solution);
+
     PYLITH_METHOD_END;
 } // initialize
 
@@ -474,14 +501,15 @@ pylith::feassemble::IntegratorInterface::initialize(const pylith::topology::Fiel
 void
 pylith::feassemble::IntegratorInterface::setState(const double t) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setState(t="<<t<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" setState(t="<<t<<")");
 
     Integrator::setState(t);
 
     assert(_physics);
     _physics->updateAuxiliaryField(_auxiliaryField, t);
 
-    pythia::journal::debug_t debug(GenericComponent::getName());
+#if !defined(PYLITH_DISABLE_CALLBACK_DEBUG)
+    pythia::journal::debug_t& debug = GenericComponent::getDebugJournal();
     if (debug.state()) {
         assert(_auxiliaryField);
         PYLITH_JOURNAL_DEBUG("IntegratorInterface component '" << GenericComponent::getName() << "' for '"
@@ -489,6 +517,7 @@ pylith::feassemble::IntegratorInterface::setState(const double t) {
                                                                << "': viewing auxiliary field.");
         _auxiliaryField->view("IntegratorInterface auxiliary field", pylith::topology::Field::VIEW_ALL);
     } // if
+#endif
 
     PYLITH_METHOD_END;
 } // setState
@@ -500,8 +529,9 @@ void
 pylith::feassemble::IntegratorInterface::computeRHSResidual(pylith::topology::Field* residual,
                                                             const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasRHSResidual) { PYLITH_METHOD_END;}
+    ProfileScope profile(this, PROFILE_RHS_RESIDUAL);
 
     _IntegratorInterface::computeResidual(residual, this, pylith::feassemble::Integrator::RHS, integrationData);
 
@@ -515,8 +545,9 @@ void
 pylith::feassemble::IntegratorInterface::computeLHSResidual(pylith::topology::Field* residual,
                                                             const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasLHSResidual) { PYLITH_METHOD_END;}
+    ProfileScope profile(this, PROFILE_LHS_RESIDUAL);
 
     if (_hasLHSResidual) {
         const pylith::feassemble::Integrator::EquationPart equationPart = pylith::feassemble::Integrator::LHS;
@@ -527,9 +558,9 @@ pylith::feassemble::IntegratorInterface::computeLHSResidual(pylith::topology::Fi
         { // KLUDGE
             PetscErrorCode err = 0;
             const pylith::topology::Field* daeWeighting =
-                integrationData.getField(pylith::feassemble::IntegrationData::dae_mass_weighting);
+                integrationData.getField(pylith::feassemble::IntegrationData::FIELD_DAE_MASS_WEIGHTING);
             const pylith::topology::Field* solution =
-                integrationData.getField(pylith::feassemble::IntegrationData::solution);
+                integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
             PetscDM dmSoln = solution->getDM();
             typedef InterfacePatches::keysmap_t keysmap_t;
             const keysmap_t& keysmap = _integrationPatches->getKeys();
@@ -556,6 +587,80 @@ pylith::feassemble::IntegratorInterface::computeLHSResidual(pylith::topology::Fi
 } // computeLHSResidual
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute LHS residual over the cohesive cells in the support of points on the interface.
+void
+pylith::feassemble::IntegratorInterface::computeLHSResidualLocalized(pylith::topology::Field* residual,
+                                                                     const pylith::feassemble::IntegrationData& integrationData,
+                                                                     const PetscInt* points,
+                                                                     const size_t numPoints) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSResidualLocalized(residual="<<residual<<", integrationData="<<integrationData.str()<<", points="<<points<<", numPoints="<<numPoints<<")");
+    if (!_hasLHSResidual) { PYLITH_METHOD_END;}
+    ProfileScope profile(this, PROFILE_LHS_RESIDUAL);
+
+    assert(_interfaceMesh);
+    assert(!numPoints || points);
+    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    // Map points in interface mesh to cohesive cells in solution mesh using star of parent point.
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution->getDM();
+    PetscIS subpointIS = NULL;
+    const PetscInt* subpoints = NULL;
+    err = DMPlexGetSubpointIS(_interfaceMesh->getDM(), &subpointIS);PYLITH_CHECK_ERROR(err);
+    if (subpointIS) {
+        err = ISGetIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+    } // if
+    std::vector<PetscInt> cells;
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        const PetscInt parent = subpoints ? subpoints[points[iPoint]] : points[iPoint];
+        PetscInt starSize = 0;
+        PetscInt* star = NULL;
+        err = DMPlexGetTransitiveClosure(dmSoln, parent, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iStar = 0; iStar < starSize*2; iStar += 2) {
+            if (pylith::topology::MeshOps::isCohesiveCell(dmSoln, star[iStar])) {
+                cells.push_back(star[iStar]);
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmSoln, parent, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+    } // for
+    if (subpointIS) {
+        err = ISRestoreIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+    } // if
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+    // Split cells by integration patch.
+    assert(_integrationPatches);
+    PetscDMLabel patchLabel = NULL;
+    err = DMGetLabel(dmSoln, _integrationPatches->getLabelName(), &patchLabel);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscIS> patchCells(_patchAssembly.size(), NULL);
+    for (size_t iPatch = 0; iPatch < _patchAssembly.size(); ++iPatch) {
+        std::vector<PetscInt> cellsPatch;
+        for (size_t iCell = 0; iCell < cells.size(); ++iCell) {
+            PetscInt value = 0;
+            err = DMLabelGetValue(patchLabel, cells[iCell], &value);PYLITH_CHECK_ERROR(err);
+            if (value == _patchAssembly[iPatch].keys[2].value) {
+                cellsPatch.push_back(cells[iCell]);
+            } // if
+        } // for
+        err = ISCreateGeneral(PETSC_COMM_SELF, cellsPatch.size(), cellsPatch.empty() ? NULL : &cellsPatch[0],
+                              PETSC_COPY_VALUES, &patchCells[iPatch]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    const pylith::feassemble::Integrator::EquationPart equationPart = pylith::feassemble::Integrator::LHS;
+    _IntegratorInterface::computeResidual(residual, this, equationPart, integrationData, &patchCells);
+
+    for (size_t iPatch = 0; iPatch < patchCells.size(); ++iPatch) {
+        err = ISDestroy(&patchCells[iPatch]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // computeLHSResidualLocalized
+
+
 // ------------------------------------------------------------------------------------------------
 // Compute LHS Jacobian for F(t,s,\dot{s}).
 void
@@ -563,13 +668,25 @@ pylith::feassemble::IntegratorInterface::computeLHSJacobian(PetscMat jacobianMat
                                                             PetscMat precondMat,
                                                             const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSJacobian(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", integrationData="<<integrationData.str()<<")");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSJacobian(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", integrationData="<<integrationData.str()<<")");
 
     _needNewLHSJacobian = false;
+    if (!_hasLHSJacobian && !_hasLHSJacobianWeighted) { PYLITH_METHOD_END;}
+    ProfileScope profile(this, PROFILE_LHS_JACOBIAN);
 
     if (_hasLHSJacobian) {
-        pylith::feassemble::Integrator::EquationPart equationPart = pylith::feassemble::Integrator::LHS;
-        _IntegratorInterface::computeJacobian(jacobianMat, precondMat, this, equationPart, integrationData);
+        // The cache holds rows of the assembled matrix, so it cannot be used with unassembled subdomain matrices.
+        PetscBool isMatIS = PETSC_FALSE;
+        PetscErrorCode err = PetscObjectTypeCompare((PetscObject)jacobianMat, MATIS, &isMatIS);PYLITH_CHECK_ERROR(err);
+        if (_useLHSJacobianCache && !_hasMaterialKernelsJacobian && (jacobianMat == precondMat) && !isMatIS) {
+            if (!_hasLHSJacobianCache) {
+                _createLHSJacobianCache(jacobianMat, integrationData);
+            } // if
+            _addLHSJacobianCache(jacobianMat);
+        } else {
+            pylith::feassemble::Integrator::EquationPart equationPart = pylith::feassemble::Integrator::LHS;
+            _IntegratorInterface::computeJacobian(jacobianMat, precondMat, this, equationPart, integrationData);
+        } // if/else
     } // if
 
     if (_hasLHSJacobianWeighted) {
@@ -587,7 +704,7 @@ void
 pylith::feassemble::IntegratorInterface::computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                                                      const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSJacobianLumpedInv(jacobianInv="<<jacobianInv<<", integrationData="<<integrationData.str()<<") empty method");
+    PYLITH_JOURNAL_DEBUG_CALLBACK(_labelName<<"="<<_labelValue<<" computeLHSJacobianLumpedInv(jacobianInv="<<jacobianInv<<", integrationData="<<integrationData.str()<<") empty method");
 
     _needNewLHSJacobianLumped = false;
     // No implementation needed for interface.
@@ -596,15 +713,135 @@ pylith::feassemble::IntegratorInterface::computeLHSJacobianLumpedInv(pylith::top
 } // computeLHSJacobianLumpedInv
 
 
+// ------------------------------------------------------------------------------------------------
+// Create weak form keys and chunks of cohesive cells for each integration patch.
+void
+pylith::feassemble::IntegratorInterface::_createPatchAssembly(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    typedef InterfacePatches::keysmap_t keysmap_t;
+    assert(_integrationPatches);
+
+    _destroyPatchAssembly();
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution.getDM();
+    const keysmap_t& keysmap = _integrationPatches->getKeys();
+    _patchAssembly.resize(keysmap.size());
+    size_t iPatch = 0;
+    for (keysmap_t::const_iterator iter = keysmap.begin(); iter != keysmap.end(); ++iter, ++iPatch) {
+        PatchAssembly& patch = _patchAssembly[iPatch];
+        patch.patchValue = iter->second.cohesive.getValue();
+
+        // Part of key depends on equation part and is set during integration.
+        const PetscInt equationPart = 0;
+        patch.keys[0] = iter->second.negative.getPetscKey(solution, equationPart);
+        patch.keys[1] = iter->second.positive.getPetscKey(solution, equationPart);
+        patch.keys[2] = iter->second.cohesive.getPetscKey(solution, equationPart);
+
+        PetscIS patchCellsIS = NULL;
+        PetscInt numPatchCells = 0;
+        const PetscInt* patchCells = NULL;
+        err = DMGetStratumIS(dmSoln, _integrationPatches->getLabelName(), patch.keys[2].value, &patchCellsIS);PYLITH_CHECK_ERROR(err);
+        err = ISGetSize(patchCellsIS, &numPatchCells);PYLITH_CHECK_ERROR(err);assert(numPatchCells > 0);
+        err = ISGetIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);assert(patchCells);
+        assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, patchCells[0]));
+        err = ISRestoreIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);
+
+        _createCellChunks(&patch.cellChunks, patchCellsIS);
+        err = ISDestroy(&patchCellsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _createPatchAssembly
+
+
+// ------------------------------------------------------------------------------------------------
+// Destroy weak form keys and chunks of cohesive cells for integration patches.
+void
+pylith::feassemble::IntegratorInterface::_destroyPatchAssembly(void) {
+    PYLITH_METHOD_BEGIN;
+
+    for (size_t iPatch = 0; iPatch < _patchAssembly.size(); ++iPatch) {
+        _destroyCellChunks(&_patchAssembly[iPatch].cellChunks);
+    } // for
+    _patchAssembly.clear();
+
+    PYLITH_METHOD_END;
+} // _destroyPatchAssembly
+
+
+// ------------------------------------------------------------------------------------------------
+// Integrate LHS Jacobian into a work matrix and store the nonzero entries in the cache.
+void
+pylith::feassemble::IntegratorInterface::_createLHSJacobianCache(PetscMat jacobianMat,
+                                                                 const pylith::feassemble::IntegrationData& integrationData) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("_createLHSJacobianCache(jacobianMat="<<jacobianMat<<", integrationData="<<integrationData.str()<<")");
+
+    PetscErrorCode err = 0;
+    PetscMat workMat = NULL;
+    err = MatDuplicate(jacobianMat, MAT_DO_NOT_COPY_VALUES, &workMat);PYLITH_CHECK_ERROR(err);
+    err = MatZeroEntries(workMat);PYLITH_CHECK_ERROR(err);
+    _IntegratorInterface::computeJacobian(workMat, workMat, this, pylith::feassemble::Integrator::LHS, integrationData);
+    err = MatAssemblyBegin(workMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(workMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    _lhsJacobianCache.rows.clear();
+    _lhsJacobianCache.cols.clear();
+    _lhsJacobianCache.values.clear();
+    PetscInt rowStart = 0;
+    PetscInt rowEnd = 0;
+    err = MatGetOwnershipRange(workMat, &rowStart, &rowEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt row = rowStart; row < rowEnd; ++row) {
+        PetscInt numCols = 0;
+        const PetscInt* cols = NULL;
+        const PetscScalar* values = NULL;
+        err = MatGetRow(workMat, row, &numCols, &cols, &values);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iCol = 0; iCol < numCols; ++iCol) {
+            if (values[iCol] != 0.0) {
+                _lhsJacobianCache.rows.push_back(row);
+                _lhsJacobianCache.cols.push_back(cols[iCol]);
+                _lhsJacobianCache.values.push_back(values[iCol]);
+            } // if
+        } // for
+        err = MatRestoreRow(workMat, row, &numCols, &cols, &values);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = MatDestroy(&workMat);PYLITH_CHECK_ERROR(err);
+    _hasLHSJacobianCache = true;
+
+    PYLITH_METHOD_END;
+} // _createLHSJacobianCache
+
+
+// ------------------------------------------------------------------------------------------------
+// Add entries in cache of LHS Jacobian to the Jacobian.
+void
+pylith::feassemble::IntegratorInterface::_addLHSJacobianCache(PetscMat jacobianMat) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("_addLHSJacobianCache(jacobianMat="<<jacobianMat<<")");
+
+    PetscErrorCode err = 0;
+    const size_t numEntries = _lhsJacobianCache.rows.size();
+    for (size_t iStart = 0, iEnd = 0; iStart < numEntries; iStart = iEnd) {
+        const PetscInt row = _lhsJacobianCache.rows[iStart];
+        for (iEnd = iStart+1; iEnd < numEntries && _lhsJacobianCache.rows[iEnd] == row; ++iEnd) {}
+        err = MatSetValues(jacobianMat, 1, &row, iEnd-iStart, &_lhsJacobianCache.cols[iStart],
+                           &_lhsJacobianCache.values[iStart], ADD_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _addLHSJacobianCache
+
+
 // ------------------------------------------------------------------------------------------------
 // Compute residual.
 void
 pylith::feassemble::_IntegratorInterface::computeResidual(pylith::topology::Field* residual,
                                                           const pylith::feassemble::IntegratorInterface* integrator,
                                                           pylith::feassemble::Integrator::EquationPart equationPart,
-                                                          const pylith::feassemble::IntegrationData& integrationData) {
+                                                          const pylith::feassemble::IntegrationData& integrationData,
+                                                          const std::vector<PetscIS>* patchCells) {
     PYLITH_METHOD_BEGIN;
-    typedef InterfacePatches::keysmap_t keysmap_t;
 
     pythia::journal::debug_t debug(_IntegratorInterface::genericComponent);
     debug << pythia::journal::at(__HERE__)
@@ -615,14 +852,14 @@ pylith::feassemble::_IntegratorInterface::computeResidual(pylith::topology::Fiel
     assert(integrator);
     assert(residual);
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
+    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
+    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP);
     PetscVec solutionDotVec = NULL;
     if ((equationPart == pylith::feassemble::Integrator::LHS) ||
         (equationPart == pylith::feassemble::Integrator::LHS_WEIGHTED) ) {
-        const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::solution_dot);
+        const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);
         assert(solutionDot);
         solutionDotVec = solutionDot->getLocalVector();
     } // if
@@ -632,35 +869,33 @@ pylith::feassemble::_IntegratorInterface::computeResidual(pylith::topology::Fiel
     // Loop over integration patches.
     PetscErrorCode err = 0;
     PetscDM dmSoln = solution->getDM();
-    const InterfacePatches* patches = integrator->_integrationPatches;assert(patches);
-    const keysmap_t& keysmap = patches->getKeys();
-    for (keysmap_t::const_iterator iter = keysmap.begin(); iter != keysmap.end(); ++iter) {
-        const PetscInt patchValue = iter->second.cohesive.getValue();
-
-        PetscFormKey weakFormKeys[3];
-        weakFormKeys[0] = iter->second.negative.getPetscKey(*solution, equationPart);
-        weakFormKeys[0].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::NEGATIVE_FACE, patchValue);
-
-        weakFormKeys[1] = iter->second.positive.getPetscKey(*solution, equationPart);
-        weakFormKeys[1].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::POSITIVE_FACE, patchValue);
-
-        weakFormKeys[2] = iter->second.cohesive.getPetscKey(*solution, equationPart);
-        weakFormKeys[2].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::FAULT_FACE, patchValue);
-
-        PetscIS patchCellsIS = NULL;
-        PetscInt numPatchCells = 0;
-        const PetscInt* patchCells = NULL;
-        err = DMGetStratumIS(dmSoln, patches->getLabelName(), weakFormKeys[2].value, &patchCellsIS);PYLITH_CHECK_ERROR(err);
-        err = ISGetSize(patchCellsIS, &numPatchCells);PYLITH_CHECK_ERROR(err);assert(numPatchCells > 0);
-        err = ISGetIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);assert(patchCells);
-        assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, patchCells[0]));
-
-        assert(solution->getLocalVector());
-        assert(residual->getLocalVector());
-        err = DMPlexComputeResidual_Hybrid_Internal(dmSoln, weakFormKeys, patchCellsIS, t, solution->getLocalVector(),
-                                                    solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
-        err = ISRestoreIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);
-        err = ISDestroy(&patchCellsIS);PYLITH_CHECK_ERROR(err);
+    assert(solution->getLocalVector());
+    assert(residual->getLocalVector());
+    const std::vector<IntegratorInterface::PatchAssembly>& patches = integrator->_patchAssembly;
+    for (size_t iPatch = 0; iPatch < patches.size(); ++iPatch) {
+        const IntegratorInterface::PatchAssembly& patch = patches[iPatch];
+        PetscFormKey weakFormKeys[3] = { patch.keys[0], patch.keys[1], patch.keys[2] };
+        weakFormKeys[0].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::NEGATIVE_FACE, patch.patchValue);
+        weakFormKeys[1].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::POSITIVE_FACE, patch.patchValue);
+        weakFormKeys[2].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::FAULT_FACE, patch.patchValue);
+
+        // The hybrid residual gathers the closure of each cohesive cell once and evaluates the kernels for the
+        // negative, positive, and fault faces from it, so we must pass all three keys in a single call rather than
+        // integrating the faces separately.
+        if (patchCells) {
+            assert(patchCells->size() == patches.size());
+            PetscInt numCells = 0;
+            err = ISGetLocalSize((*patchCells)[iPatch], &numCells);PYLITH_CHECK_ERROR(err);
+            if (numCells > 0) {
+                err = DMPlexComputeResidual_Hybrid_Internal(dmSoln, weakFormKeys, (*patchCells)[iPatch], t, solution->getLocalVector(),
+                                                            solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+            } // if
+            continue;
+        } // if
+        for (size_t iChunk = 0; iChunk < patch.cellChunks.size(); ++iChunk) {
+            err = DMPlexComputeResidual_Hybrid_Internal(dmSoln, weakFormKeys, patch.cellChunks[iChunk], t, solution->getLocalVector(),
+                                                        solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+        } // for
     } // for
 
     PYLITH_METHOD_END;
@@ -676,7 +911,6 @@ pylith::feassemble::_IntegratorInterface::computeJacobian(PetscMat jacobianMat,
                                                           pylith::feassemble::Integrator::EquationPart equationPart,
                                                           const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
-    typedef InterfacePatches::keysmap_t keysmap_t;
 
     pythia::journal::debug_t debug(_IntegratorInterface::genericComponent);
     debug << pythia::journal::at(__HERE__)
@@ -688,48 +922,33 @@ pylith::feassemble::_IntegratorInterface::computeJacobian(PetscMat jacobianMat,
     assert(precondMat);
     assert(integrator);
 
-    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
-    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::solution_dot);
+    const pylith::topology::Field* solutionDot = integrationData.getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);
     assert(solutionDot);
-    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::time);
-    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::time_step);
-    const PylithReal s_tshift = integrationData.getScalar(pylith::feassemble::IntegrationData::s_tshift);
+    const PylithReal t = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME);
+    const PylithReal dt = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP);
+    const PylithReal s_tshift = integrationData.getScalar(pylith::feassemble::IntegrationData::SCALAR_S_TSHIFT);
 
     integrator->_setKernelConstants(*solution, dt);
 
     PetscErrorCode err;
     PetscDM dmSoln = solution->getDM();
-    const InterfacePatches* patches = integrator->_integrationPatches;assert(patches);
-    const keysmap_t& keysmap = patches->getKeys();
-    for (keysmap_t::const_iterator iter = keysmap.begin(); iter != keysmap.end(); ++iter) {
-        const PetscInt patchValue = iter->second.cohesive.getValue();
-
-        PetscFormKey weakFormKeys[3];
-        weakFormKeys[0] = iter->second.negative.getPetscKey(*solution, equationPart);
-        weakFormKeys[0].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::NEGATIVE_FACE, patchValue);
-
-        weakFormKeys[1] = iter->second.positive.getPetscKey(*solution, equationPart);
-        weakFormKeys[1].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::POSITIVE_FACE, patchValue);
-
-        weakFormKeys[2] = iter->second.cohesive.getPetscKey(*solution, equationPart);
-        weakFormKeys[2].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::FAULT_FACE, patchValue);
-
-        PetscIS patchCellsIS = NULL;
-        PetscInt numPatchCells = 0;
-        const PetscInt* patchCells = NULL;
-        err = DMGetStratumIS(dmSoln, patches->getLabelName(), weakFormKeys[2].value, &patchCellsIS);PYLITH_CHECK_ERROR(err);
-        err = ISGetSize(patchCellsIS, &numPatchCells);PYLITH_CHECK_ERROR(err);assert(numPatchCells > 0);
-        err = ISGetIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);assert(patchCells);
-        assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, patchCells[0]));
-
-        assert(solution->getLocalVector());
-        err = DMPlexComputeJacobian_Hybrid_Internal(dmSoln, weakFormKeys, patchCellsIS, t, s_tshift, solution->getLocalVector(),
-                                                    solutionDot->getLocalVector(), jacobianMat, precondMat,
-                                                    NULL);PYLITH_CHECK_ERROR(err);
-        err = ISRestoreIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);
-        err = ISDestroy(&patchCellsIS);PYLITH_CHECK_ERROR(err);
-    }
+    assert(solution->getLocalVector());
+    const std::vector<IntegratorInterface::PatchAssembly>& patches = integrator->_patchAssembly;
+    for (size_t iPatch = 0; iPatch < patches.size(); ++iPatch) {
+        const IntegratorInterface::PatchAssembly& patch = patches[iPatch];
+        PetscFormKey weakFormKeys[3] = { patch.keys[0], patch.keys[1], patch.keys[2] };
+        weakFormKeys[0].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::NEGATIVE_FACE, patch.patchValue);
+        weakFormKeys[1].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::POSITIVE_FACE, patch.patchValue);
+        weakFormKeys[2].part = integrator->getWeakFormPart(equationPart, IntegratorInterface::FAULT_FACE, patch.patchValue);
+
+        for (size_t iChunk = 0; iChunk < patch.cellChunks.size(); ++iChunk) {
+            err = DMPlexComputeJacobian_Hybrid_Internal(dmSoln, weakFormKeys, patch.cellChunks[iChunk], t, s_tshift,
+                                                        solution->getLocalVector(), solutionDot->getLocalVector(),
+                                                        jacobianMat, precondMat, NULL);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
     PYLITH_METHOD_END;
 } // computeJacobian
 
@@ -182,6 +182,17 @@ public:
                     const pylith::topology::Field& solution,
                     const std::vector<pylith::materials::Material*>& materials);
 
+    /** Use cache of LHS Jacobian.
+     *
+     * The LHS Jacobian over the cohesive cells is integrated once and stored as arrays of (row, column, value)
+     * entries that are added directly to the Jacobian whenever it is rebuilt. This is only valid when the LHS
+     * Jacobian depends only on the geometry. The cache is ignored if the bounding materials contribute Jacobian
+     * kernels or the Jacobian and preconditioner matrices differ.
+     *
+     * @param[in] value True if using cache of LHS Jacobian, false otherwise.
+     */
+    void useLHSJacobianCache(const bool value);
+
     /** Compute weak form key part for face.
      *
      * For integration with hybrid cells, we must distinguish among integration of the
@@ -223,6 +234,21 @@ public:
     void computeLHSResidual(pylith::topology::Field* residual,
                             const pylith::feassemble::IntegrationData& integrationData);
 
+    /** Compute LHS residual for F(t,s,\dot{s}) over the cohesive cells in the support of points on the interface.
+     *
+     * Only cohesive cells with one of the points in their closure are integrated, so the residual is correct only
+     * when the contributions from all other cohesive cells are known to be zero.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     * @param[in] points Points in interface mesh.
+     * @param[in] numPoints Number of points.
+     */
+    void computeLHSResidualLocalized(pylith::topology::Field* residual,
+                                     const pylith::feassemble::IntegrationData& integrationData,
+                                     const PetscInt* points,
+                                     const size_t numPoints);
+
     /** Compute LHS Jacobian and preconditioner for F(t,s,\dot{s}) with implicit time-stepping.
      *
      * @param[out] jacobianMat PETSc Mat with Jacobian sparse matrix.
@@ -241,6 +267,49 @@ public:
     void computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                      const pylith::feassemble::IntegrationData& integrationData);
 
+    // PRIVATE STRUCTS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Data for integrating over a patch of cohesive cells that does not change after initialization.
+    struct PatchAssembly {
+        PetscInt patchValue; ///< Value of patch label.
+        PetscFormKey keys[3]; ///< Weak form keys (except for part) for negative, positive, and fault faces.
+        std::vector<PetscIS> cellChunks; ///< Chunks of cohesive cells in patch.
+    }; // PatchAssembly
+
+    /// Entries of LHS Jacobian in locally owned rows, ordered by row.
+    struct JacobianCache {
+        std::vector<PetscInt> rows; ///< Global row of entries.
+        std::vector<PetscInt> cols; ///< Global column of entries.
+        std::vector<PetscScalar> values; ///< Values of entries.
+    }; // JacobianCache
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Create weak form keys and chunks of cohesive cells for each integration patch.
+     *
+     * @param[in] solution Solution field.
+     */
+    void _createPatchAssembly(const pylith::topology::Field& solution);
+
+    /// Destroy weak form keys and chunks of cohesive cells for integration patches.
+    void _destroyPatchAssembly(void);
+
+    /** Integrate LHS Jacobian into a work matrix and store the nonzero entries in the cache.
+     *
+     * @param[in] jacobianMat PETSc Mat with Jacobian sparse matrix (template for work matrix).
+     * @param[in] integrationData Data needed to integrate governing equations.
+     */
+    void _createLHSJacobianCache(PetscMat jacobianMat,
+                                 const pylith::feassemble::IntegrationData& integrationData);
+
+    /** Add entries in cache of LHS Jacobian to the Jacobian.
+     *
+     * @param[out] jacobianMat PETSc Mat with Jacobian sparse matrix.
+     */
+    void _addLHSJacobianCache(PetscMat jacobianMat) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -248,12 +317,18 @@ private:
     std::string _surfaceLabelName; ///< Name of label identifying interface surface.
 
     pylith::feassemble::InterfacePatches* _integrationPatches; ///< Face patches.
+    std::vector<PatchAssembly> _patchAssembly; ///< Keys and cell chunks for integration patches.
 
     PetscDM _weightingDM; ///< PETSc DM for weighting.
     PetscVec _weightingVec; ///< PETSc Vec for weighting values.
 
     bool _hasLHSResidualWeighted; ///< Has LHS Residual with weighted terms.
     bool _hasLHSJacobianWeighted; ///< Has LHS Jacobian with weighted terms.
+    bool _hasMaterialKernelsJacobian; ///< Bounding materials contribute Jacobian kernels.
+
+    JacobianCache _lhsJacobianCache; ///< Cache of LHS Jacobian entries.
+    bool _useLHSJacobianCache; ///< Use cache of LHS Jacobian.
+    bool _hasLHSJacobianCache; ///< Cache of LHS Jacobian has been created.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
@@ -29,6 +29,7 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
 #include <utility> // USES std::pair
+#include <vector> // USES std::vector
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
@@ -94,8 +95,13 @@ pylith::feassemble::InterfacePatches::createMaterialPairs(const pylith::faults::
     patches->_labelName = patchLabelName;
 
     PetscErrorCode err = DMCreateLabel(dmSoln, patchLabelName.c_str());PYLITH_CHECK_ERROR(err);
+    PetscDMLabel patchLabel = NULL;
+    err = DMGetLabel(dmSoln, patchLabelName.c_str(), &patchLabel);PYLITH_CHECK_ERROR(err);assert(patchLabel);
+    PetscDMLabel cellsLabel = NULL;
+    err = DMGetLabel(dmSoln, cellsLabelName, &cellsLabel);PYLITH_CHECK_ERROR(err);assert(cellsLabel);
 
     std::map<std::pair<int,int>, int> integrationPatches;
+    std::vector<std::vector<PetscInt> > patchCells;
     PylithInt patchLabelValue = 0;
 
     PetscIS cohesiveCellsIS = NULL;
@@ -106,6 +112,10 @@ pylith::feassemble::InterfacePatches::createMaterialPairs(const pylith::faults::
     err = ISGetSize(cohesiveCellsIS, &numCohesiveCells);PYLITH_CHECK_ERROR(err);assert(numCohesiveCells > 0);
     err = ISGetIndices(cohesiveCellsIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);assert(cohesiveCells);
 
+    // Group cohesive cells by the material pair of the adjacent cells. Consecutive cohesive cells usually share a
+    // material pair, so we only search the map of material pairs when the pair changes.
+    std::pair<int, int> matPairPrev(-1, -1);
+    PylithInt patchIndexPrev = -1;
     for (PylithInt iCohesive = 0; iCohesive < numCohesiveCells; ++iCohesive) {
         const PetscInt cohesiveCell = cohesiveCells[iCohesive];
         assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, cohesiveCell));
@@ -117,10 +127,16 @@ pylith::feassemble::InterfacePatches::createMaterialPairs(const pylith::faults::
         assert(adjacentCellPositive >= 0);
 
         std::pair<int, int> matPair;
-        err = DMGetLabelValue(dmSoln, cellsLabelName, adjacentCellNegative, &matPair.first);
-        err = DMGetLabelValue(dmSoln, cellsLabelName, adjacentCellPositive, &matPair.second);
+        err = DMLabelGetValue(cellsLabel, adjacentCellNegative, &matPair.first);PYLITH_CHECK_ERROR(err);
+        err = DMLabelGetValue(cellsLabel, adjacentCellPositive, &matPair.second);PYLITH_CHECK_ERROR(err);
+        if ((patchIndexPrev >= 0) && (matPair == matPairPrev)) {
+            patchCells[patchIndexPrev].push_back(cohesiveCell);
+            continue;
+        } // if
+
         if (0 == integrationPatches.count(matPair)) {
             integrationPatches[matPair] = ++patchLabelValue;
+            patchCells.resize(patchLabelValue);
             pythia::journal::debug_t debug("interfacepatches");
             debug << pythia::journal::at(__HERE__)
                   << "Creating integration patch on fault '" << fault->getSurfaceLabelName()
@@ -144,7 +160,20 @@ pylith::feassemble::InterfacePatches::createMaterialPairs(const pylith::faults::
             weakFormKeys.positive = *key;delete key;key = NULL;
             patches->_keys[patchLabelValue] = weakFormKeys;
         } // if
-        err = DMSetLabelValue(dmSoln, patchLabelName.c_str(), cohesiveCell, integrationPatches[matPair]);
+        matPairPrev = matPair;
+        patchIndexPrev = integrationPatches[matPair] - 1;
+        patchCells[patchIndexPrev].push_back(cohesiveCell);
+    } // for
+
+    // Set the label value for all cohesive cells in each patch at once. The cohesive cells are sorted, so the cells
+    // in each patch are also sorted.
+    for (size_t iPatch = 0; iPatch < patchCells.size(); ++iPatch) {
+        PetscIS patchIS = NULL;
+        const PetscInt numPatchCells = patchCells[iPatch].size();
+        err = ISCreateGeneral(PETSC_COMM_SELF, numPatchCells, &patchCells[iPatch][0], PETSC_COPY_VALUES,
+                              &patchIS);PYLITH_CHECK_ERROR(err);
+        err = DMLabelSetStratumIS(patchLabel, iPatch+1, patchIS);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&patchIS);PYLITH_CHECK_ERROR(err);
     } // for
     err = ISRestoreIndices(cohesiveCellsIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);
     err = ISDestroy(&cohesiveCellsIS);PYLITH_CHECK_ERROR(err);
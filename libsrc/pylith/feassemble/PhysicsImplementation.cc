@@ -82,6 +82,14 @@ pylith::feassemble::PhysicsImplementation::getPhysicsLabelValue(void) const {
 } // getPhysicsLabelValue
 
 
+// ------------------------------------------------------------------------------------------------
+// Get physics implemented by this object.
+const pylith::problems::Physics*
+pylith::feassemble::PhysicsImplementation::getPhysics(void) const {
+    return _physics;
+} // getPhysics
+
+
 // ------------------------------------------------------------------------------------------------
 // Get auxiliary field.
 const pylith::topology::Field*
@@ -98,6 +106,28 @@ pylith::feassemble::PhysicsImplementation::getDerivedField(void) const {
 } // getDerivedField
 
 
+// ------------------------------------------------------------------------------------------------
+// Recompute values of auxiliary field from spatial databases, keeping the layout of the field.
+void
+pylith::feassemble::PhysicsImplementation::reinitialize(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("reinitialize(solution="<<solution.getLabel()<<")");
+
+    if (!_auxiliaryField) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // The auxiliary field is attached to the solution DM, so we copy the new values into the existing field.
+    assert(_physics);
+    pylith::topology::Field* auxiliaryField = _physics->createAuxiliaryField(solution, getPhysicsDomainMesh());
+    assert(auxiliaryField);
+    PetscErrorCode err = VecCopy(auxiliaryField->getLocalVector(), _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    delete auxiliaryField;auxiliaryField = NULL;
+
+    PYLITH_METHOD_END;
+} // reinitialize
+
+
 // ------------------------------------------------------------------------------------------------
 // Notify observers of current solution.
 void
@@ -114,4 +144,13 @@ pylith::feassemble::PhysicsImplementation::notifyObservers(const PylithReal t,
 } // _notifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether any observer needs update at time t.
+bool
+pylith::feassemble::PhysicsImplementation::needsObserverUpdate(const PylithReal t,
+                                                               const PylithInt tindex) const {
+    return _observers && _observers->needsUpdate(t, tindex);
+} // needsObserverUpdate
+
+
 // End of file
@@ -60,6 +60,12 @@ public:
     virtual
     const pylith::topology::Mesh& getPhysicsDomainMesh(void) const = 0;
 
+    /** Get physics implemented by this object.
+     *
+     * @returns Physics implemented by this object.
+     */
+    const pylith::problems::Physics* getPhysics(void) const;
+
     /** Get name of label marking material.
      *
      * @returns Name of label for material (from mesh generator).
@@ -84,6 +90,13 @@ public:
      */
     const pylith::topology::Field* getDerivedField(void) const;
 
+    /** Recompute values of auxiliary field from spatial databases, keeping the layout of the field.
+     *
+     * @param[in] solution Solution field (layout).
+     */
+    virtual
+    void reinitialize(const pylith::topology::Field& solution);
+
     /** Notify observers of current solution.
      *
      * @param[in] t Current time.
@@ -94,6 +107,15 @@ public:
                          const PylithInt tindex,
                          const pylith::topology::Field& solution);
 
+    /** Check whether any observer needs update at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if at least one observer needs update, false otherwise.
+     */
+    bool needsObserverUpdate(const PylithReal t,
+                             const PylithInt tindex) const;
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -22,6 +22,7 @@
 
 #include "pylith/topology/Field.hh" // USES Field
 
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 
 #include <cassert> // USES assert()
@@ -32,8 +33,7 @@ pylith::feassemble::UpdateStateVars::UpdateStateVars(void) :
     _stateVarsIS(NULL),
     _stateVarsDM(NULL),
     _stateVarsVecLocal(NULL),
-    _stateVarsVecGlobal(NULL),
-    _auxiliaryFieldVecGlobal(NULL) {}
+    _stateVarsVecGlobal(NULL) {}
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -54,7 +54,7 @@ pylith::feassemble::UpdateStateVars::deallocate(void) {
     err = DMDestroy(&_stateVarsDM);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
-    err = VecDestroy(&_auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::release(this);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -82,29 +82,87 @@ void
 pylith::feassemble::UpdateStateVars::initialize(const pylith::topology::Field& auxiliaryField) {
     PYLITH_METHOD_BEGIN;
 
+    const pylith::string_vector& subfieldNames = auxiliaryField.getSubfieldNames();
+    pylith::string_vector stateSubfieldNames;
+    for (size_t iSubfield = 0; iSubfield < subfieldNames.size(); ++iSubfield) {
+        const pylith::topology::Field::SubfieldInfo& info = auxiliaryField.getSubfieldInfo(subfieldNames[iSubfield].c_str());
+        if (info.description.hasHistory) {
+            stateSubfieldNames.push_back(subfieldNames[iSubfield]);
+        } // if
+    } // for
+    initialize(auxiliaryField, stateSubfieldNames);
+
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Initialize layout for updating selected subfields of the auxiliary field.
+void
+pylith::feassemble::UpdateStateVars::initialize(const pylith::topology::Field& auxiliaryField,
+                                                const pylith::string_vector& subfieldNames) {
+    PYLITH_METHOD_BEGIN;
+
+    deallocate();
+
     PetscErrorCode err = 0;
     PetscDM auxiliaryDM = auxiliaryField.getDM();
 
-    const pylith::string_vector& subfieldNames = auxiliaryField.getSubfieldNames();
-    const size_t numAuxiliarySubfields = subfieldNames.size();
-    pylith::int_array stateSubfieldIndices(numAuxiliarySubfields);
+    const size_t numStateSubfields = subfieldNames.size();
+    pylith::int_array stateSubfieldIndices(numStateSubfields);
 
-    size_t numStateSubfields = 0;
-    for (size_t iSubfield = 0; iSubfield < numAuxiliarySubfields; ++iSubfield) {
+    bool onlyCellValues = true;
+    for (size_t iSubfield = 0; iSubfield < numStateSubfields; ++iSubfield) {
         const pylith::topology::Field::SubfieldInfo& info = auxiliaryField.getSubfieldInfo(subfieldNames[iSubfield].c_str());
-        if (info.description.hasHistory) {
-            stateSubfieldIndices[numStateSubfields++] = info.index;
-        } // if
+        stateSubfieldIndices[iSubfield] = info.index;
+        onlyCellValues = onlyCellValues && ((pylith::topology::FieldBase::POINT_SPACE == info.fe.feSpace) ||
+                                            !info.fe.isBasisContinuous);
     } // for
     std::sort(&stateSubfieldIndices[0], &stateSubfieldIndices[numStateSubfields]);
 
     // Create subDM holding only the state vars, which we want to update.
-    err = DMCreateSubDM(auxiliaryDM, numStateSubfields, &stateSubfieldIndices[0], &_stateVarsIS,
-                        &_stateVarsDM);PYLITH_CHECK_ERROR(err);
-    err = DMCreateGlobalVector(_stateVarsDM, &_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+    err = DMCreateSubDM(auxiliaryDM, numStateSubfields, &stateSubfieldIndices[0], NULL, &_stateVarsDM);PYLITH_CHECK_ERROR(err);
     err = DMCreateLocalVector(_stateVarsDM, &_stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
 
-    err = DMCreateGlobalVector(auxiliaryDM, &_auxiliaryFieldVecGlobal);
+    // Map from state variables local vector to auxiliary field local vector.
+    PetscSection auxiliarySection = auxiliaryField.getLocalSection();
+    PetscSection stateVarsSection = NULL;
+    PetscInt pStart = 0, pEnd = 0, stateVarsSize = 0;
+    err = DMGetLocalSection(_stateVarsDM, &stateVarsSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetChart(stateVarsSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetStorageSize(stateVarsSection, &stateVarsSize);PYLITH_CHECK_ERROR(err);
+    PetscInt* indices = NULL;
+    err = PetscMalloc1(stateVarsSize, &indices);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        for (size_t iState = 0; iState < numStateSubfields; ++iState) {
+            PetscInt numDof = 0, stateOffset = 0, auxiliaryOffset = 0;
+            err = PetscSectionGetFieldDof(stateVarsSection, point, iState, &numDof);PYLITH_CHECK_ERROR(err);
+            if (!numDof) { continue; }
+            err = PetscSectionGetFieldOffset(stateVarsSection, point, iState, &stateOffset);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(auxiliarySection, point, stateSubfieldIndices[iState], &auxiliaryOffset);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+                indices[stateOffset+iDof] = auxiliaryOffset + iDof;
+            } // for
+        } // for
+    } // for
+    err = ISCreateGeneral(PETSC_COMM_SELF, stateVarsSize, indices, PETSC_OWN_POINTER, &_stateVarsIS);PYLITH_CHECK_ERROR(err);
+
+    // Values at points shared among processes must match those from the owning process, so in parallel we exchange
+    // the state variables (but not the entire auxiliary field) after the projection. State variables with values only
+    // in the interior of cells (quadrature points or discontinuous basis) are computed identically on every process
+    // holding the cell, so no exchange is needed.
+    PetscMPIInt commSize = 1;
+    err = MPI_Comm_size(PetscObjectComm((PetscObject) auxiliaryDM), &commSize);PYLITH_CHECK_ERROR(err);
+    if ((commSize > 1) && !onlyCellValues) {
+        err = DMCreateGlobalVector(_stateVarsDM, &_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PetscInt sizeStateGlobal = 0;
+    if (_stateVarsVecGlobal) {
+        err = VecGetLocalSize(_stateVarsVecGlobal, &sizeStateGlobal);PYLITH_CHECK_ERROR(err);
+    } // if
+    pylith::utils::MemoryLogger::record(this, "update state variables", "state variables vectors",
+                                        (stateVarsSize + sizeStateGlobal) * sizeof(PetscScalar));
 
     PYLITH_METHOD_END;
 } // initialize
@@ -116,16 +174,8 @@ void
 pylith::feassemble::UpdateStateVars::prepare(pylith::topology::Field* auxiliaryField) {
     PYLITH_METHOD_BEGIN;
 
-    // :TODO: Verify that we need the global vectors and can't get by with just using VecISCopy() with the local vector.
-
-    PetscErrorCode err = 0;
-    err = VecSet(_stateVarsVecLocal, 0.0);PYLITH_CHECK_ERROR(err);
-
-    // Move auxiliaryDM data to global vector.
-    assert(auxiliaryField);
-    PetscDM auxiliaryDM = auxiliaryField->getDM();
-    err = DMLocalToGlobalBegin(auxiliaryDM, auxiliaryField->getLocalVector(), INSERT_VALUES, _auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
-    err = DMLocalToGlobalEnd(auxiliaryDM, auxiliaryField->getLocalVector(), INSERT_VALUES, _auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
+    // The current state variables are read directly from the local vector of the auxiliary field during the projection.
+    PetscErrorCode err = VecSet(_stateVarsVecLocal, 0.0);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // prepare
@@ -139,18 +189,17 @@ pylith::feassemble::UpdateStateVars::restore(pylith::topology::Field* auxiliaryF
 
     PetscErrorCode err = 0;
     assert(auxiliaryField);
-    PetscDM auxiliaryDM = auxiliaryField->getDM();
-
-    // Move statevarDM data to global vector.
-    err = DMLocalToGlobalBegin(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
-    err = DMLocalToGlobalEnd(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
 
-    // Copy global data from stateVars to auxiliaryField
-    err = VecISCopy(_auxiliaryFieldVecGlobal, _stateVarsIS, SCATTER_FORWARD, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+    // Use values from owning process at shared points.
+    if (_stateVarsVecGlobal) {
+        err = DMLocalToGlobalBegin(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+        err = DMLocalToGlobalEnd(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+        err = DMGlobalToLocalBegin(_stateVarsDM, _stateVarsVecGlobal, INSERT_VALUES, _stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
+        err = DMGlobalToLocalEnd(_stateVarsDM, _stateVarsVecGlobal, INSERT_VALUES, _stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
+    } // if
 
-    // Move auxiliaryDM data to local vector
-    err = DMGlobalToLocalBegin(auxiliaryDM, _auxiliaryFieldVecGlobal, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
-    err = DMGlobalToLocalEnd(auxiliaryDM, _auxiliaryFieldVecGlobal, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    // Copy state variables into local vector of auxiliary field.
+    err = VecISCopy(auxiliaryField->getLocalVector(), _stateVarsIS, SCATTER_FORWARD, _stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // restore
@@ -31,6 +31,7 @@
 #include "pylith/topology/topologyfwd.hh" // USES Field
 
 #include "pylith/utils/petscfwd.h" // USES PetscIS, PetscDM, PetscVec
+#include "pylith/utils/array.hh" // USES string_vector
 
 class pylith::feassemble::UpdateStateVars : public pylith::utils::GenericComponent {
     friend class TestUpdateStateVars; // unit testing
@@ -66,6 +67,14 @@ public:
      */
     void initialize(const pylith::topology::Field& auxiliaryField);
 
+    /** Initialize layout for updating selected subfields of the auxiliary field.
+     *
+     * @param[in] auxiliaryField Auxiliary field containing subfields.
+     * @param[in] subfieldNames Names of subfields to update.
+     */
+    void initialize(const pylith::topology::Field& auxiliaryField,
+                    const pylith::string_vector& subfieldNames);
+
     /** Extract current state variables in auxiliary field in preparation for computing new ones.
      *
      * @param[inout] auxiliaryField Auxiliary field containing state variables.
@@ -81,11 +90,10 @@ public:
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
-    PetscIS _stateVarsIS; ///< Petsc IS for state vars in auxiliary field.
+    PetscIS _stateVarsIS; ///< Petsc IS for state vars in local vector of auxiliary field.
     PetscDM _stateVarsDM; ///< Petsc DM for state vars subfield.
-    PetscVec _stateVarsVecLocal; ///< Petsc Vec with global vector for state vars.
-    PetscVec _stateVarsVecGlobal; ///< Petsc Vec with global vector for state vars.
-    PetscVec _auxiliaryFieldVecGlobal; ///< Petsc Vec with global vector for auxiliary field.
+    PetscVec _stateVarsVecLocal; ///< Petsc Vec with local vector for state vars.
+    PetscVec _stateVarsVecGlobal; ///< Petsc Vec with global vector for state vars (parallel only).
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -25,12 +25,14 @@
  * where \tau_{shear} = -rho(\vec{x}) v_s v_{shear}
  * and \tau_{normal} = -rho(\vec{x}) v_p v_{normal}
  *
+ * The impedances rho v_p and rho v_s are computed once when the auxiliary field is set, so the traction is
+ * \vec{\tau} = -(Z_s \vec{v} + (Z_p - Z_s) (\vec{v} \cdot \vec{n}) \vec{n}).
+ *
  * Solution fields: [disp(dim), vel(dim), ...]
  *
  * Auxiliary fields:
- * - 0: density(1)
- * - 1: vp(1)
- * - 2: vs(1)
+ * - 0: p_wave_impedance(1)
+ * - 1: s_wave_impedance(1)
  */
 
 #if !defined(pylith_fekernels_absorbingdampers_hh)
@@ -95,13 +97,12 @@ public:
             PylithScalar g0[]) {
         assert(2 == dim || 3 == dim);
 
-        const PylithInt _numA = 3;
+        const PylithInt _numA = 2;
         assert(_numA == numA);
         assert(aOff);
         assert(a);
-        const PylithInt i_density = aOff[0];
-        const PylithInt i_vp = aOff[1];
-        const PylithInt i_vs = aOff[2];
+        const PylithInt i_impedanceP = aOff[0];
+        const PylithInt i_impedanceS = aOff[1];
 
         const PylithInt _numS = 2;
         assert(sOff);
@@ -109,25 +110,18 @@ public:
         assert(numS >= _numS);
         const PylithInt i_vel = sOff[1];
 
-        const PylithScalar density = a[i_density];
-        const PylithScalar vp = a[i_vp];
-        const PylithScalar vs = a[i_vs];
+        const PylithScalar impedanceP = a[i_impedanceP];
+        const PylithScalar impedanceS = a[i_impedanceS];
+        const PylithScalar* vel = &s[i_vel];
 
-        PylithScalar velN[3];
-        PylithScalar velT[3];
         PylithScalar velNMag = 0;
         for (PylithInt i = 0; i < dim; ++i) {
-            velNMag += s[i_vel+i] * n[i];
-        } // for
-        for (PylithInt i = 0; i < dim; ++i) {
-            velN[i] = velNMag * n[i];
-        } // for
-        for (PylithInt i = 0; i < dim; ++i) {
-            velT[i] = s[i_vel+i] - velN[i];
+            velNMag += vel[i] * n[i];
         } // for
 
+        const PylithScalar tractionN = (impedanceP - impedanceS) * velNMag;
         for (PylithInt i = 0; i < dim; ++i) {
-            g0[i] -= density * (vs * velT[i] + vp * velN[i]);
+            g0[i] -= impedanceS * vel[i] + tractionN * n[i];
         } // for
     } // g0
 
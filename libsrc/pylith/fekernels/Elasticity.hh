@@ -640,6 +640,53 @@ public:
 
 }; // Elasticity3D
 
+// ------------------------------------------------------------------------------------------------
+/** Kernels for elasticity with spatial dimension known at compile time.
+ *
+ * Strain and stress are dense DIM x DIM matrices (see TensorDim). For plane strain (DIM=2), the out-of-plane
+ * strain is zero.
+ *
+ * @tparam DIM Spatial dimension.
+ */
+template<int DIM>
+class pylith::fekernels::ElasticityDim {
+    // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    // --------------------------------------------------------------------------------------------
+    /** Calculate infinitesimal strain tensor.
+     *
+     * @param[in] disp_x Gradient of displacement field.
+     * @param[out] strain Strain tensor [DIM*DIM].
+     */
+    static inline
+    void infinitesimalStrain(const PylithScalar disp_x[],
+                             PylithReal strain[]) {
+        assert(disp_x);
+        assert(strain);
+
+        pylith::fekernels::TensorDim<DIM>::symmetricPart(disp_x, strain);
+    } // infinitesimalStrain
+
+    // --------------------------------------------------------------------------------------------
+    /** Add stress contribution to f1 function for elasticity, f1 -= stress.
+     *
+     * @param[in] stress Stress tensor [DIM*DIM].
+     * @param[inout] f1 Residual [DIM*DIM].
+     */
+    static inline
+    void f1v(const PylithReal stress[],
+             PylithScalar f1[]) {
+        assert(stress);
+        assert(f1);
+
+        for (PylithInt i = 0; i < DIM*DIM; ++i) {
+            f1[i] -= stress[i];
+        } // for
+    } // f1v
+
+}; // ElasticityDim
+
 #endif // pylith_fekernels_elasticity3d_hh
 
 // End of file
@@ -314,6 +314,224 @@ public:
 
 }; // IsotropicLinearElasticity
 
+// ------------------------------------------------------------------------------------------------
+/** Kernels for isotropic, linear elasticity with spatial dimension known at compile time.
+ *
+ * The stress, sigma_ij = lambda * strain_kk * delta_ij + 2 * shear_modulus * strain_ij, and the elastic constants,
+ * C_ijkl = lambda * delta_ij * delta_kl + shear_modulus * (delta_ik * delta_jl + delta_il * delta_jk), are computed
+ * with dense DIM x DIM matrices and compile-time loop bounds. DIM=2 corresponds to plane strain. The kernels in
+ * IsotropicLinearElasticityPlaneStrain and IsotropicLinearElasticity3D are instantiations of these kernels.
+ *
+ * @tparam DIM Spatial dimension.
+ */
+template<int DIM>
+class pylith::fekernels::IsotropicLinearElasticityDim {
+    // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    // --------------------------------------------------------------------------------------------
+    /** f1 entry function for isotropic linear elasticity with infinitesimal strain WITHOUT
+     * reference stress and reference strain.
+     *
+     * Solution fields: [disp(dim), ...]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1)]
+     */
+    static inline
+    void f1v_infinitesimalStrain(const PylithInt dim,
+                                 const PylithInt numS,
+                                 const PylithInt numA,
+                                 const PylithInt sOff[],
+                                 const PylithInt sOff_x[],
+                                 const PylithScalar s[],
+                                 const PylithScalar s_t[],
+                                 const PylithScalar s_x[],
+                                 const PylithInt aOff[],
+                                 const PylithInt aOff_x[],
+                                 const PylithScalar a[],
+                                 const PylithScalar a_t[],
+                                 const PylithScalar a_x[],
+                                 const PylithReal t,
+                                 const PylithScalar x[],
+                                 const PylithInt numConstants,
+                                 const PylithScalar constants[],
+                                 PylithScalar f1[]) {
+        assert(DIM == dim);
+        assert(numS >= 1);
+        assert(numA >= 3); // also have density
+
+        // Incoming solution field.
+        const PylithInt i_disp = 0;
+
+        // Incoming auxiliary fields.
+        const PylithInt i_shearModulus = numA-2;
+        const PylithInt i_bulkModulus = numA-1;
+
+        assert(aOff[i_shearModulus] >= 0);
+        assert(aOff[i_bulkModulus] >= 0);
+
+        const PylithReal shearModulus = a[aOff[i_shearModulus]];assert(shearModulus > 0.0);
+        const PylithReal bulkModulus = a[aOff[i_bulkModulus]];assert(bulkModulus > 0.0);
+
+        PylithReal strain[DIM*DIM];
+        pylith::fekernels::ElasticityDim<DIM>::infinitesimalStrain(&s_x[sOff_x[i_disp]], strain);
+
+        PylithReal stress[DIM*DIM];
+        cauchyStress(shearModulus, bulkModulus, strain, stress);
+        pylith::fekernels::ElasticityDim<DIM>::f1v(stress, f1);
+    } // f1v_infinitesimalStrain
+
+    // --------------------------------------------------------------------------------------------
+    /** f1 entry function for isotropic linear elasticity with infinitesimal strain WITH
+     * reference stress and reference strain.
+     *
+     * Solution fields: [disp(dim), ...]
+     * Auxiliary fields: [..., refstress(4|6), refstrain(4|6), shear_modulus(1), bulk_modulus(1)]
+     */
+    static inline
+    void f1v_infinitesimalStrain_refState(const PylithInt dim,
+                                          const PylithInt numS,
+                                          const PylithInt numA,
+                                          const PylithInt sOff[],
+                                          const PylithInt sOff_x[],
+                                          const PylithScalar s[],
+                                          const PylithScalar s_t[],
+                                          const PylithScalar s_x[],
+                                          const PylithInt aOff[],
+                                          const PylithInt aOff_x[],
+                                          const PylithScalar a[],
+                                          const PylithScalar a_t[],
+                                          const PylithScalar a_x[],
+                                          const PylithReal t,
+                                          const PylithScalar x[],
+                                          const PylithInt numConstants,
+                                          const PylithScalar constants[],
+                                          PylithScalar f1[]) {
+        assert(DIM == dim);
+        assert(numS >= 1);
+        assert(numA >= 5); // also have density
+
+        // Incoming solution field.
+        const PylithInt i_disp = 0;
+
+        // Incoming auxiliary fields.
+        const PylithInt i_refStress = numA-4;
+        const PylithInt i_refStrain = numA-3;
+        const PylithInt i_shearModulus = numA-2;
+        const PylithInt i_bulkModulus = numA-1;
+
+        assert(aOff[i_refStress] >= 0);
+        assert(aOff[i_refStrain] >= 0);
+        assert(aOff[i_shearModulus] >= 0);
+        assert(aOff[i_bulkModulus] >= 0);
+
+        const PylithReal shearModulus = a[aOff[i_shearModulus]];assert(shearModulus > 0.0);
+        const PylithReal bulkModulus = a[aOff[i_bulkModulus]];assert(bulkModulus > 0.0);
+        const PylithReal* refStressVector = &a[aOff[i_refStress]];
+        const PylithReal* refStrainVector = &a[aOff[i_refStrain]];
+
+        PylithReal strain[DIM*DIM];
+        pylith::fekernels::ElasticityDim<DIM>::infinitesimalStrain(&s_x[sOff_x[i_disp]], strain);
+
+        // The trace of the reference strain includes the out-of-plane component for plane strain.
+        PylithReal refStrain[DIM*DIM];
+        pylith::fekernels::TensorDim<DIM>::fromVector(refStrainVector, refStrain);
+        const PylithReal lambda = bulkModulus - 2.0/3.0*shearModulus;
+        const PylithReal meanTerm = lambda * (pylith::fekernels::TensorDim<DIM>::trace(strain) -
+                                              pylith::fekernels::TensorDim<DIM>::traceVector(refStrainVector));
+
+        PylithReal stress[DIM*DIM];
+        pylith::fekernels::TensorDim<DIM>::fromVector(refStressVector, stress);
+        for (PylithInt i = 0; i < DIM*DIM; ++i) {
+            stress[i] += 2.0*shearModulus*(strain[i] - refStrain[i]);
+        } // for
+        for (PylithInt i = 0; i < DIM; ++i) {
+            stress[i*DIM+i] += meanTerm;
+        } // for
+        pylith::fekernels::ElasticityDim<DIM>::f1v(stress, f1);
+    } // f1v_infinitesimalStrain_refState
+
+    // --------------------------------------------------------------------------------------------
+    /** Jf3_vu entry function for isotropic linear elasticity.
+     *
+     * j(f,g,df,dg) = C(f,df,g,dg)
+     *
+     * Solution fields: [...]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1)]
+     */
+    static inline
+    void Jf3vu_infinitesimalStrain(const PylithInt dim,
+                                   const PylithInt numS,
+                                   const PylithInt numA,
+                                   const PylithInt sOff[],
+                                   const PylithInt sOff_x[],
+                                   const PylithScalar s[],
+                                   const PylithScalar s_t[],
+                                   const PylithScalar s_x[],
+                                   const PylithInt aOff[],
+                                   const PylithInt aOff_x[],
+                                   const PylithScalar a[],
+                                   const PylithScalar a_t[],
+                                   const PylithScalar a_x[],
+                                   const PylithReal t,
+                                   const PylithReal s_tshift,
+                                   const PylithScalar x[],
+                                   const PylithInt numConstants,
+                                   const PylithScalar constants[],
+                                   PylithScalar Jf3[]) {
+        assert(DIM == dim);
+        assert(numA >= 3); // also have density
+        assert(Jf3);
+
+        // Incoming auxiliary fields.
+        const PylithInt i_shearModulus = numA-2;
+        const PylithInt i_bulkModulus = numA-1;
+
+        assert(aOff[i_shearModulus] >= 0);
+        assert(aOff[i_bulkModulus] >= 0);
+
+        const PylithReal shearModulus = a[aOff[i_shearModulus]];assert(shearModulus > 0.0);
+        const PylithReal bulkModulus = a[aOff[i_bulkModulus]];assert(bulkModulus > 0.0);
+        const PylithReal lambda = bulkModulus - 2.0/3.0*shearModulus;
+
+        // Only entries with f == df and g == dg (lambda) or (f,df) == (g,dg) or (f,df) == (dg,g) (shear modulus)
+        // are nonzero.
+        for (PylithInt f = 0; f < DIM; ++f) {
+            for (PylithInt g = 0; g < DIM; ++g) {
+                Jf3[((f*DIM+g)*DIM+f)*DIM+g] -= lambda;
+                Jf3[((f*DIM+f)*DIM+g)*DIM+g] -= shearModulus;
+                Jf3[((f*DIM+g)*DIM+g)*DIM+f] -= shearModulus;
+            } // for
+        } // for
+    } // Jf3vu_infinitesimalStrain
+
+    // --------------------------------------------------------------------------------------------
+    /** Calculate Cauchy stress WITHOUT reference stress and reference strain.
+     *
+     * @param[in] shearModulus Shear modulus.
+     * @param[in] bulkModulus Bulk modulus.
+     * @param[in] strain Strain tensor [DIM*DIM].
+     * @param[out] stress Stress tensor [DIM*DIM].
+     */
+    static inline
+    void cauchyStress(const PylithReal shearModulus,
+                      const PylithReal bulkModulus,
+                      const PylithReal strain[],
+                      PylithReal stress[]) {
+        assert(strain);
+        assert(stress);
+
+        const PylithReal lambda = bulkModulus - 2.0/3.0*shearModulus;
+        const PylithReal meanTerm = lambda * pylith::fekernels::TensorDim<DIM>::trace(strain);
+        for (PylithInt i = 0; i < DIM*DIM; ++i) {
+            stress[i] = 2.0*shearModulus*strain[i];
+        } // for
+        for (PylithInt i = 0; i < DIM; ++i) {
+            stress[i*DIM+i] += meanTerm;
+        } // for
+    } // cauchyStress
+
+}; // IsotropicLinearElasticityDim
+
 // ------------------------------------------------------------------------------------------------
 /// Kernels specific to isotropic, linearly elasticity plane strain.
 class pylith::fekernels::IsotropicLinearElasticityPlaneStrain {
@@ -350,23 +568,9 @@ public:
                                  const PylithInt numConstants,
                                  const PylithScalar constants[],
                                  PylithScalar f1[]) {
-        const PylithInt _dim = 2;assert(_dim == dim);
-
-        pylith::fekernels::Elasticity::StrainContext strainContext;
-        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
-
-        pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
-            &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
-
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
-            pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
-    }
+        pylith::fekernels::IsotropicLinearElasticityDim<2>::f1v_infinitesimalStrain(
+            dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x, t, x, numConstants, constants, f1);
+    } // f1v_infinitesimalStrain
 
     // --------------------------------------------------------------------------------------------
     /** f1 entry function for isotropic linear elasticity plane strain with infinitesimal strain WITH
@@ -394,23 +598,9 @@ public:
                                           const PylithInt numConstants,
                                           const PylithScalar constants[],
                                           PylithScalar f1[]) {
-        const PylithInt _dim = 2;assert(_dim == dim);
-
-        pylith::fekernels::Elasticity::StrainContext strainContext;
-        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
-
-        pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext_refState(
-            &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
-
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
-            pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
-    }
+        pylith::fekernels::IsotropicLinearElasticityDim<2>::f1v_infinitesimalStrain_refState(
+            dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x, t, x, numConstants, constants, f1);
+    } // f1v_infinitesimalStrain_refState
 
     // --------------------------------------------------------------------------------------------
     /** Jf3_vu entry function for 2D plane strain isotropic linear elasticity.
@@ -450,57 +640,9 @@ public:
                                    const PylithInt numConstants,
                                    const PylithScalar constants[],
                                    PylithScalar Jf3[]) {
-        const PylithInt _dim = 2;assert(_dim == dim);
-        pylith::fekernels::IsotropicLinearElasticity::Context context;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
-            &context, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
-
-        assert(Jf3);
-
-        const PylithScalar shearModulus = context.shearModulus;
-        const PylithScalar bulkModulus = context.bulkModulus;
-
-        const PylithScalar lambda = bulkModulus - 2.0/3.0*shearModulus;
-        const PylithScalar lambda2mu = lambda + 2.0*shearModulus;
-
-        const PylithReal C1111 = lambda2mu;
-        const PylithReal C2222 = lambda2mu;
-        const PylithReal C1122 = lambda;
-        const PylithReal C1212 = shearModulus;
-
-        /* j(f,g,df,dg) = C(f,df,g,dg)
-         *
-         * 0: j0000 = C1111
-         * 1: j0001 = C1112 = 0
-         * 4: j0100 = C1121, symmetry C1112 = 0
-         * 5: j0101 = C1122
-         *
-         * 2: j0010 = C1211 = 0
-         * 3: j0011 = C1212
-         * 6: j0110 = C1221, symmetry C1212
-         * 7: j0111 = C1222 = 0
-         *
-         * 8: j1000 = C2111 = 0
-         * 9: j1001 = C2112, symmetry C1212
-         * 12: j1100 = C2121, symmetry C1212
-         * 13: j1101 = C2122, symmetry C1222 = 0
-         *
-         * 10: j1010 = C2211, symmetry C1122
-         * 11: j1011 = C2212, symmetry C1222 = 0
-         * 14: j1110 = C2221, symmetry C1222 = 0
-         * 15: j1111 = C2222
-         */
-
-        Jf3[ 0] -= C1111; // j0000
-        Jf3[ 3] -= C1212; // j0011
-        Jf3[ 5] -= C1122; // j0101
-        Jf3[ 6] -= C1212; // j0110, C1221
-        Jf3[ 9] -= C1212; // j1001, C2112
-        Jf3[10] -= C1122; // j1010, C2211
-        Jf3[12] -= C1212; // j1100, C2121
-        Jf3[15] -= C2222; // j1111
-    } // Jf3vu
+        pylith::fekernels::IsotropicLinearElasticityDim<2>::Jf3vu_infinitesimalStrain(
+            dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x, t, s_tshift, x, numConstants, constants, Jf3);
+    } // Jf3vu_infinitesimalStrain
 
     // ===========================================================================================
     // Kernels for fault interfaces and elasticity
@@ -828,23 +970,9 @@ public:
                                  const PylithInt numConstants,
                                  const PylithScalar constants[],
                                  PylithScalar f1[]) {
-        const PylithInt _dim = 3;assert(_dim == dim);
-
-        pylith::fekernels::Elasticity::StrainContext strainContext;
-        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
-
-        pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
-            &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
-
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
-            pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
-    }
+        pylith::fekernels::IsotropicLinearElasticityDim<3>::f1v_infinitesimalStrain(
+            dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x, t, x, numConstants, constants, f1);
+    } // f1v_infinitesimalStrain
 
     // --------------------------------------------------------------------------------------------
     /** f1 entry function for 3D isotropic linear elasticity with infinitesimal strain WITH
@@ -872,23 +1000,9 @@ public:
                                           const PylithInt numConstants,
                                           const PylithScalar constants[],
                                           PylithScalar f1[]) {
-        const PylithInt _dim = 3;assert(_dim == dim);
-
-        pylith::fekernels::Elasticity::StrainContext strainContext;
-        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
-
-        pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext_refState(
-            &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
-
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
-            pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
-    }
+        pylith::fekernels::IsotropicLinearElasticityDim<3>::f1v_infinitesimalStrain_refState(
+            dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x, t, x, numConstants, constants, f1);
+    } // f1v_infinitesimalStrain_refState
 
     // --------------------------------------------------------------------------------------------
     /** Jf3_vu entry function for 3D isotropic linear elasticity.
@@ -916,131 +1030,8 @@ public:
                                    const PylithInt numConstants,
                                    const PylithScalar constants[],
                                    PylithScalar Jf3[]) {
-        const PylithInt _dim = 3;assert(_dim == dim);
-        pylith::fekernels::IsotropicLinearElasticity::Context context;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
-            &context, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
-
-        assert(Jf3);
-
-        const PylithScalar shearModulus = context.shearModulus;
-        const PylithScalar bulkModulus = context.bulkModulus;
-
-        const PylithScalar lambda = bulkModulus - 2.0/3.0*shearModulus;
-        const PylithScalar lambda2mu = lambda + 2.0*shearModulus;
-
-        // All other values are either zero or equal to one of these.
-        const PylithReal C1111 = lambda2mu;
-        const PylithReal C1122 = lambda;
-        const PylithReal C1212 = shearModulus;
-        /* j(f,g,df,dg) = C(f,df,g,dg)
-         *
-         *  0:  j0000 = C1111 = lambda + 2.0*shearModulus
-         *  1:  j0001 = C1112 = 0
-         *  2:  j0002 = C1113 = 0
-         *  3:  j0010 = C1211 = 0
-         *  4:  j0011 = C1212 = shearModulus
-         *  5:  j0012 = C1213 = 0
-         *  6:  j0020 = C1311 = 0
-         *  7:  j0021 = C1312 = 0
-         *  8:  j0022 = C1313 = shearModulus
-         *  9:  j0100 = C1121 = 0
-         * 10:  j0101 = C1122 = lambda
-         * 11:  j0102 = C1123 = 0
-         * 12:  j0110 = C1221 = shearModulus
-         * 13:  j0111 = C1222 = 0
-         * 14:  j0112 = C1223 = 0
-         * 15:  j0120 = C1321 = 0
-         * 16:  j0121 = C1322 = 0
-         * 17:  j0122 = C1323 = 0
-         * 18:  j0200 = C1131 = 0
-         * 19:  j0201 = C1132 = 0
-         * 20:  j0202 = C1133 = lambda
-         * 21:  j0210 = C1231 = 0
-         * 22:  j0211 = C1232 = 0
-         * 23:  j0212 = C1233 = 0
-         * 24:  j0220 = C1331 = shearModulus
-         * 25:  j0221 = C1332 = 0
-         * 26:  j0222 = C1333 = 0
-         * 27:  j1000 = C2111 = 0
-         * 28:  j1001 = C2112 = shearModulus
-         * 29:  j1002 = C2113 = 0
-         * 30:  j1010 = C2211 = lambda
-         * 31:  j1011 = C2212 = 0
-         * 32:  j1012 = C2213 = 0
-         * 33:  j1020 = C2311 = 0
-         * 34:  j1021 = C2312 = 0
-         * 35:  j1022 = C2313 = 0
-         * 36:  j1100 = C2121 = shearModulus
-         * 37:  j1101 = C2122 = 0
-         * 38:  j1102 = C2123 = 0
-         * 39:  j1110 = C2221 = 0
-         * 40:  j1111 = C2222 = lambda + 2.0*shearModulus
-         * 41:  j1112 = C2223 = 0
-         * 42:  j1120 = C2321 = 0
-         * 43:  j1121 = C2322 = 0
-         * 44:  j1122 = C2323 = shearModulus
-         * 45:  j1200 = C2131 = 0
-         * 46:  j1201 = C2132 = 0
-         * 47:  j1202 = C2133 = 0
-         * 48:  j1210 = C2231 = 0
-         * 49:  j1211 = C2232 = 0
-         * 50:  j1212 = C2233 = lambda
-         * 51:  j1220 = C2331 = 0
-         * 52:  j1221 = C2332 = shearModulus
-         * 53:  j1222 = C2333 = 0
-         * 54:  j2000 = C3111 = 0
-         * 55:  j2001 = C3112 = 0
-         * 56:  j2002 = C3113 = shearModulus
-         * 57:  j2010 = C3211 = 0
-         * 58:  j2011 = C3212 = 0
-         * 59:  j2012 = C3213 = 0
-         * 60:  j2020 = C3311 = lambda
-         * 61:  j2021 = C3312 = 0
-         * 62:  j2022 = C3313 = 0
-         * 63:  j2100 = C3121 = 0
-         * 64:  j2101 = C3122 = 0
-         * 65:  j2102 = C3123 = 0
-         * 66:  j2110 = C3221 = 0
-         * 67:  j2111 = C3222 = 0
-         * 68:  j2112 = C3223 = shearModulus
-         * 69:  j2120 = C3321 = 0
-         * 70:  j2121 = C3322 = lambda
-         * 71:  j2122 = C3323 = 0
-         * 72:  j2200 = C3131 = shearModulus
-         * 73:  j2201 = C3132 = 0
-         * 74:  j2202 = C3133 = 0
-         * 75:  j2210 = C3231 = 0
-         * 76:  j2211 = C3232 = shearModulus
-         * 77:  j2212 = C3233 = 0
-         * 78:  j2220 = C3331 = 0
-         * 79:  j2221 = C3332 = 0
-         * 80:  j2222 = C3333 = lambda + 2.0*shearModulus
-         */
-
-        // Nonzero Jacobian entries.
-        Jf3[ 0] -= C1111; // j0000
-        Jf3[ 4] -= C1212; // j0011
-        Jf3[ 8] -= C1212; // j0022
-        Jf3[10] -= C1122; // j0101
-        Jf3[12] -= C1212; // j0110
-        Jf3[20] -= C1122; // j0202
-        Jf3[24] -= C1212; // j0220
-        Jf3[28] -= C1212; // j1001
-        Jf3[30] -= C1122; // j1010
-        Jf3[36] -= C1212; // j1100
-        Jf3[40] -= C1111; // j1111
-        Jf3[44] -= C1212; // j1122
-        Jf3[50] -= C1122; // j1212
-        Jf3[52] -= C1212; // j1221
-        Jf3[56] -= C1212; // j2002
-        Jf3[60] -= C1122; // j2020
-        Jf3[68] -= C1212; // j2112
-        Jf3[70] -= C1122; // j2121
-        Jf3[72] -= C1212; // j2200
-        Jf3[76] -= C1212; // j2211
-        Jf3[80] -= C1111; // j2222
+        pylith::fekernels::IsotropicLinearElasticityDim<3>::Jf3vu_infinitesimalStrain(
+            dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x, t, s_tshift, x, numConstants, constants, Jf3);
     } // Jf3vu_infinitesimalStrain
 
     // ===========================================================================================
@@ -231,6 +231,52 @@ public:
         Jf0[0] += 1.0 / bulkModulus;
     } // Jf0pp
 
+    // --------------------------------------------------------------------------------------------
+    /** Jf0_pp entry function for the approximation of the Schur complement for the pressure (preconditioner).
+     *
+     * The Schur complement is spectrally equivalent to the pressure mass matrix scaled by 1/shear_modulus plus the
+     * compressibility term 1/bulk_modulus.
+     *
+     * Solution fields: [disp(dim), pressure(1)]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1)]
+     */
+    static inline
+    void Jf0pp_schur(const PylithInt dim,
+                     const PylithInt numS,
+                     const PylithInt numA,
+                     const PylithInt sOff[],
+                     const PylithInt sOff_x[],
+                     const PylithScalar s[],
+                     const PylithScalar s_t[],
+                     const PylithScalar s_x[],
+                     const PylithInt aOff[],
+                     const PylithInt aOff_x[],
+                     const PylithScalar a[],
+                     const PylithScalar a_t[],
+                     const PylithScalar a_x[],
+                     const PylithReal t,
+                     const PylithReal s_tshift,
+                     const PylithScalar x[],
+                     const PylithInt numConstants,
+                     const PylithScalar constants[],
+                     PylithScalar Jf0[]) {
+        // Incoming auxiliary subfields
+        const PylithInt i_shearModulus = numA-2;
+        const PylithInt i_bulkModulus = numA-1;
+
+        assert(numA >= 2);
+        assert(aOff);
+        assert(aOff[i_shearModulus] >= 0);
+        assert(aOff[i_bulkModulus] >= 0);
+        assert(a);
+        assert(Jf0);
+
+        const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+        const PylithScalar bulkModulus = a[aOff[i_bulkModulus]];
+
+        Jf0[0] += 1.0 / shearModulus + 1.0 / bulkModulus;
+    } // Jf0pp_schur
+
     // ===========================================================================================
     // Helper functions
     // ===========================================================================================
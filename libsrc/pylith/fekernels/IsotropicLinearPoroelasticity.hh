@@ -1637,6 +1637,51 @@ public:
 
     } // Jf0pp
 
+    // ----------------------------------------------------------------------
+    /** Jf0_pp entry function for the preconditioner of the fixed-stress split for isotropic linear poroelasticity.
+     *
+     * The fixed-stress split adds the stabilization term biot_coefficient**2 / drained_bulk_modulus to the storage
+     * term, which accounts for the change in volumetric strain with pressure while the mean stress is held fixed.
+     *
+     * Solution fields: [...]
+     * Auxiliary fields: [density(1), shear_modulus(1), bulk_modulus(1), other poroelastic related param ...]
+     */
+    static inline
+    void Jf0pp_fixed_stress(const PylithInt dim,
+                            const PylithInt numS,
+                            const PylithInt numA,
+                            const PylithInt sOff[],
+                            const PylithInt sOff_x[],
+                            const PylithScalar s[],
+                            const PylithScalar s_t[],
+                            const PylithScalar s_x[],
+                            const PylithInt aOff[],
+                            const PylithInt aOff_x[],
+                            const PylithScalar a[],
+                            const PylithScalar a_t[],
+                            const PylithScalar a_x[],
+                            const PylithReal t,
+                            const PylithReal utshift,
+                            const PylithScalar x[],
+                            const PylithInt numConstants,
+                            const PylithScalar constants[],
+                            PylithScalar Jf0[]) {
+        const PylithInt _dim = 2;assert(_dim == dim);
+
+        // Rheology Context
+        pylith::fekernels::IsotropicLinearPoroelasticity::Context rheologyContext;
+        pylith::fekernels::IsotropicLinearPoroelasticity::setContext(
+            &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
+            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+
+        // Rheological Auxiliaries
+        const PylithScalar biotModulus = rheologyContext.biotModulus;
+        const PylithScalar biotCoefficient = rheologyContext.biotCoefficient;
+        const PylithScalar drainedBulkModulus = rheologyContext.drainedBulkModulus;
+
+        Jf0[0] += utshift * (1.0 / biotModulus + biotCoefficient * biotCoefficient / drainedBulkModulus);
+    } // Jf0pp_fixed_stress
+
     // ----------------------------------------------------------------------
     /** Jf0_pe entry function for isotropic linear poroelasticity.
      *
@@ -3676,6 +3721,51 @@ public:
 
     } // Jf0pp
 
+    // ----------------------------------------------------------------------
+    /** Jf0_pp entry function for the preconditioner of the fixed-stress split for isotropic linear poroelasticity.
+     *
+     * The fixed-stress split adds the stabilization term biot_coefficient**2 / drained_bulk_modulus to the storage
+     * term, which accounts for the change in volumetric strain with pressure while the mean stress is held fixed.
+     *
+     * Solution fields: [...]
+     * Auxiliary fields: [density(1), shear_modulus(1), bulk_modulus(1), other poroelastic related param ...]
+     */
+    static inline
+    void Jf0pp_fixed_stress(const PylithInt dim,
+                            const PylithInt numS,
+                            const PylithInt numA,
+                            const PylithInt sOff[],
+                            const PylithInt sOff_x[],
+                            const PylithScalar s[],
+                            const PylithScalar s_t[],
+                            const PylithScalar s_x[],
+                            const PylithInt aOff[],
+                            const PylithInt aOff_x[],
+                            const PylithScalar a[],
+                            const PylithScalar a_t[],
+                            const PylithScalar a_x[],
+                            const PylithReal t,
+                            const PylithReal utshift,
+                            const PylithScalar x[],
+                            const PylithInt numConstants,
+                            const PylithScalar constants[],
+                            PylithScalar Jf0[]) {
+        const PylithInt _dim = 3;assert(_dim == dim);
+
+        // Rheology Context
+        pylith::fekernels::IsotropicLinearPoroelasticity::Context rheologyContext;
+        pylith::fekernels::IsotropicLinearPoroelasticity::setContext(
+            &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
+            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+
+        // Rheological Auxiliaries
+        const PylithScalar biotModulus = rheologyContext.biotModulus;
+        const PylithScalar biotCoefficient = rheologyContext.biotCoefficient;
+        const PylithScalar drainedBulkModulus = rheologyContext.drainedBulkModulus;
+
+        Jf0[0] += utshift * (1.0 / biotModulus + biotCoefficient * biotCoefficient / drainedBulkModulus);
+    } // Jf0pp_fixed_stress
+
     // ----------------------------------------------------------------------
     /** Jf0_pe entry function for isotropic linear poroelasticity.
      *
@@ -4616,6 +4706,225 @@ public:
 
 }; // IsotropicLinearPoroelasticity3D
 
+// ------------------------------------------------------------------------------------------------
+/** Kernels for the flow equation of isotropic, linear poroelasticity (quasistatic) specialized at compile time.
+ *
+ * The spatial dimension, the type of permeability, and the optional auxiliary subfields are template parameters, so
+ * the indices of the auxiliary subfields are constants, the loops over the spatial dimension have fixed trip counts,
+ * and only the auxiliary subfields used by a kernel are read. The kernels compute the same values as the
+ * corresponding kernels in IsotropicLinearPoroelasticityPlaneStrain and IsotropicLinearPoroelasticity3D.
+ *
+ * @tparam DIM Spatial dimension (2 for plane strain, 3 for 3D).
+ * @tparam TENSOR_PERMEABILITY True if permeability is a tensor, false if it is isotropic.
+ * @tparam BODY_FORCE True if the auxiliary field includes the body force.
+ * @tparam GRAVITY True if the auxiliary field includes the gravity field.
+ * @tparam SOURCE_DENSITY True if the auxiliary field includes the source density.
+ */
+template<int DIM, bool TENSOR_PERMEABILITY, bool BODY_FORCE, bool GRAVITY, bool SOURCE_DENSITY>
+class pylith::fekernels::IsotropicLinearPoroelasticityFlow {
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    // ----------------------------------------------------------------------
+    /** f0p function for the flow equation (implicit).
+     *
+     * f0p = biot_coefficient * trace_strain_t + pressure_t / biot_modulus - source_density
+     */
+    static inline
+    void f0p_implicit(const PylithInt dim,
+                      const PylithInt numS,
+                      const PylithInt numA,
+                      const PylithInt sOff[],
+                      const PylithInt sOff_x[],
+                      const PylithScalar s[],
+                      const PylithScalar s_t[],
+                      const PylithScalar s_x[],
+                      const PylithInt aOff[],
+                      const PylithInt aOff_x[],
+                      const PylithScalar a[],
+                      const PylithScalar a_t[],
+                      const PylithScalar a_x[],
+                      const PylithReal t,
+                      const PylithScalar x[],
+                      const PylithInt numConstants,
+                      const PylithScalar constants[],
+                      PylithScalar f0[]) {
+        assert(DIM == dim);
+
+        // Incoming solution fields.
+        const PylithInt i_pressure = 1;
+        const PylithInt i_traceStrain = 2;
+
+        // Incoming auxiliary fields.
+        const PylithInt i_sourceDensity = 4 + GRAVITY + BODY_FORCE;
+        const PylithInt i_biotCoefficient = numA - 3;
+        const PylithInt i_biotModulus = numA - 2;
+
+        assert(numS >= 3);
+        assert(aOff[i_biotCoefficient] >= 0);
+        assert(aOff[i_biotModulus] >= 0);
+
+        if (s_t) {
+            const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+            const PylithScalar biotModulus = a[aOff[i_biotModulus]];assert(biotModulus > 0.0);
+
+            f0[0] += biotCoefficient * s_t[sOff[i_traceStrain]];
+            f0[0] += s_t[sOff[i_pressure]] / biotModulus;
+        } // if
+        if (SOURCE_DENSITY) {
+            assert(aOff[i_sourceDensity] >= 0);
+            f0[0] -= a[aOff[i_sourceDensity]];
+        } // if
+    } // f0p_implicit
+
+    // ----------------------------------------------------------------------
+    /** f1p function for the flow equation (Darcy flux rate).
+     *
+     * f1p = permeability / fluid_viscosity * (grad(pressure) - body_force - fluid_density * gravity_field)
+     */
+    static inline
+    void f1p(const PylithInt dim,
+             const PylithInt numS,
+             const PylithInt numA,
+             const PylithInt sOff[],
+             const PylithInt sOff_x[],
+             const PylithScalar s[],
+             const PylithScalar s_t[],
+             const PylithScalar s_x[],
+             const PylithInt aOff[],
+             const PylithInt aOff_x[],
+             const PylithScalar a[],
+             const PylithScalar a_t[],
+             const PylithScalar a_x[],
+             const PylithReal t,
+             const PylithScalar x[],
+             const PylithInt numConstants,
+             const PylithScalar constants[],
+             PylithScalar f1[]) {
+        assert(DIM == dim);
+
+        // Incoming solution fields.
+        const PylithInt i_pressure = 1;
+
+        // Incoming auxiliary fields.
+        const PylithInt i_fluidDensity = 1;
+        const PylithInt i_fluidViscosity = 2;
+        const PylithInt i_gravityField = 4;
+        const PylithInt i_bodyForce = 4 + GRAVITY;
+        const PylithInt i_permeability = numA - 1;
+
+        assert(aOff[i_fluidViscosity] >= 0);
+        assert(aOff[i_permeability] >= 0);
+
+        const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
+        PylithScalar drivingForce[DIM];
+        for (PylithInt i = 0; i < DIM; ++i) {
+            drivingForce[i] = pressure_x[i];
+        } // for
+        if (BODY_FORCE) {
+            assert(aOff[i_bodyForce] >= 0);
+            const PylithScalar* bodyForce = &a[aOff[i_bodyForce]];
+            for (PylithInt i = 0; i < DIM; ++i) {
+                drivingForce[i] -= bodyForce[i];
+            } // for
+        } // if
+        if (GRAVITY) {
+            assert(aOff[i_fluidDensity] >= 0);
+            assert(aOff[i_gravityField] >= 0);
+            const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
+            const PylithScalar* gravityField = &a[aOff[i_gravityField]];
+            for (PylithInt i = 0; i < DIM; ++i) {
+                drivingForce[i] -= fluidDensity * gravityField[i];
+            } // for
+        } // if
+
+        const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];assert(fluidViscosity > 0.0);
+        const PylithScalar* permeability = &a[aOff[i_permeability]];
+        if (TENSOR_PERMEABILITY) {
+            for (PylithInt i = 0; i < DIM; ++i) {
+                for (PylithInt j = 0; j < DIM; ++j) {
+                    f1[i] += permeability[_tensorIndex(i, j)] / fluidViscosity * drivingForce[j];
+                } // for
+            } // for
+        } else {
+            const PylithScalar mobility = permeability[0] / fluidViscosity;
+            for (PylithInt i = 0; i < DIM; ++i) {
+                f1[i] += mobility * drivingForce[i];
+            } // for
+        } // if/else
+    } // f1p
+
+    // ----------------------------------------------------------------------
+    /** Jf3pp function for the flow equation.
+     *
+     * Jf3pp = permeability / fluid_viscosity
+     */
+    static inline
+    void Jf3pp(const PylithInt dim,
+               const PylithInt numS,
+               const PylithInt numA,
+               const PylithInt sOff[],
+               const PylithInt sOff_x[],
+               const PylithScalar s[],
+               const PylithScalar s_t[],
+               const PylithScalar s_x[],
+               const PylithInt aOff[],
+               const PylithInt aOff_x[],
+               const PylithScalar a[],
+               const PylithScalar a_t[],
+               const PylithScalar a_x[],
+               const PylithReal t,
+               const PylithReal utshift,
+               const PylithScalar x[],
+               const PylithInt numConstants,
+               const PylithScalar constants[],
+               PylithScalar Jf3[]) {
+        assert(DIM == dim);
+
+        // Incoming auxiliary fields.
+        const PylithInt i_fluidViscosity = 2;
+        const PylithInt i_permeability = numA - 1;
+
+        assert(aOff[i_fluidViscosity] >= 0);
+        assert(aOff[i_permeability] >= 0);
+
+        const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];assert(fluidViscosity > 0.0);
+        const PylithScalar* permeability = &a[aOff[i_permeability]];
+        if (TENSOR_PERMEABILITY) {
+            for (PylithInt i = 0; i < DIM; ++i) {
+                for (PylithInt j = 0; j < DIM; ++j) {
+                    Jf3[i*DIM+j] += permeability[_tensorIndex(i, j)] / fluidViscosity;
+                } // for
+            } // for
+        } else {
+            const PylithScalar mobility = permeability[0] / fluidViscosity;
+            for (PylithInt i = 0; i < DIM; ++i) {
+                Jf3[i*DIM+i] += mobility;
+            } // for
+        } // if/else
+    } // Jf3pp
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    /** Get index of component of symmetric tensor stored as a vector.
+     *
+     * 2D: [xx, yy, zz, xy]; 3D: [xx, yy, zz, xy, yz, xz].
+     *
+     * @param[in] i Row of component.
+     * @param[in] j Column of component.
+     * @returns Index of component in vector.
+     */
+    static inline
+    PylithInt _tensorIndex(const PylithInt i,
+                           const PylithInt j) {
+        static const PylithInt indices2D[2][2] = { {0, 3}, {3, 1} };
+        static const PylithInt indices3D[3][3] = { {0, 3, 5}, {3, 1, 4}, {5, 4, 2} };
+        return (3 == DIM) ? indices3D[i][j] : indices2D[i][j];
+    } // _tensorIndex
+
+}; // IsotropicLinearPoroelasticityFlow
+
 #endif // pylith_fekernels_isotropiclinearporoelasticity_hh
 
 // End of file
@@ -85,9 +85,16 @@
 
 #include "pylith/utils/types.hh"
 
+#include <algorithm> // USES std::min(), std::max()
+#include <cmath> // USES exp(), log(), std::isfinite()
+#include <cstring> // USES memcpy()
+#include <stdint.h> // USES uint64_t
+
 // ------------------------------------------------------------------------------------------------
 /// Kernels for isotropic power-law viscoelasticity (dimension independent).
 class pylith::fekernels::IsotropicPowerLaw {
+    friend class TestIsotropicPowerLawKernels; // unit testing
+
     // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -573,6 +580,26 @@ public:
         tensorOps.toVector(devStressTensor, devStressVector);
     }
 
+    // --------------------------------------------------------------------------------------------
+    /** Calculate viscosity parameter gamma at intermediate time tau.
+     *
+     * gammaTau = powerLawRefStrainRate / powerLawRefStress * (j2Tau / powerLawRefStress)**(n-1),
+     *
+     * evaluated in log space with the reciprocal of the reference stress.
+     */
+    static inline
+    PylithReal computeGammaTau(const PylithReal j2Tau,
+                               const PylithReal powerLawExponent,
+                               const PylithReal powerLawRefStrainRate,
+                               const PylithReal powerLawRefStress) {
+        const PylithReal invRefStress = 1.0 / powerLawRefStress;
+        const PylithReal exponent = powerLawExponent - 1.0;
+        if (j2Tau <= 0.0) {
+            return (0.0 == exponent) ? powerLawRefStrainRate * invRefStress : 0.0;
+        } // if
+        return powerLawRefStrainRate * invRefStress * exp(exponent * log(j2Tau * invRefStress));
+    }
+
 private:
 
     // --------------------------------------------------------------------------------------------
@@ -621,6 +648,14 @@ private:
      *
      * Used to compute stress and viscous strain.
      *
+     * We start from a predictor (the effective stress at the previous time step or, if the material was unstressed,
+     * the elastic trial effective stress) and use a few safeguarded Newton iterations, which converge
+     * quadratically for the small changes in effective stress over a typical time step. If Newton's method does
+     * not converge, we fall back to bracketing the root followed by Newton's method with bisection.
+     *
+     * The Jacobian kernels solve for the effective stress with exactly the same parameters as the residual kernels
+     * at the same quadrature point, so we keep the most recent roots in a small direct-mapped cache and reuse a root
+     * when all of the parameters match bit for bit. The cache is not thread-safe; PyLith uses one thread per process.
      */
     static inline
     PylithReal _effectiveStress(const PylithScalar j2InitialGuess,
@@ -634,10 +669,88 @@ private:
                                 const PylithScalar powerLawExponent,
                                 const PylithScalar powerLawRefStrainRate,
                                 const PylithScalar powerLawRefStress) {
+        const PylithReal key[EffectiveStressCache::numParams] = {
+            j2InitialGuess, stressScale, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate, powerLawRefStress,
+        };
+        EffectiveStressCache::Entry& entry = EffectiveStressCache::lookup(key);
+        if (entry.valid && (0 == memcmp(entry.key, key, sizeof(key)))) {
+            return entry.effStress;
+        } // if
+
+        const PylithReal effStress = _effectiveStressSolve(j2InitialGuess, stressScale, ae, b, c, d, dt, j2T,
+                                                           powerLawExponent, powerLawRefStrainRate, powerLawRefStress);
+        memcpy(entry.key, key, sizeof(key));
+        entry.effStress = effStress;
+        entry.valid = true;
+
+        return effStress;
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /// Direct-mapped cache of effective stress roots keyed by the parameters of the root-finding problem.
+    struct EffectiveStressCache {
+        static const size_t numParams = 11;
+        static const size_t numEntries = 4096; // Power of 2.
+
+        struct Entry {
+            PylithReal key[numParams];
+            PylithReal effStress;
+            bool valid;
+        };
+
+        /** Get cache entry for parameters.
+         *
+         * @param[in] key Parameters of root-finding problem.
+         * @returns Cache entry for parameters (may hold a different key).
+         */
+        static inline
+        Entry& lookup(const PylithReal key[numParams]) {
+            static Entry entries[numEntries]; // Zero-initialized, so all entries start invalid.
+
+            // FNV-1a hash of the bits of the parameters.
+            uint64_t hash = 14695981039346656037ULL;
+            for (size_t i = 0; i < numParams; ++i) {
+                uint64_t bits = 0;
+                memcpy(&bits, &key[i], sizeof(PylithReal) < sizeof(bits) ? sizeof(PylithReal) : sizeof(bits));
+                hash ^= bits;
+                hash *= 1099511628211ULL;
+            } // for
+            hash ^= hash >> 32;
+
+            return entries[hash & (numEntries-1)];
+        } // lookup
+
+    }; // EffectiveStressCache
+
+    // --------------------------------------------------------------------------------------------
+    /** Solve for effective stress for power-law material without using the cache.
+     *
+     * See _effectiveStress() for the algorithm.
+     */
+    static inline
+    PylithReal _effectiveStressSolve(const PylithScalar j2InitialGuess,
+                                const PylithScalar stressScale,
+                                const PylithScalar ae,
+                                const PylithScalar b,
+                                const PylithScalar c,
+                                const PylithScalar d,
+                                const PylithScalar dt,
+                                const PylithScalar j2T,
+                                const PylithScalar powerLawExponent,
+                                const PylithScalar powerLawRefStrainRate,
+                                const PylithScalar powerLawRefStress) {
         assert(j2InitialGuess >= 0.0);
-        // If initial guess is too low, use stress scale instead.
+        // If initial guess is too low, use elastic trial effective stress or stress scale instead.
         const PylithReal xMin = 1.0e-10;
 
+        PylithReal effStress = j2InitialGuess;
+        if (j2InitialGuess <= xMin) {
+            effStress = (b > 0.0) ? sqrt(b) / ae : stressScale;
+        } // if
+        if (_newton(&effStress, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate, powerLawRefStress)) {
+            return effStress;
+        } // if
+
         // Bracket the root.
         PylithReal xL = 0.0;
         PylithReal xR = 0.0;
@@ -653,12 +766,86 @@ private:
                  powerLawRefStress);
 
         // Find effective stress using Newton's method with bisection.
-        PylithReal effStress = _search(xL, xR, ae, b, c, d, dt, j2T, powerLawExponent,
-                                       powerLawRefStrainRate, powerLawRefStress);
+        effStress = _search(xL, xR, ae, b, c, d, dt, j2T, powerLawExponent,
+                            powerLawRefStrainRate, powerLawRefStress);
 
         return effStress;
     }
 
+    // --------------------------------------------------------------------------------------------
+    /** Find zero of effective stress function using safeguarded Newton's method with a small number of iterations.
+     *
+     * We keep the most recent iterates with negative and positive function values. Once they bracket the root, every
+     * iterate lies inside the bracket, so the bracket shrinks, and a Newton step that would leave the bracket is
+     * replaced by bisection. Before that, iterates are kept nonnegative by halving the current value when a Newton
+     * step would make it negative. Convergence requires a small Newton step relative to the effective stress; the
+     * effective stress function has units of strain squared, so an absolute tolerance on its value would depend on
+     * the magnitude of the strains and the nondimensionalization.
+     *
+     * @param[inout] px Initial guess on input, effective stress on output if converged.
+     * @returns True if converged, false otherwise.
+     */
+    static inline
+    bool _newton(PylithReal* px,
+                 const PylithReal ae,
+                 const PylithReal b,
+                 const PylithReal c,
+                 const PylithReal d,
+                 const PylithReal dt,
+                 const PylithReal j2T,
+                 const PylithReal powerLawExponent,
+                 const PylithReal powerLawRefStrainRate,
+                 const PylithReal powerLawRefStress) {
+        assert(px);
+        const size_t maxIterations = 12;
+
+        // Relative accuracy in the effective stress.
+        const PylithReal relAccuracy = 1.0e-14;
+
+        PylithReal x = *px;
+        PylithReal xNeg = -1.0; // Most recent iterate with negative function value (-1 if none).
+        PylithReal xPos = -1.0; // Most recent iterate with positive function value (-1 if none).
+        PylithReal funcValue = 0.0;
+        PylithReal funcDeriv = 0.0;
+        for (size_t i = 0; i < maxIterations; ++i) {
+            _effectiveStressFnDerivative(&funcValue, &funcDeriv, x, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate, powerLawRefStress);
+            if (fabs(funcValue) <= relAccuracy * fabs(funcDeriv) * x) {
+                *px = x;
+                return true;
+            } // if
+            if (funcValue < 0.0) {
+                xNeg = x;
+            } else {
+                xPos = x;
+            } // if/else
+            const bool isBracketed = (xNeg >= 0.0) && (xPos >= 0.0);
+
+            PylithReal xNew = x;
+            if ((0.0 != funcDeriv) && std::isfinite(funcValue / funcDeriv)) {
+                xNew = x - funcValue / funcDeriv;
+            } else if (!isBracketed) {
+                return false;
+            } // if/else
+            if (isBracketed) {
+                const PylithReal xLower = std::min(xNeg, xPos);
+                const PylithReal xUpper = std::max(xNeg, xPos);
+                if ((xNew <= xLower) || (xNew >= xUpper) || (xNew == x)) {
+                    xNew = 0.5 * (xLower + xUpper);
+                } // if
+            } else if (xNew < 0.0) {
+                xNew = 0.5 * x;
+            } // if/else
+            const PylithReal dx = xNew - x;
+            x = xNew;
+            if (fabs(dx) <= relAccuracy * x) {
+                *px = x;
+                return true;
+            } // if
+        } // for
+
+        return false;
+    }
+
     // --------------------------------------------------------------------------------------------
     /** Calculate effective stress function for a power-law viscoelastic material.
      *
@@ -678,8 +865,7 @@ private:
                                     const PylithReal powerLawRefStress) {
         const PylithReal factor1 = 1.0 - powerLawAlpha;
         const PylithReal j2Tau = factor1 * j2T + powerLawAlpha * j2Tpdt;
-        const PylithReal gammaTau = powerLawRefStrainRate * pow((j2Tau / powerLawRefStress), (powerLawExponent - 1.0)) /
-                                    powerLawRefStress;
+        const PylithReal gammaTau = computeGammaTau(j2Tau, powerLawExponent, powerLawRefStrainRate, powerLawRefStress);
         const PylithReal a = ae + powerLawAlpha * dt * gammaTau;
         const PylithReal y = a * a * j2Tpdt * j2Tpdt - b + c * gammaTau - d * d * gammaTau * gammaTau;
 
@@ -689,7 +875,8 @@ private:
     // --------------------------------------------------------------------------------------------
     /** Calculate effective stress function and its derivative for a power-law viscoelastic material.
      *
-     * Used for root-finding.
+     * Used for root-finding. The derivative of gamma is computed from gamma, d(gammaTau)/d(j2Tpdt) =
+     * alpha*(n-1)*gammaTau/j2Tau, so only one transcendental function evaluation is needed.
      *
      */
     static inline
@@ -710,8 +897,10 @@ private:
 
         const PylithReal factor1 = 1.0 - powerLawAlpha;
         const PylithReal j2Tau = factor1 * j2T + powerLawAlpha * j2Tpdt;
-        const PylithReal gammaTau = powerLawRefStrainRate * pow((j2Tau / powerLawRefStress), (powerLawExponent - 1.0)) / powerLawRefStress;
-        const PylithReal dGammaTau = powerLawRefStrainRate * powerLawAlpha * (powerLawExponent - 1.0) * pow((j2Tau / powerLawRefStress), (powerLawExponent - 2.0)) / (powerLawRefStress * powerLawRefStress);
+        const PylithReal gammaTau = computeGammaTau(j2Tau, powerLawExponent, powerLawRefStrainRate, powerLawRefStress);
+        const PylithReal dGammaTau = (j2Tau > 0.0) ?
+                                     powerLawAlpha * (powerLawExponent - 1.0) * gammaTau / j2Tau :
+                                     powerLawRefStrainRate * powerLawAlpha * (powerLawExponent - 1.0) * pow((j2Tau / powerLawRefStress), (powerLawExponent - 2.0)) / (powerLawRefStress * powerLawRefStress);
         const PylithReal a = ae + powerLawAlpha * dt * gammaTau;
         y = a * a * j2Tpdt * j2Tpdt - b + c * gammaTau - d * d * gammaTau * gammaTau;
         dy = 2.0 * a * a * j2Tpdt + dGammaTau * (2.0 * a * powerLawAlpha * dt * j2Tpdt * j2Tpdt + c - 2.0 * d * d * gammaTau);
@@ -757,12 +946,13 @@ private:
                 break;
             } // if
 
-            if (fabs(funcValue1) < fabs(funcValue2)) {
+            // Expand away from the other bound; once the lower bound reaches the minimum, only expand the upper bound.
+            if ((fabs(funcValue1) < fabs(funcValue2)) && (x1 > xMin)) {
                 x1 += bracketFactor * (x1 - x2);
                 x1 = std::max(x1, xMin);
                 funcValue1 = _effectiveStressFn(x1, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate, powerLawRefStress);
             } else {
-                x2 += bracketFactor * (x1 - x2);
+                x2 += bracketFactor * (x2 - x1);
                 x2 = std::max(x2, xMin);
                 funcValue2 = _effectiveStressFn(x2, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate, powerLawRefStress);
             } // else
@@ -796,8 +986,8 @@ private:
                        const PylithReal powerLawRefStress) {
         const size_t maxIterations = 100;
 
-        // Desired accuracy for root. This is a bit arbitrary for now.
-        const PylithReal accuracy = 1.0e-16;
+        // Relative accuracy in the effective stress (same as _newton()).
+        const PylithReal relAccuracy = 1.0e-14;
 
         // Organize search so that _effectiveStressFn(xLow) is less than zero.
         PylithReal funcValueLow = _effectiveStressFn(x1, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate, powerLawRefStress);
@@ -829,7 +1019,7 @@ private:
         for (size_t i = 0; i < maxIterations; ++i) {
             funcXHigh = (effStress - xHigh) * funcDeriv - funcValue;
             funcXLow = (effStress - xLow) * funcDeriv - funcValue;
-            if (fabs(funcValue) < accuracy) {
+            if (fabs(funcValue) <= relAccuracy * fabs(funcDeriv) * effStress) {
                 converged = true;
                 break;
             } // if
@@ -862,6 +1052,8 @@ private:
 // ------------------------------------------------------------------------------------------------
 /// Kernels for isotropic power-law plane strain.
 class pylith::fekernels::IsotropicPowerLawPlaneStrain {
+    friend class TestIsotropicPowerLawKernels; // unit testing
+
     // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -1646,7 +1838,9 @@ private:
         const pylith::fekernels::Tensor& devStressT = context.devStress;
 
         const PylithReal j2Tau = powerLawAlpha * j2Tpdt + (1.0 - powerLawAlpha) * j2T;
-        const PylithReal gammaTau = powerLawRefStrainRate * pow((j2Tau / powerLawRefStress), (powerLawExponent - 1.0)) / powerLawRefStress;
+        const PylithReal gammaTau = pylith::fekernels::IsotropicPowerLaw::computeGammaTau(j2Tau, powerLawExponent,
+                                                                                          powerLawRefStrainRate,
+                                                                                          powerLawRefStress);
 
         const PylithReal bulkModulus = context.bulkModulus;
         const PylithReal shearModulus = context.shearModulus;
@@ -1667,17 +1861,20 @@ private:
             const PylithReal factor3 = powerLawAlpha * factor2;
             const PylithReal factor4 = factor2 * (1.0 - powerLawAlpha);
 
+            // Reciprocal of viscoelastic compliance for each stress component, each shared by several entries.
+            const PylithReal complianceInvXX = 1.0 / (factor3 * devStressTpdt.xx * devStressTpdt.xx + factor1 +
+                                                      factor4 * devStressTpdt.xx * devStressT.xx + ae);
+            const PylithReal complianceInvYY = 1.0 / (factor3 * devStressTpdt.yy * devStressTpdt.yy + factor1 +
+                                                      factor4 * devStressTpdt.yy * devStressT.yy + ae);
+            const PylithReal complianceInvXY = 1.0 / (factor3 * devStressTpdt.xy * devStressTpdt.xy + factor1 +
+                                                      factor4 * devStressTpdt.xy * devStressT.xy + ae);
+
             /* Unique components of Jacobian. */
-            elasticityMat->C1111 = bulkModulus + 2 / (3 * (factor3 * devStressTpdt.xx * devStressTpdt.xx + factor1 +
-                                                           factor4 * devStressTpdt.xx * devStressT.xx + ae));
-            elasticityMat->C1122 = bulkModulus - 1 / (3 * (factor3 * devStressTpdt.xx * devStressTpdt.xx + factor1 +
-                                                           factor4 * devStressTpdt.xx * devStressT.xx + ae));
-            elasticityMat->C1212 = 1 / (2 * (factor3 * devStressTpdt.xy * devStressTpdt.xy + factor1 +
-                                             factor4 * devStressTpdt.xy * devStressT.xy + ae));
-            elasticityMat->C2211 = bulkModulus - 1 / (3 * (factor3 * devStressTpdt.yy * devStressTpdt.yy + factor1 +
-                                                           factor4 * devStressTpdt.yy * devStressT.yy + ae));
-            elasticityMat->C2222 = bulkModulus + 2 / (3 * (factor3 * devStressTpdt.yy * devStressTpdt.yy + factor1 +
-                                                           factor4 * devStressTpdt.yy * devStressT.yy + ae));
+            elasticityMat->C1111 = bulkModulus + complianceInvXX * 2.0 / 3.0;
+            elasticityMat->C1122 = bulkModulus - complianceInvXX / 3.0;
+            elasticityMat->C1212 = 0.5 * complianceInvXY;
+            elasticityMat->C2211 = bulkModulus - complianceInvYY / 3.0;
+            elasticityMat->C2222 = bulkModulus + complianceInvYY * 2.0 / 3.0;
         } // if
 
     }
@@ -1687,6 +1884,8 @@ private:
 // ------------------------------------------------------------------------------------------------
 /// Kernels for 3D isotropic power-law viscoelasticity.
 class pylith::fekernels::IsotropicPowerLaw3D {
+    friend class TestIsotropicPowerLawKernels; // unit testing
+
     // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -2586,7 +2785,9 @@ private:
         const pylith::fekernels::Tensor& devStressT = context.devStress;
 
         const PylithReal j2Tau = powerLawAlpha * j2Tpdt + (1.0 - powerLawAlpha) * j2T;
-        const PylithReal gammaTau = powerLawRefStrainRate * pow((j2Tau / powerLawRefStress), (powerLawExponent - 1.0)) / powerLawRefStress;
+        const PylithReal gammaTau = pylith::fekernels::IsotropicPowerLaw::computeGammaTau(j2Tau, powerLawExponent,
+                                                                                          powerLawRefStrainRate,
+                                                                                          powerLawRefStress);
 
         const PylithReal bulkModulus = context.bulkModulus;
         const PylithReal shearModulus = context.shearModulus;
@@ -2611,25 +2812,30 @@ private:
             const PylithReal factor3 = powerLawAlpha * factor2;
             const PylithReal factor4 = factor2 * (1.0 - powerLawAlpha);
 
+            // Reciprocal of viscoelastic compliance for each stress component, each shared by several entries.
+            const PylithReal complianceInvXX = 1.0 / (factor3 * devStressTpdt.xx * devStressTpdt.xx + factor1 +
+                                                      factor4 * devStressTpdt.xx * devStressT.xx + ae);
+            const PylithReal complianceInvYY = 1.0 / (factor3 * devStressTpdt.yy * devStressTpdt.yy + factor1 +
+                                                      factor4 * devStressTpdt.yy * devStressT.yy + ae);
+            const PylithReal complianceInvZZ = 1.0 / (factor3 * devStressTpdt.zz * devStressTpdt.zz + factor1 +
+                                                      factor4 * devStressTpdt.zz * devStressT.zz + ae);
+            const PylithReal complianceInvXY = 1.0 / (factor3 * devStressTpdt.xy * devStressTpdt.xy + factor1 +
+                                                      factor4 * devStressTpdt.xy * devStressT.xy + ae);
+            const PylithReal complianceInvYZ = 1.0 / (factor3 * devStressTpdt.yz * devStressTpdt.yz + factor1 +
+                                                      factor4 * devStressTpdt.yz * devStressT.yz + ae);
+            const PylithReal complianceInvXZ = 1.0 / (factor3 * devStressTpdt.xz * devStressTpdt.xz + factor1 +
+                                                      factor4 * devStressTpdt.xz * devStressT.xz + ae);
+
             /* Unique components of Jacobian. */
-            elasticityMat->C1111 = bulkModulus + 2 / (3 * (factor3 * devStressTpdt.xx * devStressTpdt.xx + factor1 +
-                                                           factor4 * devStressTpdt.xx * devStressT.xx + ae));
-            elasticityMat->C1122 = bulkModulus - 1 / (3 * (factor3 * devStressTpdt.xx * devStressTpdt.xx + factor1 +
-                                                           factor4 * devStressTpdt.xx * devStressT.xx + ae));
-            elasticityMat->C1212 = 1 / (2 * (factor3 * devStressTpdt.xy * devStressTpdt.xy + factor1 +
-                                             factor4 * devStressTpdt.xy * devStressT.xy + ae));
-            elasticityMat->C1313 = 1 / (2 * (factor3 * devStressTpdt.xz * devStressTpdt.xz + factor1 +
-                                             factor4 * devStressTpdt.xz * devStressT.xz + ae));
-            elasticityMat->C2211 = bulkModulus - 1 / (3 * (factor3 * devStressTpdt.yy * devStressTpdt.yy + factor1 +
-                                                           factor4 * devStressTpdt.yy * devStressT.yy + ae));
-            elasticityMat->C2222 = bulkModulus + 2 / (3 * (factor3 * devStressTpdt.yy * devStressTpdt.yy + factor1 +
-                                                           factor4 * devStressTpdt.yy * devStressT.yy + ae));
-            elasticityMat->C2323 = 1 / (2 * (factor3 * devStressTpdt.yz * devStressTpdt.yz + factor1 +
-                                             factor4 * devStressTpdt.yz * devStressT.yz + ae));
-            elasticityMat->C3311 = bulkModulus - 1 / (3 * (factor3 * devStressTpdt.zz * devStressTpdt.zz + factor1 +
-                                                           factor4 * devStressTpdt.zz * devStressT.zz + ae));
-            elasticityMat->C3333 = bulkModulus + 2 / (3 * (factor3 * devStressTpdt.zz * devStressTpdt.zz + factor1 +
-                                                           factor4 * devStressTpdt.zz * devStressT.zz + ae));
+            elasticityMat->C1111 = bulkModulus + complianceInvXX * 2.0 / 3.0;
+            elasticityMat->C1122 = bulkModulus - complianceInvXX / 3.0;
+            elasticityMat->C1212 = 0.5 * complianceInvXY;
+            elasticityMat->C1313 = 0.5 * complianceInvXZ;
+            elasticityMat->C2211 = bulkModulus - complianceInvYY / 3.0;
+            elasticityMat->C2222 = bulkModulus + complianceInvYY * 2.0 / 3.0;
+            elasticityMat->C2323 = 0.5 * complianceInvYZ;
+            elasticityMat->C3311 = bulkModulus - complianceInvZZ / 3.0;
+            elasticityMat->C3333 = bulkModulus + complianceInvZZ * 2.0 / 3.0;
         } // if
     }
 
@@ -0,0 +1,54 @@
+/* -*- C++ -*-
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Brad T. Aagaard, U.S. Geological Survey
+ * Charles A. Williams, GNS Science
+ * Matthew G. Knepley, University at Buffalo
+ *
+ * This code was developed as part of the Computational Infrastructure
+ * for Geodynamics (http:*geodynamics.org).
+ *
+ * Copyright (c) 2010-2022 University of California, Davis
+ *
+ * See LICENSE.md for license information.
+ *
+ * ----------------------------------------------------------------------
+ */
+
+#include <portinfo>
+
+#include "pylith/fekernels/KernelMultiversion.hh" // Implementation of object methods.
+
+#include "pylith/fekernels/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity kernels
+#include "pylith/fekernels/IsotropicLinearMaxwell.hh" // USES IsotropicLinearMaxwell kernels
+#include "pylith/fekernels/IsotropicPowerLaw.hh" // USES IsotropicPowerLaw kernels
+#include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin kernels
+
+#include "pylith/utils/macrodefs.h" // USES PYLITH_KERNEL_MULTIVERSION
+
+// ------------------------------------------------------------------------------------------------
+// Define multiversioned kernel that calls the inline kernel.
+#define PYLITH_KERNEL_MULTIVERSION_DEFINE(kernelClass, kernelName, kernelType) \
+    PYLITH_KERNEL_MULTIVERSION \
+    void \
+    pylith::fekernels::KernelMultiversion::kernelClass::kernelName(PYLITH_KERNEL_PARAMS_ ## kernelType) { \
+        pylith::fekernels::kernelClass::kernelName(PYLITH_KERNEL_ARGS_ ## kernelType); \
+    }
+
+// ------------------------------------------------------------------------------------------------
+PYLITH_KERNELS_ISOTROPICLINEARELASTICITY(PYLITH_KERNEL_MULTIVERSION_DEFINE, IsotropicLinearElasticityPlaneStrain)
+PYLITH_KERNELS_ISOTROPICLINEARELASTICITY(PYLITH_KERNEL_MULTIVERSION_DEFINE, IsotropicLinearElasticity3D)
+
+// ------------------------------------------------------------------------------------------------
+PYLITH_KERNELS_ISOTROPICLINEARMAXWELL(PYLITH_KERNEL_MULTIVERSION_DEFINE, IsotropicLinearMaxwellPlaneStrain)
+PYLITH_KERNELS_ISOTROPICLINEARMAXWELL(PYLITH_KERNEL_MULTIVERSION_DEFINE, IsotropicLinearMaxwell3D)
+
+// ------------------------------------------------------------------------------------------------
+PYLITH_KERNELS_ISOTROPICPOWERLAW(PYLITH_KERNEL_MULTIVERSION_DEFINE, IsotropicPowerLawPlaneStrain)
+PYLITH_KERNELS_ISOTROPICPOWERLAW(PYLITH_KERNEL_MULTIVERSION_DEFINE, IsotropicPowerLaw3D)
+
+// ------------------------------------------------------------------------------------------------
+PYLITH_KERNELS_FAULTCOHESIVEKIN(PYLITH_KERNEL_MULTIVERSION_DEFINE, FaultCohesiveKin)
+
+// End of file
@@ -0,0 +1,179 @@
+/* -*- C++ -*-
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Brad T. Aagaard, U.S. Geological Survey
+ * Charles A. Williams, GNS Science
+ * Matthew G. Knepley, University at Buffalo
+ *
+ * This code was developed as part of the Computational Infrastructure
+ * for Geodynamics (http:*geodynamics.org).
+ *
+ * Copyright (c) 2010-2022 University of California, Davis
+ *
+ * See LICENSE.md for license information.
+ *
+ * ----------------------------------------------------------------------
+ */
+
+/** @file libsrc/fekernels/KernelMultiversion.hh
+ *
+ * Out-of-line copies of the hot pointwise kernels compiled for several instruction sets with the best one selected
+ * for the CPU when libpylith is loaded (function multiversioning via ifunc).
+ *
+ * The kernels in the other fekernels headers are static inline, so applying target_clones to them would create
+ * the ifunc resolvers in every object that uses them, including programs linked against libpylith. The clones are
+ * defined only in KernelMultiversion.cc, which is compiled into libpylith when PyLith is configured with
+ * --enable-kernel-multiversioning, so each clone has a single definition. Each clone calls the inline kernel, which
+ * is compiled for the instruction set of the clone.
+ *
+ * The kernels are listed once for each kernel class in the PYLITH_KERNELS_* lists below (X-macros). The lists
+ * generate both the declarations here and the definitions in KernelMultiversion.cc. To multiversion another kernel,
+ * add it to the list for its class.
+ *
+ * Use PYLITH_KERNELS(kernelClass) when registering kernels to select the clones if they are available and the
+ * inline kernels otherwise.
+ */
+
+#if !defined(pylith_fekernels_kernelmultiversion_hh)
+#define pylith_fekernels_kernelmultiversion_hh
+
+// Include directives ---------------------------------------------------
+#include "fekernelsfwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh"
+
+#if defined(PYLITH_USE_KERNEL_MULTIVERSIONING)
+#define PYLITH_KERNELS(kernelClass) pylith::fekernels::KernelMultiversion::kernelClass
+#else
+#define PYLITH_KERNELS(kernelClass) pylith::fekernels::kernelClass
+#endif
+
+// Parameters and arguments of the pointwise function types -------------
+// RESIDUAL: PetscPointFunc, JACOBIAN: PetscPointJac, BD_RESIDUAL: PetscBdPointFunc, BD_JACOBIAN: PetscBdPointJac.
+#define PYLITH_KERNEL_PARAMS_RESIDUAL \
+    const PylithInt dim, const PylithInt numS, const PylithInt numA, \
+    const PylithInt sOff[], const PylithInt sOff_x[], \
+    const PylithScalar s[], const PylithScalar s_t[], const PylithScalar s_x[], \
+    const PylithInt aOff[], const PylithInt aOff_x[], \
+    const PylithScalar a[], const PylithScalar a_t[], const PylithScalar a_x[], \
+    const PylithReal t, const PylithScalar x[], \
+    const PylithInt numConstants, const PylithScalar constants[], PylithScalar f[]
+#define PYLITH_KERNEL_ARGS_RESIDUAL \
+    dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x, t, x, numConstants, constants, f
+
+#define PYLITH_KERNEL_PARAMS_JACOBIAN \
+    const PylithInt dim, const PylithInt numS, const PylithInt numA, \
+    const PylithInt sOff[], const PylithInt sOff_x[], \
+    const PylithScalar s[], const PylithScalar s_t[], const PylithScalar s_x[], \
+    const PylithInt aOff[], const PylithInt aOff_x[], \
+    const PylithScalar a[], const PylithScalar a_t[], const PylithScalar a_x[], \
+    const PylithReal t, const PylithReal s_tshift, const PylithScalar x[], \
+    const PylithInt numConstants, const PylithScalar constants[], PylithScalar J[]
+#define PYLITH_KERNEL_ARGS_JACOBIAN \
+    dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x, t, s_tshift, x, numConstants, constants, J
+
+#define PYLITH_KERNEL_PARAMS_BD_RESIDUAL \
+    const PylithInt dim, const PylithInt numS, const PylithInt numA, \
+    const PylithInt sOff[], const PylithInt sOff_x[], \
+    const PylithScalar s[], const PylithScalar s_t[], const PylithScalar s_x[], \
+    const PylithInt aOff[], const PylithInt aOff_x[], \
+    const PylithScalar a[], const PylithScalar a_t[], const PylithScalar a_x[], \
+    const PylithReal t, const PylithScalar x[], const PylithReal n[], \
+    const PylithInt numConstants, const PylithScalar constants[], PylithScalar f[]
+#define PYLITH_KERNEL_ARGS_BD_RESIDUAL \
+    dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x, t, x, n, numConstants, constants, f
+
+#define PYLITH_KERNEL_PARAMS_BD_JACOBIAN \
+    const PylithInt dim, const PylithInt numS, const PylithInt numA, \
+    const PylithInt sOff[], const PylithInt sOff_x[], \
+    const PylithScalar s[], const PylithScalar s_t[], const PylithScalar s_x[], \
+    const PylithInt aOff[], const PylithInt aOff_x[], \
+    const PylithScalar a[], const PylithScalar a_t[], const PylithScalar a_x[], \
+    const PylithReal t, const PylithReal s_tshift, const PylithScalar x[], const PylithReal n[], \
+    const PylithInt numConstants, const PylithScalar constants[], PylithScalar J[]
+#define PYLITH_KERNEL_ARGS_BD_JACOBIAN \
+    dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x, t, s_tshift, x, n, numConstants, constants, J
+
+// Lists of multiversioned kernels --------------------------------------
+// Each entry is KERNEL(kernelClass, kernelName, kernelType) with kernelType one of the pointwise function types above.
+#define PYLITH_KERNELS_ISOTROPICLINEARELASTICITY(KERNEL, kernelClass) \
+    KERNEL(kernelClass, f1v_infinitesimalStrain, RESIDUAL) \
+    KERNEL(kernelClass, f1v_infinitesimalStrain_refState, RESIDUAL) \
+    KERNEL(kernelClass, Jf3vu_infinitesimalStrain, JACOBIAN)
+
+#define PYLITH_KERNELS_ISOTROPICLINEARMAXWELL(KERNEL, kernelClass) \
+    KERNEL(kernelClass, f1v_infinitesimalStrain, RESIDUAL) \
+    KERNEL(kernelClass, f1v_infinitesimalStrain_refState, RESIDUAL) \
+    KERNEL(kernelClass, Jf3vu_infinitesimalStrain, JACOBIAN)
+
+#define PYLITH_KERNELS_ISOTROPICPOWERLAW(KERNEL, kernelClass) \
+    KERNEL(kernelClass, f1v_infinitesimalStrain, RESIDUAL) \
+    KERNEL(kernelClass, f1v_infinitesimalStrain_refState, RESIDUAL) \
+    KERNEL(kernelClass, Jf3vu_infinitesimalStrain, JACOBIAN) \
+    KERNEL(kernelClass, Jf3vu_infinitesimalStrain_refState, JACOBIAN)
+
+#define PYLITH_KERNELS_FAULTCOHESIVEKIN(KERNEL, kernelClass) \
+    KERNEL(kernelClass, f0u_neg, BD_RESIDUAL) \
+    KERNEL(kernelClass, f0u_pos, BD_RESIDUAL) \
+    KERNEL(kernelClass, f0l_slip, BD_RESIDUAL) \
+    KERNEL(kernelClass, f0l_slipAcc, BD_RESIDUAL) \
+    KERNEL(kernelClass, Jf0ul_neg, BD_JACOBIAN) \
+    KERNEL(kernelClass, Jf0ul_pos, BD_JACOBIAN) \
+    KERNEL(kernelClass, Jf0lu, BD_JACOBIAN)
+
+/// Declare multiversioned kernel.
+#define PYLITH_KERNEL_MULTIVERSION_DECLARE(kernelClass, kernelName, kernelType) \
+    static void kernelName(PYLITH_KERNEL_PARAMS_ ## kernelType);
+
+class pylith::fekernels::KernelMultiversion {
+    // PUBLIC CLASSES /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Multiversioned kernels from pylith::fekernels::IsotropicLinearElasticityPlaneStrain.
+    class IsotropicLinearElasticityPlaneStrain {
+    public:
+        PYLITH_KERNELS_ISOTROPICLINEARELASTICITY(PYLITH_KERNEL_MULTIVERSION_DECLARE, IsotropicLinearElasticityPlaneStrain)
+    }; // IsotropicLinearElasticityPlaneStrain
+
+    /// Multiversioned kernels from pylith::fekernels::IsotropicLinearElasticity3D.
+    class IsotropicLinearElasticity3D {
+    public:
+        PYLITH_KERNELS_ISOTROPICLINEARELASTICITY(PYLITH_KERNEL_MULTIVERSION_DECLARE, IsotropicLinearElasticity3D)
+    }; // IsotropicLinearElasticity3D
+
+    /// Multiversioned kernels from pylith::fekernels::IsotropicLinearMaxwellPlaneStrain.
+    class IsotropicLinearMaxwellPlaneStrain {
+    public:
+        PYLITH_KERNELS_ISOTROPICLINEARMAXWELL(PYLITH_KERNEL_MULTIVERSION_DECLARE, IsotropicLinearMaxwellPlaneStrain)
+    }; // IsotropicLinearMaxwellPlaneStrain
+
+    /// Multiversioned kernels from pylith::fekernels::IsotropicLinearMaxwell3D.
+    class IsotropicLinearMaxwell3D {
+    public:
+        PYLITH_KERNELS_ISOTROPICLINEARMAXWELL(PYLITH_KERNEL_MULTIVERSION_DECLARE, IsotropicLinearMaxwell3D)
+    }; // IsotropicLinearMaxwell3D
+
+    /// Multiversioned kernels from pylith::fekernels::IsotropicPowerLawPlaneStrain.
+    class IsotropicPowerLawPlaneStrain {
+    public:
+        PYLITH_KERNELS_ISOTROPICPOWERLAW(PYLITH_KERNEL_MULTIVERSION_DECLARE, IsotropicPowerLawPlaneStrain)
+    }; // IsotropicPowerLawPlaneStrain
+
+    /// Multiversioned kernels from pylith::fekernels::IsotropicPowerLaw3D.
+    class IsotropicPowerLaw3D {
+    public:
+        PYLITH_KERNELS_ISOTROPICPOWERLAW(PYLITH_KERNEL_MULTIVERSION_DECLARE, IsotropicPowerLaw3D)
+    }; // IsotropicPowerLaw3D
+
+    /// Multiversioned kernels from pylith::fekernels::FaultCohesiveKin.
+    class FaultCohesiveKin {
+    public:
+        PYLITH_KERNELS_FAULTCOHESIVEKIN(PYLITH_KERNEL_MULTIVERSION_DECLARE, FaultCohesiveKin)
+    }; // FaultCohesiveKin
+
+}; // KernelMultiversion
+
+#endif // pylith_fekernels_kernelmultiversion_hh
+
+/* End of file */
@@ -259,6 +259,79 @@ private:
 
 }; // TensorOps
 
+// ------------------------------------------------------------------------------------------------
+/** Operations on small dense matrices with dimension known at compile time.
+ *
+ * Matrices are stored in row-major order (DIM*DIM values). The loops have compile-time trip counts, so the compiler
+ * unrolls them completely in optimized builds.
+ *
+ * @tparam DIM Spatial dimension.
+ */
+template<int DIM>
+class pylith::fekernels::TensorDim {
+    // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    static const PylithInt size = DIM*DIM; ///< Number of values in matrix.
+
+    /** Compute trace of matrix.
+     *
+     * @param[in] m Matrix.
+     * @returns Trace of matrix.
+     */
+    static inline
+    PylithReal trace(const PylithReal m[]) {
+        PylithReal value = 0.0;
+        for (PylithInt i = 0; i < DIM; ++i) {
+            value += m[i*DIM+i];
+        } // for
+        return value;
+    } // trace
+
+    /** Compute symmetric part of matrix, 0.5*(m + m^T).
+     *
+     * @param[in] m Matrix.
+     * @param[out] sym Symmetric part of matrix.
+     */
+    static inline
+    void symmetricPart(const PylithReal m[],
+                       PylithReal sym[]) {
+        for (PylithInt i = 0; i < DIM; ++i) {
+            for (PylithInt j = 0; j < DIM; ++j) {
+                sym[i*DIM+j] = 0.5*(m[i*DIM+j] + m[j*DIM+i]);
+            } // for
+        } // for
+    } // symmetricPart
+
+    /** Convert symmetric tensor stored as vector to matrix.
+     *
+     * The out-of-plane component (zz) of the 2D vector is not part of the matrix.
+     *
+     * @param[in] v Tensor as vector (2D: xx, yy, zz, xy; 3D: xx, yy, zz, xy, yz, xz).
+     * @param[out] m Matrix.
+     */
+    static inline
+    void fromVector(const PylithReal v[],
+                    PylithReal m[]) {
+        static const PylithInt indices2D[4] = { 0, 3, 3, 1 };
+        static const PylithInt indices3D[9] = { 0, 3, 5, 3, 1, 4, 5, 4, 2 };
+        for (PylithInt i = 0; i < size; ++i) {
+            m[i] = v[(3 == DIM) ? indices3D[i] : indices2D[i]];
+        } // for
+    } // fromVector
+
+    /** Compute trace of symmetric tensor stored as vector, including the out-of-plane component in 2D.
+     *
+     * @param[in] v Tensor as vector (2D: xx, yy, zz, xy; 3D: xx, yy, zz, xy, yz, xz).
+     * @returns Trace of tensor.
+     */
+    static inline
+    PylithReal traceVector(const PylithReal v[]) {
+        return v[0] + v[1] + v[2];
+    } // traceVector
+
+}; // TensorDim
+
 #endif // pylith_fekernels_tensor_hh
 
 // End of file
@@ -31,6 +31,7 @@ namespace pylith {
     namespace fekernels {
         class Tensor;
         class TensorOps;
+        template<int DIM> class TensorDim;
 
         class Solution;
         class DispVel;
@@ -38,10 +39,12 @@ namespace pylith {
         class Elasticity;
         class ElasticityPlaneStrain;
         class Elasticity3D;
+        template<int DIM> class ElasticityDim;
 
         class IsotropicLinearElasticity;
         class IsotropicLinearElasticityPlaneStrain;
         class IsotropicLinearElasticity3D;
+        template<int DIM> class IsotropicLinearElasticityDim;
 
         class IsotropicLinearMaxwell;
         class IsotropicLinearMaxwellPlaneStrain;
@@ -67,6 +70,8 @@ namespace pylith {
         class IsotropicLinearPoroelasticity;
         class IsotropicLinearPoroelasticityPlaneStrain;
         class IsotropicLinearPoroelasticity3D;
+        template<int DIM, bool TENSOR_PERMEABILITY, bool BODY_FORCE, bool GRAVITY, bool SOURCE_DENSITY>
+        class IsotropicLinearPoroelasticityFlow;
 
         class TimeDependentFn;
         class NeumannTimeDependent;
@@ -74,6 +79,8 @@ namespace pylith {
 
         class FaultCohesiveKin;
 
+        class KernelMultiversion;
+
         class BoundaryDirections;
     } // fekernels
 } // pylith
@@ -200,7 +200,6 @@ pylith::materials::Elasticity::createAuxiliaryField(const pylith::topology::Fiel
     auxiliaryField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
     auxiliaryField->allocate();
-    auxiliaryField->createOutputVector();
 
     assert(auxiliaryFactory);
     auxiliaryFactory->setValuesFromDB();
@@ -233,7 +232,6 @@ pylith::materials::Elasticity::createDerivedField(const pylith::topology::Field&
     derivedField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *derivedField);
     derivedField->allocate();
-    derivedField->createOutputVector();
 
     PYLITH_METHOD_RETURN(derivedField);
 } // createDerivedField
@@ -275,21 +273,21 @@ pylith::materials::Elasticity::getSolverDefaults(const bool isParallel,
                 options->add("-fieldsplit_displacement_pc_type", "lu");
                 options->add("-fieldsplit_lagrange_multiplier_fault_pc_type", "lu");
             } else {
-#if 1
-                options->add("-fieldsplit_displacement_pc_type", "ml");
-                options->add("-fieldsplit_lagrange_multiplier_fault_pc_type", "ml");
-#else
                 options->add("-fieldsplit_displacement_pc_type", "gamg");
                 options->add("-fieldsplit_displacement_mg_levels_pc_type", "sor");
                 options->add("-fieldsplit_displacement_mg_levels_ksp_type", "richardson");
                 options->add("-fieldsplit_lagrange_multiplier_fault_pc_type", "gamg");
                 options->add("-fieldsplit_lagrange_multiplier_fault_mg_levels_pc_type", "sor");
                 options->add("-fieldsplit_lagrange_multiplier_fault_mg_levels_ksp_type", "richardson");
-#endif
             } // if/else
         } // if/else
         break;
     case pylith::problems::Physics::DYNAMIC:
+        // Explicit, third-order strong stability preserving Runge-Kutta; the lumped LHS Jacobian inverse is
+        // reused across stages and time steps, so each stage is a residual evaluation.
+        options->add("-ts_type", "ssp");
+        options->add("-ts_ssp_type", "rks3");
+        options->add("-ts_ssp_nstages", "4");
         break;
     case pylith::problems::Physics::DYNAMIC_IMEX:
         break;
@@ -449,7 +447,7 @@ pylith::materials::Elasticity::_setKernelsResidual(pylith::feassemble::Integrato
     std::vector<ResidualKernels> kernels;
     switch (_formulation) {
     case QUASISTATIC: {
-        const PetscPointFunc f0u = r0;
+        const PetscPointFunc f0u = NULL;
         const PetscPointFunc f1u = r1;
 
         kernels.resize(1);
@@ -466,7 +464,7 @@ pylith::materials::Elasticity::_setKernelsResidual(pylith::feassemble::Integrato
         // Velocity
         const PetscPointFunc f0v = pylith::fekernels::Elasticity::f0v;
         const PetscPointFunc f1v = NULL;
-        const PetscPointFunc g0v = r0;
+        const PetscPointFunc g0v = NULL;
         const PetscPointFunc g1v = r1;
 
         kernels.resize(4);
@@ -486,7 +484,7 @@ pylith::materials::Elasticity::_setKernelsResidual(pylith::feassemble::Integrato
         // Velocity
         const PetscPointFunc f0v = pylith::fekernels::DispVel::f0v;
         const PetscPointFunc f1v = NULL;
-        const PetscPointFunc g0v = r0;
+        const PetscPointFunc g0v = NULL;
         const PetscPointFunc g1v = r1;
 
         kernels.resize(4);
@@ -500,11 +498,21 @@ pylith::materials::Elasticity::_setKernelsResidual(pylith::feassemble::Integrato
         PYLITH_COMPONENT_LOGICERROR("Unknown formulation for equations (" << _formulation << ").");
     } // switch
 
+    // Body force and gravity terms depend only on the auxiliary field, so they are integrated once and cached.
+    if (r0) {
+        if (QUASISTATIC == _formulation) {
+            kernels.push_back(ResidualKernels("displacement", pylith::feassemble::Integrator::LHS_CONSTANT, r0, NULL));
+        } else {
+            kernels.push_back(ResidualKernels("velocity", pylith::feassemble::Integrator::RHS_CONSTANT, r0, NULL));
+        } // if/else
+    } // if
+
     // Add any MMS body force kernels.
     kernels.insert(kernels.end(), _mmsBodyForceKernels.begin(), _mmsBodyForceKernels.end());
 
     assert(integrator);
     integrator->setKernelsResidual(kernels, solution);
+    integrator->setTimeDependentLHSResidual(!_mmsBodyForceKernels.empty()); // MMS body forces may depend on time.
 
     PYLITH_METHOD_END;
 } // _setKernelsResidual
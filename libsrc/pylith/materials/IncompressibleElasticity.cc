@@ -39,6 +39,7 @@
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <sstream> // USES std::ostringstream
 #include <typeinfo> // USES typeid()
 
 // ------------------------------------------------------------------------------------------------
@@ -51,6 +52,8 @@ typedef pylith::feassemble::Integrator::EquationPart EquationPart;
 // Default constructor.
 pylith::materials::IncompressibleElasticity::IncompressibleElasticity(void) :
     _useBodyForce(false),
+    _useStaticCondensation(false),
+    _usePressureMassPreconditioner(false),
     _rheology(NULL),
     _derivedFactory(new pylith::materials::DerivedFactoryElasticity) {
     pylith::utils::PyreComponent::setName("incompressibleelasticity");
@@ -93,6 +96,42 @@ pylith::materials::IncompressibleElasticity::useBodyForce(void) const {
 } // useBodyForce
 
 
+// ------------------------------------------------------------------------------------------------
+// Eliminate pressure in each cell (static condensation)?
+void
+pylith::materials::IncompressibleElasticity::useStaticCondensation(const bool value) {
+    PYLITH_COMPONENT_DEBUG("useStaticCondensation(value="<<value<<")");
+
+    _useStaticCondensation = value;
+} // useStaticCondensation
+
+
+// ------------------------------------------------------------------------------------------------
+// Eliminate pressure in each cell (static condensation)?
+bool
+pylith::materials::IncompressibleElasticity::useStaticCondensation(void) const {
+    return _useStaticCondensation;
+} // useStaticCondensation
+
+
+// ------------------------------------------------------------------------------------------------
+// Use pressure mass matrix preconditioner?
+void
+pylith::materials::IncompressibleElasticity::usePressureMassPreconditioner(const bool value) {
+    PYLITH_COMPONENT_DEBUG("usePressureMassPreconditioner(value="<<value<<")");
+
+    _usePressureMassPreconditioner = value;
+} // usePressureMassPreconditioner
+
+
+// ------------------------------------------------------------------------------------------------
+// Use pressure mass matrix preconditioner?
+bool
+pylith::materials::IncompressibleElasticity::usePressureMassPreconditioner(void) const {
+    return _usePressureMassPreconditioner;
+} // usePressureMassPreconditioner
+
+
 // ------------------------------------------------------------------------------------------------
 // Set bulk rheology.
 void
@@ -126,6 +165,40 @@ pylith::materials::IncompressibleElasticity::verifyConfiguration(const pylith::t
         throw std::runtime_error("Cannot find 'pressure' field in solution; required for material 'IncompressibleElasticity'.");
     } // if
 
+    if (_useStaticCondensation) {
+        if (pylith::problems::Physics::QUASISTATIC != _formulation) {
+            std::ostringstream msg;
+            msg << "Static condensation of pressure in material '" << getIdentifier()
+                << "' requires the quasistatic formulation.";
+            throw std::runtime_error(msg.str());
+        } // if
+        // The pressure block of the Jacobian is diagonal only for a piecewise constant, discontinuous pressure, so
+        // that eliminating the pressure in each cell is exact.
+        const pylith::topology::FieldBase::Discretization& fe = solution.getSubfieldInfo("pressure").fe;
+        if ((0 != fe.basisOrder) || fe.isBasisContinuous) {
+            std::ostringstream msg;
+            msg << "Static condensation of pressure in material '" << getIdentifier()
+                << "' requires a discontinuous pressure subfield with basis order 0. Current pressure subfield has basis order "
+                << fe.basisOrder << " and is " << (fe.isBasisContinuous ? "continuous" : "discontinuous") << ".";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
+    if (_usePressureMassPreconditioner) {
+        if (pylith::problems::Physics::QUASISTATIC != _formulation) {
+            std::ostringstream msg;
+            msg << "Pressure mass matrix preconditioner in material '" << getIdentifier()
+                << "' requires the quasistatic formulation.";
+            throw std::runtime_error(msg.str());
+        } // if
+        if (_useStaticCondensation) {
+            std::ostringstream msg;
+            msg << "Pressure mass matrix preconditioner in material '" << getIdentifier()
+                << "' cannot be combined with static condensation of pressure.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
     PYLITH_METHOD_END;
 } // verifyConfiguration
 
@@ -188,7 +261,6 @@ pylith::materials::IncompressibleElasticity::createAuxiliaryField(const pylith::
     auxiliaryField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
     auxiliaryField->allocate();
-    auxiliaryField->createOutputVector();
 
     assert(auxiliaryFactory);
     auxiliaryFactory->setValuesFromDB();
@@ -221,7 +293,6 @@ pylith::materials::IncompressibleElasticity::createDerivedField(const pylith::to
     derivedField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *derivedField);
     derivedField->allocate();
-    derivedField->createOutputVector();
 
     PYLITH_METHOD_RETURN(derivedField);
 } // createDerivedField
@@ -241,7 +312,48 @@ pylith::materials::IncompressibleElasticity::getSolverDefaults(const bool isPara
     case pylith::problems::Physics::QUASISTATIC:
         options->add("-ts_type", "beuler");
 
-        if (!hasFault) {
+        if (_useStaticCondensation) {
+            if (hasFault) {
+                std::ostringstream msg;
+                msg << "Static condensation of pressure in material '" << getIdentifier()
+                    << "' is not supported in problems with faults.";
+                throw std::runtime_error(msg.str());
+            } // if
+            // Pressure (field 1) is the first split, so the Schur complement is the displacement system with the
+            // pressure eliminated. The pressure block is diagonal, so its inverse and the Schur complement
+            // preconditioner (selfp) are exact.
+            options->add("-pc_type", "fieldsplit");
+            options->add("-pc_fieldsplit_type", "schur");
+            options->add("-pc_fieldsplit_0_fields", "1");
+            options->add("-pc_fieldsplit_1_fields", "0");
+            options->add("-pc_fieldsplit_schur_factorization_type", "full");
+            options->add("-pc_fieldsplit_schur_precondition", "selfp");
+            options->add("-fieldsplit_0_ksp_type", "preonly");
+            options->add("-fieldsplit_0_pc_type", "jacobi");
+            if (!isParallel) {
+                options->add("-fieldsplit_1_pc_type", "lu");
+            } else {
+                options->add("-fieldsplit_1_pc_type", "gamg");
+                options->add("-fieldsplit_1_mg_levels_pc_type", "sor");
+                options->add("-fieldsplit_1_mg_levels_ksp_type", "richardson");
+            } // if/else
+        } else if (_usePressureMassPreconditioner && !hasFault) {
+            // The pressure block of the preconditioner matrix is the weighted pressure mass matrix, which is
+            // spectrally equivalent to the Schur complement, so it preconditions the Schur complement (a11).
+            options->add("-pc_type", "fieldsplit");
+            options->add("-pc_fieldsplit_type", "schur");
+            options->add("-pc_fieldsplit_schur_factorization_type", "full");
+            options->add("-pc_fieldsplit_schur_precondition", "a11");
+            options->add("-fieldsplit_pressure_ksp_type", "preonly");
+            options->add("-fieldsplit_pressure_pc_type", "jacobi");
+            if (!isParallel) {
+                options->add("-fieldsplit_displacement_pc_type", "lu");
+            } else {
+                options->add("-fieldsplit_displacement_pc_type", "gamg");
+                options->add("-fieldsplit_displacement_mg_levels_pc_type", "sor");
+                options->add("-fieldsplit_displacement_mg_levels_ksp_type", "richardson");
+            } // if/else
+        } else if (!hasFault) {
             options->add("-pc_type", "fieldsplit");
             options->add("-pc_fieldsplit_type", "schur");
             options->add("-pc_fieldsplit_schur_factorization_type", "full");
@@ -250,13 +362,9 @@ pylith::materials::IncompressibleElasticity::getSolverDefaults(const bool isPara
                 options->add("-fieldsplit_displacement_pc_type", "lu");
                 options->add("-fieldsplit_pressure_pc_type", "lu");
             } else {
-#if 1
-                options->add("-fieldsplit_displacement_pc_type", "ml");
-#else
                 options->add("-fieldsplit_displacement_pc_type", "gamg");
                 options->add("-fieldsplit_displacement_mg_levels_pc_type", "sor");
                 options->add("-fieldsplit_displacement_mg_levels_ksp_type", "richardson");
-#endif
                 options->add("-fieldsplit_pressure_pc_type", "bjacobi");
             } // if/else
         } // if/else
@@ -331,7 +439,7 @@ pylith::materials::IncompressibleElasticity::_setKernelsResidual(pylith::feassem
     } // switch
 
     // Displacement
-    const PetscPointFunc f0u = r0;
+    const PetscPointFunc f0u = NULL;
     const PetscPointFunc f1u = _rheology->getKernelf1u(coordsys);
 
     // Pressure
@@ -342,11 +450,17 @@ pylith::materials::IncompressibleElasticity::_setKernelsResidual(pylith::feassem
     kernels[0] = ResidualKernels("displacement", pylith::feassemble::Integrator::LHS, f0u, f1u);
     kernels[1] = ResidualKernels("pressure", pylith::feassemble::Integrator::LHS, f0p, f1p);
 
+    // Body force and gravity terms depend only on the auxiliary field, so they are integrated once and cached.
+    if (r0) {
+        kernels.push_back(ResidualKernels("displacement", pylith::feassemble::Integrator::LHS_CONSTANT, r0, NULL));
+    } // if
+
     // Add any MMS body force kernels.
     kernels.insert(kernels.end(), _mmsBodyForceKernels.begin(), _mmsBodyForceKernels.end());
 
     assert(integrator);
     integrator->setKernelsResidual(kernels, solution);
+    integrator->setTimeDependentLHSResidual(!_mmsBodyForceKernels.empty()); // MMS body forces may depend on time.
 
     PYLITH_METHOD_END;
 } // _setKernelsResidual
@@ -390,6 +504,17 @@ pylith::materials::IncompressibleElasticity::_setKernelsJacobian(pylith::feassem
     kernels[2] = JacobianKernels("pressure", "displacement", equationPart, Jf0pu, Jf1pu, Jf2pu, Jf3pu);
     kernels[3] = JacobianKernels("pressure", "pressure", equationPart, Jf0pp, Jf1pp, Jf2pp, Jf3pp);
 
+    if (_usePressureMassPreconditioner) {
+        // Preconditioner matches the Jacobian except for the pressure block, which approximates the Schur complement
+        // with the pressure mass matrix weighted by 1/shear_modulus + 1/bulk_modulus.
+        const EquationPart precondPart = pylith::feassemble::Integrator::LHS_PRECONDITIONER;
+        const PetscPointJac Jf0ppSchur = _rheology->getKernelJf0ppSchur(coordsys);
+        kernels.push_back(JacobianKernels("displacement", "displacement", precondPart, Jf0uu, Jf1uu, Jf2uu, Jf3uu));
+        kernels.push_back(JacobianKernels("displacement", "pressure", precondPart, Jf0up, Jf1up, Jf2up, Jf3up));
+        kernels.push_back(JacobianKernels("pressure", "displacement", precondPart, Jf0pu, Jf1pu, Jf2pu, Jf3pu));
+        kernels.push_back(JacobianKernels("pressure", "pressure", precondPart, Jf0ppSchur, Jf1pp, Jf2pp, Jf3pp));
+    } // if
+
     assert(integrator);
     integrator->setKernelsJacobian(kernels, solution);
 
@@ -55,6 +55,38 @@ public:
      */
     bool useBodyForce(void) const;
 
+    /** Eliminate pressure in each cell (static condensation)?
+     *
+     * Requires a discontinuous pressure subfield with basis order 0. The default solver options use a Schur
+     * complement field split with the pressure block first, so the Schur complement is the condensed displacement
+     * system.
+     *
+     * @param[in] value Flag indicating to eliminate pressure in each cell.
+     */
+    void useStaticCondensation(const bool value);
+
+    /** Eliminate pressure in each cell (static condensation)?
+     *
+     * @returns True if eliminating pressure in each cell, false otherwise.
+     */
+    bool useStaticCondensation(void) const;
+
+    /** Use pressure mass matrix preconditioner?
+     *
+     * Adds preconditioner kernels equal to the Jacobian kernels except for the pressure block, which is the pressure
+     * mass matrix weighted by 1/shear_modulus + 1/bulk_modulus, an approximation of the Schur complement for the
+     * pressure. Only used with the quasistatic formulation.
+     *
+     * @param[in] value Flag indicating to use pressure mass matrix preconditioner.
+     */
+    void usePressureMassPreconditioner(const bool value);
+
+    /** Use pressure mass matrix preconditioner?
+     *
+     * @returns True if using pressure mass matrix preconditioner, false otherwise.
+     */
+    bool usePressureMassPreconditioner(void) const;
+
     /** Set bulk rheology.
      *
      * @param[in] rheology Bulk rheology for elasticity.
@@ -170,6 +202,8 @@ private:
 private:
 
     bool _useBodyForce; ///< Flag to include body force term.
+    bool _useStaticCondensation; ///< Flag to eliminate pressure in each cell.
+    bool _usePressureMassPreconditioner; ///< Flag to add pressure mass matrix preconditioner kernels.
     pylith::materials::RheologyIncompressibleElasticity* _rheology; ///< Bulk rheology for incompressible elasticity.
     pylith::materials::DerivedFactoryElasticity* _derivedFactory; ///< Factory for creating derived fields.
 
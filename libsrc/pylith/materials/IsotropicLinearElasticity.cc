@@ -22,6 +22,7 @@
 
 #include "pylith/materials/AuxiliaryFactoryElastic.hh" // USES AuxiliaryFactoryElastic
 #include "pylith/fekernels/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity kernels
+#include "pylith/fekernels/KernelMultiversion.hh" // USES PYLITH_KERNELS
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 
@@ -113,10 +114,10 @@ pylith::materials::IsotropicLinearElasticity::getKernelf1v(const spatialdata::ge
 
     const int spaceDim = coordsys->getSpaceDim();
     PetscPointFunc f1v =
-        (!_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticity3D::f1v_infinitesimalStrain :
-        (!_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain :
-        (_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticity3D::f1v_infinitesimalStrain_refState :
-        (_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain_refState :
+        (!_useReferenceState && 3 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearElasticity3D)::f1v_infinitesimalStrain :
+        (!_useReferenceState && 2 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearElasticityPlaneStrain)::f1v_infinitesimalStrain :
+        (_useReferenceState && 3 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearElasticity3D)::f1v_infinitesimalStrain_refState :
+        (_useReferenceState && 2 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearElasticityPlaneStrain)::f1v_infinitesimalStrain_refState :
         NULL;
 
     PYLITH_METHOD_RETURN(f1v);
@@ -132,8 +133,8 @@ pylith::materials::IsotropicLinearElasticity::getKernelJf3vu(const spatialdata::
 
     const int spaceDim = coordsys->getSpaceDim();
     PetscPointJac Jf3vu =
-        (3 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticity3D::Jf3vu_infinitesimalStrain :
-        (2 == spaceDim) ? pylith::fekernels::IsotropicLinearElasticityPlaneStrain::Jf3vu_infinitesimalStrain :
+        (3 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearElasticity3D)::Jf3vu_infinitesimalStrain :
+        (2 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearElasticityPlaneStrain)::Jf3vu_infinitesimalStrain :
         NULL;
 
     PYLITH_METHOD_RETURN(Jf3vu);
@@ -173,6 +173,19 @@ pylith::materials::IsotropicLinearIncompElasticity::getKernelJf0pp(const spatial
 } // getKernelJacobianInverseBulkModulus
 
 
+// ------------------------------------------------------------------------------------------------
+// Get Jf0pp kernel approximating the Schur complement for the pressure in the LHS Jacobian preconditioner.
+PetscPointJac
+pylith::materials::IsotropicLinearIncompElasticity::getKernelJf0ppSchur(const spatialdata::geocoords::CoordSys* coordsys) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("getKernelJf0ppSchur(coordsys="<<typeid(coordsys).name()<<")");
+
+    PetscPointJac Jf0pp = pylith::fekernels::IsotropicLinearIncompElasticity::Jf0pp_schur;
+
+    PYLITH_METHOD_RETURN(Jf0pp);
+} // getKernelJf0ppSchur
+
+
 // ------------------------------------------------------------------------------------------------
 // Get stress kernel for derived field.
 PetscPointFunc
@@ -92,6 +92,14 @@ public:
      */
     PetscPointJac getKernelJf0pp(const spatialdata::geocoords::CoordSys* coordsys) const;
 
+    /** Get Jf0pp kernel approximating the Schur complement for the pressure in the LHS Jacobian preconditioner.
+     *
+     * @param[in] coordsys Coordinate system.
+     *
+     * @return LHS Jf0pp preconditioner kernel.
+     */
+    PetscPointJac getKernelJf0ppSchur(const spatialdata::geocoords::CoordSys* coordsys) const;
+
     /** Get Jf3uu kernel for LHS Jacobian F(t,s,\dot{s}).
      *
      * @param[in] coordsys Coordinate system.
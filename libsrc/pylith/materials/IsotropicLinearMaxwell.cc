@@ -22,6 +22,7 @@
 
 #include "pylith/materials/AuxiliaryFactoryViscoelastic.hh" // USES AuxiliaryFactoryViscoelastic
 #include "pylith/fekernels/IsotropicLinearMaxwell.hh" // USES IsotropicLinearMaxwell kernels
+#include "pylith/fekernels/KernelMultiversion.hh" // USES PYLITH_KERNELS
 #include "pylith/feassemble/Integrator.hh" // USES Integrator
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
@@ -121,10 +122,10 @@ pylith::materials::IsotropicLinearMaxwell::getKernelf1v(const spatialdata::geoco
 
     const int spaceDim = coordsys->getSpaceDim();
     PetscPointFunc f1u =
-        (!_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearMaxwell3D::f1v_infinitesimalStrain :
-        (!_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearMaxwellPlaneStrain::f1v_infinitesimalStrain :
-        (_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearMaxwell3D::f1v_infinitesimalStrain_refState :
-        (_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearMaxwellPlaneStrain::f1v_infinitesimalStrain_refState :
+        (!_useReferenceState && 3 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearMaxwell3D)::f1v_infinitesimalStrain :
+        (!_useReferenceState && 2 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearMaxwellPlaneStrain)::f1v_infinitesimalStrain :
+        (_useReferenceState && 3 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearMaxwell3D)::f1v_infinitesimalStrain_refState :
+        (_useReferenceState && 2 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearMaxwellPlaneStrain)::f1v_infinitesimalStrain_refState :
         NULL;
 
     PYLITH_METHOD_RETURN(f1u);
@@ -140,8 +141,8 @@ pylith::materials::IsotropicLinearMaxwell::getKernelJf3vu(const spatialdata::geo
 
     const int spaceDim = coordsys->getSpaceDim();
     PetscPointJac Jf3uu =
-        (3 == spaceDim) ? pylith::fekernels::IsotropicLinearMaxwell3D::Jf3vu_infinitesimalStrain :
-        (2 == spaceDim) ? pylith::fekernels::IsotropicLinearMaxwellPlaneStrain::Jf3vu_infinitesimalStrain :
+        (3 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearMaxwell3D)::Jf3vu_infinitesimalStrain :
+        (2 == spaceDim) ? PYLITH_KERNELS(IsotropicLinearMaxwellPlaneStrain)::Jf3vu_infinitesimalStrain :
         NULL;
 
     PYLITH_METHOD_RETURN(Jf3uu);
@@ -34,6 +34,45 @@
 // ---------------------------------------------------------------------------------------------------------------------
 typedef pylith::feassemble::IntegratorDomain::ProjectKernels ProjectKernels;
 
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace materials {
+        class _IsotropicLinearPoroelasticity {
+public:
+
+            /** Get flow kernels specialized for spatial dimension, permeability, and optional auxiliary subfields.
+             *
+             * @param[in] spaceDim Spatial dimension.
+             * @returns Kernel or NULL if spatial dimension is not supported.
+             */
+            template<bool TENSOR_PERMEABILITY, bool BODY_FORCE, bool GRAVITY, bool SOURCE_DENSITY>
+            static
+            PetscPointFunc f0p_implicit(const int spaceDim) {
+                return (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityFlow<3, TENSOR_PERMEABILITY, BODY_FORCE, GRAVITY, SOURCE_DENSITY>::f0p_implicit :
+                       (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityFlow<2, TENSOR_PERMEABILITY, BODY_FORCE, GRAVITY, SOURCE_DENSITY>::f0p_implicit :
+                       NULL;
+            } // f0p_implicit
+
+            template<bool TENSOR_PERMEABILITY, bool BODY_FORCE, bool GRAVITY, bool SOURCE_DENSITY>
+            static
+            PetscPointFunc f1p(const int spaceDim) {
+                return (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityFlow<3, TENSOR_PERMEABILITY, BODY_FORCE, GRAVITY, SOURCE_DENSITY>::f1p :
+                       (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityFlow<2, TENSOR_PERMEABILITY, BODY_FORCE, GRAVITY, SOURCE_DENSITY>::f1p :
+                       NULL;
+            } // f1p
+
+            template<bool TENSOR_PERMEABILITY, bool BODY_FORCE, bool GRAVITY, bool SOURCE_DENSITY>
+            static
+            PetscPointJac Jf3pp(const int spaceDim) {
+                return (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityFlow<3, TENSOR_PERMEABILITY, BODY_FORCE, GRAVITY, SOURCE_DENSITY>::Jf3pp :
+                       (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityFlow<2, TENSOR_PERMEABILITY, BODY_FORCE, GRAVITY, SOURCE_DENSITY>::Jf3pp :
+                       NULL;
+            } // Jf3pp
+
+        }; // _IsotropicLinearPoroelasticity
+    } // materials
+} // pylith
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::materials::IsotropicLinearPoroelasticity::IsotropicLinearPoroelasticity(void) :
@@ -319,44 +358,28 @@ pylith::materials::IsotropicLinearPoroelasticity::getKernelf0p_implicit(const sp
 
     switch (bitUse) {
     case 0x0:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit :
-              NULL;
+        f0p = _IsotropicLinearPoroelasticity::f0p_implicit<false, false, false, false>(spaceDim);
         break;
     case 0x1:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit :
-              NULL;
+        f0p = _IsotropicLinearPoroelasticity::f0p_implicit<false, true, false, false>(spaceDim);
         break;
     case 0x2:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit :
-              NULL;
-        break;
-    case 0x4:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source :
-              NULL; // aOff for sourceDensity is 3
+        f0p = _IsotropicLinearPoroelasticity::f0p_implicit<false, false, true, false>(spaceDim);
         break;
     case 0x3:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit :
-              NULL;
+        f0p = _IsotropicLinearPoroelasticity::f0p_implicit<false, true, true, false>(spaceDim);
+        break;
+    case 0x4:
+        f0p = _IsotropicLinearPoroelasticity::f0p_implicit<false, false, false, true>(spaceDim);
         break;
     case 0x5:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source_body :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_body :
-              NULL; // aOff for sourceDensity is 4
+        f0p = _IsotropicLinearPoroelasticity::f0p_implicit<false, true, false, true>(spaceDim);
         break;
     case 0x6:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source_grav :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_grav :
-              NULL; // aOff for sourceDensity is 4
+        f0p = _IsotropicLinearPoroelasticity::f0p_implicit<false, false, true, true>(spaceDim);
         break;
     case 0x7:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source_grav_body :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_grav_body :
-              NULL; // aOff for sourceDensity is 5
+        f0p = _IsotropicLinearPoroelasticity::f0p_implicit<false, true, true, true>(spaceDim);
         break;
     default:
         PYLITH_COMPONENT_LOGICERROR("Unknown case (bitUse=" << bitUse << ") for Poroelasticity LHS residual kernels.");
@@ -418,46 +441,29 @@ pylith::materials::IsotropicLinearPoroelasticity::getKernelf1p_implicit(const sp
 
     switch (bitUse) {
     case 0x0:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p :
-              NULL;
+        f1p = _IsotropicLinearPoroelasticity::f1p<false, false, false, false>(spaceDim);
         break;
     case 0x1:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_tensor_permeability :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_tensor_permeability :
-              NULL;
+        f1p = _IsotropicLinearPoroelasticity::f1p<true, false, false, false>(spaceDim);
         break;
     case 0x2:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body :
-              NULL;
+        f1p = _IsotropicLinearPoroelasticity::f1p<false, true, false, false>(spaceDim);
         break;
     case 0x3:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body_tensor_permeability :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body_tensor_permeability :
-              NULL;
+        f1p = _IsotropicLinearPoroelasticity::f1p<true, true, false, false>(spaceDim);
         break;
     case 0x4:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_gravity :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_gravity :
-              NULL;
+        f1p = _IsotropicLinearPoroelasticity::f1p<false, false, true, false>(spaceDim);
         break;
     case 0x5:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_gravity_tensor_permeability :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_gravity_tensor_permeability :
-              NULL;
+        f1p = _IsotropicLinearPoroelasticity::f1p<true, false, true, false>(spaceDim);
         break;
     case 0x6:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body_gravity :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body_gravity :
-              NULL;
+        f1p = _IsotropicLinearPoroelasticity::f1p<false, true, true, false>(spaceDim);
         break;
     case 0x7:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body_gravity_tensor_permeability :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body_gravity_tensor_permeability :
-              NULL;
+        f1p = _IsotropicLinearPoroelasticity::f1p<true, true, true, false>(spaceDim);
         break;
-
     default:
         PYLITH_COMPONENT_ERROR("Unknown combination of flags for  _useTensorPermeability="<<_useTensorPermeability<<", _useBodyForce="<<_useBodyForce<<", _gravityField="<<_gravityField<<").");
         throw std::logic_error("Unknown combination of flags.");
@@ -535,6 +541,23 @@ pylith::materials::IsotropicLinearPoroelasticity::getKernelJf0pp(const spatialda
 } // getKernelJf0pp
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get specific storage kernel with fixed-stress stabilization for LHS Jacobian preconditioner F(t,s, \dot{s}).
+PetscPointJac
+pylith::materials::IsotropicLinearPoroelasticity::getKernelJf0ppFixedStress(const spatialdata::geocoords::CoordSys* coordsys) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("getKernelJf0ppFixedStress(coordsys="<<typeid(coordsys).name()<<")");
+
+    const int spaceDim = coordsys->getSpaceDim();
+    PetscPointJac Jf0pp =
+        (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0pp_fixed_stress :
+        (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0pp_fixed_stress :
+        NULL;
+
+    PYLITH_METHOD_RETURN(Jf0pp);
+} // getKernelJf0ppFixedStress
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Get Darcy Conductivity kernel for LHS Jacobian
 PetscPointJac
@@ -543,12 +566,9 @@ pylith::materials::IsotropicLinearPoroelasticity::getKernelJf3pp(const spatialda
     PYLITH_COMPONENT_DEBUG("getKernelJf3pp(coordsys="<<typeid(coordsys).name()<<")");
 
     const int spaceDim = coordsys->getSpaceDim();
-    PetscPointJac Jf3pp =
-        (!_useTensorPermeability && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf3pp :
-        (!_useTensorPermeability && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf3pp :
-        (_useTensorPermeability && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf3pp_tensor_permeability :
-        (_useTensorPermeability && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf3pp_tensor_permeability :
-        NULL;
+    PetscPointJac Jf3pp = (_useTensorPermeability) ?
+                          _IsotropicLinearPoroelasticity::Jf3pp<true, false, false, false>(spaceDim) :
+                          _IsotropicLinearPoroelasticity::Jf3pp<false, false, false, false>(spaceDim);
 
     PYLITH_METHOD_RETURN(Jf3pp);
 } // getKerneJf3pp
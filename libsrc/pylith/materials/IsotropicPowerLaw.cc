@@ -22,6 +22,7 @@
 
 #include "pylith/materials/AuxiliaryFactoryViscoelastic.hh" // USES AuxiliaryFactoryViscoelastic
 #include "pylith/fekernels/IsotropicPowerLaw.hh" // USES IsotropicPowerLaw kernels
+#include "pylith/fekernels/KernelMultiversion.hh" // USES PYLITH_KERNELS
 #include "pylith/feassemble/Integrator.hh" // USES Integrator
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
@@ -123,10 +124,10 @@ pylith::materials::IsotropicPowerLaw::getKernelf1v(const spatialdata::geocoords:
 
     const int spaceDim = coordsys->getSpaceDim();
     PetscPointFunc f1u =
-        (!_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicPowerLaw3D::f1v_infinitesimalStrain :
-        (!_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicPowerLawPlaneStrain::f1v_infinitesimalStrain :
-        (_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicPowerLaw3D::f1v_infinitesimalStrain_refState :
-        (_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicPowerLawPlaneStrain::f1v_infinitesimalStrain_refState :
+        (!_useReferenceState && 3 == spaceDim) ? PYLITH_KERNELS(IsotropicPowerLaw3D)::f1v_infinitesimalStrain :
+        (!_useReferenceState && 2 == spaceDim) ? PYLITH_KERNELS(IsotropicPowerLawPlaneStrain)::f1v_infinitesimalStrain :
+        (_useReferenceState && 3 == spaceDim) ? PYLITH_KERNELS(IsotropicPowerLaw3D)::f1v_infinitesimalStrain_refState :
+        (_useReferenceState && 2 == spaceDim) ? PYLITH_KERNELS(IsotropicPowerLawPlaneStrain)::f1v_infinitesimalStrain_refState :
         NULL;
 
     PYLITH_METHOD_RETURN(f1u);
@@ -142,10 +143,10 @@ pylith::materials::IsotropicPowerLaw::getKernelJf3vu(const spatialdata::geocoord
 
     const int spaceDim = coordsys->getSpaceDim();
     PetscPointJac Jf3uu =
-        (!_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicPowerLaw3D::Jf3vu_infinitesimalStrain :
-        (!_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicPowerLawPlaneStrain::Jf3vu_infinitesimalStrain :
-        (_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicPowerLaw3D::Jf3vu_infinitesimalStrain_refState :
-        (_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicPowerLawPlaneStrain::Jf3vu_infinitesimalStrain_refState :
+        (!_useReferenceState && 3 == spaceDim) ? PYLITH_KERNELS(IsotropicPowerLaw3D)::Jf3vu_infinitesimalStrain :
+        (!_useReferenceState && 2 == spaceDim) ? PYLITH_KERNELS(IsotropicPowerLawPlaneStrain)::Jf3vu_infinitesimalStrain :
+        (_useReferenceState && 3 == spaceDim) ? PYLITH_KERNELS(IsotropicPowerLaw3D)::Jf3vu_infinitesimalStrain_refState :
+        (_useReferenceState && 2 == spaceDim) ? PYLITH_KERNELS(IsotropicPowerLawPlaneStrain)::Jf3vu_infinitesimalStrain_refState :
         NULL;
 
     PYLITH_METHOD_RETURN(Jf3uu);
@@ -109,7 +109,7 @@ public:
 
     /** Get default PETSc solver options appropriate for material.
      *
-     * @param[in] isParallel True if running in parallel, False if running in serial.
+     * @param[in] isParallel True if running in parallel or problem is too large for a direct solver, False otherwise.
      * @param[in] hasFault True if problem has fault, False otherwise.
      * @returns PETSc solver options.
      */
@@ -54,6 +54,7 @@ pylith::materials::Poroelasticity::Poroelasticity(void) :
     _useReferenceState(false),
     _useSourceDensity(false),
     _useStateVars(false),
+    _useFixedStressSplit(false),
     _rheology(NULL),
     _derivedFactory(new pylith::materials::DerivedFactoryPoroelasticity) {
     pylith::utils::PyreComponent::setName("poroelasticity");
@@ -131,6 +132,23 @@ pylith::materials::Poroelasticity::useStateVars(void) const {
 } // useStateVars
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Use fixed-stress split preconditioner?
+void
+pylith::materials::Poroelasticity::useFixedStressSplit(const bool value) {
+    PYLITH_COMPONENT_DEBUG("useFixedStressSplit(value=" << value << ")");
+    _useFixedStressSplit = value;
+} // useFixedStressSplit
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use fixed-stress split preconditioner?
+bool
+pylith::materials::Poroelasticity::useFixedStressSplit(void) const {
+    return _useFixedStressSplit;
+} // useFixedStressSplit
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set bulk rheology.
 void
@@ -175,6 +193,9 @@ pylith::materials::Poroelasticity::verifyConfiguration(const pylith::topology::F
             throw std::runtime_error("Cannot find 'velocity' field in solution; required for material 'Poroelasticity' with inertia.");
         } // if
     } // switch
+    if (_useFixedStressSplit && ((QUASISTATIC != _formulation) || _useStateVars)) {
+        throw std::runtime_error("Fixed-stress split for material 'Poroelasticity' requires the quasistatic formulation without state variables.");
+    } // if
     PYLITH_METHOD_END;
 } // verifyConfiguration
 
@@ -248,7 +269,6 @@ pylith::materials::Poroelasticity::createAuxiliaryField(const pylith::topology::
     auxiliaryField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
     auxiliaryField->allocate();
-    auxiliaryField->createOutputVector();
 
     assert(auxiliaryFactory);
     auxiliaryFactory->setValuesFromDB();
@@ -281,7 +301,6 @@ pylith::materials::Poroelasticity::createDerivedField(const pylith::topology::Fi
     derivedField->createDiscretization();
     pylith::topology::FieldOps::checkDiscretization(solution, *derivedField);
     derivedField->allocate();
-    derivedField->createOutputVector();
 
     PYLITH_METHOD_RETURN(derivedField);
 } // createDerivedField
@@ -301,21 +320,53 @@ pylith::materials::Poroelasticity::getSolverDefaults(const bool isParallel,
     case pylith::problems::Physics::QUASISTATIC:
         options->add("-ts_type", "beuler");
 
-        if (!hasFault) {
+        if (_useFixedStressSplit) {
+            // Block Gauss-Seidel iteration with the flow solve (pressure) followed by the mechanics solve
+            // (displacement and trace strain), accelerated by the outer Krylov solver.
+            options->add("-pc_type", "fieldsplit");
+            options->add("-pc_fieldsplit_type", "multiplicative");
+            options->add("-pc_fieldsplit_0_fields", "1");
+            options->add("-pc_fieldsplit_1_fields", "0,2");
+            if (!isParallel) {
+                options->add("-fieldsplit_0_pc_type", "lu");
+                options->add("-fieldsplit_1_pc_type", "lu");
+            } else {
+                // The pressure block of the preconditioner matrix includes the fixed-stress stabilization, which
+                // approximates the Schur complement of the pressure, so algebraic multigrid applies directly.
+                options->add("-fieldsplit_0_pc_type", "gamg");
+
+                // Eliminate the trace strain from the mechanics block: its block is a mass matrix (block diagonal
+                // for a discontinuous discretization), and the Schur complement for the displacement is assembled
+                // from its diagonal and solved with algebraic multigrid.
+                options->add("-fieldsplit_1_pc_type", "fieldsplit");
+                options->add("-fieldsplit_1_pc_fieldsplit_type", "schur");
+                options->add("-fieldsplit_1_pc_fieldsplit_schur_factorization_type", "full");
+                options->add("-fieldsplit_1_pc_fieldsplit_schur_precondition", "selfp");
+                options->add("-fieldsplit_1_pc_fieldsplit_0_fields", "1");
+                options->add("-fieldsplit_1_pc_fieldsplit_1_fields", "0");
+                options->add("-fieldsplit_1_fieldsplit_0_ksp_type", "preonly");
+                options->add("-fieldsplit_1_fieldsplit_0_pc_type", "jacobi");
+                options->add("-fieldsplit_1_fieldsplit_1_ksp_type", "preonly");
+                options->add("-fieldsplit_1_fieldsplit_1_pc_type", "gamg");
+                options->add("-fieldsplit_1_fieldsplit_1_mg_levels_pc_type", "sor");
+                options->add("-fieldsplit_1_fieldsplit_1_mg_levels_ksp_type", "richardson");
+            } // if/else
+        } else if (!hasFault) {
             if (!isParallel) {
                 options->add("-pc_type", "lu");
             } else {
-#if 1
-                options->add("-pc_type", "ml");
-#else
                 options->add("-pc_type", "gamg");
                 options->add("-mg_levels_pc_type", "sor");
                 options->add("-mg_levels_ksp_type", "richardson");
-#endif
             } // if/else
-        } // if
+        } // if/else
         break;
     case pylith::problems::Physics::DYNAMIC:
+        // Explicit, third-order strong stability preserving Runge-Kutta; the lumped LHS Jacobian inverse is
+        // reused across stages and time steps, so each stage is a residual evaluation.
+        options->add("-ts_type", "ssp");
+        options->add("-ts_ssp_type", "rks3");
+        options->add("-ts_ssp_nstages", "4");
         break;
     case pylith::problems::Physics::DYNAMIC_IMEX:
         break;
@@ -489,6 +540,7 @@ pylith::materials::Poroelasticity::_setKernelsResidual(pylith::feassemble::Integ
 
     assert(integrator);
     integrator->setKernelsResidual(kernels, solution);
+    integrator->setTimeDependentLHSResidual(!_mmsBodyForceKernels.empty()); // MMS body forces may depend on time.
 
     PYLITH_METHOD_END;
 } // _setKernelsResidual
@@ -848,6 +900,19 @@ pylith::materials::Poroelasticity::_setKernelsJacobian(pylith::feassemble::Integ
         PYLITH_COMPONENT_LOGICERROR("Unknown formulation for equations (" << _formulation << ").");
     } // switch
 
+    if (_useFixedStressSplit) {
+        // Preconditioner is the Jacobian with the fixed-stress stabilization added to the pressure block.
+        const size_t numKernels = kernels.size();
+        for (size_t i = 0; i < numKernels; ++i) {
+            JacobianKernels kernelsPrecond = kernels[i];
+            kernelsPrecond.part = pylith::feassemble::Integrator::LHS_PRECONDITIONER;
+            if ((kernelsPrecond.subfieldTrial == "pressure") && (kernelsPrecond.subfieldBasis == "pressure")) {
+                kernelsPrecond.j0 = _rheology->getKernelJf0ppFixedStress(coordsys);
+            } // if
+            kernels.push_back(kernelsPrecond);
+        } // for
+    } // if
+
     assert(integrator);
     integrator->setKernelsJacobian(kernels, solution);
 
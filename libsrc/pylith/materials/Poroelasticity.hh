@@ -93,6 +93,21 @@ public:
      */
     bool useReferenceState(void) const;
 
+    /** Use fixed-stress split preconditioner?
+     *
+     * Adds preconditioner kernels equal to the Jacobian kernels except for the fixed-stress stabilization of the
+     * pressure block. Only used with the quasistatic formulation without state variables.
+     *
+     * @param[in] value Flag indicating to use fixed-stress split preconditioner.
+     */
+    void useFixedStressSplit(const bool value);
+
+    /** Use fixed-stress split preconditioner?
+     *
+     * @returns True if using fixed-stress split preconditioner, false otherwise.
+     */
+    bool useFixedStressSplit(void) const;
+
     /** Set bulk rheology.
      *
      * @param[in] rheology Bulk rheology for elasticity.
@@ -211,6 +226,7 @@ private:
     bool _useReferenceState; ///< Flag to use reference stress and strain.
     bool _useSourceDensity; ///< Flag to use source density.
     bool _useStateVars; ///< Flag to update auxiliary fields.
+    bool _useFixedStressSplit; ///< Flag to add fixed-stress split preconditioner kernels.
     pylith::materials::RheologyPoroelasticity* _rheology; ///< Bulk rheology for elasticity.
     pylith::materials::DerivedFactoryPoroelasticity* _derivedFactory; ///< Factory for creating derived fields.
 
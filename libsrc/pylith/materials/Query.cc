@@ -29,6 +29,9 @@
 
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+
 namespace pylith {
     namespace materials {
         class _Query {
@@ -36,57 +39,137 @@ namespace pylith {
              *
              * Order of spatial database values must match the order given in the Query factory functions.
              *
+             * The conversion functions do not allocate memory. Failed checks are returned as a bitmask, and the
+             * corresponding message function creates the error message only after a conversion fails.
+             *
              * Interface
              *
              * @param[out] valueSubfield Value for subfield.
              * @param[in] numComponents Number of components for subfield value.
              * @param[in] dbValues Array of values from spatial database query.
              * @param[in] dbIndices Indices of values from spatial database to use for computing subfield values.
-             * @returns PETSc error code (0 for success).
+             * @returns 0 for success, otherwise bitmask of failed checks.
              */
 public:
 
             static
-            std::string vmToShearModulus(PylithScalar valueSubfield[],
-                                         const PylithInt numComponents,
-                                         const pylith::scalar_array dbValues,
-                                         const pylith::int_array dbIndices);
+            int vmToShearModulus(PylithScalar valueSubfield[],
+                                 const PylithInt numComponents,
+                                 const double dbValues[],
+                                 const PylithInt dbIndices[]);
 
             static
-            std::string vmToBulkModulus(PylithScalar valueSubfield[],
-                                        const PylithInt numComponents,
-                                        const pylith::scalar_array dbValues,
-                                        const pylith::int_array dbIndices);
+            std::string vmToShearModulusMsg(const int code,
+                                            const PylithInt numComponents,
+                                            const double dbValues[],
+                                            const PylithInt dbIndices[]);
 
             static
-            std::string vmToMaxwellTime(PylithScalar valueSubfield[],
-                                        const PylithInt numComponents,
-                                        const pylith::scalar_array dbValues,
-                                        const pylith::int_array dbIndices);
+            int vmToBulkModulus(PylithScalar valueSubfield[],
+                                const PylithInt numComponents,
+                                const double dbValues[],
+                                const PylithInt dbIndices[]);
 
             static
-            std::string vmToGeneralizedMaxwellTimes(PylithScalar valueSubfield[],
-                                                    const PylithInt numComponents,
-                                                    const pylith::scalar_array dbValues,
-                                                    const pylith::int_array dbIndices);
+            std::string vmToBulkModulusMsg(const int code,
+                                           const PylithInt numComponents,
+                                           const double dbValues[],
+                                           const PylithInt dbIndices[]);
 
             static
-            std::string vmToGeneralizedMaxwellShearModulusRatios(PylithScalar valueSubfield[],
-                                                                 const PylithInt numComponents,
-                                                                 const pylith::scalar_array dbValues,
-                                                                 const pylith::int_array dbIndices);
+            int vmToMaxwellTime(PylithScalar valueSubfield[],
+                                const PylithInt numComponents,
+                                const double dbValues[],
+                                const PylithInt dbIndices[]);
 
             static
-            std::string dbToGravityField(PylithScalar valueSubfield[],
-                                         const PylithInt numComponents,
-                                         const pylith::scalar_array dbValues,
-                                         const pylith::int_array dbIndices);
+            std::string vmToMaxwellTimeMsg(const int code,
+                                           const PylithInt numComponents,
+                                           const double dbValues[],
+                                           const PylithInt dbIndices[]);
 
             static
-            std::string inputToBiotModulus(PylithScalar valueSubfield[],
-                                           const PylithInt numComponents,
-                                           const pylith::scalar_array dbValues,
-                                           const pylith::int_array dbIndices);
+            int vmToGeneralizedMaxwellTimes(PylithScalar valueSubfield[],
+                                            const PylithInt numComponents,
+                                            const double dbValues[],
+                                            const PylithInt dbIndices[]);
+
+            static
+            std::string vmToGeneralizedMaxwellTimesMsg(const int code,
+                                                       const PylithInt numComponents,
+                                                       const double dbValues[],
+                                                       const PylithInt dbIndices[]);
+
+            static
+            int vmToGeneralizedMaxwellShearModulusRatios(PylithScalar valueSubfield[],
+                                                         const PylithInt numComponents,
+                                                         const double dbValues[],
+                                                         const PylithInt dbIndices[]);
+
+            static
+            std::string vmToGeneralizedMaxwellShearModulusRatiosMsg(const int code,
+                                                                    const PylithInt numComponents,
+                                                                    const double dbValues[],
+                                                                    const PylithInt dbIndices[]);
+
+            static
+            int dbToGravityField(PylithScalar valueSubfield[],
+                                 const PylithInt numComponents,
+                                 const double dbValues[],
+                                 const PylithInt dbIndices[]);
+
+            static
+            std::string dbToGravityFieldMsg(const int code,
+                                            const PylithInt numComponents,
+                                            const double dbValues[],
+                                            const PylithInt dbIndices[]);
+
+            static
+            int inputToBiotModulus(PylithScalar valueSubfield[],
+                                   const PylithInt numComponents,
+                                   const double dbValues[],
+                                   const PylithInt dbIndices[]);
+
+            static
+            std::string inputToBiotModulusMsg(const int code,
+                                              const PylithInt numComponents,
+                                              const double dbValues[],
+                                              const PylithInt dbIndices[]);
+
+            /** Convert spatial database values at many points using conversion function for a point.
+             *
+             * The conversion function is a template parameter, so it is inlined in the loop over points.
+             *
+             * @param[out] valueSubfield Values for subfield [numPoints*numComponents].
+             * @param[in] numComponents Number of components for subfield value.
+             * @param[in] numPoints Number of points.
+             * @param[in] dbValues Array of values from spatial database query [numPoints*numDBValues].
+             * @param[in] numDBValues Number of values from spatial database query at a point.
+             * @param[in] dbIndices Indices of values from spatial database to use for computing subfield values.
+             * @param[out] failedPoint Index of first point that failed (numPoints if none).
+             * @returns 0 for success, otherwise bitmask of failed checks at failed point.
+             */
+            template<pylith::topology::FieldQuery::convertcodefn_type convertFn>
+            static
+            int convertArray(PylithScalar valueSubfield[],
+                             const PylithInt numComponents,
+                             const size_t numPoints,
+                             const double dbValues[],
+                             const size_t numDBValues,
+                             const PylithInt dbIndices[],
+                             size_t* failedPoint) {
+                assert(failedPoint);
+                for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+                    const int code = convertFn(&valueSubfield[iPoint*numComponents], numComponents,
+                                               &dbValues[iPoint*numDBValues], dbIndices);
+                    if (code) {
+                        *failedPoint = iPoint;
+                        return code;
+                    } // if
+                } // for
+                *failedPoint = numPoints;
+                return 0;
+            } // convertArray
 
         }; // _Query
     } // materials
@@ -100,8 +183,12 @@ pylith::materials::Query::shearModulusFromVM(const char* subfieldName,
     const size_t numDBValues = 2;
     const char* dbValues[numDBValues] = { "density", "vs" };
 
+    const pylith::topology::FieldQuery::Converter converter(_Query::vmToShearModulus,
+                                                            _Query::convertArray<_Query::vmToShearModulus>,
+                                                            _Query::vmToShearModulusMsg);
+
     assert(factory);
-    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, _Query::vmToShearModulus);
+    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, converter);
 } // shearModulusFromVM
 
 
@@ -113,8 +200,12 @@ pylith::materials::Query::bulkModulusFromVM(const char* subfieldName,
     const size_t numDBValues = 3;
     const char* dbValues[numDBValues] = { "density", "vs", "vp" };
 
+    const pylith::topology::FieldQuery::Converter converter(_Query::vmToBulkModulus,
+                                                            _Query::convertArray<_Query::vmToBulkModulus>,
+                                                            _Query::vmToBulkModulusMsg);
+
     assert(factory);
-    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, _Query::vmToBulkModulus);
+    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, converter);
 } // bulkModulusFromVM
 
 
@@ -126,8 +217,12 @@ pylith::materials::Query::maxwellTimeFromVM(const char* subfieldName,
     const size_t numDBValues = 3;
     const char* dbValues[numDBValues] = { "density", "vs", "viscosity" };
 
+    const pylith::topology::FieldQuery::Converter converter(_Query::vmToMaxwellTime,
+                                                            _Query::convertArray<_Query::vmToMaxwellTime>,
+                                                            _Query::vmToMaxwellTimeMsg);
+
     assert(factory);
-    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, _Query::vmToMaxwellTime);
+    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, converter);
 } // maxwellTimeFromVM
 
 
@@ -148,8 +243,12 @@ pylith::materials::Query::generalizedMaxwellTimesFromVM(const char* subfieldName
         "shear_modulus_ratio_3",
     };
 
+    const pylith::topology::FieldQuery::Converter converter(_Query::vmToGeneralizedMaxwellTimes,
+                                                            _Query::convertArray<_Query::vmToGeneralizedMaxwellTimes>,
+                                                            _Query::vmToGeneralizedMaxwellTimesMsg);
+
     assert(factory);
-    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, _Query::vmToGeneralizedMaxwellTimes);
+    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, converter);
 } // generalizedMaxwellTimesFromVM
 
 
@@ -165,8 +264,12 @@ pylith::materials::Query::generalizedMaxwellShearModulusRatiosFromVM(const char*
         "shear_modulus_ratio_3",
     };
 
+    const pylith::topology::FieldQuery::Converter converter(_Query::vmToGeneralizedMaxwellShearModulusRatios,
+                                                            _Query::convertArray<_Query::vmToGeneralizedMaxwellShearModulusRatios>,
+                                                            _Query::vmToGeneralizedMaxwellShearModulusRatiosMsg);
+
     assert(factory);
-    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, _Query::vmToGeneralizedMaxwellShearModulusRatios);
+    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, converter);
 } // generalizedMaxwellShearModulusRatiosFromVM
 
 
@@ -184,8 +287,12 @@ pylith::materials::Query::gravityFieldFromDB(const char* subfieldName,
         "gravity_field_z"
     };
 
+    const pylith::topology::FieldQuery::Converter converter(_Query::dbToGravityField,
+                                                            _Query::convertArray<_Query::dbToGravityField>,
+                                                            _Query::dbToGravityFieldMsg);
+
     assert(factory);
-    factory->setSubfieldQuery(subfieldName, dbValues, spaceDim, _Query::dbToGravityField, gravityField);
+    factory->setSubfieldQuery(subfieldName, dbValues, spaceDim, converter, gravityField);
 } // gravityFieldFromDB
 
 
@@ -202,321 +309,387 @@ pylith::materials::Query::biotModulusFromInput(const char* subfieldName,
         "porosity"
     };
 
+    const pylith::topology::FieldQuery::Converter converter(_Query::inputToBiotModulus,
+                                                            _Query::convertArray<_Query::inputToBiotModulus>,
+                                                            _Query::inputToBiotModulusMsg);
+
     assert(factory);
-    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, _Query::inputToBiotModulus);
+    factory->setSubfieldQuery(subfieldName, dbValues, numDBValues, converter);
 } // biotModulusFromInput
 
 
 // ------------------------------------------------------------------------------------------------
-// Compute shear modules from density and Vs.
-std::string
+// Compute shear modulus from density and Vs.
+int
 pylith::materials::_Query::vmToShearModulus(PylithScalar valueSubfield[],
                                             const PylithInt numComponents,
-                                            const pylith::scalar_array dbValues,
-                                            const pylith::int_array dbIndices) {
-    PYLITH_METHOD_BEGIN;
-
-    const size_t _numComponents = 1;
-
+                                            const double dbValues[],
+                                            const PylithInt dbIndices[]) {
     assert(valueSubfield);
-    assert(_numComponents == size_t(numComponents));
-    assert(2 == dbIndices.size());
+    assert(1 == numComponents);
+    assert(dbValues);
+    assert(dbIndices);
 
-    const size_t i_density = 0;assert(size_t(dbIndices[i_density]) < dbValues.size());
-    const size_t i_vs = 1;assert(size_t(dbIndices[i_vs]) < dbValues.size());
+    const size_t i_density = 0;
+    const size_t i_vs = 1;
     const PylithScalar density = dbValues[dbIndices[i_density]];
     const PylithScalar vs = dbValues[dbIndices[i_vs]];
     valueSubfield[0] = density * vs * vs;
 
+    return (density <= 0 ? 0x1 : 0) | (vs <= 0 ? 0x2 : 0);
+} // vmToShearModulus
+
+
+// ------------------------------------------------------------------------------------------------
+// Create error message for failed conversion to shear modulus.
+std::string
+pylith::materials::_Query::vmToShearModulusMsg(const int code,
+                                               const PylithInt numComponents,
+                                               const double dbValues[],
+                                               const PylithInt dbIndices[]) {
+    const PylithScalar density = dbValues[dbIndices[0]];
+    const PylithScalar vs = dbValues[dbIndices[1]];
+
     std::ostringstream msg;
-    if (density <= 0) {
+    if (code & 0x1) {
         msg << "Found negative density (" << density << ").";
     } // if
-    if (vs <= 0) {
+    if (code & 0x2) {
         msg << "Found negative shear wave speed (" << vs << ").";
     } // if
 
-    PYLITH_METHOD_RETURN(msg.str());
-} // vmToShearModulus
+    return msg.str();
+} // vmToShearModulusMsg
 
 
 // ------------------------------------------------------------------------------------------------
-// Compute bulk modules from density, Vs, and Vp.
-std::string
+// Compute bulk modulus from density, Vs, and Vp.
+int
 pylith::materials::_Query::vmToBulkModulus(PylithScalar valueSubfield[],
                                            const PylithInt numComponents,
-                                           const pylith::scalar_array dbValues,
-                                           const pylith::int_array dbIndices) {
-    PYLITH_METHOD_BEGIN;
-
-    const size_t _numComponents = 1;
-
+                                           const double dbValues[],
+                                           const PylithInt dbIndices[]) {
     assert(valueSubfield);
-    assert(_numComponents == size_t(numComponents));
-    assert(3 == dbIndices.size());
+    assert(1 == numComponents);
+    assert(dbValues);
+    assert(dbIndices);
 
-    const size_t i_density = 0;assert(size_t(dbIndices[i_density]) < dbValues.size());
-    const size_t i_vs = 1;assert(size_t(dbIndices[i_vs]) < dbValues.size());
-    const size_t i_vp = 2;assert(size_t(dbIndices[i_vp]) < dbValues.size());
+    const size_t i_density = 0;
+    const size_t i_vs = 1;
+    const size_t i_vp = 2;
     const PylithScalar density = dbValues[dbIndices[i_density]];
     const PylithScalar vs = dbValues[dbIndices[i_vs]];
     const PylithScalar vp = dbValues[dbIndices[i_vp]];
     valueSubfield[0] = density * (vp*vp - 4.0/3.0*vs*vs);
 
+    return (density <= 0 ? 0x1 : 0) | (vs < 0 ? 0x2 : 0) | (vp <= 0 ? 0x4 : 0);
+} // vmToBulkModulus
+
+
+// ------------------------------------------------------------------------------------------------
+// Create error message for failed conversion to bulk modulus.
+std::string
+pylith::materials::_Query::vmToBulkModulusMsg(const int code,
+                                              const PylithInt numComponents,
+                                              const double dbValues[],
+                                              const PylithInt dbIndices[]) {
+    const PylithScalar density = dbValues[dbIndices[0]];
+    const PylithScalar vs = dbValues[dbIndices[1]];
+    const PylithScalar vp = dbValues[dbIndices[2]];
+
     std::ostringstream msg;
-    if (density <= 0) {
+    if (code & 0x1) {
         msg << "Found nonpositive density (" << density << ").";
     } // if
-    if (vs < 0) {
+    if (code & 0x2) {
         msg << "Found negative shear wave speed (" << vs << ").";
     } // if
-    if (vp <= 0) {
+    if (code & 0x4) {
         msg << "Found nonpositive dilatational wave speed (" << vp << ").";
     } // if
 
-    PYLITH_METHOD_RETURN(msg.str());
-} // vmToBulkModulus
+    return msg.str();
+} // vmToBulkModulusMsg
 
 
 // ------------------------------------------------------------------------------------------------
 // Compute Maxwell time from from density, Vs, and viscosity.
-std::string
+int
 pylith::materials::_Query::vmToMaxwellTime(PylithScalar valueSubfield[],
                                            const PylithInt numComponents,
-                                           const pylith::scalar_array dbValues,
-                                           const pylith::int_array dbIndices) {
-    PYLITH_METHOD_BEGIN;
-
-    const size_t _numComponents = 1;
-
+                                           const double dbValues[],
+                                           const PylithInt dbIndices[]) {
     assert(valueSubfield);
-    assert(_numComponents == size_t(numComponents));
-    assert(3 == dbIndices.size());
+    assert(1 == numComponents);
+    assert(dbValues);
+    assert(dbIndices);
 
-    const size_t i_density = 0;assert(size_t(dbIndices[i_density]) < dbValues.size());
-    const size_t i_vs = 1;assert(size_t(dbIndices[i_vs]) < dbValues.size());
-    const size_t i_viscosity = 2;assert(size_t(dbIndices[i_viscosity]) < dbValues.size());
+    const size_t i_density = 0;
+    const size_t i_vs = 1;
+    const size_t i_viscosity = 2;
     const PylithScalar density = dbValues[dbIndices[i_density]];
     const PylithScalar vs = dbValues[dbIndices[i_vs]];
     const PylithScalar viscosity = dbValues[dbIndices[i_viscosity]];
     const PylithScalar shearModulus = density * vs * vs;
     valueSubfield[0] = viscosity / shearModulus;
 
+    return (density <= 0 ? 0x1 : 0) | (vs <= 0 ? 0x2 : 0) | (viscosity <= 0 ? 0x4 : 0);
+} // vmToMaxwellTime
+
+
+// ------------------------------------------------------------------------------------------------
+// Create error message for failed conversion to Maxwell time.
+std::string
+pylith::materials::_Query::vmToMaxwellTimeMsg(const int code,
+                                              const PylithInt numComponents,
+                                              const double dbValues[],
+                                              const PylithInt dbIndices[]) {
+    const PylithScalar density = dbValues[dbIndices[0]];
+    const PylithScalar vs = dbValues[dbIndices[1]];
+    const PylithScalar viscosity = dbValues[dbIndices[2]];
+
     std::ostringstream msg;
-    if (density <= 0) {
+    if (code & 0x1) {
         msg << "Found negative density (" << density << ").";
     } // if
-    if (vs <= 0) {
+    if (code & 0x2) {
         msg << "Found negative shear wave speed (" << vs << ").";
     } // if
-    if (viscosity <= 0) {
+    if (code & 0x4) {
         msg << "Found nonpositive viscosity (" << viscosity << ").";
     } // if
 
-    PYLITH_METHOD_RETURN(msg.str());
-} // vmToMaxwellTime
+    return msg.str();
+} // vmToMaxwellTimeMsg
 
 
 // ------------------------------------------------------------------------------------------------
 // Compute Maxwell time for generalized Maxwell model (3 elements).
-std::string
+int
 pylith::materials::_Query::vmToGeneralizedMaxwellTimes(PylithScalar valueSubfield[],
                                                        const PylithInt numComponents,
-                                                       const pylith::scalar_array dbValues,
-                                                       const pylith::int_array dbIndices) {
-    PYLITH_METHOD_BEGIN;
-
-    const size_t _numComponents = 3;
-
+                                                       const double dbValues[],
+                                                       const PylithInt dbIndices[]) {
     assert(valueSubfield);
-    assert(_numComponents == size_t(numComponents));
-    assert(8 == dbIndices.size());
+    assert(3 == numComponents);
+    assert(dbValues);
+    assert(dbIndices);
 
-    const size_t i_density = 0;assert(size_t(dbIndices[i_density]) < dbValues.size());
-    const size_t i_vs = 1;assert(size_t(dbIndices[i_vs]) < dbValues.size());
-    const size_t i_viscosity = 2;assert(size_t(dbIndices[i_viscosity]+2) < dbValues.size());
-    const size_t i_shearModulusRatio = 5;assert(size_t(dbIndices[i_shearModulusRatio]+2) < dbValues.size());
+    const size_t i_density = 0;
+    const size_t i_vs = 1;
+    const size_t i_viscosity = 2;
+    const size_t i_shearModulusRatio = 5;
 
     const PylithScalar density = dbValues[dbIndices[i_density]];
     const PylithScalar vs = dbValues[dbIndices[i_vs]];
-    const PylithScalar viscosity1 = dbValues[dbIndices[i_viscosity+0]];
-    const PylithScalar viscosity2 = dbValues[dbIndices[i_viscosity+1]];
-    const PylithScalar viscosity3 = dbValues[dbIndices[i_viscosity+2]];
-    const PylithScalar shearModulusRatio1 = dbValues[dbIndices[i_shearModulusRatio+0]];
-    const PylithScalar shearModulusRatio2 = dbValues[dbIndices[i_shearModulusRatio+1]];
-    const PylithScalar shearModulusRatio3 = dbValues[dbIndices[i_shearModulusRatio+2]];
-
     const PylithScalar shearModulus = density * vs * vs;
 
-    const PylithScalar shearModulus1 = shearModulusRatio1 * shearModulus;
-    valueSubfield[0] = (shearModulus1 > 0.0) ? viscosity1 / shearModulus1 : PYLITH_MAXSCALAR;
+    int code = (density <= 0 ? 0x1 : 0) | (vs <= 0 ? 0x2 : 0);
+    PylithScalar ratioSum = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        const PylithScalar viscosity = dbValues[dbIndices[i_viscosity+i]];
+        const PylithScalar shearModulusRatio = dbValues[dbIndices[i_shearModulusRatio+i]];
+        const PylithScalar shearModulusI = shearModulusRatio * shearModulus;
+        valueSubfield[i] = (shearModulusI > 0.0) ? viscosity / shearModulusI : PYLITH_MAXSCALAR;
+        ratioSum += shearModulusRatio;
 
-    const PylithReal shearModulus2 = shearModulusRatio2 * shearModulus;
-    valueSubfield[1] = (shearModulus2 > 0.0) ? viscosity2 / shearModulus2 : PYLITH_MAXSCALAR;
+        code |= (viscosity <= 0 ? (0x4 << i) : 0) | (shearModulusRatio <= 0 ? (0x20 << i) : 0);
+    } // for
+    code |= (ratioSum > 1 ? 0x100 : 0);
 
-    const PylithReal shearModulus3 = shearModulusRatio3 * shearModulus;
-    valueSubfield[2] = (shearModulus3 > 0.0) ? viscosity3 / shearModulus3 : PYLITH_MAXSCALAR;
+    return code;
+} // vmToGeneralizedMaxwellTimes
+
+
+// ------------------------------------------------------------------------------------------------
+// Create error message for failed conversion to Maxwell times for generalized Maxwell model.
+std::string
+pylith::materials::_Query::vmToGeneralizedMaxwellTimesMsg(const int code,
+                                                          const PylithInt numComponents,
+                                                          const double dbValues[],
+                                                          const PylithInt dbIndices[]) {
+    const PylithScalar density = dbValues[dbIndices[0]];
+    const PylithScalar vs = dbValues[dbIndices[1]];
 
     std::ostringstream msg;
-    if (density <= 0) {
+    if (code & 0x1) {
         msg << "Found negative density (" << density << ").";
     } // if
-    if (vs <= 0) {
+    if (code & 0x2) {
         msg << "Found negative shear wave speed (" << vs << ").";
     } // if
-    if (viscosity1 <= 0) {
-        msg << "Found nonpositive viscosity 1 (" << viscosity1 << ").";
-    } // if
-    if (viscosity2 <= 0) {
-        msg << "Found nonpositive viscosity 2 (" << viscosity2 << ").";
-    } // if
-    if (viscosity3 <= 0) {
-        msg << "Found nonpositive viscosity 3 (" << viscosity3 << ").";
-    } // if
-    if (shearModulusRatio1 <= 0) {
-        msg << "Found negative shear modulus ratio 1 (" << shearModulusRatio1 << ").";
-    } // if
-    if (shearModulusRatio2 <= 0) {
-        msg << "Found negative shear modulus ratio 2 (" << shearModulusRatio2 << ").";
-    } // if
-    if (shearModulusRatio3 <= 0) {
-        msg << "Found negative shear modulus ratio 3 (" << shearModulusRatio3 << ").";
-    } // if
-
-    const double ratioSum = shearModulusRatio1 + shearModulusRatio2 + shearModulusRatio3;
-    if (ratioSum > 1) {
-        msg << "Shear ratio sum greater than one (" << ratioSum << ").";
-        msg << " Shear ratios are " << shearModulusRatio1 << ", " << shearModulusRatio2 << ", " << shearModulusRatio3
-            << ".";
-    } // if
+    for (int i = 0; i < 3; ++i) {
+        if (code & (0x4 << i)) {
+            msg << "Found nonpositive viscosity " << i+1 << " (" << dbValues[dbIndices[2+i]] << ").";
+        } // if
+    } // for
+    const size_t i_shearModulusRatio = 5;
+    msg << _Query::vmToGeneralizedMaxwellShearModulusRatiosMsg(code >> 5, numComponents, dbValues, &dbIndices[i_shearModulusRatio]);
 
-    PYLITH_METHOD_RETURN(msg.str());
-} // vmToGeneralizedMaxwellTimes
+    return msg.str();
+} // vmToGeneralizedMaxwellTimesMsg
 
 
 // ------------------------------------------------------------------------------------------------
-// Compute Maxwell time for generalized Maxwell model (3 elements).
-std::string
+// Set shear modulus ratios for generalized Maxwell model (3 elements).
+int
 pylith::materials::_Query::vmToGeneralizedMaxwellShearModulusRatios(PylithScalar valueSubfield[],
                                                                     const PylithInt numComponents,
-                                                                    const pylith::scalar_array dbValues,
-                                                                    const pylith::int_array dbIndices) {
-    PYLITH_METHOD_BEGIN;
-
-    const size_t _numComponents = 3;
-
+                                                                    const double dbValues[],
+                                                                    const PylithInt dbIndices[]) {
     assert(valueSubfield);
-    assert(_numComponents == size_t(numComponents));
-    assert(3 == dbIndices.size());
+    assert(3 == numComponents);
+    assert(dbValues);
+    assert(dbIndices);
+
+    int code = 0;
+    PylithScalar ratioSum = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        const PylithScalar shearModulusRatio = valueSubfield[i] = dbValues[dbIndices[i]];
+        ratioSum += shearModulusRatio;
+        code |= (shearModulusRatio <= 0 ? (0x1 << i) : 0);
+    } // for
+    code |= (ratioSum > 1 ? 0x8 : 0);
+
+    return code;
+} // vmToGeneralizedMaxwellShearModulusRatios
 
-    const size_t i_shearModulusRatio = 0;assert(size_t(dbIndices[i_shearModulusRatio+2]) < dbValues.size());
 
-    const PylithScalar shearModulusRatio1 = valueSubfield[0] = dbValues[dbIndices[i_shearModulusRatio+0]];
-    const PylithScalar shearModulusRatio2 = valueSubfield[1] = dbValues[dbIndices[i_shearModulusRatio+1]];
-    const PylithScalar shearModulusRatio3 = valueSubfield[2] = dbValues[dbIndices[i_shearModulusRatio+2]];
+// ------------------------------------------------------------------------------------------------
+// Create error message for failed shear modulus ratios for generalized Maxwell model.
+std::string
+pylith::materials::_Query::vmToGeneralizedMaxwellShearModulusRatiosMsg(const int code,
+                                                                       const PylithInt numComponents,
+                                                                       const double dbValues[],
+                                                                       const PylithInt dbIndices[]) {
+    const PylithScalar shearModulusRatio1 = dbValues[dbIndices[0]];
+    const PylithScalar shearModulusRatio2 = dbValues[dbIndices[1]];
+    const PylithScalar shearModulusRatio3 = dbValues[dbIndices[2]];
 
     std::ostringstream msg;
-    if (shearModulusRatio1 <= 0) {
+    if (code & 0x1) {
         msg << "Found negative shear modulus ratio 1 (" << shearModulusRatio1 << ").";
     } // if
-    if (shearModulusRatio2 <= 0) {
+    if (code & 0x2) {
         msg << "Found negative shear modulus ratio 2 (" << shearModulusRatio2 << ").";
     } // if
-    if (shearModulusRatio3 <= 0) {
+    if (code & 0x4) {
         msg << "Found negative shear modulus ratio 3 (" << shearModulusRatio3 << ").";
     } // if
-    const double ratioSum = shearModulusRatio1 + shearModulusRatio2 + shearModulusRatio3;
-    if (ratioSum > 1) {
+    if (code & 0x8) {
+        const double ratioSum = shearModulusRatio1 + shearModulusRatio2 + shearModulusRatio3;
         msg << "Shear ratio sum greater than one (" << ratioSum << ").";
         msg << " Shear ratios are " << shearModulusRatio1 << ", " << shearModulusRatio2 << ", " << shearModulusRatio3
             << ".";
     } // if
 
-    PYLITH_METHOD_RETURN(msg.str());
-} // vmToGeneralizedMaxwellShearModulusRatios
+    return msg.str();
+} // vmToGeneralizedMaxwellShearModulusRatiosMsg
 
 
 // ------------------------------------------------------------------------------------------------
-// Compute Maxwell time for generalized Maxwell model (3 elements).
-std::string
+// Set gravity field from GravityField spatial database.
+int
 pylith::materials::_Query::dbToGravityField(PylithScalar valueSubfield[],
                                             const PylithInt numComponents,
-                                            const pylith::scalar_array dbValues,
-                                            const pylith::int_array dbIndices) {
-    PYLITH_METHOD_BEGIN;
-
-    const size_t spaceDim = dbIndices.size();
-
+                                            const double dbValues[],
+                                            const PylithInt dbIndices[]) {
     assert(valueSubfield);
-    assert(spaceDim == size_t(numComponents));
+    assert(dbValues);
+    assert(dbIndices);
 
-    for (size_t i = 0; i < spaceDim; ++i) {
-        assert(size_t(dbIndices[i]) < dbValues.size());
+    PylithScalar mag = 0.0;
+    for (PylithInt i = 0; i < numComponents; ++i) {
         valueSubfield[i] = dbValues[dbIndices[i]];
+        mag += valueSubfield[i] * valueSubfield[i];
     } // for
+    const PylithReal tolerance = 1.0e-6;
 
+    return (mag < tolerance) ? 0x1 : 0;
+} // dbToGravityField
+
+
+// ------------------------------------------------------------------------------------------------
+// Create error message for failed gravity field.
+std::string
+pylith::materials::_Query::dbToGravityFieldMsg(const int code,
+                                               const PylithInt numComponents,
+                                               const double dbValues[],
+                                               const PylithInt dbIndices[]) {
     PylithScalar mag = 0.0;
-    for (size_t i = 0; i < spaceDim; ++i) {
-        mag += valueSubfield[i] * valueSubfield[i];
+    for (PylithInt i = 0; i < numComponents; ++i) {
+        mag += dbValues[dbIndices[i]] * dbValues[dbIndices[i]];
     } // for
-    const PylithReal tolerance = 1.0e-6;
+
     std::ostringstream msg;
-    if (mag < tolerance) {
+    if (code & 0x1) {
         msg << "Found near zero magnitude (" << mag << ") for gravity field vector (";
-        for (size_t i = 0; i < spaceDim; ++i) {
-            msg << "  " << valueSubfield[i];
+        for (PylithInt i = 0; i < numComponents; ++i) {
+            msg << "  " << dbValues[dbIndices[i]];
         } // for
         msg << ").";
     } // if
 
-    PYLITH_METHOD_RETURN(msg.str());
-} // dbToGravityField
+    return msg.str();
+} // dbToGravityFieldMsg
 
 
 // ------------------------------------------------------------------------------------------------
 // Compute Biot's modulus from Biot's coefficient, solid grain bulk moduls,
 // fluid bulk modulus, and porosity
-std::string
+int
 pylith::materials::_Query::inputToBiotModulus(PylithScalar valueSubfield[],
                                               const PylithInt numComponents,
-                                              const pylith::scalar_array dbValues,
-                                              const pylith::int_array dbIndices) {
-    PYLITH_METHOD_BEGIN;
-
-    const size_t _numComponents = 1;
-
+                                              const double dbValues[],
+                                              const PylithInt dbIndices[]) {
     assert(valueSubfield);
-    assert(_numComponents == size_t(numComponents));
-    assert(4 == dbIndices.size());
+    assert(1 == numComponents);
+    assert(dbValues);
+    assert(dbIndices);
 
-    const size_t i_fluid_bulk_modulus = 0;assert(size_t(dbIndices[i_fluid_bulk_modulus]) < dbValues.size());
-    const size_t i_solid_bulk_modulus = 1;assert(size_t(dbIndices[i_solid_bulk_modulus]) < dbValues.size());
-    const size_t i_biot_coefficient = 2;assert(size_t(dbIndices[i_biot_coefficient]) < dbValues.size());
-    const size_t i_porosity = 3;assert(size_t(dbIndices[i_porosity]) < dbValues.size());
+    const size_t i_fluid_bulk_modulus = 0;
+    const size_t i_solid_bulk_modulus = 1;
+    const size_t i_biot_coefficient = 2;
+    const size_t i_porosity = 3;
 
     const PylithScalar fluid_bulk_modulus = dbValues[dbIndices[i_fluid_bulk_modulus]];
     const PylithScalar solid_bulk_modulus = dbValues[dbIndices[i_solid_bulk_modulus]];
     const PylithScalar biot_coefficient = dbValues[dbIndices[i_biot_coefficient]];
     const PylithScalar porosity = dbValues[dbIndices[i_porosity]];
 
-    valueSubfield[0] = 1.0 / ( porosity / fluid_bulk_modulus + (biot_coefficient - porosity) / solid_bulk_modulus );
+    const PylithScalar biot_modulus = 1.0 / ( porosity / fluid_bulk_modulus + (biot_coefficient - porosity) / solid_bulk_modulus );
+    valueSubfield[0] = biot_modulus;
+
+    return (porosity < 0 ? 0x1 : 0) | (biot_coefficient <= 0 ? 0x2 : 0) | (biot_modulus <= 0 ? 0x4 : 0);
+} // inputToBiotModulus
+
+
+// ------------------------------------------------------------------------------------------------
+// Create error message for failed conversion to Biot's modulus.
+std::string
+pylith::materials::_Query::inputToBiotModulusMsg(const int code,
+                                                 const PylithInt numComponents,
+                                                 const double dbValues[],
+                                                 const PylithInt dbIndices[]) {
+    const PylithScalar fluid_bulk_modulus = dbValues[dbIndices[0]];
+    const PylithScalar solid_bulk_modulus = dbValues[dbIndices[1]];
+    const PylithScalar biot_coefficient = dbValues[dbIndices[2]];
+    const PylithScalar porosity = dbValues[dbIndices[3]];
 
     std::ostringstream msg;
-    if (porosity < 0) {
+    if (code & 0x1) {
         msg << "Found negative porosity (" << porosity << ").";
     } // if
-    if (biot_coefficient <= 0) {
+    if (code & 0x2) {
         msg << "Found negative biot coefficient (" << biot_coefficient << ").";
     } // if
-
-    // Debug
-    PylithScalar biot_modulus = 1.0 / ( porosity / fluid_bulk_modulus + (biot_coefficient - porosity) / solid_bulk_modulus );
-    if (biot_modulus <= 0) {
+    if (code & 0x4) {
+        const PylithScalar biot_modulus = 1.0 / ( porosity / fluid_bulk_modulus + (biot_coefficient - porosity) / solid_bulk_modulus );
         msg << "biot modulus (" << biot_modulus << ") wrong. Kfl: " << fluid_bulk_modulus << " Ksg: " << solid_bulk_modulus << " phi: " << porosity << " alpha: " << biot_coefficient;
     } // if
 
-    PYLITH_METHOD_RETURN(msg.str());
-} // inputToBiotModulus
+    return msg.str();
+} // inputToBiotModulusMsg
 
 
 // End of file
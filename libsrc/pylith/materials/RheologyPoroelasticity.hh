@@ -139,6 +139,11 @@ public:
     virtual
     PetscPointJac getKernelJf0pp(const spatialdata::geocoords::CoordSys* coordsys) const = 0;
 
+    // ---------------------------------------------------------------------------------------------------------------------
+    // Get specific storage kernel with fixed-stress stabilization for LHS Jacobian preconditioner F(t,s, \dot{s}).
+    virtual
+    PetscPointJac getKernelJf0ppFixedStress(const spatialdata::geocoords::CoordSys* coordsys) const = 0;
+
     // ---------------------------------------------------------------------------------------------------------------------
     // Get Darcy Conductivity kernel for LHS Jacobian
     virtual
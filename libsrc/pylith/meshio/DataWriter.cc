@@ -22,6 +22,7 @@
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/MeshOps.hh" // USES isCohesiveCell()
+#include "pylith/topology/VisitorSubmesh.hh" // USES SubmeshIS
 
 #include "pylith/utils/error.hh" \
     // USES PYLITH_METHOD_BEGIN/END
@@ -181,24 +182,16 @@ pylith::meshio::DataWriter::getCoordsGlobalVec(PetscVec* coordsGlobalVec,
     err = DMPlexGetSubpointMap(dmMesh,  &subpointMap);PYLITH_CHECK_ERROR(err);
     err = DMPlexGetSubpointMap(dmCoord, &subpointMapF);PYLITH_CHECK_ERROR(err);
     if (((dim != dimF) || ((pEnd-pStart) < (qEnd-qStart))) && subpointMap && !subpointMapF) {
-        const PylithInt *indices = NULL;
-        PetscIS subpointIS = NULL;
-        PylithInt n = 0;
-
         err = PetscSectionGetChart(section, &qStart, &qEnd);PYLITH_CHECK_ERROR(err);
-        err = DMPlexGetSubpointIS(dmMesh, &subpointIS);PYLITH_CHECK_ERROR(err);
-        if (subpointIS) {
-            err = ISGetLocalSize(subpointIS, &n);PYLITH_CHECK_ERROR(err);
-            err = ISGetIndices(subpointIS, &indices);PYLITH_CHECK_ERROR(err);
-        } // if
         err = PetscSectionCreate(mesh.getComm(), &subSection);PYLITH_CHECK_ERROR(err);
         err = PetscSectionSetChart(subSection, pStart, pEnd);PYLITH_CHECK_ERROR(err);
+        pylith::topology::SubmeshIS submeshIS(mesh);
         for (PylithInt q = qStart; q < qEnd; ++q) {
-            PylithInt dof, off, p;
+            PylithInt dof, off;
 
             err = PetscSectionGetDof(section, q, &dof);PYLITH_CHECK_ERROR(err);
             if (dof) {
-                err = PetscFindInt(q, n, indices, &p);PYLITH_CHECK_ERROR(err);
+                const PylithInt p = submeshIS.subpoint(q);
                 if ((p >= pStart) && (p < pEnd)) {
                     err = PetscSectionSetDof(subSection, p, dof);PYLITH_CHECK_ERROR(err);
                     err = PetscSectionGetOffset(section, q, &off);PYLITH_CHECK_ERROR(err);
@@ -206,9 +199,6 @@ pylith::meshio::DataWriter::getCoordsGlobalVec(PetscVec* coordsGlobalVec,
                 } // if
             } // if
         } // for
-        if (subpointIS) {
-            err = ISRestoreIndices(subpointIS, &indices);PYLITH_CHECK_ERROR(err);
-        } // if
           /* No need to setup section */
         section = subSection;
         /* There are no excludes for surface meshes */
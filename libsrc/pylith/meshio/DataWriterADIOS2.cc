@@ -0,0 +1,672 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "DataWriterADIOS2.hh" // Implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES isCohesiveCell()
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <adios2.h> // USES adios2::ADIOS, adios2::IO, adios2::Engine
+
+#include <algorithm> // USES std::min()
+#include <strings.h> // USES strcasecmp()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+/// ADIOS2 objects.
+struct pylith::meshio::DataWriterADIOS2::Handles {
+    adios2::ADIOS adios; ///< ADIOS2 instance.
+    adios2::IO io; ///< Group of variables and attributes with engine settings.
+    adios2::Engine engine; ///< Engine for writing file or stream.
+
+    Handles(MPI_Comm comm) :
+        adios(comm) {}
+
+}; // Handles
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _DataWriterADIOS2 {
+public:
+
+            /** Get VTK cell type for PETSc cell type.
+             *
+             * @param[in] cellType PETSc cell type.
+             * @returns VTK cell type.
+             */
+            static
+            uint32_t vtkCellType(const DMPolytopeType cellType);
+
+            /** Get variable, defining it as a local array if it does not exist.
+             *
+             * @param[inout] io ADIOS2 IO object.
+             * @param[in] name Name of variable.
+             * @param[in] numPoints Number of points in local block.
+             * @param[in] numComponents Number of components at each point.
+             * @returns ADIOS2 variable.
+             */
+            template<typename T>
+            static
+            adios2::Variable<T> localArray(adios2::IO& io,
+                                           const std::string& name,
+                                           const size_t numPoints,
+                                           const size_t numComponents);
+
+            /** Get variable, defining it as a local value if it does not exist.
+             *
+             * @param[inout] io ADIOS2 IO object.
+             * @param[in] name Name of variable.
+             * @returns ADIOS2 variable.
+             */
+            template<typename T>
+            static
+            adios2::Variable<T> localValue(adios2::IO& io,
+                                           const std::string& name);
+
+            static const char* engines[3]; ///< Supported ADIOS2 engines.
+            static const size_t numEngines; ///< Number of supported ADIOS2 engines.
+
+        }; // _DataWriterADIOS2
+        const char* _DataWriterADIOS2::engines[3] = { "BP5", "BP4", "SST" };
+        const size_t _DataWriterADIOS2::numEngines = 3;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Get variable, defining it as a local array if it does not exist.
+template<typename T>
+adios2::Variable<T>
+pylith::meshio::_DataWriterADIOS2::localArray(adios2::IO& io,
+                                              const std::string& name,
+                                              const size_t numPoints,
+                                              const size_t numComponents) {
+    const adios2::Dims count = (numComponents > 1) ? adios2::Dims({ numPoints, numComponents }) : adios2::Dims({ numPoints });
+    adios2::Variable<T> variable = io.InquireVariable<T>(name);
+    if (!variable) {
+        variable = io.DefineVariable<T>(name, {}, {}, count, adios2::ConstantDims);
+    } // if
+    return variable;
+} // localArray
+
+
+// ------------------------------------------------------------------------------------------------
+// Get variable, defining it as a local value if it does not exist.
+template<typename T>
+adios2::Variable<T>
+pylith::meshio::_DataWriterADIOS2::localValue(adios2::IO& io,
+                                              const std::string& name) {
+    adios2::Variable<T> variable = io.InquireVariable<T>(name);
+    if (!variable) {
+        variable = io.DefineVariable<T>(name, { adios2::LocalValueDim });
+    } // if
+    return variable;
+} // localValue
+
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::DataWriterADIOS2::DataWriterADIOS2(void) :
+    _filename("output.bp"),
+    _engine("BP5"),
+    _adios(NULL),
+    _dm(NULL),
+    _commRank(0),
+    _tstamp(0.0),
+    _numTimeSteps(0),
+    _isOpenTimeStep(false) {
+    PyreComponent::setName("datawriteradios2");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::DataWriterADIOS2::~DataWriterADIOS2(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::DataWriterADIOS2::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    closeTimeStep(); // Insure time step is closed.
+    close(); // Insure clean up.
+    DataWriter::deallocate();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::DataWriterADIOS2::DataWriterADIOS2(const DataWriterADIOS2& w) :
+    DataWriter(w),
+    _filename(w._filename),
+    _engine(w._engine),
+    _engineParameters(w._engineParameters),
+    _adios(NULL),
+    _dm(NULL),
+    _commRank(0),
+    _tstamp(0.0),
+    _numTimeSteps(0),
+    _isOpenTimeStep(false) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Set ADIOS2 engine.
+void
+pylith::meshio::DataWriterADIOS2::setEngine(const char* value) {
+    PYLITH_METHOD_BEGIN;
+    assert(value);
+
+    for (size_t i = 0; i < _DataWriterADIOS2::numEngines; ++i) {
+        if (0 == strcasecmp(value, _DataWriterADIOS2::engines[i])) {
+            _engine = _DataWriterADIOS2::engines[i];
+            PYLITH_METHOD_END;
+        } // if
+    } // for
+
+    std::ostringstream msg;
+    msg << "Unknown ADIOS2 engine '" << value << "'. Supported engines are:";
+    for (size_t i = 0; i < _DataWriterADIOS2::numEngines; ++i) {
+        msg << " " << _DataWriterADIOS2::engines[i];
+    } // for
+    msg << ".";
+    throw std::runtime_error(msg.str());
+
+    PYLITH_METHOD_END;
+} // setEngine
+
+
+// ------------------------------------------------------------------------------------------------
+// Set parameter of ADIOS2 engine.
+void
+pylith::meshio::DataWriterADIOS2::setEngineParameter(const char* key,
+                                                     const char* value) {
+    assert(key);
+    assert(value);
+
+    _engineParameters[key] = value;
+} // setEngineParameter
+
+
+// ------------------------------------------------------------------------------------------------
+// Prepare for writing files.
+void
+pylith::meshio::DataWriterADIOS2::open(const pylith::topology::Mesh& mesh,
+                                       const bool isInfo) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriter::open(mesh, isInfo);
+
+    // Save handle for actions required in closeTimeStep() and close();
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+    _dm = mesh.getDM();assert(_dm);
+    err = PetscObjectReference((PetscObject) _dm);PYLITH_CHECK_ERROR(err);
+
+    MPI_Comm comm = mesh.getComm();
+    err = MPI_Comm_rank(comm, &_commRank);PYLITH_CHECK_ERROR(err);
+
+    _setupGeometry(mesh);
+    _numTimeSteps = 0;
+
+    const std::string& filename = _adios2Filename();
+    try {
+        delete _adios;_adios = new Handles(comm);
+        _adios->io = _adios->adios.DeclareIO("pylith");
+        _adios->io.SetEngine(_engine);
+        for (std::map<std::string, std::string>::const_iterator iter = _engineParameters.begin(); iter != _engineParameters.end(); ++iter) {
+            _adios->io.SetParameter(iter->first, iter->second);
+        } // for
+        _adios->engine = _adios->io.Open(filename, adios2::Mode::Write);
+    } catch (const std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while opening ADIOS2 " << _engine << " output '" << filename << "'.\n" << err.what();
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close output files.
+void
+pylith::meshio::DataWriterADIOS2::close(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_adios) {
+        try {
+            if (_adios->engine) {
+                _adios->engine.Close();
+            } // if
+        } catch (const std::exception& err) {
+            std::ostringstream msg;
+            msg << "Error while closing ADIOS2 " << _engine << " output '" << _adios2Filename() << "'.\n" << err.what();
+            delete _adios;_adios = NULL;
+            throw std::runtime_error(msg.str());
+        } // try/catch
+        delete _adios;_adios = NULL;
+    } // if
+
+    if (_isOpen) {
+        assert(_dm);
+        PetscErrorCode err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    _vertices.clear();
+    _cells.clear();
+    _coordinates.clear();
+    _connectivity.clear();
+    _cellTypes.clear();
+
+    DataWriter::close();
+
+    PYLITH_METHOD_END;
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Prepare file for data at a new time step.
+void
+pylith::meshio::DataWriterADIOS2::openTimeStep(const PylithScalar t,
+                                               const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_dm && _dm == mesh.getDM());
+    assert(_isOpen && !_isOpenTimeStep);
+
+    _tstamp = t * _timeScale;
+    _vertexFields.clear();
+    _cellFields.clear();
+
+    _isOpenTimeStep = true;
+
+    PYLITH_METHOD_END;
+} // openTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+/// Cleanup after writing data for a time step.
+void
+pylith::meshio::DataWriterADIOS2::closeTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_isOpenTimeStep) {
+        assert(_adios);
+        try {
+            _adios->engine.BeginStep();
+            if (!_numTimeSteps) {
+                _defineSchema();
+            } // if
+            if (!_numTimeSteps || (_engine == "SST")) {
+                _writeGeometry();
+            } // if
+
+            adios2::Variable<PylithScalar> timeVar = _adios->io.InquireVariable<PylithScalar>("time");
+            if (!timeVar) {
+                timeVar = _adios->io.DefineVariable<PylithScalar>("time");
+            } // if
+            if (0 == _commRank) {
+                _adios->engine.Put(timeVar, _tstamp, adios2::Mode::Sync);
+            } // if
+            _writeFields(_vertexFields);
+            _writeFields(_cellFields);
+
+            // Values are held in the data arrays until the engine processes the deferred writes in EndStep().
+            _adios->engine.EndStep();
+        } catch (const std::exception& err) {
+            std::ostringstream msg;
+            msg << "Error while writing time step " << _tstamp << " to ADIOS2 " << _engine << " output '"
+                << _adios2Filename() << "'.\n" << err.what();
+            _isOpenTimeStep = false;
+            throw std::runtime_error(msg.str());
+        } // try/catch
+        ++_numTimeSteps;
+    } // if
+
+    _vertexFields.clear();
+    _cellFields.clear();
+    _isOpenTimeStep = false;
+
+    PYLITH_METHOD_END;
+} // closeTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Write field over vertices to file.
+void
+pylith::meshio::DataWriterADIOS2::writeVertexField(const PylithScalar t,
+                                                   const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+    assert(_isOpen && _isOpenTimeStep);
+
+    _vertexFields.push_back(DataArray());
+    _extractValues(&_vertexFields.back(), subfield, _vertices);
+
+    PYLITH_METHOD_END;
+} // writeVertexField
+
+
+// ------------------------------------------------------------------------------------------------
+// Write field over cells to file.
+void
+pylith::meshio::DataWriterADIOS2::writeCellField(const PylithScalar t,
+                                                 const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+    assert(_isOpen && _isOpenTimeStep);
+
+    _cellFields.push_back(DataArray());
+    _extractValues(&_cellFields.back(), subfield, _cells);
+
+    PYLITH_METHOD_END;
+} // writeCellField
+
+
+// ------------------------------------------------------------------------------------------------
+// Generate name of ADIOS2 file or stream.
+std::string
+pylith::meshio::DataWriterADIOS2::_adios2Filename(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    std::ostringstream filename;
+    if (DataWriter::_isInfo) {
+        const size_t indexExt = _filename.rfind(".bp");
+        filename << ((indexExt != std::string::npos) ? std::string(_filename, 0, indexExt) : _filename) << "_info.bp";
+    } else {
+        filename << _filename;
+    } // if/else
+
+    PYLITH_METHOD_RETURN(std::string(filename.str()));
+} // _adios2Filename
+
+
+// ------------------------------------------------------------------------------------------------
+// Gather topology and geometry of cells owned by this process.
+void
+pylith::meshio::DataWriterADIOS2::_setupGeometry(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dm = mesh.getDM();assert(dm);
+    PetscErrorCode err = PETSC_SUCCESS;
+
+    PetscInt pStart = 0, pEnd = 0, cStart = 0, cEnd = 0, vStart = 0, vEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    const bool isPointMesh = (cStart == vStart) && (cEnd == vEnd);
+
+    // Points shared with other processes that are owned by another process are leaves of the point SF.
+    std::vector<bool> isGhost(pEnd-pStart, false);
+    PetscSF sf = NULL;
+    PetscInt numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sf, NULL, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        const PetscInt point = leaves ? leaves[iLeaf] : iLeaf;
+        isGhost[point-pStart] = true;
+    } // for
+
+    std::vector<PylithInt> vertexIndex(vEnd-vStart, -1);
+    _vertices.clear();
+    _cells.clear();
+    _connectivity.clear();
+    _cellTypes.clear();
+
+    PetscInt cellVertices[64];
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        if (!isPointMesh && pylith::topology::MeshOps::isCohesiveCell(dm, cell)) { break; }
+        if (isGhost[cell-pStart]) { continue; }
+
+        PetscInt numCellVertices = 0;
+        DMPolytopeType cellType = DM_POLYTOPE_POINT;
+        if (isPointMesh) {
+            cellVertices[numCellVertices++] = cell;
+        } else {
+            PetscInt closureSize = 0;
+            PetscInt* closure = NULL;
+            err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iPoint = 0; iPoint < 2*closureSize; iPoint += 2) {
+                const PetscInt point = closure[iPoint];
+                if ((point >= vStart) && (point < vEnd)) {
+                    assert(numCellVertices < 64);
+                    cellVertices[numCellVertices++] = point;
+                } // if
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetCellType(dm, cell, &cellType);PYLITH_CHECK_ERROR(err);
+            // VTK ordering of vertices is inverted with respect to PETSc.
+            err = DMPlexInvertCell(cellType, cellVertices);PYLITH_CHECK_ERROR(err);
+        } // if/else
+
+        _connectivity.push_back(numCellVertices);
+        for (PetscInt iVertex = 0; iVertex < numCellVertices; ++iVertex) {
+            PylithInt& index = vertexIndex[cellVertices[iVertex]-vStart];
+            if (index < 0) {
+                index = _vertices.size();
+                _vertices.push_back(cellVertices[iVertex]);
+            } // if
+            _connectivity.push_back(index);
+        } // for
+        _cells.push_back(cell);
+        _cellTypes.push_back(_DataWriterADIOS2::vtkCellType(cellType));
+    } // for
+
+    // Coordinates of vertices (dimensioned, padded to 3 components).
+    PetscVec coordinatesVec = NULL;
+    PetscSection coordinatesSection = NULL;
+    PetscInt spaceDim = 0;
+    PylithReal lengthScale = 1.0;
+    err = DMGetCoordinatesLocal(dm, &coordinatesVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinateSection(dm, &coordinatesSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinateDim(dm, &spaceDim);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+
+    const size_t numVertices = _vertices.size();
+    _coordinates.assign(numVertices*3, 0.0);
+    const PetscScalar* coordinatesArray = NULL;
+    err = VecGetArrayRead(coordinatesVec, &coordinatesArray);PYLITH_CHECK_ERROR(err);
+    for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+        PetscInt off = 0;
+        err = PetscSectionGetOffset(coordinatesSection, _vertices[iVertex], &off);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            _coordinates[iVertex*3+iDim] = coordinatesArray[off+iDim] * lengthScale;
+        } // for
+    } // for
+    err = VecRestoreArrayRead(coordinatesVec, &coordinatesArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupGeometry
+
+
+// ------------------------------------------------------------------------------------------------
+// Extract values of subfield at local vertices or cells.
+void
+pylith::meshio::DataWriterADIOS2::_extractValues(DataArray* array,
+                                                 const pylith::meshio::OutputSubfield& subfield,
+                                                 const std::vector<PylithInt>& points) {
+    PYLITH_METHOD_BEGIN;
+    assert(array);
+
+    const pylith::topology::FieldBase::Description& description = subfield.getDescription();
+    const int numComponents = description.numComponents;
+    array->name = description.label;
+    array->numComponents = ((description.vectorFieldType == pylith::topology::FieldBase::VECTOR) && (numComponents < 3)) ?
+                           3 : numComponents;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dmSubfield = subfield.getDM();assert(dmSubfield);
+    PetscVec localVec = NULL;
+    err = DMGetLocalVector(dmSubfield, &localVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmSubfield, subfield.getVector(), INSERT_VALUES, localVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSubfield, subfield.getVector(), INSERT_VALUES, localVec);PYLITH_CHECK_ERROR(err);
+    PetscSection section = NULL;
+    err = DMGetLocalSection(dmSubfield, &section);PYLITH_CHECK_ERROR(err);
+
+    const size_t numPoints = points.size();
+    array->values.assign(numPoints*array->numComponents, 0.0);
+    const PetscScalar* valuesArray = NULL;
+    err = VecGetArrayRead(localVec, &valuesArray);PYLITH_CHECK_ERROR(err);
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        PetscInt dof = 0, off = 0;
+        err = PetscSectionGetDof(section, points[iPoint], &dof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(section, points[iPoint], &off);PYLITH_CHECK_ERROR(err);
+        const PetscInt numValues = std::min(dof, PetscInt(array->numComponents));
+        for (PetscInt iComponent = 0; iComponent < numValues; ++iComponent) {
+            array->values[iPoint*array->numComponents+iComponent] = valuesArray[off+iComponent];
+        } // for
+    } // for
+    err = VecRestoreArrayRead(localVec, &valuesArray);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSubfield, &localVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _extractValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Write topology and geometry of cells owned by this process for current time step.
+void
+pylith::meshio::DataWriterADIOS2::_writeGeometry(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_adios);
+
+    adios2::IO& io = _adios->io;
+    adios2::Engine& engine = _adios->engine;
+
+    const uint64_t numVertices = _vertices.size();
+    const uint64_t numCells = _cells.size();
+    engine.Put(_DataWriterADIOS2::localValue<uint64_t>(io, "NumOfVertices"), numVertices, adios2::Mode::Sync);
+    engine.Put(_DataWriterADIOS2::localValue<uint64_t>(io, "NumOfCells"), numCells, adios2::Mode::Sync);
+    if (numCells > 0) {
+        engine.Put(_DataWriterADIOS2::localArray<PylithScalar>(io, "vertices", numVertices, 3), _coordinates.data());
+        engine.Put(_DataWriterADIOS2::localArray<int64_t>(io, "connectivity", _connectivity.size(), 1), _connectivity.data());
+        engine.Put(_DataWriterADIOS2::localArray<uint32_t>(io, "types", numCells, 1), _cellTypes.data());
+    } // if
+
+    PYLITH_METHOD_END;
+} // _writeGeometry
+
+
+// ------------------------------------------------------------------------------------------------
+// Write fields for current time step.
+void
+pylith::meshio::DataWriterADIOS2::_writeFields(const std::vector<DataArray>& fields) {
+    PYLITH_METHOD_BEGIN;
+    assert(_adios);
+
+    for (size_t i = 0; i < fields.size(); ++i) {
+        const DataArray& array = fields[i];
+        if (array.values.empty()) { continue; }
+
+        const size_t numPoints = array.values.size() / array.numComponents;
+        adios2::Variable<PylithScalar> variable =
+            _DataWriterADIOS2::localArray<PylithScalar>(_adios->io, array.name, numPoints, array.numComponents);
+        _adios->engine.Put(variable, array.values.data());
+    } // for
+
+    PYLITH_METHOD_END;
+} // _writeFields
+
+
+// ------------------------------------------------------------------------------------------------
+// Define VTX schema attribute describing the variables.
+void
+pylith::meshio::DataWriterADIOS2::_defineSchema(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_adios);
+
+    std::ostringstream xml;
+    xml << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\">\n"
+        << "  <UnstructuredGrid>\n"
+        << "    <Piece NumberOfPoints=\"NumOfVertices\" NumberOfCells=\"NumOfCells\">\n"
+        << "      <Points>\n"
+        << "        <DataArray Name=\"vertices\" />\n"
+        << "      </Points>\n"
+        << "      <Cells>\n"
+        << "        <DataArray Name=\"connectivity\" />\n"
+        << "        <DataArray Name=\"types\" />\n"
+        << "      </Cells>\n"
+        << "      <PointData>\n";
+    for (size_t i = 0; i < _vertexFields.size(); ++i) {
+        xml << "        <DataArray Name=\"" << _vertexFields[i].name << "\" />\n";
+    } // for
+    xml << "        <DataArray Name=\"TIME\">time</DataArray>\n"
+        << "      </PointData>\n"
+        << "      <CellData>\n";
+    for (size_t i = 0; i < _cellFields.size(); ++i) {
+        xml << "        <DataArray Name=\"" << _cellFields[i].name << "\" />\n";
+    } // for
+    xml << "      </CellData>\n"
+        << "    </Piece>\n"
+        << "  </UnstructuredGrid>\n"
+        << "</VTKFile>\n";
+    _adios->io.DefineAttribute<std::string>("vtk.xml", xml.str());
+
+    PYLITH_METHOD_END;
+} // _defineSchema
+
+
+// ------------------------------------------------------------------------------------------------
+// Get VTK cell type for PETSc cell type.
+uint32_t
+pylith::meshio::_DataWriterADIOS2::vtkCellType(const DMPolytopeType cellType) {
+    uint32_t vtkType = 0;
+    switch (cellType) {
+    case DM_POLYTOPE_POINT:
+        vtkType = 1; // VTK_VERTEX
+        break;
+    case DM_POLYTOPE_SEGMENT:
+        vtkType = 3; // VTK_LINE
+        break;
+    case DM_POLYTOPE_TRIANGLE:
+        vtkType = 5; // VTK_TRIANGLE
+        break;
+    case DM_POLYTOPE_QUADRILATERAL:
+        vtkType = 9; // VTK_QUAD
+        break;
+    case DM_POLYTOPE_TETRAHEDRON:
+        vtkType = 10; // VTK_TETRA
+        break;
+    case DM_POLYTOPE_HEXAHEDRON:
+        vtkType = 12; // VTK_HEXAHEDRON
+        break;
+    default: {
+        std::ostringstream msg;
+        msg << "Unsupported cell type '" << DMPolytopeTypes[cellType] << "' for ADIOS2 output.";
+        throw std::logic_error(msg.str());
+    } // default
+    } // switch
+    return vtkType;
+} // vtkCellType
+
+
+// End of file
@@ -0,0 +1,232 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/DataWriterADIOS2.hh
+ *
+ * @brief Object for writing finite-element data using ADIOS2.
+ *
+ * Each process writes the cells it owns (and the vertices in their closure) as local blocks of ADIOS2 variables,
+ * so that the ADIOS2 engine handles aggregation and (optionally asynchronous) writing of the data. The BP engines
+ * write files (FILENAME.bp directories) while the SST engine streams the time steps to staging readers, such as
+ * in-situ analysis or ParaView/Catalyst, without going through the file system.
+ *
+ * The variables follow the ADIOS2 VTX schema for unstructured grids (written as the `vtk.xml` attribute) so that
+ * the output can be read directly by ParaView:
+ *   NumOfVertices - local value with number of vertices in block
+ *   NumOfCells - local value with number of cells in block
+ *   vertices - local array [nvertices, 3]
+ *   connectivity - local array [ncells*(1+ncorners)], number of vertices followed by vertices in each cell
+ *   types - local array [ncells] with VTK cell types
+ *   time - global value with time of time step
+ *   VERTEX_FIELD (name of vertex field) - local array [nvertices, fiberdim]
+ *   CELL_FIELD (name of cell field) - local array [ncells, fiberdim]
+ *
+ * The topology and geometry are written in the first time step for file engines and in every time step for the SST
+ * engine, because staging readers only have access to the time steps they consume.
+ */
+
+#if !defined(pylith_meshio_datawriteradios2_hh)
+#define pylith_meshio_datawriteradios2_hh
+
+// Include directives ---------------------------------------------------
+#include "DataWriter.hh" // ISA DataWriter
+
+#include "pylith/utils/petscfwd.h" // HASA PetscDM
+
+#include <string> // HASA std::string
+#include <map> // HASA std::map
+#include <vector> // HASA std::vector
+#include <cstdint> // HASA uint32_t
+
+// DataWriterADIOS2 -----------------------------------------------------
+/// Object for writing finite-element data using ADIOS2.
+class pylith::meshio::DataWriterADIOS2 : public DataWriter {
+    friend class TestDataWriterADIOS2; // unit testing
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    DataWriterADIOS2(void);
+
+    /// Destructor
+    ~DataWriterADIOS2(void);
+
+    /** Make copy of this object.
+     *
+     * @returns Copy of this.
+     */
+    DataWriter* clone(void) const;
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set filename (BP engines) or stream name (SST engine).
+     *
+     * @param[in] filename Name of ADIOS2 file or stream.
+     */
+    void filename(const char* filename);
+
+    /** Set ADIOS2 engine.
+     *
+     * @param[in] value Name of ADIOS2 engine ("BP5", "BP4", or "SST").
+     */
+    void setEngine(const char* value);
+
+    /** Set parameter of ADIOS2 engine.
+     *
+     * Examples include `NumAggregators` and `AsyncWrite` for the BP5 engine and `RendezvousReaderCount` and
+     * `QueueLimit` for the SST engine.
+     *
+     * @param[in] key Name of parameter.
+     * @param[in] value Value of parameter.
+     */
+    void setEngineParameter(const char* key,
+                            const char* value);
+
+    /** Prepare for writing files.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] isInfo True if only writing info values.
+     */
+    void open(const topology::Mesh& mesh,
+              const bool isInfo);
+
+    /// Close output files.
+    void close(void);
+
+    /** Prepare file for data at a new time step.
+     *
+     * @param[in] t Time stamp for new data
+     * @param[in] mesh Finite-element mesh.
+     */
+    void openTimeStep(const PylithScalar t,
+                      const topology::Mesh& mesh);
+
+    /// Cleanup after writing data for a time step.
+    void closeTimeStep(void);
+
+    /** Write field over vertices to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 1.
+     */
+    void writeVertexField(const PylithScalar t,
+                          const pylith::meshio::OutputSubfield& field);
+
+    /** Write field over cells to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 0.
+     */
+    void writeCellField(const PylithScalar t,
+                        const pylith::meshio::OutputSubfield& subfield);
+
+    // PRIVATE STRUCTS //////////////////////////////////////////////////////
+private:
+
+    struct DataArray {
+        std::string name; ///< Name of field.
+        int numComponents; ///< Number of components in output.
+        std::vector<PylithScalar> values; ///< Values at local vertices or cells [numPoints*numComponents].
+    };
+
+    struct Handles; ///< ADIOS2 objects (hides ADIOS2 header from interface).
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Copy constructor.
+     *
+     * @param[in] w Object to copy.
+     */
+    DataWriterADIOS2(const DataWriterADIOS2& w);
+
+    /** Generate name of ADIOS2 file or stream.
+     *
+     * Appends _info if only writing parameters.
+     *
+     * @returns Name of ADIOS2 file or stream.
+     */
+    std::string _adios2Filename(void) const;
+
+    /** Gather topology and geometry of cells owned by this process.
+     *
+     * @param[in] mesh Finite-element mesh.
+     */
+    void _setupGeometry(const pylith::topology::Mesh& mesh);
+
+    /** Extract values of subfield at local vertices or cells.
+     *
+     * @param[out] array Data array for subfield.
+     * @param[in] subfield Subfield to extract.
+     * @param[in] points Points (vertices or cells) with values.
+     */
+    void _extractValues(DataArray* array,
+                        const pylith::meshio::OutputSubfield& subfield,
+                        const std::vector<PylithInt>& points);
+
+    /// Write topology and geometry of cells owned by this process for current time step.
+    void _writeGeometry(void);
+
+    /** Write fields for current time step.
+     *
+     * @param[in] fields Fields to write.
+     */
+    void _writeFields(const std::vector<DataArray>& fields);
+
+    /// Define VTX schema attribute describing the variables.
+    void _defineSchema(void);
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    const DataWriterADIOS2& operator=(const DataWriterADIOS2&); ///< Not implemented
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Name of ADIOS2 file or stream.
+    std::string _engine; ///< Name of ADIOS2 engine.
+    std::map<std::string, std::string> _engineParameters; ///< Parameters for ADIOS2 engine.
+    Handles* _adios; ///< ADIOS2 objects.
+
+    PetscDM _dm; ///< Handle to PETSc DM for mesh
+    int _commRank; ///< Rank of this process.
+
+    std::vector<PylithInt> _vertices; ///< Local vertices in closure of cells owned by this process.
+    std::vector<PylithInt> _cells; ///< Cells owned by this process.
+    std::vector<PylithScalar> _coordinates; ///< Coordinates of vertices [numVertices*3].
+    std::vector<int64_t> _connectivity; ///< Number of vertices followed by indices of vertices (in _vertices) in cells.
+    std::vector<uint32_t> _cellTypes; ///< VTK cell type of each cell.
+
+    std::vector<DataArray> _vertexFields; ///< Vertex fields for current time step.
+    std::vector<DataArray> _cellFields; ///< Cell fields for current time step.
+    PylithScalar _tstamp; ///< Time (dimensional) of current time step.
+    size_t _numTimeSteps; ///< Number of time steps written.
+
+    bool _isOpenTimeStep; ///< true if called openTimeStep().
+
+}; // DataWriterADIOS2
+
+#include "DataWriterADIOS2.icc" // inline methods
+
+#endif // pylith_meshio_datawriteradios2_hh
+
+// End of file
@@ -21,13 +21,14 @@
 #include "DataWriterHDF5.hh" // Implementation of class methods
 
 #include "HDF5.hh" // USES HDF5
-#include "Xdmf.hh" // USES Xdmf
+#include "XdmfWriter.hh" // USES XdmfWriter
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/MeshOps.hh" // USES isCohesiveCell()
 #include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
 
+#include "pylith/utils/types.hh" // USES PetscObjectId
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT*
 
@@ -36,6 +37,11 @@
 #include "petscviewerhdf5.h"
 #include <mpi.h> // USES MPI routines
 
+#include <vector> // USES std::vector
+#include <limits> // USES std::numeric_limits
+#include <algorithm> // USES std::min()
+#include <cstring> // USES memcpy()
+#include <stdint.h> // USES uint32_t, uint64_t
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
@@ -44,13 +50,144 @@
 #define PYLITH_HDF5_USE_API_18
 #endif
 
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _DataWriterHDF5 {
+public:
+
+            /// Identifier of registered Zstandard HDF5 filter plugin.
+            static const H5Z_filter_t filterZstd;
+
+            /** Round floating point values to the given number of bits in the mantissa.
+             *
+             * @param[inout] values Array of values.
+             * @param[in] numValues Number of values.
+             * @param[in] numBits Number of bits retained in the mantissa.
+             */
+            static
+            void truncateMantissa(double* values,
+                                  const size_t numValues,
+                                  const int numBits) {
+                _truncateMantissa<double, uint64_t>(values, numValues, numBits);
+            } // truncateMantissa
+
+            /** Round floating point values to the given number of bits in the mantissa.
+             *
+             * @param[inout] values Array of values.
+             * @param[in] numValues Number of values.
+             * @param[in] numBits Number of bits retained in the mantissa.
+             */
+            static
+            void truncateMantissa(float* values,
+                                  const size_t numValues,
+                                  const int numBits) {
+                _truncateMantissa<float, uint32_t>(values, numValues, numBits);
+            } // truncateMantissa
+
+private:
+
+            template<typename real_t, typename uint_t>
+            static
+            void _truncateMantissa(real_t* values,
+                                   const size_t numValues,
+                                   const int numBits) {
+                const int numBitsDropped = std::numeric_limits<real_t>::digits - 1 - numBits;
+                if (numBitsDropped <= 0) { return; }
+                const uint_t maskDropped = (uint_t(1) << numBitsDropped) - 1;
+                const uint_t half = uint_t(1) << (numBitsDropped - 1);
+                for (size_t i = 0; i < numValues; ++i) {
+                    uint_t bits;
+                    memcpy(&bits, &values[i], sizeof(bits));
+                    bits = (bits + half) & ~maskDropped;
+                    memcpy(&values[i], &bits, sizeof(bits));
+                } // for
+            } // _truncateMantissa
+
+            /** Get dimensions of 2-D dataset.
+             *
+             * @param[in] h5 HDF5 file.
+             * @param[in] name Full name of dataset.
+             * @param[out] dims Dimensions of dataset.
+             * @returns True if file contains dataset, false otherwise.
+             */
+            static
+            bool getDatasetDims(hid_t h5,
+                                const char* name,
+                                hsize_t dims[2]) {
+                assert(name);
+
+                // Check each link in path, because H5Lexists() requires intermediate links to exist.
+                const std::string path(name);
+                for (size_t pos = path.find('/', 1); ; pos = path.find('/', pos+1)) {
+                    const std::string link = path.substr(0, pos);
+                    if (H5Lexists(h5, link.c_str(), H5P_DEFAULT) <= 0) { return false; }
+                    if (std::string::npos == pos) { break; }
+                } // for
+
+                hid_t dataset = H5Dopen2(h5, name, H5P_DEFAULT);
+                if (dataset < 0) { throw std::runtime_error("Could not open dataset."); }
+                hid_t dataspace = H5Dget_space(dataset);
+                if (dataspace < 0) { throw std::runtime_error("Could not get dataspace."); }
+                const int ndims = H5Sget_simple_extent_ndims(dataspace);
+                if (2 != ndims) {
+                    H5Sclose(dataspace);
+                    H5Dclose(dataset);
+                    return false;
+                } // if
+                H5Sget_simple_extent_dims(dataspace, dims, NULL);
+                H5Sclose(dataspace);
+                H5Dclose(dataset);
+
+                return true;
+            } // getDatasetDims
+
+            /** Get name of file relative to the directory of another file.
+             *
+             * @param[in] filename Name of file.
+             * @param[in] fromFilename Name of file in reference directory.
+             * @returns Name of file without directory if both files are in the same directory, otherwise `filename`.
+             */
+            static
+            std::string getRelativeFilename(const std::string& filename,
+                                            const std::string& fromFilename) {
+                const size_t indexDir = filename.rfind('/');
+                const size_t indexDirFrom = fromFilename.rfind('/');
+                const std::string dir = (indexDir != std::string::npos) ? filename.substr(0, indexDir) : "";
+                const std::string dirFrom = (indexDirFrom != std::string::npos) ? fromFilename.substr(0, indexDirFrom) : "";
+                return (dir == dirFrom && indexDir != std::string::npos) ? filename.substr(indexDir+1) : filename;
+            } // getRelativeFilename
+
+            /// Shared HDF5 file with mesh topology and geometry.
+            struct SharedMesh {
+                std::string filename; ///< Name of file.
+                pylith::string_vector groups; ///< Names of root groups in file.
+            };
+
+            /// Shared mesh files indexed by id of PETSc DM for mesh.
+            static std::map<PetscObjectId, SharedMesh> sharedMeshes;
+        };
+
+        const H5Z_filter_t _DataWriterHDF5::filterZstd = 32015;
+        std::map<PetscObjectId, _DataWriterHDF5::SharedMesh> _DataWriterHDF5::sharedMeshes;
+    } // meshio
+} // pylith
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Constructor
 pylith::meshio::DataWriterHDF5::DataWriterHDF5(void) :
     _filename("output.h5"),
     _viewer(0),
     _tstamp(0),
-    _tstampIndex(0) {
+    _xdmf(0),
+    _tstampIndex(0),
+    _useCollectiveIO(false),
+    _compression(COMPRESSION_NONE),
+    _compressionLevel(6),
+    _chunkNumTimeSteps(1),
+    _chunkNumPoints(0),
+    _mantissaBits(0),
+    _useSharedMesh(false) {
     PyreComponent::setName("datawriterhdf5");
 } // constructor
 
@@ -73,6 +210,8 @@ pylith::meshio::DataWriterHDF5::deallocate(void) {
     PetscErrorCode err = 0;
     err = PetscViewerDestroy(&_viewer);PYLITH_CHECK_ERROR(err);assert(!_viewer);
     err = VecDestroy(&_tstamp);PYLITH_CHECK_ERROR(err);assert(!_tstamp);
+    delete _xdmf;_xdmf = 0;
+    _buffers.clear();
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -85,7 +224,111 @@ pylith::meshio::DataWriterHDF5::DataWriterHDF5(const DataWriterHDF5& w) :
     _filename(w._filename),
     _viewer(0),
     _tstamp(0),
-    _tstampIndex(0) {}
+    _xdmf(0),
+    _tstampIndex(0),
+    _useCollectiveIO(w._useCollectiveIO),
+    _compression(w._compression),
+    _compressionLevel(w._compressionLevel),
+    _chunkNumTimeSteps(w._chunkNumTimeSteps),
+    _chunkNumPoints(w._chunkNumPoints),
+    _mantissaBits(w._mantissaBits),
+    _useSharedMesh(w._useSharedMesh) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set compression filter for field datasets.
+void
+pylith::meshio::DataWriterHDF5::setCompression(const CompressionEnum value,
+                                               const int level) {
+    PYLITH_METHOD_BEGIN;
+
+    int levelMin = 0;
+    int levelMax = 0;
+    switch (value) {
+    case COMPRESSION_NONE:
+        break;
+    case COMPRESSION_DEFLATE:
+        levelMin = 1;
+        levelMax = 9;
+        break;
+    case COMPRESSION_ZSTD:
+        levelMin = 1;
+        levelMax = 22;
+        break;
+    case COMPRESSION_SZIP:
+        levelMin = 2;
+        levelMax = 32;
+        break;
+    default:
+        PYLITH_COMPONENT_LOGICERROR("Unknown compression filter '" << value << "'.");
+    } // switch
+    if ((value != COMPRESSION_NONE) && ((level < levelMin) || (level > levelMax))) {
+        std::ostringstream msg;
+        msg << "Compression level (" << level << ") must be in the range [" << levelMin << ", " << levelMax << "].";
+        throw std::runtime_error(msg.str());
+    } // if
+    if ((COMPRESSION_SZIP == value) && (level % 2)) {
+        std::ostringstream msg;
+        msg << "Number of pixels per block (" << level << ") for szip compression must be even.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _compression = value;
+    _compressionLevel = level;
+
+    PYLITH_METHOD_END;
+} // setCompression
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set shape of chunks for field datasets.
+void
+pylith::meshio::DataWriterHDF5::setChunkShape(const size_t numTimeSteps,
+                                              const size_t numPoints) {
+    PYLITH_METHOD_BEGIN;
+
+    if (numTimeSteps < 1) {
+        std::ostringstream msg;
+        msg << "Number of time steps in a chunk (" << numTimeSteps << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _chunkNumTimeSteps = numTimeSteps;
+    _chunkNumPoints = numPoints;
+
+    PYLITH_METHOD_END;
+} // setChunkShape
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of bits retained in the mantissa of floating point values.
+void
+pylith::meshio::DataWriterHDF5::setMantissaBits(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    const int numBitsMax = std::numeric_limits<PylithScalar>::digits - 1;
+    if ((value < 0) || (value > numBitsMax)) {
+        std::ostringstream msg;
+        msg << "Number of bits retained in mantissa (" << value << ") must be in the range [0, " << numBitsMax << "].";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _mantissaBits = value;
+
+    PYLITH_METHOD_END;
+} // setMantissaBits
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for writing the mesh topology and geometry once to a shared HDF5 file.
+void
+pylith::meshio::DataWriterHDF5::setSharedMesh(const bool value) {
+    PYLITH_METHOD_BEGIN;
+
+    _useSharedMesh = value;
+
+    PYLITH_METHOD_END;
+} // setSharedMesh
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -116,8 +359,51 @@ pylith::meshio::DataWriterHDF5::open(const pylith::topology::Mesh& mesh,
         err = PetscViewerHDF5Open(mesh.getComm(), filename.c_str(), FILE_MODE_WRITE, &_viewer);PYLITH_CHECK_ERROR(err);
         err = PetscViewerPushFormat(_viewer, PETSC_VIEWER_HDF5_VIZ);PYLITH_CHECK_ERROR(err);
         err = PetscViewerHDF5SetBaseDimension2(_viewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerHDF5SetCollective(_viewer, _useCollectiveIO ? PETSC_TRUE : PETSC_FALSE);PYLITH_CHECK_ERROR(err);
 
-        err = DMView(mesh.getDM(), _viewer);PYLITH_CHECK_ERROR(err);
+        std::string meshFilename;
+        pylith::string_vector meshGroups;
+        if (_useSharedMesh) {
+            meshFilename = _getSharedMeshFilename(mesh, &meshGroups);
+        } else {
+            err = DMView(mesh.getDM(), _viewer);PYLITH_CHECK_ERROR(err);
+        } // if/else
+
+        // Get domain information for Xdmf file from datasets written by the viewer, so that the Xdmf file can be
+        // updated after each time step without reading the HDF5 file.
+        hid_t h5 = -1;
+        err = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(err);
+        if (_useSharedMesh) {
+            const std::string linkFilename = _DataWriterHDF5::getRelativeFilename(meshFilename, filename);
+            for (size_t i = 0; i < meshGroups.size(); ++i) {
+                // Link creation modifies metadata, so all processes create the links.
+                if (H5Lcreate_external(linkFilename.c_str(), meshGroups[i].c_str(), h5, meshGroups[i].c_str(),
+                                       H5P_DEFAULT, H5P_DEFAULT) < 0) {
+                    std::ostringstream msg;
+                    msg << "Could not create external link to group '" << meshGroups[i] << "' in shared mesh file '"
+                        << meshFilename << "'.";
+                    throw std::runtime_error(msg.str());
+                } // if
+            } // for
+        } // if
+        hsize_t cellsDims[2];
+        hsize_t verticesDims[2];
+        const bool hasCells = _DataWriterHDF5::getDatasetDims(h5, "/viz/topology/cells", cellsDims);
+        const bool hasVertices = _DataWriterHDF5::getDatasetDims(h5, "/geometry/vertices", verticesDims);
+        if (!commRank && hasCells && hasVertices) {
+            _xdmf = new XdmfWriter;assert(_xdmf);
+            try {
+                _xdmf->open(filename.c_str(), cellsDims[0], cellsDims[1], mesh.getDimension(),
+                            verticesDims[0], verticesDims[1]);
+                if (_useSharedMesh) {
+                    _xdmf->setMeshFilename(meshFilename.c_str());
+                } // if
+            } catch (const std::exception& err) {
+                delete _xdmf;_xdmf = 0;
+                pythia::journal::error_t error("datawriter");
+                error << err.what() << pythia::journal::endl;
+            } // try/catch
+        } // if
 
     } catch (const std::exception& err) {
         std::ostringstream msg;
@@ -133,12 +419,69 @@ pylith::meshio::DataWriterHDF5::open(const pylith::topology::Mesh& mesh,
 } // open
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of shared HDF5 file with mesh topology and geometry, writing the file if it does not exist.
+std::string
+pylith::meshio::DataWriterHDF5::_getSharedMeshFilename(const pylith::topology::Mesh& mesh,
+                                                       pylith::string_vector* groups) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(groups);
+
+    PetscErrorCode err = 0;
+    PetscObjectId meshId = 0;
+    err = PetscObjectGetId((PetscObject)mesh.getDM(), &meshId);PYLITH_CHECK_ERROR(err);
+
+    std::map<PetscObjectId, _DataWriterHDF5::SharedMesh>::const_iterator iter = _DataWriterHDF5::sharedMeshes.find(meshId);
+    if (iter == _DataWriterHDF5::sharedMeshes.end()) {
+        _DataWriterHDF5::SharedMesh sharedMesh;
+        sharedMesh.filename = _filename;
+        const size_t indexExt = sharedMesh.filename.rfind(".h5");
+        if (indexExt != std::string::npos) {
+            sharedMesh.filename = std::string(sharedMesh.filename, 0, indexExt);
+        } // if
+        sharedMesh.filename += "_mesh.h5";
+
+        PetscViewer viewer = NULL;
+        err = PetscViewerHDF5Open(mesh.getComm(), sharedMesh.filename.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_VIZ);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerHDF5SetBaseDimension2(viewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerHDF5SetCollective(viewer, _useCollectiveIO ? PETSC_TRUE : PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+        err = DMView(mesh.getDM(), viewer);PYLITH_CHECK_ERROR(err);
+
+        hid_t h5 = -1;
+        err = PetscViewerHDF5GetFileId(viewer, &h5);PYLITH_CHECK_ERROR(err);
+        const char* rootGroups[4] = { "/geometry", "/topology", "/viz", "/labels" };
+        for (int i = 0; i < 4; ++i) {
+            if (H5Lexists(h5, rootGroups[i], H5P_DEFAULT) > 0) {
+                sharedMesh.groups.push_back(rootGroups[i]);
+            } // if
+        } // for
+        err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+        iter = _DataWriterHDF5::sharedMeshes.insert(std::make_pair(meshId, sharedMesh)).first;
+    } // if
+
+    *groups = iter->second.groups;
+
+    PYLITH_METHOD_RETURN(iter->second.filename);
+} // _getSharedMeshFilename
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Close output files.
 void
 pylith::meshio::DataWriterHDF5::close(void) {
     PYLITH_METHOD_BEGIN;
 
+    // Write any buffered time steps. All processes have the same fields, so they write them in the same order.
+    if (_viewer) {
+        for (std::map<std::string, FieldBuffer>::iterator iter = _buffers.begin(); iter != _buffers.end(); ++iter) {
+            _writeFilteredBlock(iter->first, &iter->second);
+        } // for
+    } // if
+    _buffers.clear();
+
     PetscErrorCode err = 0;
     err = PetscViewerDestroy(&_viewer);PYLITH_CHECK_ERROR(err);assert(!_viewer);
     err = VecDestroy(&_tstamp);PYLITH_CHECK_ERROR(err);assert(!_tstamp);
@@ -146,18 +489,16 @@ pylith::meshio::DataWriterHDF5::close(void) {
     _timesteps.clear();
     _tstampIndex = 0;
 
-    if (isOpen()) {
-        // Write Xdmf file on process 0
-        PetscMPIInt commRank;
-        err = MPI_Comm_rank(PETSC_COMM_WORLD, &commRank);PYLITH_CHECK_ERROR(err);
-        if (!commRank) {
-            try {
-                Xdmf::write(hdf5Filename().c_str());
-            } catch (const std::exception& err) {
-                pythia::journal::error_t error("datawriter");
-                error << err.what() << pythia::journal::endl;
-            } // catch
-        } // if
+    if (_xdmf) {
+        // Append any fields written outside a time step (info files) and close Xdmf file on process 0.
+        try {
+            _xdmf->writeTimeStep();
+            _xdmf->close();
+        } catch (const std::exception& err) {
+            pythia::journal::error_t error("datawriter");
+            error << err.what() << pythia::journal::endl;
+        } // catch
+        delete _xdmf;_xdmf = 0;
     } // if
 
     DataWriter::close();
@@ -166,6 +507,27 @@ pylith::meshio::DataWriterHDF5::close(void) {
 } // close
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Append time step to Xdmf file after writing data for the time step.
+void
+pylith::meshio::DataWriterHDF5::closeTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriter::closeTimeStep();
+
+    if (_xdmf) {
+        try {
+            _xdmf->writeTimeStep();
+        } catch (const std::exception& err) {
+            pythia::journal::error_t error("datawriter");
+            error << err.what() << pythia::journal::endl;
+        } // catch
+    } // if
+
+    PYLITH_METHOD_END;
+} // closeTimeStep
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Write field over vertices to file.
 void
@@ -193,14 +555,18 @@ pylith::meshio::DataWriterHDF5::writeVertexField(const PylithScalar t,
             _writeTimeStamp(t, commRank);
         } // if
 
-        err = PetscViewerHDF5PushGroup(_viewer, "/vertex_fields");PYLITH_CHECK_ERROR(err);
-        err = PetscViewerHDF5PushTimestepping(_viewer);PYLITH_CHECK_ERROR(err);
-        err = PetscViewerHDF5SetTimestep(_viewer, istep);PYLITH_CHECK_ERROR(err);
-
         PetscVec vector = subfield.getVector();assert(vector);
-        DataWriter::_writeVec(vector, _viewer);PYLITH_CHECK_ERROR(err);
-        err = PetscViewerHDF5PopTimestepping(_viewer);PYLITH_CHECK_ERROR(err);
-        err = PetscViewerHDF5PopGroup(_viewer);PYLITH_CHECK_ERROR(err);
+        if (_useFilteredDatasets()) {
+            _writeFilteredVec("/vertex_fields", name, vector, istep);
+        } else {
+            err = PetscViewerHDF5PushGroup(_viewer, "/vertex_fields");PYLITH_CHECK_ERROR(err);
+            err = PetscViewerHDF5PushTimestepping(_viewer);PYLITH_CHECK_ERROR(err);
+            err = PetscViewerHDF5SetTimestep(_viewer, istep);PYLITH_CHECK_ERROR(err);
+
+            DataWriter::_writeVec(vector, _viewer);PYLITH_CHECK_ERROR(err);
+            err = PetscViewerHDF5PopTimestepping(_viewer);PYLITH_CHECK_ERROR(err);
+            err = PetscViewerHDF5PopGroup(_viewer);PYLITH_CHECK_ERROR(err);
+        } // if/else
 
         if (0 == istep) {
             hid_t h5 = -1;
@@ -211,6 +577,16 @@ pylith::meshio::DataWriterHDF5::writeVertexField(const PylithScalar t,
             HDF5::writeAttribute(h5, fullName.c_str(), "vector_field_type", sattr);
         } // if
 
+        if (_xdmf) {
+            PetscInt vectorSize = 0;
+            PetscInt fiberDim = 0;
+            err = VecGetSize(vector, &vectorSize);PYLITH_CHECK_ERROR(err);
+            err = VecGetBlockSize(vector, &fiberDim);PYLITH_CHECK_ERROR(err);assert(fiberDim > 0);
+            const char* sattr = pylith::topology::FieldBase::vectorFieldString(subfield.getDescription().vectorFieldType);
+            _xdmf->addField(t * DataWriter::_timeScale, name, XdmfWriter::VERTEX_FIELD, sattr, istep,
+                            vectorSize / fiberDim, fiberDim);
+        } // if
+
     } catch (const std::exception& err) {
         std::ostringstream msg;
         msg << "Error while writing field '" << name << "' at time "
@@ -256,14 +632,18 @@ pylith::meshio::DataWriterHDF5::writeCellField(const PylithScalar t,
             _writeTimeStamp(t, commRank);
         } // if
 
-        err = PetscViewerHDF5PushGroup(_viewer, "/cell_fields");PYLITH_CHECK_ERROR(err);
-        err = PetscViewerHDF5PushTimestepping(_viewer);PYLITH_CHECK_ERROR(err);
-        err = PetscViewerHDF5SetTimestep(_viewer, istep);PYLITH_CHECK_ERROR(err);
-
         PetscVec vector = subfield.getVector();assert(vector);
-        DataWriter::_writeVec(vector, _viewer);
-        err = PetscViewerHDF5PopTimestepping(_viewer);PYLITH_CHECK_ERROR(err);
-        err = PetscViewerHDF5PopGroup(_viewer);PYLITH_CHECK_ERROR(err);
+        if (_useFilteredDatasets()) {
+            _writeFilteredVec("/cell_fields", name, vector, istep);
+        } else {
+            err = PetscViewerHDF5PushGroup(_viewer, "/cell_fields");PYLITH_CHECK_ERROR(err);
+            err = PetscViewerHDF5PushTimestepping(_viewer);PYLITH_CHECK_ERROR(err);
+            err = PetscViewerHDF5SetTimestep(_viewer, istep);PYLITH_CHECK_ERROR(err);
+
+            DataWriter::_writeVec(vector, _viewer);
+            err = PetscViewerHDF5PopTimestepping(_viewer);PYLITH_CHECK_ERROR(err);
+            err = PetscViewerHDF5PopGroup(_viewer);PYLITH_CHECK_ERROR(err);
+        } // if/else
 
         if (0 == istep) {
             hid_t h5 = -1;
@@ -273,6 +653,16 @@ pylith::meshio::DataWriterHDF5::writeCellField(const PylithScalar t,
             const char* sattr = pylith::topology::FieldBase::vectorFieldString(subfield.getDescription().vectorFieldType);
             HDF5::writeAttribute(h5, fullName.c_str(), "vector_field_type", sattr);
         } // if
+
+        if (_xdmf) {
+            PetscInt vectorSize = 0;
+            PetscInt fiberDim = 0;
+            err = VecGetSize(vector, &vectorSize);PYLITH_CHECK_ERROR(err);
+            err = VecGetBlockSize(vector, &fiberDim);PYLITH_CHECK_ERROR(err);assert(fiberDim > 0);
+            const char* sattr = pylith::topology::FieldBase::vectorFieldString(subfield.getDescription().vectorFieldType);
+            _xdmf->addField(t * DataWriter::_timeScale, name, XdmfWriter::CELL_FIELD, sattr, istep,
+                            vectorSize / fiberDim, fiberDim);
+        } // if
     } catch (const std::exception& err) {
         std::ostringstream msg;
         msg << "Error while writing field '" << name << "' at time "
@@ -302,19 +692,21 @@ pylith::meshio::DataWriterHDF5::writePointNames(const pylith::string_vector& nam
     try {
         // Put station names into array of fixed length strings
         // (numNames*maxStringLegnth) on each process, and then write
-        // collectively.
+        // collectively with each process writing its names at its
+        // offset in the dataset. Parallel HDF5 does not support writing
+        // variable length strings.
         int mpierr;
         MPI_Comm comm = mesh.getComm();
         const int commRank = mesh.getCommRank();
-        int nprocs = 0;
-        mpierr = MPI_Comm_size(comm, &nprocs);assert(MPI_SUCCESS == mpierr);
 
-        // Number of names on each process.
+        // Total number of names and offset of names on this process.
         const int numNamesLocal = names.size();
-        int_array numNamesArray(nprocs);
+        int numNames = 0;
+        int numNamesOffset = 0;
         // Use void* for compatibility with OpenMPI 1.3 on Travis-CI
-        mpierr = MPI_Allgather((void*)&numNamesLocal, 1, MPI_INT, &numNamesArray[0], 1, MPI_INT, comm);assert(MPI_SUCCESS == mpierr);
-        const int numNames = numNamesArray.sum();
+        mpierr = MPI_Allreduce((void*)&numNamesLocal, &numNames, 1, MPI_INT, MPI_SUM, comm);assert(MPI_SUCCESS == mpierr);
+        mpierr = MPI_Exscan((void*)&numNamesLocal, &numNamesOffset, 1, MPI_INT, MPI_SUM, comm);assert(MPI_SUCCESS == mpierr);
+        if (!commRank) { numNamesOffset = 0; } // Result of MPI_Exscan() is undefined on process 0.
 
         // Get maximum string length.
         int maxStringLengthLocal = 0;
@@ -379,9 +771,7 @@ pylith::meshio::DataWriterHDF5::writePointNames(const pylith::string_vector& nam
         hid_t dataspace = H5Dget_space(dataset);
         if (dataspace < 0) {throw std::runtime_error("Could not get dataspace.");}
         hsize_t offset[1] = {0};
-        for (int i = 0; i < commRank; ++i) {
-            offset[0] += numNamesArray[i];
-        } // for
+        offset[0] = numNamesOffset;
         hsize_t count[1];
         count[0] = numNamesLocal;
         err = H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offset, NULL, count, NULL);
@@ -473,4 +863,218 @@ pylith::meshio::DataWriterHDF5::_writeTimeStamp(const PylithScalar t,
 } // _writeTimeStamp
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Do we need to create and write field datasets directly with the HDF5 library?
+bool
+pylith::meshio::DataWriterHDF5::_useFilteredDatasets(void) const {
+    return _compression != COMPRESSION_NONE || _chunkNumTimeSteps > 1 || _chunkNumPoints > 0 || _mantissaBits > 0;
+} // _useFilteredDatasets
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write field to chunked, filtered dataset.
+void
+pylith::meshio::DataWriterHDF5::_writeFilteredVec(const char* group,
+                                                  const char* name,
+                                                  PetscVec vector,
+                                                  const int istep) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_viewer);
+    assert(group);
+    assert(name);
+    assert(vector);
+
+    PetscErrorCode petscErr = 0;
+    PetscInt vectorSize = 0, localSize = 0, rangeStart = 0, blockSize = 1;
+    petscErr = VecGetSize(vector, &vectorSize);PYLITH_CHECK_ERROR(petscErr);
+    petscErr = VecGetLocalSize(vector, &localSize);PYLITH_CHECK_ERROR(petscErr);
+    petscErr = VecGetOwnershipRange(vector, &rangeStart, NULL);PYLITH_CHECK_ERROR(petscErr);
+    petscErr = VecGetBlockSize(vector, &blockSize);PYLITH_CHECK_ERROR(petscErr);
+    assert(blockSize > 0);
+
+    hid_t h5 = -1;
+    petscErr = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(petscErr);
+    assert(h5 >= 0);
+
+    const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    const int ndims = 3;
+    const hsize_t numPoints = vectorSize / blockSize;
+    const hsize_t fiberDim = blockSize;
+    const std::string fullName = std::string(group) + std::string("/") + std::string(name);
+
+    // Create group if necessary.
+    herr_t err = 0;
+    if (H5Lexists(h5, group, H5P_DEFAULT) <= 0) {
+        hid_t groupId = H5Gcreate2(h5, group, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        if (groupId < 0) { throw std::runtime_error("Could not create group."); }
+        err = H5Gclose(groupId);
+        if (err < 0) { throw std::runtime_error("Could not close group."); }
+    } // if
+
+    if (0 == istep) {
+        // Create empty dataset [ntimesteps, npoints, fiberdim] with the same layout as the PETSc HDF5 viewer, so that
+        // attributes can be added before any values are written.
+        hsize_t dims[ndims] = { 0, numPoints, fiberDim };
+        hsize_t maxDims[ndims] = { DataWriter::_isInfo ? 1 : H5S_UNLIMITED, numPoints, fiberDim };
+        hsize_t dimsChunk[ndims];
+        dimsChunk[0] = DataWriter::_isInfo ? 1 : _chunkNumTimeSteps;
+        dimsChunk[1] = std::max(hsize_t(1), (_chunkNumPoints > 0) ? std::min(hsize_t(_chunkNumPoints), numPoints) : numPoints);
+        dimsChunk[2] = fiberDim;
+
+        hid_t dataspace = H5Screate_simple(ndims, dims, maxDims);
+        if (dataspace < 0) { throw std::runtime_error("Could not create dataspace."); }
+        hid_t property = H5Pcreate(H5P_DATASET_CREATE);
+        if (property < 0) { throw std::runtime_error("Could not create property for dataset."); }
+        err = H5Pset_chunk(property, ndims, dimsChunk);
+        if (err < 0) { throw std::runtime_error("Could not set chunk."); }
+        switch (_compression) {
+        case COMPRESSION_NONE:
+            break;
+        case COMPRESSION_DEFLATE:
+            err = H5Pset_shuffle(property);
+            if (err < 0) { throw std::runtime_error("Could not set shuffle filter."); }
+            err = H5Pset_deflate(property, _compressionLevel);
+            if (err < 0) { throw std::runtime_error("Could not set deflate filter."); }
+            break;
+        case COMPRESSION_ZSTD: {
+            if (H5Zfilter_avail(_DataWriterHDF5::filterZstd) <= 0) {
+                throw std::runtime_error("Zstandard HDF5 filter plugin is not available; check HDF5_PLUGIN_PATH.");
+            } // if
+            const unsigned int cdValues[1] = { static_cast<unsigned int>(_compressionLevel) };
+            err = H5Pset_shuffle(property);
+            if (err < 0) { throw std::runtime_error("Could not set shuffle filter."); }
+            err = H5Pset_filter(property, _DataWriterHDF5::filterZstd, H5Z_FLAG_MANDATORY, 1, cdValues);
+            if (err < 0) { throw std::runtime_error("Could not set Zstandard filter."); }
+            break;
+        } // COMPRESSION_ZSTD
+        case COMPRESSION_SZIP:
+            if (H5Zfilter_avail(H5Z_FILTER_SZIP) <= 0) {
+                throw std::runtime_error("Szip HDF5 filter is not available.");
+            } // if
+            err = H5Pset_szip(property, H5_SZIP_NN_OPTION_MASK, _compressionLevel);
+            if (err < 0) { throw std::runtime_error("Could not set szip filter."); }
+            break;
+        default:
+            PYLITH_COMPONENT_LOGICERROR("Unknown compression filter '" << _compression << "'.");
+        } // switch
+
+        hid_t dataset = H5Dcreate2(h5, fullName.c_str(), scalartype, dataspace, H5P_DEFAULT, property, H5P_DEFAULT);
+        if (dataset < 0) { throw std::runtime_error("Could not create dataset."); }
+        err = H5Pclose(property);
+        if (err < 0) { throw std::runtime_error("Could not close property."); }
+        err = H5Sclose(dataspace);
+        if (err < 0) { throw std::runtime_error("Could not close dataspace."); }
+        err = H5Dclose(dataset);
+        if (err < 0) { throw std::runtime_error("Could not close dataset."); }
+
+        _buffers.erase(fullName);
+    } // if
+
+    // Append local values to buffer.
+    FieldBuffer& buffer = _buffers[fullName];
+    if (0 == buffer.numSteps) {
+        buffer.numPoints = numPoints;
+        buffer.numPointsLocal = localSize / blockSize;
+        buffer.pointOffset = rangeStart / blockSize;
+        buffer.fiberDim = fiberDim;
+        buffer.firstStep = istep;
+    } // if
+    assert(buffer.firstStep + buffer.numSteps == size_t(istep));
+
+    const PetscScalar* vectorArray = NULL;
+    petscErr = VecGetArrayRead(vector, &vectorArray);PYLITH_CHECK_ERROR(petscErr);
+    const size_t bufferSize = buffer.values.size();
+    buffer.values.insert(buffer.values.end(), vectorArray, vectorArray + localSize);
+    petscErr = VecRestoreArrayRead(vector, &vectorArray);PYLITH_CHECK_ERROR(petscErr);
+    if ((_mantissaBits > 0) && (localSize > 0)) {
+        _DataWriterHDF5::truncateMantissa(&buffer.values[bufferSize], localSize, _mantissaBits);
+    } // if
+    ++buffer.numSteps;
+
+    // Write block of time steps when we have filled the chunks.
+    const size_t numStepsBlock = DataWriter::_isInfo ? 1 : _chunkNumTimeSteps;
+    if (buffer.numSteps >= numStepsBlock) {
+        _writeFilteredBlock(fullName, &buffer);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _writeFilteredVec
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write buffered time steps of field to chunked, filtered dataset.
+void
+pylith::meshio::DataWriterHDF5::_writeFilteredBlock(const std::string& name,
+                                                    FieldBuffer* buffer) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_viewer);
+    assert(buffer);
+    if (0 == buffer->numSteps) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscErrorCode petscErr = 0;
+    hid_t h5 = -1;
+    petscErr = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(petscErr);
+    assert(h5 >= 0);
+
+    const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    const int ndims = 3;
+    const hsize_t numSteps = buffer->numSteps;
+    const hsize_t numPointsLocal = buffer->numPointsLocal;
+    const hsize_t fiberDim = buffer->fiberDim;
+
+    herr_t err = 0;
+    hid_t dataset = H5Dopen2(h5, name.c_str(), H5P_DEFAULT);
+    if (dataset < 0) { throw std::runtime_error("Could not open dataset."); }
+    hsize_t dims[ndims] = { hsize_t(buffer->firstStep) + numSteps, buffer->numPoints, fiberDim };
+    err = H5Dset_extent(dataset, dims);
+    if (err < 0) { throw std::runtime_error("Could not set dataset extent."); }
+
+    // Select hyperslab with values owned by this process.
+    hsize_t offset[ndims] = { hsize_t(buffer->firstStep), hsize_t(buffer->pointOffset), 0 };
+    hsize_t count[ndims] = { numSteps, numPointsLocal, fiberDim };
+    hid_t filespace = H5Dget_space(dataset);
+    if (filespace < 0) { throw std::runtime_error("Could not get dataspace."); }
+    hsize_t dimsMem[ndims] = { numSteps, std::max(hsize_t(1), numPointsLocal), fiberDim };
+    hid_t memspace = H5Screate_simple(ndims, dimsMem, NULL);
+    if (memspace < 0) { throw std::runtime_error("Could not create memspace."); }
+    if (numPointsLocal > 0) {
+        err = H5Sselect_hyperslab(filespace, H5S_SELECT_SET, offset, NULL, count, NULL);
+        if (err < 0) { throw std::runtime_error("Could not select hyperslab."); }
+    } else {
+        err = H5Sselect_none(filespace);
+        if (err < 0) { throw std::runtime_error("Could not select none in dataspace."); }
+        err = H5Sselect_none(memspace);
+        if (err < 0) { throw std::runtime_error("Could not select none in memspace."); }
+    } // if/else
+
+    // Parallel HDF5 requires collective writes for filtered datasets.
+    hid_t property = H5Pcreate(H5P_DATASET_XFER);
+    if (property < 0) { throw std::runtime_error("Could not create property."); }
+    H5Pset_dxpl_mpio(property, H5FD_MPIO_COLLECTIVE);
+
+    const void* data = buffer->values.size() > 0 ? &buffer->values[0] : NULL;
+    err = H5Dwrite(dataset, scalartype, memspace, filespace, property, data);
+    if (err < 0) { throw std::runtime_error("Could not write dataset."); }
+
+    err = H5Pclose(property);
+    if (err < 0) { throw std::runtime_error("Could not close property."); }
+    err = H5Sclose(memspace);
+    if (err < 0) { throw std::runtime_error("Could not close memspace."); }
+    err = H5Sclose(filespace);
+    if (err < 0) { throw std::runtime_error("Could not close dataspace."); }
+    err = H5Dclose(dataset);
+    if (err < 0) { throw std::runtime_error("Could not close dataset."); }
+
+    buffer->values.clear();
+    buffer->firstStep += buffer->numSteps;
+    buffer->numSteps = 0;
+
+    PYLITH_METHOD_END;
+} // _writeFilteredBlock
+
+
 // End of file
@@ -40,6 +40,13 @@
  *     [ntimesteps]
  *   stations - dataset [optional]
  *     [nvertices, 64]
+ *
+ * By default the field datasets are written by the PETSc HDF5 viewer. If compression, a chunk shape spanning
+ * multiple time steps, or truncation of the floating point mantissa is requested, the field datasets are created
+ * and written directly with the HDF5 library in the same layout, so that the chunk shape and filters can be set.
+ * With a chunk shape spanning multiple time steps, the values for those time steps are buffered in memory and written
+ * as a block of whole chunks. Combined with a small number of points per chunk, this gives a point-major layout on
+ * disk in which the time series at a single point (e.g., station) is read from a few contiguous chunks.
  */
 
 #if !defined(pylith_meshio_datawriterhdf5_hh)
@@ -51,6 +58,7 @@
 
 #include <string> // USES std::string
 #include <map> // HASA std::map
+#include <vector> // HASA std::vector
 
 class pylith::meshio::DataWriterHDF5 : public DataWriter {
     friend class TestDataWriterHDF5Mesh; // unit testing
@@ -59,6 +67,16 @@ class pylith::meshio::DataWriterHDF5 : public DataWriter {
     friend class TestDataWriterHDF5BCMesh; // unit testing
     friend class TestDataWriterHDF5FaultMesh; // unit testing
 
+    // PUBLIC ENUM /////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    enum CompressionEnum {
+        COMPRESSION_NONE, // No compression.
+        COMPRESSION_DEFLATE, // Deflate (gzip) compression.
+        COMPRESSION_ZSTD, // Zstandard compression (requires HDF5 filter plugin).
+        COMPRESSION_SZIP, // Szip compression.
+    }; // CompressionEnum
+
     // PUBLIC METHODS
     // //////////////////////////////////////////////////////////////////////////////////////////////////////
 public:
@@ -84,6 +102,52 @@ public:
      */
     void filename(const char* filename);
 
+    /** Set flag for using collective MPI-IO when writing datasets.
+     *
+     * Collective writes let the MPI-IO layer aggregate data onto a subset of processes (e.g., ROMIO collective
+     * buffering with the number of aggregators set by the `cb_nodes` hint) that issue large contiguous writes.
+     *
+     * @param[in] value True if using collective MPI-IO, false otherwise.
+     */
+    void useCollectiveIO(const bool value);
+
+    /** Set compression filter for field datasets.
+     *
+     * @param[in] value Compression filter.
+     * @param[in] level Compression level (deflate: 1-9, zstd: 1-22, szip: pixels per block).
+     */
+    void setCompression(const CompressionEnum value,
+                        const int level);
+
+    /** Set shape of chunks for field datasets.
+     *
+     * Use multiple time steps per chunk and a modest number of points per chunk for fast extraction of time series
+     * at individual points (e.g., stations). Values for the time steps in a chunk are buffered in memory and written
+     * together.
+     *
+     * @param[in] numTimeSteps Number of time steps in a chunk.
+     * @param[in] numPoints Number of points in a chunk (0 means all points).
+     */
+    void setChunkShape(const size_t numTimeSteps,
+                       const size_t numPoints);
+
+    /** Set number of bits retained in the mantissa of floating point values.
+     *
+     * Retaining fewer bits (lossy truncation) greatly improves the compression ratio.
+     *
+     * @param[in] value Number of bits retained in the mantissa (0 means retain all bits).
+     */
+    void setMantissaBits(const int value);
+
+    /** Set flag for writing the mesh topology and geometry once to a shared HDF5 file.
+     *
+     * The first writer opened for a mesh writes the topology and geometry to `<filename>_mesh.h5`; files of all
+     * writers for the same mesh reference these datasets via HDF5 external links.
+     *
+     * @param[in] value True if using shared mesh file, false if writing mesh to each file.
+     */
+    void setSharedMesh(const bool value);
+
     /** Generate filename for HDF5 file.
      *
      * Appends _info if only writing parameters.
@@ -106,6 +170,9 @@ public:
     /// Close output files.
     void close(void);
 
+    /// Append time step to Xdmf file after writing data for the time step.
+    void closeTimeStep(void);
+
     /** Write field over vertices to file.
      *
      * @param[in] t Time associated with field.
@@ -132,8 +199,31 @@ public:
     void writePointNames(const pylith::string_vector& names,
                          const topology::Mesh& mesh);
 
-    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
-private:
+    // PROTECTED STRUCTS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /// Buffer with local values of field for time steps not yet written to a filtered dataset.
+    struct FieldBuffer {
+        std::vector<PylithScalar> values; ///< Local values of buffered time steps [numSteps*numPointsLocal*fiberDim].
+        size_t numPoints; ///< Global number of points in field.
+        size_t numPointsLocal; ///< Number of points on this process.
+        size_t pointOffset; ///< Offset of points on this process.
+        size_t fiberDim; ///< Number of components in field.
+        size_t firstStep; ///< Index of first buffered time step.
+        size_t numSteps; ///< Number of buffered time steps.
+
+        FieldBuffer(void) :
+            numPoints(0),
+            numPointsLocal(0),
+            pointOffset(0),
+            fiberDim(0),
+            firstStep(0),
+            numSteps(0) {}
+
+    };
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
 
     /** Copy constructor.
      *
@@ -149,15 +239,59 @@ private:
     void _writeTimeStamp(const PylithScalar t,
                          const int commRank);
 
-    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
-private:
+    /** Do we need to create and write field datasets directly with the HDF5 library?
+     *
+     * @returns True if using filters or chunk shape not supported by the PETSc HDF5 viewer.
+     */
+    bool _useFilteredDatasets(void) const;
+
+    /** Write field to chunked, filtered dataset.
+     *
+     * @param[in] group Name of group with dataset.
+     * @param[in] name Name of dataset.
+     * @param[in] vector PETSc vector with values.
+     * @param[in] istep Index of time step.
+     */
+    void _writeFilteredVec(const char* group,
+                           const char* name,
+                           PetscVec vector,
+                           const int istep);
+
+    /** Write buffered time steps of field to chunked, filtered dataset.
+     *
+     * @param[in] name Full name of dataset.
+     * @param[inout] buffer Buffer with values of field.
+     */
+    void _writeFilteredBlock(const std::string& name,
+                             FieldBuffer* buffer);
+
+    /** Get name of shared HDF5 file with mesh topology and geometry, writing the file if it does not exist.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[out] groups Names of root groups in shared mesh file.
+     * @returns Name of shared mesh file.
+     */
+    std::string _getSharedMeshFilename(const pylith::topology::Mesh& mesh,
+                                       pylith::string_vector* groups);
+
+    // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
 
     std::string _filename; ///< Name of HDF5 file.
     PetscViewer _viewer; ///< Output file.
     PetscVec _tstamp; ///< Single value vector holding time stamp.
+    XdmfWriter* _xdmf; ///< Writer for Xdmf file (process 0 only).
 
     std::map<std::string, int> _timesteps; ///< # of time steps written per field.
     int _tstampIndex; ///< Index of last time stamp written.
+    bool _useCollectiveIO; ///< Use collective MPI-IO when writing datasets.
+    CompressionEnum _compression; ///< Compression filter for field datasets.
+    int _compressionLevel; ///< Compression level.
+    size_t _chunkNumTimeSteps; ///< Number of time steps in a chunk.
+    size_t _chunkNumPoints; ///< Number of points in a chunk (0 means all points).
+    int _mantissaBits; ///< Number of bits retained in mantissa (0 means all bits).
+    bool _useSharedMesh; ///< Reference mesh in shared HDF5 file rather than writing it to each file.
+    std::map<std::string, FieldBuffer> _buffers; ///< Buffered time steps for filtered datasets.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -27,12 +27,19 @@
 #include "pylith/topology/Stratum.hh" /// USES StratumIS
 #include "pylith/topology/MeshOps.hh" /// USES isCohesiveCell
 #include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/meshio/StagingDrain.hh" // HASA StagingDrain
 
 #include "spatialdata/geocoords/CoordSys.hh" /// USES CoordSys
 
 #include "petscviewerhdf5.h"
 #include <mpi.h> // USES MPI routines
 
+#include <vector> // USES std::vector
+#include <algorithm> // USES std::max()
+#include <fstream> // USES std::ofstream
+#include <sys/stat.h> // USES mkdir()
+#include <cerrno> // USES errno
+#include <cstring> // USES strerror()
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
@@ -42,7 +49,13 @@
 pylith::meshio::DataWriterHDF5Ext::DataWriterHDF5Ext(void) :
     _filename("output.h5"),
     _h5(new HDF5),
-    _tstampIndex(0) { // constructor
+    _tstampIndex(0),
+    _aggregationRatio(0),
+    _numStepsPreallocated(0),
+    _aggregateComm(MPI_COMM_NULL),
+    _writerComm(MPI_COMM_NULL),
+    _drain(NULL),
+    _useAsyncWrites(false) { // constructor
 } // constructor
 
 
@@ -61,6 +74,7 @@ pylith::meshio::DataWriterHDF5Ext::deallocate(void) {
     PYLITH_METHOD_BEGIN;
 
     DataWriter::deallocate();
+    _waitForWrites();
 
     PetscErrorCode err = 0;
     const dataset_type::const_iterator& dEnd = _datasets.end();
@@ -68,7 +82,17 @@ pylith::meshio::DataWriterHDF5Ext::deallocate(void) {
          d_iter != dEnd;
          ++d_iter) {
         err = PetscViewerDestroy(&d_iter->second.viewer);PYLITH_CHECK_ERROR(err);
+        if (d_iter->second.file != MPI_FILE_NULL) {
+            err = MPI_File_close(&d_iter->second.file);PYLITH_CHECK_ERROR(err);
+        } // if
     } // for
+    if (_aggregateComm != MPI_COMM_NULL) {
+        err = MPI_Comm_free(&_aggregateComm);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (_writerComm != MPI_COMM_NULL) {
+        err = MPI_Comm_free(&_writerComm);PYLITH_CHECK_ERROR(err);
+    } // if
+    delete _drain;_drain = NULL; // Finishes copying any remaining staged files.
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -80,10 +104,75 @@ pylith::meshio::DataWriterHDF5Ext::DataWriterHDF5Ext(const DataWriterHDF5Ext& w)
     DataWriter(w),
     _filename(w._filename),
     _h5(new HDF5),
-    _tstampIndex(0) { // copy constructor
+    _tstampIndex(0),
+    _aggregationRatio(w._aggregationRatio),
+    _numStepsPreallocated(w._numStepsPreallocated),
+    _aggregateComm(MPI_COMM_NULL),
+    _writerComm(MPI_COMM_NULL),
+    _stagingDir(w._stagingDir),
+    _drain(NULL),
+    _useAsyncWrites(w._useAsyncWrites) { // copy constructor
 } // copy constructor
 
 
+// ----------------------------------------------------------------------
+// Set number of processes that aggregate their data onto a single writer process.
+void
+pylith::meshio::DataWriterHDF5Ext::setAggregationRatio(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value < 0) {
+        std::ostringstream msg;
+        msg << "Aggregation ratio (" << value << ") must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _aggregationRatio = value;
+
+    PYLITH_METHOD_END;
+} // setAggregationRatio
+
+
+// ----------------------------------------------------------------------
+// Set number of time steps preallocated in external datasets.
+void
+pylith::meshio::DataWriterHDF5Ext::setNumStepsPreallocated(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value < 0) {
+        std::ostringstream msg;
+        msg << "Number of preallocated time steps (" << value << ") must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _numStepsPreallocated = value;
+
+    PYLITH_METHOD_END;
+} // setNumStepsPreallocated
+
+
+// ----------------------------------------------------------------------
+// Set node-local directory for staging external datasets.
+void
+pylith::meshio::DataWriterHDF5Ext::setStagingDir(const char* value) {
+    PYLITH_METHOD_BEGIN;
+    assert(value);
+
+    _stagingDir = value;
+    while (_stagingDir.size() > 1 && '/' == _stagingDir[_stagingDir.size()-1]) {
+        _stagingDir.erase(_stagingDir.size()-1);
+    } // while
+
+    PYLITH_METHOD_END;
+} // setStagingDir
+
+
+// ----------------------------------------------------------------------
+// Set flag for writing external datasets using nonblocking MPI-IO from double buffers.
+void
+pylith::meshio::DataWriterHDF5Ext::setUseAsyncWrites(const bool value) {
+    _useAsyncWrites = value;
+} // setUseAsyncWrites
+
+
 // ----------------------------------------------------------------------
 // Prepare for writing files.
 void
@@ -112,6 +201,20 @@ pylith::meshio::DataWriterHDF5Ext::open(const pylith::topology::Mesh& mesh,
         err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
 
         _tstampIndex = 0;
+        if (_useOffsetWrites()) {
+            _setupAggregation(comm);
+        } // if
+        if (!_stagingDir.empty() && (_writerComm != MPI_COMM_NULL)) {
+            // Staging directory is node-local, so each writer process makes sure it exists.
+            if ((mkdir(_stagingDir.c_str(), 0755) < 0) && (EEXIST != errno)) {
+                std::ostringstream msg;
+                msg << "Could not create staging directory '" << _stagingDir << "': " << strerror(errno) << ".";
+                throw std::runtime_error(msg.str());
+            } // if
+            if (!_drain) {
+                _drain = new StagingDrain();
+            } // if
+        } // if
 
     } catch (const std::exception& err) {
         std::ostringstream msg;
@@ -141,6 +244,17 @@ pylith::meshio::DataWriterHDF5Ext::close(void) {
     _tstampIndex = 0;
     DataWriter::close();
 
+    if (_drain) {
+        try {
+            _drain->wait();
+        } catch (const std::exception& err) {
+            std::ostringstream msg;
+            msg << "Error while draining staged external datasets for HDF5 file '" << _filename << "'.\n" << err.what();
+            deallocate();
+            throw std::runtime_error(msg.str());
+        } // try/catch
+    } // if
+
     deallocate();
 
     PYLITH_METHOD_END;
@@ -166,36 +280,54 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
         err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
         const bool isMPIRoot = 0 == commRank;
 
-        const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_IEEE_F64BE : H5T_IEEE_F32BE;
+        // PETSc binary viewer writes big-endian values; MPI-IO output writes native values.
+        const bool useOffsetWrites = _useOffsetWrites();
+        const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ?
+                                 (useOffsetWrites ? H5T_NATIVE_DOUBLE : H5T_IEEE_F64BE) :
+                                 (useOffsetWrites ? H5T_NATIVE_FLOAT : H5T_IEEE_F32BE);
 
         // Create external dataset if necessary
-        PetscViewer binaryViewer;
+        PetscViewer binaryViewer = NULL;
         bool createdExternalDataset = false;
         if (_datasets.find(name) != _datasets.end()) {
             binaryViewer = _datasets[name].viewer;
         } else {
-            err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &binaryViewer);PYLITH_CHECK_ERROR(err);
-            err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+            if (!useOffsetWrites) {
+                err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &binaryViewer);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+            } // if
             ExternalDataset dataset;
             dataset.numTimeSteps = 0;
+            dataset.numTimeStepsAllocated = 0;
             dataset.viewer = binaryViewer;
+            dataset.file = MPI_FILE_NULL;
+            dataset.request = MPI_REQUEST_NULL;
+            dataset.bufferIndex = 0;
             _datasets[name] = dataset;
 
             createdExternalDataset = true;
         } // else
-        assert(binaryViewer);
 
         PetscVec vector = subfield.getVector();assert(vector);
-        DataWriter::_writeVec(vector, binaryViewer);
-
         ExternalDataset& datasetInfo = _datasets[name];
+        if (useOffsetWrites) {
+            _writeVecAggregated(&datasetInfo, _datasetFilename(name).c_str(), vector);
+        } else {
+            assert(binaryViewer);
+            DataWriter::_writeVec(vector, binaryViewer);
+        } // if/else
         ++datasetInfo.numTimeSteps;
 
+        // Only open HDF5 file if we need to add a time stamp or add or extend a dataset.
+        const bool needsTimeStamp = _tstampIndex+1 == datasetInfo.numTimeSteps;
+        const bool needsExtension = !createdExternalDataset && datasetInfo.numTimeSteps > datasetInfo.numTimeStepsAllocated;
+        const bool updateHDF5 = isMPIRoot && (createdExternalDataset || needsTimeStamp || needsExtension);
+
         // Update time stamp in "/time, if necessary.
-        if (isMPIRoot) {
+        if (updateHDF5) {
             _h5->open(hdf5Filename().c_str(), H5F_ACC_RDWR);
 
-            if (_tstampIndex+1 == datasetInfo.numTimeSteps) {
+            if (needsTimeStamp) {
                 _writeTimeStamp(t);
             } // if
         } // if
@@ -230,6 +362,7 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
 
             datasetInfo.numPoints = numVertices;
             datasetInfo.fiberDim = fiberDim;
+            datasetInfo.numTimeStepsAllocated = (!DataWriter::_isInfo && _numStepsPreallocated > 0) ? _numStepsPreallocated : 1;
 
             if (isMPIRoot) {
                 // Add new external dataset to HDF5 file.
@@ -251,22 +384,32 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
                 } // if
 
                 _h5->createDatasetRawExternal("/vertex_fields", name, _datasetFilename(name).c_str(), maxDims, ndims, scalartype);
+                if (datasetInfo.numTimeStepsAllocated > 1) {
+                    hsize_t dims[ndims];
+                    dims[0] = datasetInfo.numTimeStepsAllocated;
+                    dims[1] = datasetInfo.numPoints;
+                    dims[2] = datasetInfo.fiberDim;
+                    _h5->extendDatasetRawExternal("/vertex_fields", name, dims, ndims);
+                } // if
                 std::string fullName = std::string("/vertex_fields/") + name;
                 const char* sattr = pylith::topology::FieldBase::vectorFieldString(subfield.getDescription().vectorFieldType);
                 _h5->writeAttribute(fullName.c_str(), "vector_field_type", sattr);
             } // if
-        } else if (isMPIRoot) {
+        } else if (needsExtension) {
             // Update number of time steps in external dataset info in HDF5 file.
-            const hsize_t ndims = 3;
-            hsize_t dims[3];
-            dims[0] = datasetInfo.numTimeSteps; // update to current value
-            dims[1] = datasetInfo.numPoints;
-            dims[2] = datasetInfo.fiberDim;
-
-            _h5->extendDatasetRawExternal("/vertex_fields", name, dims, ndims);
+            datasetInfo.numTimeStepsAllocated = std::max(datasetInfo.numTimeSteps,
+                                                         datasetInfo.numTimeStepsAllocated + _numStepsPreallocated);
+            if (isMPIRoot) {
+                const hsize_t ndims = 3;
+                hsize_t dims[3];
+                dims[0] = datasetInfo.numTimeStepsAllocated;
+                dims[1] = datasetInfo.numPoints;
+                dims[2] = datasetInfo.fiberDim;
+                _h5->extendDatasetRawExternal("/vertex_fields", name, dims, ndims);
+            } // if
         } // if/else
 
-        if (isMPIRoot) {
+        if (updateHDF5) {
             _h5->close();
         } // if
     } catch (const std::exception& err) {
@@ -304,36 +447,54 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
         err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
         const bool isMPIRoot = 0 == commRank;
 
-        const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_IEEE_F64BE : H5T_IEEE_F32BE;
+        // PETSc binary viewer writes big-endian values; MPI-IO output writes native values.
+        const bool useOffsetWrites = _useOffsetWrites();
+        const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ?
+                                 (useOffsetWrites ? H5T_NATIVE_DOUBLE : H5T_IEEE_F64BE) :
+                                 (useOffsetWrites ? H5T_NATIVE_FLOAT : H5T_IEEE_F32BE);
 
         // Create external dataset if necessary
-        PetscViewer binaryViewer;
+        PetscViewer binaryViewer = NULL;
         bool createdExternalDataset = false;
         if (_datasets.find(name) != _datasets.end()) {
             binaryViewer = _datasets[name].viewer;
         } else {
-            err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &binaryViewer);PYLITH_CHECK_ERROR(err);
-            err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+            if (!useOffsetWrites) {
+                err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &binaryViewer);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+            } // if
             ExternalDataset dataset;
             dataset.numTimeSteps = 0;
+            dataset.numTimeStepsAllocated = 0;
             dataset.viewer = binaryViewer;
+            dataset.file = MPI_FILE_NULL;
+            dataset.request = MPI_REQUEST_NULL;
+            dataset.bufferIndex = 0;
             _datasets[name] = dataset;
 
             createdExternalDataset = true;
         } // else
-        assert(binaryViewer);
 
         PetscVec vector = subfield.getVector();assert(vector);
-        DataWriter::_writeVec(vector, binaryViewer);
-
         ExternalDataset& datasetInfo = _datasets[name];
+        if (useOffsetWrites) {
+            _writeVecAggregated(&datasetInfo, _datasetFilename(name).c_str(), vector);
+        } else {
+            assert(binaryViewer);
+            DataWriter::_writeVec(vector, binaryViewer);
+        } // if/else
         ++datasetInfo.numTimeSteps;
 
+        // Only open HDF5 file if we need to add a time stamp or add or extend a dataset.
+        const bool needsTimeStamp = _tstampIndex+1 == datasetInfo.numTimeSteps;
+        const bool needsExtension = !createdExternalDataset && datasetInfo.numTimeSteps > datasetInfo.numTimeStepsAllocated;
+        const bool updateHDF5 = isMPIRoot && (createdExternalDataset || needsTimeStamp || needsExtension);
+
         // Update time stamp in "/time, if necessary.
-        if (isMPIRoot) {
+        if (updateHDF5) {
             _h5->open(hdf5Filename().c_str(), H5F_ACC_RDWR);
 
-            if (_tstampIndex+1 == datasetInfo.numTimeSteps) {
+            if (needsTimeStamp) {
                 _writeTimeStamp(t);
             } // if
         } // if
@@ -367,6 +528,7 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
 
             datasetInfo.numPoints = numCells;
             datasetInfo.fiberDim = fiberDim;
+            datasetInfo.numTimeStepsAllocated = (!DataWriter::_isInfo && _numStepsPreallocated > 0) ? _numStepsPreallocated : 1;
 
             if (isMPIRoot) {
                 // Add new external dataset to HDF5 file.
@@ -388,22 +550,33 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
                 } // if
 
                 _h5->createDatasetRawExternal("/cell_fields", name, _datasetFilename(name).c_str(), maxDims, ndims, scalartype);
+                if (datasetInfo.numTimeStepsAllocated > 1) {
+                    hsize_t dims[ndims];
+                    dims[0] = datasetInfo.numTimeStepsAllocated;
+                    dims[1] = datasetInfo.numPoints;
+                    dims[2] = datasetInfo.fiberDim;
+                    _h5->extendDatasetRawExternal("/cell_fields", name, dims, ndims);
+                } // if
                 std::string fullName = std::string("/cell_fields/") + name;
                 const char* sattr = pylith::topology::FieldBase::vectorFieldString(subfield.getDescription().vectorFieldType);
                 _h5->writeAttribute(fullName.c_str(), "vector_field_type", sattr);
             } // if
 
-        } else if (isMPIRoot) {
+        } else if (needsExtension) {
             // Update number of time steps in external dataset info in HDF5 file.
-            const hsize_t ndims = 3;
-            hsize_t dims[3];
-            dims[0] = datasetInfo.numTimeSteps; // update to current value
-            dims[1] = datasetInfo.numPoints;
-            dims[2] = datasetInfo.fiberDim;
-            _h5->extendDatasetRawExternal("/cell_fields", name, dims, ndims);
+            datasetInfo.numTimeStepsAllocated = std::max(datasetInfo.numTimeSteps,
+                                                         datasetInfo.numTimeStepsAllocated + _numStepsPreallocated);
+            if (isMPIRoot) {
+                const hsize_t ndims = 3;
+                hsize_t dims[3];
+                dims[0] = datasetInfo.numTimeStepsAllocated;
+                dims[1] = datasetInfo.numPoints;
+                dims[2] = datasetInfo.fiberDim;
+                _h5->extendDatasetRawExternal("/cell_fields", name, dims, ndims);
+            } // if
         } // if/else
 
-        if (isMPIRoot) {
+        if (updateHDF5) {
             _h5->close();
         } // if
     } catch (const std::exception& err) {
@@ -431,23 +604,26 @@ pylith::meshio::DataWriterHDF5Ext::writePointNames(const pylith::string_vector&
 
     assert(_h5);
 
+    MPI_File file = MPI_FILE_NULL;
     try {
         // Put station names into array of fixed length strings
-        // (numNames*maxStringLegnth) on each process, and then gather
-        // onto root process for writing in serial to HDF5.
+        // (numNames*maxStringLegnth) on each process, and then write
+        // collectively to the external dataset file with each process
+        // writing its names at its offset. The root process only
+        // creates the dataset in the HDF5 file.
         int mpierr;
         MPI_Comm comm = mesh.getComm();
         const int commRank = mesh.getCommRank();
         const int commRoot = 0;
         const bool isMPIRoot = commRoot == commRank;
-        int nprocs = 0;
-        mpierr = MPI_Comm_size(comm, &nprocs);assert(MPI_SUCCESS == mpierr);
 
-        // Number of names on each process.
+        // Total number of names and offset of names on this process.
         const int numNamesLocal = names.size();
-        int_array numNamesArray(nprocs);
-        mpierr = MPI_Allgather((void*)&numNamesLocal, 1, MPI_INT, &numNamesArray[0], 1, MPI_INT, comm);assert(MPI_SUCCESS == mpierr);
-        const int numNames = numNamesArray.sum();
+        int numNames = 0;
+        int numNamesOffset = 0;
+        mpierr = MPI_Allreduce((void*)&numNamesLocal, &numNames, 1, MPI_INT, MPI_SUM, comm);assert(MPI_SUCCESS == mpierr);
+        mpierr = MPI_Exscan((void*)&numNamesLocal, &numNamesOffset, 1, MPI_INT, MPI_SUM, comm);assert(MPI_SUCCESS == mpierr);
+        if (isMPIRoot) { numNamesOffset = 0; } // Result of MPI_Exscan() is undefined on process 0.
 
         // Get maximum string length.
         int maxStringLengthLocal = 0;
@@ -469,31 +645,39 @@ pylith::meshio::DataWriterHDF5Ext::writePointNames(const pylith::string_vector&
             } // for
         } // for
 
-        char_array namesFixedLength;
-        if (isMPIRoot) {namesFixedLength.resize(numNames*maxStringLength);}
-        // Convert numNames array from number of names to total size of names array.
-        numNamesArray *= maxStringLength;
-        int_array offsets;
-        if (isMPIRoot) {
-            offsets.resize(nprocs);
-            offsets[0] = 0;
-            for (int i = 1; i < nprocs; ++i) {
-                offsets[i] = offsets[i-1] + numNamesArray[i-1];
-            } // for
-        } // if
-        mpierr = MPI_Gatherv(&namesFixedLengthLocal[0], numNamesLocal*maxStringLength, MPI_CHAR, &namesFixedLength[0], &numNamesArray[0], &offsets[0], MPI_CHAR, commRoot, comm);
+        const std::string& filename = _datasetFilename("stations");
+        PetscErrorCode petscerr;
+        petscerr = MPI_File_open(comm, const_cast<char*>(filename.c_str()), MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                                 MPI_INFO_NULL, &file);PYLITH_CHECK_ERROR(petscerr);
+        petscerr = MPI_File_set_size(file, 0);PYLITH_CHECK_ERROR(petscerr);
+        const MPI_Offset offset = MPI_Offset(numNamesOffset) * maxStringLength;
+        petscerr = MPI_File_write_at_all(file, offset, numNamesLocal > 0 ? &namesFixedLengthLocal[0] : NULL,
+                                         numNamesLocal*maxStringLength, MPI_CHAR, MPI_STATUS_IGNORE);PYLITH_CHECK_ERROR(petscerr);
+        petscerr = MPI_File_close(&file);PYLITH_CHECK_ERROR(petscerr);
 
         if (isMPIRoot) {
+            hid_t datatype = H5Tcopy(H5T_C_S1);
+            if (datatype < 0) { throw std::runtime_error("Could not create datatype.");}
+            herr_t err = H5Tset_size(datatype, maxStringLength);
+            if (err < 0) { throw std::runtime_error("Could not set size of datatype.");}
+
+            const int ndims = 1;
+            const hsize_t maxDims[ndims] = { hsize_t(numNames) };
             _h5->open(hdf5Filename().c_str(), H5F_ACC_RDWR);
-            _h5->writeDataset("/", "stations", &namesFixedLength[0], numNames, maxStringLength);
+            _h5->createDatasetRawExternal("/", "stations", filename.c_str(), maxDims, ndims, datatype);
             _h5->close();
+
+            err = H5Tclose(datatype);
+            if (err < 0) { throw std::runtime_error("Could not close datatype.");}
         } // if
 
     } catch (const std::exception& err) {
+        if (MPI_FILE_NULL != file) { MPI_File_close(&file); }
         std::ostringstream msg;
         msg << "Error while writing stations to HDF5 file '" << hdf5Filename() << "'.\n" << err.what();
         throw std::runtime_error(msg.str());
     } catch (...) {
+        if (MPI_FILE_NULL != file) { MPI_File_close(&file); }
         std::ostringstream msg;
         msg << "Error while writing stations to HDF5 file '" << hdf5Filename() << "'.";
         throw std::runtime_error(msg.str());
@@ -578,4 +762,163 @@ pylith::meshio::DataWriterHDF5Ext::_writeTimeStamp(const PylithScalar t) {
 } // _writeTimeStamp
 
 
+// ----------------------------------------------------------------------
+// Create communicators for aggregating data onto writer processes.
+void
+pylith::meshio::DataWriterHDF5Ext::_setupAggregation(MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_useOffsetWrites());
+    PetscErrorCode err = 0;
+    if (_aggregateComm != MPI_COMM_NULL) {
+        err = MPI_Comm_free(&_aggregateComm);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (_writerComm != MPI_COMM_NULL) {
+        err = MPI_Comm_free(&_writerComm);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Groups of consecutive processes own contiguous blocks of the global vectors, so each writer process writes a
+    // single contiguous block of values. Without aggregation every process is a writer process.
+    const int aggregationRatio = (_aggregationRatio > 0) ? _aggregationRatio : 1;
+    PetscMPIInt commRank;
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_split(comm, commRank / aggregationRatio, commRank, &_aggregateComm);PYLITH_CHECK_ERROR(err);
+
+    PetscMPIInt aggregateRank;
+    err = MPI_Comm_rank(_aggregateComm, &aggregateRank);PYLITH_CHECK_ERROR(err);
+    const int color = (0 == aggregateRank) ? 0 : MPI_UNDEFINED;
+    err = MPI_Comm_split(comm, color, commRank, &_writerComm);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupAggregation
+
+
+// ----------------------------------------------------------------------
+// Write values in vector for one time step to external file using writer processes.
+void
+pylith::meshio::DataWriterHDF5Ext::_writeVecAggregated(ExternalDataset* dataset,
+                                                       const char* filename,
+                                                       PetscVec vector) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(dataset);
+    assert(filename);
+    assert(vector);
+    assert(_aggregateComm != MPI_COMM_NULL);
+
+    PetscErrorCode err = 0;
+    PetscInt numValuesLocal = 0, numValues = 0, rangeStart = 0;
+    err = VecGetLocalSize(vector, &numValuesLocal);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(vector, &numValues);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(vector, &rangeStart, NULL);PYLITH_CHECK_ERROR(err);
+
+    PetscMPIInt aggregateSize, aggregateRank;
+    err = MPI_Comm_size(_aggregateComm, &aggregateSize);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_rank(_aggregateComm, &aggregateRank);PYLITH_CHECK_ERROR(err);
+    const bool isWriter = 0 == aggregateRank;
+
+    // Gather values onto writer process.
+    int count = numValuesLocal;
+    std::vector<int> counts(isWriter ? aggregateSize : 0);
+    std::vector<int> offsets(isWriter ? aggregateSize : 0);
+    err = MPI_Gather(&count, 1, MPI_INT, isWriter ? &counts[0] : NULL, 1, MPI_INT, 0, _aggregateComm);PYLITH_CHECK_ERROR(err);
+    size_t numValuesGroup = 0;
+    if (isWriter) {
+        for (int i = 0; i < aggregateSize; ++i) {
+            offsets[i] = numValuesGroup;
+            numValuesGroup += counts[i];
+        } // for
+    } // if
+    // Asynchronous writes gather into the buffer that is not being written.
+    const bool useAsync = isWriter && _useAsyncWrites && !_drain;
+    std::vector<PylithScalar> valuesSync;
+    std::vector<PylithScalar>& values = useAsync ? dataset->buffers[dataset->bufferIndex] : valuesSync;
+    values.resize(numValuesGroup);
+
+    const PetscScalar* vectorArray = NULL;
+    err = VecGetArrayRead(vector, &vectorArray);PYLITH_CHECK_ERROR(err);
+    err = MPI_Gatherv((void*)vectorArray, count, MPIU_SCALAR, numValuesGroup > 0 ? &values[0] : NULL,
+                      isWriter ? &counts[0] : NULL, isWriter ? &offsets[0] : NULL, MPIU_SCALAR, 0,
+                      _aggregateComm);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(vector, &vectorArray);PYLITH_CHECK_ERROR(err);
+
+    // Write contiguous block of values from each writer process.
+    const MPI_Offset offset = (MPI_Offset(dataset->numTimeSteps) * numValues + rangeStart) * sizeof(PylithScalar);
+    if (isWriter && _drain) {
+        // Stage block in node-local directory and let drain thread copy it to the external file.
+        assert(_writerComm != MPI_COMM_NULL);
+        PetscMPIInt writerRank;
+        err = MPI_Comm_rank(_writerComm, &writerRank);PYLITH_CHECK_ERROR(err);
+        if (!dataset->numTimeSteps) {
+            if (!writerRank) {
+                std::ofstream fout(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+                if (!fout.is_open()) {
+                    std::ostringstream msg;
+                    msg << "Could not create external dataset file '" << filename << "'.";
+                    throw std::runtime_error(msg.str());
+                } // if
+            } // if
+            err = MPI_Barrier(_writerComm);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        const std::string& stagedFilename = StagingDrain::stagedFilename(_stagingDir, filename, writerRank, dataset->numTimeSteps);
+        std::ofstream fout(stagedFilename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (numValuesGroup > 0) {
+            fout.write((const char*)&values[0], numValuesGroup*sizeof(PylithScalar));
+        } // if
+        fout.close();
+        if (!fout.good()) {
+            std::ostringstream msg;
+            msg << "Could not write staged file '" << stagedFilename << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        _drain->add(stagedFilename, filename, offset);
+    } else if (isWriter) {
+        assert(_writerComm != MPI_COMM_NULL);
+        if (MPI_FILE_NULL == dataset->file) {
+            err = MPI_File_open(_writerComm, const_cast<char*>(filename), MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                                MPI_INFO_NULL, &dataset->file);PYLITH_CHECK_ERROR(err);
+            err = MPI_File_set_size(dataset->file, 0);PYLITH_CHECK_ERROR(err);
+        } // if
+        if (dataset->request != MPI_REQUEST_NULL) {
+            // Finish writing previous time step from the other buffer.
+            err = MPI_Wait(&dataset->request, MPI_STATUS_IGNORE);PYLITH_CHECK_ERROR(err);
+        } // if
+        if (!DataWriter::_isInfo && (_numStepsPreallocated > 0) && (0 == dataset->numTimeSteps % _numStepsPreallocated)) {
+            // Allocate space for next block of time steps.
+            const MPI_Offset size = MPI_Offset(dataset->numTimeSteps + _numStepsPreallocated) * numValues * sizeof(PylithScalar);
+            err = MPI_File_preallocate(dataset->file, size);PYLITH_CHECK_ERROR(err);
+        } // if
+        if (useAsync) {
+            err = MPI_File_iwrite_at(dataset->file, offset, numValuesGroup > 0 ? &values[0] : NULL, numValuesGroup,
+                                     MPIU_SCALAR, &dataset->request);PYLITH_CHECK_ERROR(err);
+            dataset->bufferIndex = 1 - dataset->bufferIndex;
+        } else {
+            err = MPI_File_write_at_all(dataset->file, offset, numValuesGroup > 0 ? &values[0] : NULL, numValuesGroup,
+                                        MPIU_SCALAR, MPI_STATUS_IGNORE);PYLITH_CHECK_ERROR(err);
+        } // if/else
+    } // if
+
+    PYLITH_METHOD_END;
+} // _writeVecAggregated
+
+
+// ----------------------------------------------------------------------
+// Wait for pending nonblocking writes of external datasets to finish.
+void
+pylith::meshio::DataWriterHDF5Ext::_waitForWrites(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    const dataset_type::const_iterator& dEnd = _datasets.end();
+    for (dataset_type::iterator d_iter = _datasets.begin(); d_iter != dEnd; ++d_iter) {
+        if (d_iter->second.request != MPI_REQUEST_NULL) {
+            err = MPI_Wait(&d_iter->second.request, MPI_STATUS_IGNORE);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // _waitForWrites
+
+
 // End of file
@@ -37,6 +37,28 @@
  *   cell_fields - group
  *     CELL_FIELD (name of cell field) - dataset
  *       [ntimesteps, ncells, fiberdim]
+ *
+ * By default the raw external files are written through a PETSc binary viewer, which funnels all of the data
+ * through process 0. With an aggregation ratio greater than zero, each group of that many consecutive processes
+ * gathers its values onto the first process in the group, and only those writer processes write contiguous blocks
+ * to the external files using collective MPI-IO.
+ *
+ * With a nonzero number of preallocated time steps, the external files are written in native byte order at fixed
+ * offsets using MPI-IO (by every process, or by the writer processes when aggregating), and the external files and
+ * HDF5 datasets are sized in blocks of that many time steps. The external files can then be memory-mapped by other
+ * applications while the simulation is running; the "time" dataset gives the number of time steps written.
+ *
+ * With a staging directory (e.g., node-local NVMe), the writer processes write their blocks of the external files
+ * to staged files in that directory and a background thread on each writer process copies them into the external
+ * files at their offsets (see StagingDrain), so writing a time step is limited by the speed of the node-local
+ * storage rather than the parallel file system. The small HDF5 file is still written directly by process 0.
+ * Closing the writer waits for the staged files to be drained.
+ *
+ * With asynchronous writes, each writer process gathers the values of a time step into one of two buffers per
+ * dataset and starts a nonblocking MPI-IO write from it. The write of the next time step for that dataset waits for
+ * the previous write only after gathering into the other buffer, so the solver continues while the file system
+ * completes the write. Without aggregation every process is a writer process. Closing the writer waits for all
+ * pending writes.
  */
 
 #if !defined(pylith_meshio_datawriterhdf5ext_hh)
@@ -45,8 +67,10 @@
 // Include directives ---------------------------------------------------
 #include "DataWriter.hh" // ISA DataWriter
 
+#include <mpi.h> // HASA MPI_Comm, MPI_File, MPI_Request
 #include <string> // USES std::string
 #include <map> // HASA std::map
+#include <vector> // HASA std::vector
 
 // DataWriterHDF5Ext ----------------------------------------------------
 /// Object for writing finite-element data to HDF5 file.
@@ -81,6 +105,54 @@ public:
      */
     void filename(const char* filename);
 
+    /** Set number of processes that aggregate their data onto a single writer process.
+     *
+     * @param[in] value Number of processes per writer process (0 means write through process 0 using PETSc).
+     */
+    void setAggregationRatio(const int value);
+
+    /** Get number of processes that aggregate their data onto a single writer process.
+     *
+     * @returns Number of processes per writer process (0 means write through process 0 using PETSc).
+     */
+    int getAggregationRatio(void) const;
+
+    /** Set number of time steps preallocated in external datasets.
+     *
+     * @param[in] value Number of time steps in each preallocated block (0 means extend datasets every time step).
+     */
+    void setNumStepsPreallocated(const int value);
+
+    /** Get number of time steps preallocated in external datasets.
+     *
+     * @returns Number of time steps in each preallocated block (0 means extend datasets every time step).
+     */
+    int getNumStepsPreallocated(void) const;
+
+    /** Set node-local directory for staging external datasets.
+     *
+     * @param[in] value Name of staging directory (empty means write directly to external files).
+     */
+    void setStagingDir(const char* value);
+
+    /** Get node-local directory for staging external datasets.
+     *
+     * @returns Name of staging directory (empty means write directly to external files).
+     */
+    const char* getStagingDir(void) const;
+
+    /** Set flag for writing external datasets using nonblocking MPI-IO from double buffers.
+     *
+     * @param[in] value True if writes of external datasets should overlap with the computation.
+     */
+    void setUseAsyncWrites(const bool value);
+
+    /** Get flag for writing external datasets using nonblocking MPI-IO from double buffers.
+     *
+     * @returns True if writes of external datasets overlap with the computation.
+     */
+    bool getUseAsyncWrites(void) const;
+
     /** Generate filename for HDF5 file.
      *
      * Appends _info if only writing parameters.
@@ -128,6 +200,22 @@ public:
     void writePointNames(const pylith::string_vector& names,
                          const topology::Mesh& mesh);
 
+    // PRIVATE STRUCTS //////////////////////////////////////////////////////
+private:
+
+    struct ExternalDataset {
+        PetscViewer viewer;
+        MPI_File file; ///< External file for aggregated or asynchronous output (writer processes only).
+        PetscInt numTimeSteps;
+        PetscInt numTimeStepsAllocated; ///< Number of time steps allocated in HDF5 dataset.
+        PetscInt numPoints;
+        PetscInt fiberDim;
+        MPI_Request request; ///< Pending nonblocking write (asynchronous writes only).
+        std::vector<PylithScalar> buffers[2]; ///< Buffers alternating between gathering and writing.
+        int bufferIndex; ///< Index of buffer for gathering next time step.
+    };
+    typedef std::map<std::string, ExternalDataset> dataset_type;
+
     // PRIVATE METHODS //////////////////////////////////////////////////////
 private:
 
@@ -146,21 +234,36 @@ private:
      */
     void _writeTimeStamp(const PylithScalar t);
 
-    // NOT IMPLEMENTED //////////////////////////////////////////////////////
-private:
+    /** Create communicators for aggregating data onto writer processes.
+     *
+     * @param[in] comm MPI communicator for mesh.
+     */
+    void _setupAggregation(MPI_Comm comm);
 
-    const DataWriterHDF5Ext& operator=(const DataWriterHDF5Ext&); ///< Not implemented
+    /** Does writer use MPI-IO to write values at fixed offsets in external files?
+     *
+     * @returns True if aggregating values onto writer processes, preallocating external datasets, staging, or
+     * writing asynchronously.
+     */
+    bool _useOffsetWrites(void) const;
 
-    // PRIVATE STRUCTS //////////////////////////////////////////////////////
+    /** Write values in vector for one time step to external file using writer processes.
+     *
+     * @param[inout] dataset Information for external dataset.
+     * @param[in] filename Name of external file.
+     * @param[in] vector PETSc vector with values.
+     */
+    void _writeVecAggregated(ExternalDataset* dataset,
+                             const char* filename,
+                             PetscVec vector);
+
+    /// Wait for pending nonblocking writes of external datasets to finish.
+    void _waitForWrites(void);
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
-    struct ExternalDataset {
-        PetscViewer viewer;
-        PetscInt numTimeSteps;
-        PetscInt numPoints;
-        PetscInt fiberDim;
-    };
-    typedef std::map<std::string, ExternalDataset> dataset_type;
+    const DataWriterHDF5Ext& operator=(const DataWriterHDF5Ext&); ///< Not implemented
 
     // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private:
@@ -169,6 +272,13 @@ private:
     HDF5* _h5; ///< HDF5 file
     dataset_type _datasets; ///< Datasets
     int _tstampIndex; ///< Index of last time stamp written.
+    int _aggregationRatio; ///< Number of processes per writer process.
+    int _numStepsPreallocated; ///< Number of time steps in each preallocated block of external datasets.
+    MPI_Comm _aggregateComm; ///< Communicator for processes aggregating onto a writer process.
+    MPI_Comm _writerComm; ///< Communicator for writer processes.
+    std::string _stagingDir; ///< Node-local directory for staging external datasets.
+    StagingDrain* _drain; ///< Drain for staged files (writer processes only).
+    bool _useAsyncWrites; ///< Write external datasets using nonblocking MPI-IO from double buffers.
 
 }; // DataWriterHDF5Ext
 
@@ -0,0 +1,371 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "DataWriterHDF5GreensFns.hh" // Implementation of class methods
+
+#include "HDF5.hh" // USES HDF5
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/FieldBase.hh" // USES FieldBase
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT*
+
+#include "petscviewerhdf5.h"
+#include <mpi.h> // USES MPI routines
+
+#include <algorithm> // USES std::min(), std::max()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _DataWriterHDF5GreensFns {
+public:
+
+            /// Target size of chunks in bytes.
+            static const size_t chunkSizeBytes;
+
+            /// Name of group holding Green's functions datasets.
+            static const char* groupName;
+        };
+
+        const size_t _DataWriterHDF5GreensFns::chunkSizeBytes = 1024*1024;
+        const char* _DataWriterHDF5GreensFns::groupName = "/greens_functions";
+    } // meshio
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::DataWriterHDF5GreensFns::DataWriterHDF5GreensFns(void) :
+    _blockSize(64) {
+    PyreComponent::setName("datawriterhdf5greensfns");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::DataWriterHDF5GreensFns::~DataWriterHDF5GreensFns(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::DataWriterHDF5GreensFns::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterHDF5::deallocate();
+    _blocks.clear();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::DataWriterHDF5GreensFns::DataWriterHDF5GreensFns(const DataWriterHDF5GreensFns& w) :
+    DataWriterHDF5(w),
+    _blockSize(w._blockSize) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of impulses buffered in memory before writing them as a block.
+void
+pylith::meshio::DataWriterHDF5GreensFns::setBlockSize(const size_t value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Number of impulses in each block (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _blockSize = value;
+
+    PYLITH_METHOD_END;
+} // setBlockSize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Open output file.
+void
+pylith::meshio::DataWriterHDF5GreensFns::open(const pylith::topology::Mesh& mesh,
+                                              const bool isInfo) {
+    PYLITH_METHOD_BEGIN;
+
+    _blocks.clear();
+    DataWriterHDF5::open(mesh, isInfo);
+    assert(_viewer);
+
+    try {
+        hid_t h5 = -1;
+        PetscErrorCode err = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(err);
+        assert(h5 >= 0);
+
+        hid_t group = H5Gcreate2(h5, _DataWriterHDF5GreensFns::groupName, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        if (group < 0) { throw std::runtime_error("Could not create group."); }
+        herr_t herr = H5Gclose(group);
+        if (herr < 0) { throw std::runtime_error("Could not close group."); }
+    } catch (const std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while opening HDF5 file " << hdf5Filename() << ".\n" << err.what();
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // open
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Close output files.
+void
+pylith::meshio::DataWriterHDF5GreensFns::close(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_viewer) {
+        for (std::map<std::string, MatrixBlock>::iterator iter = _blocks.begin(); iter != _blocks.end(); ++iter) {
+            _writeBlock(iter->first, &iter->second);
+        } // for
+    } // if
+    _blocks.clear();
+
+    // Green's functions matrices are not time series, so we do not generate an Xdmf file.
+    PetscErrorCode err = 0;
+    err = PetscViewerDestroy(&_viewer);PYLITH_CHECK_ERROR(err);assert(!_viewer);
+    err = VecDestroy(&_tstamp);PYLITH_CHECK_ERROR(err);assert(!_tstamp);
+
+    _timesteps.clear();
+    _tstampIndex = 0;
+
+    DataWriter::close();
+
+    PYLITH_METHOD_END;
+} // close
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Prepare file for data at a new impulse.
+void
+pylith::meshio::DataWriterHDF5GreensFns::openTimeStep(const PylithScalar t,
+                                                      const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+    assert(_viewer);
+
+    _writeTimeStamp(t, mesh.getCommRank());
+
+    PYLITH_METHOD_END;
+} // openTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write field over vertices to file.
+void
+pylith::meshio::DataWriterHDF5GreensFns::writeVertexField(const PylithScalar t,
+                                                          const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+
+    try {
+        _appendRow(subfield);
+    } catch (const std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while writing field '" << subfield.getDescription().label << "' at time "
+            << t << " to HDF5 file '" << hdf5Filename() << "'.\n" << err.what();
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // writeVertexField
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write field over cells to file.
+void
+pylith::meshio::DataWriterHDF5GreensFns::writeCellField(const PylithScalar t,
+                                                        const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+
+    try {
+        _appendRow(subfield);
+    } catch (const std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while writing field '" << subfield.getDescription().label << "' at time "
+            << t << " to HDF5 file '" << hdf5Filename() << "'.\n" << err.what();
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // writeCellField
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Append field values as a row of the Green's functions matrix.
+void
+pylith::meshio::DataWriterHDF5GreensFns::_appendRow(const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+    assert(_viewer);
+
+    const pylith::topology::FieldBase::Description& description = subfield.getDescription();
+    PetscVec vector = subfield.getVector();assert(vector);
+    PetscErrorCode err = 0;
+
+    std::map<std::string, MatrixBlock>::iterator iter = _blocks.find(description.label);
+    if (iter == _blocks.end()) {
+        MatrixBlock block;
+        PetscInt size = 0, lo = 0, hi = 0;
+        err = VecGetSize(vector, &size);PYLITH_CHECK_ERROR(err);
+        err = VecGetOwnershipRange(vector, &lo, &hi);PYLITH_CHECK_ERROR(err);
+        block.vectorFieldType = pylith::topology::FieldBase::vectorFieldString(description.vectorFieldType);
+        block.numColumns = size;
+        block.numColumnsLocal = hi - lo;
+        block.columnOffset = lo;
+        block.numRows = 0;
+        block.numRowsWritten = 0;
+        block.fiberDim = description.numComponents;
+        block.basisOrder = subfield.getBasisOrder();
+        block.values.reserve(_blockSize*block.numColumnsLocal);
+        iter = _blocks.insert(std::make_pair(description.label, block)).first;
+    } // if
+    MatrixBlock& block = iter->second;
+
+    PetscInt localSize = 0;
+    err = VecGetLocalSize(vector, &localSize);PYLITH_CHECK_ERROR(err);
+    if (hsize_t(localSize) != block.numColumnsLocal) {
+        std::ostringstream msg;
+        msg << "Local size of field (" << localSize << ") does not match size of Green's functions matrix ("
+            << block.numColumnsLocal << ").";
+        throw std::logic_error(msg.str());
+    } // if
+
+    const PylithScalar* values = NULL;
+    err = VecGetArrayRead(vector, &values);PYLITH_CHECK_ERROR(err);
+    block.values.insert(block.values.end(), values, values+localSize);
+    err = VecRestoreArrayRead(vector, &values);PYLITH_CHECK_ERROR(err);
+    ++block.numRows;
+
+    if (block.numRows >= _blockSize) {
+        _writeBlock(description.label, &block);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _appendRow
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write buffered rows for field to file.
+void
+pylith::meshio::DataWriterHDF5GreensFns::_writeBlock(const std::string& name,
+                                                     MatrixBlock* block) {
+    PYLITH_METHOD_BEGIN;
+    assert(_viewer);
+    assert(block);
+
+    if (!block->numRows) {
+        PYLITH_METHOD_END;
+    } // if
+
+    hid_t h5 = -1;
+    PetscErrorCode petscerr = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(petscerr);
+    assert(h5 >= 0);
+
+    const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    const std::string fullName = std::string(_DataWriterHDF5GreensFns::groupName) + "/" + name;
+    const int ndims = 2;
+    herr_t err = 0;
+
+    const bool isNew = 0 == block->numRowsWritten;
+    hid_t dataset = -1;
+    if (isNew) {
+        // Dataset is extensible in the number of impulses and chunked in blocks of impulses.
+        hsize_t dims[ndims] = { 0, block->numColumns };
+        hsize_t maxDims[ndims] = { H5S_UNLIMITED, block->numColumns };
+        hid_t filespace = H5Screate_simple(ndims, dims, maxDims);
+        if (filespace < 0) { throw std::runtime_error("Could not create filespace."); }
+
+        const size_t chunkColumns = _DataWriterHDF5GreensFns::chunkSizeBytes / sizeof(PylithScalar) / _blockSize;
+        hsize_t chunkDims[ndims] = {
+            _blockSize,
+            std::max(hsize_t(1), std::min(block->numColumns, hsize_t(chunkColumns))),
+        };
+        hid_t property = H5Pcreate(H5P_DATASET_CREATE);
+        if (property < 0) { throw std::runtime_error("Could not create property."); }
+        err = H5Pset_chunk(property, ndims, chunkDims);
+        if (err < 0) { throw std::runtime_error("Could not set chunk size."); }
+
+        dataset = H5Dcreate2(h5, fullName.c_str(), scalartype, filespace, H5P_DEFAULT, property, H5P_DEFAULT);
+        if (dataset < 0) { throw std::runtime_error("Could not create dataset."); }
+        err = H5Pclose(property);
+        if (err < 0) { throw std::runtime_error("Could not close property."); }
+        err = H5Sclose(filespace);
+        if (err < 0) { throw std::runtime_error("Could not close filespace."); }
+    } else {
+        dataset = H5Dopen2(h5, fullName.c_str(), H5P_DEFAULT);
+        if (dataset < 0) { throw std::runtime_error("Could not open dataset."); }
+    } // if/else
+
+    hsize_t dims[ndims] = { block->numRowsWritten + block->numRows, block->numColumns };
+    err = H5Dset_extent(dataset, dims);
+    if (err < 0) { throw std::runtime_error("Could not extend dataset."); }
+
+    hsize_t count[ndims] = { block->numRows, block->numColumnsLocal };
+    hid_t memspace = H5Screate_simple(ndims, count, NULL);
+    if (memspace < 0) { throw std::runtime_error("Could not create memspace."); }
+
+    hid_t dataspace = H5Dget_space(dataset);
+    if (dataspace < 0) { throw std::runtime_error("Could not get dataspace."); }
+    hsize_t offset[ndims] = { block->numRowsWritten, block->columnOffset };
+    err = H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offset, NULL, count, NULL);
+    if (err < 0) { throw std::runtime_error("Could not select hyperslab."); }
+
+    hid_t property = H5Pcreate(H5P_DATASET_XFER);
+    if (property < 0) { throw std::runtime_error("Could not create property."); }
+    H5Pset_dxpl_mpio(property, H5FD_MPIO_COLLECTIVE);
+
+    const PylithScalar* values = block->values.size() ? &block->values[0] : NULL;
+    err = H5Dwrite(dataset, scalartype, memspace, dataspace, property, values);
+    if (err < 0) { throw std::runtime_error("Could not write dataset."); }
+
+    err = H5Pclose(property);
+    if (err < 0) { throw std::runtime_error("Could not close property."); }
+    err = H5Sclose(dataspace);
+    if (err < 0) { throw std::runtime_error("Could not close dataspace."); }
+    err = H5Sclose(memspace);
+    if (err < 0) { throw std::runtime_error("Could not close memspace."); }
+    err = H5Dclose(dataset);
+    if (err < 0) { throw std::runtime_error("Could not close dataset."); }
+
+    if (isNew) {
+        HDF5::writeAttribute(h5, fullName.c_str(), "vector_field_type", block->vectorFieldType.c_str());
+        HDF5::writeAttribute(h5, fullName.c_str(), "fiber_dim", &block->fiberDim, H5T_NATIVE_INT);
+        HDF5::writeAttribute(h5, fullName.c_str(), "basis_order", &block->basisOrder, H5T_NATIVE_INT);
+    } // if
+
+    block->numRowsWritten += block->numRows;
+    block->numRows = 0;
+    block->values.clear();
+
+    PYLITH_METHOD_END;
+} // _writeBlock
+
+
+// End of file
@@ -0,0 +1,178 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/DataWriterHDF5GreensFns.hh
+ *
+ * @brief Object for writing Green's functions to HDF5 file as one matrix per field.
+ *
+ * Each output step (impulse) is a row of the matrix, and each value of the field (point and component) is a
+ * column. Rows are buffered in memory and written collectively in blocks, so the file contains one contiguous,
+ * chunked dataset per field that inversion codes can read (or memory-map) directly.
+ *
+ * HDF5 schema for Green's functions output.
+ *
+ * / - root group
+ *   geometry - group
+ *     vertices - dataset [nvertices, spacedim]
+ *   topology - group
+ *     cells - dataset [ncells, ncorners]
+ *   greens_functions - group
+ *     FIELD (name of field) - dataset [nimpulses, npoints*fiberdim]
+ *       vector_field_type - attribute string
+ *       fiber_dim - attribute int
+ *       basis_order - attribute int
+ *   time - dataset [nimpulses]
+ *   stations - dataset [optional]
+ *     [nvertices, 64]
+ */
+
+#if !defined(pylith_meshio_datawriterhdf5greensfns_hh)
+#define pylith_meshio_datawriterhdf5greensfns_hh
+
+#include "DataWriterHDF5.hh" // ISA DataWriterHDF5
+
+#include <hdf5.h> // USES hsize_t
+#include <vector> // HASA std::vector
+#include <string> // HASA std::string
+
+class pylith::meshio::DataWriterHDF5GreensFns : public DataWriterHDF5 {
+    friend class TestDataWriterHDF5GreensFns; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    DataWriterHDF5GreensFns(void);
+
+    /// Destructor
+    ~DataWriterHDF5GreensFns(void);
+
+    /** Make copy of this object.
+     *
+     * @returns Copy of this.
+     */
+    DataWriter* clone(void) const;
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set number of impulses buffered in memory before writing them as a block.
+     *
+     * @param[in] value Number of impulses in each block.
+     */
+    void setBlockSize(const size_t value);
+
+    /** Get number of impulses buffered in memory before writing them as a block.
+     *
+     * @returns Number of impulses in each block.
+     */
+    size_t getBlockSize(void) const;
+
+    /** Open output file.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] isInfo True if only writing info values.
+     */
+    void open(const topology::Mesh& mesh,
+              const bool isInfo);
+
+    /// Close output files.
+    void close(void);
+
+    /** Prepare file for data at a new impulse.
+     *
+     * @param[in] t Time stamp (impulse index) for new data.
+     * @param[in] mesh PETSc mesh object.
+     */
+    void openTimeStep(const PylithScalar t,
+                      const topology::Mesh& mesh);
+
+    /** Write field over vertices to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 1.
+     */
+    void writeVertexField(const PylithScalar t,
+                          const pylith::meshio::OutputSubfield& subfield);
+
+    /** Write field over cells to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 0.
+     */
+    void writeCellField(const PylithScalar t,
+                        const pylith::meshio::OutputSubfield& subfield);
+
+    // PRIVATE STRUCTS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Buffer with block of rows of the Green's functions matrix for one field.
+    struct MatrixBlock {
+        std::vector<PylithScalar> values; ///< Local values of buffered rows [numRows*numColumnsLocal].
+        std::string vectorFieldType; ///< Vector field type of field.
+        hsize_t numColumns; ///< Global number of columns (values in field).
+        hsize_t numColumnsLocal; ///< Number of columns on this process.
+        hsize_t columnOffset; ///< Offset of columns on this process.
+        hsize_t numRows; ///< Number of buffered rows.
+        hsize_t numRowsWritten; ///< Number of rows already written to file.
+        int fiberDim; ///< Number of components in field.
+        int basisOrder; ///< Basis order of field.
+    };
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Copy constructor.
+     *
+     * @param[in] w Object to copy.
+     */
+    DataWriterHDF5GreensFns(const DataWriterHDF5GreensFns& w);
+
+    /** Append field values as a row of the Green's functions matrix.
+     *
+     * @param[in] subfield Subfield with values.
+     */
+    void _appendRow(const pylith::meshio::OutputSubfield& subfield);
+
+    /** Write buffered rows for field to file.
+     *
+     * @param[in] name Name of field.
+     * @param[inout] block Buffer with rows of matrix for field.
+     */
+    void _writeBlock(const std::string& name,
+                     MatrixBlock* block);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    size_t _blockSize; ///< Number of impulses in each block.
+    std::map<std::string, MatrixBlock> _blocks; ///< Buffered blocks of rows for each field.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    const DataWriterHDF5GreensFns& operator=(const DataWriterHDF5GreensFns&); ///< Not implemented
+
+}; // DataWriterHDF5GreensFns
+
+#include "DataWriterHDF5GreensFns.icc" // inline methods
+
+#endif // pylith_meshio_datawriterhdf5greensfns_hh
+
+// End of file
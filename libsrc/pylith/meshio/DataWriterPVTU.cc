@@ -0,0 +1,726 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "DataWriterPVTU.hh" // Implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES isCohesiveCell()
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <algorithm> // USES std::min()
+#include <fstream> // USES std::ofstream
+#include <cassert> // USES assert()
+#include <cstdint> // USES uint64_t
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _DataWriterPVTU {
+public:
+
+            /// Block of raw appended data in piece.
+            struct Block {
+                const void* data;
+                uint64_t numBytes;
+            };
+
+            /** Add data array to piece with values in raw appended data.
+             *
+             * @param[inout] xml XML for piece.
+             * @param[inout] blocks Blocks of appended data.
+             * @param[inout] offset Offset of next block in appended data.
+             * @param[in] type VTK type of values.
+             * @param[in] name Name of data array.
+             * @param[in] numComponents Number of components.
+             * @param[in] data Values.
+             * @param[in] numBytes Size of values in bytes.
+             */
+            static
+            void addArray(std::ostringstream* xml,
+                          std::vector<Block>* blocks,
+                          uint64_t* offset,
+                          const char* type,
+                          const std::string& name,
+                          const int numComponents,
+                          const void* data,
+                          const uint64_t numBytes);
+
+            /** Get VTK cell type for PETSc cell type.
+             *
+             * @param[in] cellType PETSc cell type.
+             * @returns VTK cell type.
+             */
+            static
+            unsigned char vtkCellType(const DMPolytopeType cellType);
+
+            /** Get byte order of this machine.
+             *
+             * @returns VTK byte order string.
+             */
+            static
+            const char* byteOrder(void);
+
+            /** Get VTK type for PylithInt.
+             *
+             * @returns VTK integer type string.
+             */
+            static
+            const char* intType(void);
+
+            /** Get basename of a filename (remove directories).
+             *
+             * @param[in] filename Filename.
+             * @returns Filename without directories.
+             */
+            static
+            std::string basename(const std::string& filename);
+
+        }; // _DataWriterPVTU
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::DataWriterPVTU::DataWriterPVTU(void) :
+    _timeConstant(1.0),
+    _filename("output.pvtu"),
+    _timeFormat("%f"),
+    _stepFilename(""),
+    _dm(NULL),
+    _commRank(0),
+    _commSize(1),
+    _tstamp(0.0),
+    _isOpenTimeStep(false) {
+    PyreComponent::setName("datawriterpvtu");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::DataWriterPVTU::~DataWriterPVTU(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::DataWriterPVTU::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    closeTimeStep(); // Insure time step is closed.
+    close(); // Insure clean up.
+    DataWriter::deallocate();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::DataWriterPVTU::DataWriterPVTU(const DataWriterPVTU& w) :
+    DataWriter(w),
+    _timeConstant(w._timeConstant),
+    _filename(w._filename),
+    _timeFormat(w._timeFormat),
+    _stepFilename(""),
+    _dm(NULL),
+    _commRank(0),
+    _commSize(1),
+    _tstamp(0.0),
+    _isOpenTimeStep(false) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Set value used to normalize time stamp in name of VTK file.
+void
+pylith::meshio::DataWriterPVTU::timeConstant(const PylithScalar value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Time used to normalize time stamp in VTK data files must be "
+            << "positive.\nCurrent value is " << value << ".";
+        throw std::runtime_error(msg.str());
+    } // if
+    _timeConstant = value;
+
+    PYLITH_METHOD_END;
+} // timeConstant
+
+
+// ------------------------------------------------------------------------------------------------
+// Prepare for writing files.
+void
+pylith::meshio::DataWriterPVTU::open(const pylith::topology::Mesh& mesh,
+                                     const bool isInfo) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriter::open(mesh, isInfo);
+
+    // Save handle for actions required in closeTimeStep() and close();
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+    _dm = mesh.getDM();assert(_dm);
+    err = PetscObjectReference((PetscObject) _dm);PYLITH_CHECK_ERROR(err);
+
+    MPI_Comm comm = mesh.getComm();
+    err = MPI_Comm_rank(comm, &_commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &_commSize);PYLITH_CHECK_ERROR(err);
+
+    _setupGeometry(mesh);
+    _collectionTimes.clear();
+    _collectionFiles.clear();
+
+    PYLITH_METHOD_END;
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close output files.
+void
+pylith::meshio::DataWriterPVTU::close(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_isOpen) {
+        assert(_dm);
+        PetscErrorCode err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    _vertices.clear();
+    _cells.clear();
+    _coordinates.clear();
+    _connectivity.clear();
+    _offsets.clear();
+    _cellTypes.clear();
+
+    DataWriter::close();
+
+    PYLITH_METHOD_END;
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Prepare file for data at a new time step.
+void
+pylith::meshio::DataWriterPVTU::openTimeStep(const PylithScalar t,
+                                             const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_dm && _dm == mesh.getDM());
+    assert(_isOpen && !_isOpenTimeStep);
+
+    _stepFilename = _pvtuFilename(t);
+    _tstamp = t * _timeScale;
+    _vertexFields.clear();
+    _cellFields.clear();
+
+    _isOpenTimeStep = true;
+
+    PYLITH_METHOD_END;
+} // openTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+/// Cleanup after writing data for a time step.
+void
+pylith::meshio::DataWriterPVTU::closeTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_isOpenTimeStep) {
+        _writePiece();
+        if (0 == _commRank) {
+            _writeParallelFile();
+        } // if
+    } // if
+
+    _vertexFields.clear();
+    _cellFields.clear();
+    _isOpenTimeStep = false;
+
+    PYLITH_METHOD_END;
+} // closeTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Write field over vertices to file.
+void
+pylith::meshio::DataWriterPVTU::writeVertexField(const PylithScalar t,
+                                                 const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+    assert(_isOpen && _isOpenTimeStep);
+
+    _vertexFields.push_back(DataArray());
+    _extractValues(&_vertexFields.back(), subfield, _vertices);
+
+    PYLITH_METHOD_END;
+} // writeVertexField
+
+
+// ------------------------------------------------------------------------------------------------
+// Write field over cells to file.
+void
+pylith::meshio::DataWriterPVTU::writeCellField(const PylithScalar t,
+                                               const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+    assert(_isOpen && _isOpenTimeStep);
+
+    _cellFields.push_back(DataArray());
+    _extractValues(&_cellFields.back(), subfield, _cells);
+
+    PYLITH_METHOD_END;
+} // writeCellField
+
+
+// ------------------------------------------------------------------------------------------------
+// Generate filename for file without extension and time stamp.
+std::string
+pylith::meshio::DataWriterPVTU::_baseFilename(void) const {
+    const size_t indexExt = _filename.rfind(".pvtu");
+    return (indexExt != std::string::npos) ? std::string(_filename, 0, indexExt) : _filename;
+} // _baseFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Generate filename for parallel VTK file for time step.
+std::string
+pylith::meshio::DataWriterPVTU::_pvtuFilename(const PylithScalar t) const {
+    PYLITH_METHOD_BEGIN;
+
+    std::ostringstream filename;
+    if (!DataWriter::_isInfo) {
+        // If data with multiple time steps, then add time stamp to filename
+        char sbuffer[256];
+        snprintf(sbuffer, sizeof(sbuffer), _timeFormat.c_str(), t * _timeScale / _timeConstant);
+        std::string timestamp(sbuffer);
+        const size_t pos = timestamp.find(".");
+        if (pos != std::string::npos) {
+            timestamp.erase(pos, 1);
+        } // if
+        filename << _baseFilename() << "_t" << timestamp << ".pvtu";
+    } else {
+        filename << _baseFilename() << "_info.pvtu";
+    } // if/else
+
+    PYLITH_METHOD_RETURN(std::string(filename.str()));
+} // _pvtuFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Generate filename for piece written by process.
+std::string
+pylith::meshio::DataWriterPVTU::_vtuFilename(const std::string& pvtuFilename,
+                                             const int rank) {
+    std::ostringstream filename;
+    filename << std::string(pvtuFilename, 0, pvtuFilename.rfind(".pvtu")) << "_p" << rank << ".vtu";
+    return std::string(filename.str());
+} // _vtuFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Gather topology and geometry of cells owned by this process.
+void
+pylith::meshio::DataWriterPVTU::_setupGeometry(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dm = mesh.getDM();assert(dm);
+    PetscErrorCode err = PETSC_SUCCESS;
+
+    PetscInt pStart = 0, pEnd = 0, cStart = 0, cEnd = 0, vStart = 0, vEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    const bool isPointMesh = (cStart == vStart) && (cEnd == vEnd);
+
+    // Points shared with other processes that are owned by another process are leaves of the point SF.
+    std::vector<bool> isGhost(pEnd-pStart, false);
+    PetscSF sf = NULL;
+    PetscInt numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sf, NULL, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        const PetscInt point = leaves ? leaves[iLeaf] : iLeaf;
+        isGhost[point-pStart] = true;
+    } // for
+
+    std::vector<PylithInt> vertexIndex(vEnd-vStart, -1);
+    _vertices.clear();
+    _cells.clear();
+    _connectivity.clear();
+    _offsets.clear();
+    _cellTypes.clear();
+
+    PetscInt cellVertices[64];
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        if (!isPointMesh && pylith::topology::MeshOps::isCohesiveCell(dm, cell)) { break; }
+        if (isGhost[cell-pStart]) { continue; }
+
+        PetscInt numCellVertices = 0;
+        DMPolytopeType cellType = DM_POLYTOPE_POINT;
+        if (isPointMesh) {
+            cellVertices[numCellVertices++] = cell;
+        } else {
+            PetscInt closureSize = 0;
+            PetscInt* closure = NULL;
+            err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iPoint = 0; iPoint < 2*closureSize; iPoint += 2) {
+                const PetscInt point = closure[iPoint];
+                if ((point >= vStart) && (point < vEnd)) {
+                    assert(numCellVertices < 64);
+                    cellVertices[numCellVertices++] = point;
+                } // if
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetCellType(dm, cell, &cellType);PYLITH_CHECK_ERROR(err);
+            // VTK ordering of vertices is inverted with respect to PETSc.
+            err = DMPlexInvertCell(cellType, cellVertices);PYLITH_CHECK_ERROR(err);
+        } // if/else
+
+        for (PetscInt iVertex = 0; iVertex < numCellVertices; ++iVertex) {
+            PylithInt& index = vertexIndex[cellVertices[iVertex]-vStart];
+            if (index < 0) {
+                index = _vertices.size();
+                _vertices.push_back(cellVertices[iVertex]);
+            } // if
+            _connectivity.push_back(index);
+        } // for
+        _offsets.push_back(_connectivity.size());
+        _cells.push_back(cell);
+        _cellTypes.push_back(_DataWriterPVTU::vtkCellType(cellType));
+    } // for
+
+    // Coordinates of vertices (dimensioned, padded to 3 components).
+    PetscVec coordinatesVec = NULL;
+    PetscSection coordinatesSection = NULL;
+    PetscInt spaceDim = 0;
+    PylithReal lengthScale = 1.0;
+    err = DMGetCoordinatesLocal(dm, &coordinatesVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinateSection(dm, &coordinatesSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinateDim(dm, &spaceDim);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+
+    const size_t numVertices = _vertices.size();
+    _coordinates.assign(numVertices*3, 0.0);
+    const PetscScalar* coordinatesArray = NULL;
+    err = VecGetArrayRead(coordinatesVec, &coordinatesArray);PYLITH_CHECK_ERROR(err);
+    for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+        PetscInt off = 0;
+        err = PetscSectionGetOffset(coordinatesSection, _vertices[iVertex], &off);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            _coordinates[iVertex*3+iDim] = coordinatesArray[off+iDim] * lengthScale;
+        } // for
+    } // for
+    err = VecRestoreArrayRead(coordinatesVec, &coordinatesArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupGeometry
+
+
+// ------------------------------------------------------------------------------------------------
+// Extract values of subfield at local vertices or cells.
+void
+pylith::meshio::DataWriterPVTU::_extractValues(DataArray* array,
+                                               const pylith::meshio::OutputSubfield& subfield,
+                                               const std::vector<PylithInt>& points) {
+    PYLITH_METHOD_BEGIN;
+    assert(array);
+
+    const pylith::topology::FieldBase::Description& description = subfield.getDescription();
+    const int numComponents = description.numComponents;
+    array->name = description.label;
+    array->numComponents = ((description.vectorFieldType == pylith::topology::FieldBase::VECTOR) && (numComponents < 3)) ?
+                           3 : numComponents;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dmSubfield = subfield.getDM();assert(dmSubfield);
+    PetscVec localVec = NULL;
+    err = DMGetLocalVector(dmSubfield, &localVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmSubfield, subfield.getVector(), INSERT_VALUES, localVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSubfield, subfield.getVector(), INSERT_VALUES, localVec);PYLITH_CHECK_ERROR(err);
+    PetscSection section = NULL;
+    err = DMGetLocalSection(dmSubfield, &section);PYLITH_CHECK_ERROR(err);
+
+    const size_t numPoints = points.size();
+    array->values.assign(numPoints*array->numComponents, 0.0);
+    const PetscScalar* valuesArray = NULL;
+    err = VecGetArrayRead(localVec, &valuesArray);PYLITH_CHECK_ERROR(err);
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        PetscInt dof = 0, off = 0;
+        err = PetscSectionGetDof(section, points[iPoint], &dof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(section, points[iPoint], &off);PYLITH_CHECK_ERROR(err);
+        const PetscInt numValues = std::min(dof, PetscInt(array->numComponents));
+        for (PetscInt iComponent = 0; iComponent < numValues; ++iComponent) {
+            array->values[iPoint*array->numComponents+iComponent] = valuesArray[off+iComponent];
+        } // for
+    } // for
+    err = VecRestoreArrayRead(localVec, &valuesArray);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSubfield, &localVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _extractValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Write piece for this process.
+void
+pylith::meshio::DataWriterPVTU::_writePiece(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const std::string& filename = _vtuFilename(_stepFilename, _commRank);
+    std::ofstream fout(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open VTK file '" << filename << "' for writing.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Blocks of appended data in the order they are referenced.
+    std::vector<_DataWriterPVTU::Block> blocks;
+    uint64_t offset = 0;
+    std::ostringstream xml;
+    const char* intType = _DataWriterPVTU::intType();
+
+    const size_t numFields = _vertexFields.size() + _cellFields.size();
+    blocks.reserve(4 + numFields);
+
+    xml << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << _DataWriterPVTU::byteOrder()
+        << "\" header_type=\"UInt64\">\n"
+        << "  <UnstructuredGrid>\n"
+        << "    <Piece NumberOfPoints=\"" << _vertices.size() << "\" NumberOfCells=\"" << _cells.size() << "\">\n";
+
+    xml << "      <PointData>\n";
+    for (size_t i = 0; i < _vertexFields.size(); ++i) {
+        const DataArray& array = _vertexFields[i];
+        _DataWriterPVTU::addArray(&xml, &blocks, &offset, "Float64", array.name, array.numComponents,
+                                  array.values.data(), array.values.size()*sizeof(PylithScalar));
+    } // for
+    xml << "      </PointData>\n";
+
+    xml << "      <CellData>\n";
+    for (size_t i = 0; i < _cellFields.size(); ++i) {
+        const DataArray& array = _cellFields[i];
+        _DataWriterPVTU::addArray(&xml, &blocks, &offset, "Float64", array.name, array.numComponents,
+                                  array.values.data(), array.values.size()*sizeof(PylithScalar));
+    } // for
+    xml << "      </CellData>\n";
+
+    xml << "      <Points>\n";
+    _DataWriterPVTU::addArray(&xml, &blocks, &offset, "Float64", "Points", 3,
+                              _coordinates.data(), _coordinates.size()*sizeof(PylithScalar));
+    xml << "      </Points>\n";
+
+    xml << "      <Cells>\n";
+    _DataWriterPVTU::addArray(&xml, &blocks, &offset, intType, "connectivity", 1,
+                              _connectivity.data(), _connectivity.size()*sizeof(PylithInt));
+    _DataWriterPVTU::addArray(&xml, &blocks, &offset, intType, "offsets", 1,
+                              _offsets.data(), _offsets.size()*sizeof(PylithInt));
+    _DataWriterPVTU::addArray(&xml, &blocks, &offset, "UInt8", "types", 1,
+                              _cellTypes.data(), _cellTypes.size()*sizeof(unsigned char));
+    xml << "      </Cells>\n";
+
+    xml << "    </Piece>\n"
+        << "  </UnstructuredGrid>\n"
+        << "  <AppendedData encoding=\"raw\">\n"
+        << "_";
+    fout << xml.str();
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        fout.write((const char*)&blocks[i].numBytes, sizeof(uint64_t));
+        if (blocks[i].numBytes > 0) {
+            fout.write((const char*)blocks[i].data, blocks[i].numBytes);
+        } // if
+    } // for
+    fout << "\n  </AppendedData>\n"
+         << "</VTKFile>\n";
+    fout.close();
+
+    PYLITH_METHOD_END;
+} // _writePiece
+
+
+// ------------------------------------------------------------------------------------------------
+// Write parallel VTK file and collection file.
+void
+pylith::meshio::DataWriterPVTU::_writeParallelFile(void) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(0 == _commRank);
+    const char* intType = _DataWriterPVTU::intType();
+
+    std::ofstream fout(_stepFilename.c_str());
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open parallel VTK file '" << _stepFilename << "' for writing.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    fout << "<?xml version=\"1.0\"?>\n"
+         << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\"" << _DataWriterPVTU::byteOrder()
+         << "\" header_type=\"UInt64\">\n"
+         << "  <PUnstructuredGrid GhostLevel=\"0\">\n";
+    fout << "    <PPointData>\n";
+    for (size_t i = 0; i < _vertexFields.size(); ++i) {
+        fout << "      <PDataArray type=\"Float64\" Name=\"" << _vertexFields[i].name << "\" NumberOfComponents=\""
+             << _vertexFields[i].numComponents << "\"/>\n";
+    } // for
+    fout << "    </PPointData>\n";
+    fout << "    <PCellData>\n";
+    for (size_t i = 0; i < _cellFields.size(); ++i) {
+        fout << "      <PDataArray type=\"Float64\" Name=\"" << _cellFields[i].name << "\" NumberOfComponents=\""
+             << _cellFields[i].numComponents << "\"/>\n";
+    } // for
+    fout << "    </PCellData>\n";
+    fout << "    <PPoints>\n"
+         << "      <PDataArray type=\"Float64\" Name=\"Points\" NumberOfComponents=\"3\"/>\n"
+         << "    </PPoints>\n"
+         << "    <PCells>\n"
+         << "      <PDataArray type=\"" << intType << "\" Name=\"connectivity\" NumberOfComponents=\"1\"/>\n"
+         << "      <PDataArray type=\"" << intType << "\" Name=\"offsets\" NumberOfComponents=\"1\"/>\n"
+         << "      <PDataArray type=\"UInt8\" Name=\"types\" NumberOfComponents=\"1\"/>\n"
+         << "    </PCells>\n";
+    for (int rank = 0; rank < _commSize; ++rank) {
+        fout << "    <Piece Source=\"" << _DataWriterPVTU::basename(_vtuFilename(_stepFilename, rank)) << "\"/>\n";
+    } // for
+    fout << "  </PUnstructuredGrid>\n"
+         << "</VTKFile>\n";
+    fout.close();
+
+    if (DataWriter::_isInfo) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Rewrite collection so that it is complete after every time step.
+    _collectionTimes.push_back(_tstamp);
+    _collectionFiles.push_back(_DataWriterPVTU::basename(_stepFilename));
+    const std::string& pvdFilename = _baseFilename() + ".pvd";
+    std::ofstream fpvd(pvdFilename.c_str());
+    if (!fpvd.is_open() || !fpvd.good()) {
+        std::ostringstream msg;
+        msg << "Could not open VTK collection file '" << pvdFilename << "' for writing.";
+        throw std::runtime_error(msg.str());
+    } // if
+    fpvd << "<?xml version=\"1.0\"?>\n"
+         << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"" << _DataWriterPVTU::byteOrder() << "\">\n"
+         << "  <Collection>\n";
+    fpvd.precision(16);
+    for (size_t i = 0; i < _collectionFiles.size(); ++i) {
+        fpvd << "    <DataSet timestep=\"" << _collectionTimes[i] << "\" group=\"\" part=\"0\" file=\""
+             << _collectionFiles[i] << "\"/>\n";
+    } // for
+    fpvd << "  </Collection>\n"
+         << "</VTKFile>\n";
+    fpvd.close();
+
+    PYLITH_METHOD_END;
+} // _writeParallelFile
+
+
+// ------------------------------------------------------------------------------------------------
+// Add data array to piece with values in raw appended data.
+void
+pylith::meshio::_DataWriterPVTU::addArray(std::ostringstream* xml,
+                                          std::vector<Block>* blocks,
+                                          uint64_t* offset,
+                                          const char* type,
+                                          const std::string& name,
+                                          const int numComponents,
+                                          const void* data,
+                                          const uint64_t numBytes) {
+    assert(xml);
+    assert(blocks);
+    assert(offset);
+
+    *xml << "        <DataArray type=\"" << type << "\" Name=\"" << name << "\" NumberOfComponents=\"" << numComponents
+         << "\" format=\"appended\" offset=\"" << *offset << "\"/>\n";
+    Block block;
+    block.data = data;
+    block.numBytes = numBytes;
+    blocks->push_back(block);
+    *offset += sizeof(uint64_t) + numBytes;
+} // addArray
+
+
+// ------------------------------------------------------------------------------------------------
+// Get VTK cell type for PETSc cell type.
+unsigned char
+pylith::meshio::_DataWriterPVTU::vtkCellType(const DMPolytopeType cellType) {
+    unsigned char vtkType = 0;
+    switch (cellType) {
+    case DM_POLYTOPE_POINT:
+        vtkType = 1; // VTK_VERTEX
+        break;
+    case DM_POLYTOPE_SEGMENT:
+        vtkType = 3; // VTK_LINE
+        break;
+    case DM_POLYTOPE_TRIANGLE:
+        vtkType = 5; // VTK_TRIANGLE
+        break;
+    case DM_POLYTOPE_QUADRILATERAL:
+        vtkType = 9; // VTK_QUAD
+        break;
+    case DM_POLYTOPE_TETRAHEDRON:
+        vtkType = 10; // VTK_TETRA
+        break;
+    case DM_POLYTOPE_HEXAHEDRON:
+        vtkType = 12; // VTK_HEXAHEDRON
+        break;
+    default: {
+        std::ostringstream msg;
+        msg << "Unsupported cell type '" << DMPolytopeTypes[cellType] << "' for VTK output.";
+        throw std::logic_error(msg.str());
+    } // default
+    } // switch
+    return vtkType;
+} // vtkCellType
+
+
+// ------------------------------------------------------------------------------------------------
+// Get byte order of this machine.
+const char*
+pylith::meshio::_DataWriterPVTU::byteOrder(void) {
+    const uint16_t value = 1;
+    return (*(const unsigned char*)&value) ? "LittleEndian" : "BigEndian";
+} // byteOrder
+
+
+// ------------------------------------------------------------------------------------------------
+// Get VTK type for PylithInt.
+const char*
+pylith::meshio::_DataWriterPVTU::intType(void) {
+    return (sizeof(PylithInt) == 8) ? "Int64" : "Int32";
+} // intType
+
+
+// ------------------------------------------------------------------------------------------------
+// Get basename of a filename (remove directories).
+std::string
+pylith::meshio::_DataWriterPVTU::basename(const std::string& filename) {
+    const size_t pos = filename.rfind('/');
+    return (pos != std::string::npos) ? std::string(filename, pos+1) : filename;
+} // basename
+
+
+// End of file
@@ -0,0 +1,233 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/DataWriterPVTU.hh
+ *
+ * @brief Object for writing finite-element data to partitioned XML VTK files.
+ *
+ * Each process writes the cells it owns (and the vertices in their closure) to its own unstructured grid piece
+ * (.vtu) with the values stored as raw binary appended data. Process 0 writes the parallel unstructured grid file
+ * (.pvtu) referencing the pieces for each time step and a collection file (.pvd) with the time associated with each
+ * time step.
+ *
+ * Files for data with name FILENAME.pvtu:
+ *   FILENAME.pvd - collection of time steps
+ *   FILENAME_tTIMESTAMP.pvtu - parallel unstructured grid for time step
+ *   FILENAME_tTIMESTAMP_pRANK.vtu - piece for process RANK for time step
+ */
+
+#if !defined(pylith_meshio_datawriterpvtu_hh)
+#define pylith_meshio_datawriterpvtu_hh
+
+// Include directives ---------------------------------------------------
+#include "DataWriter.hh" // ISA DataWriter
+
+#include "pylith/utils/array.hh" // HASA string_vector
+#include "pylith/utils/petscfwd.h" // HASA PetscDM
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+// DataWriterPVTU -------------------------------------------------------
+/// Object for writing finite-element data to partitioned XML VTK files.
+class pylith::meshio::DataWriterPVTU : public DataWriter {
+    friend class TestDataWriterPVTU; // unit testing
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    DataWriterPVTU(void);
+
+    /// Destructor
+    ~DataWriterPVTU(void);
+
+    /** Make copy of this object.
+     *
+     * @returns Copy of this.
+     */
+    DataWriter* clone(void) const;
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set filename for parallel VTK file.
+     *
+     * @param[in] filename Name of parallel VTK file.
+     */
+    void filename(const char* filename);
+
+    /** Set time format for time stamp in name of VTK file.
+     *
+     * @param[in] format C style time format for filename.
+     */
+    void timeFormat(const char* format);
+
+    /** Set value used to normalize time stamp in name of VTK file.
+     *
+     * Time stamp is divided by this value (time in seconds).
+     *
+     * @param[in] value Value (time in seconds) used to normalize time stamp in
+     * filename.
+     */
+    void timeConstant(const PylithScalar value);
+
+    /** Prepare for writing files.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] isInfo True if only writing info values.
+     */
+    void open(const topology::Mesh& mesh,
+              const bool isInfo);
+
+    /// Close output files.
+    void close(void);
+
+    /** Prepare file for data at a new time step.
+     *
+     * @param[in] t Time stamp for new data
+     * @param[in] mesh Finite-element mesh.
+     */
+    void openTimeStep(const PylithScalar t,
+                      const topology::Mesh& mesh);
+
+    /// Cleanup after writing data for a time step.
+    void closeTimeStep(void);
+
+    /** Write field over vertices to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 1.
+     */
+    void writeVertexField(const PylithScalar t,
+                          const pylith::meshio::OutputSubfield& field);
+
+    /** Write field over cells to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 0.
+     */
+    void writeCellField(const PylithScalar t,
+                        const pylith::meshio::OutputSubfield& subfield);
+
+    // PRIVATE STRUCTS //////////////////////////////////////////////////////
+private:
+
+    struct DataArray {
+        std::string name; ///< Name of field.
+        int numComponents; ///< Number of components in VTK file.
+        std::vector<PylithScalar> values; ///< Values at local vertices or cells [numPoints*numComponents].
+    };
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Copy constructor.
+     *
+     * @param[in] w Object to copy.
+     */
+    DataWriterPVTU(const DataWriterPVTU& w);
+
+    /** Generate filename for file without extension and time stamp.
+     *
+     * @returns Filename without extension.
+     */
+    std::string _baseFilename(void) const;
+
+    /** Generate filename for parallel VTK file for time step.
+     *
+     * @param[in] t Time in seconds.
+     * @returns Filename of parallel VTK file.
+     */
+    std::string _pvtuFilename(const PylithScalar t) const;
+
+    /** Generate filename for piece written by process.
+     *
+     * @param[in] pvtuFilename Name of parallel VTK file.
+     * @param[in] rank Rank of process.
+     * @returns Filename of piece.
+     */
+    static
+    std::string _vtuFilename(const std::string& pvtuFilename,
+                             const int rank);
+
+    /** Gather topology and geometry of cells owned by this process.
+     *
+     * @param[in] mesh Finite-element mesh.
+     */
+    void _setupGeometry(const pylith::topology::Mesh& mesh);
+
+    /** Extract values of subfield at local vertices or cells.
+     *
+     * @param[out] array Data array for subfield.
+     * @param[in] subfield Subfield to extract.
+     * @param[in] points Points (vertices or cells) with values.
+     */
+    void _extractValues(DataArray* array,
+                        const pylith::meshio::OutputSubfield& subfield,
+                        const std::vector<PylithInt>& points);
+
+    /// Write piece for this process.
+    void _writePiece(void);
+
+    /// Write parallel VTK file and collection file (process 0 only).
+    void _writeParallelFile(void);
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    const DataWriterPVTU& operator=(const DataWriterPVTU&); ///< Not implemented
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    /// Time value (in seconds) used to normalize time stamp.
+    PylithScalar _timeConstant;
+
+    std::string _filename; ///< Name of parallel VTK file.
+    std::string _timeFormat; ///< C style time format for time stamp.
+    std::string _stepFilename; ///< Name of parallel VTK file for current time step.
+
+    PetscDM _dm; ///< Handle to PETSc DM for mesh
+    int _commRank; ///< Rank of this process.
+    int _commSize; ///< Number of processes.
+
+    std::vector<PylithInt> _vertices; ///< Local vertices in closure of cells owned by this process.
+    std::vector<PylithInt> _cells; ///< Cells owned by this process.
+    std::vector<PylithScalar> _coordinates; ///< Coordinates of vertices [numVertices*3].
+    std::vector<PylithInt> _connectivity; ///< Indices of vertices (in _vertices) in cells.
+    std::vector<PylithInt> _offsets; ///< End of each cell in connectivity.
+    std::vector<unsigned char> _cellTypes; ///< VTK cell type of each cell.
+
+    std::vector<DataArray> _vertexFields; ///< Vertex fields for current time step.
+    std::vector<DataArray> _cellFields; ///< Cell fields for current time step.
+    PylithScalar _tstamp; ///< Time (dimensional) of current time step.
+
+    std::vector<PylithScalar> _collectionTimes; ///< Times of time steps in collection.
+    pylith::string_vector _collectionFiles; ///< Parallel VTK files in collection.
+
+    bool _isOpenTimeStep; ///< true if called openTimeStep().
+
+}; // DataWriterPVTU
+
+#include "DataWriterPVTU.icc" // inline methods
+
+#endif // pylith_meshio_datawriterpvtu_hh
+
+// End of file
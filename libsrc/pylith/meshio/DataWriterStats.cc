@@ -0,0 +1,301 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "DataWriterStats.hh" // Implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/FieldBase.hh" // USES FieldBase
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include "petscvec.h" // USES PetscVec
+
+#include <algorithm> // USES std::min(), std::max()
+#include <cassert> // USES assert()
+#include <cfloat> // USES DBL_MAX
+#include <cmath> // USES sqrt()
+#include <iomanip> // USES std::setprecision()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _DataWriterStats {
+public:
+
+            /** Reduction operator combining [min(n), max(n), sumsq(n)] arrays of statistics.
+             *
+             * @param[in] invec Statistics from other process.
+             * @param[inout] inoutvec Statistics on this process.
+             * @param[in] len Length of arrays (3*n).
+             * @param[in] datatype MPI datatype (MPI_DOUBLE).
+             */
+            static
+            void reduceStats(void* invec,
+                             void* inoutvec,
+                             int* len,
+                             MPI_Datatype* datatype);
+
+        }; // _DataWriterStats
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::DataWriterStats::DataWriterStats(void) :
+    _filename("output.txt"),
+    _comm(MPI_COMM_NULL),
+    _precision(6) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::DataWriterStats::~DataWriterStats(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::DataWriterStats::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    close(); // Insure clean up.
+    DataWriter::deallocate();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::DataWriterStats::DataWriterStats(const DataWriterStats& w) :
+    DataWriter(w),
+    _filename(w._filename),
+    _comm(MPI_COMM_NULL),
+    _precision(w._precision) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Set filename for ASCII file.
+void
+pylith::meshio::DataWriterStats::setFilename(const char* filename) {
+    PYLITH_METHOD_BEGIN;
+
+    _filename = filename;
+
+    PYLITH_METHOD_END;
+} // setFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Set precision of floating point values in output.
+void
+pylith::meshio::DataWriterStats::setPrecision(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value <= 0) {
+        std::ostringstream msg;
+        msg << "Floating point precision (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _precision = value;
+
+    PYLITH_METHOD_END;
+} // setPrecision
+
+
+// ------------------------------------------------------------------------------------------------
+// Open output file.
+void
+pylith::meshio::DataWriterStats::open(const pylith::topology::Mesh& mesh,
+                                      const bool isInfo) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriter::open(mesh, isInfo);
+
+    _comm = mesh.getComm();
+    if (0 == mesh.getCommRank()) {
+        _file.open(_filename.c_str(), std::ios::out | std::ios::trunc);
+        if (!_file.is_open() || !_file.good()) {
+            std::ostringstream msg;
+            msg << "Could not open file '" << _filename << "' for statistics of output fields.";
+            throw std::runtime_error(msg.str());
+        } // if
+        _file << "# time subfield component min max l2_norm\n";
+        _file << std::scientific << std::setprecision(_precision);
+    } // if
+
+    PYLITH_METHOD_END;
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close output file.
+void
+pylith::meshio::DataWriterStats::close(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_file.is_open()) {
+        _file.close();
+    } // if
+    _comm = MPI_COMM_NULL;
+
+    DataWriter::close();
+
+    PYLITH_METHOD_END;
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Cleanup after writing data for a time step.
+void
+pylith::meshio::DataWriterStats::closeTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_file.is_open()) {
+        _file.flush();
+    } // if
+
+    PYLITH_METHOD_END;
+} // closeTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Write statistics of field over vertices to file.
+void
+pylith::meshio::DataWriterStats::writeVertexField(const PylithScalar t,
+                                                  const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+
+    _writeStats(t, subfield);
+
+    PYLITH_METHOD_END;
+} // writeVertexField
+
+
+// ------------------------------------------------------------------------------------------------
+// Write statistics of field over cells to file.
+void
+pylith::meshio::DataWriterStats::writeCellField(const PylithScalar t,
+                                                const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+
+    _writeStats(t, subfield);
+
+    PYLITH_METHOD_END;
+} // writeCellField
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute global statistics of subfield and write them to file.
+void
+pylith::meshio::DataWriterStats::_writeStats(const PylithScalar t,
+                                             const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+    assert(_isOpen);
+    assert(MPI_COMM_NULL != _comm);
+
+    PetscErrorCode err;
+    PetscVec vector = subfield.getVector();assert(vector);
+    PetscInt numValues = 0, blockSize = 0;
+    err = VecGetLocalSize(vector, &numValues);PYLITH_CHECK_ERROR(err);
+    err = VecGetBlockSize(vector, &blockSize);PYLITH_CHECK_ERROR(err);
+    assert(blockSize > 0);
+
+    // Statistics are packed as [min(blockSize), max(blockSize), sumsq(blockSize)] so a single reduction suffices.
+    std::vector<double> stats(3*blockSize);
+    for (PetscInt iComponent = 0; iComponent < blockSize; ++iComponent) {
+        stats[iComponent] = DBL_MAX;
+        stats[blockSize+iComponent] = -DBL_MAX;
+        stats[2*blockSize+iComponent] = 0.0;
+    } // for
+
+    const PetscScalar* values = NULL;
+    err = VecGetArrayRead(vector, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numValues; ++i) {
+        const PetscInt iComponent = i % blockSize;
+        const double value = values[i];
+        stats[iComponent] = std::min(stats[iComponent], value);
+        stats[blockSize+iComponent] = std::max(stats[blockSize+iComponent], value);
+        stats[2*blockSize+iComponent] += value*value;
+    } // for
+    err = VecRestoreArrayRead(vector, &values);PYLITH_CHECK_ERROR(err);
+
+    MPI_Op opStats;
+    err = MPI_Op_create(_DataWriterStats::reduceStats, 1, &opStats);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(MPI_IN_PLACE, &stats[0], 3*blockSize, MPI_DOUBLE, opStats, _comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Op_free(&opStats);PYLITH_CHECK_ERROR(err);
+
+    if (_file.is_open()) {
+        const pylith::topology::FieldBase::Description& description = subfield.getDescription();
+        const size_t numComponentNames = description.componentNames.size();
+        for (PetscInt iComponent = 0; iComponent < blockSize; ++iComponent) {
+            _file << t*_timeScale << " " << description.label << " ";
+            if (size_t(iComponent) < numComponentNames) {
+                _file << description.componentNames[iComponent];
+            } else {
+                _file << iComponent;
+            } // if/else
+            _file << " " << stats[iComponent]
+                  << " " << stats[blockSize+iComponent]
+                  << " " << sqrt(stats[2*blockSize+iComponent])
+                  << "\n";
+        } // for
+        if (!_file.good()) {
+            std::ostringstream msg;
+            msg << "Error writing statistics for subfield '" << description.label << "' to file '" << _filename << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
+    PYLITH_METHOD_END;
+} // _writeStats
+
+
+// ------------------------------------------------------------------------------------------------
+// Reduction operator combining [min(n), max(n), sumsq(n)] arrays of statistics.
+void
+pylith::meshio::_DataWriterStats::reduceStats(void* invec,
+                                              void* inoutvec,
+                                              int* len,
+                                              MPI_Datatype* datatype) {
+    assert(invec);
+    assert(inoutvec);
+    assert(len);
+    assert(0 == *len % 3);
+
+    const double* in = (const double*) invec;
+    double* inout = (double*) inoutvec;
+    const int n = *len / 3;
+    for (int i = 0; i < n; ++i) {
+        inout[i] = std::min(inout[i], in[i]);
+        inout[n+i] = std::max(inout[n+i], in[n+i]);
+        inout[2*n+i] += in[2*n+i];
+    } // for
+} // reduceStats
+
+
+// End of file
@@ -0,0 +1,148 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/DataWriterStats.hh
+ *
+ * @brief Object for writing global statistics (min, max, L2 norm) of subfields to an ASCII file.
+ *
+ * The statistics are computed in-situ for each component of each subfield using a single global reduction per
+ * subfield, so only a few numbers per output step are written instead of the full field. This allows monitoring
+ * large simulations at every time step without writing field output.
+ *
+ * File format (one line per time step, subfield, and component):
+ *
+ *   # time subfield component min max l2_norm
+ *   TIME NAME COMPONENT MIN MAX L2NORM
+ */
+
+#if !defined(pylith_meshio_datawriterstats_hh)
+#define pylith_meshio_datawriterstats_hh
+
+#include "DataWriter.hh" // ISA DataWriter
+
+#include <mpi.h> // HASA MPI_Comm
+#include <fstream> // HASA std::ofstream
+#include <string> // HASA std::string
+
+class pylith::meshio::DataWriterStats : public DataWriter {
+    friend class TestDataWriterStats; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    DataWriterStats(void);
+
+    /// Destructor
+    ~DataWriterStats(void);
+
+    /** Make copy of this object.
+     *
+     * @returns Copy of this.
+     */
+    DataWriter* clone(void) const;
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set filename for ASCII file.
+     *
+     * @param[in] filename Name of file.
+     */
+    void setFilename(const char* filename);
+
+    /** Get filename for ASCII file.
+     *
+     * @returns Name of file.
+     */
+    const char* getFilename(void) const;
+
+    /** Set precision of floating point values in output.
+     *
+     * @param[in] value Precision for floating point values.
+     */
+    void setPrecision(const int value);
+
+    /** Open output file.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] isInfo True if only writing info values.
+     */
+    void open(const pylith::topology::Mesh& mesh,
+              const bool isInfo);
+
+    /// Close output file.
+    void close(void);
+
+    /// Cleanup after writing data for a time step.
+    void closeTimeStep(void);
+
+    /** Write statistics of field over vertices to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 1.
+     */
+    void writeVertexField(const PylithScalar t,
+                          const pylith::meshio::OutputSubfield& subfield);
+
+    /** Write statistics of field over cells to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 0.
+     */
+    void writeCellField(const PylithScalar t,
+                        const pylith::meshio::OutputSubfield& subfield);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Copy constructor.
+     *
+     * @param[in] w Object to copy.
+     */
+    DataWriterStats(const DataWriterStats& w);
+
+    /** Compute global statistics of subfield and write them to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with values.
+     */
+    void _writeStats(const PylithScalar t,
+                     const pylith::meshio::OutputSubfield& subfield);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Name of ASCII file.
+    std::ofstream _file; ///< ASCII file (only open on rank 0).
+    MPI_Comm _comm; ///< MPI communicator for mesh.
+    int _precision; ///< Precision of floating point values in output.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    const DataWriterStats& operator=(const DataWriterStats&); ///< Not implemented
+
+}; // DataWriterStats
+
+#include "DataWriterStats.icc" // inline methods
+
+#endif // pylith_meshio_datawriterstats_hh
+
+// End of file
@@ -0,0 +1,351 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "ExpressionDB.hh" // Implementation of class methods
+
+#include "pylith/utils/Expression.hh" // HASA Expression
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+#include "spatialdata/geocoords/Converter.hh" // USES Converter
+#include "spatialdata/units/Parser.hh" // USES Parser
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include <cmath> // USES std::isfinite()
+#include <strings.h> // USES strcasecmp()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _ExpressionDB {
+public:
+
+            static const char* variables[3];
+            static const size_t numVariables;
+
+        }; // _ExpressionDB
+        const char* _ExpressionDB::variables[3] = { "x", "y", "z" };
+        const size_t _ExpressionDB::numVariables = 3;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::ExpressionDB::ExpressionDB(void) :
+    _cs(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::ExpressionDB::~ExpressionDB(void) {
+    _deallocate();
+    delete _cs;_cs = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Set names of values in database.
+void
+pylith::meshio::ExpressionDB::setValueNames(const char* const* names,
+                                            const int numNames) {
+    assert((names && numNames) || (!names && !numNames));
+
+    _names.resize(numNames);
+    for (int i = 0; i < numNames; ++i) {
+        assert(names[i]);
+        _names[i] = names[i];
+    } // for
+} // setValueNames
+
+
+// ------------------------------------------------------------------------------------------------
+// Set expressions for values in database.
+void
+pylith::meshio::ExpressionDB::setExpressions(const char* const* expressions,
+                                             const int numExpressions) {
+    assert((expressions && numExpressions) || (!expressions && !numExpressions));
+
+    _expressionStrings.resize(numExpressions);
+    for (int i = 0; i < numExpressions; ++i) {
+        assert(expressions[i]);
+        _expressionStrings[i] = expressions[i];
+    } // for
+} // setExpressions
+
+
+// ------------------------------------------------------------------------------------------------
+// Set units of values in database.
+void
+pylith::meshio::ExpressionDB::setUnits(const char* const* units,
+                                       const int numUnits) {
+    assert((units && numUnits) || (!units && !numUnits));
+
+    _units.resize(numUnits);
+    for (int i = 0; i < numUnits; ++i) {
+        assert(units[i]);
+        _units[i] = units[i];
+    } // for
+} // setUnits
+
+
+// ------------------------------------------------------------------------------------------------
+// Set coordinate system associated with the coordinates in the expressions.
+void
+pylith::meshio::ExpressionDB::setCoordSys(const spatialdata::geocoords::CoordSys& cs) {
+    delete _cs;_cs = cs.clone();
+} // setCoordSys
+
+
+// ------------------------------------------------------------------------------------------------
+// Open the database and prepare for querying.
+void
+pylith::meshio::ExpressionDB::open(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!_expressions.empty()) { PYLITH_METHOD_END;}
+    if (!_cs) {
+        std::ostringstream msg;
+        msg << "Coordinate system not set for expression spatial database '" << getDescription() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    const size_t numValues = _names.size();
+    if (!numValues) {
+        std::ostringstream msg;
+        msg << "No values specified for expression spatial database '" << getDescription() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if ((_expressionStrings.size() != numValues) || (_units.size() != numValues)) {
+        std::ostringstream msg;
+        msg << "Number of expressions (" << _expressionStrings.size() << ") and number of units (" << _units.size()
+            << ") must match the number of values (" << numValues << ") in expression spatial database '"
+            << getDescription() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Compile expressions and get scales for units.
+    _expressions.resize(numValues);
+    _scales.resize(numValues);
+    spatialdata::units::Parser parser;
+    for (size_t iValue = 0; iValue < numValues; ++iValue) {
+        _expressions[iValue] = new pylith::utils::Expression();
+        try {
+            _expressions[iValue]->compile(_expressionStrings[iValue].c_str(), _ExpressionDB::variables,
+                                          _ExpressionDB::numVariables);
+        } catch (const std::exception& err) {
+            std::ostringstream msg;
+            msg << "Error compiling expression for value '" << _names[iValue] << "' in expression spatial database '"
+                << getDescription() << "'.\n" << err.what();
+            _deallocate();
+            throw std::runtime_error(msg.str());
+        } // try/catch
+        _scales[iValue] = ("none" == _units[iValue]) ? 1.0 : parser.parse(_units[iValue].c_str());
+    } // for
+
+    // Default is to return all values.
+    _queryIndices.resize(numValues);
+    for (size_t iValue = 0; iValue < numValues; ++iValue) {
+        _queryIndices[iValue] = iValue;
+    } // for
+
+    PYLITH_METHOD_END;
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close the database.
+void
+pylith::meshio::ExpressionDB::close(void) {
+    _deallocate();
+    std::vector<double>().swap(_coordinates);
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Set values to be returned by queries.
+void
+pylith::meshio::ExpressionDB::setQueryValues(const char* const* names,
+                                             const size_t numVals) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_expressions.empty()) {
+        std::ostringstream msg;
+        msg << "Expression spatial database '" << getDescription() << "' must be open before setting query values.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    _queryIndices.resize(numVals);
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        size_t index = 0;
+        while (index < _names.size() && strcasecmp(names[iVal], _names[index].c_str())) {
+            ++index;
+        } // while
+        if (index == _names.size()) {
+            std::ostringstream msg;
+            msg << "Could not find value '" << names[iVal] << "' in expression spatial database '" << getDescription()
+                << "'. Available values are:";
+            for (size_t iName = 0; iName < _names.size(); ++iName) {
+                msg << "\n  " << _names[iName];
+            } // for
+            msg << "\n";
+            throw std::out_of_range(msg.str());
+        } // if
+        _queryIndices[iVal] = index;
+    } // for
+
+    PYLITH_METHOD_END;
+} // setQueryValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Get names of values in spatial database.
+void
+pylith::meshio::ExpressionDB::getNamesDBValues(const char*** valueNames,
+                                               size_t* numValues) const {
+    assert(valueNames);
+    assert(numValues);
+
+    *numValues = _names.size();
+    *valueNames = (*numValues > 0) ? new const char*[*numValues] : NULL;
+    for (size_t iValue = 0; iValue < *numValues; ++iValue) {
+        (*valueNames)[iValue] = _names[iValue].c_str();
+    } // for
+} // getNamesDBValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database.
+int
+pylith::meshio::ExpressionDB::query(double* vals,
+                                    const size_t numVals,
+                                    const double* coords,
+                                    const size_t numDims,
+                                    const spatialdata::geocoords::CoordSys* csQuery) {
+    int err = 0;
+    queryPoints(vals, numVals, &err, coords, 1, numDims, csQuery);
+
+    return err;
+} // query
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database.
+int
+pylith::meshio::ExpressionDB::query(float* vals,
+                                    const size_t numVals,
+                                    const float* coords,
+                                    const size_t numDims,
+                                    const spatialdata::geocoords::CoordSys* csQuery) {
+    double valsDouble[64];
+    double coordsDouble[3] = { 0.0, 0.0, 0.0 };
+    assert(numVals <= 64);
+    assert(numDims <= 3);
+    for (size_t iDim = 0; iDim < numDims; ++iDim) {
+        coordsDouble[iDim] = coords[iDim];
+    } // for
+    const int err = query(valsDouble, numVals, coordsDouble, numDims, csQuery);
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        vals[iVal] = valsDouble[iVal];
+    } // for
+
+    return err;
+} // query
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database at many points, evaluating each expression for all of the points together.
+void
+pylith::meshio::ExpressionDB::queryPoints(double* vals,
+                                          const size_t numVals,
+                                          int* errs,
+                                          const double* coords,
+                                          const size_t numPoints,
+                                          const size_t numDims,
+                                          const spatialdata::geocoords::CoordSys* csQuery) {
+    assert(!_expressions.empty());
+    assert(!numPoints || (vals && errs && coords));
+
+    const size_t numQueryValues = _queryIndices.size();
+    if (numVals != numQueryValues) {
+        std::ostringstream msg;
+        msg << "Number of values for query in expression spatial database '" << getDescription() << "' ("
+            << numVals << ") does not match size of array for values (" << numQueryValues << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (numDims > _ExpressionDB::numVariables) {
+        std::ostringstream msg;
+        msg << "Spatial dimension of query points (" << numDims << ") in expression spatial database '"
+            << getDescription() << "' must be no more than " << _ExpressionDB::numVariables << ".";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (!numPoints) {
+        return;
+    } // if
+
+    // Convert coordinates to coordinate system of the expressions, with coordinates not in the query points set to
+    // zero.
+    _coordinates.resize(numPoints*numDims);
+    for (size_t i = 0; i < numPoints*numDims; ++i) {
+        _coordinates[i] = coords[i];
+    } // for
+    spatialdata::geocoords::Converter::convert(&_coordinates[0], numPoints, numDims, _cs, csQuery);
+    if (numDims < _ExpressionDB::numVariables) {
+        _coordinates.resize(numPoints*_ExpressionDB::numVariables);
+        for (size_t iPoint = numPoints; iPoint-- > 0; ) {
+            for (size_t iDim = _ExpressionDB::numVariables; iDim-- > 0; ) {
+                _coordinates[iPoint*_ExpressionDB::numVariables+iDim] =
+                    (iDim < numDims) ? _coordinates[iPoint*numDims+iDim] : 0.0;
+            } // for
+        } // for
+    } // if
+
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        _expressions[_queryIndices[iVal]]->evaluate(&vals[iVal], numVals, &_coordinates[0],
+                                                    _ExpressionDB::numVariables, numPoints);
+    } // for
+
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        errs[iPoint] = 0;
+        for (size_t iVal = 0; iVal < numVals; ++iVal) {
+            double& value = vals[iPoint*numVals+iVal];
+            if (!std::isfinite(value)) {
+                errs[iPoint] = 1;
+            } // if
+            value *= _scales[_queryIndices[iVal]];
+        } // for
+    } // for
+} // queryPoints
+
+
+// ------------------------------------------------------------------------------------------------
+// Delete compiled expressions.
+void
+pylith::meshio::ExpressionDB::_deallocate(void) {
+    for (size_t i = 0; i < _expressions.size(); ++i) {
+        delete _expressions[i];_expressions[i] = NULL;
+    } // for
+    _expressions.clear();
+} // _deallocate
+
+
+// End of file
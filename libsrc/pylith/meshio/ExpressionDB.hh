@@ -0,0 +1,185 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/ExpressionDB.hh
+ *
+ * @brief Spatial database with values given by analytical expressions of the coordinates `x`, `y`, and `z`.
+ *
+ * The expressions are compiled when the database is opened (see pylith::utils::Expression). Queries for many points
+ * at once, such as those used to set auxiliary fields, initial conditions, and boundary conditions, evaluate each
+ * expression over blocks of points.
+ */
+
+#if !defined(pylith_meshio_expressiondb_hh)
+#define pylith_meshio_expressiondb_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "spatialdata/spatialdb/SpatialDB.hh" // ISA SpatialDB
+#include "spatialdata/geocoords/geocoordsfwd.hh" // HOLDSA CoordSys
+
+#include "pylith/utils/utilsfwd.hh" // HASA Expression
+#include "pylith/utils/array.hh" // HASA string_vector
+
+#include <vector> // HASA std::vector
+
+class pylith::meshio::ExpressionDB : public spatialdata::spatialdb::SpatialDB {
+    friend class TestExpressionDB; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    ExpressionDB(void);
+
+    /// Destructor
+    ~ExpressionDB(void);
+
+    /** Set names of values in database.
+     *
+     * @param[in] names Array of names of values.
+     * @param[in] numNames Number of values.
+     */
+    void setValueNames(const char* const* names,
+                       const int numNames);
+
+    /** Set expressions for values in database.
+     *
+     * @param[in] expressions Array of expressions, one for each value.
+     * @param[in] numExpressions Number of expressions.
+     */
+    void setExpressions(const char* const* expressions,
+                        const int numExpressions);
+
+    /** Set units of values in database.
+     *
+     * @param[in] units Array of units, one for each value.
+     * @param[in] numUnits Number of units.
+     */
+    void setUnits(const char* const* units,
+                  const int numUnits);
+
+    /** Set coordinate system associated with the coordinates in the expressions.
+     *
+     * @param[in] cs Coordinate system.
+     */
+    void setCoordSys(const spatialdata::geocoords::CoordSys& cs);
+
+    /// Open the database and prepare for querying.
+    void open(void);
+
+    /// Close the database.
+    void close(void);
+
+    /** Set values to be returned by queries.
+     *
+     * @param[in] names Names of values to be returned in queries
+     * @param[in] numVals Number of values to be returned in queries
+     */
+    void setQueryValues(const char* const* names,
+                        const size_t numVals);
+
+    /** Get names of values in spatial database.
+     *
+     * @param[out] valueNames Array of names of values.
+     * @param[out] numValues Number of values.
+     */
+    void getNamesDBValues(const char*** valueNames,
+                          size_t* numValues) const;
+
+    /** Query the database.
+     *
+     * @param[out] vals Array for computed values (output from query), must be allocated BEFORE calling query().
+     * @param[in] numVals Number of values expected (size of pVals array)
+     * @param[in] coords Coordinates of point for query
+     * @param[in] numDims Number of dimensions for coordinates
+     * @param[in] csQuery Coordinate system of coordinates
+     *
+     * @returns 0 on success, 1 on failure (i.e., value is not finite)
+     */
+    int query(double* vals,
+              const size_t numVals,
+              const double* coords,
+              const size_t numDims,
+              const spatialdata::geocoords::CoordSys* csQuery);
+
+    /** Query the database.
+     *
+     * @param[out] vals Array for computed values (output from query), must be allocated BEFORE calling query().
+     * @param[in] numVals Number of values expected (size of pVals array)
+     * @param[in] coords Coordinates of point for query
+     * @param[in] numDims Number of dimensions for coordinates
+     * @param[in] csQuery Coordinate system of coordinates
+     *
+     * @returns 0 on success, 1 on failure (i.e., value is not finite)
+     */
+    int query(float* vals,
+              const size_t numVals,
+              const float* coords,
+              const size_t numDims,
+              const spatialdata::geocoords::CoordSys* csQuery);
+
+    /** Query the database at many points, evaluating each expression for all of the points together.
+     *
+     * @param[out] vals Array for computed values [numPoints*numVals].
+     * @param[in] numVals Number of values expected at each point.
+     * @param[out] errs Array for error flags [numPoints] (0 on success, 1 if a value is not finite).
+     * @param[in] coords Coordinates of points [numPoints*numDims].
+     * @param[in] numPoints Number of points.
+     * @param[in] numDims Number of dimensions for coordinates.
+     * @param[in] csQuery Coordinate system of coordinates.
+     */
+    void queryPoints(double* vals,
+                     const size_t numVals,
+                     int* errs,
+                     const double* coords,
+                     const size_t numPoints,
+                     const size_t numDims,
+                     const spatialdata::geocoords::CoordSys* csQuery);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Delete compiled expressions.
+    void _deallocate(void);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::string_vector _names; ///< Names of values in database.
+    pylith::string_vector _expressionStrings; ///< Expressions for values.
+    pylith::string_vector _units; ///< Units of values.
+    spatialdata::geocoords::CoordSys* _cs; ///< Coordinate system of coordinates in expressions.
+
+    std::vector<pylith::utils::Expression*> _expressions; ///< Compiled expressions.
+    std::vector<double> _scales; ///< Scales for converting values to SI units.
+    std::vector<size_t> _queryIndices; ///< Indices of values returned in queries.
+    std::vector<double> _coordinates; ///< Work array for coordinates of points.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    ExpressionDB(const ExpressionDB&); ///< Not implemented.
+    const ExpressionDB& operator=(const ExpressionDB&); ///< Not implemented
+
+}; // ExpressionDB
+
+#endif // pylith_meshio_expressiondb_hh
+
+// End of file
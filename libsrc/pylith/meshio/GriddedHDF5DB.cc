@@ -0,0 +1,500 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "GriddedHDF5DB.hh" // Implementation of class methods
+
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+#include "pylith/utils/NodeSharedBuffer.hh" // USES NodeSharedBuffer
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+#include "spatialdata/geocoords/Converter.hh" // USES Converter
+#include "spatialdata/units/Parser.hh" // USES Parser
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include <algorithm> // USES std::upper_bound()
+#include <strings.h> // USES strcasecmp()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _GriddedHDF5DB {
+public:
+
+            /** Get number of blocks along an axis.
+             *
+             * @param[in] numPoints Number of grid points along axis.
+             * @param[in] blockSize Number of grid cells along axis in a block.
+             * @returns Number of blocks.
+             */
+            static
+            size_t numBlocks(const size_t numPoints,
+                             const size_t blockSize) {
+                return (numPoints > 1) ? (numPoints - 2) / blockSize + 1 : 1;
+            } // numBlocks
+
+            static const char* axisNames[3];
+
+        }; // _GriddedHDF5DB
+        const char* _GriddedHDF5DB::axisNames[3] = { "x", "y", "z" };
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::GriddedHDF5DB::GriddedHDF5DB(void) :
+    _queryType(LINEAR),
+    _blockSize(32),
+    _useSharedMemory(false),
+    _cs(NULL),
+    _h5(NULL),
+    _spaceDim(0),
+    _sharedValues(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::GriddedHDF5DB::~GriddedHDF5DB(void) {
+    close();
+    delete _cs;_cs = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Set filename containing data.
+void
+pylith::meshio::GriddedHDF5DB::setFilename(const char* value) {
+    _filename = value;
+} // setFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Set query type.
+void
+pylith::meshio::GriddedHDF5DB::setQueryType(const QueryEnum value) {
+    _queryType = value;
+} // setQueryType
+
+
+// ------------------------------------------------------------------------------------------------
+// Set number of grid cells along each axis in blocks read from the file.
+void
+pylith::meshio::GriddedHDF5DB::setBlockSize(const int value) {
+    if (value <= 0) {
+        std::ostringstream msg;
+        msg << "Block size (" << value << ") for gridded HDF5 spatial database '" << getDescription()
+            << "' must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _blockSize = value;
+} // setBlockSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Set flag for reading values for the entire grid into memory shared by the processes on each compute node.
+void
+pylith::meshio::GriddedHDF5DB::setSharedMemory(const bool value) {
+    _useSharedMemory = value;
+} // setSharedMemory
+
+
+// ------------------------------------------------------------------------------------------------
+// Set coordinate system associated with grid coordinates.
+void
+pylith::meshio::GriddedHDF5DB::setCoordSys(const spatialdata::geocoords::CoordSys& cs) {
+    delete _cs;_cs = cs.clone();
+} // setCoordSys
+
+
+// ------------------------------------------------------------------------------------------------
+// Open the database and prepare for querying.
+void
+pylith::meshio::GriddedHDF5DB::open(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_h5) { PYLITH_METHOD_END;}
+    if (!_cs) {
+        std::ostringstream msg;
+        msg << "Coordinate system not set for gridded HDF5 spatial database '" << getDescription() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _h5 = new HDF5(_filename.c_str(), H5F_ACC_RDONLY);assert(_h5);
+
+    // Coordinates of grid along each axis.
+    _spaceDim = 0;
+    for (size_t iDim = 0; iDim < 3; ++iDim) {
+        _axes[iDim].clear();
+        const std::string axisName = std::string("/coordinates/") + _GriddedHDF5DB::axisNames[iDim];
+        if (!_h5->hasDataset(axisName.c_str())) { break; }
+
+        hsize_t* dims = NULL;
+        int ndims = 0;
+        _h5->getDatasetDims(&dims, &ndims, "/coordinates", _GriddedHDF5DB::axisNames[iDim]);
+        const hsize_t numPoints = (1 == ndims) ? dims[0] : 0;
+        delete[] dims;dims = NULL;
+        if (0 == numPoints) {
+            std::ostringstream msg;
+            msg << "Expected one-dimensional, nonempty dataset for '" << axisName << "' in gridded HDF5 spatial database '"
+                << getDescription() << "' (" << _filename << ").";
+            throw std::runtime_error(msg.str());
+        } // if
+
+        _axes[iDim].resize(numPoints);
+        const hsize_t offset = 0;
+        _h5->readDatasetHyperslab("/coordinates", _GriddedHDF5DB::axisNames[iDim], &_axes[iDim][0], &offset, &numPoints,
+                                  1, H5T_NATIVE_DOUBLE);
+        for (size_t i = 1; i < numPoints; ++i) {
+            if (_axes[iDim][i] <= _axes[iDim][i-1]) {
+                std::ostringstream msg;
+                msg << "Coordinates in '" << axisName << "' of gridded HDF5 spatial database '" << getDescription()
+                    << "' (" << _filename << ") must be strictly increasing.";
+                throw std::runtime_error(msg.str());
+            } // if
+        } // for
+        ++_spaceDim;
+    } // for
+    if (0 == _spaceDim) {
+        std::ostringstream msg;
+        msg << "Could not find coordinates of grid in gridded HDF5 spatial database '" << getDescription() << "' ("
+            << _filename << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Names and units of values.
+    _h5->getGroupDatasets(&_names, "/values");
+    const size_t numValues = _names.size();
+    _scales.resize(numValues);
+    spatialdata::units::Parser parser;
+    for (size_t iValue = 0; iValue < numValues; ++iValue) {
+        const std::string fullName = std::string("/values/") + _names[iValue];
+        hsize_t* dims = NULL;
+        int ndims = 0;
+        _h5->getDatasetDims(&dims, &ndims, "/values", _names[iValue].c_str());
+        bool isConsistent = ndims == int(_spaceDim);
+        for (int iDim = 0; iDim < ndims && isConsistent; ++iDim) {
+            isConsistent = dims[iDim] == _axes[iDim].size();
+        } // for
+        delete[] dims;dims = NULL;
+        if (!isConsistent) {
+            std::ostringstream msg;
+            msg << "Dimensions of dataset '" << fullName << "' in gridded HDF5 spatial database '" << getDescription()
+                << "' (" << _filename << ") do not match the dimensions of the grid.";
+            throw std::runtime_error(msg.str());
+        } // if
+        const std::string& units = _h5->readAttribute(fullName.c_str(), "units");
+        _scales[iValue] = ("none" == units) ? 1.0 : parser.parse(units.c_str());
+    } // for
+
+    // Default is to return all values.
+    _queryIndices.resize(numValues);
+    for (size_t iValue = 0; iValue < numValues; ++iValue) {
+        _queryIndices[iValue] = iValue;
+    } // for
+
+    if (_useSharedMemory) {
+        _readShared();
+    } // if
+
+    PYLITH_METHOD_END;
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close the database.
+void
+pylith::meshio::GriddedHDF5DB::close(void) {
+    delete _h5;_h5 = NULL;
+    _blocks.clear();
+    delete _sharedValues;_sharedValues = NULL;
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Set values to be returned by queries.
+void
+pylith::meshio::GriddedHDF5DB::setQueryValues(const char* const* names,
+                                              const size_t numVals) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!_h5) {
+        std::ostringstream msg;
+        msg << "Gridded HDF5 spatial database '" << getDescription() << "' must be open before setting query values.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    _queryIndices.resize(numVals);
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        size_t index = 0;
+        while (index < _names.size() && strcasecmp(names[iVal], _names[index].c_str())) {
+            ++index;
+        } // while
+        if (index == _names.size()) {
+            std::ostringstream msg;
+            msg << "Could not find value '" << names[iVal] << "' in gridded HDF5 spatial database '" << getDescription()
+                << "'. Available values are:";
+            for (size_t iName = 0; iName < _names.size(); ++iName) {
+                msg << "\n  " << _names[iName];
+            } // for
+            msg << "\n";
+            throw std::out_of_range(msg.str());
+        } // if
+        _queryIndices[iVal] = index;
+    } // for
+
+    PYLITH_METHOD_END;
+} // setQueryValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Get names of values in spatial database.
+void
+pylith::meshio::GriddedHDF5DB::getNamesDBValues(const char*** valueNames,
+                                                size_t* numValues) const {
+    assert(valueNames);
+    assert(numValues);
+
+    *numValues = _names.size();
+    *valueNames = (*numValues > 0) ? new const char*[*numValues] : NULL;
+    for (size_t iValue = 0; iValue < *numValues; ++iValue) {
+        (*valueNames)[iValue] = _names[iValue].c_str();
+    } // for
+} // getNamesDBValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database.
+int
+pylith::meshio::GriddedHDF5DB::query(double* vals,
+                                     const size_t numVals,
+                                     const double* coords,
+                                     const size_t numDims,
+                                     const spatialdata::geocoords::CoordSys* csQuery) {
+    assert(_h5);
+    assert(vals);
+    assert(coords);
+
+    const size_t numQueryValues = _queryIndices.size();
+    if (numVals != numQueryValues) {
+        std::ostringstream msg;
+        msg << "Number of values for query in gridded HDF5 spatial database '" << getDescription() << "' ("
+            << numVals << ") does not match size of array for values (" << numQueryValues << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (numDims != _spaceDim) {
+        std::ostringstream msg;
+        msg << "Spatial dimension of query point (" << numDims << ") does not match spatial dimension of gridded HDF5 "
+            << "spatial database '" << getDescription() << "' (" << _spaceDim << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    double xyz[3] = { 0.0, 0.0, 0.0 };
+    for (size_t iDim = 0; iDim < numDims; ++iDim) {
+        xyz[iDim] = coords[iDim];
+    } // for
+    spatialdata::geocoords::Converter::convert(xyz, 1, numDims, _cs, csQuery);
+
+    // Find cell of grid containing point, interpolation weights, and block containing cell.
+    size_t blockIndices[3] = { 0, 0, 0 };
+    size_t localIndices[3] = { 0, 0, 0 };
+    size_t blockPoints[3] = { 1, 1, 1 };
+    double weights[3] = { 0.0, 0.0, 0.0 };
+    for (size_t iDim = 0; iDim < _spaceDim; ++iDim) {
+        const std::vector<double>& axis = _axes[iDim];
+        const size_t numPoints = axis.size();
+        if (1 == numPoints) { continue; }
+
+        if ((xyz[iDim] < axis[0]) || (xyz[iDim] > axis[numPoints-1])) {
+            for (size_t iVal = 0; iVal < numVals; ++iVal) {
+                vals[iVal] = 0.0;
+            } // for
+            return 1;
+        } // if
+        size_t index = std::upper_bound(axis.begin(), axis.end(), xyz[iDim]) - axis.begin();
+        index = (index > 0) ? index - 1 : 0;
+        index = std::min(index, numPoints-2);
+        weights[iDim] = (xyz[iDim] - axis[index]) / (axis[index+1] - axis[index]);
+
+        blockIndices[iDim] = std::min(index / _blockSize, _GriddedHDF5DB::numBlocks(numPoints, _blockSize)-1);
+        localIndices[iDim] = index - blockIndices[iDim]*_blockSize;
+        blockPoints[iDim] = std::min(_blockSize+1, numPoints - blockIndices[iDim]*_blockSize);
+    } // for
+    const double* block = _getBlock(blockIndices);assert(block);
+    const size_t numValues = _names.size();
+
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        vals[iVal] = 0.0;
+    } // for
+    const size_t numCorners = 1 << _spaceDim;
+    for (size_t iCorner = 0; iCorner < numCorners; ++iCorner) {
+        double weight = 1.0;
+        size_t offset = 0;
+        bool isValid = true;
+        for (size_t iDim = 0; iDim < _spaceDim; ++iDim) {
+            const size_t shift = (iCorner >> iDim) & 1;
+            if (shift && (1 == blockPoints[iDim])) {
+                isValid = false;
+                break;
+            } // if
+            if (NEAREST == _queryType) {
+                weight *= (shift == (weights[iDim] >= 0.5 ? 1u : 0u)) ? 1.0 : 0.0;
+            } else {
+                weight *= shift ? weights[iDim] : 1.0 - weights[iDim];
+            } // if/else
+            offset = offset*blockPoints[iDim] + localIndices[iDim] + shift;
+        } // for
+        if (!isValid || (0.0 == weight)) { continue; }
+
+        for (size_t iVal = 0; iVal < numVals; ++iVal) {
+            vals[iVal] += weight * block[offset*numValues+_queryIndices[iVal]];
+        } // for
+    } // for
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        vals[iVal] *= _scales[_queryIndices[iVal]];
+    } // for
+
+    return 0;
+} // query
+
+
+// ------------------------------------------------------------------------------------------------
+// Query the database.
+int
+pylith::meshio::GriddedHDF5DB::query(float* vals,
+                                     const size_t numVals,
+                                     const float* coords,
+                                     const size_t numDims,
+                                     const spatialdata::geocoords::CoordSys* csQuery) {
+    double valsDouble[64];
+    double coordsDouble[3] = { 0.0, 0.0, 0.0 };
+    assert(numVals <= 64);
+    assert(numDims <= 3);
+    for (size_t iDim = 0; iDim < numDims; ++iDim) {
+        coordsDouble[iDim] = coords[iDim];
+    } // for
+    const int err = query(valsDouble, numVals, coordsDouble, numDims, csQuery);
+    for (size_t iVal = 0; iVal < numVals; ++iVal) {
+        vals[iVal] = valsDouble[iVal];
+    } // for
+
+    return err;
+} // query
+
+
+// ------------------------------------------------------------------------------------------------
+// Get values of block, reading them from the file if necessary.
+const double*
+pylith::meshio::GriddedHDF5DB::_getBlock(const size_t* blockIndices) {
+    assert(blockIndices);
+
+    if (_sharedValues) {
+        return static_cast<const double*>(_sharedValues->data());
+    } // if
+
+    size_t key = 0;
+    hsize_t offset[3] = { 0, 0, 0 };
+    hsize_t count[3] = { 1, 1, 1 };
+    size_t blockSize = 1;
+    for (size_t iDim = 0; iDim < _spaceDim; ++iDim) {
+        const size_t numPoints = _axes[iDim].size();
+        key = key*_GriddedHDF5DB::numBlocks(numPoints, _blockSize) + blockIndices[iDim];
+        offset[iDim] = blockIndices[iDim]*_blockSize;
+        count[iDim] = std::min(_blockSize+1, numPoints - size_t(offset[iDim]));
+        blockSize *= count[iDim];
+    } // for
+
+    std::map<size_t, std::vector<double> >::const_iterator iter = _blocks.find(key);
+    if (iter != _blocks.end()) {
+        return &iter->second[0];
+    } // if
+
+    // Read hyperslab of each value and interleave values at each grid point.
+    assert(_h5);
+    const size_t numValues = _names.size();
+    std::vector<double>& block = _blocks[key];
+    block.resize(blockSize*numValues);
+    std::vector<double> buffer(blockSize);
+    for (size_t iValue = 0; iValue < numValues; ++iValue) {
+        _h5->readDatasetHyperslab("/values", _names[iValue].c_str(), &buffer[0], offset, count, _spaceDim,
+                                  H5T_NATIVE_DOUBLE);
+        for (size_t iPoint = 0; iPoint < blockSize; ++iPoint) {
+            block[iPoint*numValues+iValue] = buffer[iPoint];
+        } // for
+    } // for
+
+    return &block[0];
+} // _getBlock
+
+
+// ------------------------------------------------------------------------------------------------
+// Read values for the entire grid into memory shared by the processes on each compute node.
+void
+pylith::meshio::GriddedHDF5DB::_readShared(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_h5);
+
+    // Entire grid is a single block.
+    size_t numGridPoints = 1;
+    _blockSize = 1;
+    for (size_t iDim = 0; iDim < _spaceDim; ++iDim) {
+        const size_t numPoints = _axes[iDim].size();
+        numGridPoints *= numPoints;
+        _blockSize = std::max(_blockSize, numPoints-1);
+    } // for
+    const size_t numValues = _names.size();
+
+    delete _sharedValues;_sharedValues = new pylith::utils::NodeSharedBuffer;assert(_sharedValues);
+    _sharedValues->allocate(numGridPoints*numValues*sizeof(double), PETSC_COMM_WORLD);
+    if (_sharedValues->isLoader()) {
+        // Read slabs of grid points along the first axis to limit the size of the buffer.
+        const size_t maxSlabPoints = 1 << 20;
+        const size_t numPointsSlice = numGridPoints / _axes[0].size();
+        const size_t numSlices = std::max(size_t(1), maxSlabPoints / numPointsSlice);
+        double* values = static_cast<double*>(_sharedValues->data());
+        std::vector<double> buffer(std::min(numSlices, _axes[0].size())*numPointsSlice);
+        hsize_t offset[3] = { 0, 0, 0 };
+        hsize_t count[3] = { 1, 1, 1 };
+        for (size_t iDim = 1; iDim < _spaceDim; ++iDim) {
+            count[iDim] = _axes[iDim].size();
+        } // for
+        for (size_t iSlice = 0; iSlice < _axes[0].size(); iSlice += numSlices) {
+            offset[0] = iSlice;
+            count[0] = std::min(numSlices, _axes[0].size() - iSlice);
+            const size_t numSlabPoints = count[0]*numPointsSlice;
+            double* slab = &values[iSlice*numPointsSlice*numValues];
+            for (size_t iValue = 0; iValue < numValues; ++iValue) {
+                _h5->readDatasetHyperslab("/values", _names[iValue].c_str(), &buffer[0], offset, count, _spaceDim,
+                                          H5T_NATIVE_DOUBLE);
+                for (size_t iPoint = 0; iPoint < numSlabPoints; ++iPoint) {
+                    slab[iPoint*numValues+iValue] = buffer[iPoint];
+                } // for
+            } // for
+        } // for
+    } // if
+    _sharedValues->synchronize();
+
+    PYLITH_METHOD_END;
+} // _readShared
+
+
+// End of file
@@ -0,0 +1,198 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/GriddedHDF5DB.hh
+ *
+ * @brief Spatial database with values on a logically rectangular grid stored in an HDF5 file.
+ *
+ * The coordinates of the grid along each axis are in the datasets `/coordinates/x`, `/coordinates/y`, and
+ * `/coordinates/z` (as needed for the spatial dimension) and must be strictly increasing. Each value is a dataset
+ * `/values/NAME` with dimensions (numX, numY, numZ) and a string attribute `units`.
+ *
+ * The grid is divided into blocks that are read from the file by hyperslab when a query point first falls within
+ * the block, so each process only reads the portion of the grid covering its part of the domain.
+ *
+ * Alternatively, the values for the entire grid can be read once per compute node into memory shared by all of the
+ * processes on the node (see pylith::utils::NodeSharedBuffer). This avoids holding a copy of large grids, such as
+ * seismic velocity models, in each process when the domain of every process covers most of the grid.
+ */
+
+#if !defined(pylith_meshio_griddedhdf5db_hh)
+#define pylith_meshio_griddedhdf5db_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "spatialdata/spatialdb/SpatialDB.hh" // ISA SpatialDB
+#include "spatialdata/geocoords/geocoordsfwd.hh" // HOLDSA CoordSys
+
+#include "pylith/utils/utilsfwd.hh" // HOLDSA NodeSharedBuffer
+#include "pylith/utils/array.hh" // HASA string_vector
+
+#include <map> // HASA std::map
+#include <vector> // HASA std::vector
+#include <string> // HASA std::string
+
+class pylith::meshio::GriddedHDF5DB : public spatialdata::spatialdb::SpatialDB {
+    friend class TestGriddedHDF5DB; // unit testing
+
+    // PUBLIC ENUMS ///////////////////////////////////////////////////////////////////////////////
+public:
+
+    enum QueryEnum {
+        NEAREST=0, ///< Nearest grid point.
+        LINEAR=1, ///< Linear interpolation.
+    };
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    GriddedHDF5DB(void);
+
+    /// Destructor
+    ~GriddedHDF5DB(void);
+
+    /** Set filename containing data.
+     *
+     * @param[in] value Name of HDF5 file.
+     */
+    void setFilename(const char* value);
+
+    /** Set query type.
+     *
+     * @param[in] value Query type.
+     */
+    void setQueryType(const QueryEnum value);
+
+    /** Set number of grid cells along each axis in blocks read from the file.
+     *
+     * @param[in] value Number of grid cells along each axis.
+     */
+    void setBlockSize(const int value);
+
+    /** Set flag for reading values for the entire grid into memory shared by the processes on each compute node.
+     *
+     * The block size is ignored when shared memory is used.
+     *
+     * @param[in] value True if values are stored in shared memory, false otherwise.
+     */
+    void setSharedMemory(const bool value);
+
+    /** Set coordinate system associated with grid coordinates.
+     *
+     * @param[in] cs Coordinate system.
+     */
+    void setCoordSys(const spatialdata::geocoords::CoordSys& cs);
+
+    /// Open the database and prepare for querying.
+    void open(void);
+
+    /// Close the database.
+    void close(void);
+
+    /** Set values to be returned by queries.
+     *
+     * @param[in] names Names of values to be returned in queries
+     * @param[in] numVals Number of values to be returned in queries
+     */
+    void setQueryValues(const char* const* names,
+                        const size_t numVals);
+
+    /** Get names of values in spatial database.
+     *
+     * @param[out] valueNames Array of names of values.
+     * @param[out] numValues Number of values.
+     */
+    void getNamesDBValues(const char*** valueNames,
+                          size_t* numValues) const;
+
+    /** Query the database.
+     *
+     * @param[out] vals Array for computed values (output from query), must be allocated BEFORE calling query().
+     * @param[in] numVals Number of values expected (size of pVals array)
+     * @param[in] coords Coordinates of point for query
+     * @param[in] numDims Number of dimensions for coordinates
+     * @param[in] csQuery Coordinate system of coordinates
+     *
+     * @returns 0 on success, 1 on failure (i.e., could not interpolate)
+     */
+    int query(double* vals,
+              const size_t numVals,
+              const double* coords,
+              const size_t numDims,
+              const spatialdata::geocoords::CoordSys* csQuery);
+
+    /** Query the database.
+     *
+     * @param[out] vals Array for computed values (output from query), must be allocated BEFORE calling query().
+     * @param[in] numVals Number of values expected (size of pVals array)
+     * @param[in] coords Coordinates of point for query
+     * @param[in] numDims Number of dimensions for coordinates
+     * @param[in] csQuery Coordinate system of coordinates
+     *
+     * @returns 0 on success, 1 on failure (i.e., could not interpolate)
+     */
+    int query(float* vals,
+              const size_t numVals,
+              const float* coords,
+              const size_t numDims,
+              const spatialdata::geocoords::CoordSys* csQuery);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Get values of block, reading them from the file if necessary.
+     *
+     * @param[in] blockIndices Indices of block along each axis.
+     * @returns Values at grid points of block.
+     */
+    const double* _getBlock(const size_t* blockIndices);
+
+    /// Read values for the entire grid into memory shared by the processes on each compute node.
+    void _readShared(void);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Name of HDF5 file.
+    QueryEnum _queryType; ///< Query type.
+    size_t _blockSize; ///< Number of grid cells along each axis in a block.
+    bool _useSharedMemory; ///< True if values are stored in memory shared by processes on a node.
+    spatialdata::geocoords::CoordSys* _cs; ///< Coordinate system of grid coordinates.
+    HDF5* _h5; ///< HDF5 file.
+
+    size_t _spaceDim; ///< Spatial dimension of grid.
+    std::vector<double> _axes[3]; ///< Coordinates of grid along each axis.
+    pylith::string_vector _names; ///< Names of values in database.
+    std::vector<double> _scales; ///< Scales for converting values to SI units.
+    std::vector<size_t> _queryIndices; ///< Indices of values returned in queries.
+    std::map<size_t, std::vector<double> > _blocks; ///< Values at grid points of blocks read from file.
+    pylith::utils::NodeSharedBuffer* _sharedValues; ///< Values at grid points of entire grid in shared memory.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    GriddedHDF5DB(const GriddedHDF5DB&); ///< Not implemented.
+    const GriddedHDF5DB& operator=(const GriddedHDF5DB&); ///< Not implemented
+
+}; // GriddedHDF5DB
+
+#endif // pylith_meshio_griddedhdf5db_hh
+
+// End of file
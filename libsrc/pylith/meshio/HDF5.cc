@@ -958,6 +958,99 @@ pylith::meshio::HDF5::readDatasetChunk(const char* parent,
   PYLITH_METHOD_END;
 } // readDatasetChunk
 
+// ----------------------------------------------------------------------
+// Read hyperslab of dataset.
+void
+pylith::meshio::HDF5::readDatasetHyperslab(const char* parent,
+					   const char* name,
+					   void* const data,
+					   const hsize_t* offset,
+					   const hsize_t* count,
+					   const int ndims,
+					   hid_t datatype)
+{ // readDatasetHyperslab
+  PYLITH_METHOD_BEGIN;
+
+  assert(parent);
+  assert(name);
+  assert(data);
+  assert(offset);
+  assert(count);
+  assert(_file > 0);
+
+  try {
+    // Open group
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t group = H5Gopen2(_file, parent, H5P_DEFAULT);
+#else
+    hid_t group = H5Gopen(_file, parent);
+#endif
+    if (group < 0)
+      throw std::runtime_error("Could not open group.");
+
+    // Open the dataset
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t dataset = H5Dopen2(group, name, H5P_DEFAULT);
+#else
+    hid_t dataset = H5Dopen(group, name);
+#endif
+    if (dataset < 0)
+      throw std::runtime_error("Could not open dataset.");
+
+    hid_t dataspace = H5Dget_space(dataset);
+    if (dataspace < 0)
+      throw std::runtime_error("Could not get dataspace.");
+
+    if (H5Sget_simple_extent_ndims(dataspace) != ndims)
+      throw std::runtime_error("Mismatch in number of dimensions of dataset and hyperslab.");
+
+    // Select hyperslab in file
+    hid_t slabspace = H5Screate_simple(ndims, count, 0);
+    if (slabspace < 0)
+      throw std::runtime_error("Could not create hyperslab dataspace.");
+
+    herr_t err = H5Sselect_hyperslab(dataspace, H5S_SELECT_SET,
+				     offset, 0, count, 0);
+    if (err < 0)
+      throw std::runtime_error("Could not select hyperslab.");
+
+    err = H5Dread(dataset, datatype, slabspace, dataspace,
+		  H5P_DEFAULT, data);
+    if (err < 0)
+      throw std::runtime_error("Could not read data.");
+
+    err = H5Sclose(slabspace);
+    if (err < 0)
+      throw std::runtime_error("Could not close hyperslab dataspace.");
+
+    err = H5Sclose(dataspace);
+    if (err < 0)
+      throw std::runtime_error("Could not close dataspace.");
+
+    err = H5Dclose(dataset);
+    if (err < 0)
+      throw std::runtime_error("Could not close dataset.");
+
+    err = H5Gclose(group);
+    if (err < 0)
+      throw std::runtime_error("Could not close group.");
+
+  } catch (const std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error occurred while reading hyperslab of dataset '"
+	<< parent << "/" << name << "':\n"
+	<< err.what();
+    throw std::runtime_error(msg.str());
+  } catch (...) {
+    std::ostringstream msg;
+    msg << "Unknown error occurred while reading hyperslab of dataset '"
+	<< parent << "/" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // readDatasetHyperslab
+
 // ----------------------------------------------------------------------
 // Create dataset associated with data stored in a raw external binary
 // file.
@@ -240,6 +240,24 @@ public :
 			const int chunk,
 			hid_t datatype);
 
+  /** Read hyperslab of dataset.
+   *
+   * @param parent Full path of parent group for dataset.
+   * @param name Name of dataset.
+   * @param data Preallocated buffer for data [product of count].
+   * @param offset Starting indices of hyperslab.
+   * @param count Number of entries along each dimension of hyperslab.
+   * @param ndims Number of dimensions of dataset.
+   * @param datatype Type of data.
+   */
+  void readDatasetHyperslab(const char* parent,
+			    const char* name,
+			    void* const data,
+			    const hsize_t* offset,
+			    const hsize_t* count,
+			    const int ndims,
+			    hid_t datatype);
+
   /** Create dataset associated with data stored in a raw external
    * binary file.
    *
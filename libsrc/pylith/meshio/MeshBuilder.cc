@@ -21,14 +21,63 @@
 #include "MeshBuilder.hh" // implementation of class methods
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
-#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/array.hh" // USES scalar_array, int_array, int_buffer
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::min()
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _MeshBuilder {
+public:
+
+            /// Cells from a caller-owned array.
+            class ArrayCellSource : public MeshBuilder::CellSource {
+public:
+
+                /** Constructor.
+                 *
+                 * @param[in] cells Array of indices of vertices in cells.
+                 * @param[in] numCorners Number of vertices per cell.
+                 */
+                ArrayCellSource(const PylithInt* cells,
+                                const int numCorners) :
+                    _cells(cells),
+                    _numCorners(numCorners) {}
+
+
+                /** Get vertices in a contiguous chunk of cells.
+                 *
+                 * @param[out] cells Array of indices of vertices in cells.
+                 * @param[in] cellStart Index of first cell in chunk.
+                 * @param[in] numCells Number of cells in chunk.
+                 */
+                void getCells(PylithInt* cells,
+                              const PylithInt cellStart,
+                              const PylithInt numCells) {
+                    const PylithInt* chunk = &_cells[cellStart*_numCorners];
+                    for (PylithInt i = 0; i < numCells*_numCorners; ++i) {
+                        cells[i] = chunk[i];
+                    } // for
+                } // getCells
+
+
+private:
+
+                const PylithInt* _cells; ///< Array of indices of vertices in cells.
+                const int _numCorners; ///< Number of vertices per cell.
+            }; // ArrayCellSource
+
+        }; // _MeshBuilder
+    } // meshio
+} // pylith
 
 // ----------------------------------------------------------------------
 // Set vertices and cells in mesh.
@@ -46,36 +95,163 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
 
     assert(mesh);
     assert(coordinates);
+
+    const PylithScalar* coordsPtr = (coordinates->size() > 0) ? &(*coordinates)[0] : NULL;
+    const PylithInt* cellsPtr = (cells.size() > 0) ? &cells[0] : NULL;
+    buildMeshFromArrays(mesh, coordsPtr, numVertices, spaceDim, cellsPtr, numCells, numCorners, meshDim);
+
+    PYLITH_METHOD_END;
+} // buildMesh
+
+
+// ----------------------------------------------------------------------
+// Build mesh topology and set vertex coordinates from caller-owned arrays.
+void
+pylith::meshio::MeshBuilder::buildMeshFromArrays(topology::Mesh* mesh,
+                                                 const PylithScalar* coordinates,
+                                                 const int numVertices,
+                                                 int spaceDim,
+                                                 const PylithInt* cells,
+                                                 const int numCells,
+                                                 const int numCorners,
+                                                 const int meshDim) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(!numCells || cells);
+
+    _MeshBuilder::ArrayCellSource source(cells, numCorners);
+    buildMeshStreaming(mesh, coordinates, numVertices, spaceDim, &source, numCells, numCorners, meshDim);
+
+    PYLITH_METHOD_END;
+} // buildMeshFromArrays
+
+
+// ----------------------------------------------------------------------
+// Build mesh topology and set vertex coordinates with cells provided in chunks.
+void
+pylith::meshio::MeshBuilder::buildMeshStreaming(topology::Mesh* mesh,
+                                                const PylithScalar* coordinates,
+                                                const int numVertices,
+                                                int spaceDim,
+                                                CellSource* source,
+                                                const int numCells,
+                                                const int numCorners,
+                                                const int meshDim,
+                                                const int chunkSize) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(!numVertices || coordinates);
+    assert(source);
+    assert(chunkSize > 0);
     MPI_Comm comm = mesh->getComm();
     PetscInt dim = meshDim;
     PetscErrorCode err;
 
-    { // Check to make sure every vertex is in at least one cell.
-      // This is required by PETSc
-        std::vector<bool> vertexInCell(numVertices, false);
-        const int size = cells.size();
-        for (int i = 0; i < size; ++i) {
-            vertexInCell[cells[i]] = true;
-        }
-        int count = 0;
-        for (int i = 0; i < numVertices; ++i) {
-            if (!vertexInCell[i]) {
-                ++count;
-            }
-        }
-        if (count > 0) {
-            std::ostringstream msg;
-            msg << "Mesh contains " << count << " vertices that are not in any cells.";
-            throw std::runtime_error(msg.str());
-        } // if
-    } // check
+    err = MPI_Bcast(&dim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Bcast(&spaceDim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
 
-    /* DMPlex */
+    DMPolytopeType cellType = DM_POLYTOPE_UNKNOWN;
+    if (3 == dim) {
+        switch (numCorners) {
+        case 4: cellType = DM_POLYTOPE_TETRAHEDRON;break;
+        case 6: cellType = DM_POLYTOPE_TRI_PRISM;break;
+        case 8: cellType = DM_POLYTOPE_HEXAHEDRON;break;
+        default: break;
+        } // switch
+    } // if
+
+    // Insert cells into DMPlex one chunk at a time, equivalent to DMPlexBuildFromCellList() without requiring the
+    // entire array of cells.
     PetscDM dmMesh = NULL;
-    PetscBool interpolate = PETSC_TRUE;
+    err = DMPlexCreate(comm, &dmMesh);PYLITH_CHECK_ERROR(err);
+    err = DMSetDimension(dmMesh, dim);PYLITH_CHECK_ERROR(err);
+    err = DMPlexSetChart(dmMesh, 0, numCells+numVertices);PYLITH_CHECK_ERROR(err);
+    for (PetscInt c = 0; c < numCells; ++c) {
+        err = DMPlexSetConeSize(dmMesh, c, numCorners);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = DMSetUp(dmMesh);PYLITH_CHECK_ERROR(err);
+
+    // Every vertex must be in at least one cell; this is required by PETSc.
+    std::vector<bool> vertexInCell(numVertices, false);
+    pylith::int_buffer chunk(size_t(std::min(chunkSize, numCells))*numCorners);
+    for (PetscInt cStart = 0; cStart < numCells; cStart += chunkSize) {
+        const PetscInt chunkCells = std::min(chunkSize, numCells-int(cStart));
+        source->getCells(chunk.data(), cStart, chunkCells);
+        for (PetscInt i = 0; i < chunkCells*numCorners; ++i) {
+            const PetscInt vertex = chunk[i];
+            if ((vertex < 0) || (vertex >= numVertices)) {
+                err = DMDestroy(&dmMesh);PYLITH_CHECK_ERROR(err);
+                std::ostringstream msg;
+                msg << "Cell " << cStart+i/numCorners << " contains vertex " << vertex << " outside of range [0, "
+                    << numVertices << ").";
+                throw std::runtime_error(msg.str());
+            } // if
+            vertexInCell[vertex] = true;
+            chunk[i] += numCells;
+        } // for
+        for (PetscInt iCell = 0; iCell < chunkCells; ++iCell) {
+            PetscInt* cone = &chunk[iCell*numCorners];
+            if (cellType != DM_POLYTOPE_UNKNOWN) {
+                err = DMPlexInvertCell(cellType, cone);PYLITH_CHECK_ERROR(err);
+            } // if
+            err = DMPlexSetCone(dmMesh, cStart+iCell, cone);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+    chunk.deallocate();
+
+    int count = 0;
+    for (int i = 0; i < numVertices; ++i) {
+        if (!vertexInCell[i]) {
+            ++count;
+        } // if
+    } // for
+    if (count > 0) {
+        err = DMDestroy(&dmMesh);PYLITH_CHECK_ERROR(err);
+        std::ostringstream msg;
+        msg << "Mesh contains " << count << " vertices that are not in any cells.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    err = DMPlexSymmetrize(dmMesh);PYLITH_CHECK_ERROR(err);
+    err = DMPlexStratify(dmMesh);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmInterp = NULL;
+    err = DMPlexInterpolate(dmMesh, &dmInterp);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dmMesh);PYLITH_CHECK_ERROR(err);
+    dmMesh = dmInterp;
+
+    err = DMPlexBuildCoordinatesFromCellList(dmMesh, spaceDim, coordinates);PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmMesh);
+
+    PYLITH_METHOD_END;
+} // buildMeshStreaming
+
+
+// ----------------------------------------------------------------------
+// Build distributed mesh topology and set vertex coordinates.
+void
+pylith::meshio::MeshBuilder::buildMeshParallel(topology::Mesh* mesh,
+                                               scalar_array* coordinates,
+                                               const int numVertices,
+                                               const int numVerticesGlobal,
+                                               const int spaceDim,
+                                               int_array* cells,
+                                               const int numCells,
+                                               const int numCorners,
+                                               const int meshDim,
+                                               int_array* verticesGlobal) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(coordinates);
+    assert(cells);
+    assert(verticesGlobal);
+    MPI_Comm comm = mesh->getComm();
+    const PetscInt dim = meshDim;
+    PetscErrorCode err;
 
-    err = MPI_Bcast(&dim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
-    err = MPI_Bcast(&spaceDim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
     const PetscInt bound = numCells*numCorners;
     for (PetscInt coff = 0; coff < bound; coff += numCorners) {
         DMPolytopeType ct;
@@ -87,13 +263,32 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
         case 8: ct = DM_POLYTOPE_HEXAHEDRON;break;
         default: continue;
         }
-        err = DMPlexInvertCell(ct, (int *) &cells[coff]);PYLITH_CHECK_ERROR(err);
+        err = DMPlexInvertCell(ct, (int *) &(*cells)[coff]);PYLITH_CHECK_ERROR(err);
     }
-    err = DMPlexCreateFromCellListPetsc(comm, dim, numCells, numVertices, numCorners, interpolate, &cells[0], spaceDim, &(*coordinates)[0], &dmMesh);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmMesh = NULL;
+    PetscBool interpolate = PETSC_TRUE;
+    PetscSF vertexSF = NULL;
+    PetscInt* verticesAdj = NULL;
+    const PetscInt* cellsPtr = (numCells > 0) ? &(*cells)[0] : NULL;
+    const PetscReal* coordsPtr = (numVertices > 0) ? &(*coordinates)[0] : NULL;
+    err = DMPlexCreateFromCellListParallelPetsc(comm, dim, numCells, numVertices, numVerticesGlobal, numCorners, interpolate,
+                                                cellsPtr, spaceDim, coordsPtr, &vertexSF, &verticesAdj, &dmMesh);PYLITH_CHECK_ERROR(err);
+
+    // Local vertices are numbered in increasing order of their global indices.
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    verticesGlobal->resize(vEnd - vStart);
+    for (PetscInt v = 0; v < vEnd - vStart; ++v) {
+        (*verticesGlobal)[v] = verticesAdj[v];
+    } // for
+    err = PetscFree(verticesAdj);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&vertexSF);PYLITH_CHECK_ERROR(err);
+
     mesh->setDM(dmMesh);
 
     PYLITH_METHOD_END;
-} // buildMesh
+} // buildMeshParallel
 
 
 // ----------------------------------------------------------------------
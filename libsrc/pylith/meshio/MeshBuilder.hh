@@ -47,6 +47,33 @@ public:
         CELL=1,
     }; // GroupPtType
 
+    // PUBLIC CLASSES ///////////////////////////////////////////////////
+public:
+
+    /** @brief Source of cells for building a mesh in chunks.
+     *
+     * Readers implement this interface to provide the cells directly from the file (or another buffer) without
+     * holding every cell in memory at once.
+     */
+    class CellSource {
+public:
+
+        /// Destructor.
+        virtual ~CellSource(void) {}
+
+        /** Get vertices in a contiguous chunk of cells.
+         *
+         * @param[out] cells Array [numCells*numCorners] of indices of vertices in cells (first index is 0).
+         * @param[in] cellStart Index of first cell in chunk.
+         * @param[in] numCells Number of cells in chunk.
+         */
+        virtual
+        void getCells(PylithInt* cells,
+                      const PylithInt cellStart,
+                      const PylithInt numCells) = 0;
+
+    }; // CellSource
+
     // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public:
 
@@ -77,6 +104,82 @@ public:
                    const int meshDim,
                    const bool isParallel=false);
 
+    /** Build mesh topology and set vertex coordinates from caller-owned arrays.
+     *
+     * The arrays are not copied or modified, so they may be read-only (for example, memory mapped). The cells are
+     * inserted into the DMPlex in chunks, so the only temporary storage is a single chunk of cells.
+     *
+     * @param[inout] mesh PyLith finite-element mesh.
+     * @param[in] coordinates Array [numVertices*spaceDim] of coordinates of vertices.
+     * @param[in] numVertices Number of vertices.
+     * @param[in] spaceDim Dimension of vector space for vertex coordinates.
+     * @param[in] cells Array [numCells*numCorners] of indices of vertices in cells (first index is 0).
+     * @param[in] numCells Number of cells.
+     * @param[in] numCorners Number of vertices per cell.
+     * @param[in] meshDim Dimension of cells in mesh.
+     */
+    static
+    void buildMeshFromArrays(pylith::topology::Mesh* mesh,
+                             const PylithScalar* coordinates,
+                             const int numVertices,
+                             int spaceDim,
+                             const PylithInt* cells,
+                             const int numCells,
+                             const int numCorners,
+                             const int meshDim);
+
+    /** Build mesh topology and set vertex coordinates with cells provided in chunks.
+     *
+     * @param[inout] mesh PyLith finite-element mesh.
+     * @param[in] coordinates Array [numVertices*spaceDim] of coordinates of vertices.
+     * @param[in] numVertices Number of vertices.
+     * @param[in] spaceDim Dimension of vector space for vertex coordinates.
+     * @param[in] source Source of cells.
+     * @param[in] numCells Number of cells.
+     * @param[in] numCorners Number of vertices per cell.
+     * @param[in] meshDim Dimension of cells in mesh.
+     * @param[in] chunkSize Number of cells in each chunk requested from source.
+     */
+    static
+    void buildMeshStreaming(pylith::topology::Mesh* mesh,
+                            const PylithScalar* coordinates,
+                            const int numVertices,
+                            int spaceDim,
+                            CellSource* source,
+                            const int numCells,
+                            const int numCorners,
+                            const int meshDim,
+                            const int chunkSize=65536);
+
+    /** Build distributed mesh topology and set vertex coordinates, with each process providing a subset of the
+     * cells and vertices.
+     *
+     * All mesh information must use zero based indices. In other words,
+     * the lowest index MUST be 0 not 1.
+     *
+     * @param[inout] mesh PyLith finite-element mesh.
+     * @param[in] coordinates Array of coordinates of vertices owned by this process.
+     * @param[in] numVertices Number of vertices owned by this process.
+     * @param[in] numVerticesGlobal Total number of vertices over all processes.
+     * @param[in] spaceDim Dimension of vector space for vertex coordinates.
+     * @param[inout] cells Array of global indices of vertices in cells on this process (first index is 0).
+     * @param[in] numCells Number of cells on this process.
+     * @param[in] numCorners Number of vertices per cell.
+     * @param[in] meshDim Dimension of cells in mesh.
+     * @param[out] verticesGlobal Global indices of vertices in mesh on this process (in order of local vertices).
+     */
+    static
+    void buildMeshParallel(pylith::topology::Mesh* mesh,
+                           scalar_array* coordinates,
+                           const int numVertices,
+                           const int numVerticesGlobal,
+                           const int spaceDim,
+                           int_array* cells,
+                           const int numCells,
+                           const int numCorners,
+                           const int meshDim,
+                           int_array* verticesGlobal);
+
     /** Build a point group
      *
      * The indices in the points array must use zero based indices. In
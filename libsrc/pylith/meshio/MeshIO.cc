@@ -27,6 +27,7 @@
 #include "pylith/utils/array.hh" // USES scalar_array, int_array
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_INFO
+#include "pylith/utils/SetupProfiler.hh" // USES SetupProfiler
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
 #include <cassert> // USES assert()
@@ -72,7 +73,9 @@ pylith::meshio::MeshIO::read(pylith::topology::Mesh* mesh,
     assert(!_mesh);
 
     _mesh = mesh;
+    pylith::utils::SetupProfiler::begin("Read mesh");
     _read();
+    pylith::utils::SetupProfiler::end("Read mesh");
 
     PetscErrorCode err = 0;
 
@@ -249,7 +252,8 @@ pylith::meshio::MeshIO::_setMaterials(const int_array& materialIds) {
     PetscErrorCode err = 0;
     const char* const labelName = pylith::topology::Mesh::cells_label_name;
 
-    if (!_mesh->getCommRank()) {
+    // Cells are only on process 0 unless the mesh was read in parallel.
+    if (!_mesh->getCommRank() || (materialIds.size() > 0)) {
         PetscDM dmMesh = _mesh->getDM();assert(dmMesh);
         topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
         const PetscInt cStart = cellsStratum.begin();
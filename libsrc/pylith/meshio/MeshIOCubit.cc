@@ -23,12 +23,13 @@
 #include "MeshBuilder.hh" // USES MeshBuilder
 #include "ExodusII.hh" // USES ExodusII
 
-#include "pylith/utils/array.hh" // USES scalar_array, int_array, string_vector
+#include "pylith/utils/array.hh" // USES scalar_array, int_array, scalar_buffer, string_vector
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
 #include "petsc.h" // USES MPI_Comm
 
+#include <algorithm> // USES std::sort(), std::lower_bound()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
@@ -38,7 +39,8 @@
 // Constructor
 pylith::meshio::MeshIOCubit::MeshIOCubit(void) :
     _filename(""),
-    _useNodesetNames(true) { // constructor
+    _useNodesetNames(true),
+    _useParallelRead(false) { // constructor
     PyreComponent::setName("meshiocubit");
 } // constructor
 
@@ -71,6 +73,13 @@ pylith::meshio::MeshIOCubit::_read(void) {
 
     assert(_mesh);
 
+    int commSize = 1;
+    MPI_Comm_size(_mesh->getComm(), &commSize);
+    if (_useParallelRead && (commSize > 1)) {
+        _readParallel();
+        PYLITH_METHOD_END;
+    } // if
+
     const int commRank = _mesh->getCommRank();
     int meshDim = 0;
     int spaceDim = 0;
@@ -116,6 +125,131 @@ pylith::meshio::MeshIOCubit::_read(void) {
 } // read
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Read mesh in parallel.
+void
+pylith::meshio::MeshIOCubit::_readParallel(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readParallel()");
+
+    assert(_mesh);
+
+    const int commRank = _mesh->getCommRank();
+    int commSize = 1;
+    MPI_Comm_size(_mesh->getComm(), &commSize);
+
+    try {
+        // Every process opens the file and reads only its own hyperslabs of the variables.
+        ExodusII exofile(_filename.c_str());
+
+        const int meshDim = exofile.getDim("num_dim");
+        const int spaceDim = meshDim;
+        const int numVerticesGlobal = exofile.getDim("num_nodes");
+        const int numCellsGlobal = exofile.getDim("num_elem");
+        const int numMaterials = exofile.getDim("num_el_blk");
+
+        PYLITH_COMPONENT_INFO_ROOT("Reading " << numVerticesGlobal << " vertices and " << numCellsGlobal
+                                              << " cells in " << numMaterials << " blocks in parallel.");
+
+        // Contiguous chunks of vertices and cells for this process.
+        const int vBegin = int((long(numVerticesGlobal) * commRank) / commSize);
+        const int vEnd = int((long(numVerticesGlobal) * (commRank+1)) / commSize);
+        const int cBegin = int((long(numCellsGlobal) * commRank) / commSize);
+        const int cEnd = int((long(numCellsGlobal) * (commRank+1)) / commSize);
+        const int numVertices = vEnd - vBegin;
+        const int numCells = cEnd - cBegin;
+
+        // Vertices
+        scalar_array coordinates(numVertices*spaceDim);
+        scalar_buffer buffer(numVertices);
+        if (exofile.hasVar("coord", NULL)) {
+            for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                const size_t start[2] = { size_t(iDim), size_t(vBegin) };
+                const size_t count[2] = { 1, size_t(numVertices) };
+                exofile.getVarSlab((numVertices > 0) ? buffer.data() : NULL, start, count, 2, "coord");
+                for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+                    coordinates[iVertex*spaceDim+iDim] = buffer[iVertex];
+                } // for
+            } // for
+        } else {
+            const char* coordNames[3] = { "coordx", "coordy", "coordz" };
+            for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                const size_t start[1] = { size_t(vBegin) };
+                const size_t count[1] = { size_t(numVertices) };
+                exofile.getVarSlab((numVertices > 0) ? buffer.data() : NULL, start, count, 1, coordNames[iDim]);
+                for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+                    coordinates[iVertex*spaceDim+iDim] = buffer[iVertex];
+                } // for
+            } // for
+        } // if/else
+
+        // Cells
+        int_array blockIds(numMaterials);
+        int dims[1] = { numMaterials };
+        exofile.getVar(&blockIds[0], dims, 1, "eb_prop1");
+
+        int numCorners = 0;
+        for (int iMaterial = 0; iMaterial < numMaterials; ++iMaterial) {
+            std::ostringstream varname;
+            varname << "num_nod_per_el" << iMaterial+1;
+            const int blockCorners = exofile.getDim(varname.str().c_str());
+            if (0 == numCorners) {
+                numCorners = blockCorners;
+            } else if (blockCorners != numCorners) {
+                std::ostringstream msg;
+                msg << "All materials must have the same number of vertices per cell.\n"
+                    << "Expected " << numCorners << " vertices per cell, but block "
+                    << blockIds[iMaterial] << " has " << blockCorners << " vertices.";
+                throw std::runtime_error(msg.str());
+            } // if
+        } // for
+
+        int_array cells(numCells*numCorners);
+        int_array materialIds(numCells);
+        for (int iMaterial = 0, index = 0; iMaterial < numMaterials; ++iMaterial) {
+            std::ostringstream varname;
+            varname << "num_el_in_blk" << iMaterial+1;
+            const int blockSize = exofile.getDim(varname.str().c_str());
+
+            // Intersection of block with chunk of cells for this process.
+            const int blockBegin = std::max(index, cBegin);
+            const int blockEnd = std::min(index+blockSize, cEnd);
+            if (blockBegin < blockEnd) {
+                varname.str("");
+                varname << "connect" << iMaterial+1;
+                const size_t start[2] = { size_t(blockBegin-index), 0 };
+                const size_t count[2] = { size_t(blockEnd-blockBegin), size_t(numCorners) };
+                exofile.getVarSlab(&cells[(blockBegin-cBegin)*numCorners], start, count, 2, varname.str().c_str());
+                for (int iCell = blockBegin; iCell < blockEnd; ++iCell) {
+                    materialIds[iCell-cBegin] = blockIds[iMaterial];
+                } // for
+            } // if
+            index += blockSize;
+        } // for
+        cells -= 1; // use zero index
+
+        _orientCells(&cells, numCells, numCorners, meshDim);
+        int_array verticesGlobal;
+        MeshBuilder::buildMeshParallel(_mesh, &coordinates, numVertices, numVerticesGlobal, spaceDim,
+                                       &cells, numCells, numCorners, meshDim, &verticesGlobal);
+        _setMaterials(materialIds);
+
+        _readGroups(exofile, &verticesGlobal);
+    } catch (std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while reading Cubit Exodus file '" << _filename << "' in parallel.\n"
+            << err.what();
+        throw std::runtime_error(msg.str());
+    } catch (...) {
+        std::ostringstream msg;
+        msg << "Unknown error while reading Cubit Exodus file '" << _filename << "' in parallel.";
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // _readParallel
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Write mesh to file.
 void
@@ -160,8 +294,8 @@ pylith::meshio::MeshIOCubit::_readVertices(ExodusII& exofile,
         int dims[2];
         dims[0] = *numDims;
         dims[1] = *numVertices;
-        scalar_array buffer(*numVertices * *numDims);
-        exofile.getVar(&buffer[0], dims, ndims, "coord");
+        scalar_buffer buffer(*numVertices * *numDims);
+        exofile.getVar(buffer.data(), dims, ndims, "coord");
 
         coordinates->resize(*numVertices * *numDims);
         for (int iVertex = 0; iVertex < *numVertices; ++iVertex) {
@@ -175,14 +309,14 @@ pylith::meshio::MeshIOCubit::_readVertices(ExodusII& exofile,
         const char* coordNames[3] = { "coordx", "coordy", "coordz" };
 
         coordinates->resize(*numVertices * *numDims);
-        scalar_array buffer(*numVertices);
+        scalar_buffer buffer(*numVertices);
 
         const int ndims = 1;
         int dims[1];
         dims[0] = *numVertices;
 
         for (int i = 0; i < *numDims; ++i) {
-            exofile.getVar(&buffer[0], dims, ndims, coordNames[i]);
+            exofile.getVar(buffer.data(), dims, ndims, coordNames[i]);
 
             for (int iVertex = 0; iVertex < *numVertices; ++iVertex) {
                 (*coordinates)[iVertex*(*numDims)+i] = buffer[iVertex];
@@ -269,9 +403,10 @@ pylith::meshio::MeshIOCubit::_readCells(ExodusII& exofile,
 // ---------------------------------------------------------------------------------------------------------------------
 // Read mesh groups.
 void
-pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile) {
+pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile,
+                                         const int_array* verticesGlobal) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("_readGroups(exofile="<<typeid(exofile).name()<<")");
+    PYLITH_COMPONENT_DEBUG("_readGroups(exofile="<<typeid(exofile).name()<<", verticesGlobal="<<verticesGlobal<<")");
 
     const int numGroups = exofile.getDim("num_node_sets");
 
@@ -307,6 +442,25 @@ pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile) {
         std::sort(&points[0], &points[0]+nodesetSize);
         points -= 1; // use zero index
 
+        if (verticesGlobal) {
+            // Keep only vertices on this process and convert global indices to local indices.
+            const size_t numVerticesLocal = verticesGlobal->size();
+            const PylithInt* verticesBegin = (numVerticesLocal > 0) ? &(*verticesGlobal)[0] : NULL;
+            const PylithInt* verticesEnd = verticesBegin + numVerticesLocal;
+            int_array pointsLocal(nodesetSize);
+            size_t numPointsLocal = 0;
+            for (size_t i = 0; i < nodesetSize; ++i) {
+                const PylithInt* iter = std::lower_bound(verticesBegin, verticesEnd, points[i]);
+                if ((iter != verticesEnd) && (*iter == points[i])) {
+                    pointsLocal[numPointsLocal++] = int(iter - verticesBegin);
+                } // if
+            } // for
+            points.resize(numPointsLocal);
+            for (size_t i = 0; i < numPointsLocal; ++i) {
+                points[i] = pointsLocal[i];
+            } // for
+        } // if
+
         pylith::meshio::MeshBuilder::GroupPtType type = pylith::meshio::MeshBuilder::VERTEX;
         if (_useNodesetNames) {
             pylith::meshio::MeshBuilder::setGroup(_mesh, groupNames[iGroup].c_str(), type, points);
@@ -62,6 +62,12 @@ public:
      */
     void setUseNodesetNames(const bool flag);
 
+    /** Set flag on whether to read mesh in parallel.
+     *
+     * @param flag True to read contiguous chunks of the vertices and cells on each process.
+     */
+    void setUseParallelRead(const bool flag);
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -74,6 +80,13 @@ protected:
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
+    /** Read mesh in parallel.
+     *
+     * Each process reads a contiguous chunk of the vertices and cells from the file and the node sets are converted
+     * to labels on each process, so the entire mesh is never held by a single process.
+     */
+    void _readParallel(void);
+
     /** Read mesh vertices.
      *
      * @param ncfile Cubit Exodus file.
@@ -103,8 +116,10 @@ private:
     /** Read point groups.
      *
      * @param ncfile Cubit Exodus file.
+     * @param verticesGlobal Global indices of local vertices if mesh was read in parallel, NULL otherwise.
      */
-    void _readGroups(ExodusII& filein);
+    void _readGroups(ExodusII& filein,
+                     const int_array* verticesGlobal=NULL);
 
     /** Write mesh dimensions.
      *
@@ -142,6 +157,7 @@ private:
 
     std::string _filename; ///< Name of file
     bool _useNodesetNames; ///< True to use node set names instead of ids.
+    bool _useParallelRead; ///< True to read mesh in parallel.
 
 }; // MeshIOCubit
 
@@ -29,6 +29,8 @@
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5Open()
+
 #include <set> // USES std::set
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
@@ -59,6 +61,14 @@ public:
             static
             void fixBoundaryLabels(PetscDM* dmMesh);
 
+            /** Check if file is a PETSc DMPlex HDF5 file.
+             *
+             * @param[in] filename Name of file.
+             * @returns True if filename has the extension '.h5', false otherwise.
+             */
+            static
+            bool isHDF5(const std::string& filename);
+
         }; // _MeshIOPetsc
     } // meshio
 } // pylith
@@ -67,7 +77,9 @@ public:
 // Constructor
 pylith::meshio::MeshIOPetsc::MeshIOPetsc(void) :
     _filename(""),
-    _prefix("") {
+    _prefix(""),
+    _hdf5Layout(HDF5_PETSC),
+    _fixGmshLabels(false) {
     PyreComponent::setName("meshiopetsc");
 } // constructor
 
@@ -106,8 +118,22 @@ pylith::meshio::MeshIOPetsc::_read(void) {
         "-" + _prefix + "dm_plex_gmsh_mark_vertices", "",
     };
 
+    // PETSc DMPlex HDF5 files are read in parallel, with each process reading a contiguous chunk of the
+    // cells. Files written by PyLith contain the labels in PyLith form, so they do not need the Gmsh options or label
+    // fix ups. The label fix ups only involve the closure and star of local points, so they can be applied on each
+    // process to HDF5 files converted from Gmsh files.
+    const bool isHDF5 = _MeshIOPetsc::isHDF5(_filename);
+
     PetscErrorCode err;
-    if (!_filename.empty()) {
+    if (isHDF5) {
+        err = PetscOptionsSetValue(NULL, options[0].c_str(), options[1].c_str());PYLITH_CHECK_ERROR(err);
+        const std::string xdmfOption = "-" + _prefix + "dm_plex_create_from_hdf5_xdmf";
+        if (HDF5_XDMF == _hdf5Layout) {
+            err = PetscOptionsSetValue(NULL, xdmfOption.c_str(), "");PYLITH_CHECK_ERROR(err);
+        } else {
+            err = PetscOptionsClearValue(NULL, xdmfOption.c_str());PYLITH_CHECK_ERROR(err);
+        } // if/else
+    } else if (!_filename.empty()) {
         for (size_t i = 0; i < noptions; ++i) {
             err = PetscOptionsSetValue(NULL, options[2*i+0].c_str(), options[2*i+1].c_str());
         } // for
@@ -121,8 +147,10 @@ pylith::meshio::MeshIOPetsc::_read(void) {
     } // if
     err = DMPlexDistributeSetDefault(dmMesh, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
     err = DMSetFromOptions(dmMesh);PYLITH_CHECK_ERROR(err);
-    _MeshIOPetsc::fixMaterialLabel(&dmMesh);
-    _MeshIOPetsc::fixBoundaryLabels(&dmMesh);
+    if (!isHDF5 || _fixGmshLabels) {
+        _MeshIOPetsc::fixMaterialLabel(&dmMesh);
+        _MeshIOPetsc::fixBoundaryLabels(&dmMesh);
+    } // if
     _mesh->setDM(dmMesh);
 
     PYLITH_METHOD_END;
@@ -132,7 +160,28 @@ pylith::meshio::MeshIOPetsc::_read(void) {
 // ------------------------------------------------------------------------------------------------
 // Write mesh to file.
 void
-pylith::meshio::MeshIOPetsc::_write(void) const {  }
+pylith::meshio::MeshIOPetsc::_write(void) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_write()");
+    assert(_mesh);
+
+    if (!_MeshIOPetsc::isHDF5(_filename)) {
+        std::ostringstream msg;
+        msg << "Cannot write mesh to '" << _filename << "'. Only PETSc DMPlex HDF5 files (extension '.h5') are supported.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Write topology, coordinates, and labels in the PETSc DMPlex HDF5 format (written and read in parallel).
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(_mesh->getComm(), _filename.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+    err = DMView(_mesh->getDM(), viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _write
 
 
 // ------------------------------------------------------------------------------------------------
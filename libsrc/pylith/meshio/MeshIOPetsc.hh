@@ -20,6 +20,8 @@
  * @file libsrc/meshio/MeshIOPetsc.hh
  *
  * @brief C++ input/output manager for PyLith PETSc gmsh mesh files.
+ *
+ * Meshes can also be written to and read from PETSc DMPlex HDF5 files (extension '.h5') in parallel.
  */
 
 #if !defined(pylith_meshio_meshiopetsc_hh)
@@ -32,6 +34,14 @@
 class pylith::meshio::MeshIOPetsc : public MeshIO {
     friend class TestMeshIOPetsc; // unit testing
 
+    // PUBLIC ENUMS ///////////////////////////////////////////////////////////////////////////////
+public:
+
+    enum HDF5LayoutEnum {
+        HDF5_PETSC, ///< PETSc DMPlex HDF5 storage layout (written by PyLith).
+        HDF5_XDMF, ///< Legacy PETSc DMPlex HDF5 layout with XDMF-compatible topology and geometry.
+    }; // HDF5LayoutEnum
+
     // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -68,6 +78,33 @@ public:
      */
     const char* getPrefix(void) const;
 
+    /** Set layout of PETSc DMPlex HDF5 file.
+     *
+     * @param value Layout of HDF5 file.
+     */
+    void setHDF5Layout(const HDF5LayoutEnum value);
+
+    /** Get layout of PETSc DMPlex HDF5 file.
+     *
+     * @returns Layout of HDF5 file.
+     */
+    HDF5LayoutEnum getHDF5Layout(void) const;
+
+    /** Convert labels in PETSc DMPlex HDF5 file from Gmsh conventions to PyLith conventions.
+     *
+     * Use for HDF5 files converted from Gmsh files by PETSc rather than written by PyLith. The labels are converted
+     * on each process after the parallel load.
+     *
+     * @param value True if labels follow Gmsh conventions, false otherwise.
+     */
+    void setFixGmshLabels(const bool value);
+
+    /** Convert labels in PETSc DMPlex HDF5 file from Gmsh conventions to PyLith conventions?
+     *
+     * @returns True if labels follow Gmsh conventions, false otherwise.
+     */
+    bool getFixGmshLabels(void) const;
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -82,6 +119,8 @@ private:
 
     std::string _filename; ///< Name of file
     std::string _prefix; ///< Options prefix for mesh
+    HDF5LayoutEnum _hdf5Layout; ///< Layout of PETSc DMPlex HDF5 file.
+    bool _fixGmshLabels; ///< True if converting labels in HDF5 file from Gmsh conventions.
 
 }; // MeshIOPetsc
 
@@ -41,6 +41,7 @@ pylith::meshio::OutputObserver::OutputObserver(void) :
     _timeScale(1.0),
     _writer(NULL),
     _trigger(NULL),
+    _subfieldCache(NULL),
     _outputBasisOrder(1) {}
 
 
@@ -68,6 +69,7 @@ pylith::meshio::OutputObserver::deallocate(void) {
 
     _writer = NULL; // :TODO: Use shared pointer
     _trigger = NULL; // :TODO: Use shared pointer
+    _subfieldCache = NULL; // Memory managed by observers of subject.
 
 } // deallocate
 
@@ -146,17 +148,32 @@ pylith::meshio::OutputObserver::_getSubfield(const pylith::topology::Field& fiel
 
     if (0 == _subfields.count(name) ) {
         _subfields[name] = OutputSubfield::create(field, submesh, name, _outputBasisOrder);
+        _subfields[name]->setCache(_subfieldCache);
     } // if
 
     PYLITH_METHOD_RETURN(_subfields[name]);
 } // _getSubfield
 
 
+// ------------------------------------------------------------------------------------------------
+// Set cache for sharing projected subfields with other observers of the same subject.
+void
+pylith::meshio::OutputObserver::_setSubfieldCache(pylith::meshio::OutputSubfieldCache* cache) {
+    _subfieldCache = cache;
+
+    typedef std::map<std::string, OutputSubfield*> subfield_t;
+    for (subfield_t::iterator iter = _subfields.begin(); iter != _subfields.end(); ++iter) {
+        assert(iter->second);
+        iter->second->setCache(cache);
+    } // for
+} // _setSubfieldCache
+
+
 // ------------------------------------------------------------------------------------------------
 // Append finite-element vertex field to file.
 void
 pylith::meshio::OutputObserver::_appendField(const PylithReal t,
-                                             const pylith::meshio::OutputSubfield& subfield) {
+                                             pylith::meshio::OutputSubfield& subfield) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("_appendField(t="<<t<<", subfield="<<typeid(subfield).name()<<")");
 
@@ -177,6 +194,7 @@ pylith::meshio::OutputObserver::_appendField(const PylithReal t,
                                        << subfield.getDescription().label << "' field."
             );
     } // switch
+    subfield.releaseVector();
 
     PYLITH_METHOD_END;
 } // _appendField
@@ -83,6 +83,12 @@ public:
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
+    /** Set cache for sharing projected subfields with other observers of the same subject.
+     *
+     * @param[in] cache Cache of projected subfields (NULL to project without cache).
+     */
+    void _setSubfieldCache(pylith::meshio::OutputSubfieldCache* cache);
+
     /** Set context.
      *
      * @param[in] mesh Mesh associated with output.
@@ -101,12 +107,14 @@ protected:
                                  const char* name);
 
     /** Append subfield at current time to output.
+     *
+     * The output vector of the subfield is returned to the pool of output buffers after it is written.
      *
      * @param[in] t Current time.
      * @param[in] subfield Subfield to write.
      */
     void _appendField(const PylithReal t,
-                      const pylith::meshio::OutputSubfield& subfield);
+                      pylith::meshio::OutputSubfield& subfield);
 
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
@@ -115,6 +123,7 @@ protected:
     std::map<std::string, OutputSubfield*> _subfields; ///< Subfields extracted for output.
     DataWriter* _writer; ///< Writer for data.
     OutputTrigger* _trigger; ///< Trigger for deciding how often to write output.
+    OutputSubfieldCache* _subfieldCache; ///< Cache of projected subfields shared with other observers.
     int _outputBasisOrder; ///< Basis order for output.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
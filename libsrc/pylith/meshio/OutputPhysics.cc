@@ -35,6 +35,28 @@
 #include <iostream> // USES std::cout
 #include <typeinfo> // USES typeid()
 
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _OutputPhysics {
+public:
+
+            /** Create global vector without constrained DOF and populate it from the local vector of a field.
+             *
+             * Auxiliary and derived fields do not hold a persistent output vector, because they are only written
+             * at output steps; this avoids keeping a second copy of their values in memory for the entire
+             * simulation. The caller is responsible for destroying the vector.
+             *
+             * @param[in] field Field with local vector.
+             * @returns Global vector with values of field for output.
+             */
+            static
+            PetscVec createOutputVector(const pylith::topology::Field& field);
+
+        }; // _OutputPhysics
+    } // meshio
+} // pylith
+
 // ------------------------------------------------------------------------------------------------
 // Constructor
 pylith::meshio::OutputPhysics::OutputPhysics(void) {}
@@ -180,6 +202,24 @@ pylith::meshio::OutputPhysics::verifyConfiguration(const pylith::topology::Field
 } // verifyConfiguration
 
 
+// ------------------------------------------------------------------------------------------------
+// Set cache for sharing projected subfields with other observers of the same subject.
+void
+pylith::meshio::OutputPhysics::setSubfieldCache(pylith::meshio::OutputSubfieldCache* cache) {
+    OutputObserver::_setSubfieldCache(cache);
+} // setSubfieldCache
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether observer needs update at time t.
+bool
+pylith::meshio::OutputPhysics::needsUpdate(const PylithReal t,
+                                           const PylithInt tindex) const {
+    assert(_trigger);
+    return getForceOutput() || _trigger->willWrite(t, tindex);
+} // needsUpdate
+
+
 // ------------------------------------------------------------------------------------------------
 // Get update from integrator (subject of observer).
 void
@@ -191,7 +231,7 @@ pylith::meshio::OutputPhysics::update(const PylithReal t,
         _writeInfo();
     } else {
         assert(_trigger);
-        if (_trigger->shouldWrite(t, tindex)) {
+        if (getForceOutput() || _trigger->shouldWriteSolution(t, tindex, solution)) {
             _writeDataStep(t, tindex, solution);
         } // if
     } // if/else
@@ -218,8 +258,7 @@ pylith::meshio::OutputPhysics::_writeInfo(void) {
     _open(domainMesh, isInfo);
     _openDataStep(0.0, domainMesh);
 
-    PetscVec auxiliaryVector = auxiliaryField->getOutputVector();
-    auxiliaryField->scatterLocalToOutput();
+    PetscVec auxiliaryVector = _OutputPhysics::createOutputVector(*auxiliaryField);
 
     const size_t numInfoFields = infoNames.size();
     for (size_t i = 0; i < numInfoFields; i++) {
@@ -234,6 +273,7 @@ pylith::meshio::OutputPhysics::_writeInfo(void) {
             throw std::runtime_error(msg.str());
         } // if/else
     } // for
+    PetscErrorCode err = VecDestroy(&auxiliaryVector);PYLITH_CHECK_ERROR(err);
 
     _closeDataStep();
     _close();
@@ -326,11 +366,8 @@ pylith::meshio::OutputPhysics::_writeDataStep(const PylithReal t,
 
     _openDataStep(t, domainMesh);
 
-    if (auxiliaryField) { auxiliaryField->scatterLocalToOutput(); }
-    PetscVec auxiliaryVector = (auxiliaryField) ? auxiliaryField->getOutputVector() : NULL;
-
-    if (derivedField) { derivedField->scatterLocalToOutput(); }
-    PetscVec derivedVector = (derivedField) ? derivedField->getOutputVector() : NULL;
+    PetscVec auxiliaryVector = (auxiliaryField) ? _OutputPhysics::createOutputVector(*auxiliaryField) : NULL;
+    PetscVec derivedVector = (derivedField) ? _OutputPhysics::createOutputVector(*derivedField) : NULL;
 
     PetscVec solutionVector = solution.getOutputVector();assert(solutionVector);
 
@@ -360,6 +397,9 @@ pylith::meshio::OutputPhysics::_writeDataStep(const PylithReal t,
 
         OutputObserver::_appendField(t, *subfield);
     } // for
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = VecDestroy(&auxiliaryVector);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&derivedVector);PYLITH_CHECK_ERROR(err);
     _closeDataStep();
 
     PYLITH_METHOD_END;
@@ -407,4 +447,34 @@ pylith::meshio::OutputPhysics::_expandDataFieldNames(const pylith::topology::Fie
 } // _expandDataFieldNames
 
 
+// ------------------------------------------------------------------------------------------------
+// Create global vector without constrained DOF and populate it from the local vector of a field.
+PetscVec
+pylith::meshio::_OutputPhysics::createOutputVector(const pylith::topology::Field& field) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dmOutput = NULL;
+    err = DMGetOutputDM(field.getDM(), &dmOutput);PYLITH_CHECK_ERROR(err);assert(dmOutput);
+
+    PetscDS dsOutput = NULL;
+    PetscInt numRegions = 0;
+    err = DMGetNumDS(dmOutput, &numRegions);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numRegions; ++i) {
+        err = DMGetRegionNumDS(dmOutput, i, NULL, NULL, &dsOutput, NULL);PYLITH_CHECK_ERROR(err);
+        err = PetscDSSetUp(dsOutput);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PetscVec outputVector = NULL;
+    err = DMCreateGlobalVector(dmOutput, &outputVector);PYLITH_CHECK_ERROR(err);assert(outputVector);
+    err = PetscObjectSetName((PetscObject) outputVector, field.getLabel());PYLITH_CHECK_ERROR(err);
+
+    PetscVec localVector = field.getLocalVector();assert(localVector);
+    err = DMLocalToGlobalBegin(dmOutput, localVector, INSERT_VALUES, outputVector);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmOutput, localVector, INSERT_VALUES, outputVector);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(outputVector);
+} // createOutputVector
+
+
 // End of file
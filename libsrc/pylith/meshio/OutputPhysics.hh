@@ -91,6 +91,21 @@ public:
      */
     void verifyConfiguration(const pylith::topology::Field& solution) const;
 
+    /** Set cache for sharing projected subfields with other observers of the same subject.
+     *
+     * @param[in] cache Cache of projected subfields (NULL to project without cache).
+     */
+    void setSubfieldCache(pylith::meshio::OutputSubfieldCache* cache);
+
+    /** Check whether observer needs update at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if trigger may write output at time t, false otherwise.
+     */
+    bool needsUpdate(const PylithReal t,
+                     const PylithInt tindex) const;
+
     /** Receive update (subject of observer).
      *
      * @param[in] t Current time.
@@ -0,0 +1,348 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputPhysicsCoulombStress.hh" // Implementation of class methods
+
+#include "pylith/meshio/DataWriter.hh" // USES DataWriter
+#include "pylith/meshio/OutputTrigger.hh" // USES OutputTrigger
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/meshio/PointInterpolator.hh" // USES PointInterpolator
+#include "pylith/feassemble/PhysicsImplementation.hh" // USES PhysicsImplementation
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cmath> // USES sin(), cos()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _OutputPhysicsCoulombStress {
+public:
+
+            static const size_t numReceiverValues; ///< Strike, dip, rake, and friction coefficient.
+            static const size_t stressSize; ///< Number of components of Cauchy stress in 3D.
+            static const char* subfieldNames[3]; ///< Names of subfields in Coulomb stress field.
+        };
+    } // meshio
+} // pylith
+
+const size_t pylith::meshio::_OutputPhysicsCoulombStress::numReceiverValues = 4;
+const size_t pylith::meshio::_OutputPhysicsCoulombStress::stressSize = 6;
+const char* pylith::meshio::_OutputPhysicsCoulombStress::subfieldNames[3] = {
+    "coulomb_stress_change",
+    "shear_stress_change",
+    "normal_stress_change",
+};
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputPhysicsCoulombStress::OutputPhysicsCoulombStress(void) :
+    _coulombField(NULL),
+    _hasRefStress(false) {
+    PyreComponent::setName("outputphysicscoulombstress");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputPhysicsCoulombStress::~OutputPhysicsCoulombStress(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputPhysicsCoulombStress::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputPhysicsPoints::deallocate();
+
+    delete _coulombField;_coulombField = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set orientation and effective coefficient of friction of receiver faults at points.
+void
+pylith::meshio::OutputPhysicsCoulombStress::setReceivers(const PylithReal* values,
+                                                         const int numPoints,
+                                                         const int numValues) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setReceivers(values="<<values<<", numPoints="<<numPoints<<", numValues="<<numValues<<")");
+
+    if (size_t(numValues) != _OutputPhysicsCoulombStress::numReceiverValues) {
+        std::ostringstream msg;
+        msg << "Expected " << _OutputPhysicsCoulombStress::numReceiverValues << " values (strike, dip, rake, and "
+            << "friction coefficient) for each receiver in Coulomb stress output '" << getIdentifier() << "'. Found "
+            << numValues << " values.";
+        throw std::runtime_error(msg.str());
+    } // if
+    assert(_interpolator);
+    if (size_t(numPoints) != _interpolator->getNumPoints()) {
+        std::ostringstream msg;
+        msg << "Number of receivers (" << numPoints << ") does not match number of points ("
+            << _interpolator->getNumPoints() << ") in Coulomb stress output '" << getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    assert(numPoints == 0 || values);
+
+    const size_t size = numPoints * numValues;
+    _receivers.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+        _receivers[i] = values[i];
+    } // for
+
+    PYLITH_METHOD_END;
+} // setReceivers
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::meshio::OutputPhysicsCoulombStress::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputPhysicsCoulombStress::verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    if (3 != solution.getSpaceDim()) {
+        std::ostringstream msg;
+        msg << "Coulomb stress output '" << PyreComponent::getIdentifier() << "' requires a 3D domain. Spatial "
+            << "dimension of solution is " << solution.getSpaceDim() << ".";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    assert(_physics);
+    const pylith::topology::Field* derivedField = _physics->getDerivedField();
+    if (!derivedField || !derivedField->hasSubfield("cauchy_stress")) {
+        std::ostringstream msg;
+        msg << "Physics implementation '" << _physics->getName() << "' has no 'cauchy_stress' derived subfield "
+            << "required by Coulomb stress output '" << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether observer needs update at time t.
+bool
+pylith::meshio::OutputPhysicsCoulombStress::needsUpdate(const PylithReal t,
+                                                        const PylithInt tindex) const {
+    return !_hasRefStress || OutputPhysicsPoints::needsUpdate(t, tindex);
+} // needsUpdate
+
+
+// ------------------------------------------------------------------------------------------------
+// Get update from integrator (subject of observer).
+void
+pylith::meshio::OutputPhysicsCoulombStress::update(const PylithReal t,
+                                                   const PylithInt tindex,
+                                                   const pylith::topology::Field& solution,
+                                                   const bool infoOnly) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputPhysicsCoulombStress::update(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    if (infoOnly) {
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_trigger);
+    const bool shouldWrite = getForceOutput() || _trigger->shouldWriteSolution(t, tindex, solution);
+    if (_hasRefStress && !shouldWrite) {
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_physics);
+    assert(_interpolator);
+    const pylith::topology::Field* derivedField = _physics->getDerivedField();assert(derivedField);
+    if (!_interpolator->isSetup()) {
+        _setup(*derivedField);
+    } // if
+    _interpolator->interpolate(*derivedField);
+    _computeCoulombStress(_interpolator->getPointField());
+    if (shouldWrite) {
+        _writeCoulombStep(t);
+    } // if
+
+    PYLITH_METHOD_END;
+} // update
+
+
+// ------------------------------------------------------------------------------------------------
+// Locate points, create field with Coulomb stress change, and set receiver directions at local points.
+void
+pylith::meshio::OutputPhysicsCoulombStress::_setup(const pylith::topology::Field& derivedField) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setup(derivedField="<<derivedField.getLabel()<<")");
+
+    // Only output points in cells of this physics.
+    assert(_interpolator);
+    _interpolator->setLabel(_physics->getPhysicsLabelName(), _physics->getPhysicsLabelValue());
+    _interpolator->setup(derivedField, pylith::string_vector(1, "cauchy_stress"));
+    const pylith::topology::Field& pointField = _interpolator->getPointField();
+
+    const pylith::topology::Field::SubfieldInfo& stressInfo = pointField.getSubfieldInfo("cauchy_stress");
+    delete _coulombField;_coulombField = new pylith::topology::Field(pointField.getMesh());assert(_coulombField);
+    for (size_t i = 0; i < 3; ++i) {
+        pylith::topology::Field::Description description;
+        description.label = _OutputPhysicsCoulombStress::subfieldNames[i];
+        description.alias = _OutputPhysicsCoulombStress::subfieldNames[i];
+        description.vectorFieldType = pylith::topology::Field::SCALAR;
+        description.numComponents = 1;
+        description.componentNames.resize(1);
+        description.componentNames[0] = _OutputPhysicsCoulombStress::subfieldNames[i];
+        description.scale = stressInfo.description.scale;
+        _coulombField->subfieldAdd(description, stressInfo.fe);
+    } // for
+    _coulombField->subfieldsSetup();
+    _coulombField->createDiscretization();
+    _coulombField->setLabel("coulomb stress change");
+    _coulombField->allocate();
+
+    // Unit normal (pointing into the hanging wall) and slip direction (of the hanging wall) with x east, y north, and
+    // z up.
+    const pylith::int_vector& pointIndices = _interpolator->getPointIndices();
+    const size_t numPointsLocal = pointIndices.size();
+    const size_t numValues = _OutputPhysicsCoulombStress::numReceiverValues;
+    _normalDir.resize(3*numPointsLocal);
+    _slipDir.resize(3*numPointsLocal);
+    _friction.resize(numPointsLocal);
+    for (size_t iPoint = 0; iPoint < numPointsLocal; ++iPoint) {
+        const size_t iReceiver = pointIndices[iPoint];
+        assert(numValues*(iReceiver+1) <= _receivers.size());
+        const PylithReal strike = _receivers[numValues*iReceiver+0];
+        const PylithReal dip = _receivers[numValues*iReceiver+1];
+        const PylithReal rake = _receivers[numValues*iReceiver+2];
+
+        const PylithReal strikeDir[3] = { sin(strike), cos(strike), 0.0 };
+        const PylithReal updipDir[3] = { -cos(dip)*cos(strike), cos(dip)*sin(strike), sin(dip) };
+        _normalDir[3*iPoint+0] = sin(dip)*cos(strike);
+        _normalDir[3*iPoint+1] = -sin(dip)*sin(strike);
+        _normalDir[3*iPoint+2] = cos(dip);
+        for (size_t i = 0; i < 3; ++i) {
+            _slipDir[3*iPoint+i] = cos(rake)*strikeDir[i] + sin(rake)*updipDir[i];
+        } // for
+        _friction[iPoint] = _receivers[numValues*iReceiver+3];
+    } // for
+    _refStress.resize(_OutputPhysicsCoulombStress::stressSize*numPointsLocal);
+    _refStress = 0.0;
+
+    PYLITH_METHOD_END;
+} // _setup
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute Coulomb stress change at points from interpolated stress.
+void
+pylith::meshio::OutputPhysicsCoulombStress::_computeCoulombStress(const pylith::topology::Field& pointField) {
+    PYLITH_METHOD_BEGIN;
+    assert(_coulombField);
+
+    const size_t stressSize = _OutputPhysicsCoulombStress::stressSize;
+
+    PetscDM dmPoints = pointField.getDM();assert(dmPoints);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(dmPoints, 0, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(size_t(pEnd-pStart) == _friction.size());
+
+    pylith::topology::VecVisitorMesh stressVisitor(pointField, "cauchy_stress");
+    const PetscScalar* stressArray = stressVisitor.localArray();
+    pylith::topology::VecVisitorMesh coulombVisitor(*_coulombField);
+    PetscScalar* coulombArray = coulombVisitor.localArray();
+    for (PetscInt point = pStart, iPoint = 0; point < pEnd; ++point, ++iPoint) {
+        const PetscInt stressOff = stressVisitor.sectionOffset(point);
+        assert(PetscInt(stressSize) == stressVisitor.sectionDof(point));
+        PylithScalar* refStress = &_refStress[stressSize*iPoint];
+        if (!_hasRefStress) {
+            for (size_t i = 0; i < stressSize; ++i) {
+                refStress[i] = stressArray[stressOff+i];
+            } // for
+        } // if
+
+        // Stress change (xx, yy, zz, xy, yz, xz) relative to reference stress.
+        PylithScalar s[6];
+        for (size_t i = 0; i < stressSize; ++i) {
+            s[i] = stressArray[stressOff+i] - refStress[i];
+        } // for
+        const PylithScalar* n = &_normalDir[3*iPoint];
+        const PylithScalar* d = &_slipDir[3*iPoint];
+        const PylithScalar traction[3] = {
+            s[0]*n[0] + s[3]*n[1] + s[5]*n[2],
+            s[3]*n[0] + s[1]*n[1] + s[4]*n[2],
+            s[5]*n[0] + s[4]*n[1] + s[2]*n[2],
+        };
+        const PylithScalar shearStress = traction[0]*d[0] + traction[1]*d[1] + traction[2]*d[2];
+        const PylithScalar normalStress = traction[0]*n[0] + traction[1]*n[1] + traction[2]*n[2];
+
+        const PetscInt coulombOff = coulombVisitor.sectionOffset(point);
+        assert(3 == coulombVisitor.sectionDof(point));
+        coulombArray[coulombOff+0] = shearStress + _friction[iPoint] * normalStress;
+        coulombArray[coulombOff+1] = shearStress;
+        coulombArray[coulombOff+2] = normalStress;
+    } // for
+    _hasRefStress = true;
+
+    PYLITH_METHOD_END;
+} // _computeCoulombStress
+
+
+// ------------------------------------------------------------------------------------------------
+// Write Coulomb stress change at time step.
+void
+pylith::meshio::OutputPhysicsCoulombStress::_writeCoulombStep(const PylithReal t) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_writeCoulombStep(t="<<t<<")");
+
+    assert(_interpolator);
+    assert(_coulombField);
+    const pylith::topology::Mesh& pointMesh = _interpolator->getPointMesh();
+
+    assert(_writer);
+    const bool writePointNames = !_writer->isOpen();
+    _openDataStep(t, pointMesh);
+    if (writePointNames) {
+        _writer->writePointNames(_interpolator->getPointNames(), pointMesh);
+    } // if
+
+    for (size_t i = 0; i < 3; ++i) {
+        const char* name = _OutputPhysicsCoulombStress::subfieldNames[i];
+        OutputSubfield* subfield = _getSubfield(*_coulombField, pointMesh, name);assert(subfield);
+        subfield->extractSubfield(*_coulombField, i);
+
+        OutputObserver::_appendField(t, *subfield);
+    } // for
+    _closeDataStep();
+
+    PYLITH_METHOD_END;
+} // _writeCoulombStep
+
+
+// End of file
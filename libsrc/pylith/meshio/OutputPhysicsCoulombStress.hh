@@ -0,0 +1,139 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/OutputPhysicsCoulombStress.hh
+ *
+ * @brief Manager for output of Coulomb failure stress change on receiver faults at an arbitrary set of points.
+ *
+ * The Cauchy stress of a material is interpolated to the points, and the change in stress relative to the stress at
+ * the start of the simulation is resolved onto the receiver fault at each point. The receiver fault is given by its
+ * strike, dip, and rake (x is east, y is north, and z is up) and an effective coefficient of friction. The Coulomb
+ * failure stress change is the change in shear stress in the rake direction plus the effective coefficient of
+ * friction times the change in normal stress (tension is positive).
+ */
+
+#if !defined(pylith_meshio_outputphysicscoulombstress_hh)
+#define pylith_meshio_outputphysicscoulombstress_hh
+
+#include "pylith/meshio/OutputPhysicsPoints.hh" // ISA OutputPhysicsPoints
+
+#include "pylith/utils/array.hh" // HASA scalar_array
+
+class pylith::meshio::OutputPhysicsCoulombStress : public pylith::meshio::OutputPhysicsPoints {
+    friend class TestOutputPhysicsCoulombStress; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    OutputPhysicsCoulombStress(void);
+
+    /// Destructor
+    ~OutputPhysicsCoulombStress(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set orientation and effective coefficient of friction of receiver faults at points.
+     *
+     * The values at each point are the strike, dip, and rake (radians) followed by the effective coefficient of
+     * friction. The points are in the same order as in setPoints().
+     *
+     * @param[in] values Array of receiver values [numPoints * numValues].
+     * @param[in] numPoints Number of points.
+     * @param[in] numValues Number of values at each point (must be 4).
+     */
+    void setReceivers(const PylithReal* values,
+                      const int numPoints,
+                      const int numValues);
+
+    /** Verify configuration.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Check whether observer needs update at time t.
+     *
+     * The first update after the solution is available sets the reference stress, so it is always needed.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if observer needs the derived field at time t, false otherwise.
+     */
+    bool needsUpdate(const PylithReal t,
+                     const PylithInt tindex) const;
+
+    /** Receive update (subject of observer).
+     *
+     * The stress at the first update after the solution is available is the reference stress.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @param[in] infoOnly Flag is true if this update is before solution is available (e.g., after initialization).
+     */
+    void update(const PylithReal t,
+                const PylithInt tindex,
+                const pylith::topology::Field& solution,
+                const bool infoOnly);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Locate points, create field with Coulomb stress change, and set receiver directions at local points.
+     *
+     * @param[in] derivedField Derived field of physics.
+     */
+    void _setup(const pylith::topology::Field& derivedField);
+
+    /** Compute Coulomb stress change at points from interpolated stress.
+     *
+     * @param[in] pointField Derived field interpolated to points.
+     */
+    void _computeCoulombStress(const pylith::topology::Field& pointField);
+
+    /** Write Coulomb stress change at time step.
+     *
+     * @param[in] t Current time.
+     */
+    void _writeCoulombStep(const PylithReal t);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::scalar_array _receivers; ///< Strike, dip, rake, and friction coefficient at points [numPoints * 4].
+    pylith::scalar_array _normalDir; ///< Receiver normal directions at local points [numPointsLocal * 3].
+    pylith::scalar_array _slipDir; ///< Receiver slip directions at local points [numPointsLocal * 3].
+    pylith::scalar_array _friction; ///< Effective coefficient of friction at local points [numPointsLocal].
+    pylith::scalar_array _refStress; ///< Reference stress at local points [numPointsLocal * 6].
+    pylith::topology::Field* _coulombField; ///< Field at points with Coulomb stress change.
+    bool _hasRefStress; ///< True if reference stress has been set.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputPhysicsCoulombStress(const OutputPhysicsCoulombStress&); ///< Not implemented.
+    const OutputPhysicsCoulombStress& operator=(const OutputPhysicsCoulombStress&); ///< Not implemented
+
+}; // OutputPhysicsCoulombStress
+
+#endif // pylith_meshio_outputphysicscoulombstress_hh
+
+// End of file
@@ -0,0 +1,225 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputPhysicsPoints.hh" // Implementation of class methods
+
+#include "pylith/meshio/DataWriter.hh" // USES DataWriter
+#include "pylith/meshio/OutputTrigger.hh" // USES OutputTrigger
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/meshio/PointInterpolator.hh" // USES PointInterpolator
+#include "pylith/feassemble/PhysicsImplementation.hh" // USES PhysicsImplementation
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <typeinfo> // USES typeid()
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputPhysicsPoints::OutputPhysicsPoints(void) :
+    _interpolator(new PointInterpolator) {
+    PyreComponent::setName("outputphysicspoints");
+    _interpolator->setName(PyreComponent::getName());
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputPhysicsPoints::~OutputPhysicsPoints(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputPhysicsPoints::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputPhysics::deallocate();
+
+    delete _interpolator;_interpolator = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set point names and coordinates of points .
+void
+pylith::meshio::OutputPhysicsPoints::setPoints(const PylithReal* pointCoords,
+                                               const int numPoints,
+                                               const int spaceDim,
+                                               const char* const* pointNames,
+                                               const int numPointNames) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_interpolator);
+    _interpolator->setPoints(pointCoords, numPoints, spaceDim, pointNames, numPointNames);
+
+    PYLITH_METHOD_END;
+} // setPoints
+
+
+// ------------------------------------------------------------------------------------------------
+// Use sparse interpolation matrix for output of the requested subfields.
+void
+pylith::meshio::OutputPhysicsPoints::useInterpolationMatrix(const bool value) {
+    PYLITH_COMPONENT_DEBUG("useInterpolationMatrix(value="<<value<<")");
+
+    assert(_interpolator);
+    _interpolator->useInterpolationMatrix(value);
+} // useInterpolationMatrix
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::meshio::OutputPhysicsPoints::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputPhysicsPoints::verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    assert(_physics);
+    const pylith::topology::Field* derivedField = _physics->getDerivedField();
+    if (!derivedField) {
+        std::ostringstream msg;
+        msg << "Physics implementation '" << _physics->getName() << "' has no derived field, but physics output '"
+            << PyreComponent::getIdentifier() << "' only supports output of derived subfields at points.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Data fields must be in derived field.
+    const size_t numDataFields = _dataFieldNames.size();
+    if ((numDataFields > 0) && (std::string("all") != _dataFieldNames[0])) {
+        for (size_t i = 0; i < numDataFields; i++) {
+            if (!derivedField->hasSubfield(_dataFieldNames[i].c_str())) {
+                std::ostringstream msg;
+                msg << "Could not find subfield '" << _dataFieldNames[i] << "' in derived field '"
+                    << derivedField->getLabel() << "' for physics output '" << PyreComponent::getIdentifier() << "'.";
+                throw std::runtime_error(msg.str());
+            } // if
+        } // for
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Get update from integrator (subject of observer).
+void
+pylith::meshio::OutputPhysicsPoints::update(const PylithReal t,
+                                            const PylithInt tindex,
+                                            const pylith::topology::Field& solution,
+                                            const bool infoOnly) {
+    if (infoOnly) {
+        return;
+    } // if
+
+    assert(_trigger);
+    if (getForceOutput() || _trigger->shouldWriteSolution(t, tindex, solution)) {
+        _writeDataStep(t, tindex, solution);
+    } // if
+} // update
+
+
+// ------------------------------------------------------------------------------------------------
+// Write output for step in solution.
+void
+pylith::meshio::OutputPhysicsPoints::_writeDataStep(const PylithReal t,
+                                                    const PylithInt tindex,
+                                                    const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputPhysicsPoints::_writeDataStep(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    assert(_physics);
+    assert(_interpolator);
+    const pylith::topology::Field* derivedField = _physics->getDerivedField();assert(derivedField);
+
+    const pylith::string_vector& subfieldNames = _expandDerivedFieldNames(*derivedField);
+    if (!_interpolator->isSetup()) {
+        // Only output points in cells of this physics.
+        _interpolator->setLabel(_physics->getPhysicsLabelName(), _physics->getPhysicsLabelValue());
+        _interpolator->setup(*derivedField, subfieldNames);
+    } // if
+    _interpolator->interpolate(*derivedField);
+    const pylith::topology::Mesh& pointMesh = _interpolator->getPointMesh();
+    const pylith::topology::Field& pointField = _interpolator->getPointField();
+
+    assert(_writer);
+    const bool writePointNames = !_writer->isOpen();
+    _openDataStep(t, pointMesh);
+    if (writePointNames) {
+        _writer->writePointNames(_interpolator->getPointNames(), pointMesh);
+    } // if
+
+    const size_t numSubfields = subfieldNames.size();
+    for (size_t i = 0; i < numSubfields; i++) {
+        OutputSubfield* subfield = _getSubfield(pointField, pointMesh, subfieldNames[i].c_str());assert(subfield);
+
+        const pylith::topology::Field::SubfieldInfo& info = derivedField->getSubfieldInfo(subfieldNames[i].c_str());
+        subfield->extractSubfield(pointField, info.index);
+
+        OutputObserver::_appendField(t, *subfield);
+    } // for
+    _closeDataStep();
+
+    PYLITH_METHOD_END;
+} // _writeDataStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Get output subfield, creating if necessary.
+pylith::meshio::OutputSubfield*
+pylith::meshio::OutputPhysicsPoints::_getSubfield(const pylith::topology::Field& field,
+                                                  const pylith::topology::Mesh& submesh,
+                                                  const char* name) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_getSubfield(field="<<field.getLabel()<<", name="<<name<<", submesh="<<typeid(submesh).name()<<")");
+
+    if (_subfields.count(name) == 0) {
+        _subfields[name] = OutputSubfield::create(field, submesh, name);
+    } // if
+
+    PYLITH_METHOD_RETURN(_subfields[name]);
+} // _getSubfield
+
+
+// ------------------------------------------------------------------------------------------------
+// Names of derived subfields for output.
+pylith::string_vector
+pylith::meshio::OutputPhysicsPoints::_expandDerivedFieldNames(const pylith::topology::Field& derivedField) const {
+    PYLITH_METHOD_BEGIN;
+
+    if ((1 == _dataFieldNames.size()) && (std::string("all") == _dataFieldNames[0])) {
+        PYLITH_METHOD_RETURN(derivedField.getSubfieldNames());
+    } // if
+
+    PYLITH_METHOD_RETURN(_dataFieldNames);
+} // _expandDerivedFieldNames
+
+
+// End of file
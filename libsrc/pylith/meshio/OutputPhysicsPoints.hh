@@ -0,0 +1,138 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/OutputPhysicsPoints.hh
+ *
+ * @brief Manager for output of derived fields of physics (e.g., stress and strain of a material) at an arbitrary set
+ * of points.
+ */
+
+#if !defined(pylith_meshio_outputphysicspoints_hh)
+#define pylith_meshio_outputphysicspoints_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/meshio/OutputPhysics.hh" // ISA OutputPhysics
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/array.hh" // USES string_vector
+
+class pylith::meshio::OutputPhysicsPoints : public pylith::meshio::OutputPhysics {
+    friend class TestOutputPhysicsPoints; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    OutputPhysicsPoints(void);
+
+    /// Destructor
+    virtual ~OutputPhysicsPoints(void);
+
+    /// Deallocate PETSc and local data structures.
+    virtual
+    void deallocate(void);
+
+    /** Set coordinates and names of points.
+     *
+     * @param[in] points Array of coordinates [numPoints * spaceDim].
+     * @param[in] numPoints Number of points.
+     * @param[in] spaceDim Spatial dimension for coordinates.
+     * @param[in] pointNames Array with point names.
+     * @param[in] numPointNames Number of point banes.
+     */
+    void setPoints(const PylithReal* pointCoords,
+                   const int numPoints,
+                   const int spaceDim,
+                   const char* const* pointNames,
+                   const int numPointNames);
+
+    /** Use sparse interpolation matrix for output of the requested subfields.
+     *
+     * @param[in] value True if using interpolation matrix, false if using DMInterpolationEvaluate().
+     */
+    void useInterpolationMatrix(const bool value);
+
+    /** Verify configuration.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Receive update (subject of observer).
+     *
+     * There is no info output at points, so updates before the solution is available are ignored.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @param[in] infoOnly Flag is true if this update is before solution is available (e.g., after initialization).
+     */
+    void update(const PylithReal t,
+                const PylithInt tindex,
+                const pylith::topology::Field& solution,
+                const bool infoOnly);
+
+    // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Write output for step in solution.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void _writeDataStep(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution);
+
+    /** Get output subfield, creating if necessary.
+     *
+     * @param[in] field Field containing subfields.
+     * @param[in] submesh Submesh associated with output.
+     * @param[in] name Name of subfield.
+     */
+    OutputSubfield* _getSubfield(const pylith::topology::Field& field,
+                                 const pylith::topology::Mesh& submesh,
+                                 const char* name);
+
+    /** Names of derived subfields for output.
+     *
+     * Expand "all" into list of subfields in the derived field.
+     *
+     * @param[in] derivedField Derived field.
+     */
+    pylith::string_vector _expandDerivedFieldNames(const pylith::topology::Field& derivedField) const;
+
+    // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
+protected:
+
+    PointInterpolator* _interpolator; ///< Interpolator for derived field at points.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputPhysicsPoints(const OutputPhysicsPoints&); ///< Not implemented.
+    const OutputPhysicsPoints& operator=(const OutputPhysicsPoints&); ///< Not implemented
+
+}; // OutputPhysicsPoints
+
+#endif // pylith_meshio_outputphysicspoints_hh
+
+// End of file
@@ -0,0 +1,466 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputRuptureStats.hh" // Implementation of class methods
+
+#include "pylith/meshio/OutputTrigger.hh" // USES OutputTrigger
+#include "pylith/feassemble/PhysicsImplementation.hh" // USES PhysicsImplementation
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+
+#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cmath> // USES sqrt(), pow(), log10()
+#include <cstdio> // USES snprintf()
+#include <strings.h> // USES strcasecmp()
+#include <fstream> // USES std::ofstream
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _OutputRuptureStats {
+public:
+
+            /** Write time series to output file in format of pylith_eqinfo.
+             *
+             * NaN and infinite values are written as +-1.0e+30.
+             *
+             * @param[inout] fout Output stream.
+             * @param[in] fault Name of fault.
+             * @param[in] name Name of time series.
+             * @param[in] values Values in time series.
+             */
+            static
+            void writeArray(std::ostream& fout,
+                            const std::string& fault,
+                            const char* name,
+                            const std::vector<PylithReal>& values);
+
+        }; // _OutputRuptureStats
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputRuptureStats::OutputRuptureStats(void) :
+    _filename("rupture_stats.py"),
+    _faultName("fault"),
+    _timeScale(1.0),
+    _trigger(NULL),
+    _propertiesDB(NULL) {
+    PyreComponent::setName("outputrupturestats");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputRuptureStats::~OutputRuptureStats(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputRuptureStats::deallocate(void) {
+    ObserverPhysics::deallocate();
+
+    _trigger = NULL; // :TODO: Use shared pointer
+    _propertiesDB = NULL; // :KLUDGE: Memory managed by Python object
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set output trigger for how often to compute the statistics.
+void
+pylith::meshio::OutputRuptureStats::setTrigger(pylith::meshio::OutputTrigger* const trigger) {
+    PYLITH_COMPONENT_DEBUG("OutputRuptureStats::setTrigger(trigger="<<trigger<<")");
+
+    _trigger = trigger;
+} // setTrigger
+
+
+// ------------------------------------------------------------------------------------------------
+// Set spatial database with density and shear wave speed.
+void
+pylith::meshio::OutputRuptureStats::setPropertiesDB(spatialdata::spatialdb::SpatialDB* db) {
+    PYLITH_COMPONENT_DEBUG("OutputRuptureStats::setPropertiesDB(db="<<db<<")");
+
+    _propertiesDB = db;
+} // setPropertiesDB
+
+
+// ------------------------------------------------------------------------------------------------
+// Set name of fault used for the variable in the output file.
+void
+pylith::meshio::OutputRuptureStats::setFaultName(const char* value) {
+    PYLITH_COMPONENT_DEBUG("OutputRuptureStats::setFaultName(value="<<value<<")");
+
+    _faultName = value;
+} // setFaultName
+
+
+// ------------------------------------------------------------------------------------------------
+// Set filename for output.
+void
+pylith::meshio::OutputRuptureStats::setFilename(const char* value) {
+    PYLITH_COMPONENT_DEBUG("OutputRuptureStats::setFilename(value="<<value<<")");
+
+    _filename = value;
+} // setFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Get filename for output.
+const char*
+pylith::meshio::OutputRuptureStats::getFilename(void) const {
+    return _filename.c_str();
+} // getFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Set time scale.
+void
+pylith::meshio::OutputRuptureStats::setTimeScale(const PylithReal value) {
+    PYLITH_COMPONENT_DEBUG("OutputRuptureStats::setTimeScale(value="<<value<<")");
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Time scale (" << value << ") for rupture statistics '" << PyreComponent::getIdentifier()
+            << "' must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _timeScale = value;
+    if (_trigger) {
+        _trigger->setTimeScale(value);
+    } // if
+} // setTimeScale
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::meshio::OutputRuptureStats::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputRuptureStats::verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    assert(_physics);
+    const pylith::topology::Field* auxiliaryField = _physics->getAuxiliaryField();
+    if (!auxiliaryField || !auxiliaryField->hasSubfield("slip")) {
+        std::ostringstream msg;
+        msg << "Rupture statistics '" << PyreComponent::getIdentifier() << "' require a 'slip' subfield in the "
+            << "auxiliary field of '" << _physics->getName() << "'. Rupture statistics are only available for faults "
+            << "with prescribed slip.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (_physics->getPhysicsDomainMesh().getDimension() < 1) {
+        std::ostringstream msg;
+        msg << "Rupture statistics '" << PyreComponent::getIdentifier() << "' are not available for 1D problems.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (!_propertiesDB) {
+        std::ostringstream msg;
+        msg << "Spatial database with density and shear wave speed not set for rupture statistics '"
+            << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether observer needs update at time t.
+bool
+pylith::meshio::OutputRuptureStats::needsUpdate(const PylithReal t,
+                                                const PylithInt tindex) const {
+    assert(_trigger);
+    return getForceOutput() || _trigger->willWrite(t, tindex);
+} // needsUpdate
+
+
+// ------------------------------------------------------------------------------------------------
+// Get update from fault (subject of observer).
+void
+pylith::meshio::OutputRuptureStats::update(const PylithReal t,
+                                           const PylithInt tindex,
+                                           const pylith::topology::Field& solution,
+                                           const bool infoOnly) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputRuptureStats::update(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()
+                                                               <<", infoOnly="<<infoOnly<<")");
+
+    if (infoOnly) { PYLITH_METHOD_END;}
+
+    assert(_trigger);
+    if (getForceOutput() || _trigger->shouldWriteSolution(t, tindex, solution)) {
+        assert(_physics);
+        const pylith::topology::Field* auxiliaryField = _physics->getAuxiliaryField();assert(auxiliaryField);
+        if (_timestamp.empty()) {
+            _setupCells(*auxiliaryField);
+        } // if
+        _computeStats(t, *auxiliaryField);
+        _write();
+    } // if
+
+    PYLITH_METHOD_END;
+} // update
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute area and shear modulus of cells owned by this process.
+void
+pylith::meshio::OutputRuptureStats::_setupCells(const pylith::topology::Field& auxField) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputRuptureStats::_setupCells(auxField="<<auxField.getLabel()<<")");
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dm = auxField.getDM();
+    const int cellDim = auxField.getMesh().getDimension();
+    const int spaceDim = auxField.getSpaceDim();
+    const PylithReal lengthScale = auxField.getSubfieldInfo("slip").description.scale;
+    const PylithReal areaScale = pow(lengthScale, cellDim);
+
+    // Cells shared with other processes that are owned by another process are leaves of the point SF.
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    std::vector<bool> isGhost(pEnd-pStart, false);
+    PetscSF sf = NULL;
+    PetscInt numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sf, NULL, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        const PetscInt point = leaves ? leaves[iLeaf] : iLeaf;
+        isGhost[point-pStart] = true;
+    } // for
+
+    pylith::topology::Stratum cellsStratum(dm, pylith::topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    _cells.clear();
+    _cellsArea.clear();
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        if (isGhost[cell-pStart]) { continue; }
+        _cells.push_back(cell);
+    } // for
+    const size_t numCells = _cells.size();
+    _cellsArea.resize(numCells);
+    _cellsShearModulus.resize(numCells);
+
+    assert(_propertiesDB);
+    _propertiesDB->open();
+    const char** dbValues = NULL;
+    size_t numDBValues = 0;
+    _propertiesDB->getNamesDBValues(&dbValues, &numDBValues);
+    int indexDensity = -1;
+    int indexVs = -1;
+    for (size_t index = 0; index < numDBValues; ++index) {
+        if (0 == strcasecmp(dbValues[index], "density")) {
+            indexDensity = index;
+        } else if (0 == strcasecmp(dbValues[index], "vs")) {
+            indexVs = index;
+        } // if/else
+    } // for
+    delete[] dbValues;dbValues = NULL;
+    if ((indexDensity < 0) || (indexVs < 0)) {
+        std::ostringstream msg;
+        msg << "Could not find values 'density' and 'vs' in spatial database '" << _propertiesDB->getDescription()
+            << "' for rupture statistics '" << PyreComponent::getIdentifier() << "'.";
+        _propertiesDB->close();
+        throw std::runtime_error(msg.str());
+    } // if
+
+    const spatialdata::geocoords::CoordSys* cs = auxField.getMesh().getCoordSys();
+    std::vector<double> queryValues(numDBValues);
+    PylithReal centroid[3] = { 0.0, 0.0, 0.0 };
+    double xyz[3] = { 0.0, 0.0, 0.0 };
+    for (size_t iCell = 0; iCell < numCells; ++iCell) {
+        PylithReal area = 0.0;
+        err = DMPlexComputeCellGeometryFVM(dm, _cells[iCell], &area, centroid, NULL);PYLITH_CHECK_ERROR(err);
+        _cellsArea[iCell] = area * areaScale;
+
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            xyz[iDim] = centroid[iDim] * lengthScale;
+        } // for
+        const int queryErr = _propertiesDB->query(&queryValues[0], numDBValues, xyz, spaceDim, cs);
+        if (queryErr) {
+            std::ostringstream msg;
+            msg << "Could not find density and shear wave speed at (";
+            for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                msg << " " << xyz[iDim];
+            } // for
+            msg << ") in spatial database '" << _propertiesDB->getDescription() << "' for rupture statistics '"
+                << PyreComponent::getIdentifier() << "'.";
+            _propertiesDB->close();
+            throw std::runtime_error(msg.str());
+        } // if
+        const PylithReal density = queryValues[indexDensity];
+        const PylithReal vs = queryValues[indexVs];
+        _cellsShearModulus[iCell] = density * vs * vs;
+    } // for
+    _propertiesDB->close();
+
+    PYLITH_METHOD_END;
+} // _setupCells
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute statistics at current time and append them to the time series.
+void
+pylith::meshio::OutputRuptureStats::_computeStats(const PylithReal t,
+                                                  const pylith::topology::Field& auxField) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputRuptureStats::_computeStats(t="<<t<<", auxField="<<auxField.getLabel()<<")");
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dm = auxField.getDM();
+    PetscSection section = auxField.getLocalSection();
+    PetscVec localVec = auxField.getLocalVector();
+    const pylith::topology::Field::SubfieldInfo& slipInfo = auxField.getSubfieldInfo("slip");
+    const PetscInt slipIndex = slipInfo.index;
+    const int numComponents = slipInfo.description.numComponents;
+    const PylithReal lengthScale = slipInfo.description.scale;
+
+    const PetscScalar* values = NULL;
+    err = VecGetArrayRead(localVec, &values);PYLITH_CHECK_ERROR(err);
+
+    // Local sums of rupture area, potency, and seismic moment.
+    PylithReal statsLocal[3] = { 0.0, 0.0, 0.0 };
+    std::vector<PylithReal> slip(numComponents);
+    const size_t numCells = _cells.size();
+    for (size_t iCell = 0; iCell < numCells; ++iCell) {
+        // Slip in cell is the average slip over the points in the closure with slip degrees of freedom.
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dm, _cells[iCell], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        slip.assign(numComponents, 0.0);
+        int count = 0;
+        for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+            const PetscInt point = closure[2*iPoint];
+            PetscInt dof = 0, off = 0;
+            err = PetscSectionGetFieldDof(section, point, slipIndex, &dof);PYLITH_CHECK_ERROR(err);
+            if (dof <= 0) { continue; }
+            err = PetscSectionGetFieldOffset(section, point, slipIndex, &off);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                slip[iDof % numComponents] += values[off+iDof];
+            } // for
+            count += dof / numComponents;
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dm, _cells[iCell], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+        PylithReal slipMag = 0.0;
+        for (int iComponent = 0; iComponent < numComponents; ++iComponent) {
+            slipMag += slip[iComponent]*slip[iComponent];
+        } // for
+        slipMag = (count > 0) ? sqrt(slipMag) / count * lengthScale : 0.0;
+
+        if (slipMag > 0.0) {
+            statsLocal[0] += _cellsArea[iCell];
+        } // if
+        statsLocal[1] += slipMag * _cellsArea[iCell];
+        statsLocal[2] += slipMag * _cellsArea[iCell] * _cellsShearModulus[iCell];
+    } // for
+    err = VecRestoreArrayRead(localVec, &values);PYLITH_CHECK_ERROR(err);
+
+    PylithReal statsGlobal[3] = { 0.0, 0.0, 0.0 };
+    err = MPI_Allreduce(statsLocal, statsGlobal, 3, MPIU_REAL, MPI_SUM, auxField.getMesh().getComm());PYLITH_CHECK_ERROR(err);
+
+    _timestamp.push_back(t * _timeScale);
+    _ruptureArea.push_back(statsGlobal[0]);
+    _potency.push_back(statsGlobal[1]);
+    _moment.push_back(statsGlobal[2]);
+
+    PYLITH_METHOD_END;
+} // _computeStats
+
+
+// ------------------------------------------------------------------------------------------------
+// Write time series of statistics to file.
+void
+pylith::meshio::OutputRuptureStats::_write(void) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputRuptureStats::_write()");
+
+    assert(_physics);
+    if (_physics->getPhysicsDomainMesh().getCommRank() > 0) { PYLITH_METHOD_END;}
+
+    const size_t numSteps = _timestamp.size();
+    std::vector<PylithReal> avgSlip(numSteps);
+    std::vector<PylithReal> momentMagnitude(numSteps);
+    for (size_t i = 0; i < numSteps; ++i) {
+        avgSlip[i] = _potency[i] / (_ruptureArea[i] + 1.0e-30);
+        momentMagnitude[i] = (_moment[i] > 0.0) ? 2.0 / 3.0 * (log10(_moment[i]) - 9.05) : -1.0e+30;
+    } // for
+
+    // Rewrite entire file so that it is complete if the simulation terminates early.
+    std::ofstream fout(_filename.c_str());
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open file '" << _filename << "' for rupture statistics '" << PyreComponent::getIdentifier()
+            << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    fout << "class RuptureStats(object):\n"
+         << "    pass\n"
+         << _faultName << " = RuptureStats()\n";
+    _OutputRuptureStats::writeArray(fout, _faultName, "timestamp", _timestamp);
+    _OutputRuptureStats::writeArray(fout, _faultName, "ruparea", _ruptureArea);
+    _OutputRuptureStats::writeArray(fout, _faultName, "potency", _potency);
+    _OutputRuptureStats::writeArray(fout, _faultName, "moment", _moment);
+    _OutputRuptureStats::writeArray(fout, _faultName, "avgslip", avgSlip);
+    _OutputRuptureStats::writeArray(fout, _faultName, "mommag", momentMagnitude);
+    fout.close();
+
+    PYLITH_METHOD_END;
+} // _write
+
+
+// ------------------------------------------------------------------------------------------------
+// Write time series to output file in format of pylith_eqinfo.
+void
+pylith::meshio::_OutputRuptureStats::writeArray(std::ostream& fout,
+                                                const std::string& fault,
+                                                const char* name,
+                                                const std::vector<PylithReal>& values) {
+    fout << fault << "." << name << " = [";
+    char buffer[32];
+    const size_t size = values.size();
+    for (size_t i = 0; i < size; ++i) {
+        PylithReal value = values[i];
+        if (std::isnan(value) || std::isinf(value)) {
+            value = (value > 0.0) ? 1.0e+30 : -1.0e+30;
+        } // if
+        snprintf(buffer, sizeof(buffer), "%14.6e", value);
+        fout << (i > 0 ? ", " : "") << buffer;
+    } // for
+    fout << "]\n";
+} // writeArray
+
+
+// End of file
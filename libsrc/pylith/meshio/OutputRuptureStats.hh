@@ -0,0 +1,174 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/OutputRuptureStats.hh
+ *
+ * @brief Observer computing earthquake source statistics (rupture area, potency, seismic moment) on a fault.
+ *
+ * The statistics are computed from the slip subfield of the fault auxiliary field at each output step using the
+ * same approach as pylith_eqinfo: slip in each fault cell is the average of the slip at the cell vertices and the
+ * shear modulus is computed from the density and shear wave speed in a spatial database at the cell centroids. The
+ * integrals are summed over the cells owned by each process and then reduced across processes. The time series
+ * are written by the first process as a Python file with the RuptureStats format of pylith_eqinfo.
+ */
+
+#if !defined(pylith_meshio_outputrupturestats_hh)
+#define pylith_meshio_outputrupturestats_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/problems/ObserverPhysics.hh" // ISA ObserverPhysics
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // HOLDSA SpatialDB
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::meshio::OutputRuptureStats :
+    public pylith::problems::ObserverPhysics,
+    public pylith::utils::PyreComponent {
+    friend class TestOutputRuptureStats; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    OutputRuptureStats(void);
+
+    /// Destructor
+    virtual ~OutputRuptureStats(void);
+
+    /// Deallocate PETSc and local data structures.
+    virtual
+    void deallocate(void);
+
+    /** Set output trigger for how often to compute the statistics.
+     *
+     * @param[in] trigger Output trigger.
+     */
+    void setTrigger(pylith::meshio::OutputTrigger* const trigger);
+
+    /** Set spatial database with density and shear wave speed.
+     *
+     * @param[in] db Spatial database with elastic properties.
+     */
+    void setPropertiesDB(spatialdata::spatialdb::SpatialDB* db);
+
+    /** Set name of fault used for the variable in the output file.
+     *
+     * @param[in] value Name of fault.
+     */
+    void setFaultName(const char* value);
+
+    /** Set filename for output.
+     *
+     * @param[in] value Name of output file.
+     */
+    void setFilename(const char* value);
+
+    /** Get filename for output.
+     *
+     * @returns Name of output file.
+     */
+    const char* getFilename(void) const;
+
+    /** Set time scale.
+     *
+     * @param[in] value Time scale for dimensionalizing time.
+     */
+    void setTimeScale(const PylithReal value);
+
+    /** Verify configuration.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Check whether observer needs update at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if trigger may write output at time t, false otherwise.
+     */
+    bool needsUpdate(const PylithReal t,
+                     const PylithInt tindex) const;
+
+    /** Receive update (subject of observer).
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @param[in] infoOnly Flag is true if this update is before solution is available (e.g., after initialization).
+     */
+    void update(const PylithReal t,
+                const PylithInt tindex,
+                const pylith::topology::Field& solution,
+                const bool infoOnly);
+
+    // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Compute area and shear modulus of cells owned by this process.
+     *
+     * @param[in] auxField Auxiliary field of fault.
+     */
+    void _setupCells(const pylith::topology::Field& auxField);
+
+    /** Compute statistics at current time and append them to the time series.
+     *
+     * @param[in] t Current time (nondimensional).
+     * @param[in] auxField Auxiliary field of fault.
+     */
+    void _computeStats(const PylithReal t,
+                       const pylith::topology::Field& auxField);
+
+    /// Write time series of statistics to file (first process only).
+    void _write(void) const;
+
+    // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
+protected:
+
+    std::string _filename; ///< Name of output file.
+    std::string _faultName; ///< Name of fault in output file.
+    PylithReal _timeScale; ///< Time scale for dimentionalizing time.
+    OutputTrigger* _trigger; ///< Trigger for deciding how often to compute statistics.
+    spatialdata::spatialdb::SpatialDB* _propertiesDB; ///< Spatial database with density and shear wave speed.
+
+    std::vector<PetscInt> _cells; ///< Fault cells owned by this process.
+    std::vector<PylithReal> _cellsArea; ///< Dimensioned area of owned fault cells.
+    std::vector<PylithReal> _cellsShearModulus; ///< Shear modulus of owned fault cells.
+
+    std::vector<PylithReal> _timestamp; ///< Time series of time stamps.
+    std::vector<PylithReal> _ruptureArea; ///< Time series of rupture area.
+    std::vector<PylithReal> _potency; ///< Time series of potency.
+    std::vector<PylithReal> _moment; ///< Time series of seismic moment.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputRuptureStats(const OutputRuptureStats&); ///< Not implemented.
+    const OutputRuptureStats& operator=(const OutputRuptureStats&); ///< Not implemented
+
+}; // OutputRuptureStats
+
+#endif // pylith_meshio_outputrupturestats_hh
+
+// End of file
@@ -25,10 +25,13 @@
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
+#include <algorithm> // USES std::find(), std::min()
 #include <iostream> // USES std::cout
 #include <typeinfo> // USES typeid()
 
@@ -119,6 +122,24 @@ pylith::meshio::OutputSoln::verifyConfiguration(const pylith::topology::Field& s
 } // verifyConfiguration
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set cache for sharing projected subfields with other observers of the same subject.
+void
+pylith::meshio::OutputSoln::setSubfieldCache(pylith::meshio::OutputSubfieldCache* cache) {
+    OutputObserver::_setSubfieldCache(cache);
+} // setSubfieldCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether observer needs update at time t.
+bool
+pylith::meshio::OutputSoln::needsUpdate(const PylithReal t,
+                                        const PylithInt tindex) const {
+    assert(_trigger);
+    return getForceOutput() || _trigger->willWrite(t, tindex);
+} // needsUpdate
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Get update from integrator (subject of observer).
 void
@@ -126,12 +147,35 @@ pylith::meshio::OutputSoln::update(const PylithReal t,
                                    const PylithInt tindex,
                                    const pylith::topology::Field& solution) {
     assert(_trigger);
-    if (_trigger->shouldWrite(t, tindex)) {
+    if (getForceOutput() || _trigger->shouldWriteSolution(t, tindex, solution)) {
         _writeSolnStep(t, tindex, solution);
     } // if
 } // update
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Estimate number of bytes written per time step over all processes.
+PylithReal
+pylith::meshio::OutputSoln::estimateOutputSize(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("estimateOutputSize(solution="<<solution.getLabel()<<")");
+
+    assert(_trigger);
+    PylithReal numVertices = 0.0, numCells = 0.0;
+    _getOutputPointCounts(&numVertices, &numCells, solution);
+
+    const pylith::string_vector& subfieldNames = _getOutputSubfieldNames(solution);
+    PylithReal numValues = 0.0;
+    for (size_t i = 0; i < subfieldNames.size(); ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(subfieldNames[i].c_str());
+        const int basisOrder = std::min(_outputBasisOrder, info.fe.basisOrder);
+        numValues += info.description.numComponents * ((basisOrder > 0) ? numVertices : numCells);
+    } // for
+
+    PYLITH_METHOD_RETURN(_trigger->getOutputFraction() * numValues * sizeof(PylithScalar));
+} // estimateOutputSize
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Prepare for output.
 void
@@ -212,4 +256,50 @@ pylith::meshio::OutputSoln::_writeSolnStep(const PylithReal t,
 } // _writeSolnStep
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get names of solution subfields to output.
+pylith::string_vector
+pylith::meshio::OutputSoln::_getOutputSubfieldNames(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+
+    const pylith::string_vector& subfieldNamesDomain = pylith::topology::FieldOps::getSubfieldNamesDomain(solution);
+    if (_subfieldNames.empty() || (std::string("all") == _subfieldNames[0])) {
+        PYLITH_METHOD_RETURN(subfieldNamesDomain);
+    } // if
+
+    pylith::string_vector subfieldNames;
+    for (size_t i = 0; i < subfieldNamesDomain.size(); ++i) {
+        if (std::find(_subfieldNames.begin(), _subfieldNames.end(), subfieldNamesDomain[i]) != _subfieldNames.end()) {
+            subfieldNames.push_back(subfieldNamesDomain[i]);
+        } // if
+    } // for
+
+    PYLITH_METHOD_RETURN(subfieldNames);
+} // _getOutputSubfieldNames
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of vertices and cells in output over all processes.
+void
+pylith::meshio::OutputSoln::_getOutputPointCounts(PylithReal* numVertices,
+                                                  PylithReal* numCells,
+                                                  const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    assert(numVertices);
+    assert(numCells);
+
+    const pylith::topology::Mesh& mesh = solution.getMesh();
+    PylithReal countsLocal[2] = {
+        PylithReal(pylith::topology::MeshOps::getNumVertices(mesh)),
+        PylithReal(pylith::topology::MeshOps::getNumCells(mesh)),
+    };
+    PylithReal counts[2] = { 0.0, 0.0 };
+    PetscErrorCode err = MPI_Allreduce(countsLocal, counts, 2, MPIU_REAL, MPI_SUM, mesh.getComm());PYLITH_CHECK_ERROR(err);
+    *numVertices = counts[0];
+    *numCells = counts[1];
+
+    PYLITH_METHOD_END;
+} // _getOutputPointCounts
+
+
 // End of file
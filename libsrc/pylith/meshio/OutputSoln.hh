@@ -77,6 +77,21 @@ public:
     virtual
     void verifyConfiguration(const pylith::topology::Field& solution) const;
 
+    /** Set cache for sharing projected subfields with other observers of the same subject.
+     *
+     * @param[in] cache Cache of projected subfields (NULL to project without cache).
+     */
+    void setSubfieldCache(pylith::meshio::OutputSubfieldCache* cache);
+
+    /** Check whether observer needs update at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if trigger may write output at time t, false otherwise.
+     */
+    bool needsUpdate(const PylithReal t,
+                     const PylithInt tindex) const;
+
     /** Receive update from subject.
      *
      * @param[in] t Current time.
@@ -88,6 +103,16 @@ public:
                 const PylithInt tindex,
                 const pylith::topology::Field& solution);
 
+    /** Estimate number of bytes written per time step over all processes.
+     *
+     * The estimate uses the number of output points, the number of components of the subfields, and the fraction of
+     * time steps with output from the trigger.
+     *
+     * @param[in] solution Solution field.
+     * @returns Average number of bytes written per time step.
+     */
+    PylithReal estimateOutputSize(const pylith::topology::Field& solution) const;
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -126,6 +151,28 @@ protected:
                         const PylithInt tindex,
                         const pylith::topology::Field& solution);
 
+    /** Get names of solution subfields to output.
+     *
+     * @param[in] solution Solution field.
+     * @returns Names of requested subfields defined over the entire domain.
+     */
+    pylith::string_vector _getOutputSubfieldNames(const pylith::topology::Field& solution) const;
+
+    /** Get number of vertices and cells in output over all processes.
+     *
+     * Collective over the processes of the solution. Default implementation uses the entire domain. Points on
+     * process boundaries are counted on each process, so the counts are slightly larger than the number of points
+     * written.
+     *
+     * @param[out] numVertices Number of vertices (or points) for subfields with a basis order of 1 or more.
+     * @param[out] numCells Number of cells (or points) for subfields with a basis order of 0.
+     * @param[in] solution Solution field.
+     */
+    virtual
+    void _getOutputPointCounts(PylithReal* numVertices,
+                               PylithReal* numCells,
+                               const pylith::topology::Field& solution) const;
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
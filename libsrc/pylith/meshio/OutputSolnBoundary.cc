@@ -29,6 +29,8 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 
+#include <set> // USES std::set
+
 // ------------------------------------------------------------------------------------------------
 // Constructor
 pylith::meshio::OutputSolnBoundary::OutputSolnBoundary(void) :
@@ -141,4 +143,59 @@ pylith::meshio::OutputSolnBoundary::_writeSolnStep(const PylithReal t,
 } // _writeSolnStep
 
 
+// ------------------------------------------------------------------------------------------------
+// Get number of vertices and cells of boundary over all processes.
+void
+pylith::meshio::OutputSolnBoundary::_getOutputPointCounts(PylithReal* numVertices,
+                                                          PylithReal* numCells,
+                                                          const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    assert(numVertices);
+    assert(numCells);
+
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+    PetscErrorCode err = 0;
+    PetscInt vStart = 0, vEnd = 0, fStart = 0, fEnd = 0;
+    err = DMPlexGetDepthStratum(dmSoln, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dmSoln, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
+
+    // Boundary labels may or may not include the vertices, so we collect the vertices in the closure of the faces.
+    std::set<PetscInt> vertices;
+    PetscInt numFaces = 0;
+    PetscIS stratumIS = NULL;
+    err = DMGetStratumIS(dmSoln, _labelName.c_str(), _labelValue, &stratumIS);PYLITH_CHECK_ERROR(err);
+    if (stratumIS) {
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = ISGetLocalSize(stratumIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(stratumIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt p = 0; p < numPoints; ++p) {
+            const PetscInt point = points[p];
+            if ((point < fStart) || (point >= fEnd)) {
+                continue;
+            } // if
+            ++numFaces;
+            PetscInt closureSize = 0, *closure = NULL;
+            err = DMPlexGetTransitiveClosure(dmSoln, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt c = 0; c < closureSize*2; c += 2) {
+                if ((closure[c] >= vStart) && (closure[c] < vEnd)) {
+                    vertices.insert(closure[c]);
+                } // if
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dmSoln, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = ISRestoreIndices(stratumIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&stratumIS);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PylithReal countsLocal[2] = { PylithReal(vertices.size()), PylithReal(numFaces) };
+    PylithReal counts[2] = { 0.0, 0.0 };
+    err = MPI_Allreduce(countsLocal, counts, 2, MPIU_REAL, MPI_SUM, solution.getMesh().getComm());PYLITH_CHECK_ERROR(err);
+    *numVertices = counts[0];
+    *numCells = counts[1];
+
+    PYLITH_METHOD_END;
+} // _getOutputPointCounts
+
+
 // End of file
@@ -79,6 +79,16 @@ protected:
                         const PylithInt tindex,
                         const pylith::topology::Field& solution);
 
+    /** Get number of vertices and cells of boundary over all processes.
+     *
+     * @param[out] numVertices Number of vertices on boundary.
+     * @param[out] numCells Number of faces on boundary.
+     * @param[in] solution Solution field.
+     */
+    void _getOutputPointCounts(PylithReal* numVertices,
+                               PylithReal* numCells,
+                               const pylith::topology::Field& solution) const;
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -0,0 +1,250 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputSolnLineOfSight.hh" // implementation of class methods
+
+#include "pylith/meshio/DataWriter.hh" // USES DataWriter
+#include "pylith/meshio/PointInterpolator.hh" // USES PointInterpolator
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <algorithm> // USES std::find()
+#include <cmath> // USES sqrt()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputSolnLineOfSight::OutputSolnLineOfSight(void) :
+    _losField(NULL) {
+    PyreComponent::setName("outputsolnlineofsight");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputSolnLineOfSight::~OutputSolnLineOfSight(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputSolnLineOfSight::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPoints::deallocate();
+
+    delete _losField;_losField = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set line-of-sight directions and names of satellite tracks.
+void
+pylith::meshio::OutputSolnLineOfSight::setLineOfSight(const PylithReal* directions,
+                                                      const int numTracks,
+                                                      const int spaceDim,
+                                                      const char* const* trackNames,
+                                                      const int numTrackNames) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setLineOfSight(directions="<<directions<<", numTracks="<<numTracks<<", spaceDim="<<spaceDim
+                                                       <<", trackNames="<<trackNames<<", numTrackNames="<<numTrackNames<<")");
+
+    if (numTracks != numTrackNames) {
+        std::ostringstream msg;
+        msg << "Number of line-of-sight directions (" << numTracks << ") does not match number of satellite tracks ("
+            << numTrackNames << ") in line-of-sight output '" << getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (numTracks < 1) {
+        std::ostringstream msg;
+        msg << "No satellite tracks specified for line-of-sight output '" << getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    assert(directions && trackNames);
+
+    _directions.resize(numTracks*spaceDim);
+    _trackNames.resize(numTracks);
+    for (int iTrack = 0; iTrack < numTracks; ++iTrack) {
+        assert(trackNames[iTrack]);
+        _trackNames[iTrack] = trackNames[iTrack];
+
+        PylithReal mag = 0.0;
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            mag += directions[iTrack*spaceDim+iDim] * directions[iTrack*spaceDim+iDim];
+        } // for
+        mag = sqrt(mag);
+        if (mag <= 0.0) {
+            std::ostringstream msg;
+            msg << "Line-of-sight direction for satellite track '" << _trackNames[iTrack]
+                << "' in line-of-sight output '" << getIdentifier() << "' has zero length.";
+            throw std::runtime_error(msg.str());
+        } // if
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            _directions[iTrack*spaceDim+iDim] = directions[iTrack*spaceDim+iDim] / mag;
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // setLineOfSight
+
+
+// ------------------------------------------------------------------------------------------------
+// Write solution at time step.
+void
+pylith::meshio::OutputSolnLineOfSight::_writeSolnStep(const PylithReal t,
+                                                      const PylithInt tindex,
+                                                      const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_writeSolnStep(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    assert(_interpolator);
+    const pylith::string_vector& subfieldNames = _getOutputSubfieldNames(solution);
+    if (!_interpolator->isSetup()) {
+        if (!solution.hasSubfield("displacement")) {
+            std::ostringstream msg;
+            msg << "Cannot find 'displacement' subfield in solution for line-of-sight output '" << getIdentifier() << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        // Interpolate the displacement even if it is not one of the requested subfields.
+        pylith::string_vector interpolateNames(subfieldNames);
+        if (std::find(interpolateNames.begin(), interpolateNames.end(), "displacement") == interpolateNames.end()) {
+            interpolateNames.push_back("displacement");
+        } // if
+        _interpolator->setup(solution, interpolateNames);
+        _createLineOfSightField(_interpolator->getPointField());
+    } // if
+    _interpolator->interpolate(solution);
+    const pylith::topology::Mesh& pointMesh = _interpolator->getPointMesh();
+    const pylith::topology::Field& pointSoln = _interpolator->getPointField();
+    _projectLineOfSight(pointSoln);
+
+    const bool writePointNames = !_writer->isOpen();
+    _openSolnStep(t, pointMesh);
+    if (writePointNames) { _writePointNames(); }
+
+    assert(_losField);
+    OutputSubfield* losSubfield = _getSubfield(*_losField, pointMesh, "line_of_sight_displacement");assert(losSubfield);
+    losSubfield->extractSubfield(*_losField, 0);
+    OutputObserver::_appendField(t, *losSubfield);
+
+    const size_t numSubfieldNames = subfieldNames.size();
+    for (size_t iField = 0; iField < numSubfieldNames; iField++) {
+        OutputSubfield* subfield = _getSubfield(pointSoln, pointMesh, subfieldNames[iField].c_str());assert(subfield);
+
+        const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(subfieldNames[iField].c_str());
+        subfield->extractSubfield(pointSoln, info.index);
+
+        OutputObserver::_appendField(t, *subfield);
+    } // for
+    _closeSolnStep();
+
+    PYLITH_METHOD_END;
+} // _writeSolnStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Create field at points with displacement projected onto line-of-sight directions.
+void
+pylith::meshio::OutputSolnLineOfSight::_createLineOfSightField(const pylith::topology::Field& pointSoln) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_createLineOfSightField(pointSoln="<<pointSoln.getLabel()<<")");
+
+    const pylith::topology::Field::SubfieldInfo& dispInfo = pointSoln.getSubfieldInfo("displacement");
+    const size_t spaceDim = dispInfo.description.numComponents;
+    const size_t numTracks = _trackNames.size();
+    if (_directions.size() != numTracks*spaceDim) {
+        std::ostringstream msg;
+        msg << "Dimension of line-of-sight directions (" << (numTracks ? _directions.size() / numTracks : 0)
+            << ") does not match spatial dimension of displacement (" << spaceDim << ") in line-of-sight output '"
+            << getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    pylith::topology::Field::Description description;
+    description.label = "line_of_sight_displacement";
+    description.alias = "line_of_sight_displacement";
+    description.vectorFieldType = pylith::topology::Field::OTHER;
+    description.numComponents = numTracks;
+    description.componentNames.resize(numTracks);
+    for (size_t iTrack = 0; iTrack < numTracks; ++iTrack) {
+        description.componentNames[iTrack] = std::string("line_of_sight_displacement_") + _trackNames[iTrack];
+    } // for
+    description.scale = dispInfo.description.scale;
+
+    delete _losField;_losField = new pylith::topology::Field(pointSoln.getMesh());assert(_losField);
+    _losField->subfieldAdd(description, dispInfo.fe);
+    _losField->subfieldsSetup();
+    _losField->createDiscretization();
+    _losField->setLabel("line-of-sight displacement");
+    _losField->allocate();
+
+    PYLITH_METHOD_END;
+} // _createLineOfSightField
+
+
+// ------------------------------------------------------------------------------------------------
+// Project displacement at points onto line-of-sight directions.
+void
+pylith::meshio::OutputSolnLineOfSight::_projectLineOfSight(const pylith::topology::Field& pointSoln) {
+    PYLITH_METHOD_BEGIN;
+    assert(_losField);
+
+    const size_t numTracks = _trackNames.size();
+    const PetscInt spaceDim = pointSoln.getSubfieldInfo("displacement").description.numComponents;
+
+    PetscDM dmPoints = pointSoln.getDM();assert(dmPoints);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(dmPoints, 0, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::VecVisitorMesh solnVisitor(pointSoln, "displacement");
+    const PetscScalar* dispArray = solnVisitor.localArray();
+    pylith::topology::VecVisitorMesh losVisitor(*_losField);
+    PetscScalar* losArray = losVisitor.localArray();
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt dispOff = solnVisitor.sectionOffset(point);
+        const PetscInt losOff = losVisitor.sectionOffset(point);
+        assert(spaceDim == solnVisitor.sectionDof(point));
+        assert(PetscInt(numTracks) == losVisitor.sectionDof(point));
+        for (size_t iTrack = 0; iTrack < numTracks; ++iTrack) {
+            PylithScalar value = 0.0;
+            for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+                value += dispArray[dispOff+iDim] * _directions[iTrack*spaceDim+iDim];
+            } // for
+            losArray[losOff+iTrack] = value;
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _projectLineOfSight
+
+
+// End of file
@@ -0,0 +1,113 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/OutputSolnLineOfSight.hh
+ *
+ * @brief C++ object for managing output of displacement projected onto line-of-sight directions at points on the
+ * ground surface, such as those for comparison with InSAR observations.
+ *
+ * The displacement is interpolated to the points and projected onto the line-of-sight unit vector of each satellite
+ * track, so the output contains one value per track at each point.
+ */
+
+#if !defined(pylith_meshio_outputsolnlineofsight_hh)
+#define pylith_meshio_outputsolnlineofsight_hh
+
+#include "pylith/meshio/OutputSolnPoints.hh" // ISA OutputSolnPoints
+
+#include "pylith/utils/array.hh" // HASA scalar_array, string_vector
+
+class pylith::meshio::OutputSolnLineOfSight : public pylith::meshio::OutputSolnPoints {
+    friend class TestOutputSolnLineOfSight; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    OutputSolnLineOfSight(void);
+
+    /// Destructor
+    ~OutputSolnLineOfSight(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set line-of-sight directions and names of satellite tracks.
+     *
+     * Each direction is a vector in the mesh coordinate system pointing from the ground to the satellite; it is
+     * normalized to a unit vector.
+     *
+     * @param[in] directions Array of line-of-sight directions [numTracks * spaceDim].
+     * @param[in] numTracks Number of satellite tracks.
+     * @param[in] spaceDim Spatial dimension for directions.
+     * @param[in] trackNames Array with names of satellite tracks.
+     * @param[in] numTrackNames Number of names of satellite tracks.
+     */
+    void setLineOfSight(const PylithReal* directions,
+                        const int numTracks,
+                        const int spaceDim,
+                        const char* const* trackNames,
+                        const int numTrackNames);
+
+    // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Write solution at time step.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void _writeSolnStep(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Create field at points with displacement projected onto line-of-sight directions.
+     *
+     * @param[in] pointSoln Solution field at points.
+     */
+    void _createLineOfSightField(const pylith::topology::Field& pointSoln);
+
+    /** Project displacement at points onto line-of-sight directions.
+     *
+     * @param[in] pointSoln Solution field at points.
+     */
+    void _projectLineOfSight(const pylith::topology::Field& pointSoln);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::scalar_array _directions; ///< Unit line-of-sight directions [numTracks * spaceDim].
+    pylith::string_vector _trackNames; ///< Names of satellite tracks.
+    pylith::topology::Field* _losField; ///< Field at points with line-of-sight displacement.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputSolnLineOfSight(const OutputSolnLineOfSight&); ///< Not implemented.
+    const OutputSolnLineOfSight& operator=(const OutputSolnLineOfSight&); ///< Not implemented
+
+}; // OutputSolnLineOfSight
+
+#endif // pylith_meshio_outputsolnlineofsight_hh
+
+// End of file
@@ -62,6 +62,15 @@ public:
                    const char* const* pointNames,
                    const int numPointNames);
 
+    /** Use sparse interpolation matrix for output of the requested subfields.
+     *
+     * The basis functions are tabulated at the points once, so interpolation at each output step is a single
+     * sparse matrix-vector product rather than a point-by-point evaluation of all solution subfields.
+     *
+     * @param[in] value True if using interpolation matrix, false if using DMInterpolationEvaluate().
+     */
+    void useInterpolationMatrix(const bool value);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -85,32 +94,23 @@ protected:
                                  const pylith::topology::Mesh& submesh,
                                  const char* name);
 
-    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
-private:
-
-    /** Setup interpolatior.
+    /** Get number of points in output.
      *
+     * @param[out] numVertices Number of points.
+     * @param[out] numCells Number of points.
      * @param[in] solution Solution field.
      */
-    void _setupInterpolator(const pylith::topology::Field& solution);
-
-    /** Interpolate solution field.
-     *
-     * @param[in] solution Solution field to interpolate.
-     */
-    void _interpolateField(const pylith::topology::Field& solution);
+    void _getOutputPointCounts(PylithReal* numVertices,
+                               PylithReal* numCells,
+                               const pylith::topology::Field& solution) const;
 
     /// Write dataset with names of points to file.
     void _writePointNames(void);
 
-    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
-private:
+    // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
 
-    pylith::scalar_array _pointCoords; ///< Array of point coordinates.
-    pylith::string_vector _pointNames; ///< Array of point names.
-    pylith::topology::Mesh* _pointMesh; ///< Mesh for points (no cells).
-    pylith::topology::Field* _pointSoln; ///< Solution field at points.
-    DMInterpolationInfo _interpolator; ///< Field interpolator.
+    PointInterpolator* _interpolator; ///< Interpolator for solution at points.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -0,0 +1,277 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputSolnRegion.hh" // implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES isCohesiveCell()
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputSolnRegion::OutputSolnRegion(void) :
+    _regionMesh(NULL),
+    _labelName(""),
+    _labelValue(1),
+    _decimation(1) {
+    PyreComponent::setName("outputsolnregion");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputSolnRegion::~OutputSolnRegion(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputSolnRegion::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputSoln::deallocate();
+
+    delete _regionMesh;_regionMesh = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set name of label identifier restricting cells in region.
+void
+pylith::meshio::OutputSolnRegion::setLabelName(const char* value) {
+    PYLITH_METHOD_BEGIN;
+
+    _labelName = value;
+
+    PYLITH_METHOD_END;
+} // setLabelName
+
+
+// ------------------------------------------------------------------------------------------------
+// Set value of label identifier restricting cells in region.
+void
+pylith::meshio::OutputSolnRegion::setLabelValue(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    _labelValue = value;
+
+    PYLITH_METHOD_END;
+} // setLabelValue
+
+
+// ------------------------------------------------------------------------------------------------
+// Set bounding box of region.
+void
+pylith::meshio::OutputSolnRegion::setBoundingBox(const PylithReal* bbox,
+                                                 const int size) {
+    PYLITH_METHOD_BEGIN;
+
+    if ((size > 0) && (size != 4) && (size != 6)) {
+        std::ostringstream msg;
+        msg << "Bounding box for region of interest in solution observer '" << PyreComponent::getIdentifier()
+            << "' must have 4 values (2D) or 6 values (3D); found " << size << " values.";
+        throw std::invalid_argument(msg.str());
+    } // if
+    assert(!size || bbox);
+
+    _bbox.resize(size);
+    for (int i = 0; i < size; ++i) {
+        _bbox[i] = bbox[i];
+    } // for
+
+    PYLITH_METHOD_END;
+} // setBoundingBox
+
+
+// ------------------------------------------------------------------------------------------------
+// Set decimation of cells in region.
+void
+pylith::meshio::OutputSolnRegion::setDecimation(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Decimation (" << value << ") for region of interest in solution observer '"
+            << PyreComponent::getIdentifier() << "' must be positive.";
+        throw std::invalid_argument(msg.str());
+    } // if
+    _decimation = value;
+
+    PYLITH_METHOD_END;
+} // setDecimation
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::meshio::OutputSolnRegion::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    OutputSoln::verifyConfiguration(solution);
+
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+    PetscErrorCode err = PETSC_SUCCESS;
+    if (!_labelName.empty()) {
+        PetscBool hasLabel = PETSC_FALSE;
+        err = DMHasLabel(dmSoln, _labelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+        if (!hasLabel) {
+            std::ostringstream msg;
+            msg << "Mesh missing group of points '" << _labelName << "' for output using solution region observer '"
+                << PyreComponent::getIdentifier() << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmSoln, &spaceDim);PYLITH_CHECK_ERROR(err);
+    if ((_bbox.size() > 0) && (_bbox.size() != size_t(2*spaceDim))) {
+        std::ostringstream msg;
+        msg << "Bounding box for solution region observer '" << PyreComponent::getIdentifier() << "' has "
+            << _bbox.size() << " values but mesh has spatial dimension " << spaceDim << ".";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Write data for step in solution.
+void
+pylith::meshio::OutputSolnRegion::_writeSolnStep(const PylithReal t,
+                                                 const PylithInt tindex,
+                                                 const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_writeSolnStep(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    if (!_regionMesh) {
+        _createRegionMesh(solution.getMesh());assert(_regionMesh);
+    } // if
+
+    const pylith::string_vector& subfieldNames = OutputSoln::_getOutputSubfieldNames(solution);
+    PetscVec solutionVector = solution.getOutputVector();assert(solutionVector);
+
+    _openSolnStep(t, *_regionMesh);
+    const size_t numSubfieldNames = subfieldNames.size();
+    for (size_t iField = 0; iField < numSubfieldNames; iField++) {
+        assert(solution.hasSubfield(subfieldNames[iField].c_str()));
+
+        OutputSubfield* subfield = NULL;
+        subfield = OutputObserver::_getSubfield(solution, *_regionMesh, subfieldNames[iField].c_str());assert(subfield);
+        subfield->project(solutionVector);
+
+        OutputObserver::_appendField(t, *subfield);
+    } // for
+    _closeSolnStep();
+
+    PYLITH_METHOD_END;
+} // _writeSolnStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh of cells in region.
+void
+pylith::meshio::OutputSolnRegion::_createRegionMesh(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_createRegionMesh(mesh="<<mesh.getDM()<<")");
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dmDomain = mesh.getDM();assert(dmDomain);
+
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmDomain, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmDomain, &spaceDim);PYLITH_CHECK_ERROR(err);
+    const bool hasBoundingBox = _bbox.size() == size_t(2*spaceDim);
+
+    PetscDMLabel dmLabelRegion = NULL;
+    const PylithInt regionValue = 1;
+    err = DMLabelCreate(PETSC_COMM_SELF, "output_region", &dmLabelRegion);PYLITH_CHECK_ERROR(err);
+
+    // Mark cells with label value and centroids inside bounding box, keeping every k-th cell.
+    PylithInt numCellsRegion = 0;
+    PylithInt numCellsMarked = 0;
+    PylithReal centroid[3];
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        if (pylith::topology::MeshOps::isCohesiveCell(dmDomain, cell)) { continue; }
+        if (!_labelName.empty()) {
+            PetscInt value = 0;
+            err = DMGetLabelValue(dmDomain, _labelName.c_str(), cell, &value);PYLITH_CHECK_ERROR(err);
+            if (value != _labelValue) { continue; }
+        } // if
+        if (hasBoundingBox) {
+            err = DMPlexComputeCellGeometryFVM(dmDomain, cell, NULL, centroid, NULL);PYLITH_CHECK_ERROR(err);
+            bool isInside = true;
+            for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+                if ((centroid[iDim] < _bbox[2*iDim]) || (centroid[iDim] > _bbox[2*iDim+1])) {
+                    isInside = false;
+                    break;
+                } // if
+            } // for
+            if (!isInside) { continue; }
+        } // if
+        if (0 == numCellsRegion++ % _decimation) {
+            err = DMLabelSetValue(dmLabelRegion, cell, regionValue);PYLITH_CHECK_ERROR(err);
+            ++numCellsMarked;
+        } // if
+    } // for
+
+    PylithInt numCellsMarkedGlobal = 0;
+    err = MPI_Allreduce(&numCellsMarked, &numCellsMarkedGlobal, 1, MPIU_INT, MPI_SUM,
+                        PetscObjectComm((PetscObject) dmDomain));PYLITH_CHECK_ERROR(err);
+    if (!numCellsMarkedGlobal) {
+        err = DMLabelDestroy(&dmLabelRegion);PYLITH_CHECK_ERROR(err);
+        std::ostringstream msg;
+        msg << "Region of interest for solution observer '" << PyreComponent::getIdentifier()
+            << "' does not contain any cells. Check the bounding box and label.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PetscDM dmRegion = NULL;
+    err = DMPlexFilter(dmDomain, dmLabelRegion, regionValue, &dmRegion);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDestroy(&dmLabelRegion);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) dmRegion, "region");PYLITH_CHECK_ERROR(err);
+
+    PylithScalar lengthScale = 1.0;
+    err = DMPlexGetScale(dmDomain, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+    err = DMPlexSetScale(dmRegion, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+
+    delete _regionMesh;_regionMesh = new pylith::topology::Mesh();assert(_regionMesh);
+    _regionMesh->setCoordSys(mesh.getCoordSys());
+    _regionMesh->setDM(dmRegion);
+
+    PYLITH_COMPONENT_INFO("Region of interest for output contains "<<numCellsMarkedGlobal<<" cells.");
+
+    PYLITH_METHOD_END;
+} // _createRegionMesh
+
+
+// End of file
@@ -0,0 +1,128 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/OutputSolnRegion.hh
+ *
+ * @brief C++ object for managing solution output over a region of interest.
+ *
+ * The region contains the cells with centroids inside a bounding box and, optionally, with a given label value
+ * (e.g., material id). The cells in the region can be decimated by keeping every k-th cell.
+ */
+
+#if !defined(pylith_meshio_outputsolnregion_hh)
+#define pylith_meshio_outputsolnregion_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/meshio/OutputSoln.hh" // ISA OutputSoln
+
+#include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh
+#include "pylith/utils/array.hh" // HASA scalar_array
+
+#include <string> // HASA std::string
+
+class pylith::meshio::OutputSolnRegion : public pylith::meshio::OutputSoln {
+    friend class TestOutputSolnRegion; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    OutputSolnRegion(void);
+
+    /// Destructor
+    ~OutputSolnRegion(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set name of label identifier restricting cells in region.
+     *
+     * @param[in] value Name of label for cells (empty for all cells).
+     */
+    void setLabelName(const char* value);
+
+    /** Set value of label identifier restricting cells in region.
+     *
+     * @param[in] value Value of label for cells.
+     */
+    void setLabelValue(const int value);
+
+    /** Set bounding box of region.
+     *
+     * @param[in] bbox Array of bounds [xmin, xmax, ymin, ymax, (zmin, zmax)] (nondimensional).
+     * @param[in] size Size of array (0 for no bounding box).
+     */
+    void setBoundingBox(const PylithReal* bbox,
+                        const int size);
+
+    /** Set decimation of cells in region.
+     *
+     * @param[in] value Keep every k-th cell in region (1 for all cells).
+     */
+    void setDecimation(const int value);
+
+    /** Verify configuration.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Write solution at time step.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void _writeSolnStep(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Create mesh of cells in region.
+     *
+     * @param[in] mesh Mesh for domain.
+     */
+    void _createRegionMesh(const pylith::topology::Mesh& mesh);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::topology::Mesh* _regionMesh; ///< Mesh of region.
+    pylith::scalar_array _bbox; ///< Bounding box of region.
+    std::string _labelName; ///< Name of label for cells in region.
+    int _labelValue; ///< Value of label for cells in region.
+    int _decimation; ///< Keep every k-th cell in region.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputSolnRegion(const OutputSolnRegion&); ///< Not implemented.
+    const OutputSolnRegion& operator=(const OutputSolnRegion&); ///< Not implemented
+
+}; // OutputSolnRegion
+
+#endif // pylith_meshio_outputsolnregion_hh
+
+// End of file
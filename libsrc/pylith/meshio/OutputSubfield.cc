@@ -26,9 +26,12 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/fekernels/Solution.hh" // USES Solution::passThruSubfield
 
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 
 #include <typeinfo> // USES typeid()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
 
 // ------------------------------------------------------------------------------------------------
 // Constructor
@@ -36,8 +39,15 @@ pylith::meshio::OutputSubfield::OutputSubfield(void) :
     _dm(NULL),
     _vector(NULL),
     _fn(pylith::fekernels::Solution::passThruSubfield),
+    _subfieldIndex(0),
+    _subfieldIS(NULL),
     _label(NULL),
-    _labelValue(0) {}
+    _labelValue(0),
+    _cache(NULL),
+    _meshId(0),
+    _fieldMeshId(0),
+    _canRestrict(-1),
+    _isPooled(false) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -54,8 +64,11 @@ pylith::meshio::OutputSubfield::deallocate(void) {
     PetscErrorCode err;
     err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_vector);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_subfieldIS);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::release(this);
 
     _label = NULL; // Destroyed by DMDestroy()
+    _cache = NULL; // Memory managed by observers.
 } // deallocate
 
 
@@ -79,6 +92,45 @@ pylith::meshio::OutputSubfield::create(const pylith::topology::Field& field,
     subfield->_discretization.basisOrder = std::min(basisOrder, info.fe.basisOrder);
 
     PetscErrorCode err;
+    if (pylith::topology::FieldBase::POINT_SPACE == info.fe.feSpace) {
+        // Values are at the quadrature points, so output the average over each cell.
+        PetscInt fieldStart = 0, fieldEnd = 0, meshStart = 0, meshEnd = 0;
+        err = DMPlexGetChart(field.getDM(), &fieldStart, &fieldEnd);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetChart(mesh.getDM(), &meshStart, &meshEnd);PYLITH_CHECK_ERROR(err);
+        if ((fieldStart != meshStart) || (fieldEnd != meshEnd)) {
+            std::ostringstream msg;
+            msg << "Cannot output subfield '" << name << "' with values at quadrature points (point finite-element "
+                << "space) on a submesh. Output it only over the domain of the physics.";
+            throw std::runtime_error(msg.str());
+        } // if
+        subfield->_discretization.feSpace = pylith::topology::FieldBase::POLYNOMIAL_SPACE;
+        subfield->_discretization.basisOrder = 0;
+        subfield->_discretization.isBasisContinuous = false;
+
+        PetscObject fieldFE = NULL;
+        PetscQuadrature quadrature = NULL;
+        PetscInt numPoints = 0;
+        const PetscReal* weights = NULL;
+        err = DMGetField(field.getDM(), info.index, NULL, &fieldFE);PYLITH_CHECK_ERROR(err);
+        err = PetscFEGetQuadrature((PetscFE) fieldFE, &quadrature);PYLITH_CHECK_ERROR(err);
+        err = PetscQuadratureGetData(quadrature, NULL, NULL, &numPoints, NULL, &weights);PYLITH_CHECK_ERROR(err);
+        PylithReal volume = 0.0;
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            volume += weights[iPoint];
+        } // for
+        subfield->_cellWeights.resize(numPoints);
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            subfield->_cellWeights[iPoint] = weights[iPoint] / volume;
+        } // for
+    } // if
+
+    err = PetscObjectGetId((PetscObject)mesh.getDM(), &subfield->_meshId);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectGetId((PetscObject)field.getDM(), &subfield->_fieldMeshId);PYLITH_CHECK_ERROR(err);
+    subfield->_layout.name = name;
+    subfield->_layout.meshId = subfield->_meshId;
+    subfield->_layout.numComponents = info.description.numComponents;
+    subfield->_layout.discretization = subfield->_discretization;
+    subfield->_isPooled = true;
     err = DMClone(mesh.getDM(), &subfield->_dm);PYLITH_CHECK_ERROR(err);
     err = PetscObjectSetName((PetscObject)subfield->_dm, name);PYLITH_CHECK_ERROR(err);
 
@@ -92,6 +144,28 @@ pylith::meshio::OutputSubfield::create(const pylith::topology::Field& field,
 
     err = DMCreateGlobalVector(subfield->_dm, &subfield->_vector);PYLITH_CHECK_ERROR(err);
     err = PetscObjectSetName((PetscObject)subfield->_vector, name);PYLITH_CHECK_ERROR(err);
+    PetscInt bufferSize = 0;
+    err = VecGetLocalSize(subfield->_vector, &bufferSize);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::record(subfield, "output buffers", name, bufferSize * sizeof(PetscScalar));
+
+    // Projection is an identity operation if the discretization is unchanged, so we can copy values from the output
+    // vector of the field instead of traversing the mesh and tabulating the basis functions.
+    const bool sameDimension = (info.fe.dimension < 0) || (info.fe.dimension == mesh.getDimension());
+    if ((field.getDM() == mesh.getDM()) && sameDimension && (info.fe.basisOrder == subfield->_discretization.basisOrder) &&
+        subfield->_cellWeights.empty()) {
+        PetscDM dmOutput = NULL;
+        err = DMGetOutputDM(field.getDM(), &dmOutput);PYLITH_CHECK_ERROR(err);
+        PetscInt fieldIndex = info.index;
+        err = DMCreateSubDM(dmOutput, 1, &fieldIndex, &subfield->_subfieldIS, NULL);PYLITH_CHECK_ERROR(err);
+
+        PetscInt subfieldSize = 0, vectorSize = 0;
+        err = ISGetLocalSize(subfield->_subfieldIS, &subfieldSize);PYLITH_CHECK_ERROR(err);
+        err = VecGetLocalSize(subfield->_vector, &vectorSize);PYLITH_CHECK_ERROR(err);
+        if (subfieldSize != vectorSize) {
+            // Subfield is not defined over entire mesh, so layouts differ.
+            err = ISDestroy(&subfield->_subfieldIS);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // if
 
     PYLITH_METHOD_RETURN(subfield);
 }
@@ -131,6 +205,9 @@ pylith::meshio::OutputSubfield::create(const pylith::topology::Field& field,
     err = PetscSectionDestroy(&subfieldSection);PYLITH_CHECK_ERROR(err);
     err = DMCreateGlobalVector(subfield->_dm, &subfield->_vector);PYLITH_CHECK_ERROR(err);
     err = PetscObjectSetName((PetscObject)subfield->_vector, name);PYLITH_CHECK_ERROR(err);
+    PetscInt bufferSize = 0;
+    err = VecGetLocalSize(subfield->_vector, &bufferSize);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::record(subfield, "output buffers", name, bufferSize * sizeof(PetscScalar));
 
     PYLITH_METHOD_RETURN(subfield);
 }
@@ -150,12 +227,60 @@ pylith::meshio::OutputSubfield::setLabel(const char* name,
     err = DMGetLabel(_dm, name, &_label);PYLITH_CHECK_ERROR(err);
     err = DMPlexLabelComplete(_dm, _label);
 
+    _labelName = name;
     _labelValue = value;
 
     PYLITH_METHOD_END;
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Set cache for sharing projections with other observers.
+void
+pylith::meshio::OutputSubfield::setCache(pylith::meshio::OutputSubfieldCache* cache) {
+    PYLITH_METHOD_BEGIN;
+
+    if (cache == _cache) {
+        PYLITH_METHOD_END;
+    } // if
+    releaseVector();
+    _cache = cache;
+    if (!_isPooled || !_cache) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Share DM with other subfields with the same layout.
+    PetscErrorCode err;
+    PetscDM pooledDM = _cache->getDM(_layout);
+    if (!pooledDM) {
+        _cache->putDM(_layout, _dm);
+    } else if (pooledDM != _dm) {
+        err = PetscObjectReference((PetscObject)pooledDM);PYLITH_CHECK_ERROR(err);
+        err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+        _dm = pooledDM;
+        if (_label) {
+            err = DMGetLabel(_dm, _labelName.c_str(), &_label);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // if/else
+
+    // Vector is obtained from the pool when projecting.
+    err = VecDestroy(&_vector);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::release(this);
+
+    PYLITH_METHOD_END;
+} // setCache
+
+
+// ------------------------------------------------------------------------------------------------
+// Return output vector to the pool of output buffers.
+void
+pylith::meshio::OutputSubfield::releaseVector(void) {
+    if (_isPooled && _cache) {
+        PetscErrorCode err = VecDestroy(&_vector);PYLITH_CHECK_ERROR(err);
+    } // if
+} // releaseVector
+
+
 // ------------------------------------------------------------------------------------------------
 // Get description of subfield.
 const pylith::topology::FieldBase::Description&
@@ -194,14 +319,28 @@ void
 pylith::meshio::OutputSubfield::project(const PetscVec& fieldVector) {
     PYLITH_METHOD_BEGIN;
     assert(fieldVector);
+    _getVector();
     assert(_vector);
 
-    PetscErrorCode err;
-    const PetscReal t = PetscReal(_subfieldIndex) + 0.01; // :KLUDGE: Easiest way to get subfield to extract into fn.
+    if (_cache && (_copyFromCache(fieldVector, false) || _restrictFromCache(fieldVector))) {
+        PYLITH_METHOD_END;
+    } // if
 
-    err = DMProjectField(_dm, t, fieldVector, &_fn, INSERT_VALUES, _vector);PYLITH_CHECK_ERROR(err);
+    PetscErrorCode err;
+    if (!_cellWeights.empty()) {
+        _averageCells(fieldVector);
+    } else if (_subfieldIS) {
+        err = VecISCopy(fieldVector, _subfieldIS, SCATTER_REVERSE, _vector);PYLITH_CHECK_ERROR(err);
+    } else {
+        const PetscReal t = PetscReal(_subfieldIndex) + 0.01; // :KLUDGE: Easiest way to get subfield to extract into fn.
+        err = DMProjectField(_dm, t, fieldVector, &_fn, INSERT_VALUES, _vector);PYLITH_CHECK_ERROR(err);
+    } // if/else
     err = VecScale(_vector, _description.scale);PYLITH_CHECK_ERROR(err);
 
+    if (_cache) {
+        _addToCache(fieldVector, false);
+    } // if
+
     PYLITH_METHOD_END;
 }
 
@@ -212,8 +351,16 @@ void
 pylith::meshio::OutputSubfield::projectWithLabel(const PetscVec& fieldVector) {
     PYLITH_METHOD_BEGIN;
     assert(fieldVector);
+    _getVector();
     assert(_vector);
     assert(_label);
+    if (!_cellWeights.empty()) {
+        throw std::logic_error("Projection with label not implemented for subfields with values at quadrature points.");
+    } // if
+
+    if (_cache && _copyFromCache(fieldVector, true)) {
+        PYLITH_METHOD_END;
+    } // if
 
     PetscErrorCode err;
     const PetscReal t = PetscReal(_subfieldIndex) + 0.01; // :KLUDGE: Easiest way to get subfield to extract into fn.
@@ -221,6 +368,10 @@ pylith::meshio::OutputSubfield::projectWithLabel(const PetscVec& fieldVector) {
     err = DMProjectFieldLabel(_dm, t, _label, 1, &_labelValue, PETSC_DETERMINE, NULL, fieldVector, &_fn, INSERT_VALUES, _vector);PYLITH_CHECK_ERROR(err);
     err = VecScale(_vector, _description.scale);PYLITH_CHECK_ERROR(err);
 
+    if (_cache) {
+        _addToCache(fieldVector, true);
+    } // if
+
     PYLITH_METHOD_END;
 }
 
@@ -238,6 +389,7 @@ pylith::meshio::OutputSubfield::extractSubfield(const pylith::topology::Field& f
     err = PetscSectionGetField(field.getLocalSection(), subfieldIndex, &subfieldSection);PYLITH_CHECK_ERROR(err);
     err = PetscSectionGetStorageSize(subfieldSection, &storageSize);PYLITH_CHECK_ERROR(err);
 
+    _getVector();
     PetscVec subfieldVector = this->getVector();
     PetscInt subfieldSize = 0;
     err = VecGetLocalSize(subfieldVector, &subfieldSize);PYLITH_CHECK_ERROR(err);
@@ -267,4 +419,243 @@ pylith::meshio::OutputSubfield::extractSubfield(const pylith::topology::Field& f
 } // extractSubfield
 
 
+// ------------------------------------------------------------------------------------------------
+// Get output vector from pool (or create it without a pool) if the subfield does not have one.
+void
+pylith::meshio::OutputSubfield::_getVector(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_vector) {
+        PYLITH_METHOD_END;
+    } // if
+
+    if (_isPooled && _cache) {
+        _vector = _cache->getVector(_layout);
+    } else {
+        PetscErrorCode err;
+        err = DMCreateGlobalVector(_dm, &_vector);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectSetName((PetscObject)_vector, _layout.name.c_str());PYLITH_CHECK_ERROR(err);
+        PetscInt bufferSize = 0;
+        err = VecGetLocalSize(_vector, &bufferSize);PYLITH_CHECK_ERROR(err);
+        pylith::utils::MemoryLogger::record(this, "output buffers", _layout.name.c_str(), bufferSize * sizeof(PetscScalar));
+    } // if/else
+    assert(_vector);
+
+    PYLITH_METHOD_END;
+} // _getVector
+
+
+// ------------------------------------------------------------------------------------------------
+// Get key for subfield in cache.
+pylith::meshio::OutputSubfieldCache::Key
+pylith::meshio::OutputSubfield::_getCacheKey(const PetscObjectId meshId,
+                                             const bool withLabel) const {
+    OutputSubfieldCache::Key key;
+    key.name = _description.label;
+    key.basisOrder = _discretization.basisOrder;
+    key.meshId = meshId;
+    key.labelName = withLabel ? _labelName : "";
+    key.labelValue = withLabel ? _labelValue : 0;
+    return key;
+} // _getCacheKey
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy projected subfield from cache.
+bool
+pylith::meshio::OutputSubfield::_copyFromCache(const PetscVec& fieldVector,
+                                               const bool withLabel) {
+    PYLITH_METHOD_BEGIN;
+    assert(_cache);
+
+    PetscDM cachedDM = NULL;
+    PetscVec cachedVector = NULL;
+    if (!_cache->get(_getCacheKey(_meshId, withLabel), fieldVector, &cachedDM, &cachedVector)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    if (cachedVector == _vector) {
+        PYLITH_METHOD_RETURN(true);
+    } // if
+
+    // Same mesh, subfield, and basis order, so the layouts match.
+    PetscErrorCode err;
+    err = VecCopy(cachedVector, _vector);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(true);
+} // _copyFromCache
+
+
+// ------------------------------------------------------------------------------------------------
+// Add projected subfield to cache.
+void
+pylith::meshio::OutputSubfield::_addToCache(const PetscVec& fieldVector,
+                                            const bool withLabel) {
+    PYLITH_METHOD_BEGIN;
+    assert(_cache);
+
+    _cache->put(_getCacheKey(_meshId, withLabel), fieldVector, _dm, _vector);
+
+    PYLITH_METHOD_END;
+} // _addToCache
+
+
+// ------------------------------------------------------------------------------------------------
+// Restrict subfield over boundary from cached projection over mesh of field.
+bool
+pylith::meshio::OutputSubfield::_restrictFromCache(const PetscVec& fieldVector) {
+    PYLITH_METHOD_BEGIN;
+    assert(_cache);
+
+    // Values of a subfield with a basis order of 1 live on the vertices, so the values on the boundary are the values at
+    // the corresponding vertices of the mesh.
+    if ((0 == _canRestrict) || (_meshId == _fieldMeshId) || (1 != _discretization.basisOrder)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscDM domainDM = NULL;
+    PetscVec domainVector = NULL;
+    if (!_cache->get(_getCacheKey(_fieldMeshId, false), fieldVector, &domainDM, &domainVector)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscErrorCode err;
+    // The layouts do not change, so the indices are created and all processes need to agree only the first time.
+    if (-1 == _canRestrict) {
+        const bool canRestrict = _createRestrictIndices(domainDM, domainVector);
+        PetscBool canRestrictLocal = canRestrict ? PETSC_TRUE : PETSC_FALSE;
+        PetscBool canRestrictAll = PETSC_FALSE;
+        err = MPIU_Allreduce(&canRestrictLocal, &canRestrictAll, 1, MPIU_BOOL, MPI_LAND, PetscObjectComm((PetscObject)_dm));PYLITH_CHECK_ERROR(err);
+        _canRestrict = canRestrictAll ? 1 : 0;
+        if (!_canRestrict) {
+            _restrictIndices.clear();
+            _restrictDomainIndices.clear();
+            PYLITH_METHOD_RETURN(false);
+        } // if
+    } // if
+
+    const PetscScalar* domainArray = NULL;
+    PetscScalar* array = NULL;
+    err = VecGetArrayRead(domainVector, &domainArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(_vector, &array);PYLITH_CHECK_ERROR(err);
+    const size_t numIndices = _restrictIndices.size();
+    for (size_t i = 0; i < numIndices; ++i) {
+        array[_restrictIndices[i]] = domainArray[_restrictDomainIndices[i]];
+    } // for
+    err = VecRestoreArray(_vector, &array);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(domainVector, &domainArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(1 == _canRestrict);
+} // _restrictFromCache
+
+
+// ------------------------------------------------------------------------------------------------
+// Create indices for restricting subfield over boundary from projection over mesh of field.
+bool
+pylith::meshio::OutputSubfield::_createRestrictIndices(PetscDM domainDM,
+                                                       PetscVec domainVector) {
+    PYLITH_METHOD_BEGIN;
+
+    _restrictIndices.clear();
+    _restrictDomainIndices.clear();
+
+    PetscErrorCode err;
+    PetscIS subpointIS = NULL;
+    err = DMPlexGetSubpointIS(_dm, &subpointIS);PYLITH_CHECK_ERROR(err);
+    if (!subpointIS) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscSection section = NULL, domainSection = NULL;
+    err = DMGetGlobalSection(_dm, &section);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(domainDM, &domainSection);PYLITH_CHECK_ERROR(err);
+    PetscInt vStart = 0, vEnd = 0, rStart = 0, domainRStart = 0;
+    err = DMPlexGetDepthStratum(_dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(_vector, &rStart, NULL);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(domainVector, &domainRStart, NULL);PYLITH_CHECK_ERROR(err);
+    PetscInt vectorSize = 0;
+    err = VecGetLocalSize(_vector, &vectorSize);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt* subpoints = NULL;
+    err = ISGetIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+    _restrictIndices.reserve(vectorSize);
+    _restrictDomainIndices.reserve(vectorSize);
+    bool canRestrict = true;
+    for (PetscInt vertex = vStart; vertex < vEnd; ++vertex) {
+        PetscInt numDof = 0, offset = 0;
+        err = PetscSectionGetDof(section, vertex, &numDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(section, vertex, &offset);PYLITH_CHECK_ERROR(err);
+        if ((numDof <= 0) || (offset < 0)) {
+            continue; // Vertex is not owned by this process.
+        } // if
+        PetscInt domainNumDof = 0, domainOffset = 0;
+        err = PetscSectionGetDof(domainSection, subpoints[vertex], &domainNumDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(domainSection, subpoints[vertex], &domainOffset);PYLITH_CHECK_ERROR(err);
+        if ((domainNumDof != numDof) || (domainOffset < 0)) {
+            canRestrict = false;
+            break;
+        } // if
+        for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+            _restrictIndices.push_back(offset-rStart+iDof);
+            _restrictDomainIndices.push_back(domainOffset-domainRStart+iDof);
+        } // for
+    } // for
+    err = ISRestoreIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(canRestrict && (PetscInt(_restrictIndices.size()) == vectorSize));
+} // _createRestrictIndices
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute average of subfield with values at quadrature points (point space) over each cell.
+void
+pylith::meshio::OutputSubfield::_averageCells(const PetscVec& fieldVector) {
+    PYLITH_METHOD_BEGIN;
+    assert(!_cellWeights.empty());
+
+    PetscErrorCode err;
+    PetscDM fieldDM = NULL;
+    err = VecGetDM(fieldVector, &fieldDM);PYLITH_CHECK_ERROR(err);assert(fieldDM);
+    PetscSection fieldSection = NULL, section = NULL;
+    err = DMGetGlobalSection(fieldDM, &fieldSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(_dm, &section);PYLITH_CHECK_ERROR(err);
+    PetscInt cStart = 0, cEnd = 0, fieldRStart = 0, rStart = 0;
+    err = DMPlexGetHeightStratum(_dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(fieldVector, &fieldRStart, NULL);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(_vector, &rStart, NULL);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt numComponents = _description.numComponents;
+    const size_t numPoints = _cellWeights.size();
+    const PetscScalar* fieldArray = NULL;
+    PetscScalar* subfieldArray = NULL;
+    err = VecGetArrayRead(fieldVector, &fieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(_vector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt numDof = 0, offset = 0, fieldNumDof = 0, fieldOffset = 0;
+        err = PetscSectionGetDof(section, cell, &numDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(section, cell, &offset);PYLITH_CHECK_ERROR(err);
+        if ((numDof <= 0) || (offset < 0)) { continue; } // not owned
+        err = PetscSectionGetFieldDof(fieldSection, cell, _subfieldIndex, &fieldNumDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldOffset(fieldSection, cell, _subfieldIndex, &fieldOffset);PYLITH_CHECK_ERROR(err);
+
+        PetscScalar* cellValues = &subfieldArray[offset-rStart];
+        for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+            cellValues[iComponent] = 0.0;
+        } // for
+        if (fieldNumDof != PetscInt(numPoints)*numComponents) { continue; } // subfield not defined over cell
+
+        // Components vary fastest at each quadrature point.
+        const PetscScalar* fieldValues = &fieldArray[fieldOffset-fieldRStart];
+        for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+            for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                cellValues[iComponent] += _cellWeights[iPoint] * fieldValues[iPoint*numComponents+iComponent];
+            } // for
+        } // for
+    } // for
+    err = VecRestoreArray(_vector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(fieldVector, &fieldArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _averageCells
+
+
 // End of file
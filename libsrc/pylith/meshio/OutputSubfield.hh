@@ -30,9 +30,14 @@
 #include "pylith/utils/GenericComponent.hh" // ISA PyreComponent
 
 #include "pylith/topology/FieldBase.hh" // HASA Description, Discretization
+#include "pylith/meshio/OutputSubfieldCache.hh" // USES OutputSubfieldCache::Key
 
 #include "pylith/topology/topologyfwd.hh" // USES Field
 #include "pylith/utils/petscfwd.h" // HASA PetscVec
+#include "pylith/utils/types.hh" // HASA PetscObjectId
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
 
 class pylith::meshio::OutputSubfield : public pylith::utils::GenericComponent {
     friend class TestOutputSubfield; // unit testing
@@ -80,6 +85,22 @@ public:
     void setLabel(const char* name,
                   const int value);
 
+    /** Set cache for sharing projections with other observers.
+     *
+     * With a cache, subfields created for projection share the PETSc DM with other subfields with the same layout
+     * and get their output vector from the pool in the cache when projecting (see releaseVector()).
+     *
+     * @param[in] cache Cache of projected subfields (NULL to project without cache).
+     */
+    void setCache(pylith::meshio::OutputSubfieldCache* cache);
+
+    /** Return output vector to the pool of output buffers.
+     *
+     * Call this after the projected subfield has been written. The vector returns to the pool only for subfields
+     * created for projection with a cache; other subfields keep their vector.
+     */
+    void releaseVector(void);
+
     /** Get description of subfield.
      *
      * @returns Description of subfield.
@@ -94,7 +115,7 @@ public:
 
     /** Get PETSc global vector for projected subfield.
      *
-     * @returns PETSc global vector.
+     * @returns PETSc global vector (NULL if a pooled vector has been released since the last projection).
      */
     PetscVec getVector(void) const;
 
@@ -106,7 +127,12 @@ public:
 
     /** Project PETSc vector to subfield.
      *
-     * @param[in] fieldVector PETSc vector with subfields.
+     * If the subfield has the same discretization as the field, the values are copied directly from the field
+     * vector without a projection. With a cache, the values are copied from a projection of the same field vector
+     * by another observer, if available. Subfields with a basis order of 1 over a boundary of the mesh of the field
+     * are restricted from a cached projection over the mesh of the field.
+     *
+     * @param[in] fieldVector PETSc output vector with subfields.
      */
     void project(const PetscVec& fieldVector);
 
@@ -132,6 +158,57 @@ private:
     // Constructor.
     OutputSubfield(void);
 
+    /// Get output vector from pool (or create it without a pool) if the subfield does not have one.
+    void _getVector(void);
+
+    /** Get key for subfield in cache.
+     *
+     * @param[in] meshId Id of PETSc DM of mesh for projected subfield.
+     * @param[in] withLabel True if projection is restricted to label.
+     * @returns Key for cache.
+     */
+    pylith::meshio::OutputSubfieldCache::Key _getCacheKey(const PetscObjectId meshId,
+                                                          const bool withLabel) const;
+
+    /** Copy projected subfield from cache.
+     *
+     * @param[in] fieldVector PETSc vector with subfields.
+     * @param[in] withLabel True if projection is restricted to label.
+     * @returns True if values were copied from cache, false otherwise.
+     */
+    bool _copyFromCache(const PetscVec& fieldVector,
+                        const bool withLabel);
+
+    /** Add projected subfield to cache.
+     *
+     * @param[in] fieldVector PETSc vector with subfields.
+     * @param[in] withLabel True if projection is restricted to label.
+     */
+    void _addToCache(const PetscVec& fieldVector,
+                     const bool withLabel);
+
+    /** Restrict subfield over boundary from cached projection over mesh of field.
+     *
+     * @param[in] fieldVector PETSc vector with subfields.
+     * @returns True if values were restricted from cache, false otherwise.
+     */
+    bool _restrictFromCache(const PetscVec& fieldVector);
+
+    /** Create indices for restricting subfield over boundary from projection over mesh of field.
+     *
+     * @param[in] domainDM PETSc DM of projection over mesh of field.
+     * @param[in] domainVector PETSc vector of projection over mesh of field.
+     * @returns True if all values of subfield on this process can be restricted, false otherwise.
+     */
+    bool _createRestrictIndices(PetscDM domainDM,
+                                PetscVec domainVector);
+
+    /** Compute average of subfield with values at quadrature points (point space) over each cell.
+     *
+     * @param[in] fieldVector PETSc vector with subfields.
+     */
+    void _averageCells(const PetscVec& fieldVector);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -141,10 +218,22 @@ protected:
     PetscVec _vector; ///< PETSc global vector for subfield.
     PetscPointFunc _fn; ///< PETSc point function for projection.
     PetscInt _subfieldIndex; ///< Index of subfield in fields.
+    PetscIS _subfieldIS; ///< Indices of subfield in field output vector (NULL if projection is required).
 
     PetscDMLabel _label; ///< PETSc label associated with subfield.
+    std::string _labelName; ///< Name of PETSc label associated with subfield.
     PetscInt _labelValue; ///< Value of PETSc label associated with subfield.
 
+    OutputSubfieldCache* _cache; ///< Cache of projected subfields shared with other observers.
+    PetscObjectId _meshId; ///< Id of PETSc DM of mesh for subfield.
+    PetscObjectId _fieldMeshId; ///< Id of PETSc DM of mesh for field.
+    int _canRestrict; ///< Restrict from projection over mesh of field (-1=unknown, 0=no, 1=yes).
+    std::vector<PetscInt> _restrictIndices; ///< Indices into local array of subfield for restriction.
+    std::vector<PetscInt> _restrictDomainIndices; ///< Indices into local array of projection over mesh of field.
+    std::vector<PylithReal> _cellWeights; ///< Weights of quadrature points for cell averages of point space subfield.
+    OutputSubfieldCache::Layout _layout; ///< Layout of DM and vector for pooling.
+    bool _isPooled; ///< True if DM and vector can be pooled (subfields created for projection).
+
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -0,0 +1,240 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputSubfieldCache.hh" // Implementation of class methods
+
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+// Compare keys.
+bool
+pylith::meshio::OutputSubfieldCache::Key::operator<(const Key& other) const {
+    if (name != other.name) { return name < other.name; }
+    if (basisOrder != other.basisOrder) { return basisOrder < other.basisOrder; }
+    if (meshId != other.meshId) { return meshId < other.meshId; }
+    if (labelName != other.labelName) { return labelName < other.labelName; }
+    return labelValue < other.labelValue;
+} // operator<
+
+
+// ------------------------------------------------------------------------------------------------
+// Compare layouts.
+bool
+pylith::meshio::OutputSubfieldCache::Layout::operator<(const Layout& other) const {
+    if (name != other.name) { return name < other.name; }
+    if (meshId != other.meshId) { return meshId < other.meshId; }
+    if (numComponents != other.numComponents) { return numComponents < other.numComponents; }
+
+    const pylith::topology::FieldBase::Discretization& a = discretization;
+    const pylith::topology::FieldBase::Discretization& b = other.discretization;
+    if (a.basisOrder != b.basisOrder) { return a.basisOrder < b.basisOrder; }
+    if (a.quadOrder != b.quadOrder) { return a.quadOrder < b.quadOrder; }
+    if (a.dimension != b.dimension) { return a.dimension < b.dimension; }
+    if (a.isFaultOnly != b.isFaultOnly) { return a.isFaultOnly < b.isFaultOnly; }
+    if (a.cellBasis != b.cellBasis) { return a.cellBasis < b.cellBasis; }
+    if (a.feSpace != b.feSpace) { return a.feSpace < b.feSpace; }
+    return a.isBasisContinuous < b.isBasisContinuous;
+} // operator<
+
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputSubfieldCache::OutputSubfieldCache(void) {
+    GenericComponent::setName("outputsubfieldcache");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputSubfieldCache::~OutputSubfieldCache(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputSubfieldCache::deallocate(void) {
+    PetscErrorCode err;
+    for (std::map<Key, Entry>::iterator iter = _entries.begin(); iter != _entries.end(); ++iter) {
+        err = DMDestroy(&iter->second.dm);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&iter->second.vector);PYLITH_CHECK_ERROR(err);
+    } // for
+    _entries.clear();
+
+    for (std::map<Layout, Buffers>::iterator iter = _buffers.begin(); iter != _buffers.end(); ++iter) {
+        std::vector<PetscVec>& vectors = iter->second.vectors;
+        for (size_t i = 0; i < vectors.size(); ++i) {
+            pylith::utils::MemoryLogger::release(vectors[i]);
+            err = VecDestroy(&vectors[i]);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = DMDestroy(&iter->second.dm);PYLITH_CHECK_ERROR(err);
+    } // for
+    _buffers.clear();
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Get projected subfield.
+bool
+pylith::meshio::OutputSubfieldCache::get(const Key& key,
+                                         PetscVec fieldVector,
+                                         PetscDM* dm,
+                                         PetscVec* vector) const {
+    PYLITH_METHOD_BEGIN;
+    assert(fieldVector);
+    assert(dm);
+    assert(vector);
+
+    const std::map<Key, Entry>::const_iterator iter = _entries.find(key);
+    if (iter == _entries.end()) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    const Entry& entry = iter->second;
+
+    PetscErrorCode err;
+    PetscObjectId fieldId = 0;
+    PetscObjectState fieldState = 0, vectorState = 0;
+    err = PetscObjectGetId((PetscObject)fieldVector, &fieldId);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)fieldVector, &fieldState);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)entry.vector, &vectorState);PYLITH_CHECK_ERROR(err);
+    if ((fieldId != entry.fieldId) || (fieldState != entry.fieldState) || (vectorState != entry.vectorState)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    *dm = entry.dm;
+    *vector = entry.vector;
+
+    PYLITH_METHOD_RETURN(true);
+} // get
+
+
+// ------------------------------------------------------------------------------------------------
+// Add projected subfield to cache.
+void
+pylith::meshio::OutputSubfieldCache::put(const Key& key,
+                                         PetscVec fieldVector,
+                                         PetscDM dm,
+                                         PetscVec vector) {
+    PYLITH_METHOD_BEGIN;
+    assert(fieldVector);
+    assert(dm);
+    assert(vector);
+
+    PetscErrorCode err;
+    Entry& entry = _entries[key];
+    if (entry.vector != vector) {
+        // Hold references, so entry remains valid if the subfield that did the projection is destroyed.
+        err = PetscObjectReference((PetscObject)dm);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectReference((PetscObject)vector);PYLITH_CHECK_ERROR(err);
+        err = DMDestroy(&entry.dm);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&entry.vector);PYLITH_CHECK_ERROR(err);
+        entry.dm = dm;
+        entry.vector = vector;
+    } // if
+    err = PetscObjectGetId((PetscObject)fieldVector, &entry.fieldId);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)fieldVector, &entry.fieldState);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)vector, &entry.vectorState);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // put
+
+
+// ------------------------------------------------------------------------------------------------
+// Get PETSc DM with layout from pool.
+PetscDM
+pylith::meshio::OutputSubfieldCache::getDM(const Layout& layout) const {
+    const std::map<Layout, Buffers>::const_iterator iter = _buffers.find(layout);
+    return (iter != _buffers.end()) ? iter->second.dm : NULL;
+} // getDM
+
+
+// ------------------------------------------------------------------------------------------------
+// Add PETSc DM with layout to pool.
+void
+pylith::meshio::OutputSubfieldCache::putDM(const Layout& layout,
+                                           PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(dm);
+
+    Buffers& buffers = _buffers[layout];
+    if (buffers.dm != dm) {
+        assert(!buffers.dm);
+        PetscErrorCode err = PetscObjectReference((PetscObject)dm);PYLITH_CHECK_ERROR(err);
+        buffers.dm = dm;
+    } // if
+
+    PYLITH_METHOD_END;
+} // putDM
+
+
+// ------------------------------------------------------------------------------------------------
+// Get PETSc global vector with layout that is not in use, creating one if necessary.
+PetscVec
+pylith::meshio::OutputSubfieldCache::getVector(const Layout& layout) {
+    PYLITH_METHOD_BEGIN;
+
+    std::map<Layout, Buffers>::iterator iter = _buffers.find(layout);
+    assert(iter != _buffers.end());
+    Buffers& buffers = iter->second;
+    assert(buffers.dm);
+
+    PetscErrorCode err;
+    PetscVec vector = NULL;
+    for (size_t i = 0; i < buffers.vectors.size(); ++i) {
+        PetscInt numReferences = 0;
+        err = PetscObjectGetReference((PetscObject)buffers.vectors[i], &numReferences);PYLITH_CHECK_ERROR(err);
+        if (numReferences == 1 + _numProjections(buffers.vectors[i])) {
+            vector = buffers.vectors[i];
+            break;
+        } // if
+    } // for
+    if (!vector) {
+        err = DMCreateGlobalVector(buffers.dm, &vector);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectSetName((PetscObject)vector, layout.name.c_str());PYLITH_CHECK_ERROR(err);
+        PetscInt bufferSize = 0;
+        err = VecGetLocalSize(vector, &bufferSize);PYLITH_CHECK_ERROR(err);
+        pylith::utils::MemoryLogger::record(vector, "output buffers", layout.name.c_str(), bufferSize * sizeof(PetscScalar));
+        buffers.vectors.push_back(vector);
+    } // if
+    err = PetscObjectReference((PetscObject)vector);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(vector);
+} // getVector
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of projections in the cache that hold a reference to the vector.
+PetscInt
+pylith::meshio::OutputSubfieldCache::_numProjections(PetscVec vector) const {
+    PetscInt count = 0;
+    for (std::map<Key, Entry>::const_iterator iter = _entries.begin(); iter != _entries.end(); ++iter) {
+        if (iter->second.vector == vector) {
+            ++count;
+        } // if
+    } // for
+    return count;
+} // _numProjections
+
+
+// End of file
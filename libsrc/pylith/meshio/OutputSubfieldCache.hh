@@ -0,0 +1,200 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/OutputSubfieldCache.hh
+ *
+ * @brief Cache of subfields projected for output, shared by the observers of a subject.
+ *
+ * Observers that output the same subfield with the same basis order over the same mesh (and label) at the same
+ * time step reuse the projection of the first observer instead of projecting again. Entries hold references to the
+ * PETSc DM and vector of the subfield that did the projection and are valid as long as neither the vector with the
+ * subfields nor the projected vector has changed since the projection.
+ *
+ * The cache also pools the PETSc DMs and output vectors of the subfields by layout. Subfields with the same layout
+ * share a single DM, and they get a vector from the pool only while they project and write a time step, so the
+ * memory for output vectors scales with the number of vectors in use at the same time rather than with the number of
+ * output subfields.
+ */
+
+#if !defined(pylith_meshio_outputsubfieldcache_hh)
+#define pylith_meshio_outputsubfieldcache_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/topology/FieldBase.hh" // HASA Discretization
+#include "pylith/utils/petscfwd.h" // USES PetscVec, PetscDM
+#include "pylith/utils/types.hh" // HASA PetscObjectId, PetscObjectState
+
+#include <map> // HASA std::map
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::meshio::OutputSubfieldCache : public pylith::utils::GenericComponent {
+    friend class TestOutputSubfieldCache; // unit testing
+
+    // PUBLIC STRUCTS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Key identifying projection of a subfield.
+    struct Key {
+        std::string name; ///< Name of subfield.
+        int basisOrder; ///< Basis order of projected subfield.
+        PetscObjectId meshId; ///< Id of PETSc DM of mesh for projected subfield.
+        std::string labelName; ///< Name of label restricting projection (empty if none).
+        PetscInt labelValue; ///< Value of label restricting projection.
+
+        /** Compare keys.
+         *
+         * @param[in] other Key to compare with.
+         * @returns True if this key is less than other key.
+         */
+        bool operator<(const Key& other) const;
+
+    };
+
+    /// Key identifying layout of the PETSc DM and vector of a subfield.
+    struct Layout {
+        std::string name; ///< Name of subfield.
+        PetscObjectId meshId; ///< Id of PETSc DM of mesh for subfield.
+        int numComponents; ///< Number of components.
+        pylith::topology::FieldBase::Discretization discretization; ///< Discretization of subfield.
+
+        /** Compare layouts.
+         *
+         * @param[in] other Layout to compare with.
+         * @returns True if this layout is less than other layout.
+         */
+        bool operator<(const Layout& other) const;
+
+    };
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    OutputSubfieldCache(void);
+
+    /// Destructor
+    ~OutputSubfieldCache(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Get projected subfield.
+     *
+     * @param[in] key Key identifying projection.
+     * @param[in] fieldVector PETSc vector with subfields that was projected.
+     * @param[out] dm PETSc DM of projected subfield.
+     * @param[out] vector PETSc global vector of projected subfield.
+     * @returns True if cache has a current projection of fieldVector, false otherwise.
+     */
+    bool get(const Key& key,
+             PetscVec fieldVector,
+             PetscDM* dm,
+             PetscVec* vector) const;
+
+    /** Add projected subfield to cache, replacing any previous projection with the same key.
+     *
+     * @param[in] key Key identifying projection.
+     * @param[in] fieldVector PETSc vector with subfields that was projected.
+     * @param[in] dm PETSc DM of projected subfield.
+     * @param[in] vector PETSc global vector of projected subfield.
+     */
+    void put(const Key& key,
+             PetscVec fieldVector,
+             PetscDM dm,
+             PetscVec vector);
+
+    /** Get PETSc DM with layout from pool.
+     *
+     * @param[in] layout Layout of subfield.
+     * @returns PETSc DM (borrowed reference) or NULL if pool does not have a DM with the layout.
+     */
+    PetscDM getDM(const Layout& layout) const;
+
+    /** Add PETSc DM with layout to pool.
+     *
+     * @param[in] layout Layout of subfield.
+     * @param[in] dm PETSc DM for subfield.
+     */
+    void putDM(const Layout& layout,
+               PetscDM dm);
+
+    /** Get PETSc global vector with layout that is not in use, creating one if necessary.
+     *
+     * A vector is in use if anything other than the pool and the projections in the cache hold a reference to it.
+     * The caller gets a new reference that it must destroy when it no longer needs the vector.
+     *
+     * @pre DM with layout must be in pool.
+     *
+     * @param[in] layout Layout of subfield.
+     * @returns PETSc global vector.
+     */
+    PetscVec getVector(const Layout& layout);
+
+    // PRIVATE STRUCTS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Projected subfield and state of vectors at the time of the projection.
+    struct Entry {
+        PetscObjectId fieldId; ///< Id of PETSc vector with subfields.
+        PetscObjectState fieldState; ///< State of PETSc vector with subfields.
+        PetscObjectState vectorState; ///< State of PETSc vector of projected subfield.
+        PetscDM dm; ///< PETSc DM of projected subfield.
+        PetscVec vector; ///< PETSc global vector of projected subfield.
+    };
+
+    /// PETSc DM and vectors for a layout.
+    struct Buffers {
+        PetscDM dm; ///< PETSc DM for layout.
+        std::vector<PetscVec> vectors; ///< PETSc global vectors for layout.
+
+        Buffers(void) : dm(NULL) {}
+
+    };
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Get number of projections in the cache that hold a reference to the vector.
+     *
+     * @param[in] vector PETSc vector.
+     * @returns Number of projections.
+     */
+    PetscInt _numProjections(PetscVec vector) const;
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::map<Key, Entry> _entries; ///< Projected subfields.
+    std::map<Layout, Buffers> _buffers; ///< Pool of PETSc DMs and vectors.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputSubfieldCache(const OutputSubfieldCache&); ///< Not implemented.
+    const OutputSubfieldCache& operator=(const OutputSubfieldCache&); ///< Not implemented
+
+}; // OutputSubfieldCache
+
+#endif // pylith_meshio_outputsubfieldcache_hh
+
+// End of file
@@ -45,4 +45,31 @@ pylith::meshio::OutputTrigger::setTimeScale(const PylithReal value) {
 } // setTimeScale
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether we want to write output at time t given the current solution.
+bool
+pylith::meshio::OutputTrigger::shouldWriteSolution(const PylithReal t,
+                                                   const PylithInt tindex,
+                                                   const pylith::topology::Field& solution) {
+    return shouldWrite(t, tindex);
+} // shouldWriteSolution
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether output may be written at time t without changing the state of the trigger.
+bool
+pylith::meshio::OutputTrigger::willWrite(const PylithReal t,
+                                         const PylithInt tindex) const {
+    return true;
+} // willWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Estimate fraction of time steps with output.
+PylithReal
+pylith::meshio::OutputTrigger::getOutputFraction(void) const {
+    return 1.0;
+} // getOutputFraction
+
+
 // End of file
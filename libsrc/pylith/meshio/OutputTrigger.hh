@@ -29,6 +29,8 @@
 
 #include "pylith/utils/PyreComponent.hh"
 
+#include "pylith/topology/topologyfwd.hh" // USES Field
+
 #include "pylith/utils/types.hh" // USE PylithInt, PylithReal
 
 class pylith::meshio::OutputTrigger : public pylith::utils::PyreComponent {
@@ -59,6 +61,42 @@ public:
     bool shouldWrite(const PylithReal t,
                      const PylithInt tindex) = 0;
 
+    /** Check whether we want to write output at time t given the current solution.
+     *
+     * Default implementation ignores the solution; triggers based on changes in the solution override this method.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if output should be written at time t, false otherwise.
+     */
+    virtual
+    bool shouldWriteSolution(const PylithReal t,
+                             const PylithInt tindex,
+                             const pylith::topology::Field& solution);
+
+    /** Check whether output may be written at time t without changing the state of the trigger.
+     *
+     * Used to skip computing derived fields and scattering the solution to the output vector on time steps without
+     * output. Must be true whenever shouldWriteSolution() would return true. Default implementation returns true.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @returns True if output may be written at time t, false otherwise.
+     */
+    virtual
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex) const;
+
+    /** Estimate fraction of time steps with output.
+     *
+     * Used to estimate the output volume before running a simulation. Default implementation returns 1.
+     *
+     * @returns Fraction of time steps with output.
+     */
+    virtual
+    PylithReal getOutputFraction(void) const;
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -0,0 +1,170 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputTriggerChange.hh" // Implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cassert> // USES assert()
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputTriggerChange::OutputTriggerChange(void) :
+    _tolerance(0.01),
+    _subfieldName(""),
+    _subfieldIS(NULL),
+    _valuesWrote(NULL),
+    _valuesWork(NULL) {
+    PyreComponent::setName("outputtriggerchange");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputTriggerChange::~OutputTriggerChange(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputTriggerChange::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = ISDestroy(&_subfieldIS);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_valuesWrote);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_valuesWork);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set relative change in solution that triggers a write.
+void
+pylith::meshio::OutputTriggerChange::setTolerance(const double value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::setTolerance(value="<<value<<")");
+
+    if (value < 0.0) {
+        std::ostringstream msg;
+        msg << "Relative change in solution (" << value << ") for output trigger '" << PyreComponent::getIdentifier()
+            << "' must be nonnegative.";
+        throw std::invalid_argument(msg.str());
+    } // if
+    _tolerance = value;
+} // setTolerance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get relative change in solution that triggers a write.
+double
+pylith::meshio::OutputTriggerChange::getTolerance(void) const {
+    return _tolerance;
+} // getTolerance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of subfield to monitor.
+void
+pylith::meshio::OutputTriggerChange::setSubfield(const char* value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::setSubfield(value="<<value<<")");
+
+    _subfieldName = value;
+} // setSubfield
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of subfield to monitor.
+const char*
+pylith::meshio::OutputTriggerChange::getSubfield(void) const {
+    return _subfieldName.c_str();
+} // getSubfield
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether we want to write output at time t.
+bool
+pylith::meshio::OutputTriggerChange::shouldWrite(const PylithReal t,
+                                                 const PylithInt timeStep) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::shouldWrite(t="<<t<<", timeStep="<<timeStep<<")");
+
+    return true;
+} // shouldWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether we want to write output at time t given the current solution.
+bool
+pylith::meshio::OutputTriggerChange::shouldWriteSolution(const PylithReal t,
+                                                         const PylithInt timeStep,
+                                                         const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::shouldWriteSolution(t="<<t<<", timeStep="<<timeStep<<", solution="<<solution.getLabel()<<")");
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscVec outputVector = solution.getOutputVector();assert(outputVector);
+    PetscVec values = outputVector;
+    if (!_subfieldName.empty()) {
+        if (!_subfieldIS) {
+            if (!solution.hasSubfield(_subfieldName.c_str())) {
+                std::ostringstream msg;
+                msg << "Could not find subfield '" << _subfieldName << "' in solution '" << solution.getLabel()
+                    << "' for output trigger '" << PyreComponent::getIdentifier() << "'.";
+                throw std::runtime_error(msg.str());
+            } // if
+            const PetscInt subfieldIndex = solution.getSubfieldInfo(_subfieldName.c_str()).index;
+            PetscDM dmOutput = NULL;
+            err = DMGetOutputDM(solution.getDM(), &dmOutput);PYLITH_CHECK_ERROR(err);
+            err = DMCreateSubDM(dmOutput, 1, &subfieldIndex, &_subfieldIS, NULL);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = VecGetSubVector(outputVector, _subfieldIS, &values);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    bool isWrite = false;
+    if (!_valuesWrote) {
+        err = VecDuplicate(values, &_valuesWrote);PYLITH_CHECK_ERROR(err);
+        err = VecDuplicate(values, &_valuesWork);PYLITH_CHECK_ERROR(err);
+        isWrite = true;
+    } else {
+        PylithReal normWrote = 0.0;
+        PylithReal normChange = 0.0;
+        err = VecNorm(_valuesWrote, NORM_2, &normWrote);PYLITH_CHECK_ERROR(err);
+        err = VecWAXPY(_valuesWork, -1.0, _valuesWrote, values);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(_valuesWork, NORM_2, &normChange);PYLITH_CHECK_ERROR(err);
+        isWrite = normChange > _tolerance * normWrote;
+    } // if/else
+    if (isWrite) {
+        err = VecCopy(values, _valuesWrote);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    if (!_subfieldName.empty()) {
+        err = VecRestoreSubVector(outputVector, _subfieldIS, &values);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_RETURN(isWrite);
+} // shouldWriteSolution
+
+
+// End of file
@@ -0,0 +1,122 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/OutputTriggerChange.hh
+ *
+ * @brief Base decision on whether to write output on the relative change in the solution since the most recent write.
+ *
+ * The change is measured by the L2 norm of the difference between the current values and the values at the most
+ * recent write of the solution (or one of its subfields), relative to the L2 norm of the values at the most recent
+ * write.
+ */
+
+#if !defined(pylith_meshio_outputtriggerchange_hh)
+#define pylith_meshio_outputtriggerchange_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/meshio/OutputTrigger.hh" // ISA OutputTrigger
+
+#include "pylith/utils/petscfwd.h" // HASA PetscVec, PetscIS
+
+#include <string> // HASA std::string
+
+class pylith::meshio::OutputTriggerChange : public pylith::meshio::OutputTrigger {
+    friend class TestOutputTriggerChange; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    OutputTriggerChange(void);
+
+    /// Destructor
+    virtual ~OutputTriggerChange(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Check whether we want to write output at time t.
+     *
+     * Without the solution we cannot measure the change, so we always write.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @returns True.
+     */
+    bool shouldWrite(const PylithReal t,
+                     const PylithInt tindex);
+
+    /** Check whether we want to write output at time t given the current solution.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if output should be written at time t, false otherwise.
+     */
+    bool shouldWriteSolution(const PylithReal t,
+                             const PylithInt tindex,
+                             const pylith::topology::Field& solution);
+
+    /** Set relative change in solution that triggers a write.
+     *
+     * @param[in] value Relative change in L2 norm.
+     */
+    void setTolerance(const double value);
+
+    /** Get relative change in solution that triggers a write.
+     *
+     * @returns Relative change in L2 norm.
+     */
+    double getTolerance(void) const;
+
+    /** Set name of subfield to monitor.
+     *
+     * @param[in] value Name of subfield (empty for entire solution).
+     */
+    void setSubfield(const char* value);
+
+    /** Get name of subfield to monitor.
+     *
+     * @returns Name of subfield (empty for entire solution).
+     */
+    const char* getSubfield(void) const;
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    PylithReal _tolerance; ///< Relative change in L2 norm that triggers a write.
+    std::string _subfieldName; ///< Name of monitored subfield (empty for entire solution).
+    PetscIS _subfieldIS; ///< Indices of monitored subfield in output vector of solution.
+    PetscVec _valuesWrote; ///< Monitored values at most recent write.
+    PetscVec _valuesWork; ///< Work vector for difference between current values and values at most recent write.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputTriggerChange(const OutputTriggerChange&); ///< Not implemented.
+    const OutputTriggerChange& operator=(const OutputTriggerChange&); ///< Not implemented
+
+};
+
+// OutputTriggerChange
+
+#endif // pylith_meshio_outputtriggerchange_hh
+
+// End of file
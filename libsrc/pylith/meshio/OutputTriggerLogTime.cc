@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "OutputTriggerLogTime.hh" // Implementation of class methods
+
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputTriggerLogTime::OutputTriggerLogTime(void) :
+    _timeFirst(1.0),
+    _ratio(2.0),
+    _timeNondimStart(-PYLITH_MAXSCALAR),
+    _timeNondimNext(0.0) {
+    PyreComponent::setName("outputtriggerlogtime");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputTriggerLogTime::~OutputTriggerLogTime(void) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set elapsed time of first write after initial write.
+void
+pylith::meshio::OutputTriggerLogTime::setTimeFirst(const double value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerLogTime::setTimeFirst(value="<<value<<")");
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Elapsed time of first write (" << value << ") for output trigger '" << PyreComponent::getIdentifier()
+            << "' must be positive.";
+        throw std::invalid_argument(msg.str());
+    } // if
+    _timeFirst = value;
+} // setTimeFirst
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get elapsed time of first write after initial write.
+double
+pylith::meshio::OutputTriggerLogTime::getTimeFirst(void) const {
+    return _timeFirst;
+} // getTimeFirst
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set ratio of successive elapsed times between writes.
+void
+pylith::meshio::OutputTriggerLogTime::setRatio(const double value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerLogTime::setRatio(value="<<value<<")");
+
+    if (value <= 1.0) {
+        std::ostringstream msg;
+        msg << "Ratio of successive elapsed times (" << value << ") for output trigger '"
+            << PyreComponent::getIdentifier() << "' must be greater than 1.";
+        throw std::invalid_argument(msg.str());
+    } // if
+    _ratio = value;
+} // setRatio
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get ratio of successive elapsed times between writes.
+double
+pylith::meshio::OutputTriggerLogTime::getRatio(void) const {
+    return _ratio;
+} // getRatio
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether we want to write output at time t.
+bool
+pylith::meshio::OutputTriggerLogTime::shouldWrite(const PylithReal t,
+                                                  const PylithInt timeStep) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputTriggerLogTime::shouldWrite(t="<<t<<", timeStep="<<timeStep<<")");
+
+    if (_timeNondimStart == -PYLITH_MAXSCALAR) {
+        _timeNondimStart = t;
+        _timeNondimNext = _timeFirst / _timeScale;
+        PYLITH_METHOD_RETURN(true);
+    } // if
+
+    bool isWrite = false;
+    const PylithReal elapsed = t - _timeNondimStart;
+    if (elapsed >= _timeNondimNext) {
+        isWrite = true;
+        // Skip any scheduled writes that fall within the current time step.
+        while (_timeNondimNext <= elapsed) {
+            _timeNondimNext *= _ratio;
+        } // while
+    } // if
+
+    PYLITH_METHOD_RETURN(isWrite);
+} // shouldWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether output may be written at time t without changing the state of the trigger.
+bool
+pylith::meshio::OutputTriggerLogTime::willWrite(const PylithReal t,
+                                                const PylithInt timeStep) const {
+    if (_timeNondimStart == -PYLITH_MAXSCALAR) {
+        return true;
+    } // if
+    return t - _timeNondimStart >= _timeNondimNext;
+} // willWrite
+
+
+// End of file
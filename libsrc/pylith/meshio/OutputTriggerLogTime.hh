@@ -0,0 +1,110 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/OutputTriggerLogTime.hh
+ *
+ * @brief Base decision on whether to write output on a logarithmic schedule of elapsed time.
+ *
+ * Output is written at the first time step and then when the time elapsed since the first time step reaches
+ * t_1, t_1*r, t_1*r^2, ..., where t_1 is the elapsed time of the first write and r is the ratio between successive
+ * elapsed times.
+ */
+
+#if !defined(pylith_meshio_outputtriggerlogtime_hh)
+#define pylith_meshio_outputtriggerlogtime_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/meshio/OutputTrigger.hh" // ISA OutputTrigger
+
+class pylith::meshio::OutputTriggerLogTime : public pylith::meshio::OutputTrigger {
+    friend class TestOutputTriggerLogTime; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    OutputTriggerLogTime(void);
+
+    /// Destructor
+    virtual ~OutputTriggerLogTime(void);
+
+    /** Check whether we want to write output at time t.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @returns True if output should be written at time t, false otherwise.
+     */
+    bool shouldWrite(const PylithReal t,
+                     const PylithInt tindex);
+
+    /** Check whether output may be written at time t without changing the state of the trigger.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @returns True if output will be written at time t, false otherwise.
+     */
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex) const;
+
+    /** Set elapsed time of first write after initial write.
+     *
+     * @param[in] Elapsed time since first time step.
+     */
+    void setTimeFirst(const double value);
+
+    /** Get elapsed time of first write after initial write.
+     *
+     * @returns Elapsed time since first time step.
+     */
+    double getTimeFirst(void) const;
+
+    /** Set ratio of successive elapsed times between writes.
+     *
+     * @param[in] Ratio of successive elapsed times (greater than 1).
+     */
+    void setRatio(const double value);
+
+    /** Get ratio of successive elapsed times between writes.
+     *
+     * @returns Ratio of successive elapsed times.
+     */
+    double getRatio(void) const;
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    PylithReal _timeFirst; ///< Elapsed (dimensional) time of first write after initial write.
+    PylithReal _ratio; ///< Ratio of successive elapsed times.
+    PylithReal _timeNondimStart; ///< Time (nondimensional) of first time step.
+    PylithReal _timeNondimNext; ///< Elapsed time (nondimensional) of next write.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputTriggerLogTime(const OutputTriggerLogTime&); ///< Not implemented.
+    const OutputTriggerLogTime& operator=(const OutputTriggerLogTime&); ///< Not implemented
+
+};
+
+// OutputTriggerLogTime
+
+#endif // pylith_meshio_outputtriggerlogtime_hh
+
+// End of file
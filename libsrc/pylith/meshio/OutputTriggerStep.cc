@@ -74,4 +74,21 @@ pylith::meshio::OutputTriggerStep::shouldWrite(const PylithReal t,
 } // shouldWrite
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether output may be written at time t without changing the state of the trigger.
+bool
+pylith::meshio::OutputTriggerStep::willWrite(const PylithReal t,
+                                             const PylithInt tindex) const {
+    return tindex - _stepWrote > _numStepsSkip;
+} // willWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Estimate fraction of time steps with output.
+PylithReal
+pylith::meshio::OutputTriggerStep::getOutputFraction(void) const {
+    return 1.0 / (_numStepsSkip + 1);
+} // getOutputFraction
+
+
 // End of file
@@ -74,4 +74,13 @@ pylith::meshio::OutputTriggerTime::shouldWrite(const PylithReal t,
 } // shouldWrite
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether output may be written at time t without changing the state of the trigger.
+bool
+pylith::meshio::OutputTriggerTime::willWrite(const PylithReal t,
+                                             const PylithInt timeStep) const {
+    return t - _timeNondimWrote >= _timeSkip / _timeScale;
+} // willWrite
+
+
 // End of file
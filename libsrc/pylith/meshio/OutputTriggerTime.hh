@@ -50,6 +50,15 @@ public:
     bool shouldWrite(const PylithReal t,
                      const PylithInt tindex);
 
+    /** Check whether output may be written at time t without changing the state of the trigger.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @returns True if output will be written at time t, false otherwise.
+     */
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex) const;
+
     /** Set elapsed time between writes.
      *
      * @param[in] Elapsed time between writes.
@@ -0,0 +1,594 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "PointInterpolator.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::createFromPoints()
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+
+#include <vector> // USES std::vector
+#include <limits> // USES std::numeric_limits
+#include <algorithm> // USES std::min(), std::max()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _PointInterpolator {
+public:
+
+            /** Get bounding box of local vertices.
+             *
+             * @param[out] bboxMin Minimum coordinates of bounding box.
+             * @param[out] bboxMax Maximum coordinates of bounding box.
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] spaceDim Spatial dimension.
+             */
+            static
+            void getLocalBoundingBox(PylithReal bboxMin[],
+                                     PylithReal bboxMax[],
+                                     PetscDM dm,
+                                     const int spaceDim);
+
+        };
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::PointInterpolator::PointInterpolator(void) :
+    _labelValue(1),
+    _pointMesh(NULL),
+    _pointField(NULL),
+    _interpolator(NULL),
+    _interpolationMat(NULL),
+    _interpolationMatNumCols(0),
+    _useInterpolationMatrix(true) {
+    GenericComponent::setName("pointinterpolator");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::PointInterpolator::~PointInterpolator(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::PointInterpolator::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err;
+    if (_interpolator) {
+        err = DMInterpolationDestroy(&_interpolator);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = MatDestroy(&_interpolationMat);PYLITH_CHECK_ERROR(err);
+
+    delete _pointMesh;_pointMesh = NULL;
+    delete _pointField;_pointField = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set point names and coordinates of points .
+void
+pylith::meshio::PointInterpolator::setPoints(const PylithReal* pointCoords,
+                                             const int numPoints,
+                                             const int spaceDim,
+                                             const char* const* pointNames,
+                                             const int numPointNames) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(pointCoords && pointNames);
+    assert(numPoints == numPointNames);
+
+    // Copy point coordinates.
+    const PylithInt size = numPoints * spaceDim;
+    _pointCoords.resize(size);
+    for (PylithInt i = 0; i < size; ++i) {
+        _pointCoords[i] = pointCoords[i];
+    } // for
+
+    // Copy point names.
+    _pointNames.resize(numPointNames);
+    _pointIndices.resize(numPointNames);
+    for (PylithInt i = 0; i < numPointNames; ++i) {
+        _pointNames[i] = pointNames[i];
+        _pointIndices[i] = i;
+    } // for
+
+    PYLITH_METHOD_END;
+} // setPoints
+
+
+// ------------------------------------------------------------------------------------------------
+// Restrict points to cells with label value.
+void
+pylith::meshio::PointInterpolator::setLabel(const char* name,
+                                            const int value) {
+    assert(name);
+
+    _labelName = name;
+    _labelValue = value;
+} // setLabel
+
+
+// ------------------------------------------------------------------------------------------------
+// Use sparse interpolation matrix.
+void
+pylith::meshio::PointInterpolator::useInterpolationMatrix(const bool value) {
+    _useInterpolationMatrix = value;
+} // useInterpolationMatrix
+
+
+// ------------------------------------------------------------------------------------------------
+// Has interpolator been setup?
+bool
+pylith::meshio::PointInterpolator::isSetup(void) const {
+    return _interpolator != NULL;
+} // isSetup
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of points.
+size_t
+pylith::meshio::PointInterpolator::getNumPoints(void) const {
+    return _pointNames.size();
+} // getNumPoints
+
+
+// ------------------------------------------------------------------------------------------------
+// Locate points in mesh of field and create field at points.
+void
+pylith::meshio::PointInterpolator::setup(const pylith::topology::Field& field,
+                                         const pylith::string_vector& subfieldNames) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setup(field="<<field.getLabel()<<", subfieldNames="<<subfieldNames.size()<<")");
+
+    deallocate();
+
+    _subfieldNames = subfieldNames;
+    _locatePoints(field.getMesh());
+    _createPointField(field);
+    if (_useInterpolationMatrix) {
+        _setupInterpolationMatrix(field);
+    } // if
+
+    PYLITH_METHOD_END;
+} // setup
+
+
+// ------------------------------------------------------------------------------------------------
+// Interpolate field to points.
+void
+pylith::meshio::PointInterpolator::interpolate(const pylith::topology::Field& field) {
+    PYLITH_METHOD_BEGIN;
+    assert(_interpolator);
+    assert(_pointField);
+
+    PetscErrorCode err;
+    if (_interpolationMat) {
+        PetscInt numCols = 0;
+        err = VecGetLocalSize(field.getLocalVector(), &numCols);PYLITH_CHECK_ERROR(err);
+        if (numCols != _interpolationMatNumCols) {
+            // Layout of field changed, so the tabulation no longer matches the local field vector.
+            _setupInterpolationMatrix(field);
+        } // if
+        err = MatMult(_interpolationMat, field.getLocalVector(), _pointField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    } else {
+        err = DMInterpolationEvaluate(_interpolator, field.getDM(), field.getLocalVector(),
+                                      _pointField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // interpolate
+
+
+// ------------------------------------------------------------------------------------------------
+// Get mesh with points local to this process.
+const pylith::topology::Mesh&
+pylith::meshio::PointInterpolator::getPointMesh(void) const {
+    assert(_pointMesh);
+    return *_pointMesh;
+} // getPointMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Get field interpolated to points.
+const pylith::topology::Field&
+pylith::meshio::PointInterpolator::getPointField(void) const {
+    assert(_pointField);
+    return *_pointField;
+} // getPointField
+
+
+// ------------------------------------------------------------------------------------------------
+// Get names of points local to this process.
+const pylith::string_vector&
+pylith::meshio::PointInterpolator::getPointNames(void) const {
+    return _pointNames;
+} // getPointNames
+
+
+// ------------------------------------------------------------------------------------------------
+// Get indices of points local to this process in the array of points passed to setPoints().
+const pylith::int_vector&
+pylith::meshio::PointInterpolator::getPointIndices(void) const {
+    return _pointIndices;
+} // getPointIndices
+
+
+// ------------------------------------------------------------------------------------------------
+// Get sparse matrix interpolating subfields from the local vector of the field to the points.
+PetscMat
+pylith::meshio::PointInterpolator::getInterpolationMatrix(void) const {
+    return _interpolationMat;
+} // getInterpolationMatrix
+
+
+// ------------------------------------------------------------------------------------------------
+// Locate points and create mesh with points local to this process.
+void
+pylith::meshio::PointInterpolator::_locatePoints(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err;
+    assert(!_interpolator);
+
+    const spatialdata::geocoords::CoordSys* csMesh = mesh.getCoordSys();assert(csMesh);
+    const int spaceDim = csMesh->getSpaceDim();
+
+    MPI_Comm comm = mesh.getComm();
+
+    // Setup interpolator object
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+
+    PylithReal lengthScale = 1.0;
+    err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+
+    // Only locate points inside the bounding box of the local vertices rather than having every process search for
+    // every point.
+    const size_t numPoints = _pointNames.size();
+    PylithReal bboxMin[3];
+    PylithReal bboxMax[3];
+    _PointInterpolator::getLocalBoundingBox(bboxMin, bboxMax, dmMesh, spaceDim);
+    std::vector<PetscInt> candidates;
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        bool isInside = true;
+        for (int iDim = 0; iDim < spaceDim && isInside; ++iDim) {
+            const PylithReal xyz = _pointCoords[iPoint*spaceDim+iDim];
+            isInside = (xyz >= bboxMin[iDim]) && (xyz <= bboxMax[iDim]);
+        } // for
+        if (isInside) {
+            candidates.push_back(iPoint);
+        } // if
+    } // for
+    const PetscInt numCandidates = candidates.size();
+
+    PetscVec candidateVec = NULL;
+    PetscScalar* candidateArray = NULL;
+    err = VecCreateSeq(PETSC_COMM_SELF, numCandidates*spaceDim, &candidateVec);PYLITH_CHECK_ERROR(err);
+    err = VecSetBlockSize(candidateVec, spaceDim);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(candidateVec, &candidateArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iCandidate = 0; iCandidate < numCandidates; ++iCandidate) {
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            candidateArray[iCandidate*spaceDim+iDim] = _pointCoords[candidates[iCandidate]*spaceDim+iDim];
+        } // for
+    } // for
+    err = VecRestoreArray(candidateVec, &candidateArray);PYLITH_CHECK_ERROR(err);
+
+    PetscSF cellSF = NULL;
+    PetscInt numFound = 0;
+    const PetscInt* foundPoints = NULL;
+    const PetscSFNode* foundCells = NULL;
+    std::vector<PetscInt> candidateCells(numCandidates, -1);
+    err = DMLocatePoints(dmMesh, candidateVec, DM_POINTLOCATION_NONE, &cellSF);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(cellSF, NULL, &numFound, &foundPoints, &foundCells);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iFound = 0; iFound < numFound; ++iFound) {
+        const PetscInt iCandidate = (foundPoints) ? foundPoints[iFound] : iFound;
+        candidateCells[iCandidate] = foundCells[iFound].index;
+    } // for
+    err = PetscSFDestroy(&cellSF);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&candidateVec);PYLITH_CHECK_ERROR(err);
+
+    // Only keep points in cells with the label value.
+    const bool hasLabel = !_labelName.empty();
+    if (hasLabel) {
+        PetscDMLabel label = NULL;
+        err = DMGetLabel(dmMesh, _labelName.c_str(), &label);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iCandidate = 0; iCandidate < numCandidates; ++iCandidate) {
+            if (candidateCells[iCandidate] < 0) { continue; }
+            PetscInt value = -1;
+            if (label) {
+                err = DMLabelGetValue(label, candidateCells[iCandidate], &value);PYLITH_CHECK_ERROR(err);
+            } // if
+            if (value != _labelValue) {
+                candidateCells[iCandidate] = -1;
+            } // if
+        } // for
+    } // if
+
+    // Assign each point to the lowest ranked process that found it.
+    PetscMPIInt commRank = 0;
+    PetscMPIInt commSize = 0;
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+    std::vector<int> foundProcs(numPoints, commSize);
+    std::vector<int> ownerProcs(numPoints, commSize);
+    for (PetscInt iCandidate = 0; iCandidate < numCandidates; ++iCandidate) {
+        if (candidateCells[iCandidate] >= 0) {
+            foundProcs[candidates[iCandidate]] = commRank;
+        } // if
+    } // for
+    if (numPoints > 0) {
+        err = MPI_Allreduce(&foundProcs[0], &ownerProcs[0], numPoints, MPI_INT, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    } // if
+    size_t numDropped = 0;
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        if (commSize != ownerProcs[iPoint]) { continue; }
+        if (hasLabel) {
+            ++numDropped;
+            continue;
+        } // if
+
+        std::ostringstream msg;
+        msg << "Could not find point '" << _pointNames[iPoint] << "' (";
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            msg << (iDim > 0 ? ", " : "") << _pointCoords[iPoint*spaceDim+iDim] * lengthScale;
+        } // for
+        msg << ") in mesh.";
+        PYLITH_JOURNAL_ERROR(msg.str());
+        throw std::runtime_error(msg.str());
+    } // for
+    if (numDropped > 0) {
+        PYLITH_JOURNAL_INFO_ROOT("Skipping " << numDropped << " of " << numPoints << " points not in cells with label '"
+                                             << _labelName << "' and value " << _labelValue << ".");
+    } // if
+
+    // Setup interpolator with points owned by this process and the cells containing them. This matches
+    // DMInterpolationSetUp() but keeps the indices of the points, so we do not need to match coordinates to get the
+    // point names.
+    size_t numPointsLocal = 0;
+    for (PetscInt iCandidate = 0; iCandidate < numCandidates; ++iCandidate) {
+        if (commRank == ownerProcs[candidates[iCandidate]]) {
+            ++numPointsLocal;
+        } // if
+    } // for
+
+    err = DMInterpolationCreate(comm, &_interpolator);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDim(_interpolator, spaceDim);PYLITH_CHECK_ERROR(err);
+    _interpolator->n = numPointsLocal;
+    err = PetscMalloc1(numPointsLocal, &_interpolator->cells);PYLITH_CHECK_ERROR(err);
+    err = VecCreate(comm, &_interpolator->coords);PYLITH_CHECK_ERROR(err);
+    err = VecSetSizes(_interpolator->coords, numPointsLocal*spaceDim, PETSC_DECIDE);PYLITH_CHECK_ERROR(err);
+    err = VecSetBlockSize(_interpolator->coords, spaceDim);PYLITH_CHECK_ERROR(err);
+    err = VecSetType(_interpolator->coords, VECSTANDARD);PYLITH_CHECK_ERROR(err);
+
+    pylith::string_vector pointNamesLocal(numPointsLocal);
+    pylith::int_vector pointIndicesLocal(numPointsLocal);
+    PylithScalar* pointsLocal = NULL;
+    err = VecGetArray(_interpolator->coords, &pointsLocal);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iCandidate = 0, iPointLocal = 0; iCandidate < numCandidates; ++iCandidate) {
+        const PetscInt iPoint = candidates[iCandidate];
+        if (commRank != ownerProcs[iPoint]) {
+            continue;
+        } // if
+        _interpolator->cells[iPointLocal] = candidateCells[iCandidate];
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            pointsLocal[iPointLocal*spaceDim+iDim] = _pointCoords[iPoint*spaceDim+iDim];
+        } // for
+        pointNamesLocal[iPointLocal] = _pointNames[iPoint];
+        pointIndicesLocal[iPointLocal] = _pointIndices[iPoint];
+        ++iPointLocal;
+    } // for
+
+    // Create mesh corresponding to local points.
+    delete _pointMesh;_pointMesh = pylith::topology::MeshOps::createFromPoints(
+        pointsLocal, numPointsLocal, csMesh, lengthScale, comm);
+    err = VecRestoreArray(_interpolator->coords, &pointsLocal);PYLITH_CHECK_ERROR(err);
+
+    _pointNames = pointNamesLocal;
+    _pointIndices = pointIndicesLocal;
+    _pointCoords.resize(0);
+
+    PYLITH_METHOD_END;
+} // _locatePoints
+
+
+// ------------------------------------------------------------------------------------------------
+// Create field at points.
+void
+pylith::meshio::PointInterpolator::_createPointField(const pylith::topology::Field& field) {
+    PYLITH_METHOD_BEGIN;
+    assert(_interpolator);
+    assert(_pointMesh);
+
+    const int spaceDim = _interpolator->dim;
+
+    // Determine size of interpolated field that we will have.
+    PetscInt numDof = 0;
+    const pylith::string_vector& subfieldNames = field.getSubfieldNames();
+    const size_t numSubfields = subfieldNames.size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = field.getSubfieldInfo(subfieldNames[i].c_str());
+        if (!info.fe.isFaultOnly) {
+            numDof += info.description.numComponents;
+        } // if
+    } // for
+    PetscErrorCode err = DMInterpolationSetDof(_interpolator, numDof);PYLITH_CHECK_ERROR(err);
+
+    delete _pointField;_pointField = new pylith::topology::Field(*_pointMesh);
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& sinfo = field.getSubfieldInfo(subfieldNames[i].c_str());
+        pylith::topology::Field::Discretization discretization = sinfo.fe;
+        discretization.dimension = spaceDim;
+        _pointField->subfieldAdd(sinfo.description, discretization);
+    } // for
+    _pointField->subfieldsSetup();
+    _pointField->createDiscretization();
+    _pointField->setLabel(field.getLabel());
+    _pointField->allocate();
+
+    PYLITH_METHOD_END;
+} // _createPointField
+
+
+// ------------------------------------------------------------------------------------------------
+// Setup sparse matrix interpolating subfields from the local vector of the field to the points.
+void
+pylith::meshio::PointInterpolator::_setupInterpolationMatrix(const pylith::topology::Field& field) {
+    PYLITH_METHOD_BEGIN;
+    assert(_interpolator);
+    assert(_pointField);
+
+    PetscErrorCode err;
+    err = MatDestroy(&_interpolationMat);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmField = field.getDM();assert(dmField);
+    PetscSection fieldSection = field.getLocalSection();assert(fieldSection);
+    PetscSection pointSection = _pointField->getLocalSection();assert(pointSection);
+    PetscInt numRows = 0, numFields = 0;
+    err = VecGetLocalSize(_pointField->getLocalVector(), &numRows);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(field.getLocalVector(), &_interpolationMatNumCols);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetNumFields(fieldSection, &numFields);PYLITH_CHECK_ERROR(err);
+
+    const size_t numSubfields = _subfieldNames.size();
+    std::vector<PetscFE> fes(numSubfields);
+    PetscInt maxRowSize = 1;
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = field.getSubfieldInfo(_subfieldNames[i].c_str());
+        err = DMGetField(dmField, info.index, NULL, (PetscObject*)&fes[i]);PYLITH_CHECK_ERROR(err);assert(fes[i]);
+        PetscInt basisSize = 0;
+        err = PetscFEGetDimension(fes[i], &basisSize);PYLITH_CHECK_ERROR(err);
+        maxRowSize = std::max(maxRowSize, basisSize);
+    } // for
+
+    err = MatCreateSeqAIJ(PETSC_COMM_SELF, numRows, _interpolationMatNumCols, maxRowSize, NULL,
+                          &_interpolationMat);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt spaceDim = _interpolator->dim;
+    const PetscInt numPointsLocal = _interpolator->n;
+    const PetscScalar* pointCoords = NULL;
+    std::vector<PetscInt> closureOffsets(numFields+1);
+    PylithReal refCoords[3];
+    err = VecGetArrayRead(_interpolator->coords, &pointCoords);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iPoint = 0; iPoint < numPointsLocal; ++iPoint) {
+        const PetscInt cell = _interpolator->cells[iPoint];
+        err = DMPlexCoordinatesToReference(dmField, cell, 1, &pointCoords[iPoint*spaceDim], refCoords);PYLITH_CHECK_ERROR(err);
+
+        PetscInt numIndices = 0;
+        PetscInt* indices = NULL;
+        err = DMPlexGetClosureIndices(dmField, fieldSection, fieldSection, cell, PETSC_TRUE, &numIndices, &indices,
+                                      &closureOffsets[0], NULL);PYLITH_CHECK_ERROR(err);
+        for (size_t i = 0; i < numSubfields; ++i) {
+            const PetscInt fieldIndex = field.getSubfieldInfo(_subfieldNames[i].c_str()).index;
+            const PetscInt pointIndex = _pointField->getSubfieldInfo(_subfieldNames[i].c_str()).index;
+            PetscInt rowOffset = 0;
+            err = PetscSectionGetFieldOffset(pointSection, iPoint, pointIndex, &rowOffset);PYLITH_CHECK_ERROR(err);
+
+            PetscTabulation tabulation = NULL;
+            err = PetscFECreateTabulation(fes[i], 1, 1, refCoords, 0, &tabulation);PYLITH_CHECK_ERROR(err);
+            const PetscInt basisSize = tabulation->Nb;
+            const PetscInt numComponents = tabulation->Nc;
+            assert(closureOffsets[fieldIndex+1] - closureOffsets[fieldIndex] == basisSize);
+            const PetscInt* cols = &indices[closureOffsets[fieldIndex]];
+            for (PetscInt iComp = 0; iComp < numComponents; ++iComp) {
+                for (PetscInt iBasis = 0; iBasis < basisSize; ++iBasis) {
+                    const PetscScalar value = tabulation->T[0][iBasis*numComponents+iComp];
+                    if (value != 0.0) {
+                        // Constrained degrees of freedom are flagged with negative indices.
+                        const PetscInt col = (cols[iBasis] >= 0) ? cols[iBasis] : -(cols[iBasis]+1);
+                        err = MatSetValue(_interpolationMat, rowOffset+iComp, col, value, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+                    } // if
+                } // for
+            } // for
+            err = PetscTabulationDestroy(&tabulation);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = DMPlexRestoreClosureIndices(dmField, fieldSection, fieldSection, cell, PETSC_TRUE, &numIndices, &indices,
+                                          &closureOffsets[0], NULL);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecRestoreArrayRead(_interpolator->coords, &pointCoords);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyBegin(_interpolationMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_interpolationMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupInterpolationMatrix
+
+
+// ------------------------------------------------------------------------------------------------
+// Get bounding box of local vertices.
+void
+pylith::meshio::_PointInterpolator::getLocalBoundingBox(PylithReal bboxMin[],
+                                                         PylithReal bboxMax[],
+                                                         PetscDM dm,
+                                                         const int spaceDim) {
+    PYLITH_METHOD_BEGIN;
+    assert(bboxMin);
+    assert(bboxMax);
+    assert(dm);
+
+    for (int iDim = 0; iDim < spaceDim; ++iDim) {
+        bboxMin[iDim] = std::numeric_limits<PylithReal>::max();
+        bboxMax[iDim] = -std::numeric_limits<PylithReal>::max();
+    } // for
+
+    PetscErrorCode err;
+    PetscVec coordsVec = NULL;
+    PetscInt coordsSize = 0;
+    const PetscScalar* coordsArray = NULL;
+    err = DMGetCoordinatesLocal(dm, &coordsVec);PYLITH_CHECK_ERROR(err);assert(coordsVec);
+    err = VecGetLocalSize(coordsVec, &coordsSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < coordsSize; i += spaceDim) {
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            bboxMin[iDim] = std::min(bboxMin[iDim], PylithReal(coordsArray[i+iDim]));
+            bboxMax[iDim] = std::max(bboxMax[iDim], PylithReal(coordsArray[i+iDim]));
+        } // for
+    } // for
+    err = VecRestoreArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+
+    // Expand bounding box slightly, so points on the boundary of the local vertices are candidates.
+    if (coordsSize > 0) {
+        const PylithReal tolerance = 1.0e-6;
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            const PylithReal dx = tolerance * std::max(bboxMax[iDim] - bboxMin[iDim], PylithReal(1.0));
+            bboxMin[iDim] -= dx;
+            bboxMax[iDim] += dx;
+        } // for
+    } // if
+
+    PYLITH_METHOD_END;
+} // getLocalBoundingBox
+
+
+// End of file
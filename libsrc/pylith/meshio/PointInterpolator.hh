@@ -0,0 +1,194 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/PointInterpolator.hh
+ *
+ * @brief Interpolation of a field to an arbitrary set of points.
+ *
+ * Each point is located in the mesh once and assigned to the lowest ranked process containing it. The interpolated
+ * values are stored in a field over a mesh with only the points (no cells) on each process.
+ */
+
+#if !defined(pylith_meshio_pointinterpolator_hh)
+#define pylith_meshio_pointinterpolator_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh, Field
+#include "pylith/utils/array.hh" // HASA scalar_array, string_vector, int_vector
+#include "pylith/utils/petscfwd.h" // HASA PetscMat
+
+#include <string> // HASA std::string
+
+class pylith::meshio::PointInterpolator : public pylith::utils::GenericComponent {
+    friend class TestPointInterpolator; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    PointInterpolator(void);
+
+    /// Destructor
+    ~PointInterpolator(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set coordinates and names of points.
+     *
+     * @param[in] points Array of coordinates [numPoints * spaceDim].
+     * @param[in] numPoints Number of points.
+     * @param[in] spaceDim Spatial dimension for coordinates.
+     * @param[in] pointNames Array with point names.
+     * @param[in] numPointNames Number of point banes.
+     */
+    void setPoints(const PylithReal* pointCoords,
+                   const int numPoints,
+                   const int spaceDim,
+                   const char* const* pointNames,
+                   const int numPointNames);
+
+    /** Restrict points to cells with label value.
+     *
+     * Points that are not in cells with the label value are dropped rather than generating an error.
+     *
+     * @param[in] name Name of label.
+     * @param[in] value Value of label.
+     */
+    void setLabel(const char* name,
+                  const int value);
+
+    /** Use sparse interpolation matrix.
+     *
+     * The basis functions are tabulated at the points once, so interpolation is a single sparse matrix-vector
+     * product rather than a point-by-point evaluation of all subfields.
+     *
+     * @param[in] value True if using interpolation matrix, false if using DMInterpolationEvaluate().
+     */
+    void useInterpolationMatrix(const bool value);
+
+    /** Has interpolator been setup?
+     *
+     * @returns True if setup() has been called, false otherwise.
+     */
+    bool isSetup(void) const;
+
+    /** Get number of points.
+     *
+     * @returns Number of points over all processes.
+     */
+    size_t getNumPoints(void) const;
+
+    /** Locate points in mesh of field and create field at points.
+     *
+     * @param[in] field Field to interpolate.
+     * @param[in] subfieldNames Names of subfields to interpolate (used with interpolation matrix).
+     */
+    void setup(const pylith::topology::Field& field,
+               const pylith::string_vector& subfieldNames);
+
+    /** Interpolate field to points.
+     *
+     * @param[in] field Field to interpolate.
+     */
+    void interpolate(const pylith::topology::Field& field);
+
+    /** Get mesh with points local to this process.
+     *
+     * @returns Mesh with points (no cells).
+     */
+    const pylith::topology::Mesh& getPointMesh(void) const;
+
+    /** Get field interpolated to points.
+     *
+     * @returns Field at points.
+     */
+    const pylith::topology::Field& getPointField(void) const;
+
+    /** Get names of points local to this process.
+     *
+     * @returns Array of point names.
+     */
+    const pylith::string_vector& getPointNames(void) const;
+
+    /** Get indices of points local to this process in the array of points passed to setPoints().
+     *
+     * @returns Array of point indices.
+     */
+    const pylith::int_vector& getPointIndices(void) const;
+
+    /** Get sparse matrix interpolating subfields from the local vector of the field to the points.
+     *
+     * Rows follow the local section of the field at points, and columns follow the local vector of the field.
+     *
+     * @returns Interpolation matrix (NULL if not using interpolation matrix).
+     */
+    PetscMat getInterpolationMatrix(void) const;
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Locate points and create mesh with points local to this process.
+     *
+     * @param[in] mesh Finite-element mesh containing points.
+     */
+    void _locatePoints(const pylith::topology::Mesh& mesh);
+
+    /** Create field at points.
+     *
+     * @param[in] field Field to interpolate.
+     */
+    void _createPointField(const pylith::topology::Field& field);
+
+    /** Setup sparse matrix interpolating subfields from the local vector of the field to the points.
+     *
+     * @param[in] field Field to interpolate.
+     */
+    void _setupInterpolationMatrix(const pylith::topology::Field& field);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::scalar_array _pointCoords; ///< Array of point coordinates.
+    pylith::string_vector _pointNames; ///< Array of point names.
+    pylith::int_vector _pointIndices; ///< Indices of points in array passed to setPoints().
+    pylith::string_vector _subfieldNames; ///< Names of subfields to interpolate.
+    std::string _labelName; ///< Name of label restricting points (empty for entire mesh).
+    int _labelValue; ///< Value of label restricting points.
+    pylith::topology::Mesh* _pointMesh; ///< Mesh for points (no cells).
+    pylith::topology::Field* _pointField; ///< Field at points.
+    DMInterpolationInfo _interpolator; ///< Field interpolator.
+    PetscMat _interpolationMat; ///< Sparse matrix interpolating local field vector to points.
+    PetscInt _interpolationMatNumCols; ///< Size of local field vector when interpolation matrix was created.
+    bool _useInterpolationMatrix; ///< Use interpolation matrix rather than DMInterpolationEvaluate().
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    PointInterpolator(const PointInterpolator&); ///< Not implemented.
+    const PointInterpolator& operator=(const PointInterpolator&); ///< Not implemented
+
+}; // PointInterpolator
+
+#endif // pylith_meshio_pointinterpolator_hh
+
+// End of file
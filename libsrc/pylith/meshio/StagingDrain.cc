@@ -0,0 +1,200 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "StagingDrain.hh" // Implementation of class methods
+
+#include <vector> // USES std::vector
+#include <fcntl.h> // USES open()
+#include <unistd.h> // USES read(), pwrite(), close(), unlink()
+#include <cerrno> // USES errno
+#include <cstring> // USES strerror()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::StagingDrain::StagingDrain(void) :
+    _numActive(0),
+    _stop(false) {
+    GenericComponent::setName("stagingdrain");
+    _thread = std::thread(&StagingDrain::_run, this);
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::StagingDrain::~StagingDrain(void) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _taskAdded.notify_all();
+    if (_thread.joinable()) {
+        _thread.join(); // Drain thread copies remaining staged files before stopping.
+    } // if
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Add staged file to drain.
+void
+pylith::meshio::StagingDrain::add(const std::string& stagedFilename,
+                                  const std::string& finalFilename,
+                                  const uint64_t offset) {
+    Task task;
+    task.stagedFilename = stagedFilename;
+    task.finalFilename = finalFilename;
+    task.offset = offset;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.push_back(task);
+    }
+    _taskAdded.notify_one();
+} // add
+
+
+// ------------------------------------------------------------------------------------------------
+// Wait for all staged files to be drained.
+void
+pylith::meshio::StagingDrain::wait(void) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _taskDone.wait(lock, [this] { return _tasks.empty() && !_numActive; });
+    if (!_errorMsg.empty()) {
+        std::string msg = _errorMsg;
+        _errorMsg.clear();
+        throw std::runtime_error(msg);
+    } // if
+} // wait
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of staged files not yet drained.
+size_t
+pylith::meshio::StagingDrain::getNumPending(void) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _tasks.size() + _numActive;
+} // getNumPending
+
+
+// ------------------------------------------------------------------------------------------------
+// Create name of staged file in staging directory.
+std::string
+pylith::meshio::StagingDrain::stagedFilename(const std::string& stagingDir,
+                                             const std::string& filename,
+                                             const int rank,
+                                             const size_t index) {
+    const size_t pos = filename.rfind('/');
+    const std::string& basename = (pos != std::string::npos) ? std::string(filename, pos+1) : filename;
+
+    std::ostringstream staged;
+    staged << stagingDir << "/" << basename << ".p" << rank << "." << index;
+    return std::string(staged.str());
+} // stagedFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy staged files until stopped.
+void
+pylith::meshio::StagingDrain::_run(void) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _taskAdded.wait(lock, [this] { return _stop || !_tasks.empty(); });
+        if (_tasks.empty()) { // stop requested and nothing left to copy
+            break;
+        } // if
+        const Task task = _tasks.front();
+        _tasks.pop_front();
+        ++_numActive;
+
+        lock.unlock();
+        std::string errorMsg;
+        try {
+            _copy(task);
+        } catch (const std::exception& err) {
+            errorMsg = err.what();
+        } // try/catch
+        lock.lock();
+
+        --_numActive;
+        if (!errorMsg.empty() && _errorMsg.empty()) {
+            _errorMsg = errorMsg;
+        } // if
+        _taskDone.notify_all();
+    } // while
+} // _run
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy staged file into final file.
+void
+pylith::meshio::StagingDrain::_copy(const Task& task) {
+    const int fdStaged = ::open(task.stagedFilename.c_str(), O_RDONLY);
+    if (fdStaged < 0) {
+        std::ostringstream msg;
+        msg << "Could not open staged file '" << task.stagedFilename << "': " << strerror(errno) << ".";
+        throw std::runtime_error(msg.str());
+    } // if
+    const int fdFinal = ::open(task.finalFilename.c_str(), O_WRONLY);
+    if (fdFinal < 0) {
+        std::ostringstream msg;
+        msg << "Could not open file '" << task.finalFilename << "' to drain staged file '" << task.stagedFilename
+            << "': " << strerror(errno) << ".";
+        ::close(fdStaged);
+        throw std::runtime_error(msg.str());
+    } // if
+
+    const size_t bufferSize = 4 * 1024 * 1024;
+    std::vector<char> buffer(bufferSize);
+    uint64_t offset = task.offset;
+    std::string errorMsg;
+    while (errorMsg.empty()) {
+        const ssize_t numRead = ::read(fdStaged, &buffer[0], bufferSize);
+        if (numRead < 0) {
+            if (EINTR == errno) { continue; }
+            errorMsg = std::string("Error reading staged file '") + task.stagedFilename + "': " + strerror(errno) + ".";
+            break;
+        } // if
+        if (!numRead) { break; }
+
+        for (ssize_t numWritten = 0; numWritten < numRead;) {
+            const ssize_t n = ::pwrite(fdFinal, &buffer[numWritten], numRead-numWritten, off_t(offset+numWritten));
+            if (n < 0) {
+                if (EINTR == errno) { continue; }
+                errorMsg = std::string("Error writing file '") + task.finalFilename + "': " + strerror(errno) + ".";
+                break;
+            } // if
+            numWritten += n;
+        } // for
+        offset += numRead;
+    } // while
+
+    ::close(fdStaged);
+    if (::close(fdFinal) < 0 && errorMsg.empty()) {
+        errorMsg = std::string("Error closing file '") + task.finalFilename + "': " + strerror(errno) + ".";
+    } // if
+    if (!errorMsg.empty()) {
+        throw std::runtime_error(errorMsg);
+    } // if
+    ::unlink(task.stagedFilename.c_str());
+} // _copy
+
+
+// End of file
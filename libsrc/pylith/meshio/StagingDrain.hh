@@ -0,0 +1,139 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/StagingDrain.hh
+ *
+ * @brief Background thread that drains files written to node-local staging storage to their final location.
+ *
+ * Writers write blocks of data to files in a fast node-local directory (e.g., NVMe burst buffer) and add them to the
+ * drain; a background thread copies each staged file into its final file (usually on the parallel file system) at
+ * the given offset and then removes the staged file. Several processes may merge disjoint blocks into the same final
+ * file. The drain thread only does POSIX I/O, so it does not interfere with MPI.
+ */
+
+#if !defined(pylith_meshio_stagingdrain_hh)
+#define pylith_meshio_stagingdrain_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include <string> // HASA std::string
+#include <deque> // HASA std::deque
+#include <thread> // HASA std::thread
+#include <mutex> // HASA std::mutex
+#include <condition_variable> // HASA std::condition_variable
+#include <cstdint> // USES uint64_t
+
+class pylith::meshio::StagingDrain : public pylith::utils::GenericComponent {
+    friend class TestStagingDrain; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    StagingDrain(void);
+
+    /// Destructor (waits for drain to finish).
+    ~StagingDrain(void);
+
+    /** Add staged file to drain.
+     *
+     * The staged file is copied into the final file starting at the given offset and then removed.
+     *
+     * @param[in] stagedFilename Name of staged file.
+     * @param[in] finalFilename Name of final file (must exist).
+     * @param[in] offset Offset in bytes in final file.
+     */
+    void add(const std::string& stagedFilename,
+             const std::string& finalFilename,
+             const uint64_t offset);
+
+    /** Wait for all staged files to be drained.
+     *
+     * @throws std::runtime_error if copying a staged file failed.
+     */
+    void wait(void);
+
+    /** Get number of staged files not yet drained.
+     *
+     * @returns Number of staged files not yet drained.
+     */
+    size_t getNumPending(void);
+
+    /** Create name of staged file in staging directory.
+     *
+     * @param[in] stagingDir Node-local staging directory.
+     * @param[in] filename Name of final file.
+     * @param[in] rank Rank of process writing staged file.
+     * @param[in] index Index of block (e.g., time step).
+     * @returns Name of staged file.
+     */
+    static
+    std::string stagedFilename(const std::string& stagingDir,
+                               const std::string& filename,
+                               const int rank,
+                               const size_t index);
+
+    // PRIVATE STRUCTS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Staged file to copy to final file.
+    struct Task {
+        std::string stagedFilename; ///< Name of staged file.
+        std::string finalFilename; ///< Name of final file.
+        uint64_t offset; ///< Offset in bytes in final file.
+    };
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Copy staged files until stopped.
+    void _run(void);
+
+    /** Copy staged file into final file.
+     *
+     * @param[in] task Staged file to copy.
+     */
+    static
+    void _copy(const Task& task);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::deque<Task> _tasks; ///< Staged files not yet copied.
+    std::mutex _mutex; ///< Mutex protecting tasks, flags, and error message.
+    std::condition_variable _taskAdded; ///< Signals new task or stop.
+    std::condition_variable _taskDone; ///< Signals completion of a task.
+    std::thread _thread; ///< Drain thread.
+    std::string _errorMsg; ///< Error message from first failed copy.
+    size_t _numActive; ///< Number of tasks being copied (0 or 1).
+    bool _stop; ///< True if drain thread should stop.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    StagingDrain(const StagingDrain&); ///< Not implemented.
+    const StagingDrain& operator=(const StagingDrain&); ///< Not implemented
+
+}; // StagingDrain
+
+#endif // pylith_meshio_stagingdrain_hh
+
+// End of file
@@ -0,0 +1,425 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TimeSlicesHDF5.hh" // Implementation of class methods
+
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+#include "spatialdata/units/Parser.hh" // USES Parser
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include <algorithm> // USES std::sort(), std::lower_bound(), std::upper_bound()
+#include <cmath> // USES fabs()
+#include <limits> // USES std::numeric_limits
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _TimeSlicesHDF5 {
+public:
+
+            /// Compare points in file by their first coordinate.
+            class CompareCoordinate {
+public:
+
+                CompareCoordinate(const std::vector<double>& coordinates,
+                                  const size_t spaceDim) :
+                    _coordinates(coordinates),
+                    _spaceDim(spaceDim) {}
+
+
+                bool operator()(const size_t a,
+                                const size_t b) const {
+                    return _coordinates[a*_spaceDim] < _coordinates[b*_spaceDim];
+                }
+
+
+                bool operator()(const size_t a,
+                                const double x) const {
+                    return _coordinates[a*_spaceDim] < x;
+                }
+
+
+private:
+
+                const std::vector<double>& _coordinates;
+                const size_t _spaceDim;
+            }; // CompareCoordinate
+
+            /** Get scale for converting values in dataset to SI units.
+             *
+             * @param[in] h5 HDF5 file.
+             * @param[in] dataset Full path of dataset.
+             * @returns Scale for values in dataset.
+             */
+            static
+            double getScale(HDF5* h5,
+                            const char* dataset);
+
+            static const size_t noSlice;
+        }; // _TimeSlicesHDF5
+        const size_t _TimeSlicesHDF5::noSlice = std::numeric_limits<size_t>::max();
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::TimeSlicesHDF5::TimeSlicesHDF5(void) :
+    _h5(NULL),
+    _valueScale(1.0),
+    _numComponents(0),
+    _rowStart(0),
+    _numRows(0) {
+    _sliceIndices[0] = _TimeSlicesHDF5::noSlice;
+    _sliceIndices[1] = _TimeSlicesHDF5::noSlice;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::TimeSlicesHDF5::~TimeSlicesHDF5(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::TimeSlicesHDF5::deallocate(void) {
+    close();
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set filename containing time slices.
+void
+pylith::meshio::TimeSlicesHDF5::setFilename(const char* value) {
+    _filename = value;
+} // setFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Get filename containing time slices.
+const char*
+pylith::meshio::TimeSlicesHDF5::getFilename(void) const {
+    return _filename.c_str();
+} // getFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Open file and match points in file to vertices of subfield.
+void
+pylith::meshio::TimeSlicesHDF5::open(const pylith::topology::Field& field,
+                                     const char* subfieldName,
+                                     const spatialdata::units::Nondimensional& normalizer) {
+    PYLITH_METHOD_BEGIN;
+    assert(subfieldName);
+
+    close();
+    _subfieldName = subfieldName;
+
+    const pylith::topology::Field::SubfieldInfo& info = field.getSubfieldInfo(subfieldName);
+    if (1 != info.fe.basisOrder) {
+        std::ostringstream msg;
+        msg << "Time slices in '" << _filename << "' require a basis order of 1 for subfield '" << subfieldName
+            << "'. Current basis order is " << info.fe.basisOrder << ".";
+        throw std::runtime_error(msg.str());
+    } // if
+    _numComponents = info.description.numComponents;
+
+    _h5 = new HDF5(_filename.c_str(), H5F_ACC_RDONLY);assert(_h5);
+
+    // Times of slices.
+    hsize_t* dims = NULL;
+    int ndims = 0;
+    _h5->getDatasetDims(&dims, &ndims, "/", "time");
+    hsize_t numTimes = (ndims > 0) ? dims[0] : 0;
+    for (int iDim = 1; iDim < ndims; ++iDim) {
+        numTimes *= (1 == dims[iDim]) ? 1 : 0;
+    } // for
+    if (!numTimes) {
+        delete[] dims;dims = NULL;
+        std::ostringstream msg;
+        msg << "Expected nonempty dataset '/time' with one time per slice in time slices file '" << _filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    std::vector<hsize_t> offset(ndims, 0);
+    _times.resize(numTimes);
+    _h5->readDatasetHyperslab("/", "time", &_times[0], &offset[0], dims, ndims, H5T_NATIVE_DOUBLE);
+    delete[] dims;dims = NULL;
+    const PylithReal timeScale = _TimeSlicesHDF5::getScale(_h5, "/time") / normalizer.getTimeScale();
+    for (size_t i = 0; i < numTimes; ++i) {
+        _times[i] *= timeScale;
+        if ((i > 0) && (_times[i] <= _times[i-1])) {
+            std::ostringstream msg;
+            msg << "Times in dataset '/time' of time slices file '" << _filename << "' must be strictly increasing.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // for
+
+    // Coordinates of points.
+    _h5->getDatasetDims(&dims, &ndims, "/geometry", "vertices");
+    const size_t spaceDim = field.getSpaceDim();
+    const size_t numPoints = (2 == ndims) ? dims[0] : 0;
+    const bool isConsistent = (2 == ndims) && (spaceDim == dims[1]);
+    delete[] dims;dims = NULL;
+    if (!numPoints || !isConsistent) {
+        std::ostringstream msg;
+        msg << "Expected dataset '/geometry/vertices' with dimensions (numPoints, " << spaceDim
+            << ") in time slices file '" << _filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    std::vector<double> coordinates(numPoints*spaceDim);
+    const hsize_t offsetVertices[2] = { 0, 0 };
+    const hsize_t countVertices[2] = { numPoints, spaceDim };
+    _h5->readDatasetHyperslab("/geometry", "vertices", &coordinates[0], offsetVertices, countVertices, 2,
+                              H5T_NATIVE_DOUBLE);
+    const double coordsScale = _TimeSlicesHDF5::getScale(_h5, "/geometry/vertices");
+    double coordsMin[3] = { 0.0, 0.0, 0.0 };
+    double coordsMax[3] = { 0.0, 0.0, 0.0 };
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        for (size_t iDim = 0; iDim < spaceDim; ++iDim) {
+            double& x = coordinates[iPoint*spaceDim+iDim];
+            x *= coordsScale;
+            coordsMin[iDim] = (!iPoint || (x < coordsMin[iDim])) ? x : coordsMin[iDim];
+            coordsMax[iDim] = (!iPoint || (x > coordsMax[iDim])) ? x : coordsMax[iDim];
+        } // for
+    } // for
+    double extent = 0.0;
+    for (size_t iDim = 0; iDim < spaceDim; ++iDim) {
+        extent = std::max(extent, coordsMax[iDim] - coordsMin[iDim]);
+    } // for
+    const double tolerance = 1.0e-6 * ((extent > 0.0) ? extent : normalizer.getLengthScale());
+
+    // Values of slices.
+    _h5->getDatasetDims(&dims, &ndims, "/vertex_fields", "amplitude");
+    const bool hasValues = (3 == ndims) && (numTimes == dims[0]) && (numPoints == dims[1]) && (_numComponents == dims[2]);
+    delete[] dims;dims = NULL;
+    if (!hasValues) {
+        std::ostringstream msg;
+        msg << "Expected dataset '/vertex_fields/amplitude' with dimensions (" << numTimes << ", " << numPoints << ", "
+            << _numComponents << ") in time slices file '" << _filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _valueScale = _TimeSlicesHDF5::getScale(_h5, "/vertex_fields/amplitude") / info.description.scale;
+
+    // Match vertices of subfield to points in file, using points sorted by their first coordinate to limit the search.
+    std::vector<size_t> sortedPoints(numPoints);
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        sortedPoints[iPoint] = iPoint;
+    } // for
+    const _TimeSlicesHDF5::CompareCoordinate compare(coordinates, spaceDim);
+    std::sort(sortedPoints.begin(), sortedPoints.end(), compare);
+
+    PetscErrorCode err = 0;
+    PetscDM dm = field.getDM();
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    pylith::topology::VecVisitorMesh fieldVisitor(field, subfieldName);
+    pylith::topology::CoordsVisitor coordsVisitor(dm);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();
+    const PylithReal lengthScale = normalizer.getLengthScale();
+    std::vector<size_t> rows;
+    for (PetscInt vertex = vStart; vertex < vEnd; ++vertex) {
+        if (!fieldVisitor.sectionDof(vertex)) { continue; }
+
+        double xyz[3] = { 0.0, 0.0, 0.0 };
+        const PetscInt off = coordsVisitor.sectionOffset(vertex);
+        for (size_t iDim = 0; iDim < spaceDim; ++iDim) {
+            xyz[iDim] = coordsArray[off+iDim] * lengthScale;
+        } // for
+
+        size_t row = numPoints;
+        std::vector<size_t>::const_iterator iter = std::lower_bound(sortedPoints.begin(), sortedPoints.end(),
+                                                                    xyz[0] - tolerance, compare);
+        for (; iter != sortedPoints.end() && coordinates[*iter*spaceDim] <= xyz[0] + tolerance; ++iter) {
+            double distSquared = 0.0;
+            for (size_t iDim = 0; iDim < spaceDim; ++iDim) {
+                const double dx = coordinates[*iter*spaceDim+iDim] - xyz[iDim];
+                distSquared += dx*dx;
+            } // for
+            if (distSquared <= tolerance*tolerance) {
+                row = *iter;
+                break;
+            } // if
+        } // for
+        if (row == numPoints) {
+            std::ostringstream msg;
+            msg << "Could not find point matching vertex (";
+            for (size_t iDim = 0; iDim < spaceDim; ++iDim) {
+                msg << (iDim ? ", " : "") << xyz[iDim];
+            } // for
+            msg << ") of subfield '" << subfieldName << "' in time slices file '" << _filename << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        rows.push_back(row);
+        _offsets.push_back(fieldVisitor.sectionOffset(vertex));
+    } // for
+
+    // Read only the contiguous block of rows covering the local vertices.
+    if (!rows.empty()) {
+        _rowStart = *std::min_element(rows.begin(), rows.end());
+        _numRows = *std::max_element(rows.begin(), rows.end()) - _rowStart + 1;
+    } // if
+    _rows.resize(rows.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+        _rows[i] = rows[i] - _rowStart;
+    } // for
+
+    PYLITH_METHOD_END;
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close file and release time slices.
+void
+pylith::meshio::TimeSlicesHDF5::close(void) {
+    delete _h5;_h5 = NULL;
+    _times.clear();
+    _rows.clear();
+    _offsets.clear();
+    _rowStart = 0;
+    _numRows = 0;
+    for (size_t i = 0; i < 2; ++i) {
+        std::vector<PylithScalar>().swap(_slices[i]);
+        _sliceIndices[i] = _TimeSlicesHDF5::noSlice;
+    } // for
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Set subfield to values interpolated in time between the time slices bracketing time t.
+void
+pylith::meshio::TimeSlicesHDF5::update(pylith::topology::Field* field,
+                                       const PylithReal t) {
+    PYLITH_METHOD_BEGIN;
+    assert(field);
+
+    if (!_h5) {
+        std::ostringstream msg;
+        msg << "Time slices file '" << _filename << "' must be open before updating subfield '" << _subfieldName << "'.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    // Find slices bracketing current time.
+    const size_t numTimes = _times.size();
+    size_t i0 = 0, i1 = 0;
+    if (t >= _times[numTimes-1]) {
+        i0 = i1 = numTimes-1;
+    } else if (t > _times[0]) {
+        i1 = std::upper_bound(_times.begin(), _times.end(), t) - _times.begin();
+        i0 = i1 - 1;
+    } // if/else
+    _loadSlices(i0, i1);
+    const PylithReal w1 = (i1 > i0) ? (t - _times[i0]) / (_times[i1] - _times[i0]) : 0.0;
+    const PylithReal w0 = 1.0 - w1;
+
+    // Update values in local section.
+    PetscErrorCode err = 0;
+    PetscVec localVec = field->getLocalVector();assert(localVec);
+    PetscScalar* fieldArray = NULL;
+    err = VecGetArray(localVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+    const PylithScalar* values0 = _slices[0].empty() ? NULL : &_slices[0][0];
+    const PylithScalar* values1 = _slices[1].empty() ? NULL : &_slices[1][0];
+    const size_t numVertices = _offsets.size();
+    for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+        const size_t iValue = _rows[iVertex]*_numComponents;
+        for (size_t iComponent = 0; iComponent < _numComponents; ++iComponent) {
+            fieldArray[_offsets[iVertex]+iComponent] = _valueScale *
+                                                       (w0*values0[iValue+iComponent] + w1*values1[iValue+iComponent]);
+        } // for
+    } // for
+    err = VecRestoreArray(localVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // update
+
+
+// ------------------------------------------------------------------------------------------------
+// Make slices with indices i0 and i1 the current slices, reading them from the file if necessary.
+void
+pylith::meshio::TimeSlicesHDF5::_loadSlices(const size_t i0,
+                                            const size_t i1) {
+    PYLITH_METHOD_BEGIN;
+
+    // When time advances into the next interval, the upper slice becomes the lower slice, so only one slice is read.
+    const size_t indices[2] = { i0, i1 };
+    for (size_t i = 0; i < 2; ++i) {
+        if (_sliceIndices[i] == indices[i]) { continue; }
+
+        const size_t other = 1 - i;
+        if (_sliceIndices[other] == indices[i]) {
+            _slices[i].swap(_slices[other]);
+            std::swap(_sliceIndices[i], _sliceIndices[other]);
+        } else {
+            _readSlice(indices[i], &_slices[i]);
+            _sliceIndices[i] = indices[i];
+        } // if/else
+    } // for
+
+    PYLITH_METHOD_END;
+} // _loadSlices
+
+
+// ------------------------------------------------------------------------------------------------
+// Read rows of slice for local vertices.
+void
+pylith::meshio::TimeSlicesHDF5::_readSlice(const size_t index,
+                                           std::vector<PylithScalar>* values) {
+    PYLITH_METHOD_BEGIN;
+    assert(_h5);
+    assert(values);
+
+    values->resize(_numRows*_numComponents);
+    if (!_numRows) {
+        PYLITH_METHOD_END;
+    } // if
+
+    const hsize_t offset[3] = { index, _rowStart, 0 };
+    const hsize_t count[3] = { 1, _numRows, _numComponents };
+    _h5->readDatasetHyperslab("/vertex_fields", "amplitude", &(*values)[0], offset, count, 3, H5T_NATIVE_DOUBLE);
+
+    PYLITH_METHOD_END;
+} // _readSlice
+
+
+// ------------------------------------------------------------------------------------------------
+// Get scale for converting values in dataset to SI units.
+double
+pylith::meshio::_TimeSlicesHDF5::getScale(HDF5* h5,
+                                          const char* dataset) {
+    assert(h5);
+    assert(dataset);
+
+    const std::string& units = h5->readAttribute(dataset, "units");
+    spatialdata::units::Parser parser;
+    return ("none" == units) ? 1.0 : parser.parse(units.c_str());
+} // getScale
+
+
+// End of file
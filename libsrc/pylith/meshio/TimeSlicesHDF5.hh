@@ -0,0 +1,144 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/TimeSlicesHDF5.hh
+ *
+ * @brief Set auxiliary subfield from time slices of a space-time field stored in an HDF5 file.
+ *
+ * The times of the slices are in the dataset `/time` and must be strictly increasing. The coordinates of the points
+ * are in the dataset `/geometry/vertices` with dimensions (numPoints, spaceDim), and the values are in the dataset
+ * `/vertex_fields/amplitude` with dimensions (numTimes, numPoints, numComponents). Each dataset has a string attribute
+ * `units`.
+ *
+ * The points in the file are matched to the vertices of the auxiliary subfield by their coordinates when the file
+ * is opened. Each process holds only the two slices bracketing the current time and reads only the rows of the
+ * slices for its vertices. A slice is read when the current time enters a new interval between slices, and the
+ * values are interpolated linearly in time directly into the local section of the auxiliary field.
+ */
+
+#if !defined(pylith_meshio_timesliceshdf5_hh)
+#define pylith_meshio_timesliceshdf5_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/types.hh" // HASA PylithScalar
+
+#include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::meshio::TimeSlicesHDF5 {
+    friend class TestTimeSlicesHDF5; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    TimeSlicesHDF5(void);
+
+    /// Destructor
+    ~TimeSlicesHDF5(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set filename containing time slices.
+     *
+     * @param[in] value Name of HDF5 file.
+     */
+    void setFilename(const char* value);
+
+    /** Get filename containing time slices.
+     *
+     * @returns Name of HDF5 file.
+     */
+    const char* getFilename(void) const;
+
+    /** Open file and match points in file to vertices of subfield.
+     *
+     * @param[in] field Field with subfield set from time slices.
+     * @param[in] subfieldName Name of subfield set from time slices.
+     * @param[in] normalizer Scales for nondimensionalizing coordinates, time, and values.
+     */
+    void open(const pylith::topology::Field& field,
+              const char* subfieldName,
+              const spatialdata::units::Nondimensional& normalizer);
+
+    /// Close file and release time slices.
+    void close(void);
+
+    /** Set subfield to values interpolated in time between the time slices bracketing time t.
+     *
+     * Values at times before the first slice and after the last slice are the values of the first and last slices.
+     *
+     * @param[inout] field Field with subfield set from time slices.
+     * @param[in] t Current time (nondimensional).
+     */
+    void update(pylith::topology::Field* field,
+                const PylithReal t);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Make slices with indices i0 and i1 the current slices, reading them from the file if necessary.
+     *
+     * @param[in] i0 Index of slice at or before current time.
+     * @param[in] i1 Index of slice after current time.
+     */
+    void _loadSlices(const size_t i0,
+                     const size_t i1);
+
+    /** Read rows of slice for local vertices.
+     *
+     * @param[in] index Index of slice.
+     * @param[out] values Values of slice for local vertices.
+     */
+    void _readSlice(const size_t index,
+                    std::vector<PylithScalar>* values);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Name of HDF5 file.
+    std::string _subfieldName; ///< Name of subfield set from time slices.
+    HDF5* _h5; ///< HDF5 file.
+
+    std::vector<PylithReal> _times; ///< Nondimensional times of slices.
+    PylithReal _valueScale; ///< Scale for converting values in file to nondimensional values.
+    size_t _numComponents; ///< Number of components in subfield.
+    size_t _rowStart; ///< Index of first row of slices read by this process.
+    size_t _numRows; ///< Number of rows of slices read by this process.
+    std::vector<size_t> _rows; ///< Row in slices read by this process for each local vertex.
+    std::vector<PetscInt> _offsets; ///< Offset of subfield in local section for each local vertex.
+    std::vector<PylithScalar> _slices[2]; ///< Values of slices bracketing current time.
+    size_t _sliceIndices[2]; ///< Indices of slices bracketing current time.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    TimeSlicesHDF5(const TimeSlicesHDF5&); ///< Not implemented.
+    const TimeSlicesHDF5& operator=(const TimeSlicesHDF5&); ///< Not implemented
+
+}; // TimeSlicesHDF5
+
+#endif // pylith_meshio_timesliceshdf5_hh
+
+// End of file
@@ -0,0 +1,420 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "XdmfWriter.hh" // implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include <cassert> // USES assert()
+#include <cstdio> // USES snprintf()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _XdmfWriter {
+public:
+
+            /// Closing tags for temporal collection, domain, and Xdmf elements.
+            static const char* closingTags;
+        };
+
+        const char* _XdmfWriter::closingTags =
+            "    </Grid>\n"
+            "  </Domain>\n"
+            "</Xdmf>\n";
+    } // meshio
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::XdmfWriter::XdmfWriter(void) :
+    _closingPos(0),
+    _t(0.0),
+    _numCells(0),
+    _numCorners(0),
+    _numVertices(0),
+    _cellDim(0),
+    _spaceDim(0) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::XdmfWriter::~XdmfWriter(void) {
+    close();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set HDF5 file and domain information.
+void
+pylith::meshio::XdmfWriter::open(const char* filenameH5,
+                                 const size_t numCells,
+                                 const size_t numCorners,
+                                 const int cellDim,
+                                 const size_t numVertices,
+                                 const int spaceDim) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(filenameH5);
+
+    close();
+    _filenameH5 = filenameH5;
+    _filenameMeshH5 = "";
+    _numCells = numCells;
+    _numCorners = numCorners;
+    _cellDim = cellDim;
+    _numVertices = numVertices;
+    _spaceDim = spaceDim;
+    _fields.clear();
+
+    if ((spaceDim < 2) || (spaceDim > 3)) {
+        std::ostringstream msg;
+        msg << "Xdmf grids are not defined for " << spaceDim << "-D domains.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // open
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set HDF5 file with topology and geometry if different from HDF5 file with fields.
+void
+pylith::meshio::XdmfWriter::setMeshFilename(const char* filenameH5) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(filenameH5);
+    assert(!_file.is_open());
+
+    _filenameMeshH5 = filenameH5;
+
+    PYLITH_METHOD_END;
+} // setMeshFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Close Xdmf file.
+void
+pylith::meshio::XdmfWriter::close(void) {
+    if (_file.is_open()) {
+        _file.close();
+    } // if
+    _fields.clear();
+} // close
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add field written at current time step.
+void
+pylith::meshio::XdmfWriter::addField(const PylithScalar t,
+                                     const char* name,
+                                     const FieldCenterEnum center,
+                                     const char* vectorFieldType,
+                                     const size_t istep,
+                                     const size_t numPoints,
+                                     const size_t numComponents) {
+    assert(name);
+    assert(vectorFieldType);
+
+    FieldInfo field;
+    field.name = name;
+    field.center = center;
+    field.istep = istep;
+    field.numPoints = numPoints;
+    field.numComponents = numComponents;
+
+    const std::string fieldType(vectorFieldType);
+    if (fieldType == "scalar") {
+        field.vectorFieldType = "Scalar";
+    } else if (fieldType == "vector") {
+        field.vectorFieldType = "Vector";
+    } else if (fieldType == "tensor") {
+        field.vectorFieldType = "Tensor6";
+    } else {
+        field.vectorFieldType = "Matrix";
+    } // if/else
+
+    _t = t;
+    _fields.push_back(field);
+} // addField
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Append grid with fields added since last time step to Xdmf file.
+void
+pylith::meshio::XdmfWriter::writeTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_fields.empty()) {
+        PYLITH_METHOD_END;
+    } // if
+    if (!_file.is_open()) {
+        _openXdmf();
+    } // if
+
+    // Overwrite closing tags with grid for time step and then restore closing tags.
+    _file.seekp(_closingPos);
+
+    char tstamp[64];
+    snprintf(tstamp, sizeof(tstamp), "%16.8e", double(_t));
+    _file << "      <Grid Name=\"domain\" GridType=\"Uniform\">\n"
+          << "        <Time Value=\"" << tstamp << "\"/>\n"
+          << "        <Topology TopologyType=\"" << _getCellType() << "\" NumberOfElements=\"" << _numCells << "\">\n"
+          << "          <DataItem Reference=\"XML\">\n"
+          << "            /Xdmf/Domain/DataItem[@Name=\"cells\"]\n"
+          << "          </DataItem>\n"
+          << "        </Topology>\n"
+          << "        <Geometry GeometryType=\"XYZ\">\n"
+          << "          <DataItem Reference=\"XML\">\n"
+          << "            /Xdmf/Domain/DataItem[@Name=\"vertices\"]\n"
+          << "          </DataItem>\n"
+          << "        </Geometry>\n";
+    for (size_t i = 0; i < _fields.size(); ++i) {
+        const FieldInfo& field = _fields[i];
+        if ((field.vectorFieldType == "Tensor6") || (field.vectorFieldType == "Matrix")) {
+            for (size_t iComponent = 0; iComponent < field.numComponents; ++iComponent) {
+                _writeGridFieldComponent(field, iComponent);
+            } // for
+        } else {
+            _writeGridField(field);
+        } // if/else
+    } // for
+    _file << "      </Grid>\n";
+
+    _closingPos = _file.tellp();
+    _file << _XdmfWriter::closingTags;
+    _file.flush();
+    if (!_file.good()) {
+        std::ostringstream msg;
+        msg << "Error while writing time step to Xdmf file for HDF5 file '" << _filenameH5 << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _fields.clear();
+
+    PYLITH_METHOD_END;
+} // writeTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create Xdmf file and write header and domain.
+void
+pylith::meshio::XdmfWriter::_openXdmf(void) {
+    PYLITH_METHOD_BEGIN;
+
+    std::string filenameXdmf = _filenameH5;
+    const size_t indexExt = filenameXdmf.rfind(".h5");
+    if (indexExt != std::string::npos) {
+        filenameXdmf.replace(indexExt, 3, ".xmf");
+    } else {
+        filenameXdmf += ".xmf";
+    } // if/else
+    _file.open(filenameXdmf.c_str(), std::ios::out | std::ios::trunc);
+    if (!_file.is_open() || !_file.good()) {
+        std::ostringstream msg;
+        msg << "Could not create Xdmf file '" << filenameXdmf << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // HDF5 file is referenced relative to the Xdmf file.
+    const size_t indexDir = _filenameH5.rfind('/');
+    const std::string heavyData = (indexDir != std::string::npos) ? _filenameH5.substr(indexDir+1) : _filenameH5;
+    std::string meshData = heavyData;
+    if (!_filenameMeshH5.empty()) {
+        const size_t indexMeshDir = _filenameMeshH5.rfind('/');
+        const bool sameDir = _filenameH5.substr(0, indexDir+1) == _filenameMeshH5.substr(0, indexMeshDir+1);
+        meshData = (sameDir && indexMeshDir != std::string::npos) ? _filenameMeshH5.substr(indexMeshDir+1) : _filenameMeshH5;
+    } // if
+
+    _file << "<?xml version=\"1.0\" ?>\n"
+          << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" [\n"
+          << "<!ENTITY HeavyData \"" << heavyData << "\">\n"
+          << "<!ENTITY MeshData \"" << meshData << "\">\n"
+          << "]>\n"
+          << "\n"
+          << "<Xdmf>\n"
+          << "  <Domain Name=\"domain\">\n";
+
+    // Cells
+    _file << "    <DataItem Name=\"cells\" ItemType=\"Uniform\" Format=\"HDF\" NumberType=\"Float\" Precision=\"8\" "
+          << "Dimensions=\"" << _numCells << " " << _numCorners << "\">\n"
+          << "      &MeshData;:/viz/topology/cells\n"
+          << "    </DataItem>\n";
+
+    // Vertices
+    if (3 == _spaceDim) {
+        _file << "    <DataItem Name=\"vertices\" ItemType=\"Uniform\" Format=\"HDF\" "
+              << "Dimensions=\"" << _numVertices << " " << _spaceDim << "\">\n"
+              << "      &MeshData;:/geometry/vertices\n"
+              << "    </DataItem>\n";
+    } else {
+        assert(2 == _spaceDim);
+        // Form vector with 3 components using x and y components and then a fake z-component by multiplying the
+        // x-component by zero.
+        _file << "    <DataItem Name=\"vertices\" ItemType=\"Function\" Dimensions=\"" << _numVertices << " 3\" "
+              << "Function=\"JOIN($0, $1, $2)\">\n";
+        const char* components[2] = { "X", "Y" };
+        for (int i = 0; i < 2; ++i) {
+            _file << "      <DataItem Name=\"vertices" << components[i] << "\" ItemType=\"Hyperslab\" Type=\"HyperSlab\" "
+                  << "Dimensions=\"" << _numVertices << " 1\">\n"
+                  << "        <DataItem Dimensions=\"3 2\" Format=\"XML\">\n"
+                  << "          0 " << i << "   1 1   " << _numVertices << " 1\n"
+                  << "        </DataItem>\n"
+                  << "        <DataItem Dimensions=\"" << _numVertices << " 1\" Format=\"HDF\">\n"
+                  << "          &MeshData;:/geometry/vertices\n"
+                  << "        </DataItem>\n"
+                  << "      </DataItem>\n";
+        } // for
+        _file << "      <DataItem Name=\"verticesZ\" ItemType=\"Function\" Dimensions=\"" << _numVertices << " 1\" "
+              << "Function=\"0*$0\">\n"
+              << "        <DataItem Reference=\"XML\">\n"
+              << "          /Xdmf/Domain/DataItem[@Name=\"vertices\"]/DataItem[@Name=\"verticesX\"]\n"
+              << "        </DataItem>\n"
+              << "      </DataItem>\n"
+              << "    </DataItem>\n";
+    } // if/else
+
+    _file << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+    _closingPos = _file.tellp();
+
+    PYLITH_METHOD_END;
+} // _openXdmf
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write field for current time step.
+void
+pylith::meshio::XdmfWriter::_writeGridField(const FieldInfo& field) {
+    const std::string h5Name = _getDatasetName(field);
+    const char* center = (VERTEX_FIELD == field.center) ? "Node" : "Cell";
+    const size_t numTimeSteps = field.istep + 1;
+    const size_t precision = sizeof(PylithScalar);
+
+    _file << "        <Attribute Name=\"" << field.name << "\" Type=\"" << field.vectorFieldType << "\" Center=\""
+          << center << "\">\n";
+    if ((2 == _spaceDim) && (field.vectorFieldType == "Vector")) {
+        _file << "          <DataItem ItemType=\"Function\" Dimensions=\"" << field.numPoints << " 3\" "
+              << "Function=\"JOIN($0, $1, $2)\">\n";
+        for (size_t iComponent = 0; iComponent < 2; ++iComponent) {
+            _file << "            <DataItem ItemType=\"HyperSlab\" Dimensions=\"" << field.numPoints << " 1\" Type=\"HyperSlab\">\n"
+                  << "              <DataItem Dimensions=\"3 3\" Format=\"XML\">\n"
+                  << "                " << field.istep << " 0 " << iComponent << "    1 1 1    1 " << field.numPoints << " 1\n"
+                  << "              </DataItem>\n"
+                  << "              <DataItem DataType=\"Float\" Precision=\"" << precision << "\" Dimensions=\""
+                  << numTimeSteps << " " << field.numPoints << " " << field.numComponents << "\" Format=\"HDF\">\n"
+                  << "                &HeavyData;:" << h5Name << "\n"
+                  << "              </DataItem>\n"
+                  << "            </DataItem>\n";
+        } // for
+        _file << "            <DataItem ItemType=\"Function\" Dimensions=\"" << field.numPoints << " 1\" Function=\"0*$0\">\n"
+              << "              <DataItem Reference=\"XML\">\n"
+              << "                /Xdmf/Domain/Grid/Grid[1]/Attribute[@Name=\"" << field.name << "\"]/DataItem[1]/DataItem[1]\n"
+              << "              </DataItem>\n"
+              << "            </DataItem>\n"
+              << "          </DataItem>\n";
+    } else {
+        _file << "          <DataItem ItemType=\"HyperSlab\" Dimensions=\"1 " << field.numPoints << " " << field.numComponents
+              << "\" Type=\"HyperSlab\">\n"
+              << "            <DataItem Dimensions=\"3 3\" Format=\"XML\">\n"
+              << "              " << field.istep << " 0 0    1 1 1    1 " << field.numPoints << " " << field.numComponents << "\n"
+              << "            </DataItem>\n"
+              << "            <DataItem DataType=\"Float\" Precision=\"" << precision << "\" Dimensions=\""
+              << numTimeSteps << " " << field.numPoints << " " << field.numComponents << "\" Format=\"HDF\">\n"
+              << "              &HeavyData;:" << h5Name << "\n"
+              << "            </DataItem>\n"
+              << "          </DataItem>\n";
+    } // if/else
+    _file << "        </Attribute>\n";
+} // _writeGridField
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write single component of field for current time step.
+void
+pylith::meshio::XdmfWriter::_writeGridFieldComponent(const FieldInfo& field,
+                                                     const size_t iComponent) {
+    std::ostringstream componentName;
+    componentName << field.name;
+    if (field.vectorFieldType == "Tensor6") {
+        const char* components2D[3] = { "_xx", "_yy", "_xy" };
+        const char* components3D[6] = { "_xx", "_yy", "_zz", "_xy", "_yz", "_xz" };
+        if ((2 == _spaceDim) && (iComponent < 3)) {
+            componentName << components2D[iComponent];
+        } else if ((3 == _spaceDim) && (iComponent < 6)) {
+            componentName << components3D[iComponent];
+        } else {
+            componentName << "_" << iComponent;
+        } // if/else
+    } else {
+        componentName << "_" << iComponent;
+    } // if/else
+
+    const std::string h5Name = _getDatasetName(field);
+    const char* center = (VERTEX_FIELD == field.center) ? "Node" : "Cell";
+    const size_t numTimeSteps = field.istep + 1;
+    const size_t precision = sizeof(PylithScalar);
+
+    _file << "        <Attribute Name=\"" << componentName.str() << "\" Type=\"Scalar\" Center=\"" << center << "\">\n"
+          << "          <DataItem ItemType=\"HyperSlab\" Dimensions=\"1 " << field.numPoints << " 1\" Type=\"HyperSlab\">\n"
+          << "            <DataItem Dimensions=\"3 3\" Format=\"XML\">\n"
+          << "              " << field.istep << " 0 " << iComponent << "    1 1 1    1 " << field.numPoints << " 1\n"
+          << "            </DataItem>\n"
+          << "            <DataItem DataType=\"Float\" Precision=\"" << precision << "\" Dimensions=\""
+          << numTimeSteps << " " << field.numPoints << " " << field.numComponents << "\" Format=\"HDF\">\n"
+          << "              &HeavyData;:" << h5Name << "\n"
+          << "            </DataItem>\n"
+          << "          </DataItem>\n"
+          << "        </Attribute>\n";
+} // _writeGridFieldComponent
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get Xdmf cell type.
+const char*
+pylith::meshio::XdmfWriter::_getCellType(void) const {
+    if ((0 == _cellDim) && (1 == _numCorners)) {
+        return "Polyvertex";
+    } else if ((1 == _cellDim) && (2 == _numCorners)) {
+        return "Polyline";
+    } else if ((2 == _cellDim) && (3 == _numCorners)) {
+        return "Triangle";
+    } else if ((2 == _cellDim) && (4 == _numCorners)) {
+        return "Quadrilateral";
+    } else if ((3 == _cellDim) && (4 == _numCorners)) {
+        return "Tetrahedron";
+    } else if ((3 == _cellDim) && (8 == _numCorners)) {
+        return "Hexahedron";
+    } // if/else
+    return "Unknown";
+} // _getCellType
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get HDF5 dataset name of field.
+std::string
+pylith::meshio::XdmfWriter::_getDatasetName(const FieldInfo& field) const {
+    const char* group = (VERTEX_FIELD == field.center) ? "/vertex_fields/" : "/cell_fields/";
+    return std::string(group) + field.name;
+} // _getDatasetName
+
+
+// End of file
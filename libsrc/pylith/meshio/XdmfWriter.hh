@@ -0,0 +1,181 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/XdmfWriter.hh
+ *
+ * @brief Incremental writer of Xdmf metadata file for HDF5 file.
+ *
+ * The Xdmf file is built from the information the data writer already has, so the HDF5 file is not read. Each time
+ * step is appended as a uniform grid with its own time value in a temporal collection, so the Xdmf file is complete
+ * after every time step and closing it requires no additional work.
+ */
+
+#if !defined(pylith_meshio_xdmfwriter_hh)
+#define pylith_meshio_xdmfwriter_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <fstream> // HASA std::fstream
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::meshio::XdmfWriter {
+    friend class TestXdmfWriter; // unit testing
+
+    // PUBLIC ENUM /////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    enum FieldCenterEnum {
+        VERTEX_FIELD, // Field over vertices.
+        CELL_FIELD, // Field over cells.
+    }; // FieldCenterEnum
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    XdmfWriter(void);
+
+    /// Destructor
+    ~XdmfWriter(void);
+
+    /** Set HDF5 file and domain information.
+     *
+     * The Xdmf file is created when the first time step is written.
+     *
+     * @param[in] filenameH5 Name of HDF5 file.
+     * @param[in] numCells Number of cells.
+     * @param[in] numCorners Number of vertices in each cell.
+     * @param[in] cellDim Dimension of cells.
+     * @param[in] numVertices Number of vertices.
+     * @param[in] spaceDim Spatial dimension of vertex coordinates.
+     */
+    void open(const char* filenameH5,
+              const size_t numCells,
+              const size_t numCorners,
+              const int cellDim,
+              const size_t numVertices,
+              const int spaceDim);
+
+    /** Set HDF5 file with topology and geometry if different from HDF5 file with fields.
+     *
+     * Must be called after open() and before the first time step is written.
+     *
+     * @param[in] filenameH5 Name of HDF5 file with topology and geometry.
+     */
+    void setMeshFilename(const char* filenameH5);
+
+    /// Close Xdmf file.
+    void close(void);
+
+    /** Add field written at current time step.
+     *
+     * @param[in] t Time stamp (dimensioned) of current time step.
+     * @param[in] name Name of field.
+     * @param[in] center Type of points for field.
+     * @param[in] vectorFieldType Vector field type of field ('scalar', 'vector', 'tensor', 'other').
+     * @param[in] istep Index of time step in field dataset.
+     * @param[in] numPoints Number of points in field.
+     * @param[in] numComponents Number of components in field.
+     */
+    void addField(const PylithScalar t,
+                  const char* name,
+                  const FieldCenterEnum center,
+                  const char* vectorFieldType,
+                  const size_t istep,
+                  const size_t numPoints,
+                  const size_t numComponents);
+
+    /// Append grid with fields added since last time step to Xdmf file.
+    void writeTimeStep(void);
+
+    // PRIVATE STRUCTS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Information about field written at a time step.
+    struct FieldInfo {
+        std::string name; ///< Name of field.
+        std::string vectorFieldType; ///< Xdmf vector field type.
+        FieldCenterEnum center; ///< Type of points for field.
+        size_t istep; ///< Index of time step in dataset.
+        size_t numPoints; ///< Number of points in field.
+        size_t numComponents; ///< Number of components in field.
+    };
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Create Xdmf file and write header and domain.
+    void _openXdmf(void);
+
+    /** Write field for current time step.
+     *
+     * @param[in] field Information about field.
+     */
+    void _writeGridField(const FieldInfo& field);
+
+    /** Write single component of field for current time step.
+     *
+     * @param[in] field Information about field.
+     * @param[in] iComponent Index of component.
+     */
+    void _writeGridFieldComponent(const FieldInfo& field,
+                                  const size_t iComponent);
+
+    /** Get Xdmf cell type.
+     *
+     * @returns Name of Xdmf cell type.
+     */
+    const char* _getCellType(void) const;
+
+    /** Get HDF5 dataset name of field.
+     *
+     * @param[in] field Information about field.
+     * @returns Full name of dataset.
+     */
+    std::string _getDatasetName(const FieldInfo& field) const;
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::fstream _file; ///< Xdmf file.
+    std::streampos _closingPos; ///< Position of closing tags in Xdmf file.
+    std::string _filenameH5; ///< Name of HDF5 file.
+    std::string _filenameMeshH5; ///< Name of HDF5 file with topology and geometry (empty if same as _filenameH5).
+    std::vector<FieldInfo> _fields; ///< Fields added since last time step.
+    PylithScalar _t; ///< Time stamp of current time step.
+    size_t _numCells; ///< Number of cells.
+    size_t _numCorners; ///< Number of vertices in each cell.
+    size_t _numVertices; ///< Number of vertices.
+    int _cellDim; ///< Dimension of cells.
+    int _spaceDim; ///< Spatial dimension.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    XdmfWriter(const XdmfWriter&); ///< Not implemented
+    const XdmfWriter& operator=(const XdmfWriter&); ///< Not implemented
+
+}; // XdmfWriter
+
+#endif // pylith_meshio_xdmfwriter_hh
+
+// End of file
@@ -44,15 +44,26 @@ namespace pylith {
         class PsetFileAscii;
         class PsetFileBinary;
         class ExodusII;
+        class GriddedHDF5DB;
+        class TimeSlicesHDF5;
+        class ExpressionDB;
 
         class OutputObserver;
         class OutputSubfield;
+        class OutputSubfieldCache;
+        class StagingDrain;
         class OutputSoln;
         class OutputSolnDomain;
         class OutputSolnBoundary;
+        class OutputSolnRegion;
         class OutputSolnPoints;
+        class OutputSolnLineOfSight;
+        class PointInterpolator;
 
         class OutputPhysics;
+        class OutputPhysicsPoints;
+        class OutputPhysicsCoulombStress;
+        class OutputRuptureStats;
         class OutputIntegrator;
         class OutputConstraint;
 
@@ -60,14 +71,21 @@ namespace pylith {
         class OutputTrigger;
         class OutputTriggerStep;
         class OutputTriggerTime;
+        class OutputTriggerLogTime;
+        class OutputTriggerChange;
 
         class DataWriter;
         class DataWriterVTK;
+        class DataWriterPVTU;
+        class DataWriterADIOS2;
         class DataWriterHDF5;
         class DataWriterHDF5Ext;
+        class DataWriterHDF5GreensFns;
+        class DataWriterStats;
 
         class HDF5;
         class Xdmf;
+        class XdmfWriter;
 
     } // meshio
 } // pylith
@@ -0,0 +1,403 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "CouplerBoundary.hh" // implementation of class methods
+
+#include "pylith/problems/Problem.hh" // USES Problem
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES createLowerDimMesh()
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::CouplerBoundary::CouplerBoundary(void) :
+    _problem(NULL),
+    _boundaryMesh(NULL),
+    _labelName(""),
+    _labelValue(1),
+    _recvIdentifier(""),
+    _recvSubfieldName("initial_amplitude"),
+    _portName(""),
+    _intercomm(MPI_COMM_NULL),
+    _exchangeFn(NULL),
+    _exchangeContext(NULL),
+    _timeScale(1.0) {
+    PyreComponent::setName("couplerboundary");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::CouplerBoundary::~CouplerBoundary(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::CouplerBoundary::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    ObserverSoln::deallocate();
+
+    for (size_t i = 0; i < _sendSubfields.size(); ++i) {
+        delete _sendSubfields[i];_sendSubfields[i] = NULL;
+    } // for
+    _sendSubfields.clear();
+    delete _boundaryMesh;_boundaryMesh = NULL;
+
+    if (MPI_COMM_NULL != _intercomm) {
+        PetscErrorCode err = MPI_Comm_disconnect(&_intercomm);PYLITH_CHECK_ERROR(err);
+        _intercomm = MPI_COMM_NULL;
+    } // if
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set problem with boundary condition receiving values.
+void
+pylith::problems::CouplerBoundary::setProblem(const pylith::problems::Problem* problem) {
+    _problem = problem;
+} // setProblem
+
+
+// ------------------------------------------------------------------------------------------------
+// Set name of label identifying boundary for values sent to external code.
+void
+pylith::problems::CouplerBoundary::setLabelName(const char* value) {
+    PYLITH_COMPONENT_DEBUG("setLabelName(value="<<value<<")");
+
+    _labelName = value;
+} // setLabelName
+
+
+// ------------------------------------------------------------------------------------------------
+// Set value of label identifying boundary for values sent to external code.
+void
+pylith::problems::CouplerBoundary::setLabelValue(const int value) {
+    PYLITH_COMPONENT_DEBUG("setLabelValue(value="<<value<<")");
+
+    _labelValue = value;
+} // setLabelValue
+
+
+// ------------------------------------------------------------------------------------------------
+// Set names of solution subfields sent to external code.
+void
+pylith::problems::CouplerBoundary::setSendSubfields(const char* names[],
+                                                    const int numNames) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setSendSubfields(names="<<names<<", numNames="<<numNames<<")");
+
+    assert((names && numNames) || (!names && !numNames));
+
+    _sendSubfieldNames.resize(numNames);
+    for (int i = 0; i < numNames; ++i) {
+        assert(names[i]);
+        _sendSubfieldNames[i] = names[i];
+    } // for
+
+    PYLITH_METHOD_END;
+} // setSendSubfields
+
+
+// ------------------------------------------------------------------------------------------------
+// Set boundary condition and subfield of its auxiliary field receiving values from external code.
+void
+pylith::problems::CouplerBoundary::setReceiveSubfield(const char* identifier,
+                                                      const char* subfieldName) {
+    PYLITH_COMPONENT_DEBUG("setReceiveSubfield(identifier="<<identifier<<", subfieldName="<<subfieldName<<")");
+
+    _recvIdentifier = identifier;
+    _recvSubfieldName = subfieldName;
+} // setReceiveSubfield
+
+
+// ------------------------------------------------------------------------------------------------
+// Set function exchanging values with external code.
+void
+pylith::problems::CouplerBoundary::setExchangeFn(exchangefn_type fn,
+                                                 void* context) {
+    _exchangeFn = fn;
+    _exchangeContext = context;
+} // setExchangeFn
+
+
+// ------------------------------------------------------------------------------------------------
+// Set name of MPI port for connecting to external code.
+void
+pylith::problems::CouplerBoundary::setPortName(const char* value) {
+    PYLITH_COMPONENT_DEBUG("setPortName(value="<<value<<")");
+
+    _portName = value;
+} // setPortName
+
+
+// ------------------------------------------------------------------------------------------------
+// Set time scale.
+void
+pylith::problems::CouplerBoundary::setTimeScale(const PylithReal value) {
+    PYLITH_COMPONENT_DEBUG("setTimeScale(value="<<value<<")");
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Time scale ("<<value<<") for coupler '" << PyreComponent::getIdentifier() << "' must be positive.";
+        throw std::invalid_argument(msg.str());
+    } // if
+    _timeScale = value;
+} // setTimeScale
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::problems::CouplerBoundary::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    if (!_exchangeFn && _portName.empty()) {
+        std::ostringstream msg;
+        msg << "Coupler '" << PyreComponent::getIdentifier()
+            << "' needs an MPI port name or a function for exchanging values with the external code.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+    PetscBool hasLabel = PETSC_FALSE;
+    PetscErrorCode err = DMHasLabel(dmSoln, _labelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+    if (!hasLabel) {
+        std::ostringstream msg;
+        msg << "Mesh missing group of points '" << _labelName << "' for boundary of coupler '"
+            << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    for (size_t i = 0; i < _sendSubfieldNames.size(); ++i) {
+        if (!solution.hasSubfield(_sendSubfieldNames[i].c_str())) {
+            std::ostringstream msg;
+            msg << "Could not find subfield '" << _sendSubfieldNames[i] << "' in solution '" << solution.getLabel()
+                << "' for coupler '" << PyreComponent::getIdentifier() << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // for
+
+    if (!_recvIdentifier.empty() && !_problem) {
+        std::ostringstream msg;
+        msg << "Coupler '" << PyreComponent::getIdentifier() << "' needs the problem to find the auxiliary field of '"
+            << _recvIdentifier << "'.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Exchange values with external code.
+void
+pylith::problems::CouplerBoundary::update(const PylithReal t,
+                                          const PylithInt tindex,
+                                          const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("update(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    if (!_boundaryMesh) {
+        _boundaryMesh = pylith::topology::MeshOps::createLowerDimMesh(solution.getMesh(), _labelName.c_str(), _labelValue);
+        assert(_boundaryMesh);
+
+        const int basisOrder = 1;
+        _sendSubfields.resize(_sendSubfieldNames.size());
+        for (size_t i = 0; i < _sendSubfieldNames.size(); ++i) {
+            _sendSubfields[i] = pylith::meshio::OutputSubfield::create(solution, *_boundaryMesh,
+                                                                      _sendSubfieldNames[i].c_str(), basisOrder);
+        } // for
+    } // if
+    _pack(solution);
+
+    // The boundary condition uses its auxiliary field directly, so the received values are written into it.
+    pylith::topology::Field* recvField = NULL;
+    if (!_recvIdentifier.empty()) {
+        assert(_problem);
+        recvField = const_cast<pylith::topology::Field*>(_problem->getAuxiliaryField(_recvIdentifier.c_str()));
+        _packReceive(*recvField);
+    } else {
+        _recvValues.clear();
+    } // if/else
+
+    const PylithReal tDim = t * _timeScale;
+    if (_exchangeFn) {
+        _exchangeFn(_exchangeContext, tDim, tindex, _sendValues.data(), _sendValues.size(),
+                    _recvValues.data(), _recvValues.size());
+    } // if
+    if (!_portName.empty()) {
+        _exchangeIntercomm(tDim, tindex);
+    } // if
+
+    if (recvField) {
+        _unpackReceive(recvField);
+    } // if
+
+    PYLITH_METHOD_END;
+} // update
+
+
+// ------------------------------------------------------------------------------------------------
+// Pack values of solution subfields on boundary into send buffer.
+void
+pylith::problems::CouplerBoundary::_pack(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscVec solutionVector = solution.getOutputVector();assert(solutionVector);
+
+    _sendValues.clear();
+    PetscErrorCode err;
+    for (size_t i = 0; i < _sendSubfields.size(); ++i) {
+        assert(_sendSubfields[i]);
+        _sendSubfields[i]->project(solutionVector);
+
+        PetscVec subfieldVector = _sendSubfields[i]->getVector();assert(subfieldVector);
+        PetscInt size = 0;
+        const PetscScalar* values = NULL;
+        err = VecGetLocalSize(subfieldVector, &size);PYLITH_CHECK_ERROR(err);
+        err = VecGetArrayRead(subfieldVector, &values);PYLITH_CHECK_ERROR(err);
+        _sendValues.insert(_sendValues.end(), values, values+size);
+        err = VecRestoreArrayRead(subfieldVector, &values);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _pack
+
+
+// ------------------------------------------------------------------------------------------------
+// Pack values of auxiliary subfield into receive buffer.
+void
+pylith::problems::CouplerBoundary::_packReceive(const pylith::topology::Field& field) {
+    PYLITH_METHOD_BEGIN;
+
+    const pylith::topology::Field::SubfieldInfo& info = field.getSubfieldInfo(_recvSubfieldName.c_str());
+    const PylithReal scale = info.description.scale;
+
+    PetscSection section = field.getLocalSection();assert(section);
+    PetscVec localVector = field.getLocalVector();assert(localVector);
+    PetscInt pStart = 0, pEnd = 0;
+    const PetscScalar* values = NULL;
+    PetscErrorCode err;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(localVector, &values);PYLITH_CHECK_ERROR(err);
+
+    _recvValues.clear();
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, off = 0;
+        err = PetscSectionGetFieldDof(section, point, info.index, &dof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldOffset(section, point, info.index, &off);PYLITH_CHECK_ERROR(err);
+        for (PetscInt d = 0; d < dof; ++d) {
+            _recvValues.push_back(values[off+d] * scale);
+        } // for
+    } // for
+    err = VecRestoreArrayRead(localVector, &values);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _packReceive
+
+
+// ------------------------------------------------------------------------------------------------
+// Unpack values in receive buffer into auxiliary subfield.
+void
+pylith::problems::CouplerBoundary::_unpackReceive(pylith::topology::Field* field) {
+    PYLITH_METHOD_BEGIN;
+    assert(field);
+
+    const pylith::topology::Field::SubfieldInfo& info = field->getSubfieldInfo(_recvSubfieldName.c_str());
+    const PylithReal scale = info.description.scale;assert(scale > 0.0);
+
+    PetscSection section = field->getLocalSection();assert(section);
+    PetscVec localVector = field->getLocalVector();assert(localVector);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscScalar* values = NULL;
+    PetscErrorCode err;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(localVector, &values);PYLITH_CHECK_ERROR(err);
+
+    size_t index = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, off = 0;
+        err = PetscSectionGetFieldDof(section, point, info.index, &dof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldOffset(section, point, info.index, &off);PYLITH_CHECK_ERROR(err);
+        for (PetscInt d = 0; d < dof; ++d, ++index) {
+            assert(index < _recvValues.size());
+            values[off+d] = _recvValues[index] / scale;
+        } // for
+    } // for
+    err = VecRestoreArray(localVector, &values);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _unpackReceive
+
+
+// ------------------------------------------------------------------------------------------------
+// Exchange values with external code over intercommunicator.
+void
+pylith::problems::CouplerBoundary::_exchangeIntercomm(const PylithReal t,
+                                                      const PylithInt tindex) {
+    PYLITH_METHOD_BEGIN;
+    assert(_boundaryMesh);
+
+    PetscErrorCode err;
+    const MPI_Comm comm = _boundaryMesh->getComm();
+    if (MPI_COMM_NULL == _intercomm) {
+        std::vector<char> portName(_portName.begin(), _portName.end());
+        portName.push_back('\0');
+        err = MPI_Comm_connect(&portName[0], MPI_INFO_NULL, 0, comm, &_intercomm);PYLITH_CHECK_ERROR(err);
+
+        int localSize = 0, remoteSize = 0;
+        err = MPI_Comm_size(comm, &localSize);PYLITH_CHECK_ERROR(err);
+        err = MPI_Comm_remote_size(_intercomm, &remoteSize);PYLITH_CHECK_ERROR(err);
+        if (localSize != remoteSize) {
+            std::ostringstream msg;
+            msg << "Number of processes of external code (" << remoteSize << ") for coupler '"
+                << PyreComponent::getIdentifier() << "' does not match number of PyLith processes (" << localSize << ").";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
+    // Header: time, time step, number of values sent, and number of values expected.
+    int rank = 0;
+    err = MPI_Comm_rank(comm, &rank);PYLITH_CHECK_ERROR(err);
+    PylithScalar header[4] = { t, PylithScalar(tindex), PylithScalar(_sendValues.size()), PylithScalar(_recvValues.size()) };
+    err = MPI_Send(header, 4, MPIU_SCALAR, rank, 0, _intercomm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Send(_sendValues.data(), _sendValues.size(), MPIU_SCALAR, rank, 1, _intercomm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Recv(_recvValues.data(), _recvValues.size(), MPIU_SCALAR, rank, 2, _intercomm, MPI_STATUS_IGNORE);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _exchangeIntercomm
+
+
+// End of file
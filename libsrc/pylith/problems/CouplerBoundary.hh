@@ -0,0 +1,215 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** @file libsrc/problems/CouplerBoundary.hh
+ *
+ * @brief Observer of the solution that exchanges boundary values with an external code each time step.
+ *
+ * The values of solution subfields projected to the boundary are sent to the external code, and the values received
+ * from the external code replace a subfield of the auxiliary field of a boundary condition (for example,
+ * `initial_amplitude` of a Neumann or Dirichlet boundary condition), which is used in the next time step. The values
+ * are exchanged in memory through a callback function or an MPI intercommunicator.
+ */
+
+#if !defined(pylith_problems_couplerboundary_hh)
+#define pylith_problems_couplerboundary_hh
+
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/problems/ObserverSoln.hh" // ISA ObserverSoln
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+
+#include "pylith/meshio/meshiofwd.hh" // HASA OutputSubfield
+#include "pylith/topology/topologyfwd.hh" // HASA Mesh
+#include "pylith/utils/array.hh" // HASA string_vector
+
+#include <mpi.h> // HASA MPI_Comm
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::problems::CouplerBoundary :
+    public pylith::problems::ObserverSoln,
+    public pylith::utils::PyreComponent {
+    friend class TestCouplerBoundary; // unit testing
+
+    // PUBLIC TYPEDEFS ////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Function exchanging values with external code.
+     *
+     * @param[in] context User context.
+     * @param[in] t Current time (dimensional).
+     * @param[in] tindex Current time step.
+     * @param[in] sendValues Values of solution subfields on boundary (dimensional) [numSendValues].
+     * @param[in] numSendValues Number of values sent.
+     * @param[inout] recvValues Values of auxiliary subfield of boundary condition (dimensional) [numRecvValues].
+     * @param[in] numRecvValues Number of values received.
+     */
+    typedef void (*exchangefn_type)(void* context,
+                                    const PylithReal t,
+                                    const PylithInt tindex,
+                                    const PylithScalar* sendValues,
+                                    const PylithInt numSendValues,
+                                    PylithScalar* recvValues,
+                                    const PylithInt numRecvValues);
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    CouplerBoundary(void);
+
+    /// Destructor
+    ~CouplerBoundary(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set problem with boundary condition receiving values.
+     *
+     * @param[in] problem Problem.
+     */
+    void setProblem(const pylith::problems::Problem* problem);
+
+    /** Set name of label identifying boundary for values sent to external code.
+     *
+     * @param[in] value Name of label.
+     */
+    void setLabelName(const char* value);
+
+    /** Set value of label identifying boundary for values sent to external code.
+     *
+     * @param[in] value Value of label.
+     */
+    void setLabelValue(const int value);
+
+    /** Set names of solution subfields sent to external code.
+     *
+     * @param[in] names Array of names of solution subfields.
+     * @param[in] numNames Length of array.
+     */
+    void setSendSubfields(const char* names[],
+                          const int numNames);
+
+    /** Set boundary condition and subfield of its auxiliary field receiving values from external code.
+     *
+     * @param[in] identifier Identifier of boundary condition.
+     * @param[in] subfieldName Name of auxiliary subfield.
+     */
+    void setReceiveSubfield(const char* identifier,
+                            const char* subfieldName);
+
+    /** Set function exchanging values with external code.
+     *
+     * @param[in] fn Function exchanging values.
+     * @param[in] context User context passed to function.
+     */
+    void setExchangeFn(exchangefn_type fn,
+                       void* context);
+
+    /** Set name of MPI port for connecting to external code.
+     *
+     * The intercommunicator is created with MPI_Comm_connect() when the values are exchanged the first time. The
+     * external code must have the same number of processes; rank i of PyLith exchanges values with rank i of the
+     * external code.
+     *
+     * @param[in] value Name of MPI port (empty if not using an intercommunicator).
+     */
+    void setPortName(const char* value);
+
+    /** Set time scale.
+     *
+     * @param[in] value Time scale for dimensionalizing time.
+     */
+    void setTimeScale(const PylithReal value);
+
+    /** Verify observer is compatible with solution.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Receive update (subject of observer).
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void update(const PylithReal t,
+                const PylithInt tindex,
+                const pylith::topology::Field& solution);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Pack values of solution subfields on boundary into send buffer.
+     *
+     * @param[in] solution Solution field.
+     */
+    void _pack(const pylith::topology::Field& solution);
+
+    /** Pack values of auxiliary subfield into receive buffer.
+     *
+     * @param[in] field Auxiliary field of boundary condition.
+     */
+    void _packReceive(const pylith::topology::Field& field);
+
+    /** Unpack values in receive buffer into auxiliary subfield.
+     *
+     * @param[inout] field Auxiliary field of boundary condition.
+     */
+    void _unpackReceive(pylith::topology::Field* field);
+
+    /** Exchange values with external code over intercommunicator.
+     *
+     * @param[in] t Current time (dimensional).
+     * @param[in] tindex Current time step.
+     */
+    void _exchangeIntercomm(const PylithReal t,
+                            const PylithInt tindex);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    const pylith::problems::Problem* _problem; ///< Problem with boundary condition receiving values.
+    pylith::topology::Mesh* _boundaryMesh; ///< Mesh of boundary for values sent.
+    std::vector<pylith::meshio::OutputSubfield*> _sendSubfields; ///< Solution subfields projected to boundary.
+    pylith::string_vector _sendSubfieldNames; ///< Names of solution subfields sent.
+    std::string _labelName; ///< Name of label identifying boundary.
+    int _labelValue; ///< Value of label identifying boundary.
+    std::string _recvIdentifier; ///< Identifier of boundary condition receiving values.
+    std::string _recvSubfieldName; ///< Name of auxiliary subfield receiving values.
+    std::string _portName; ///< Name of MPI port for intercommunicator.
+    MPI_Comm _intercomm; ///< Intercommunicator with external code.
+    exchangefn_type _exchangeFn; ///< Function exchanging values.
+    void* _exchangeContext; ///< User context for function exchanging values.
+    std::vector<PylithScalar> _sendValues; ///< Buffer with values sent.
+    std::vector<PylithScalar> _recvValues; ///< Buffer with values received.
+    PylithReal _timeScale; ///< Time scale for dimensionalizing time.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    CouplerBoundary(const CouplerBoundary&); ///< Not implemented.
+    const CouplerBoundary& operator=(const CouplerBoundary&); ///< Not implemented
+
+}; // CouplerBoundary
+
+#endif // pylith_problems_couplerboundary_hh
+
+// End of file
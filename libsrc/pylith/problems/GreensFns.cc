@@ -24,19 +24,26 @@
 #include "pylith/topology/Field.hh" // USES Field
 
 #include "pylith/faults/FaultCohesiveImpulses.hh" // USES FaultCohesiveImpulses
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
 #include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface
 #include "pylith/feassemble/Constraint.hh" // USES Constraint
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
 #include "pylith/problems/ProgressMonitorStep.hh" // USES ProgressMonitorStep
+#include "pylith/meshio/PointInterpolator.hh" // USES PointInterpolator
 #include "pylith/utils/PetscOptions.hh" // USES SolverDefaults
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 
 #include "petscsnes.h" // USES PetscSNES
+#include "petscksp.h" // USES KSPMatSolve()
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include <cassert> // USES assert()
+#include <algorithm> // USES std::min()
+#include <map> // USES std::map
 
 // ------------------------------------------------------------------------------------------------
 namespace pylith {
@@ -57,13 +64,27 @@ pylith::problems::GreensFns::GreensFns(void) :
     _faultLabelName(pylith::topology::Mesh::cells_label_name),
     _faultLabelValue(100),
     _faultImpulses(NULL),
+    _faultScenarios(NULL),
     _integratorImpulses(NULL),
+    _impulseBatchSize(1),
+    _numImpulseGroups(1),
+    _initialGuessSize(8),
+    _deflationSize(0),
+    _deflationNumVectors(0),
+    _deflationMat(NULL),
+    _localizedResidual(false),
+    _residualBaseVec(NULL),
+    _surrogateRank(0),
+    _responseMat(NULL),
+    _responseCoefMat(NULL),
+    _reciprocalSpaceDim(0),
+    _reciprocalFilename("greensfns-reciprocal.bin"),
     _snes(NULL),
     _monitor(NULL) {
     PyreComponent::setName(_GreensFns::pyreComponent);
 
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_jacobian, -1.0);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, -HUGE_VAL);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_JACOBIAN, -1.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_T_STATE, -HUGE_VAL);
 } // constructor
 
 
@@ -83,11 +104,19 @@ pylith::problems::GreensFns::deallocate(void) {
     Problem::deallocate();
 
     _faultImpulses = NULL; // Memory handle in Python. :TODO: Use shared pointer.
+    _faultScenarios = NULL; // Memory handle in Python. :TODO: Use shared pointer.
     _integratorImpulses = NULL; // Memory handle in Problem. :TODO: Use shared pointer.
 
     _monitor = NULL; // Memory handle in Python. :TODO: Use shared pointer.
+    _surrogateSlipDBs.clear(); // Memory handle in Python. :TODO: Use shared pointer.
 
     PetscErrorCode err = SNESDestroy(&_snes);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_responseMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_responseCoefMat);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_residualBaseVec);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_deflationMat);PYLITH_CHECK_ERROR(err);
+    _deflationNumVectors = 0;
+    pylith::utils::MemoryLogger::release(this);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -133,6 +162,199 @@ pylith::problems::GreensFns::getFaultLabelValue(void) const {
 } // getFaultLabelValue
 
 
+// ------------------------------------------------------------------------------------------------
+// Set number of impulses solved together as a block of right-hand sides.
+void
+pylith::problems::GreensFns::setImpulseBatchSize(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setImpulseBatchSize(value="<<value<<")");
+
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Number of impulses in each block of right-hand sides (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _impulseBatchSize = value;
+} // setImpulseBatchSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of impulses solved together as a block of right-hand sides.
+size_t
+pylith::problems::GreensFns::getImpulseBatchSize(void) const {
+    return _impulseBatchSize;
+} // getImpulseBatchSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Set number of process groups solving impulses concurrently.
+void
+pylith::problems::GreensFns::setNumImpulseGroups(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setNumImpulseGroups(value="<<value<<")");
+
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Number of process groups for solving impulses (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _numImpulseGroups = value;
+} // setNumImpulseGroups
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of process groups solving impulses concurrently.
+size_t
+pylith::problems::GreensFns::getNumImpulseGroups(void) const {
+    return _numImpulseGroups;
+} // getNumImpulseGroups
+
+
+// ------------------------------------------------------------------------------------------------
+// Set number of previous impulse solutions retained in the initial guess basis.
+void
+pylith::problems::GreensFns::setInitialGuessSize(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setInitialGuessSize(value="<<value<<")");
+
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Number of solutions in initial guess basis (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _initialGuessSize = value;
+} // setInitialGuessSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of previous impulse solutions retained in the initial guess basis.
+size_t
+pylith::problems::GreensFns::getInitialGuessSize(void) const {
+    return _initialGuessSize;
+} // getInitialGuessSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Set number of previous impulse solutions in deflation space of preconditioner.
+void
+pylith::problems::GreensFns::setDeflationSize(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setDeflationSize(value="<<value<<")");
+
+    _deflationSize = value;
+} // setDeflationSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of previous impulse solutions in deflation space of preconditioner.
+size_t
+pylith::problems::GreensFns::getDeflationSize(void) const {
+    return _deflationSize;
+} // getDeflationSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Set flag for assembling right-hand side of each impulse over the cohesive cells in its support.
+void
+pylith::problems::GreensFns::setLocalizedResidual(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setLocalizedResidual(value="<<value<<")");
+
+    _localizedResidual = value;
+} // setLocalizedResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Get flag for assembling right-hand side of each impulse over the cohesive cells in its support.
+bool
+pylith::problems::GreensFns::getLocalizedResidual(void) const {
+    return _localizedResidual;
+} // getLocalizedResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Add slip distribution for prediction with the surrogate model.
+void
+pylith::problems::GreensFns::addSurrogateSlip(spatialdata::spatialdb::SpatialDB* db) {
+    PYLITH_COMPONENT_DEBUG("addSurrogateSlip(db="<<db<<")");
+
+    if (!db) {
+        throw std::runtime_error("Missing spatial database for slip distribution of surrogate model.");
+    } // if
+
+    _surrogateSlipDBs.push_back(db); // :KLUDGE: :TODO: Use shared pointer.
+} // addSurrogateSlip
+
+
+// ------------------------------------------------------------------------------------------------
+// Set rank of compressed response matrix for surrogate model.
+void
+pylith::problems::GreensFns::setSurrogateRank(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setSurrogateRank(value="<<value<<")");
+
+    _surrogateRank = value;
+} // setSurrogateRank
+
+
+// ------------------------------------------------------------------------------------------------
+// Get rank of compressed response matrix for surrogate model.
+size_t
+pylith::problems::GreensFns::getSurrogateRank(void) const {
+    return _surrogateRank;
+} // getSurrogateRank
+
+
+// ------------------------------------------------------------------------------------------------
+// Set points for computing Green's functions using reciprocity.
+void
+pylith::problems::GreensFns::setReciprocalPoints(const PylithReal* pointCoords,
+                                                 const int numPoints,
+                                                 const int spaceDim,
+                                                 const char* const* pointNames,
+                                                 const int numPointNames) {
+    PYLITH_COMPONENT_DEBUG("setReciprocalPoints(pointCoords="<<pointCoords<<", numPoints="<<numPoints<<", spaceDim="<<spaceDim
+                                                              <<", pointNames="<<pointNames<<", numPointNames="<<numPointNames<<")");
+
+    if (numPoints != numPointNames) {
+        std::ostringstream msg;
+        msg << "Number of points (" << numPoints << ") and number of point names (" << numPointNames
+            << ") for reciprocal Green's functions must match.";
+        throw std::runtime_error(msg.str());
+    } // if
+    assert(!numPoints || (pointCoords && pointNames));
+
+    _reciprocalSpaceDim = spaceDim;
+    _reciprocalPointCoords.resize(numPoints*spaceDim);
+    for (int i = 0; i < numPoints*spaceDim; ++i) {
+        _reciprocalPointCoords[i] = pointCoords[i];
+    } // for
+    _reciprocalPointNames.resize(numPoints);
+    for (int i = 0; i < numPoints; ++i) {
+        _reciprocalPointNames[i] = pointNames[i];
+    } // for
+} // setReciprocalPoints
+
+
+// ------------------------------------------------------------------------------------------------
+// Set name of PETSc binary file for Green's functions computed using reciprocity.
+void
+pylith::problems::GreensFns::setReciprocalFilename(const char* value) {
+    PYLITH_COMPONENT_DEBUG("setReciprocalFilename(value="<<value<<")");
+
+    if (strlen(value) == 0) {
+        throw std::runtime_error("Empty string given for name of file for reciprocal Green's functions.");
+    } // if
+
+    _reciprocalFilename = value;
+} // setReciprocalFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Get name of PETSc binary file for Green's functions computed using reciprocity.
+const char*
+pylith::problems::GreensFns::getReciprocalFilename(void) const {
+    return _reciprocalFilename.c_str();
+} // getReciprocalFilename
+
+
 // ------------------------------------------------------------------------------------------------
 // Set progress monitor.
 void
@@ -163,23 +385,25 @@ pylith::problems::GreensFns::verifyConfiguration(void) const {
 
     Problem::verifyConfiguration();
 
-    // Verify we have fault for the impulses.
+    // Verify we have fault for the impulses. Kinematic ruptures on a FaultCohesiveKin fault are solved as static slip
+    // scenarios, one rupture per impulse.
     const size_t numInterfaces = _interfaces.size();
-    pylith::faults::FaultCohesiveImpulses* faultImpulses = NULL;
+    bool hasFault = false;
     for (size_t i = 0; i < numInterfaces; ++i) {
         if ((_faultLabelName == std::string(_interfaces[i]->getSurfaceLabelName())) &&
             (_faultLabelValue == _interfaces[i]->getSurfaceLabelValue())) {
-            faultImpulses = dynamic_cast<pylith::faults::FaultCohesiveImpulses*>(_interfaces[i]);
-            if (!faultImpulses) {
+            if (!dynamic_cast<pylith::faults::FaultCohesiveImpulses*>(_interfaces[i]) &&
+                !dynamic_cast<pylith::faults::FaultCohesiveKin*>(_interfaces[i])) {
                 std::ostringstream msg;
                 msg << "Found fault with "<<_faultLabelName<<"="<<_faultLabelValue
-                    <<" in interfaces for imposing impulses, but type is not FaultCohesiveImpulses.";
+                    <<" in interfaces for imposing impulses, but type is not FaultCohesiveImpulses or FaultCohesiveKin.";
                 throw std::runtime_error(msg.str());
             } // if
+            hasFault = true;
             break;
         } // if
     } // for
-    if (!faultImpulses) {
+    if (!hasFault) {
         std::ostringstream msg;
         msg << "Could not find fault with "<<_faultLabelName<<"="<<_faultLabelValue<<" in interfaces for imposing impulses.";
         throw std::runtime_error(msg.str());
@@ -202,18 +426,33 @@ pylith::problems::GreensFns::initialize(void) {
 
     // Find fault on which to put the impulses.
     assert(!_faultImpulses);
+    assert(!_faultScenarios);
     const size_t numInterfaces = _interfaces.size();
     for (size_t i = 0; i < numInterfaces; ++i) {
         if ((_faultLabelName == std::string(_interfaces[i]->getSurfaceLabelName())) &&
             (_faultLabelValue == _interfaces[i]->getSurfaceLabelValue())) {
             _faultImpulses = dynamic_cast<pylith::faults::FaultCohesiveImpulses*>(_interfaces[i]);
+            _faultScenarios = dynamic_cast<pylith::faults::FaultCohesiveKin*>(_interfaces[i]);
         } // if
     } // for
-    assert(_faultImpulses);
+    assert(_faultImpulses || _faultScenarios);
+    if (!_faultImpulses && !_surrogateSlipDBs.empty()) {
+        std::ostringstream msg;
+        msg << "Surrogate model predictions require impulses on fault with "<<_faultLabelName<<"="<<_faultLabelValue
+            << " (FaultCohesiveImpulses).";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (_faultImpulses && _faultImpulses->hasImpulsePatches() && !_surrogateSlipDBs.empty()) {
+        throw std::runtime_error("Surrogate model predictions require impulses at points rather than over patches.");
+    } // if
+    if (!_reciprocalPointNames.empty() && !_surrogateSlipDBs.empty()) {
+        throw std::runtime_error("Surrogate model predictions require the responses to the impulses, which are not "
+                                 "computed with reciprocal Green's functions.");
+    } // if
 
     PetscErrorCode err = SNESDestroy(&_snes);PYLITH_CHECK_ERROR(err);assert(!_snes);
     assert(_integrationData);
-    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
 
     err = SNESCreate(solution->getMesh().getComm(), &_snes);PYLITH_CHECK_ERROR(err);assert(_snes);
@@ -225,18 +464,16 @@ pylith::problems::GreensFns::initialize(void) {
     err = SNESSetSolution(_snes, solutionVector);PYLITH_CHECK_ERROR(err);
 
     // Initialize solution_dot.
-    pylith::topology::Field* solutionDot = new pylith::topology::Field(*solution);assert(solutionDot);
-    solutionDot->setLabel("solution_dot");
+    pylith::topology::Field* solutionDot = new pylith::topology::Field(*solution, "solution_dot");assert(solutionDot);
     _integrationData->setField(pylith::feassemble::IntegrationData::solution_dot, solutionDot);
 
     // Initialize residual.
-    pylith::topology::Field* residual = new pylith::topology::Field(*solution);assert(residual);
-    residual->setLabel("residual");
+    pylith::topology::Field* residual = new pylith::topology::Field(*solution, "residual");assert(residual);
     _integrationData->setField(pylith::feassemble::IntegrationData::residual, residual);
 
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, 0.0);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, 1.0);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::s_tshift, 0.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME, 0.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP, 1.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_S_TSHIFT, 0.0);
 
     switch (_formulation) {
     case pylith::problems::Physics::QUASISTATIC:
@@ -245,6 +482,7 @@ pylith::problems::GreensFns::initialize(void) {
         err = SNESSetJacobian(_snes, NULL, NULL, computeJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
         err = SNESSetType(_snes, SNESKSPONLY);PYLITH_CHECK_ERROR(err);
         err = SNESSetLagJacobian(_snes, -2);PYLITH_CHECK_ERROR(err);
+        err = SNESSetLagPreconditioner(_snes, -2);PYLITH_CHECK_ERROR(err);
         break;
     case pylith::problems::Physics::DYNAMIC_IMEX:
         PYLITH_COMPONENT_LOGICERROR("Dynamic Green's functions problems not yet supported.");
@@ -257,9 +495,12 @@ pylith::problems::GreensFns::initialize(void) {
     } // default
     } // switch
 
-    pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults);
+    _setSplitNodeSolverDefaults();
+    pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults, pylith::utils::PetscDefaults::NEWTON,
+                                      _initialGuessSize);
     err = SNESSetFromOptions(_snes);PYLITH_CHECK_ERROR(err);
     err = SNESSetUp(_snes);PYLITH_CHECK_ERROR(err);
+    _setPreconditionerHints(_snes);
 
     // Get integrator for fault with impulses.
     assert(!_integratorImpulses);
@@ -276,7 +517,7 @@ pylith::problems::GreensFns::initialize(void) {
         throw std::runtime_error(msg.str());
     } // if
 
-    pythia::journal::debug_t debug(pylith::utils::PyreComponent::getName());
+    pythia::journal::debug_t& debug = pylith::utils::PyreComponent::getDebugJournal();
     if (debug.state()) {
         PetscDS dsSoln = NULL;
         err = DMGetDS(solution->getDM(), &dsSoln);PYLITH_CHECK_ERROR(err);
@@ -300,46 +541,45 @@ pylith::problems::GreensFns::solve(void) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("solve()");
 
-    assert(_integrationData);
-    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
-    assert(solution);
-    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
-
-    PetscErrorCode err;
-    int mpiRank = 0;
-    int mpiNumProcs = 0;
-    PetscDM dm = getPetscDM();
-    MPI_Comm comm = PetscObjectComm((PetscObject)dm);
-    err = MPI_Comm_rank(comm, &mpiRank);
-    err = MPI_Comm_size(comm, &mpiNumProcs);PYLITH_CHECK_ERROR(err);
-
-    PetscInt numImpulsesLocal = _faultImpulses->getNumImpulsesLocal();
-    PYLITH_COMPONENT_DEBUG("[" << mpiRank << "] Contributing " << numImpulsesLocal << " impulses for Green's functions.");
-    int_array numImpulses(mpiNumProcs);
-    err = MPI_Allgather(&numImpulsesLocal, 1, MPI_INT, &numImpulses[0], 1, MPI_INT, comm);PYLITH_CHECK_ERROR(err);
-
-    size_t numImpulsesGlobal = 0;
-    for (int iProc = 0; iProc < mpiNumProcs; ++iProc) {
-        numImpulsesGlobal += numImpulses[iProc];
-    } // for
-
-    const PylithReal tolerance = 1.0e-4;
-    for (int iProc = 0, iImpulseGlobal = 0; iProc < mpiNumProcs; ++iProc) {
-        for (int iImpulseLocal = 0; iImpulseLocal < numImpulses[iProc]; ++iImpulseLocal, ++iImpulseGlobal) {
-            if (0 == mpiRank) {
-                PYLITH_COMPONENT_INFO_ROOT("Computing Green's function " << iImpulseGlobal+1 << " of " << numImpulsesGlobal << ".");
-            } // if
-
-            // Update impulse on fault
-            const PetscReal impulseReal = (mpiRank == iProc) ? iImpulseLocal + tolerance : -1.0;
-            _integratorImpulses->setState(impulseReal);
+    _createImpulseSchedule();
+
+    PetscErrorCode err = MatDestroy(&_responseMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_responseCoefMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_deflationMat);PYLITH_CHECK_ERROR(err);
+    _deflationNumVectors = 0;
+    if (!_surrogateSlipDBs.empty()) {
+        assert(_integrationData);
+        PetscVec solutionVec = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION)->getGlobalVector();
+        PetscInt numRowsLocal = 0;
+        PetscInt numRows = 0;
+        err = VecGetLocalSize(solutionVec, &numRowsLocal);PYLITH_CHECK_ERROR(err);
+        err = VecGetSize(solutionVec, &numRows);PYLITH_CHECK_ERROR(err);
+        const PetscInt numImpulsesGlobal = _impulseProc.size();
+        err = MatCreateDense(PetscObjectComm((PetscObject)solutionVec), numRowsLocal, PETSC_DECIDE, numRows, numImpulsesGlobal,
+                             NULL, &_responseMat);PYLITH_CHECK_ERROR(err);
+        pylith::utils::MemoryLogger::record(this, "Green's functions", "response matrix",
+                                            size_t(numRowsLocal)*numImpulsesGlobal*sizeof(PetscScalar));
+    } // if
 
-            err = SNESSolve(_snes, residual->getGlobalVector(), solution->getGlobalVector());PYLITH_CHECK_ERROR(err);
-            solution->scatterVectorToLocal(solution->getGlobalVector());
-            solution->scatterLocalToOutput();
-            poststep(size_t(iImpulseGlobal), numImpulsesGlobal);
-        } // for
-    } // for
+    if (!_reciprocalPointNames.empty()) {
+        _solveReciprocal();
+    } else if (_numImpulseGroups > 1) {
+        _solveGroups();
+    } else if (_impulseBatchSize > 1) {
+        _solveBatch();
+    } else {
+        _solveSingle();
+    } // if/else
+
+    if (_responseMat) {
+        err = MatAssemblyBegin(_responseMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+        err = MatAssemblyEnd(_responseMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+        if (_surrogateRank > 0) {
+            _compressResponse();
+        } // if
+        _evaluateSurrogate();
+    } // if
+    err = VecDestroy(&_residualBaseVec);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // solve
@@ -358,9 +598,13 @@ pylith::problems::GreensFns::poststep(const size_t impulse,
     const PetscReal dt = 1.0;
 
     assert(_integrationData);
-    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
 
+    if (_responseMat && (impulse < _impulseProc.size())) {
+        _storeResponse(impulse);
+    } // if
+
     // Update integrators.
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
@@ -392,11 +636,11 @@ pylith::problems::GreensFns::poststep(const size_t impulse,
 void
 pylith::problems::GreensFns::setSolutionLocal(PetscVec solutionVec) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("setSolutionLocal(solutionVec="<<solutionVec<<")");
+    PYLITH_COMPONENT_DEBUG_CALLBACK("setSolutionLocal(solutionVec="<<solutionVec<<")");
 
     // Update PyLith view of the solution.
     assert(_integrationData);
-    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
     solution->scatterVectorToLocal(solutionVec);
 
     const size_t numConstraints = _constraints.size();
@@ -416,12 +660,12 @@ void
 pylith::problems::GreensFns::computeResidual(PetscVec residualVec,
                                              PetscVec solutionVec) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("computeResidual(solutionVec="<<solutionVec<<", residualVec="<<residualVec<<")");
+    PYLITH_COMPONENT_DEBUG_CALLBACK("computeResidual(solutionVec="<<solutionVec<<", residualVec="<<residualVec<<")");
 
     assert(residualVec);
     assert(solutionVec);
     assert(_integrationData);
-    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);
+    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_RESIDUAL);
     assert(residual);
 
     // Update PyLith view of the solution.
@@ -450,13 +694,13 @@ pylith::problems::GreensFns::computeJacobian(PetscMat jacobianMat,
                                              PetscMat precondMat,
                                              PetscVec solutionVec) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("GreensFns::computeJacobian(solutionVec="<<solutionVec<<",jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<")");
+    PYLITH_COMPONENT_DEBUG_CALLBACK("GreensFns::computeJacobian(solutionVec="<<solutionVec<<",jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<")");
 
     assert(jacobianMat);
     assert(solutionVec);
 
     assert(_integrationData);
-    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
 
     // Zero Jacobian
@@ -489,6 +733,11 @@ pylith::problems::GreensFns::computeJacobian(PetscMat jacobianMat,
     err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);
     err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);
 
+    // Nonzero pattern is fixed after first assembly.
+    if (jacobianMat != precondMat) { _reuseJacobianPattern(jacobianMat); }
+    _reuseJacobianPattern(precondMat);
+    _recordJacobianMemory(jacobianMat, precondMat);
+
     PYLITH_METHOD_END;
 } // computeJacobian
 
@@ -501,9 +750,7 @@ pylith::problems::GreensFns::computeResidual(PetscSNES snes,
                                              PetscVec residualVec,
                                              void* context) {
     PYLITH_METHOD_BEGIN;
-    pythia::journal::debug_t debug(_GreensFns::pyreComponent);
-    debug << pythia::journal::at(__HERE__)
-          << "computeResidual(snes="<<snes<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+    PYLITH_DEBUG_CALLBACK(_GreensFns::pyreComponent, "computeResidual(snes="<<snes<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")");
 
     pylith::problems::GreensFns* problem = (pylith::problems::GreensFns*)context;
     problem->computeResidual(residualVec, solutionVec);
@@ -521,10 +768,7 @@ pylith::problems::GreensFns::computeJacobian(PetscSNES snes,
                                              PetscMat precondMat,
                                              void* context) {
     PYLITH_METHOD_BEGIN;
-    pythia::journal::debug_t debug(_GreensFns::pyreComponent);
-    debug << pythia::journal::at(__HERE__)
-          << "computeJacobian(snes="<<snes<<", solutionVec="<<solutionVec<<", jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", context="<<context<<")" <<
-        pythia::journal::endl;
+    PYLITH_DEBUG_CALLBACK(_GreensFns::pyreComponent, "computeJacobian(snes="<<snes<<", solutionVec="<<solutionVec<<", jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", context="<<context<<")");
 
     pylith::problems::GreensFns* problem = (pylith::problems::GreensFns*)context;
     problem->computeJacobian(jacobianMat, precondMat, solutionVec);
@@ -533,4 +777,886 @@ pylith::problems::GreensFns::computeJacobian(PetscSNES snes,
 } // computeJacobian
 
 
+// ------------------------------------------------------------------------------------------------
+// Create schedule of impulses (process and local index of each global impulse).
+void
+pylith::problems::GreensFns::_createImpulseSchedule(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_createImpulseSchedule()");
+
+    assert(_faultImpulses || _faultScenarios);
+
+    // Every process contributes to each slip scenario.
+    if (_faultScenarios) {
+        const size_t numScenarios = _faultScenarios->getNumRuptures();
+        PYLITH_COMPONENT_DEBUG("Solving " << numScenarios << " kinematic rupture slip scenarios.");
+        _impulseProc.resize(numScenarios);
+        _impulseLocal.resize(numScenarios);
+        for (size_t iScenario = 0; iScenario < numScenarios; ++iScenario) {
+            _impulseProc[iScenario] = -1;
+            _impulseLocal[iScenario] = iScenario;
+        } // for
+        PYLITH_METHOD_END;
+    } // if
+
+    // Every process contributes to each patch impulse.
+    if (_faultImpulses->hasImpulsePatches()) {
+        const size_t numImpulses = _faultImpulses->getNumImpulsesLocal();
+        _impulseProc.resize(numImpulses);
+        _impulseLocal.resize(numImpulses);
+        for (size_t iImpulse = 0; iImpulse < numImpulses; ++iImpulse) {
+            _impulseProc[iImpulse] = -1;
+            _impulseLocal[iImpulse] = iImpulse;
+        } // for
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscErrorCode err;
+    int mpiRank = 0;
+    int mpiNumProcs = 0;
+    PetscDM dm = getPetscDM();
+    MPI_Comm comm = PetscObjectComm((PetscObject)dm);
+    err = MPI_Comm_rank(comm, &mpiRank);
+    err = MPI_Comm_size(comm, &mpiNumProcs);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numImpulsesLocal = _faultImpulses->getNumImpulsesLocal();
+    PYLITH_COMPONENT_DEBUG("[" << mpiRank << "] Contributing " << numImpulsesLocal << " impulses for Green's functions.");
+    int_array numImpulses(mpiNumProcs);
+    err = MPI_Allgather(&numImpulsesLocal, 1, MPI_INT, &numImpulses[0], 1, MPI_INT, comm);PYLITH_CHECK_ERROR(err);
+
+    _impulseProc.clear();
+    _impulseLocal.clear();
+    for (int iProc = 0; iProc < mpiNumProcs; ++iProc) {
+        for (int iImpulseLocal = 0; iImpulseLocal < numImpulses[iProc]; ++iImpulseLocal) {
+            _impulseProc.push_back(iProc);
+            _impulseLocal.push_back(iImpulseLocal);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _createImpulseSchedule
+
+
+// ------------------------------------------------------------------------------------------------
+// Set state of fault with impulses for impulse.
+void
+pylith::problems::GreensFns::_setImpulse(const size_t impulse) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setImpulse(impulse="<<impulse<<")");
+
+    assert(impulse < _impulseProc.size());
+    assert(_integratorImpulses);
+
+    // Slip scenarios only refill the slip subfield; the mesh and operator are unchanged.
+    if (_faultScenarios) {
+        _faultScenarios->setScenarioRupture(_impulseLocal[impulse]);
+        _integratorImpulses->setState(0.0);
+        PYLITH_METHOD_END;
+    } // if
+
+    int mpiRank = 0;
+    MPI_Comm comm = PetscObjectComm((PetscObject)getPetscDM());
+    PetscErrorCode err = MPI_Comm_rank(comm, &mpiRank);PYLITH_CHECK_ERROR(err);
+
+    const PylithReal tolerance = 1.0e-4;
+    const bool hasImpulse = (_impulseProc[impulse] < 0) || (mpiRank == _impulseProc[impulse]);
+    const PetscReal impulseReal = hasImpulse ? _impulseLocal[impulse] + tolerance : -1.0;
+    _integratorImpulses->setState(impulseReal);
+
+    PYLITH_METHOD_END;
+} // _setImpulse
+
+
+// ------------------------------------------------------------------------------------------------
+// Solve for impulses one at a time.
+void
+pylith::problems::GreensFns::_solveSingle(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_solveSingle()");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    PetscErrorCode err;
+    const size_t numImpulsesGlobal = _impulseProc.size();
+    for (size_t iImpulse = 0; iImpulse < numImpulsesGlobal; ++iImpulse) {
+        PYLITH_COMPONENT_INFO_ROOT("Computing Green's function " << iImpulse+1 << " of " << numImpulsesGlobal << ".");
+
+        // Update impulse on fault
+        _setImpulse(iImpulse);
+
+        err = SNESSolve(_snes, NULL, solution->getGlobalVector());PYLITH_CHECK_ERROR(err);
+        solution->scatterVectorToLocal(solution->getGlobalVector());
+        solution->scatterLocalToOutput();
+        poststep(iImpulse, numImpulsesGlobal);
+
+        if (_addDeflationVector(solution->getGlobalVector())) {
+            _setDeflation();
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // _solveSingle
+
+
+// ------------------------------------------------------------------------------------------------
+// Solve for impulses in blocks of right-hand sides.
+void
+pylith::problems::GreensFns::_solveBatch(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_solveBatch()");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    PetscErrorCode err;
+    PetscVec solutionVec = solution->getGlobalVector();assert(solutionVec);
+    PetscVec zeroVec = NULL;
+    err = VecDuplicate(solutionVec, &zeroVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(zeroVec, 0.0);PYLITH_CHECK_ERROR(err);
+
+    // The Jacobian does not depend on the impulse, so we form it once and use it for all blocks.
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
+    PetscKSP ksp = NULL;
+    err = SNESGetJacobian(_snes, &jacobianMat, &precondMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    err = SNESComputeJacobian(_snes, zeroVec, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
+    err = SNESGetKSP(_snes, &ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(ksp, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
+    err = KSPSetUp(ksp);PYLITH_CHECK_ERROR(err);
+
+    MPI_Comm comm = PetscObjectComm((PetscObject)solutionVec);
+    PetscInt numRowsLocal = 0;
+    PetscInt numRows = 0;
+    err = VecGetLocalSize(solutionVec, &numRowsLocal);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(solutionVec, &numRows);PYLITH_CHECK_ERROR(err);
+
+    const size_t numImpulsesGlobal = _impulseProc.size();
+    PetscMat rhsMat = NULL;
+    PetscMat blockSolnMat = NULL;
+    PetscInt numColumns = 0;
+    for (size_t iStart = 0; iStart < numImpulsesGlobal; iStart += _impulseBatchSize) {
+        const PetscInt numBatch = std::min(_impulseBatchSize, numImpulsesGlobal - iStart);
+        if (numBatch != numColumns) {
+            err = MatDestroy(&rhsMat);PYLITH_CHECK_ERROR(err);
+            err = MatDestroy(&blockSolnMat);PYLITH_CHECK_ERROR(err);
+            err = MatCreateDense(comm, numRowsLocal, PETSC_DECIDE, numRows, numBatch, NULL, &rhsMat);PYLITH_CHECK_ERROR(err);
+            err = MatDuplicate(rhsMat, MAT_DO_NOT_COPY_VALUES, &blockSolnMat);PYLITH_CHECK_ERROR(err);
+            numColumns = numBatch;
+        } // if
+
+        PYLITH_COMPONENT_INFO_ROOT("Computing Green's functions " << iStart+1 << "-" << iStart+numBatch << " of " << numImpulsesGlobal << ".");
+
+        // Right-hand side for each impulse is -F(0), consistent with the linear solve in SNESKSPONLY.
+        for (PetscInt iBatch = 0; iBatch < numBatch; ++iBatch) {
+            PetscVec rhsVec = NULL;
+            err = MatDenseGetColumnVecWrite(rhsMat, iBatch, &rhsVec);PYLITH_CHECK_ERROR(err);
+            _computeImpulseRHS(rhsVec, zeroVec, iStart + iBatch);
+            err = MatDenseRestoreColumnVecWrite(rhsMat, iBatch, &rhsVec);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        err = KSPMatSolve(ksp, rhsMat, blockSolnMat);PYLITH_CHECK_ERROR(err);
+
+        for (PetscInt iBatch = 0; iBatch < numBatch; ++iBatch) {
+            const size_t impulse = iStart + iBatch;
+
+            // Restore state for impulse so integrators and observers see consistent auxiliary fields.
+            _setImpulse(impulse);
+
+            PetscVec columnVec = NULL;
+            err = MatDenseGetColumnVecRead(blockSolnMat, iBatch, &columnVec);PYLITH_CHECK_ERROR(err);
+            err = VecCopy(columnVec, solutionVec);PYLITH_CHECK_ERROR(err);
+            err = MatDenseRestoreColumnVecRead(blockSolnMat, iBatch, &columnVec);PYLITH_CHECK_ERROR(err);
+
+            solution->scatterVectorToLocal(solutionVec);
+            solution->scatterLocalToOutput();
+            poststep(impulse, numImpulsesGlobal);
+
+            if (_addDeflationVector(solutionVec)) {
+                _setDeflation();
+            } // if
+        } // for
+    } // for
+
+    err = MatDestroy(&rhsMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&blockSolnMat);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&zeroVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _solveBatch
+
+
+// ------------------------------------------------------------------------------------------------
+// Solve for impulses concurrently on groups of processes.
+void
+pylith::problems::GreensFns::_solveGroups(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_solveGroups()");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    PetscErrorCode err;
+    PetscVec solutionVec = solution->getGlobalVector();assert(solutionVec);
+    MPI_Comm comm = PetscObjectComm((PetscObject)solutionVec);
+    int mpiRank = 0;
+    int mpiNumProcs = 0;
+    err = MPI_Comm_rank(comm, &mpiRank);
+    err = MPI_Comm_size(comm, &mpiNumProcs);PYLITH_CHECK_ERROR(err);
+
+    const int numGroups = _numImpulseGroups;
+    if (numGroups > mpiNumProcs) {
+        std::ostringstream msg;
+        msg << "Number of process groups for solving impulses (" << numGroups << ") exceeds number of processes ("
+            << mpiNumProcs << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Use contiguous groups of processes (same layout as PCREDUNDANT), so group blocks are contiguous in vectors.
+    int group = 0;
+    for (int iGroup = 0, rankStart = 0; iGroup < numGroups; ++iGroup) {
+        const int groupSize = mpiNumProcs / numGroups + ((iGroup < mpiNumProcs % numGroups) ? 1 : 0);
+        if (mpiRank < rankStart + groupSize) {
+            group = iGroup;
+            break;
+        } // if
+        rankStart += groupSize;
+    } // for
+    MPI_Comm groupComm = MPI_COMM_NULL;
+    err = MPI_Comm_split(comm, group, mpiRank, &groupComm);PYLITH_CHECK_ERROR(err);
+
+    PetscVec zeroVec = NULL;
+    PetscVec rhsVec = NULL;
+    err = VecDuplicate(solutionVec, &zeroVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &rhsVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(zeroVec, 0.0);PYLITH_CHECK_ERROR(err);
+
+    // The Jacobian does not depend on the impulse, so we form it once and give each group a copy.
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
+    err = SNESGetJacobian(_snes, &jacobianMat, &precondMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    err = SNESComputeJacobian(_snes, zeroVec, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
+
+    PetscMat jacobianGroup = NULL;
+    PetscMat precondGroup = NULL;
+    err = MatCreateRedundantMatrix(jacobianMat, numGroups, groupComm, MAT_INITIAL_MATRIX, &jacobianGroup);PYLITH_CHECK_ERROR(err);
+    if (precondMat != jacobianMat) {
+        err = MatCreateRedundantMatrix(precondMat, numGroups, groupComm, MAT_INITIAL_MATRIX, &precondGroup);PYLITH_CHECK_ERROR(err);
+    } else {
+        precondGroup = jacobianGroup;
+        err = PetscObjectReference((PetscObject)precondGroup);PYLITH_CHECK_ERROR(err);
+    } // if/else
+
+    // Default to a direct solve, so each group factors its copy of the operator once for all of its impulses.
+    pylith::utils::PetscOptions groupOptions;
+    groupOptions.add("-greensfns_group_ksp_type", "preonly");
+    groupOptions.add("-greensfns_group_pc_type", "lu");
+    groupOptions.set();
+
+    PetscKSP kspGroup = NULL;
+    err = KSPCreate(groupComm, &kspGroup);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOptionsPrefix(kspGroup, "greensfns_group_");PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(kspGroup, jacobianGroup, precondGroup);PYLITH_CHECK_ERROR(err);
+    err = KSPSetFromOptions(kspGroup);PYLITH_CHECK_ERROR(err);
+    err = KSPSetUp(kspGroup);PYLITH_CHECK_ERROR(err);
+
+    // Vectors over all processes holding one copy of the system per group; group g owns block g.
+    PetscInt numRows = 0;
+    PetscInt numRowsGroupLocal = 0;
+    err = VecGetSize(solutionVec, &numRows);PYLITH_CHECK_ERROR(err);
+    err = MatGetLocalSize(jacobianGroup, &numRowsGroupLocal, NULL);PYLITH_CHECK_ERROR(err);
+
+    PetscVec rhsDup = NULL;
+    PetscVec solnDup = NULL;
+    err = VecCreateMPI(comm, numRowsGroupLocal, numGroups*numRows, &rhsDup);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(rhsDup, &solnDup);PYLITH_CHECK_ERROR(err);
+    PetscInt dupStart = 0;
+    PetscInt dupEnd = 0;
+    err = VecGetOwnershipRange(rhsDup, &dupStart, &dupEnd);PYLITH_CHECK_ERROR(err);
+
+    // Vectors over group sharing storage with local blocks of duplicated vectors.
+    PetscVec rhsGroup = NULL;
+    PetscVec solnGroup = NULL;
+    err = VecCreateMPIWithArray(groupComm, 1, numRowsGroupLocal, numRows, NULL, &rhsGroup);PYLITH_CHECK_ERROR(err);
+    err = VecCreateMPIWithArray(groupComm, 1, numRowsGroupLocal, numRows, NULL, &solnGroup);PYLITH_CHECK_ERROR(err);
+
+    // Scatter between global vector and block of each group in duplicated vectors.
+    std::vector<PetscVecScatter> scatters(numGroups, NULL);
+    for (int iGroup = 0; iGroup < numGroups; ++iGroup) {
+        const PetscInt numIndices = (iGroup == group) ? dupEnd - dupStart : 0;
+        PetscIS isFrom = NULL;
+        PetscIS isTo = NULL;
+        err = ISCreateStride(PETSC_COMM_SELF, numIndices, dupStart - iGroup*numRows, 1, &isFrom);PYLITH_CHECK_ERROR(err);
+        err = ISCreateStride(PETSC_COMM_SELF, numIndices, dupStart, 1, &isTo);PYLITH_CHECK_ERROR(err);
+        err = VecScatterCreate(solutionVec, isFrom, rhsDup, isTo, &scatters[iGroup]);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&isFrom);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&isTo);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    const size_t numImpulsesGlobal = _impulseProc.size();
+    for (size_t iStart = 0; iStart < numImpulsesGlobal; iStart += numGroups) {
+        const int numRound = std::min(size_t(numGroups), numImpulsesGlobal - iStart);
+
+        PYLITH_COMPONENT_INFO_ROOT("Computing Green's functions " << iStart+1 << "-" << iStart+numRound << " of " << numImpulsesGlobal << ".");
+
+        // Residual assembly uses all processes; right-hand side for impulse iStart+g goes to group g.
+        for (int iGroup = 0; iGroup < numRound; ++iGroup) {
+            _computeImpulseRHS(rhsVec, zeroVec, iStart + iGroup);
+            err = VecScatterBegin(scatters[iGroup], rhsVec, rhsDup, INSERT_VALUES, SCATTER_FORWARD);PYLITH_CHECK_ERROR(err);
+            err = VecScatterEnd(scatters[iGroup], rhsVec, rhsDup, INSERT_VALUES, SCATTER_FORWARD);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        // Groups solve for their impulses concurrently.
+        if (group < numRound) {
+            PetscScalar* rhsArray = NULL;
+            PetscScalar* solnArray = NULL;
+            err = VecGetArray(rhsDup, &rhsArray);PYLITH_CHECK_ERROR(err);
+            err = VecGetArray(solnDup, &solnArray);PYLITH_CHECK_ERROR(err);
+            err = VecPlaceArray(rhsGroup, rhsArray);PYLITH_CHECK_ERROR(err);
+            err = VecPlaceArray(solnGroup, solnArray);PYLITH_CHECK_ERROR(err);
+            err = KSPSolve(kspGroup, rhsGroup, solnGroup);PYLITH_CHECK_ERROR(err);
+            err = VecResetArray(rhsGroup);PYLITH_CHECK_ERROR(err);
+            err = VecResetArray(solnGroup);PYLITH_CHECK_ERROR(err);
+            err = VecRestoreArray(rhsDup, &rhsArray);PYLITH_CHECK_ERROR(err);
+            err = VecRestoreArray(solnDup, &solnArray);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        // Gather solutions over all processes and do output in impulse order.
+        for (int iGroup = 0; iGroup < numRound; ++iGroup) {
+            const size_t impulse = iStart + iGroup;
+            err = VecScatterBegin(scatters[iGroup], solnDup, solutionVec, INSERT_VALUES, SCATTER_REVERSE);PYLITH_CHECK_ERROR(err);
+            err = VecScatterEnd(scatters[iGroup], solnDup, solutionVec, INSERT_VALUES, SCATTER_REVERSE);PYLITH_CHECK_ERROR(err);
+
+            _setImpulse(impulse);
+            solution->scatterVectorToLocal(solutionVec);
+            solution->scatterLocalToOutput();
+            poststep(impulse, numImpulsesGlobal);
+        } // for
+    } // for
+
+    for (int iGroup = 0; iGroup < numGroups; ++iGroup) {
+        err = VecScatterDestroy(&scatters[iGroup]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecDestroy(&rhsGroup);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solnGroup);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&rhsDup);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solnDup);PYLITH_CHECK_ERROR(err);
+    err = KSPDestroy(&kspGroup);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianGroup);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&precondGroup);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&rhsVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&zeroVec);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_free(&groupComm);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _solveGroups
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute Green's functions at points using reciprocity (one adjoint solve per observation).
+void
+pylith::problems::GreensFns::_solveReciprocal(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_solveReciprocal()");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+    if (!solution->hasSubfield("displacement")) {
+        throw std::runtime_error("Reciprocal Green's functions require a solution field with a displacement subfield.");
+    } // if
+    const size_t numComponents = solution->getSubfieldInfo("displacement").description.numComponents;
+    if (numComponents != size_t(_reciprocalSpaceDim)) {
+        std::ostringstream msg;
+        msg << "Spatial dimension of points for reciprocal Green's functions (" << _reciprocalSpaceDim
+            << ") does not match number of components in displacement subfield (" << numComponents << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PetscErrorCode err;
+    PetscDM dmSoln = solution->getDM();assert(dmSoln);
+    PetscVec solutionVec = solution->getGlobalVector();assert(solutionVec);
+    PetscVec zeroVec = NULL;
+    err = VecDuplicate(solutionVec, &zeroVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(zeroVec, 0.0);PYLITH_CHECK_ERROR(err);
+
+    // The Jacobian does not depend on the impulse, so we form it once and use it for all adjoint solves.
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
+    PetscKSP ksp = NULL;
+    err = SNESGetJacobian(_snes, &jacobianMat, &precondMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    err = SNESComputeJacobian(_snes, zeroVec, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
+    err = SNESGetKSP(_snes, &ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(ksp, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
+    err = KSPSetUp(ksp);PYLITH_CHECK_ERROR(err);
+
+    // Observation operator: interpolation of the displacement from the local solution vector to the points.
+    const size_t numPoints = _reciprocalPointNames.size();
+    std::vector<const char*> pointNames(numPoints);
+    std::map<std::string, size_t> pointIndices;
+    for (size_t i = 0; i < numPoints; ++i) {
+        pointNames[i] = _reciprocalPointNames[i].c_str();
+        pointIndices[_reciprocalPointNames[i]] = i;
+    } // for
+    pylith::meshio::PointInterpolator interpolator;
+    interpolator.setPoints(&_reciprocalPointCoords[0], numPoints, _reciprocalSpaceDim, &pointNames[0], numPoints);
+    interpolator.useInterpolationMatrix(true);
+    interpolator.setup(*solution, pylith::string_vector(1, "displacement"));
+    PetscMat interpolationMat = interpolator.getInterpolationMatrix();assert(interpolationMat);
+
+    // Map global observation index (point*spaceDim+component) to row of local interpolation matrix.
+    const PetscInt numObservations = numPoints * _reciprocalSpaceDim;
+    std::vector<PetscInt> observationRows(numObservations, -1);
+    const pylith::topology::Field& pointField = interpolator.getPointField();
+    PetscSection pointSection = pointField.getLocalSection();assert(pointSection);
+    const PetscInt dispIndex = pointField.getSubfieldInfo("displacement").index;
+    const pylith::string_vector& pointNamesLocal = interpolator.getPointNames();
+    for (size_t iPoint = 0; iPoint < pointNamesLocal.size(); ++iPoint) {
+        assert(pointIndices.count(pointNamesLocal[iPoint]));
+        const size_t index = pointIndices[pointNamesLocal[iPoint]];
+        PetscInt offset = 0;
+        err = PetscSectionGetFieldOffset(pointSection, iPoint, dispIndex, &offset);PYLITH_CHECK_ERROR(err);
+        for (int iDim = 0; iDim < _reciprocalSpaceDim; ++iDim) {
+            observationRows[index*_reciprocalSpaceDim+iDim] = offset + iDim;
+        } // for
+    } // for
+
+    MPI_Comm comm = PetscObjectComm((PetscObject)solutionVec);
+    PetscInt numRowsLocal = 0;
+    PetscInt numRows = 0;
+    PetscInt numInterpolationRows = 0;
+    err = VecGetLocalSize(solutionVec, &numRowsLocal);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(solutionVec, &numRows);PYLITH_CHECK_ERROR(err);
+    err = MatGetSize(interpolationMat, &numInterpolationRows, NULL);PYLITH_CHECK_ERROR(err);
+
+    PetscMat adjointMat = NULL;
+    err = MatCreateDense(comm, numRowsLocal, PETSC_DECIDE, numRows, numObservations, NULL, &adjointMat);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::record(this, "Green's functions", "adjoint solutions",
+                                        size_t(numRowsLocal)*numObservations*sizeof(PetscScalar));
+
+    // Adjoint solve for each observation, K^T y_k = m_k. The transpose of the global-to-local scatter followed by the
+    // interpolation is the interpolation transpose followed by adding the local vector into the global vector.
+    PetscVec unitVec = NULL;
+    PetscVec observationLocalVec = NULL;
+    PetscVec observationVec = NULL;
+    err = VecCreateSeq(PETSC_COMM_SELF, numInterpolationRows, &unitVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetLocalVector(dmSoln, &observationLocalVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &observationVec);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iObs = 0; iObs < numObservations; ++iObs) {
+        PYLITH_COMPONENT_INFO_ROOT("Computing adjoint solution " << iObs+1 << " of " << numObservations
+                                                                << " for reciprocal Green's functions.");
+        err = VecSet(unitVec, 0.0);PYLITH_CHECK_ERROR(err);
+        if (observationRows[iObs] >= 0) {
+            err = VecSetValue(unitVec, observationRows[iObs], 1.0, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = VecAssemblyBegin(unitVec);PYLITH_CHECK_ERROR(err);
+        err = VecAssemblyEnd(unitVec);PYLITH_CHECK_ERROR(err);
+        err = MatMultTranspose(interpolationMat, unitVec, observationLocalVec);PYLITH_CHECK_ERROR(err);
+        err = VecSet(observationVec, 0.0);PYLITH_CHECK_ERROR(err);
+        err = DMLocalToGlobalBegin(dmSoln, observationLocalVec, ADD_VALUES, observationVec);PYLITH_CHECK_ERROR(err);
+        err = DMLocalToGlobalEnd(dmSoln, observationLocalVec, ADD_VALUES, observationVec);PYLITH_CHECK_ERROR(err);
+
+        PetscVec columnVec = NULL;
+        err = MatDenseGetColumnVecWrite(adjointMat, iObs, &columnVec);PYLITH_CHECK_ERROR(err);
+        err = KSPSolveTranspose(ksp, observationVec, columnVec);PYLITH_CHECK_ERROR(err);
+        err = MatDenseRestoreColumnVecWrite(adjointMat, iObs, &columnVec);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecDestroy(&unitVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSoln, &observationLocalVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&observationVec);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyBegin(adjointMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(adjointMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    // Green's function for each impulse, G_kj = y_k^T b_j, requires only the right-hand side of the impulse.
+    const size_t numImpulsesGlobal = _impulseProc.size();
+    PetscInt numObservationsLocal = 0;
+    err = MatGetLocalSize(adjointMat, NULL, &numObservationsLocal);PYLITH_CHECK_ERROR(err);
+    PetscMat reciprocalMat = NULL;
+    err = MatCreateDense(comm, numObservationsLocal, PETSC_DECIDE, numObservations, numImpulsesGlobal, NULL,
+                         &reciprocalMat);PYLITH_CHECK_ERROR(err);
+    PetscVec rhsVec = NULL;
+    err = VecDuplicate(solutionVec, &rhsVec);PYLITH_CHECK_ERROR(err);
+    for (size_t iImpulse = 0; iImpulse < numImpulsesGlobal; ++iImpulse) {
+        PYLITH_COMPONENT_INFO_ROOT("Computing Green's function " << iImpulse+1 << " of " << numImpulsesGlobal
+                                                                 << " using reciprocity.");
+        _computeImpulseRHS(rhsVec, zeroVec, iImpulse);
+
+        PetscVec columnVec = NULL;
+        err = MatDenseGetColumnVecWrite(reciprocalMat, iImpulse, &columnVec);PYLITH_CHECK_ERROR(err);
+        err = MatMultTranspose(adjointMat, rhsVec, columnVec);PYLITH_CHECK_ERROR(err);
+        err = MatDenseRestoreColumnVecWrite(reciprocalMat, iImpulse, &columnVec);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = MatAssemblyBegin(reciprocalMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(reciprocalMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    // Redimensionalize so the values match the displacement written by the solution observers for each impulse.
+    assert(_normalizer);
+    err = MatScale(reciprocalMat, _normalizer->getLengthScale());PYLITH_CHECK_ERROR(err);
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerBinaryOpen(comm, _reciprocalFilename.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+    err = MatView(reciprocalMat, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    PYLITH_COMPONENT_INFO_ROOT("Wrote reciprocal Green's functions for " << numObservations << " observations and "
+                                                                         << numImpulsesGlobal << " impulses to '"
+                                                                         << _reciprocalFilename << "'.");
+
+    err = VecDestroy(&rhsVec);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&reciprocalMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&adjointMat);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&zeroVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _solveReciprocal
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute right-hand side, -F(0), for impulse.
+void
+pylith::problems::GreensFns::_computeImpulseRHS(PetscVec rhsVec,
+                                                PetscVec zeroVec,
+                                                const size_t impulse) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_computeImpulseRHS(rhsVec="<<rhsVec<<", zeroVec="<<zeroVec<<", impulse="<<impulse<<")");
+
+    PetscErrorCode err;
+    pylith::feassemble::IntegratorInterface* integratorFault = dynamic_cast<pylith::feassemble::IntegratorInterface*>(_integratorImpulses);
+    if (!_localizedResidual || !_faultImpulses || !integratorFault) {
+        _setImpulse(impulse);
+        computeResidual(rhsVec, zeroVec);
+        err = VecScale(rhsVec, -1.0);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
+
+    // Residual with no impulse from all integrators (body forces, boundary conditions) is the same for all impulses.
+    if (!_residualBaseVec) {
+        err = VecDuplicate(rhsVec, &_residualBaseVec);PYLITH_CHECK_ERROR(err);
+        _integratorImpulses->setState(-1.0);
+        computeResidual(_residualBaseVec, zeroVec);
+    } // if
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_RESIDUAL);
+    assert(solution);
+    assert(residual);
+
+    // By linearity, the impulse contributes F(0) for the impulse slip alone, which is nonzero only on the cohesive
+    // cells in the support of the impulse point.
+    _setImpulse(impulse);
+    pylith::int_array points;
+    _faultImpulses->getImpulseSupport(&points, *integratorFault->getAuxiliaryField());
+    solution->zeroLocal();
+    residual->zeroLocal();
+    integratorFault->computeLHSResidualLocalized(residual, *_integrationData, points.size() > 0 ? &points[0] : NULL, points.size());
+
+    err = VecSet(rhsVec, 0.0);PYLITH_CHECK_ERROR(err);
+    residual->scatterLocalToVector(rhsVec, ADD_VALUES);
+    err = VecAXPY(rhsVec, 1.0, _residualBaseVec);PYLITH_CHECK_ERROR(err);
+    err = VecScale(rhsVec, -1.0);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _computeImpulseRHS
+
+
+// ------------------------------------------------------------------------------------------------
+// Store response to impulse in response matrix for surrogate model.
+void
+pylith::problems::GreensFns::_storeResponse(const size_t impulse) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_storeResponse(impulse="<<impulse<<")");
+
+    assert(_responseMat);
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    PetscErrorCode err;
+    PetscVec columnVec = NULL;
+    err = MatDenseGetColumnVecWrite(_responseMat, impulse, &columnVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(solution->getGlobalVector(), columnVec);PYLITH_CHECK_ERROR(err);
+    err = MatDenseRestoreColumnVecWrite(_responseMat, impulse, &columnVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _storeResponse
+
+
+// ------------------------------------------------------------------------------------------------
+// Compress response matrix for surrogate model using randomized range finder.
+void
+pylith::problems::GreensFns::_compressResponse(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_compressResponse()");
+
+    assert(_responseMat);
+    assert(!_responseCoefMat);
+
+    PetscErrorCode err;
+    PetscInt numRows = 0;
+    PetscInt numImpulses = 0;
+    PetscInt numRowsLocal = 0;
+    PetscInt numImpulsesLocal = 0;
+    err = MatGetSize(_responseMat, &numRows, &numImpulses);PYLITH_CHECK_ERROR(err);
+    err = MatGetLocalSize(_responseMat, &numRowsLocal, &numImpulsesLocal);PYLITH_CHECK_ERROR(err);
+    if (PetscInt(_surrogateRank) >= numImpulses) {
+        PYLITH_COMPONENT_INFO_ROOT("Rank of surrogate model (" << _surrogateRank << ") is not less than number of impulses ("
+                                                               << numImpulses << "); using full response matrix.");
+        PYLITH_METHOD_END;
+    } // if
+    const PetscInt rank = _surrogateRank;
+    MPI_Comm comm = PetscObjectComm((PetscObject)_responseMat);
+
+    // Sample range of G with random test matrix, Y = G Omega.
+    PetscMat omegaMat = NULL;
+    PetscRandom random = NULL;
+    err = MatCreateDense(comm, numImpulsesLocal, PETSC_DECIDE, numImpulses, rank, NULL, &omegaMat);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomCreate(comm, &random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomSetInterval(random, -1.0, 1.0);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomSetFromOptions(random);PYLITH_CHECK_ERROR(err);
+    err = MatSetRandom(omegaMat, random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomDestroy(&random);PYLITH_CHECK_ERROR(err);
+
+    PetscMat basisMat = NULL;
+    err = MatMatMult(_responseMat, omegaMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &basisMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&omegaMat);PYLITH_CHECK_ERROR(err);
+
+    // Orthonormalize columns of Y using modified Gram-Schmidt to get Q. Only one column of a dense matrix may be
+    // accessed at a time, so column j is updated in a work vector.
+    PetscVec qj = NULL;
+    err = MatCreateVecs(basisMat, NULL, &qj);PYLITH_CHECK_ERROR(err);
+    for (PetscInt j = 0; j < rank; ++j) {
+        PetscVec columnVec = NULL;
+        err = MatDenseGetColumnVecRead(basisMat, j, &columnVec);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(columnVec, qj);PYLITH_CHECK_ERROR(err);
+        err = MatDenseRestoreColumnVecRead(basisMat, j, &columnVec);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < j; ++i) {
+            PetscScalar dot = 0.0;
+            err = MatDenseGetColumnVecRead(basisMat, i, &columnVec);PYLITH_CHECK_ERROR(err);
+            err = VecDot(qj, columnVec, &dot);PYLITH_CHECK_ERROR(err);
+            err = VecAXPY(qj, -dot, columnVec);PYLITH_CHECK_ERROR(err);
+            err = MatDenseRestoreColumnVecRead(basisMat, i, &columnVec);PYLITH_CHECK_ERROR(err);
+        } // for
+        PetscReal norm = 0.0;
+        err = VecNormalize(qj, &norm);PYLITH_CHECK_ERROR(err);
+        if (norm <= 0.0) {
+            err = VecSet(qj, 0.0);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = MatDenseGetColumnVecWrite(basisMat, j, &columnVec);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(qj, columnVec);PYLITH_CHECK_ERROR(err);
+        err = MatDenseRestoreColumnVecWrite(basisMat, j, &columnVec);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecDestroy(&qj);PYLITH_CHECK_ERROR(err);
+
+    // Coefficients B = Q^T G and relative error ||G - Q B||_F / ||G||_F.
+    err = MatTransposeMatMult(basisMat, _responseMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &_responseCoefMat);PYLITH_CHECK_ERROR(err);
+
+    PetscMat errorMat = NULL;
+    PetscReal normResponse = 0.0;
+    PetscReal normError = 0.0;
+    err = MatMatMult(basisMat, _responseCoefMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &errorMat);PYLITH_CHECK_ERROR(err);
+    err = MatAXPY(errorMat, -1.0, _responseMat, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+    err = MatNorm(_responseMat, NORM_FROBENIUS, &normResponse);PYLITH_CHECK_ERROR(err);
+    err = MatNorm(errorMat, NORM_FROBENIUS, &normError);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&errorMat);PYLITH_CHECK_ERROR(err);
+
+    err = MatDestroy(&_responseMat);PYLITH_CHECK_ERROR(err);
+    _responseMat = basisMat;
+    pylith::utils::MemoryLogger::record(this, "Green's functions", "response matrix",
+                                        size_t(numRowsLocal+numImpulsesLocal)*rank*sizeof(PetscScalar));
+
+    PYLITH_COMPONENT_INFO_ROOT("Compressed response matrix for " << numImpulses << " impulses to rank " << rank
+                                                                 << " with relative error " << (normResponse > 0.0 ? normError/normResponse : 0.0) << ".");
+
+    PYLITH_METHOD_END;
+} // _compressResponse
+
+
+// ------------------------------------------------------------------------------------------------
+// Add impulse solution to orthonormal basis for deflation space.
+bool
+pylith::problems::GreensFns::_addDeflationVector(PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_addDeflationVector(solutionVec="<<solutionVec<<")");
+
+    if (_deflationNumVectors >= _deflationSize) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    assert(solutionVec);
+
+    PetscErrorCode err;
+    if (!_deflationMat) {
+        PetscInt numRowsLocal = 0;
+        PetscInt numRows = 0;
+        err = VecGetLocalSize(solutionVec, &numRowsLocal);PYLITH_CHECK_ERROR(err);
+        err = VecGetSize(solutionVec, &numRows);PYLITH_CHECK_ERROR(err);
+        err = MatCreateDense(PetscObjectComm((PetscObject)solutionVec), numRowsLocal, PETSC_DECIDE, numRows, _deflationSize,
+                             NULL, &_deflationMat);PYLITH_CHECK_ERROR(err);
+        pylith::utils::MemoryLogger::record(this, "Green's functions", "deflation space",
+                                            size_t(numRowsLocal)*_deflationSize*sizeof(PetscScalar));
+    } // if
+
+    // Orthogonalize against basis using modified Gram-Schmidt. Only one column of a dense matrix may be accessed at a
+    // time, so the new column is updated in a work vector.
+    PetscVec qj = NULL;
+    PetscReal normSolution = 0.0;
+    err = VecDuplicate(solutionVec, &qj);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(solutionVec, qj);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(qj, NORM_2, &normSolution);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < _deflationNumVectors; ++i) {
+        PetscVec columnVec = NULL;
+        PetscScalar dot = 0.0;
+        err = MatDenseGetColumnVecRead(_deflationMat, i, &columnVec);PYLITH_CHECK_ERROR(err);
+        err = VecDot(qj, columnVec, &dot);PYLITH_CHECK_ERROR(err);
+        err = VecAXPY(qj, -dot, columnVec);PYLITH_CHECK_ERROR(err);
+        err = MatDenseRestoreColumnVecRead(_deflationMat, i, &columnVec);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Skip solutions that are (nearly) in the span of the basis, so the coarse problem W^T A W stays nonsingular.
+    const PylithReal tolerance = 1.0e-8;
+    PetscReal norm = 0.0;
+    err = VecNormalize(qj, &norm);PYLITH_CHECK_ERROR(err);
+    if (norm > tolerance * normSolution) {
+        PetscVec columnVec = NULL;
+        err = MatDenseGetColumnVecWrite(_deflationMat, _deflationNumVectors, &columnVec);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(qj, columnVec);PYLITH_CHECK_ERROR(err);
+        err = MatDenseRestoreColumnVecWrite(_deflationMat, _deflationNumVectors, &columnVec);PYLITH_CHECK_ERROR(err);
+        ++_deflationNumVectors;
+    } // if
+    err = VecDestroy(&qj);PYLITH_CHECK_ERROR(err);
+
+    if (_deflationNumVectors < _deflationSize) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    err = MatAssemblyBegin(_deflationMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_deflationMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(true);
+} // _addDeflationVector
+
+
+// ------------------------------------------------------------------------------------------------
+// Wrap preconditioner in deflation preconditioner with basis of impulse solutions.
+void
+pylith::problems::GreensFns::_setDeflation(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setDeflation()");
+
+    assert(_snes);
+    assert(_deflationMat);
+
+    // The existing preconditioner, which has already been set up with the lagged Jacobian, becomes the preconditioner
+    // applied inside the deflation preconditioner.
+    PetscErrorCode err;
+    PetscKSP ksp = NULL;
+    PetscPC pcInner = NULL;
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
+    PetscBool isDeflation = PETSC_FALSE;
+    err = SNESGetKSP(_snes, &ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPGetPC(ksp, &pcInner);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectTypeCompare((PetscObject)pcInner, PCDEFLATION, &isDeflation);PYLITH_CHECK_ERROR(err);
+    if (isDeflation) {
+        // Deflation space from a previous solve remains valid, because the Jacobian is not recomputed.
+        PYLITH_METHOD_END;
+    } // if
+    PYLITH_COMPONENT_INFO_ROOT("Deflating preconditioner with " << _deflationNumVectors << " impulse solutions.");
+
+    err = KSPGetOperators(ksp, &jacobianMat, &precondMat);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectReference((PetscObject)pcInner);PYLITH_CHECK_ERROR(err);
+
+    PetscPC pc = NULL;
+    err = PCCreate(PetscObjectComm((PetscObject)ksp), &pc);PYLITH_CHECK_ERROR(err);
+    err = PCSetType(pc, PCDEFLATION);PYLITH_CHECK_ERROR(err);
+    err = PCSetOperators(pc, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
+    err = PCDeflationSetSpace(pc, _deflationMat, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    err = PCDeflationSetPC(pc, pcInner);PYLITH_CHECK_ERROR(err);
+    err = KSPSetPC(ksp, pc);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(ksp, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
+    err = KSPSetUp(ksp);PYLITH_CHECK_ERROR(err);
+    err = PCDestroy(&pc);PYLITH_CHECK_ERROR(err);
+    err = PCDestroy(&pcInner);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setDeflation
+
+
+// ------------------------------------------------------------------------------------------------
+// Evaluate surrogate model for slip distributions and notify observers of predictions.
+void
+pylith::problems::GreensFns::_evaluateSurrogate(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_evaluateSurrogate()");
+
+    assert(_responseMat);
+    assert(_faultImpulses);
+    assert(_integratorImpulses);
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+    // The slip subfield is refilled for each impulse, so we overwrite it with each slip distribution too.
+    pylith::topology::Field* faultAuxiliaryField = const_cast<pylith::topology::Field*>(_integratorImpulses->getAuxiliaryField());
+    assert(faultAuxiliaryField);
+
+    PetscErrorCode err;
+    PetscVec solutionVec = solution->getGlobalVector();assert(solutionVec);
+    MPI_Comm comm = PetscObjectComm((PetscObject)solutionVec);
+
+    // Amplitudes are in the order of the impulse schedule, in which impulses are contiguous by process.
+    PetscMat amplitudesMat = _responseCoefMat ? _responseCoefMat : _responseMat;
+    PetscVec amplitudesVec = NULL;
+    PetscVec coefVec = NULL;
+    err = MatCreateVecs(amplitudesMat, &amplitudesVec, NULL);PYLITH_CHECK_ERROR(err);
+    if (_responseCoefMat) {
+        err = MatCreateVecs(_responseMat, &coefVec, NULL);PYLITH_CHECK_ERROR(err);
+    } // if
+    PetscInt numImpulsesLocal = _faultImpulses->getNumImpulsesLocal();
+    PetscInt impulseOffset = 0;
+    err = MPI_Exscan(&numImpulsesLocal, &impulseOffset, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    int mpiRank = 0;
+    err = MPI_Comm_rank(comm, &mpiRank);PYLITH_CHECK_ERROR(err);
+    if (!mpiRank) {
+        impulseOffset = 0;
+    } // if
+
+    const size_t numImpulses = _impulseProc.size();
+    const size_t numPredictions = _surrogateSlipDBs.size();
+    pylith::scalar_array amplitudes;
+    pylith::int_array indices(numImpulsesLocal);
+    for (PetscInt i = 0; i < numImpulsesLocal; ++i) {
+        indices[i] = impulseOffset + i;
+    } // for
+    for (size_t iPrediction = 0; iPrediction < numPredictions; ++iPrediction) {
+        PYLITH_COMPONENT_INFO_ROOT("Evaluating surrogate model for slip distribution " << iPrediction+1 << " of " << numPredictions << ".");
+
+        _faultImpulses->getImpulseAmplitudes(&amplitudes, faultAuxiliaryField, _surrogateSlipDBs[iPrediction]);
+        assert(PetscInt(amplitudes.size()) == numImpulsesLocal);
+        err = VecSet(amplitudesVec, 0.0);PYLITH_CHECK_ERROR(err);
+        if (numImpulsesLocal > 0) {
+            err = VecSetValues(amplitudesVec, numImpulsesLocal, &indices[0], &amplitudes[0], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = VecAssemblyBegin(amplitudesVec);PYLITH_CHECK_ERROR(err);
+        err = VecAssemblyEnd(amplitudesVec);PYLITH_CHECK_ERROR(err);
+
+        if (_responseCoefMat) {
+            err = MatMult(_responseCoefMat, amplitudesVec, coefVec);PYLITH_CHECK_ERROR(err);
+            err = MatMult(_responseMat, coefVec, solutionVec);PYLITH_CHECK_ERROR(err);
+        } else {
+            err = MatMult(_responseMat, amplitudesVec, solutionVec);PYLITH_CHECK_ERROR(err);
+        } // if/else
+
+        solution->scatterVectorToLocal(solutionVec);
+        solution->scatterLocalToOutput();
+        poststep(numImpulses + iPrediction, numImpulses + numPredictions);
+    } // for
+
+    err = VecDestroy(&amplitudesVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&coefVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _evaluateSurrogate
+
+
 // End of file
@@ -27,9 +27,13 @@
 
 #include "Problem.hh" // ISA Problem
 #include "pylith/testing/testingfwd.hh" // USES MMSTest
-#include "pylith/faults/faultsfwd.hh" // HOLDSA FaultCohesiveImpulses
+#include "pylith/faults/faultsfwd.hh" // HOLDSA FaultCohesiveImpulses, FaultCohesiveKin
 #include "pylith/feassemble/feassemblefwd.hh" // HOLDSA Integrator
 
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // HOLDSA SpatialDB
+
+#include <vector> // HOLDSA std::vector
+
 class pylith::problems::GreensFns : public pylith::problems::Problem {
     friend class TestGreensFns; // unit testing
     friend class pylith::testing::MMSTest; // Testing with Method of Manufactured Solutions
@@ -70,6 +74,143 @@ public:
      */
     int getFaultLabelValue(void) const;
 
+    /** Set number of impulses solved together as a block of right-hand sides.
+     *
+     * A batch size of 1 solves each impulse separately using SNESSolve(). A batch size greater than 1 solves the
+     * impulses in blocks using KSPMatSolve() with the Jacobian formed once for all impulses.
+     *
+     * @param[in] value Number of impulses in each block.
+     */
+    void setImpulseBatchSize(const size_t value);
+
+    /** Get number of impulses solved together as a block of right-hand sides.
+     *
+     * @returns Number of impulses in each block.
+     */
+    size_t getImpulseBatchSize(void) const;
+
+    /** Set number of process groups solving impulses concurrently.
+     *
+     * Each group holds a copy of the assembled operator on a sub-communicator and solves the impulses assigned to it
+     * round-robin. A value of 1 uses all processes for every impulse.
+     *
+     * @param[in] value Number of process groups.
+     */
+    void setNumImpulseGroups(const size_t value);
+
+    /** Get number of process groups solving impulses concurrently.
+     *
+     * @returns Number of process groups.
+     */
+    size_t getNumImpulseGroups(void) const;
+
+    /** Set number of previous impulse solutions retained in the initial guess basis.
+     *
+     * Responses to nearby impulses are similar, so a larger proper orthogonal decomposition (POD) basis built from
+     * earlier solutions reduces the number of Krylov iterations. Used only when the INITIAL_GUESS PETSc defaults are
+     * turned on.
+     *
+     * @param[in] value Number of solutions in initial guess basis.
+     */
+    void setInitialGuessSize(const size_t value);
+
+    /** Get number of previous impulse solutions retained in the initial guess basis.
+     *
+     * @returns Number of solutions in initial guess basis.
+     */
+    size_t getInitialGuessSize(void) const;
+
+    /** Set number of previous impulse solutions in deflation space of preconditioner.
+     *
+     * Once the orthonormal basis of earlier impulse solutions reaches this size, the preconditioner is wrapped in a
+     * deflation preconditioner (PCDEFLATION) that removes the basis from the Krylov iterations of later impulses.
+     * Used when impulses are solved one at a time or in blocks.
+     *
+     * @param[in] value Number of solutions in deflation space (0=no deflation).
+     */
+    void setDeflationSize(const size_t value);
+
+    /** Get number of previous impulse solutions in deflation space of preconditioner.
+     *
+     * @returns Number of solutions in deflation space (0=no deflation).
+     */
+    size_t getDeflationSize(void) const;
+
+    /** Set flag for assembling right-hand side of each impulse over the cohesive cells in its support.
+     *
+     * The residual with no impulse is assembled once over all integrators. The right-hand side for each impulse adds
+     * the contribution of the cohesive cells with the impulse point in their closure, which is exact because the
+     * operator is linear. Used when impulses are solved in blocks or on groups of processes.
+     *
+     * @param[in] value True if right-hand side is localized, false otherwise.
+     */
+    void setLocalizedResidual(const bool value);
+
+    /** Get flag for assembling right-hand side of each impulse over the cohesive cells in its support.
+     *
+     * @returns True if right-hand side is localized, false otherwise.
+     */
+    bool getLocalizedResidual(void) const;
+
+    /** Add slip distribution for prediction with the surrogate model.
+     *
+     * When at least one slip distribution is given, the responses to the impulses are retained as the columns of a
+     * response matrix G, and after the impulses are solved the response to each slip distribution s is evaluated as
+     * G s without a finite-element solve. The predictions are passed to the observers following the impulses.
+     *
+     * @param[in] db Spatial database with slip distribution.
+     */
+    void addSurrogateSlip(spatialdata::spatialdb::SpatialDB* db);
+
+    /** Set rank of compressed response matrix for surrogate model.
+     *
+     * A rank of 0 retains the full response matrix. A positive rank compresses the response matrix using a
+     * randomized range finder, G ~ Q (Q^T G), with Q having the given number of orthonormal columns.
+     *
+     * @param[in] value Rank of compressed response matrix.
+     */
+    void setSurrogateRank(const size_t value);
+
+    /** Get rank of compressed response matrix for surrogate model.
+     *
+     * @returns Rank of compressed response matrix (0 = full response matrix).
+     */
+    size_t getSurrogateRank(void) const;
+
+    /** Set points for computing Green's functions using reciprocity.
+     *
+     * When points are given, the Green's functions of the displacement at the points are computed from one adjoint
+     * solve, K^T y_k = m_k, per displacement component k at each point, where m_k is the transpose of the
+     * interpolation of component k to the point. The Green's function for impulse j is G_kj = y_k^T b_j, where b_j is
+     * the right-hand side for impulse j, so no forward solves are needed. This is more efficient than solving for the
+     * impulses when there are fewer observations than impulses. Observers are not notified; the dense matrix G
+     * [numPoints*spaceDim, numImpulses] is written to a PETSc binary file, with row index point*spaceDim+component in
+     * the order of the points given here.
+     *
+     * @param[in] pointCoords Array of nondimensional coordinates [numPoints * spaceDim].
+     * @param[in] numPoints Number of points.
+     * @param[in] spaceDim Spatial dimension for coordinates.
+     * @param[in] pointNames Array with point names.
+     * @param[in] numPointNames Number of point names.
+     */
+    void setReciprocalPoints(const PylithReal* pointCoords,
+                             const int numPoints,
+                             const int spaceDim,
+                             const char* const* pointNames,
+                             const int numPointNames);
+
+    /** Set name of PETSc binary file for Green's functions computed using reciprocity.
+     *
+     * @param[in] value Name of file.
+     */
+    void setReciprocalFilename(const char* value);
+
+    /** Get name of PETSc binary file for Green's functions computed using reciprocity.
+     *
+     * @returns Name of file.
+     */
+    const char* getReciprocalFilename(void) const;
+
     /** Set progress monitor.
      *
      * @param[in] monitor Progress monitor for Green's functions simulation.
@@ -152,13 +293,90 @@ public:
                                    PetscMat precondMat,
                                    void* context);
 
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Create schedule of impulses (process and local index of each global impulse).
+    void _createImpulseSchedule(void);
+
+    /** Set state of fault with impulses for impulse.
+     *
+     * @param[in] impulse Global index of impulse.
+     */
+    void _setImpulse(const size_t impulse);
+
+    /// Solve for impulses one at a time.
+    void _solveSingle(void);
+
+    /// Solve for impulses in blocks of right-hand sides.
+    void _solveBatch(void);
+
+    /// Solve for impulses concurrently on groups of processes.
+    void _solveGroups(void);
+
+    /// Compute Green's functions at points using reciprocity (one adjoint solve per observation).
+    void _solveReciprocal(void);
+
+    /** Compute right-hand side, -F(0), for impulse.
+     *
+     * @param[out] rhsVec PETSc Vec for right-hand side.
+     * @param[in] zeroVec PETSc Vec with zero solution.
+     * @param[in] impulse Global index of impulse.
+     */
+    void _computeImpulseRHS(PetscVec rhsVec,
+                            PetscVec zeroVec,
+                            const size_t impulse);
+
+    /** Store response to impulse in response matrix for surrogate model.
+     *
+     * @param[in] impulse Global index of impulse.
+     */
+    void _storeResponse(const size_t impulse);
+
+    /// Compress response matrix for surrogate model using randomized range finder.
+    void _compressResponse(void);
+
+    /** Add impulse solution to orthonormal basis for deflation space.
+     *
+     * Solutions that are nearly linearly dependent on the basis are skipped.
+     *
+     * @param[in] solutionVec PETSc Vec with global solution for impulse.
+     * @returns True if basis is complete, false otherwise.
+     */
+    bool _addDeflationVector(PetscVec solutionVec);
+
+    /// Wrap preconditioner in deflation preconditioner with basis of impulse solutions.
+    void _setDeflation(void);
+
+    /// Evaluate surrogate model for slip distributions and notify observers of predictions.
+    void _evaluateSurrogate(void);
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
     std::string _faultLabelName; ///< Name of label for fault with impulses.
     PylithInt _faultLabelValue; ///< Value of label for fault with impulses.
     pylith::faults::FaultCohesiveImpulses* _faultImpulses; ///< Fault interface with Green's functions impulses.
+    pylith::faults::FaultCohesiveKin* _faultScenarios; ///< Fault interface with kinematic rupture slip scenarios.
     pylith::feassemble::Integrator* _integratorImpulses; ///< Integrator for Green's functions impulses.
+    size_t _impulseBatchSize; ///< Number of impulses in each block of right-hand sides.
+    size_t _numImpulseGroups; ///< Number of process groups solving impulses concurrently.
+    size_t _initialGuessSize; ///< Number of previous solutions retained in initial guess basis.
+    size_t _deflationSize; ///< Number of previous solutions in deflation space (0=no deflation).
+    size_t _deflationNumVectors; ///< Number of vectors in basis for deflation space.
+    PetscMat _deflationMat; ///< Orthonormal basis of impulse solutions for deflation space.
+    bool _localizedResidual; ///< True if right-hand side of impulses is assembled over support of impulse.
+    PetscVec _residualBaseVec; ///< Residual with no impulse for localized right-hand side.
+    pylith::int_vector _impulseProc; ///< Process with each global impulse.
+    pylith::int_vector _impulseLocal; ///< Local index of each global impulse on its process.
+    std::vector<spatialdata::spatialdb::SpatialDB*> _surrogateSlipDBs; ///< Slip distributions for surrogate model.
+    size_t _surrogateRank; ///< Rank of compressed response matrix (0 = full).
+    PetscMat _responseMat; ///< Response matrix (full) or orthonormal basis Q (compressed).
+    PetscMat _responseCoefMat; ///< Coefficients Q^T G of compressed response matrix.
+    pylith::scalar_array _reciprocalPointCoords; ///< Coordinates of points for reciprocal Green's functions.
+    pylith::string_vector _reciprocalPointNames; ///< Names of points for reciprocal Green's functions.
+    int _reciprocalSpaceDim; ///< Spatial dimension of coordinates of points for reciprocal Green's functions.
+    std::string _reciprocalFilename; ///< Name of file for reciprocal Green's functions.
 
     PetscSNES _snes; ///< PETSc SNES solver.
     pylith::problems::ProgressMonitorStep* _monitor; ///< Monitor for simulation progress.
@@ -0,0 +1,897 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "InitialConditionFile.hh" // implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "petscdmplex.h" // USES DMInterpolationInfo
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include <algorithm> // USES std::min(), std::max()
+#include <cassert> // USES assert()
+#include <cmath> // USES fabs()
+#include <cstring> // USES strlen()
+#include <limits> // USES std::numeric_limits
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class _InitialConditionFile {
+public:
+
+            /// Sizes of datasets in HDF5 file.
+            struct FileInfo {
+                PetscInt numVertices; ///< Number of vertices.
+                PetscInt spaceDim; ///< Spatial dimension of vertex coordinates.
+                PetscInt numCells; ///< Number of cells.
+                PetscInt numCorners; ///< Number of vertices in each cell.
+                std::vector<PetscInt> numComponents; ///< Number of components in each subfield.
+                std::vector<PetscInt> timeSteps; ///< Index of time step in file for each subfield.
+            }; // FileInfo
+
+            /** Get sizes of datasets in HDF5 file.
+             *
+             * Collective over the communicator; the file is read on process 0.
+             *
+             * @param[out] info Sizes of datasets.
+             * @param[in] filename Name of HDF5 file.
+             * @param[in] subfields Names of subfields.
+             * @param[in] timeStep Index of time step (negative values count from the last time step).
+             * @param[in] comm MPI communicator.
+             */
+            static
+            void getFileInfo(FileInfo* info,
+                             const std::string& filename,
+                             const pylith::string_vector& subfields,
+                             const int timeStep,
+                             MPI_Comm comm);
+
+            /** Load vector from dataset in HDF5 file.
+             *
+             * @param[out] vec PETSc vector with values from dataset.
+             * @param[in] viewer HDF5 viewer.
+             * @param[in] group Name of group with dataset.
+             * @param[in] name Name of dataset.
+             * @param[in] blockSize Block size of vector.
+             * @param[in] localSize Local size of vector (PETSC_DECIDE for default layout).
+             * @param[in] timeStep Index of time step (negative for dataset without time steps).
+             */
+            static
+            void loadVector(PetscVec* vec,
+                            PetscViewer viewer,
+                            const char* group,
+                            const char* name,
+                            const PetscInt blockSize,
+                            const PetscInt localSize,
+                            const PetscInt timeStep);
+
+            /** Get flags indicating which points are owned by other processes.
+             *
+             * @param[out] isGhost Flag for each point in the chart of the DM.
+             * @param[in] dm PETSc DM.
+             */
+            static
+            void getGhostPoints(std::vector<bool>* isGhost,
+                                PetscDM dm);
+
+            /** Copy values from HDF5 file directly into solution.
+             *
+             * Requires every subfield to use basis functions of order 1 and the vertices in the file to match the
+             * vertices owned by each process, which is the case if the file was written with the same mesh and number
+             * of processes.
+             *
+             * @param[inout] solution Solution field.
+             * @param[in] subfields Names of subfields.
+             * @param[in] info Sizes of datasets in file.
+             * @param[in] viewer HDF5 viewer.
+             * @param[in] lengthScale Scale for nondimensionalizing coordinates.
+             * @returns True if values were copied, false otherwise.
+             */
+            static
+            bool setValuesDirect(pylith::topology::Field* solution,
+                                 const pylith::string_vector& subfields,
+                                 const FileInfo& info,
+                                 PetscViewer viewer,
+                                 const PylithReal lengthScale);
+
+            /** Interpolate values from HDF5 file into solution.
+             *
+             * The mesh in the file is distributed in slices of cells. Each process sends the locations of its
+             * degrees of freedom to the processes whose bounding box contains them, and the processes that find the
+             * locations in their cells return the interpolated values.
+             *
+             * @param[inout] solution Solution field.
+             * @param[in] subfields Names of subfields.
+             * @param[in] info Sizes of datasets in file.
+             * @param[in] viewer HDF5 viewer.
+             * @param[in] lengthScale Scale for nondimensionalizing coordinates.
+             */
+            static
+            void setValuesInterpolate(pylith::topology::Field* solution,
+                                      const pylith::string_vector& subfields,
+                                      const FileInfo& info,
+                                      PetscViewer viewer,
+                                      const PylithReal lengthScale);
+
+            static const char* pyreComponent;
+
+        }; // _InitialConditionFile
+        const char* _InitialConditionFile::pyreComponent = "initialconditionfile";
+
+    } // problems
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::InitialConditionFile::InitialConditionFile(void) :
+    _filename(""),
+    _timeStep(-1) {
+    PyreComponent::setName(_InitialConditionFile::pyreComponent);
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::InitialConditionFile::~InitialConditionFile(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::InitialConditionFile::deallocate(void) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Set name of HDF5 file with solution.
+void
+pylith::problems::InitialConditionFile::setFilename(const char* value) {
+    PYLITH_COMPONENT_DEBUG("setFilename(value="<<value<<")");
+
+    if (strlen(value) == 0) {
+        throw std::runtime_error("Empty string given for name of HDF5 file with initial conditions.");
+    } // if
+
+    _filename = value;
+} // setFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Get name of HDF5 file with solution.
+const char*
+pylith::problems::InitialConditionFile::getFilename(void) const {
+    return _filename.c_str();
+} // getFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Set index of time step in file used for initial condition.
+void
+pylith::problems::InitialConditionFile::setTimeStep(const int value) {
+    _timeStep = value;
+} // setTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Get index of time step in file used for initial condition.
+int
+pylith::problems::InitialConditionFile::getTimeStep(void) const {
+    return _timeStep;
+} // getTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::problems::InitialConditionFile::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    InitialCondition::verifyConfiguration(solution);
+
+    // Values are set at the location of each point with degrees of freedom, so we require one node per point.
+    const size_t numSubfields = _subfields.size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(_subfields[i].c_str());
+        if (!info.fe.isBasisContinuous || (info.fe.basisOrder < 1) || (info.fe.basisOrder > 2)) {
+            std::ostringstream msg;
+            msg << "Initial condition '" << PyreComponent::getIdentifier() << "' requires continuous basis functions "
+                << "of order 1 or 2 for solution subfield '" << _subfields[i] << "' (basis order is "
+                << info.fe.basisOrder << ").";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Set solution to values for initial condition.
+void
+pylith::problems::InitialConditionFile::setValues(pylith::topology::Field* solution,
+                                                  const spatialdata::units::Nondimensional& normalizer) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setValues(solution="<<solution<<", normalizer)");
+
+    assert(solution);
+
+    MPI_Comm comm = solution->getMesh().getComm();
+    _InitialConditionFile::FileInfo info;
+    _InitialConditionFile::getFileInfo(&info, _filename, _subfields, _timeStep, comm);
+    if (info.spaceDim != PetscInt(solution->getSpaceDim())) {
+        std::ostringstream msg;
+        msg << "Spatial dimension of vertices (" << info.spaceDim << ") in HDF5 file '" << _filename
+            << "' for initial condition '" << PyreComponent::getIdentifier() << "' does not match spatial dimension "
+            << "of mesh (" << solution->getSpaceDim() << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+    const size_t numSubfields = _subfields.size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const PetscInt numComponents = solution->getSubfieldInfo(_subfields[i].c_str()).description.numComponents;
+        if (info.numComponents[i] != numComponents) {
+            std::ostringstream msg;
+            msg << "Number of components (" << info.numComponents[i] << ") of field '" << _subfields[i]
+                << "' in HDF5 file '" << _filename << "' for initial condition '" << PyreComponent::getIdentifier()
+                << "' does not match number of components in solution subfield (" << numComponents << ").";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // for
+
+    PetscErrorCode err = 0;
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(comm, _filename.c_str(), FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5SetBaseDimension2(viewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+
+    const PylithReal lengthScale = normalizer.getLengthScale();
+    const bool isDirect = _InitialConditionFile::setValuesDirect(solution, _subfields, info, viewer, lengthScale);
+    if (!isDirect) {
+        _InitialConditionFile::setValuesInterpolate(solution, _subfields, info, viewer, lengthScale);
+    } // if
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_COMPONENT_INFO_ROOT("Set initial conditions from HDF5 file '" << _filename << "' by "
+                                                                        << (isDirect ? "copying values at matching vertices." : "interpolation."));
+
+    pythia::journal::debug_t debug(PyreComponent::getName());
+    if (debug.state()) {
+        PYLITH_COMPONENT_DEBUG("Displaying solution field");
+        solution->view("Solution field with initial values", pylith::topology::Field::VIEW_ALL);
+    } // if
+
+    PYLITH_METHOD_END;
+} // setValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Get sizes of datasets in HDF5 file.
+void
+pylith::problems::_InitialConditionFile::getFileInfo(FileInfo* info,
+                                                     const std::string& filename,
+                                                     const pylith::string_vector& subfields,
+                                                     const int timeStep,
+                                                     MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+    assert(info);
+
+    PetscMPIInt commRank = 0;
+    PetscErrorCode err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+
+    // Values: status, numVertices, spaceDim, numCells, numCorners, and (numComponents, timeStep) for each subfield.
+    const size_t numSubfields = subfields.size();
+    const size_t numHeader = 5;
+    std::vector<PetscInt> values(numHeader + 2*numSubfields, 0);
+    std::ostringstream msg;
+    if (!commRank) {
+        hsize_t* dims = NULL;
+        int ndims = 0;
+        try {
+            pylith::meshio::HDF5 h5(filename.c_str(), H5F_ACC_RDONLY);
+            if (!h5.hasDataset("/geometry/vertices") || !h5.hasDataset("/viz/topology/cells")) {
+                msg << "HDF5 file '" << filename << "' is missing the vertices or cells of the mesh.";
+            } else {
+                h5.getDatasetDims(&dims, &ndims, "/geometry", "vertices");
+                values[1] = dims[0];
+                values[2] = (ndims > 1) ? dims[1] : 1;
+                h5.getDatasetDims(&dims, &ndims, "/viz/topology", "cells");
+                values[3] = dims[0];
+                values[4] = (ndims > 1) ? dims[1] : 1;
+            } // if/else
+            for (size_t i = 0; i < numSubfields && msg.str().empty(); ++i) {
+                const std::string& fullName = std::string("/vertex_fields/") + subfields[i];
+                if (!h5.hasDataset(fullName.c_str())) {
+                    msg << "HDF5 file '" << filename << "' is missing vertex field '" << subfields[i] << "'.";
+                    break;
+                } // if
+                h5.getDatasetDims(&dims, &ndims, "/vertex_fields", subfields[i].c_str());
+                const PetscInt numTimeSteps = (3 == ndims) ? dims[0] : 1;
+                const PetscInt step = (timeStep < 0) ? numTimeSteps + timeStep : timeStep;
+                if ((step < 0) || (step >= numTimeSteps)) {
+                    msg << "Time step " << timeStep << " not found in vertex field '" << subfields[i]
+                        << "' of HDF5 file '" << filename << "' with " << numTimeSteps << " time steps.";
+                    break;
+                } // if
+                values[numHeader+2*i+0] = (ndims > 1) ? dims[ndims-1] : 1;
+                values[numHeader+2*i+1] = (3 == ndims) ? step : -1;
+            } // for
+            h5.close();
+        } catch (const std::exception& err) {
+            msg << "Error reading HDF5 file '" << filename << "'.\n" << err.what();
+        } // try/catch
+        delete[] dims;dims = NULL;
+        values[0] = msg.str().empty() ? 0 : 1;
+    } // if
+    err = MPI_Bcast(&values[0], values.size(), MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    if (values[0]) {
+        throw std::runtime_error(commRank ? std::string("Error reading HDF5 file on process 0.") : msg.str());
+    } // if
+
+    info->numVertices = values[1];
+    info->spaceDim = values[2];
+    info->numCells = values[3];
+    info->numCorners = values[4];
+    info->numComponents.resize(numSubfields);
+    info->timeSteps.resize(numSubfields);
+    for (size_t i = 0; i < numSubfields; ++i) {
+        info->numComponents[i] = values[numHeader+2*i+0];
+        info->timeSteps[i] = values[numHeader+2*i+1];
+    } // for
+
+    PYLITH_METHOD_END;
+} // getFileInfo
+
+
+// ------------------------------------------------------------------------------------------------
+// Load vector from dataset in HDF5 file.
+void
+pylith::problems::_InitialConditionFile::loadVector(PetscVec* vec,
+                                                    PetscViewer viewer,
+                                                    const char* group,
+                                                    const char* name,
+                                                    const PetscInt blockSize,
+                                                    const PetscInt localSize,
+                                                    const PetscInt timeStep) {
+    PYLITH_METHOD_BEGIN;
+    assert(vec);
+
+    PetscErrorCode err = 0;
+    err = VecCreate(PetscObjectComm((PetscObject)viewer), vec);PYLITH_CHECK_ERROR(err);
+    if (localSize != PETSC_DECIDE) {
+        err = VecSetSizes(*vec, localSize, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = VecSetBlockSize(*vec, blockSize);PYLITH_CHECK_ERROR(err);
+    err = VecSetType(*vec, VECSTANDARD);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject)*vec, name);PYLITH_CHECK_ERROR(err);
+
+    err = PetscViewerHDF5PushGroup(viewer, group);PYLITH_CHECK_ERROR(err);
+    if (timeStep >= 0) {
+        err = PetscViewerHDF5PushTimestepping(viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerHDF5SetTimestep(viewer, timeStep);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = VecLoad(*vec, viewer);PYLITH_CHECK_ERROR(err);
+    if (timeStep >= 0) {
+        err = PetscViewerHDF5PopTimestepping(viewer);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // loadVector
+
+
+// ------------------------------------------------------------------------------------------------
+// Get flags indicating which points are owned by other processes.
+void
+pylith::problems::_InitialConditionFile::getGhostPoints(std::vector<bool>* isGhost,
+                                                        PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(isGhost);
+
+    PetscErrorCode err = 0;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    isGhost->assign(pEnd, false);
+
+    PetscSF sf = NULL;
+    PetscInt numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sf, NULL, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numLeaves; ++i) {
+        const PetscInt point = leaves ? leaves[i] : i;
+        if (point < pEnd) {
+            (*isGhost)[point] = true;
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // getGhostPoints
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy values from HDF5 file directly into solution.
+bool
+pylith::problems::_InitialConditionFile::setValuesDirect(pylith::topology::Field* solution,
+                                                         const pylith::string_vector& subfields,
+                                                         const FileInfo& info,
+                                                         PetscViewer viewer,
+                                                         const PylithReal lengthScale) {
+    PYLITH_METHOD_BEGIN;
+    assert(solution);
+
+    const size_t numSubfields = subfields.size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        if (solution->getSubfieldInfo(subfields[i].c_str()).fe.basisOrder != 1) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+    } // for
+
+    // Vertices are written in the order of the global vertices, with the vertices owned by each process in a
+    // contiguous block.
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution->getDM();
+    MPI_Comm comm = solution->getMesh().getComm();
+    std::vector<bool> isGhost;
+    getGhostPoints(&isGhost, dmSoln);
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dmSoln, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> vertices;
+    for (PetscInt vertex = vStart; vertex < vEnd; ++vertex) {
+        if (!isGhost[vertex]) {
+            vertices.push_back(vertex);
+        } // if
+    } // for
+    const PetscInt numVerticesLocal = vertices.size();
+    PetscInt numVerticesGlobal = 0;
+    err = MPI_Allreduce(&numVerticesLocal, &numVerticesGlobal, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    if (numVerticesGlobal != info.numVertices) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    // Check coordinates of vertices.
+    const PetscInt spaceDim = info.spaceDim;
+    PetscVec verticesVec = NULL;
+    loadVector(&verticesVec, viewer, "/geometry", "vertices", spaceDim, numVerticesLocal*spaceDim, -1);
+    PetscVec coordsVec = NULL;
+    PetscSection coordsSection = NULL;
+    err = DMGetCoordinatesLocal(dmSoln, &coordsVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinateSection(dmSoln, &coordsSection);PYLITH_CHECK_ERROR(err);
+    const PetscScalar* verticesArray = NULL;
+    const PetscScalar* coordsArray = NULL;
+    err = VecGetArrayRead(verticesVec, &verticesArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    const PylithReal tolerance = 1.0e-6;
+    int isMatchLocal = 1;
+    for (PetscInt iVertex = 0; iVertex < numVerticesLocal && isMatchLocal; ++iVertex) {
+        PetscInt off = 0;
+        err = PetscSectionGetOffset(coordsSection, vertices[iVertex], &off);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            const PylithReal xyzFile = PetscRealPart(verticesArray[iVertex*spaceDim+iDim]);
+            const PylithReal xyzMesh = PetscRealPart(coordsArray[off+iDim]) * lengthScale;
+            if (fabs(xyzFile - xyzMesh) > tolerance * (fabs(xyzFile) + lengthScale)) {
+                isMatchLocal = 0;
+            } // if
+        } // for
+    } // for
+    err = VecRestoreArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(verticesVec, &verticesArray);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&verticesVec);PYLITH_CHECK_ERROR(err);
+    int isMatch = 0;
+    err = MPI_Allreduce(&isMatchLocal, &isMatch, 1, MPI_INT, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    if (!isMatch) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscSection solnSection = solution->getLocalSection();
+    PetscScalar* solnArray = NULL;
+    err = VecGetArray(solution->getLocalVector(), &solnArray);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& sinfo = solution->getSubfieldInfo(subfields[i].c_str());
+        const PetscInt numComponents = info.numComponents[i];
+        const PylithReal scale = sinfo.description.scale;
+
+        PetscVec valuesVec = NULL;
+        loadVector(&valuesVec, viewer, "/vertex_fields", subfields[i].c_str(), numComponents,
+                   numVerticesLocal*numComponents, info.timeSteps[i]);
+        const PetscScalar* valuesArray = NULL;
+        err = VecGetArrayRead(valuesVec, &valuesArray);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iVertex = 0; iVertex < numVerticesLocal; ++iVertex) {
+            PetscInt off = 0, dof = 0;
+            err = PetscSectionGetFieldDof(solnSection, vertices[iVertex], sinfo.index, &dof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(solnSection, vertices[iVertex], sinfo.index, &off);PYLITH_CHECK_ERROR(err);
+            assert(!dof || numComponents == dof);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                solnArray[off+iDof] = valuesArray[iVertex*numComponents+iDof] / scale;
+            } // for
+        } // for
+        err = VecRestoreArrayRead(valuesVec, &valuesArray);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&valuesVec);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecRestoreArray(solution->getLocalVector(), &solnArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(true);
+} // setValuesDirect
+
+
+// ------------------------------------------------------------------------------------------------
+// Interpolate values from HDF5 file into solution.
+void
+pylith::problems::_InitialConditionFile::setValuesInterpolate(pylith::topology::Field* solution,
+                                                              const pylith::string_vector& subfields,
+                                                              const FileInfo& info,
+                                                              PetscViewer viewer,
+                                                              const PylithReal lengthScale) {
+    PYLITH_METHOD_BEGIN;
+    assert(solution);
+
+    PetscErrorCode err = 0;
+    MPI_Comm comm = solution->getMesh().getComm();
+    PetscMPIInt commRank = 0, commSize = 1;
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+    const PetscInt spaceDim = info.spaceDim;
+    const size_t numSubfields = subfields.size();
+    std::vector<PetscInt> componentOffsets(numSubfields+1, 0);
+    for (size_t i = 0; i < numSubfields; ++i) {
+        componentOffsets[i+1] = componentOffsets[i] + info.numComponents[i];
+    } // for
+    const PetscInt numDof = componentOffsets[numSubfields];
+
+    // Create mesh from cells and vertices in file, distributed in slices.
+    PetscVec cellsVec = NULL, verticesVec = NULL;
+    loadVector(&cellsVec, viewer, "/viz/topology", "cells", info.numCorners, PETSC_DECIDE, -1);
+    loadVector(&verticesVec, viewer, "/geometry", "vertices", spaceDim, PETSC_DECIDE, -1);
+    PetscInt cellsSize = 0, verticesSize = 0;
+    err = VecGetLocalSize(cellsVec, &cellsSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(verticesVec, &verticesSize);PYLITH_CHECK_ERROR(err);
+    const PetscInt numCellsLocal = cellsSize / info.numCorners;
+    const PetscInt numVerticesLocal = verticesSize / spaceDim;
+    std::vector<PetscInt> cells(cellsSize+1);
+    std::vector<PetscReal> vertices(verticesSize+1);
+    const PetscScalar* array = NULL;
+    err = VecGetArrayRead(cellsVec, &array);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < cellsSize; ++i) {
+        cells[i] = PetscInt(PetscRealPart(array[i]) + 0.5);
+    } // for
+    err = VecRestoreArrayRead(cellsVec, &array);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(verticesVec, &array);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < verticesSize; ++i) {
+        vertices[i] = PetscRealPart(array[i]) / lengthScale;
+    } // for
+    err = VecRestoreArrayRead(verticesVec, &array);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&cellsVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&verticesVec);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmSource = NULL;
+    PetscSF vertexSF = NULL;
+    const PetscInt cellDim = solution->getMesh().getDimension();
+    err = DMPlexCreateFromCellListParallelPetsc(comm, cellDim, numCellsLocal, numVerticesLocal, info.numVertices,
+                                                info.numCorners, PETSC_FALSE, &cells[0], spaceDim, &vertices[0],
+                                                &vertexSF, NULL, &dmSource);PYLITH_CHECK_ERROR(err);
+    cells.clear();
+    vertices.clear();
+
+    // Layout of values in mesh from file: all subfields at each vertex.
+    PetscInt pStart = 0, pEnd = 0, vStart = 0, vEnd = 0;
+    err = DMPlexGetChart(dmSource, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dmSource, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    PetscSection sourceSection = NULL;
+    err = PetscSectionCreate(comm, &sourceSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionSetChart(sourceSection, pStart, pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt vertex = vStart; vertex < vEnd; ++vertex) {
+        err = PetscSectionSetDof(sourceSection, vertex, numDof);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = PetscSectionSetUp(sourceSection);PYLITH_CHECK_ERROR(err);
+    err = DMSetLocalSection(dmSource, sourceSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionDestroy(&sourceSection);PYLITH_CHECK_ERROR(err);
+
+    // Values at vertices of mesh from file. Leaves of the vertex SF are the vertices of the mesh in order.
+    PetscVec sourceVec = NULL;
+    PetscScalar* sourceArray = NULL;
+    err = DMCreateLocalVector(dmSource, &sourceVec);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(sourceVec, &sourceArray);PYLITH_CHECK_ERROR(err);
+    const PetscInt numVerticesSource = vEnd - vStart;
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const PetscInt numComponents = info.numComponents[i];
+        const PylithReal scale = solution->getSubfieldInfo(subfields[i].c_str()).description.scale;
+        PetscVec valuesVec = NULL;
+        loadVector(&valuesVec, viewer, "/vertex_fields", subfields[i].c_str(), numComponents,
+                   numVerticesLocal*numComponents, info.timeSteps[i]);
+
+        std::vector<PetscScalar> leafValues(numVerticesSource*numComponents+1);
+        MPI_Datatype unitType;
+        err = MPI_Type_contiguous(numComponents, MPIU_SCALAR, &unitType);PYLITH_CHECK_ERROR(err);
+        err = MPI_Type_commit(&unitType);PYLITH_CHECK_ERROR(err);
+        const PetscScalar* valuesArray = NULL;
+        err = VecGetArrayRead(valuesVec, &valuesArray);PYLITH_CHECK_ERROR(err);
+        err = PetscSFBcastBegin(vertexSF, unitType, valuesArray, &leafValues[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+        err = PetscSFBcastEnd(vertexSF, unitType, valuesArray, &leafValues[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+        err = VecRestoreArrayRead(valuesVec, &valuesArray);PYLITH_CHECK_ERROR(err);
+        err = MPI_Type_free(&unitType);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&valuesVec);PYLITH_CHECK_ERROR(err);
+
+        for (PetscInt iVertex = 0; iVertex < numVerticesSource; ++iVertex) {
+            for (PetscInt iComp = 0; iComp < numComponents; ++iComp) {
+                sourceArray[iVertex*numDof+componentOffsets[i]+iComp] = leafValues[iVertex*numComponents+iComp] / scale;
+            } // for
+        } // for
+    } // for
+    err = VecRestoreArray(sourceVec, &sourceArray);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&vertexSF);PYLITH_CHECK_ERROR(err);
+
+    // Locations of owned points with degrees of freedom in the subfields (vertices and centroids of edges, faces,
+    // and cells for basis order 2).
+    PetscDM dmSoln = solution->getDM();
+    PetscSection solnSection = solution->getLocalSection();
+    std::vector<bool> isGhost;
+    getGhostPoints(&isGhost, dmSoln);
+    PetscInt solnStart = 0, solnEnd = 0, solnVStart = 0, solnVEnd = 0;
+    err = PetscSectionGetChart(solnSection, &solnStart, &solnEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dmSoln, 0, &solnVStart, &solnVEnd);PYLITH_CHECK_ERROR(err);
+    PetscVec coordsVec = NULL;
+    PetscSection coordsSection = NULL;
+    const PetscScalar* coordsArray = NULL;
+    err = DMGetCoordinatesLocal(dmSoln, &coordsVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinateSection(dmSoln, &coordsSection);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> targetPoints;
+    std::vector<PylithReal> targetCoords;
+    for (PetscInt point = solnStart; point < solnEnd; ++point) {
+        if (isGhost[point]) { continue; }
+        PetscInt dofTotal = 0;
+        for (size_t i = 0; i < numSubfields; ++i) {
+            PetscInt dof = 0;
+            err = PetscSectionGetFieldDof(solnSection, point, solution->getSubfieldInfo(subfields[i].c_str()).index, &dof);PYLITH_CHECK_ERROR(err);
+            dofTotal += dof;
+        } // for
+        if (!dofTotal) { continue; }
+
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0, numClosureVertices = 0;
+        PylithReal xyz[3] = { 0.0, 0.0, 0.0 };
+        err = DMPlexGetTransitiveClosure(dmSoln, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iClosure = 0; iClosure < 2*closureSize; iClosure += 2) {
+            const PetscInt vertex = closure[iClosure];
+            if ((vertex < solnVStart) || (vertex >= solnVEnd)) { continue; }
+            PetscInt off = 0;
+            err = PetscSectionGetOffset(coordsSection, vertex, &off);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+                xyz[iDim] += PetscRealPart(coordsArray[off+iDim]);
+            } // for
+            ++numClosureVertices;
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmSoln, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        assert(numClosureVertices > 0);
+        targetPoints.push_back(point);
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            targetCoords.push_back(xyz[iDim] / numClosureVertices);
+        } // for
+    } // for
+    err = VecRestoreArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    const size_t numTargets = targetPoints.size();
+
+    // Send each location to the processes whose bounding box of the mesh from the file contains it.
+    std::vector<PylithReal> bbox(2*spaceDim);
+    for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+        bbox[iDim] = std::numeric_limits<PylithReal>::max();
+        bbox[spaceDim+iDim] = -std::numeric_limits<PylithReal>::max();
+    } // for
+    PetscVec sourceCoordsVec = NULL;
+    PetscInt sourceCoordsSize = 0;
+    err = DMGetCoordinatesLocal(dmSource, &sourceCoordsVec);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(sourceCoordsVec, &sourceCoordsSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(sourceCoordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < sourceCoordsSize; i += spaceDim) {
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            bbox[iDim] = std::min(bbox[iDim], PylithReal(PetscRealPart(coordsArray[i+iDim])));
+            bbox[spaceDim+iDim] = std::max(bbox[spaceDim+iDim], PylithReal(PetscRealPart(coordsArray[i+iDim])));
+        } // for
+    } // for
+    err = VecRestoreArrayRead(sourceCoordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    if (sourceCoordsSize > 0) {
+        const PylithReal tolerance = 1.0e-6;
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            const PylithReal dx = tolerance * std::max(bbox[spaceDim+iDim] - bbox[iDim], PylithReal(1.0));
+            bbox[iDim] -= dx;
+            bbox[spaceDim+iDim] += dx;
+        } // for
+    } // if
+    std::vector<PylithReal> bboxes(commSize*2*spaceDim);
+    err = MPI_Allgather(&bbox[0], 2*spaceDim, MPIU_REAL, &bboxes[0], 2*spaceDim, MPIU_REAL, comm);PYLITH_CHECK_ERROR(err);
+
+    std::vector<std::vector<PetscInt> > sendTargets(commSize);
+    for (size_t iTarget = 0; iTarget < numTargets; ++iTarget) {
+        for (PetscMPIInt iRank = 0; iRank < commSize; ++iRank) {
+            const PylithReal* bboxRank = &bboxes[iRank*2*spaceDim];
+            bool isInside = true;
+            for (PetscInt iDim = 0; iDim < spaceDim && isInside; ++iDim) {
+                const PylithReal x = targetCoords[iTarget*spaceDim+iDim];
+                isInside = (x >= bboxRank[iDim]) && (x <= bboxRank[spaceDim+iDim]);
+            } // for
+            if (isInside) {
+                sendTargets[iRank].push_back(iTarget);
+            } // if
+        } // for
+    } // for
+    std::vector<int> sendCounts(commSize), recvCounts(commSize), sendOffsets(commSize+1, 0), recvOffsets(commSize+1, 0);
+    for (PetscMPIInt iRank = 0; iRank < commSize; ++iRank) {
+        sendCounts[iRank] = sendTargets[iRank].size();
+    } // for
+    err = MPI_Alltoall(&sendCounts[0], 1, MPI_INT, &recvCounts[0], 1, MPI_INT, comm);PYLITH_CHECK_ERROR(err);
+    for (PetscMPIInt iRank = 0; iRank < commSize; ++iRank) {
+        sendOffsets[iRank+1] = sendOffsets[iRank] + sendCounts[iRank];
+        recvOffsets[iRank+1] = recvOffsets[iRank] + recvCounts[iRank];
+    } // for
+    const int numSend = sendOffsets[commSize];
+    const int numRecv = recvOffsets[commSize];
+
+    std::vector<PylithReal> sendCoords(numSend*spaceDim+1);
+    for (PetscMPIInt iRank = 0, iSend = 0; iRank < commSize; ++iRank) {
+        for (size_t i = 0; i < sendTargets[iRank].size(); ++i, ++iSend) {
+            for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+                sendCoords[iSend*spaceDim+iDim] = targetCoords[sendTargets[iRank][i]*spaceDim+iDim];
+            } // for
+        } // for
+    } // for
+    std::vector<int> sendCountsCoords(commSize), recvCountsCoords(commSize), sendOffsetsCoords(commSize), recvOffsetsCoords(commSize);
+    for (PetscMPIInt iRank = 0; iRank < commSize; ++iRank) {
+        sendCountsCoords[iRank] = sendCounts[iRank]*spaceDim;
+        recvCountsCoords[iRank] = recvCounts[iRank]*spaceDim;
+        sendOffsetsCoords[iRank] = sendOffsets[iRank]*spaceDim;
+        recvOffsetsCoords[iRank] = recvOffsets[iRank]*spaceDim;
+    } // for
+    std::vector<PylithReal> recvCoords(numRecv*spaceDim+1);
+    err = MPI_Alltoallv(&sendCoords[0], &sendCountsCoords[0], &sendOffsetsCoords[0], MPIU_REAL,
+                        &recvCoords[0], &recvCountsCoords[0], &recvOffsetsCoords[0], MPIU_REAL, comm);PYLITH_CHECK_ERROR(err);
+
+    // Locate received points in local cells of mesh from file and interpolate values.
+    PetscVec recvVec = NULL;
+    PetscScalar* recvArray = NULL;
+    err = VecCreateSeq(PETSC_COMM_SELF, numRecv*spaceDim, &recvVec);PYLITH_CHECK_ERROR(err);
+    err = VecSetBlockSize(recvVec, spaceDim);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(recvVec, &recvArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numRecv*spaceDim; ++i) {
+        recvArray[i] = recvCoords[i];
+    } // for
+    err = VecRestoreArray(recvVec, &recvArray);PYLITH_CHECK_ERROR(err);
+
+    PetscSF cellSF = NULL;
+    PetscInt numFound = 0;
+    const PetscInt* foundPoints = NULL;
+    const PetscSFNode* foundCells = NULL;
+    err = DMLocatePoints(dmSource, recvVec, DM_POINTLOCATION_NONE, &cellSF);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(cellSF, NULL, &numFound, &foundPoints, &foundCells);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> foundRecv;
+    std::vector<PetscInt> foundCellsRecv;
+    for (PetscInt iFound = 0; iFound < numFound; ++iFound) {
+        if (foundCells[iFound].index >= 0) {
+            foundRecv.push_back(foundPoints ? foundPoints[iFound] : iFound);
+            foundCellsRecv.push_back(foundCells[iFound].index);
+        } // if
+    } // for
+    err = PetscSFDestroy(&cellSF);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&recvVec);PYLITH_CHECK_ERROR(err);
+    const PetscInt numFoundRecv = foundRecv.size();
+
+    // Setup interpolator with the located points and the cells containing them (as in OutputSolnPoints).
+    DMInterpolationInfo interpolator = NULL;
+    err = DMInterpolationCreate(PETSC_COMM_SELF, &interpolator);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDim(interpolator, spaceDim);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDof(interpolator, numDof);PYLITH_CHECK_ERROR(err);
+    interpolator->n = numFoundRecv;
+    err = PetscMalloc1(numFoundRecv, &interpolator->cells);PYLITH_CHECK_ERROR(err);
+    err = VecCreateSeq(PETSC_COMM_SELF, numFoundRecv*spaceDim, &interpolator->coords);PYLITH_CHECK_ERROR(err);
+    err = VecSetBlockSize(interpolator->coords, spaceDim);PYLITH_CHECK_ERROR(err);
+    PetscScalar* interpCoordsArray = NULL;
+    err = VecGetArray(interpolator->coords, &interpCoordsArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iFound = 0; iFound < numFoundRecv; ++iFound) {
+        interpolator->cells[iFound] = foundCellsRecv[iFound];
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            interpCoordsArray[iFound*spaceDim+iDim] = recvCoords[foundRecv[iFound]*spaceDim+iDim];
+        } // for
+    } // for
+    err = VecRestoreArray(interpolator->coords, &interpCoordsArray);PYLITH_CHECK_ERROR(err);
+
+    PetscVec interpVec = NULL;
+    err = VecCreateSeq(PETSC_COMM_SELF, numFoundRecv*numDof, &interpVec);PYLITH_CHECK_ERROR(err);
+    err = VecSetBlockSize(interpVec, numDof);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationEvaluate(interpolator, dmSource, sourceVec, interpVec);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationDestroy(&interpolator);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&sourceVec);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dmSource);PYLITH_CHECK_ERROR(err);
+
+    // Return flag indicating whether point was found, followed by the values.
+    const PetscInt numReply = numDof + 1;
+    std::vector<PetscScalar> replyValues(numRecv*numReply+1, 0.0);
+    const PetscScalar* interpArray = NULL;
+    err = VecGetArrayRead(interpVec, &interpArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iFound = 0; iFound < numFoundRecv; ++iFound) {
+        PetscScalar* reply = &replyValues[foundRecv[iFound]*numReply];
+        reply[0] = 1.0;
+        for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+            reply[1+iDof] = interpArray[iFound*numDof+iDof];
+        } // for
+    } // for
+    err = VecRestoreArrayRead(interpVec, &interpArray);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&interpVec);PYLITH_CHECK_ERROR(err);
+
+    for (PetscMPIInt iRank = 0; iRank < commSize; ++iRank) {
+        sendCountsCoords[iRank] = recvCounts[iRank]*numReply;
+        recvCountsCoords[iRank] = sendCounts[iRank]*numReply;
+        sendOffsetsCoords[iRank] = recvOffsets[iRank]*numReply;
+        recvOffsetsCoords[iRank] = sendOffsets[iRank]*numReply;
+    } // for
+    std::vector<PetscScalar> targetReplies(numSend*numReply+1);
+    err = MPI_Alltoallv(&replyValues[0], &sendCountsCoords[0], &sendOffsetsCoords[0], MPIU_SCALAR,
+                        &targetReplies[0], &recvCountsCoords[0], &recvOffsetsCoords[0], MPIU_SCALAR, comm);PYLITH_CHECK_ERROR(err);
+
+    // Use values from the lowest ranked process that found each point.
+    std::vector<const PetscScalar*> targetValues(numTargets, NULL);
+    for (PetscMPIInt iRank = 0, iSend = 0; iRank < commSize; ++iRank) {
+        for (size_t i = 0; i < sendTargets[iRank].size(); ++i, ++iSend) {
+            const PetscScalar* reply = &targetReplies[iSend*numReply];
+            if (!targetValues[sendTargets[iRank][i]] && (PetscRealPart(reply[0]) > 0.5)) {
+                targetValues[sendTargets[iRank][i]] = &reply[1];
+            } // if
+        } // for
+    } // for
+    PetscInt numMissingLocal = 0, numMissing = 0;
+    for (size_t iTarget = 0; iTarget < numTargets; ++iTarget) {
+        numMissingLocal += targetValues[iTarget] ? 0 : 1;
+    } // for
+    err = MPI_Allreduce(&numMissingLocal, &numMissing, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    if (numMissing > 0) {
+        std::ostringstream msg;
+        msg << "Could not find " << numMissing << " points with degrees of freedom in the mesh of the HDF5 file "
+            << "for initial conditions.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PetscScalar* solnArray = NULL;
+    err = VecGetArray(solution->getLocalVector(), &solnArray);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const PetscInt fieldIndex = solution->getSubfieldInfo(subfields[i].c_str()).index;
+        for (size_t iTarget = 0; iTarget < numTargets; ++iTarget) {
+            PetscInt off = 0, dof = 0;
+            err = PetscSectionGetFieldDof(solnSection, targetPoints[iTarget], fieldIndex, &dof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(solnSection, targetPoints[iTarget], fieldIndex, &off);PYLITH_CHECK_ERROR(err);
+            assert(!dof || info.numComponents[i] == dof);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                solnArray[off+iDof] = targetValues[iTarget][componentOffsets[i]+iDof];
+            } // for
+        } // for
+    } // for
+    err = VecRestoreArray(solution->getLocalVector(), &solnArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setValuesInterpolate
+
+
+// End of file
@@ -0,0 +1,104 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/InitialConditionFile.hh
+ *
+ * @brief C++ object for specifying initial conditions over the entire domain using the solution written to an HDF5
+ * file by DataWriterHDF5.
+ *
+ * If the vertices in the file match the vertices owned by each process, the values are copied directly into the
+ * solution. Otherwise, the values are interpolated using parallel point location in the mesh in the file.
+ */
+#if !defined(pylith_problems_initialconditionfile_hh)
+#define pylith_problems_initialconditionfile_hh
+
+#include "InitialCondition.hh" // ISA InitialCondition
+
+#include <string> // HASA std::string
+
+class pylith::problems::InitialConditionFile : public pylith::problems::InitialCondition {
+    friend class TestInitialConditionFile; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    InitialConditionFile(void);
+
+    /// Destructor
+    virtual ~InitialConditionFile(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set name of HDF5 file with solution.
+     *
+     * @param[in] value Name of HDF5 file written by DataWriterHDF5.
+     */
+    void setFilename(const char* value);
+
+    /** Get name of HDF5 file with solution.
+     *
+     * @returns Name of HDF5 file written by DataWriterHDF5.
+     */
+    const char* getFilename(void) const;
+
+    /** Set index of time step in file used for initial condition.
+     *
+     * @param[in] value Index of time step (negative values count from the last time step).
+     */
+    void setTimeStep(const int value);
+
+    /** Get index of time step in file used for initial condition.
+     *
+     * @returns Index of time step (negative values count from the last time step).
+     */
+    int getTimeStep(void) const;
+
+    /** Verify configuration is acceptable.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Set solution to values for initial condition.
+     *
+     * @param[out] solution Solution field.
+     * @param[in] normalizer Nondimensionalization.
+     */
+    void setValues(pylith::topology::Field* solution,
+                   const spatialdata::units::Nondimensional& normalizer);
+
+    // PRIVATE MEMEBRS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Name of HDF5 file with solution.
+    int _timeStep; ///< Index of time step in file.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    InitialConditionFile(const InitialConditionFile&); ///< Not implemented
+    const InitialConditionFile& operator=(const InitialConditionFile&); ///< Not implemented
+
+}; // InitialConditionFile
+
+#endif // pylith_problems_initialconditionfile_hh
+
+// End of file
@@ -25,7 +25,8 @@
 // ------------------------------------------------------------------------------------------------
 // Constructor.
 pylith::problems::ObserverPhysics::ObserverPhysics(void) :
-    _physics(NULL) {}
+    _physics(NULL),
+    _forceOutput(false) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -55,4 +56,51 @@ pylith::problems::ObserverPhysics::setPhysicsImplementation(const pylith::feasse
 } // setPhysicsImplemetation
 
 
+// ------------------------------------------------------------------------------------------------
+// Set name of load case observed in runs with multiple load cases.
+void
+pylith::problems::ObserverPhysics::setLoadCase(const char* value) {
+    _loadCase = value ? value : "";
+} // setLoadCase
+
+
+// ------------------------------------------------------------------------------------------------
+// Get name of load case observed in runs with multiple load cases.
+const char*
+pylith::problems::ObserverPhysics::getLoadCase(void) const {
+    return _loadCase.c_str();
+} // getLoadCase
+
+
+// ------------------------------------------------------------------------------------------------
+// Set flag for writing output at the next update regardless of the output trigger.
+void
+pylith::problems::ObserverPhysics::setForceOutput(const bool value) {
+    _forceOutput = value;
+} // setForceOutput
+
+
+// ------------------------------------------------------------------------------------------------
+// Get flag for writing output at the next update regardless of the output trigger.
+bool
+pylith::problems::ObserverPhysics::getForceOutput(void) const {
+    return _forceOutput;
+} // getForceOutput
+
+
+// ------------------------------------------------------------------------------------------------
+// Set cache for sharing projected subfields with other observers of the same subject.
+void
+pylith::problems::ObserverPhysics::setSubfieldCache(pylith::meshio::OutputSubfieldCache* cache) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether observer needs update at time t.
+bool
+pylith::problems::ObserverPhysics::needsUpdate(const PylithReal t,
+                                               const PylithInt tindex) const {
+    return true;
+} // needsUpdate
+
+
 // End of file
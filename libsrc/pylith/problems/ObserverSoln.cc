@@ -23,7 +23,8 @@
 // ---------------------------------------------------------------------------------------------------------------------
 // Constructor.
 pylith::problems::ObserverSoln::ObserverSoln(void) :
-index(0) {}
+index(0),
+_forceOutput(false) {}
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -39,4 +40,59 @@ void
 pylith::problems::ObserverSoln::deallocate(void) {}
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of load case observed in runs with multiple load cases.
+void
+pylith::problems::ObserverSoln::setLoadCase(const char* value) {
+    _loadCase = value ? value : "";
+} // setLoadCase
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of load case observed in runs with multiple load cases.
+const char*
+pylith::problems::ObserverSoln::getLoadCase(void) const {
+    return _loadCase.c_str();
+} // getLoadCase
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for writing output at the next update regardless of the output trigger.
+void
+pylith::problems::ObserverSoln::setForceOutput(const bool value) {
+    _forceOutput = value;
+} // setForceOutput
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag for writing output at the next update regardless of the output trigger.
+bool
+pylith::problems::ObserverSoln::getForceOutput(void) const {
+    return _forceOutput;
+} // getForceOutput
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set cache for sharing projected subfields with other observers of the same subject.
+void
+pylith::problems::ObserverSoln::setSubfieldCache(pylith::meshio::OutputSubfieldCache* cache) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether observer needs update at time t.
+bool
+pylith::problems::ObserverSoln::needsUpdate(const PylithReal t,
+                                            const PylithInt tindex) const {
+    return true;
+} // needsUpdate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Estimate number of bytes written per time step over all processes.
+PylithReal
+pylith::problems::ObserverSoln::estimateOutputSize(const pylith::topology::Field& solution) const {
+    return 0.0;
+} // estimateOutputSize
+
+
 // End of file
@@ -27,9 +27,12 @@
 
 #include "problemsfwd.hh" // forward declarations
 
+#include "pylith/meshio/meshiofwd.hh" // USES OutputSubfieldCache
 #include "pylith/topology/topologyfwd.hh" // USES Field
 #include "pylith/utils/types.hh" // USES PylithReal, PylithInt
 
+#include <string> // HASA std::string
+
 class pylith::problems::ObserverSoln {
     friend ObserversSoln; ///< Access to ordering index.
     friend class TestObserverSoln; // unit testing
@@ -61,6 +64,64 @@ public:
     virtual
     void verifyConfiguration(const pylith::topology::Field& solution) const = 0;
 
+    /** Set name of load case observed in runs with multiple load cases.
+     *
+     * @param[in] value Name of load case (empty for first load case).
+     */
+    void setLoadCase(const char* value);
+
+    /** Get name of load case observed in runs with multiple load cases.
+     *
+     * @returns Name of load case (empty for first load case).
+     */
+    const char* getLoadCase(void) const;
+
+    /** Set flag for writing output at the next update regardless of the output trigger.
+     *
+     * Used to write output at the last time step when a simulation stops early.
+     *
+     * @param[in] value True to write output regardless of output trigger, false otherwise.
+     */
+    void setForceOutput(const bool value);
+
+    /** Get flag for writing output at the next update regardless of the output trigger.
+     *
+     * @returns True if output is written regardless of output trigger, false otherwise.
+     */
+    bool getForceOutput(void) const;
+
+    /** Set cache for sharing projected subfields with other observers of the same subject.
+     *
+     * Default implementation does nothing.
+     *
+     * @param[in] cache Cache of projected subfields (NULL to project without cache).
+     */
+    virtual
+    void setSubfieldCache(pylith::meshio::OutputSubfieldCache* cache);
+
+    /** Check whether observer needs update at time t.
+     *
+     * Used to skip computing derived fields and scattering the solution to the output vector on time steps when no
+     * observer uses them. Default implementation returns true.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if update at time t uses the solution output vector or derived field, false otherwise.
+     */
+    virtual
+    bool needsUpdate(const PylithReal t,
+                     const PylithInt tindex) const;
+
+    /** Estimate number of bytes written per time step over all processes.
+     *
+     * Collective over the processes of the solution. Default implementation returns zero.
+     *
+     * @param[in] solution Solution field.
+     * @returns Average number of bytes written per time step.
+     */
+    virtual
+    PylithReal estimateOutputSize(const pylith::topology::Field& solution) const;
+
     /** Receive update (subject of observer).
      *
      * @param[in] t Current time.
@@ -77,6 +138,8 @@ public:
 private:
 
     size_t index; ///< Index for keeing set of observers ordered. 
+    std::string _loadCase; ///< Name of load case observed.
+    bool _forceOutput; ///< True if output is written regardless of output trigger.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
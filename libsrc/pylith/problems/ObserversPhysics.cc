@@ -22,8 +22,10 @@
 
 #include "pylith/problems/ObserverPhysics.hh" // USES ObserverPhysics
 #include "pylith/feassemble/PhysicsImplementation.hh" // USES PhysicsImplementation
+#include "pylith/meshio/OutputSubfieldCache.hh" // HASA OutputSubfieldCache
 #include "pylith/topology/Field.hh" // USES Field
 
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_DEBUG
 
@@ -31,7 +33,10 @@
 
 // ------------------------------------------------------------------------------------------------
 // Constructor.
-pylith::problems::ObserversPhysics::ObserversPhysics(void) {
+pylith::problems::ObserversPhysics::ObserversPhysics(void) :
+    _subfieldCache(new pylith::meshio::OutputSubfieldCache),
+    _isFirstLoadCase(true),
+    _suppressOutput(false) {
     // GenericComponent::setName("observersphysics");
 } // constructor
 
@@ -48,6 +53,7 @@ pylith::problems::ObserversPhysics::~ObserversPhysics(void) {
 void
 pylith::problems::ObserversPhysics::deallocate(void) {
     _observers.clear(); // Memory allocation of Observer* managed elsewhere.
+    delete _subfieldCache;_subfieldCache = NULL;
 } // deallocate
 
 
@@ -60,6 +66,7 @@ pylith::problems::ObserversPhysics::registerObserver(pylith::problems::ObserverP
 
     if (observer) {
         _observers.insert(observer);
+        observer->setSubfieldCache(_subfieldCache);
     } // if
 
     PYLITH_METHOD_END;
@@ -75,6 +82,7 @@ pylith::problems::ObserversPhysics::removeObserver(pylith::problems::ObserverPhy
 
     if (observer) {
         _observers.erase(observer);
+        observer->setSubfieldCache(NULL);
     } // if
 
     PYLITH_METHOD_END;
@@ -121,6 +129,35 @@ pylith::problems::ObserversPhysics::setTimeScale(const PylithReal value) {
 } // setTimeScale
 
 
+// ------------------------------------------------------------------------------------------------
+// Set current load case in runs with multiple load cases.
+void
+pylith::problems::ObserversPhysics::setLoadCase(const char* name,
+                                     const bool isFirst) {
+    _loadCase = name ? name : "";
+    _isFirstLoadCase = isFirst;
+} // setLoadCase
+
+
+// ------------------------------------------------------------------------------------------------
+// Set flag for suppressing output from all observers.
+void
+pylith::problems::ObserversPhysics::setSuppressOutput(const bool value) {
+    _suppressOutput = value;
+} // setSuppressOutput
+
+
+// ------------------------------------------------------------------------------------------------
+// Set flag for writing output at the next update regardless of the output triggers of the observers.
+void
+pylith::problems::ObserversPhysics::setForceOutput(const bool value) {
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        (*iter)->setForceOutput(value);
+    } // for
+} // setForceOutput
+
+
 // ------------------------------------------------------------------------------------------------
 // Verify observers.
 void
@@ -137,6 +174,25 @@ pylith::problems::ObserversPhysics::verifyObservers(const pylith::topology::Fiel
 } // verifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether any observer needs update at time t.
+bool
+pylith::problems::ObserversPhysics::needsUpdate(const PylithReal t,
+                                                const PylithInt tindex) const {
+    if (_suppressOutput) {
+        return false;
+    } // if
+
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        if (_observesLoadCase(*iter) && (*iter)->needsUpdate(t, tindex)) {
+            return true;
+        } // if
+    } // for
+    return false;
+} // needsUpdate
+
+
 // ------------------------------------------------------------------------------------------------
 // Notify observers.
 void
@@ -147,13 +203,35 @@ pylith::problems::ObserversPhysics::notifyObservers(const PylithReal t,
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("notifyObservers(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
 
+    if (_suppressOutput && !infoOnly) {
+        PYLITH_METHOD_END;
+    } // if
+
+    pylith::utils::EventLogger::stagePushShared("Output");
     for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
         assert(*iter);
-        (*iter)->update(t, tindex, solution, infoOnly);
+        if (infoOnly || _observesLoadCase(*iter)) {
+            (*iter)->update(t, tindex, solution, infoOnly);
+        } // if
     } // for
+    pylith::utils::EventLogger::stagePopShared();
 
     PYLITH_METHOD_END;
 } // notifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether observer receives updates for the current load case.
+bool
+pylith::problems::ObserversPhysics::_observesLoadCase(const ObserverPhysics* observer) const {
+    assert(observer);
+    if (_loadCase.empty()) {
+        return true;
+    } // if
+
+    const std::string loadCase(observer->getLoadCase());
+    return loadCase.empty() ? _isFirstLoadCase : loadCase == _loadCase;
+} // _observesLoadCase
+
+
 // End of file
@@ -21,8 +21,10 @@
 #include "ObserversSoln.hh" // Implementation of class methods
 
 #include "pylith/problems/ObserverSoln.hh" // USES ObserverSoln
+#include "pylith/meshio/OutputSubfieldCache.hh" // HASA OutputSubfieldCache
 #include "pylith/topology/Field.hh" // USES Field
 
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_DEBUG
 
@@ -30,7 +32,10 @@
 
 // ----------------------------------------------------------------------
 // Constructor.
-pylith::problems::ObserversSoln::ObserversSoln(void) {
+pylith::problems::ObserversSoln::ObserversSoln(void) :
+    _subfieldCache(new pylith::meshio::OutputSubfieldCache),
+    _isFirstLoadCase(true),
+    _suppressOutput(false) {
     GenericComponent::setName("observerssoln");
 } // constructor
 
@@ -47,6 +52,7 @@ pylith::problems::ObserversSoln::~ObserversSoln(void) {
 void
 pylith::problems::ObserversSoln::deallocate(void) {
     _observers.clear(); // Memory allocation of Observer* managed elsewhere.
+    delete _subfieldCache;_subfieldCache = NULL;
 } // deallocate
 
 
@@ -60,6 +66,7 @@ pylith::problems::ObserversSoln::registerObserver(pylith::problems::ObserverSoln
     if (observer) {
         observer->index = _observers.size();
         _observers.insert(observer);
+        observer->setSubfieldCache(_subfieldCache);
     } // if
 
     PYLITH_METHOD_END;
@@ -75,6 +82,7 @@ pylith::problems::ObserversSoln::removeObserver(pylith::problems::ObserverSoln*
 
     if (observer) {
         _observers.erase(observer);
+        observer->setSubfieldCache(NULL);
     } // if
 
     PYLITH_METHOD_END;
@@ -97,6 +105,35 @@ pylith::problems::ObserversSoln::setTimeScale(const PylithReal value) {
 } // setTimeScale
 
 
+// ----------------------------------------------------------------------
+// Set current load case in runs with multiple load cases.
+void
+pylith::problems::ObserversSoln::setLoadCase(const char* name,
+                                     const bool isFirst) {
+    _loadCase = name ? name : "";
+    _isFirstLoadCase = isFirst;
+} // setLoadCase
+
+
+// ----------------------------------------------------------------------
+// Set flag for suppressing output from all observers.
+void
+pylith::problems::ObserversSoln::setSuppressOutput(const bool value) {
+    _suppressOutput = value;
+} // setSuppressOutput
+
+
+// ----------------------------------------------------------------------
+// Set flag for writing output at the next update regardless of the output triggers of the observers.
+void
+pylith::problems::ObserversSoln::setForceOutput(const bool value) {
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        (*iter)->setForceOutput(value);
+    } // for
+} // setForceOutput
+
+
 // ----------------------------------------------------------------------
 // Verify observers.
 void
@@ -113,6 +150,42 @@ pylith::problems::ObserversSoln::verifyObservers(const pylith::topology::Field&
 } // verifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether any observer needs update at time t.
+bool
+pylith::problems::ObserversSoln::needsUpdate(const PylithReal t,
+                                             const PylithInt tindex) const {
+    if (_suppressOutput) {
+        return false;
+    } // if
+
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        if (_observesLoadCase(*iter) && (*iter)->needsUpdate(t, tindex)) {
+            return true;
+        } // if
+    } // for
+    return false;
+} // needsUpdate
+
+
+// ------------------------------------------------------------------------------------------------
+// Estimate number of bytes written by observers per time step over all processes.
+PylithReal
+pylith::problems::ObserversSoln::estimateOutputSize(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("estimateOutputSize(solution="<<solution.getLabel()<<")");
+
+    PylithReal size = 0.0;
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        size += (*iter)->estimateOutputSize(solution);
+    } // for
+
+    PYLITH_METHOD_RETURN(size);
+} // estimateOutputSize
+
+
 // ------------------------------------------------------------------------------------------------
 // Notify observers.
 void
@@ -122,10 +195,18 @@ pylith::problems::ObserversSoln::notifyObservers(const PylithReal t,
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("notifyObservers(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
 
+    if (_suppressOutput) {
+        PYLITH_METHOD_END;
+    } // if
+
+    pylith::utils::EventLogger::stagePushShared("Output");
     for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
         assert(*iter);
-        (*iter)->update(t, tindex, solution);
+        if (_observesLoadCase(*iter)) {
+            (*iter)->update(t, tindex, solution);
+        } // if
     } // for
+    pylith::utils::EventLogger::stagePopShared();
 
     PYLITH_METHOD_END;
 } // notifyObservers
@@ -142,4 +223,18 @@ pylith::problems::ObserversSoln::_compare::operator()(const ObserverSoln* const
 } // _compare
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether observer receives updates for the current load case.
+bool
+pylith::problems::ObserversSoln::_observesLoadCase(const ObserverSoln* observer) const {
+    assert(observer);
+    if (_loadCase.empty()) {
+        return true;
+    } // if
+
+    const std::string loadCase(observer->getLoadCase());
+    return loadCase.empty() ? _isFirstLoadCase : loadCase == _loadCase;
+} // _observesLoadCase
+
+
 // End of file
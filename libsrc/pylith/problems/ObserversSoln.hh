@@ -29,10 +29,12 @@
 
 #include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
 
+#include "pylith/meshio/meshiofwd.hh" // HOLDSA OutputSubfieldCache
 #include "pylith/topology/topologyfwd.hh" // USES Field
 #include "pylith/utils/types.hh" // USES PylithReal, PylithInt
 
 #include <set> // USES std::set
+#include <string> // HASA std::string
 
 class pylith::problems::ObserversSoln : public pylith::utils::GenericComponent {
     friend class TestObserversSoln; // unit testing
@@ -69,12 +71,56 @@ public:
      */
     void setTimeScale(const PylithReal value);
 
+    /** Set current load case in runs with multiple load cases.
+     *
+     * Observers with a load case only receive updates for that load case, and observers without a load case only
+     * receive updates for the first load case. All observers receive updates when the name is empty.
+     *
+     * @param[in] name Name of current load case.
+     * @param[in] isFirst True if current load case is the first load case.
+     */
+    void setLoadCase(const char* name,
+                     const bool isFirst);
+
+    /** Set flag for suppressing output from all observers.
+     *
+     * Observers neither need updates nor receive them while output is suppressed, so their output triggers are not
+     * advanced.
+     *
+     * @param[in] value True to suppress output, false otherwise.
+     */
+    void setSuppressOutput(const bool value);
+
+    /** Set flag for writing output at the next update regardless of the output triggers of the observers.
+     *
+     * @param[in] value True to write output regardless of output triggers, false otherwise.
+     */
+    void setForceOutput(const bool value);
+
     /** Verify observers are compatible.
      *
      * @param[in] solution Solution field.
      */
     void verifyObservers(const pylith::topology::Field& solution) const;
 
+    /** Check whether any observer needs update at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if at least one observer needs update, false otherwise.
+     */
+    bool needsUpdate(const PylithReal t,
+                     const PylithInt tindex) const;
+
+    /** Estimate number of bytes written by observers per time step over all processes.
+     *
+     * Collective over the processes of the solution.
+     *
+     * @param[in] solution Solution field.
+     * @returns Average number of bytes written per time step.
+     */
+    PylithReal estimateOutputSize(const pylith::topology::Field& solution) const;
+
     /** Send observers an update.
      *
      * @param[in] t Current time.
@@ -101,11 +147,22 @@ private:
 
     };
 
+    /** Check whether observer receives updates for the current load case.
+     *
+     * @param[in] observer Observer of subject.
+     * @returns True if observer receives updates for the current load case, false otherwise.
+     */
+    bool _observesLoadCase(const ObserverSoln* observer) const;
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
     typedef std::set<pylith::problems::ObserverSoln*>::iterator iterator; ///< Iterator.
     std::set<pylith::problems::ObserverSoln*, _compare> _observers; ///< Subscribers of updates.
+    pylith::meshio::OutputSubfieldCache* _subfieldCache; ///< Cache of projected subfields shared by observers.
+    std::string _loadCase; ///< Name of current load case.
+    bool _isFirstLoadCase; ///< True if current load case is the first load case.
+    bool _suppressOutput; ///< True if output is suppressed.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
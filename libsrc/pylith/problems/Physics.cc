@@ -38,7 +38,9 @@ pylith::problems::Physics::Physics(void) :
     _normalizer(NULL),
     _labelName(pylith::topology::Mesh::cells_label_name),
     _labelValue(1),
-    _observers(new pylith::problems::ObserversPhysics) {}
+    _observers(new pylith::problems::ObserversPhysics),
+    _kernelConstantsDt(0.0),
+    _haveKernelConstants(false) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -147,6 +149,21 @@ pylith::problems::Physics::setAuxiliaryFieldDB(spatialdata::spatialdb::SpatialDB
 } // setAuxiliaryFieldDB
 
 
+// ------------------------------------------------------------------------------------------------
+// Set file for caching values of auxiliary field.
+void
+pylith::problems::Physics::setAuxiliaryFieldCache(const char* filename,
+                                                  const char* dbKey) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setAuxiliaryFieldCache(filename="<<filename<<", dbKey="<<dbKey<<")");
+
+    pylith::feassemble::AuxiliaryFactory* factory = _getAuxiliaryFactory();assert(factory);
+    factory->setCache(filename, dbKey);
+
+    PYLITH_METHOD_END;
+} // setAuxiliaryFieldCache
+
+
 // ------------------------------------------------------------------------------------------------
 // Set discretization information for auxiliary subfield.
 void
@@ -231,7 +248,12 @@ pylith::problems::Physics::getObservers(void) {
 // Get constants used in kernels (point-wise functions).
 const pylith::real_array&
 pylith::problems::Physics::getKernelConstants(const PylithReal dt) {
-    _updateKernelConstants(dt);
+    // Kernel constants depend only on the time step, so only update them when it changes.
+    if (!_haveKernelConstants || (dt != _kernelConstantsDt)) {
+        _updateKernelConstants(dt);
+        _kernelConstantsDt = dt;
+        _haveKernelConstants = true;
+    } // if
 
     return _kernelConstants;
 } // getKernelConstants
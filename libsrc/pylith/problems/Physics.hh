@@ -108,6 +108,14 @@ public:
      */
     void setAuxiliaryFieldDB(spatialdata::spatialdb::SpatialDB* const value);
 
+    /** Set file for caching values of auxiliary field.
+     *
+     * @param[in] filename Name of HDF5 file for cache (empty string disables cache).
+     * @param[in] dbKey Key identifying spatial database and its parameters.
+     */
+    void setAuxiliaryFieldCache(const char* filename,
+                                const char* dbKey);
+
     /** Set discretization information for auxiliary subfield.
      *
      * @param[in] subfieldName Name of auxiliary subfield.
@@ -166,7 +174,8 @@ public:
 
     /** Get constants used in kernels (point-wise functions).
      *
-     * @param[in] solution Solution field.
+     * The constants are only updated when the time step changes.
+     *
      * @param[in] dt Current time step.
      *
      * @return Array of constants.
@@ -264,6 +273,8 @@ private:
     std::string _labelName; ///< Name of label in mesh for material.
     int _labelValue; ///< Value of label in mesh for material.
     pylith::problems::ObserversPhysics* _observers; ///< Subscribers of updates.
+    PylithReal _kernelConstantsDt; ///< Time step associated with current kernel constants.
+    bool _haveKernelConstants; ///< True if kernel constants have been set.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
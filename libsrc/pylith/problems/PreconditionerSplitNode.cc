@@ -0,0 +1,599 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "PreconditionerSplitNode.hh" // implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petscksp.h" // USES PetscKSP, PetscPC
+
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class _PreconditionerSplitNode {
+public:
+
+            /** Get global index stored in vector.
+             *
+             * @param[in] value Value in vector.
+             * @returns Global index (negative if none).
+             */
+            static
+            PetscInt toIndex(const PetscScalar value) {
+                const PetscReal index = PetscRealPart(value);
+                return (index < 0.0) ? -1 : PetscInt(index + 0.5);
+            } // toIndex
+
+            /** Get offset of this process in layout distributed among processes.
+             *
+             * @param[in] comm MPI communicator.
+             * @param[in] localSize Size on this process.
+             * @returns Offset of this process.
+             */
+            static
+            PetscInt getStart(MPI_Comm comm,
+                              const PetscInt localSize) {
+                PetscInt end = 0;
+                PetscErrorCode err = MPI_Scan(&localSize, &end, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+                return end - localSize;
+            } // getStart
+
+            /** Throw an exception on all processes if any process reports an error.
+             *
+             * @param[in] comm MPI communicator.
+             * @param[in] localMsg Error message on this process (empty if no error).
+             */
+            static
+            void checkError(MPI_Comm comm,
+                            const std::string& localMsg) {
+                int localError = localMsg.empty() ? 0 : 1;
+                int error = 0;
+                PetscErrorCode err = MPI_Allreduce(&localError, &error, 1, MPI_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+                if (error) {
+                    std::ostringstream msg;
+                    msg << "Could not create split node preconditioner for fault Lagrange multipliers. ";
+                    msg << (localMsg.empty() ? "Error on another process." : localMsg);
+                    throw std::runtime_error(msg.str());
+                } // if
+            } // checkError
+
+        }; // _PreconditionerSplitNode
+    } // problems
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::PreconditionerSplitNode::PreconditionerSplitNode(void) :
+    _displacementIS(NULL),
+    _lagrangeIS(NULL),
+    _projectMat(NULL),
+    _projectTMat(NULL),
+    _expandMat(NULL),
+    _displacementMat(NULL),
+    _constraintMat(NULL),
+    _couplingMat(NULL),
+    _constraintPosMat(NULL),
+    _couplingPosMat(NULL),
+    _reducedMat(NULL),
+    _reducedKSP(NULL),
+    _constraintKSP(NULL),
+    _couplingKSP(NULL),
+    _displacementWork(NULL),
+    _displacementUpdate(NULL),
+    _lagrangeWork(NULL),
+    _reducedWork(NULL),
+    _reducedSoln(NULL),
+    _nullSpace(NULL),
+    _numReducedDof(0),
+    _haveOperators(false) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::PreconditionerSplitNode::~PreconditionerSplitNode(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::PreconditionerSplitNode::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    err = ISDestroy(&_displacementIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_lagrangeIS);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_projectMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_projectTMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_expandMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_displacementMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_constraintMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_couplingMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_constraintPosMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_couplingPosMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_reducedMat);PYLITH_CHECK_ERROR(err);
+    err = KSPDestroy(&_reducedKSP);PYLITH_CHECK_ERROR(err);
+    err = KSPDestroy(&_constraintKSP);PYLITH_CHECK_ERROR(err);
+    err = KSPDestroy(&_couplingKSP);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_displacementWork);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_displacementUpdate);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_lagrangeWork);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_reducedWork);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_reducedSoln);PYLITH_CHECK_ERROR(err);
+    err = MatNullSpaceDestroy(&_nullSpace);PYLITH_CHECK_ERROR(err);
+    _numReducedDof = 0;
+    _haveOperators = false;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mappings between the displacement, Lagrange multiplier, and reduced degrees of freedom.
+void
+pylith::problems::PreconditionerSplitNode::initialize(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    deallocate();
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution.getDM();
+    MPI_Comm comm = solution.getMesh().getComm();
+    PetscSection localSection = solution.getLocalSection();
+    const PetscInt dispField = solution.getSubfieldInfo("displacement").index;
+    const PetscInt lagrangeField = solution.getSubfieldInfo("lagrange_multiplier_fault").index;
+
+    // Global indices of displacement and Lagrange multiplier degrees of freedom owned by this process.
+    PetscInt numFields = 0;
+    PetscIS* fieldIS = NULL;
+    err = DMCreateFieldIS(dmSoln, &numFields, NULL, &fieldIS);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iField = 0; iField < numFields; ++iField) {
+        if (iField == dispField) {
+            _displacementIS = fieldIS[iField];
+        } else if (iField == lagrangeField) {
+            _lagrangeIS = fieldIS[iField];
+        } else {
+            err = ISDestroy(&fieldIS[iField]);PYLITH_CHECK_ERROR(err);
+        } // if/else
+    } // for
+    err = PetscFree(fieldIS);PYLITH_CHECK_ERROR(err);
+    assert(_displacementIS);
+    assert(_lagrangeIS);
+
+    PetscInt numDisp = 0, numLagrange = 0;
+    const PetscInt *dispIndices = NULL, *lagrangeIndices = NULL;
+    err = ISGetLocalSize(_displacementIS, &numDisp);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(_lagrangeIS, &numLagrange);PYLITH_CHECK_ERROR(err);
+    const PetscInt dispStart = _PreconditionerSplitNode::getStart(comm, numDisp);
+    const PetscInt lagrangeStart = _PreconditionerSplitNode::getStart(comm, numLagrange);
+
+    // Index of each degree of freedom in the displacement or Lagrange multiplier space. Constrained degrees of
+    // freedom are not in the global vector, so they keep the value -1 in the local vector.
+    PetscVec indexGlobalVec = NULL, indexLocalVec = NULL;
+    PetscVec markerGlobalVec = NULL, markerLocalVec = NULL;
+    PetscInt rStart = 0;
+    PetscScalar* indexArray = NULL;
+    err = DMGetGlobalVector(dmSoln, &indexGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalVector(dmSoln, &markerGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetLocalVector(dmSoln, &indexLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetLocalVector(dmSoln, &markerLocalVec);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(indexGlobalVec, &rStart, NULL);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(_displacementIS, &dispIndices);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(_lagrangeIS, &lagrangeIndices);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(indexGlobalVec, &indexArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numDisp; ++i) {
+        indexArray[dispIndices[i]-rStart] = dispStart + i;
+    } // for
+    for (PetscInt i = 0; i < numLagrange; ++i) {
+        indexArray[lagrangeIndices[i]-rStart] = lagrangeStart + i;
+    } // for
+    err = VecRestoreArray(indexGlobalVec, &indexArray);PYLITH_CHECK_ERROR(err);
+    err = VecSet(indexLocalVec, -1.0);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmSoln, indexGlobalVec, INSERT_VALUES, indexLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSoln, indexGlobalVec, INSERT_VALUES, indexLocalVec);PYLITH_CHECK_ERROR(err);
+
+    // Pair each Lagrange multiplier owned by this process with the displacement degrees of freedom on the negative
+    // (cone[0]) and positive (cone[1]) sides of its cohesive point, and mark the positive side.
+    struct Pair {
+        PetscInt lagrangeIndex; ///< Index in Lagrange multiplier space.
+        PetscInt posIndex; ///< Index of positive side in displacement space.
+        PetscInt negOffset; ///< Offset of negative side in local vector.
+    };
+    std::vector<Pair> pairs;
+    std::ostringstream errorMsg;
+    const PetscScalar* indexLocalArray = NULL;
+    PetscScalar* markerLocalArray = NULL;
+    PetscInt pStart = 0, pEnd = 0;
+    err = VecSet(markerLocalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(indexLocalVec, &indexLocalArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(markerLocalVec, &markerLocalArray);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetChart(localSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd && errorMsg.str().empty(); ++point) {
+        PetscInt numLagrangeDof = 0;
+        err = PetscSectionGetFieldDof(localSection, point, lagrangeField, &numLagrangeDof);PYLITH_CHECK_ERROR(err);
+        if (!numLagrangeDof) { continue; }
+
+        const PetscInt* cone = NULL;
+        PetscInt coneSize = 0, numNegDof = 0, numPosDof = 0;
+        PetscInt lagrangeOffset = 0, negOffset = 0, posOffset = 0;
+        err = DMPlexGetConeSize(dmSoln, point, &coneSize);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetCone(dmSoln, point, &cone);PYLITH_CHECK_ERROR(err);
+        if (coneSize < 2) {
+            errorMsg << "Lagrange multiplier degrees of freedom on point " << point << " that is not a cohesive point.";
+            break;
+        } // if
+        err = PetscSectionGetFieldDof(localSection, cone[0], dispField, &numNegDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldDof(localSection, cone[1], dispField, &numPosDof);PYLITH_CHECK_ERROR(err);
+        if ((numNegDof != numLagrangeDof) || (numPosDof != numLagrangeDof)) {
+            errorMsg << "Discretization of the Lagrange multiplier does not match the discretization of the "
+                     << "displacement on cohesive point " << point << ".";
+            break;
+        } // if
+        err = PetscSectionGetFieldOffset(localSection, point, lagrangeField, &lagrangeOffset);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldOffset(localSection, cone[0], dispField, &negOffset);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldOffset(localSection, cone[1], dispField, &posOffset);PYLITH_CHECK_ERROR(err);
+
+        for (PetscInt iDof = 0; iDof < numLagrangeDof; ++iDof) {
+            const PetscInt lagrangeIndex = _PreconditionerSplitNode::toIndex(indexLocalArray[lagrangeOffset+iDof]);
+            if ((lagrangeIndex < lagrangeStart) || (lagrangeIndex >= lagrangeStart + numLagrange)) {
+                continue; // constrained (buried edge) or owned by another process
+            } // if
+            const PetscInt posIndex = _PreconditionerSplitNode::toIndex(indexLocalArray[posOffset+iDof]);
+            const PetscInt negIndex = _PreconditionerSplitNode::toIndex(indexLocalArray[negOffset+iDof]);
+            if ((posIndex < 0) || (negIndex < 0)) {
+                errorMsg << "Displacement on the fault is constrained where the Lagrange multiplier is not "
+                         << "(cohesive point " << point << ").";
+                break;
+            } // if
+            Pair pair;
+            pair.lagrangeIndex = lagrangeIndex;
+            pair.posIndex = posIndex;
+            pair.negOffset = negOffset + iDof;
+            pairs.push_back(pair);
+            markerLocalArray[posOffset+iDof] += 1.0;
+        } // for
+    } // for
+    err = VecRestoreArray(markerLocalVec, &markerLocalArray);PYLITH_CHECK_ERROR(err);
+    _PreconditionerSplitNode::checkError(comm, errorMsg.str());
+
+    err = VecSet(markerGlobalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalBegin(dmSoln, markerLocalVec, ADD_VALUES, markerGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmSoln, markerLocalVec, ADD_VALUES, markerGlobalVec);PYLITH_CHECK_ERROR(err);
+
+    // Number the reduced degrees of freedom (displacement not on the positive side of a fault).
+    const PetscScalar* markerArray = NULL;
+    err = VecGetArrayRead(markerGlobalVec, &markerArray);PYLITH_CHECK_ERROR(err);
+    _numReducedDof = 0;
+    for (PetscInt i = 0; i < numDisp; ++i) {
+        const PetscInt count = _PreconditionerSplitNode::toIndex(markerArray[dispIndices[i]-rStart]);
+        if (count > 1) {
+            errorMsg << "Displacement degree of freedom " << dispIndices[i] << " is on the positive side of more "
+                     << "than one fault. Fault intersections are not supported.";
+            break;
+        } // if
+        _numReducedDof += (0 == count) ? 1 : 0;
+    } // for
+    _PreconditionerSplitNode::checkError(comm, errorMsg.str());
+    const PetscInt reducedStart = _PreconditionerSplitNode::getStart(comm, _numReducedDof);
+
+    // Reduced index of each displacement degree of freedom (-1 on the positive side of a fault).
+    PetscVec reducedGlobalVec = NULL, reducedLocalVec = NULL;
+    PetscScalar* reducedArray = NULL;
+    std::vector<PetscInt> reducedIndices(numDisp);
+    err = DMGetGlobalVector(dmSoln, &reducedGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetLocalVector(dmSoln, &reducedLocalVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(reducedGlobalVec, -1.0);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(reducedGlobalVec, &reducedArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0, iReduced = reducedStart; i < numDisp; ++i) {
+        const bool isPos = _PreconditionerSplitNode::toIndex(markerArray[dispIndices[i]-rStart]) > 0;
+        reducedIndices[i] = isPos ? -1 : iReduced++;
+        reducedArray[dispIndices[i]-rStart] = reducedIndices[i];
+    } // for
+    err = VecRestoreArray(reducedGlobalVec, &reducedArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(markerGlobalVec, &markerArray);PYLITH_CHECK_ERROR(err);
+    err = VecSet(reducedLocalVec, -1.0);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmSoln, reducedGlobalVec, INSERT_VALUES, reducedLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSoln, reducedGlobalVec, INSERT_VALUES, reducedLocalVec);PYLITH_CHECK_ERROR(err);
+
+    // P: Lagrange multiplier space to positive side of displacement space.
+    err = MatCreateAIJ(comm, numLagrange, numDisp, PETSC_DETERMINE, PETSC_DETERMINE, 1, NULL, 1, NULL,
+                       &_projectMat);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        err = MatSetValue(_projectMat, pairs[i].lagrangeIndex, pairs[i].posIndex, 1.0, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = MatAssemblyBegin(_projectMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_projectMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatTranspose(_projectMat, MAT_INITIAL_MATRIX, &_projectTMat);PYLITH_CHECK_ERROR(err);
+
+    // Z: reduced space to displacement space. The positive side takes the value of the negative side. Rows for the
+    // positive side may be owned by another process.
+    const PetscScalar* reducedLocalArray = NULL;
+    err = MatCreateAIJ(comm, numDisp, _numReducedDof, PETSC_DETERMINE, PETSC_DETERMINE, 1, NULL, 1, NULL,
+                       &_expandMat);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numDisp; ++i) {
+        if (reducedIndices[i] < 0) { continue; }
+        err = MatSetValue(_expandMat, dispStart+i, reducedIndices[i], 1.0, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecGetArrayRead(reducedLocalVec, &reducedLocalArray);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        const PetscInt negReducedIndex = _PreconditionerSplitNode::toIndex(reducedLocalArray[pairs[i].negOffset]);
+        if (negReducedIndex < 0) {
+            errorMsg << "Displacement on the negative side of a fault is on the positive side of another fault. "
+                     << "Fault intersections are not supported.";
+            break;
+        } // if
+        err = MatSetValue(_expandMat, pairs[i].posIndex, negReducedIndex, 1.0, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecRestoreArrayRead(reducedLocalVec, &reducedLocalArray);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyBegin(_expandMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_expandMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    err = VecRestoreArrayRead(indexLocalVec, &indexLocalArray);PYLITH_CHECK_ERROR(err);
+    err = ISRestoreIndices(_displacementIS, &dispIndices);PYLITH_CHECK_ERROR(err);
+    err = ISRestoreIndices(_lagrangeIS, &lagrangeIndices);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSoln, &reducedLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreGlobalVector(dmSoln, &reducedGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSoln, &markerLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSoln, &indexLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreGlobalVector(dmSoln, &markerGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreGlobalVector(dmSoln, &indexGlobalVec);PYLITH_CHECK_ERROR(err);
+    _PreconditionerSplitNode::checkError(comm, errorMsg.str());
+
+    // Rigid body modes created with the solution field.
+    PetscObject field = NULL;
+    PetscObject nullSpace = NULL;
+    err = DMGetField(dmSoln, dispField, NULL, &field);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectQuery(field, "nearnullspace", &nullSpace);PYLITH_CHECK_ERROR(err);
+    if (nullSpace) {
+        _createNearNullSpace((PetscMatNullSpace) nullSpace);
+    } // if
+
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Use preconditioner as PETSc shell preconditioner.
+void
+pylith::problems::PreconditionerSplitNode::setShell(PetscPC pc) {
+    PYLITH_METHOD_BEGIN;
+    assert(pc);
+
+    PetscErrorCode err = 0;
+    err = PCShellSetContext(pc, this);PYLITH_CHECK_ERROR(err);
+    err = PCShellSetSetUp(pc, setUp);PYLITH_CHECK_ERROR(err);
+    err = PCShellSetApply(pc, apply);PYLITH_CHECK_ERROR(err);
+    err = PCShellSetName(pc, "Split node elimination of fault Lagrange multipliers");PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setShell
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of reduced degrees of freedom on this process.
+PylithInt
+pylith::problems::PreconditionerSplitNode::getNumReducedDof(void) const {
+    return _numReducedDof;
+} // getNumReducedDof
+
+
+// ------------------------------------------------------------------------------------------------
+// Set up operators and solvers for the current Jacobian (PCShellSetSetUp() callback).
+PetscErrorCode
+pylith::problems::PreconditionerSplitNode::setUp(PetscPC pc) {
+    PYLITH_METHOD_BEGIN;
+
+    void* context = NULL;
+    PetscErrorCode err = PCShellGetContext(pc, &context);PYLITH_CHECK_ERROR(err);
+    PreconditionerSplitNode* preconditioner = (PreconditionerSplitNode*)context;assert(preconditioner);
+    preconditioner->_setUp(pc);
+
+    PYLITH_METHOD_RETURN(0);
+} // setUp
+
+
+// ------------------------------------------------------------------------------------------------
+// Apply preconditioner (PCShellSetApply() callback).
+PetscErrorCode
+pylith::problems::PreconditionerSplitNode::apply(PetscPC pc,
+                                                 PetscVec x,
+                                                 PetscVec y) {
+    PYLITH_METHOD_BEGIN;
+
+    void* context = NULL;
+    PetscErrorCode err = PCShellGetContext(pc, &context);PYLITH_CHECK_ERROR(err);
+    PreconditionerSplitNode* preconditioner = (PreconditionerSplitNode*)context;assert(preconditioner);
+    preconditioner->_apply(x, y);
+
+    PYLITH_METHOD_RETURN(0);
+} // apply
+
+
+// ------------------------------------------------------------------------------------------------
+// Set up operators and solvers for the current Jacobian.
+void
+pylith::problems::PreconditionerSplitNode::_setUp(PetscPC pc) {
+    PYLITH_METHOD_BEGIN;
+    assert(_expandMat);
+
+    PetscErrorCode err = 0;
+    PetscMat jacobianMat = NULL;
+    err = PCGetOperators(pc, NULL, &jacobianMat);PYLITH_CHECK_ERROR(err);
+
+    // The nonzero pattern of the Jacobian does not change, so we reuse the operators after the first setup.
+    const MatReuse reuse = _haveOperators ? MAT_REUSE_MATRIX : MAT_INITIAL_MATRIX;
+    err = MatCreateSubMatrix(jacobianMat, _displacementIS, _displacementIS, reuse, &_displacementMat);PYLITH_CHECK_ERROR(err);
+    err = MatCreateSubMatrix(jacobianMat, _lagrangeIS, _displacementIS, reuse, &_constraintMat);PYLITH_CHECK_ERROR(err);
+    err = MatCreateSubMatrix(jacobianMat, _displacementIS, _lagrangeIS, reuse, &_couplingMat);PYLITH_CHECK_ERROR(err);
+    err = MatMatMult(_constraintMat, _projectTMat, reuse, PETSC_DEFAULT, &_constraintPosMat);PYLITH_CHECK_ERROR(err);
+    err = MatMatMult(_projectMat, _couplingMat, reuse, PETSC_DEFAULT, &_couplingPosMat);PYLITH_CHECK_ERROR(err);
+    err = MatPtAP(_displacementMat, _expandMat, reuse, PETSC_DEFAULT, &_reducedMat);PYLITH_CHECK_ERROR(err);
+
+    if (!_haveOperators) {
+        MPI_Comm comm = PetscObjectComm((PetscObject)pc);
+        const char* pcPrefix = NULL;
+        err = PCGetOptionsPrefix(pc, &pcPrefix);PYLITH_CHECK_ERROR(err);
+        const std::string prefix = pcPrefix ? pcPrefix : "";
+        PetscPC subPC = NULL;
+
+        // Reduced displacement system is symmetric positive definite.
+        if (_nullSpace) {
+            err = MatSetNearNullSpace(_reducedMat, _nullSpace);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = KSPCreate(comm, &_reducedKSP);PYLITH_CHECK_ERROR(err);
+        err = KSPSetOptionsPrefix(_reducedKSP, (prefix + "split_node_displacement_").c_str());PYLITH_CHECK_ERROR(err);
+        err = KSPSetType(_reducedKSP, KSPCG);PYLITH_CHECK_ERROR(err);
+        err = KSPGetPC(_reducedKSP, &subPC);PYLITH_CHECK_ERROR(err);
+        err = PCSetType(subPC, PCGAMG);PYLITH_CHECK_ERROR(err);
+        err = KSPSetTolerances(_reducedKSP, 1.0e-10, PETSC_DEFAULT, PETSC_DEFAULT, PETSC_DEFAULT);PYLITH_CHECK_ERROR(err);
+        err = KSPSetFromOptions(_reducedKSP);PYLITH_CHECK_ERROR(err);
+
+        // Fault blocks are square mass-like matrices on the positive side of the fault.
+        PetscKSP* faultKSPs[2] = { &_constraintKSP, &_couplingKSP };
+        for (int i = 0; i < 2; ++i) {
+            err = KSPCreate(comm, faultKSPs[i]);PYLITH_CHECK_ERROR(err);
+            err = KSPSetOptionsPrefix(*faultKSPs[i], (prefix + "split_node_fault_").c_str());PYLITH_CHECK_ERROR(err);
+            err = KSPSetType(*faultKSPs[i], KSPGMRES);PYLITH_CHECK_ERROR(err);
+            err = KSPGetPC(*faultKSPs[i], &subPC);PYLITH_CHECK_ERROR(err);
+            err = PCSetType(subPC, PCJACOBI);PYLITH_CHECK_ERROR(err);
+            err = KSPSetTolerances(*faultKSPs[i], 1.0e-12, PETSC_DEFAULT, PETSC_DEFAULT, PETSC_DEFAULT);PYLITH_CHECK_ERROR(err);
+            err = KSPSetFromOptions(*faultKSPs[i]);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        err = MatCreateVecs(_displacementMat, &_displacementWork, &_displacementUpdate);PYLITH_CHECK_ERROR(err);
+        err = MatCreateVecs(_constraintPosMat, &_lagrangeWork, NULL);PYLITH_CHECK_ERROR(err);
+        err = MatCreateVecs(_reducedMat, &_reducedSoln, &_reducedWork);PYLITH_CHECK_ERROR(err);
+        _haveOperators = true;
+    } // if
+    err = KSPSetOperators(_reducedKSP, _reducedMat, _reducedMat);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(_constraintKSP, _constraintPosMat, _constraintPosMat);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(_couplingKSP, _couplingPosMat, _couplingPosMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setUp
+
+
+// ------------------------------------------------------------------------------------------------
+// Apply preconditioner.
+void
+pylith::problems::PreconditionerSplitNode::_apply(PetscVec x,
+                                                  PetscVec y) {
+    PYLITH_METHOD_BEGIN;
+    assert(_haveOperators);
+
+    PetscErrorCode err = 0;
+    PetscVec xDisp = NULL, xLagrange = NULL, yDisp = NULL, yLagrange = NULL;
+    err = VecGetSubVector(x, _displacementIS, &xDisp);PYLITH_CHECK_ERROR(err);
+    err = VecGetSubVector(x, _lagrangeIS, &xLagrange);PYLITH_CHECK_ERROR(err);
+    err = VecGetSubVector(y, _displacementIS, &yDisp);PYLITH_CHECK_ERROR(err);
+    err = VecGetSubVector(y, _lagrangeIS, &yLagrange);PYLITH_CHECK_ERROR(err);
+
+    // Displacement on positive side satisfying constraint: B P^T t = r_lambda, du_p = P^T t.
+    err = KSPSolve(_constraintKSP, xLagrange, _lagrangeWork);PYLITH_CHECK_ERROR(err);
+    err = MatMult(_projectTMat, _lagrangeWork, _displacementUpdate);PYLITH_CHECK_ERROR(err);
+
+    // Reduced system: Z^T K Z v = Z^T (r_u - K du_p), du = Z v + du_p.
+    err = MatMult(_displacementMat, _displacementUpdate, _displacementWork);PYLITH_CHECK_ERROR(err);
+    err = VecAYPX(_displacementWork, -1.0, xDisp);PYLITH_CHECK_ERROR(err);
+    err = MatMultTranspose(_expandMat, _displacementWork, _reducedWork);PYLITH_CHECK_ERROR(err);
+    err = KSPSolve(_reducedKSP, _reducedWork, _reducedSoln);PYLITH_CHECK_ERROR(err);
+    err = MatMultAdd(_expandMat, _reducedSoln, _displacementUpdate, yDisp);PYLITH_CHECK_ERROR(err);
+
+    // Lagrange multipliers from equations on positive side: P C dlambda = P (r_u - K du).
+    err = MatMult(_displacementMat, yDisp, _displacementWork);PYLITH_CHECK_ERROR(err);
+    err = VecAYPX(_displacementWork, -1.0, xDisp);PYLITH_CHECK_ERROR(err);
+    err = MatMult(_projectMat, _displacementWork, _lagrangeWork);PYLITH_CHECK_ERROR(err);
+    err = KSPSolve(_couplingKSP, _lagrangeWork, yLagrange);PYLITH_CHECK_ERROR(err);
+
+    err = VecRestoreSubVector(y, _lagrangeIS, &yLagrange);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreSubVector(y, _displacementIS, &yDisp);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreSubVector(x, _lagrangeIS, &xLagrange);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreSubVector(x, _displacementIS, &xDisp);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _apply
+
+
+// ------------------------------------------------------------------------------------------------
+// Create near null space of the reduced operator from the rigid body modes of the displacement.
+void
+pylith::problems::PreconditionerSplitNode::_createNearNullSpace(PetscMatNullSpace nullSpace) {
+    PYLITH_METHOD_BEGIN;
+    assert(nullSpace);
+    assert(_expandMat);
+
+    PetscErrorCode err = 0;
+    PetscBool hasConstant = PETSC_FALSE;
+    PetscInt numModes = 0;
+    const PetscVec* modes = NULL;
+    err = MatNullSpaceGetVecs(nullSpace, &hasConstant, &numModes, &modes);PYLITH_CHECK_ERROR(err);
+    if (!numModes) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Reduced mode is Z^T u divided by the number of displacement degrees of freedom mapped to each reduced one,
+    // which recovers the rigid body mode at the reduced degrees of freedom.
+    PetscVec weightVec = NULL, onesVec = NULL;
+    err = MatCreateVecs(_expandMat, &weightVec, &onesVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(onesVec, 1.0);PYLITH_CHECK_ERROR(err);
+    err = MatMultTranspose(_expandMat, onesVec, weightVec);PYLITH_CHECK_ERROR(err);
+    err = VecReciprocal(weightVec);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PetscVec> reducedModes(numModes);
+    for (PetscInt i = 0; i < numModes; ++i) {
+        PetscVec dispMode = NULL;
+        err = VecDuplicate(weightVec, &reducedModes[i]);PYLITH_CHECK_ERROR(err);
+        err = VecGetSubVector(modes[i], _displacementIS, &dispMode);PYLITH_CHECK_ERROR(err);
+        err = MatMultTranspose(_expandMat, dispMode, reducedModes[i]);PYLITH_CHECK_ERROR(err);
+        err = VecRestoreSubVector(modes[i], _displacementIS, &dispMode);PYLITH_CHECK_ERROR(err);
+        err = VecPointwiseMult(reducedModes[i], reducedModes[i], weightVec);PYLITH_CHECK_ERROR(err);
+
+        // Modified Gram-Schmidt, because MatNullSpaceCreate() requires orthonormal vectors.
+        for (PetscInt j = 0; j < i; ++j) {
+            PetscScalar dot = 0.0;
+            err = VecDot(reducedModes[i], reducedModes[j], &dot);PYLITH_CHECK_ERROR(err);
+            err = VecAXPY(reducedModes[i], -dot, reducedModes[j]);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = VecNormalize(reducedModes[i], NULL);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = MatNullSpaceCreate(PetscObjectComm((PetscObject)_expandMat), PETSC_FALSE, numModes, &reducedModes[0],
+                             &_nullSpace);PYLITH_CHECK_ERROR(err);
+
+    for (PetscInt i = 0; i < numModes; ++i) {
+        err = VecDestroy(&reducedModes[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecDestroy(&weightVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&onesVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _createNearNullSpace
+
+
+// End of file
@@ -0,0 +1,160 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** @file libsrc/problems/PreconditionerSplitNode.hh
+ *
+ * @brief Preconditioner eliminating the fault Lagrange multipliers in problems with prescribed slip.
+ *
+ * The fault constraint B u = d ties each displacement degree of freedom on the positive side of a fault to the
+ * matching degree of freedom on the negative side. We parameterize the displacement as u = Z y + P^T t, where Z maps
+ * the reduced (split node) degrees of freedom to the displacement by copying the value of the negative side to the
+ * positive side, so B Z = 0, and P^T t is a displacement on the positive side that satisfies the constraint. The
+ * displacement is found from the symmetric positive definite system Z^T K Z y = Z^T (r_u - K P^T t), which does not
+ * contain the Lagrange multipliers, and the Lagrange multipliers are recovered from the equations of the positive
+ * side. The application is exact for the saddle point system, so the outer Krylov solver converges in a few
+ * iterations when the inner solves are accurate.
+ *
+ * The Lagrange multiplier block of the Jacobian is zero for prescribed slip, so the Lagrange multipliers cannot be
+ * eliminated by static condensation; instead, the displacement on the positive side is eliminated.
+ */
+
+#if !defined(pylith_problems_preconditionersplitnode_hh)
+#define pylith_problems_preconditionersplitnode_hh
+
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/petscfwd.h" // HASA PetscMat, PetscKSP, PetscIS
+#include "pylith/utils/types.hh" // HASA PylithInt
+
+class pylith::problems::PreconditionerSplitNode {
+    friend class TestPreconditionerSplitNode; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    PreconditionerSplitNode(void);
+
+    /// Destructor
+    ~PreconditionerSplitNode(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Create mappings between the displacement, Lagrange multiplier, and reduced degrees of freedom.
+     *
+     * The solution must contain only the displacement and Lagrange multiplier subfields with the same
+     * discretization. Fault intersections are not supported.
+     *
+     * @param[in] solution Solution field with global section.
+     */
+    void initialize(const pylith::topology::Field& solution);
+
+    /** Use preconditioner as PETSc shell preconditioner.
+     *
+     * @param[inout] pc PETSc preconditioner of type PCSHELL.
+     */
+    void setShell(PetscPC pc);
+
+    /** Get number of reduced degrees of freedom on this process.
+     *
+     * @returns Number of displacement degrees of freedom that are not on the positive side of a fault.
+     */
+    PylithInt getNumReducedDof(void) const;
+
+    /** Set up operators and solvers for the current Jacobian (PCShellSetSetUp() callback).
+     *
+     * @param[in] pc PETSc preconditioner.
+     * @returns PETSc error code.
+     */
+    static
+    PetscErrorCode setUp(PetscPC pc);
+
+    /** Apply preconditioner (PCShellSetApply() callback).
+     *
+     * @param[in] pc PETSc preconditioner.
+     * @param[in] x Input vector (residual).
+     * @param[out] y Output vector (update).
+     * @returns PETSc error code.
+     */
+    static
+    PetscErrorCode apply(PetscPC pc,
+                         PetscVec x,
+                         PetscVec y);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Set up operators and solvers for the current Jacobian.
+     *
+     * @param[in] pc PETSc preconditioner with assembled Jacobian as preconditioning matrix.
+     */
+    void _setUp(PetscPC pc);
+
+    /** Apply preconditioner.
+     *
+     * @param[in] x Input vector (residual).
+     * @param[out] y Output vector (update).
+     */
+    void _apply(PetscVec x,
+                PetscVec y);
+
+    /** Create near null space of the reduced operator from the rigid body modes of the displacement.
+     *
+     * @param[in] nullSpace Rigid body modes of the solution.
+     */
+    void _createNearNullSpace(PetscMatNullSpace nullSpace);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    PetscIS _displacementIS; ///< Global indices of displacement degrees of freedom.
+    PetscIS _lagrangeIS; ///< Global indices of Lagrange multiplier degrees of freedom.
+    PetscMat _projectMat; ///< P: Lagrange multiplier to positive side displacement degrees of freedom.
+    PetscMat _projectTMat; ///< P^T.
+    PetscMat _expandMat; ///< Z: reduced to displacement degrees of freedom.
+    PetscMat _displacementMat; ///< K: displacement block of Jacobian.
+    PetscMat _constraintMat; ///< B: Lagrange multiplier rows and displacement columns of Jacobian.
+    PetscMat _couplingMat; ///< C: displacement rows and Lagrange multiplier columns of Jacobian.
+    PetscMat _constraintPosMat; ///< B P^T.
+    PetscMat _couplingPosMat; ///< P C.
+    PetscMat _reducedMat; ///< Z^T K Z.
+    PetscKSP _reducedKSP; ///< Solver for reduced displacement system.
+    PetscKSP _constraintKSP; ///< Solver for B P^T.
+    PetscKSP _couplingKSP; ///< Solver for P C.
+    PetscVec _displacementWork; ///< Work vector for displacement.
+    PetscVec _displacementUpdate; ///< Work vector for displacement update.
+    PetscVec _lagrangeWork; ///< Work vector for Lagrange multiplier.
+    PetscVec _reducedWork; ///< Work vector for reduced degrees of freedom.
+    PetscVec _reducedSoln; ///< Solution of reduced system.
+    PetscMatNullSpace _nullSpace; ///< Near null space of reduced operator.
+    PylithInt _numReducedDof; ///< Number of reduced degrees of freedom on this process.
+    bool _haveOperators; ///< True if operators have been created.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    PreconditionerSplitNode(const PreconditionerSplitNode&); ///< Not implemented
+    const PreconditionerSplitNode& operator=(const PreconditionerSplitNode&); ///< Not implemented
+
+}; // PreconditionerSplitNode
+
+#endif // pylith_problems_preconditionersplitnode_hh
+
+// End of file
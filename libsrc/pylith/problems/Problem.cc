@@ -33,17 +33,30 @@
 #include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface
 #include "pylith/feassemble/Constraint.hh" // USES Constraint
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
+#include "pylith/problems/Physics.hh" // USES Physics
+#include "pylith/problems/PreconditionerSplitNode.hh" // HOLDSA PreconditionerSplitNode
 #include "pylith/topology/MeshOps.hh" // USES MeshOps
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor::optimizeClosure()
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 
+#include "pylith/utils/HardwareCounters.hh" // USES HardwareCounters
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
+#include "pylith/utils/PetscOptions.hh" // USES PetscOptions
+#include "pylith/utils/SetupProfiler.hh" // USES SetupProfiler
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
 #include <cassert> // USES assert()
+#include <fstream> // USES std::ofstream
+#include <algorithm> // USES std::count(), std::fill()
+#include <iomanip> // USES std::setprecision()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <set> // USES std::set
 #include <typeinfo> // USES typeid()
+#include <vector> // USES std::vector
 
 // ------------------------------------------------------------------------------------------------
 namespace pylith {
@@ -60,6 +73,33 @@ public:
             void createNullSpace(const pylith::topology::Field* solution,
                                  const char* subfieldName);
 
+            /** Create rigid body modes as near null space for a field of a DM.
+             *
+             * Matches the signature of DMSetNearNullSpaceConstructor(), so PETSc creates the near null space
+             * for the subfield block whenever it creates a sub-DM, such as for the displacement split in a Schur
+             * complement fieldsplit preconditioner in problems with faults or poroelasticity.
+             *
+             * @param[in] dm PETSc DM for (sub)problem.
+             * @param[in] origField Index of field in original DM.
+             * @param[in] field Index of field in dm.
+             * @param[out] nullSpace Near null space.
+             */
+            static
+            PetscErrorCode createRigidBodyModes(PetscDM dm,
+                                                PetscInt origField,
+                                                PetscInt field,
+                                                MatNullSpace* nullSpace);
+
+            /** Create coarse DMs for the solution field from the coarse meshes kept by uniform refinement.
+             *
+             * Each coarse DM has the discretization and constraints of the solution field, so PETSc can create the
+             * interpolation between levels for geometric multigrid (PCMG).
+             *
+             * @param[inout] solution Solution field.
+             */
+            static
+            void createCoarseSolutionDMs(const pylith::topology::Field* solution);
+
             /** Set data needed to integrate domain faces on interior interface.
              *
              * @param[inout] solution Solution field.
@@ -76,6 +116,16 @@ public:
              */
             template<class T> static std::vector<T*> subset(const std::vector<pylith::feassemble::Integrator*>& integrators);
 
+            /** Get name of setup phase for a physics object.
+             *
+             * @param[in] action Name of action in setup phase.
+             * @param[in] physics Physics object (may be NULL).
+             * @returns Name of setup phase.
+             */
+            static
+            std::string getPhaseName(const char* action,
+                                     const pylith::problems::Physics* physics);
+
         };
     }
 }
@@ -89,7 +139,13 @@ pylith::problems::Problem::Problem() :
     _observers(new pylith::problems::ObserversSoln),
     _formulation(pylith::problems::Physics::QUASISTATIC),
     _solverType(LINEAR),
-    _petscDefaults(pylith::utils::PetscDefaults::SOLVER | pylith::utils::PetscDefaults::TESTING) {}
+    _device(DEVICE_NONE),
+    _jacobianStorage(JACOBIAN_AIJ),
+    _petscDefaults(pylith::utils::PetscDefaults::SOLVER | pylith::utils::PetscDefaults::TESTING),
+    _assemblyChunkSize(0),
+    _cacheGeometry(true),
+    _useSplitNodeSolver(false),
+    _preconditionerSplitNode(NULL) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -119,8 +175,10 @@ pylith::problems::Problem::deallocate(void) {
     delete _normalizer;_normalizer = NULL;
     _gravityField = NULL; // Held by Python. :KLUDGE: :TODO: Use shared pointer.
     delete _observers;_observers = NULL;
+    delete _preconditionerSplitNode;_preconditionerSplitNode = NULL;
 
     pylith::topology::FieldOps::deallocate();
+    pylith::utils::MemoryLogger::release(this);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -165,6 +223,42 @@ pylith::problems::Problem::getSolverType(void) const {
 } // getSolverType
 
 
+// ------------------------------------------------------------------------------------------------
+// Set device for solution vectors and Jacobian matrices.
+void
+pylith::problems::Problem::setDevice(const DeviceEnum value) {
+    PYLITH_COMPONENT_DEBUG("Problem::setDevice(value="<<value<<")");
+
+    _device = value;
+} // setDevice
+
+
+// ------------------------------------------------------------------------------------------------
+// Get device for solution vectors and Jacobian matrices.
+pylith::problems::Problem::DeviceEnum
+pylith::problems::Problem::getDevice(void) const {
+    return _device;
+} // getDevice
+
+
+// ------------------------------------------------------------------------------------------------
+// Set storage of assembled Jacobian matrices.
+void
+pylith::problems::Problem::setJacobianStorage(const JacobianStorageEnum value) {
+    PYLITH_COMPONENT_DEBUG("Problem::setJacobianStorage(value="<<value<<")");
+
+    _jacobianStorage = value;
+} // setJacobianStorage
+
+
+// ------------------------------------------------------------------------------------------------
+// Get storage of assembled Jacobian matrices.
+pylith::problems::Problem::JacobianStorageEnum
+pylith::problems::Problem::getJacobianStorage(void) const {
+    return _jacobianStorage;
+} // getJacobianStorage
+
+
 // ------------------------------------------------------------------------------------------------
 // Specify whether to set defaults for PETSc solver appropriate for problem.
 void
@@ -197,6 +291,44 @@ pylith::problems::Problem::setGravityField(spatialdata::spatialdb::GravityField*
 } // setGravityField
 
 
+// ------------------------------------------------------------------------------------------------
+// Set maximum number of cells assembled in each call to the PETSc assembly routines.
+void
+pylith::problems::Problem::setAssemblyChunkSize(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("Problem::setAssemblyChunkSize(value="<<value<<")");
+
+    _assemblyChunkSize = value;
+} // setAssemblyChunkSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Set flag for caching cell geometry between assembly calls.
+void
+pylith::problems::Problem::setCacheGeometry(const bool value) {
+    PYLITH_COMPONENT_DEBUG("Problem::setCacheGeometry(value="<<value<<")");
+
+    _cacheGeometry = value;
+} // setCacheGeometry
+
+
+// ------------------------------------------------------------------------------------------------
+// Set flag for eliminating the fault Lagrange multipliers in the preconditioner.
+void
+pylith::problems::Problem::setUseSplitNodeSolver(const bool value) {
+    PYLITH_COMPONENT_DEBUG("Problem::setUseSplitNodeSolver(value="<<value<<")");
+
+    _useSplitNodeSolver = value;
+} // setUseSplitNodeSolver
+
+
+// ------------------------------------------------------------------------------------------------
+// Get flag for eliminating the fault Lagrange multipliers in the preconditioner.
+bool
+pylith::problems::Problem::getUseSplitNodeSolver(void) const {
+    return _useSplitNodeSolver;
+} // getUseSplitNodeSolver
+
+
 // ----------------------------------------------------------------------
 // Register observer to receive notifications.
 void
@@ -246,8 +378,8 @@ pylith::problems::Problem::getSolution(void) const {
 
     assert(_integrationData);
     pylith::topology::Field* solution = NULL;
-    if (_integrationData->hasField(pylith::feassemble::IntegrationData::solution)) {
-        solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    if (_integrationData->hasField(pylith::feassemble::IntegrationData::FIELD_SOLUTION)) {
+        solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     } // if
 
     PYLITH_METHOD_RETURN(solution);
@@ -260,14 +392,40 @@ const pylith::topology::Field*
 pylith::problems::Problem::getSolutionDot(void) const {
     assert(_integrationData);
     pylith::topology::Field* solutionDot = NULL;
-    if (_integrationData->hasField(pylith::feassemble::IntegrationData::solution_dot)) {
-        solutionDot = _integrationData->getField(pylith::feassemble::IntegrationData::solution_dot);
+    if (_integrationData->hasField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT)) {
+        solutionDot = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);
     } // if
 
     PYLITH_METHOD_RETURN(solutionDot);
 } // getSolutionDot
 
 
+// ------------------------------------------------------------------------------------------------
+// Get auxiliary field of physics.
+const pylith::topology::Field*
+pylith::problems::Problem::getAuxiliaryField(const char* identifier) const {
+    PYLITH_METHOD_BEGIN;
+    assert(identifier);
+
+    std::vector<const pylith::feassemble::PhysicsImplementation*> implementations;
+    implementations.insert(implementations.end(), _integrators.begin(), _integrators.end());
+    implementations.insert(implementations.end(), _constraints.begin(), _constraints.end());
+    for (size_t i = 0; i < implementations.size(); ++i) {
+        assert(implementations[i]);
+        const pylith::problems::Physics* physics = implementations[i]->getPhysics();
+        if (physics && (std::string(identifier) == physics->getIdentifier()) && implementations[i]->getAuxiliaryField()) {
+            PYLITH_METHOD_RETURN(implementations[i]->getAuxiliaryField());
+        } // if
+    } // for
+
+    std::ostringstream msg;
+    msg << "Could not find auxiliary field for physics '" << identifier << "'. Has the problem been initialized?";
+    throw std::runtime_error(msg.str());
+
+    PYLITH_METHOD_RETURN(NULL);
+} // getAuxiliaryField
+
+
 // ------------------------------------------------------------------------------------------------
 // Set materials.
 void
@@ -368,7 +526,7 @@ pylith::problems::Problem::verifyConfiguration(void) const {
     PYLITH_COMPONENT_DEBUG("Problem::verifyConfiguration(void)");
 
     assert(_integrationData);
-    const pylith::topology::Field* solution = _integrationData->getField("solution");
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
 
     // Check to make sure materials are compatible with the solution.
@@ -394,6 +552,27 @@ pylith::problems::Problem::verifyConfiguration(void) const {
 
     _checkMaterialLabels();
 
+    if (_useSplitNodeSolver) {
+        std::ostringstream msg;
+        if (pylith::problems::Physics::QUASISTATIC != _formulation) {
+            msg << "Split node solver requires the quasistatic formulation.";
+        } else if ((2 != solution->getSubfieldNames().size()) || !solution->hasSubfield("displacement") ||
+                   !solution->hasSubfield("lagrange_multiplier_fault")) {
+            msg << "Split node solver requires a solution with only the displacement and "
+                << "lagrange_multiplier_fault subfields.";
+        } else if (solution->getSubfieldInfo("displacement").fe.basisOrder !=
+                   solution->getSubfieldInfo("lagrange_multiplier_fault").fe.basisOrder) {
+            msg << "Split node solver requires the same basis order for the displacement and "
+                << "lagrange_multiplier_fault subfields.";
+        } else if (JACOBIAN_AIJ != _jacobianStorage) {
+            msg << "Split node solver requires 'aij' storage of the Jacobian.";
+        } // if/else
+        if (!msg.str().empty()) {
+            msg << " Set 'split_node_solver' to False in problem '" << PyreComponent::getIdentifier() << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
     assert(_observers);
     _observers->verifyObservers(*solution);
 
@@ -409,33 +588,75 @@ pylith::problems::Problem::initialize(void) {
     PYLITH_COMPONENT_DEBUG("Problem::initialize()");
 
     assert(_integrationData);
-    pylith::topology::Field* solution = _integrationData->getField("solution");
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
 
-    // Initialize solution field.
-    PetscErrorCode err = DMSetFromOptions(solution->getDM());PYLITH_CHECK_ERROR(err);
+    // Initialize solution field. Set device types before DMSetFromOptions(), so that -dm_vec_type and -dm_mat_type
+    // take precedence.
+    PetscErrorCode err = 0;
+    switch (_device) {
+    case DEVICE_NONE:
+        break;
+    case DEVICE_CUDA:
+        err = DMSetVecType(solution->getDM(), VECCUDA);PYLITH_CHECK_ERROR(err);
+        err = DMSetMatType(solution->getDM(), MATAIJCUSPARSE);PYLITH_CHECK_ERROR(err);
+        break;
+    case DEVICE_HIP:
+        err = DMSetVecType(solution->getDM(), VECHIP);PYLITH_CHECK_ERROR(err);
+        err = DMSetMatType(solution->getDM(), MATAIJHIPSPARSE);PYLITH_CHECK_ERROR(err);
+        break;
+    case DEVICE_KOKKOS:
+        err = DMSetVecType(solution->getDM(), VECKOKKOS);PYLITH_CHECK_ERROR(err);
+        err = DMSetMatType(solution->getDM(), MATAIJKOKKOS);PYLITH_CHECK_ERROR(err);
+        break;
+    default:
+        PYLITH_COMPONENT_LOGICERROR("Unknown device type '" << _device << "'.");
+    } // switch
+    pylith::utils::SetupProfiler::begin("Setup solution");
+    err = DMSetFromOptions(solution->getDM());PYLITH_CHECK_ERROR(err);
     _setupSolution();
     pylith::topology::CoordsVisitor::optimizeClosure(solution->getDM());
+    pylith::utils::SetupProfiler::end("Setup solution");
 
     // Initialize integrators.
+    pylith::utils::SetupProfiler::begin("Create integrators");
     _createIntegrators();
+    pylith::utils::SetupProfiler::end("Create integrators");
+    pylith::utils::SetupProfiler::begin("Initialize integrators");
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
         assert(_integrators[i]);
+        const std::string& phase = _Problem::getPhaseName("Initialize", _integrators[i]->getPhysics());
+        pylith::utils::SetupProfiler::begin(phase.c_str());
         _integrators[i]->initialize(*solution);
+        pylith::utils::SetupProfiler::end(phase.c_str());
     } // for
+    pylith::utils::SetupProfiler::end("Initialize integrators");
 
     // Initialize constraints.
+    pylith::utils::SetupProfiler::begin("Create constraints");
     _createConstraints();
+    pylith::utils::SetupProfiler::end("Create constraints");
+    pylith::utils::SetupProfiler::begin("Initialize constraints");
     const size_t numConstraints = _constraints.size();
     for (size_t i = 0; i < numConstraints; ++i) {
         assert(_constraints[i]);
+        const std::string& phase = _Problem::getPhaseName("Initialize", _constraints[i]->getPhysics());
+        pylith::utils::SetupProfiler::begin(phase.c_str());
         _constraints[i]->initialize(*solution);
+        pylith::utils::SetupProfiler::end(phase.c_str());
     } // for
+    pylith::utils::SetupProfiler::end("Initialize constraints");
+
+    // Discretization, including constraints, is complete, so we can create the coarse levels (if any).
+    pylith::utils::SetupProfiler::begin("Allocate solution and Jacobian");
+    _Problem::createCoarseSolutionDMs(solution);
 
     solution->allocate();
     solution->createGlobalVector();
     solution->createOutputVector();
+    _setJacobianStorage();
+    pylith::utils::SetupProfiler::end("Allocate solution and Jacobian");
 
     switch (_formulation) {
     case pylith::problems::Physics::DYNAMIC:
@@ -459,6 +680,609 @@ pylith::problems::Problem::initialize(void) {
 } // initialize
 
 
+// ------------------------------------------------------------------------------------------------
+// Reset problem for another run, reusing the mesh, integrators, constraints, and solution layout.
+void
+pylith::problems::Problem::reinitialize(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::reinitialize()");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        _integrators[i]->reinitialize(*solution);
+    } // for
+
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        assert(_constraints[i]);
+        _constraints[i]->reinitialize(*solution);
+    } // for
+
+    PYLITH_METHOD_END;
+} // reinitialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Write performance of integrators to JSON file.
+void
+pylith::problems::Problem::writePerformanceReport(const char* filename) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("writePerformanceReport(filename="<<filename<<")");
+    typedef pylith::feassemble::Integrator Integrator;
+    typedef pylith::utils::HardwareCounters HardwareCounters;
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    MPI_Comm comm = solution->getMesh().getComm();
+    int commRank = 0, commSize = 1;
+    MPI_Comm_rank(comm, &commRank);
+    MPI_Comm_size(comm, &commSize);
+
+    // Pack local values as [numCells, numDOF, numCalls(numEvents), time(numEvents), flops(numEvents),
+    // counters(numEvents*numCounters)] for each integrator.
+    const size_t numIntegrators = _integrators.size();
+    const size_t numEvents = Integrator::PROFILE_NUM_EVENTS;
+    const size_t numCounters = HardwareCounters::NUM_COUNTERS;
+    const size_t stride = 2 + (3+numCounters)*numEvents;
+    std::vector<double> localValues(stride*numIntegrators);
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        double* values = &localValues[stride*i];
+        values[0] = _integrators[i]->getProfileNumCells();
+        values[1] = _integrators[i]->getProfileNumDOF();
+        for (size_t iEvent = 0; iEvent < numEvents; ++iEvent) {
+            const Integrator::ProfileStats& stats = _integrators[i]->getProfileStats(Integrator::ProfileEvent(iEvent));
+            values[2+iEvent] = stats.numCalls;
+            values[2+numEvents+iEvent] = stats.time;
+            values[2+2*numEvents+iEvent] = stats.flops;
+            for (size_t iCounter = 0; iCounter < numCounters; ++iCounter) {
+                values[2+3*numEvents+iEvent*numCounters+iCounter] = stats.counters[iCounter];
+            } // for
+        } // for
+    } // for
+    const int numValues = localValues.size();
+    std::vector<double> sumValues(numValues);
+    std::vector<double> maxValues(numValues);
+    PetscErrorCode err = 0;
+    err = MPI_Reduce(numValues ? &localValues[0] : NULL, numValues ? &sumValues[0] : NULL, numValues, MPI_DOUBLE,
+                     MPI_SUM, 0, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Reduce(numValues ? &localValues[0] : NULL, numValues ? &maxValues[0] : NULL, numValues, MPI_DOUBLE,
+                     MPI_MAX, 0, comm);PYLITH_CHECK_ERROR(err);
+    int hasCounters = HardwareCounters::isActive() ? 1 : 0;
+    err = MPI_Allreduce(MPI_IN_PLACE, &hasCounters, 1, MPI_INT, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    if (commRank) {
+        PYLITH_METHOD_END;
+    } // if
+
+    std::ofstream fout(filename);
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open file '" << filename << "' for performance report.";
+        throw std::runtime_error(msg.str());
+    } // if
+    fout << std::setprecision(6);
+    fout << "{\n"
+         << "  \"num_processes\": " << commSize << ",\n"
+         << "  \"integrators\": [";
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        const double* sum = &sumValues[stride*i];
+        const double* max = &maxValues[stride*i];
+        std::string name = _integrators[i]->getProfileName();
+        for (size_t pos = name.find_first_of("\"\\"); pos != std::string::npos; pos = name.find_first_of("\"\\", pos+2)) {
+            name.insert(pos, "\\");
+        } // for
+        fout << (i ? ",\n" : "\n")
+             << "    {\n"
+             << "      \"name\": \"" << name << "\",\n"
+             << "      \"num_cells\": " << size_t(sum[0]) << ",\n"
+             << "      \"num_dof\": " << size_t(sum[1]) << ",\n"
+             << "      \"events\": {";
+        bool isFirst = true;
+        for (size_t iEvent = 0; iEvent < numEvents; ++iEvent) {
+            const double numCalls = max[2+iEvent];
+            if (numCalls <= 0.0) { continue; }
+            const double timeMax = max[2+numEvents+iEvent];
+            const double timeMean = sum[2+numEvents+iEvent] / commSize;
+            const double cellRate = (timeMax > 0.0) ? sum[0]*numCalls / timeMax : 0.0;
+            const double dofRate = (timeMax > 0.0) ? sum[1]*numCalls / timeMax : 0.0;
+            fout << (isFirst ? "\n" : ",\n")
+                 << "        \"" << Integrator::getProfileEventName(Integrator::ProfileEvent(iEvent)) << "\": {"
+                 << "\"calls\": " << size_t(numCalls)
+                 << ", \"time_max\": " << timeMax
+                 << ", \"time_mean\": " << timeMean
+                 << ", \"cells_per_second\": " << cellRate
+                 << ", \"dof_per_second\": " << dofRate
+                 << ", \"flops\": " << sum[2+2*numEvents+iEvent];
+            if (hasCounters) {
+                // Counters are summed over processes; the maximum number of cycles identifies the slowest process.
+                const double* counters = &sum[2+3*numEvents+iEvent*numCounters];
+                const double cyclesMax = max[2+3*numEvents+iEvent*numCounters+HardwareCounters::CYCLES];
+                const double cycles = counters[HardwareCounters::CYCLES];
+                const double instructions = counters[HardwareCounters::INSTRUCTIONS];
+                const double dramBytes = counters[HardwareCounters::LLC_MISSES] * HardwareCounters::getCacheLineSize();
+                const double flops = sum[2+2*numEvents+iEvent];
+                for (size_t iCounter = 0; iCounter < numCounters; ++iCounter) {
+                    fout << ", \"" << HardwareCounters::getCounterName(HardwareCounters::CounterEnum(iCounter)) << "\": "
+                         << counters[iCounter];
+                } // for
+                fout << ", \"cycles_max\": " << cyclesMax
+                     << ", \"instructions_per_cycle\": " << ((cycles > 0.0) ? instructions / cycles : 0.0)
+                     << ", \"dram_bytes\": " << dramBytes
+                     << ", \"flops_per_byte\": " << ((dramBytes > 0.0) ? flops / dramBytes : 0.0)
+                     << ", \"instructions_per_byte\": " << ((dramBytes > 0.0) ? instructions / dramBytes : 0.0);
+            } // if
+            fout << "}";
+            isFirst = false;
+        } // for
+        fout << (isFirst ? "}\n" : "\n      }\n")
+             << "    }";
+    } // for
+    fout << (numIntegrators ? "\n  ]\n" : "]\n")
+         << "}\n";
+    if (!fout.good()) {
+        std::ostringstream msg;
+        msg << "Error writing performance report to file '" << filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // writePerformanceReport
+
+
+// ------------------------------------------------------------------------------------------------
+// Estimate computational resources for running problem.
+std::string
+pylith::problems::Problem::estimateResources(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::estimateResources()");
+
+    // Setup solution, integrators, and constraints without time stepping, solver, or Jacobian.
+    Problem::initialize();
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+    PetscDM dmSoln = solution->getDM();assert(dmSoln);
+    MPI_Comm comm = solution->getMesh().getComm();
+
+    const pylith::string_vector& subfieldNames = solution->getSubfieldNames();
+    const size_t numSubfields = subfieldNames.size();
+    pylith::int_array subfieldIndices(numSubfields);
+    for (size_t i = 0; i < numSubfields; ++i) {
+        subfieldIndices[i] = solution->getSubfieldInfo(subfieldNames[i].c_str()).index;
+    } // for
+
+    // Unconstrained degrees of freedom of each subfield at each point.
+    PetscErrorCode err = 0;
+    PetscSection localSection = solution->getLocalSection();assert(localSection);
+    PetscSection globalSection = solution->getGlobalSection();assert(globalSection);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(localSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> pointDof((pEnd-pStart)*numSubfields, 0);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        for (size_t i = 0; i < numSubfields; ++i) {
+            PetscInt dof = 0, cdof = 0;
+            err = PetscSectionGetFieldDof(localSection, point, subfieldIndices[i], &dof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldConstraintDof(localSection, point, subfieldIndices[i], &cdof);PYLITH_CHECK_ERROR(err);
+            pointDof[(point-pStart)*numSubfields+i] = dof - cdof;
+        } // for
+    } // for
+
+    // Count rows and nonzeros in each block of the Jacobian for points owned by this process using the same
+    // adjacency as the preallocation of the Jacobian.
+    std::vector<PetscInt64> counts(numSubfields + numSubfields*numSubfields, 0);
+    PetscInt64* numRows = &counts[0];
+    PetscInt64* numNonzeros = &counts[numSubfields];
+    std::vector<PetscInt64> adjacentDof(numSubfields);
+    PetscInt* adjacency = NULL;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt goff = 0;
+        err = PetscSectionGetOffset(globalSection, point, &goff);PYLITH_CHECK_ERROR(err);
+        const PetscInt* dofPoint = &pointDof[(point-pStart)*numSubfields];
+        if ((goff < 0) || (std::count(dofPoint, dofPoint+numSubfields, 0) == PetscInt(numSubfields))) {
+            continue;
+        } // if
+
+        PetscInt adjacencySize = PETSC_DETERMINE;
+        err = DMPlexGetAdjacency(dmSoln, point, &adjacencySize, &adjacency);PYLITH_CHECK_ERROR(err);
+        std::fill(adjacentDof.begin(), adjacentDof.end(), 0);
+        for (PetscInt iAdj = 0; iAdj < adjacencySize; ++iAdj) {
+            const PetscInt* dofAdj = &pointDof[(adjacency[iAdj]-pStart)*numSubfields];
+            for (size_t j = 0; j < numSubfields; ++j) {
+                adjacentDof[j] += dofAdj[j];
+            } // for
+        } // for
+        for (size_t i = 0; i < numSubfields; ++i) {
+            numRows[i] += dofPoint[i];
+            for (size_t j = 0; j < numSubfields; ++j) {
+                numNonzeros[i*numSubfields+j] += dofPoint[i] * adjacentDof[j];
+            } // for
+        } // for
+    } // for
+    err = PetscFree(adjacency);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PetscInt64> countsGlobal(counts.size(), 0);
+    err = MPI_Allreduce(&counts[0], &countsGlobal[0], counts.size(), MPIU_INT64, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+    // Memory on this process.
+    PetscInt64 numRowsLocal = 0, numNonzerosLocal = 0;
+    for (size_t i = 0; i < numSubfields; ++i) {
+        numRowsLocal += numRows[i];
+        for (size_t j = 0; j < numSubfields; ++j) {
+            numNonzerosLocal += numNonzeros[i*numSubfields+j];
+        } // for
+    } // for
+    std::set<const pylith::topology::Field*> auxiliaryFields;
+    for (size_t i = 0; i < _integrators.size(); ++i) {
+        assert(_integrators[i]);
+        auxiliaryFields.insert(_integrators[i]->getAuxiliaryField());
+    } // for
+    for (size_t i = 0; i < _constraints.size(); ++i) {
+        assert(_constraints[i]);
+        auxiliaryFields.insert(_constraints[i]->getAuxiliaryField());
+    } // for
+    auxiliaryFields.erase(NULL);
+    PylithReal auxiliaryBytes = 0.0;
+    for (std::set<const pylith::topology::Field*>::const_iterator iter = auxiliaryFields.begin(); iter != auxiliaryFields.end(); ++iter) {
+        auxiliaryBytes += PylithReal((*iter)->getStorageSize()) * sizeof(PylithScalar);
+    } // for
+    const PylithReal jacobianBytes = PylithReal(numNonzerosLocal) * (sizeof(PetscScalar) + sizeof(PetscInt)) +
+                                     PylithReal(numRowsLocal) * 3 * sizeof(PetscInt);
+    PetscLogDouble currentBytes = 0.0;
+    err = PetscMemoryGetCurrentUsage(&currentBytes);PYLITH_CHECK_ERROR(err);
+
+    const size_t numLocal = 6;
+    const char* localKeys[numLocal] = {
+        "Degrees of freedom",
+        "Solution vector (MB)",
+        "Auxiliary fields (MB)",
+        "Jacobian matrix, AIJ (MB)",
+        "Current memory (MB)",
+        "Estimated memory, current + Jacobian (MB)",
+    };
+    const PylithReal mb = 1024.0*1024.0;
+    const PylithReal localValues[numLocal] = {
+        PylithReal(numRowsLocal),
+        PylithReal(solution->getStorageSize()) * sizeof(PylithScalar) / mb,
+        auxiliaryBytes / mb,
+        jacobianBytes / mb,
+        currentBytes / mb,
+        (currentBytes + jacobianBytes) / mb,
+    };
+    PylithReal minValues[numLocal], maxValues[numLocal], sumValues[numLocal];
+    err = MPI_Reduce(localValues, minValues, numLocal, MPIU_REAL, MPI_MIN, 0, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Reduce(localValues, maxValues, numLocal, MPIU_REAL, MPI_MAX, 0, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Reduce(localValues, sumValues, numLocal, MPIU_REAL, MPI_SUM, 0, comm);PYLITH_CHECK_ERROR(err);
+
+    assert(_observers);
+    const PylithReal outputBytes = _observers->estimateOutputSize(*solution);
+
+    int commRank = 0, commSize = 1;
+    MPI_Comm_rank(comm, &commRank);
+    MPI_Comm_size(comm, &commSize);
+    if (commRank) {
+        PYLITH_METHOD_RETURN(std::string(""));
+    } // if
+
+    const int keyWidth = 44;
+    std::ostringstream msg;
+    msg << "Estimated resources over " << commSize << " process(es):\n"
+        << "  Degrees of freedom (unconstrained):\n";
+    PetscInt64 numRowsGlobal = 0;
+    for (size_t i = 0; i < numSubfields; ++i) {
+        msg << "    " << std::left << std::setw(keyWidth-2) << subfieldNames[i] << std::right << std::setw(16)
+            << countsGlobal[i] << "\n";
+        numRowsGlobal += countsGlobal[i];
+    } // for
+    msg << "    " << std::left << std::setw(keyWidth-2) << "total" << std::right << std::setw(16) << numRowsGlobal << "\n";
+    msg << "  Nonzeros in Jacobian (row subfield, column subfield):\n";
+    PetscInt64 numNonzerosGlobal = 0;
+    for (size_t i = 0; i < numSubfields; ++i) {
+        for (size_t j = 0; j < numSubfields; ++j) {
+            const PetscInt64 value = countsGlobal[numSubfields+i*numSubfields+j];
+            if (!value) {
+                continue;
+            } // if
+            msg << "    " << std::left << std::setw(keyWidth-2) << (subfieldNames[i] + ", " + subfieldNames[j])
+                << std::right << std::setw(16) << value << "\n";
+            numNonzerosGlobal += value;
+        } // for
+    } // for
+    msg << "    " << std::left << std::setw(keyWidth-2) << "total" << std::right << std::setw(16) << numNonzerosGlobal << "\n";
+    msg << "  Output per time step from solution observers (MB): " << std::fixed << std::setprecision(2)
+        << outputBytes / mb << "\n";
+    msg << "  Per process:\n"
+        << "    " << std::left << std::setw(keyWidth-2) << "" << std::right
+        << std::setw(12) << "min" << std::setw(12) << "mean" << std::setw(12) << "max" << "\n";
+    for (size_t i = 0; i < numLocal; ++i) {
+        msg << std::setprecision(i ? 2 : 0)
+            << "    " << std::left << std::setw(keyWidth-2) << localKeys[i] << std::right
+            << std::setw(12) << minValues[i]
+            << std::setw(12) << sumValues[i] / commSize
+            << std::setw(12) << maxValues[i] << "\n";
+    } // for
+    msg << "  Memory for the preconditioner and solver work vectors is not included.";
+
+    PYLITH_METHOD_RETURN(msg.str());
+} // estimateResources
+
+
+// ------------------------------------------------------------------------------------------------
+// Reuse sparsity pattern and communication pattern of assembled Jacobian in subsequent assemblies.
+void
+pylith::problems::Problem::_reuseJacobianPattern(PetscMat mat) {
+    PYLITH_METHOD_BEGIN;
+    assert(mat);
+
+    PetscErrorCode err = 0;
+    err = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    err = MatSetOption(mat, MAT_SUBSET_OFF_PROC_ENTRIES, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _reuseJacobianPattern
+
+
+// ------------------------------------------------------------------------------------------------
+// Ignore entries in lower triangle when inserting values into matrix with symmetric storage.
+void
+pylith::problems::Problem::_ignoreLowerTriangular(PetscMat mat) {
+    PYLITH_METHOD_BEGIN;
+    assert(mat);
+
+    PetscBool isSymmetricStorage = PETSC_FALSE;
+    PetscErrorCode err = PetscObjectTypeCompareAny((PetscObject)mat, &isSymmetricStorage, MATSBAIJ, MATSEQSBAIJ,
+                                                   MATMPISBAIJ, "");PYLITH_CHECK_ERROR(err);
+    if (isSymmetricStorage) {
+        err = MatSetOption(mat, MAT_IGNORE_LOWER_TRIANGULAR, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _ignoreLowerTriangular
+
+
+// ------------------------------------------------------------------------------------------------
+// Record memory used by assembled Jacobian and preconditioner matrices.
+void
+pylith::problems::Problem::_recordJacobianMemory(PetscMat jacobianMat,
+                                                 PetscMat precondMat) {
+    PYLITH_METHOD_BEGIN;
+    assert(jacobianMat);
+    assert(precondMat);
+
+    PetscErrorCode err = 0;
+    MatInfo info;
+    err = MatGetInfo(precondMat, MAT_LOCAL, &info);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::record(this, "Jacobian", "preconditioner matrix", size_t(info.memory));
+    if (jacobianMat != precondMat) {
+        err = MatGetInfo(jacobianMat, MAT_LOCAL, &info);PYLITH_CHECK_ERROR(err);
+        pylith::utils::MemoryLogger::record(this, "Jacobian", "Jacobian matrix", size_t(info.memory));
+    } // if
+
+    PYLITH_METHOD_END;
+} // _recordJacobianMemory
+
+
+// ------------------------------------------------------------------------------------------------
+// Set matrix type of solution DM for storage of Jacobian matrices.
+void
+pylith::problems::Problem::_setJacobianStorage(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::_setJacobianStorage()");
+
+    if (JACOBIAN_AIJ == _jacobianStorage) {
+        PYLITH_METHOD_END;
+    } // if
+    if (DEVICE_NONE != _device) {
+        PYLITH_COMPONENT_WARNING("Ignoring blocked or unassembled storage of Jacobian. It is not supported on devices.");
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+    PetscDM dmSoln = solution->getDM();
+
+    PetscErrorCode err = 0;
+    const char* prefix = NULL;
+    PetscBool hasMatType = PETSC_FALSE;
+    err = PetscObjectGetOptionsPrefix((PetscObject)dmSoln, &prefix);PYLITH_CHECK_ERROR(err);
+    err = PetscOptionsHasName(NULL, prefix, "-dm_mat_type", &hasMatType);PYLITH_CHECK_ERROR(err);
+    if (hasMatType) {
+        PYLITH_METHOD_END;
+    } // if
+
+    if (JACOBIAN_IS == _jacobianStorage) {
+        // Each process assembles the matrix of its subdomain without communication.
+        PYLITH_COMPONENT_DEBUG("Using unassembled subdomain storage of Jacobian.");
+        err = DMSetMatType(dmSoln, MATIS);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
+
+    // Block size used by DMCreateMatrix(): number of unconstrained degrees of freedom if it is the same at every
+    // point on every process, 1 otherwise. Points with only some degrees of freedom constrained give 1.
+    PetscSection globalSection = NULL;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMGetGlobalSection(dmSoln, &globalSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetChart(globalSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    PetscInt blockSize = -1;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, cdof = 0;
+        err = PetscSectionGetDof(globalSection, point, &dof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetConstraintDof(globalSection, point, &cdof);PYLITH_CHECK_ERROR(err);
+        dof = (dof < 0) ? -(dof+1) : dof;
+        if (!dof) { continue; }
+        const PetscInt pointBlockSize = (cdof && (dof - cdof)) ? 1 : dof;
+        blockSize = (blockSize < 0) ? pointBlockSize : ((blockSize != pointBlockSize) ? 1 : blockSize);
+    } // for
+    PetscInt blockSizeLocal[2] = { (blockSize < 0) ? PETSC_MAX_INT : blockSize, (blockSize < 0) ? 0 : blockSize };
+    PetscInt blockSizeMin = 0, blockSizeMax = 0;
+    err = MPI_Allreduce(&blockSizeLocal[0], &blockSizeMin, 1, MPIU_INT, MPI_MIN, solution->getMesh().getComm());PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&blockSizeLocal[1], &blockSizeMax, 1, MPIU_INT, MPI_MAX, solution->getMesh().getComm());PYLITH_CHECK_ERROR(err);
+    blockSize = (blockSizeMin == blockSizeMax) ? blockSizeMin : 1;
+    if (blockSize <= 1) {
+        PYLITH_COMPONENT_WARNING("Ignoring blocked storage of Jacobian. The number of unconstrained degrees of freedom "
+                                 "differs among points, as in problems with faults or Dirichlet boundary conditions "
+                                 "that constrain only some components.");
+        PYLITH_METHOD_END;
+    } // if
+
+    JacobianStorageEnum storage = _jacobianStorage;
+    if ((JACOBIAN_SBAIJ == storage) && ((pylith::problems::Physics::QUASISTATIC != _formulation) ||
+                                        (solution->getSubfieldNames().size() != 1) || !solution->hasSubfield("displacement"))) {
+        PYLITH_COMPONENT_WARNING("Using nonsymmetric blocked storage of Jacobian. Symmetric storage requires the "
+                                 "quasistatic formulation with only the displacement solution subfield.");
+        storage = JACOBIAN_BAIJ;
+    } // if
+    PYLITH_COMPONENT_DEBUG("Using blocked storage of Jacobian with block size "<<blockSize<<".");
+    err = DMSetMatType(dmSoln, (JACOBIAN_SBAIJ == storage) ? MATSBAIJ : MATBAIJ);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setJacobianStorage
+
+
+// ------------------------------------------------------------------------------------------------
+// Supply information about the solution field to a BDDC preconditioner or attach the split node preconditioner.
+void
+pylith::problems::Problem::_setPreconditionerHints(PetscSNES snes) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::_setPreconditionerHints(snes="<<snes<<")");
+
+    PetscErrorCode err = 0;
+    PetscKSP ksp = NULL;
+    PetscPC pc = NULL;
+    PetscBool isBDDC = PETSC_FALSE;
+    err = SNESGetKSP(snes, &ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPGetPC(ksp, &pc);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectTypeCompare((PetscObject)pc, PCBDDC, &isBDDC);PYLITH_CHECK_ERROR(err);
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    // User options may replace the shell preconditioner with another preconditioner.
+    PetscBool isShell = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)pc, PCSHELL, &isShell);PYLITH_CHECK_ERROR(err);
+    if (_useSplitNodeSolver && isShell) {
+        delete _preconditionerSplitNode;_preconditionerSplitNode = new PreconditionerSplitNode;
+        assert(_preconditionerSplitNode);
+        _preconditionerSplitNode->initialize(*solution);
+        _preconditionerSplitNode->setShell(pc);
+        PYLITH_METHOD_END;
+    } // if
+
+    if (!isBDDC) {
+        PYLITH_METHOD_END;
+    } // if
+    PetscDM dmSoln = solution->getDM();
+
+    // Matrices are created when the nonlinear solver is set up.
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
+    PetscBool isMatIS = PETSC_FALSE;
+    err = SNESSetUp(snes);PYLITH_CHECK_ERROR(err);
+    err = SNESGetJacobian(snes, &jacobianMat, &precondMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    if (precondMat) {
+        err = PetscObjectTypeCompare((PetscObject)precondMat, MATIS, &isMatIS);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (!isMatIS) {
+        std::ostringstream msg;
+        msg << "BDDC preconditioner requires unassembled storage of the Jacobian. Set 'jacobian_storage' to 'is' in "
+            << "problem '" << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Split degrees of freedom by solution subfield, so subdomain interfaces are identified separately for each subfield.
+    PetscInt numFields = 0;
+    PetscIS* fieldIS = NULL;
+    err = DMCreateFieldIS(dmSoln, &numFields, NULL, &fieldIS);PYLITH_CHECK_ERROR(err);
+    err = PCBDDCSetDofsSplitting(pc, numFields, fieldIS);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iField = 0; iField < numFields; ++iField) {
+        err = ISDestroy(&fieldIS[iField]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = PetscFree(fieldIS);PYLITH_CHECK_ERROR(err);
+
+    // Rigid body modes created with the solution field (quasistatic problems) are included in the coarse space.
+    if (solution->hasSubfield("displacement")) {
+        const pylith::topology::Field::SubfieldInfo& info = solution->getSubfieldInfo("displacement");
+        PetscObject field = NULL;
+        PetscObject nullSpace = NULL;
+        err = DMGetField(dmSoln, info.index, NULL, &field);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectQuery(field, "nearnullspace", &nullSpace);PYLITH_CHECK_ERROR(err);
+        if (nullSpace) {
+            err = MatSetNearNullSpace(precondMat, (MatNullSpace) nullSpace);PYLITH_CHECK_ERROR(err);
+            if (jacobianMat != precondMat) {
+                err = MatSetNearNullSpace(jacobianMat, (MatNullSpace) nullSpace);PYLITH_CHECK_ERROR(err);
+            } // if
+        } // if
+    } // if
+
+    // Fault Lagrange multipliers at points shared among processes are primal vertices. Each process lists the
+    // degrees of freedom it owns.
+    if (solution->hasSubfield("lagrange_multiplier_fault")) {
+        const PetscInt lagrangeIndex = solution->getSubfieldInfo("lagrange_multiplier_fault").index;
+        PetscSF pointSF = NULL;
+        PetscInt numRoots = 0;
+        const PetscInt* degree = NULL;
+        err = DMGetPointSF(dmSoln, &pointSF);PYLITH_CHECK_ERROR(err);
+        err = PetscSFGetGraph(pointSF, &numRoots, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+        if (numRoots >= 0) {
+            err = PetscSFComputeDegreeBegin(pointSF, &degree);PYLITH_CHECK_ERROR(err);
+            err = PetscSFComputeDegreeEnd(pointSF, &degree);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        PetscSection globalSection = solution->getGlobalSection();
+        PetscInt pStart = 0, pEnd = 0;
+        err = PetscSectionGetChart(globalSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        std::vector<PetscInt> indices;
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            if (!degree || (degree[point-pStart] <= 0)) { continue; } // not shared or not owned
+            PetscInt numDof = 0, numConstrained = 0, offset = 0;
+            err = PetscSectionGetFieldDof(globalSection, point, lagrangeIndex, &numDof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldConstraintDof(globalSection, point, lagrangeIndex, &numConstrained);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(globalSection, point, lagrangeIndex, &offset);PYLITH_CHECK_ERROR(err);
+            if ((numDof - numConstrained <= 0) || (offset < 0)) { continue; }
+            for (PetscInt iDof = 0; iDof < numDof - numConstrained; ++iDof) {
+                indices.push_back(offset + iDof);
+            } // for
+        } // for
+
+        PetscIS primalIS = NULL;
+        err = ISCreateGeneral(solution->getMesh().getComm(), indices.size(), indices.size() ? &indices[0] : NULL,
+                              PETSC_COPY_VALUES, &primalIS);PYLITH_CHECK_ERROR(err);
+        err = PCBDDCSetPrimalVerticesIS(pc, primalIS);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&primalIS);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setPreconditionerHints
+
+
+// ------------------------------------------------------------------------------------------------
+// Set default PETSc options for the split node preconditioner.
+void
+pylith::problems::Problem::_setSplitNodeSolverDefaults(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::_setSplitNodeSolverDefaults()");
+
+    if (!_useSplitNodeSolver) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // The inner solves are iterative, so the preconditioner changes slightly between iterations.
+    pylith::utils::PetscOptions options;
+    options.add("-ksp_type", "fgmres");
+    options.add("-pc_type", "shell");
+    options.set();
+
+    PYLITH_METHOD_END;
+} // _setSplitNodeSolverDefaults
+
+
 // ------------------------------------------------------------------------------------------------
 // Check material and interface ids.
 void
@@ -481,7 +1305,7 @@ pylith::problems::Problem::_checkMaterialLabels(void) const {
     } // for
 
     assert(_integrationData);
-    const pylith::topology::Field* solution = _integrationData->getField("solution");
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
     pylith::topology::MeshOps::checkMaterialLabels(solution->getMesh(), labelValues);
 
@@ -505,19 +1329,25 @@ pylith::problems::Problem::_createIntegrators(void) {
     size_t count = 0;
 
     assert(_integrationData);
-    const pylith::topology::Field* solution = _integrationData->getField("solution");
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
 
     for (size_t i = 0; i < numMaterials; ++i) {
         assert(_materials[i]);
+        const std::string& phase = _Problem::getPhaseName("Create integrator", _materials[i]);
+        pylith::utils::SetupProfiler::begin(phase.c_str());
         pylith::feassemble::Integrator* integrator = _materials[i]->createIntegrator(*solution);
+        pylith::utils::SetupProfiler::end(phase.c_str());
         assert(count < maxSize);
         if (integrator) { _integrators[count++] = integrator;}
     } // for
 
     for (size_t i = 0; i < numInterfaces; ++i) {
         assert(_interfaces[i]);
+        const std::string& phase = _Problem::getPhaseName("Create integrator", _interfaces[i]);
+        pylith::utils::SetupProfiler::begin(phase.c_str());
         pylith::feassemble::Integrator* integrator = _interfaces[i]->createIntegrator(*solution, _materials);
+        pylith::utils::SetupProfiler::end(phase.c_str());
         assert(count < maxSize);
         if (integrator) { _integrators[count++] = integrator;}
     } // for
@@ -525,12 +1355,19 @@ pylith::problems::Problem::_createIntegrators(void) {
     // Check to make sure boundary conditions are compatible with the solution.
     for (size_t i = 0; i < numBC; ++i) {
         assert(_bc[i]);
+        const std::string& phase = _Problem::getPhaseName("Create integrator", _bc[i]);
+        pylith::utils::SetupProfiler::begin(phase.c_str());
         pylith::feassemble::Integrator* integrator = _bc[i]->createIntegrator(*solution);
+        pylith::utils::SetupProfiler::end(phase.c_str());
         assert(count < maxSize);
         if (integrator) { _integrators[count++] = integrator;}
     } // for
 
     _integrators.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        _integrators[i]->setAssemblyChunkSize(_assemblyChunkSize);
+        _integrators[i]->setCacheGeometry(_cacheGeometry);
+    } // for
 
     PYLITH_METHOD_END;
 } // _createIntegrators
@@ -548,7 +1385,7 @@ pylith::problems::Problem::_createConstraints(void) {
     const size_t numBC = _bc.size();
 
     assert(_integrationData);
-    const pylith::topology::Field* solution = _integrationData->getField("solution");
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
 
     _constraints.resize(0); // insure we start with an empty array.
@@ -586,7 +1423,7 @@ pylith::problems::Problem::_setupSolution(void) {
     PYLITH_COMPONENT_DEBUG("Problem::_setupSolution()");
 
     assert(_integrationData);
-    pylith::topology::Field* solution = _integrationData->getField("solution");
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
     solution->subfieldsSetup();
     solution->createDiscretization();
@@ -650,10 +1487,64 @@ pylith::problems::_Problem::createNullSpace(const pylith::topology::Field* solut
     err = PetscObjectCompose(field, "nearnullspace", (PetscObject) nullSpace);PYLITH_CHECK_ERROR(err);
     err = MatNullSpaceDestroy(&nullSpace);PYLITH_CHECK_ERROR(err);
 
+    // Also register a constructor, so the rigid body modes are attached to the matrix of the subfield block
+    // (whose block size matches the number of components of the subfield) when the subfield is split from
+    // other subfields, such as the fault Lagrange multiplier, pressure, or trace strain.
+    err = DMSetNearNullSpaceConstructor(dmSoln, info.index, createRigidBodyModes);PYLITH_CHECK_ERROR(err);
+
     PYLITH_METHOD_END;
 } // createNullSpace
 
 
+// ------------------------------------------------------------------------------------------------
+// Create rigid body modes as near null space for a field of a DM.
+PetscErrorCode
+pylith::problems::_Problem::createRigidBodyModes(PetscDM dm,
+                                                 PetscInt origField,
+                                                 PetscInt field,
+                                                 MatNullSpace* nullSpace) {
+    PetscFunctionBeginUser;
+    PetscCall(DMPlexCreateRigidBody(dm, field, nullSpace));
+    PetscFunctionReturn(PETSC_SUCCESS);
+} // createRigidBodyModes
+
+
+// ------------------------------------------------------------------------------------------------
+// Create coarse DMs for the solution field from the coarse meshes kept by uniform refinement.
+void
+pylith::problems::_Problem::createCoarseSolutionDMs(const pylith::topology::Field* solution) {
+    PYLITH_METHOD_BEGIN;
+    assert(solution);
+
+    PetscErrorCode err = 0;
+    PetscDM dmMeshCoarse = NULL;
+    err = DMGetCoarseDM(solution->getMesh().getDM(), &dmMeshCoarse);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmFine = solution->getDM();
+    while (dmMeshCoarse) {
+        PetscDM dmCoarse = NULL;
+        err = DMClone(dmMeshCoarse, &dmCoarse);PYLITH_CHECK_ERROR(err);
+        err = DMCopyDisc(dmFine, dmCoarse);PYLITH_CHECK_ERROR(err);
+
+        // Constraints must use the labels of the coarse mesh.
+        PetscInt numDS = 0;
+        err = DMGetNumDS(dmCoarse, &numDS);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numDS; ++i) {
+            PetscDS ds = NULL;
+            err = DMGetRegionNumDS(dmCoarse, i, NULL, NULL, &ds, NULL);PYLITH_CHECK_ERROR(err);
+            err = PetscDSUpdateBoundaryLabels(ds, dmCoarse);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        err = DMSetCoarseDM(dmFine, dmCoarse);PYLITH_CHECK_ERROR(err);
+        dmFine = dmCoarse; // Reference held by the finer DM.
+        err = DMDestroy(&dmCoarse);PYLITH_CHECK_ERROR(err);
+        err = DMGetCoarseDM(dmMeshCoarse, &dmMeshCoarse);PYLITH_CHECK_ERROR(err);
+    } // while
+
+    PYLITH_METHOD_END;
+} // createCoarseSolutionDMs
+
+
 // ------------------------------------------------------------------------------------------------
 // Set data needed to integrate domain faces on interior interface.
 void
@@ -701,4 +1592,20 @@ pylith::problems::_Problem::subset(const std::vector<pylith::feassemble::Integra
 } // subset
 
 
+// ------------------------------------------------------------------------------------------------
+// Get name of setup phase for a physics object.
+std::string
+pylith::problems::_Problem::getPhaseName(const char* action,
+                                         const pylith::problems::Physics* physics) {
+    assert(action);
+
+    std::ostringstream phase;
+    phase << action;
+    if (physics) {
+        phase << " '" << physics->getIdentifier() << "'";
+    } // if
+    return phase.str();
+} // getPhaseName
+
+
 // End of file
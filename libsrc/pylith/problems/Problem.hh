@@ -49,6 +49,8 @@
 
 #include "pylith/utils/array.hh" // HASA std::vector
 
+#include <string> // USES std::string
+
 class pylith::problems::Problem : public pylith::utils::PyreComponent {
     friend class TestProblem; // unit testing
     friend class pylith::testing::MMSTest; // MMS testing
@@ -59,8 +61,24 @@ public:
     enum SolverTypeEnum {
         LINEAR, // Linear solver.
         NONLINEAR, // Nonlinear solver.
+        NONLINEAR_ANDERSON, // Nonlinear solver with Anderson acceleration of Newton iterations with lagged Jacobian.
+        NONLINEAR_QUASI_NEWTON, // Nonlinear solver with L-BFGS quasi-Newton method using lagged Jacobian.
     }; // SolverType
 
+    enum DeviceEnum {
+        DEVICE_NONE, // Vectors and matrices on host.
+        DEVICE_CUDA, // Vectors and matrices on CUDA device.
+        DEVICE_HIP, // Vectors and matrices on HIP device.
+        DEVICE_KOKKOS, // Vectors and matrices using Kokkos.
+    }; // DeviceEnum
+
+    enum JacobianStorageEnum {
+        JACOBIAN_AIJ, // Compressed sparse row storage of scalar entries.
+        JACOBIAN_BAIJ, // Compressed sparse row storage of dense blocks.
+        JACOBIAN_SBAIJ, // Compressed sparse row storage of dense blocks in upper triangle of symmetric matrix.
+        JACOBIAN_IS, // Unassembled storage of subdomain matrices for domain decomposition preconditioners (BDDC).
+    }; // JacobianStorageEnum
+
     // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -97,6 +115,35 @@ public:
      */
     SolverTypeEnum getSolverType(void) const;
 
+    /** Set device for solution vectors and Jacobian matrices.
+     *
+     * @param[in] value Device type.
+     */
+    void setDevice(const DeviceEnum value);
+
+    /** Get device for solution vectors and Jacobian matrices.
+     *
+     * @returns Device type.
+     */
+    DeviceEnum getDevice(void) const;
+
+    /** Set storage of assembled Jacobian matrices.
+     *
+     * Blocked storage uses blocks with the degrees of freedom at each point, such as the components of the
+     * displacement. It requires the same number of unconstrained degrees of freedom at every point, so it is ignored
+     * for problems with faults or Dirichlet boundary conditions that constrain only some components. Symmetric blocked
+     * storage also requires the quasistatic formulation with only the displacement solution subfield.
+     *
+     * @param[in] value Storage of Jacobian matrices.
+     */
+    void setJacobianStorage(const JacobianStorageEnum value);
+
+    /** Get storage of assembled Jacobian matrices.
+     *
+     * @returns Storage of Jacobian matrices.
+     */
+    JacobianStorageEnum getJacobianStorage(void) const;
+
     /** Specify which default PETSc options to use.
      *
      * @param[in] flags Flags indicating which default PETSc options to set.
@@ -115,6 +162,35 @@ public:
      */
     void setGravityField(spatialdata::spatialdb::GravityField* const g);
 
+    /** Set maximum number of cells assembled in each call to the PETSc assembly routines.
+     *
+     * @param[in] value Maximum number of cells in chunk (0 for all cells).
+     */
+    void setAssemblyChunkSize(const size_t value);
+
+    /** Set flag for caching cell geometry between assembly calls.
+     *
+     * @param[in] value True to cache cell geometry, false to recompute it in every assembly call.
+     */
+    void setCacheGeometry(const bool value);
+
+    /** Set flag for eliminating the fault Lagrange multipliers in the preconditioner.
+     *
+     * Requires the quasistatic formulation with only the displacement and fault Lagrange multiplier solution
+     * subfields, prescribed slip (or impulses), and assembled AIJ storage of the Jacobian. The displacement on the
+     * positive side of the faults is eliminated, so the inner solver iterates on a symmetric positive definite
+     * displacement system.
+     *
+     * @param[in] value True to use split node preconditioner, false otherwise.
+     */
+    void setUseSplitNodeSolver(const bool value);
+
+    /** Get flag for eliminating the fault Lagrange multipliers in the preconditioner.
+     *
+     * @returns True if using split node preconditioner, false otherwise.
+     */
+    bool getUseSplitNodeSolver(void) const;
+
     /** Register observer to receive notifications.
      *
      * Observers are used for output.
@@ -147,6 +223,13 @@ public:
      */
     const pylith::topology::Field* getSolutionDot(void) const;
 
+    /** Get auxiliary field of physics (material, boundary condition, or fault).
+     *
+     * @param[in] identifier Identifier of physics component.
+     * @returns Auxiliary field of physics.
+     */
+    const pylith::topology::Field* getAuxiliaryField(const char* identifier) const;
+
     /** Set materials.
      *
      * @param[in] materials Array of materials.
@@ -186,6 +269,89 @@ public:
     virtual
     void initialize(void);
 
+    /** Reset problem for another run, reusing the mesh, integrators, constraints, and solution layout.
+     *
+     * Values of the auxiliary fields are recomputed from the spatial databases, so changes to the spatial databases
+     * since initialize() are used in the next run.
+     */
+    virtual
+    void reinitialize(void);
+
+    /** Write performance of integrators to JSON file.
+     *
+     * For each integrator and instrumented operation, the report contains the number of calls, the maximum and
+     * mean elapsed time over the processes, and the throughput (cells and solution degrees of freedom integrated per
+     * second) computed from the global number of cells and degrees of freedom and the maximum elapsed time.
+     *
+     * @param[in] filename Name of JSON file (written by rank 0).
+     */
+    void writePerformanceReport(const char* filename) const;
+
+    /** Estimate computational resources for running problem.
+     *
+     * Initializes the solution, integrators, and constraints (including the auxiliary fields) but does not create
+     * the time stepping, solver, or Jacobian matrices. The report contains the number of degrees of freedom, the
+     * number of nonzeros in each block of the Jacobian from the adjacency of the solution degrees of freedom, the
+     * memory for the auxiliary fields and an assembled Jacobian (AIJ storage), the output volume per time step from
+     * the solution observers and their triggers, and the memory per process (current memory plus the Jacobian).
+     * Memory for the preconditioner (for example, multigrid hierarchies or factorizations) is not included.
+     *
+     * Collective over the processes of the solution.
+     *
+     * @returns Report on rank 0, empty string on other ranks.
+     */
+    std::string estimateResources(void);
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Reuse sparsity pattern and communication pattern of assembled Jacobian in subsequent assemblies.
+     *
+     * Must be called after the first assembly of the matrix. Inserting values outside the preallocated nonzero
+     * pattern is an error, so values are inserted directly without allocations, and the off-process entries are
+     * assumed to be a subset of those in the first assembly, so the communication pattern is reused.
+     *
+     * @param[in] mat PETSc Mat with assembled Jacobian.
+     */
+    static
+    void _reuseJacobianPattern(PetscMat mat);
+
+    /** Ignore entries in lower triangle when inserting values into matrix with symmetric storage.
+     *
+     * Must be called before the first assembly of the matrix. Matrices without symmetric storage are not changed.
+     *
+     * @param[in] mat PETSc Mat for Jacobian.
+     */
+    static
+    void _ignoreLowerTriangular(PetscMat mat);
+
+    /** Record memory used by assembled Jacobian and preconditioner matrices.
+     *
+     * @param[in] jacobianMat PETSc Mat with assembled Jacobian.
+     * @param[in] precondMat PETSc Mat with assembled preconditioner.
+     */
+    void _recordJacobianMemory(PetscMat jacobianMat,
+                               PetscMat precondMat);
+
+    /** Supply information about the solution field to a BDDC preconditioner or attach the split node preconditioner.
+     *
+     * Must be called after setting options of the nonlinear solver. Does nothing unless the preconditioner is BDDC
+     * or the split node preconditioner is used with a shell preconditioner.
+     * The degrees of freedom are split by solution subfield, the rigid body modes (if any) are attached to the
+     * Jacobian as the near null space, and the fault Lagrange multipliers on subdomain interfaces are primal
+     * vertices of the coarse space.
+     *
+     * @param[in] snes PETSc SNES for nonlinear solver.
+     */
+    void _setPreconditionerHints(PetscSNES snes);
+
+    /** Set default PETSc options for the split node preconditioner.
+     *
+     * Must be called before setting the default options of the materials, so these take precedence over them but not
+     * over user options. Does nothing unless the split node preconditioner is used.
+     */
+    void _setSplitNodeSolverDefaults(void);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -204,7 +370,13 @@ protected:
 
     pylith::problems::Physics::FormulationEnum _formulation; ///< Formulation for equations.
     SolverTypeEnum _solverType; ///< Problem (solver) type.
+    DeviceEnum _device; ///< Device for solution vectors and Jacobian matrices.
+    JacobianStorageEnum _jacobianStorage; ///< Storage of assembled Jacobian matrices.
     int _petscDefaults; ///< Flags for PETSc default options for problem.
+    size_t _assemblyChunkSize; ///< Maximum number of cells in each chunk for assembly.
+    bool _cacheGeometry; ///< True if cell geometry is cached between assembly calls.
+    bool _useSplitNodeSolver; ///< True if fault Lagrange multipliers are eliminated in the preconditioner.
+    pylith::problems::PreconditionerSplitNode* _preconditionerSplitNode; ///< Split node preconditioner.
 
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -221,6 +393,12 @@ private:
     /// Setup solution subfields and discretization.
     void _setupSolution(void);
 
+    /** Set matrix type of solution DM for storage of Jacobian matrices.
+     *
+     * Must be called after the global section of the solution is created. PETSc option -dm_mat_type takes precedence.
+     */
+    void _setJacobianStorage(void);
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
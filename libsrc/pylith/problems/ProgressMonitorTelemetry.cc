@@ -0,0 +1,371 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "ProgressMonitorTelemetry.hh" // implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include "petscts.h" // USES PetscTS
+#include "petsclog.h" // USES PetscLogEventGetPerfInfo()
+
+#include <mpi.h> // USES MPI_Reduce()
+
+#include <sys/resource.h> // USES getrusage()
+#include <cassert> // USES assert()
+#include <cstdio> // USES std::rename()
+#include <ctime> // USES time(), gmtime(), strftime()
+#include <iomanip> // USES std::setprecision()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class _ProgressMonitorTelemetry {
+public:
+
+            /// Values describing time step and solver.
+            enum HeaderEnum {
+                TIME=0,
+                TIME_STEP=1,
+                DT=2,
+                PERCENT_COMPLETE=3,
+                SNES_ITERATIONS=4,
+                KSP_ITERATIONS=5,
+                RESIDUAL_NORM=6,
+                KSP_RESIDUAL_NORM=7,
+                CONVERGED_REASON=8,
+                NUM_JACOBIANS=9,
+                NUM_SOLVER_ITERATIONS=10,
+                NUM_HEADER=11,
+            };
+
+            /// PETSc events for operations (output is timed by the problem).
+            static const char* eventNames[4];
+        }; // _ProgressMonitorTelemetry
+        const char* _ProgressMonitorTelemetry::eventNames[4] = {
+            "SNESFunctionEval",
+            "SNESJacobianEval",
+            "PCSetUp",
+            "KSPSolve",
+        };
+
+    } // problems
+} // pylith
+
+const char* pylith::problems::ProgressMonitorTelemetry::_operationNames[NUM_OPERATIONS] = {
+    "residual",
+    "jacobian",
+    "pcsetup",
+    "solve",
+    "output",
+};
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::ProgressMonitorTelemetry::ProgressMonitorTelemetry(void) :
+    _format(JSON_LINES),
+    _percentComplete(0.0),
+    _eventsSetup(false) {
+    _filename = "progress.jsonl";
+    for (int i = 0; i < NUM_OPERATIONS; ++i) {
+        _eventIds[i] = -1;
+        _eventTimes[i] = 0.0;
+    } // for
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::ProgressMonitorTelemetry::~ProgressMonitorTelemetry(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::ProgressMonitorTelemetry::deallocate(void) {
+    ProgressMonitorTime::deallocate();
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set format of telemetry.
+void
+pylith::problems::ProgressMonitorTelemetry::setFormat(const FormatEnum value) {
+    _format = value;
+} // setFormat
+
+
+// ------------------------------------------------------------------------------------------------
+// Get format of telemetry.
+pylith::problems::ProgressMonitorTelemetry::FormatEnum
+pylith::problems::ProgressMonitorTelemetry::getFormat(void) const {
+    return _format;
+} // getFormat
+
+
+// ------------------------------------------------------------------------------------------------
+// Update progress.
+void
+pylith::problems::ProgressMonitorTelemetry::update(const double current,
+                                                   const double start,
+                                                   const double stop) {
+    _percentComplete = (stop > start) ? (100*(current-start)) / (stop-start) : 0.0;
+} // update
+
+
+// ------------------------------------------------------------------------------------------------
+// Update statistics of time step.
+void
+pylith::problems::ProgressMonitorTelemetry::updateStep(const double t,
+                                                       const double dt,
+                                                       const PylithInt tindex,
+                                                       PetscTS ts,
+                                                       const double outputTime) {
+    PYLITH_METHOD_BEGIN;
+    assert(ts);
+
+    if (!_eventsSetup) {
+        _setupEvents();
+    } // if
+
+    double header[_ProgressMonitorTelemetry::NUM_HEADER];
+    PetscSNES snes = NULL;
+    PetscKSP ksp = NULL;
+    PetscInt snesIts = 0, kspIts = 0;
+    PetscReal residualNorm = 0.0, kspResidualNorm = 0.0;
+    SNESConvergedReason reason = SNES_CONVERGED_ITERATING;
+    PetscErrorCode err;
+    err = TSGetSNES(ts, &snes);PYLITH_CHECK_ERROR(err);
+    err = SNESGetIterationNumber(snes, &snesIts);PYLITH_CHECK_ERROR(err);
+    err = SNESGetLinearSolveIterations(snes, &kspIts);PYLITH_CHECK_ERROR(err);
+    err = SNESGetFunctionNorm(snes, &residualNorm);PYLITH_CHECK_ERROR(err);
+    err = SNESGetConvergedReason(snes, &reason);PYLITH_CHECK_ERROR(err);
+    err = SNESGetKSP(snes, &ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPGetResidualNorm(ksp, &kspResidualNorm);PYLITH_CHECK_ERROR(err);
+    header[_ProgressMonitorTelemetry::TIME] = t / _baseTime;
+    header[_ProgressMonitorTelemetry::TIME_STEP] = tindex;
+    header[_ProgressMonitorTelemetry::DT] = dt / _baseTime;
+    header[_ProgressMonitorTelemetry::PERCENT_COMPLETE] = _percentComplete;
+    header[_ProgressMonitorTelemetry::SNES_ITERATIONS] = snesIts;
+    header[_ProgressMonitorTelemetry::KSP_ITERATIONS] = kspIts;
+    header[_ProgressMonitorTelemetry::RESIDUAL_NORM] = residualNorm;
+    header[_ProgressMonitorTelemetry::KSP_RESIDUAL_NORM] = kspResidualNorm;
+    header[_ProgressMonitorTelemetry::CONVERGED_REASON] = reason;
+    header[_ProgressMonitorTelemetry::NUM_JACOBIANS] = getNumJacobians();
+    header[_ProgressMonitorTelemetry::NUM_SOLVER_ITERATIONS] = getNumSolverIterations();
+
+    // Elapsed time of operations since previous time step and memory high-water mark on this process.
+    double local[NUM_OPERATIONS+1];
+    for (int i = 0; i < OUTPUT; ++i) {
+        local[i] = 0.0;
+        if (_eventIds[i] >= 0) {
+            PetscEventPerfInfo info;
+            err = PetscLogEventGetPerfInfo(PETSC_DETERMINE, _eventIds[i], &info);PYLITH_CHECK_ERROR(err);
+            local[i] = info.time - _eventTimes[i];
+            _eventTimes[i] = info.time;
+        } // if
+    } // for
+    local[OUTPUT] = outputTime;
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    local[NUM_OPERATIONS] = 1024.0 * usage.ru_maxrss; // Linux reports kilobytes.
+
+    double global[NUM_OPERATIONS+1];
+    err = MPI_Reduce(local, global, NUM_OPERATIONS+1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);PYLITH_CHECK_ERROR(err);
+
+    if (_isMaster) {
+        switch (_format) {
+        case JSON_LINES:
+            _writeJSONLine(header, global, global[NUM_OPERATIONS]);
+            break;
+        case PROMETHEUS:
+            _writePrometheus(header, global, global[NUM_OPERATIONS]);
+            break;
+        default:
+            PYLITH_JOURNAL_LOGICERROR("Unknown telemetry format ("<<_format<<").");
+        } // switch
+    } // if
+
+    PYLITH_METHOD_END;
+} // updateStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Open progress monitor.
+void
+pylith::problems::ProgressMonitorTelemetry::_open(void) {
+    if (JSON_LINES == _format) {
+        _sout.open(getFilename());
+        if (!_sout.is_open() || !_sout.good()) {
+            std::ostringstream msg;
+            msg << "Could not open telemetry file '" << getFilename() << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+} // _open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close progress monitor.
+void
+pylith::problems::ProgressMonitorTelemetry::_close(void) {
+    if (_sout.is_open()) {
+        _sout.close();
+    } // if
+} // _close
+
+
+// ------------------------------------------------------------------------------------------------
+// Register PETSc events for operations and turn on PETSc logging if necessary.
+void
+pylith::problems::ProgressMonitorTelemetry::_setupEvents(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err;
+    PetscBool isActive = PETSC_FALSE;
+    err = PetscLogIsActive(&isActive);PYLITH_CHECK_ERROR(err);
+    if (!isActive) {
+        err = PetscLogDefaultBegin();PYLITH_CHECK_ERROR(err);
+    } // if
+
+    for (int i = 0; i < OUTPUT; ++i) {
+        PetscLogEvent id = -1;
+        err = PetscLogEventGetId(_ProgressMonitorTelemetry::eventNames[i], &id);PYLITH_CHECK_ERROR(err);
+        _eventIds[i] = id;
+        _eventTimes[i] = 0.0;
+        if (id >= 0) {
+            PetscEventPerfInfo info;
+            err = PetscLogEventGetPerfInfo(PETSC_DETERMINE, id, &info);PYLITH_CHECK_ERROR(err);
+            _eventTimes[i] = info.time;
+        } // if
+    } // for
+    _eventsSetup = true;
+
+    PYLITH_METHOD_END;
+} // _setupEvents
+
+
+// ------------------------------------------------------------------------------------------------
+// Write statistics as JSON object on one line.
+void
+pylith::problems::ProgressMonitorTelemetry::_writeJSONLine(const double* header,
+                                                           const double* times,
+                                                           const double memoryMax) {
+    assert(_sout.is_open());
+    assert(header);
+    assert(times);
+
+    const time_t now = time(NULL);
+    char timestamp[32];
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    std::ostringstream line;
+    line << std::setprecision(8)
+         << "{\"timestamp\": \"" << timestamp << "\""
+         << ", \"t\": " << header[_ProgressMonitorTelemetry::TIME]
+         << ", \"t_units\": \"" << _baseUnit << "\""
+         << ", \"time_step\": " << int(header[_ProgressMonitorTelemetry::TIME_STEP])
+         << ", \"dt\": " << header[_ProgressMonitorTelemetry::DT]
+         << ", \"percent_complete\": " << header[_ProgressMonitorTelemetry::PERCENT_COMPLETE]
+         << ", \"snes_iterations\": " << int(header[_ProgressMonitorTelemetry::SNES_ITERATIONS])
+         << ", \"ksp_iterations\": " << int(header[_ProgressMonitorTelemetry::KSP_ITERATIONS])
+         << ", \"residual_norm\": " << header[_ProgressMonitorTelemetry::RESIDUAL_NORM]
+         << ", \"ksp_residual_norm\": " << header[_ProgressMonitorTelemetry::KSP_RESIDUAL_NORM]
+         << ", \"snes_converged_reason\": " << int(header[_ProgressMonitorTelemetry::CONVERGED_REASON])
+         << ", \"num_jacobians\": " << size_t(header[_ProgressMonitorTelemetry::NUM_JACOBIANS])
+         << ", \"num_solver_iterations\": " << size_t(header[_ProgressMonitorTelemetry::NUM_SOLVER_ITERATIONS])
+         << ", \"elapsed_time\": {";
+    for (int i = 0; i < NUM_OPERATIONS; ++i) {
+        line << (i ? ", " : "") << "\"" << _operationNames[i] << "\": " << times[i];
+    } // for
+    line << "}, \"memory_max\": " << memoryMax << "}";
+
+    _sout << line.str() << std::endl;
+} // _writeJSONLine
+
+
+// ------------------------------------------------------------------------------------------------
+// Write statistics in Prometheus text format.
+void
+pylith::problems::ProgressMonitorTelemetry::_writePrometheus(const double* header,
+                                                             const double* times,
+                                                             const double memoryMax) {
+    assert(header);
+    assert(times);
+
+    // Write to temporary file and rename, so scrapers never see a partially written file.
+    const std::string filename = getFilename();
+    const std::string filenameTmp = filename + ".tmp";
+    std::ofstream fout(filenameTmp.c_str());
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open telemetry file '" << filenameTmp << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    fout << std::setprecision(8);
+
+    struct Metric {
+        const char* name;
+        const char* type;
+        const char* help;
+        int index;
+    };
+    const Metric metrics[] = {
+        { "pylith_simulation_time", "gauge", "Current simulation time", _ProgressMonitorTelemetry::TIME },
+        { "pylith_time_step", "gauge", "Current time step", _ProgressMonitorTelemetry::TIME_STEP },
+        { "pylith_percent_complete", "gauge", "Percent of simulation completed", _ProgressMonitorTelemetry::PERCENT_COMPLETE },
+        { "pylith_snes_iterations", "gauge", "Nonlinear solver iterations in current time step", _ProgressMonitorTelemetry::SNES_ITERATIONS },
+        { "pylith_ksp_iterations", "gauge", "Linear solver iterations in current time step", _ProgressMonitorTelemetry::KSP_ITERATIONS },
+        { "pylith_residual_norm", "gauge", "Norm of nonlinear residual in current time step", _ProgressMonitorTelemetry::RESIDUAL_NORM },
+        { "pylith_ksp_residual_norm", "gauge", "Norm of linear residual in current time step", _ProgressMonitorTelemetry::KSP_RESIDUAL_NORM },
+        { "pylith_snes_converged_reason", "gauge", "Reason nonlinear solver converged or diverged", _ProgressMonitorTelemetry::CONVERGED_REASON },
+        { "pylith_jacobians_total", "counter", "Number of Jacobian reformations", _ProgressMonitorTelemetry::NUM_JACOBIANS },
+        { "pylith_solver_iterations_total", "counter", "Number of nonlinear solver iterations", _ProgressMonitorTelemetry::NUM_SOLVER_ITERATIONS },
+    };
+    const size_t numMetrics = sizeof(metrics) / sizeof(Metric);
+    for (size_t i = 0; i < numMetrics; ++i) {
+        fout << "# HELP " << metrics[i].name << " " << metrics[i].help << ".\n"
+             << "# TYPE " << metrics[i].name << " " << metrics[i].type << "\n"
+             << metrics[i].name << " " << header[metrics[i].index] << "\n";
+    } // for
+
+    fout << "# HELP pylith_step_seconds Maximum elapsed time over processes of operations in current time step.\n"
+         << "# TYPE pylith_step_seconds gauge\n";
+    for (int i = 0; i < NUM_OPERATIONS; ++i) {
+        fout << "pylith_step_seconds{operation=\"" << _operationNames[i] << "\"} " << times[i] << "\n";
+    } // for
+    fout << "# HELP pylith_memory_max_bytes Maximum memory high-water mark over processes.\n"
+         << "# TYPE pylith_memory_max_bytes gauge\n"
+         << "pylith_memory_max_bytes " << memoryMax << "\n";
+    fout.close();
+
+    if (std::rename(filenameTmp.c_str(), filename.c_str())) {
+        std::ostringstream msg;
+        msg << "Could not rename telemetry file '" << filenameTmp << "' to '" << filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+} // _writePrometheus
+
+
+// End of file
@@ -0,0 +1,161 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/*** @file libsrc/problems/ProgressMonitorTelemetry.hh
+ *
+ * @brief Progress monitor for time-dependent problem writing machine-readable solver statistics at every time step.
+ *
+ * The statistics include the nonlinear and linear solver iterations and residual norms, the time spent in the
+ * residual, Jacobian, preconditioner setup, solve, and output, and the memory high-water mark over all processes.
+ * They are written as JSON Lines (one JSON object per time step appended to the file) or in the Prometheus text
+ * format (file with the current values, replaced at every time step).
+ */
+
+#if !defined(pylith_problems_progressmonitortelemetry_hh)
+#define pylith_problems_progressmonitortelemetry_hh
+
+#include "ProgressMonitorTime.hh" // ISA ProgressMonitorTime
+
+class pylith::problems::ProgressMonitorTelemetry : public pylith::problems::ProgressMonitorTime {
+    friend class TestProgressMonitorTelemetry; // unit testing
+
+    // PUBLIC ENUMS ///////////////////////////////////////////////////////////////////////////////
+public:
+
+    enum FormatEnum {
+        JSON_LINES=0, ///< One JSON object per time step.
+        PROMETHEUS=1, ///< Prometheus text format with current values.
+    };
+
+    // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    ProgressMonitorTelemetry(void);
+
+    /// Destructor
+    virtual ~ProgressMonitorTelemetry(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set format of telemetry.
+     *
+     * @param[in] value Format of telemetry.
+     */
+    void setFormat(const FormatEnum value);
+
+    /** Get format of telemetry.
+     *
+     * @returns Format of telemetry.
+     */
+    FormatEnum getFormat(void) const;
+
+    /** Update progress.
+     *
+     * @param[in] current Current time.
+     * @param[in] start Starting time.
+     * @param[in] stop Ending time.
+     */
+    void update(const double current,
+                const double start,
+                const double stop);
+
+    /** Update statistics of time step.
+     *
+     * @param[in] t Current time (dimensional).
+     * @param[in] dt Current time step size (dimensional).
+     * @param[in] tindex Current time step.
+     * @param[in] ts PETSc time stepper.
+     * @param[in] outputTime Elapsed time (seconds) of post-step updates and output for this time step.
+     */
+    void updateStep(const double t,
+                    const double dt,
+                    const PylithInt tindex,
+                    PetscTS ts,
+                    const double outputTime);
+
+    // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
+protected:
+
+    /// Open progress monitor.
+    void _open(void);
+
+    /// Close progress monitor.
+    void _close(void);
+
+    // PRIVATE ENUMS //////////////////////////////////////////////////////////////////////////////
+private:
+
+    enum OperationEnum {
+        RESIDUAL=0,
+        JACOBIAN=1,
+        PCSETUP=2,
+        SOLVE=3,
+        OUTPUT=4,
+        NUM_OPERATIONS=5,
+    };
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Register PETSc events for operations and turn on PETSc logging if necessary.
+    void _setupEvents(void);
+
+    /** Write statistics as JSON object on one line.
+     *
+     * @param[in] header Values describing time step and solver.
+     * @param[in] times Elapsed time of operations for time step.
+     * @param[in] memoryMax Memory high-water mark (bytes).
+     */
+    void _writeJSONLine(const double* header,
+                        const double* times,
+                        const double memoryMax);
+
+    /** Write statistics in Prometheus text format.
+     *
+     * @param[in] header Values describing time step and solver.
+     * @param[in] times Elapsed time of operations for time step.
+     * @param[in] memoryMax Memory high-water mark (bytes).
+     */
+    void _writePrometheus(const double* header,
+                          const double* times,
+                          const double memoryMax);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    FormatEnum _format; ///< Format of telemetry.
+    double _percentComplete; ///< Percent of simulation completed.
+    int _eventIds[NUM_OPERATIONS]; ///< PETSc events for operations (-1 if not available).
+    double _eventTimes[NUM_OPERATIONS]; ///< Cumulative time of operations at previous time step.
+    bool _eventsSetup; ///< True if PETSc events have been setup.
+
+    static const char* _operationNames[NUM_OPERATIONS]; ///< Names of operations.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    ProgressMonitorTelemetry(const ProgressMonitorTelemetry&); ///< Not implemented.
+    const ProgressMonitorTelemetry& operator=(const ProgressMonitorTelemetry&); ///< Not implemented.
+
+}; // ProgressMonitorTelemetry
+
+#endif // pylith_problems_progressmonitortelemetry_hh
+
+// End of file
@@ -34,7 +34,10 @@
 // Constructor
 pylith::problems::ProgressMonitorTime::ProgressMonitorTime(void) :
     _baseTime(1.0),
-    _baseUnit("second") {}
+    _baseUnit("second"),
+    _numJacobians(0),
+    _numSolverIterations(0),
+    _showSolverStatistics(false) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -75,12 +78,58 @@ pylith::problems::ProgressMonitorTime::getTimeUnit(void) const {
 } // getTimeUnit
 
 
+// ------------------------------------------------------------------------------------------------
+// Set flag for reporting solver statistics with progress.
+void
+pylith::problems::ProgressMonitorTime::setShowSolverStatistics(const bool value) {
+    _showSolverStatistics = value;
+} // setShowSolverStatistics
+
+
+// ------------------------------------------------------------------------------------------------
+// Get flag for reporting solver statistics with progress.
+bool
+pylith::problems::ProgressMonitorTime::getShowSolverStatistics(void) const {
+    return _showSolverStatistics;
+} // getShowSolverStatistics
+
+
+// ------------------------------------------------------------------------------------------------
+// Set solver statistics reported with progress.
+void
+pylith::problems::ProgressMonitorTime::setSolverStatistics(const size_t numJacobians,
+                                                           const size_t numSolverIterations) {
+    _numJacobians = numJacobians;
+    _numSolverIterations = numSolverIterations;
+} // setSolverStatistics
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of times the Jacobian has been reformed.
+size_t
+pylith::problems::ProgressMonitorTime::getNumJacobians(void) const {
+    return _numJacobians;
+} // getNumJacobians
+
+
+// ------------------------------------------------------------------------------------------------
+// Get total number of nonlinear solver iterations.
+size_t
+pylith::problems::ProgressMonitorTime::getNumSolverIterations(void) const {
+    return _numSolverIterations;
+} // getNumSolverIterations
+
+
 // ------------------------------------------------------------------------------------------------
 // Open progress monitor.
 void
 pylith::problems::ProgressMonitorTime::_open(void) {
     _sout.open(getFilename());
-    _sout << "Timestamp                     Simulation t   % complete   Est. completion" << std::endl;
+    _sout << "Timestamp                     Simulation t   % complete   Est. completion";
+    if (_showSolverStatistics) {
+        _sout << "           # Jacobians  # Solver its";
+    } // if
+    _sout << std::endl;
     _sout.setf(std::ios::fixed);
 } // _open
 
@@ -120,6 +169,16 @@ pylith::problems::ProgressMonitorTime::update(const double current,
 } // update
 
 
+// ------------------------------------------------------------------------------------------------
+// Update statistics of time step.
+void
+pylith::problems::ProgressMonitorTime::updateStep(const double t,
+                                                  const double dt,
+                                                  const PylithInt tindex,
+                                                  PetscTS ts,
+                                                  const double outputTime) {}
+
+
 // ------------------------------------------------------------------------------------------------
 // Update progress.
 void
@@ -136,8 +195,15 @@ pylith::problems::ProgressMonitorTime::_update(const double t,
           << std::setprecision(2) << std::setw(8) << tSimNorm
           << "*" << std::left << std::setw(6) << _baseUnit << std::right
           << std::setprecision(0) << std::setw(13) << percentComplete
-          << "   " << finished
-          << std::endl;
+          << "   ";
+    if (_showSolverStatistics) {
+        _sout << std::left << std::setw(24) << finished << std::right
+              << std::setw(13) << _numJacobians
+              << std::setw(14) << _numSolverIterations;
+    } else {
+        _sout << finished;
+    } // if/else
+    _sout << std::endl;
 } // _update
 
 
@@ -27,6 +27,9 @@
 
 #include "ProgressMonitor.hh" // ISA ProgressMonitor
 
+#include "pylith/utils/petscfwd.h" // USES PetscTS
+#include "pylith/utils/types.hh" // USES PylithInt
+
 #include <fstream> // HASA std::ofstream
 
 class pylith::problems::ProgressMonitorTime : public pylith::problems::ProgressMonitor {
@@ -56,16 +59,66 @@ public:
      */
     const char* getTimeUnit(void) const;
 
+    /** Set flag for reporting solver statistics (number of Jacobians and solver iterations) with progress.
+     *
+     * @param[in] value True to report solver statistics, false otherwise.
+     */
+    void setShowSolverStatistics(const bool value);
+
+    /** Get flag for reporting solver statistics (number of Jacobians and solver iterations) with progress.
+     *
+     * @returns True if reporting solver statistics, false otherwise.
+     */
+    bool getShowSolverStatistics(void) const;
+
+    /** Set solver statistics reported with progress.
+     *
+     * @param[in] numJacobians Number of times the Jacobian has been reformed.
+     * @param[in] numSolverIterations Total number of nonlinear solver iterations.
+     */
+    void setSolverStatistics(const size_t numJacobians,
+                             const size_t numSolverIterations);
+
+    /** Get number of times the Jacobian has been reformed.
+     *
+     * @returns Number of Jacobian reformations.
+     */
+    size_t getNumJacobians(void) const;
+
+    /** Get total number of nonlinear solver iterations.
+     *
+     * @returns Number of nonlinear solver iterations.
+     */
+    size_t getNumSolverIterations(void) const;
+
     /** Update progress.
      *
      * @param[in] current Current time.
      * @param[in] start Starting time.
      * @param[in] stop Ending time.
      */
+    virtual
     void update(const double current,
                 const double start,
                 const double stop);
 
+    /** Update statistics of time step.
+     *
+     * Called after update() at every time step; the default implementation does nothing.
+     *
+     * @param[in] t Current time (dimensional).
+     * @param[in] dt Current time step size (dimensional).
+     * @param[in] tindex Current time step.
+     * @param[in] ts PETSc time stepper.
+     * @param[in] outputTime Elapsed time (seconds) of post-step updates and output for this time step.
+     */
+    virtual
+    void updateStep(const double t,
+                    const double dt,
+                    const PylithInt tindex,
+                    PetscTS ts,
+                    const double outputTime);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -87,12 +140,15 @@ protected:
                  const double percentComplete,
                  const char* finished);
 
-    // PRIVATE MEMBERS //////////////////////////////////////////////////////
-private:
+    // PROTECTED MEMBERS ////////////////////////////////////////////////////////////////////////
+protected:
 
     double _baseTime; ///< Units of time as seconds.
     std::string _baseUnit; ///< Unit of time.
     std::ofstream _sout; ///< Output stream.
+    size_t _numJacobians; ///< Number of Jacobian reformations.
+    size_t _numSolverIterations; ///< Number of nonlinear solver iterations.
+    bool _showSolverStatistics; ///< True if reporting solver statistics with progress.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -20,25 +20,43 @@
 
 #include "TimeDependent.hh" // implementation of class methods
 
+#include "pylith/problems/TimeDependentTimeStep.hh" // HOLDSA TimeDependentTimeStep
+#include "pylith/problems/TimeDependentCheckpoint.hh" // HOLDSA TimeDependentCheckpoint
+#include "pylith/problems/TimeDependentSteadyState.hh" // HOLDSA TimeDependentSteadyState
+#include "pylith/problems/TimeDependentLoadCases.hh" // HOLDSA TimeDependentLoadCases
+#include "pylith/problems/TimeDependentParareal.hh" // HOLDSA TimeDependentParareal
+#include "pylith/problems/TimeDependentGreensFns.hh" // HOLDSA TimeDependentGreensFns
 #include "pylith/feassemble/IntegrationData.hh" // HOLDSA IntegrationData
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/faults/FaultOps.hh" // USES FaultOps
 #include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/feassemble/IntegratorDomain.hh" // USES IntegratorDomain
 #include "pylith/feassemble/Constraint.hh" // USES Constraint
+#include "pylith/materials/Material.hh" // USES Material
+#include "pylith/materials/Poroelasticity.hh" // USES Poroelasticity
+#include "pylith/materials/IncompressibleElasticity.hh" // USES IncompressibleElasticity
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
 #include "pylith/problems/InitialCondition.hh" // USES InitialCondition
 #include "pylith/problems/ProgressMonitorTime.hh" // USES ProgressMonitorTime
 #include "pylith/utils/PetscOptions.hh" // USES SolverDefaults
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include "petscts.h" // USES PetscTS
+#include "petsctime.h" // USES PetscTime()
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/SetupProfiler.hh" // USES SetupProfiler
+#include <algorithm> // USES std::min(), std::max()
 #include <cassert> // USES assert()
+#include <cmath> // USES HUGE_VAL
+#include <cstring> // USES strlen(), strcmp()
 #include <iostream> // USES std::cout in debugging
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
 
 // ---------------------------------------------------------------------------------------------------------------------
 namespace pylith {
@@ -47,6 +65,53 @@ namespace pylith {
 public:
 
             static const char* pyreComponent;
+
+            /// Context for nonlinear solve of equilibrium used to set reference state.
+            struct EquilibriumContext {
+                TimeDependent* problem; ///< Problem.
+                PylithReal t; ///< Time of equilibrium.
+                PylithReal dt; ///< Time step.
+                PetscVec initialVec; ///< Initial solution.
+                PetscVec solutionDotVec; ///< Time derivative of solution.
+            }; // EquilibriumContext
+
+            /** Compute time derivative of solution relative to initial solution for equilibrium.
+             *
+             * @param[inout] context Context for equilibrium.
+             * @param[in] solutionVec PETSc Vec with current trial solution.
+             */
+            static
+            void computeEquilibriumSolutionDot(EquilibriumContext* context,
+                                               PetscVec solutionVec);
+
+            /** Callback for computing residual in nonlinear solve of equilibrium.
+             *
+             * @param[in] snes PETSc nonlinear solver.
+             * @param[in] solutionVec PETSc Vec with current trial solution.
+             * @param[out] residualVec PETSc Vec for residual.
+             * @param[in] context Context for equilibrium.
+             */
+            static
+            PetscErrorCode computeEquilibriumResidual(PetscSNES snes,
+                                                      PetscVec solutionVec,
+                                                      PetscVec residualVec,
+                                                      void* context);
+
+            /** Callback for computing Jacobian in nonlinear solve of equilibrium.
+             *
+             * @param[in] snes PETSc nonlinear solver.
+             * @param[in] solutionVec PETSc Vec with current trial solution.
+             * @param[out] jacobianMat PETSc Mat for Jacobian.
+             * @param[out] precondMat PETSc Mat for preconditioner.
+             * @param[in] context Context for equilibrium.
+             */
+            static
+            PetscErrorCode computeEquilibriumJacobian(PetscSNES snes,
+                                                      PetscVec solutionVec,
+                                                      PetscMat jacobianMat,
+                                                      PetscMat precondMat,
+                                                      void* context);
+
         }; // _TimeDependent
 
         const char* _TimeDependent::pyreComponent = "timedependent";
@@ -64,13 +129,54 @@ pylith::problems::TimeDependent::TimeDependent(void) :
     _monitor(NULL),
     _needNewLHSJacobian(true),
     _haveNewLHSJacobian(false),
-    _shouldNotifyIC(false) {
+    _shouldNotifyIC(false),
+    _useMatrixFreeJacobian(false),
+    _useLinearFastPath(false),
+    _useFixedStressSplit(false),
+    _usePressureMassPreconditioner(false),
+    _linearLoad(NULL),
+    _linearZero(NULL),
+    _useOverlappedAssembly(false),
+    _useLocalTimeStepping(false),
+    _rhsResidualSplit(NULL),
+    _localSolutionTime(0.0),
+    _localSolutionVecId(0),
+    _localSolutionDotVecId(0),
+    _localSolutionVecState(-1),
+    _localSolutionDotVecState(-1),
+    _localSolutionState(-1),
+    _localSolutionDotState(-1),
+    _jacobianLagSteps(0),
+    _jacobianReformIterations(0),
+    _jacobianStep(0),
+    _jacobianShift(0.0),
+    _solverIterationsPrevious(0),
+    _numJacobians(0),
+    _numSolverIterations(0),
+    _predictor(PREDICTOR_NONE),
+    _predictorUseTimeStepRatio(true),
+    _predictorNumSolutions(0),
+    _predictorStep(-1),
+    _timeStepping(TIMESTEPPING_BACKWARD_EULER),
+    _useTimeStepErrorControl(false),
+    _shouldEquilibrate(false),
+    _timeStep(new pylith::problems::TimeDependentTimeStep(*this)),
+    _checkpoint(new pylith::problems::TimeDependentCheckpoint(*this)),
+    _steadyState(new pylith::problems::TimeDependentSteadyState(*this)),
+    _loadCases(new pylith::problems::TimeDependentLoadCases(*this)),
+    _parareal(new pylith::problems::TimeDependentParareal(*this)),
+    _greensFns(new pylith::problems::TimeDependentGreensFns(*this)) {
     PyreComponent::setName(_TimeDependent::pyreComponent);
 
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, -HUGE_VAL);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_residual, -1.0);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_jacobian, -1.0);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_lumped_jacobian_inverse, -1.0);
+    for (size_t i = 0; i < 3; ++i) {
+        _predictorSolutions[i] = NULL;
+        _predictorTimes[i] = 0.0;
+    } // for
+
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_T_STATE, -HUGE_VAL);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_RESIDUAL, -1.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_JACOBIAN, -1.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_LUMPED_JACOBIAN_INVERSE, -1.0);
 } // constructor
 
 
@@ -78,6 +184,13 @@ pylith::problems::TimeDependent::TimeDependent(void) :
 // Destructor
 pylith::problems::TimeDependent::~TimeDependent(void) {
     deallocate();
+
+    delete _timeStep;_timeStep = NULL;
+    delete _checkpoint;_checkpoint = NULL;
+    delete _steadyState;_steadyState = NULL;
+    delete _loadCases;_loadCases = NULL;
+    delete _parareal;_parareal = NULL;
+    delete _greensFns;_greensFns = NULL;
 } // destructor
 
 
@@ -92,6 +205,19 @@ pylith::problems::TimeDependent::deallocate(void) {
     _monitor = NULL; // Memory handle in Python. :TODO: Use shared pointer.
 
     PetscErrorCode err = TSDestroy(&_ts);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_linearLoad);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_linearZero);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_rhsResidualSplit);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < 3; ++i) {
+        err = VecDestroy(&_predictorSolutions[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _predictorNumSolutions = 0;
+
+    if (_timeStep) { _timeStep->deallocate(); }
+    if (_steadyState) { _steadyState->deallocate(); }
+    if (_loadCases) { _loadCases->deallocate(); }
+    if (_parareal) { _parareal->deallocate(); }
+    if (_greensFns) { _greensFns->deallocate(); }
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -220,6 +346,496 @@ pylith::problems::TimeDependent::setShouldNotifyIC(const bool value) {
 } // setShouldNotifyIC
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Use matrix-free action of the LHS Jacobian with an assembled preconditioner.
+void
+pylith::problems::TimeDependent::setUseMatrixFreeJacobian(const bool value) {
+    _useMatrixFreeJacobian = value;
+} // setUseMatrixFreeJacobian
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use matrix-free action of the LHS Jacobian with an assembled preconditioner?
+bool
+pylith::problems::TimeDependent::getUseMatrixFreeJacobian(void) const {
+    return _useMatrixFreeJacobian;
+} // getUseMatrixFreeJacobian
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Form the residual of linear problems from the stored Jacobian and a cached load vector.
+void
+pylith::problems::TimeDependent::setUseLinearFastPath(const bool value) {
+    _useLinearFastPath = value;
+} // setUseLinearFastPath
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Form the residual of linear problems from the stored Jacobian and a cached load vector?
+bool
+pylith::problems::TimeDependent::getUseLinearFastPath(void) const {
+    return _useLinearFastPath;
+} // getUseLinearFastPath
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use fixed-stress split of poroelasticity instead of monolithic coupling of flow and mechanics.
+void
+pylith::problems::TimeDependent::setUseFixedStressSplit(const bool value) {
+    _useFixedStressSplit = value;
+} // setUseFixedStressSplit
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use fixed-stress split of poroelasticity instead of monolithic coupling of flow and mechanics?
+bool
+pylith::problems::TimeDependent::getUseFixedStressSplit(void) const {
+    return _useFixedStressSplit;
+} // getUseFixedStressSplit
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use pressure mass matrix as the preconditioner for the Schur complement of incompressible elasticity.
+void
+pylith::problems::TimeDependent::setUsePressureMassPreconditioner(const bool value) {
+    _usePressureMassPreconditioner = value;
+} // setUsePressureMassPreconditioner
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use pressure mass matrix as the preconditioner for the Schur complement of incompressible elasticity?
+bool
+pylith::problems::TimeDependent::getUsePressureMassPreconditioner(void) const {
+    return _usePressureMassPreconditioner;
+} // getUsePressureMassPreconditioner
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Overlap exchange of ghost values of the solution with assembly of the residual over interior cells.
+void
+pylith::problems::TimeDependent::setUseOverlappedAssembly(const bool value) {
+    _useOverlappedAssembly = value;
+} // setUseOverlappedAssembly
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Overlap exchange of ghost values of the solution with assembly of the residual over interior cells?
+bool
+pylith::problems::TimeDependent::getUseOverlappedAssembly(void) const {
+    return _useOverlappedAssembly;
+} // getUseOverlappedAssembly
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use local time stepping with explicit time stepping.
+void
+pylith::problems::TimeDependent::setUseLocalTimeStepping(const bool value) {
+    _useLocalTimeStepping = value;
+} // setUseLocalTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use local time stepping with explicit time stepping?
+bool
+pylith::problems::TimeDependent::getUseLocalTimeStepping(void) const {
+    return _useLocalTimeStepping;
+} // getUseLocalTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set minimum number of time steps between Jacobian reformations requested by integrators.
+void
+pylith::problems::TimeDependent::setJacobianLagSteps(const size_t value) {
+    _jacobianLagSteps = value;
+} // setJacobianLagSteps
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get minimum number of time steps between Jacobian reformations requested by integrators.
+size_t
+pylith::problems::TimeDependent::getJacobianLagSteps(void) const {
+    return _jacobianLagSteps;
+} // getJacobianLagSteps
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of nonlinear solver iterations in previous time step that triggers reforming a lagged Jacobian.
+void
+pylith::problems::TimeDependent::setJacobianReformIterations(const size_t value) {
+    _jacobianReformIterations = value;
+} // setJacobianReformIterations
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of nonlinear solver iterations in previous time step that triggers reforming a lagged Jacobian.
+size_t
+pylith::problems::TimeDependent::getJacobianReformIterations(void) const {
+    return _jacobianReformIterations;
+} // getJacobianReformIterations
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set predictor for initial guess of nonlinear solver in each time step.
+void
+pylith::problems::TimeDependent::setPredictor(const PredictorEnum value) {
+    PYLITH_COMPONENT_DEBUG("setPredictor(value="<<value<<")");
+
+    _predictor = value;
+} // setPredictor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get predictor for initial guess of nonlinear solver in each time step.
+pylith::problems::TimeDependent::PredictorEnum
+pylith::problems::TimeDependent::getPredictor(void) const {
+    return _predictor;
+} // getPredictor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use ratios of time steps in extrapolation of initial guess.
+void
+pylith::problems::TimeDependent::setPredictorUseTimeStepRatio(const bool value) {
+    _predictorUseTimeStepRatio = value;
+} // setPredictorUseTimeStepRatio
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use ratios of time steps in extrapolation of initial guess?
+bool
+pylith::problems::TimeDependent::getPredictorUseTimeStepRatio(void) const {
+    return _predictorUseTimeStepRatio;
+} // getPredictorUseTimeStepRatio
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set implicit time stepping method for the quasistatic formulation.
+void
+pylith::problems::TimeDependent::setTimeStepping(const TimeSteppingEnum value) {
+    PYLITH_COMPONENT_DEBUG("setTimeStepping(value="<<value<<")");
+
+    _timeStepping = value;
+} // setTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get implicit time stepping method for the quasistatic formulation.
+pylith::problems::TimeDependent::TimeSteppingEnum
+pylith::problems::TimeDependent::getTimeStepping(void) const {
+    return _timeStepping;
+} // getTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use local truncation error estimate of the time stepping method to control the time step.
+void
+pylith::problems::TimeDependent::setUseTimeStepErrorControl(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setUseTimeStepErrorControl(value="<<value<<")");
+
+    _useTimeStepErrorControl = value;
+} // setUseTimeStepErrorControl
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use local truncation error estimate of the time stepping method to control the time step?
+bool
+pylith::problems::TimeDependent::getUseTimeStepErrorControl(void) const {
+    return _useTimeStepErrorControl;
+} // getUseTimeStepErrorControl
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set reference state of materials from equilibrium at the start time before time stepping.
+void
+pylith::problems::TimeDependent::setEquilibrateReferenceState(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setEquilibrateReferenceState(value="<<value<<")");
+
+    _shouldEquilibrate = value;
+} // setEquilibrateReferenceState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set reference state of materials from equilibrium at the start time before time stepping?
+bool
+pylith::problems::TimeDependent::getEquilibrateReferenceState(void) const {
+    return _shouldEquilibrate;
+} // getEquilibrateReferenceState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution.
+void
+pylith::problems::TimeDependent::setAdaptTimeStep(const bool value) {
+    assert(_timeStep);
+    _timeStep->setAdaptTimeStep(value);
+} // setAdaptTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution?
+bool
+pylith::problems::TimeDependent::getAdaptTimeStep(void) const {
+    assert(_timeStep);
+    return _timeStep->getAdaptTimeStep();
+} // getAdaptTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set maximum time step for adaptive time stepping.
+void
+pylith::problems::TimeDependent::setMaxTimeStep(const double value) {
+    assert(_timeStep);
+    _timeStep->setMaxTimeStep(value);
+} // setMaxTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get maximum time step for adaptive time stepping.
+double
+pylith::problems::TimeDependent::getMaxTimeStep(void) const {
+    assert(_timeStep);
+    return _timeStep->getMaxTimeStep();
+} // getMaxTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set factor for geometric growth of time step.
+void
+pylith::problems::TimeDependent::setTimeStepGrowthFactor(const double value) {
+    assert(_timeStep);
+    _timeStep->setTimeStepGrowthFactor(value);
+} // setTimeStepGrowthFactor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get factor for geometric growth of time step.
+double
+pylith::problems::TimeDependent::getTimeStepGrowthFactor(void) const {
+    assert(_timeStep);
+    return _timeStep->getTimeStepGrowthFactor();
+} // getTimeStepGrowthFactor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set fraction of the minimum Maxwell time limiting the time step during the viscoelastic transient.
+void
+pylith::problems::TimeDependent::setMaxwellTimeFraction(const double value) {
+    assert(_timeStep);
+    _timeStep->setMaxwellTimeFraction(value);
+} // setMaxwellTimeFraction
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get fraction of the minimum Maxwell time limiting the time step during the viscoelastic transient.
+double
+pylith::problems::TimeDependent::getMaxwellTimeFraction(void) const {
+    assert(_timeStep);
+    return _timeStep->getMaxwellTimeFraction();
+} // getMaxwellTimeFraction
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set tolerance for relative change in solution over a time step.
+void
+pylith::problems::TimeDependent::setSolutionChangeTolerance(const double value) {
+    assert(_timeStep);
+    _timeStep->setSolutionChangeTolerance(value);
+} // setSolutionChangeTolerance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get tolerance for relative change in solution over a time step.
+double
+pylith::problems::TimeDependent::getSolutionChangeTolerance(void) const {
+    assert(_timeStep);
+    return _timeStep->getSolutionChangeTolerance();
+} // getSolutionChangeTolerance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use estimate of stable time step for explicit time stepping as the initial time step.
+void
+pylith::problems::TimeDependent::setUseStableTimeStep(const bool value) {
+    assert(_timeStep);
+    _timeStep->setUseStableTimeStep(value);
+} // setUseStableTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use estimate of stable time step for explicit time stepping as the initial time step?
+bool
+pylith::problems::TimeDependent::getUseStableTimeStep(void) const {
+    assert(_timeStep);
+    return _timeStep->getUseStableTimeStep();
+} // getUseStableTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set factor applied to estimate of stable time step for explicit time stepping.
+void
+pylith::problems::TimeDependent::setStableTimeStepFactor(const double value) {
+    assert(_timeStep);
+    _timeStep->setStableTimeStepFactor(value);
+} // setStableTimeStepFactor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get factor applied to estimate of stable time step for explicit time stepping.
+double
+pylith::problems::TimeDependent::getStableTimeStepFactor(void) const {
+    assert(_timeStep);
+    return _timeStep->getStableTimeStepFactor();
+} // getStableTimeStepFactor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of time steps between checkpoints.
+void
+pylith::problems::TimeDependent::setCheckpointInterval(const size_t value) {
+    assert(_checkpoint);
+    _checkpoint->setCheckpointInterval(value);
+} // setCheckpointInterval
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of time steps between checkpoints.
+size_t
+pylith::problems::TimeDependent::getCheckpointInterval(void) const {
+    assert(_checkpoint);
+    return _checkpoint->getCheckpointInterval();
+} // getCheckpointInterval
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of HDF5 file for checkpoints.
+void
+pylith::problems::TimeDependent::setCheckpointFilename(const char* value) {
+    assert(_checkpoint);
+    _checkpoint->setCheckpointFilename(value);
+} // setCheckpointFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of HDF5 file for checkpoints.
+const char*
+pylith::problems::TimeDependent::getCheckpointFilename(void) const {
+    assert(_checkpoint);
+    return _checkpoint->getCheckpointFilename();
+} // getCheckpointFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set threshold for load imbalance in assembly that triggers a checkpoint for repartitioning.
+void
+pylith::problems::TimeDependent::setLoadImbalanceThreshold(const double value) {
+    assert(_checkpoint);
+    _checkpoint->setLoadImbalanceThreshold(value);
+} // setLoadImbalanceThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get threshold for load imbalance in assembly that triggers a checkpoint for repartitioning.
+double
+pylith::problems::TimeDependent::getLoadImbalanceThreshold(void) const {
+    assert(_checkpoint);
+    return _checkpoint->getLoadImbalanceThreshold();
+} // getLoadImbalanceThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get load imbalance in assembly for most recent time step.
+double
+pylith::problems::TimeDependent::getLoadImbalance(void) const {
+    assert(_checkpoint);
+    return _checkpoint->getLoadImbalance();
+} // getLoadImbalance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set relative rate of change in solution for steady state.
+void
+pylith::problems::TimeDependent::setSteadyStateRate(const double value) {
+    assert(_steadyState);
+    _steadyState->setSteadyStateRate(value);
+} // setSteadyStateRate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get relative rate of change in solution for steady state.
+double
+pylith::problems::TimeDependent::getSteadyStateRate(void) const {
+    assert(_steadyState);
+    return _steadyState->getSteadyStateRate();
+} // getSteadyStateRate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of consecutive time steps at or below steady state rate for steady state.
+void
+pylith::problems::TimeDependent::setSteadyStateWindow(const size_t value) {
+    assert(_steadyState);
+    _steadyState->setSteadyStateWindow(value);
+} // setSteadyStateWindow
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of consecutive time steps at or below steady state rate for steady state.
+size_t
+pylith::problems::TimeDependent::getSteadyStateWindow(void) const {
+    assert(_steadyState);
+    return _steadyState->getSteadyStateWindow();
+} // getSteadyStateWindow
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set names of solution subfields checked for steady state.
+void
+pylith::problems::TimeDependent::setSteadyStateSubfields(const char* names[],
+                                                         const int numNames) {
+    assert(_steadyState);
+    _steadyState->setSteadyStateSubfields(names, numNames);
+} // setSteadyStateSubfields
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of HDF5 checkpoint file used to restart simulation.
+void
+pylith::problems::TimeDependent::setRestartFilename(const char* value) {
+    assert(_checkpoint);
+    _checkpoint->setRestartFilename(value);
+} // setRestartFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of HDF5 checkpoint file used to restart simulation.
+const char*
+pylith::problems::TimeDependent::getRestartFilename(void) const {
+    assert(_checkpoint);
+    return _checkpoint->getRestartFilename();
+} // getRestartFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use parareal iteration with time slices distributed across groups of processes.
+void
+pylith::problems::TimeDependent::setParallelInTime(const MPI_Comm& comm,
+                                                   const double coarseTimeStep,
+                                                   const size_t maxIterations,
+                                                   const double tolerance) {
+    assert(_parareal);
+    _parareal->setParallelInTime(comm, coarseTimeStep, maxIterations, tolerance);
+} // setParallelInTime
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of parareal iterations in most recent solve.
+size_t
+pylith::problems::TimeDependent::getNumPararealIterations(void) const {
+    assert(_parareal);
+    return _parareal->getNumPararealIterations();
+} // getNumPararealIterations
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set progress monitor.
 void
@@ -275,7 +891,7 @@ pylith::problems::TimeDependent::verifyConfiguration(void) const {
     Problem::verifyConfiguration();
 
     assert(_integrationData);
-    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
 
     // Check to make sure initial conditions are compatible with the solution.
@@ -285,6 +901,11 @@ pylith::problems::TimeDependent::verifyConfiguration(void) const {
         _ic[i]->verifyConfiguration(*solution);
     } // for
 
+    assert(_parareal);
+    _parareal->verifyConfiguration();
+    assert(_greensFns);
+    _greensFns->verifyConfiguration();
+
     PYLITH_METHOD_END;
 } // verifyConfiguration
 
@@ -296,10 +917,25 @@ pylith::problems::TimeDependent::initialize(void) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("initialize()");
 
+    // Helpers write journal entries under the identifier of the problem.
+    _timeStep->setIdentifier(getIdentifier());
+    _checkpoint->setIdentifier(getIdentifier());
+    _steadyState->setIdentifier(getIdentifier());
+    _loadCases->setIdentifier(getIdentifier());
+    _parareal->setIdentifier(getIdentifier());
+    _greensFns->setIdentifier(getIdentifier());
+
+    // Materials add the preconditioner kernels when the integrators are created.
+    if (_useFixedStressSplit) {
+        _setupFixedStressSplit();
+    } // if
+    if (_usePressureMassPreconditioner) {
+        _setupPressureMassPreconditioner();
+    } // if
     Problem::initialize();
 
     assert(_integrationData);
-    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
     assert(solution);
 
     PetscErrorCode err = TSDestroy(&_ts);PYLITH_CHECK_ERROR(err);assert(!_ts);
@@ -316,6 +952,8 @@ pylith::problems::TimeDependent::initialize(void) {
         err = TSSetProblemType(_ts, TS_LINEAR);PYLITH_CHECK_ERROR(err);
         break;
     case NONLINEAR:
+    case NONLINEAR_ANDERSON:
+    case NONLINEAR_QUASI_NEWTON:
         PYLITH_COMPONENT_DEBUG("Setting PetscTS problem type to 'nonlinear'.");
         err = TSSetProblemType(_ts, TS_NONLINEAR);PYLITH_CHECK_ERROR(err);
         break;
@@ -336,9 +974,14 @@ pylith::problems::TimeDependent::initialize(void) {
     err = TSSetMaxSteps(_ts, _maxTimeSteps);PYLITH_CHECK_ERROR(err);
     err = TSSetMaxTime(_ts, _endTime / timeScale);PYLITH_CHECK_ERROR(err);
     err = TSSetDM(_ts, solution->getDM());PYLITH_CHECK_ERROR(err);
+    if ((pylith::problems::Physics::DYNAMIC == _formulation) || (pylith::problems::Physics::DYNAMIC_IMEX == _formulation)) {
+        assert(_timeStep);
+        _timeStep->setStableTimeStep();
+    } // if
 
     // Set initial solution.
     PYLITH_COMPONENT_DEBUG("Setting PetscTS initial conditions using global vector for solution.");
+    pylith::utils::SetupProfiler::begin("Set initial conditions");
     solution->zeroLocal();
     const size_t numIC = _ic.size();
     for (size_t i = 0; i < numIC; ++i) {
@@ -348,20 +991,28 @@ pylith::problems::TimeDependent::initialize(void) {
     PetscVec solutionVector = solution->getGlobalVector();
     solution->scatterLocalToVector(solutionVector);
     err = TSSetSolution(_ts, solutionVector);PYLITH_CHECK_ERROR(err);
+    pylith::utils::SetupProfiler::end("Set initial conditions");
     assert(_observers);
     _observers->setTimeScale(timeScale);
 
     PYLITH_COMPONENT_DEBUG("Setting up time derivative of solution and residual fields.");
-    pylith::topology::Field* solutionDot = new pylith::topology::Field(*solution);assert(solutionDot);
-    solutionDot->setLabel("solutionDot");
+    pylith::topology::Field* solutionDot = new pylith::topology::Field(*solution, "solutionDot");assert(solutionDot);
     _integrationData->setField(pylith::feassemble::IntegrationData::solution_dot, solutionDot);
 
+    assert(_checkpoint);
+    const bool isRestart = _checkpoint->isRestart();
+    if (isRestart) {
+        _checkpoint->read(solutionVector);
+    } // if
+
     // Initialize residual.
-    pylith::topology::Field* residual = new pylith::topology::Field(*solution);assert(residual);
-    residual->setLabel("residual");
+    pylith::topology::Field* residual = new pylith::topology::Field(*solution, "residual");assert(residual);
     _integrationData->setField(pylith::feassemble::IntegrationData::residual, residual);
 
     // Set callbacks.
+    pylith::utils::SetupProfiler::begin("Setup time stepper");
+    bool hasLocalTimeStepping = false;
+    PylithReal dtStableMin = PYLITH_MAXSCALAR;
     PYLITH_COMPONENT_DEBUG("Setting PetscTS callback for poststep().");
     err = TSSetPostStep(_ts, poststep);PYLITH_CHECK_ERROR(err);
 
@@ -382,33 +1033,151 @@ pylith::problems::TimeDependent::initialize(void) {
         err = TSSetRHSFunction(_ts, NULL, computeRHSResidual, (void*)this);PYLITH_CHECK_ERROR(err);
 
         PYLITH_COMPONENT_DEBUG("Setting up field for inverse of lumped LHS Jacobian.");
-        pylith::topology::Field* jacobianLHSLumpedInv = new pylith::topology::Field(*solution);assert(jacobianLHSLumpedInv);
-        jacobianLHSLumpedInv->setLabel("JacobianLHS_lumped_inverse");
+        pylith::topology::Field* jacobianLHSLumpedInv = new pylith::topology::Field(*solution, "JacobianLHS_lumped_inverse");
+        assert(jacobianLHSLumpedInv);
         jacobianLHSLumpedInv->createGlobalVector();
         _integrationData->setField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse, jacobianLHSLumpedInv);
+
+        if (_useLocalTimeStepping && (pylith::problems::Physics::DYNAMIC == _formulation)) {
+            hasLocalTimeStepping = _setupLocalTimeStepping(&dtStableMin);
+        } // if
         break;
     }
     default: {
         PYLITH_COMPONENT_LOGICERROR("Unknown time stepping formulation '" << _formulation << "'.");
     } // default
     } // switch
+    if (_useMatrixFreeJacobian) {
+        if (pylith::problems::Physics::DYNAMIC == _formulation) {
+            PYLITH_COMPONENT_WARNING("Ignoring matrix-free Jacobian with explicit time stepping.");
+        } else {
+            _setMatrixFreeJacobian();
+        } // if/else
+    } // if
+    if ((_useFixedStressSplit || _usePressureMassPreconditioner) && !_useMatrixFreeJacobian) {
+        _setPreconditionerMatrix();
+    } // if
+    if (_useLocalTimeStepping && (pylith::problems::Physics::DYNAMIC != _formulation)) {
+        PYLITH_COMPONENT_WARNING("Ignoring local time stepping. It requires the explicit, dynamic formulation.");
+    } // if
+    if (_useLinearFastPath && !_canUseLinearFastPath()) {
+        PYLITH_COMPONENT_WARNING("Ignoring linear fast path. It requires the linear solver, quasistatic formulation, "
+                                 "materials with linear, time-independent residuals, and time-independent constraints.");
+        _useLinearFastPath = false;
+    } // if
+    if (PREDICTOR_NONE != _predictor) {
+        if (pylith::problems::Physics::QUASISTATIC == _formulation) {
+            PYLITH_COMPONENT_DEBUG("Setting PetscSNES callback for computeInitialGuess().");
+            PetscSNES snes = NULL;
+            err = TSGetSNES(_ts, &snes);PYLITH_CHECK_ERROR(err);
+            err = SNESSetComputeInitialGuess(snes, computeInitialGuess, (void*)this);PYLITH_CHECK_ERROR(err);
+        } else {
+            PYLITH_COMPONENT_WARNING("Ignoring predictor for initial guess. It requires the quasistatic formulation.");
+            _predictor = PREDICTOR_NONE;
+        } // if/else
+    } // if
 
-    pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults);
-    err = TSSetFromOptions(_ts);PYLITH_CHECK_ERROR(err);
-    err = TSSetUp(_ts);PYLITH_CHECK_ERROR(err);
-
-#if 0
-    // Set solve type for solution fields defined over the domain (not Lagrange multipliers).
-    PetscDS dsSoln = NULL;
-    err = DMGetDS(solution->getDM(), &dsSoln);PYLITH_CHECK_ERROR(err);
-    PetscInt numFields = 0;
-    err = PetscDSGetNumFields(dsSoln, &numFields);PYLITH_CHECK_ERROR(err);
-    for (PetscInt iField = 0; iField < numFields; ++iField) {
-        err = PetscDSSetImplicit(dsSoln, iField, (_formulation == pylith::problems::Physics::QUASISTATIC) ? PETSC_TRUE : PETSC_FALSE);
-    } // for
+    if (_shouldEquilibrate && (pylith::problems::Physics::QUASISTATIC != _formulation)) {
+        PYLITH_COMPONENT_WARNING("Ignoring equilibration of reference state. It requires the quasistatic formulation.");
+        _shouldEquilibrate = false;
+    } // if
+    if (_shouldEquilibrate && isRestart) {
+        PYLITH_COMPONENT_INFO_ROOT("Using reference state from checkpoint instead of equilibrating reference state.");
+        _shouldEquilibrate = false;
+    } // if
+    if ((TIMESTEPPING_BACKWARD_EULER != _timeStepping) && (pylith::problems::Physics::QUASISTATIC != _formulation)) {
+        PYLITH_COMPONENT_WARNING("Ignoring BDF2 time stepping. It requires the quasistatic formulation.");
+        _timeStepping = TIMESTEPPING_BACKWARD_EULER;
+    } // if
+    if (_useTimeStepErrorControl && (TIMESTEPPING_BDF2 != _timeStepping)) {
+        PYLITH_COMPONENT_WARNING("Ignoring time step error control. It requires BDF2 time stepping.");
+        _useTimeStepErrorControl = false;
+    } // if
+    assert(_timeStep);
+    if (_useTimeStepErrorControl && _timeStep->getAdaptTimeStep()) {
+        PYLITH_COMPONENT_WARNING("Ignoring adapting time step using Maxwell times and change in solution. Time step "
+                                 "is controlled using the error estimate of the time stepping method.");
+        _timeStep->setAdaptTimeStep(false);
+    } // if
+    if (TIMESTEPPING_BDF2 == _timeStepping) {
+        // Set before the material defaults, so these take precedence over them but not over user options.
+        pylith::utils::PetscOptions options;
+        options.add("-ts_type", "bdf");
+        options.add("-ts_bdf_order", "2");
+        if (_useTimeStepErrorControl) {
+            options.add("-ts_adapt_type", "basic");
+            if (_timeStep->getMaxTimeStep() < PYLITH_MAXSCALAR) {
+                assert(_normalizer);
+                std::ostringstream dtMax;
+                dtMax << _timeStep->getMaxTimeStep() / _normalizer->getTimeScale();
+                options.add("-ts_adapt_dt_max", dtMax.str().c_str());
+            } // if
+        } else {
+            options.add("-ts_adapt_type", "none");
+        } // if/else
+        options.set();
+    } // if
+    if (hasLocalTimeStepping) {
+        // Set before the material defaults, so these take precedence over them but not over user options.
+        pylith::utils::PetscOptions options;
+        options.add("-ts_type", "mprk");
+        options.add("-ts_mprk_type", "2a22");
+        options.set();
+    } // if
+    pylith::utils::PetscDefaults::NonlinearSolverEnum nonlinearSolver = pylith::utils::PetscDefaults::NEWTON;
+    switch (getSolverType()) {
+    case NONLINEAR_ANDERSON:
+        nonlinearSolver = pylith::utils::PetscDefaults::NEWTON_ANDERSON;
+        break;
+    case NONLINEAR_QUASI_NEWTON:
+        nonlinearSolver = pylith::utils::PetscDefaults::QUASI_NEWTON;
+        break;
+    default:
+        break;
+    } // switch
+    _setSplitNodeSolverDefaults();
+    pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults, nonlinearSolver);
+    err = TSSetFromOptions(_ts);PYLITH_CHECK_ERROR(err);
+    if (hasLocalTimeStepping) {
+        PetscBool isMPRK = PETSC_FALSE;
+        err = PetscObjectTypeCompare((PetscObject)_ts, TSMPRK, &isMPRK);PYLITH_CHECK_ERROR(err);
+        if (isMPRK) {
+            // Refinement factor of the time step in fast rate group for two-rate methods.
+            TSMPRKType mprkType = NULL;
+            err = TSMPRKGetType(_ts, &mprkType);PYLITH_CHECK_ERROR(err);
+            const PylithReal refineFactor = (0 == strcmp(mprkType, TSMPRK2A32)) ? 3.0 : 2.0;
+            PylithReal dt = 0.0;
+            err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+            if (dtStableMin < dt / refineFactor) {
+                assert(_normalizer);
+                const PylithReal timeScale = _normalizer->getTimeScale();
+                PYLITH_COMPONENT_WARNING("Time step in fast rate group of local time stepping ("<<dt/refineFactor*timeScale
+                                                                                                  <<" s) exceeds minimum stable time step ("
+                                                                                                  <<dtStableMin*timeScale<<" s).");
+            } // if
+        } else {
+            PYLITH_COMPONENT_WARNING("Local time stepping requires the multirate partitioned Runge-Kutta (mprk) "
+                                     "time stepper. Solution will use a single time step.");
+        } // if/else
+    } // if
+    err = TSSetUp(_ts);PYLITH_CHECK_ERROR(err);
+    PetscSNES snes = NULL;
+    err = TSGetSNES(_ts, &snes);PYLITH_CHECK_ERROR(err);
+    _setPreconditionerHints(snes);
+    pylith::utils::SetupProfiler::end("Setup time stepper");
+
+#if 0
+    // Set solve type for solution fields defined over the domain (not Lagrange multipliers).
+    PetscDS dsSoln = NULL;
+    err = DMGetDS(solution->getDM(), &dsSoln);PYLITH_CHECK_ERROR(err);
+    PetscInt numFields = 0;
+    err = PetscDSGetNumFields(dsSoln, &numFields);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iField = 0; iField < numFields; ++iField) {
+        err = PetscDSSetImplicit(dsSoln, iField, (_formulation == pylith::problems::Physics::QUASISTATIC) ? PETSC_TRUE : PETSC_FALSE);
+    } // for
 #endif
 
-    pythia::journal::debug_t debug(pylith::utils::PyreComponent::getName());
+    pythia::journal::debug_t& debug = pylith::utils::PyreComponent::getDebugJournal();
     if (debug.state()) {
         PetscDS prob = NULL;
         err = DMGetDS(solution->getDM(), &prob);PYLITH_CHECK_ERROR(err);
@@ -417,10 +1186,18 @@ pylith::problems::TimeDependent::initialize(void) {
         PetscDSView(prob, PETSC_VIEWER_STDOUT_SELF);
     } // if
 
-    if (_shouldNotifyIC) {
+    if (_shouldNotifyIC && !isRestart) {
+        pylith::utils::SetupProfiler::begin("Output initial solution");
         _notifyObserversInitialSoln();
+        pylith::utils::SetupProfiler::end("Output initial solution");
     } // if
 
+    if (_timeStep->getAdaptTimeStep()) {
+        _timeStep->initialize(solutionVector);
+    } // if
+    assert(_greensFns);
+    _greensFns->initialize();
+
     if (_monitor) {
         _monitor->open();
     } // if
@@ -429,6 +1206,153 @@ pylith::problems::TimeDependent::initialize(void) {
 } // initialize
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Reset problem for another run, reusing the mesh, integrators, Jacobian sparsity, and solver setup.
+void
+pylith::problems::TimeDependent::reinitialize(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("reinitialize()");
+
+    if (!_ts) {
+        PYLITH_COMPONENT_LOGICERROR("Problem must be initialized before it can be reinitialized.");
+    } // if
+
+    Problem::reinitialize();
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    // Reset time stepping state.
+    assert(_normalizer);
+    const PylithReal timeScale = _normalizer->getTimeScale();
+    PetscErrorCode err = TSSetTime(_ts, _startTime / timeScale);PYLITH_CHECK_ERROR(err);
+    err = TSSetStepNumber(_ts, 0);PYLITH_CHECK_ERROR(err);
+    err = TSSetTimeStep(_ts, _dtInitial / timeScale);PYLITH_CHECK_ERROR(err);
+    if ((pylith::problems::Physics::DYNAMIC == _formulation) || (pylith::problems::Physics::DYNAMIC_IMEX == _formulation)) {
+        assert(_timeStep);
+        _timeStep->setStableTimeStep();
+    } // if
+
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_T_STATE, -HUGE_VAL);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_RESIDUAL, -1.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_JACOBIAN, -1.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_LUMPED_JACOBIAN_INVERSE, -1.0);
+    _needNewLHSJacobian = true;
+    _haveNewLHSJacobian = false;
+    _jacobianStep = 0;
+    _jacobianShift = 0.0;
+    _solverIterationsPrevious = 0;
+    _localSolutionVecId = 0;
+    _localSolutionDotVecId = 0;
+    _localSolutionVecState = -1;
+    _localSolutionDotVecState = -1;
+    _localSolutionState = -1;
+    _localSolutionDotState = -1;
+    assert(_checkpoint);
+    _checkpoint->reinitialize();
+    assert(_steadyState);
+    _steadyState->reinitialize();
+    _predictorNumSolutions = 0;
+    _predictorStep = -1;
+
+    // Cached load vector depends on the auxiliary fields.
+    err = VecDestroy(&_linearLoad);PYLITH_CHECK_ERROR(err);
+
+    // Set initial solution.
+    solution->zeroLocal();
+    const size_t numIC = _ic.size();
+    for (size_t i = 0; i < numIC; ++i) {
+        assert(_ic[i]);
+        _ic[i]->setValues(solution, *_normalizer);
+    } // for
+    PetscVec solutionVector = solution->getGlobalVector();
+    solution->scatterLocalToVector(solutionVector);
+    err = TSSetSolution(_ts, solutionVector);PYLITH_CHECK_ERROR(err);
+    pylith::topology::Field* solutionDot = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);
+    assert(solutionDot);
+    solutionDot->zeroLocal();
+
+    if (_shouldNotifyIC) {
+        _notifyObserversInitialSoln();
+    } // if
+
+    assert(_timeStep);
+    if (_timeStep->getAdaptTimeStep()) {
+        _timeStep->initialize(solutionVector);
+    } // if
+
+    PYLITH_METHOD_END;
+} // reinitialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add load case to run with multiple load cases sharing the LHS Jacobian and preconditioner.
+void
+pylith::problems::TimeDependent::addLoadCase(const char* name,
+                                             pylith::bc::BoundaryCondition* bc[],
+                                             const int numBC) {
+    assert(_loadCases);
+    _loadCases->addLoadCase(name, bc, numBC);
+} // addLoadCase
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of load cases.
+size_t
+pylith::problems::TimeDependent::getNumLoadCases(void) const {
+    assert(_loadCases);
+    return _loadCases->getNumLoadCases();
+} // getNumLoadCases
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set fault with impulses for time-dependent Green's functions.
+void
+pylith::problems::TimeDependent::setImpulseFault(const char* labelName,
+                                                 const int labelValue) {
+    assert(_greensFns);
+    _greensFns->setImpulseFault(labelName, labelValue);
+} // setImpulseFault
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of impulses advanced together with one block solve per time step.
+void
+pylith::problems::TimeDependent::setImpulseBatchSize(const size_t value) {
+    assert(_greensFns);
+    _greensFns->setImpulseBatchSize(value);
+} // setImpulseBatchSize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set rank of compressed responses to impulses.
+void
+pylith::problems::TimeDependent::setResponseRank(const size_t value) {
+    assert(_greensFns);
+    _greensFns->setResponseRank(value);
+} // setResponseRank
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add slip history for prediction with time-dependent Green's functions.
+void
+pylith::problems::TimeDependent::addSlipHistory(spatialdata::spatialdb::SpatialDB* db,
+                                                spatialdata::spatialdb::TimeHistory* th) {
+    assert(_greensFns);
+    _greensFns->addSlipHistory(db, th);
+} // addSlipHistory
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of impulses for time-dependent Green's functions.
+size_t
+pylith::problems::TimeDependent::getNumImpulses(void) const {
+    assert(_greensFns);
+    return _greensFns->getNumImpulses();
+} // getNumImpulses
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Solve time-dependent problem.
 void
@@ -436,6 +1360,24 @@ pylith::problems::TimeDependent::solve(void) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("solve()");
 
+    if (_shouldEquilibrate) {
+        _equilibrateReferenceState();
+    } // if
+    assert(_greensFns);
+    if (_greensFns->isEnabled()) {
+        _greensFns->solve();
+        PYLITH_METHOD_END;
+    } // if
+    assert(_loadCases);
+    if (_loadCases->isEnabled()) {
+        _loadCases->solve();
+        PYLITH_METHOD_END;
+    } // if
+    assert(_parareal);
+    if (_parareal->isEnabled()) {
+        _parareal->solve();
+        PYLITH_METHOD_END;
+    } // if
     PetscErrorCode err = TSSolve(_ts, NULL);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
@@ -447,7 +1389,7 @@ pylith::problems::TimeDependent::solve(void) {
 void
 pylith::problems::TimeDependent::poststep(void) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("poststep()");
+    PYLITH_COMPONENT_DEBUG_CALLBACK("poststep()");
 
     // Get current solution. After first time step, t==dt, and tindex==1.
     PetscErrorCode err;
@@ -458,12 +1400,30 @@ pylith::problems::TimeDependent::poststep(void) {
     err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
     err = TSGetStepNumber(_ts, &tindex);PYLITH_CHECK_ERROR(err);
     err = TSGetSolution(_ts, &solutionVec);PYLITH_CHECK_ERROR(err);
+    if (_useTimeStepErrorControl) {
+        // TSAdapt has already chosen the next time step, so use the time step just taken.
+        PylithReal tPrev = 0.0;
+        err = TSGetPrevTime(_ts, &tPrev);PYLITH_CHECK_ERROR(err);
+        dt = t - tPrev;
+    } // if
 
     // Update PyLith view of the solution.
     assert(_integrationData);
-    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
     solution->scatterVectorToLocal(solutionVec);
-    solution->scatterLocalToOutput();
+
+    // Write output at the final time step when stopping at steady state.
+    assert(_steadyState);
+    const bool isSteadyState = _steadyState->isEnabled() && _steadyState->isSteadyState(dt, tindex, solutionVec);
+    if (isSteadyState) {
+        _steadyState->setObserversForceOutput(true);
+    } // if
+    if (isSteadyState || _needsOutputUpdate(t, tindex)) {
+        solution->scatterLocalToOutput();
+    } // if
+
+    PetscLogDouble outputTimeBegin = 0.0;
+    PetscTime(&outputTimeBegin);
 
     // Update integrators.
     const size_t numIntegrators = _integrators.size();
@@ -480,11 +1440,46 @@ pylith::problems::TimeDependent::poststep(void) {
     // Notify problem observers of updated solution.
     assert(_observers);
     _observers->notifyObservers(t, tindex, *solution);
+    if (isSteadyState) {
+        _steadyState->setObserversForceOutput(false);
+    } // if
 
-    if (_monitor) {
+    PetscLogDouble outputTimeEnd = 0.0;
+    PetscTime(&outputTimeEnd);
+
+    // Track nonlinear solver iterations for Jacobian reformation policy and progress.
+    PetscSNES snes = NULL;
+    PetscInt numIterations = 0;
+    err = TSGetSNES(_ts, &snes);PYLITH_CHECK_ERROR(err);
+    err = SNESGetIterationNumber(snes, &numIterations);PYLITH_CHECK_ERROR(err);
+    _solverIterationsPrevious = numIterations;
+    _numSolverIterations += numIterations;
+
+    assert(_parareal);
+    if (_monitor && !_parareal->isIterate()) {
         assert(_normalizer);
         const PylithReal timeScale = _normalizer->getTimeScale();
+        _monitor->setSolverStatistics(_numJacobians, _numSolverIterations);
         _monitor->update(t*timeScale, _startTime, _endTime);
+        _monitor->updateStep(t*timeScale, dt*timeScale, tindex, _ts, outputTimeEnd-outputTimeBegin);
+    } // if
+
+    assert(_timeStep);
+    if (_timeStep->getAdaptTimeStep()) {
+        _timeStep->adaptTimeStep(t, dt, solutionVec);
+    } // if
+
+    assert(_checkpoint);
+    if (_checkpoint->isEnabled()) {
+        _checkpoint->poststep(t, tindex, solutionVec);
+    } // if
+
+    if (isSteadyState) {
+        assert(_normalizer);
+        const PylithReal timeScale = _normalizer->getTimeScale();
+        PYLITH_COMPONENT_INFO_ROOT("Solution reached steady state at time step " << tindex << " (t=" << t*timeScale
+                                                                                   << " s). Stopping time stepping.");
+        err = TSSetConvergedReason(_ts, TS_CONVERGED_USER);PYLITH_CHECK_ERROR(err);
     } // if
 
     PYLITH_METHOD_END;
@@ -498,26 +1493,125 @@ pylith::problems::TimeDependent::setSolutionLocal(const PylithReal t,
                                                   PetscVec solutionVec,
                                                   PetscVec solutionDotVec) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("setSolutionLocal(t="<<t<<", solutionVec="<<solutionVec<<")");
+    PYLITH_COMPONENT_DEBUG_CALLBACK("setSolutionLocal(t="<<t<<", solutionVec="<<solutionVec<<")");
     assert(_integrationData);
 
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME, t);
+
+    // Skip scatter and constraints if neither the global vectors nor the local vectors have changed since the most
+    // recent update at this time (for example, the IFunction and IJacobian callbacks with the same state).
+    if (_isSolutionLocalCurrent(t, solutionVec, solutionDotVec)) {
+        PYLITH_COMPONENT_DEBUG_CALLBACK("Local solution is current; skipping scatter.");
+        PYLITH_METHOD_END;
+    } // if
+
     // Update PyLith view of the solution and its time derivative.
-    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
-    solution->scatterVectorToLocal(solutionVec);
+    _setSolutionLocalBegin(solutionVec, solutionDotVec);
+    _setSolutionLocalEnd(t, solutionVec, solutionDotVec);
+
+    PYLITH_METHOD_END;
+} // setSolutionLocal
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether the local solution is current.
+bool
+pylith::problems::TimeDependent::_isSolutionLocalCurrent(const PylithReal t,
+                                                         PetscVec solutionVec,
+                                                         PetscVec solutionDotVec) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_integrationData);
+    assert(solutionVec);
+
+    if (t != _localSolutionTime) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscErrorCode err = 0;
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    PetscObjectId vecId = 0;
+    PetscObjectState vecState = 0, localState = 0;
+    err = PetscObjectGetId((PetscObject)solutionVec, &vecId);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)solutionVec, &vecState);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)solution->getLocalVector(), &localState);PYLITH_CHECK_ERROR(err);
+    if ((vecId != _localSolutionVecId) || (vecState != _localSolutionVecState) || (localState != _localSolutionState)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscObjectId dotVecId = 0;
+    PetscObjectState dotVecState = 0, dotLocalState = 0;
+    if (solutionDotVec) {
+        const pylith::topology::Field* solutionDot = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);assert(solutionDot);
+        err = PetscObjectGetId((PetscObject)solutionDotVec, &dotVecId);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectStateGet((PetscObject)solutionDotVec, &dotVecState);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectStateGet((PetscObject)solutionDot->getLocalVector(), &dotLocalState);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_RETURN((dotVecId == _localSolutionDotVecId) && (dotVecState == _localSolutionDotVecState) &&
+                         (dotLocalState == _localSolutionDotState));
+} // _isSolutionLocalCurrent
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Start scattering solution and its time derivative to local vectors.
+void
+pylith::problems::TimeDependent::_setSolutionLocalBegin(PetscVec solutionVec,
+                                                        PetscVec solutionDotVec) {
+    PYLITH_METHOD_BEGIN;
+    assert(_integrationData);
+
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    solution->scatterVectorToLocalBegin(solutionVec);
+    if (solutionDotVec) {
+        pylith::topology::Field* solutionDot = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);assert(solutionDot);
+        solutionDot->scatterVectorToLocalBegin(solutionDotVec);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setSolutionLocalBegin
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Finish scattering solution and its time derivative to local vectors and insert constrained values.
+void
+pylith::problems::TimeDependent::_setSolutionLocalEnd(const PylithReal t,
+                                                      PetscVec solutionVec,
+                                                      PetscVec solutionDotVec) {
+    PYLITH_METHOD_BEGIN;
+    assert(_integrationData);
 
+    PetscErrorCode err = 0;
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    pylith::topology::Field* solutionDot = solutionDotVec ?
+                                           _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT) : NULL;
+    solution->scatterVectorToLocalEnd(solutionVec);
     if (solutionDotVec) {
-        pylith::topology::Field* solutionDot = _integrationData->getField(pylith::feassemble::IntegrationData::solution_dot);assert(solution);
-        solutionDot->scatterVectorToLocal(solutionDotVec);
+        assert(solutionDot);
+        solutionDot->scatterVectorToLocalEnd(solutionDotVec);
     } // if
 
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
     const size_t numConstraints = _constraints.size();
     for (size_t i = 0; i < numConstraints; ++i) {
         _constraints[i]->setSolution(_integrationData);
     } // for
 
+    // Record state after update.
+    _localSolutionTime = t;
+    err = PetscObjectGetId((PetscObject)solutionVec, &_localSolutionVecId);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)solutionVec, &_localSolutionVecState);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)solution->getLocalVector(), &_localSolutionState);PYLITH_CHECK_ERROR(err);
+    if (solutionDotVec) {
+        err = PetscObjectGetId((PetscObject)solutionDotVec, &_localSolutionDotVecId);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectStateGet((PetscObject)solutionDotVec, &_localSolutionDotVecState);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectStateGet((PetscObject)solutionDot->getLocalVector(), &_localSolutionDotState);PYLITH_CHECK_ERROR(err);
+    } else {
+        _localSolutionDotVecId = 0;
+        _localSolutionDotVecState = 0;
+        _localSolutionDotState = 0;
+    } // if/else
+
     PYLITH_METHOD_END;
-} // setSolutionLocal
+} // _setSolutionLocalEnd
 
 
 // ----------------------------------------------------------------------
@@ -528,53 +1622,10 @@ pylith::problems::TimeDependent::computeRHSResidual(PetscVec residualVec,
                                                     const PylithReal dt,
                                                     PetscVec solutionVec) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("computeRHSResidual(t="<<t<<", dt="<<dt<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<")");
-
-    assert(residualVec);
-    assert(solutionVec);
-    assert(_integrationData);
-
-    if (t != _integrationData->getScalar(pylith::feassemble::IntegrationData::t_state)) { _setState(t); }
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, t);
-
-    // Update PyLith view of the solution.
-    const PetscVec solutionDotVec = NULL;
-    setSolutionLocal(t, solutionVec, solutionDotVec);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
-
-    const bool hasLumpedJacobianInverse = _integrationData->hasField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);
-    if (hasLumpedJacobianInverse) {
-        const PylithReal s_tshift = 1.0; // Keep shift terms on LHS, so use 1.0 for terms moved to RHS.
-        computeLHSJacobianLumpedInv(t, dt, s_tshift, solutionVec);
-    } // if
-
-    // Sum residual contributions across integrators.
-    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
-    residual->zeroLocal();
-    const size_t numIntegrators = _integrators.size();
-    assert(numIntegrators > 0); // must have at least 1 integrator
-    for (size_t i = 0; i < numIntegrators; ++i) {
-        _integrators[i]->computeRHSResidual(residual, *_integrationData);
-    } // for
+    PYLITH_COMPONENT_DEBUG_CALLBACK("computeRHSResidual(t="<<t<<", dt="<<dt<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<")");
 
-    // Assemble residual values across processes.
-    PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
-    residual->scatterLocalToVector(residualVec, ADD_VALUES);
-
-    if (hasLumpedJacobianInverse) {
-        // Multiply RHS, G(t,s), by M^{-1}
-        const pylith::topology::Field* jacobianLumpedInv =
-            _integrationData->getField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);assert(jacobianLumpedInv);
-        err = VecPointwiseMult(residualVec, jacobianLumpedInv->getGlobalVector(), residualVec);PYLITH_CHECK_ERROR(err);
-    } // if
+    _computeRHSResidual(residualVec, t, dt, solutionVec, false);
 
-    pythia::journal::debug_t debug("timedependent.view_residual");
-    if (debug.state()) {
-        residual->view("RHS RESIDUAL");
-        std::cout << "RHS RESIDUAL GLOBAL VEC" << std::endl;
-        VecView(residualVec, PETSC_VIEWER_STDOUT_SELF);
-    } // if
     PYLITH_METHOD_END;
 } // computeRHSResidual
 
@@ -588,41 +1639,72 @@ pylith::problems::TimeDependent::computeLHSResidual(PetscVec residualVec,
                                                     PetscVec solutionVec,
                                                     PetscVec solutionDotVec) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("computeLHSResidual(t="<<t<<", dt="<<dt<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", residualVec="<<residualVec<<")");
+    PYLITH_COMPONENT_DEBUG_CALLBACK("computeLHSResidual(t="<<t<<", dt="<<dt<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", residualVec="<<residualVec<<")");
 
     assert(residualVec);
     assert(solutionVec);
     assert(solutionDotVec);
     assert(_integrationData);
 
-    if (t != _integrationData->getScalar(pylith::feassemble::IntegrationData::t_state)) { _setState(t); }
+    if (t != _integrationData->getScalar(pylith::feassemble::IntegrationData::SCALAR_T_STATE)) { _setState(t); }
 
-    // Update PyLith view of the solution.
-    setSolutionLocal(t, solutionVec, solutionDotVec);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
+    // Use stored Jacobian of linear problem after it has been formed.
+    PetscMat jacobianMat = NULL;
+    if (_useLinearFastPath && (_numJacobians > 0)) {
+        PetscErrorCode err = TSGetIJacobian(_ts, &jacobianMat, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (jacobianMat) {
+        _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME, t);
+        _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP, dt);
+        _computeLHSResidualLinear(residualVec, t, jacobianMat, solutionVec, solutionDotVec);
+        _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_T_STATE, t);
+        PYLITH_METHOD_END;
+    } // if
+
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME, t);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP, dt);
 
     // Sum residual across integrators.
-    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
+    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_RESIDUAL);assert(residual);
     residual->zeroLocal();
     const int numIntegrators = _integrators.size();
     assert(numIntegrators > 0); // must have at least 1 integrator
-    for (int i = 0; i < numIntegrators; ++i) {
-        _integrators[i]->computeLHSResidual(residual, *_integrationData);
-    } // for
+    PetscLogDouble assemblyStart = 0.0, assemblyEnd = 0.0;
+    PetscErrorCode err = PetscTime(&assemblyStart);PYLITH_CHECK_ERROR(err);
+    if (_useOverlappedAssembly && !_isSolutionLocalCurrent(t, solutionVec, solutionDotVec)) {
+        // Overlap exchange of ghost values of the solution with assembly over interior cells.
+        _setSolutionLocalBegin(solutionVec, solutionDotVec);
+        for (int i = 0; i < numIntegrators; ++i) {
+            _integrators[i]->computeLHSResidualInterior(residual, *_integrationData);
+        } // for
+        _setSolutionLocalEnd(t, solutionVec, solutionDotVec);
+        for (int i = 0; i < numIntegrators; ++i) {
+            _integrators[i]->computeLHSResidualBoundary(residual, *_integrationData);
+        } // for
+    } else {
+        // Update PyLith view of the solution.
+        setSolutionLocal(t, solutionVec, solutionDotVec);
+        for (int i = 0; i < numIntegrators; ++i) {
+            _integrators[i]->computeLHSResidual(residual, *_integrationData);
+        } // for
+    } // if/else
+    err = PetscTime(&assemblyEnd);PYLITH_CHECK_ERROR(err);
+    _checkpoint->addAssemblyTime(assemblyEnd - assemblyStart);
 
     // Assemble residual values across processes.
-    PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
     residual->scatterLocalToVector(residualVec, ADD_VALUES);
 
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, t);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_T_STATE, t);
 
-    pythia::journal::debug_t debug("timedependent.view_residual");
+#if !defined(PYLITH_DISABLE_CALLBACK_DEBUG)
+    static pythia::journal::debug_t debug("timedependent.view_residual");
     if (debug.state()) {
         residual->view("LHS RESIDUAL");
         std::cout << "LHS RESIDUAL GLOBAL VEC" << std::endl;
         VecView(residualVec, PETSC_VIEWER_STDOUT_SELF);
     } // if
+#endif
 
     PYLITH_METHOD_END;
 } // computeLHSResidual
@@ -639,7 +1721,7 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
                                                     PetscVec solutionVec,
                                                     PetscVec solutionDotVec) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("computeLHSJacobian(t="<<t<<", dt="<<dt<<", s_tshift="<<s_tshift<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<")");
+    PYLITH_COMPONENT_DEBUG_CALLBACK("computeLHSJacobian(t="<<t<<", dt="<<dt<<", s_tshift="<<s_tshift<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<")");
 
     assert(jacobianMat);
     assert(precondMat);
@@ -647,26 +1729,35 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
     assert(solutionDotVec);
     assert(s_tshift > 0);
 
-    if (!_needNewJacobian(dt)) {
-        PYLITH_COMPONENT_DEBUG("KEEP LHS Jacobian; t=" << t << ", dt=" << dt);
+    if (!_needNewJacobian(dt, s_tshift)) {
+        PYLITH_COMPONENT_DEBUG_CALLBACK("KEEP LHS Jacobian; t=" << t << ", dt=" << dt);
         _haveNewLHSJacobian = false;
         PYLITH_METHOD_END;
     } // if
-    PYLITH_COMPONENT_DEBUG("NEW LHS Jacobian; t=" << t << ", dt=" << dt);
+    PYLITH_COMPONENT_DEBUG_CALLBACK("NEW LHS Jacobian; t=" << t << ", dt=" << dt);
 
     assert(_integrationData);
-    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::s_tshift, s_tshift);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME, t);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP, dt);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_S_TSHIFT, s_tshift);
 
-    // Zero LHS Jacobian
+    // With a matrix-free Jacobian, we only assemble the preconditioner.
     PetscErrorCode err = 0;
+    PetscBool isMatrixFree = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)jacobianMat, MATSHELL, &isMatrixFree);PYLITH_CHECK_ERROR(err);
+    PetscMat jacobianAssembled = isMatrixFree ? precondMat : jacobianMat;
+    if (!_numJacobians) {
+        if (jacobianAssembled != precondMat) { _ignoreLowerTriangular(jacobianAssembled); }
+        _ignoreLowerTriangular(precondMat);
+    } // if
+
+    // Zero LHS Jacobian
     PetscDS solnDS = NULL;
     PetscBool hasJacobian = PETSC_FALSE;
     err = DMGetDS(solution->getDM(), &solnDS);PYLITH_CHECK_ERROR(err);
     err = PetscDSHasJacobian(solnDS, &hasJacobian);PYLITH_CHECK_ERROR(err);
-    if (hasJacobian) { err = MatZeroEntries(jacobianMat);PYLITH_CHECK_ERROR(err); }
+    if (hasJacobian && (jacobianAssembled != precondMat)) { err = MatZeroEntries(jacobianAssembled);PYLITH_CHECK_ERROR(err); }
     err = MatZeroEntries(precondMat);PYLITH_CHECK_ERROR(err);
 
     // Update PyLith view of the solution.
@@ -674,27 +1765,87 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
 
     // Sum Jacobian contributions across integrators.
     const size_t numIntegrators = _integrators.size();
+    PetscLogDouble assemblyStart = 0.0, assemblyEnd = 0.0;
+    err = PetscTime(&assemblyStart);PYLITH_CHECK_ERROR(err);
     for (size_t i = 0; i < numIntegrators; ++i) {
-        _integrators[i]->computeLHSJacobian(jacobianMat, precondMat, *_integrationData);
+        _integrators[i]->computeLHSJacobian(jacobianAssembled, precondMat, *_integrationData);
     } // for
+    err = PetscTime(&assemblyEnd);PYLITH_CHECK_ERROR(err);
+    _checkpoint->addAssemblyTime(assemblyEnd - assemblyStart);
 
     _needNewLHSJacobian = false;
     _haveNewLHSJacobian = true;
+    ++_numJacobians;
+    if (_ts) {
+        err = TSGetStepNumber(_ts, &_jacobianStep);PYLITH_CHECK_ERROR(err);
+    } // if
 
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_jacobian, dt);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_JACOBIAN, dt);
+    _jacobianShift = s_tshift;
 
     // Assemble matrices
-    if (jacobianMat != precondMat) {
-        err = MatAssemblyBegin(jacobianMat, MAT_FINAL_ASSEMBLY);
-        err = MatAssemblyEnd(jacobianMat, MAT_FINAL_ASSEMBLY);
+    if (jacobianAssembled != precondMat) {
+        err = MatAssemblyBegin(jacobianAssembled, MAT_FINAL_ASSEMBLY);
+        err = MatAssemblyEnd(jacobianAssembled, MAT_FINAL_ASSEMBLY);
     }
     err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);
     err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);
 
+    // Nonzero pattern is fixed after first assembly.
+    if (1 == _numJacobians) {
+        if (jacobianAssembled != precondMat) { _reuseJacobianPattern(jacobianAssembled); }
+        _reuseJacobianPattern(precondMat);
+        _recordJacobianMemory(jacobianAssembled, precondMat);
+    } // if
+
     PYLITH_METHOD_END;
 } // computeLHSJacobian
 
 
+// ----------------------------------------------------------------------
+// Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector for implicit time stepping.
+void
+pylith::problems::TimeDependent::computeLHSJacobianAction(PetscVec actionVec,
+                                                          PetscVec vectorVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("computeLHSJacobianAction(actionVec="<<actionVec<<", vectorVec="<<vectorVec<<")");
+
+    assert(actionVec);
+    assert(vectorVec);
+    assert(_integrationData);
+
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    PetscDM dmSoln = solution->getDM();
+
+    // Constrained degrees of freedom are not in the global vector, so they remain zero in the local vector.
+    PetscErrorCode err = 0;
+    PetscVec vectorLocal = NULL;
+    PetscVec actionLocal = NULL;
+    err = DMGetLocalVector(dmSoln, &vectorLocal);PYLITH_CHECK_ERROR(err);
+    err = DMGetLocalVector(dmSoln, &actionLocal);PYLITH_CHECK_ERROR(err);
+    err = VecSet(vectorLocal, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmSoln, vectorVec, INSERT_VALUES, vectorLocal);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSoln, vectorVec, INSERT_VALUES, vectorLocal);PYLITH_CHECK_ERROR(err);
+    err = VecSet(actionLocal, 0.0);PYLITH_CHECK_ERROR(err);
+
+    // Sum action contributions across integrators.
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->computeLHSJacobianAction(actionLocal, vectorLocal, *_integrationData);
+    } // for
+
+    // Assemble action across processes.
+    err = VecSet(actionVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalBegin(dmSoln, actionLocal, ADD_VALUES, actionVec);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmSoln, actionLocal, ADD_VALUES, actionVec);PYLITH_CHECK_ERROR(err);
+
+    err = DMRestoreLocalVector(dmSoln, &vectorLocal);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSoln, &actionLocal);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // computeLHSJacobianAction
+
+
 // ----------------------------------------------------------------------
 // Compute inverse of LHS Jacobian for F(t,s,\dot{s}) for explicit time stepping.
 void
@@ -703,7 +1854,7 @@ pylith::problems::TimeDependent::computeLHSJacobianLumpedInv(const PylithReal t,
                                                              const PylithReal s_tshift,
                                                              PetscVec solutionVec) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("TimeDependent::computeLHSJacobianLumpedInv(t="<<t<<", dt="<<dt<<", s_tshift="<<s_tshift<<", solutionVec="<<solutionVec<<")");
+    PYLITH_COMPONENT_DEBUG_CALLBACK("TimeDependent::computeLHSJacobianLumpedInv(t="<<t<<", dt="<<dt<<", s_tshift="<<s_tshift<<", solutionVec="<<solutionVec<<")");
 
     assert(solutionVec);
     assert(s_tshift > 0);
@@ -713,7 +1864,7 @@ pylith::problems::TimeDependent::computeLHSJacobianLumpedInv(const PylithReal t,
 
     // Check to see if we need to compute LHS Jacobian.
     bool needNewLHSJacobianLumped = false;
-    const bool dtChanged = dt != _integrationData->getScalar(pylith::feassemble::IntegrationData::dt_lumped_jacobian_inverse);
+    const bool dtChanged = dt != _integrationData->getScalar(pylith::feassemble::IntegrationData::SCALAR_DT_LUMPED_JACOBIAN_INVERSE);
     for (size_t i = 0; i < numIntegrators; ++i) {
         if (_integrators[i]->needNewLHSJacobianLumped(dtChanged)) {
             needNewLHSJacobianLumped = true;
@@ -723,15 +1874,15 @@ pylith::problems::TimeDependent::computeLHSJacobianLumpedInv(const PylithReal t,
     if (!needNewLHSJacobianLumped) { PYLITH_METHOD_END; }
 
     // Set jacobian to zero.
-    pylith::topology::Field* jacobianLumpedInv = _integrationData->getField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);
+    pylith::topology::Field* jacobianLumpedInv = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_LUMPED_JACOBIAN_INVERSE);
     jacobianLumpedInv->zeroLocal();
 
     // Update PyLith view of the solution.
     const PetscVec solutionDotVec = NULL;
     setSolutionLocal(t, solutionVec, solutionDotVec);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::s_tshift, s_tshift);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME, t);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP, dt);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_S_TSHIFT, s_tshift);
 
     // Sum Jacobian contributions across integrators.
     for (size_t i = 0; i < numIntegrators; ++i) {
@@ -740,11 +1891,11 @@ pylith::problems::TimeDependent::computeLHSJacobianLumpedInv(const PylithReal t,
 
     // Insert values into global vector.
     jacobianLumpedInv->scatterLocalToVector(jacobianLumpedInv->getGlobalVector());
-    if (_integrationData->hasField(pylith::feassemble::IntegrationData::dae_mass_weighting)) {
+    if (_integrationData->hasField(pylith::feassemble::IntegrationData::FIELD_DAE_MASS_WEIGHTING)) {
         pylith::faults::FaultOps::updateDAEMassWeighting(_integrationData);
     } // if
 
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_lumped_jacobian_inverse, dt);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_LUMPED_JACOBIAN_INVERSE, dt);
     PYLITH_METHOD_END;
 } // computeLHSJacobianLumpedInv
 
@@ -758,9 +1909,7 @@ pylith::problems::TimeDependent::computeRHSResidual(PetscTS ts,
                                                     PetscVec residualVec,
                                                     void* context) {
     PYLITH_METHOD_BEGIN;
-    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
-    debug << pythia::journal::at(__HERE__)
-          << "computeRHSResidual(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+    PYLITH_DEBUG_CALLBACK(_TimeDependent::pyreComponent, "computeRHSResidual(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")");
 
     // Get current time step.
     PylithReal dt;
@@ -773,6 +1922,42 @@ pylith::problems::TimeDependent::computeRHSResidual(PetscTS ts,
 } // computeRHSResidual
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing RHS residual, G(t,s), for slow rate group of local time stepping.
+PetscErrorCode
+pylith::problems::TimeDependent::computeRHSResidualSlow(PetscTS ts,
+                                                        PetscReal t,
+                                                        PetscVec solutionVec,
+                                                        PetscVec residualVec,
+                                                        void* context) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_DEBUG_CALLBACK(_TimeDependent::pyreComponent, "computeRHSResidualSlow(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")");
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+    problem->_computeRHSResidualSplit(residualVec, t, solutionVec, "slow");
+
+    PYLITH_METHOD_RETURN(0);
+} // computeRHSResidualSlow
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing RHS residual, G(t,s), for fast rate group of local time stepping.
+PetscErrorCode
+pylith::problems::TimeDependent::computeRHSResidualFast(PetscTS ts,
+                                                        PetscReal t,
+                                                        PetscVec solutionVec,
+                                                        PetscVec residualVec,
+                                                        void* context) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_DEBUG_CALLBACK(_TimeDependent::pyreComponent, "computeRHSResidualFast(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")");
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+    problem->_computeRHSResidualSplit(residualVec, t, solutionVec, "fast");
+
+    PYLITH_METHOD_RETURN(0);
+} // computeRHSResidualFast
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Callback static method for computing residual for LHS, F(t,s,\dot{s}).
 PetscErrorCode
@@ -783,9 +1968,7 @@ pylith::problems::TimeDependent::computeLHSResidual(PetscTS ts,
                                                     PetscVec residualVec,
                                                     void* context) {
     PYLITH_METHOD_BEGIN;
-    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
-    debug << pythia::journal::at(__HERE__)
-          << "computeLHSResidual(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+    PYLITH_DEBUG_CALLBACK(_TimeDependent::pyreComponent, "computeLHSResidual(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", residualVec="<<residualVec<<", context="<<context<<")");
 
     // Get current time step.
     PylithReal dt;
@@ -809,10 +1992,7 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscTS ts,
                                                     PetscMat precondMat,
                                                     void* context) {
     PYLITH_METHOD_BEGIN;
-    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
-    debug << pythia::journal::at(__HERE__)
-          << "computeLHSJacobian(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", s_tshift="<<s_tshift<<", jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", context="<<context<<")" <<
-        pythia::journal::endl;
+    PYLITH_DEBUG_CALLBACK(_TimeDependent::pyreComponent, "computeLHSJacobian(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", s_tshift="<<s_tshift<<", jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", context="<<context<<")");
 
     // Get current time step.
     PylithReal dt;
@@ -825,14 +2005,29 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscTS ts,
 } // computeLHSJacobian
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing action of LHS Jacobian (MatMult for PETSc shell matrix).
+PetscErrorCode
+pylith::problems::TimeDependent::computeLHSJacobianAction(PetscMat jacobianMat,
+                                                          PetscVec vectorVec,
+                                                          PetscVec actionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_DEBUG_CALLBACK(_TimeDependent::pyreComponent, "computeLHSJacobianAction(jacobianMat="<<jacobianMat<<", vectorVec="<<vectorVec<<", actionVec="<<actionVec<<")");
+
+    pylith::problems::TimeDependent* problem = NULL;
+    PetscErrorCode err = MatShellGetContext(jacobianMat, &problem);PYLITH_CHECK_ERROR(err);assert(problem);
+    problem->computeLHSJacobianAction(actionVec, vectorVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeLHSJacobianAction
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Callback static method for operations after advancing solution one time step.
 PetscErrorCode
 pylith::problems::TimeDependent::poststep(PetscTS ts) {
     PYLITH_METHOD_BEGIN;
-    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
-    debug << pythia::journal::at(__HERE__)
-          << "poststep(ts="<<ts<<")" << pythia::journal::endl;
+    PYLITH_DEBUG_CALLBACK(_TimeDependent::pyreComponent, "poststep(ts="<<ts<<")");
 
     TimeDependent* problem = NULL;
     PetscErrorCode err = TSGetApplicationContext(ts, (void*)&problem);PYLITH_CHECK_ERROR(err);assert(problem);
@@ -843,25 +2038,63 @@ pylith::problems::TimeDependent::poststep(PetscTS ts) {
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Check whether we need to reform the Jacobian.
+// Callback static method for computing initial guess of nonlinear solver using predictor.
+PetscErrorCode
+pylith::problems::TimeDependent::computeInitialGuess(PetscSNES snes,
+                                                     PetscVec solutionVec,
+                                                     void* context) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_DEBUG_CALLBACK(_TimeDependent::pyreComponent, "computeInitialGuess(snes="<<snes<<", solutionVec="<<solutionVec<<", context="<<context<<")");
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+    problem->_computeInitialGuess(solutionVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeInitialGuess
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether we need to reform the Jacobian.
 bool
-pylith::problems::TimeDependent::_needNewJacobian(const PylithReal dt) {
+pylith::problems::TimeDependent::_needNewJacobian(const PylithReal dt,
+                                                  const PylithReal s_tshift) {
     PYLITH_METHOD_BEGIN;
 
     // If we already know we need to recompute the LHS Jacobian, then return true.
     if (_needNewLHSJacobian) { PYLITH_METHOD_RETURN(true); }
 
     assert(_integrationData);
-    const bool dtChanged = dt != _integrationData->getScalar(pylith::feassemble::IntegrationData::dt_jacobian);
+    // Multistep methods (BDF2) change the shift without changing the time step, such as after the first (backward Euler)
+    // step or when the ratio of consecutive time steps changes.
+    const bool dtChanged = (dt != _integrationData->getScalar(pylith::feassemble::IntegrationData::SCALAR_DT_JACOBIAN)) ||
+                           (s_tshift != _jacobianShift);
     const size_t numIntegrators = _integrators.size();
 
+    bool integratorNeedsNewJacobian = false;
     for (size_t i = 0; i < numIntegrators; ++i) {
         if (_integrators[i]->needNewLHSJacobian(dtChanged)) {
-            _needNewLHSJacobian = true;
+            integratorNeedsNewJacobian = true;
             break;
         } // if
     } // for
+    if (!integratorNeedsNewJacobian) { PYLITH_METHOD_RETURN(false); }
+
+    // Lag Jacobian requested by integrators unless the time step changed or the lagging policy triggers it.
+    if (!dtChanged && _ts && (_jacobianLagSteps || _jacobianReformIterations)) {
+        PylithInt step = 0;
+        PetscErrorCode err = TSGetStepNumber(_ts, &step);PYLITH_CHECK_ERROR(err);
+        bool reform = false;
+        if (_jacobianLagSteps && (step >= _jacobianStep + PylithInt(_jacobianLagSteps))) {
+            reform = true;
+        } // if
+        if (_jacobianReformIterations && (step > _jacobianStep) &&
+            (_solverIterationsPrevious > PylithInt(_jacobianReformIterations))) {
+            reform = true;
+        } // if
+        if (!reform) { PYLITH_METHOD_RETURN(false); }
+    } // if
 
+    _needNewLHSJacobian = true;
     PYLITH_METHOD_RETURN(_needNewLHSJacobian);
 } // _needNewJacobian
 
@@ -871,7 +2104,7 @@ pylith::problems::TimeDependent::_needNewJacobian(const PylithReal dt) {
 void
 pylith::problems::TimeDependent::_setState(const PylithReal t) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("_setState(t="<<t<<")");
+    PYLITH_COMPONENT_DEBUG_CALLBACK("_setState(t="<<t<<")");
 
     // Update constraint values to current time, t.
     const size_t numConstraints = _constraints.size();
@@ -889,6 +2122,618 @@ pylith::problems::TimeDependent::_setState(const PylithReal t) {
 } // _setState
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set LHS Jacobian to matrix-free shell matrix with assembled preconditioner.
+void
+pylith::problems::TimeDependent::_setMatrixFreeJacobian(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setMatrixFreeJacobian()");
+
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        if (!_integrators[i]->hasLHSJacobianAction()) {
+            std::ostringstream msg;
+            msg << "Cannot use matrix-free Jacobian. Integrator for '" << _integrators[i]->getLabelName() << "="
+                << _integrators[i]->getLabelValue() << "' cannot compute the action of the LHS Jacobian.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // for
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    PetscVec solutionVec = solution->getGlobalVector();assert(solutionVec);
+    PetscInt numRowsLocal = 0, numRows = 0;
+    PetscErrorCode err = 0;
+    err = VecGetLocalSize(solutionVec, &numRowsLocal);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(solutionVec, &numRows);PYLITH_CHECK_ERROR(err);
+
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
+    err = MatCreateShell(solution->getMesh().getComm(), numRowsLocal, numRowsLocal, numRows, numRows, (void*)this,
+                         &jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = MatShellSetOperation(jacobianMat, MATOP_MULT, (void(*)(void))computeLHSJacobianAction);PYLITH_CHECK_ERROR(err);
+    err = DMCreateMatrix(solution->getDM(), &precondMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_COMPONENT_DEBUG("Setting PetscTS callback computeLHSJacobian() with matrix-free Jacobian.");
+    err = TSSetIJacobian(_ts, jacobianMat, precondMat, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&precondMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setMatrixFreeJacobian
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set up materials for fixed-stress split of poroelasticity.
+void
+pylith::problems::TimeDependent::_setupFixedStressSplit(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupFixedStressSplit()");
+
+    if ((pylith::problems::Physics::QUASISTATIC != _formulation) || (_interfaces.size() > 0)) {
+        throw std::runtime_error("Fixed-stress split requires the quasistatic formulation and a problem without faults.");
+    } // if
+
+    const size_t numMaterials = _materials.size();
+    for (size_t i = 0; i < numMaterials; ++i) {
+        pylith::materials::Poroelasticity* material = dynamic_cast<pylith::materials::Poroelasticity*>(_materials[i]);
+        if (!material) {
+            std::ostringstream msg;
+            msg << "Fixed-stress split requires poroelastic materials. Material '" << _materials[i]->getIdentifier()
+                << "' is not a poroelastic material.";
+            throw std::runtime_error(msg.str());
+        } // if
+        material->useFixedStressSplit(true);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setupFixedStressSplit
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set up materials for pressure mass matrix preconditioner of incompressible elasticity.
+void
+pylith::problems::TimeDependent::_setupPressureMassPreconditioner(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupPressureMassPreconditioner()");
+
+    if (pylith::problems::Physics::QUASISTATIC != _formulation) {
+        throw std::runtime_error("Pressure mass matrix preconditioner requires the quasistatic formulation.");
+    } // if
+
+    const size_t numMaterials = _materials.size();
+    for (size_t i = 0; i < numMaterials; ++i) {
+        pylith::materials::IncompressibleElasticity* material =
+            dynamic_cast<pylith::materials::IncompressibleElasticity*>(_materials[i]);
+        if (!material) {
+            std::ostringstream msg;
+            msg << "Pressure mass matrix preconditioner requires incompressible elastic materials. Material '"
+                << _materials[i]->getIdentifier() << "' is not an incompressible elastic material.";
+            throw std::runtime_error(msg.str());
+        } // if
+        material->usePressureMassPreconditioner(true);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setupPressureMassPreconditioner
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set LHS Jacobian and preconditioner to separate assembled matrices.
+void
+pylith::problems::TimeDependent::_setPreconditionerMatrix(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setPreconditionerMatrix()");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+
+    PetscErrorCode err = 0;
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
+    err = DMCreateMatrix(solution->getDM(), &jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = DMCreateMatrix(solution->getDM(), &precondMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_COMPONENT_DEBUG("Setting PetscTS callback computeLHSJacobian() with separate preconditioner.");
+    err = TSSetIJacobian(_ts, jacobianMat, precondMat, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&precondMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setPreconditionerMatrix
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether the residual can be formed from the stored Jacobian and a cached load vector.
+bool
+pylith::problems::TimeDependent::_canUseLinearFastPath(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    if ((LINEAR != _solverType) || (pylith::problems::Physics::QUASISTATIC != _formulation)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    // Integrators over materials must have linear, time-independent residuals. Boundary conditions and faults are
+    // evaluated at each time.
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        if (dynamic_cast<pylith::feassemble::IntegratorDomain*>(_integrators[i]) &&
+            !_integrators[i]->hasTimeIndependentLHSResidual()) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+    } // for
+
+    // Constrained values enter the residual through the materials, so they must not depend on time.
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        assert(_constraints[i]);
+        if (_constraints[i]->isTimeDependent()) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+    } // for
+
+    PYLITH_METHOD_RETURN(true);
+} // _canUseLinearFastPath
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute LHS residual for linear problem from stored Jacobian: F(t,s) = J*s + b + b_t(t).
+void
+pylith::problems::TimeDependent::_computeLHSResidualLinear(PetscVec residualVec,
+                                                           const PylithReal t,
+                                                           PetscMat jacobianMat,
+                                                           PetscVec solutionVec,
+                                                           PetscVec solutionDotVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("_computeLHSResidualLinear(t="<<t<<", jacobianMat="<<jacobianMat<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<", residualVec="<<residualVec<<")");
+
+    assert(residualVec);
+    assert(jacobianMat);
+    assert(solutionVec);
+    assert(_integrationData);
+
+    PetscErrorCode err = 0;
+    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_RESIDUAL);assert(residual);
+    const size_t numIntegrators = _integrators.size();
+
+    // Evaluate residuals with zero solution (constrained values are still inserted).
+    if (!_linearZero) {
+        err = VecDuplicate(solutionVec, &_linearZero);PYLITH_CHECK_ERROR(err);
+        err = VecSet(_linearZero, 0.0);PYLITH_CHECK_ERROR(err);
+    } // if
+    setSolutionLocal(t, _linearZero, _linearZero);
+
+    // Cached load vector, b, from integrators with time-independent residuals.
+    if (!_linearLoad) {
+        PYLITH_COMPONENT_DEBUG("Computing load vector for integrators with time-independent residuals.");
+        residual->zeroLocal();
+        for (size_t i = 0; i < numIntegrators; ++i) {
+            if (_integrators[i]->hasTimeIndependentLHSResidual()) {
+                _integrators[i]->computeLHSResidual(residual, *_integrationData);
+            } // if
+        } // for
+        err = VecDuplicate(solutionVec, &_linearLoad);PYLITH_CHECK_ERROR(err);
+        err = VecSet(_linearLoad, 0.0);PYLITH_CHECK_ERROR(err);
+        residual->scatterLocalToVector(_linearLoad, ADD_VALUES);
+    } // if
+
+    // Load vector, b_t(t), from integrators with time-dependent residuals.
+    residual->zeroLocal();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        if (!_integrators[i]->hasTimeIndependentLHSResidual()) {
+            _integrators[i]->computeLHSResidual(residual, *_integrationData);
+        } // if
+    } // for
+    err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
+    residual->scatterLocalToVector(residualVec, ADD_VALUES);
+
+    // F(t,s) = J*s + b + b_t(t)
+    err = VecAXPY(residualVec, 1.0, _linearLoad);PYLITH_CHECK_ERROR(err);
+    err = MatMultAdd(jacobianMat, solutionVec, residualVec, residualVec);PYLITH_CHECK_ERROR(err);
+
+    // Restore PyLith view of the solution.
+    setSolutionLocal(t, solutionVec, solutionDotVec);
+
+    PYLITH_METHOD_END;
+} // _computeLHSResidualLinear
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute RHS residual for G(t,s) at all degrees of freedom or only degrees of freedom in the fast rate group.
+void
+pylith::problems::TimeDependent::_computeRHSResidual(PetscVec residualVec,
+                                                     const PylithReal t,
+                                                     const PylithReal dt,
+                                                     PetscVec solutionVec,
+                                                     const bool fastOnly) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("_computeRHSResidual(t="<<t<<", dt="<<dt<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", fastOnly="<<fastOnly<<")");
+
+    assert(residualVec);
+    assert(solutionVec);
+    assert(_integrationData);
+
+    if (t != _integrationData->getScalar(pylith::feassemble::IntegrationData::SCALAR_T_STATE)) { _setState(t); }
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_T_STATE, t);
+
+    // Update PyLith view of the solution.
+    const PetscVec solutionDotVec = NULL;
+    setSolutionLocal(t, solutionVec, solutionDotVec);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME, t);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_TIME_STEP, dt);
+
+    const bool hasLumpedJacobianInverse = _integrationData->hasField(pylith::feassemble::IntegrationData::FIELD_LUMPED_JACOBIAN_INVERSE);
+    if (hasLumpedJacobianInverse) {
+        const PylithReal s_tshift = 1.0; // Keep shift terms on LHS, so use 1.0 for terms moved to RHS.
+        computeLHSJacobianLumpedInv(t, dt, s_tshift, solutionVec);
+    } // if
+
+    // Sum residual contributions across integrators.
+    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_RESIDUAL);assert(residual);
+    residual->zeroLocal();
+    const size_t numIntegrators = _integrators.size();
+    assert(numIntegrators > 0); // must have at least 1 integrator
+    PetscLogDouble assemblyStart = 0.0, assemblyEnd = 0.0;
+    PetscErrorCode err = PetscTime(&assemblyStart);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        if (fastOnly) {
+            _integrators[i]->computeRHSResidualFast(residual, *_integrationData);
+        } else {
+            _integrators[i]->computeRHSResidual(residual, *_integrationData);
+        } // if/else
+    } // for
+    err = PetscTime(&assemblyEnd);PYLITH_CHECK_ERROR(err);
+    _checkpoint->addAssemblyTime(assemblyEnd - assemblyStart);
+
+    // Assemble residual values across processes.
+    err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
+    residual->scatterLocalToVector(residualVec, ADD_VALUES);
+
+    if (hasLumpedJacobianInverse) {
+        // Multiply RHS, G(t,s), by M^{-1}
+        const pylith::topology::Field* jacobianLumpedInv =
+            _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_LUMPED_JACOBIAN_INVERSE);assert(jacobianLumpedInv);
+        err = VecPointwiseMult(residualVec, jacobianLumpedInv->getGlobalVector(), residualVec);PYLITH_CHECK_ERROR(err);
+    } // if
+
+#if !defined(PYLITH_DISABLE_CALLBACK_DEBUG)
+    static pythia::journal::debug_t debug("timedependent.view_residual");
+    if (debug.state()) {
+        residual->view("RHS RESIDUAL");
+        std::cout << "RHS RESIDUAL GLOBAL VEC" << std::endl;
+        VecView(residualVec, PETSC_VIEWER_STDOUT_SELF);
+    } // if
+#endif
+    PYLITH_METHOD_END;
+} // _computeRHSResidual
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute RHS residual for G(t,s) for a rate group of local time stepping.
+void
+pylith::problems::TimeDependent::_computeRHSResidualSplit(PetscVec residualVec,
+                                                          const PylithReal t,
+                                                          PetscVec solutionVec,
+                                                          const char* splitName) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("_computeRHSResidualSplit(t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", splitName="<<splitName<<")");
+
+    assert(residualVec);
+    assert(_rhsResidualSplit);
+
+    // Sub-time steppers of rate groups do not carry the time step, so use the time step of the problem.
+    PylithReal dt = 0.0;
+    PetscErrorCode err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+    const bool fastOnly = 0 == strcmp(splitName, "fast");
+    _computeRHSResidual(_rhsResidualSplit, t, dt, solutionVec, fastOnly);
+
+    PetscIS splitIS = NULL;
+    PetscVec splitVec = NULL;
+    err = TSRHSSplitGetIS(_ts, splitName, &splitIS);PYLITH_CHECK_ERROR(err);assert(splitIS);
+    err = VecGetSubVector(_rhsResidualSplit, splitIS, &splitVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(splitVec, residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreSubVector(_rhsResidualSplit, splitIS, &splitVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _computeRHSResidualSplit
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set up rate groups for local time stepping.
+bool
+pylith::problems::TimeDependent::_setupLocalTimeStepping(PylithReal* dtStableMin) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupLocalTimeStepping(dtStableMin="<<dtStableMin<<")");
+    assert(dtStableMin);
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    PetscDM dm = solution->getDM();assert(dm);
+    const MPI_Comm comm = solution->getMesh().getComm();
+
+    PetscErrorCode err = 0;
+    PylithReal dt = 0.0;
+    err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    // Cells that are not stable with the time step go in the fast rate group along with the points in their closure.
+    std::vector<int> fastFlags(pEnd-pStart, 0);
+    PylithReal dtStableMinLocal = PYLITH_MAXSCALAR;
+    PylithInt numCellsLocal[2] = { 0, 0 }; // fast, all
+    std::vector<pylith::feassemble::IntegratorDomain*> integratorsDomain;
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        pylith::feassemble::IntegratorDomain* integrator = dynamic_cast<pylith::feassemble::IntegratorDomain*>(_integrators[i]);
+        if (!integrator) { continue; }
+        integratorsDomain.push_back(integrator);
+
+        std::vector<PetscInt> cells;
+        std::vector<PylithReal> dtStable;
+        integrator->computeStableTimeSteps(&cells, &dtStable);
+        numCellsLocal[1] += cells.size();
+        for (size_t iCell = 0; iCell < cells.size(); ++iCell) {
+            dtStableMinLocal = std::min(dtStableMinLocal, dtStable[iCell]);
+            if (dtStable[iCell] >= dt) { continue; }
+
+            ++numCellsLocal[0];
+            PetscInt closureSize = 0;
+            PetscInt* closure = NULL;
+            err = DMPlexGetTransitiveClosure(dm, cells[iCell], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+                fastFlags[closure[2*iPoint]-pStart] = 1;
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dm, cells[iCell], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+
+    // Points shared among processes are in the fast rate group if any process puts them there.
+    PetscSF sf = NULL;
+    PetscInt numRoots = -1;
+    err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+    if (sf) {
+        err = PetscSFGetGraph(sf, &numRoots, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (numRoots >= 0) {
+        std::vector<int> rootFlags(fastFlags);
+        err = PetscSFReduceBegin(sf, MPI_INT, &fastFlags[0], &rootFlags[0], MPI_MAX);PYLITH_CHECK_ERROR(err);
+        err = PetscSFReduceEnd(sf, MPI_INT, &fastFlags[0], &rootFlags[0], MPI_MAX);PYLITH_CHECK_ERROR(err);
+        fastFlags = rootFlags;
+        err = PetscSFBcastBegin(sf, MPI_INT, &rootFlags[0], &fastFlags[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+        err = PetscSFBcastEnd(sf, MPI_INT, &rootFlags[0], &fastFlags[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PylithInt numCells[2] = { 0, 0 };
+    err = MPI_Allreduce(&dtStableMinLocal, dtStableMin, 1, MPIU_REAL, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(numCellsLocal, numCells, 2, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    if (!numCells[0]) {
+        PYLITH_COMPONENT_INFO_ROOT("All cells are stable with the time step, so local time stepping is not needed.");
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    PYLITH_COMPONENT_INFO_ROOT("Local time stepping with "<<numCells[0]<<" of "<<numCells[1]<<" cells in fast rate group.");
+
+    const std::vector<bool> isFastPoint(fastFlags.begin(), fastFlags.end());
+    for (size_t i = 0; i < integratorsDomain.size(); ++i) {
+        integratorsDomain[i]->setFastPoints(isFastPoint);
+    } // for
+
+    // Split degrees of freedom in global vector into rate groups.
+    PetscSection globalSection = NULL;
+    err = DMGetGlobalSection(dm, &globalSection);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> indices[2]; // slow, fast
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, cdof = 0, off = 0;
+        err = PetscSectionGetDof(globalSection, point, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof <= 0) { continue; } // Not owned by this process.
+        err = PetscSectionGetConstraintDof(globalSection, point, &cdof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(globalSection, point, &off);PYLITH_CHECK_ERROR(err);
+        std::vector<PetscInt>& group = indices[fastFlags[point-pStart]];
+        for (PetscInt iDof = 0; iDof < dof-cdof; ++iDof) {
+            group.push_back(off+iDof);
+        } // for
+    } // for
+
+    const char* splitNames[2] = { "slow", "fast" };
+    TSRHSFunction splitFns[2] = { computeRHSResidualSlow, computeRHSResidualFast };
+    for (size_t iGroup = 0; iGroup < 2; ++iGroup) {
+        PetscIS splitIS = NULL;
+        err = ISCreateGeneral(comm, indices[iGroup].size(), indices[iGroup].size() ? &indices[iGroup][0] : NULL,
+                              PETSC_COPY_VALUES, &splitIS);PYLITH_CHECK_ERROR(err);
+        err = TSRHSSplitSetIS(_ts, splitNames[iGroup], splitIS);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&splitIS);PYLITH_CHECK_ERROR(err);
+        err = TSRHSSplitSetRHSFunction(_ts, splitNames[iGroup], NULL, splitFns[iGroup], (void*)this);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = TSSetUseSplitRHSFunction(_ts, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+
+    err = VecDestroy(&_rhsResidualSplit);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solution->getGlobalVector(), &_rhsResidualSplit);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(true);
+} // _setupLocalTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute initial guess of nonlinear solver by extrapolating solutions at previous time steps.
+void
+pylith::problems::TimeDependent::_computeInitialGuess(PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("_computeInitialGuess(solutionVec="<<solutionVec<<")");
+
+    assert(solutionVec);
+    assert(_predictor != PREDICTOR_NONE);
+
+    // Time and solution at the beginning of the time step.
+    PetscErrorCode err = 0;
+    PylithReal t = 0.0, dt = 0.0;
+    PylithInt tindex = 0;
+    PetscVec solutionPrevious = NULL;
+    err = TSGetTime(_ts, &t);PYLITH_CHECK_ERROR(err);
+    err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+    err = TSGetStepNumber(_ts, &tindex);PYLITH_CHECK_ERROR(err);
+    err = TSGetSolution(_ts, &solutionPrevious);PYLITH_CHECK_ERROR(err);
+
+    // Add the solution at the beginning of the time step once per time step, because the solve is repeated if the
+    // time step is rejected. Skip the initial conditions, because the response in the first time step is usually a
+    // jump (e.g., elastic response to loading) that should not be extrapolated.
+    const size_t maxSolutions = size_t(_predictor) + 1;
+    if ((tindex > 0) && (tindex != _predictorStep)) {
+        PetscVec vecOldest = _predictorSolutions[maxSolutions-1];
+        for (size_t i = maxSolutions-1; i > 0; --i) {
+            _predictorSolutions[i] = _predictorSolutions[i-1];
+            _predictorTimes[i] = _predictorTimes[i-1];
+        } // for
+        if (!vecOldest) {
+            err = VecDuplicate(solutionPrevious, &vecOldest);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = VecCopy(solutionPrevious, vecOldest);PYLITH_CHECK_ERROR(err);
+        _predictorSolutions[0] = vecOldest;
+        _predictorTimes[0] = t;
+        _predictorNumSolutions = std::min(_predictorNumSolutions+1, maxSolutions);
+        _predictorStep = tindex;
+    } // if
+
+    // Use lower order extrapolation until enough time steps are available.
+    if (_predictorNumSolutions < 2) {
+        PYLITH_METHOD_END;
+    } // if
+    const size_t numSolutions = _predictorNumSolutions;
+
+    // Lagrange interpolation weights for the solutions evaluated at t+dt. Without ratios of time steps, the time steps
+    // are assumed to be uniform, which gives weights (2, -1) and (3, -3, 1).
+    const PylithReal tGuess = (_predictorUseTimeStepRatio) ? t + dt : 1.0;
+    PylithReal times[3];
+    for (size_t i = 0; i < numSolutions; ++i) {
+        times[i] = (_predictorUseTimeStepRatio) ? _predictorTimes[i] : -PylithReal(i);
+    } // for
+    PetscScalar weights[3];
+    for (size_t i = 0; i < numSolutions; ++i) {
+        weights[i] = 1.0;
+        for (size_t j = 0; j < numSolutions; ++j) {
+            if (i != j) {
+                weights[i] *= (tGuess - times[j]) / (times[i] - times[j]);
+            } // if
+        } // for
+    } // for
+
+    err = VecAXPBY(solutionVec, weights[0], 0.0, _predictorSolutions[0]);PYLITH_CHECK_ERROR(err);
+    err = VecMAXPY(solutionVec, PetscInt(numSolutions-1), &weights[1], &_predictorSolutions[1]);PYLITH_CHECK_ERROR(err);
+    PYLITH_COMPONENT_DEBUG_CALLBACK("Initial guess from extrapolating "<<numSolutions<<" solutions.");
+
+    PYLITH_METHOD_END;
+} // _computeInitialGuess
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Solve for equilibrium at the start time and store it in the reference state of the materials.
+void
+pylith::problems::TimeDependent::_equilibrateReferenceState(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_equilibrateReferenceState()");
+
+    std::vector<pylith::feassemble::IntegratorDomain*> domainIntegrators;
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        pylith::feassemble::IntegratorDomain* integrator = dynamic_cast<pylith::feassemble::IntegratorDomain*>(_integrators[i]);
+        if (!integrator) { continue; }
+        const pylith::topology::Field* auxiliaryField = integrator->getAuxiliaryField();assert(auxiliaryField);
+        if (!auxiliaryField->hasSubfield("reference_stress") || !auxiliaryField->hasSubfield("reference_strain")) {
+            std::ostringstream msg;
+            msg << "Equilibrating the reference state requires all materials to use a reference state "
+                << "(use_reference_state = True). Auxiliary field '" << auxiliaryField->getLabel()
+                << "' does not contain the reference stress and reference strain.";
+            throw std::runtime_error(msg.str());
+        } // if
+        domainIntegrators.push_back(integrator);
+    } // for
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    PetscErrorCode err = 0;
+    _TimeDependent::EquilibriumContext context;
+    context.problem = this;
+    err = TSGetTime(_ts, &context.t);PYLITH_CHECK_ERROR(err);
+    err = TSGetTimeStep(_ts, &context.dt);PYLITH_CHECK_ERROR(err);
+    err = TSGetSolution(_ts, &context.initialVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(context.initialVec, &context.solutionDotVec);PYLITH_CHECK_ERROR(err);
+
+    // Use a copy of the DM, so the nonlinear solver of the time stepper keeps its callbacks.
+    PetscDM dmEquilibrium = NULL;
+    PetscSection solutionSection = NULL;
+    err = DMClone(solution->getDM(), &dmEquilibrium);PYLITH_CHECK_ERROR(err);
+    err = DMCopyDisc(solution->getDM(), dmEquilibrium);PYLITH_CHECK_ERROR(err);
+    err = DMGetLocalSection(solution->getDM(), &solutionSection);PYLITH_CHECK_ERROR(err);
+    err = DMSetLocalSection(dmEquilibrium, solutionSection);PYLITH_CHECK_ERROR(err);
+
+    PetscVec equilibriumVec = NULL, residualVec = NULL;
+    PetscMat jacobianMat = NULL;
+    err = VecDuplicate(context.initialVec, &equilibriumVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(context.initialVec, &residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(context.initialVec, equilibriumVec);PYLITH_CHECK_ERROR(err);
+    err = DMCreateMatrix(dmEquilibrium, &jacobianMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_COMPONENT_INFO_ROOT("Solving for equilibrium to set reference state of materials.");
+    PetscSNES snes = NULL;
+    err = SNESCreate(PetscObjectComm((PetscObject)dmEquilibrium), &snes);PYLITH_CHECK_ERROR(err);
+    err = SNESSetDM(snes, dmEquilibrium);PYLITH_CHECK_ERROR(err);
+    err = SNESSetFunction(snes, residualVec, _TimeDependent::computeEquilibriumResidual, (void*)&context);PYLITH_CHECK_ERROR(err);
+    err = SNESSetJacobian(snes, jacobianMat, jacobianMat, _TimeDependent::computeEquilibriumJacobian, (void*)&context);PYLITH_CHECK_ERROR(err);
+    err = SNESSetFromOptions(snes);PYLITH_CHECK_ERROR(err);
+    err = SNESSolve(snes, NULL, equilibriumVec);PYLITH_CHECK_ERROR(err);
+    SNESConvergedReason reason = SNES_CONVERGED_ITERATING;
+    err = SNESGetConvergedReason(snes, &reason);PYLITH_CHECK_ERROR(err);
+    err = SNESDestroy(&snes);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dmEquilibrium);PYLITH_CHECK_ERROR(err);
+    if (reason < 0) {
+        err = VecDestroy(&equilibriumVec);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&context.solutionDotVec);PYLITH_CHECK_ERROR(err);
+        std::ostringstream msg;
+        msg << "Nonlinear solve of equilibrium for reference state failed to converge (reason " << reason << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // The reference stress is the stress of the equilibrium solution, computed with the current reference state.
+    _TimeDependent::computeEquilibriumSolutionDot(&context, equilibriumVec);
+    setSolutionLocal(context.t, equilibriumVec, context.solutionDotVec);
+    for (size_t i = 0; i < domainIntegrators.size(); ++i) {
+        domainIntegrators[i]->setAuxiliarySubfieldFromDerived("reference_stress", "cauchy_stress", context.t,
+                                                              context.dt, *solution);
+    } // for
+
+    // The reference strain is the strain of the initial solution, so the initial solution has the reference stress.
+    err = VecSet(context.solutionDotVec, 0.0);PYLITH_CHECK_ERROR(err);
+    setSolutionLocal(context.t, context.initialVec, context.solutionDotVec);
+    for (size_t i = 0; i < domainIntegrators.size(); ++i) {
+        domainIntegrators[i]->setAuxiliarySubfieldFromDerived("reference_strain", "cauchy_strain", context.t,
+                                                              context.dt, *solution);
+    } // for
+    err = VecDestroy(&equilibriumVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&context.solutionDotVec);PYLITH_CHECK_ERROR(err);
+
+    // Time stepping starts from scratch with the new reference state.
+    err = VecDestroy(&_linearLoad);PYLITH_CHECK_ERROR(err);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_RESIDUAL, -1.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_DT_JACOBIAN, -1.0);
+    _jacobianShift = 0.0;
+    _needNewLHSJacobian = true;
+    _haveNewLHSJacobian = false;
+    _numJacobians = 0;
+    _localSolutionVecId = 0;
+    _localSolutionDotVecId = 0;
+    _localSolutionVecState = -1;
+    _localSolutionDotVecState = -1;
+    _localSolutionState = -1;
+    _localSolutionDotState = -1;
+
+    PYLITH_METHOD_END;
+} // _equilibrateReferenceState
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Notify observers with solution corresponding to initial conditions.
 void
@@ -899,16 +2744,17 @@ pylith::problems::TimeDependent::_notifyObserversInitialSoln(void) {
     assert(_normalizer);
     const PylithReal timeScale = _normalizer->getTimeScale();
     const PylithReal tStartNondim = _startTime / timeScale;
+    const PylithReal dtInitialNondim = _dtInitial / timeScale;
     const PylithInt tindex = 0;
 
     assert(_integrationData);
-    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
     _observers->notifyObservers(tStartNondim, tindex, *solution);
 
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
         assert(_integrators[i]);
-        _integrators[i]->notifyObservers(tStartNondim, tindex, *solution);
+        _integrators[i]->notifyObserversInitialSoln(tStartNondim, tindex, dtInitialNondim, *solution);
     } // for
 
     const size_t numConstraints = _constraints.size();
@@ -921,4 +2767,100 @@ pylith::problems::TimeDependent::_notifyObserversInitialSoln(void) {
 } // _notifyObserversInitialSoln
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether any problem, integrator, or constraint observer needs an update at the current time step.
+bool
+pylith::problems::TimeDependent::_needsOutputUpdate(const PylithReal t,
+                                                    const PylithInt tindex) const {
+    assert(_observers);
+    if (_observers->needsUpdate(t, tindex)) {
+        return true;
+    } // if
+
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        if (_integrators[i]->needsObserverUpdate(t, tindex)) {
+            return true;
+        } // if
+    } // for
+
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        assert(_constraints[i]);
+        if (_constraints[i]->needsObserverUpdate(t, tindex)) {
+            return true;
+        } // if
+    } // for
+
+    return false;
+} // _needsOutputUpdate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get integrators followed by constraints.
+void
+pylith::problems::TimeDependent::_getImplementations(std::vector<pylith::feassemble::PhysicsImplementation*>* implementations) const {
+    assert(implementations);
+    implementations->assign(_integrators.begin(), _integrators.end());
+    implementations->insert(implementations->end(), _constraints.begin(), _constraints.end());
+} // _getImplementations
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute time derivative of solution relative to initial solution for equilibrium.
+void
+pylith::problems::_TimeDependent::computeEquilibriumSolutionDot(EquilibriumContext* context,
+                                                                PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    assert(context);
+    assert(context->dt > 0.0);
+
+    PetscErrorCode err = VecWAXPY(context->solutionDotVec, -1.0, context->initialVec, solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecScale(context->solutionDotVec, 1.0 / context->dt);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // computeEquilibriumSolutionDot
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback for computing residual in nonlinear solve of equilibrium.
+PetscErrorCode
+pylith::problems::_TimeDependent::computeEquilibriumResidual(PetscSNES snes,
+                                                             PetscVec solutionVec,
+                                                             PetscVec residualVec,
+                                                             void* context) {
+    PYLITH_METHOD_BEGIN;
+    EquilibriumContext* equilibrium = (EquilibriumContext*)context;assert(equilibrium);
+    assert(equilibrium->problem);
+
+    computeEquilibriumSolutionDot(equilibrium, solutionVec);
+    equilibrium->problem->computeLHSResidual(residualVec, equilibrium->t, equilibrium->dt, solutionVec,
+                                             equilibrium->solutionDotVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeEquilibriumResidual
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback for computing Jacobian in nonlinear solve of equilibrium.
+PetscErrorCode
+pylith::problems::_TimeDependent::computeEquilibriumJacobian(PetscSNES snes,
+                                                             PetscVec solutionVec,
+                                                             PetscMat jacobianMat,
+                                                             PetscMat precondMat,
+                                                             void* context) {
+    PYLITH_METHOD_BEGIN;
+    EquilibriumContext* equilibrium = (EquilibriumContext*)context;assert(equilibrium);
+    assert(equilibrium->problem);
+
+    computeEquilibriumSolutionDot(equilibrium, solutionVec);
+    const PylithReal s_tshift = 1.0 / equilibrium->dt;
+    equilibrium->problem->computeLHSJacobian(jacobianMat, precondMat, equilibrium->t, equilibrium->dt, s_tshift,
+                                             solutionVec, equilibrium->solutionDotVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeEquilibriumJacobian
+
+
 // End of file
@@ -28,9 +28,31 @@
 #include "Problem.hh" // ISA Problem
 #include "pylith/testing/testingfwd.hh" // USES MMSTest
 
+#include <mpi.h> // HASA MPI_Comm
+
 class pylith::problems::TimeDependent : public pylith::problems::Problem {
     friend class TestTimeDependent; // unit testing
     friend class pylith::testing::MMSTest; // Testing with Method of Manufactured Solutions
+    friend class TimeDependentTimeStep; // time step control
+    friend class TimeDependentCheckpoint; // checkpoints and restart
+    friend class TimeDependentSteadyState; // steady state
+    friend class TimeDependentLoadCases; // load cases
+    friend class TimeDependentParareal; // parareal iteration
+    friend class TimeDependentGreensFns; // time-dependent Green's functions
+
+    // PUBLIC ENUM /////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    enum PredictorEnum {
+        PREDICTOR_NONE, // Use solution at previous time step.
+        PREDICTOR_LINEAR, // Linear extrapolation from two previous solutions.
+        PREDICTOR_QUADRATIC, // Quadratic extrapolation from three previous solutions.
+    }; // PredictorEnum
+
+    enum TimeSteppingEnum {
+        TIMESTEPPING_BACKWARD_EULER, // Backward Euler (first order).
+        TIMESTEPPING_BDF2, // Second order backward differentiation formula with variable time steps.
+    }; // TimeSteppingEnum
 
     // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
@@ -108,6 +130,416 @@ public:
      */
     void setShouldNotifyIC(const bool value);
 
+    /** Use matrix-free action of the LHS Jacobian with an assembled preconditioner.
+     *
+     * Only used with implicit time stepping.
+     *
+     * @param[in] value True if using matrix-free Jacobian, false otherwise.
+     */
+    void setUseMatrixFreeJacobian(const bool value);
+
+    /** Use matrix-free action of the LHS Jacobian with an assembled preconditioner?
+     *
+     * @returns True if using matrix-free Jacobian, false otherwise.
+     */
+    bool getUseMatrixFreeJacobian(void) const;
+
+    /** Form the residual of linear problems from the stored Jacobian and a cached load vector.
+     *
+     * Only used with the linear solver and quasistatic formulation when materials have linear, time-independent
+     * residuals and constrained values do not depend on time.
+     *
+     * @param[in] value True if using stored Jacobian to form residual, false otherwise.
+     */
+    void setUseLinearFastPath(const bool value);
+
+    /** Form the residual of linear problems from the stored Jacobian and a cached load vector?
+     *
+     * @returns True if using stored Jacobian to form residual, false otherwise.
+     */
+    bool getUseLinearFastPath(void) const;
+
+    /** Use fixed-stress split of poroelasticity instead of monolithic coupling of flow and mechanics.
+     *
+     * The preconditioner alternates a flow solve with the fixed-stress stabilization and a mechanics solve. Only used
+     * with the quasistatic formulation when all materials are poroelastic and the problem has no faults.
+     *
+     * @param[in] value True if using fixed-stress split, false otherwise.
+     */
+    void setUseFixedStressSplit(const bool value);
+
+    /** Use fixed-stress split of poroelasticity instead of monolithic coupling of flow and mechanics?
+     *
+     * @returns True if using fixed-stress split, false otherwise.
+     */
+    bool getUseFixedStressSplit(void) const;
+
+    /** Use pressure mass matrix as the preconditioner for the Schur complement of incompressible elasticity.
+     *
+     * The pressure block of a separate preconditioner matrix is the pressure mass matrix weighted by
+     * 1/shear_modulus + 1/bulk_modulus. Only used with the quasistatic formulation when all materials are
+     * incompressible elastic.
+     *
+     * @param[in] value True if using pressure mass matrix preconditioner, false otherwise.
+     */
+    void setUsePressureMassPreconditioner(const bool value);
+
+    /** Use pressure mass matrix as the preconditioner for the Schur complement of incompressible elasticity?
+     *
+     * @returns True if using pressure mass matrix preconditioner, false otherwise.
+     */
+    bool getUsePressureMassPreconditioner(void) const;
+
+    /** Overlap exchange of ghost values of the solution with assembly of the residual over interior cells.
+     *
+     * Cells without ghost or constrained points in their closure are integrated while the ghost values are exchanged;
+     * the remaining cells, boundary conditions, and faults are integrated after the exchange is complete.
+     *
+     * @param[in] value True if overlapping communication and assembly, false otherwise.
+     */
+    void setUseOverlappedAssembly(const bool value);
+
+    /** Overlap exchange of ghost values of the solution with assembly of the residual over interior cells?
+     *
+     * @returns True if overlapping communication and assembly, false otherwise.
+     */
+    bool getUseOverlappedAssembly(void) const;
+
+    /** Use local time stepping with explicit time stepping.
+     *
+     * Cells with a stable time step smaller than the time step are put in a fast rate group that a multirate
+     * partitioned Runge-Kutta method (PETSc TSMPRK) advances with a fraction of the time step. Only used with the
+     * dynamic formulation.
+     *
+     * @param[in] value True if using local time stepping, false otherwise.
+     */
+    void setUseLocalTimeStepping(const bool value);
+
+    /** Use local time stepping with explicit time stepping?
+     *
+     * @returns True if using local time stepping, false otherwise.
+     */
+    bool getUseLocalTimeStepping(void) const;
+
+    /** Set minimum number of time steps between Jacobian reformations requested by integrators.
+     *
+     * The Jacobian is always reformed when the time step changes. A value of 0 reforms the Jacobian
+     * whenever an integrator requests it.
+     *
+     * @param[in] value Number of time steps.
+     */
+    void setJacobianLagSteps(const size_t value);
+
+    /** Get minimum number of time steps between Jacobian reformations requested by integrators.
+     *
+     * @returns Number of time steps.
+     */
+    size_t getJacobianLagSteps(void) const;
+
+    /** Set number of nonlinear solver iterations in previous time step that triggers reforming a lagged
+     * Jacobian.
+     *
+     * A value of 0 disables this trigger.
+     *
+     * @param[in] value Number of nonlinear solver iterations.
+     */
+    void setJacobianReformIterations(const size_t value);
+
+    /** Get number of nonlinear solver iterations in previous time step that triggers reforming a lagged
+     * Jacobian.
+     *
+     * @returns Number of nonlinear solver iterations.
+     */
+    size_t getJacobianReformIterations(void) const;
+
+    /** Set predictor for initial guess of nonlinear solver in each time step.
+     *
+     * The initial guess is extrapolated in time from the solutions at the most recent time steps. Lower order
+     * extrapolation is used until enough time steps are available. Only used with the quasistatic formulation.
+     *
+     * @param[in] value Predictor for initial guess.
+     */
+    void setPredictor(const PredictorEnum value);
+
+    /** Get predictor for initial guess of nonlinear solver in each time step.
+     *
+     * @returns Predictor for initial guess.
+     */
+    PredictorEnum getPredictor(void) const;
+
+    /** Use ratios of time steps in extrapolation of initial guess.
+     *
+     * If false, the extrapolation assumes a uniform time step.
+     *
+     * @param[in] value True if using ratios of time steps, false otherwise.
+     */
+    void setPredictorUseTimeStepRatio(const bool value);
+
+    /** Use ratios of time steps in extrapolation of initial guess?
+     *
+     * @returns True if using ratios of time steps, false otherwise.
+     */
+    bool getPredictorUseTimeStepRatio(void) const;
+
+    /** Set implicit time stepping method for the quasistatic formulation.
+     *
+     * BDF2 is a single-stage multistep method, so the updates of state variables in the viscoelastic materials, which
+     * use the time step from the beginning to the end of the step, remain consistent. Only used with the quasistatic
+     * formulation.
+     *
+     * @param[in] value Time stepping method.
+     */
+    void setTimeStepping(const TimeSteppingEnum value);
+
+    /** Get implicit time stepping method for the quasistatic formulation.
+     *
+     * @returns Time stepping method.
+     */
+    TimeSteppingEnum getTimeStepping(void) const;
+
+    /** Use local truncation error estimate of the time stepping method to control the time step.
+     *
+     * Requires BDF2 time stepping. Time steps are chosen by the PETSc TSAdapt controller using the tolerances
+     * `ts_rtol` and `ts_atol` and are limited by the maximum time step.
+     *
+     * @param[in] value True if controlling the time step using the error estimate, false otherwise.
+     */
+    void setUseTimeStepErrorControl(const bool value);
+
+    /** Use local truncation error estimate of the time stepping method to control the time step?
+     *
+     * @returns True if controlling the time step using the error estimate, false otherwise.
+     */
+    bool getUseTimeStepErrorControl(void) const;
+
+    /** Set reference state of materials from equilibrium at the start time before time stepping.
+     *
+     * The equilibrium (for example, with gravitational body forces or tectonic boundary conditions) is solved using
+     * the same mesh, integrators, and solver settings. The stress of the equilibrium solution is stored in the
+     * reference stress and the strain of the initial solution is stored in the reference strain of each material, so
+     * that the initial solution is in equilibrium. Requires the quasistatic formulation and all materials to use a
+     * reference state.
+     *
+     * @param[in] value True if equilibrating reference state, false otherwise.
+     */
+    void setEquilibrateReferenceState(const bool value);
+
+    /** Set reference state of materials from equilibrium at the start time before time stepping?
+     *
+     * @returns True if equilibrating reference state, false otherwise.
+     */
+    bool getEquilibrateReferenceState(void) const;
+
+    /** Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution.
+     *
+     * @param[in] value True if adapting time step, false otherwise.
+     */
+    void setAdaptTimeStep(const bool value);
+
+    /** Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution?
+     *
+     * @returns True if adapting time step, false otherwise.
+     */
+    bool getAdaptTimeStep(void) const;
+
+    /** Set maximum time step for adaptive time stepping.
+     *
+     * @param[in] value Maximum time step (dimensional).
+     */
+    void setMaxTimeStep(const double value);
+
+    /** Get maximum time step for adaptive time stepping.
+     *
+     * @returns Maximum time step (dimensional).
+     */
+    double getMaxTimeStep(void) const;
+
+    /** Set factor for geometric growth of time step.
+     *
+     * @param[in] value Ratio of consecutive time steps (>1).
+     */
+    void setTimeStepGrowthFactor(const double value);
+
+    /** Get factor for geometric growth of time step.
+     *
+     * @returns Ratio of consecutive time steps.
+     */
+    double getTimeStepGrowthFactor(void) const;
+
+    /** Set fraction of the minimum Maxwell time limiting the time step during the viscoelastic transient.
+     *
+     * @param[in] value Fraction of minimum Maxwell time.
+     */
+    void setMaxwellTimeFraction(const double value);
+
+    /** Get fraction of the minimum Maxwell time limiting the time step during the viscoelastic transient.
+     *
+     * @returns Fraction of minimum Maxwell time.
+     */
+    double getMaxwellTimeFraction(void) const;
+
+    /** Set tolerance for relative change in solution over a time step.
+     *
+     * @param[in] value Tolerance for relative change in solution.
+     */
+    void setSolutionChangeTolerance(const double value);
+
+    /** Get tolerance for relative change in solution over a time step.
+     *
+     * @returns Tolerance for relative change in solution.
+     */
+    double getSolutionChangeTolerance(void) const;
+
+    /** Use estimate of stable time step for explicit time stepping as the initial time step.
+     *
+     * The stable time step is estimated as the minimum over cells of the distance between vertices divided by the
+     * dilatational wave speed. Only used with the dynamic and dynamic_imex formulations.
+     *
+     * @param[in] value True if using stable time step, false if using initial time step.
+     */
+    void setUseStableTimeStep(const bool value);
+
+    /** Use estimate of stable time step for explicit time stepping as the initial time step?
+     *
+     * @returns True if using stable time step, false if using initial time step.
+     */
+    bool getUseStableTimeStep(void) const;
+
+    /** Set factor applied to estimate of stable time step for explicit time stepping.
+     *
+     * @param[in] value Factor applied to estimate of stable time step.
+     */
+    void setStableTimeStepFactor(const double value);
+
+    /** Get factor applied to estimate of stable time step for explicit time stepping.
+     *
+     * @returns Factor applied to estimate of stable time step.
+     */
+    double getStableTimeStepFactor(void) const;
+
+    /** Set number of time steps between checkpoints.
+     *
+     * A value of 0 disables checkpointing.
+     *
+     * @param[in] value Number of time steps.
+     */
+    void setCheckpointInterval(const size_t value);
+
+    /** Get number of time steps between checkpoints.
+     *
+     * @returns Number of time steps.
+     */
+    size_t getCheckpointInterval(void) const;
+
+    /** Set name of HDF5 file for checkpoints.
+     *
+     * @param[in] value Name of file.
+     */
+    void setCheckpointFilename(const char* value);
+
+    /** Get name of HDF5 file for checkpoints.
+     *
+     * @returns Name of file.
+     */
+    const char* getCheckpointFilename(void) const;
+
+    /** Set threshold for load imbalance in assembly that triggers a checkpoint for repartitioning.
+     *
+     * The load imbalance is the ratio of the maximum to the mean time spent in assembly of the residual and
+     * Jacobian over the processes in a time step. A value of 0 disables monitoring of the load imbalance.
+     *
+     * @param[in] value Threshold for load imbalance (0 or >= 1).
+     */
+    void setLoadImbalanceThreshold(const double value);
+
+    /** Get threshold for load imbalance in assembly that triggers a checkpoint for repartitioning.
+     *
+     * @returns Threshold for load imbalance.
+     */
+    double getLoadImbalanceThreshold(void) const;
+
+    /** Get load imbalance in assembly for most recent time step.
+     *
+     * @returns Ratio of maximum to mean assembly time over processes (0 if not monitored).
+     */
+    double getLoadImbalance(void) const;
+
+    /** Set relative rate of change in solution for steady state.
+     *
+     * The relative rate of change in the solution over a time step is the norm of the change in the solution divided
+     * by the norm of the solution and the time step. Time stepping stops with output at the current time step when
+     * the relative rate of change is at or below this value for a number of consecutive time steps. A value of 0
+     * disables checking for steady state.
+     *
+     * @param[in] value Relative rate of change in solution (1/s, 0=disable).
+     */
+    void setSteadyStateRate(const double value);
+
+    /** Get relative rate of change in solution for steady state.
+     *
+     * @returns Relative rate of change in solution (1/s).
+     */
+    double getSteadyStateRate(void) const;
+
+    /** Set number of consecutive time steps at or below steady state rate for steady state.
+     *
+     * @param[in] value Number of time steps.
+     */
+    void setSteadyStateWindow(const size_t value);
+
+    /** Get number of consecutive time steps at or below steady state rate for steady state.
+     *
+     * @returns Number of time steps.
+     */
+    size_t getSteadyStateWindow(void) const;
+
+    /** Set names of solution subfields checked for steady state.
+     *
+     * Each subfield must satisfy the steady state criterion. The entire solution is checked if no subfields are given.
+     *
+     * @param[in] names Array of subfield names.
+     * @param[in] numNames Length of array.
+     */
+    void setSteadyStateSubfields(const char* names[],
+                                 const int numNames);
+
+    /** Set name of HDF5 checkpoint file used to restart simulation.
+     *
+     * An empty name starts the simulation from the initial conditions.
+     *
+     * @param[in] value Name of file.
+     */
+    void setRestartFilename(const char* value);
+
+    /** Get name of HDF5 checkpoint file used to restart simulation.
+     *
+     * @returns Name of file.
+     */
+    const char* getRestartFilename(void) const;
+
+    /** Use parareal iteration with time slices distributed across groups of processes.
+     *
+     * The interval from the start time to the end time is divided into one time slice per group. Each group solves the
+     * entire spatial problem for its time slice on its own PETSC_COMM_WORLD. The fine propagator uses the initial time
+     * step and the coarse propagator uses the coarse time step, both with the same integrators, time stepper, Jacobian,
+     * and preconditioner. Only the fine propagation after the final iteration writes output.
+     *
+     * @param[in] comm Communicator connecting processes with the same rank in each group; rank is the time slice.
+     * @param[in] coarseTimeStep Time step of coarse propagator (seconds).
+     * @param[in] maxIterations Maximum number of parareal iterations.
+     * @param[in] tolerance Tolerance for relative change in solution at the end of the time slices.
+     */
+    void setParallelInTime(const MPI_Comm& comm,
+                           const double coarseTimeStep,
+                           const size_t maxIterations,
+                           const double tolerance);
+
+    /** Get number of parareal iterations in most recent solve.
+     *
+     * @returns Number of parareal iterations (0 if not using parareal iteration).
+     */
+    size_t getNumPararealIterations(void) const;
+
     /** Set progress monitor.
      *
      * @param[in] monitor Progress monitor for time-dependent simulation.
@@ -138,6 +570,72 @@ public:
     /// Initialize.
     void initialize(void);
 
+    /** Reset problem for another run, reusing the mesh, integrators, Jacobian sparsity, and solver setup.
+     *
+     * Values of the auxiliary fields are recomputed from the spatial databases, the time stepping state is reset to
+     * the start time, and the solution is set from the initial conditions. The Jacobian is recomputed in the first time
+     * step, so only the numeric setup of the preconditioner is redone.
+     */
+    void reinitialize(void);
+
+    /** Add load case to run with multiple load cases sharing the LHS Jacobian and preconditioner.
+     *
+     * The auxiliary fields of the boundary conditions are recomputed from their current spatial databases and stored
+     * along with the auxiliary fields of the other integrators and constraints as the initial state of the load case.
+     * With load cases, solve() advances all of them together with a fixed time step, using one block solve (KSPMatSolve)
+     * per time step. Only linear quasistatic problems are supported.
+     *
+     * @param[in] name Name of load case.
+     * @param[in] bc Array of boundary conditions with spatial databases for the load case.
+     * @param[in] numBC Number of boundary conditions.
+     */
+    void addLoadCase(const char* name,
+                     pylith::bc::BoundaryCondition* bc[],
+                     const int numBC);
+
+    /** Get number of load cases.
+     *
+     * @returns Number of load cases (0 if solving a single problem).
+     */
+    size_t getNumLoadCases(void) const;
+
+    /** Set fault with impulses for time-dependent Green's functions.
+     *
+     * With a fault, solve() advances unit slip for each impulse through the time steps as load cases and computes the
+     * responses to the slip histories by convolution. Only linear quasistatic problems are supported.
+     *
+     * @param[in] labelName Name of label for fault (empty to solve a single problem).
+     * @param[in] labelValue Value of label for fault.
+     */
+    void setImpulseFault(const char* labelName,
+                         const int labelValue);
+
+    /** Set number of impulses advanced together with one block solve per time step.
+     *
+     * @param[in] value Number of impulses.
+     */
+    void setImpulseBatchSize(const size_t value);
+
+    /** Set rank of compressed responses to impulses.
+     *
+     * @param[in] value Rank of spatial basis shared by the responses at all time steps (0=full responses).
+     */
+    void setResponseRank(const size_t value);
+
+    /** Add slip history for prediction with time-dependent Green's functions.
+     *
+     * @param[in] db Spatial database with slip distribution.
+     * @param[in] th Time history of slip amplitude.
+     */
+    void addSlipHistory(spatialdata::spatialdb::SpatialDB* db,
+                        spatialdata::spatialdb::TimeHistory* th);
+
+    /** Get number of impulses for time-dependent Green's functions.
+     *
+     * @returns Number of impulses (0 if solving a single problem).
+     */
+    size_t getNumImpulses(void) const;
+
     /** Solve time dependent problem.
      */
     void solve(void);
@@ -202,6 +700,16 @@ public:
                             PetscVec solutionVec,
                             PetscVec solutionDotVec);
 
+    /* Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector for implicit time stepping.
+     *
+     * Uses the state (time, time step, and solution) from the most recent LHS residual or Jacobian evaluation.
+     *
+     * @param[out] actionVec PETSc Vec with action of Jacobian, J*v.
+     * @param[in] vectorVec PETSc Vec with vector, v.
+     */
+    void computeLHSJacobianAction(PetscVec actionVec,
+                                  PetscVec vectorVec);
+
     /* Compute inverse of lumped LHS Jacobian for F(t,s,\dot{s}) for explicit time stepping.
      *
      * @param[in] t Current time.
@@ -229,6 +737,36 @@ public:
                                       PetscVec residualVec,
                                       void* context);
 
+    /** Callback static method for computing RHS residual, G(t,s), for slow rate group of local time stepping.
+     *
+     * @param[in] ts PETSc time stepper for slow rate group.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec for solution.
+     * @param[out] residualvec PETSc Vec for residual of slow rate group.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeRHSResidualSlow(PetscTS ts,
+                                          PetscReal t,
+                                          PetscVec solutionVec,
+                                          PetscVec residualVec,
+                                          void* context);
+
+    /** Callback static method for computing RHS residual, G(t,s), for fast rate group of local time stepping.
+     *
+     * @param[in] ts PETSc time stepper for fast rate group.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec for solution.
+     * @param[out] residualvec PETSc Vec for residual of fast rate group.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeRHSResidualFast(PetscTS ts,
+                                          PetscReal t,
+                                          PetscVec solutionVec,
+                                          PetscVec residualVec,
+                                          void* context);
+
     /** Callback static method for computing residual for LHS, F(t,s,\dot{s}).
      *
      * @param[in] ts PETSc time stepper.
@@ -265,20 +803,44 @@ public:
                                       PetscMat precondMat,
                                       void* context);
 
+    /* Callback static method for computing action of LHS Jacobian (MatMult for PETSc shell matrix).
+     *
+     * @param[in] jacobianMat PETSc shell matrix with TimeDependent as context.
+     * @param[in] vectorVec PetscVec with vector, v.
+     * @param[out] actionVec PetscVec with action of Jacobian, J*v.
+     */
+    static
+    PetscErrorCode computeLHSJacobianAction(PetscMat jacobianMat,
+                                            PetscVec vectorVec,
+                                            PetscVec actionVec);
+
     /** Callback static method for operations after advancing solution one time step.
      */
     static
     PetscErrorCode poststep(PetscTS ts);
 
+    /** Callback static method for computing initial guess of nonlinear solver using predictor.
+     *
+     * @param[in] snes PETSc nonlinear solver.
+     * @param[inout] solutionVec PetscVec with initial guess.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeInitialGuess(PetscSNES snes,
+                                       PetscVec solutionVec,
+                                       void* context);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
     /** Check whether we need to reform the Jacobian.
      *
      * @param[in] dt Current time step.
+     * @param[in] s_tshift Scale for time derivative.
      * @returns True if we need to reform the Jacobian, false otherwise.
      */
-    bool _needNewJacobian(const PylithReal dt);
+    bool _needNewJacobian(const PylithReal dt,
+                          const PylithReal s_tshift);
 
     /** Set state (auxiliary field values) of system for time t.
      *
@@ -289,6 +851,134 @@ private:
     /// Notify observers with solution corresponding to initial conditions.
     void _notifyObserversInitialSoln(void);
 
+    /// Set LHS Jacobian to matrix-free shell matrix with assembled preconditioner.
+    void _setMatrixFreeJacobian(void);
+
+    /// Set up materials for fixed-stress split of poroelasticity.
+    void _setupFixedStressSplit(void);
+
+    /// Set up materials for pressure mass matrix preconditioner of incompressible elasticity.
+    void _setupPressureMassPreconditioner(void);
+
+    /// Set LHS Jacobian and preconditioner to separate assembled matrices.
+    void _setPreconditionerMatrix(void);
+
+    /** Check whether the local solution is current.
+     *
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] solutionDotVec PETSc Vec with time derivative of current trial solution.
+     *
+     * @returns True if the global vectors and local vectors are unchanged since the most recent update at time t.
+     */
+    bool _isSolutionLocalCurrent(const PylithReal t,
+                                 PetscVec solutionVec,
+                                 PetscVec solutionDotVec) const;
+
+    /** Start scattering solution and its time derivative to local vectors.
+     *
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] solutionDotVec PETSc Vec with time derivative of current trial solution.
+     */
+    void _setSolutionLocalBegin(PetscVec solutionVec,
+                                PetscVec solutionDotVec);
+
+    /** Finish scattering solution and its time derivative to local vectors and insert constrained values.
+     *
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] solutionDotVec PETSc Vec with time derivative of current trial solution.
+     */
+    void _setSolutionLocalEnd(const PylithReal t,
+                              PetscVec solutionVec,
+                              PetscVec solutionDotVec);
+
+    /** Check whether the residual can be formed from the stored Jacobian and a cached load vector.
+     *
+     * @returns True if problem is linear with time-independent materials and constraints, false otherwise.
+     */
+    bool _canUseLinearFastPath(void) const;
+
+    /** Compute LHS residual for linear problem from stored Jacobian: F(t,s) = J*s + b + b_t(t).
+     *
+     * The load vector b from integrators with time-independent residuals is computed once with zero solution and
+     * cached. Only integrators with time-dependent residuals (boundary conditions and faults) are evaluated, with zero
+     * solution, to get b_t(t).
+     *
+     * @param[out] residualVec PETSc Vec for residual.
+     * @param[in] t Current time.
+     * @param[in] jacobianMat LHS Jacobian.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] solutionDotVec PETSc Vec with time derivative of current trial solution.
+     */
+    void _computeLHSResidualLinear(PetscVec residualVec,
+                                   const PylithReal t,
+                                   PetscMat jacobianMat,
+                                   PetscVec solutionVec,
+                                   PetscVec solutionDotVec);
+
+    /** Compute RHS residual, G(t,s), and assemble into global vector.
+     *
+     * @param[out] residualVec PETSc Vec for residual.
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] fastOnly True if only computing residual at degrees of freedom in fast rate group.
+     */
+    void _computeRHSResidual(PetscVec residualVec,
+                             const PetscReal t,
+                             const PetscReal dt,
+                             PetscVec solutionVec,
+                             const bool fastOnly);
+
+    /** Compute RHS residual, G(t,s), for a rate group of local time stepping.
+     *
+     * @param[out] residualVec PETSc Vec for residual of rate group.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] splitName Name of rate group ('slow' or 'fast').
+     */
+    void _computeRHSResidualSplit(PetscVec residualVec,
+                                  const PetscReal t,
+                                  PetscVec solutionVec,
+                                  const char* splitName);
+
+    /** Set up rate groups for local time stepping.
+     *
+     * Cells with a stable time step smaller than the initial time step go in the fast rate group along with the
+     * degrees of freedom in their closure; all other degrees of freedom go in the slow rate group.
+     *
+     * @param[out] dtStableMin Minimum nondimensional stable time step over all cells.
+     * @returns True if the fast rate group contains cells, false otherwise.
+     */
+    bool _setupLocalTimeStepping(PylithReal* dtStableMin);
+
+    /// Solve for equilibrium at the start time and store it in the reference state of the materials.
+    void _equilibrateReferenceState(void);
+
+    /** Compute initial guess of nonlinear solver by extrapolating solutions at previous time steps.
+     *
+     * @param[inout] solutionVec PETSc Vec with initial guess.
+     */
+    void _computeInitialGuess(PetscVec solutionVec);
+
+    /** Check whether any problem, integrator, or constraint observer needs an update at the current time step.
+     *
+     * When no observer writes output at this time step, scattering the solution to the output vector is skipped.
+     *
+     * @param[in] t Current time (nondimensional).
+     * @param[in] tindex Current time step index.
+     * @returns True if at least one observer needs update, false otherwise.
+     */
+    bool _needsOutputUpdate(const PylithReal t,
+                            const PylithInt tindex) const;
+
+    /** Get integrators followed by constraints.
+     *
+     * @param[out] implementations Integrators followed by constraints.
+     */
+    void _getImplementations(std::vector<pylith::feassemble::PhysicsImplementation*>* implementations) const;
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -303,6 +993,47 @@ private:
     bool _needNewLHSJacobian; ///< True if need to recompute LHS Jacobian.
     bool _haveNewLHSJacobian; ///< True if LHS Jacobian was reformed.
     bool _shouldNotifyIC;
+    bool _useMatrixFreeJacobian; ///< True if using matrix-free action of LHS Jacobian.
+    bool _useLinearFastPath; ///< True if forming residual of linear problem from stored Jacobian.
+    bool _useFixedStressSplit; ///< True if using fixed-stress split of poroelasticity.
+    bool _usePressureMassPreconditioner; ///< True if using pressure mass matrix preconditioner.
+    PetscVec _linearLoad; ///< Cached load vector from integrators with time-independent residuals.
+    PetscVec _linearZero; ///< Zero solution used to compute load vectors.
+    bool _useOverlappedAssembly; ///< True if overlapping exchange of ghost values with residual assembly.
+    bool _useLocalTimeStepping; ///< True if using local time stepping with explicit time stepping.
+    PetscVec _rhsResidualSplit; ///< Global RHS residual used to compute residual of rate groups.
+    PylithReal _localSolutionTime; ///< Time of most recent update of local solution.
+    PetscObjectId _localSolutionVecId; ///< Id of global solution vector of most recent update of local solution.
+    PetscObjectId _localSolutionDotVecId; ///< Id of global solution_dot vector of most recent update of local solution.
+    PetscObjectState _localSolutionVecState; ///< State of global solution vector at most recent update.
+    PetscObjectState _localSolutionDotVecState; ///< State of global solution_dot vector at most recent update.
+    PetscObjectState _localSolutionState; ///< State of local solution vector after most recent update.
+    PetscObjectState _localSolutionDotState; ///< State of local solution_dot vector after most recent update.
+    size_t _jacobianLagSteps; ///< Minimum number of time steps between Jacobian reformations.
+    size_t _jacobianReformIterations; ///< Nonlinear solver iterations that trigger new Jacobian.
+    PylithInt _jacobianStep; ///< Time step of most recent Jacobian reformation.
+    PylithReal _jacobianShift; ///< Scale for time derivative (s_tshift) of most recent Jacobian reformation.
+    PylithInt _solverIterationsPrevious; ///< Number of nonlinear solver iterations in previous time step.
+    size_t _numJacobians; ///< Number of Jacobian reformations.
+    size_t _numSolverIterations; ///< Total number of nonlinear solver iterations.
+
+    PredictorEnum _predictor; ///< Predictor for initial guess of nonlinear solver.
+    bool _predictorUseTimeStepRatio; ///< True if using ratios of time steps in predictor.
+    PetscVec _predictorSolutions[3]; ///< Solutions at most recent time steps (most recent first).
+    PylithReal _predictorTimes[3]; ///< Times of solutions used in predictor.
+    size_t _predictorNumSolutions; ///< Number of solutions available for predictor.
+    PylithInt _predictorStep; ///< Time step index of most recent update of solutions for predictor.
+
+    TimeSteppingEnum _timeStepping; ///< Implicit time stepping method for quasistatic formulation.
+    bool _useTimeStepErrorControl; ///< True if controlling time step using local truncation error estimate.
+    bool _shouldEquilibrate; ///< True if setting reference state from equilibrium before time stepping.
+
+    pylith::problems::TimeDependentTimeStep* _timeStep; ///< Time step control.
+    pylith::problems::TimeDependentCheckpoint* _checkpoint; ///< Checkpoints and restart.
+    pylith::problems::TimeDependentSteadyState* _steadyState; ///< Stopping time stepping at steady state.
+    pylith::problems::TimeDependentLoadCases* _loadCases; ///< Load cases sharing LHS Jacobian and preconditioner.
+    pylith::problems::TimeDependentParareal* _parareal; ///< Parareal iteration over time slices.
+    pylith::problems::TimeDependentGreensFns* _greensFns; ///< Time-dependent Green's functions.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -0,0 +1,577 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TimeDependentCheckpoint.hh" // implementation of class methods
+
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "petscts.h" // USES PetscTS
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include <cassert> // USES assert()
+#include <cstdio> // USES std::rename()
+#include <cstring> // USES strlen()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class _TimeDependentCheckpoint {
+public:
+
+            /** Create DM for mapping global vector of field to natural (original) ordering.
+             *
+             * @param[out] dmNatural PETSc DM with natural SF.
+             * @param[in] field Field associated with vector.
+             * @param[in] sfMigration PETSc SF from original mesh to distributed mesh.
+             */
+            static
+            void createNaturalDM(PetscDM* dmNatural,
+                                 const pylith::topology::Field& field,
+                                 PetscSF sfMigration);
+
+            /** Write global vector of field to checkpoint in natural ordering.
+             *
+             * @param[in] viewer HDF5 viewer for checkpoint.
+             * @param[in] field Field associated with vector.
+             * @param[in] globalVector Global vector with values of field.
+             * @param[in] name Name of dataset.
+             * @param[in] sfMigration PETSc SF from original mesh to distributed mesh (NULL if not distributed).
+             */
+            static
+            void viewVector(PetscViewer viewer,
+                            const pylith::topology::Field& field,
+                            PetscVec globalVector,
+                            const char* name,
+                            PetscSF sfMigration);
+
+            /** Read global vector of field from checkpoint in natural ordering.
+             *
+             * @param[in] viewer HDF5 viewer for checkpoint.
+             * @param[in] field Field associated with vector.
+             * @param[out] globalVector Global vector for values of field.
+             * @param[in] name Name of dataset.
+             * @param[in] sfMigration PETSc SF from original mesh to distributed mesh (NULL if not distributed).
+             */
+            static
+            void loadVector(PetscViewer viewer,
+                            const pylith::topology::Field& field,
+                            PetscVec globalVector,
+                            const char* name,
+                            PetscSF sfMigration);
+
+            /** Get name of checkpoint dataset for auxiliary field of integrator.
+             *
+             * @param[in] integrator Integrator with auxiliary field.
+             * @returns Name of dataset.
+             */
+            static
+            std::string auxiliaryName(const pylith::feassemble::Integrator& integrator);
+
+        }; // _TimeDependentCheckpoint
+    } // problems
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::TimeDependentCheckpoint::TimeDependentCheckpoint(pylith::problems::TimeDependent& problem) :
+    _problem(problem),
+    _checkpointInterval(0),
+    _checkpointFilename("checkpoint.h5"),
+    _restartFilename(""),
+    _loadImbalanceThreshold(0.0),
+    _loadImbalance(0.0),
+    _assemblyTime(0.0),
+    _isLoadImbalanced(false) {
+    PyreComponent::setName("timedependent");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::TimeDependentCheckpoint::~TimeDependentCheckpoint(void) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of time steps between checkpoints.
+void
+pylith::problems::TimeDependentCheckpoint::setCheckpointInterval(const size_t value) {
+    _checkpointInterval = value;
+} // setCheckpointInterval
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of time steps between checkpoints.
+size_t
+pylith::problems::TimeDependentCheckpoint::getCheckpointInterval(void) const {
+    return _checkpointInterval;
+} // getCheckpointInterval
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of HDF5 file for checkpoints.
+void
+pylith::problems::TimeDependentCheckpoint::setCheckpointFilename(const char* value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!value || (0 == strlen(value))) {
+        throw std::runtime_error("Name of checkpoint file must be non-empty.");
+    } // if
+    _checkpointFilename = value;
+
+    PYLITH_METHOD_END;
+} // setCheckpointFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of HDF5 file for checkpoints.
+const char*
+pylith::problems::TimeDependentCheckpoint::getCheckpointFilename(void) const {
+    return _checkpointFilename.c_str();
+} // getCheckpointFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set threshold for load imbalance in assembly that triggers a checkpoint for repartitioning.
+void
+pylith::problems::TimeDependentCheckpoint::setLoadImbalanceThreshold(const double value) {
+    PYLITH_COMPONENT_DEBUG("setLoadImbalanceThreshold(value="<<value<<")");
+
+    if ((value != 0.0) && (value < 1.0)) {
+        std::ostringstream msg;
+        msg << "Threshold for load imbalance (" << value << ") must be 0 (disable) or greater than or equal to 1.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _loadImbalanceThreshold = value;
+} // setLoadImbalanceThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get threshold for load imbalance in assembly that triggers a checkpoint for repartitioning.
+double
+pylith::problems::TimeDependentCheckpoint::getLoadImbalanceThreshold(void) const {
+    return _loadImbalanceThreshold;
+} // getLoadImbalanceThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get load imbalance in assembly for most recent time step.
+double
+pylith::problems::TimeDependentCheckpoint::getLoadImbalance(void) const {
+    return _loadImbalance;
+} // getLoadImbalance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of HDF5 checkpoint file used to restart simulation.
+void
+pylith::problems::TimeDependentCheckpoint::setRestartFilename(const char* value) {
+    _restartFilename = (value) ? value : "";
+} // setRestartFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of HDF5 checkpoint file used to restart simulation.
+const char*
+pylith::problems::TimeDependentCheckpoint::getRestartFilename(void) const {
+    return _restartFilename.c_str();
+} // getRestartFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Are checkpoints written or read?
+bool
+pylith::problems::TimeDependentCheckpoint::isEnabled(void) const {
+    return (_checkpointInterval > 0) || (_loadImbalanceThreshold > 0.0) || !_restartFilename.empty();
+} // isEnabled
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Is the simulation restarted from a checkpoint?
+bool
+pylith::problems::TimeDependentCheckpoint::isRestart(void) const {
+    return !_restartFilename.empty();
+} // isRestart
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Reset state for another run.
+void
+pylith::problems::TimeDependentCheckpoint::reinitialize(void) {
+    _assemblyTime = 0.0;
+    _isLoadImbalanced = false;
+} // reinitialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add time spent in assembly on this process in the current time step.
+void
+pylith::problems::TimeDependentCheckpoint::addAssemblyTime(const PetscLogDouble value) {
+    _assemblyTime += value;
+} // addAssemblyTime
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write checkpoints at the checkpoint interval and check the load imbalance after a time step.
+void
+pylith::problems::TimeDependentCheckpoint::poststep(const PylithReal t,
+                                                    const PylithInt tindex,
+                                                    PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("poststep(t="<<t<<", tindex="<<tindex<<", solutionVec="<<solutionVec<<")");
+
+    // Time step may have been adapted.
+    PylithReal dt = 0.0;
+    PetscErrorCode err = TSGetTimeStep(_problem._ts, &dt);PYLITH_CHECK_ERROR(err);
+
+    if ((_checkpointInterval > 0) && (0 == size_t(tindex) % _checkpointInterval)) {
+        write(t, dt, tindex, solutionVec);
+    } // if
+
+    if (_loadImbalanceThreshold > 0.0) {
+        _checkLoadBalance(t, dt, tindex, solutionVec);
+    } // if
+
+    PYLITH_METHOD_END;
+} // poststep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write checkpoint with solution, time derivative of solution, auxiliary fields, and time stepping state.
+void
+pylith::problems::TimeDependentCheckpoint::write(const PylithReal t,
+                                                 const PylithReal dt,
+                                                 const PylithInt tindex,
+                                                 PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("write(t="<<t<<", dt="<<dt<<", tindex="<<tindex<<")");
+
+    assert(_problem._integrationData);
+    pylith::topology::Field* solution = _problem._integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    pylith::topology::Field* solutionDot = _problem._integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);assert(solutionDot);
+    const pylith::topology::Mesh& mesh = solution->getMesh();
+
+    PetscErrorCode err;
+    PetscSF sfMigration = NULL;
+    err = DMPlexGetMigrationSF(mesh.getDM(), &sfMigration);PYLITH_CHECK_ERROR(err);
+    PetscMPIInt numProcs = 0;
+    err = MPI_Comm_size(mesh.getComm(), &numProcs);PYLITH_CHECK_ERROR(err);
+    const PetscInt isNatural = (sfMigration || 1 == numProcs) ? 1 : 0;
+
+    // Write to temporary file and replace checkpoint after it is complete, so that an interrupted write does not
+    // destroy the previous checkpoint.
+    const std::string filenameTmp = _checkpointFilename + ".tmp";
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(mesh.getComm(), filenameTmp.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PushGroup(viewer, "/checkpoint");PYLITH_CHECK_ERROR(err);
+
+    _TimeDependentCheckpoint::viewVector(viewer, *solution, solutionVec, "solution", sfMigration);
+
+    PetscVec solutionDotVec = NULL;
+    err = DMGetGlobalVector(solutionDot->getDM(), &solutionDotVec);PYLITH_CHECK_ERROR(err);
+    solutionDot->scatterLocalToVector(solutionDotVec);
+    _TimeDependentCheckpoint::viewVector(viewer, *solutionDot, solutionDotVec, "solution_dot", sfMigration);
+    err = DMRestoreGlobalVector(solutionDot->getDM(), &solutionDotVec);PYLITH_CHECK_ERROR(err);
+
+    // Auxiliary fields (including state variables) of integrators over the domain.
+    const size_t numIntegrators = _problem._integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_problem._integrators[i]);
+        const pylith::topology::Field* auxiliaryField = _problem._integrators[i]->getAuxiliaryField();
+        if (!auxiliaryField || (auxiliaryField->getMesh().getDM() != mesh.getDM())) {
+            continue;
+        } // if
+        PetscDM dmAux = auxiliaryField->getDM();
+        PetscVec auxiliaryVec = NULL;
+        err = DMGetGlobalVector(dmAux, &auxiliaryVec);PYLITH_CHECK_ERROR(err);
+        err = DMLocalToGlobalBegin(dmAux, auxiliaryField->getLocalVector(), INSERT_VALUES, auxiliaryVec);PYLITH_CHECK_ERROR(err);
+        err = DMLocalToGlobalEnd(dmAux, auxiliaryField->getLocalVector(), INSERT_VALUES, auxiliaryVec);PYLITH_CHECK_ERROR(err);
+        const std::string name = _TimeDependentCheckpoint::auxiliaryName(*_problem._integrators[i]);
+        _TimeDependentCheckpoint::viewVector(viewer, *auxiliaryField, auxiliaryVec, name.c_str(), sfMigration);
+        err = DMRestoreGlobalVector(dmAux, &auxiliaryVec);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    const PetscInt numProcsValue = numProcs;
+    err = PetscViewerHDF5WriteAttribute(viewer, NULL, "time", PETSC_REAL, &t);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5WriteAttribute(viewer, NULL, "dt", PETSC_REAL, &dt);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5WriteAttribute(viewer, NULL, "time_step", PETSC_INT, &tindex);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5WriteAttribute(viewer, NULL, "num_processes", PETSC_INT, &numProcsValue);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5WriteAttribute(viewer, NULL, "natural_ordering", PETSC_INT, &isNatural);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    err = MPI_Barrier(mesh.getComm());PYLITH_CHECK_ERROR(err);
+    if (0 == mesh.getCommRank()) {
+        if (std::rename(filenameTmp.c_str(), _checkpointFilename.c_str())) {
+            std::ostringstream msg;
+            msg << "Could not rename temporary checkpoint file '" << filenameTmp << "' to '" << _checkpointFilename << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
+    PYLITH_METHOD_END;
+} // write
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Restore solution, time derivative of solution, auxiliary fields, and time stepping state from checkpoint.
+void
+pylith::problems::TimeDependentCheckpoint::read(PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("read(solutionVec="<<solutionVec<<")");
+
+    assert(_problem._integrationData);
+    pylith::topology::Field* solution = _problem._integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    pylith::topology::Field* solutionDot = _problem._integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION_DOT);assert(solutionDot);
+    const pylith::topology::Mesh& mesh = solution->getMesh();
+
+    PetscErrorCode err;
+    PetscSF sfMigration = NULL;
+    err = DMPlexGetMigrationSF(mesh.getDM(), &sfMigration);PYLITH_CHECK_ERROR(err);
+    PetscMPIInt numProcs = 0;
+    err = MPI_Comm_size(mesh.getComm(), &numProcs);PYLITH_CHECK_ERROR(err);
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(mesh.getComm(), _restartFilename.c_str(), FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5PushGroup(viewer, "/checkpoint");PYLITH_CHECK_ERROR(err);
+
+    PylithReal t = 0.0, dt = 0.0;
+    PetscInt tindex = 0, numProcsCheckpoint = 0, isNatural = 0;
+    err = PetscViewerHDF5ReadAttribute(viewer, NULL, "time", PETSC_REAL, NULL, &t);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5ReadAttribute(viewer, NULL, "dt", PETSC_REAL, NULL, &dt);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5ReadAttribute(viewer, NULL, "time_step", PETSC_INT, NULL, &tindex);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5ReadAttribute(viewer, NULL, "num_processes", PETSC_INT, NULL, &numProcsCheckpoint);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5ReadAttribute(viewer, NULL, "natural_ordering", PETSC_INT, NULL, &isNatural);PYLITH_CHECK_ERROR(err);
+    const bool canReadNatural = sfMigration || 1 == numProcs;
+    if ((!isNatural || !canReadNatural) && (numProcsCheckpoint != numProcs)) {
+        std::ostringstream msg;
+        msg << "Checkpoint '" << _restartFilename << "' was written with " << numProcsCheckpoint << " processes without the "
+            << "natural ordering of the mesh. Restart with " << numProcsCheckpoint << " processes (current number of "
+            << "processes is " << numProcs << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (!isNatural || !canReadNatural) {
+        sfMigration = NULL;
+    } // if
+
+    _TimeDependentCheckpoint::loadVector(viewer, *solution, solutionVec, "solution", sfMigration);
+    solution->scatterVectorToLocal(solutionVec);
+
+    PetscVec solutionDotVec = NULL;
+    err = DMGetGlobalVector(solutionDot->getDM(), &solutionDotVec);PYLITH_CHECK_ERROR(err);
+    _TimeDependentCheckpoint::loadVector(viewer, *solutionDot, solutionDotVec, "solution_dot", sfMigration);
+    solutionDot->scatterVectorToLocal(solutionDotVec);
+    err = DMRestoreGlobalVector(solutionDot->getDM(), &solutionDotVec);PYLITH_CHECK_ERROR(err);
+
+    const size_t numIntegrators = _problem._integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_problem._integrators[i]);
+        const pylith::topology::Field* auxiliaryField = _problem._integrators[i]->getAuxiliaryField();
+        if (!auxiliaryField || (auxiliaryField->getMesh().getDM() != mesh.getDM())) {
+            continue;
+        } // if
+        PetscDM dmAux = auxiliaryField->getDM();
+        PetscVec auxiliaryVec = NULL;
+        err = DMGetGlobalVector(dmAux, &auxiliaryVec);PYLITH_CHECK_ERROR(err);
+        const std::string name = _TimeDependentCheckpoint::auxiliaryName(*_problem._integrators[i]);
+        _TimeDependentCheckpoint::loadVector(viewer, *auxiliaryField, auxiliaryVec, name.c_str(), sfMigration);
+        err = DMGlobalToLocalBegin(dmAux, auxiliaryVec, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+        err = DMGlobalToLocalEnd(dmAux, auxiliaryVec, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+        err = DMRestoreGlobalVector(dmAux, &auxiliaryVec);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    err = TSSetTime(_problem._ts, t);PYLITH_CHECK_ERROR(err);
+    err = TSSetTimeStep(_problem._ts, dt);PYLITH_CHECK_ERROR(err);
+    err = TSSetStepNumber(_problem._ts, tindex);PYLITH_CHECK_ERROR(err);
+
+    pythia::journal::info_t info(pylith::utils::PyreComponent::getName());
+    if (0 == mesh.getCommRank()) {
+        assert(_problem._normalizer);
+        const PylithReal timeScale = _problem._normalizer->getTimeScale();
+        info << pythia::journal::at(__HERE__)
+             << "Restarting from checkpoint '" << _restartFilename << "' at time step " << tindex
+             << " (t=" << t*timeScale << " s)." << pythia::journal::endl;
+    } // if
+
+    PYLITH_METHOD_END;
+} // read
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check load imbalance in assembly over the current time step.
+void
+pylith::problems::TimeDependentCheckpoint::_checkLoadBalance(const PylithReal t,
+                                                             const PylithReal dt,
+                                                             const PylithInt tindex,
+                                                             PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("_checkLoadBalance(t="<<t<<", dt="<<dt<<", tindex="<<tindex<<", solutionVec="<<solutionVec<<")");
+
+    assert(_loadImbalanceThreshold > 0.0);
+
+    PetscErrorCode err = 0;
+    MPI_Comm comm = PetscObjectComm((PetscObject) solutionVec);
+    PetscMPIInt commSize = 1;
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+    double assemblyTimeMax = _assemblyTime;
+    double assemblyTimeSum = _assemblyTime;
+    err = MPI_Allreduce(MPI_IN_PLACE, &assemblyTimeMax, 1, MPI_DOUBLE, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(MPI_IN_PLACE, &assemblyTimeSum, 1, MPI_DOUBLE, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    _assemblyTime = 0.0;
+
+    const double assemblyTimeMean = assemblyTimeSum / commSize;
+    _loadImbalance = (assemblyTimeMean > 0.0) ? assemblyTimeMax / assemblyTimeMean : 1.0;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("Load imbalance in assembly for time step " << tindex << ": " << _loadImbalance);
+
+    if (_loadImbalance <= _loadImbalanceThreshold) {
+        _isLoadImbalanced = false;
+        PYLITH_METHOD_END;
+    } // if
+    if (_isLoadImbalanced) {
+        PYLITH_METHOD_END;
+    } // if
+    _isLoadImbalanced = true;
+
+    PYLITH_COMPONENT_WARNING("Load imbalance in assembly (" << _loadImbalance << ") exceeds threshold ("
+                             << _loadImbalanceThreshold << ") in time step " << tindex << ". Writing checkpoint '"
+                             << _checkpointFilename << "'; restart from the checkpoint to repartition the mesh.");
+    write(t, dt, tindex, solutionVec);
+
+    PYLITH_METHOD_END;
+} // _checkLoadBalance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create DM for mapping global vector of field to natural (original) ordering.
+void
+pylith::problems::_TimeDependentCheckpoint::createNaturalDM(PetscDM* dmNatural,
+                                                            const pylith::topology::Field& field,
+                                                            PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+    assert(dmNatural);
+    assert(sfMigration);
+
+    PetscErrorCode err;
+    PetscSF sfNatural = NULL;
+    err = DMClone(field.getDM(), dmNatural);PYLITH_CHECK_ERROR(err);
+    err = DMSetLocalSection(*dmNatural, field.getLocalSection());PYLITH_CHECK_ERROR(err);
+    err = DMSetUseNatural(*dmNatural, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    err = DMPlexCreateGlobalToNaturalSF(*dmNatural, field.getLocalSection(), sfMigration, &sfNatural);PYLITH_CHECK_ERROR(err);
+    err = DMSetNaturalSF(*dmNatural, sfNatural);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&sfNatural);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // createNaturalDM
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write global vector of field to checkpoint in natural ordering.
+void
+pylith::problems::_TimeDependentCheckpoint::viewVector(PetscViewer viewer,
+                                                       const pylith::topology::Field& field,
+                                                       PetscVec globalVector,
+                                                       const char* name,
+                                                       PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+
+    // Vector without a DM, so PETSc writes a plain dataset.
+    PetscErrorCode err;
+    PetscVec naturalVector = NULL;
+    PetscDM dmNatural = NULL;
+    if (sfMigration) {
+        createNaturalDM(&dmNatural, field, sfMigration);
+        err = DMPlexCreateNaturalVector(dmNatural, &naturalVector);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGlobalToNaturalBegin(dmNatural, globalVector, naturalVector);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGlobalToNaturalEnd(dmNatural, globalVector, naturalVector);PYLITH_CHECK_ERROR(err);
+    } else {
+        PetscInt localSize = 0;
+        err = VecGetLocalSize(globalVector, &localSize);PYLITH_CHECK_ERROR(err);
+        err = VecCreateMPI(PetscObjectComm((PetscObject)globalVector), localSize, PETSC_DETERMINE, &naturalVector);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(globalVector, naturalVector);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    err = PetscObjectSetName((PetscObject)naturalVector, name);PYLITH_CHECK_ERROR(err);
+    err = VecView(naturalVector, viewer);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&naturalVector);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dmNatural);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // viewVector
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read global vector of field from checkpoint in natural ordering.
+void
+pylith::problems::_TimeDependentCheckpoint::loadVector(PetscViewer viewer,
+                                                       const pylith::topology::Field& field,
+                                                       PetscVec globalVector,
+                                                       const char* name,
+                                                       PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err;
+    PetscVec naturalVector = NULL;
+    PetscDM dmNatural = NULL;
+    if (sfMigration) {
+        createNaturalDM(&dmNatural, field, sfMigration);
+        err = DMPlexCreateNaturalVector(dmNatural, &naturalVector);PYLITH_CHECK_ERROR(err);
+    } else {
+        PetscInt localSize = 0;
+        err = VecGetLocalSize(globalVector, &localSize);PYLITH_CHECK_ERROR(err);
+        err = VecCreateMPI(PetscObjectComm((PetscObject)globalVector), localSize, PETSC_DETERMINE, &naturalVector);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    err = PetscObjectSetName((PetscObject)naturalVector, name);PYLITH_CHECK_ERROR(err);
+    err = VecLoad(naturalVector, viewer);PYLITH_CHECK_ERROR(err);
+    if (sfMigration) {
+        err = DMPlexNaturalToGlobalBegin(dmNatural, naturalVector, globalVector);PYLITH_CHECK_ERROR(err);
+        err = DMPlexNaturalToGlobalEnd(dmNatural, naturalVector, globalVector);PYLITH_CHECK_ERROR(err);
+    } else {
+        err = VecCopy(naturalVector, globalVector);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    err = VecDestroy(&naturalVector);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dmNatural);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // loadVector
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of checkpoint dataset for auxiliary field of integrator.
+std::string
+pylith::problems::_TimeDependentCheckpoint::auxiliaryName(const pylith::feassemble::Integrator& integrator) {
+    std::ostringstream name;
+    name << "auxiliary_" << integrator.getPhysicsLabelName() << "_" << integrator.getPhysicsLabelValue();
+    return name.str();
+} // auxiliaryName
+
+
+// End of file
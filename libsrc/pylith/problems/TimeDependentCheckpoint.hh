@@ -0,0 +1,206 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/TimeDependentCheckpoint.hh
+ *
+ * @brief Checkpoints and restart of a time dependent problem.
+ *
+ * Checkpoints hold the solution, time derivative of the solution, auxiliary fields (including state variables) of the
+ * integrators over the domain, and the time stepping state. A checkpoint is also written when the load imbalance in
+ * assembly exceeds a threshold, so the simulation can be restarted with a new partition of the mesh.
+ */
+
+#if !defined(pylith_problems_timedependentcheckpoint_hh)
+#define pylith_problems_timedependentcheckpoint_hh
+
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+
+#include "pylith/utils/petscfwd.h" // USES PetscVec
+#include "pylith/utils/types.hh" // USES PylithReal
+
+#include "petscsys.h" // HASA PetscLogDouble
+
+#include <string> // HASA std::string
+
+class pylith::problems::TimeDependentCheckpoint : public pylith::utils::PyreComponent {
+    friend class TestTimeDependent; // unit testing
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Constructor
+     *
+     * @param[in] problem Time dependent problem.
+     */
+    TimeDependentCheckpoint(pylith::problems::TimeDependent& problem);
+
+    /// Destructor
+    ~TimeDependentCheckpoint(void);
+
+    /** Set number of time steps between checkpoints.
+     *
+     * @param[in] value Number of time steps (0=no checkpoints).
+     */
+    void setCheckpointInterval(const size_t value);
+
+    /** Get number of time steps between checkpoints.
+     *
+     * @returns Number of time steps.
+     */
+    size_t getCheckpointInterval(void) const;
+
+    /** Set name of HDF5 file for checkpoints.
+     *
+     * @param[in] value Name of file.
+     */
+    void setCheckpointFilename(const char* value);
+
+    /** Get name of HDF5 file for checkpoints.
+     *
+     * @returns Name of file.
+     */
+    const char* getCheckpointFilename(void) const;
+
+    /** Set threshold for load imbalance in assembly that triggers a checkpoint for repartitioning.
+     *
+     * @param[in] value Threshold for load imbalance (0 or >= 1).
+     */
+    void setLoadImbalanceThreshold(const double value);
+
+    /** Get threshold for load imbalance in assembly that triggers a checkpoint for repartitioning.
+     *
+     * @returns Threshold for load imbalance.
+     */
+    double getLoadImbalanceThreshold(void) const;
+
+    /** Get load imbalance in assembly for most recent time step.
+     *
+     * @returns Ratio of maximum to mean time spent in assembly over the processes.
+     */
+    double getLoadImbalance(void) const;
+
+    /** Set name of HDF5 checkpoint file used to restart simulation.
+     *
+     * @param[in] value Name of file (empty for no restart).
+     */
+    void setRestartFilename(const char* value);
+
+    /** Get name of HDF5 checkpoint file used to restart simulation.
+     *
+     * @returns Name of file.
+     */
+    const char* getRestartFilename(void) const;
+
+    /** Are checkpoints written or read?
+     *
+     * @returns True if writing checkpoints, monitoring load imbalance, or restarting; false otherwise.
+     */
+    bool isEnabled(void) const;
+
+    /** Is the simulation restarted from a checkpoint?
+     *
+     * @returns True if restarting from a checkpoint, false otherwise.
+     */
+    bool isRestart(void) const;
+
+    /// Reset state for another run.
+    void reinitialize(void);
+
+    /** Add time spent in assembly on this process in the current time step.
+     *
+     * @param[in] value Time spent in assembly (seconds).
+     */
+    void addAssemblyTime(const PetscLogDouble value);
+
+    /** Write checkpoints at the checkpoint interval and check the load imbalance after a time step.
+     *
+     * @param[in] t Current time (nondimensional).
+     * @param[in] tindex Current time step index.
+     * @param[in] solutionVec PETSc Vec with solution at current time.
+     */
+    void poststep(const PylithReal t,
+                  const PylithInt tindex,
+                  PetscVec solutionVec);
+
+    /** Write checkpoint with solution, time derivative of solution, auxiliary fields, and time stepping state.
+     *
+     * Vectors are written in the natural (original) ordering of the mesh when it is available, so the simulation
+     * can be restarted with a different number of processes.
+     *
+     * @param[in] t Current time (nondimensional).
+     * @param[in] dt Current time step (nondimensional).
+     * @param[in] tindex Current time step index.
+     * @param[in] solutionVec PETSc Vec with solution at current time.
+     */
+    void write(const PylithReal t,
+               const PylithReal dt,
+               const PylithInt tindex,
+               PetscVec solutionVec);
+
+    /** Restore solution, time derivative of solution, auxiliary fields, and time stepping state from checkpoint.
+     *
+     * @param[out] solutionVec PETSc Vec for solution.
+     */
+    void read(PetscVec solutionVec);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Check load imbalance in assembly over the current time step.
+     *
+     * When the load imbalance exceeds the threshold, write a checkpoint (once until the load imbalance drops below
+     * the threshold) so the simulation can be restarted with a new partition of the mesh.
+     *
+     * @param[in] t Current time (nondimensional).
+     * @param[in] dt Current time step (nondimensional).
+     * @param[in] tindex Current time step index.
+     * @param[in] solutionVec PETSc Vec with solution at current time.
+     */
+    void _checkLoadBalance(const PylithReal t,
+                           const PylithReal dt,
+                           const PylithInt tindex,
+                           PetscVec solutionVec);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::problems::TimeDependent& _problem; ///< Time dependent problem.
+
+    size_t _checkpointInterval; ///< Number of time steps between checkpoints (0=no checkpoints).
+    std::string _checkpointFilename; ///< Name of HDF5 file for checkpoints.
+    std::string _restartFilename; ///< Name of HDF5 checkpoint file for restart.
+
+    double _loadImbalanceThreshold; ///< Load imbalance in assembly that triggers a checkpoint (0=disable).
+    double _loadImbalance; ///< Load imbalance in assembly in most recent time step.
+    PetscLogDouble _assemblyTime; ///< Time spent in assembly on this process in current time step.
+    bool _isLoadImbalanced; ///< True if load imbalance exceeded threshold in previous check.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    TimeDependentCheckpoint(const TimeDependentCheckpoint&); ///< Not implemented
+    const TimeDependentCheckpoint& operator=(const TimeDependentCheckpoint&); ///< Not implemented
+
+}; // TimeDependentCheckpoint
+
+#endif // pylith_problems_timedependentcheckpoint_hh
+
+// End of file
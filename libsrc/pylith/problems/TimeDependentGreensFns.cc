@@ -0,0 +1,701 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TimeDependentGreensFns.hh" // implementation of class methods
+
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/problems/TimeDependentTimeStep.hh" // USES TimeDependentTimeStep
+#include "pylith/problems/TimeDependentCheckpoint.hh" // USES TimeDependentCheckpoint
+#include "pylith/problems/TimeDependentLoadCases.hh" // USES TimeDependentLoadCases
+#include "pylith/problems/TimeDependentParareal.hh" // USES TimeDependentParareal
+#include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/faults/FaultCohesiveImpulses.hh" // USES FaultCohesiveImpulses
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
+#include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
+
+#include "petscts.h" // USES PetscTS
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include <algorithm> // USES std::min()
+#include <cassert> // USES assert()
+#include <cmath> // USES sqrt()
+#include <cstring> // USES strlen()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::TimeDependentGreensFns::TimeDependentGreensFns(pylith::problems::TimeDependent& problem) :
+    _problem(problem),
+    _faultLabelValue(100),
+    _impulseBatchSize(1),
+    _responseRank(0),
+    _faultImpulses(NULL),
+    _integratorImpulses(NULL),
+    _responseBasis(NULL) {
+    PyreComponent::setName("timedependent");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::TimeDependentGreensFns::~TimeDependentGreensFns(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::TimeDependentGreensFns::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _faultImpulses = NULL; // Memory handle in Python. :TODO: Use shared pointer.
+    _integratorImpulses = NULL; // Memory handle in Problem. :TODO: Use shared pointer.
+    _slipDBs.clear(); // Memory handle in Python. :TODO: Use shared pointer.
+    _slipTimeHistories.clear(); // Memory handle in Python. :TODO: Use shared pointer.
+
+    for (size_t i = 0; i < _responses.size(); ++i) {
+        PetscErrorCode err = MatDestroy(&_responses[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _responses.clear();
+    PetscErrorCode err = MatDestroy(&_responseBasis);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::release(this);
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set fault with impulses for time-dependent Green's functions.
+void
+pylith::problems::TimeDependentGreensFns::setImpulseFault(const char* labelName,
+                                                          const int labelValue) {
+    PYLITH_COMPONENT_DEBUG("setImpulseFault(labelName="<<labelName<<", labelValue="<<labelValue<<")");
+
+    _faultLabelName = labelName ? labelName : "";
+    _faultLabelValue = labelValue;
+} // setImpulseFault
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of label for fault with impulses.
+const char*
+pylith::problems::TimeDependentGreensFns::getImpulseFaultLabelName(void) const {
+    return _faultLabelName.c_str();
+} // getImpulseFaultLabelName
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get value of label for fault with impulses.
+int
+pylith::problems::TimeDependentGreensFns::getImpulseFaultLabelValue(void) const {
+    return _faultLabelValue;
+} // getImpulseFaultLabelValue
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of impulses advanced together with one block solve per time step.
+void
+pylith::problems::TimeDependentGreensFns::setImpulseBatchSize(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setImpulseBatchSize(value="<<value<<")");
+
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Number of impulses advanced together (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _impulseBatchSize = value;
+} // setImpulseBatchSize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of impulses advanced together with one block solve per time step.
+size_t
+pylith::problems::TimeDependentGreensFns::getImpulseBatchSize(void) const {
+    return _impulseBatchSize;
+} // getImpulseBatchSize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set rank of compressed responses.
+void
+pylith::problems::TimeDependentGreensFns::setResponseRank(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setResponseRank(value="<<value<<")");
+
+    _responseRank = value;
+} // setResponseRank
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get rank of compressed responses.
+size_t
+pylith::problems::TimeDependentGreensFns::getResponseRank(void) const {
+    return _responseRank;
+} // getResponseRank
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add slip history for prediction by convolution with the responses to the impulses.
+void
+pylith::problems::TimeDependentGreensFns::addSlipHistory(spatialdata::spatialdb::SpatialDB* db,
+                                                         spatialdata::spatialdb::TimeHistory* th) {
+    PYLITH_COMPONENT_DEBUG("addSlipHistory(db="<<db<<", th="<<th<<")");
+
+    if (!db) {
+        throw std::runtime_error("Missing spatial database for slip distribution of slip history.");
+    } // if
+    if (!th) {
+        throw std::runtime_error("Missing time history for slip history.");
+    } // if
+
+    _slipDBs.push_back(db); // :KLUDGE: :TODO: Use shared pointer.
+    _slipTimeHistories.push_back(th); // :KLUDGE: :TODO: Use shared pointer.
+} // addSlipHistory
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Are time-dependent Green's functions computed?
+bool
+pylith::problems::TimeDependentGreensFns::isEnabled(void) const {
+    return !_faultLabelName.empty();
+} // isEnabled
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of impulses.
+size_t
+pylith::problems::TimeDependentGreensFns::getNumImpulses(void) const {
+    return _impulseProc.size();
+} // getNumImpulses
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify configuration of problem is compatible with time-dependent Green's functions.
+void
+pylith::problems::TimeDependentGreensFns::verifyConfiguration(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    if (!isEnabled()) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Superposition of the responses requires a linear problem with the same fixed time steps for every impulse.
+    assert(_problem._timeStep);
+    assert(_problem._checkpoint);
+    assert(_problem._parareal);
+    const char* feature = NULL;
+    if ((pylith::problems::Problem::LINEAR != _problem._solverType)
+        || (pylith::problems::Physics::QUASISTATIC != _problem._formulation)) {
+        feature = "the nonlinear solver or the dynamic formulations";
+    } else if (_problem._timeStep->getAdaptTimeStep() || _problem._useTimeStepErrorControl
+               || (pylith::problems::TimeDependent::TIMESTEPPING_BACKWARD_EULER != _problem._timeStepping)) {
+        feature = "time stepping other than backward Euler with a fixed time step";
+    } else if (_problem._checkpoint->isEnabled()) {
+        feature = "checkpoints";
+    } else if (_problem._parareal->isEnabled()) {
+        feature = "parareal iteration";
+    } // if
+    if (feature) {
+        std::ostringstream msg;
+        msg << "Time-dependent Green's functions do not support " << feature << ".";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    bool hasFault = false;
+    for (size_t i = 0; i < _problem._interfaces.size(); ++i) {
+        assert(_problem._interfaces[i]);
+        if ((_faultLabelName == std::string(_problem._interfaces[i]->getSurfaceLabelName())) &&
+            (_faultLabelValue == _problem._interfaces[i]->getSurfaceLabelValue())) {
+            if (!dynamic_cast<pylith::faults::FaultCohesiveImpulses*>(_problem._interfaces[i])) {
+                std::ostringstream msg;
+                msg << "Found fault with "<<_faultLabelName<<"="<<_faultLabelValue
+                    <<" in interfaces for imposing impulses, but type is not FaultCohesiveImpulses.";
+                throw std::runtime_error(msg.str());
+            } // if
+            hasFault = true;
+            break;
+        } // if
+    } // for
+    if (!hasFault) {
+        std::ostringstream msg;
+        msg << "Could not find fault with "<<_faultLabelName<<"="<<_faultLabelValue<<" in interfaces for imposing impulses.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Find fault with impulses and create schedule of impulses.
+void
+pylith::problems::TimeDependentGreensFns::initialize(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("initialize()");
+
+    if (!isEnabled()) {
+        PYLITH_METHOD_END;
+    } // if
+
+    _faultImpulses = NULL;
+    for (size_t i = 0; i < _problem._interfaces.size(); ++i) {
+        if ((_faultLabelName == std::string(_problem._interfaces[i]->getSurfaceLabelName())) &&
+            (_faultLabelValue == _problem._interfaces[i]->getSurfaceLabelValue())) {
+            _faultImpulses = dynamic_cast<pylith::faults::FaultCohesiveImpulses*>(_problem._interfaces[i]);
+        } // if
+    } // for
+    assert(_faultImpulses);
+    if (_faultImpulses->hasImpulsePatches() && !_slipDBs.empty()) {
+        throw std::runtime_error("Predictions for slip histories require impulses at points rather than over patches.");
+    } // if
+
+    _integratorImpulses = NULL;
+    for (size_t i = 0; i < _problem._integrators.size(); ++i) {
+        assert(_problem._integrators[i]);
+        if (_problem._integrators[i]->getPhysics() == _faultImpulses) {
+            _integratorImpulses = _problem._integrators[i];
+            break;
+        } // if
+    } // for
+    if (!_integratorImpulses) {
+        std::ostringstream msg;
+        msg << "Could not find integrator for fault with "<<_faultLabelName<<"="<<_faultLabelValue<<" for imposing impulses.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Every process contributes to each patch impulse; otherwise impulses are contiguous by process.
+    const size_t numImpulsesLocal = _faultImpulses->getNumImpulsesLocal();
+    _impulseProc.clear();
+    _impulseLocal.clear();
+    if (_faultImpulses->hasImpulsePatches()) {
+        _impulseProc.resize(numImpulsesLocal, -1);
+        _impulseLocal.resize(numImpulsesLocal);
+        for (size_t iImpulse = 0; iImpulse < numImpulsesLocal; ++iImpulse) {
+            _impulseLocal[iImpulse] = iImpulse;
+        } // for
+    } else {
+        PetscErrorCode err = 0;
+        int mpiNumProcs = 0;
+        MPI_Comm comm = PetscObjectComm((PetscObject)_problem.getPetscDM());
+        err = MPI_Comm_size(comm, &mpiNumProcs);PYLITH_CHECK_ERROR(err);
+        int_array numImpulses(mpiNumProcs);
+        const int numImpulsesLocalInt = numImpulsesLocal;
+        err = MPI_Allgather(&numImpulsesLocalInt, 1, MPI_INT, &numImpulses[0], 1, MPI_INT, comm);PYLITH_CHECK_ERROR(err);
+        for (int iProc = 0; iProc < mpiNumProcs; ++iProc) {
+            for (int iImpulseLocal = 0; iImpulseLocal < numImpulses[iProc]; ++iImpulseLocal) {
+                _impulseProc.push_back(iProc);
+                _impulseLocal.push_back(iImpulseLocal);
+            } // for
+        } // for
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute responses to impulses and predictions for slip histories.
+void
+pylith::problems::TimeDependentGreensFns::solve(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("solve()");
+
+    assert(_faultImpulses);
+    assert(_problem._loadCases);
+    assert(_problem._parareal);
+    if (_problem._loadCases->isEnabled()) {
+        throw std::runtime_error("Time-dependent Green's functions cannot be combined with load cases.");
+    } // if
+
+    // Every impulse starts from the initial state, including the initial values of the state variables.
+    std::vector<PetscVec> initialState;
+    _problem._parareal->getTimeSliceState(&initialState);
+
+    // Responses are only needed for predictions; output of the impulses is suppressed.
+    const bool storeResponses = !_slipDBs.empty();
+    _problem._parareal->_setObserversSuppressOutput(true);
+
+    std::vector<PetscMat> solutions;
+    const size_t numImpulses = _impulseProc.size();
+    for (size_t iStart = 0; iStart < numImpulses; iStart += _impulseBatchSize) {
+        const size_t numBatch = std::min(_impulseBatchSize, numImpulses - iStart);
+        PYLITH_COMPONENT_INFO_ROOT("Computing time-dependent Green's functions " << iStart+1 << "-" << iStart+numBatch
+                                                                                << " of " << numImpulses << ".");
+
+        // Load cases start from the auxiliary fields of the first load case, so we add them all before setting the
+        // slip of each impulse.
+        _problem._parareal->setTimeSliceState(initialState);
+        for (size_t iBatch = 0; iBatch < numBatch; ++iBatch) {
+            std::ostringstream name;
+            name << "impulse_" << iStart + iBatch;
+            _problem._loadCases->addLoadCase(name.str().c_str(), NULL, 0);
+        } // for
+        for (size_t iBatch = 0; iBatch < numBatch; ++iBatch) {
+            _problem._loadCases->setLoadCase(iBatch);
+            _setImpulse(iStart + iBatch);
+            _problem._loadCases->storeLoadCase(iBatch);
+        } // for
+
+        _problem._loadCases->solve(storeResponses ? &solutions : NULL);
+        if (storeResponses) {
+            _storeResponses(solutions, iStart);
+        } // if
+        for (size_t i = 0; i < solutions.size(); ++i) {
+            PetscErrorCode err = MatDestroy(&solutions[i]);PYLITH_CHECK_ERROR(err);
+        } // for
+        solutions.clear();
+        _problem._loadCases->deallocate();
+    } // for
+
+    _problem._parareal->_setObserversSuppressOutput(false);
+    _problem._parareal->setTimeSliceState(initialState);
+    TimeDependentParareal::destroyTimeSliceState(&initialState);
+
+    if (storeResponses && !_responses.empty()) {
+        if (_responseRank > 0) {
+            _compressResponses();
+        } // if
+        _convolveSlipHistories();
+    } // if
+    _faultImpulses->releaseImpulse();
+
+    PYLITH_METHOD_END;
+} // solve
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set slip for impulse and hold it fixed while stepping.
+void
+pylith::problems::TimeDependentGreensFns::_setImpulse(const size_t impulse) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setImpulse(impulse="<<impulse<<")");
+
+    assert(impulse < _impulseProc.size());
+    assert(_faultImpulses);
+    assert(_integratorImpulses);
+
+    int mpiRank = 0;
+    PetscErrorCode err = MPI_Comm_rank(PetscObjectComm((PetscObject)_problem.getPetscDM()), &mpiRank);PYLITH_CHECK_ERROR(err);
+    const bool hasImpulse = (_impulseProc[impulse] < 0) || (mpiRank == _impulseProc[impulse]);
+    pylith::topology::Field* auxiliaryField = const_cast<pylith::topology::Field*>(_integratorImpulses->getAuxiliaryField());
+    _faultImpulses->holdImpulse(auxiliaryField, hasImpulse ? _impulseLocal[impulse] : -1);
+
+    PYLITH_METHOD_END;
+} // _setImpulse
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Store solutions of a batch of impulses in responses.
+void
+pylith::problems::TimeDependentGreensFns::_storeResponses(const std::vector<PetscMat>& solutions,
+                                                          const size_t impulseStart) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_storeResponses(solutions="<<&solutions<<", impulseStart="<<impulseStart<<")");
+
+    PetscErrorCode err = 0;
+    const size_t numSteps = solutions.size();
+    if (_responses.empty()) {
+        PetscVec solutionVec = NULL;
+        err = TSGetSolution(_problem._ts, &solutionVec);PYLITH_CHECK_ERROR(err);
+        PetscInt numRowsLocal = 0, numRows = 0;
+        err = VecGetLocalSize(solutionVec, &numRowsLocal);PYLITH_CHECK_ERROR(err);
+        err = VecGetSize(solutionVec, &numRows);PYLITH_CHECK_ERROR(err);
+        const PetscInt numImpulses = _impulseProc.size();
+        _responses.resize(numSteps, NULL);
+        for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+            err = MatCreateDense(PetscObjectComm((PetscObject)solutionVec), numRowsLocal, PETSC_DECIDE, numRows, numImpulses,
+                                 NULL, &_responses[iStep]);PYLITH_CHECK_ERROR(err);
+        } // for
+        pylith::utils::MemoryLogger::record(this, "Green's functions", "response matrices",
+                                            size_t(numRowsLocal)*numImpulses*numSteps*sizeof(PetscScalar));
+    } // if
+    assert(_responses.size() == numSteps);
+
+    PetscVec columnVec = NULL, responseVec = NULL;
+    for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+        PetscInt numBatch = 0;
+        err = MatGetSize(solutions[iStep], NULL, &numBatch);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iBatch = 0; iBatch < numBatch; ++iBatch) {
+            err = MatDenseGetColumnVecRead(solutions[iStep], iBatch, &columnVec);PYLITH_CHECK_ERROR(err);
+            err = MatDenseGetColumnVecWrite(_responses[iStep], impulseStart+iBatch, &responseVec);PYLITH_CHECK_ERROR(err);
+            err = VecCopy(columnVec, responseVec);PYLITH_CHECK_ERROR(err);
+            err = MatDenseRestoreColumnVecWrite(_responses[iStep], impulseStart+iBatch, &responseVec);PYLITH_CHECK_ERROR(err);
+            err = MatDenseRestoreColumnVecRead(solutions[iStep], iBatch, &columnVec);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _storeResponses
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compress responses using randomized range finder for a spatial basis shared by all time steps.
+void
+pylith::problems::TimeDependentGreensFns::_compressResponses(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_compressResponses()");
+
+    assert(!_responses.empty());
+    assert(!_responseBasis);
+
+    PetscErrorCode err = 0;
+    const size_t numSteps = _responses.size();
+    PetscInt numRows = 0, numImpulses = 0, numRowsLocal = 0, numImpulsesLocal = 0;
+    err = MatGetSize(_responses[0], &numRows, &numImpulses);PYLITH_CHECK_ERROR(err);
+    err = MatGetLocalSize(_responses[0], &numRowsLocal, &numImpulsesLocal);PYLITH_CHECK_ERROR(err);
+    if (PetscInt(_responseRank) >= std::min(numRows, PetscInt(numImpulses*numSteps))) {
+        PYLITH_COMPONENT_INFO_ROOT("Rank of compressed responses (" << _responseRank << ") is not less than the number of "
+                                                                    << "responses; using full responses.");
+        PYLITH_METHOD_END;
+    } // if
+    const PetscInt rank = _responseRank;
+    MPI_Comm comm = PetscObjectComm((PetscObject)_responses[0]);
+
+    // Sample range of responses at all time steps with random test matrices, Y = sum_n R_n Omega_n.
+    PetscMat omegaMat = NULL;
+    PetscRandom random = NULL;
+    err = MatCreateDense(comm, numImpulsesLocal, PETSC_DECIDE, numImpulses, rank, NULL, &omegaMat);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomCreate(comm, &random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomSetInterval(random, -1.0, 1.0);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomSetFromOptions(random);PYLITH_CHECK_ERROR(err);
+    PetscMat basisMat = NULL, sampleMat = NULL;
+    for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+        err = MatSetRandom(omegaMat, random);PYLITH_CHECK_ERROR(err);
+        if (!basisMat) {
+            err = MatMatMult(_responses[iStep], omegaMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &basisMat);PYLITH_CHECK_ERROR(err);
+        } else {
+            err = MatMatMult(_responses[iStep], omegaMat, sampleMat ? MAT_REUSE_MATRIX : MAT_INITIAL_MATRIX, PETSC_DEFAULT,
+                             &sampleMat);PYLITH_CHECK_ERROR(err);
+            err = MatAXPY(basisMat, 1.0, sampleMat, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+        } // if/else
+    } // for
+    err = MatDestroy(&sampleMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&omegaMat);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomDestroy(&random);PYLITH_CHECK_ERROR(err);
+
+    // Orthonormalize columns of Y using modified Gram-Schmidt to get Q.
+    PetscVec qj = NULL;
+    err = MatCreateVecs(basisMat, NULL, &qj);PYLITH_CHECK_ERROR(err);
+    for (PetscInt j = 0; j < rank; ++j) {
+        PetscVec columnVec = NULL;
+        err = MatDenseGetColumnVecRead(basisMat, j, &columnVec);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(columnVec, qj);PYLITH_CHECK_ERROR(err);
+        err = MatDenseRestoreColumnVecRead(basisMat, j, &columnVec);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < j; ++i) {
+            PetscScalar dot = 0.0;
+            err = MatDenseGetColumnVecRead(basisMat, i, &columnVec);PYLITH_CHECK_ERROR(err);
+            err = VecDot(qj, columnVec, &dot);PYLITH_CHECK_ERROR(err);
+            err = VecAXPY(qj, -dot, columnVec);PYLITH_CHECK_ERROR(err);
+            err = MatDenseRestoreColumnVecRead(basisMat, i, &columnVec);PYLITH_CHECK_ERROR(err);
+        } // for
+        PetscReal norm = 0.0;
+        err = VecNormalize(qj, &norm);PYLITH_CHECK_ERROR(err);
+        if (norm <= 0.0) {
+            err = VecSet(qj, 0.0);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = MatDenseGetColumnVecWrite(basisMat, j, &columnVec);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(qj, columnVec);PYLITH_CHECK_ERROR(err);
+        err = MatDenseRestoreColumnVecWrite(basisMat, j, &columnVec);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecDestroy(&qj);PYLITH_CHECK_ERROR(err);
+
+    // Coefficients B_n = Q^T R_n replace the responses; relative error is ||R - Q B||_F / ||R||_F over all time steps.
+    PylithReal normResponse2 = 0.0, normError2 = 0.0;
+    for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+        PetscMat coefMat = NULL, errorMat = NULL;
+        PetscReal normResponse = 0.0, normError = 0.0;
+        err = MatTransposeMatMult(basisMat, _responses[iStep], MAT_INITIAL_MATRIX, PETSC_DEFAULT, &coefMat);PYLITH_CHECK_ERROR(err);
+        err = MatMatMult(basisMat, coefMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &errorMat);PYLITH_CHECK_ERROR(err);
+        err = MatAXPY(errorMat, -1.0, _responses[iStep], SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+        err = MatNorm(_responses[iStep], NORM_FROBENIUS, &normResponse);PYLITH_CHECK_ERROR(err);
+        err = MatNorm(errorMat, NORM_FROBENIUS, &normError);PYLITH_CHECK_ERROR(err);
+        err = MatDestroy(&errorMat);PYLITH_CHECK_ERROR(err);
+        err = MatDestroy(&_responses[iStep]);PYLITH_CHECK_ERROR(err);
+        _responses[iStep] = coefMat;
+        normResponse2 += normResponse*normResponse;
+        normError2 += normError*normError;
+    } // for
+    _responseBasis = basisMat;
+    pylith::utils::MemoryLogger::record(this, "Green's functions", "response matrices",
+                                        size_t(numRowsLocal+numImpulsesLocal*numSteps)*rank*sizeof(PetscScalar));
+
+    PYLITH_COMPONENT_INFO_ROOT("Compressed responses to " << numImpulses << " impulses at " << numSteps << " time steps to rank "
+                                                          << rank << " with relative error "
+                                                          << (normResponse2 > 0.0 ? sqrt(normError2/normResponse2) : 0.0) << ".");
+
+    PYLITH_METHOD_END;
+} // _compressResponses
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute predictions for slip histories by convolution and notify observers.
+void
+pylith::problems::TimeDependentGreensFns::_convolveSlipHistories(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_convolveSlipHistories()");
+
+    assert(!_responses.empty());
+    assert(_faultImpulses);
+    assert(_integratorImpulses);
+    assert(_problem._normalizer);
+    assert(_problem._integrationData);
+    pylith::topology::Field* solution = _problem._integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+    pylith::topology::Field* faultAuxiliaryField = const_cast<pylith::topology::Field*>(_integratorImpulses->getAuxiliaryField());
+    assert(faultAuxiliaryField);
+
+    PetscErrorCode err = 0;
+    PetscVec initialVec = NULL;
+    err = TSGetSolution(_problem._ts, &initialVec);PYLITH_CHECK_ERROR(err);
+    MPI_Comm comm = PetscObjectComm((PetscObject)initialVec);
+
+    // Amplitudes are in the order of the impulse schedule, in which impulses are contiguous by process.
+    PetscVec amplitudesVec = NULL;
+    err = MatCreateVecs(_responses[0], &amplitudesVec, NULL);PYLITH_CHECK_ERROR(err);
+    PetscInt numImpulsesLocal = _faultImpulses->getNumImpulsesLocal();
+    PetscInt impulseOffset = 0;
+    err = MPI_Exscan(&numImpulsesLocal, &impulseOffset, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    int mpiRank = 0;
+    err = MPI_Comm_rank(comm, &mpiRank);PYLITH_CHECK_ERROR(err);
+    if (!mpiRank) {
+        impulseOffset = 0;
+    } // if
+    pylith::int_array indices(numImpulsesLocal);
+    for (PetscInt i = 0; i < numImpulsesLocal; ++i) {
+        indices[i] = impulseOffset + i;
+    } // for
+
+    // Response of each slip history at each lag, r_j = R_j s, and increments of its amplitude.
+    const size_t numSteps = _responses.size();
+    const size_t numHistories = _slipDBs.size();
+    const PylithReal timeScale = _problem._normalizer->getTimeScale();
+    const PylithReal dt = _problem._dtInitial / timeScale;
+    const PylithReal tStart = _problem._startTime / timeScale;
+    std::vector<PetscVec> lagResponses(numHistories*numSteps, NULL);
+    std::vector<pylith::scalar_array> increments(numHistories);
+    pylith::scalar_array amplitudes;
+    for (size_t iHistory = 0; iHistory < numHistories; ++iHistory) {
+        _faultImpulses->getImpulseAmplitudes(&amplitudes, faultAuxiliaryField, _slipDBs[iHistory]);
+        assert(PetscInt(amplitudes.size()) == numImpulsesLocal);
+        err = VecSet(amplitudesVec, 0.0);PYLITH_CHECK_ERROR(err);
+        if (numImpulsesLocal > 0) {
+            err = VecSetValues(amplitudesVec, numImpulsesLocal, &indices[0], &amplitudes[0], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = VecAssemblyBegin(amplitudesVec);PYLITH_CHECK_ERROR(err);
+        err = VecAssemblyEnd(amplitudesVec);PYLITH_CHECK_ERROR(err);
+
+        for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+            PetscVec* lagVec = &lagResponses[iHistory*numSteps+iStep];
+            err = MatCreateVecs(_responses[iStep], NULL, lagVec);PYLITH_CHECK_ERROR(err);
+            err = MatMult(_responses[iStep], amplitudesVec, *lagVec);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        _computeSlipIncrements(&increments[iHistory], _slipTimeHistories[iHistory], tStart, dt, numSteps, timeScale);
+    } // for
+    err = VecDestroy(&amplitudesVec);PYLITH_CHECK_ERROR(err);
+
+    // u(t_n) = sum_k R_{n-k} ds_k, accumulated in the coefficients of the spatial basis for compressed responses.
+    PetscVec solutionVec = NULL, solutionDotVec = NULL, sumVec = NULL;
+    err = VecDuplicate(initialVec, &solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(initialVec, &solutionDotVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(solutionDotVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(lagResponses[0], &sumVec);PYLITH_CHECK_ERROR(err);
+    assert(_problem._observers);
+    for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+        err = VecSet(sumVec, 0.0);PYLITH_CHECK_ERROR(err);
+        for (size_t iHistory = 0; iHistory < numHistories; ++iHistory) {
+            for (size_t kStep = 0; kStep <= iStep; ++kStep) {
+                const PylithScalar increment = increments[iHistory][kStep];
+                if (increment != 0.0) {
+                    err = VecAXPY(sumVec, increment, lagResponses[iHistory*numSteps+iStep-kStep]);PYLITH_CHECK_ERROR(err);
+                } // if
+            } // for
+        } // for
+        if (_responseBasis) {
+            err = MatMult(_responseBasis, sumVec, solutionVec);PYLITH_CHECK_ERROR(err);
+        } else {
+            err = VecCopy(sumVec, solutionVec);PYLITH_CHECK_ERROR(err);
+        } // if/else
+
+        const PylithReal t = tStart + (iStep+1) * dt;
+        const PylithInt tindex = iStep+1;
+        _problem.setSolutionLocal(t, solutionVec, solutionDotVec);
+        if (_problem._needsOutputUpdate(t, tindex)) {
+            solution->scatterLocalToOutput();
+        } // if
+        _problem._observers->notifyObservers(t, tindex, *solution);
+    } // for
+
+    for (size_t i = 0; i < lagResponses.size(); ++i) {
+        err = VecDestroy(&lagResponses[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecDestroy(&sumVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionDotVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _convolveSlipHistories
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute increments in amplitude of slip time history at time steps.
+void
+pylith::problems::TimeDependentGreensFns::_computeSlipIncrements(pylith::scalar_array* increments,
+                                                                 spatialdata::spatialdb::TimeHistory* th,
+                                                                 const PylithReal tStart,
+                                                                 const PylithReal dt,
+                                                                 const size_t numSteps,
+                                                                 const PylithReal timeScale) {
+    PYLITH_METHOD_BEGIN;
+    assert(increments);
+    assert(th);
+
+    increments->resize(numSteps);
+    th->open();
+    PylithScalar valuePrev = 0.0;
+    for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+        const PylithScalar tDim = (tStart + (iStep+1) * dt) * timeScale;
+        PylithScalar value = 0.0;
+        const int err = th->query(&value, tDim);
+        if (err) {
+            th->close();
+            std::ostringstream msg;
+            msg << "Error querying for time '" << tDim << "' in time history database '" << th->getDescription() << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        (*increments)[iStep] = value - valuePrev;
+        valuePrev = value;
+    } // for
+    th->close();
+
+    PYLITH_METHOD_END;
+} // _computeSlipIncrements
+
+
+// End of file
@@ -0,0 +1,219 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/TimeDependentGreensFns.hh
+ *
+ * @brief Time-dependent Green's functions of a linear time dependent problem.
+ *
+ * The response to each fault slip impulse is the solution at every time step for unit slip held fixed from the start
+ * time, starting from the initial state of the problem. The impulses are advanced as load cases, so viscoelastic state
+ * variables evolve independently for each impulse. Responses to slip histories are computed by convolution of the
+ * slip increments with the stored responses.
+ */
+
+#if !defined(pylith_problems_timedependentgreensfns_hh)
+#define pylith_problems_timedependentgreensfns_hh
+
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+
+#include "pylith/faults/faultsfwd.hh" // HOLDSA FaultCohesiveImpulses
+#include "pylith/feassemble/feassemblefwd.hh" // HOLDSA Integrator
+#include "pylith/utils/array.hh" // HASA int_array
+#include "pylith/utils/petscfwd.h" // HASA PetscMat
+#include "pylith/utils/types.hh" // USES PylithReal
+
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // HOLDSA SpatialDB, TimeHistory
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::problems::TimeDependentGreensFns : public pylith::utils::PyreComponent {
+    friend class TestTimeDependent; // unit testing
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Constructor
+     *
+     * @param[in] problem Time dependent problem.
+     */
+    TimeDependentGreensFns(pylith::problems::TimeDependent& problem);
+
+    /// Destructor
+    ~TimeDependentGreensFns(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set fault with impulses for time-dependent Green's functions.
+     *
+     * @param[in] labelName Name of label for fault (empty to solve a single problem).
+     * @param[in] labelValue Value of label for fault.
+     */
+    void setImpulseFault(const char* labelName,
+                         const int labelValue);
+
+    /** Get name of label for fault with impulses.
+     *
+     * @returns Name of label (empty if solving a single problem).
+     */
+    const char* getImpulseFaultLabelName(void) const;
+
+    /** Get value of label for fault with impulses.
+     *
+     * @returns Value of label.
+     */
+    int getImpulseFaultLabelValue(void) const;
+
+    /** Set number of impulses advanced together with one block solve per time step.
+     *
+     * @param[in] value Number of impulses.
+     */
+    void setImpulseBatchSize(const size_t value);
+
+    /** Get number of impulses advanced together with one block solve per time step.
+     *
+     * @returns Number of impulses.
+     */
+    size_t getImpulseBatchSize(void) const;
+
+    /** Set rank of compressed responses.
+     *
+     * @param[in] value Rank of spatial basis shared by the responses at all time steps (0=full responses).
+     */
+    void setResponseRank(const size_t value);
+
+    /** Get rank of compressed responses.
+     *
+     * @returns Rank of spatial basis shared by the responses at all time steps (0=full responses).
+     */
+    size_t getResponseRank(void) const;
+
+    /** Add slip history for prediction by convolution with the responses to the impulses.
+     *
+     * Slip is the slip distribution in the spatial database scaled by the amplitude in the time history.
+     *
+     * @param[in] db Spatial database with slip distribution.
+     * @param[in] th Time history of slip amplitude.
+     */
+    void addSlipHistory(spatialdata::spatialdb::SpatialDB* db,
+                        spatialdata::spatialdb::TimeHistory* th);
+
+    /** Are time-dependent Green's functions computed?
+     *
+     * @returns True if computing time-dependent Green's functions, false otherwise.
+     */
+    bool isEnabled(void) const;
+
+    /** Get number of impulses.
+     *
+     * @returns Number of impulses over all processes.
+     */
+    size_t getNumImpulses(void) const;
+
+    /// Verify configuration of problem is compatible with time-dependent Green's functions.
+    void verifyConfiguration(void) const;
+
+    /// Find fault with impulses and create schedule of impulses.
+    void initialize(void);
+
+    /** Compute responses to impulses and predictions for slip histories.
+     *
+     * Impulses are advanced in batches as load cases, with output from observers suppressed. Each load case starts
+     * from the initial state of the problem with unit slip for one impulse. Observers of the solution receive the
+     * predictions for the slip histories at each time step.
+     */
+    void solve(void);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Set slip for impulse and hold it fixed while stepping.
+     *
+     * @param[in] impulse Index of impulse in schedule.
+     */
+    void _setImpulse(const size_t impulse);
+
+    /** Store solutions of a batch of impulses in responses.
+     *
+     * @param[in] solutions Solutions of impulses in batch at each time step.
+     * @param[in] impulseStart Index of first impulse in batch.
+     */
+    void _storeResponses(const std::vector<PetscMat>& solutions,
+                         const size_t impulseStart);
+
+    /// Compress responses using randomized range finder for a spatial basis shared by all time steps.
+    void _compressResponses(void);
+
+    /// Compute predictions for slip histories by convolution and notify observers.
+    void _convolveSlipHistories(void);
+
+    /** Compute increments in amplitude of slip time history at time steps.
+     *
+     * Slip before the first time step is zero, consistent with the initial conditions, so the first increment is the
+     * amplitude at the end of the first time step.
+     *
+     * @param[out] increments Increment in amplitude over each time step.
+     * @param[in] th Time history of slip amplitude.
+     * @param[in] tStart Start time (nondimensional).
+     * @param[in] dt Time step (nondimensional).
+     * @param[in] numSteps Number of time steps.
+     * @param[in] timeScale Time scale for dimensionalizing time.
+     */
+    static
+    void _computeSlipIncrements(pylith::scalar_array* increments,
+                                spatialdata::spatialdb::TimeHistory* th,
+                                const PylithReal tStart,
+                                const PylithReal dt,
+                                const size_t numSteps,
+                                const PylithReal timeScale);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::problems::TimeDependent& _problem; ///< Time dependent problem.
+
+    std::string _faultLabelName; ///< Name of label for fault with impulses.
+    int _faultLabelValue; ///< Value of label for fault with impulses.
+    size_t _impulseBatchSize; ///< Number of impulses advanced together.
+    size_t _responseRank; ///< Rank of compressed responses (0=full).
+    std::vector<spatialdata::spatialdb::SpatialDB*> _slipDBs; ///< Slip distributions of slip histories.
+    std::vector<spatialdata::spatialdb::TimeHistory*> _slipTimeHistories; ///< Time histories of slip histories.
+
+    pylith::faults::FaultCohesiveImpulses* _faultImpulses; ///< Fault with impulses.
+    pylith::feassemble::Integrator* _integratorImpulses; ///< Integrator for fault with impulses.
+    pylith::int_array _impulseProc; ///< Process applying each impulse (-1 for all processes).
+    pylith::int_array _impulseLocal; ///< Local index of each impulse on process applying it.
+
+    std::vector<PetscMat> _responses; ///< Responses (or coefficients of compressed responses) at each time step.
+    PetscMat _responseBasis; ///< Spatial basis of compressed responses.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    TimeDependentGreensFns(const TimeDependentGreensFns&); ///< Not implemented
+    const TimeDependentGreensFns& operator=(const TimeDependentGreensFns&); ///< Not implemented
+
+}; // TimeDependentGreensFns
+
+#endif // pylith_problems_timedependentgreensfns_hh
+
+// End of file
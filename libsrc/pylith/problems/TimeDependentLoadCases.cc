@@ -0,0 +1,416 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TimeDependentLoadCases.hh" // implementation of class methods
+
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/problems/TimeDependentTimeStep.hh" // USES TimeDependentTimeStep
+#include "pylith/problems/TimeDependentCheckpoint.hh" // USES TimeDependentCheckpoint
+#include "pylith/problems/TimeDependentParareal.hh" // USES TimeDependentParareal
+#include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/feassemble/Constraint.hh" // USES Constraint
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/bc/BoundaryCondition.hh" // USES BoundaryCondition
+#include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
+#include "pylith/materials/Material.hh" // USES Material
+#include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
+#include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
+#include "pylith/problems/ProgressMonitorTime.hh" // USES ProgressMonitorTime
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "petscts.h" // USES PetscTS
+#include "petsctime.h" // USES PetscTime()
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include <cassert> // USES assert()
+#include <cmath> // USES HUGE_VAL
+#include <cstring> // USES strlen()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::TimeDependentLoadCases::TimeDependentLoadCases(pylith::problems::TimeDependent& problem) :
+    _problem(problem) {
+    PyreComponent::setName("timedependent");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::TimeDependentLoadCases::~TimeDependentLoadCases(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::TimeDependentLoadCases::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    for (size_t i = 0; i < _loadCaseAuxiliary.size(); ++i) {
+        PetscErrorCode err = VecDestroy(&_loadCaseAuxiliary[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _loadCaseAuxiliary.clear();
+    _loadCaseNames.clear();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add load case to run with multiple load cases sharing the LHS Jacobian and preconditioner.
+void
+pylith::problems::TimeDependentLoadCases::addLoadCase(const char* name,
+                                                      pylith::bc::BoundaryCondition* bc[],
+                                                      const int numBC) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("addLoadCase(name="<<name<<", bc="<<bc<<", numBC="<<numBC<<")");
+
+    if (!_problem._ts) {
+        PYLITH_COMPONENT_LOGICERROR("Problem must be initialized before adding load cases.");
+    } // if
+    assert( (!bc && 0 == numBC) || (bc && 0 < numBC) );
+
+    if (!name || !strlen(name)) {
+        throw std::runtime_error("Name of load case must not be empty.");
+    } // if
+    for (size_t i = 0; i < _loadCaseNames.size(); ++i) {
+        if (_loadCaseNames[i] == name) {
+            std::ostringstream msg;
+            msg << "Found duplicate load case '" << name << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // for
+    assert(_problem._parareal);
+    if (_problem._parareal->isEnabled()) {
+        throw std::runtime_error("Load cases cannot be used with parareal iteration.");
+    } // if
+
+    if (_loadCaseNames.empty()) {
+        std::ostringstream msg;
+        if ((pylith::problems::Problem::LINEAR != _problem._solverType)
+            || (pylith::problems::Physics::QUASISTATIC != _problem._formulation)) {
+            msg << "Load cases require the linear solver with the quasistatic formulation.";
+        } else if (_problem._timeStep->getAdaptTimeStep() || _problem._useTimeStepErrorControl
+                   || (pylith::problems::TimeDependent::TIMESTEPPING_BACKWARD_EULER != _problem._timeStepping)) {
+            msg << "Load cases require backward Euler time stepping with a fixed time step.";
+        } else if (_problem._checkpoint->isEnabled()) {
+            msg << "Load cases do not support checkpoints or restarts.";
+        } // if/else
+        if (msg.str().length() > 0) {
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
+    assert(_problem._integrationData);
+    const pylith::topology::Field* solution = _problem._integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    std::vector<pylith::feassemble::PhysicsImplementation*> implementations;
+    _problem._getImplementations(&implementations);
+    const size_t numImplementations = implementations.size();
+    PetscErrorCode err = 0;
+    for (size_t i = 0; i < numImplementations; ++i) {
+        assert(implementations[i]);
+        const pylith::topology::Field* auxiliaryField = implementations[i]->getAuxiliaryField();
+        if (!auxiliaryField) {
+            _loadCaseAuxiliary.push_back(NULL);
+            continue;
+        } // if
+
+        // Start from auxiliary field of first load case, so boundary conditions without spatial databases for this
+        // load case use the values of the first load case.
+        if (_loadCaseNames.size() > 0) {
+            err = VecCopy(_loadCaseAuxiliary[i], auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+        } // if
+        for (int iBC = 0; iBC < numBC; ++iBC) {
+            if (implementations[i]->getPhysics() == bc[iBC]) {
+                implementations[i]->reinitialize(*solution);
+                break;
+            } // if
+        } // for
+
+        PetscVec auxiliaryVec = NULL;
+        err = VecDuplicate(auxiliaryField->getLocalVector(), &auxiliaryVec);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(auxiliaryField->getLocalVector(), auxiliaryVec);PYLITH_CHECK_ERROR(err);
+        _loadCaseAuxiliary.push_back(auxiliaryVec);
+    } // for
+    _loadCaseNames.push_back(name);
+
+    PYLITH_METHOD_END;
+} // addLoadCase
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of load cases.
+size_t
+pylith::problems::TimeDependentLoadCases::getNumLoadCases(void) const {
+    return _loadCaseNames.size();
+} // getNumLoadCases
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Are there load cases?
+bool
+pylith::problems::TimeDependentLoadCases::isEnabled(void) const {
+    return !_loadCaseNames.empty();
+} // isEnabled
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Advance load cases together with a fixed time step using block solves with the LHS Jacobian.
+void
+pylith::problems::TimeDependentLoadCases::solve(std::vector<PetscMat>* solutions) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("solve(solutions="<<solutions<<")");
+
+    assert(_problem._ts);
+    assert(_problem._normalizer);
+    assert(_problem._integrationData);
+    pylith::topology::Field* solution = _problem._integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+    assert(solution);
+
+    const PetscInt numLoadCases = _loadCaseNames.size();
+    const PylithReal timeScale = _problem._normalizer->getTimeScale();
+    const PylithReal dt = _problem._dtInitial / timeScale;
+    const PylithReal tEnd = _problem._endTime / timeScale;
+    PylithReal t = _problem._startTime / timeScale;
+
+    // Solutions of load cases are columns of a dense matrix, starting from the initial conditions.
+    PetscErrorCode err = 0;
+    PetscVec initialVec = NULL;
+    err = TSGetSolution(_problem._ts, &initialVec);PYLITH_CHECK_ERROR(err);
+    PetscInt numRowsLocal = 0, numRows = 0;
+    err = VecGetLocalSize(initialVec, &numRowsLocal);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(initialVec, &numRows);PYLITH_CHECK_ERROR(err);
+    PetscMat solutionMat = NULL, residualMat = NULL, correctionMat = NULL;
+    err = MatCreateDense(PetscObjectComm((PetscObject)initialVec), numRowsLocal, PETSC_DECIDE, numRows, numLoadCases,
+                         NULL, &solutionMat);PYLITH_CHECK_ERROR(err);
+    err = MatDuplicate(solutionMat, MAT_DO_NOT_COPY_VALUES, &residualMat);PYLITH_CHECK_ERROR(err);
+    err = MatDuplicate(solutionMat, MAT_DO_NOT_COPY_VALUES, &correctionMat);PYLITH_CHECK_ERROR(err);
+    PetscVec columnVec = NULL;
+    for (PetscInt iCase = 0; iCase < numLoadCases; ++iCase) {
+        err = MatDenseGetColumnVecWrite(solutionMat, iCase, &columnVec);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(initialVec, columnVec);PYLITH_CHECK_ERROR(err);
+        err = MatDenseRestoreColumnVecWrite(solutionMat, iCase, &columnVec);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Residuals are computed at the solution of the previous time step, so the time derivative is zero.
+    PetscVec solutionVec = NULL, solutionDotVec = NULL, residualVec = NULL;
+    err = VecDuplicate(initialVec, &solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(initialVec, &solutionDotVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(initialVec, &residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(solutionDotVec, 0.0);PYLITH_CHECK_ERROR(err);
+
+    // Use the Jacobian, preconditioner, and linear solver of the time stepper.
+    PetscSNES snes = NULL;
+    PetscKSP ksp = NULL;
+    PetscMat jacobianMat = NULL, precondMat = NULL;
+    err = TSGetSNES(_problem._ts, &snes);PYLITH_CHECK_ERROR(err);
+    err = SNESSetUp(snes);PYLITH_CHECK_ERROR(err);
+    err = TSGetIJacobian(_problem._ts, &jacobianMat, &precondMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    err = SNESGetKSP(snes, &ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(ksp, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
+
+    PylithInt tindex = 0;
+    while (tEnd - t > PETSC_SMALL * dt && size_t(tindex) < _problem._maxTimeSteps) {
+        const PylithReal tNext = t + dt;
+        ++tindex;
+
+        for (PetscInt iCase = 0; iCase < numLoadCases; ++iCase) {
+            setLoadCase(iCase);
+            err = MatDenseGetColumnVecRead(solutionMat, iCase, &columnVec);PYLITH_CHECK_ERROR(err);
+            err = VecCopy(columnVec, solutionVec);PYLITH_CHECK_ERROR(err);
+            err = MatDenseRestoreColumnVecRead(solutionMat, iCase, &columnVec);PYLITH_CHECK_ERROR(err);
+
+            _problem.computeLHSResidual(residualVec, tNext, dt, solutionVec, solutionDotVec);
+            if (!iCase) {
+                // Jacobian does not depend on the load case; it is only reformed when it changes.
+                _problem.computeLHSJacobian(jacobianMat, precondMat, tNext, dt, 1.0 / dt, solutionVec, solutionDotVec);
+            } // if
+            storeLoadCase(iCase); // Keep values of boundary conditions at time tNext.
+
+            err = MatDenseGetColumnVecWrite(residualMat, iCase, &columnVec);PYLITH_CHECK_ERROR(err);
+            err = VecCopy(residualVec, columnVec);PYLITH_CHECK_ERROR(err);
+            err = MatDenseRestoreColumnVecWrite(residualMat, iCase, &columnVec);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        // Solve J*dS = -R for corrections of all load cases at once.
+        err = MatScale(residualMat, -1.0);PYLITH_CHECK_ERROR(err);
+        err = KSPMatSolve(ksp, residualMat, correctionMat);PYLITH_CHECK_ERROR(err);
+        KSPConvergedReason reason = KSP_CONVERGED_ITERATING;
+        err = KSPGetConvergedReason(ksp, &reason);PYLITH_CHECK_ERROR(err);
+        if (reason < 0) {
+            std::ostringstream msg;
+            msg << "Block solve of load cases did not converge at time step " << tindex << " ("
+                << KSPConvergedReasons[reason] << ").";
+            throw std::runtime_error(msg.str());
+        } // if
+        PetscInt numIterations = 0;
+        err = KSPGetIterationNumber(ksp, &numIterations);PYLITH_CHECK_ERROR(err);
+        _problem._numSolverIterations += numIterations;
+        err = MatAXPY(solutionMat, 1.0, correctionMat, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+        if (solutions) {
+            PetscMat stepMat = NULL;
+            err = MatDuplicate(solutionMat, MAT_COPY_VALUES, &stepMat);PYLITH_CHECK_ERROR(err);
+            solutions->push_back(stepMat);
+        } // if
+
+        // Update state variables and notify observers of each load case.
+        PetscLogDouble outputTimeBegin = 0.0;
+        PetscTime(&outputTimeBegin);
+        for (PetscInt iCase = 0; iCase < numLoadCases; ++iCase) {
+            setLoadCase(iCase);
+            err = MatDenseGetColumnVecRead(solutionMat, iCase, &columnVec);PYLITH_CHECK_ERROR(err);
+            err = VecCopy(columnVec, solutionVec);PYLITH_CHECK_ERROR(err);
+            err = MatDenseRestoreColumnVecRead(solutionMat, iCase, &columnVec);PYLITH_CHECK_ERROR(err);
+            _problem.setSolutionLocal(tNext, solutionVec, solutionDotVec);
+            if (_problem._needsOutputUpdate(tNext, tindex)) {
+                solution->scatterLocalToOutput();
+            } // if
+
+            const size_t numIntegrators = _problem._integrators.size();
+            for (size_t i = 0; i < numIntegrators; ++i) {
+                _problem._integrators[i]->poststep(tNext, tindex, dt, *solution);
+            } // for
+            const size_t numConstraints = _problem._constraints.size();
+            for (size_t i = 0; i < numConstraints; ++i) {
+                _problem._constraints[i]->poststep(tNext, tindex, dt, *solution);
+            } // for
+            assert(_problem._observers);
+            _problem._observers->notifyObservers(tNext, tindex, *solution);
+
+            storeLoadCase(iCase);
+        } // for
+        PetscLogDouble outputTimeEnd = 0.0;
+        PetscTime(&outputTimeEnd);
+
+        if (_problem._monitor) {
+            _problem._monitor->setSolverStatistics(_problem._numJacobians, _problem._numSolverIterations);
+            _problem._monitor->update(tNext*timeScale, _problem._startTime, _problem._endTime);
+            _problem._monitor->updateStep(tNext*timeScale, dt*timeScale, tindex, _problem._ts, outputTimeEnd-outputTimeBegin);
+        } // if
+
+        t = tNext;
+    } // while
+    _setObserversLoadCase("", true);
+
+    err = MatDestroy(&solutionMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&residualMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&correctionMat);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionDotVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // solve
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Make load case current by setting auxiliary fields and observers for the load case.
+void
+pylith::problems::TimeDependentLoadCases::setLoadCase(const size_t index) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setLoadCase(index="<<index<<")");
+
+    std::vector<pylith::feassemble::PhysicsImplementation*> implementations;
+    _problem._getImplementations(&implementations);
+    const size_t numImplementations = implementations.size();
+    assert(index < _loadCaseNames.size());
+    assert(_loadCaseAuxiliary.size() == _loadCaseNames.size() * numImplementations);
+
+    PetscErrorCode err = 0;
+    for (size_t i = 0; i < numImplementations; ++i) {
+        PetscVec auxiliaryVec = _loadCaseAuxiliary[index*numImplementations+i];
+        if (auxiliaryVec) {
+            assert(implementations[i]->getAuxiliaryField());
+            err = VecCopy(auxiliaryVec, implementations[i]->getAuxiliaryField()->getLocalVector());PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+
+    // State and cached load vector depend on the auxiliary fields.
+    assert(_problem._integrationData);
+    _problem._integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_T_STATE, -HUGE_VAL);
+    _problem._localSolutionVecId = 0;
+    err = VecDestroy(&_problem._linearLoad);PYLITH_CHECK_ERROR(err);
+
+    _setObserversLoadCase(_loadCaseNames[index].c_str(), 0 == index);
+
+    PYLITH_METHOD_END;
+} // setLoadCase
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Store auxiliary fields (including state variables) of current load case.
+void
+pylith::problems::TimeDependentLoadCases::storeLoadCase(const size_t index) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("storeLoadCase(index="<<index<<")");
+
+    std::vector<pylith::feassemble::PhysicsImplementation*> implementations;
+    _problem._getImplementations(&implementations);
+    const size_t numImplementations = implementations.size();
+    assert(_loadCaseAuxiliary.size() == _loadCaseNames.size() * numImplementations);
+
+    PetscErrorCode err = 0;
+    for (size_t i = 0; i < numImplementations; ++i) {
+        PetscVec auxiliaryVec = _loadCaseAuxiliary[index*numImplementations+i];
+        if (auxiliaryVec) {
+            assert(implementations[i]->getAuxiliaryField());
+            err = VecCopy(implementations[i]->getAuxiliaryField()->getLocalVector(), auxiliaryVec);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // storeLoadCase
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set current load case in observers of solution and physics.
+void
+pylith::problems::TimeDependentLoadCases::_setObserversLoadCase(const char* name,
+                                                                const bool isFirst) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_problem._observers);
+    _problem._observers->setLoadCase(name, isFirst);
+    for (size_t i = 0; i < _problem._materials.size(); ++i) {
+        assert(_problem._materials[i]);
+        if (_problem._materials[i]->getObservers()) { _problem._materials[i]->getObservers()->setLoadCase(name, isFirst); }
+    } // for
+    for (size_t i = 0; i < _problem._bc.size(); ++i) {
+        assert(_problem._bc[i]);
+        if (_problem._bc[i]->getObservers()) { _problem._bc[i]->getObservers()->setLoadCase(name, isFirst); }
+    } // for
+    for (size_t i = 0; i < _problem._interfaces.size(); ++i) {
+        assert(_problem._interfaces[i]);
+        if (_problem._interfaces[i]->getObservers()) { _problem._interfaces[i]->getObservers()->setLoadCase(name, isFirst); }
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setObserversLoadCase
+
+
+// End of file
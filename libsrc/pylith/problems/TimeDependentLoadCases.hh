@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/TimeDependentLoadCases.hh
+ *
+ * @brief Load cases of a time dependent problem sharing the LHS Jacobian and preconditioner.
+ *
+ * Each load case holds the local auxiliary vectors (including state variables) of the integrators and constraints.
+ * The load cases are advanced together with a fixed time step using one block solve (KSPMatSolve) per time step.
+ */
+
+#if !defined(pylith_problems_timedependentloadcases_hh)
+#define pylith_problems_timedependentloadcases_hh
+
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+
+#include "pylith/bc/bcfwd.hh" // USES BoundaryCondition
+#include "pylith/utils/array.hh" // HASA string_vector
+#include "pylith/utils/petscfwd.h" // HASA PetscVec, USES PetscMat
+
+#include <vector> // HASA std::vector
+
+class pylith::problems::TimeDependentLoadCases : public pylith::utils::PyreComponent {
+    friend class TestTimeDependent; // unit testing
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Constructor
+     *
+     * @param[in] problem Time dependent problem.
+     */
+    TimeDependentLoadCases(pylith::problems::TimeDependent& problem);
+
+    /// Destructor
+    ~TimeDependentLoadCases(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Add load case.
+     *
+     * @param[in] name Name of load case.
+     * @param[in] bc Array of boundary conditions with spatial databases for the load case.
+     * @param[in] numBC Number of boundary conditions.
+     */
+    void addLoadCase(const char* name,
+                     pylith::bc::BoundaryCondition* bc[],
+                     const int numBC);
+
+    /** Get number of load cases.
+     *
+     * @returns Number of load cases (0 if solving a single problem).
+     */
+    size_t getNumLoadCases(void) const;
+
+    /** Are there load cases?
+     *
+     * @returns True if solving load cases, false otherwise.
+     */
+    bool isEnabled(void) const;
+
+    /** Advance load cases together with a fixed time step using block solves with the LHS Jacobian.
+     *
+     * At each time step, the residual of each load case is computed at the solution of the previous time step, and
+     * the corrections for all load cases are computed with a single block solve with the LHS Jacobian, which is formed
+     * only when it changes.
+     *
+     * @param[out] solutions Solutions of load cases (one column per load case) at each time step, if not NULL.
+     */
+    void solve(std::vector<PetscMat>* solutions=NULL);
+
+    /** Make load case current by setting auxiliary fields and observers for the load case.
+     *
+     * @param[in] index Index of load case.
+     */
+    void setLoadCase(const size_t index);
+
+    /** Store auxiliary fields (including state variables) of current load case.
+     *
+     * @param[in] index Index of load case.
+     */
+    void storeLoadCase(const size_t index);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Set current load case in observers of solution and physics.
+     *
+     * @param[in] name Name of load case (empty to notify all observers).
+     * @param[in] isFirst True if load case is the first load case.
+     */
+    void _setObserversLoadCase(const char* name,
+                               const bool isFirst);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::problems::TimeDependent& _problem; ///< Time dependent problem.
+
+    pylith::string_vector _loadCaseNames; ///< Names of load cases.
+    std::vector<PetscVec> _loadCaseAuxiliary; ///< Local auxiliary vectors of integrators and constraints for each load case.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    TimeDependentLoadCases(const TimeDependentLoadCases&); ///< Not implemented
+    const TimeDependentLoadCases& operator=(const TimeDependentLoadCases&); ///< Not implemented
+
+}; // TimeDependentLoadCases
+
+#endif // pylith_problems_timedependentloadcases_hh
+
+// End of file
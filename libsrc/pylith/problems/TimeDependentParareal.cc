@@ -0,0 +1,504 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TimeDependentParareal.hh" // implementation of class methods
+
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/problems/TimeDependentTimeStep.hh" // USES TimeDependentTimeStep
+#include "pylith/problems/TimeDependentCheckpoint.hh" // USES TimeDependentCheckpoint
+#include "pylith/problems/TimeDependentSteadyState.hh" // USES TimeDependentSteadyState
+#include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/feassemble/Constraint.hh" // USES Constraint
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/bc/BoundaryCondition.hh" // USES BoundaryCondition
+#include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
+#include "pylith/materials/Material.hh" // USES Material
+#include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
+#include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "petscts.h" // USES PetscTS
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include <algorithm> // USES std::min(), std::max()
+#include <cassert> // USES assert()
+#include <cmath> // USES std::ceil()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::TimeDependentParareal::TimeDependentParareal(pylith::problems::TimeDependent& problem) :
+    _problem(problem),
+    _timeComm(MPI_COMM_NULL),
+    _coarseTimeStep(1.0),
+    _pararealMaxIterations(0),
+    _pararealTolerance(1.0e-6),
+    _numPararealIterations(0),
+    _isPararealIterate(false) {
+    PyreComponent::setName("timedependent");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::TimeDependentParareal::~TimeDependentParareal(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::TimeDependentParareal::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (MPI_COMM_NULL != _timeComm) {
+        int isFinalized = 0;
+        MPI_Finalized(&isFinalized);
+        if (!isFinalized) {
+            PetscErrorCode err = MPI_Comm_free(&_timeComm);PYLITH_CHECK_ERROR(err);
+        } // if
+        _timeComm = MPI_COMM_NULL;
+    } // if
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use parareal iteration with time slices distributed across groups of processes.
+void
+pylith::problems::TimeDependentParareal::setParallelInTime(const MPI_Comm& comm,
+                                                           const double coarseTimeStep,
+                                                           const size_t maxIterations,
+                                                           const double tolerance) {
+    PYLITH_METHOD_BEGIN;
+
+    if (coarseTimeStep <= 0.0) {
+        std::ostringstream msg;
+        msg << "Coarse time step (" << coarseTimeStep << ") for parareal iteration must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (tolerance <= 0.0) {
+        std::ostringstream msg;
+        msg << "Tolerance (" << tolerance << ") for parareal iteration must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PetscErrorCode err = 0;
+    if (MPI_COMM_NULL != _timeComm) {
+        err = MPI_Comm_free(&_timeComm);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = MPI_Comm_dup(comm, &_timeComm);PYLITH_CHECK_ERROR(err);
+    _coarseTimeStep = coarseTimeStep;
+    _pararealMaxIterations = maxIterations;
+    _pararealTolerance = tolerance;
+
+    PYLITH_METHOD_END;
+} // setParallelInTime
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of parareal iterations in most recent solve.
+size_t
+pylith::problems::TimeDependentParareal::getNumPararealIterations(void) const {
+    return _numPararealIterations;
+} // getNumPararealIterations
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Is parareal iteration used?
+bool
+pylith::problems::TimeDependentParareal::isEnabled(void) const {
+    return MPI_COMM_NULL != _timeComm;
+} // isEnabled
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Are iterates of parareal iteration being propagated?
+bool
+pylith::problems::TimeDependentParareal::isIterate(void) const {
+    return _isPararealIterate;
+} // isIterate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify configuration of problem is compatible with parareal iteration.
+void
+pylith::problems::TimeDependentParareal::verifyConfiguration(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    // Parareal iteration requires the same fixed time steps in every iteration and output only from the final one.
+    if (MPI_COMM_NULL != _timeComm) {
+        assert(_problem._timeStep);
+        assert(_problem._steadyState);
+        assert(_problem._checkpoint);
+        const char* feature = NULL;
+        if (pylith::problems::Physics::QUASISTATIC != _problem._formulation) {
+            feature = "the dynamic formulations";
+        } else if (_problem._timeStep->getAdaptTimeStep() || _problem._useTimeStepErrorControl) {
+            feature = "adaptive time stepping";
+        } else if (_problem._steadyState->isEnabled()) {
+            feature = "stopping at steady state";
+        } else if (_problem._checkpoint->isEnabled()) {
+            feature = "checkpoints";
+        } // if
+        if (feature) {
+            std::ostringstream msg;
+            msg << "Parareal iteration does not support " << feature << ".";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Solve with parareal iteration over time slices distributed across groups of processes.
+void
+pylith::problems::TimeDependentParareal::solve(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("solve()");
+
+    assert(_problem._ts);
+    assert(_problem._normalizer);
+    assert(MPI_COMM_NULL != _timeComm);
+
+    PetscErrorCode err = 0;
+    int numSlices = 0, slice = 0;
+    err = MPI_Comm_size(_timeComm, &numSlices);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_rank(_timeComm, &slice);PYLITH_CHECK_ERROR(err);
+
+    // Time slices contain whole fine time steps, so the fine propagation over all time slices matches the sequential
+    // solve, which steps over the end time.
+    const PylithReal timeScale = _problem._normalizer->getTimeScale();
+    const PylithReal dtFine = _problem._dtInitial / timeScale;
+    const PylithReal dtCoarse = _coarseTimeStep / timeScale;
+    const PylithReal tStart = _problem._startTime / timeScale;
+    const PylithInt numSteps = std::max(PylithInt(std::ceil((_problem._endTime - _problem._startTime) / _problem._dtInitial - PETSC_SMALL)), PylithInt(1));
+    if (numSteps < numSlices) {
+        std::ostringstream msg;
+        msg << "Number of time steps (" << numSteps << ") must be at least the number of time slices (" << numSlices
+            << ") for parareal iteration.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (size_t(numSteps) > _problem._maxTimeSteps) {
+        std::ostringstream msg;
+        msg << "Number of time steps (" << numSteps << ") exceeds the maximum number of time steps (" << _problem._maxTimeSteps
+            << ") for parareal iteration.";
+        throw std::runtime_error(msg.str());
+    } // if
+    const PylithInt stepBegin = (slice * numSteps) / numSlices;
+    const PylithInt stepEnd = ((slice+1) * numSteps) / numSlices;
+    const PylithReal tBegin = tStart + stepBegin * dtFine;
+    const PylithReal tEnd = tStart + stepEnd * dtFine;
+    if (!slice) {
+        PYLITH_COMPONENT_INFO_ROOT("Solving with parareal iteration over " << numSlices << " time slices with "
+                                                                           << numSteps << " fine time steps.");
+    } // if
+
+    // Iterates are not written to output.
+    _isPararealIterate = true;
+    _setObserversSuppressOutput(true);
+
+    // Initial state of the time slices from a sequential coarse propagation.
+    std::vector<PetscVec> startState, fineState, coarseState, coarsePrevState, endState;
+    getTimeSliceState(&startState);
+    if (slice > 0) {
+        _recvTimeSliceState(&startState);
+    } // if
+    setTimeSliceState(startState);
+    _propagateTimeSlice(tBegin, tEnd, dtCoarse, stepBegin);
+    getTimeSliceState(&coarsePrevState);
+    getTimeSliceState(&endState);
+    if (slice+1 < numSlices) {
+        _sendTimeSliceState(endState);
+    } // if
+    PetscVec changeVec = NULL;
+    err = VecDuplicate(endState[0], &changeVec);PYLITH_CHECK_ERROR(err);
+
+    // The start of time slice n matches the sequential solution after n iterations, so the fine propagation after
+    // iteration numSlices-1 is the sequential solution.
+    const size_t maxIterations = std::min(_pararealMaxIterations, size_t(numSlices-1));
+    _numPararealIterations = 0;
+    for (size_t iteration = 1; iteration <= maxIterations; ++iteration) {
+        // Fine propagation from previous iterate runs concurrently in all time slices.
+        setTimeSliceState(startState);
+        _propagateTimeSlice(tBegin, tEnd, dtFine, stepBegin);
+        getTimeSliceState(&fineState);
+
+        // Coarse propagation from new iterate is a pipeline over the time slices.
+        if (slice > 0) {
+            _recvTimeSliceState(&startState);
+        } // if
+        setTimeSliceState(startState);
+        _propagateTimeSlice(tBegin, tEnd, dtCoarse, stepBegin);
+        getTimeSliceState(&coarseState);
+
+        // U_{n+1}^k = G(U_n^k) + F(U_n^{k-1}) - G(U_n^{k-1})
+        err = VecCopy(endState[0], changeVec);PYLITH_CHECK_ERROR(err);
+        for (size_t i = 0; i < endState.size(); ++i) {
+            if (endState[i]) {
+                err = VecAXPBYPCZ(endState[i], 1.0, 1.0, 0.0, coarseState[i], fineState[i]);PYLITH_CHECK_ERROR(err);
+                err = VecAXPY(endState[i], -1.0, coarsePrevState[i]);PYLITH_CHECK_ERROR(err);
+            } // if
+        } // for
+        std::swap(coarseState, coarsePrevState);
+        if (slice+1 < numSlices) {
+            _sendTimeSliceState(endState);
+        } // if
+
+        PylithReal changeNorm = 0.0, endNorm = 0.0;
+        err = VecAXPY(changeVec, -1.0, endState[0]);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(changeVec, NORM_2, &changeNorm);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(endState[0], NORM_2, &endNorm);PYLITH_CHECK_ERROR(err);
+        PylithReal change = (endNorm > 0.0) ? changeNorm / endNorm : changeNorm;
+        err = MPI_Allreduce(MPI_IN_PLACE, &change, 1, MPIU_REAL, MPI_MAX, _timeComm);PYLITH_CHECK_ERROR(err);
+        _numPararealIterations = iteration;
+        if (!slice) {
+            PYLITH_COMPONENT_INFO_ROOT("Parareal iteration " << iteration << ": relative change in solution at end of "
+                                                            << "time slices " << change << ".");
+        } // if
+        if (change <= _pararealTolerance) {
+            break;
+        } // if
+    } // for
+
+    // Fine propagation with output from the final iterate.
+    _isPararealIterate = false;
+    _setObserversSuppressOutput(false);
+    setTimeSliceState(startState);
+    _propagateTimeSlice(tBegin, tEnd, dtFine, stepBegin);
+
+    err = VecDestroy(&changeVec);PYLITH_CHECK_ERROR(err);
+    destroyTimeSliceState(&startState);
+    destroyTimeSliceState(&fineState);
+    destroyTimeSliceState(&coarseState);
+    destroyTimeSliceState(&coarsePrevState);
+    destroyTimeSliceState(&endState);
+
+    PYLITH_METHOD_END;
+} // solve
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Advance solution over a time slice from the current state.
+void
+pylith::problems::TimeDependentParareal::_propagateTimeSlice(const PylithReal tBegin,
+                                                             const PylithReal tEnd,
+                                                             const PylithReal dt,
+                                                             const PylithInt stepBegin) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_propagateTimeSlice(tBegin="<<tBegin<<", tEnd="<<tEnd<<", dt="<<dt<<", stepBegin="<<stepBegin<<")");
+
+    // The Jacobian and preconditioner are reused; they are reformed only if they depend on the time step and it changed.
+    assert(_problem._ts);
+    PetscErrorCode err = TSSetTime(_problem._ts, tBegin);PYLITH_CHECK_ERROR(err);
+    err = TSSetStepNumber(_problem._ts, stepBegin);PYLITH_CHECK_ERROR(err);
+    err = TSSetTimeStep(_problem._ts, dt);PYLITH_CHECK_ERROR(err);
+    err = TSSetMaxTime(_problem._ts, tEnd);PYLITH_CHECK_ERROR(err);
+    err = TSSetExactFinalTime(_problem._ts, TS_EXACTFINALTIME_MATCHSTEP);PYLITH_CHECK_ERROR(err);
+    err = TSRestartStep(_problem._ts);PYLITH_CHECK_ERROR(err);
+    err = TSSolve(_problem._ts, NULL);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _propagateTimeSlice
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get state of time slice (global solution vector and local auxiliary vectors of integrators and constraints).
+void
+pylith::problems::TimeDependentParareal::getTimeSliceState(std::vector<PetscVec>* state) {
+    PYLITH_METHOD_BEGIN;
+    assert(state);
+
+    std::vector<pylith::feassemble::PhysicsImplementation*> implementations;
+    _problem._getImplementations(&implementations);
+    const size_t numImplementations = implementations.size();
+
+    PetscErrorCode err = 0;
+    PetscVec solutionVec = NULL;
+    err = TSGetSolution(_problem._ts, &solutionVec);PYLITH_CHECK_ERROR(err);
+    if (state->empty()) {
+        state->resize(1+numImplementations, NULL);
+        err = VecDuplicate(solutionVec, &(*state)[0]);PYLITH_CHECK_ERROR(err);
+        for (size_t i = 0; i < numImplementations; ++i) {
+            if (implementations[i]->getAuxiliaryField()) {
+                err = VecDuplicate(implementations[i]->getAuxiliaryField()->getLocalVector(), &(*state)[1+i]);PYLITH_CHECK_ERROR(err);
+            } // if
+        } // for
+    } // if
+    assert(state->size() == 1+numImplementations);
+
+    err = VecCopy(solutionVec, (*state)[0]);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < numImplementations; ++i) {
+        if ((*state)[1+i]) {
+            assert(implementations[i]->getAuxiliaryField());
+            err = VecCopy(implementations[i]->getAuxiliaryField()->getLocalVector(), (*state)[1+i]);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // getTimeSliceState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set solution and auxiliary fields (including state variables) from state of time slice.
+void
+pylith::problems::TimeDependentParareal::setTimeSliceState(const std::vector<PetscVec>& state) {
+    PYLITH_METHOD_BEGIN;
+
+    std::vector<pylith::feassemble::PhysicsImplementation*> implementations;
+    _problem._getImplementations(&implementations);
+    const size_t numImplementations = implementations.size();
+    assert(state.size() == 1+numImplementations);
+
+    PetscErrorCode err = 0;
+    PetscVec solutionVec = NULL;
+    err = TSGetSolution(_problem._ts, &solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(state[0], solutionVec);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < numImplementations; ++i) {
+        if (state[1+i]) {
+            assert(implementations[i]->getAuxiliaryField());
+            err = VecCopy(state[1+i], implementations[i]->getAuxiliaryField()->getLocalVector());PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+
+    // State, cached load vector, and predictor depend on the previous state.
+    assert(_problem._integrationData);
+    _problem._integrationData->setScalar(pylith::feassemble::IntegrationData::SCALAR_T_STATE, -HUGE_VAL);
+    _problem._localSolutionVecId = 0;
+    _problem._predictorNumSolutions = 0;
+    _problem._predictorStep = -1;
+    err = VecDestroy(&_problem._linearLoad);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setTimeSliceState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Send state of time slice to matching process of the group for the next time slice.
+void
+pylith::problems::TimeDependentParareal::_sendTimeSliceState(const std::vector<PetscVec>& state) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    int slice = 0;
+    err = MPI_Comm_rank(_timeComm, &slice);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < state.size(); ++i) {
+        if (!state[i]) { continue; }
+
+        PetscInt size = 0;
+        const PetscScalar* values = NULL;
+        err = VecGetLocalSize(state[i], &size);PYLITH_CHECK_ERROR(err);
+        err = VecGetArrayRead(state[i], &values);PYLITH_CHECK_ERROR(err);
+        err = MPI_Send(values, int(size), MPIU_SCALAR, slice+1, int(i), _timeComm);PYLITH_CHECK_ERROR(err);
+        err = VecRestoreArrayRead(state[i], &values);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _sendTimeSliceState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Receive state of time slice from matching process of the group for the previous time slice.
+void
+pylith::problems::TimeDependentParareal::_recvTimeSliceState(std::vector<PetscVec>* state) {
+    PYLITH_METHOD_BEGIN;
+    assert(state);
+
+    PetscErrorCode err = 0;
+    int slice = 0;
+    err = MPI_Comm_rank(_timeComm, &slice);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < state->size(); ++i) {
+        if (!(*state)[i]) { continue; }
+
+        // Matching processes must own the same points, which requires the same distribution of the mesh in each group.
+        PetscInt size = 0;
+        int count = 0;
+        MPI_Status status;
+        err = VecGetLocalSize((*state)[i], &size);PYLITH_CHECK_ERROR(err);
+        err = MPI_Probe(slice-1, int(i), _timeComm, &status);PYLITH_CHECK_ERROR(err);
+        err = MPI_Get_count(&status, MPIU_SCALAR, &count);PYLITH_CHECK_ERROR(err);
+        if (count != int(size)) {
+            std::ostringstream msg;
+            msg << "Size of state (" << count << ") received from group for time slice " << slice-1
+                << " does not match local size (" << size << ") in group for time slice " << slice
+                << ". The mesh must be distributed the same way in each group.";
+            throw std::runtime_error(msg.str());
+        } // if
+
+        PetscScalar* values = NULL;
+        err = VecGetArray((*state)[i], &values);PYLITH_CHECK_ERROR(err);
+        err = MPI_Recv(values, count, MPIU_SCALAR, slice-1, int(i), _timeComm, MPI_STATUS_IGNORE);PYLITH_CHECK_ERROR(err);
+        err = VecRestoreArray((*state)[i], &values);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _recvTimeSliceState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for suppressing output from observers of solution and physics.
+void
+pylith::problems::TimeDependentParareal::_setObserversSuppressOutput(const bool value) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_problem._observers);
+    _problem._observers->setSuppressOutput(value);
+    for (size_t i = 0; i < _problem._materials.size(); ++i) {
+        assert(_problem._materials[i]);
+        if (_problem._materials[i]->getObservers()) { _problem._materials[i]->getObservers()->setSuppressOutput(value); }
+    } // for
+    for (size_t i = 0; i < _problem._bc.size(); ++i) {
+        assert(_problem._bc[i]);
+        if (_problem._bc[i]->getObservers()) { _problem._bc[i]->getObservers()->setSuppressOutput(value); }
+    } // for
+    for (size_t i = 0; i < _problem._interfaces.size(); ++i) {
+        assert(_problem._interfaces[i]);
+        if (_problem._interfaces[i]->getObservers()) { _problem._interfaces[i]->getObservers()->setSuppressOutput(value); }
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setObserversSuppressOutput
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destroy vectors holding state of time slice.
+void
+pylith::problems::TimeDependentParareal::destroyTimeSliceState(std::vector<PetscVec>* state) {
+    PYLITH_METHOD_BEGIN;
+    assert(state);
+
+    for (size_t i = 0; i < state->size(); ++i) {
+        PetscErrorCode err = VecDestroy(&(*state)[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    state->clear();
+
+    PYLITH_METHOD_END;
+} // destroyTimeSliceState
+
+
+// End of file
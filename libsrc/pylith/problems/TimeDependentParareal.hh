@@ -0,0 +1,176 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/TimeDependentParareal.hh
+ *
+ * @brief Parareal iteration of a time dependent problem over time slices distributed across groups of processes.
+ *
+ * The state of a time slice is the global solution vector and the local auxiliary vectors (including state variables)
+ * of the integrators and constraints.
+ */
+
+#if !defined(pylith_problems_timedependentparareal_hh)
+#define pylith_problems_timedependentparareal_hh
+
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+
+#include "pylith/utils/petscfwd.h" // USES PetscVec
+#include "pylith/utils/types.hh" // USES PylithReal
+
+#include <mpi.h> // HASA MPI_Comm
+#include <vector> // USES std::vector
+
+class pylith::problems::TimeDependentParareal : public pylith::utils::PyreComponent {
+    friend class TestTimeDependent; // unit testing
+    friend class TimeDependentGreensFns; // suppressing output of impulses
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Constructor
+     *
+     * @param[in] problem Time dependent problem.
+     */
+    TimeDependentParareal(pylith::problems::TimeDependent& problem);
+
+    /// Destructor
+    ~TimeDependentParareal(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Use parareal iteration with time slices distributed across groups of processes.
+     *
+     * @param[in] comm Communicator connecting processes with the same rank in each group; rank is the time slice.
+     * @param[in] coarseTimeStep Time step of coarse propagator (seconds).
+     * @param[in] maxIterations Maximum number of parareal iterations.
+     * @param[in] tolerance Tolerance for relative change in solution at the end of the time slices.
+     */
+    void setParallelInTime(const MPI_Comm& comm,
+                           const double coarseTimeStep,
+                           const size_t maxIterations,
+                           const double tolerance);
+
+    /** Get number of parareal iterations in most recent solve.
+     *
+     * @returns Number of parareal iterations (0 if not using parareal iteration).
+     */
+    size_t getNumPararealIterations(void) const;
+
+    /** Is parareal iteration used?
+     *
+     * @returns True if using parareal iteration, false otherwise.
+     */
+    bool isEnabled(void) const;
+
+    /** Are iterates of parareal iteration being propagated?
+     *
+     * @returns True if propagating iterates (no output), false otherwise.
+     */
+    bool isIterate(void) const;
+
+    /// Verify configuration of problem is compatible with parareal iteration.
+    void verifyConfiguration(void) const;
+
+    /** Solve with parareal iteration over time slices distributed across groups of processes.
+     *
+     * Iteration k updates the solution and auxiliary fields (including state variables) at the end of time slice n
+     * using U_{n+1}^k = G(U_n^k) + F(U_n^{k-1}) - G(U_n^{k-1}), where F and G are the fine and coarse propagators.
+     * The fine propagations run concurrently on all groups; the coarse propagations form a pipeline from the first to
+     * the last group. After k iterations the first k time slices match the sequential solution.
+     */
+    void solve(void);
+
+    /** Get state of time slice (global solution vector and local auxiliary vectors of integrators and constraints).
+     *
+     * @param[inout] state Vectors for state (created if empty).
+     */
+    void getTimeSliceState(std::vector<PetscVec>* state);
+
+    /** Set solution and auxiliary fields (including state variables) from state of time slice.
+     *
+     * @param[in] state Vectors for state.
+     */
+    void setTimeSliceState(const std::vector<PetscVec>& state);
+
+    /** Destroy vectors holding state of time slice.
+     *
+     * @param[inout] state Vectors for state (some may be NULL).
+     */
+    static
+    void destroyTimeSliceState(std::vector<PetscVec>* state);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Advance solution over a time slice from the current state.
+     *
+     * @param[in] tBegin Time at beginning of time slice (nondimensional).
+     * @param[in] tEnd Time at end of time slice (nondimensional).
+     * @param[in] dt Time step (nondimensional).
+     * @param[in] stepBegin Time step index at beginning of time slice.
+     */
+    void _propagateTimeSlice(const PylithReal tBegin,
+                             const PylithReal tEnd,
+                             const PylithReal dt,
+                             const PylithInt stepBegin);
+
+    /** Send state of time slice to matching process of the group for the next time slice.
+     *
+     * @param[in] state Vectors for state.
+     */
+    void _sendTimeSliceState(const std::vector<PetscVec>& state);
+
+    /** Receive state of time slice from matching process of the group for the previous time slice.
+     *
+     * @param[inout] state Vectors for state.
+     */
+    void _recvTimeSliceState(std::vector<PetscVec>* state);
+
+    /** Set flag for suppressing output from observers of solution and physics.
+     *
+     * @param[in] value True to suppress output, false otherwise.
+     */
+    void _setObserversSuppressOutput(const bool value);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::problems::TimeDependent& _problem; ///< Time dependent problem.
+
+    MPI_Comm _timeComm; ///< Communicator connecting matching processes of groups for time slices.
+    double _coarseTimeStep; ///< Time step of coarse propagator (seconds).
+    size_t _pararealMaxIterations; ///< Maximum number of parareal iterations.
+    double _pararealTolerance; ///< Tolerance for relative change in solution at end of time slices.
+    size_t _numPararealIterations; ///< Number of parareal iterations in most recent solve.
+    bool _isPararealIterate; ///< True if propagating iterates of parareal iteration (no output).
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    TimeDependentParareal(const TimeDependentParareal&); ///< Not implemented
+    const TimeDependentParareal& operator=(const TimeDependentParareal&); ///< Not implemented
+
+}; // TimeDependentParareal
+
+#endif // pylith_problems_timedependentparareal_hh
+
+// End of file
@@ -0,0 +1,256 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TimeDependentSteadyState.hh" // implementation of class methods
+
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/materials/Material.hh" // USES Material
+#include "pylith/bc/BoundaryCondition.hh" // USES BoundaryCondition
+#include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
+#include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
+#include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include <algorithm> // USES std::max()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::TimeDependentSteadyState::TimeDependentSteadyState(pylith::problems::TimeDependent& problem) :
+    _problem(problem),
+    _steadyStateRate(0.0),
+    _steadyStateWindow(5),
+    _steadyStatePrevious(NULL),
+    _steadyStateNumSteps(0) {
+    PyreComponent::setName("timedependent");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::TimeDependentSteadyState::~TimeDependentSteadyState(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::TimeDependentSteadyState::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = VecDestroy(&_steadyStatePrevious);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < _steadyStateIS.size(); ++i) {
+        err = ISDestroy(&_steadyStateIS[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _steadyStateIS.clear();
+    _steadyStateNumSteps = 0;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set relative rate of change in solution for steady state.
+void
+pylith::problems::TimeDependentSteadyState::setSteadyStateRate(const double value) {
+    PYLITH_COMPONENT_DEBUG("setSteadyStateRate(value="<<value<<")");
+
+    if (value < 0.0) {
+        std::ostringstream msg;
+        msg << "Relative rate of change in solution for steady state (" << value << ") must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _steadyStateRate = value;
+} // setSteadyStateRate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get relative rate of change in solution for steady state.
+double
+pylith::problems::TimeDependentSteadyState::getSteadyStateRate(void) const {
+    return _steadyStateRate;
+} // getSteadyStateRate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of consecutive time steps at or below steady state rate for steady state.
+void
+pylith::problems::TimeDependentSteadyState::setSteadyStateWindow(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setSteadyStateWindow(value="<<value<<")");
+
+    if (0 == value) {
+        throw std::runtime_error("Number of time steps for steady state must be positive.");
+    } // if
+    _steadyStateWindow = value;
+} // setSteadyStateWindow
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of consecutive time steps at or below steady state rate for steady state.
+size_t
+pylith::problems::TimeDependentSteadyState::getSteadyStateWindow(void) const {
+    return _steadyStateWindow;
+} // getSteadyStateWindow
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set names of solution subfields checked for steady state.
+void
+pylith::problems::TimeDependentSteadyState::setSteadyStateSubfields(const char* names[],
+                                                                    const int numNames) {
+    PYLITH_COMPONENT_DEBUG("setSteadyStateSubfields(names="<<names<<", numNames="<<numNames<<")");
+    assert( (!names && 0 == numNames) || (names && 0 < numNames) );
+
+    _steadyStateSubfields.resize(numNames);
+    for (int i = 0; i < numNames; ++i) {
+        assert(names[i]);
+        _steadyStateSubfields[i] = names[i];
+    } // for
+} // setSteadyStateSubfields
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Is time stepping stopped at steady state?
+bool
+pylith::problems::TimeDependentSteadyState::isEnabled(void) const {
+    return _steadyStateRate > 0.0;
+} // isEnabled
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Reset state for another run.
+void
+pylith::problems::TimeDependentSteadyState::reinitialize(void) {
+    _steadyStateNumSteps = 0;
+} // reinitialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether solution has reached steady state.
+bool
+pylith::problems::TimeDependentSteadyState::isSteadyState(const PylithReal dt,
+                                                          const PylithInt tindex,
+                                                          PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("isSteadyState(dt="<<dt<<", tindex="<<tindex<<", solutionVec="<<solutionVec<<")");
+
+    assert(solutionVec);
+    assert(_steadyStateRate > 0.0);
+    assert(_problem._normalizer);
+    const PylithReal timeScale = _problem._normalizer->getTimeScale();
+
+    PetscErrorCode err = 0;
+    if (!_steadyStatePrevious) {
+        assert(_problem._integrationData);
+        const pylith::topology::Field* solution = _problem._integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);
+        assert(solution);
+        const size_t numSubfields = _steadyStateSubfields.size();
+        _steadyStateIS.resize(numSubfields, NULL);
+        for (size_t i = 0; i < numSubfields; ++i) {
+            if (!solution->hasSubfield(_steadyStateSubfields[i].c_str())) {
+                std::ostringstream msg;
+                msg << "Could not find subfield '" << _steadyStateSubfields[i] << "' in solution '" << solution->getLabel()
+                    << "' for checking steady state.";
+                throw std::runtime_error(msg.str());
+            } // if
+            const PetscInt subfieldIndex = solution->getSubfieldInfo(_steadyStateSubfields[i].c_str()).index;
+            err = DMCreateSubDM(solution->getDM(), 1, &subfieldIndex, &_steadyStateIS[i], NULL);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = VecDuplicate(solutionVec, &_steadyStatePrevious);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(solutionVec, _steadyStatePrevious);PYLITH_CHECK_ERROR(err);
+        _steadyStateNumSteps = 0;
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    // Change in solution over time step.
+    err = VecAYPX(_steadyStatePrevious, -1.0, solutionVec);PYLITH_CHECK_ERROR(err);
+
+    // Relative rate of change (dimensional) must satisfy criterion for entire solution or each subfield.
+    bool isBelowRate = true;
+    PylithReal rateMax = 0.0;
+    const size_t numChecks = std::max(size_t(1), _steadyStateIS.size());
+    for (size_t i = 0; i < numChecks; ++i) {
+        PetscVec changeVec = _steadyStatePrevious;
+        PetscVec valuesVec = solutionVec;
+        if (_steadyStateIS.size() > 0) {
+            err = VecGetSubVector(_steadyStatePrevious, _steadyStateIS[i], &changeVec);PYLITH_CHECK_ERROR(err);
+            err = VecGetSubVector(solutionVec, _steadyStateIS[i], &valuesVec);PYLITH_CHECK_ERROR(err);
+        } // if
+        PylithReal changeNorm = 0.0, valuesNorm = 0.0;
+        err = VecNorm(changeVec, NORM_2, &changeNorm);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(valuesVec, NORM_2, &valuesNorm);PYLITH_CHECK_ERROR(err);
+        if (_steadyStateIS.size() > 0) {
+            err = VecRestoreSubVector(_steadyStatePrevious, _steadyStateIS[i], &changeVec);PYLITH_CHECK_ERROR(err);
+            err = VecRestoreSubVector(solutionVec, _steadyStateIS[i], &valuesVec);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        // Skip subfields that remain zero.
+        if (valuesNorm > 0.0) {
+            const PylithReal rate = changeNorm / (valuesNorm * dt * timeScale);
+            rateMax = std::max(rate, rateMax);
+            isBelowRate = isBelowRate && (rate <= _steadyStateRate);
+        } else if (changeNorm > 0.0) {
+            isBelowRate = false;
+        } // if/else
+    } // for
+    err = VecCopy(solutionVec, _steadyStatePrevious);PYLITH_CHECK_ERROR(err);
+
+    _steadyStateNumSteps = (isBelowRate) ? _steadyStateNumSteps + 1 : 0;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("Maximum relative rate of change in solution for time step " << tindex << ": "
+                                                                                                << rateMax << " 1/s.");
+
+    PYLITH_METHOD_RETURN(_steadyStateNumSteps >= _steadyStateWindow);
+} // isSteadyState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for writing output at the next update regardless of output triggers in observers of solution and physics.
+void
+pylith::problems::TimeDependentSteadyState::setObserversForceOutput(const bool value) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_problem._observers);
+    _problem._observers->setForceOutput(value);
+    for (size_t i = 0; i < _problem._materials.size(); ++i) {
+        assert(_problem._materials[i]);
+        if (_problem._materials[i]->getObservers()) { _problem._materials[i]->getObservers()->setForceOutput(value); }
+    } // for
+    for (size_t i = 0; i < _problem._bc.size(); ++i) {
+        assert(_problem._bc[i]);
+        if (_problem._bc[i]->getObservers()) { _problem._bc[i]->getObservers()->setForceOutput(value); }
+    } // for
+    for (size_t i = 0; i < _problem._interfaces.size(); ++i) {
+        assert(_problem._interfaces[i]);
+        if (_problem._interfaces[i]->getObservers()) { _problem._interfaces[i]->getObservers()->setForceOutput(value); }
+    } // for
+
+    PYLITH_METHOD_END;
+} // setObserversForceOutput
+
+
+// End of file
@@ -0,0 +1,139 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/TimeDependentSteadyState.hh
+ *
+ * @brief Stopping time stepping of a time dependent problem at steady state.
+ */
+
+#if !defined(pylith_problems_timedependentsteadystate_hh)
+#define pylith_problems_timedependentsteadystate_hh
+
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+
+#include "pylith/utils/array.hh" // HASA string_vector
+#include "pylith/utils/petscfwd.h" // HASA PetscVec, PetscIS
+#include "pylith/utils/types.hh" // USES PylithReal
+
+#include <vector> // HASA std::vector
+
+class pylith::problems::TimeDependentSteadyState : public pylith::utils::PyreComponent {
+    friend class TestTimeDependent; // unit testing
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Constructor
+     *
+     * @param[in] problem Time dependent problem.
+     */
+    TimeDependentSteadyState(pylith::problems::TimeDependent& problem);
+
+    /// Destructor
+    ~TimeDependentSteadyState(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set relative rate of change in solution for steady state.
+     *
+     * @param[in] value Relative rate of change in solution (1/s, 0=disable).
+     */
+    void setSteadyStateRate(const double value);
+
+    /** Get relative rate of change in solution for steady state.
+     *
+     * @returns Relative rate of change in solution (1/s).
+     */
+    double getSteadyStateRate(void) const;
+
+    /** Set number of consecutive time steps at or below steady state rate for steady state.
+     *
+     * @param[in] value Number of time steps.
+     */
+    void setSteadyStateWindow(const size_t value);
+
+    /** Get number of consecutive time steps at or below steady state rate for steady state.
+     *
+     * @returns Number of time steps.
+     */
+    size_t getSteadyStateWindow(void) const;
+
+    /** Set names of solution subfields checked for steady state.
+     *
+     * @param[in] names Array of subfield names.
+     * @param[in] numNames Length of array.
+     */
+    void setSteadyStateSubfields(const char* names[],
+                                 const int numNames);
+
+    /** Is time stepping stopped at steady state?
+     *
+     * @returns True if checking for steady state, false otherwise.
+     */
+    bool isEnabled(void) const;
+
+    /// Reset state for another run.
+    void reinitialize(void);
+
+    /** Check whether solution has reached steady state.
+     *
+     * The relative rate of change in the solution (or each subfield checked) must be at or below the steady state
+     * rate for the number of consecutive time steps given by the steady state window.
+     *
+     * @param[in] dt Time step just taken (nondimensional).
+     * @param[in] tindex Current time step index.
+     * @param[in] solutionVec Global PETSc vector with solution.
+     * @returns True if solution is at steady state, false otherwise.
+     */
+    bool isSteadyState(const PylithReal dt,
+                       const PylithInt tindex,
+                       PetscVec solutionVec);
+
+    /** Set flag for writing output at the next update regardless of output triggers in observers of solution and physics.
+     *
+     * @param[in] value True to write output regardless of output triggers, false otherwise.
+     */
+    void setObserversForceOutput(const bool value);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::problems::TimeDependent& _problem; ///< Time dependent problem.
+
+    double _steadyStateRate; ///< Relative rate of change in solution for steady state (0=disable).
+    size_t _steadyStateWindow; ///< Number of consecutive time steps at or below rate for steady state.
+    pylith::string_vector _steadyStateSubfields; ///< Names of subfields checked for steady state.
+    std::vector<PetscIS> _steadyStateIS; ///< Index sets of subfields in global solution vector.
+    PetscVec _steadyStatePrevious; ///< Solution at previous time step for steady state check.
+    size_t _steadyStateNumSteps; ///< Number of consecutive time steps at or below steady state rate.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    TimeDependentSteadyState(const TimeDependentSteadyState&); ///< Not implemented
+    const TimeDependentSteadyState& operator=(const TimeDependentSteadyState&); ///< Not implemented
+
+}; // TimeDependentSteadyState
+
+#endif // pylith_problems_timedependentsteadystate_hh
+
+// End of file
@@ -0,0 +1,548 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TimeDependentTimeStep.hh" // implementation of class methods
+
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/feassemble/IntegratorDomain.hh" // USES IntegratorDomain
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "petscts.h" // USES PetscTS
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include <algorithm> // USES std::min(), std::max()
+#include <cassert> // USES assert()
+#include <cmath> // USES sqrt(), pow()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::TimeDependentTimeStep::TimeDependentTimeStep(pylith::problems::TimeDependent& problem) :
+    _problem(problem),
+    _shouldAdaptTimeStep(false),
+    _dtMax(PYLITH_MAXSCALAR),
+    _dtGrowthFactor(1.5),
+    _maxwellTimeFraction(0.2),
+    _solutionChangeTolerance(0.05),
+    _maxwellTimeMin(PYLITH_MAXSCALAR),
+    _isMaxwellTimeStressDependent(false),
+    _solutionPrevious(NULL),
+    _useStableTimeStep(false),
+    _stableTimeStepFactor(1.0) {
+    PyreComponent::setName("timedependent");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::TimeDependentTimeStep::~TimeDependentTimeStep(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::TimeDependentTimeStep::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = VecDestroy(&_solutionPrevious);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution.
+void
+pylith::problems::TimeDependentTimeStep::setAdaptTimeStep(const bool value) {
+    _shouldAdaptTimeStep = value;
+} // setAdaptTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution?
+bool
+pylith::problems::TimeDependentTimeStep::getAdaptTimeStep(void) const {
+    return _shouldAdaptTimeStep;
+} // getAdaptTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set maximum time step for adaptive time stepping.
+void
+pylith::problems::TimeDependentTimeStep::setMaxTimeStep(const double value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Maximum time step (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _dtMax = value;
+
+    PYLITH_METHOD_END;
+} // setMaxTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get maximum time step for adaptive time stepping.
+double
+pylith::problems::TimeDependentTimeStep::getMaxTimeStep(void) const {
+    return _dtMax;
+} // getMaxTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set factor for geometric growth of time step.
+void
+pylith::problems::TimeDependentTimeStep::setTimeStepGrowthFactor(const double value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value <= 1.0) {
+        std::ostringstream msg;
+        msg << "Time step growth factor (" << value << ") must be greater than 1.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _dtGrowthFactor = value;
+
+    PYLITH_METHOD_END;
+} // setTimeStepGrowthFactor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get factor for geometric growth of time step.
+double
+pylith::problems::TimeDependentTimeStep::getTimeStepGrowthFactor(void) const {
+    return _dtGrowthFactor;
+} // getTimeStepGrowthFactor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set fraction of the minimum Maxwell time limiting the time step during the viscoelastic transient.
+void
+pylith::problems::TimeDependentTimeStep::setMaxwellTimeFraction(const double value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Fraction of Maxwell time (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _maxwellTimeFraction = value;
+
+    PYLITH_METHOD_END;
+} // setMaxwellTimeFraction
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get fraction of the minimum Maxwell time limiting the time step during the viscoelastic transient.
+double
+pylith::problems::TimeDependentTimeStep::getMaxwellTimeFraction(void) const {
+    return _maxwellTimeFraction;
+} // getMaxwellTimeFraction
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set tolerance for relative change in solution over a time step.
+void
+pylith::problems::TimeDependentTimeStep::setSolutionChangeTolerance(const double value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Tolerance for relative change in solution (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _solutionChangeTolerance = value;
+
+    PYLITH_METHOD_END;
+} // setSolutionChangeTolerance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get tolerance for relative change in solution over a time step.
+double
+pylith::problems::TimeDependentTimeStep::getSolutionChangeTolerance(void) const {
+    return _solutionChangeTolerance;
+} // getSolutionChangeTolerance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use estimate of stable time step for explicit time stepping as the initial time step.
+void
+pylith::problems::TimeDependentTimeStep::setUseStableTimeStep(const bool value) {
+    _useStableTimeStep = value;
+} // setUseStableTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use estimate of stable time step for explicit time stepping as the initial time step?
+bool
+pylith::problems::TimeDependentTimeStep::getUseStableTimeStep(void) const {
+    return _useStableTimeStep;
+} // getUseStableTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set factor applied to estimate of stable time step for explicit time stepping.
+void
+pylith::problems::TimeDependentTimeStep::setStableTimeStepFactor(const double value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Factor applied to stable time step (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _stableTimeStepFactor = value;
+
+    PYLITH_METHOD_END;
+} // setStableTimeStepFactor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get factor applied to estimate of stable time step for explicit time stepping.
+double
+pylith::problems::TimeDependentTimeStep::getStableTimeStepFactor(void) const {
+    return _stableTimeStepFactor;
+} // getStableTimeStepFactor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Start adaptive time stepping from the initial solution.
+void
+pylith::problems::TimeDependentTimeStep::initialize(PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("initialize(solutionVec="<<solutionVec<<")");
+
+    assert(solutionVec);
+    assert(_problem._normalizer);
+    const PylithReal timeScale = _problem._normalizer->getTimeScale();
+
+    _maxwellTimeMin = _getMinMaxwellTime(&_isMaxwellTimeStressDependent);
+    PetscErrorCode err = VecDestroy(&_solutionPrevious);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &_solutionPrevious);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(solutionVec, _solutionPrevious);PYLITH_CHECK_ERROR(err);
+    PYLITH_COMPONENT_DEBUG("Adaptive time stepping with minimum Maxwell time "<<_maxwellTimeMin*timeScale<<" s.");
+    if (_problem._dtInitial / timeScale > _maxwellTimeFraction * _maxwellTimeMin) {
+        err = TSSetTimeStep(_problem._ts, _maxwellTimeFraction * _maxwellTimeMin);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set time step for next time step using Maxwell times and change in solution.
+void
+pylith::problems::TimeDependentTimeStep::adaptTimeStep(const PylithReal t,
+                                                       const PylithReal dt,
+                                                       PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG_CALLBACK("adaptTimeStep(t="<<t<<", dt="<<dt<<", solutionVec="<<solutionVec<<")");
+
+    assert(solutionVec);
+    assert(_solutionPrevious);
+    assert(_problem._normalizer);
+    const PylithReal timeScale = _problem._normalizer->getTimeScale();
+
+    // Relative change in solution over the time step.
+    PetscErrorCode err = 0;
+    PylithReal solutionNorm = 0.0, solutionPreviousNorm = 0.0, changeNorm = 0.0;
+    err = VecNorm(solutionVec, NORM_2, &solutionNorm);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(_solutionPrevious, NORM_2, &solutionPreviousNorm);PYLITH_CHECK_ERROR(err);
+    err = VecAYPX(_solutionPrevious, -1.0, solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(_solutionPrevious, NORM_2, &changeNorm);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(solutionVec, _solutionPrevious);PYLITH_CHECK_ERROR(err);
+    const PylithReal relativeChange = (solutionNorm > 0.0) ? changeNorm / solutionNorm : 0.0;
+
+    // Grow time step geometrically when the solution changes slowly; shrink it when the solution changes quickly.
+    // Skip the solution criterion for the initial (e.g., elastic) response from a zero solution.
+    PylithReal scale = _dtGrowthFactor;
+    if ((solutionPreviousNorm > 0.0) && (relativeChange > 0.0)) {
+        scale = std::max(1.0 / _dtGrowthFactor, std::min(_dtGrowthFactor, _solutionChangeTolerance / relativeChange));
+    } // if
+    PylithReal dtNext = std::min(dt * scale, _dtMax / timeScale);
+
+    // Resolve the viscoelastic transient over the first Maxwell time. The Maxwell time of power-law rheologies
+    // depends on the current stress.
+    if (_isMaxwellTimeStressDependent) {
+        _maxwellTimeMin = _getMinMaxwellTime(&_isMaxwellTimeStressDependent);
+    } // if
+    const PylithReal tElapsed = t - _problem._startTime / timeScale;
+    if (tElapsed < _maxwellTimeMin) {
+        dtNext = std::min(dtNext, _maxwellTimeFraction * _maxwellTimeMin);
+    } // if
+
+    if (dtNext != dt) {
+        PYLITH_COMPONENT_DEBUG_CALLBACK("Changing time step from "<<dt*timeScale<<" s to "<<dtNext*timeScale<<" s (relative change in solution "<<relativeChange<<").");
+        err = TSSetTimeStep(_problem._ts, dtNext);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // adaptTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Report estimate of stable time step for explicit time stepping and use it if requested.
+void
+pylith::problems::TimeDependentTimeStep::setStableTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setStableTimeStep()");
+
+    const PylithReal dtStableMin = _getMinStableTimeStep();
+    if (dtStableMin >= PYLITH_MAXSCALAR) {
+        if (_useStableTimeStep) {
+            PYLITH_COMPONENT_WARNING("Ignoring stable time step. Materials do not provide the wave speeds needed to estimate it.");
+        } // if
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_problem._normalizer);
+    const PylithReal timeScale = _problem._normalizer->getTimeScale();
+    const PylithReal dtStable = _stableTimeStepFactor * dtStableMin;
+    PYLITH_COMPONENT_INFO_ROOT("Estimated stable time step for explicit time stepping: "<<dtStableMin*timeScale
+                                                                                        <<" s (minimum over cells of distance between vertices divided by Vp).");
+    PetscErrorCode err = 0;
+    if (_useStableTimeStep) {
+        PYLITH_COMPONENT_INFO_ROOT("Using initial time step of "<<dtStable*timeScale<<" s ("<<_stableTimeStepFactor
+                                                                <<" times estimated stable time step).");
+        err = TSSetTimeStep(_problem._ts, dtStable);PYLITH_CHECK_ERROR(err);
+    } else if ((_problem._dtInitial / timeScale > dtStable) && !_problem._useLocalTimeStepping) {
+        PYLITH_COMPONENT_WARNING("Initial time step ("<<_problem._dtInitial<<" s) exceeds "<<_stableTimeStepFactor
+                                                    <<" times the estimated stable time step ("<<dtStable*timeScale
+                                                    <<" s). The solution may become unstable.");
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // setStableTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get minimum stable time step for explicit time stepping over all integrators over the domain.
+PylithReal
+pylith::problems::TimeDependentTimeStep::_getMinStableTimeStep(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    PylithReal dtStableMinLocal = PYLITH_MAXSCALAR;
+    const size_t numIntegrators = _problem._integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        const pylith::feassemble::IntegratorDomain* integrator = dynamic_cast<pylith::feassemble::IntegratorDomain*>(_problem._integrators[i]);
+        if (!integrator) { continue; }
+
+        std::vector<PetscInt> cells;
+        std::vector<PylithReal> dtStable;
+        integrator->computeStableTimeSteps(&cells, &dtStable);
+        for (size_t iCell = 0; iCell < dtStable.size(); ++iCell) {
+            dtStableMinLocal = std::min(dtStableMinLocal, dtStable[iCell]);
+        } // for
+    } // for
+
+    assert(_problem._integrationData);
+    const pylith::topology::Field* solution = _problem._integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    PylithReal dtStableMin = PYLITH_MAXSCALAR;
+    PetscErrorCode err = MPI_Allreduce(&dtStableMinLocal, &dtStableMin, 1, MPIU_REAL, MPI_MIN,
+                                       solution->getMesh().getComm());PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(dtStableMin);
+} // _getMinStableTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get minimum Maxwell time over all integrators with viscoelastic rheologies.
+PylithReal
+pylith::problems::TimeDependentTimeStep::_getMinMaxwellTime(bool* isStressDependent) const {
+    PYLITH_METHOD_BEGIN;
+    assert(isStressDependent);
+
+    PylithReal maxwellTimeMinLocal = PYLITH_MAXSCALAR;
+    int isStressDependentLocal = 0;
+    const size_t numIntegrators = _problem._integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_problem._integrators[i]);
+        const pylith::topology::Field* auxiliaryField = _problem._integrators[i]->getAuxiliaryField();
+        if (!auxiliaryField) { continue; }
+
+        bool integratorStressDependent = false;
+        maxwellTimeMinLocal = std::min(maxwellTimeMinLocal, _getMinMaxwellTime(*auxiliaryField, &integratorStressDependent));
+        isStressDependentLocal = std::max(isStressDependentLocal, int(integratorStressDependent));
+    } // for
+
+    assert(_problem._integrationData);
+    const pylith::topology::Field* solution = _problem._integrationData->getField(pylith::feassemble::IntegrationData::FIELD_SOLUTION);assert(solution);
+    MPI_Comm comm = solution->getMesh().getComm();
+    PylithReal maxwellTimeMin = PYLITH_MAXSCALAR;
+    int isStressDependentGlobal = 0;
+    PetscErrorCode err = 0;
+    err = MPI_Allreduce(&maxwellTimeMinLocal, &maxwellTimeMin, 1, MPIU_REAL, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&isStressDependentLocal, &isStressDependentGlobal, 1, MPI_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    *isStressDependent = isStressDependentGlobal > 0;
+
+    PYLITH_METHOD_RETURN(maxwellTimeMin);
+} // _getMinMaxwellTime
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get minimum Maxwell time in auxiliary field on this process.
+PylithReal
+pylith::problems::TimeDependentTimeStep::_getMinMaxwellTime(const pylith::topology::Field& auxiliaryField,
+                                                            bool* isStressDependent) {
+    PYLITH_METHOD_BEGIN;
+    assert(isStressDependent);
+
+    PylithReal maxwellTimeMin = PYLITH_MAXSCALAR;
+    *isStressDependent = false;
+    PetscErrorCode err = 0;
+
+    // Linear and generalized Maxwell: all components of 'maxwell_time'.
+    if (auxiliaryField.hasSubfield("maxwell_time")) {
+        PetscSection auxiliarySection = auxiliaryField.getLocalSection();assert(auxiliarySection);
+        PetscInt pStart = 0, pEnd = 0;
+        err = PetscSectionGetChart(auxiliarySection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        pylith::topology::VecVisitorMesh auxiliaryVisitor(auxiliaryField, "maxwell_time");
+        const PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            const PetscInt off = auxiliaryVisitor.sectionOffset(point);
+            const PetscInt dof = auxiliaryVisitor.sectionDof(point);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                const PylithReal maxwellTime = auxiliaryArray[off+iDof];
+                if (maxwellTime > 0.0) {
+                    maxwellTimeMin = std::min(maxwellTimeMin, maxwellTime);
+                } // if
+            } // for
+        } // for
+    } // if
+
+    // Power-law: Maxwell time of effective viscosity, eta/mu, where 1/(2 eta) = refStrainRate/refStress *
+    // (j2/refStress)^(n-1), so eta/mu = refStress/(2 mu refStrainRate) * (refStress/j2)^(n-1).
+    if (auxiliaryField.hasSubfield("power_law_exponent") && auxiliaryField.hasSubfield("deviatoric_stress")) {
+        *isStressDependent = true;
+
+        const size_t numSubfields = 5;
+        const char* subfieldNames[numSubfields] = {
+            "shear_modulus",
+            "power_law_reference_strain_rate",
+            "power_law_reference_stress",
+            "power_law_exponent",
+            "deviatoric_stress",
+        };
+        const size_t i_shearModulus = 0;
+        const size_t i_refStrainRate = 1;
+        const size_t i_refStress = 2;
+        const size_t i_exponent = 3;
+        const size_t i_stress = 4;
+
+        PetscInt subfieldIndices[numSubfields];
+        PetscInt numComponents[numSubfields];
+        size_t valueOffsets[numSubfields];
+        size_t numValues = 0;
+        for (size_t i = 0; i < numSubfields; ++i) {
+            const pylith::topology::Field::SubfieldInfo& info = auxiliaryField.getSubfieldInfo(subfieldNames[i]);
+            subfieldIndices[i] = info.index;
+            numComponents[i] = info.description.numComponents;
+            valueOffsets[i] = numValues;
+            numValues += numComponents[i];
+        } // for
+        const PetscInt stressSize = numComponents[i_stress];
+        if ((4 != stressSize) && (6 != stressSize)) {
+            std::ostringstream msg;
+            msg << "Unexpected number of components (" << stressSize << ") in deviatoric stress subfield for "
+                << "computing power-law Maxwell time. Expected 4 (2D) or 6 (3D).";
+            throw std::runtime_error(msg.str());
+        } // if
+
+        PetscDM dmAux = auxiliaryField.getDM();assert(dmAux);
+        PetscSection auxiliarySection = auxiliaryField.getLocalSection();assert(auxiliarySection);
+        const PylithScalar* auxiliaryArray = NULL;
+        err = VecGetArrayRead(auxiliaryField.getLocalVector(), &auxiliaryArray);PYLITH_CHECK_ERROR(err);
+
+        std::vector<PylithReal> values(numValues);
+        PetscInt counts[numSubfields];
+        PetscInt cStart = 0, cEnd = 0;
+        err = DMPlexGetHeightStratum(dmAux, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            // Average values of subfields over points in closure of cell.
+            std::fill(values.begin(), values.end(), 0.0);
+            std::fill(counts, counts+numSubfields, 0);
+            PetscInt closureSize = 0;
+            PetscInt* closure = NULL;
+            err = DMPlexGetTransitiveClosure(dmAux, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+                const PetscInt point = closure[2*iPoint];
+                for (size_t i = 0; i < numSubfields; ++i) {
+                    PetscInt dof = 0, off = 0;
+                    err = PetscSectionGetFieldDof(auxiliarySection, point, subfieldIndices[i], &dof);PYLITH_CHECK_ERROR(err);
+                    if (!dof) { continue; }
+                    err = PetscSectionGetFieldOffset(auxiliarySection, point, subfieldIndices[i], &off);PYLITH_CHECK_ERROR(err);
+                    for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                        values[valueOffsets[i] + iDof % numComponents[i]] += auxiliaryArray[off+iDof];
+                    } // for
+                    counts[i] += dof / numComponents[i];
+                } // for
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dmAux, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+            bool hasValues = true;
+            for (size_t i = 0; i < numSubfields; ++i) {
+                if (!counts[i]) {
+                    hasValues = false;
+                    break;
+                } // if
+                for (PetscInt iComp = 0; iComp < numComponents[i]; ++iComp) {
+                    values[valueOffsets[i]+iComp] /= counts[i];
+                } // for
+            } // for
+            if (!hasValues) { continue; }
+
+            const PylithReal shearModulus = values[valueOffsets[i_shearModulus]];
+            const PylithReal refStrainRate = values[valueOffsets[i_refStrainRate]];
+            const PylithReal refStress = values[valueOffsets[i_refStress]];
+            const PylithReal exponent = values[valueOffsets[i_exponent]];
+            const PylithReal* stress = &values[valueOffsets[i_stress]];
+
+            // Components are xx, yy, zz, xy (2D) and xx, yy, zz, xy, yz, xz (3D).
+            PylithReal stressProduct = stress[0]*stress[0] + stress[1]*stress[1] + stress[2]*stress[2];
+            for (PetscInt iComp = 3; iComp < stressSize; ++iComp) {
+                stressProduct += 2.0*stress[iComp]*stress[iComp];
+            } // for
+            const PylithReal j2 = sqrt(0.5*stressProduct);
+            if ((j2 <= 0.0) || (shearModulus <= 0.0) || (refStrainRate <= 0.0) || (refStress <= 0.0)) { continue; }
+
+            const PylithReal maxwellTime = refStress / (2.0*shearModulus*refStrainRate) * pow(refStress/j2, exponent-1.0);
+            maxwellTimeMin = std::min(maxwellTimeMin, maxwellTime);
+        } // for
+        err = VecRestoreArrayRead(auxiliaryField.getLocalVector(), &auxiliaryArray);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_RETURN(maxwellTimeMin);
+} // _getMinMaxwellTime
+
+
+// End of file
@@ -0,0 +1,221 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/TimeDependentTimeStep.hh
+ *
+ * @brief Time step control of a time dependent problem.
+ *
+ * Adapts the time step of implicit time stepping using the viscoelastic relaxation (Maxwell) times and the change in
+ * the solution, and estimates the stable time step of explicit time stepping.
+ */
+
+#if !defined(pylith_problems_timedependenttimestep_hh)
+#define pylith_problems_timedependenttimestep_hh
+
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/petscfwd.h" // HASA PetscVec
+#include "pylith/utils/types.hh" // HASA PylithReal
+
+class pylith::problems::TimeDependentTimeStep : public pylith::utils::PyreComponent {
+    friend class TestTimeDependent; // unit testing
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Constructor
+     *
+     * @param[in] problem Time dependent problem.
+     */
+    TimeDependentTimeStep(pylith::problems::TimeDependent& problem);
+
+    /// Destructor
+    ~TimeDependentTimeStep(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution.
+     *
+     * @param[in] value True if adapting time step, false otherwise.
+     */
+    void setAdaptTimeStep(const bool value);
+
+    /** Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution?
+     *
+     * @returns True if adapting time step, false otherwise.
+     */
+    bool getAdaptTimeStep(void) const;
+
+    /** Set maximum time step for adaptive time stepping.
+     *
+     * @param[in] value Maximum time step (seconds).
+     */
+    void setMaxTimeStep(const double value);
+
+    /** Get maximum time step for adaptive time stepping.
+     *
+     * @returns Maximum time step (seconds).
+     */
+    double getMaxTimeStep(void) const;
+
+    /** Set factor for geometric growth of time step.
+     *
+     * @param[in] value Ratio of consecutive time steps (> 1).
+     */
+    void setTimeStepGrowthFactor(const double value);
+
+    /** Get factor for geometric growth of time step.
+     *
+     * @returns Ratio of consecutive time steps.
+     */
+    double getTimeStepGrowthFactor(void) const;
+
+    /** Set fraction of the minimum Maxwell time limiting the time step during the viscoelastic transient.
+     *
+     * @param[in] value Fraction of minimum Maxwell time.
+     */
+    void setMaxwellTimeFraction(const double value);
+
+    /** Get fraction of the minimum Maxwell time limiting the time step during the viscoelastic transient.
+     *
+     * @returns Fraction of minimum Maxwell time.
+     */
+    double getMaxwellTimeFraction(void) const;
+
+    /** Set tolerance for relative change in solution over a time step.
+     *
+     * @param[in] value Tolerance for relative change in solution.
+     */
+    void setSolutionChangeTolerance(const double value);
+
+    /** Get tolerance for relative change in solution over a time step.
+     *
+     * @returns Tolerance for relative change in solution.
+     */
+    double getSolutionChangeTolerance(void) const;
+
+    /** Use estimate of stable time step for explicit time stepping as the initial time step.
+     *
+     * @param[in] value True if using estimate of stable time step, false otherwise.
+     */
+    void setUseStableTimeStep(const bool value);
+
+    /** Use estimate of stable time step for explicit time stepping as the initial time step?
+     *
+     * @returns True if using estimate of stable time step, false otherwise.
+     */
+    bool getUseStableTimeStep(void) const;
+
+    /** Set factor applied to estimate of stable time step for explicit time stepping.
+     *
+     * @param[in] value Factor applied to estimate of stable time step.
+     */
+    void setStableTimeStepFactor(const double value);
+
+    /** Get factor applied to estimate of stable time step for explicit time stepping.
+     *
+     * @returns Factor applied to estimate of stable time step.
+     */
+    double getStableTimeStepFactor(void) const;
+
+    /** Start adaptive time stepping from the initial solution.
+     *
+     * Limits the initial time step to the fraction of the minimum Maxwell time.
+     *
+     * @param[in] solutionVec PETSc Vec with initial solution.
+     */
+    void initialize(PetscVec solutionVec);
+
+    /** Set time step for next time step using Maxwell times and change in solution.
+     *
+     * @param[in] t Current time (nondimensional).
+     * @param[in] dt Current time step (nondimensional).
+     * @param[in] solutionVec PETSc Vec with solution at current time.
+     */
+    void adaptTimeStep(const PylithReal t,
+                       const PylithReal dt,
+                       PetscVec solutionVec);
+
+    /// Report estimate of stable time step for explicit time stepping and use it if requested.
+    void setStableTimeStep(void);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Get minimum stable time step for explicit time stepping over all integrators over the domain.
+     *
+     * @returns Minimum nondimensional stable time step (PYLITH_MAXSCALAR if none).
+     */
+    PylithReal _getMinStableTimeStep(void) const;
+
+    /** Get minimum Maxwell time over all integrators with viscoelastic rheologies.
+     *
+     * @param[out] isStressDependent True if the Maxwell time of any rheology depends on the stress.
+     * @returns Minimum nondimensional Maxwell time (PYLITH_MAXSCALAR if none).
+     */
+    PylithReal _getMinMaxwellTime(bool* isStressDependent) const;
+
+    /** Get minimum Maxwell time in auxiliary field on this process.
+     *
+     * Linear and generalized Maxwell rheologies contribute all components of the 'maxwell_time' subfield
+     * (maxwell_time_1, maxwell_time_2, and maxwell_time_3 for generalized Maxwell). Power-law rheologies contribute
+     * the Maxwell time of the effective viscosity, eta/mu, using the average values of the auxiliary subfields in
+     * each cell, including the current deviatoric stress. Cells with zero deviatoric stress have an infinite
+     * Maxwell time.
+     *
+     * @param[in] auxiliaryField Auxiliary field.
+     * @param[out] isStressDependent True if the Maxwell time depends on the stress.
+     * @returns Minimum nondimensional Maxwell time (PYLITH_MAXSCALAR if none).
+     */
+    static
+    PylithReal _getMinMaxwellTime(const pylith::topology::Field& auxiliaryField,
+                                  bool* isStressDependent);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::problems::TimeDependent& _problem; ///< Time dependent problem.
+
+    bool _shouldAdaptTimeStep; ///< True if adapting time step.
+    double _dtMax; ///< Maximum time step for adaptive time stepping (seconds).
+    double _dtGrowthFactor; ///< Ratio of consecutive time steps.
+    double _maxwellTimeFraction; ///< Fraction of minimum Maxwell time limiting time step during transient.
+    double _solutionChangeTolerance; ///< Tolerance for relative change in solution over a time step.
+    PylithReal _maxwellTimeMin; ///< Minimum nondimensional Maxwell time.
+    bool _isMaxwellTimeStressDependent; ///< True if minimum Maxwell time must be updated each time step.
+    PetscVec _solutionPrevious; ///< Solution at previous time step.
+
+    bool _useStableTimeStep; ///< True if using estimate of stable time step as initial time step.
+    double _stableTimeStepFactor; ///< Factor applied to estimate of stable time step.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    TimeDependentTimeStep(const TimeDependentTimeStep&); ///< Not implemented
+    const TimeDependentTimeStep& operator=(const TimeDependentTimeStep&); ///< Not implemented
+
+}; // TimeDependentTimeStep
+
+#endif // pylith_problems_timedependenttimestep_hh
+
+// End of file
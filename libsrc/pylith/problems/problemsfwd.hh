@@ -31,11 +31,19 @@ namespace pylith {
     namespace problems {
         class Problem;
         class TimeDependent;
+        class TimeDependentTimeStep;
+        class TimeDependentCheckpoint;
+        class TimeDependentSteadyState;
+        class TimeDependentLoadCases;
+        class TimeDependentParareal;
+        class TimeDependentGreensFns;
         class GreensFns;
 
         class SolutionFactory;
         class ObserversSoln;
         class ObserverSoln;
+        class CouplerBoundary;
+        class PreconditionerSplitNode;
 
         class Physics;
         class ObserversPhysics;
@@ -43,10 +51,12 @@ namespace pylith {
 
         class InitialCondition;
         class InitialConditionDomain;
+        class InitialConditionFile;
         class InitialConditionPatch;
 
         class ProgressMonitor;
         class ProgressMonitorTime;
+        class ProgressMonitorTelemetry;
         class ProgressMonitorStep;
 
     } // problems
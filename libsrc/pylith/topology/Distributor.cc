@@ -28,12 +28,17 @@
 #include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
 #include "pylith/meshio/DataWriter.hh" // USES DataWriter
 #include "pylith/utils/journals.hh" // pythia::journal
+#include "pylith/utils/SetupProfiler.hh" // USES SetupProfiler
 
+#include <algorithm> // USES std::max()
 #include <cstring> // USES strlen()
+#include <iomanip> // USES std::setw()
 #include <strings.h> // USES strcasecmp()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
+#include <map> // USES std::map
+#include <vector> // USES std::vector
 
 // ------------------------------------------------------------------------------------------------
 namespace pylith {
@@ -41,12 +46,15 @@ namespace pylith {
         class _Distributor {
 public:
 
-            /** Distribute custom overlap based on PETSc labels.
+            /** Distribute custom overlap for faults.
              *
-             * The overlap excludes cohesive cells but includes cells adjacent to faults.
+             * The overlap contains only the cells (and their closures) sharing a fault face on a partition boundary,
+             * so that both cells adjacent to each fault face (and cohesive cell) are available on the process with
+             * the fault face. Cohesive cells are not included in the overlap.
              * This is a custom version of DMPlexDistributeOverlap()
              *
              * @param[out] dmOverlap PETSc DM for the overlap.
+             * @param[out] sfOverlap PETSc SF migrating points to the overlap (NULL if no overlap).
              * @param[in] dmMesh PETSc DM for the current mesh.
              * @param[in] faults Array of fault interfaces.
              * @param[in] numFaults Number of fault interfaces.
@@ -55,10 +63,68 @@ public:
              */
             static
             PetscErrorCode distributeOverlap(PetscDM* dmOverlap,
+                                             PetscSF* sfOverlap,
                                              PetscDM dmMesh,
                                              pylith::faults::FaultCohesive* faults[],
                                              const int numFaults);
 
+            /** Create label with points to migrate for overlap of faults.
+             *
+             * This is a custom version of DMPlexCreateOverlapLabel() using the cells in the support of fault faces
+             * shared with other processes instead of the adjacency of all shared points.
+             *
+             * @param[out] ovLabel Label with the rank of the process to which each point is migrated.
+             * @param[in] dmMesh PETSc DM for the current mesh.
+             * @param[in] faults Array of fault interfaces.
+             * @param[in] numFaults Number of fault interfaces.
+             * @param[in] rootSection Number of leaves for each root point.
+             * @param[in] rootrank Ranks of leaves for each root point.
+             * @param[in] leafSection Number of processes sharing each leaf point.
+             * @param[in] leafrank Ranks of processes sharing each leaf point.
+             *
+             * @returns PETSc error code (0==success).
+             */
+            static
+            PetscErrorCode createFaultOverlapLabel(PetscDMLabel* ovLabel,
+                                                   PetscDM dmMesh,
+                                                   pylith::faults::FaultCohesive* faults[],
+                                                   const int numFaults,
+                                                   PetscSection rootSection,
+                                                   PetscIS rootrank,
+                                                   PetscSection leafSection,
+                                                   PetscIS leafrank);
+
+            /** Report quality of partition.
+             *
+             * Reports the shared faces (edge cut of the dual graph), the fraction of ghost cells, and the imbalance in
+             * the number of cells, vertices, and cohesive cells owned by each process.
+             *
+             * @param[in] mesh Distributed mesh.
+             */
+            static
+            void reportPartition(const pylith::topology::Mesh& mesh);
+
+            /** Partition mesh using cell weights and set the resulting partition in the partitioner of the mesh.
+             *
+             * The partition is computed with the PETSc partitioner `partitionerName` using cell weights for the
+             * vertices of the cell adjacency graph. The partitioner of the mesh is set to a shell partitioner with
+             * the resulting partition, so it is used in DMPlexDistribute().
+             *
+             * @param[in] dmMesh PETSc DM for the mesh.
+             * @param[in] partitionerName Name of PETSc partitioner to use in computing the partition.
+             * @param[in] faults Array of fault interfaces.
+             * @param[in] numFaults Number of fault interfaces.
+             * @param[in] materialWeights Map from material label value to cell weight.
+             * @param[in] faultWeights Array of weights for cohesive cells in each fault.
+             */
+            static
+            void setWeightedPartition(PetscDM dmMesh,
+                                      const char* partitionerName,
+                                      pylith::faults::FaultCohesive* faults[],
+                                      const int numFaults,
+                                      const std::map<int, int>& materialWeights,
+                                      const int* faultWeights);
+
         }; // _Distributor
     } // topology
 } // pylith
@@ -80,12 +146,31 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
                                           const pylith::topology::Mesh& origMesh,
                                           pylith::faults::FaultCohesive* faults[],
                                           const int numFaults,
-                                          const char* partitionerName) {
+                                          const char* partitionerName,
+                                          const int* materialIds,
+                                          const int numMaterialIds,
+                                          const int* materialWeights,
+                                          const int numMaterialWeights,
+                                          const int* faultWeights,
+                                          const int numFaultWeights) {
     PYLITH_METHOD_BEGIN;
     pythia::journal::info_t info("mesh_distributor");
 
     assert(newMesh);
+    if (numMaterialIds != numMaterialWeights) {
+        std::ostringstream msg;
+        msg << "Number of material label values (" << numMaterialIds << ") does not match number of material weights ("
+            << numMaterialWeights << ").";
+        throw std::logic_error(msg.str());
+    } // if
+    const bool useWeights = numMaterialWeights > 0;
+    if (useWeights && (numFaultWeights != numFaults)) {
+        std::ostringstream msg;
+        msg << "Number of fault weights (" << numFaultWeights << ") does not match number of faults (" << numFaults << ").";
+        throw std::logic_error(msg.str());
+    } // if
     newMesh->setCoordSys(origMesh.getCoordSys());
+    pylith::utils::SetupProfiler::begin("Distribute mesh");
 
     const int commRank = origMesh.getCommRank();
     if (0 == commRank) {
@@ -97,7 +182,15 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
     PetscPartitioner partitioner = 0;
     PetscDM dmOrig = origMesh.getDM();assert(dmOrig);
     err = DMPlexGetPartitioner(dmOrig, &partitioner);PYLITH_CHECK_ERROR(err);
-    err = PetscPartitionerSetType(partitioner, partitionerName);PYLITH_CHECK_ERROR(err);
+    if (useWeights) {
+        std::map<int, int> materialWeightsMap;
+        for (int i = 0; i < numMaterialIds; ++i) {
+            materialWeightsMap[materialIds[i]] = materialWeights[i];
+        } // for
+        _Distributor::setWeightedPartition(dmOrig, partitionerName, faults, numFaults, materialWeightsMap, faultWeights);
+    } else {
+        err = PetscPartitionerSetType(partitioner, partitionerName);PYLITH_CHECK_ERROR(err);
+    } // if/else
 
     if (0 == commRank) {
         info << pythia::journal::at(__HERE__)
@@ -105,15 +198,34 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
     } // if
 
     PetscDM dmTmp = NULL, dmNew = NULL;
+    PetscSF sfDist = NULL, sfOverlap = NULL;
     const PetscInt overlap = 0;
-    err = DMPlexDistribute(origMesh.getDM(), overlap, NULL, &dmTmp);PYLITH_CHECK_ERROR(err);
-    err = _Distributor::distributeOverlap(&dmNew, dmTmp, faults, numFaults);PYLITH_CHECK_ERROR(err);
+    err = DMPlexDistribute(origMesh.getDM(), overlap, &sfDist, &dmTmp);PYLITH_CHECK_ERROR(err);
+    err = _Distributor::distributeOverlap(&dmNew, &sfOverlap, dmTmp, faults, numFaults);PYLITH_CHECK_ERROR(err);
     err = DMDestroy(&dmTmp);PYLITH_CHECK_ERROR(err);
+
+    // Keep migration SF from original to distributed mesh, so checkpoints can be written in the natural
+    // (original) ordering of points, independent of the number of processes.
+    if (sfDist) {
+        PetscSF sfMigration = NULL;
+        if (sfOverlap) {
+            err = PetscSFCompose(sfDist, sfOverlap, &sfMigration);PYLITH_CHECK_ERROR(err);
+        } else {
+            err = PetscObjectReference((PetscObject)sfDist);PYLITH_CHECK_ERROR(err);
+            sfMigration = sfDist;
+        } // if/else
+        err = DMPlexSetMigrationSF(dmNew, sfMigration);PYLITH_CHECK_ERROR(err);
+        err = PetscSFDestroy(&sfMigration);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = PetscSFDestroy(&sfDist);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&sfOverlap);PYLITH_CHECK_ERROR(err);
     err = DMPlexDistributeSetDefault(dmNew, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
     err = DMPlexReorderCohesiveSupports(dmNew);PYLITH_CHECK_ERROR(err);
     err = DMViewFromOptions(dmNew, NULL, "-pylith_dist_dm_view");PYLITH_CHECK_ERROR(err);
     newMesh->setDM(dmNew);
 
+    pylith::utils::SetupProfiler::end("Distribute mesh");
+
     PYLITH_METHOD_END;
 } // distribute
 
@@ -130,6 +242,7 @@ pylith::topology::Distributor::write(meshio::DataWriter* const writer,
         info << pythia::journal::at(__HERE__)
              << "Writing partition." << pythia::journal::endl;
     } // if
+    _Distributor::reportPartition(mesh);
 
     // Setup and allocate PETSc vector
     const int commRank = mesh.getCommRank();
@@ -196,14 +309,16 @@ pylith::topology::Distributor::write(meshio::DataWriter* const writer,
 // This is a copy of DMPlexDistributeOverlap()
 PetscErrorCode
 pylith::topology::_Distributor::distributeOverlap(PetscDM* dmOverlap,
+                                                  PetscSF* sfOverlapOut,
                                                   PetscDM dmMesh,
                                                   pylith::faults::FaultCohesive* faults[],
                                                   const int numFaults) {
     PYLITH_METHOD_BEGIN;
     assert(dmOverlap);
+    assert(sfOverlapOut);
+    *sfOverlapOut = NULL;
 
     MPI_Comm comm;
-    PetscMPIInt size, rank;
     PetscSection rootSection, leafSection;
     PetscIS rootrank, leafrank;
     PetscDM dmCoord;
@@ -217,35 +332,12 @@ pylith::topology::_Distributor::distributeOverlap(PetscDM* dmOverlap,
         PYLITH_METHOD_RETURN(0);
     } // if
 
-    PetscDMLabel* ovIncludeLabels = (numFaults > 0) ? new PetscDMLabel[numFaults] : NULL;
-    PetscInt* ovIncludeLabelValues = (numFaults > 0) ? new PetscInt[numFaults] : NULL;
-    PetscDMLabel* ovExcludeLabels = (numFaults > 0) ? new PetscDMLabel[numFaults] : NULL;
-    PetscInt* ovExcludeLabelValues = (numFaults > 0) ? new PetscInt[numFaults] : NULL;
-
-    for (int i = 0; i < numFaults; ++i) {
-        const char* surfaceLabelName = faults[i]->getSurfaceLabelName();
-        err = DMGetLabel(dmMesh, surfaceLabelName, &ovIncludeLabels[i]);PYLITH_CHECK_ERROR(err);
-        ovIncludeLabelValues[i] = faults[i]->getSurfaceLabelValue();
-
-        const char* cohesiveLabelName = faults[i]->getCohesiveLabelName();
-        err = DMGetLabel(dmMesh, cohesiveLabelName, &ovExcludeLabels[i]);PYLITH_CHECK_ERROR(err);
-        ovExcludeLabelValues[i] = faults[i]->getCohesiveLabelValue();
-    } // for
-
     PetscCall(PetscObjectGetComm((PetscObject)dmMesh,&comm));
-    PetscCallMPI(MPI_Comm_size(comm, &size));
-    PetscCallMPI(MPI_Comm_rank(comm, &rank));
     /* Compute point overlap with neighbouring processes on the distributed DM */
     PetscCall(PetscSectionCreate(comm, &rootSection));
     PetscCall(PetscSectionCreate(comm, &leafSection));
     PetscCall(DMPlexDistributeOwnership(dmMesh, rootSection, &rootrank, leafSection, &leafrank));
-    PetscCall(DMPlexCreateOverlapLabelFromLabels(dmMesh, numFaults, ovIncludeLabels, ovIncludeLabelValues,
-                                                 numFaults, ovExcludeLabels, ovExcludeLabelValues, rootSection, rootrank, leafSection, leafrank, &lblOverlap));
-
-    delete[] ovIncludeLabels;ovIncludeLabels = NULL;
-    delete[] ovIncludeLabelValues;ovIncludeLabelValues = NULL;
-    delete[] ovExcludeLabels;ovExcludeLabels = NULL;
-    delete[] ovExcludeLabelValues;ovExcludeLabelValues = NULL;
+    PetscCall(createFaultOverlapLabel(&lblOverlap, dmMesh, faults, numFaults, rootSection, rootrank, leafSection, leafrank));
 
     /* Convert overlap label to stratified migration SF */
     PetscCall(DMPlexPartitionLabelCreateSF(dmMesh, lblOverlap, &sfOverlap));
@@ -274,10 +366,425 @@ pylith::topology::_Distributor::distributeOverlap(PetscDM* dmOverlap,
     PetscCall(PetscSFDestroy(&sfPoint));
     /* Cleanup overlap partition */
     PetscCall(DMLabelDestroy(&lblOverlap));
-    PetscCall(PetscSFDestroy(&sfOverlap));
+    *sfOverlapOut = sfOverlap;
 
     PYLITH_METHOD_RETURN(0);
 } // distributeOverlap
 
 
+// ------------------------------------------------------------------------------------------------
+// Create label with points to migrate for overlap of faults.
+PetscErrorCode
+pylith::topology::_Distributor::createFaultOverlapLabel(PetscDMLabel* ovLabel,
+                                                        PetscDM dmMesh,
+                                                        pylith::faults::FaultCohesive* faults[],
+                                                        const int numFaults,
+                                                        PetscSection rootSection,
+                                                        PetscIS rootrank,
+                                                        PetscSection leafSection,
+                                                        PetscIS leafrank) {
+    PYLITH_METHOD_BEGIN;
+    assert(ovLabel);
+    assert(dmMesh);
+
+    PetscErrorCode err = 0;
+    MPI_Comm comm = PetscObjectComm((PetscObject) dmMesh);
+    PetscMPIInt rank = 0;
+    err = MPI_Comm_rank(comm, &rank);PYLITH_CHECK_ERROR(err);
+
+    PetscInt pStart = 0, pEnd = 0, fStart = 0, fEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dmMesh, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
+
+    // Mark fault faces and cohesive cells. The faces of cohesive cells are fault faces, whether or not they are in
+    // the fault surface label. Cohesive cells do not exist yet if they are created after distribution.
+    std::vector<PetscInt> isFaultFace(pEnd-pStart, 0);
+    std::vector<bool> isCohesive(pEnd-pStart, false);
+    for (int iFault = 0; iFault < numFaults; ++iFault) {
+        PetscDMLabel surfaceLabel = NULL;
+        err = DMGetLabel(dmMesh, faults[iFault]->getSurfaceLabelName(), &surfaceLabel);PYLITH_CHECK_ERROR(err);
+        if (surfaceLabel) {
+            PetscIS pointsIS = NULL;
+            err = DMLabelGetStratumIS(surfaceLabel, faults[iFault]->getSurfaceLabelValue(), &pointsIS);PYLITH_CHECK_ERROR(err);
+            if (pointsIS) {
+                PetscInt numPoints = 0;
+                const PetscInt* points = NULL;
+                err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+                err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+                for (PetscInt i = 0; i < numPoints; ++i) {
+                    if ((points[i] >= fStart) && (points[i] < fEnd)) {
+                        isFaultFace[points[i]-pStart] = 1;
+                    } // if
+                } // for
+                err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+            } // if
+            err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        PetscDMLabel cohesiveLabel = NULL;
+        err = DMGetLabel(dmMesh, faults[iFault]->getCohesiveLabelName(), &cohesiveLabel);PYLITH_CHECK_ERROR(err);
+        if (cohesiveLabel) {
+            PetscIS cohesiveIS = NULL;
+            err = DMLabelGetStratumIS(cohesiveLabel, faults[iFault]->getCohesiveLabelValue(), &cohesiveIS);PYLITH_CHECK_ERROR(err);
+            if (cohesiveIS) {
+                PetscInt numCohesiveCells = 0;
+                const PetscInt* cohesiveCells = NULL;
+                err = ISGetLocalSize(cohesiveIS, &numCohesiveCells);PYLITH_CHECK_ERROR(err);
+                err = ISGetIndices(cohesiveIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);
+                for (PetscInt i = 0; i < numCohesiveCells; ++i) {
+                    const PetscInt* cone = NULL;
+                    isCohesive[cohesiveCells[i]-pStart] = true;
+                    err = DMPlexGetCone(dmMesh, cohesiveCells[i], &cone);PYLITH_CHECK_ERROR(err);
+                    isFaultFace[cone[0]-pStart] = 1;
+                    isFaultFace[cone[1]-pStart] = 1;
+                } // for
+                err = ISRestoreIndices(cohesiveIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);
+            } // if
+            err = ISDestroy(&cohesiveIS);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+
+    // A process with a cell adjacent to a fault face may not have the cohesive cell or the fault label for the face,
+    // so share the marks among all processes with the face.
+    PetscSF sfPoint = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* localPoints = NULL;
+    const PetscSFNode* remotePoints = NULL;
+    err = DMGetPointSF(dmMesh, &sfPoint);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sfPoint, &numRoots, &numLeaves, &localPoints, &remotePoints);PYLITH_CHECK_ERROR(err);
+    if (numRoots >= 0) {
+        std::vector<PetscInt> rootMarks(isFaultFace);
+        std::vector<PetscInt> leafMarks(isFaultFace);
+        err = PetscSFReduceBegin(sfPoint, MPIU_INT, &leafMarks[0], &rootMarks[0], MPI_MAX);PYLITH_CHECK_ERROR(err);
+        err = PetscSFReduceEnd(sfPoint, MPIU_INT, &leafMarks[0], &rootMarks[0], MPI_MAX);PYLITH_CHECK_ERROR(err);
+        err = PetscSFBcastBegin(sfPoint, MPIU_INT, &rootMarks[0], &leafMarks[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+        err = PetscSFBcastEnd(sfPoint, MPIU_INT, &rootMarks[0], &leafMarks[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            isFaultFace[point-pStart] = std::max(rootMarks[point-pStart], leafMarks[point-pStart]);
+        } // for
+    } // if
+
+    // Send the cells (other than cohesive cells) adjacent to fault faces to the other processes sharing the faces.
+    PetscDMLabel ovAdjByRank = NULL;
+    err = DMLabelCreate(PETSC_COMM_SELF, "Overlap adjacency", &ovAdjByRank);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> ownerRanks(pEnd-pStart, -1);
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        ownerRanks[(localPoints ? localPoints[iLeaf] : iLeaf)-pStart] = remotePoints[iLeaf].rank;
+    } // for
+    std::vector<PetscInt> remoteRanks;
+    const PetscInt* rrank = NULL;
+    const PetscInt* nrank = NULL;
+    err = ISGetIndices(rootrank, &rrank);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(leafrank, &nrank);PYLITH_CHECK_ERROR(err);
+    for (PetscInt face = fStart; face < fEnd; ++face) {
+        if (!isFaultFace[face-pStart]) {
+            continue;
+        } // if
+
+        // Ranks of processes sharing the face.
+        remoteRanks.clear();
+        if (ownerRanks[face-pStart] >= 0) {
+            remoteRanks.push_back(ownerRanks[face-pStart]);
+        } // if
+        PetscInt numRanks = 0, offset = 0;
+        err = PetscSectionGetDof(rootSection, face, &numRanks);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(rootSection, face, &offset);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numRanks; ++i) {
+            remoteRanks.push_back(rrank[offset+i]);
+        } // for
+        err = PetscSectionGetDof(leafSection, face, &numRanks);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(leafSection, face, &offset);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numRanks; ++i) {
+            remoteRanks.push_back(nrank[offset+i]);
+        } // for
+        if (remoteRanks.empty()) {
+            continue;
+        } // if
+
+        const PetscInt* support = NULL;
+        PetscInt supportSize = 0;
+        err = DMPlexGetSupportSize(dmMesh, face, &supportSize);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetSupport(dmMesh, face, &support);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iSupport = 0; iSupport < supportSize; ++iSupport) {
+            if (isCohesive[support[iSupport]-pStart]) {
+                continue;
+            } // if
+            for (size_t iRank = 0; iRank < remoteRanks.size(); ++iRank) {
+                if (remoteRanks[iRank] != rank) {
+                    err = DMLabelSetValue(ovAdjByRank, support[iSupport], remoteRanks[iRank]);PYLITH_CHECK_ERROR(err);
+                } // if
+            } // for
+        } // for
+    } // for
+    err = ISRestoreIndices(rootrank, &rrank);PYLITH_CHECK_ERROR(err);
+    err = ISRestoreIndices(leafrank, &nrank);PYLITH_CHECK_ERROR(err);
+
+    // We require the closure in the overlap.
+    err = DMPlexPartitionLabelClosure(dmMesh, ovAdjByRank);PYLITH_CHECK_ERROR(err);
+
+    // Invert sender to receiver label, and add owned points, except for shared local points.
+    err = DMLabelCreate(PETSC_COMM_SELF, "Overlap label", ovLabel);PYLITH_CHECK_ERROR(err);
+    err = DMPlexPartitionLabelInvert(dmMesh, ovAdjByRank, NULL, *ovLabel);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        err = DMLabelSetValue(*ovLabel, point, rank);PYLITH_CHECK_ERROR(err);
+    } // for
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        const PetscInt point = localPoints ? localPoints[iLeaf] : iLeaf;
+        err = DMLabelClearValue(*ovLabel, point, rank);PYLITH_CHECK_ERROR(err);
+        err = DMLabelSetValue(*ovLabel, remotePoints[iLeaf].index, remotePoints[iLeaf].rank);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = DMLabelDestroy(&ovAdjByRank);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(0);
+} // createFaultOverlapLabel
+
+
+// ------------------------------------------------------------------------------------------------
+// Report quality of partition.
+void
+pylith::topology::_Distributor::reportPartition(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    MPI_Comm comm = mesh.getComm();
+    const int commRank = mesh.getCommRank();
+    int commSize = 0;
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    // Points owned by other processes, and number of other processes sharing each owned point.
+    PetscSF sfPoint = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* localPoints = NULL;
+    err = DMGetPointSF(dmMesh, &sfPoint);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sfPoint, &numRoots, &numLeaves, &localPoints, NULL);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> isGhost(pEnd-pStart, 0);
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        isGhost[(localPoints ? localPoints[iLeaf] : iLeaf)-pStart] = 1;
+    } // for
+    std::vector<PetscInt> numSharing(pEnd-pStart, 0);
+    if (numRoots >= 0) {
+        err = PetscSFReduceBegin(sfPoint, MPIU_INT, &isGhost[0], &numSharing[0], MPI_SUM);PYLITH_CHECK_ERROR(err);
+        err = PetscSFReduceEnd(sfPoint, MPIU_INT, &isGhost[0], &numSharing[0], MPI_SUM);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Cells outside the range of simplex or box cells are cohesive cells.
+    enum StatEnum { OWNED_CELLS=0, OWNED_VERTICES=1, COHESIVE_CELLS=2, GHOST_CELLS=3, SHARED_FACES=4, NUM_STATS=5 };
+    PylithReal statsLocal[NUM_STATS] = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+    PetscInt cStart = 0, cEnd = 0, gStart = 0, gEnd = 0;
+    err = DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetSimplexOrBoxCells(dmMesh, 0, &gStart, &gEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        const bool isCohesive = (cell < gStart) || (cell >= gEnd);
+        if (isGhost[cell-pStart]) {
+            statsLocal[GHOST_CELLS] += isCohesive ? 0.0 : 1.0;
+        } else {
+            statsLocal[isCohesive ? COHESIVE_CELLS : OWNED_CELLS] += 1.0;
+        } // if/else
+    } // for
+
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt vertex = vStart; vertex < vEnd; ++vertex) {
+        statsLocal[OWNED_VERTICES] += isGhost[vertex-pStart] ? 0.0 : 1.0;
+    } // for
+
+    // Owned faces (other than faces of cohesive cells) shared with other processes.
+    PetscInt fStart = 0, fEnd = 0;
+    err = DMPlexGetSimplexOrBoxCells(dmMesh, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt face = fStart; face < fEnd; ++face) {
+        statsLocal[SHARED_FACES] += (!isGhost[face-pStart] && numSharing[face-pStart] > 0) ? 1.0 : 0.0;
+    } // for
+
+    PylithReal statsMin[NUM_STATS];
+    PylithReal statsMax[NUM_STATS];
+    PylithReal statsSum[NUM_STATS];
+    err = MPI_Reduce(statsLocal, statsMin, NUM_STATS, MPIU_REAL, MPI_MIN, 0, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Reduce(statsLocal, statsMax, NUM_STATS, MPIU_REAL, MPI_MAX, 0, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Reduce(statsLocal, statsSum, NUM_STATS, MPIU_REAL, MPI_SUM, 0, comm);PYLITH_CHECK_ERROR(err);
+    PylithReal ghostFractionLocal = (statsLocal[OWNED_CELLS] + statsLocal[GHOST_CELLS] > 0.0) ?
+                                    statsLocal[GHOST_CELLS] / (statsLocal[OWNED_CELLS] + statsLocal[GHOST_CELLS]) : 0.0;
+    PylithReal ghostFractionMax = 0.0;
+    err = MPI_Reduce(&ghostFractionLocal, &ghostFractionMax, 1, MPIU_REAL, MPI_MAX, 0, comm);PYLITH_CHECK_ERROR(err);
+
+    if (0 == commRank) {
+        const char* labels[3] = { "Cells", "Vertices", "Cohesive cells" };
+        const StatEnum stats[3] = { OWNED_CELLS, OWNED_VERTICES, COHESIVE_CELLS };
+        std::ostringstream msg;
+        msg << "Partition quality for " << commSize << " processes:\n"
+            << "  " << std::left << std::setw(16) << "Owned" << std::right << std::setw(12) << "Min"
+            << std::setw(12) << "Mean" << std::setw(12) << "Max" << std::setw(12) << "Imbalance" << "\n";
+        for (int i = 0; i < 3; ++i) {
+            const PylithReal mean = statsSum[stats[i]] / commSize;
+            msg << "  " << std::left << std::setw(16) << labels[i] << std::right << std::fixed << std::setprecision(0)
+                << std::setw(12) << statsMin[stats[i]] << std::setw(12) << mean << std::setw(12) << statsMax[stats[i]]
+                << std::setprecision(3) << std::setw(12) << ((mean > 0.0) ? statsMax[stats[i]] / mean : 1.0) << "\n";
+        } // for
+        const PylithReal numCellsGlobal = statsSum[OWNED_CELLS] + statsSum[GHOST_CELLS];
+        msg << std::setprecision(0)
+            << "  Shared faces (edge cut): " << statsSum[SHARED_FACES] << "\n"
+            << std::setprecision(3)
+            << "  Ghost cells: fraction " << ((numCellsGlobal > 0.0) ? statsSum[GHOST_CELLS] / numCellsGlobal : 0.0)
+            << ", max fraction on a process " << ghostFractionMax;
+
+        pythia::journal::info_t info("mesh_distributor");
+        info << pythia::journal::at(__HERE__) << msg.str() << pythia::journal::endl;
+    } // if
+
+    PYLITH_METHOD_END;
+} // reportPartition
+
+
+// ------------------------------------------------------------------------------------------------
+// Partition mesh using cell weights and set the resulting partition in the partitioner of the mesh.
+void
+pylith::topology::_Distributor::setWeightedPartition(PetscDM dmMesh,
+                                                     const char* partitionerName,
+                                                     pylith::faults::FaultCohesive* faults[],
+                                                     const int numFaults,
+                                                     const std::map<int, int>& materialWeights,
+                                                     const int* faultWeights) {
+    PYLITH_METHOD_BEGIN;
+    assert(dmMesh);
+    assert(!numFaults || faultWeights);
+
+    PetscErrorCode err = 0;
+    MPI_Comm comm = PetscObjectComm((PetscObject) dmMesh);
+    PetscMPIInt commSize = 0;
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+    // Weights of cells from material label values; unlabeled cells have unit weight.
+    pylith::topology::Stratum cellsStratum(dmMesh, pylith::topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    std::vector<PetscInt> cellWeights(cEnd-cStart, 1);
+
+    PetscDMLabel materialLabel = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::cells_label_name, &materialLabel);PYLITH_CHECK_ERROR(err);
+    if (materialLabel) {
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            PetscInt materialId = -1;
+            err = DMLabelGetValue(materialLabel, cell, &materialId);PYLITH_CHECK_ERROR(err);
+            const std::map<int, int>::const_iterator iter = materialWeights.find(materialId);
+            if (iter != materialWeights.end()) {
+                cellWeights[cell-cStart] = iter->second;
+            } // if
+        } // for
+    } // if
+
+    // The weight of a cohesive cell is split between the cells on either side of the fault, so that the work of
+    // the fault is accounted for whether or not cohesive cells are vertices of the partitioner graph.
+    for (int iFault = 0; iFault < numFaults; ++iFault) {
+        PetscDMLabel cohesiveLabel = NULL;
+        err = DMGetLabel(dmMesh, faults[iFault]->getCohesiveLabelName(), &cohesiveLabel);PYLITH_CHECK_ERROR(err);
+        if (!cohesiveLabel) {
+            continue;
+        } // if
+        PetscIS cohesiveIS = NULL;
+        PetscInt numCohesiveCells = 0;
+        const PetscInt* cohesiveCells = NULL;
+        err = DMLabelGetStratumIS(cohesiveLabel, faults[iFault]->getCohesiveLabelValue(), &cohesiveIS);PYLITH_CHECK_ERROR(err);
+        if (cohesiveIS) {
+            err = ISGetLocalSize(cohesiveIS, &numCohesiveCells);PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(cohesiveIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);
+        } // if
+        const PetscInt sideWeight = (faultWeights[iFault] + 1) / 2;
+        for (PetscInt iCohesive = 0; iCohesive < numCohesiveCells; ++iCohesive) {
+            const PetscInt cohesiveCell = cohesiveCells[iCohesive];
+            if ((cohesiveCell < cStart) || (cohesiveCell >= cEnd)) {
+                continue;
+            } // if
+            const PetscInt* cone = NULL;
+            err = DMPlexGetCone(dmMesh, cohesiveCell, &cone);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iSide = 0; iSide < 2; ++iSide) {
+                const PetscInt* support = NULL;
+                PetscInt supportSize = 0;
+                err = DMPlexGetSupportSize(dmMesh, cone[iSide], &supportSize);PYLITH_CHECK_ERROR(err);
+                err = DMPlexGetSupport(dmMesh, cone[iSide], &support);PYLITH_CHECK_ERROR(err);
+                for (PetscInt iSupport = 0; iSupport < supportSize; ++iSupport) {
+                    if (support[iSupport] != cohesiveCell) {
+                        cellWeights[support[iSupport]-cStart] += sideWeight;
+                    } // if
+                } // for
+            } // for
+        } // for
+        if (cohesiveIS) {
+            err = ISRestoreIndices(cohesiveIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = ISDestroy(&cohesiveIS);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Partitioner graph with vertices for the local cells in the graph.
+    PetscInt numVertices = 0;
+    PetscInt* offsets = NULL;
+    PetscInt* adjacency = NULL;
+    PetscIS globalNumbering = NULL;
+    err = DMPlexCreatePartitionerGraph(dmMesh, 0, &numVertices, &offsets, &adjacency, &globalNumbering);PYLITH_CHECK_ERROR(err);
+
+    PetscInt gStart = 0, gEnd = 0;
+    err = DMPlexGetSimplexOrBoxCells(dmMesh, 0, &gStart, &gEnd);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> vertexCells(numVertices);
+    PetscSection vertexSection = NULL;
+    err = PetscSectionCreate(PETSC_COMM_SELF, &vertexSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionSetChart(vertexSection, 0, numVertices);PYLITH_CHECK_ERROR(err);
+    const PetscInt* gids = NULL;
+    err = ISGetIndices(globalNumbering, &gids);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = gStart, iVertex = 0; cell < gEnd; ++cell) {
+        if (gids[cell-gStart] < 0) {
+            continue;
+        } // if
+        assert(iVertex < numVertices);
+        vertexCells[iVertex] = cell;
+        err = PetscSectionSetDof(vertexSection, iVertex, cellWeights[cell-cStart]);PYLITH_CHECK_ERROR(err);
+        ++iVertex;
+    } // for
+    err = ISRestoreIndices(globalNumbering, &gids);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionSetUp(vertexSection);PYLITH_CHECK_ERROR(err);
+
+    PetscPartitioner weightedPartitioner = NULL;
+    PetscSection partSection = NULL;
+    PetscIS partition = NULL;
+    err = PetscPartitionerCreate(comm, &weightedPartitioner);PYLITH_CHECK_ERROR(err);
+    err = PetscPartitionerSetType(weightedPartitioner, partitionerName);PYLITH_CHECK_ERROR(err);
+    err = PetscPartitionerSetUp(weightedPartitioner);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionCreate(comm, &partSection);PYLITH_CHECK_ERROR(err);
+    err = PetscPartitionerPartition(weightedPartitioner, commSize, numVertices, offsets, adjacency, vertexSection, NULL,
+                                    partSection, &partition);PYLITH_CHECK_ERROR(err);
+
+    // Convert partition of graph vertices to partition of cells.
+    std::vector<PetscInt> partSizes(commSize, 0);
+    for (PetscMPIInt iRank = 0; iRank < commSize; ++iRank) {
+        err = PetscSectionGetDof(partSection, iRank, &partSizes[iRank]);PYLITH_CHECK_ERROR(err);
+    } // for
+    PetscInt numPoints = 0;
+    const PetscInt* partVertices = NULL;
+    err = ISGetLocalSize(partition, &numPoints);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(partition, &partVertices);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> partPoints(numPoints);
+    for (PetscInt i = 0; i < numPoints; ++i) {
+        partPoints[i] = vertexCells[partVertices[i]];
+    } // for
+    err = ISRestoreIndices(partition, &partVertices);PYLITH_CHECK_ERROR(err);
+
+    PetscPartitioner partitioner = NULL;
+    err = DMPlexGetPartitioner(dmMesh, &partitioner);PYLITH_CHECK_ERROR(err);
+    err = PetscPartitionerSetType(partitioner, PETSCPARTITIONERSHELL);PYLITH_CHECK_ERROR(err);
+    err = PetscPartitionerShellSetPartition(partitioner, commSize, partSizes.data(),
+                                            numPoints > 0 ? partPoints.data() : NULL);PYLITH_CHECK_ERROR(err);
+
+    err = ISDestroy(&partition);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionDestroy(&partSection);PYLITH_CHECK_ERROR(err);
+    err = PetscPartitionerDestroy(&weightedPartitioner);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionDestroy(&vertexSection);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&globalNumbering);PYLITH_CHECK_ERROR(err);
+    err = PetscFree(offsets);PYLITH_CHECK_ERROR(err);
+    err = PetscFree(adjacency);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setWeightedPartition
+
+
 // End of file
@@ -52,15 +52,33 @@ public:
      * @param[in] faults Array of fault interfaces.
      * @param[in] numFaults Number of fault interfaces.
      * @param[in] partitionerName Name of PETSc partitioner to use in distributing mesh.
+     * @param[in] materialIds Array of material label values for cell weights.
+     * @param[in] numMaterialIds Number of material label values.
+     * @param[in] materialWeights Array of weights for cells in each material.
+     * @param[in] numMaterialWeights Number of material weights.
+     * @param[in] faultWeights Array of weights for cohesive cells in each fault.
+     * @param[in] numFaultWeights Number of fault weights.
+     *
+     * If no material weights are given, all cells have the same weight. Otherwise, the partitioner balances the
+     * sum of the cell weights, with the weight of each cohesive cell split between the two adjacent cells.
      */
     static
     void distribute(pylith::topology::Mesh* const newMesh,
                     const pylith::topology::Mesh& origMesh,
                     pylith::faults::FaultCohesive* faults[],
                     const int numFaults,
-                    const char* partitionerName);
+                    const char* partitionerName,
+                    const int* materialIds,
+                    const int numMaterialIds,
+                    const int* materialWeights,
+                    const int numMaterialWeights,
+                    const int* faultWeights,
+                    const int numFaultWeights);
 
-    /** Write partitioning info for distributed mesh.
+    /** Write partitioning info for distributed mesh and report quality of partition.
+     *
+     * The report includes the number of cells, vertices, and cohesive cells owned by each process, the number of
+     * faces shared among processes, and the fraction of ghost cells.
      *
      * @param writer Data writer for partition information.
      * @param mesh Distributed mesh.
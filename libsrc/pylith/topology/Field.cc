@@ -28,6 +28,7 @@
 #include "pylith/faults/TopologyOps.hh" // USES getInterfacesLabel()
 
 #include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
@@ -37,6 +38,8 @@
 #include <cassert> // USES assert()
 #include <iostream> // USES std::cout
 #include <iomanip> // USES std::setw()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
 
 namespace pylith {
     namespace topology {
@@ -69,7 +72,8 @@ pylith::topology::Field::Field(const pylith::topology::Mesh& mesh) :
     _mesh(NULL),
     _localVec(NULL),
     _globalVec(NULL),
-    _outputVec(NULL) {
+    _outputVec(NULL),
+    _sharesLayout(false) {
     PYLITH_METHOD_BEGIN;
 
     GenericComponent::setName("field");
@@ -86,7 +90,8 @@ pylith::topology::Field::Field(const Field& src) :
     _mesh(NULL),
     _localVec(NULL),
     _globalVec(NULL),
-    _outputVec(NULL) {
+    _outputVec(NULL),
+    _sharesLayout(false) {
     PYLITH_METHOD_BEGIN;
 
     _subfields = src._subfields;
@@ -103,6 +108,44 @@ pylith::topology::Field::Field(const Field& src) :
     assert(!_localVec);
     err = DMCreateLocalVector(_mesh->getDM(), &_localVec);PYLITH_CHECK_ERROR(err);
     err = VecSet(_localVec, 0.0);PYLITH_CHECK_ERROR(err);
+    _recordMemory();
+
+    PYLITH_METHOD_END;
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Constructor for field sharing the layout of another field.
+pylith::topology::Field::Field(const Field& src,
+                               const char* label) :
+    _mesh(NULL),
+    _localVec(NULL),
+    _globalVec(NULL),
+    _outputVec(NULL),
+    _sharesLayout(true) {
+    PYLITH_METHOD_BEGIN;
+
+    _subfields = src._subfields;
+    _label = label;
+
+    if (!src._mesh) {
+        PYLITH_JOURNAL_LOGICERROR("Source field _mesh must be non-NULL.");
+    } // if
+
+    // Reference the DM of the source field; the mesh releases the reference when it is destroyed.
+    PetscErrorCode err;
+    PetscDM dm = src._mesh->getDM();assert(dm);
+    const char* dmName = NULL;
+    err = PetscObjectReference((PetscObject) dm);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectGetName((PetscObject) dm, &dmName);PYLITH_CHECK_ERROR(err);
+    _mesh = new pylith::topology::Mesh();assert(_mesh);
+    _mesh->setCoordSys(src._mesh->getCoordSys());
+    _mesh->setDM(dm, dmName);
+
+    err = DMCreateLocalVector(dm, &_localVec);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) _localVec, _label.c_str());PYLITH_CHECK_ERROR(err);
+    err = VecSet(_localVec, 0.0);PYLITH_CHECK_ERROR(err);
+    _recordMemory();
 
     PYLITH_METHOD_END;
 } // constructor
@@ -127,6 +170,7 @@ pylith::topology::Field::deallocate(void) {
     err = VecDestroy(&_localVec);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_globalVec);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_outputVec);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryLogger::release(this);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -167,7 +211,7 @@ pylith::topology::Field::setLabel(const char* value) {
     PetscErrorCode err;
 
     _label = value;
-    if (_mesh->getDM()) {
+    if (_mesh->getDM() && !_sharesLayout) {
         err = PetscObjectSetName((PetscObject) _mesh->getDM(), value);PYLITH_CHECK_ERROR(err);
     } // of
     if (_localVec) {
@@ -179,6 +223,10 @@ pylith::topology::Field::setLabel(const char* value) {
     if (_outputVec) {
         err = PetscObjectSetName((PetscObject) _outputVec, value);PYLITH_CHECK_ERROR(err);
     } // if
+    if (_localVec) {
+        pylith::utils::MemoryLogger::release(this);
+        _recordMemory();
+    } // if
 
     PYLITH_METHOD_END;
 } // setLabel
@@ -222,6 +270,9 @@ pylith::topology::Field::getLocalVector(void) const {
 // Get global vector.
 PetscVec
 pylith::topology::Field::getGlobalVector(void) const {
+    if (!_globalVec && _sharesLayout) {
+        const_cast<Field*>(this)->createGlobalVector();
+    } // if
     return _globalVec;
 }
 
@@ -279,6 +330,74 @@ pylith::topology::Field::getStorageSize(void) const {
 } // getStorageSize
 
 
+// ------------------------------------------------------------------------------------------------
+// Get values of the local vector without copying them.
+void
+pylith::topology::Field::getLocalArray(PylithScalar** values,
+                                       int* numValues) const {
+    PYLITH_METHOD_BEGIN;
+    assert(values);
+    assert(numValues);
+
+    if (!_localVec) {
+        std::ostringstream msg;
+        msg << "Cannot get values of field '" << getLabel() << "'. Local vector has not been allocated.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    PetscInt size = 0;
+    PetscScalar* array = NULL;
+    PetscErrorCode err;
+    err = VecGetLocalSize(_localVec, &size);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(_localVec, &array);PYLITH_CHECK_ERROR(err);
+    *values = array;
+    *numValues = size;
+    // VecRestoreArray() resets the pointer it is given, but the storage of the local vector does not move.
+    err = VecRestoreArray(_localVec, &array);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // getLocalArray
+
+
+// ------------------------------------------------------------------------------------------------
+// Get layout of subfield in the local vector.
+void
+pylith::topology::Field::getSubfieldLayout(const char* name,
+                                           int* offsets,
+                                           const int numOffsets,
+                                           int* numDof,
+                                           const int numNumDof) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+
+    const SubfieldInfo& info = getSubfieldInfo(name);
+
+    PetscSection s = NULL;
+    PylithInt pStart = 0, pEnd = 0;
+    PetscErrorCode err;
+    err = DMGetSection(_mesh->getDM(), &s);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetChart(s, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    if ((numOffsets != pEnd-pStart) || (numNumDof != pEnd-pStart)) {
+        std::ostringstream msg;
+        msg << "Size of arrays for layout of subfield '" << name << "' (" << numOffsets << ", " << numNumDof
+            << ") does not match chart size (" << pEnd-pStart << ") of field '" << getLabel() << "'.";
+        throw std::invalid_argument(msg.str());
+    } // if
+    assert(offsets);
+    assert(numDof);
+
+    for (PylithInt point = pStart; point < pEnd; ++point) {
+        PylithInt off = 0, dof = 0;
+        err = PetscSectionGetFieldOffset(s, point, info.index, &off);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldDof(s, point, info.index, &dof);PYLITH_CHECK_ERROR(err);
+        offsets[point-pStart] = off;
+        numDof[point-pStart] = dof;
+    } // for
+
+    PYLITH_METHOD_END;
+} // getSubfieldLayout
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::topology::Field::createDiscretization(void) {
@@ -316,6 +435,7 @@ pylith::topology::Field::allocate(void) {
     err = DMCreateLocalVector(dm, &_localVec);PYLITH_CHECK_ERROR(err);
     err = PetscObjectSetName((PetscObject) _localVec,  _label.c_str());PYLITH_CHECK_ERROR(err);
     err = VecSet(_localVec, 0.0);PYLITH_CHECK_ERROR(err);
+    _recordMemory();
 
     PYLITH_METHOD_END;
 } // allocate
@@ -434,6 +554,40 @@ pylith::topology::Field::scatterVectorToLocal(const PetscVec vector,
 } // scatterVectorToLocal
 
 
+// ------------------------------------------------------------------------------------------------
+// Start scattering global information across processors to update the local view of the field.
+void
+pylith::topology::Field::scatterVectorToLocalBegin(const PetscVec vector,
+                                                   InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(vector);
+
+    PetscErrorCode err;
+    assert(_localVec);
+    err = DMGlobalToLocalBegin(_mesh->getDM(), vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scatterVectorToLocalBegin
+
+
+// ------------------------------------------------------------------------------------------------
+// Finish scattering global information across processors to update the local view of the field.
+void
+pylith::topology::Field::scatterVectorToLocalEnd(const PetscVec vector,
+                                                 InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(vector);
+
+    PetscErrorCode err;
+    assert(_localVec);
+    err = DMGlobalToLocalEnd(_mesh->getDM(), vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scatterVectorToLocalEnd
+
+
 // ------------------------------------------------------------------------------------------------
 // Scatter section information across processors to update the
 // output view of the field.
@@ -635,6 +789,7 @@ pylith::topology::Field::createGlobalVector(void) {
     PetscErrorCode err = VecDestroy(&_globalVec);PYLITH_CHECK_ERROR(err);
     err = DMCreateGlobalVector(_mesh->getDM(), &_globalVec);PYLITH_CHECK_ERROR(err);assert(_globalVec);
     err = PetscObjectSetName((PetscObject) _globalVec, getLabel());PYLITH_CHECK_ERROR(err);
+    _recordMemory();
 
     PYLITH_METHOD_END;
 }
@@ -662,11 +817,56 @@ pylith::topology::Field::createOutputVector(void) {
 
     err = DMCreateGlobalVector(dmOutput, &_outputVec);PYLITH_CHECK_ERROR(err);assert(_outputVec);
     err = PetscObjectSetName((PetscObject) _outputVec, getLabel());PYLITH_CHECK_ERROR(err);
+    _recordMemory();
 
     PYLITH_METHOD_END;
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Record memory used by the vectors of the field, divided among the subfields.
+void
+pylith::topology::Field::_recordMemory(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err;
+    PetscInt numBytes = 0;
+    const PetscVec vectors[3] = { _localVec, _globalVec, _outputVec };
+    for (size_t i = 0; i < 3; ++i) {
+        if (vectors[i]) {
+            PetscInt localSize = 0;
+            err = VecGetLocalSize(vectors[i], &localSize);PYLITH_CHECK_ERROR(err);
+            numBytes += localSize * sizeof(PetscScalar);
+        } // if
+    } // for
+
+    // Divide memory among subfields by fraction of degrees of freedom in the local section.
+    PetscSection section = getLocalSection();
+    PetscInt numFields = 0;
+    err = PetscSectionGetNumFields(section, &numFields);PYLITH_CHECK_ERROR(err);
+    if (numFields != PetscInt(_subfields.size()) || !numFields) {
+        pylith::utils::MemoryLogger::record(this, _label.c_str(), "vectors", numBytes);
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscInt pStart = 0, pEnd = 0, storageSize = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetStorageSize(section, &storageSize);PYLITH_CHECK_ERROR(err);
+    for (subfields_type::const_iterator iter = _subfields.begin(); iter != _subfields.end(); ++iter) {
+        PetscInt numDof = 0;
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt fiberDof = 0;
+            err = PetscSectionGetFieldDof(section, point, iter->second.index, &fiberDof);PYLITH_CHECK_ERROR(err);
+            numDof += fiberDof;
+        } // for
+        const size_t subfieldBytes = storageSize > 0 ? size_t(double(numBytes) * numDof / storageSize) : 0;
+        pylith::utils::MemoryLogger::record(this, _label.c_str(), iter->first.c_str(), subfieldBytes);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _recordMemory
+
+
 // ------------------------------------------------------------------------------------------------
 // View field layout.
 void
@@ -94,6 +94,18 @@ public:
      */
     Field(const Field& src);
 
+    /** Constructor for field sharing the layout of another field.
+     *
+     * The field references the PETSc DM (and its sections) of the source field instead of creating copies, so
+     * only the local vector is allocated. The global vector is allocated on the first call to getGlobalVector().
+     * The layout of the source field must not change while this field exists.
+     *
+     * @param[in] src Field to share layout with.
+     * @param[in] label Label for field.
+     */
+    Field(const Field& src,
+          const char* label);
+
     /// Destructor.
     ~Field(void);
 
@@ -143,6 +155,8 @@ public:
     PetscVec getLocalVector(void) const;
 
     /** Get the global PETSc Vec.
+     *
+     * If the field shares the layout of another field, the vector is created if it does not exist.
      *
      * @returns PETSc Vec object.
      */
@@ -172,6 +186,32 @@ public:
      */
     PylithInt getStorageSize(void) const;
 
+    /** Get values of the local vector without copying them.
+     *
+     * The array points to the storage of the local vector, so it is valid until the field is deallocated. Values
+     * are ordered by the local section and include constrained degrees of freedom. Changing values through the
+     * array does not increase the PETSc object state of the local vector.
+     *
+     * @param[out] values Array of values in local vector.
+     * @param[out] numValues Number of values in local vector.
+     */
+    void getLocalArray(PylithScalar** values,
+                       int* numValues) const;
+
+    /** Get layout of subfield in the local vector.
+     *
+     * @param[in] name Name of subfield.
+     * @param[out] offsets Offset of subfield in local vector for each point in chart [chartSize].
+     * @param[in] numOffsets Size of offsets array.
+     * @param[out] numDof Number of degrees of freedom of subfield for each point in chart [chartSize].
+     * @param[in] numNumDof Size of numDof array.
+     */
+    void getSubfieldLayout(const char* name,
+                           int* offsets,
+                           const int numOffsets,
+                           int* numDof,
+                           const int numNumDof) const;
+
     /** Create discretization for field.
      *
      * @important Should be called for all fields after
@@ -201,7 +241,7 @@ public:
      * @param[in] dimension Dimension of points for discretization.
      * @param[in] isFaultOnly True if subfield is limited to fault degrees of freedom.
      * @param[in] cellBasis Type of basis functions to use (e.g., simplex, tensor, or default).
-     * @param[in] feSpace Finite-element space (POLYNOMIAL_SPACE or POINT_SPACE).
+     * @param[in] feSpace Finite-element space (POLYNOMIAL_SPACE, POINT_SPACE, or GLL_SPACE).
      * @param[in] isBasisContinuous True if basis is continuous.
      */
     void subfieldAdd(const char *name,
@@ -283,6 +323,25 @@ public:
     void scatterVectorToLocal(const PetscVec vector,
                               InsertMode mode=INSERT_VALUES) const;
 
+    /** Start scattering global information across processors to update the local view of the field.
+     *
+     * Values of points owned by this process are available in the local vector on return; ghost values are available
+     * after scatterVectorToLocalEnd().
+     *
+     * @param[in] vector PETSc vector used in update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterVectorToLocalBegin(const PetscVec vector,
+                                   InsertMode mode=INSERT_VALUES) const;
+
+    /** Finish scattering global information across processors to update the local view of the field.
+     *
+     * @param[in] vector PETSc vector used in update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterVectorToLocalEnd(const PetscVec vector,
+                                 InsertMode mode=INSERT_VALUES) const;
+
     /** Scatter section information across processors to update the
      * output view of the field.
      *
@@ -301,6 +360,12 @@ private:
 
     typedef std::map<std::string, SubfieldInfo> subfields_type;
 
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Record memory used by the vectors of the field, divided among the subfields.
+    void _recordMemory(void) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -311,6 +376,7 @@ private:
     PetscVec _localVec; ///< Local PETSc vector.
     PetscVec _globalVec; ///< Global PETSc vector.
     PetscVec _outputVec; ///< Global PETSc vector without constrained DOF for output.
+    bool _sharesLayout; ///< True if field shares PETSc DM with another field.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
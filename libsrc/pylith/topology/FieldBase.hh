@@ -56,6 +56,7 @@ public:
     enum SpaceEnum {
         POLYNOMIAL_SPACE=0, ///< Polynomial finite-element space.
         POINT_SPACE=1, ///< Point finite-element space.
+        GLL_SPACE=2, ///< Polynomial space with Gauss-Lobatto-Legendre nodes and collocated quadrature (spectral element).
     }; // SpaceEnum
 
     enum CellBasis {
@@ -156,12 +157,10 @@ public:
             if (cellBasis          != rhs.cellBasis) {return false;}
             if (feSpace            != rhs.feSpace) {return false;}
             if (isBasisContinuous  != rhs.isBasisContinuous) {return false;}
-            // return true;
-            return false;
+            return true;
         } // operator=
 
         bool operator<(const Discretization rhs) const {
-            return true;
             if (basisOrder < rhs.basisOrder) {return true;}
             if (basisOrder == rhs.basisOrder) {
                 if (quadOrder < rhs.quadOrder) {return true;}
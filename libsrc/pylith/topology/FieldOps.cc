@@ -30,6 +30,41 @@
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 
 #include "petscdm.h" // USES PetscDM
+#include "petscdt.h" // USES PetscDTGaussLobattoLegendreQuadrature()
+
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _FieldOps {
+public:
+
+            /** Create tensor-product Gauss-Lobatto-Legendre quadrature on reference cell [-1,1]^dim.
+             *
+             * @param[out] quadrature Quadrature.
+             * @param[in] dim Dimension of reference cell.
+             * @param[in] numPoints1D Number of points in each direction (at least 2).
+             */
+            static
+            void createGLLQuadrature(PetscQuadrature* quadrature,
+                                     const int dim,
+                                     const int numPoints1D);
+
+            /** Set functionals of dual space for point space to evaluation of each component at each quadrature point.
+             *
+             * @param[inout] dualspace Dual space (PETSCDUALSPACESIMPLE type is set here).
+             * @param[in] quadrature Quadrature with points of point space.
+             * @param[in] numComponents Number of components.
+             */
+            static
+            void setPointFunctionals(PetscDualSpace dualspace,
+                                     PetscQuadrature quadrature,
+                                     const int numComponents);
+
+        }; // _FieldOps
+    } // topology
+} // pylith
 
 std::map<pylith::topology::FieldBase::Discretization, pylith::topology::FE> pylith::topology::FieldOps::feStore = std::map<pylith::topology::FieldBase::Discretization, pylith::topology::FE>();
 
@@ -64,18 +99,47 @@ pylith::topology::FieldOps::createFE(const FieldBase::Discretization& feinfo,
         const PetscBool simplexBasis = pylith::topology::FieldBase::SIMPLEX_BASIS == feKey.cellBasis ? PETSC_TRUE : PETSC_FALSE;
         const PetscBool useTensor = pylith::topology::FieldBase::TENSOR_BASIS == feKey.cellBasis ? PETSC_TRUE : PETSC_FALSE;
         const PetscBool basisContinuity = feKey.isBasisContinuous ? PETSC_TRUE : PETSC_FALSE;
+        const bool isGLL = FieldBase::GLL_SPACE == feKey.feSpace;
+        if (isGLL && (dim > 1) && !useTensor) {
+            throw std::runtime_error("Gauss-Lobatto-Legendre (spectral element) discretization requires quadrilateral or "
+                                     "hexahedral cells.");
+        } // if
+
+        const bool isPoint = FieldBase::POINT_SPACE == feKey.feSpace;
+
+        // Create quadrature
+        PetscQuadrature quadrature = NULL;
+        PetscQuadrature faceQuadrature = NULL;
+        DMPolytopeType ct;
+        switch (dim) {
+          case 0: ct = DM_POLYTOPE_POINT;break;
+          case 1: ct = DM_POLYTOPE_SEGMENT;break;
+          case 2: ct = useTensor ? DM_POLYTOPE_QUADRILATERAL : DM_POLYTOPE_TRIANGLE;break;
+          case 3: ct = useTensor ? DM_POLYTOPE_HEXAHEDRON : DM_POLYTOPE_TETRAHEDRON;break;
+          default: throw std::logic_error("Cannot handle dimension");
+        }
+        if (isGLL && (dim > 0)) {
+            // Quadrature points coincide with the nodes when the quadrature order matches the basis order, so the
+            // mass matrix is diagonal.
+            _FieldOps::createGLLQuadrature(&quadrature, dim, quadOrder+1);
+            _FieldOps::createGLLQuadrature(&faceQuadrature, dim-1, quadOrder+1);
+        } else {
+            err = PetscDTCreateDefaultQuadrature(ct, quadOrder, &quadrature, &faceQuadrature);PYLITH_CHECK_ERROR(err);
+        } // if/else
 
         // Create space
         PetscSpace space = NULL;
         err = PetscSpaceCreate(PETSC_COMM_SELF, &space);PYLITH_CHECK_ERROR(err);assert(space);
-        err = PetscSpaceSetType(space, feKey.feSpace == FieldBase::POLYNOMIAL_SPACE ?
-                                PETSCSPACEPOLYNOMIAL : PETSCSPACEPOINT);PYLITH_CHECK_ERROR(err);
+        err = PetscSpaceSetType(space, !isPoint ? PETSCSPACEPOLYNOMIAL : PETSCSPACEPOINT);PYLITH_CHECK_ERROR(err);
         err = PetscSpaceSetNumComponents(space, numComponents);PYLITH_CHECK_ERROR(err);
-        err = PetscSpaceSetDegree(space, basisOrder, PETSC_DETERMINE);
-        if (feKey.feSpace == FieldBase::POLYNOMIAL_SPACE) {
-            err = PetscSpacePolynomialSetTensor(space, useTensor);PYLITH_CHECK_ERROR(err);
-        } // if
         err = PetscSpaceSetNumVariables(space, dim);PYLITH_CHECK_ERROR(err);
+        if (!isPoint) {
+            err = PetscSpaceSetDegree(space, basisOrder, PETSC_DETERMINE);
+            err = PetscSpacePolynomialSetTensor(space, useTensor);PYLITH_CHECK_ERROR(err);
+        } else {
+            // Values are stored at the quadrature points, so tabulating the basis at the quadrature points is an identity.
+            err = PetscSpacePointSetPoints(space, quadrature);PYLITH_CHECK_ERROR(err);
+        } // if/else
         err = PetscSpaceSetUp(space);PYLITH_CHECK_ERROR(err);
 
         // Create dual space
@@ -86,10 +150,18 @@ pylith::topology::FieldOps::createFE(const FieldBase::Discretization& feinfo,
         err = PetscDualSpaceSetDM(dualspace, dmCell);PYLITH_CHECK_ERROR(err);
         err = DMDestroy(&dmCell);PYLITH_CHECK_ERROR(err);
         err = PetscDualSpaceSetNumComponents(dualspace, numComponents);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceSetType(dualspace, PETSCDUALSPACELAGRANGE);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceLagrangeSetTensor(dualspace, useTensor);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceSetOrder(dualspace, basisOrder);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceLagrangeSetContinuity(dualspace, basisContinuity);
+        if (!isPoint) {
+            err = PetscDualSpaceSetType(dualspace, PETSCDUALSPACELAGRANGE);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceLagrangeSetTensor(dualspace, useTensor);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceSetOrder(dualspace, basisOrder);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceLagrangeSetContinuity(dualspace, basisContinuity);
+            if (isGLL) {
+                // Gauss-Jacobi nodes with endpoints and zero exponent are the Gauss-Lobatto-Legendre nodes.
+                err = PetscDualSpaceLagrangeSetNodeType(dualspace, PETSCDTNODES_GAUSSJACOBI, PETSC_TRUE, 0.0);PYLITH_CHECK_ERROR(err);
+            } // if
+        } else {
+            _FieldOps::setPointFunctionals(dualspace, quadrature, numComponents);
+        } // if/else
         err = PetscDualSpaceSetUp(dualspace);PYLITH_CHECK_ERROR(err);
 
         // Create element
@@ -102,30 +174,34 @@ pylith::topology::FieldOps::createFE(const FieldBase::Discretization& feinfo,
         err = PetscSpaceDestroy(&space);PYLITH_CHECK_ERROR(err);
         err = PetscDualSpaceDestroy(&dualspace);PYLITH_CHECK_ERROR(err);
 
-        // Create quadrature
-        PetscQuadrature quadrature = NULL;
-        PetscQuadrature faceQuadrature = NULL;
-        DMPolytopeType ct;
-        switch (dim) {
-          case 0: ct = DM_POLYTOPE_POINT;break;
-          case 1: ct = DM_POLYTOPE_SEGMENT;break;
-          case 2: ct = useTensor ? DM_POLYTOPE_QUADRILATERAL : DM_POLYTOPE_TRIANGLE;break;
-          case 3: ct = useTensor ? DM_POLYTOPE_HEXAHEDRON : DM_POLYTOPE_TETRAHEDRON;break;
-          default: throw std::logic_error("Cannot handle dimension");
-        }
-        err = PetscDTCreateDefaultQuadrature(ct, quadOrder, &quadrature, &faceQuadrature);PYLITH_CHECK_ERROR(err);
         err = PetscFESetQuadrature(fe, quadrature);PYLITH_CHECK_ERROR(err);
         err = PetscQuadratureDestroy(&quadrature);PYLITH_CHECK_ERROR(err);
         err = PetscFESetFaceQuadrature(fe, faceQuadrature);PYLITH_CHECK_ERROR(err);
         err = PetscQuadratureDestroy(&faceQuadrature);PYLITH_CHECK_ERROR(err);
 
-        assert(feKey.feSpace == FieldBase::POLYNOMIAL_SPACE);
         pylith::topology::FieldOps::feStore.insert(std::pair<FieldBase::Discretization, pylith::topology::FE>(feKey, fe));
     } else {
-        throw std::logic_error("FieldOps::createFE() :TODO: Can't reuse PetscFE due to naming of fields, so make a deep copy of fe.");
-        fe = hasFE->second._fe;
-        err = PetscObjectReference((PetscObject) fe);PYLITH_CHECK_ERROR(err);
-    }
+        // Fields set the name of the PetscFE, so each field gets its own lightweight PetscFE that shares the
+        // immutable basis space, dual space, and quadrature of the cached PetscFE.
+        const PetscFE feCached = hasFE->second._fe;assert(feCached);
+        PetscSpace space = NULL;
+        PetscDualSpace dualspace = NULL;
+        PetscQuadrature quadrature = NULL;
+        PetscQuadrature faceQuadrature = NULL;
+        err = PetscFEGetBasisSpace(feCached, &space);PYLITH_CHECK_ERROR(err);
+        err = PetscFEGetDualSpace(feCached, &dualspace);PYLITH_CHECK_ERROR(err);
+        err = PetscFEGetQuadrature(feCached, &quadrature);PYLITH_CHECK_ERROR(err);
+        err = PetscFEGetFaceQuadrature(feCached, &faceQuadrature);PYLITH_CHECK_ERROR(err);
+
+        err = PetscFECreate(PETSC_COMM_SELF, &fe);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetType(fe, PETSCFEBASIC);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetBasisSpace(fe, space);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetDualSpace(fe, dualspace);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetNumComponents(fe, numComponents);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetUp(fe);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetQuadrature(fe, quadrature);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetFaceQuadrature(fe, faceQuadrature);PYLITH_CHECK_ERROR(err);
+    } // if/else
 
     PYLITH_METHOD_RETURN(fe);
 } // createFE
@@ -262,4 +338,88 @@ pylith::topology::FieldOps::layoutsMatch(const pylith::topology::Field& fieldA,
 } // layoutsMatch
 
 
+// ------------------------------------------------------------------------------------------------
+// Create tensor-product Gauss-Lobatto-Legendre quadrature on reference cell [-1,1]^dim.
+void
+pylith::topology::_FieldOps::createGLLQuadrature(PetscQuadrature* quadrature,
+                                                 const int dim,
+                                                 const int numPoints1D) {
+    PYLITH_METHOD_BEGIN;
+    assert(quadrature);
+    assert(dim >= 0);
+
+    // Two points (endpoints only) is the lowest order rule.
+    const PetscInt n1D = PetscMax(numPoints1D, 2);
+    PetscErrorCode err;
+    PetscReal* points1D = NULL;
+    PetscReal* weights1D = NULL;
+    err = PetscMalloc2(n1D, &points1D, n1D, &weights1D);PYLITH_CHECK_ERROR(err);
+    err = PetscDTGaussLobattoLegendreQuadrature(n1D, PETSCGAUSSLOBATTOLEGENDRE_VIA_NEWTON, points1D, weights1D);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numPoints = 1;
+    for (int iDim = 0; iDim < dim; ++iDim) {
+        numPoints *= n1D;
+    } // for
+    PetscReal* points = NULL;
+    PetscReal* weights = NULL;
+    err = PetscMalloc1(PetscMax(numPoints*dim, 1), &points);PYLITH_CHECK_ERROR(err);
+    err = PetscMalloc1(numPoints, &weights);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+        weights[iPoint] = 1.0;
+        for (PetscInt iDim = 0, index = iPoint; iDim < dim; ++iDim, index /= n1D) {
+            points[iPoint*dim+iDim] = points1D[index % n1D];
+            weights[iPoint] *= weights1D[index % n1D];
+        } // for
+    } // for
+    err = PetscFree2(points1D, weights1D);PYLITH_CHECK_ERROR(err);
+
+    err = PetscQuadratureCreate(PETSC_COMM_SELF, quadrature);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureSetOrder(*quadrature, 2*n1D-3);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureSetData(*quadrature, dim, 1, numPoints, points, weights);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // createGLLQuadrature
+
+
+// ------------------------------------------------------------------------------------------------
+// Set functionals of dual space for point space to evaluation of each component at each quadrature point.
+void
+pylith::topology::_FieldOps::setPointFunctionals(PetscDualSpace dualspace,
+                                                 PetscQuadrature quadrature,
+                                                 const int numComponents) {
+    PYLITH_METHOD_BEGIN;
+    assert(dualspace);
+    assert(quadrature);
+
+    PetscErrorCode err;
+    PetscInt dim = 0, numPoints = 0;
+    const PetscReal* points = NULL;
+    err = PetscQuadratureGetData(quadrature, &dim, NULL, &numPoints, &points, NULL);PYLITH_CHECK_ERROR(err);
+
+    // Order of functionals matches order of basis functions in point space: components vary fastest.
+    err = PetscDualSpaceSetType(dualspace, PETSCDUALSPACESIMPLE);PYLITH_CHECK_ERROR(err);
+    err = PetscDualSpaceSimpleSetDimension(dualspace, numPoints*numComponents);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+        for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+            PetscReal* point = NULL;
+            PetscReal* weights = NULL;
+            err = PetscMalloc1(PetscMax(dim, 1), &point);PYLITH_CHECK_ERROR(err);
+            err = PetscCalloc1(numComponents, &weights);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iDim = 0; iDim < dim; ++iDim) {
+                point[iDim] = points[iPoint*dim+iDim];
+            } // for
+            weights[iComponent] = 1.0;
+
+            PetscQuadrature functional = NULL;
+            err = PetscQuadratureCreate(PETSC_COMM_SELF, &functional);PYLITH_CHECK_ERROR(err);
+            err = PetscQuadratureSetData(functional, dim, numComponents, 1, point, weights);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceSimpleSetFunctional(dualspace, iPoint*numComponents+iComponent, functional);PYLITH_CHECK_ERROR(err);
+            err = PetscQuadratureDestroy(&functional);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // setPointFunctionals
+
+
 // End of file
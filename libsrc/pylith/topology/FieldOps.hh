@@ -117,7 +117,7 @@ public:
     bool layoutsMatch(const pylith::topology::Field& fieldA,
                       const pylith::topology::Field& fieldB);
 
-    /** Free saved PetscFE objects.
+    /** Free cached PetscFE objects.
      */
     static
     void deallocate(void);
@@ -25,9 +25,13 @@
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
+#include "pylith/meshio/ExpressionDB.hh" // USES ExpressionDB
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/SetupProfiler.hh" // USES SetupProfiler
+
+#include <algorithm> // USES std::sort()
 
 namespace pylith {
     namespace topology {
@@ -42,6 +46,147 @@ public:
             void findQueryIndices(FieldQuery::DBQueryContext* context,
                                   const pylith::string_vector& valuesForSubfield);
 
+            /** Convert, validate, and nondimensionalize values from spatial database query at point.
+             *
+             * @param[in] context Query context with spatial database values in queryValues.
+             * @param[in] xDim Coordinates (dimensioned) of point.
+             * @param[in] dim Spatial dimension.
+             * @param[in] nvalues Size of values array.
+             * @param[out] values Array of values for subfield.
+             * @returns PETSc error code (0 for success).
+             */
+            static
+            PetscErrorCode setValues(FieldQuery::DBQueryContext* context,
+                                     const double xDim[],
+                                     const PylithInt dim,
+                                     const PylithInt nvalues,
+                                     PylithScalar* values);
+
+            /** Validate and nondimensionalize converted values at point.
+             *
+             * @param[in] context Query context.
+             * @param[in] xDim Coordinates (dimensioned) of point.
+             * @param[in] dim Spatial dimension.
+             * @param[in] nvalues Size of values array.
+             * @param[inout] values Array of values for subfield.
+             * @returns PETSc error code (0 for success).
+             */
+            static
+            PetscErrorCode validateValues(FieldQuery::DBQueryContext* context,
+                                          const double xDim[],
+                                          const PylithInt dim,
+                                          const PylithInt nvalues,
+                                          PylithScalar* values);
+
+            /** Report error converting spatial database values at point.
+             *
+             * @param[in] context Query context.
+             * @param[in] xDim Coordinates (dimensioned) of point.
+             * @param[in] dim Spatial dimension.
+             * @param[in] invalidMsg Message from converter.
+             * @returns PETSc error code.
+             */
+            static
+            PetscErrorCode conversionError(FieldQuery::DBQueryContext* context,
+                                           const double xDim[],
+                                           const PylithInt dim,
+                                           const std::string& invalidMsg);
+
+            /** Collect coordinates of point for batch query (first projection).
+             *
+             * @param[in] dim Spatial dimension.
+             * @param[in] t Current time.
+             * @param[in] x Coordinates (nondimensioned) of point location for query.
+             * @param[in] nvalues Size of values array.
+             * @param[out] values Array of values (set to zero).
+             * @param[in] context Query context.
+             * @returns PETSc error code (0 for success).
+             */
+            static
+            PetscErrorCode collectPointFn(PylithInt dim,
+                                          PylithReal t,
+                                          const PylithReal x[],
+                                          PylithInt nvalues,
+                                          PylithScalar* values,
+                                          void* context);
+
+            /** Set values at point from results of batch query (second projection).
+             *
+             * @param[in] dim Spatial dimension.
+             * @param[in] t Current time.
+             * @param[in] x Coordinates (nondimensioned) of point location for query.
+             * @param[in] nvalues Size of values array.
+             * @param[out] values Array of values to be returned.
+             * @param[in] context Query context.
+             * @returns PETSc error code (0 for success).
+             */
+            static
+            PetscErrorCode batchPointFn(PylithInt dim,
+                                        PylithReal t,
+                                        const PylithReal x[],
+                                        PylithInt nvalues,
+                                        PylithScalar* values,
+                                        void* context);
+
+            /** Query spatial database for all collected points.
+             *
+             * Points are queried in sorted order of their coordinates, so consecutive queries are at nearby locations.
+             *
+             * If another subfield has already queried the same spatial database using the same coordinate system at
+             * the same points, the values from that query are reused, so the points are located (and their
+             * coordinates transformed to the coordinate system of the spatial database) only once.
+             *
+             * @param[inout] context Query context with collected points.
+             * @param[in] reuseContext Query context with results for the same points (NULL if none).
+             */
+            static
+            void queryBatch(FieldQuery::DBQueryContext* context,
+                            const FieldQuery::DBQueryContext* reuseContext);
+
+            /** Check whether batch query for one context gives the same results as another context.
+             *
+             * @param[in] a Query context with collected points.
+             * @param[in] b Query context with collected points.
+             * @returns True if the contexts query the same spatial database with the same coordinate system at the same
+             * points.
+             */
+            static
+            bool isSameBatch(const FieldQuery::DBQueryContext& a,
+                             const FieldQuery::DBQueryContext& b);
+
+            /// Compare points using lexicographic order of their coordinates.
+            class PointCompare {
+public:
+
+                PointCompare(const double* coordinates,
+                             const int dim) :
+                    _coordinates(coordinates),
+                    _dim(dim) {}
+
+
+                bool operator()(const size_t a,
+                                const size_t b) const {
+                    const double* xA = &_coordinates[a*_dim];
+                    const double* xB = &_coordinates[b*_dim];
+                    for (int i = 0; i < _dim; ++i) {
+    PYLITH_METHOD_BEGIN;
+
+    PYLITH_METHOD_BEGIN;
+
+                        if (xA[i] != xB[i]) {
+                            return xA[i] < xB[i];
+                        } // if
+                    } // for
+                    return false;
+                } // operator()
+
+
+private:
+
+                const double* _coordinates;
+                const int _dim;
+            }; // PointCompare
+
         }; // _FieldQuery
     } // topology
 } // pylith
@@ -58,7 +203,9 @@ pylith::topology::FieldQuery::FieldQuery(const Field& field) :
     _logger->setClassName("FieldQuery");
     _logger->initialize();
     _logger->registerEvent("Py-FdQu-queryDB");
-    _logger->registerEvent("Py-FdQu-queryPt");
+    _logger->registerEvent("Py-FdQu-queryBatch");
+    _queryEvent = _logger->getEvent("Py-FdQu-queryDB");
+    _batchEvent = _logger->getEvent("Py-FdQu-queryBatch");
 } // constructor
 
 
@@ -119,6 +266,26 @@ pylith::topology::FieldQuery::setQuery(const char* subfield,
 } // setQuery
 
 
+// ----------------------------------------------------------------------
+// Set query function information for subfield using converter functions that report errors via codes.
+void
+pylith::topology::FieldQuery::setQuery(const char* subfield,
+                                       const char* queryValues[],
+                                       const size_t numValues,
+                                       const Converter& converter,
+                                       spatialdata::spatialdb::SpatialDB* db) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(converter.point);
+    assert(converter.message);
+
+    setQuery(subfield, queryValues, numValues, convertfn_type(NULL), db);
+    _subfieldQueries[subfield].converterFns = converter;
+
+    PYLITH_METHOD_END;
+} // setQuery
+
+
 // ----------------------------------------------------------------------
 // Initialize query with default query information.
 void
@@ -171,6 +338,7 @@ pylith::topology::FieldQuery::openDB(spatialdata::spatialdb::SpatialDB* db,
             _functions[index] = (dbSubfield) ? queryDBPointFn : NULL;
 
             _contexts[index].converter = query->second.converter;
+            _contexts[index].converterFns = query->second.converterFns;
             _contexts[index].db = dbSubfield;
             _contexts[index].cs = _field.getMesh().getCoordSys();
 
@@ -185,8 +353,8 @@ pylith::topology::FieldQuery::openDB(spatialdata::spatialdb::SpatialDB* db,
         const pylith::topology::Field::Description& description = iter->second.description;
         _contexts[index].description = description.label;
         _contexts[index].valueScale = description.scale;
+        _contexts[index].numComponents = description.numComponents;
         _contexts[index].validator = description.validator;
-        _contexts[index].logger = _logger;
 
         _contextPtrs[index] = &_contexts[index];
     } // for
@@ -201,16 +369,13 @@ void
 pylith::topology::FieldQuery::queryDB(void) {
     PYLITH_METHOD_BEGIN;
 
-    assert(_logger);
-    const PylithInt queryEvent = _logger->getEventId("Py-FdQu-queryDB");
-    _logger->eventBegin(queryEvent);
+    _queryEvent.begin();
+    pylith::utils::SetupProfiler::begin("Query spatial databases");
 
-    PetscErrorCode err = 0;
-    PetscReal dummyTime = 0.0;
-    err = DMProjectFunctionLocal(_field.getDM(), dummyTime, _functions, (void**)_contextPtrs, INSERT_ALL_VALUES,
-                                 _field.getLocalVector());PYLITH_CHECK_ERROR(err);
+    _projectBatchQuery(NULL, 0);
 
-    _logger->eventEnd(queryEvent);
+    pylith::utils::SetupProfiler::end("Query spatial databases");
+    _queryEvent.end();
 
     PYLITH_METHOD_END;
 } // queryDB
@@ -223,28 +388,15 @@ pylith::topology::FieldQuery::queryDBLabel(const char* labelName,
                                            const PylithInt labelValue) {
     PYLITH_METHOD_BEGIN;
 
-    assert(_logger);
-    const PylithInt queryEvent = _logger->getEventId("Py-FdQu-queryDB");
-    _logger->eventBegin(queryEvent);
-
-    PetscErrorCode err = 0;
-    PetscReal dummyTime = 0.0;
-
-    const Field::subfields_type& subfields = _field._subfields;
-    const size_t numSubfields = subfields.size();
-    pylith::int_array subfieldIndices(numSubfields);
-    size_t i = 0;
-    for (Field::subfields_type::const_iterator iter = subfields.begin(); iter != subfields.end(); ++iter, ++i) {
-        subfieldIndices[i] = iter->second.index;
-    } // for
+    _queryEvent.begin();
+    pylith::utils::SetupProfiler::begin("Query spatial databases");
 
     PetscDMLabel dmLabel = NULL;
-    err = DMGetLabel(_field.getDM(), labelName, &dmLabel);PYLITH_CHECK_ERROR(err);assert(dmLabel);
-    err = DMProjectFunctionLabelLocal(_field.getDM(), dummyTime, dmLabel, 1, &labelValue,
-                                      numSubfields, &subfieldIndices[0], _functions, (void**)_contextPtrs,
-                                      INSERT_ALL_VALUES, _field.getLocalVector());PYLITH_CHECK_ERROR(err);
+    PetscErrorCode err = DMGetLabel(_field.getDM(), labelName, &dmLabel);PYLITH_CHECK_ERROR(err);assert(dmLabel);
+    _projectBatchQuery(dmLabel, labelValue);
 
-    _logger->eventEnd(queryEvent);
+    pylith::utils::SetupProfiler::end("Query spatial databases");
+    _queryEvent.end();
 
     PYLITH_METHOD_END;
 } // queryDBLabel
@@ -269,6 +421,84 @@ pylith::topology::FieldQuery::closeDB(spatialdata::spatialdb::SpatialDB* db) {
 } // queryDB
 
 
+// ----------------------------------------------------------------------
+// Project spatial database values into field using a batch query.
+void
+pylith::topology::FieldQuery::_projectBatchQuery(PetscDMLabel dmLabel,
+                                                 const PylithInt labelValue) {
+    PYLITH_METHOD_BEGIN;
+
+    const Field::subfields_type& subfields = _field._subfields;
+    const size_t numSubfields = subfields.size();
+    if (!numSubfields) {
+        PYLITH_METHOD_END;
+    } // if
+    assert(_functions);
+    assert(_contexts);
+
+    std::vector<queryfn_type> collectFns(numSubfields);
+    std::vector<queryfn_type> batchFns(numSubfields);
+    for (size_t i = 0; i < numSubfields; ++i) {
+        collectFns[i] = (_functions[i]) ? _FieldQuery::collectPointFn : NULL;
+        batchFns[i] = (_functions[i]) ? _FieldQuery::batchPointFn : NULL;
+    } // for
+
+    pylith::int_array subfieldIndices(numSubfields);
+    size_t i = 0;
+    for (Field::subfields_type::const_iterator iter = subfields.begin(); iter != subfields.end(); ++iter, ++i) {
+        subfieldIndices[i] = iter->second.index;
+    } // for
+
+    PetscErrorCode err = 0;
+    PetscReal dummyTime = 0.0;
+    for (int iPass = 0; iPass < 2; ++iPass) {
+        queryfn_type* functions = (0 == iPass) ? &collectFns[0] : &batchFns[0];
+        if (dmLabel) {
+            err = DMProjectFunctionLabelLocal(_field.getDM(), dummyTime, dmLabel, 1, &labelValue,
+                                              numSubfields, &subfieldIndices[0], functions, (void**)_contextPtrs,
+                                              INSERT_ALL_VALUES, _field.getLocalVector());PYLITH_CHECK_ERROR(err);
+        } else {
+            err = DMProjectFunctionLocal(_field.getDM(), dummyTime, functions, (void**)_contextPtrs, INSERT_ALL_VALUES,
+                                         _field.getLocalVector());PYLITH_CHECK_ERROR(err);
+        } // if/else
+
+        if (0 == iPass) {
+            _batchEvent.begin();
+            // Identify subfields with the same points as a previous subfield before the coordinates are released.
+            std::vector<int> reuseIndices(numSubfields, -1);
+            for (size_t iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
+                if (!_functions[iSubfield]) { continue; }
+                for (size_t jSubfield = 0; jSubfield < iSubfield; ++jSubfield) {
+                    if (_functions[jSubfield] && (reuseIndices[jSubfield] < 0) &&
+                        _FieldQuery::isSameBatch(_contexts[iSubfield], _contexts[jSubfield])) {
+                        reuseIndices[iSubfield] = jSubfield;
+                        break;
+                    } // if
+                } // for
+            } // for
+            for (size_t iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
+                if (_functions[iSubfield]) {
+                    const DBQueryContext* reuseContext = (reuseIndices[iSubfield] >= 0) ? &_contexts[reuseIndices[iSubfield]] : NULL;
+                    _FieldQuery::queryBatch(&_contexts[iSubfield], reuseContext);
+                } // if
+            } // for
+            _batchEvent.end();
+        } // if
+    } // for
+
+    // Release batch buffers.
+    for (size_t iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
+        std::vector<PylithReal>().swap(_contexts[iSubfield].batchCoordinates);
+        std::vector<double>().swap(_contexts[iSubfield].batchValues);
+        std::vector<int>().swap(_contexts[iSubfield].batchErrors);
+        std::vector<PylithScalar>().swap(_contexts[iSubfield].batchSubfieldValues);
+        _contexts[iSubfield].batchCursor = 0;
+    } // for
+
+    PYLITH_METHOD_END;
+} // _projectBatchQuery
+
+
 // ----------------------------------------------------------------------
 // Generic query of values from spatial database.
 PetscErrorCode
@@ -289,10 +519,6 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
         PYLITH_METHOD_RETURN(0);
     } // if
 
-    assert(queryctx->logger);
-    const PylithInt pointFnEvent = queryctx->logger->getEventId("Py-FdQu-queryPt");
-    queryctx->logger->eventBegin(pointFnEvent);
-
     // Dimensionalize query location coordinates.
     assert(queryctx->lengthScale > 0);
     double xDim[3];
@@ -313,51 +539,7 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
         PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
     } // if
 
-    // Convert database values to subfield values if converter function specified.
-    if (queryctx->converter) {
-        const std::string& invalidMsg = queryctx->converter(values, nvalues, queryctx->queryValues, queryctx->queryIndices);
-        if (invalidMsg.length() > 0) {
-            std::ostringstream msg;
-            msg << "Error converting spatial database values for " << queryctx->description << " at (";
-            for (int i = 0; i < dim; ++i) {
-                msg << "  " << xDim[i];
-            }
-            msg << ") in spatial database '" << queryctx->db->getDescription() << "'. "
-                << invalidMsg;
-            PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
-        }
-    } else {
-        for (PylithInt i = 0; i < nvalues; ++i) {
-            values[i] = queryctx->queryValues[queryctx->queryIndices[i]];
-        } // for
-    } // if/else
-
-    // Validate subfield values if validator function was specified.
-    if (queryctx->validator) {
-        for (PylithInt i = 0; i < nvalues; ++i) {
-            const char* invalidMsg = queryctx->validator(values[i]);
-            if (invalidMsg) {
-                std::ostringstream msg;
-                msg << "Found invalid value for " << queryctx->description << " (" << values[i] << ") at location (";
-                for (int i = 0; i < dim; ++i) {
-                    msg << "  " << xDim[i];
-                }
-                msg << ") from spatial database '" << queryctx->db->getDescription() << "'. ";
-                msg << invalidMsg;
-                PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
-            } // if
-        } // for
-    } // if
-
-    // Nondimensionalize values
-    assert(queryctx->valueScale > 0);
-    for (int i = 0; i < nvalues; ++i) {
-        values[i] /= queryctx->valueScale;
-    } // for
-
-    queryctx->logger->eventEnd(pointFnEvent);
-
-    PYLITH_METHOD_RETURN(0);
+    PYLITH_METHOD_RETURN(_FieldQuery::setValues(queryctx, xDim, dim, nvalues, values));
 } // queryDBPointFn
 
 
@@ -421,4 +603,294 @@ pylith::topology::_FieldQuery::findQueryIndices(FieldQuery::DBQueryContext* cont
 } // findQueryIndices
 
 
+// ----------------------------------------------------------------------
+// Convert, validate, and nondimensionalize values from spatial database query at point.
+PetscErrorCode
+pylith::topology::_FieldQuery::setValues(FieldQuery::DBQueryContext* queryctx,
+                                         const double xDim[],
+                                         const PylithInt dim,
+                                         const PylithInt nvalues,
+                                         PylithScalar* values) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(queryctx);
+    assert(xDim);
+    assert(values);
+
+    // Convert database values to subfield values if converter function specified.
+    if (queryctx->converterFns.point) {
+        const int code = queryctx->converterFns.point(values, nvalues, &queryctx->queryValues[0], &queryctx->queryIndices[0]);
+        if (code) {
+            assert(queryctx->converterFns.message);
+            const std::string& invalidMsg = queryctx->converterFns.message(code, nvalues, &queryctx->queryValues[0], &queryctx->queryIndices[0]);
+            PYLITH_METHOD_RETURN(conversionError(queryctx, xDim, dim, invalidMsg));
+        } // if
+    } else if (queryctx->converter) {
+        const std::string& invalidMsg = queryctx->converter(values, nvalues, queryctx->queryValues, queryctx->queryIndices);
+        if (invalidMsg.length() > 0) {
+            PYLITH_METHOD_RETURN(conversionError(queryctx, xDim, dim, invalidMsg));
+        }
+    } else {
+        for (PylithInt i = 0; i < nvalues; ++i) {
+            values[i] = queryctx->queryValues[queryctx->queryIndices[i]];
+        } // for
+    } // if/else
+
+    PYLITH_METHOD_RETURN(validateValues(queryctx, xDim, dim, nvalues, values));
+} // setValues
+
+
+// ----------------------------------------------------------------------
+// Validate and nondimensionalize converted values at point.
+PetscErrorCode
+pylith::topology::_FieldQuery::validateValues(FieldQuery::DBQueryContext* queryctx,
+                                              const double xDim[],
+                                              const PylithInt dim,
+                                              const PylithInt nvalues,
+                                              PylithScalar* values) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(queryctx);
+    assert(xDim);
+    assert(values);
+
+    // Validate subfield values if validator function was specified.
+    if (queryctx->validator) {
+        for (PylithInt i = 0; i < nvalues; ++i) {
+            const char* invalidMsg = queryctx->validator(values[i]);
+            if (invalidMsg) {
+                std::ostringstream msg;
+                msg << "Found invalid value for " << queryctx->description << " (" << values[i] << ") at location (";
+                for (int i = 0; i < dim; ++i) {
+                    msg << "  " << xDim[i];
+                }
+                msg << ") from spatial database '" << queryctx->db->getDescription() << "'. ";
+                msg << invalidMsg;
+                PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
+            } // if
+        } // for
+    } // if
+
+    // Nondimensionalize values
+    assert(queryctx->valueScale > 0);
+    for (int i = 0; i < nvalues; ++i) {
+        values[i] /= queryctx->valueScale;
+    } // for
+
+    PYLITH_METHOD_RETURN(0);
+} // validateValues
+
+
+// ----------------------------------------------------------------------
+// Report error converting spatial database values at point.
+PetscErrorCode
+pylith::topology::_FieldQuery::conversionError(FieldQuery::DBQueryContext* queryctx,
+                                               const double xDim[],
+                                               const PylithInt dim,
+                                               const std::string& invalidMsg) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(queryctx);
+    assert(xDim);
+
+    std::ostringstream msg;
+    msg << "Error converting spatial database values for " << queryctx->description << " at (";
+    for (int i = 0; i < dim; ++i) {
+        msg << "  " << xDim[i];
+    }
+    msg << ") in spatial database '" << queryctx->db->getDescription() << "'. "
+        << invalidMsg;
+    PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
+} // conversionError
+
+
+// ----------------------------------------------------------------------
+// Collect coordinates of point for batch query.
+PetscErrorCode
+pylith::topology::_FieldQuery::collectPointFn(PylithInt dim,
+                                              PylithReal t,
+                                              const PylithReal x[],
+                                              PylithInt nvalues,
+                                              PylithScalar* values,
+                                              void* context) {
+    assert(x);
+    assert(values);
+    assert(context);
+
+    FieldQuery::DBQueryContext* queryctx = (FieldQuery::DBQueryContext*)context;assert(queryctx);
+    if (queryctx->db) {
+        queryctx->batchDim = dim;
+        queryctx->batchCoordinates.insert(queryctx->batchCoordinates.end(), x, x+dim);
+    } // if
+    for (PylithInt i = 0; i < nvalues; ++i) {
+        values[i] = 0.0;
+    } // for
+
+    PYLITH_METHOD_RETURN(0);
+} // collectPointFn
+
+
+// ----------------------------------------------------------------------
+// Set values at point from results of batch query.
+PetscErrorCode
+pylith::topology::_FieldQuery::batchPointFn(PylithInt dim,
+                                            PylithReal t,
+                                            const PylithReal x[],
+                                            PylithInt nvalues,
+                                            PylithScalar* values,
+                                            void* context) {
+    assert(x);
+    assert(values);
+    assert(context);
+
+    FieldQuery::DBQueryContext* queryctx = (FieldQuery::DBQueryContext*)context;assert(queryctx);
+    if (!queryctx->db) {
+        PYLITH_METHOD_RETURN(0);
+    } // if
+
+    const size_t numDBValues = queryctx->queryValues.size();
+    const size_t iPoint = queryctx->batchCursor++;
+    if (iPoint >= queryctx->batchErrors.size()) {
+        std::ostringstream msg;
+        msg << "Number of points in projection for " << queryctx->description << " does not match number of points in "
+            << "batch query (" << queryctx->batchErrors.size() << ").";
+        PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_PLIB, msg.str().c_str());
+    } // if
+
+    assert(queryctx->lengthScale > 0);
+    double xDim[3];
+    for (int i = 0; i < dim; ++i) {
+        xDim[i] = x[i] * queryctx->lengthScale;
+    } // for
+
+    if (queryctx->batchErrors[iPoint]) {
+        std::ostringstream msg;
+        msg << "Could not find values for " << queryctx->description << " at (";
+        for (int i = 0; i < dim; ++i) {
+            msg << "  " << xDim[i];
+        }
+        msg << ") in spatial database '" << queryctx->db->getDescription() << "'.";
+        PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
+    } // if
+
+    const double* dbValues = &queryctx->batchValues[iPoint*numDBValues];
+    if (queryctx->batchSubfieldValues.size() > 0) {
+        // Values were converted for all points in the batch query.
+        if (iPoint == queryctx->batchFailedPoint) {
+            assert(queryctx->converterFns.message);
+            const std::string& invalidMsg = queryctx->converterFns.message(queryctx->batchFailedCode, nvalues, dbValues, &queryctx->queryIndices[0]);
+            PYLITH_METHOD_RETURN(conversionError(queryctx, xDim, dim, invalidMsg));
+        } // if
+        assert(size_t(nvalues) == queryctx->numComponents);
+        const PylithScalar* subfieldValues = &queryctx->batchSubfieldValues[iPoint*nvalues];
+        for (PylithInt i = 0; i < nvalues; ++i) {
+            values[i] = subfieldValues[i];
+        } // for
+        PYLITH_METHOD_RETURN(validateValues(queryctx, xDim, dim, nvalues, values));
+    } // if
+
+    for (size_t i = 0; i < numDBValues; ++i) {
+        queryctx->queryValues[i] = dbValues[i];
+    } // for
+
+    PYLITH_METHOD_RETURN(setValues(queryctx, xDim, dim, nvalues, values));
+} // batchPointFn
+
+
+// ----------------------------------------------------------------------
+// Query spatial database for all collected points.
+void
+pylith::topology::_FieldQuery::queryBatch(FieldQuery::DBQueryContext* queryctx,
+                                          const FieldQuery::DBQueryContext* reusectx) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(queryctx);
+    assert(queryctx->db);
+    assert(queryctx->cs);
+    assert(queryctx->lengthScale > 0);
+
+    const size_t numDBValues = queryctx->queryValues.size();
+    const int dim = queryctx->batchDim;
+    const size_t numPoints = (dim > 0) ? queryctx->batchCoordinates.size() / dim : 0;
+    queryctx->batchValues.resize(numPoints*numDBValues);
+    queryctx->batchErrors.resize(numPoints);
+    queryctx->batchCursor = 0;
+    if (!numPoints) {
+        PYLITH_METHOD_END;
+    } // if
+
+    pylith::meshio::ExpressionDB* expressionDB = dynamic_cast<pylith::meshio::ExpressionDB*>(queryctx->db);
+    if (reusectx) {
+        // Same points, coordinate system, and spatial database as a previous query, so values are the same.
+        assert(reusectx->batchValues.size() == queryctx->batchValues.size());
+        queryctx->batchValues = reusectx->batchValues;
+        queryctx->batchErrors = reusectx->batchErrors;
+        std::vector<PylithReal>().swap(queryctx->batchCoordinates);
+    } else if (expressionDB) {
+        // Evaluate expressions for all points together, so the order of the points does not matter.
+        std::vector<double> coordinates(numPoints*dim);
+        for (size_t i = 0; i < numPoints*dim; ++i) {
+            coordinates[i] = queryctx->batchCoordinates[i] * queryctx->lengthScale;
+        } // for
+        std::vector<PylithReal>().swap(queryctx->batchCoordinates);
+
+        expressionDB->queryPoints(&queryctx->batchValues[0], numDBValues, &queryctx->batchErrors[0], &coordinates[0],
+                                  numPoints, dim, queryctx->cs);
+    } else {
+        // Order points so that consecutive queries are at nearby locations.
+        std::vector<size_t> order(numPoints);
+        for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+            order[iPoint] = iPoint;
+        } // for
+        std::sort(order.begin(), order.end(), PointCompare(&queryctx->batchCoordinates[0], dim));
+
+        std::vector<double> coordinatesSorted(numPoints*dim);
+        for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+            for (int i = 0; i < dim; ++i) {
+                coordinatesSorted[iPoint*dim+i] = queryctx->batchCoordinates[order[iPoint]*dim+i] * queryctx->lengthScale;
+            } // for
+        } // for
+        std::vector<PylithReal>().swap(queryctx->batchCoordinates);
+
+        std::vector<double> valuesSorted(numPoints*numDBValues);
+        std::vector<int> errorsSorted(numPoints);
+        queryctx->db->multiquery(&valuesSorted[0], numPoints, numDBValues, &errorsSorted[0], numPoints,
+                                 &coordinatesSorted[0], numPoints, dim, queryctx->cs);
+
+        for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+            const size_t index = order[iPoint];
+            queryctx->batchErrors[index] = errorsSorted[iPoint];
+            for (size_t i = 0; i < numDBValues; ++i) {
+                queryctx->batchValues[index*numDBValues+i] = valuesSorted[iPoint*numDBValues+i];
+            } // for
+        } // for
+    } // if/else
+
+    // Convert values at all points at once if array converter function specified. Points after the first failure
+    // are not converted, because the projection stops at the failed point.
+    if (queryctx->converterFns.array) {
+        const size_t numComponents = queryctx->numComponents;assert(numComponents > 0);
+        queryctx->batchSubfieldValues.resize(numPoints*numComponents);
+        queryctx->batchFailedPoint = numPoints;
+        queryctx->batchFailedCode = queryctx->converterFns.array(&queryctx->batchSubfieldValues[0], numComponents, numPoints,
+                                                                 &queryctx->batchValues[0], numDBValues,
+                                                                 &queryctx->queryIndices[0], &queryctx->batchFailedPoint);
+    } // if
+
+    PYLITH_METHOD_END;
+} // queryBatch
+
+
+// ----------------------------------------------------------------------
+// Check whether batch query for one context gives the same results as another context.
+bool
+pylith::topology::_FieldQuery::isSameBatch(const FieldQuery::DBQueryContext& a,
+                                           const FieldQuery::DBQueryContext& b) {
+    // Queries return all values in the spatial database, so the results depend only on the spatial database, the
+    // coordinate system, and the (dimensioned) coordinates of the points.
+    return a.db && (a.db == b.db) && (a.cs == b.cs) && (a.lengthScale == b.lengthScale) && (a.batchDim == b.batchDim) &&
+           (a.queryValues.size() == b.queryValues.size()) && (a.batchCoordinates == b.batchCoordinates);
+} // isSameBatch
+
+
 // End of file
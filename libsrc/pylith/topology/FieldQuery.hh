@@ -29,13 +29,15 @@
 
 #include "pylith/topology/FieldBase.hh" // HASA validatorfn_type
 #include "pylith/testing/testingfwd.hh" // USES FieldTester
-#include "pylith/utils/utilsfwd.hh" // USES EventLogger
+#include "pylith/utils/EventLogger.hh" // HOLDSA EventLogger, HASA EventLogger::Event
+#include "pylith/utils/petscfwd.h" // USES PetscDMLabel
 
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // HOLDSA SpatialDB
 #include "spatialdata/geocoords/geocoordsfwd.hh" // USES CoordSys
 
 #include <map> // HOLDSA std::map
 #include <string> // HASA std::string
+#include <vector> // HASA std::vector
 
 namespace pylith {
     namespace feassemble {
@@ -64,6 +66,71 @@ public:
                                           const pylith::scalar_array,
                                           const pylith::int_array);
 
+    /** Function prototype for converter functions that do not allocate memory.
+     *
+     * @param[out] values Values for subfield.
+     * @param[in] nvalues Number of values for subfield.
+     * @param[in] dbValues Array of values from spatial database query.
+     * @param[in] dbIndices Indices of values from spatial database to use for computing subfield values.
+     * @returns 0 for success, otherwise nonzero code identifying failed checks.
+     */
+    typedef int (*convertcodefn_type)(PylithScalar[],
+                                      const PylithInt,
+                                      const double[],
+                                      const PylithInt[]);
+
+    /** Function prototype for converter functions operating on values at many points.
+     *
+     * Conversion stops at the first point that fails.
+     *
+     * @param[out] values Values for subfield [numPoints*nvalues].
+     * @param[in] nvalues Number of values for subfield at a point.
+     * @param[in] numPoints Number of points.
+     * @param[in] dbValues Array of values from spatial database query [numPoints*numDBValues].
+     * @param[in] numDBValues Number of values from spatial database query at a point.
+     * @param[in] dbIndices Indices of values from spatial database to use for computing subfield values.
+     * @param[out] failedPoint Index of first point that failed (numPoints if all points succeed).
+     * @returns 0 for success, otherwise nonzero code from convertcodefn_type for failed point.
+     */
+    typedef int (*convertarrayfn_type)(PylithScalar[],
+                                       const PylithInt,
+                                       const size_t,
+                                       const double[],
+                                       const size_t,
+                                       const PylithInt[],
+                                       size_t*);
+
+    /** Function prototype for creating error message for failed conversion.
+     *
+     * Only called after a conversion fails.
+     *
+     * @param[in] code Nonzero code returned by converter function.
+     * @param[in] nvalues Number of values for subfield.
+     * @param[in] dbValues Array of values from spatial database query at point.
+     * @param[in] dbIndices Indices of values from spatial database to use for computing subfield values.
+     * @returns Error message.
+     */
+    typedef std::string (*convertmsgfn_type)(const int,
+                                             const PylithInt,
+                                             const double[],
+                                             const PylithInt[]);
+
+    /// Converter functions that report errors via codes.
+    struct Converter {
+        convertcodefn_type point; ///< Convert values at a point.
+        convertarrayfn_type array; ///< Convert values at many points (optional).
+        convertmsgfn_type message; ///< Create error message for code from failed conversion.
+
+        explicit Converter(convertcodefn_type pointFn=NULL,
+                           convertarrayfn_type arrayFn=NULL,
+                           convertmsgfn_type messageFn=NULL) :
+            point(pointFn),
+            array(arrayFn),
+            message(messageFn) {}
+
+
+    }; // Converter
+
     // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public:
 
@@ -98,6 +165,22 @@ public:
                   convertfn_type converter=NULL,
                   spatialdata::spatialdb::SpatialDB* db=NULL);
 
+    /** Set query information for subfield using converter functions that report errors via codes.
+     *
+     * The array converter, if provided, converts the values at all points of a batch query at once.
+     *
+     * @param[in] subfield Name of subfield.
+     * @param[in] queryValues Array of names of spatial database values for subfield.
+     * @param[in] numValues Size of names array.
+     * @param[in] converter Functions to convert spatial database values to subfield value.
+     * @param[in] db Spatial database to query (optional).
+     */
+    void setQuery(const char* subfield,
+                  const char* queryValues[],
+                  const size_t numValues,
+                  const Converter& converter,
+                  spatialdata::spatialdb::SpatialDB* db=NULL);
+
     /// Initialize query with default query information.
     void initializeWithDefaultQueries(void);
 
@@ -131,6 +214,8 @@ public:
      *
      * Includes nondimensionalization but no conversion of values.
      *
+     * queryDB() and queryDBLabel() use a batch query instead; this function is for querying individual points.
+     *
      * @param[in] dim Spatial dimension.
      * @param[in] t Current time.
      * @param[in] x Coordinates (nondimensioned) of point location for query.
@@ -169,6 +254,7 @@ private:
     struct SubfieldQuery {
         pylith::string_vector queryValues; ///< Values to use from spatial database.
         convertfn_type converter; ///< Function to convert spatial database values to subfield values.
+        Converter converterFns; ///< Functions to convert spatial database values to subfield values.
         spatialdata::spatialdb::SpatialDB* db; ///< Spatial database to query.
 
         SubfieldQuery(void) :
@@ -198,8 +284,18 @@ private:
         pylith::scalar_array queryValues; ///< Values returned by spatial database query;
         pylith::int_array queryIndices; ///< Indices of spatial database values to use for subfield.
         convertfn_type converter; ///< Function to convert values to subfield (optional).
+        Converter converterFns; ///< Functions to convert values to subfield (optional).
         pylith::topology::FieldBase::validatorfn_type validator; ///< Function to validate values (optional).
-        pylith::utils::EventLogger* logger;
+
+        std::vector<PylithReal> batchCoordinates; ///< Coordinates (nondimensional) of points for batch query.
+        std::vector<double> batchValues; ///< Values from batch query [numPoints*numDBValues].
+        std::vector<int> batchErrors; ///< Error flags from batch query [numPoints].
+        std::vector<PylithScalar> batchSubfieldValues; ///< Converted values from batch query [numPoints*numComponents].
+        size_t batchCursor; ///< Index of next point in batch.
+        size_t batchFailedPoint; ///< Index of first point in batch that failed conversion.
+        int batchFailedCode; ///< Code from failed conversion.
+        int batchDim; ///< Spatial dimension of points in batch.
+        size_t numComponents; ///< Number of components in subfield.
 
         DBQueryContext(void) :
             db(NULL),
@@ -209,11 +305,29 @@ private:
             description("unknown"),
             converter(NULL),
             validator(NULL),
-            logger(NULL) {}
+            batchCursor(0),
+            batchFailedPoint(0),
+            batchFailedCode(0),
+            batchDim(0),
+            numComponents(0) {}
 
 
     }; // DBQueryStruct
 
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Project spatial database values into field using a batch query.
+     *
+     * The first projection collects the coordinates of the points for each subfield, the spatial database is
+     * queried for all of the points at once, and the second projection sets the field values from the results.
+     *
+     * @param[in] dmLabel PETSc label of points to project (NULL for all points).
+     * @param[in] labelValue Value of label.
+     */
+    void _projectBatchQuery(PetscDMLabel dmLabel,
+                            const PylithInt labelValue);
+
     // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private:
 
@@ -225,7 +339,9 @@ private:
     DBQueryContext* _contexts; ///< Contexts for performing query for each subfield.
     DBQueryContext** _contextPtrs; ///< Array of pointers to contexts.
 
-    pylith::utils::EventLogger* _logger;
+    pylith::utils::EventLogger* _logger; ///< Event logger.
+    pylith::utils::EventLogger::Event _queryEvent; ///< Event for querying spatial database.
+    pylith::utils::EventLogger::Event _batchEvent; ///< Event for batch query of spatial database.
 
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
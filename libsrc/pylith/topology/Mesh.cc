@@ -28,6 +28,7 @@
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/petscfwd.h" // USES PetscVec
 
+#include <algorithm> // USES std::min_element(), std::max_element()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
@@ -39,7 +40,8 @@ const char* pylith::topology::Mesh::cells_label_name = "material-id";
 // Default constructor
 pylith::topology::Mesh::Mesh(void) :
     _coordSys(NULL),
-    _dm(NULL) {}
+    _dm(NULL),
+    _pointToSubpointStart(0) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -47,7 +49,8 @@ pylith::topology::Mesh::Mesh(void) :
 pylith::topology::Mesh::Mesh(const int dim,
                              const MPI_Comm& comm) :
     _coordSys(NULL),
-    _dm(NULL) {
+    _dm(NULL),
+    _pointToSubpointStart(0) {
     PYLITH_METHOD_BEGIN;
 
     PetscErrorCode err;
@@ -74,6 +77,8 @@ pylith::topology::Mesh::deallocate(void) {
     PYLITH_METHOD_BEGIN;
 
     delete _coordSys;_coordSys = NULL;
+    _clearLowerDimDMs();
+    _clearSubpointMaps();
     PetscErrorCode err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
@@ -118,6 +123,8 @@ pylith::topology::Mesh::setDM(PetscDM dm,
     PYLITH_METHOD_BEGIN;
 
     PetscErrorCode err;
+    _clearLowerDimDMs();
+    _clearSubpointMaps();
     err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
     _dm = dm;
     err = PetscObjectSetName((PetscObject) _dm, label);PYLITH_CHECK_ERROR(err);
@@ -161,6 +168,42 @@ pylith::topology::Mesh::getDimension(void) const {
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Get coordinates of vertices in the local coordinate vector without copying them.
+void
+pylith::topology::Mesh::getCoordinatesArray(PylithScalar** coordinates,
+                                            int* numVertices,
+                                            int* spaceDim) const {
+    PYLITH_METHOD_BEGIN;
+    assert(coordinates);
+    assert(numVertices);
+    assert(spaceDim);
+
+    *coordinates = NULL;
+    *numVertices = 0;
+    *spaceDim = 0;
+    if (!_dm) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscVec coordVec = NULL;
+    PetscInt size = 0, cdim = 0;
+    PetscScalar* array = NULL;
+    PetscErrorCode err;
+    err = DMGetCoordinateDim(_dm, &cdim);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinatesLocal(_dm, &coordVec);PYLITH_CHECK_ERROR(err);assert(coordVec);
+    err = VecGetLocalSize(coordVec, &size);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(coordVec, &array);PYLITH_CHECK_ERROR(err);
+    *coordinates = array;
+    *numVertices = (cdim > 0) ? size / cdim : 0;
+    *spaceDim = cdim;
+    // VecRestoreArray() resets the pointer it is given, but the storage of the coordinate vector does not move.
+    err = VecRestoreArray(coordVec, &array);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // getCoordinatesArray
+
+
 // ------------------------------------------------------------------------------------------------
 // Get MPI communicator associated with mesh.
 MPI_Comm
@@ -221,4 +264,149 @@ pylith::topology::Mesh::view(const char* viewOption) const {
 } // view
 
 
+// ------------------------------------------------------------------------------------------------
+// Get cached PETSc DM of lower dimension mesh for label.
+PetscDM
+pylith::topology::Mesh::getLowerDimDM(const char* labelName,
+                                      const int labelValue) const {
+    PYLITH_METHOD_BEGIN;
+    assert(labelName);
+
+    std::map<std::pair<std::string, int>, LowerDimDM>::iterator iter =
+        _lowerDimDMs.find(std::make_pair(std::string(labelName), labelValue));
+    if (iter == _lowerDimDMs.end()) {
+        PYLITH_METHOD_RETURN(NULL);
+    } // if
+
+    // Points in label may have changed since the lower dimension mesh was created.
+    PetscErrorCode err;
+    PetscDMLabel dmLabel = NULL;
+    PetscObjectState labelState = 0;
+    err = DMGetLabel(_dm, labelName, &dmLabel);PYLITH_CHECK_ERROR(err);
+    if (dmLabel) {
+        err = PetscObjectStateGet((PetscObject) dmLabel, &labelState);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (!dmLabel || (labelState != iter->second.labelState)) {
+        err = DMDestroy(&iter->second.dm);PYLITH_CHECK_ERROR(err);
+        _lowerDimDMs.erase(iter);
+        PYLITH_METHOD_RETURN(NULL);
+    } // if
+
+    PYLITH_METHOD_RETURN(iter->second.dm);
+} // getLowerDimDM
+
+
+// ------------------------------------------------------------------------------------------------
+// Cache PETSc DM of lower dimension mesh for label.
+void
+pylith::topology::Mesh::setLowerDimDM(const char* labelName,
+                                      const int labelValue,
+                                      PetscDM dm) const {
+    PYLITH_METHOD_BEGIN;
+    assert(labelName);
+    assert(dm);
+
+    PetscErrorCode err;
+    PetscDMLabel dmLabel = NULL;
+    err = DMGetLabel(_dm, labelName, &dmLabel);PYLITH_CHECK_ERROR(err);assert(dmLabel);
+
+    LowerDimDM& cached = _lowerDimDMs[std::make_pair(std::string(labelName), labelValue)];
+    err = PetscObjectReference((PetscObject) dm);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&cached.dm);PYLITH_CHECK_ERROR(err);
+    cached.dm = dm;
+    err = PetscObjectStateGet((PetscObject) dmLabel, &cached.labelState);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setLowerDimDM
+
+
+// ------------------------------------------------------------------------------------------------
+// Destroy cached PETSc DMs of lower dimension meshes.
+void
+pylith::topology::Mesh::_clearLowerDimDMs(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err;
+    typedef std::map<std::pair<std::string, int>, LowerDimDM>::iterator iterator;
+    for (iterator iter = _lowerDimDMs.begin(); iter != _lowerDimDMs.end(); ++iter) {
+        err = DMDestroy(&iter->second.dm);PYLITH_CHECK_ERROR(err);
+    } // for
+    _lowerDimDMs.clear();
+
+    PYLITH_METHOD_END;
+} // _clearLowerDimDMs
+
+
+// ------------------------------------------------------------------------------------------------
+// Create maps between points of this lower dimension mesh and points of the mesh it was extracted from.
+void
+pylith::topology::Mesh::createSubpointMaps(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_dm);
+
+    _clearSubpointMaps();
+
+    PetscErrorCode err;
+    PetscIS subpointIS = NULL;
+    err = DMPlexGetSubpointIS(_dm, &subpointIS);PYLITH_CHECK_ERROR(err);
+    if (!subpointIS) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscInt numPoints = 0;
+    const PetscInt* points = NULL;
+    err = ISGetLocalSize(subpointIS, &numPoints);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(subpointIS, &points);PYLITH_CHECK_ERROR(err);
+    _subpointToPoint.assign(points, points+numPoints);
+    err = ISRestoreIndices(subpointIS, &points);PYLITH_CHECK_ERROR(err);
+
+    if (numPoints > 0) {
+        const PetscInt pStart = *std::min_element(_subpointToPoint.begin(), _subpointToPoint.end());
+        const PetscInt pEnd = *std::max_element(_subpointToPoint.begin(), _subpointToPoint.end()) + 1;
+        _pointToSubpointStart = pStart;
+        _pointToSubpoint.assign(pEnd-pStart, -1);
+        for (PetscInt subpoint = 0; subpoint < numPoints; ++subpoint) {
+            _pointToSubpoint[_subpointToPoint[subpoint]-pStart] = subpoint;
+        } // for
+    } // if
+
+    PYLITH_METHOD_END;
+} // createSubpointMaps
+
+
+// ------------------------------------------------------------------------------------------------
+// Get map from points of this lower dimension mesh to points of the mesh it was extracted from.
+const PetscInt*
+pylith::topology::Mesh::getSubpointToPointMap(PetscInt* numPoints) const {
+    assert(numPoints);
+
+    *numPoints = _subpointToPoint.size();
+    return _subpointToPoint.empty() ? NULL : &_subpointToPoint[0];
+} // getSubpointToPointMap
+
+
+// ------------------------------------------------------------------------------------------------
+// Get map from points of the mesh this lower dimension mesh was extracted from to points of this mesh.
+const PetscInt*
+pylith::topology::Mesh::getPointToSubpointMap(PetscInt* pStart,
+                                              PetscInt* pEnd) const {
+    assert(pStart);
+    assert(pEnd);
+
+    *pStart = _pointToSubpointStart;
+    *pEnd = _pointToSubpointStart + PetscInt(_pointToSubpoint.size());
+    return _pointToSubpoint.empty() ? NULL : &_pointToSubpoint[0];
+} // getPointToSubpointMap
+
+
+// ------------------------------------------------------------------------------------------------
+// Clear maps between points of this lower dimension mesh and points of the mesh it was extracted from.
+void
+pylith::topology::Mesh::_clearSubpointMaps(void) {
+    _subpointToPoint.clear();
+    _pointToSubpoint.clear();
+    _pointToSubpointStart = 0;
+} // _clearSubpointMaps
+
+
 // End of file
@@ -30,6 +30,12 @@
 #include "spatialdata/geocoords/geocoordsfwd.hh" // forward declarations
 
 #include "pylith/utils/petscfwd.h" // HASA PetscDM
+#include "pylith/utils/types.hh" // HASA PetscObjectState
+
+#include <map> // HASA std::map
+#include <string> // HASA std::string
+#include <utility> // HASA std::pair
+#include <vector> // HASA std::vector
 
 // Mesh -----------------------------------------------------------------
 /** @brief PyLith finite-element mesh.
@@ -103,6 +109,19 @@ public:
      */
     int getDimension(void) const;
 
+    /** Get coordinates of vertices in the local coordinate vector without copying them.
+     *
+     * The array points to the storage of the local coordinate vector, so it is valid until the mesh is deallocated.
+     * Coordinates are nondimensional.
+     *
+     * @param[out] coordinates Array of vertex coordinates [numVertices*spaceDim].
+     * @param[out] numVertices Number of vertices.
+     * @param[out] spaceDim Spatial dimension of coordinates.
+     */
+    void getCoordinatesArray(PylithScalar** coordinates,
+                             int* numVertices,
+                             int* spaceDim) const;
+
     /** Get MPI communicator associated with mesh.
      *
      * @returns MPI communicator.
@@ -131,11 +150,78 @@ public:
      */
     void view(const char* viewOption="::ascii_info_detail") const;
 
+    /** Get cached PETSc DM of lower dimension mesh for label.
+     *
+     * @param[in] labelName Name of label.
+     * @param[in] labelValue Value of label.
+     * @returns PETSc DM of lower dimension mesh or NULL if not cached or label has changed.
+     */
+    PetscDM getLowerDimDM(const char* labelName,
+                          const int labelValue) const;
+
+    /** Cache PETSc DM of lower dimension mesh for label.
+     *
+     * The mesh holds a reference to the DM, so Mesh objects for the same label share the DM.
+     *
+     * @param[in] labelName Name of label.
+     * @param[in] labelValue Value of label.
+     * @param[in] dm PETSc DM of lower dimension mesh.
+     */
+    void setLowerDimDM(const char* labelName,
+                       const int labelValue,
+                       PetscDM dm) const;
+
+    /** Create maps between points of this lower dimension mesh and points of the mesh it was extracted from.
+     *
+     * The maps are contiguous arrays local to this process, so mapping a point does not require a search of the
+     * PETSc subpoint map. The maps are cleared when the PETSc DM is replaced.
+     */
+    void createSubpointMaps(void);
+
+    /** Get map from points of this lower dimension mesh to points of the mesh it was extracted from.
+     *
+     * @param[out] numPoints Number of points in map.
+     * @returns Array of points in mesh indexed by point in this mesh (NULL if maps have not been created).
+     */
+    const PetscInt* getSubpointToPointMap(PetscInt* numPoints) const;
+
+    /** Get map from points of the mesh this lower dimension mesh was extracted from to points of this mesh.
+     *
+     * @param[out] pStart First point of mesh in map.
+     * @param[out] pEnd One past last point of mesh in map.
+     * @returns Array of points in this mesh (-1 if not in this mesh) indexed by point-pStart (NULL if maps have
+     *     not been created).
+     */
+    const PetscInt* getPointToSubpointMap(PetscInt* pStart,
+                                          PetscInt* pEnd) const;
+
+    // PRIVATE STRUCTS //////////////////////////////////////////////////////
+private:
+
+    /// Cached PETSc DM of lower dimension mesh.
+    struct LowerDimDM {
+        PetscDM dm; ///< PETSc DM of lower dimension mesh.
+        PetscObjectState labelState; ///< State of label when DM was created.
+    };
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /// Destroy cached PETSc DMs of lower dimension meshes.
+    void _clearLowerDimDMs(void) const;
+
+    /// Clear maps between points of this lower dimension mesh and points of the mesh it was extracted from.
+    void _clearSubpointMaps(void);
+
     // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private:
 
     spatialdata::geocoords::CoordSys* _coordSys; ///< Coordinate system.
     PetscDM _dm; ///< PETSc DM with topology.
+    mutable std::map<std::pair<std::string, int>, LowerDimDM> _lowerDimDMs; ///< Lower dimension meshes by label.
+    std::vector<PetscInt> _subpointToPoint; ///< Map from points of this mesh to points of mesh it was extracted from.
+    std::vector<PetscInt> _pointToSubpoint; ///< Map from points of mesh it was extracted from to points of this mesh.
+    PetscInt _pointToSubpointStart; ///< First point of mesh it was extracted from in _pointToSubpoint.
 
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
@@ -22,17 +22,46 @@
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Stratum.hh" // USES Stratum
-#include "pylith/utils/array.hh" // USES int_array
+#include "pylith/utils/array.hh" // USES int_array, int_buffer
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5
+
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
+#include <fstream> // USES std::ifstream
+#include <cstring> // USES strcmp()
+#include <string> // USES std::string
 
 #include <algorithm> // USES std::sort, std::find
 #include <map> // USES std::map
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        namespace _MeshOps {
+            static const char* preparedDistributionName = "pylith_prepared";
+
+            /** Gather up to maxReport offending cells from each process on process 0 and write them to the stream.
+             *
+             * @param[inout] msg Output stream for message.
+             * @param[in] cells Global cell numbers of local offending cells.
+             * @param[in] maxReport Maximum number of cells to report.
+             * @param[in] comm MPI communicator.
+             */
+            static
+            void reportCells(std::ostringstream& msg,
+                             const std::vector<PetscInt>& cells,
+                             const size_t maxReport,
+                             MPI_Comm comm);
+
+        } // _MeshOps
+    } // topology
+} // pylith
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Create subdomain mesh using label.
@@ -121,6 +150,17 @@ pylith::topology::MeshOps::createLowerDimMesh(const pylith::topology::Mesh& mesh
 
     PetscErrorCode err = PETSC_SUCCESS;
 
+    // Reuse submesh created for another boundary condition, integrator, or observer on the same label.
+    PetscDM dmCached = mesh.getLowerDimDM(labelName, labelValue);
+    if (dmCached) {
+        err = PetscObjectReference((PetscObject) dmCached);PYLITH_CHECK_ERROR(err);
+        pylith::topology::Mesh* submesh = new pylith::topology::Mesh(true);assert(submesh);
+        submesh->setCoordSys(mesh.getCoordSys());
+        submesh->setDM(dmCached);
+        submesh->createSubpointMaps();
+        PYLITH_METHOD_RETURN(submesh);
+    } // if
+
     PetscDM dmDomain = mesh.getDM();assert(dmDomain);
     PetscBool hasLabel = PETSC_FALSE;
     err = DMHasLabel(dmDomain, labelName, &hasLabel);PYLITH_CHECK_ERROR(err);
@@ -175,10 +215,13 @@ pylith::topology::MeshOps::createLowerDimMesh(const pylith::topology::Mesh& mesh
     pylith::topology::Mesh* submesh = new pylith::topology::Mesh(true);assert(submesh);
     submesh->setCoordSys(mesh.getCoordSys());
     submesh->setDM(dmSubmesh);
+    submesh->createSubpointMaps();
 
     // Check topology
     MeshOps::checkTopology(*submesh);
 
+    mesh.setLowerDimDM(labelName, labelValue, submesh->getDM());
+
     PYLITH_METHOD_RETURN(submesh);
 } // createLowerDimMesh
 
@@ -203,17 +246,17 @@ pylith::topology::MeshOps::createFromPoints(const PylithReal* points,
     const PetscInt depth = 0;
     PetscInt dmNumPoints[1];
     dmNumPoints[0] = numPoints;
-    pylith::int_array dmConeSizes(0, numPoints);
-    pylith::int_array dmCones(0, numPoints);
-    pylith::int_array dmConeOrientations(0, numPoints);
+    pylith::int_buffer dmConeSizes;dmConeSizes.assign(numPoints, 0);
+    pylith::int_buffer dmCones;dmCones.assign(numPoints, 0);
+    pylith::int_buffer dmConeOrientations;dmConeOrientations.assign(numPoints, 0);
 
     const size_t spaceDim = cs->getSpaceDim();
 
     err = DMPlexCreate(comm, &dmPoints);PYLITH_CHECK_ERROR(err);
     err = DMSetDimension(dmPoints, 0);PYLITH_CHECK_ERROR(err);
     err = DMSetCoordinateDim(dmPoints, spaceDim);PYLITH_CHECK_ERROR(err);
-    err = DMPlexCreateFromDAG(dmPoints, depth, dmNumPoints, &dmConeSizes[0], &dmCones[0],
-                              &dmConeOrientations[0], points);PYLITH_CHECK_ERROR(err);
+    err = DMPlexCreateFromDAG(dmPoints, depth, dmNumPoints, dmConeSizes.data(), dmCones.data(),
+                              dmConeOrientations.data(), points);PYLITH_CHECK_ERROR(err);
 
     PetscSF sf = NULL;
     err = DMGetPointSF(dmPoints, &sf);PYLITH_CHECK_ERROR(err);
@@ -248,6 +291,16 @@ pylith::topology::MeshOps::nondimensionalize(Mesh* const mesh,
     err = DMPlexSetScale(dmMesh, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
     err = DMViewFromOptions(dmMesh, NULL, "-pylith_nondim_dm_view");PYLITH_CHECK_ERROR(err);
 
+    // Coarse meshes kept for geometric multigrid.
+    PetscDM dmCoarse = NULL;
+    err = DMGetCoarseDM(dmMesh, &dmCoarse);PYLITH_CHECK_ERROR(err);
+    while (dmCoarse) {
+        err = DMGetCoordinatesLocal(dmCoarse, &coordVec);PYLITH_CHECK_ERROR(err);assert(coordVec);
+        err = VecScale(coordVec, 1.0/lengthScale);PYLITH_CHECK_ERROR(err);
+        err = DMPlexSetScale(dmCoarse, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+        err = DMGetCoarseDM(dmCoarse, &dmCoarse);PYLITH_CHECK_ERROR(err);
+    } // while
+
     const PetscInt dim = mesh->getDimension();
     if (dim < 1) {
         PYLITH_METHOD_END;
@@ -301,6 +354,206 @@ pylith::topology::MeshOps::checkTopology(const Mesh& mesh) {
 } // checkTopology
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check topology, geometry, and labels of a distributed mesh.
+void
+pylith::topology::MeshOps::checkDistributedTopology(const Mesh& mesh,
+                                                    const size_t maxReport) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    MPI_Comm comm = mesh.getComm();
+    PetscErrorCode err;
+
+    err = DMViewFromOptions(dmMesh, NULL, "-pylith_checktopo_dm_view");PYLITH_CHECK_ERROR(err);
+
+    DMLabel subpointMap = NULL;
+    err = DMPlexGetSubpointMap(dmMesh, &subpointMap);PYLITH_CHECK_ERROR(err);
+    const PetscInt cellHeight = subpointMap ? 1 : 0;
+
+    enum CheckEnum {
+        CHECK_SYMMETRY=0,
+        CHECK_SKELETON=1,
+        CHECK_POINTSF=2,
+        CHECK_ORIENTATION=3,
+        CHECK_MATERIAL=4,
+        CHECK_LABELS=5,
+        NUM_CHECKS=6,
+    };
+    int localFailures[NUM_CHECKS] = { 0, 0, 0, 0, 0, 0 };
+
+    // Checks of the local topology. Errors are returned rather than raised so that every process reaches the
+    // collective operations below.
+    err = PetscPushErrorHandler(PetscReturnErrorHandler, NULL);PYLITH_CHECK_ERROR(err);
+    localFailures[CHECK_SYMMETRY] = DMPlexCheckSymmetry(dmMesh) ? 1 : 0;
+    localFailures[CHECK_SKELETON] = DMPlexCheckSkeleton(dmMesh, cellHeight) ? 1 : 0;
+    localFailures[CHECK_POINTSF] = DMPlexCheckPointSF(dmMesh, NULL, PETSC_FALSE) ? 1 : 0;
+    err = PetscPopErrorHandler();PYLITH_CHECK_ERROR(err);
+
+    // Group cells owned by this process by cell type, skipping cohesive cells. Cells not owned by this process have
+    // negative global cell numbers.
+    Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+
+    PetscIS globalCellNumbersIS = NULL;
+    const PetscInt* globalCellNumbers = NULL;
+    err = DMPlexGetCellNumbering(dmMesh, &globalCellNumbersIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(globalCellNumbersIS, &globalCellNumbers);PYLITH_CHECK_ERROR(err);
+
+    PetscDMLabel materialsLabel = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::cells_label_name, &materialsLabel);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PetscInt> badMaterialCells;
+    std::map<int, std::vector<PetscInt> > cellsByType;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        if (globalCellNumbers[c-cStart] < 0) { continue; }
+        if (isCohesiveCell(dmMesh, c)) { continue; }
+
+        DMPolytopeType cellType;
+        err = DMPlexGetCellType(dmMesh, c, &cellType);PYLITH_CHECK_ERROR(err);
+        cellsByType[cellType].push_back(c);
+
+        PetscInt matId = -1;
+        if (materialsLabel) {
+            err = DMLabelGetValue(materialsLabel, c, &matId);PYLITH_CHECK_ERROR(err);
+        } // if
+        if (matId < 0) {
+            badMaterialCells.push_back(globalCellNumbers[c-cStart]);
+        } // if
+    } // for
+    localFailures[CHECK_MATERIAL] = badMaterialCells.size();
+
+    // Compute the Jacobian determinant at the quadrature points for all cells of a given type at once.
+    std::vector<PetscInt> badOrientationCells;
+    PetscDMField coordField = NULL;
+    err = DMGetCoordinateField(dmMesh, &coordField);PYLITH_CHECK_ERROR(err);
+    for (std::map<int, std::vector<PetscInt> >::const_iterator iter = cellsByType.begin(); iter != cellsByType.end(); ++iter) {
+        const DMPolytopeType cellType = DMPolytopeType(iter->first);
+        const std::vector<PetscInt>& cells = iter->second;
+        const PetscInt numCells = cells.size();
+        const PetscInt cellDim = DMPolytopeTypeGetDim(cellType);
+
+        PetscIS cellIS = NULL;
+        err = ISCreateGeneral(PETSC_COMM_SELF, numCells, &cells[0], PETSC_USE_POINTER, &cellIS);PYLITH_CHECK_ERROR(err);
+
+        PetscQuadrature quadrature = NULL;
+        err = DMFieldCreateDefaultQuadrature(coordField, cellIS, &quadrature);PYLITH_CHECK_ERROR(err);
+        if (!quadrature) {
+            // Affine cells have a constant Jacobian, so a single point is sufficient.
+            if (DMPolytopeTypeGetNumVertices(cellType) == cellDim+1) {
+                err = PetscDTStroudConicalQuadrature(cellDim, 1, 1, -1.0, 1.0, &quadrature);PYLITH_CHECK_ERROR(err);
+            } else {
+                err = PetscDTGaussTensorQuadrature(cellDim, 1, 1, -1.0, 1.0, &quadrature);PYLITH_CHECK_ERROR(err);
+            } // if/else
+        } // if
+        PetscInt numQuadPts = 0;
+        err = PetscQuadratureGetData(quadrature, NULL, NULL, &numQuadPts, NULL, NULL);PYLITH_CHECK_ERROR(err);
+
+        PetscFEGeom* geometry = NULL;
+        err = DMFieldCreateFEGeom(coordField, cellIS, quadrature, PETSC_FALSE, &geometry);PYLITH_CHECK_ERROR(err);
+        assert(geometry);
+        for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+            for (PetscInt iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+                if (geometry->detJ[iCell*numQuadPts+iQuad] <= 0.0) {
+                    badOrientationCells.push_back(globalCellNumbers[cells[iCell]-cStart]);
+                    break;
+                } // if
+            } // for
+        } // for
+        err = PetscFEGeomDestroy(&geometry);PYLITH_CHECK_ERROR(err);
+        err = PetscQuadratureDestroy(&quadrature);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&cellIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    localFailures[CHECK_ORIENTATION] = badOrientationCells.size();
+    err = ISRestoreIndices(globalCellNumbersIS, &globalCellNumbers);PYLITH_CHECK_ERROR(err);
+
+    // Check that points shared across processes have the same label values as the owning process.
+    PetscInt numLabels = 0;
+    err = DMGetNumLabels(dmMesh, &numLabels);PYLITH_CHECK_ERROR(err);
+    int numLabelsLocal[2] = { int(numLabels), -int(numLabels) };
+    int numLabelsGlobal[2] = { 0, 0 };
+    err = MPI_Allreduce(numLabelsLocal, numLabelsGlobal, 2, MPI_INT, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    pylith::string_vector badLabels;
+    if (numLabelsGlobal[0] != -numLabelsGlobal[1]) {
+        badLabels.push_back("(number of labels differs among processes)");
+    } else {
+        PetscInt pStart = 0, pEnd = 0;
+        err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        PetscSF sfPoint = NULL;
+        PetscInt numRoots = 0, numLeaves = 0;
+        const PetscInt* localPoints = NULL;
+        const PetscSFNode* remotePoints = NULL;
+        err = DMGetPointSF(dmMesh, &sfPoint);PYLITH_CHECK_ERROR(err);
+        err = PetscSFGetGraph(sfPoint, &numRoots, &numLeaves, &localPoints, &remotePoints);PYLITH_CHECK_ERROR(err);
+
+        std::vector<PetscInt> rootValues(pEnd-pStart+1);
+        std::vector<PetscInt> leafValues(pEnd-pStart+1);
+        for (PetscInt iLabel = 0; iLabel < numLabels; ++iLabel) {
+            PetscDMLabel label = NULL;
+            const char* labelName = NULL;
+            err = DMGetLabelByNum(dmMesh, iLabel, &label);PYLITH_CHECK_ERROR(err);
+            err = DMGetLabelName(dmMesh, iLabel, &labelName);PYLITH_CHECK_ERROR(err);
+            for (PetscInt p = pStart; p < pEnd; ++p) {
+                err = DMLabelGetValue(label, p, &rootValues[p-pStart]);PYLITH_CHECK_ERROR(err);
+            } // for
+            leafValues = rootValues;
+            err = PetscSFBcastBegin(sfPoint, MPIU_INT, &rootValues[0], &leafValues[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+            err = PetscSFBcastEnd(sfPoint, MPIU_INT, &rootValues[0], &leafValues[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+                const PetscInt p = localPoints ? localPoints[iLeaf] : iLeaf;
+                if (leafValues[p-pStart] != rootValues[p-pStart]) {
+                    badLabels.push_back(labelName);
+                    break;
+                } // if
+            } // for
+        } // for
+    } // if/else
+    localFailures[CHECK_LABELS] = badLabels.size();
+
+    int globalFailures[NUM_CHECKS];
+    err = MPI_Allreduce(localFailures, globalFailures, NUM_CHECKS, MPI_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    int numFailures = 0;
+    for (int i = 0; i < NUM_CHECKS; ++i) {
+        numFailures += globalFailures[i];
+    } // for
+
+    // Gathering the offending cells is collective, so every process builds the message.
+    std::ostringstream msg;
+    if (numFailures > 0) {
+        msg << "Error in topology of the distributed mesh.";
+        if (globalFailures[CHECK_SYMMETRY]) {
+            msg << "\n  Adjacency information is not symmetric on " << globalFailures[CHECK_SYMMETRY] << " process(es).";
+        } // if
+        if (globalFailures[CHECK_SKELETON]) {
+            msg << "\n  Cell skeleton is inconsistent on " << globalFailures[CHECK_SKELETON] << " process(es).";
+        } // if
+        if (globalFailures[CHECK_POINTSF]) {
+            msg << "\n  Point star forest is invalid on " << globalFailures[CHECK_POINTSF] << " process(es).";
+        } // if
+        if (globalFailures[CHECK_ORIENTATION]) {
+            msg << "\n  " << globalFailures[CHECK_ORIENTATION]
+                << " cell(s) have a nonpositive Jacobian determinant (inverted or degenerate cells).";
+            _MeshOps::reportCells(msg, badOrientationCells, maxReport, comm);
+        } // if
+        if (globalFailures[CHECK_MATERIAL]) {
+            msg << "\n  " << globalFailures[CHECK_MATERIAL] << " cell(s) do not have a value for label '"
+                << pylith::topology::Mesh::cells_label_name << "'.";
+            _MeshOps::reportCells(msg, badMaterialCells, maxReport, comm);
+        } // if
+        if (globalFailures[CHECK_LABELS]) {
+            msg << "\n  Values of labels at points shared among processes do not match.";
+            for (size_t i = 0; i < badLabels.size(); ++i) {
+                msg << "\n    Label '" << badLabels[i] << "'";
+            } // for
+        } // if
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // checkDistributedTopology
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 bool
 pylith::topology::MeshOps::isSimplexMesh(const Mesh& mesh) {
@@ -356,6 +609,49 @@ pylith::topology::MeshOps::isCohesiveCell(const PetscDM dm,
 } // isCohesiveCell
 
 
+// ------------------------------------------------------------------------------------------------
+// Remove all points other than cells from label.
+void
+pylith::topology::MeshOps::removeNonCellsFromLabel(PetscDM dm,
+                                                   const char* labelName) {
+    PYLITH_METHOD_BEGIN;
+    assert(dm);
+    assert(labelName);
+
+    PetscErrorCode err;
+    PetscDMLabel matidLabel = NULL;
+    PetscIS valuesIS = NULL;
+    const PetscInt *values = NULL;
+    PetscInt cStart, cEnd, labelNumValues;
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, labelName, &matidLabel);PYLITH_CHECK_ERROR(err);
+    err = DMLabelGetNumValues(matidLabel, &labelNumValues);PYLITH_CHECK_ERROR(err);
+    err = DMLabelGetValueIS(matidLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue = 0; iValue < labelNumValues; ++iValue) {
+        PetscIS stratumIS = NULL;
+        const PetscInt *points = NULL;
+        const PetscInt value = values[iValue];
+        PetscInt numPoints;
+        err = DMLabelGetStratumSize(matidLabel, value, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = DMLabelGetStratumIS(matidLabel, value, &stratumIS);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(stratumIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt p = 0; p < numPoints; ++p) {
+            const PetscInt point = points[p];
+            if (( point < cStart) || ( point >= cEnd) ) {
+                err = DMLabelClearValue(matidLabel, point, value);PYLITH_CHECK_ERROR(err);
+            } // if
+        } // for
+        err = ISRestoreIndices(stratumIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&stratumIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // removeNonCellsFromLabel
+
+
 // ----------------------------------------------------------------------
 // Get number of vertices in mesh.
 PylithInt
@@ -488,4 +784,146 @@ pylith::topology::MeshOps::checkMaterialLabels(const pylith::topology::Mesh& mes
 } // checkMaterialIds
 
 
+// ------------------------------------------------------------------------------------------------
+// Gather up to maxReport offending cells from each process on process 0 and write them to the stream.
+void
+pylith::topology::_MeshOps::reportCells(std::ostringstream& msg,
+                                        const std::vector<PetscInt>& cells,
+                                        const size_t maxReport,
+                                        MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err;
+    int commRank = 0, commSize = 1;
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+    const int numLocal = std::min(cells.size(), maxReport);
+    std::vector<int> numCells(commSize, 0);
+    err = MPI_Gather(const_cast<int*>(&numLocal), 1, MPI_INT, &numCells[0], 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+
+    std::vector<int> offsets(commSize, 0);
+    for (int i = 1; i < commSize; ++i) {
+        offsets[i] = offsets[i-1] + numCells[i-1];
+    } // for
+    const int numGathered = offsets[commSize-1] + numCells[commSize-1];
+    std::vector<PetscInt> cellsGathered(numGathered+1);
+    err = MPI_Gatherv(const_cast<PetscInt*>(cells.empty() ? NULL : &cells[0]), numLocal, MPIU_INT,
+                      &cellsGathered[0], &numCells[0], &offsets[0], MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+
+    if (!commRank) {
+        std::sort(cellsGathered.begin(), cellsGathered.begin()+numGathered);
+        const size_t numReport = std::min(size_t(numGathered), maxReport);
+        msg << "\n    Global cell numbers:";
+        for (size_t i = 0; i < numReport; ++i) {
+            msg << " " << cellsGathered[i];
+        } // for
+        if (size_t(numGathered) > numReport) {
+            msg << " ...";
+        } // if
+    } else {
+        msg << "\n    See output from process 0 for the list of cells.";
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // reportCells
+
+
+// ------------------------------------------------------------------------------------------------
+// Save prepared mesh to PETSc DMPlex HDF5 file.
+void
+pylith::topology::MeshOps::savePrepared(const Mesh& mesh,
+                                        const char* filename,
+                                        const char* key) {
+    PYLITH_METHOD_BEGIN;
+    assert(filename);
+    assert(key);
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    MPI_Comm comm = mesh.getComm();
+    PetscMPIInt commSize = 0;
+    PetscErrorCode err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+    const PetscInt numProcs = commSize;
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(comm, filename, FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+    err = DMPlexDistributionSetName(dmMesh, _MeshOps::preparedDistributionName);PYLITH_CHECK_ERROR(err);
+    err = DMView(dmMesh, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5WriteAttribute(viewer, "/", "pylith_prepared_key", PETSC_STRING, key);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5WriteAttribute(viewer, "/", "pylith_prepared_num_procs", PETSC_INT, &numProcs);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // savePrepared
+
+
+// ------------------------------------------------------------------------------------------------
+// Load prepared mesh from PETSc DMPlex HDF5 file if it matches the key and number of processes.
+bool
+pylith::topology::MeshOps::loadPrepared(Mesh* mesh,
+                                        const char* filename,
+                                        const char* key) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+    assert(filename);
+    assert(key);
+
+    MPI_Comm comm = mesh->getComm();
+    PetscMPIInt commRank = 0, commSize = 0;
+    PetscErrorCode err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+    int fileExists = 0;
+    if (!commRank) {
+        std::ifstream fin(filename);
+        fileExists = fin.good() ? 1 : 0;
+    } // if
+    err = MPI_Bcast(&fileExists, 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    if (!fileExists) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(comm, filename, FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+
+    // The key and number of processes must match those used to create the file.
+    PetscBool hasKey = PETSC_FALSE, hasNumProcs = PETSC_FALSE;
+    err = PetscViewerHDF5HasAttribute(viewer, "/", "pylith_prepared_key", &hasKey);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5HasAttribute(viewer, "/", "pylith_prepared_num_procs", &hasNumProcs);PYLITH_CHECK_ERROR(err);
+    int isMatch = 0;
+    if (hasKey && hasNumProcs) {
+        char* fileKey = NULL;
+        PetscInt numProcs = 0;
+        err = PetscViewerHDF5ReadAttribute(viewer, "/", "pylith_prepared_key", PETSC_STRING, NULL, &fileKey);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerHDF5ReadAttribute(viewer, "/", "pylith_prepared_num_procs", PETSC_INT, NULL, &numProcs);PYLITH_CHECK_ERROR(err);
+        isMatch = (numProcs == commSize) && (commRank || (fileKey && !strcmp(fileKey, key))) ? 1 : 0;
+        err = PetscFree(fileKey);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = MPI_Bcast(&isMatch, 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    if (!isMatch) {
+        err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    const char* dmNameTmp = NULL;
+    err = PetscObjectGetName((PetscObject) mesh->getDM(), &dmNameTmp);PYLITH_CHECK_ERROR(err);
+    const std::string dmName(dmNameTmp); // Copy, because setDM() destroys the original DM.
+
+    PetscDM dmMesh = NULL;
+    err = DMCreate(comm, &dmMesh);PYLITH_CHECK_ERROR(err);
+    err = DMSetType(dmMesh, DMPLEX);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) dmMesh, dmName.c_str());PYLITH_CHECK_ERROR(err);
+    err = DMPlexDistributionSetName(dmMesh, _MeshOps::preparedDistributionName);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+    err = DMLoad(dmMesh, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmMesh, dmName.c_str());
+
+    PYLITH_METHOD_RETURN(true);
+} // loadPrepared
+
+
 // End of file
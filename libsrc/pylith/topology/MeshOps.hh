@@ -55,6 +55,10 @@ public:
                                                 const char* descriptiveLabel);
 
     /** Create lower dimension mesh using label.
+     *
+     * The PETSc DM of the lower dimension mesh is cached in the domain mesh, so later calls with the same label name
+     * and value return a mesh sharing the DM. The lower dimension mesh holds the maps between its points and the
+     * points of the domain mesh (see Mesh::createSubpointMaps()).
      *
      * @param[in] mesh Mesh for domain.
      * @param[in] labelName Name of label marking subdomain.
@@ -98,6 +102,21 @@ public:
     static
     void checkTopology(const Mesh& mesh);
 
+    /** Check topology, geometry, and labels of a distributed mesh.
+     *
+     * All checks are done on the local portion of the mesh and then combined across processes, so the cost
+     * scales with the number of cells per process. We check the symmetry of the adjacency information, the cell
+     * skeleton, and the point star forest; the orientation of the cells (positive Jacobian determinant at the
+     * quadrature points); and the consistency of labels (every cell has a material id and shared points have the
+     * same label values on all processes). Each offending cell is reported once using its global cell number.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] maxReport Maximum number of offending cells to list in the error message.
+     */
+    static
+    void checkDistributedTopology(const Mesh& mesh,
+                                  const size_t maxReport=10);
+
     /** Determine is mesh contains simplex cells (i.e., line, tri, tet).
      *
      * @param[in] mesh Finite-element mesh.
@@ -116,6 +135,17 @@ public:
     bool isCohesiveCell(const PetscDM dm,
                         const PetscInt cell);
 
+    /** Remove all points other than cells from label.
+     *
+     * Mesh refinement labels the new faces, edges, and vertices of labeled cells as well.
+     *
+     * @param[in] dm PETSc DM with mesh.
+     * @param[in] labelName Name of label.
+     */
+    static
+    void removeNonCellsFromLabel(PetscDM dm,
+                                 const char* labelName);
+
     /** Get number of vertices in mesh.
      *
      * @param[in] mesh Finite-element mesh.
@@ -150,6 +180,32 @@ public:
     void checkMaterialLabels(const Mesh& mesh,
                              pylith::int_array& labelValues);
 
+    /** Save prepared mesh (distributed with cohesive cells) to PETSc DMPlex HDF5 file.
+     *
+     * The distribution of the mesh among processes is saved with the mesh, so it can be reloaded without
+     * repartitioning when using the same number of processes.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] filename Name of HDF5 file.
+     * @param[in] key Key identifying the input and parameters used to prepare the mesh (only used on process 0).
+     */
+    static
+    void savePrepared(const Mesh& mesh,
+                      const char* filename,
+                      const char* key);
+
+    /** Load prepared mesh from PETSc DMPlex HDF5 file if it matches the key and number of processes.
+     *
+     * @param[inout] mesh Finite-element mesh.
+     * @param[in] filename Name of HDF5 file.
+     * @param[in] key Key identifying the input and parameters used to prepare the mesh (only used on process 0).
+     * @returns True if the mesh was loaded, false if the file does not exist or does not match.
+     */
+    static
+    bool loadPrepared(Mesh* mesh,
+                      const char* filename,
+                      const char* key);
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -0,0 +1,161 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "pylith/topology/RefineAdaptive.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::topology::RefineAdaptive::RefineAdaptive(void) :
+    _labelName(""),
+    _labelValue(1) {}
+
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::topology::RefineAdaptive::~RefineAdaptive(void) {
+    deallocate();
+}
+
+
+// ----------------------------------------------------------------------
+// Deallocate data structures.
+void
+pylith::topology::RefineAdaptive::deallocate(void) {}
+
+
+// ----------------------------------------------------------------------
+// Set label marking points near which cells are refined.
+void
+pylith::topology::RefineAdaptive::setLabel(const char* name,
+                                           const int value) {
+    assert(name);
+
+    _labelName = name;
+    _labelValue = value;
+}
+
+
+// ----------------------------------------------------------------------
+// Refine mesh.
+void
+pylith::topology::RefineAdaptive::refine(Mesh* const newMesh,
+                                         const Mesh& mesh,
+                                         const int levels) {
+    PYLITH_METHOD_BEGIN;
+
+    if (levels < 1) {
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(newMesh);
+
+    PetscErrorCode err;
+    PetscDM dmOrig = mesh.getDM();assert(dmOrig);
+
+    PetscInt meshDepth = 0;
+    err = DMPlexGetDepth(dmOrig, &meshDepth);PYLITH_CHECK_ERROR(err);
+
+    const int meshDim = mesh.getDimension();
+    if (( meshDim > 0) && ( meshDepth != meshDim) ) {
+        std::ostringstream msg;
+        msg << "Mesh refinement for uninterpolated meshes not supported.\n"
+            << "Turn on interpolated meshes using 'interpolate' mesh generator property.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (!MeshOps::isSimplexMesh(mesh)) {
+        throw std::runtime_error("Adaptive mesh refinement requires a mesh with simplex cells (triangles or tetrahedra).");
+    } // if
+    if (_labelName.empty()) {
+        throw std::runtime_error("Label for adaptive mesh refinement not specified.");
+    } // if
+
+    PetscBool hasLabel = PETSC_FALSE;
+    err = DMHasLabel(dmOrig, _labelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+    if (!hasLabel) {
+        std::ostringstream msg;
+        msg << "Could not find group of points '" << _labelName << "' in mesh for adaptive mesh refinement.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Refine, keeping original mesh intact.
+    PetscDM dmCur = dmOrig;
+    PetscDM dmNew = NULL;
+    for (int i = 0; i < levels; ++i) {
+        // Flag all cells sharing a point with the label.
+        PetscDMLabel adaptLabel = NULL;
+        err = DMLabelCreate(PETSC_COMM_SELF, "adapt", &adaptLabel);PYLITH_CHECK_ERROR(err);
+        err = DMLabelSetDefaultValue(adaptLabel, DM_ADAPT_KEEP);PYLITH_CHECK_ERROR(err);
+
+        Stratum cellsStratum(dmCur, Stratum::HEIGHT, 0);
+        const PetscInt cStart = cellsStratum.begin();
+        const PetscInt cEnd = cellsStratum.end();
+
+        PetscIS pointsIS = NULL;
+        err = DMGetStratumIS(dmCur, _labelName.c_str(), _labelValue, &pointsIS);PYLITH_CHECK_ERROR(err);
+        if (pointsIS) {
+            PetscInt numPoints = 0;
+            const PetscInt* points = NULL;
+            err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+                PetscInt* star = NULL;
+                PetscInt starSize = 0;
+                err = DMPlexGetTransitiveClosure(dmCur, points[iPoint], PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+                for (PetscInt iStar = 0; iStar < starSize; ++iStar) {
+                    const PetscInt point = star[2*iStar];
+                    if ((point >= cStart) && (point < cEnd)) {
+                        err = DMLabelSetValue(adaptLabel, point, DM_ADAPT_REFINE);PYLITH_CHECK_ERROR(err);
+                    } // if
+                } // for
+                err = DMPlexRestoreTransitiveClosure(dmCur, points[iPoint], PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+            } // for
+            err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+            err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        err = DMAdaptLabel(dmCur, adaptLabel, &dmNew);PYLITH_CHECK_ERROR(err);
+        err = DMLabelDestroy(&adaptLabel);PYLITH_CHECK_ERROR(err);
+        MeshOps::removeNonCellsFromLabel(dmNew, pylith::topology::Mesh::cells_label_name);
+
+        if (dmCur != dmOrig) {
+            err = DMDestroy(&dmCur);PYLITH_CHECK_ERROR(err);
+        } // if
+        dmCur = dmNew;
+    } // for
+
+    newMesh->setDM(dmNew);
+
+    // Check consistency
+    topology::MeshOps::checkTopology(*newMesh);
+
+    PYLITH_METHOD_END;
+} // refine
+
+
+// End of file
@@ -0,0 +1,91 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/RefineAdaptive.hh
+ *
+ * @brief Object for managing local mesh refinement near labeled features.
+ *
+ * Cells that share a point with a label (for example, the vertices on a fault surface or along the buried edges of a
+ * fault) are refined using DMPlex adaptivity (DMAdaptLabel). The new points on the refined feature retain the label,
+ * so each additional level refines the cells closer to the feature. The adaptive refinement is conforming only for
+ * simplex cells and does not support cohesive cells, so the mesh is refined before the faults are inserted.
+ */
+
+#if !defined(pylith_topology_refineadaptive_hh)
+#define pylith_topology_refineadaptive_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include <string> // HASA std::string
+
+// RefineAdaptive -------------------------------------------------------
+/// Object for managing local mesh refinement near labeled features.
+class pylith::topology::RefineAdaptive
+{ // RefineAdaptive
+  friend class TestRefineAdaptive; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  RefineAdaptive(void);
+
+  /// Destructor
+  ~RefineAdaptive(void);
+
+  /// Deallocate data structures.
+  void deallocate(void);
+
+  /** Set label marking points near which cells are refined.
+   *
+   * @param name Name of label.
+   * @param value Value of label.
+   */
+  void setLabel(const char* name,
+		const int value);
+
+  /** Refine mesh.
+   *
+   * @param newMesh Refined mesh (result).
+   * @param mesh Mesh to refine.
+   * @param levels Number of levels to refine.
+   */
+  void refine(Mesh* const newMesh,
+	      const Mesh& mesh,
+	      const int levels =1);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::string _labelName; ///< Name of label marking points near which cells are refined.
+  int _labelValue; ///< Value of label marking points near which cells are refined.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  RefineAdaptive(const RefineAdaptive&); ///< Not implemented
+  const RefineAdaptive& operator=(const RefineAdaptive&); ///< Not implemented
+
+}; // RefineAdaptive
+
+#endif // pylith_topology_refineadaptive_hh
+
+ 
+// End of file 
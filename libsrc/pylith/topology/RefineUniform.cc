@@ -23,14 +23,34 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/MeshOps.hh" // USES MeshOps
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/SetupProfiler.hh" // USES SetupProfiler
 
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _RefineUniform {
+public:
+
+            /** Count number of cohesive cells on this process.
+             *
+             * @param[in] dm PETSc DM with mesh.
+             * @returns Number of cohesive cells.
+             */
+            static
+            PetscInt countCohesiveCells(PetscDM dm);
+
+        }; // _RefineUniform
+    } // topology
+} // pylith
+
 // ----------------------------------------------------------------------
 // Constructor
-pylith::topology::RefineUniform::RefineUniform(void) {}
+pylith::topology::RefineUniform::RefineUniform(void) :
+    _keepCoarseLevels(false) {}
 
 
 // ----------------------------------------------------------------------
@@ -46,6 +66,14 @@ void
 pylith::topology::RefineUniform::deallocate(void) {}
 
 
+// ----------------------------------------------------------------------
+// Set flag for keeping the coarse meshes as the coarse DMs of the refined mesh.
+void
+pylith::topology::RefineUniform::setKeepCoarseLevels(const bool value) {
+    _keepCoarseLevels = value;
+}
+
+
 // ----------------------------------------------------------------------
 // Refine mesh.
 void
@@ -74,51 +102,42 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
         throw std::runtime_error(msg.str());
     } // if
 
-    // Refine, keeping original mesh intact.
+    pylith::utils::SetupProfiler::begin("Refine mesh");
+
+    // Refine, keeping original mesh intact. Refinement is local to each process, so the partition is unchanged,
+    // and the labels (materials, boundary conditions, and faults) and cohesive cells are refined with the cells.
     PetscDM dmNew = NULL;
     err = DMPlexSetRefinementUniform(dmOrig, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
     err = DMRefine(dmOrig, mesh.getComm(), &dmNew);PYLITH_CHECK_ERROR(err);
+    // Removing non-cells after each level keeps the label from growing with all of the points in the refined mesh.
+    pylith::topology::MeshOps::removeNonCellsFromLabel(dmNew, pylith::topology::Mesh::cells_label_name);
+    if (_keepCoarseLevels) {
+        err = DMSetCoarseDM(dmNew, dmOrig);PYLITH_CHECK_ERROR(err);
+    } // if
 
     for (int i = 1; i < levels; ++i) {
         PetscDM dmCur = dmNew;dmNew = NULL;
         err = DMPlexSetRefinementUniform(dmCur, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
         err = DMRefine(dmCur, mesh.getComm(), &dmNew);PYLITH_CHECK_ERROR(err);
+        pylith::topology::MeshOps::removeNonCellsFromLabel(dmNew, pylith::topology::Mesh::cells_label_name);
+        if (_keepCoarseLevels) {
+            err = DMSetCoarseDM(dmNew, dmCur);PYLITH_CHECK_ERROR(err);
+        } // if
 
         err = DMDestroy(&dmCur);PYLITH_CHECK_ERROR(err);
     } // for
 
     newMesh->setDM(dmNew);
+    pylith::utils::SetupProfiler::end("Refine mesh");
 
-    // Remove all non-cells from cells label
-    const char* const labelName = pylith::topology::Mesh::cells_label_name;
-    PetscDMLabel matidLabel = NULL;
-    PetscIS valuesIS = NULL;
-    const PetscInt *values = NULL;
-    PetscInt cStart, cEnd, labelNumValues;
-    err = DMPlexGetHeightStratum(dmNew, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
-    err = DMGetLabel(dmNew, labelName, &matidLabel);PYLITH_CHECK_ERROR(err);
-    err = DMLabelGetNumValues(matidLabel, &labelNumValues);PYLITH_CHECK_ERROR(err);
-    err = DMLabelGetValueIS(matidLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
-    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
-    for (PetscInt iValue = 0; iValue < labelNumValues; ++iValue) {
-        PetscIS stratumIS = NULL;
-        const PetscInt *points = NULL;
-        const PetscInt value = values[iValue];
-        PetscInt numPoints;
-        err = DMLabelGetStratumSize(matidLabel, value, &numPoints);PYLITH_CHECK_ERROR(err);
-        err = DMLabelGetStratumIS(matidLabel, value, &stratumIS);PYLITH_CHECK_ERROR(err);
-        err = ISGetIndices(stratumIS, &points);PYLITH_CHECK_ERROR(err);
-        for (PetscInt p = 0; p < numPoints; ++p) {
-            const PetscInt point = points[p];
-            if (( point < cStart) || ( point >= cEnd) ) {
-                err = DMLabelClearValue(matidLabel, point, value);PYLITH_CHECK_ERROR(err);
-            } // if
-        } // for
-        err = ISRestoreIndices(stratumIS, &points);PYLITH_CHECK_ERROR(err);
-        err = ISDestroy(&stratumIS);PYLITH_CHECK_ERROR(err);
-    } // for
-    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
-    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+    const PetscInt numCohesiveOrig = _RefineUniform::countCohesiveCells(dmOrig);
+    const PetscInt numCohesiveNew = _RefineUniform::countCohesiveCells(dmNew);
+    if ((numCohesiveOrig > 0) && (numCohesiveNew < numCohesiveOrig)) {
+        std::ostringstream msg;
+        msg << "Uniform refinement did not preserve cohesive cells (" << numCohesiveOrig << " cohesive cells before refinement, "
+            << numCohesiveNew << " after refinement).";
+        throw std::logic_error(msg.str());
+    } // if
 
     // Check consistency
     topology::MeshOps::checkTopology(*newMesh);
@@ -129,4 +148,26 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
 } // refine
 
 
+// ------------------------------------------------------------------------------------------------
+// Count number of cohesive cells on this process.
+PetscInt
+pylith::topology::_RefineUniform::countCohesiveCells(PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(dm);
+
+    PetscErrorCode err;
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+
+    // Cohesive cells are after all other cells.
+    PetscInt numCohesive = 0;
+    for (PetscInt cell = cEnd-1; cell >= cStart; --cell) {
+        if (!pylith::topology::MeshOps::isCohesiveCell(dm, cell)) { break; }
+        ++numCohesive;
+    } // for
+
+    PYLITH_METHOD_RETURN(numCohesive);
+} // countCohesiveCells
+
+
 // End of file
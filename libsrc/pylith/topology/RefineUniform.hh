@@ -46,6 +46,14 @@ public :
   /// Deallocate data structures.
   void deallocate(void);
 
+  /** Set flag for keeping the coarse meshes as the coarse DMs of the refined mesh.
+   *
+   * The coarse meshes provide the hierarchy for geometric multigrid (PCMG).
+   *
+   * @param value True if keeping coarse meshes, false otherwise.
+   */
+  void setKeepCoarseLevels(const bool value);
+
   /** Refine mesh.
    *
    * @param newMesh Refined mesh (result).
@@ -56,6 +64,11 @@ public :
 	      const Mesh& mesh,
 	      const int levels =1);
 
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  bool _keepCoarseLevels; ///< Keep coarse meshes as coarse DMs of refined mesh.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
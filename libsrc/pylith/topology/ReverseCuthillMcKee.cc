@@ -21,12 +21,96 @@
 #include "ReverseCuthillMcKee.hh" // implementation of class methods
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::isCohesiveCell()
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/SetupProfiler.hh" // USES SetupProfiler
+
+#include <algorithm> // USES std::sort(), std::copy(), std::min(), std::max()
+#include <cfloat> // USES DBL_MAX
+#include <map> // USES std::map
+#include <vector> // USES std::vector
+#include <stdint.h> // USES uint64_t
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _ReverseCuthillMcKee {
+public:
+
+            typedef std::vector<std::vector<PetscInt> > cellgroups_type;
+
+            /** Group cells by material, keeping cohesive cells after the other cells.
+             *
+             * @param[out] groups Cells in each group in their original order.
+             * @param[in] dm PETSc DM with mesh.
+             * @param[in] labelName Name of label with materials.
+             */
+            static
+            void groupCells(cellgroups_type* groups,
+                            PetscDM dm,
+                            const char* labelName);
+
+            /** Order cells in each group using reverse Cuthill-McKee on the cell adjacency graph.
+             *
+             * @param[inout] groups Cells in each group.
+             * @param[in] dm PETSc DM with mesh.
+             */
+            static
+            void orderRCM(cellgroups_type* groups,
+                          PetscDM dm);
+
+            /** Order cells in each group along a space-filling curve through the cell centroids.
+             *
+             * @param[inout] groups Cells in each group.
+             * @param[in] dm PETSc DM with mesh.
+             * @param[in] ordering Type of space-filling curve.
+             */
+            static
+            void orderCurve(cellgroups_type* groups,
+                            PetscDM dm,
+                            const ReverseCuthillMcKee::OrderingEnum ordering);
+
+            /** Compute index of point along space-filling curve.
+             *
+             * @param[in] coords Integer coordinates of point (modified).
+             * @param[in] dim Number of dimensions.
+             * @param[in] numBits Number of bits for each coordinate.
+             * @param[in] ordering Type of space-filling curve.
+             * @returns Index of point along curve.
+             */
+            static
+            uint64_t curveIndex(uint64_t* coords,
+                                const int dim,
+                                const int numBits,
+                                const ReverseCuthillMcKee::OrderingEnum ordering);
+
+            /** Create permutation of all points from the order of the cells.
+             *
+             * Vertices, edges, and faces are numbered in the order they first appear in the closure of the cells.
+             *
+             * @param[in] dm PETSc DM with mesh.
+             * @param[in] groups Cells in each group in their new order.
+             * @param[out] permutation Permutation with new point number for each old point.
+             */
+            static
+            void createPermutation(PetscDM dm,
+                                   const cellgroups_type& groups,
+                                   PetscIS* permutation);
+
+        }; // _ReverseCuthillMcKee
+    } // topology
+} // pylith
 
 // ----------------------------------------------------------------------
 // Reorder vertices and cells in mesh.
 void
-pylith::topology::ReverseCuthillMcKee::reorder(topology::Mesh* mesh) {
+pylith::topology::ReverseCuthillMcKee::reorder(topology::Mesh* mesh,
+                                               const OrderingEnum ordering) {
     assert(mesh);
     PetscErrorCode err = 0;
 
@@ -35,12 +119,38 @@ pylith::topology::ReverseCuthillMcKee::reorder(topology::Mesh* mesh) {
     const char* const labelName = pylith::topology::Mesh::cells_label_name;
     err = DMGetLabel(dmOrig, labelName, &dmLabel);PYLITH_CHECK_ERROR(err);assert(dmLabel);
 
+    pylith::utils::SetupProfiler::begin("Reorder mesh");
     PetscIS permutation = NULL;
     PetscDM dmNew = NULL;
-    err = DMPlexGetOrdering(dmOrig, MATORDERINGRCM, dmLabel, &permutation);PYLITH_CHECK_ERROR(err);
+    switch (ordering) {
+    case RCM:
+        err = DMPlexGetOrdering(dmOrig, MATORDERINGRCM, dmLabel, &permutation);PYLITH_CHECK_ERROR(err);
+        break;
+    case RCM_MATERIAL: {
+        _ReverseCuthillMcKee::cellgroups_type groups;
+        _ReverseCuthillMcKee::groupCells(&groups, dmOrig, labelName);
+        _ReverseCuthillMcKee::orderRCM(&groups, dmOrig);
+        _ReverseCuthillMcKee::createPermutation(dmOrig, groups, &permutation);
+        break;
+    } // RCM_MATERIAL
+    case HILBERT:
+    case MORTON: {
+        _ReverseCuthillMcKee::cellgroups_type groups;
+        _ReverseCuthillMcKee::groupCells(&groups, dmOrig, labelName);
+        _ReverseCuthillMcKee::orderCurve(&groups, dmOrig, ordering);
+        _ReverseCuthillMcKee::createPermutation(dmOrig, groups, &permutation);
+        break;
+    } // HILBERT/MORTON
+    default: {
+        std::ostringstream msg;
+        msg << "Unknown mesh ordering (" << ordering << ").";
+        throw std::logic_error(msg.str());
+    } // default
+    } // switch
     err = DMPlexPermute(dmOrig, permutation, &dmNew);PYLITH_CHECK_ERROR(err);
     err = ISDestroy(&permutation);PYLITH_CHECK_ERROR(err);
     mesh->setDM(dmNew);
+    pylith::utils::SetupProfiler::end("Reorder mesh");
 
     // Verify that all material points (cells) are consecutive.
     PetscIS valuesIS = NULL;
@@ -78,4 +188,295 @@ pylith::topology::ReverseCuthillMcKee::reorder(topology::Mesh* mesh) {
 } // reorder
 
 
+// ------------------------------------------------------------------------------------------------
+// Group cells by material, keeping cohesive cells after the other cells.
+void
+pylith::topology::_ReverseCuthillMcKee::groupCells(cellgroups_type* groups,
+                                                   PetscDM dm,
+                                                   const char* labelName) {
+    assert(groups);
+    PetscErrorCode err = 0;
+
+    PetscDMLabel dmLabel = NULL;
+    err = DMGetLabel(dm, labelName, &dmLabel);PYLITH_CHECK_ERROR(err);assert(dmLabel);
+
+    // Key is (is cohesive cell, label value), so std::map puts cohesive cells last.
+    std::map<std::pair<int, PetscInt>, std::vector<PetscInt> > cellsMap;
+    Stratum cellsStratum(dm, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt value = -1;
+        err = DMLabelGetValue(dmLabel, cell, &value);PYLITH_CHECK_ERROR(err);
+        const int isCohesive = pylith::topology::MeshOps::isCohesiveCell(dm, cell) ? 1 : 0;
+        cellsMap[std::make_pair(isCohesive, value)].push_back(cell);
+    } // for
+
+    groups->clear();
+    for (std::map<std::pair<int, PetscInt>, std::vector<PetscInt> >::iterator iter = cellsMap.begin(); iter != cellsMap.end(); ++iter) {
+        groups->push_back(iter->second);
+    } // for
+} // groupCells
+
+
+// ------------------------------------------------------------------------------------------------
+// Order cells in each group using reverse Cuthill-McKee on the cell adjacency graph.
+void
+pylith::topology::_ReverseCuthillMcKee::orderRCM(cellgroups_type* groups,
+                                                 PetscDM dm) {
+    assert(groups);
+    PetscErrorCode err = 0;
+
+    Stratum cellsStratum(dm, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt numCells = cellsStratum.size();
+
+    // Graph vertices are cells relative to cStart. The graph may omit cohesive cells, which then have no neighbors.
+    PetscInt numGraphCells = 0;
+    PetscInt* offsets = NULL;
+    PetscInt* adjacency = NULL;
+    err = DMPlexCreateNeighborCSR(dm, 0, &numGraphCells, &offsets, &adjacency);PYLITH_CHECK_ERROR(err);
+    assert(numGraphCells <= numCells);
+    std::vector<PetscInt> graphOffsets(numCells+1, offsets[numGraphCells]);
+    std::copy(offsets, offsets+numGraphCells+1, graphOffsets.begin());
+
+    // Only follow edges of the graph between cells in the same group.
+    std::vector<PetscInt> cellGroup(numCells, -1);
+    const size_t numGroups = groups->size();
+    for (size_t iGroup = 0; iGroup < numGroups; ++iGroup) {
+        const std::vector<PetscInt>& cells = (*groups)[iGroup];
+        for (size_t iCell = 0; iCell < cells.size(); ++iCell) {
+            cellGroup[cells[iCell]-cStart] = iGroup;
+        } // for
+    } // for
+    std::vector<PetscInt> degree(numCells, 0);
+    for (PetscInt cell = 0; cell < numCells; ++cell) {
+        for (PetscInt i = graphOffsets[cell]; i < graphOffsets[cell+1]; ++i) {
+            degree[cell] += (cellGroup[adjacency[i]] == cellGroup[cell]) ? 1 : 0;
+        } // for
+    } // for
+
+    std::vector<bool> isVisited(numCells, false);
+    std::vector<std::pair<PetscInt, PetscInt> > candidates;
+    std::vector<std::pair<PetscInt, PetscInt> > neighbors;
+    for (size_t iGroup = 0; iGroup < numGroups; ++iGroup) {
+        std::vector<PetscInt>& cells = (*groups)[iGroup];
+        const size_t numGroupCells = cells.size();
+
+        // Start each connected component from the unvisited cell with the lowest degree.
+        candidates.resize(numGroupCells);
+        for (size_t iCell = 0; iCell < numGroupCells; ++iCell) {
+            const PetscInt cell = cells[iCell] - cStart;
+            candidates[iCell] = std::make_pair(degree[cell], cell);
+        } // for
+        std::sort(candidates.begin(), candidates.end());
+
+        std::vector<PetscInt> order;
+        order.reserve(numGroupCells);
+        for (size_t iCandidate = 0; iCandidate < numGroupCells; ++iCandidate) {
+            const PetscInt start = candidates[iCandidate].second;
+            if (isVisited[start]) { continue; }
+            isVisited[start] = true;
+            order.push_back(start);
+
+            // Cuthill-McKee breadth-first traversal, visiting neighbors in order of increasing degree.
+            for (size_t iHead = order.size()-1; iHead < order.size(); ++iHead) {
+                const PetscInt cell = order[iHead];
+                neighbors.clear();
+                for (PetscInt i = graphOffsets[cell]; i < graphOffsets[cell+1]; ++i) {
+                    const PetscInt neighbor = adjacency[i];
+                    if ((cellGroup[neighbor] == PetscInt(iGroup)) && !isVisited[neighbor]) {
+                        isVisited[neighbor] = true;
+                        neighbors.push_back(std::make_pair(degree[neighbor], neighbor));
+                    } // if
+                } // for
+                std::sort(neighbors.begin(), neighbors.end());
+                for (size_t i = 0; i < neighbors.size(); ++i) {
+                    order.push_back(neighbors[i].second);
+                } // for
+            } // for
+        } // for
+        assert(order.size() == numGroupCells);
+        for (size_t iCell = 0; iCell < numGroupCells; ++iCell) {
+            cells[iCell] = order[numGroupCells-1-iCell] + cStart;
+        } // for
+    } // for
+
+    err = PetscFree(offsets);PYLITH_CHECK_ERROR(err);
+    err = PetscFree(adjacency);PYLITH_CHECK_ERROR(err);
+} // orderRCM
+
+
+// ------------------------------------------------------------------------------------------------
+// Order cells in each group along a space-filling curve through the cell centroids.
+void
+pylith::topology::_ReverseCuthillMcKee::orderCurve(cellgroups_type* groups,
+                                                   PetscDM dm,
+                                                   const ReverseCuthillMcKee::OrderingEnum ordering) {
+    assert(groups);
+    PetscErrorCode err = 0;
+
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dm, &spaceDim);PYLITH_CHECK_ERROR(err);assert(spaceDim > 0);
+    const int numBits = std::min(63 / int(spaceDim), 31);
+
+    // Compute cell centroids and their bounding box.
+    Stratum cellsStratum(dm, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    std::vector<double> centroids((cEnd-cStart)*spaceDim, 0.0);
+    std::vector<double> coordsMin(spaceDim, DBL_MAX);
+    std::vector<double> coordsMax(spaceDim, -DBL_MAX);
+    pylith::topology::CoordsVisitor coordsVisitor(dm);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscScalar* coordsCell = NULL;
+        PetscInt coordsSize = 0;
+        coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+        const PetscInt numVertices = coordsSize / spaceDim;assert(numVertices > 0);
+        double* centroid = &centroids[(cell-cStart)*spaceDim];
+        for (PetscInt iVertex = 0; iVertex < numVertices; ++iVertex) {
+            for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+                centroid[iDim] += PetscRealPart(coordsCell[iVertex*spaceDim+iDim]) / numVertices;
+            } // for
+        } // for
+        coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            coordsMin[iDim] = std::min(coordsMin[iDim], centroid[iDim]);
+            coordsMax[iDim] = std::max(coordsMax[iDim], centroid[iDim]);
+        } // for
+    } // for
+
+    // Use the same scale in all directions, so the curve does not distort the geometry.
+    double scale = 0.0;
+    for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+        scale = std::max(scale, coordsMax[iDim] - coordsMin[iDim]);
+    } // for
+    const double maxCoord = double((uint64_t(1) << numBits) - 1);
+    scale = (scale > 0.0) ? maxCoord / scale : 0.0;
+
+    std::vector<uint64_t> coordsInt(spaceDim);
+    std::vector<std::pair<uint64_t, PetscInt> > keys;
+    const size_t numGroups = groups->size();
+    for (size_t iGroup = 0; iGroup < numGroups; ++iGroup) {
+        std::vector<PetscInt>& cells = (*groups)[iGroup];
+        const size_t numGroupCells = cells.size();
+        keys.resize(numGroupCells);
+        for (size_t iCell = 0; iCell < numGroupCells; ++iCell) {
+            const double* centroid = &centroids[(cells[iCell]-cStart)*spaceDim];
+            for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+                coordsInt[iDim] = uint64_t(std::min(maxCoord, (centroid[iDim] - coordsMin[iDim]) * scale));
+            } // for
+            keys[iCell] = std::make_pair(curveIndex(&coordsInt[0], spaceDim, numBits, ordering), cells[iCell]);
+        } // for
+        std::sort(keys.begin(), keys.end());
+        for (size_t iCell = 0; iCell < numGroupCells; ++iCell) {
+            cells[iCell] = keys[iCell].second;
+        } // for
+    } // for
+} // orderCurve
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute index of point along space-filling curve.
+uint64_t
+pylith::topology::_ReverseCuthillMcKee::curveIndex(uint64_t* coords,
+                                                   const int dim,
+                                                   const int numBits,
+                                                   const ReverseCuthillMcKee::OrderingEnum ordering) {
+    assert(coords);
+    assert(dim > 0);
+    assert(numBits > 0 && dim*numBits <= 64);
+
+    if (ReverseCuthillMcKee::HILBERT == ordering) {
+        // Transform coordinates to the transpose of the Hilbert index (J. Skilling, AIP Conf. Proc. 707, 2004).
+        const uint64_t maxBit = uint64_t(1) << (numBits-1);
+        for (uint64_t q = maxBit; q > 1; q >>= 1) {
+            const uint64_t p = q - 1;
+            for (int i = 0; i < dim; ++i) {
+                if (coords[i] & q) {
+                    coords[0] ^= p;
+                } else {
+                    const uint64_t t = (coords[0] ^ coords[i]) & p;
+                    coords[0] ^= t;
+                    coords[i] ^= t;
+                } // if/else
+            } // for
+        } // for
+        for (int i = 1; i < dim; ++i) {
+            coords[i] ^= coords[i-1];
+        } // for
+        uint64_t t = 0;
+        for (uint64_t q = maxBit; q > 1; q >>= 1) {
+            if (coords[dim-1] & q) {
+                t ^= q - 1;
+            } // if
+        } // for
+        for (int i = 0; i < dim; ++i) {
+            coords[i] ^= t;
+        } // for
+    } // if
+
+    // Interleave bits, starting with the most significant bit.
+    uint64_t index = 0;
+    for (int iBit = numBits-1; iBit >= 0; --iBit) {
+        for (int i = 0; i < dim; ++i) {
+            index = (index << 1) | ((coords[i] >> iBit) & 1);
+        } // for
+    } // for
+
+    return index;
+} // curveIndex
+
+
+// ------------------------------------------------------------------------------------------------
+// Create permutation of all points from the order of the cells.
+void
+pylith::topology::_ReverseCuthillMcKee::createPermutation(PetscDM dm,
+                                                          const cellgroups_type& groups,
+                                                          PetscIS* permutation) {
+    assert(permutation);
+    PetscErrorCode err = 0;
+
+    PetscInt pStart = 0, pEnd = 0, depth = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepth(dm, &depth);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> nextPoint(depth+1);
+    for (PetscInt iDepth = 0; iDepth <= depth; ++iDepth) {
+        err = DMPlexGetDepthStratum(dm, iDepth, &nextPoint[iDepth], NULL);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // The closure of a cell starts with the cell, so cells are numbered in their new order.
+    std::vector<PetscInt> perm(pEnd-pStart, -1);
+    const size_t numGroups = groups.size();
+    for (size_t iGroup = 0; iGroup < numGroups; ++iGroup) {
+        const std::vector<PetscInt>& cells = groups[iGroup];
+        for (size_t iCell = 0; iCell < cells.size(); ++iCell) {
+            PetscInt* closure = NULL;
+            PetscInt closureSize = 0;
+            err = DMPlexGetTransitiveClosure(dm, cells[iCell], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+                const PetscInt point = closure[2*iPoint];
+                if (perm[point-pStart] < 0) {
+                    PetscInt pointDepth = 0;
+                    err = DMPlexGetPointDepth(dm, point, &pointDepth);PYLITH_CHECK_ERROR(err);
+                    perm[point-pStart] = nextPoint[pointDepth]++;
+                } // if
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dm, cells[iCell], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+
+    // Points not in the closure of any cell keep their relative order.
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        if (perm[point-pStart] < 0) {
+            PetscInt pointDepth = 0;
+            err = DMPlexGetPointDepth(dm, point, &pointDepth);PYLITH_CHECK_ERROR(err);
+            perm[point-pStart] = nextPoint[pointDepth]++;
+        } // if
+    } // for
+
+    err = ISCreateGeneral(PETSC_COMM_SELF, pEnd-pStart, &perm[0], PETSC_COPY_VALUES, permutation);PYLITH_CHECK_ERROR(err);
+} // createPermutation
+
+
 // End of file
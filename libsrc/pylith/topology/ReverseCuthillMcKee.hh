@@ -19,7 +19,12 @@
 /**
  * @file libsrc/topology/ReverseCuthillMcKee.hh
  *
- * @brief Interface to PETSc reverse Cuthill-McKee reordering.
+ * @brief Interface to reordering of mesh cells and vertices.
+ *
+ * In addition to PETSc reverse Cuthill-McKee reordering over the entire mesh, cells can be reordered using
+ * reverse Cuthill-McKee within each material or using Hilbert or Morton (Z-order) space-filling curves on the cell
+ * centroids. In all cases, cells in a material remain consecutive and cohesive cells remain after the other cells;
+ * vertices, edges, and faces are ordered by their first appearance in the closure of the reordered cells.
  */
 
 #if !defined(pylith_topology_reversecuthillmckee_hh)
@@ -36,13 +41,22 @@ class pylith::topology::ReverseCuthillMcKee
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
-  /** Reorder vertices and cells of mesh using PETSc routines
-   * implementing reverse Cuthill-McKee algorithm.
+  /// Algorithm for ordering the cells.
+  enum OrderingEnum {
+    RCM=0, ///< PETSc reverse Cuthill-McKee over the entire mesh.
+    RCM_MATERIAL=1, ///< Reverse Cuthill-McKee within each material.
+    HILBERT=2, ///< Hilbert space-filling curve on cell centroids within each material.
+    MORTON=3, ///< Morton (Z-order) space-filling curve on cell centroids within each material.
+  }; // OrderingEnum
+
+  /** Reorder vertices and cells of mesh.
    *
    * @param mesh PyLith finite-element mesh.
+   * @param ordering Algorithm for ordering the cells.
    */
   static
-  void reorder(topology::Mesh* mesh);
+  void reorder(topology::Mesh* mesh,
+	       const OrderingEnum ordering=RCM);
 
 }; // ReverseCuthillMcKee
 
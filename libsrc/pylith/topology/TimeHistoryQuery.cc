@@ -0,0 +1,187 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TimeHistoryQuery.hh" // implementation of class methods
+
+#include "Field.hh" // USES Field
+#include "VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::sort(), std::unique(), std::lower_bound()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+// Default constructor.
+pylith::topology::TimeHistoryQuery::TimeHistoryQuery(const char* startTimeSubfield,
+                                                     const char* valueSubfield) :
+    _startTimeSubfield(startTimeSubfield),
+    _valueSubfield(valueSubfield),
+    _vecId(0),
+    _vecState(-1) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::topology::TimeHistoryQuery::~TimeHistoryQuery(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::topology::TimeHistoryQuery::deallocate(void) {
+    _startTimes.clear();
+    _values.clear();
+    _startTimeIndices.clear();
+    _valueOffsets.clear();
+    _vecId = 0;
+    _vecState = -1;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Update time history value subfield at time t.
+void
+pylith::topology::TimeHistoryQuery::update(pylith::topology::Field* field,
+                                           const PylithReal t,
+                                           const PylithReal timeScale,
+                                           spatialdata::spatialdb::TimeHistory* const dbTimeHistory) {
+    PYLITH_METHOD_BEGIN;
+    assert(field);
+    assert(dbTimeHistory);
+
+    if (!_isCurrent(*field)) {
+        _setup(*field);
+    } // if
+
+    // Query time history database once per unique start time. Start times are sorted in increasing order, so the
+    // relative times decrease monotonically.
+    const size_t numStartTimes = _startTimes.size();
+    for (size_t i = 0; i < numStartTimes; ++i) {
+        const PylithScalar tRel = t - _startTimes[i];
+        PylithScalar value = 0.0;
+        if (tRel >= 0.0) {
+            PylithScalar tDim = tRel * timeScale;
+            const int err = dbTimeHistory->query(&value, tDim);
+            if (err) {
+                std::ostringstream msg;
+                msg << "Error querying for time '" << tDim << "' in time history database '" << dbTimeHistory->getDescription() << "'.";
+                throw std::runtime_error(msg.str());
+            } // if
+        } // if
+        _values[i] = value;
+    } // for
+
+    // Update values (normalized amplitude) in local section.
+    PetscErrorCode err = 0;
+    PetscVec localVec = field->getLocalVector();assert(localVec);
+    PetscScalar* fieldArray = NULL;
+    err = VecGetArray(localVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+    const size_t numPoints = _valueOffsets.size();
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        fieldArray[_valueOffsets[iPoint]] = _values[_startTimeIndices[iPoint]];
+    } // for
+    err = VecRestoreArray(localVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)localVec, &_vecState);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // update
+
+
+// ------------------------------------------------------------------------------------------------
+// Build table of unique start times and offsets of values in section.
+void
+pylith::topology::TimeHistoryQuery::_setup(const pylith::topology::Field& field) {
+    PYLITH_METHOD_BEGIN;
+
+    deallocate();
+
+    PetscErrorCode err = 0;
+    PetscSection fieldSection = field.getLocalSection();assert(fieldSection);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(fieldSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    pylith::topology::VecVisitorMesh fieldVisitor(field);
+    const PetscScalar* fieldArray = fieldVisitor.localArray();assert(fieldArray);
+
+    const PetscInt i_startTime = field.getSubfieldInfo(_startTimeSubfield.c_str()).index;
+    const PetscInt i_value = field.getSubfieldInfo(_valueSubfield.c_str()).index;
+
+    std::vector<PylithScalar> startTimes;
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        // Skip points without values in section.
+        if (!fieldVisitor.sectionDof(p)) {continue;}
+
+        startTimes.push_back(fieldArray[fieldVisitor.sectionSubfieldOffset(i_startTime, p)]);
+        _valueOffsets.push_back(fieldVisitor.sectionSubfieldOffset(i_value, p));
+    } // for
+
+    // Create sorted table of unique start times and find entry in table for each point.
+    _startTimes = startTimes;
+    std::sort(_startTimes.begin(), _startTimes.end());
+    _startTimes.erase(std::unique(_startTimes.begin(), _startTimes.end()), _startTimes.end());
+    _values.resize(_startTimes.size());
+
+    const size_t numPoints = startTimes.size();
+    _startTimeIndices.resize(numPoints);
+    size_t iHint = 0;
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        // Neighboring points usually share the same start time, so check the previous entry before searching.
+        if ((iHint >= _startTimes.size()) || (_startTimes[iHint] != startTimes[iPoint])) {
+            iHint = std::lower_bound(_startTimes.begin(), _startTimes.end(), startTimes[iPoint]) - _startTimes.begin();
+        } // if
+        assert(iHint < _startTimes.size());
+        _startTimeIndices[iPoint] = iHint;
+    } // for
+
+    PetscVec localVec = field.getLocalVector();assert(localVec);
+    err = PetscObjectGetId((PetscObject)localVec, &_vecId);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setup
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether table matches field.
+bool
+pylith::topology::TimeHistoryQuery::_isCurrent(const pylith::topology::Field& field) const {
+    PYLITH_METHOD_BEGIN;
+
+    PetscVec localVec = field.getLocalVector();
+    if (!localVec || (_vecState < 0)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscErrorCode err = 0;
+    PetscObjectId vecId = 0;
+    PetscObjectState vecState = 0;
+    err = PetscObjectGetId((PetscObject)localVec, &vecId);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)localVec, &vecState);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN((vecId == _vecId) && (vecState == _vecState));
+} // _isCurrent
+
+
+// End of file
@@ -0,0 +1,112 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/TimeHistoryQuery.hh
+ *
+ * @brief Set time history value subfield via cached queries of a time history database.
+ *
+ * The start times of the points in the field are gathered once into a sorted table of unique values, and each point
+ * holds the index of its start time in the table and the offset of its value in the local section. Each update
+ * queries the time history database once per unique start time and writes the values directly into the section, so
+ * the cost per point is constant. The table is rebuilt if the field values are changed by another object.
+ */
+
+#if !defined(pylith_topology_timehistoryquery_hh)
+#define pylith_topology_timehistoryquery_hh
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh" // HASA PylithScalar, PetscObjectState
+
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // USES TimeHistory
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::topology::TimeHistoryQuery {
+    friend class TestTimeHistoryQuery; // unit testing
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /** Default constructor.
+     *
+     * @param[in] startTimeSubfield Name of subfield with start time of time history.
+     * @param[in] valueSubfield Name of subfield with value of time history.
+     */
+    TimeHistoryQuery(const char* startTimeSubfield,
+                     const char* valueSubfield);
+
+    /// Destructor.
+    ~TimeHistoryQuery(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Update time history value subfield at time t.
+     *
+     * @param[inout] field Field with start time and value subfields.
+     * @param[in] t Current time (nondimensional).
+     * @param[in] timeScale Time scale for dimensionalizing time.
+     * @param[in] dbTimeHistory Time history database.
+     */
+    void update(pylith::topology::Field* field,
+                const PylithReal t,
+                const PylithReal timeScale,
+                spatialdata::spatialdb::TimeHistory* const dbTimeHistory);
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Build table of unique start times and offsets of values in section.
+     *
+     * @param[in] field Field with start time and value subfields.
+     */
+    void _setup(const pylith::topology::Field& field);
+
+    /** Check whether table matches field.
+     *
+     * @param[in] field Field with start time and value subfields.
+     * @returns True if table matches field, false otherwise.
+     */
+    bool _isCurrent(const pylith::topology::Field& field) const;
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    std::string _startTimeSubfield; ///< Name of subfield with start time.
+    std::string _valueSubfield; ///< Name of subfield with time history value.
+    std::vector<PylithScalar> _startTimes; ///< Sorted unique start times.
+    std::vector<PylithScalar> _values; ///< Time history values for unique start times.
+    std::vector<size_t> _startTimeIndices; ///< Index of start time in table for each point with a value.
+    std::vector<PetscInt> _valueOffsets; ///< Offset of value in local section for each point with a value.
+    PetscObjectId _vecId; ///< Id of local vector when table was built.
+    PetscObjectState _vecState; ///< State of local vector after last update.
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    TimeHistoryQuery(const TimeHistoryQuery&); ///< Not implemented
+    const TimeHistoryQuery& operator=(const TimeHistoryQuery&); ///< Not implemented
+
+}; // TimeHistoryQuery
+
+#endif // pylith_topology_timehistoryquery_hh
+
+// End of file
@@ -31,6 +31,7 @@
 
 #include "pylith/utils/petscfwd.h" // HASA PetscVec, PetscSection
 #include "pylith/utils/arrayfwd.hh" // USES scalar_array
+#include "pylith/utils/array.hh" // HASA int_array
 
 // VecVisitorMesh ----------------------------------------------------------
 /** @brief Helper class for accessing field values at points in a
@@ -213,6 +214,92 @@ private:
 
 // VecVisitorMesh
 
+// VecScatterPlanMesh ------------------------------------------------------
+/** @brief Precomputed map between the values of a set of subfields in
+ *  a flat array and their locations in the local array of a field.
+ *
+ * Setting up the plan queries the section once for every point and
+ * subfield; copying values with the plan is a single indexed loop
+ * that can be reused as long as the layout of the field does not
+ * change. Values in the flat array are ordered by point, then by
+ * subfield (in the order given), and then by degree of freedom.
+ */
+class pylith::topology::VecScatterPlanMesh { // VecScatterPlanMesh
+    friend class TestVecScatterPlanMesh; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    VecScatterPlanMesh(void);
+
+    /// Default destructor
+    ~VecScatterPlanMesh(void);
+
+    /** Compute indices into local array of field for subfields.
+     *
+     * @param[in] field Field over a mesh.
+     * @param[in] subfieldIndices Indices of subfields in field.
+     * @param[in] numSubfields Number of subfields.
+     */
+    void initialize(const Field& field,
+                    const PetscInt* subfieldIndices,
+                    const PetscInt numSubfields);
+
+    /// Clear cached data.
+    void clear(void);
+
+    /** Check whether plan was computed for current layout of field.
+     *
+     * @param[in] field Field over a mesh.
+     * @returns True if plan matches the local section of the field.
+     */
+    bool isCurrent(const Field& field) const;
+
+    /** Get number of values in plan.
+     *
+     * @returns Number of values.
+     */
+    size_t size(void) const;
+
+    /** Get indices into local array of field.
+     *
+     * @returns Array of indices.
+     */
+    const int_array& indices(void) const;
+
+    /** Copy values from flat array into local array of field.
+     *
+     * @param[inout] fieldArray Local array of field.
+     * @param[in] values Flat array of values for subfields.
+     */
+    void scatter(PetscScalar* fieldArray,
+                 const PetscScalar* values) const;
+
+    /** Copy values from local array of field into flat array.
+     *
+     * @param[out] values Flat array of values for subfields.
+     * @param[in] fieldArray Local array of field.
+     */
+    void gather(PetscScalar* values,
+                const PetscScalar* fieldArray) const;
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    int_array _indices; ///< Indices into local array of field.
+    PetscSection _localSection; ///< PETSc local section used to compute plan.
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    VecScatterPlanMesh(const VecScatterPlanMesh&); ///< Not implemented
+    const VecScatterPlanMesh& operator=(const VecScatterPlanMesh&); ///< Not implemented
+
+};
+
+// VecScatterPlanMesh
+
 // MatVisitorMesh ----------------------------------------------------------
 /** @brief Helper class for accessing field values at points in a
  *  finite-element mesh.
@@ -292,6 +292,13 @@ public:
      */
     PetscInt size(void) const;
 
+    /** Get point in submesh corresponding to point in mesh.
+     *
+     * @param[in] point Point in mesh.
+     * @return Point in submesh (-1 if point is not in submesh).
+     */
+    PetscInt subpoint(const PetscInt point) const;
+
     // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private:
 
@@ -299,6 +306,10 @@ private:
     PetscIS _indexSet; ///< PETSc index set.
     PetscInt _size; ///< Size of index set.
     const PetscInt* _indices; ///< Array of indices of points in index set.
+    const PetscInt* _subpoints; ///< Array of points in submesh indexed by point-_pStart in mesh.
+    PetscInt _pStart; ///< First point in mesh in _subpoints.
+    PetscInt _pEnd; ///< One past last point in mesh in _subpoints.
+    bool _restoreIndices; ///< True if _indices must be restored to _indexSet.
 
 }; // SubmeshIS
 
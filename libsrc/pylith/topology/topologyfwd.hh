@@ -41,18 +41,21 @@ namespace pylith {
         class FieldBase;
         class Field;
         class VecVisitorMesh;
+        class VecScatterPlanMesh;
         class VecVisitorSubmesh;
 
         class FE;
         class FieldFactory;
         class FieldOps;
         class FieldQuery;
+        class TimeHistoryQuery;
 
         class MatVisitorMesh;
         class MatVisitorSubmesh;
 
         class Distributor;
         class RefineUniform;
+        class RefineAdaptive;
         class ReverseCuthillMcKee;
 
     } // topology
@@ -0,0 +1,169 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/AlignedBuffer.hh
+ *
+ * @brief Growable buffer of plain values with cache-line aligned storage.
+ *
+ * The buffer is intended for large temporary arrays used during setup, such as the coordinates and cells read by
+ * the mesh importers. Unlike std::valarray, resizing does not initialize or copy values unless requested, storage
+ * grows geometrically, and clear() keeps the storage so that a single buffer can be reused for a sequence of
+ * temporaries without reallocating. The values must be plain old data (integers and floating point values).
+ */
+
+#if !defined(pylith_utils_alignedbuffer_hh)
+#define pylith_utils_alignedbuffer_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include <cstddef> // USES size_t
+
+// AlignedBuffer --------------------------------------------------------
+/// @brief Growable buffer of plain values with cache-line aligned storage.
+template<typename T>
+class pylith::utils::AlignedBuffer { // AlignedBuffer
+    friend class TestAlignedBuffer; // unit testing
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /// Alignment of storage in bytes.
+    static const size_t ALIGNMENT = 64;
+
+    /// Default constructor.
+    AlignedBuffer(void);
+
+    /** Constructor with size.
+     *
+     * @param[in] size Number of values (uninitialized).
+     */
+    explicit
+    AlignedBuffer(const size_t size);
+
+    /// Destructor.
+    ~AlignedBuffer(void);
+
+    /// Deallocate storage.
+    void deallocate(void);
+
+    /** Reserve storage without changing the number of values.
+     *
+     * @param[in] capacity Minimum number of values that fit in storage.
+     */
+    void reserve(const size_t capacity);
+
+    /** Set number of values, keeping existing values.
+     *
+     * New values are not initialized.
+     *
+     * @param[in] size Number of values.
+     */
+    void resize(const size_t size);
+
+    /** Set number of values and set all values.
+     *
+     * @param[in] size Number of values.
+     * @param[in] value Value for all entries.
+     */
+    void assign(const size_t size,
+                const T& value);
+
+    /** Append value, growing storage if necessary.
+     *
+     * @param[in] value Value to append.
+     */
+    void push_back(const T& value);
+
+    /// Remove all values, keeping storage for reuse.
+    void clear(void);
+
+    /** Exchange values and storage with another buffer.
+     *
+     * @param[inout] other Buffer to exchange with.
+     */
+    void swap(AlignedBuffer& other);
+
+    /** Get number of values.
+     *
+     * @returns Number of values.
+     */
+    size_t size(void) const;
+
+    /** Get number of values that fit in storage.
+     *
+     * @returns Number of values.
+     */
+    size_t capacity(void) const;
+
+    /** Get pointer to values.
+     *
+     * @returns Pointer to values (NULL if no storage has been allocated).
+     */
+    T* data(void);
+
+    /** Get pointer to values.
+     *
+     * @returns Pointer to values (NULL if no storage has been allocated).
+     */
+    const T* data(void) const;
+
+    /** Get value.
+     *
+     * @param[in] index Index of value.
+     * @returns Reference to value.
+     */
+    T& operator[](const size_t index);
+
+    /** Get value.
+     *
+     * @param[in] index Index of value.
+     * @returns Reference to value.
+     */
+    const T& operator[](const size_t index) const;
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Allocate new storage and copy existing values.
+     *
+     * @param[in] capacity Number of values that fit in new storage.
+     */
+    void _reallocate(const size_t capacity);
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    T* _values; ///< Storage for values.
+    size_t _size; ///< Number of values.
+    size_t _capacity; ///< Number of values that fit in storage.
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    AlignedBuffer(const AlignedBuffer&); ///< Not implemented
+    const AlignedBuffer& operator=(const AlignedBuffer&); ///< Not implemented
+
+}; // AlignedBuffer
+
+#include "AlignedBuffer.icc" // template and inline methods
+
+#endif // pylith_utils_alignedbuffer_hh
+
+// End of file
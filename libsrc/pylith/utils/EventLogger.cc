@@ -22,10 +22,68 @@
 
 #include "error.hh" // USES PYLITH_METHOD_BEGIN/END
 
+#include "petsctime.h" // USES PetscTime()
+
+#include <algorithm> // USES std::min()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
+#include <fstream> // USES std::ofstream
+#include <iomanip> // USES std::setprecision()
+#include <vector> // USES std::vector
 #include <cassert> // USES assert()
 
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class _EventLogger {
+public:
+
+            /// Beginning or end of event or stage in timeline trace.
+            struct TraceRecord {
+                double time; ///< Wall clock time (s).
+                int id; ///< Event or stage identifier.
+                bool isStage; ///< True if stage, false if event.
+                bool isBegin; ///< True if beginning, false if end.
+            }; // TraceRecord
+
+            static std::vector<TraceRecord> traceBuffer; ///< Ring buffer of trace records.
+            static size_t traceNumRecords; ///< Number of records since trace was enabled.
+            static double traceTimeStart; ///< Wall clock time when trace was enabled.
+            static std::vector<int> traceStages; ///< Stack of current stages.
+            static std::map<int, std::string> eventNames; ///< Names of events.
+            static std::map<int, std::string> stageNames; ///< Names of stages.
+
+            /** Write trace records of this process in Chrome trace event format.
+             *
+             * @param[out] sout Output stream.
+             * @param[in] rank Rank of process.
+             * @param[in] isFirst True if no other records have been written to the file.
+             */
+            static
+            void writeTraceEvents(std::ostream& sout,
+                                  const int rank,
+                                  const bool isFirst);
+
+            /** Quote string as JSON string.
+             *
+             * @param[in] value String value.
+             * @returns Quoted string.
+             */
+            static
+            std::string quote(const std::string& value);
+
+        }; // _EventLogger
+    } // utils
+} // pylith
+
+std::vector<pylith::utils::_EventLogger::TraceRecord> pylith::utils::_EventLogger::traceBuffer;
+size_t pylith::utils::_EventLogger::traceNumRecords = 0;
+double pylith::utils::_EventLogger::traceTimeStart = 0.0;
+std::vector<int> pylith::utils::_EventLogger::traceStages;
+std::map<int, std::string> pylith::utils::_EventLogger::eventNames;
+std::map<int, std::string> pylith::utils::_EventLogger::stageNames;
+bool pylith::utils::EventLogger::_traceEnabled = false;
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::utils::EventLogger::EventLogger(void) :
@@ -76,6 +134,7 @@ pylith::utils::EventLogger::registerEvent(const char* name) {
         throw std::runtime_error(msg.str());
     } // if
     _events[name] = id;
+    _EventLogger::eventNames[id] = name;
     PYLITH_METHOD_RETURN(id);
 } // registerEvent
 
@@ -97,6 +156,25 @@ pylith::utils::EventLogger::getEventId(const char* name) {
 } // getEventId
 
 
+// ----------------------------------------------------------------------
+// Get handle for event.
+pylith::utils::EventLogger::Event
+pylith::utils::EventLogger::getEvent(const char* name) const {
+    PYLITH_METHOD_BEGIN;
+
+    map_event_type::const_iterator iter = _events.find(name);
+    if (iter == _events.end()) {
+        std::ostringstream msg;
+        msg << "Could not find logging event '" << name << "' in logging class '" << _className << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    Event event;
+    event._id = iter->second;
+
+    PYLITH_METHOD_RETURN(event);
+} // getEvent
+
+
 // ----------------------------------------------------------------------
 // Register stage.
 int
@@ -112,6 +190,7 @@ pylith::utils::EventLogger::registerStage(const char* name) {
         throw std::runtime_error(msg.str());
     } // if
     _stages[name] = id;
+    _EventLogger::stageNames[id] = name;
 
     PYLITH_METHOD_RETURN(id);
 } // registerStage
@@ -134,4 +213,218 @@ pylith::utils::EventLogger::getStageId(const char* name) {
 } // getStageId
 
 
+// ----------------------------------------------------------------------
+// Log begin of stage shared among all loggers, registering the stage if necessary.
+void
+pylith::utils::EventLogger::stagePushShared(const char* name) {
+#if !defined(PYLITH_DISABLE_EVENT_LOGGING)
+    PYLITH_METHOD_BEGIN;
+
+    PetscLogStage id = -1;
+    PetscErrorCode err = PetscLogStageGetId(name, &id);PYLITH_CHECK_ERROR(err);
+    if (id < 0) {
+        err = PetscLogStageRegister(name, &id);
+        if (err) {
+            std::ostringstream msg;
+            msg << "Could not register logging stage '" << name << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+    err = PetscLogStagePush(id);PYLITH_CHECK_ERROR(err);
+    if (_traceEnabled) {
+        _EventLogger::stageNames.insert(std::make_pair(id, std::string(name)));
+        _traceRecord(id, true, true);
+    } // if
+
+    PYLITH_METHOD_END;
+#endif
+} // stagePushShared
+
+
+// ----------------------------------------------------------------------
+// Start recording timeline trace of events and stages on each process.
+void
+pylith::utils::EventLogger::enableTrace(const size_t bufferSize,
+                                        MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!bufferSize) {
+        throw std::runtime_error("Size of buffer for timeline trace must be positive.");
+    } // if
+    _EventLogger::traceBuffer.resize(bufferSize);
+    _EventLogger::traceNumRecords = 0;
+    _EventLogger::traceStages.clear();
+
+    PetscErrorCode err = MPI_Barrier(comm);PYLITH_CHECK_ERROR(err);
+    PetscTime(&_EventLogger::traceTimeStart);
+    _traceEnabled = true;
+
+    PYLITH_METHOD_END;
+} // enableTrace
+
+
+// ----------------------------------------------------------------------
+// Stop recording timeline trace and discard records.
+void
+pylith::utils::EventLogger::disableTrace(void) {
+    _traceEnabled = false;
+    std::vector<_EventLogger::TraceRecord>().swap(_EventLogger::traceBuffer);
+    _EventLogger::traceNumRecords = 0;
+    _EventLogger::traceStages.clear();
+} // disableTrace
+
+
+// ----------------------------------------------------------------------
+// Is timeline trace being recorded?
+bool
+pylith::utils::EventLogger::isTraceEnabled(void) {
+    return _traceEnabled;
+} // isTraceEnabled
+
+
+// ----------------------------------------------------------------------
+// Write timeline trace of all processes to file in Chrome trace event (JSON) format.
+void
+pylith::utils::EventLogger::writeTrace(const char* filename,
+                                       MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+    assert(filename);
+
+    int commRank = 0, commSize = 1;
+    MPI_Comm_rank(comm, &commRank);
+    MPI_Comm_size(comm, &commSize);
+
+    // Processes send their records to rank 0 one at a time to limit the memory used on rank 0.
+    const int tag = 0;
+    PetscErrorCode err = 0;
+    if (commRank) {
+        std::ostringstream buffer;
+        _EventLogger::writeTraceEvents(buffer, commRank, false);
+        const std::string& localString = buffer.str();
+        int localSize = localString.size();
+        err = MPI_Send(&localSize, 1, MPI_INT, 0, tag, comm);PYLITH_CHECK_ERROR(err);
+        err = MPI_Send(const_cast<char*>(localString.c_str()), localSize, MPI_CHAR, 0, tag, comm);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
+
+    std::ofstream fout(filename);
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open file '" << filename << "' for timeline trace.";
+        throw std::runtime_error(msg.str());
+    } // if
+    fout << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    _EventLogger::writeTraceEvents(fout, 0, true);
+    for (int iRank = 1; iRank < commSize; ++iRank) {
+        int size = 0;
+        err = MPI_Recv(&size, 1, MPI_INT, iRank, tag, comm, MPI_STATUS_IGNORE);PYLITH_CHECK_ERROR(err);
+        std::vector<char> chars(size > 0 ? size : 1);
+        err = MPI_Recv(&chars[0], size, MPI_CHAR, iRank, tag, comm, MPI_STATUS_IGNORE);PYLITH_CHECK_ERROR(err);
+        fout.write(&chars[0], size);
+    } // for
+    fout << "\n]}\n";
+    if (!fout.good()) {
+        std::ostringstream msg;
+        msg << "Error writing timeline trace to file '" << filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // writeTrace
+
+
+// ----------------------------------------------------------------------
+// Record beginning or end of event or stage in timeline trace.
+void
+pylith::utils::EventLogger::_traceRecord(const int id,
+                                         const bool isStage,
+                                         const bool isBegin) {
+    std::vector<_EventLogger::TraceRecord>& buffer = _EventLogger::traceBuffer;
+    if (buffer.empty()) {
+        return;
+    } // if
+
+    _EventLogger::TraceRecord record;
+    PetscTime(&record.time);
+    record.id = id;
+    record.isStage = isStage;
+    record.isBegin = isBegin;
+    if (isStage) {
+        // PETSc does not identify the stage when it is popped, so we track the stack of stages.
+        if (isBegin) {
+            _EventLogger::traceStages.push_back(id);
+        } else if (!_EventLogger::traceStages.empty()) {
+            record.id = _EventLogger::traceStages.back();
+            _EventLogger::traceStages.pop_back();
+        } // if/else
+    } // if
+    buffer[_EventLogger::traceNumRecords % buffer.size()] = record;
+    ++_EventLogger::traceNumRecords;
+} // _traceRecord
+
+
+// ----------------------------------------------------------------------
+// Write trace records of this process in Chrome trace event format.
+void
+pylith::utils::_EventLogger::writeTraceEvents(std::ostream& sout,
+                                              const int rank,
+                                              const bool isFirst) {
+    sout << std::fixed << std::setprecision(3);
+    sout << (isFirst ? "\n" : ",\n")
+         << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << rank << ", \"args\": {\"name\": \"rank "
+         << rank << "\"}},\n"
+         << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << rank << ", \"tid\": 0, \"args\": {\"name\": "
+         << "\"stages\"}},\n"
+         << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << rank << ", \"tid\": 1, \"args\": {\"name\": "
+         << "\"events\"}}";
+
+    // Records are in chronological order starting with the oldest record still in the ring buffer. Skip ends without
+    // beginnings if the beginnings were overwritten.
+    const size_t bufferSize = traceBuffer.size();
+    const size_t numRecords = std::min(traceNumRecords, bufferSize);
+    const size_t iStart = traceNumRecords - numRecords;
+    size_t depth[2] = { 0, 0 };
+    for (size_t iRecord = iStart; iRecord < traceNumRecords; ++iRecord) {
+        const TraceRecord& record = traceBuffer[iRecord % bufferSize];
+        const int tid = record.isStage ? 0 : 1;
+        if (record.isBegin) {
+            ++depth[tid];
+        } else if (depth[tid] > 0) {
+            --depth[tid];
+        } else {
+            continue;
+        } // if/else
+
+        const std::map<int, std::string>& names = record.isStage ? stageNames : eventNames;
+        const std::map<int, std::string>::const_iterator iter = names.find(record.id);
+        std::ostringstream name;
+        if (iter != names.end()) {
+            name << iter->second;
+        } else {
+            name << (record.isStage ? "stage " : "event ") << record.id;
+        } // if/else
+        sout << ",\n"
+             << "{\"name\": " << quote(name.str())
+             << ", \"cat\": \"" << (record.isStage ? "stage" : "event") << "\""
+             << ", \"ph\": \"" << (record.isBegin ? "B" : "E") << "\""
+             << ", \"ts\": " << 1.0e+6*(record.time - traceTimeStart)
+             << ", \"pid\": " << rank
+             << ", \"tid\": " << tid
+             << "}";
+    } // for
+} // writeTraceEvents
+
+
+// ----------------------------------------------------------------------
+// Quote string as JSON string.
+std::string
+pylith::utils::_EventLogger::quote(const std::string& value) {
+    std::string quoted = value;
+    for (size_t pos = quoted.find_first_of("\"\\"); pos != std::string::npos; pos = quoted.find_first_of("\"\\", pos+2)) {
+        quoted.insert(pos, "\\");
+    } // for
+    return "\"" + quoted + "\"";
+} // quote
+
+
 // End of file
@@ -22,6 +22,13 @@
  * @brief C++ object for managing event logging using PETSc.
  *
  * Each logger object manages the events for a single "logging class".
+ *
+ * Define PYLITH_DISABLE_EVENT_LOGGING (configure with --disable-event-logging) to compile out beginning and ending
+ * events and stages.
+ *
+ * The beginning and ending of events and stages can also be recorded with wall clock timestamps for each process
+ * in a ring buffer (timeline trace) and written in the Chrome trace event format, which shows load imbalance and
+ * waiting in collective operations and I/O in trace viewers such as Perfetto or chrome://tracing.
  */
 
 #if !defined(pylith_utils_eventlogger_hh)
@@ -35,6 +42,9 @@
 
 #include "petsc.h"
 #include "petsclog.h" // USES PetscLogEventBegin/End() in inline methods
+#include "petscsys.h" // USES MPI_Comm, PETSC_COMM_WORLD
+
+#include <cstddef> // USES size_t
 
 // EventLogger ----------------------------------------------------------
 /** @brief C++ object for managing event logging using PETSc.
@@ -44,6 +54,45 @@
 class pylith::utils::EventLogger { // EventLogger
     friend class TestEventLogger; // unit testing
 
+    // PUBLIC CLASSES ///////////////////////////////////////////////////////
+public:
+
+    /** @brief Handle for an event resolved once during setup.
+     *
+     * Beginning and ending an event through a handle does not look up the event by name, so handles should be used
+     * in frequently called functions.
+     */
+    class Event {
+        friend class EventLogger;
+
+public:
+
+        /// Constructor for unregistered event.
+        Event(void);
+
+        /** Get event identifier.
+         *
+         * @returns Event identifier.
+         */
+        int getId(void) const;
+
+        /** Has event been registered?
+         *
+         * @returns True if handle refers to a registered event, false otherwise.
+         */
+        bool isRegistered(void) const;
+
+        /// Log event begin.
+        void begin(void) const;
+
+        /// Log event end.
+        void end(void) const;
+
+private:
+
+        int _id; ///< PETSc logging identifier for event.
+    }; // Event
+
     // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public:
 
@@ -84,6 +133,13 @@ public:
      */
     int getEventId(const char* name);
 
+    /** Get handle for event.
+     *
+     * @param name Name of event.
+     * @returns Event handle.
+     */
+    Event getEvent(const char* name) const;
+
     /** Log event begin.
      *
      * @param id Event identifier.
@@ -121,9 +177,68 @@ public:
     /// Log stage end.
     void stagePop(void);
 
+    /** Log begin of stage shared among all loggers, registering the stage if necessary.
+     *
+     * Use a shared stage for work, such as output, that is started from objects without their own logger.
+     *
+     * @param name Name of stage.
+     */
+    static
+    void stagePushShared(const char* name);
+
+    /// Log end of stage shared among all loggers.
+    static
+    void stagePopShared(void);
+
+    /** Start recording timeline trace of events and stages on each process.
+     *
+     * Collective over the communicator, so that the timestamps of all processes start at approximately the same
+     * time. When the buffer is full, the oldest records are overwritten.
+     *
+     * @param[in] bufferSize Maximum number of records (beginning or end of an event or stage) on each process.
+     * @param[in] comm MPI communicator.
+     */
+    static
+    void enableTrace(const size_t bufferSize,
+                     MPI_Comm comm=PETSC_COMM_WORLD);
+
+    /// Stop recording timeline trace and discard records.
+    static
+    void disableTrace(void);
+
+    /** Is timeline trace being recorded?
+     *
+     * @returns True if recording timeline trace, false otherwise.
+     */
+    static
+    bool isTraceEnabled(void);
+
+    /** Write timeline trace of all processes to file in Chrome trace event (JSON) format.
+     *
+     * Collective over the communicator. Each process is a separate timeline; stages and events are shown as separate
+     * threads of the process.
+     *
+     * @param[in] filename Name of file.
+     * @param[in] comm MPI communicator.
+     */
+    static
+    void writeTrace(const char* filename,
+                    MPI_Comm comm=PETSC_COMM_WORLD);
+
     // PRIVATE METHODS //////////////////////////////////////////////////////
 private:
 
+    /** Record beginning or end of event or stage in timeline trace.
+     *
+     * @param[in] id Event or stage identifier (ignored for end of stage).
+     * @param[in] isStage True if stage, false if event.
+     * @param[in] isBegin True if beginning, false if end.
+     */
+    static
+    void _traceRecord(const int id,
+                      const bool isStage,
+                      const bool isBegin);
+
     EventLogger(const EventLogger&); ///< Not implemented
     const EventLogger& operator=(const EventLogger&); ///< Not implemented
 
@@ -139,6 +254,7 @@ private:
     int _classId; ///< PETSc logging identifier for class
     map_event_type _events; ///< PETSc logging identifiers for events
     map_event_type _stages; ///< PETSc logging identifiers for stages
+    static bool _traceEnabled; ///< True if recording timeline trace.
 
 }; // EventLogger
 
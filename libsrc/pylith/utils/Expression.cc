@@ -0,0 +1,735 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "Expression.hh" // Implementation of class methods
+
+#include <algorithm> // USES std::max()
+#include <cmath> // USES sin(), cos(), etc
+#include <cstdlib> // USES strtod()
+#include <cstring> // USES strcmp()
+#include <cctype> // USES isalpha(), isdigit(), isspace()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class _Expression {
+public:
+
+            typedef double (*function1_type)(double);
+            typedef double (*function2_type)(double,
+                                             double);
+
+            /// Function with one argument.
+            struct Function1 {
+                const char* name; ///< Name of function.
+                function1_type fn; ///< Function.
+            };
+
+            /// Function with two arguments.
+            struct Function2 {
+                const char* name; ///< Name of function.
+                function2_type fn; ///< Function.
+            };
+
+            static double abs(double x) {
+                return fabs(x);
+            }
+
+            static double min(double x,
+                              double y) {
+                return (x < y) ? x : y;
+            }
+
+            static double max(double x,
+                              double y) {
+                return (x > y) ? x : y;
+            }
+
+            static const Function1 functions1[];
+            static const size_t numFunctions1;
+            static const Function2 functions2[];
+            static const size_t numFunctions2;
+
+        }; // _Expression
+        const _Expression::Function1 _Expression::functions1[] = {
+            { "sin", ::sin },
+            { "cos", ::cos },
+            { "tan", ::tan },
+            { "asin", ::asin },
+            { "acos", ::acos },
+            { "atan", ::atan },
+            { "sinh", ::sinh },
+            { "cosh", ::cosh },
+            { "tanh", ::tanh },
+            { "exp", ::exp },
+            { "log", ::log },
+            { "log10", ::log10 },
+            { "sqrt", ::sqrt },
+            { "abs", _Expression::abs },
+            { "floor", ::floor },
+            { "ceil", ::ceil },
+        };
+        const size_t _Expression::numFunctions1 = sizeof(_Expression::functions1) / sizeof(_Expression::Function1);
+        const _Expression::Function2 _Expression::functions2[] = {
+            { "atan2", ::atan2 },
+            { "pow", ::pow },
+            { "min", _Expression::min },
+            { "max", _Expression::max },
+        };
+        const size_t _Expression::numFunctions2 = sizeof(_Expression::functions2) / sizeof(_Expression::Function2);
+
+        // ----------------------------------------------------------------------------------------
+        /// Recursive descent parser that compiles an expression into a program for the stack machine. Operations on
+        /// constants are evaluated when the expression is compiled.
+        class _ExpressionParser {
+public:
+
+            /** Constructor.
+             *
+             * @param[inout] expression Expression to compile.
+             */
+            _ExpressionParser(Expression* expression) :
+                _expression(expression),
+                _text(expression->_expression.c_str()),
+                _pos(0),
+                _stackSize(0) {}
+
+
+            /// Compile expression.
+            void compile(void) {
+                _expression->_program.clear();
+                _parseOr();
+                _skipSpace();
+                if (_text[_pos]) {
+                    _error("Unexpected character");
+                } // if
+                assert(1 == _stackSize);
+
+                // Maximum size of stack for program after evaluating operations on constants.
+                const std::vector<Instruction>& program = _expression->_program;
+                size_t stackSize = 0;
+                size_t maxStackSize = 0;
+                for (size_t i = 0; i < program.size(); ++i) {
+                    stackSize -= _numOperands(program[i].op);
+                    ++stackSize;
+                    maxStackSize = std::max(maxStackSize, stackSize);
+                } // for
+                _expression->_stackSize = maxStackSize;
+            } // compile
+
+private:
+
+            typedef Expression::Instruction Instruction;
+
+            /// Parse logical or.
+            void _parseOr(void) {
+                _parseAnd();
+                while (_accept("||")) {
+                    _parseAnd();
+                    _emit(Expression::OR);
+                } // while
+            } // _parseOr
+
+            /// Parse logical and.
+            void _parseAnd(void) {
+                _parseComparison();
+                while (_accept("&&")) {
+                    _parseComparison();
+                    _emit(Expression::AND);
+                } // while
+            } // _parseAnd
+
+            /// Parse comparison.
+            void _parseComparison(void) {
+                _parseSum();
+                Expression::OpEnum op;
+                if (_accept("<=")) {
+                    op = Expression::LESS_EQUAL;
+                } else if (_accept(">=")) {
+                    op = Expression::GREATER_EQUAL;
+                } else if (_accept("==")) {
+                    op = Expression::EQUAL;
+                } else if (_accept("!=")) {
+                    op = Expression::NOT_EQUAL;
+                } else if (_accept("<")) {
+                    op = Expression::LESS;
+                } else if (_accept(">")) {
+                    op = Expression::GREATER;
+                } else {
+                    return;
+                } // if/else
+                _parseSum();
+                _emit(op);
+            } // _parseComparison
+
+            /// Parse addition and subtraction.
+            void _parseSum(void) {
+                _parseProduct();
+                while (true) {
+                    if (_accept("+")) {
+                        _parseProduct();
+                        _emit(Expression::ADD);
+                    } else if (_accept("-")) {
+                        _parseProduct();
+                        _emit(Expression::SUBTRACT);
+                    } else {
+                        break;
+                    } // if/else
+                } // while
+            } // _parseSum
+
+            /// Parse multiplication and division.
+            void _parseProduct(void) {
+                _parseUnary();
+                while (true) {
+                    if (_accept("*")) {
+                        _parseUnary();
+                        _emit(Expression::MULTIPLY);
+                    } else if (_accept("/")) {
+                        _parseUnary();
+                        _emit(Expression::DIVIDE);
+                    } else {
+                        break;
+                    } // if/else
+                } // while
+            } // _parseProduct
+
+            /// Parse unary operators.
+            void _parseUnary(void) {
+                if (_accept("-")) {
+                    _parseUnary();
+                    _emit(Expression::NEGATE);
+                } else if (_accept("+")) {
+                    _parseUnary();
+                } else if ((_peek() == '!') && (_text[_pos+1] != '=')) {
+                    ++_pos;
+                    _parseUnary();
+                    _emit(Expression::NOT);
+                } else {
+                    _parsePower();
+                } // if/else
+            } // _parseUnary
+
+            /// Parse power (right associative, binds more tightly than unary minus on the left).
+            void _parsePower(void) {
+                _parsePrimary();
+                if (_accept("^")) {
+                    _parseUnary();
+                    _emit(Expression::POWER);
+                } // if
+            } // _parsePower
+
+            /// Parse number, variable, constant, function call, or expression in parentheses.
+            void _parsePrimary(void) {
+                const char c = _peek();
+                if (isdigit(c) || (('.' == c) && isdigit(_text[_pos+1]))) {
+                    char* end = NULL;
+                    const double value = strtod(&_text[_pos], &end);
+                    _pos = end - _text;
+                    _emitConstant(value);
+                } else if (isalpha(c) || ('_' == c)) {
+                    const size_t start = _pos;
+                    while (isalnum(_text[_pos]) || ('_' == _text[_pos])) {
+                        ++_pos;
+                    } // while
+                    const std::string name(&_text[start], _pos - start);
+                    if (_accept("(")) {
+                        _parseFunction(name, start);
+                    } else {
+                        _parseName(name, start);
+                    } // if/else
+                } else if (_accept("(")) {
+                    _parseOr();
+                    _expect(")");
+                } else {
+                    _error(c ? "Unexpected character" : "Unexpected end of expression");
+                } // if/else
+            } // _parsePrimary
+
+            /** Parse variable or constant.
+             *
+             * @param[in] name Name of variable or constant.
+             * @param[in] start Position of name in expression.
+             */
+            void _parseName(const std::string& name,
+                            const size_t start) {
+                const pylith::string_vector& variables = _expression->_variables;
+                for (size_t i = 0; i < variables.size(); ++i) {
+                    if (name == variables[i]) {
+                        Instruction instruction = { Expression::PUSH_VARIABLE, i, 0.0 };
+                        _push(instruction);
+                        return;
+                    } // if
+                } // for
+                if ("pi" == name) {
+                    _emitConstant(M_PI);
+                } else if ("e" == name) {
+                    _emitConstant(M_E);
+                } else {
+                    _pos = start;
+                    std::ostringstream msg;
+                    msg << "Unknown variable '" << name << "'";
+                    _error(msg.str().c_str());
+                } // if/else
+            } // _parseName
+
+            /** Parse arguments of function.
+             *
+             * @param[in] name Name of function.
+             * @param[in] start Position of name in expression.
+             */
+            void _parseFunction(const std::string& name,
+                                const size_t start) {
+                size_t numArgs = 0;
+                if (!_accept(")")) {
+                    do {
+                        _parseOr();
+                        ++numArgs;
+                    } while (_accept(","));
+                    _expect(")");
+                } // if
+
+                size_t numArgsExpected = 0;
+                if ("if" == name) {
+                    numArgsExpected = 3;
+                    if (numArgs == numArgsExpected) {
+                        _emit(Expression::SELECT);
+                        return;
+                    } // if
+                } // if
+                for (size_t i = 0; i < _Expression::numFunctions1 && !numArgsExpected; ++i) {
+                    if (name == _Expression::functions1[i].name) {
+                        numArgsExpected = 1;
+                        if (numArgs == numArgsExpected) {
+                            _emit(Expression::FUNCTION1, i);
+                            return;
+                        } // if
+                    } // if
+                } // for
+                for (size_t i = 0; i < _Expression::numFunctions2 && !numArgsExpected; ++i) {
+                    if (name == _Expression::functions2[i].name) {
+                        numArgsExpected = 2;
+                        if (numArgs == numArgsExpected) {
+                            _emit(Expression::FUNCTION2, i);
+                            return;
+                        } // if
+                    } // if
+                } // for
+
+                _pos = start;
+                std::ostringstream msg;
+                if (numArgsExpected) {
+                    msg << "Function '" << name << "' expects " << numArgsExpected << " argument(s) but has " << numArgs;
+                } else {
+                    msg << "Unknown function '" << name << "'";
+                } // if/else
+                _error(msg.str().c_str());
+            } // _parseFunction
+
+            /** Emit instruction for operation, evaluating it if all operands are constants.
+             *
+             * @param[in] op Operation.
+             * @param[in] index Index of function.
+             */
+            void _emit(const Expression::OpEnum op,
+                       const size_t index=0) {
+                const size_t numOperands = _numOperands(op);
+                std::vector<Instruction>& program = _expression->_program;
+                assert(program.size() >= numOperands);
+                bool isConstant = true;
+                for (size_t i = program.size()-numOperands; i < program.size(); ++i) {
+                    isConstant = isConstant && (Expression::PUSH_CONSTANT == program[i].op);
+                } // for
+                if (isConstant) {
+                    Instruction instruction = { op, index, 0.0 };
+                    Expression evaluator;
+                    evaluator._program.assign(program.end()-numOperands, program.end());
+                    evaluator._program.push_back(instruction);
+                    evaluator._stackSize = numOperands;
+                    double stack[3];
+                    double value = 0.0;
+                    evaluator._evaluateBlock(&value, 1, NULL, 0, 1, stack);
+                    program.resize(program.size()-numOperands);
+                    _stackSize -= numOperands;
+                    _emitConstant(value);
+                } else {
+                    Instruction instruction = { op, index, 0.0 };
+                    _push(instruction);
+                    _stackSize -= numOperands;
+                } // if/else
+            } // _emit
+
+            /** Emit instruction to push constant.
+             *
+             * @param[in] value Value of constant.
+             */
+            void _emitConstant(const double value) {
+                Instruction instruction = { Expression::PUSH_CONSTANT, 0, value };
+                _push(instruction);
+            } // _emitConstant
+
+            /** Append instruction to program, which pushes its result on the stack.
+             *
+             * @param[in] instruction Instruction.
+             */
+            void _push(const Instruction& instruction) {
+                _expression->_program.push_back(instruction);
+                ++_stackSize;
+            } // _push
+
+            /** Get number of operands of operation, which are popped from the stack.
+             *
+             * @param[in] op Operation.
+             * @returns Number of operands.
+             */
+            static
+            size_t _numOperands(const Expression::OpEnum op) {
+                switch (op) {
+                case Expression::PUSH_CONSTANT:
+                case Expression::PUSH_VARIABLE:
+                    return 0;
+                case Expression::NEGATE:
+                case Expression::NOT:
+                case Expression::FUNCTION1:
+                    return 1;
+                case Expression::SELECT:
+                    return 3;
+                default:
+                    return 2;
+                } // switch
+            } // _numOperands
+
+            /** Skip whitespace and get next character.
+             *
+             * @returns Next character.
+             */
+            char _peek(void) {
+                _skipSpace();
+                return _text[_pos];
+            } // _peek
+
+            /// Skip whitespace.
+            void _skipSpace(void) {
+                while (isspace(_text[_pos])) {
+                    ++_pos;
+                } // while
+            } // _skipSpace
+
+            /** Consume token if it is next in the expression.
+             *
+             * @param[in] token Token.
+             * @returns True if token was consumed, false otherwise.
+             */
+            bool _accept(const char* token) {
+                _skipSpace();
+                const size_t length = strlen(token);
+                if (strncmp(&_text[_pos], token, length)) {
+                    return false;
+                } // if
+                _pos += length;
+                return true;
+            } // _accept
+
+            /** Consume token, which must be next in the expression.
+             *
+             * @param[in] token Token.
+             */
+            void _expect(const char* token) {
+                if (!_accept(token)) {
+                    std::ostringstream msg;
+                    msg << "Expected '" << token << "'";
+                    _error(msg.str().c_str());
+                } // if
+            } // _expect
+
+            /** Throw exception for error at current position.
+             *
+             * @param[in] reason Description of error.
+             */
+            void _error(const char* reason) {
+                std::ostringstream msg;
+                msg << reason << " at position " << _pos+1 << " in expression '" << _text << "'.";
+                throw std::runtime_error(msg.str());
+            } // _error
+
+            Expression* _expression; ///< Expression to compile.
+            const char* _text; ///< Expression as a string.
+            size_t _pos; ///< Position of next character in expression.
+            size_t _stackSize; ///< Current size of stack.
+
+        }; // _ExpressionParser
+    } // utils
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+const size_t pylith::utils::Expression::_blockSize = 128;
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::utils::Expression::Expression(void) :
+    _stackSize(0) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::utils::Expression::~Expression(void) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Compile expression.
+void
+pylith::utils::Expression::compile(const char* expression,
+                                   const char* const* variables,
+                                   const size_t numVariables) {
+    assert(expression);
+    assert(!numVariables || variables);
+
+    _expression = expression;
+    _variables.resize(numVariables);
+    for (size_t i = 0; i < numVariables; ++i) {
+        _variables[i] = variables[i];
+    } // for
+
+    try {
+        _ExpressionParser parser(this);
+        parser.compile();
+    } catch (...) {
+        _program.clear();
+        _stackSize = 0;
+        throw;
+    } // try/catch
+} // compile
+
+
+// ------------------------------------------------------------------------------------------------
+// Get expression as a string.
+const char*
+pylith::utils::Expression::getExpression(void) const {
+    return _expression.c_str();
+} // getExpression
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of variables in expression.
+size_t
+pylith::utils::Expression::getNumVariables(void) const {
+    return _variables.size();
+} // getNumVariables
+
+
+// ------------------------------------------------------------------------------------------------
+// Evaluate expression at a point.
+double
+pylith::utils::Expression::evaluate(const double* variables) const {
+    double value = 0.0;
+    evaluate(&value, 1, variables, _variables.size(), 1);
+    return value;
+} // evaluate
+
+
+// ------------------------------------------------------------------------------------------------
+// Evaluate expression at points.
+void
+pylith::utils::Expression::evaluate(double* values,
+                                    const size_t valuesStride,
+                                    const double* variables,
+                                    const size_t variablesStride,
+                                    const size_t numPoints) const {
+    if (_program.empty()) {
+        throw std::logic_error("Expression must be compiled before it is evaluated.");
+    } // if
+    assert(values);
+    assert(!_variables.size() || variables);
+
+    const size_t blockSize = std::min(_blockSize, numPoints);
+    std::vector<double> stack(_stackSize*blockSize);
+    for (size_t iPoint = 0; iPoint < numPoints; iPoint += blockSize) {
+        const size_t numBlockPoints = std::min(blockSize, numPoints-iPoint);
+        _evaluateBlock(&values[iPoint*valuesStride], valuesStride, variables ? &variables[iPoint*variablesStride] : NULL,
+                       variablesStride, numBlockPoints, &stack[0]);
+    } // for
+} // evaluate
+
+
+// ------------------------------------------------------------------------------------------------
+// Evaluate program for a block of points.
+void
+pylith::utils::Expression::_evaluateBlock(double* values,
+                                          const size_t valuesStride,
+                                          const double* variables,
+                                          const size_t variablesStride,
+                                          const size_t numPoints,
+                                          double* stack) const {
+    assert(values);
+    assert(stack);
+
+    // Entry i of the stack for point p is stack[i*numPoints+p], so each instruction operates on contiguous arrays.
+    size_t top = 0;
+    const size_t numInstructions = _program.size();
+    for (size_t iInstruction = 0; iInstruction < numInstructions; ++iInstruction) {
+        const Instruction& instruction = _program[iInstruction];
+        double* const a = (top > 0) ? &stack[(top-1)*numPoints] : NULL;
+        double* const b = (top > 1) ? &stack[(top-2)*numPoints] : NULL;
+        double* const c = (top > 2) ? &stack[(top-3)*numPoints] : NULL;
+        switch (instruction.op) {
+        case PUSH_CONSTANT: {
+            double* const r = &stack[top*numPoints];
+            for (size_t p = 0; p < numPoints; ++p) {
+                r[p] = instruction.value;
+            } // for
+            ++top;
+            break;
+        } // PUSH_CONSTANT
+        case PUSH_VARIABLE: {
+            double* const r = &stack[top*numPoints];
+            const double* const v = &variables[instruction.index];
+            for (size_t p = 0; p < numPoints; ++p) {
+                r[p] = v[p*variablesStride];
+            } // for
+            ++top;
+            break;
+        } // PUSH_VARIABLE
+        case NEGATE:
+            for (size_t p = 0; p < numPoints; ++p) {
+                a[p] = -a[p];
+            } // for
+            break;
+        case NOT:
+            for (size_t p = 0; p < numPoints; ++p) {
+                a[p] = (a[p] == 0.0) ? 1.0 : 0.0;
+            } // for
+            break;
+        case FUNCTION1: {
+            const _Expression::function1_type fn = _Expression::functions1[instruction.index].fn;
+            for (size_t p = 0; p < numPoints; ++p) {
+                a[p] = fn(a[p]);
+            } // for
+            break;
+        } // FUNCTION1
+        case ADD:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] += a[p];
+            } // for
+            --top;
+            break;
+        case SUBTRACT:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] -= a[p];
+            } // for
+            --top;
+            break;
+        case MULTIPLY:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] *= a[p];
+            } // for
+            --top;
+            break;
+        case DIVIDE:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] /= a[p];
+            } // for
+            --top;
+            break;
+        case POWER:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] = pow(b[p], a[p]);
+            } // for
+            --top;
+            break;
+        case LESS:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] = (b[p] < a[p]) ? 1.0 : 0.0;
+            } // for
+            --top;
+            break;
+        case LESS_EQUAL:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] = (b[p] <= a[p]) ? 1.0 : 0.0;
+            } // for
+            --top;
+            break;
+        case GREATER:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] = (b[p] > a[p]) ? 1.0 : 0.0;
+            } // for
+            --top;
+            break;
+        case GREATER_EQUAL:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] = (b[p] >= a[p]) ? 1.0 : 0.0;
+            } // for
+            --top;
+            break;
+        case EQUAL:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] = (b[p] == a[p]) ? 1.0 : 0.0;
+            } // for
+            --top;
+            break;
+        case NOT_EQUAL:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] = (b[p] != a[p]) ? 1.0 : 0.0;
+            } // for
+            --top;
+            break;
+        case AND:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] = ((b[p] != 0.0) && (a[p] != 0.0)) ? 1.0 : 0.0;
+            } // for
+            --top;
+            break;
+        case OR:
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] = ((b[p] != 0.0) || (a[p] != 0.0)) ? 1.0 : 0.0;
+            } // for
+            --top;
+            break;
+        case FUNCTION2: {
+            const _Expression::function2_type fn = _Expression::functions2[instruction.index].fn;
+            for (size_t p = 0; p < numPoints; ++p) {
+                b[p] = fn(b[p], a[p]);
+            } // for
+            --top;
+            break;
+        } // FUNCTION2
+        case SELECT:
+            // Both alternatives are evaluated for all points in the block.
+            for (size_t p = 0; p < numPoints; ++p) {
+                c[p] = (c[p] != 0.0) ? b[p] : a[p];
+            } // for
+            top -= 2;
+            break;
+        default:
+            assert(0);
+            throw std::logic_error("Unknown operation in expression program.");
+        } // switch
+    } // for
+    assert(1 == top);
+
+    for (size_t p = 0; p < numPoints; ++p) {
+        values[p*valuesStride] = stack[p];
+    } // for
+} // _evaluateBlock
+
+
+// End of file
@@ -0,0 +1,171 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/Expression.hh
+ *
+ * @brief Analytical expression compiled from a string into a program for a stack machine.
+ *
+ * Expressions contain numbers, variables, the constants `pi` and `e`, the operators `+ - * / ^` (power), unary `-`,
+ * comparisons `< <= > >= == !=` (1 if true, 0 if false), logical `&& || !`, parentheses, and the functions `sin`,
+ * `cos`, `tan`, `asin`, `acos`, `atan`, `atan2`, `sinh`, `cosh`, `tanh`, `exp`, `log`, `log10`, `sqrt`, `abs`,
+ * `floor`, `ceil`, `min`, `max`, `pow`, and `if(condition, a, b)`.
+ *
+ * The program is evaluated one instruction at a time over blocks of points, so the cost of interpreting each
+ * instruction is shared by all of the points in the block and the loops over the points can be vectorized.
+ */
+
+#if !defined(pylith_utils_expression_hh)
+#define pylith_utils_expression_hh
+
+#include "utilsfwd.hh" // forward declarations
+
+#include "pylith/utils/array.hh" // HASA string_vector
+
+#include <vector> // HASA std::vector
+#include <string> // HASA std::string
+
+class pylith::utils::Expression {
+    friend class TestExpression; // unit testing
+    friend class _ExpressionParser; // compiles expression
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    Expression(void);
+
+    /// Destructor
+    ~Expression(void);
+
+    /** Compile expression.
+     *
+     * @param[in] expression Expression as a string.
+     * @param[in] variables Names of variables in expression.
+     * @param[in] numVariables Number of variables.
+     */
+    void compile(const char* expression,
+                 const char* const* variables,
+                 const size_t numVariables);
+
+    /** Get expression as a string.
+     *
+     * @returns Expression.
+     */
+    const char* getExpression(void) const;
+
+    /** Get number of variables in expression.
+     *
+     * @returns Number of variables.
+     */
+    size_t getNumVariables(void) const;
+
+    /** Evaluate expression at a point.
+     *
+     * @param[in] variables Values of variables.
+     * @returns Value of expression.
+     */
+    double evaluate(const double* variables) const;
+
+    /** Evaluate expression at points.
+     *
+     * @param[out] values Array for values of expression at points.
+     * @param[in] valuesStride Stride between points in values array.
+     * @param[in] variables Values of variables at points.
+     * @param[in] variablesStride Stride between points in variables array.
+     * @param[in] numPoints Number of points.
+     */
+    void evaluate(double* values,
+                  const size_t valuesStride,
+                  const double* variables,
+                  const size_t variablesStride,
+                  const size_t numPoints) const;
+
+    // PRIVATE ENUMS //////////////////////////////////////////////////////////////////////////////
+private:
+
+    enum OpEnum {
+        PUSH_CONSTANT=0, ///< Push constant.
+        PUSH_VARIABLE=1, ///< Push variable.
+        NEGATE=2, ///< Negate top of stack.
+        NOT=3, ///< Logical not of top of stack.
+        FUNCTION1=4, ///< Apply function with one argument to top of stack.
+        ADD=5, ///< Add top two entries of stack.
+        SUBTRACT=6, ///< Subtract top two entries of stack.
+        MULTIPLY=7, ///< Multiply top two entries of stack.
+        DIVIDE=8, ///< Divide top two entries of stack.
+        POWER=9, ///< Raise next to top entry of stack to power of top entry.
+        LESS=10, ///< Less than comparison.
+        LESS_EQUAL=11, ///< Less than or equal comparison.
+        GREATER=12, ///< Greater than comparison.
+        GREATER_EQUAL=13, ///< Greater than or equal comparison.
+        EQUAL=14, ///< Equal comparison.
+        NOT_EQUAL=15, ///< Not equal comparison.
+        AND=16, ///< Logical and.
+        OR=17, ///< Logical or.
+        FUNCTION2=18, ///< Apply function with two arguments to top two entries of stack.
+        SELECT=19, ///< Select between two entries of stack based on condition.
+    };
+
+    /// Instruction in program.
+    struct Instruction {
+        OpEnum op; ///< Operation.
+        size_t index; ///< Index of variable or function.
+        double value; ///< Value of constant.
+    };
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Evaluate program for a block of points.
+     *
+     * @param[out] values Array for values of expression at points.
+     * @param[in] valuesStride Stride between points in values array.
+     * @param[in] variables Values of variables at points.
+     * @param[in] variablesStride Stride between points in variables array.
+     * @param[in] numPoints Number of points (no more than block size).
+     * @param[in] stack Work array for stack (size is stack size times block size).
+     */
+    void _evaluateBlock(double* values,
+                        const size_t valuesStride,
+                        const double* variables,
+                        const size_t variablesStride,
+                        const size_t numPoints,
+                        double* stack) const;
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _expression; ///< Expression.
+    pylith::string_vector _variables; ///< Names of variables.
+    std::vector<Instruction> _program; ///< Program for stack machine.
+    size_t _stackSize; ///< Maximum size of stack.
+
+    static const size_t _blockSize; ///< Number of points evaluated together.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    Expression(const Expression&); ///< Not implemented.
+    const Expression& operator=(const Expression&); ///< Not implemented
+
+}; // Expression
+
+#endif // pylith_utils_expression_hh
+
+// End of file
@@ -30,7 +30,8 @@
 // ----------------------------------------------------------------------
 // Constructor
 pylith::utils::GenericComponent::GenericComponent(void) :
-    _name("") {
+    _name(""),
+    _debug(NULL) {
     if (!Py_IsInitialized()) {
         throw std::logic_error("Python must be initialized to use GenericComponent in C++.");
     } // if
@@ -39,7 +40,9 @@ pylith::utils::GenericComponent::GenericComponent(void) :
 
 // ----------------------------------------------------------------------
 // Destructor
-pylith::utils::GenericComponent::~GenericComponent(void) {}
+pylith::utils::GenericComponent::~GenericComponent(void) {
+    delete _debug;_debug = NULL;
+} // destructor
 
 
 // ----------------------------------------------------------------------
@@ -50,6 +53,7 @@ pylith::utils::GenericComponent::setName(const char* value) {
         throw std::logic_error("Cannot set name of Generic component to empty string.");
     } // if
     _name = value;
+    delete _debug;_debug = NULL;
 } // setName
 
 
@@ -61,4 +65,15 @@ pylith::utils::GenericComponent::getName(void) const {
 } // getName
 
 
+// ----------------------------------------------------------------------
+// Get debug journal of component.
+pythia::journal::debug_t&
+pylith::utils::GenericComponent::getDebugJournal(void) const {
+    if (!_debug) {
+        _debug = new pythia::journal::debug_t(_name.c_str());
+    } // if
+    return *_debug;
+} // getDebugJournal
+
+
 // End of file
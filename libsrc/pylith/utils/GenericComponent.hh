@@ -28,6 +28,8 @@
 // Include directives ---------------------------------------------------
 #include "utilsfwd.hh" // forward declarations
 
+#include "pythia/journal/diagnostics.h" // HASA debug_t
+
 #include <string> // HASA std::string
 
 // GenericComponent ----------------------------------------------------------
@@ -60,10 +62,19 @@ public:
      */
     const char* getName(void) const;
 
+    /** Get debug journal of component.
+     *
+     * The journal is created on first use after the name is set, so it is not looked up by name every time it is used.
+     *
+     * @returns Debug journal.
+     */
+    pythia::journal::debug_t& getDebugJournal(void) const;
+
     // PRIVATE METHODS //////////////////////////////////////////////////////
 private:
 
     std::string _name; ///< Name of component (used in journals).
+    mutable pythia::journal::debug_t* _debug; ///< Debug journal of component.
 
     // PRIVATE METHODS //////////////////////////////////////////////////////
 private:
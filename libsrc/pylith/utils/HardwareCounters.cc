@@ -0,0 +1,204 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "HardwareCounters.hh" // Implementation of class methods
+
+#if defined(PYLITH_USE_HARDWARE_COUNTERS)
+#include <linux/perf_event.h> // USES perf_event_attr
+#include <sys/ioctl.h> // USES ioctl()
+#include <sys/syscall.h> // USES syscall()
+#include <unistd.h> // USES close(), read(), sysconf()
+#include <cstring> // USES memset()
+#include <stdint.h> // USES uint64_t
+#endif
+
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class _HardwareCounters {
+public:
+
+            static int fds[HardwareCounters::NUM_COUNTERS]; ///< File descriptors for perf events (group leader first).
+            static bool isActive; ///< True if counters are active.
+
+#if defined(PYLITH_USE_HARDWARE_COUNTERS)
+            /** Open perf event for counting user-space events of the calling process.
+             *
+             * @param[in] config Hardware event.
+             * @param[in] groupFd File descriptor of group leader (-1 to create group).
+             * @returns File descriptor of event (-1 on failure).
+             */
+            static
+            int openEvent(const uint64_t config,
+                          const int groupFd);
+
+#endif
+        }; // _HardwareCounters
+    } // utils
+} // pylith
+
+int pylith::utils::_HardwareCounters::fds[pylith::utils::HardwareCounters::NUM_COUNTERS] = { -1, -1, -1 };
+bool pylith::utils::_HardwareCounters::isActive = false;
+
+// ----------------------------------------------------------------------
+// Start counting.
+bool
+pylith::utils::HardwareCounters::initialize(void) {
+    if (_HardwareCounters::isActive) {
+        return true;
+    } // if
+
+#if defined(PYLITH_USE_HARDWARE_COUNTERS)
+    const uint64_t configs[NUM_COUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+    };
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        _HardwareCounters::fds[i] = _HardwareCounters::openEvent(configs[i], i ? _HardwareCounters::fds[0] : -1);
+        if (_HardwareCounters::fds[i] < 0) {
+            deallocate();
+            return false;
+        } // if
+    } // for
+    if (ioctl(_HardwareCounters::fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP) ||
+        ioctl(_HardwareCounters::fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP)) {
+        deallocate();
+        return false;
+    } // if
+    _HardwareCounters::isActive = true;
+#endif
+
+    return _HardwareCounters::isActive;
+} // initialize
+
+
+// ----------------------------------------------------------------------
+// Stop counting and release counters.
+void
+pylith::utils::HardwareCounters::deallocate(void) {
+#if defined(PYLITH_USE_HARDWARE_COUNTERS)
+    for (int i = NUM_COUNTERS-1; i >= 0; --i) {
+        if (_HardwareCounters::fds[i] >= 0) {
+            close(_HardwareCounters::fds[i]);
+            _HardwareCounters::fds[i] = -1;
+        } // if
+    } // for
+#endif
+    _HardwareCounters::isActive = false;
+} // deallocate
+
+
+// ----------------------------------------------------------------------
+// Are counters active?
+bool
+pylith::utils::HardwareCounters::isActive(void) {
+    return _HardwareCounters::isActive;
+} // isActive
+
+
+// ----------------------------------------------------------------------
+// Get current values of counters.
+void
+pylith::utils::HardwareCounters::read(double values[]) {
+    assert(values);
+
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        values[i] = 0.0;
+    } // for
+#if defined(PYLITH_USE_HARDWARE_COUNTERS)
+    if (!_HardwareCounters::isActive) {
+        return;
+    } // if
+
+    // Layout for PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING.
+    uint64_t buffer[3+NUM_COUNTERS];
+    const ssize_t numBytes = ::read(_HardwareCounters::fds[0], buffer, sizeof(buffer));
+    if ((numBytes != ssize_t(sizeof(buffer))) || (buffer[0] != uint64_t(NUM_COUNTERS))) {
+        return;
+    } // if
+
+    // Scale counts if the kernel multiplexed the counters with other events.
+    const double timeEnabled = buffer[1];
+    const double timeRunning = buffer[2];
+    const double scale = (timeRunning > 0.0) ? timeEnabled / timeRunning : 0.0;
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        values[i] = scale * buffer[3+i];
+    } // for
+#endif
+} // read
+
+
+// ----------------------------------------------------------------------
+// Get size of cache line used to estimate bytes transferred from main memory.
+size_t
+pylith::utils::HardwareCounters::getCacheLineSize(void) {
+    long lineSize = 0;
+#if defined(PYLITH_USE_HARDWARE_COUNTERS) && defined(_SC_LEVEL3_CACHE_LINESIZE)
+    lineSize = sysconf(_SC_LEVEL3_CACHE_LINESIZE);
+#endif
+    return (lineSize > 0) ? size_t(lineSize) : 64;
+} // getCacheLineSize
+
+
+// ----------------------------------------------------------------------
+// Get name of counter.
+const char*
+pylith::utils::HardwareCounters::getCounterName(const CounterEnum counter) {
+    switch (counter) {
+    case CYCLES:
+        return "cycles";
+    case INSTRUCTIONS:
+        return "instructions";
+    case LLC_MISSES:
+        return "llc_misses";
+    default:
+        assert(0);
+    } // switch
+    return "unknown";
+} // getCounterName
+
+
+#if defined(PYLITH_USE_HARDWARE_COUNTERS)
+// ----------------------------------------------------------------------
+// Open perf event for counting user-space events of the calling process.
+int
+pylith::utils::_HardwareCounters::openEvent(const uint64_t config,
+                                            const int groupFd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = (groupFd < 0) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    const long fd = syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0);
+    return (fd >= 0) ? int(fd) : -1;
+} // openEvent
+
+
+#endif
+
+// End of file
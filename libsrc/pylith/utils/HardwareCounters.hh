@@ -0,0 +1,108 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+/**
+ * @file libsrc/utils/HardwareCounters.hh
+ *
+ * @brief Hardware performance counters of the calling process.
+ *
+ * The counters (cycles, instructions, and last level cache misses) use Linux perf events and count user-space
+ * events of the process. They are available only if PyLith is configured with --enable-hardware-counters and the
+ * operating system permits access to perf events (see /proc/sys/kernel/perf_event_paranoid). The number of bytes
+ * transferred from main memory is estimated as the number of last level cache misses times the cache line size.
+ */
+
+#if !defined(pylith_utils_hardwarecounters_hh)
+#define pylith_utils_hardwarecounters_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include <cstddef> // USES size_t
+
+// HardwareCounters ------------------------------------------------------
+/// @brief Hardware performance counters of the calling process.
+class pylith::utils::HardwareCounters { // HardwareCounters
+    friend class TestHardwareCounters; // unit testing
+
+    // PUBLIC ENUMS /////////////////////////////////////////////////////////
+public:
+
+    enum CounterEnum {
+        CYCLES=0, ///< Number of CPU cycles.
+        INSTRUCTIONS=1, ///< Number of instructions retired.
+        LLC_MISSES=2, ///< Number of last level cache misses.
+        NUM_COUNTERS=3,
+    }; // CounterEnum
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /** Start counting.
+     *
+     * @returns True if counters are available, false otherwise.
+     */
+    static
+    bool initialize(void);
+
+    /// Stop counting and release counters.
+    static
+    void deallocate(void);
+
+    /** Are counters active?
+     *
+     * @returns True if counters are active, false otherwise.
+     */
+    static
+    bool isActive(void);
+
+    /** Get current values of counters.
+     *
+     * Values are zero if the counters are not active.
+     *
+     * @param[out] values Values of counters [NUM_COUNTERS].
+     */
+    static
+    void read(double values[]);
+
+    /** Get size of cache line used to estimate bytes transferred from main memory.
+     *
+     * @returns Size of cache line (bytes).
+     */
+    static
+    size_t getCacheLineSize(void);
+
+    /** Get name of counter.
+     *
+     * @param[in] counter Counter.
+     * @returns Name of counter.
+     */
+    static
+    const char* getCounterName(const CounterEnum counter);
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    HardwareCounters(void); ///< Not implemented
+    HardwareCounters(const HardwareCounters&); ///< Not implemented
+    const HardwareCounters& operator=(const HardwareCounters&); ///< Not implemented
+
+}; // HardwareCounters
+
+#endif // pylith_utils_hardwarecounters_hh
+
+// End of file
@@ -0,0 +1,293 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MemoryLogger.hh" // Implementation of class methods
+
+#include "error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petscsys.h" // USES PetscMemoryGetCurrentUsage()
+
+#include <sys/resource.h> // USES getrusage()
+
+#include <algorithm> // USES std::min(), std::max()
+#include <cassert> // USES assert()
+#include <cstdlib> // USES atof()
+#include <iomanip> // USES std::setw()
+#include <map> // USES std::map
+#include <sstream> // USES std::ostringstream
+#include <vector> // USES std::vector
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class _MemoryLogger {
+public:
+
+            /// Memory recorded by an object.
+            struct Owner {
+                std::string group; ///< Name of group.
+                bool hasGroupOverride; ///< True if group was set via setGroup().
+                std::map<std::string, size_t> items; ///< Number of bytes for each item.
+
+                Owner(void) :
+                    hasGroupOverride(false) {}
+
+
+            }; // Owner
+
+            /// Statistics of value over processes.
+            struct Stats {
+                double min;
+                double max;
+                double sum;
+                int count;
+            }; // Stats
+
+            typedef std::map<const void*, Owner> owner_map;
+            static owner_map owners; ///< Memory recorded by each owner.
+            static size_t currentBytes; ///< Memory currently recorded.
+            static size_t peakBytes; ///< Peak memory recorded since last report.
+
+            /** Get resident set size of process.
+             *
+             * @param[out] current Current resident set size (bytes).
+             * @param[out] peak Peak resident set size (bytes).
+             */
+            static
+            void getProcessMemory(double* current,
+                                  double* peak);
+
+        }; // _MemoryLogger
+    } // utils
+} // pylith
+
+pylith::utils::_MemoryLogger::owner_map pylith::utils::_MemoryLogger::owners;
+size_t pylith::utils::_MemoryLogger::currentBytes = 0;
+size_t pylith::utils::_MemoryLogger::peakBytes = 0;
+
+// ----------------------------------------------------------------------
+// Record memory used by an object.
+void
+pylith::utils::MemoryLogger::record(const void* owner,
+                                    const char* group,
+                                    const char* item,
+                                    const size_t bytes) {
+    assert(owner);
+    assert(group);
+    assert(item);
+
+    _MemoryLogger::Owner& entry = _MemoryLogger::owners[owner];
+    if (!entry.hasGroupOverride) {
+        entry.group = group;
+    } // if
+    size_t& itemBytes = entry.items[item];
+    _MemoryLogger::currentBytes -= itemBytes;
+    itemBytes = bytes;
+    _MemoryLogger::currentBytes += itemBytes;
+    _MemoryLogger::peakBytes = std::max(_MemoryLogger::peakBytes, _MemoryLogger::currentBytes);
+} // record
+
+
+// ----------------------------------------------------------------------
+// Set group for memory recorded by an object.
+void
+pylith::utils::MemoryLogger::setGroup(const void* owner,
+                                      const char* group) {
+    assert(owner);
+    assert(group);
+
+    _MemoryLogger::Owner& entry = _MemoryLogger::owners[owner];
+    entry.group = group;
+    entry.hasGroupOverride = true;
+} // setGroup
+
+
+// ----------------------------------------------------------------------
+// Remove all memory recorded by an object.
+void
+pylith::utils::MemoryLogger::release(const void* owner) {
+    _MemoryLogger::owner_map::iterator iter = _MemoryLogger::owners.find(owner);
+    if (iter == _MemoryLogger::owners.end()) {
+        return;
+    } // if
+
+    const std::map<std::string, size_t>& items = iter->second.items;
+    for (std::map<std::string, size_t>::const_iterator item = items.begin(); item != items.end(); ++item) {
+        _MemoryLogger::currentBytes -= item->second;
+    } // for
+    _MemoryLogger::owners.erase(iter);
+} // release
+
+
+// ----------------------------------------------------------------------
+// Get memory currently recorded on this process.
+size_t
+pylith::utils::MemoryLogger::getCurrentBytes(void) {
+    return _MemoryLogger::currentBytes;
+} // getCurrentBytes
+
+
+// ----------------------------------------------------------------------
+// Get peak memory recorded on this process since the last report.
+size_t
+pylith::utils::MemoryLogger::getPeakBytes(void) {
+    return _MemoryLogger::peakBytes;
+} // getPeakBytes
+
+
+// ----------------------------------------------------------------------
+// Create report of memory usage over all processes.
+std::string
+pylith::utils::MemoryLogger::report(const char* stage,
+                                    MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+
+    // Summary values come first, so they are present on every process and listed first in the report.
+    const size_t numSummary = 4;
+    const char* summaryKeys[numSummary] = {
+        "Process resident set size",
+        "Process peak resident set size",
+        "Recorded memory",
+        "Recorded peak memory during stage",
+    };
+    double processCurrent = 0.0, processPeak = 0.0;
+    _MemoryLogger::getProcessMemory(&processCurrent, &processPeak);
+    const double summaryValues[numSummary] = {
+        processCurrent,
+        processPeak,
+        double(_MemoryLogger::currentBytes),
+        double(_MemoryLogger::peakBytes),
+    };
+
+    std::map<std::string, double> localValues;
+    for (_MemoryLogger::owner_map::const_iterator owner = _MemoryLogger::owners.begin(); owner != _MemoryLogger::owners.end(); ++owner) {
+        const std::map<std::string, size_t>& items = owner->second.items;
+        for (std::map<std::string, size_t>::const_iterator item = items.begin(); item != items.end(); ++item) {
+            localValues[owner->second.group + ": " + item->first] += item->second;
+        } // for
+    } // for
+    _MemoryLogger::peakBytes = _MemoryLogger::currentBytes;
+
+    // Serialize values as lines with alternating keys and values.
+    std::ostringstream buffer;
+    buffer << std::setprecision(17);
+    for (size_t i = 0; i < numSummary; ++i) {
+        buffer << summaryKeys[i] << "\n" << summaryValues[i] << "\n";
+    } // for
+    for (std::map<std::string, double>::const_iterator iter = localValues.begin(); iter != localValues.end(); ++iter) {
+        buffer << iter->first << "\n" << iter->second << "\n";
+    } // for
+    const std::string& localString = buffer.str();
+
+    int commRank = 0, commSize = 1;
+    MPI_Comm_rank(comm, &commRank);
+    MPI_Comm_size(comm, &commSize);
+    int localSize = localString.size();
+    std::vector<int> sizes(commRank ? 0 : commSize);
+    PetscErrorCode err = MPI_Gather(&localSize, 1, MPI_INT, commRank ? NULL : &sizes[0], 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    std::vector<int> offsets(commRank ? 0 : commSize+1, 0);
+    for (int i = 0; i < int(sizes.size()); ++i) {
+        offsets[i+1] = offsets[i] + sizes[i];
+    } // for
+    std::vector<char> allChars(commRank ? 1 : std::max(offsets[commSize], 1));
+    err = MPI_Gatherv(const_cast<char*>(localString.c_str()), localSize, MPI_CHAR, &allChars[0],
+                      commRank ? NULL : &sizes[0], commRank ? NULL : &offsets[0], MPI_CHAR, 0, comm);PYLITH_CHECK_ERROR(err);
+    if (commRank) {
+        PYLITH_METHOD_RETURN(std::string(""));
+    } // if
+
+    std::vector<std::string> keys(summaryKeys, summaryKeys+numSummary);
+    std::map<std::string, _MemoryLogger::Stats> stats;
+    for (int iRank = 0; iRank < commSize; ++iRank) {
+        std::istringstream sin(std::string(&allChars[offsets[iRank]], sizes[iRank]));
+        std::string key, value;
+        while (std::getline(sin, key) && std::getline(sin, value)) {
+            const double bytes = atof(value.c_str());
+            std::map<std::string, _MemoryLogger::Stats>::iterator iter = stats.find(key);
+            if (iter == stats.end()) {
+                const std::vector<std::string>::iterator summaryEnd = keys.begin() + numSummary;
+                if (summaryEnd == std::find(keys.begin(), summaryEnd, key)) {
+                    keys.push_back(key);
+                } // if
+                _MemoryLogger::Stats& entry = stats[key];
+                entry.min = bytes;
+                entry.max = bytes;
+                entry.sum = bytes;
+                entry.count = 1;
+            } else {
+                iter->second.min = std::min(iter->second.min, bytes);
+                iter->second.max = std::max(iter->second.max, bytes);
+                iter->second.sum += bytes;
+                iter->second.count += 1;
+            } // if/else
+        } // while
+    } // for
+    std::sort(keys.begin()+numSummary, keys.end());
+
+    size_t keyWidth = 0;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        keyWidth = std::max(keyWidth, keys[i].size());
+    } // for
+    const double mb = 1024.0*1024.0;
+    std::ostringstream msg;
+    msg << "Memory usage at end of stage '" << stage << "' over " << commSize << " process(es) (MB):\n"
+        << "  " << std::left << std::setw(keyWidth) << "" << std::right
+        << std::setw(12) << "min" << std::setw(12) << "mean" << std::setw(12) << "max" << "\n";
+    msg << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        const _MemoryLogger::Stats& entry = stats[keys[i]];
+        // Processes without the item contribute zero.
+        const double minValue = (entry.count < commSize) ? 0.0 : entry.min;
+        msg << "  " << std::left << std::setw(keyWidth) << keys[i] << std::right
+            << std::setw(12) << minValue/mb
+            << std::setw(12) << entry.sum/commSize/mb
+            << std::setw(12) << entry.max/mb << "\n";
+    } // for
+
+    PYLITH_METHOD_RETURN(msg.str());
+} // report
+
+
+// ----------------------------------------------------------------------
+// Get resident set size of process.
+void
+pylith::utils::_MemoryLogger::getProcessMemory(double* current,
+                                               double* peak) {
+    assert(current);
+    assert(peak);
+
+    PetscLogDouble mem = 0.0;
+    PetscMemoryGetCurrentUsage(&mem);
+    *current = mem;
+
+    struct rusage usage;
+    if (!getrusage(RUSAGE_SELF, &usage)) {
+#if defined(__APPLE__)
+        *peak = usage.ru_maxrss; // bytes
+#else
+        *peak = 1024.0 * usage.ru_maxrss; // kilobytes
+#endif
+    } else {
+        *peak = 0.0;
+    } // if/else
+} // getProcessMemory
+
+
+// End of file
@@ -0,0 +1,116 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/MemoryLogger.hh
+ *
+ * @brief Accounting of memory used by fields, matrices, and buffers.
+ *
+ * Objects that own large PETSc vectors, matrices, or buffers record the number of bytes they use, organized by
+ * group (for example, the label of a field or the identifier of a physics object) and item within the group (for
+ * example, a subfield). Recording again for the same owner and item replaces the previous value, and releasing an
+ * owner removes all of its records. The report at the end of each stage contains the current values and the peak
+ * of the recorded memory during the stage, along with the resident set size of the process, over all processes.
+ */
+
+#if !defined(pylith_utils_memorylogger_hh)
+#define pylith_utils_memorylogger_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include "petscsys.h" // USES MPI_Comm, PETSC_COMM_WORLD
+#include <string> // USES std::string
+
+// MemoryLogger ----------------------------------------------------------
+/// @brief Accounting of memory used by fields, matrices, and buffers.
+class pylith::utils::MemoryLogger { // MemoryLogger
+    friend class TestMemoryLogger; // unit testing
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /** Record memory used by an object.
+     *
+     * @param[in] owner Object owning the memory.
+     * @param[in] group Name of group (used unless overridden with setGroup()).
+     * @param[in] item Name of item within group.
+     * @param[in] bytes Number of bytes used by item.
+     */
+    static
+    void record(const void* owner,
+                const char* group,
+                const char* item,
+                const size_t bytes);
+
+    /** Set group for memory recorded by an object, overriding the group given in record().
+     *
+     * Use this to attribute memory of a generic object, such as the auxiliary field, to the physics object using it.
+     *
+     * @param[in] owner Object owning the memory.
+     * @param[in] group Name of group.
+     */
+    static
+    void setGroup(const void* owner,
+                  const char* group);
+
+    /** Remove all memory recorded by an object.
+     *
+     * @param[in] owner Object owning the memory.
+     */
+    static
+    void release(const void* owner);
+
+    /** Get memory currently recorded on this process.
+     *
+     * @returns Number of bytes.
+     */
+    static
+    size_t getCurrentBytes(void);
+
+    /** Get peak memory recorded on this process since the last report.
+     *
+     * @returns Number of bytes.
+     */
+    static
+    size_t getPeakBytes(void);
+
+    /** Create report of memory usage over all processes and reset the peak of the recorded memory.
+     *
+     * Collective over the communicator.
+     *
+     * @param[in] stage Name of stage.
+     * @param[in] comm MPI communicator.
+     * @returns Report on rank 0, empty string on other ranks.
+     */
+    static
+    std::string report(const char* stage,
+                       MPI_Comm comm=PETSC_COMM_WORLD);
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    MemoryLogger(void); ///< Not implemented
+    MemoryLogger(const MemoryLogger&); ///< Not implemented
+    const MemoryLogger& operator=(const MemoryLogger&); ///< Not implemented
+
+}; // MemoryLogger
+
+#endif // pylith_utils_memorylogger_hh
+
+// End of file
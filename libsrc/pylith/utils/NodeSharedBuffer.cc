@@ -0,0 +1,148 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "NodeSharedBuffer.hh" // Implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::utils::NodeSharedBuffer::NodeSharedBuffer(void) :
+    _nodeComm(MPI_COMM_NULL),
+    _window(MPI_WIN_NULL),
+    _data(NULL),
+    _size(0),
+    _isLoader(false) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::utils::NodeSharedBuffer::~NodeSharedBuffer(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Allocate buffer shared by the processes on each node.
+void
+pylith::utils::NodeSharedBuffer::allocate(const size_t numBytes,
+                                          MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+
+    deallocate();
+
+    PetscErrorCode err = 0;
+    err = MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &_nodeComm);PYLITH_CHECK_ERROR(err);
+    int nodeRank = 0;
+    err = MPI_Comm_rank(_nodeComm, &nodeRank);PYLITH_CHECK_ERROR(err);
+    _isLoader = 0 == nodeRank;
+
+    // Only the loader allocates memory; the other processes get the address of the loader's memory.
+    const MPI_Aint localSize = _isLoader ? MPI_Aint(numBytes) : 0;
+    void* localData = NULL;
+    err = MPI_Win_allocate_shared(localSize, 1, MPI_INFO_NULL, _nodeComm, &localData, &_window);PYLITH_CHECK_ERROR(err);
+    MPI_Aint sharedSize = 0;
+    int dispUnit = 0;
+    err = MPI_Win_shared_query(_window, 0, &sharedSize, &dispUnit, &_data);PYLITH_CHECK_ERROR(err);
+    assert(size_t(sharedSize) == numBytes);
+    _size = numBytes;
+
+    // Passive target epoch for the lifetime of the window, so synchronize() only needs MPI_Win_sync() and a barrier.
+    err = MPI_Win_lock_all(MPI_MODE_NOCHECK, _window);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // allocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Free buffer.
+void
+pylith::utils::NodeSharedBuffer::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    if (MPI_WIN_NULL != _window) {
+        err = MPI_Win_unlock_all(_window);PYLITH_CHECK_ERROR(err);
+        err = MPI_Win_free(&_window);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (MPI_COMM_NULL != _nodeComm) {
+        err = MPI_Comm_free(&_nodeComm);PYLITH_CHECK_ERROR(err);
+    } // if
+    _window = MPI_WIN_NULL;
+    _nodeComm = MPI_COMM_NULL;
+    _data = NULL;
+    _size = 0;
+    _isLoader = false;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Is this process responsible for filling the buffer on its node?
+bool
+pylith::utils::NodeSharedBuffer::isLoader(void) const {
+    return _isLoader;
+} // isLoader
+
+
+// ------------------------------------------------------------------------------------------------
+// Make the values written by the loader visible to all processes on the node.
+void
+pylith::utils::NodeSharedBuffer::synchronize(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(MPI_WIN_NULL != _window);
+
+    PetscErrorCode err = 0;
+    err = MPI_Win_sync(_window);PYLITH_CHECK_ERROR(err);
+    err = MPI_Barrier(_nodeComm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Win_sync(_window);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // synchronize
+
+
+// ------------------------------------------------------------------------------------------------
+// Get size of buffer.
+size_t
+pylith::utils::NodeSharedBuffer::size(void) const {
+    return _size;
+} // size
+
+
+// ------------------------------------------------------------------------------------------------
+// Get buffer.
+void*
+pylith::utils::NodeSharedBuffer::data(void) {
+    return _data;
+} // data
+
+
+// ------------------------------------------------------------------------------------------------
+// Get buffer.
+const void*
+pylith::utils::NodeSharedBuffer::data(void) const {
+    return _data;
+} // data
+
+
+// End of file
@@ -0,0 +1,107 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/NodeSharedBuffer.hh
+ *
+ * @brief Read-only buffer shared by the processes on a compute node.
+ *
+ * The buffer is allocated in an MPI-3 shared memory window on the first process (loader) of each node. The loader
+ * fills the buffer and then all of the processes on the node call synchronize() before reading it, so each node
+ * holds a single copy of the data regardless of the number of processes on the node.
+ */
+
+#if !defined(pylith_utils_nodesharedbuffer_hh)
+#define pylith_utils_nodesharedbuffer_hh
+
+#include "utilsfwd.hh" // forward declarations
+
+#include <mpi.h> // HASA MPI_Comm, MPI_Win
+#include <cstddef> // USES size_t
+
+class pylith::utils::NodeSharedBuffer {
+    friend class TestNodeSharedBuffer; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    NodeSharedBuffer(void);
+
+    /// Destructor
+    ~NodeSharedBuffer(void);
+
+    /** Allocate buffer shared by the processes on each node (collective over comm).
+     *
+     * @param[in] numBytes Size of buffer in bytes.
+     * @param[in] comm MPI communicator.
+     */
+    void allocate(const size_t numBytes,
+                  MPI_Comm comm);
+
+    /// Free buffer (collective over processes that allocated it).
+    void deallocate(void);
+
+    /** Is this process responsible for filling the buffer on its node?
+     *
+     * @returns True if process is the first process on its node, false otherwise.
+     */
+    bool isLoader(void) const;
+
+    /** Make the values written by the loader visible to all processes on the node (collective over the node).
+     */
+    void synchronize(void);
+
+    /** Get size of buffer.
+     *
+     * @returns Size of buffer in bytes.
+     */
+    size_t size(void) const;
+
+    /** Get buffer.
+     *
+     * @returns Pointer to buffer.
+     */
+    void* data(void);
+
+    /** Get buffer.
+     *
+     * @returns Pointer to buffer.
+     */
+    const void* data(void) const;
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    MPI_Comm _nodeComm; ///< Communicator for processes on node.
+    MPI_Win _window; ///< Shared memory window.
+    void* _data; ///< Buffer.
+    size_t _size; ///< Size of buffer in bytes.
+    bool _isLoader; ///< True if process fills the buffer on its node.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    NodeSharedBuffer(const NodeSharedBuffer&); ///< Not implemented.
+    const NodeSharedBuffer& operator=(const NodeSharedBuffer&); ///< Not implemented
+
+}; // NodeSharedBuffer
+
+#endif // pylith_utils_nodesharedbuffer_hh
+
+// End of file
@@ -28,6 +28,10 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL*
 #include "pylith/utils/mpi.hh" // USES isRoot()
 
+#include <sstream> // USES std::ostringstream
+#include <vector> // USES std::vector
+#include <cstring> // USES strlen()
+#include <stdexcept> // USES std::logic_error
 #include <cassert>
 
 namespace pylith {
@@ -57,6 +61,14 @@ public:
             static
             bool hasFault(const pylith::topology::Field& solution);
 
+            /** Check if problem is too large for the default direct solver.
+             *
+             * @param[in] solution Solution field for problem.
+             * @returns True if number of unconstrained degrees of freedom exceeds maxDirectSolverSize.
+             */
+            static
+            bool isLarge(const pylith::topology::Field& solution);
+
             /** Add debugging options.
              *
              * @param[in] options PETSc options.
@@ -79,11 +91,55 @@ public:
             void addSolverTolerances(PetscOptions* options);
 
             /** Add initial guess options.
+             *
+             * @param[in] options PETSc options.
+             * @param[in] size Number of previous solutions retained in the initial guess basis.
+             */
+            static
+            void addInitialGuess(PetscOptions* options,
+                                 const size_t size);
+
+            /** Add options for Anderson acceleration with Newton's method with lagged Jacobian as nonlinear
+             * preconditioner.
+             *
+             * The nonlinear preconditioner has its own linear solver, so the linear solver options are copied with the
+             * prefix of the nonlinear preconditioner.
+             *
+             * @param[in] options PETSc options.
+             */
+            static
+            void addNewtonAnderson(PetscOptions* options);
+
+            /** Add options for factorization in single precision in direct solvers used as preconditioners.
+             *
+             * PETSc is built with a single precision for scalars, so the factorization uses MUMPS, which can factor
+             * and solve in single precision in a double precision build. The Krylov solver remains in double
+             * precision and iterates to the double precision tolerances.
              *
              * @param[in] options PETSc options.
              */
             static
-            void addInitialGuess(PetscOptions* options);
+            void addSinglePrecisionFactorization(PetscOptions* options);
+
+            /** Add options for reusing the interpolation of algebraic multigrid preconditioners.
+             *
+             * When the Jacobian is rebuilt, the sparsity and near null space do not change, so GAMG keeps the
+             * aggregates and prolongators from the first setup and only recomputes the Galerkin coarse operators.
+             *
+             * @param[in] options PETSc options.
+             */
+            static
+            void addReuseAMGInterpolation(PetscOptions* options);
+
+            /** Add options for L-BFGS quasi-Newton method with lagged Jacobian as initial Hessian.
+             *
+             * @param[in] options PETSc options.
+             */
+            static
+            void addQuasiNewton(PetscOptions* options);
+
+            /// Maximum number of unconstrained degrees of freedom for using a direct solver by default.
+            static const PetscInt maxDirectSolverSize;
 
         };
     }
@@ -96,13 +152,19 @@ const int pylith::utils::PetscDefaults::SOLVER = 0x2;
 const int pylith::utils::PetscDefaults::PARALLEL = 0x4;
 const int pylith::utils::PetscDefaults::INITIAL_GUESS = 0x8;
 const int pylith::utils::PetscDefaults::TESTING = 0x10;
+const int pylith::utils::PetscDefaults::SINGLE_PRECISION_PC = 0x20;
+const int pylith::utils::PetscDefaults::REUSE_AMG_INTERPOLATION = 0x40;
+
+const PetscInt pylith::utils::_PetscOptions::maxDirectSolverSize = 200000;
 
 // ------------------------------------------------------------------------------------------------
 // Set default PETSc solver options based on solution field and material.
 void
 pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
                                   const pylith::materials::Material* material,
-                                  const int flags) {
+                                  const int flags,
+                                  const NonlinearSolverEnum nonlinearSolver,
+                                  const size_t initialGuessSize) {
     PYLITH_METHOD_BEGIN;
     assert(material);
 
@@ -112,7 +174,9 @@ pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
 
     PetscOptions* options = NULL;
     if (flags & SOLVER) {
-        const bool isParallel = flags & PARALLEL || _PetscOptions::isParallel(solution);
+        // Large serial problems use the same scalable preconditioners as parallel problems, because the
+        // memory and runtime of a direct solve grow much faster than the number of degrees of freedom.
+        const bool isParallel = flags & PARALLEL || _PetscOptions::isParallel(solution) || _PetscOptions::isLarge(solution);
         const bool hasFault = _PetscOptions::hasFault(solution);
         options = material->getSolverDefaults(isParallel, hasFault);
     } // if
@@ -123,7 +187,27 @@ pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
 
     _PetscOptions::addSolverTolerances(options);
     if (flags & INITIAL_GUESS) {
-        _PetscOptions::addInitialGuess(options);
+        _PetscOptions::addInitialGuess(options, initialGuessSize);
+    } // if
+    if ((flags & SOLVER) && (flags & SINGLE_PRECISION_PC)) {
+        _PetscOptions::addSinglePrecisionFactorization(options);
+    } // if
+    if ((flags & SOLVER) && (flags & REUSE_AMG_INTERPOLATION)) {
+        _PetscOptions::addReuseAMGInterpolation(options);
+    } // if
+    if (flags & SOLVER) {
+        switch (nonlinearSolver) {
+        case NEWTON:
+            break;
+        case NEWTON_ANDERSON:
+            _PetscOptions::addNewtonAnderson(options);
+            break;
+        case QUASI_NEWTON:
+            _PetscOptions::addQuasiNewton(options);
+            break;
+        default:
+            PYLITH_JOURNAL_LOGICERROR("Unknown nonlinear solver '" << nonlinearSolver << "'.");
+        } // switch
     } // if
     if (flags & TESTING) {
         _PetscOptions::addTesting(options);
@@ -285,6 +369,25 @@ pylith::utils::_PetscOptions::hasFault(const pylith::topology::Field& solution)
 } // hasFault
 
 
+// ------------------------------------------------------------------------------------------------
+// Check if problem is too large for the default direct solver.
+bool
+pylith::utils::_PetscOptions::isLarge(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscSection globalSection = NULL;
+    PetscInt localSize = 0;
+    err = DMGetGlobalSection(solution.getDM(), &globalSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstrainedStorageSize(globalSection, &localSize);PYLITH_CHECK_ERROR(err);
+
+    PetscInt globalSize = 0;
+    err = MPI_Allreduce(&localSize, &globalSize, 1, MPIU_INT, MPI_SUM, solution.getMesh().getComm());PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(globalSize > maxDirectSolverSize);
+} // isLarge
+
+
 // ------------------------------------------------------------------------------------------------
 // Add debugging options.
 void
@@ -333,13 +436,123 @@ pylith::utils::_PetscOptions::addSolverTolerances(PetscOptions* options) {
 // ------------------------------------------------------------------------------------------------
 // Add initial guess defaults.
 void
-pylith::utils::_PetscOptions::addInitialGuess(PetscOptions* options) {
+pylith::utils::_PetscOptions::addInitialGuess(PetscOptions* options,
+                                              const size_t size) {
     assert(options);
 
+    std::ostringstream sizeStr;
+    sizeStr << size;
     options->add("-ksp_guess_type", "pod");
-    options->add("-ksp_guess_pod_size", "8");
+    options->add("-ksp_guess_pod_size", sizeStr.str().c_str());
 
 } // addInitialGuess
 
 
+// ------------------------------------------------------------------------------------------------
+// Add options for Anderson acceleration with Newton's method as nonlinear preconditioner.
+void
+pylith::utils::_PetscOptions::addNewtonAnderson(PetscOptions* options) {
+    assert(options);
+
+    // Copy linear solver options, including preconditioners of field splits and multigrid levels.
+    const char* linearPrefixes[4] = { "-ksp_", "-pc_", "-fieldsplit_", "-mg_" };
+    PetscOptions::options_t npcOptions;
+    for (PetscOptions::options_t::const_iterator iter = options->_options.begin(); iter != options->_options.end(); ++iter) {
+        for (size_t i = 0; i < 4; ++i) {
+            if (0 == iter->first.compare(0, strlen(linearPrefixes[i]), linearPrefixes[i])) {
+                npcOptions["-npc_" + iter->first.substr(1)] = iter->second;
+                break;
+            } // if
+        } // for
+    } // for
+    options->_options.insert(npcOptions.begin(), npcOptions.end());
+    options->remove("-npc_ksp_error_if_not_converged");
+
+    options->add("-snes_type", "anderson");
+    options->add("-snes_anderson_m", "5");
+    options->add("-snes_anderson_beta", "1.0");
+    options->add("-snes_anderson_restart_type", "difference");
+    options->add("-snes_npc_side", "right");
+    options->add("-snes_max_it", "100");
+
+    // One Newton iteration per Anderson iteration, reforming the Jacobian every other iteration.
+    options->add("-npc_snes_type", "newtonls");
+    options->add("-npc_snes_max_it", "1");
+    options->add("-npc_snes_linesearch_type", "basic");
+    options->add("-npc_snes_lag_jacobian", "2");
+    options->add("-npc_snes_lag_jacobian_persists");
+    options->add("-npc_snes_convergence_test", "skip");
+} // addNewtonAnderson
+
+
+// ------------------------------------------------------------------------------------------------
+// Add options for factorization in single precision in direct solvers used as preconditioners.
+void
+pylith::utils::_PetscOptions::addSinglePrecisionFactorization(PetscOptions* options) {
+    assert(options);
+
+    // Direct solvers for the entire problem or for a field split, e.g., '-fieldsplit_displacement_pc_type lu'.
+    const std::string pcTypeSuffix("pc_type");
+    std::vector<std::string> prefixes;
+    for (PetscOptions::options_t::const_iterator iter = options->_options.begin(); iter != options->_options.end(); ++iter) {
+        const std::string& name = iter->first;
+        if ((name.size() < pcTypeSuffix.size()) ||
+            (0 != name.compare(name.size()-pcTypeSuffix.size(), pcTypeSuffix.size(), pcTypeSuffix))) {
+            continue;
+        } // if
+        if ((iter->second == "lu") || (iter->second == "cholesky")) {
+            prefixes.push_back(name.substr(0, name.size()-pcTypeSuffix.size()));
+        } // if
+    } // for
+
+    for (size_t i = 0; i < prefixes.size(); ++i) {
+        options->add((prefixes[i] + "pc_factor_mat_solver_type").c_str(), "mumps");
+        options->add((prefixes[i] + "pc_precision").c_str(), "single");
+    } // for
+} // addSinglePrecisionFactorization
+
+
+// ------------------------------------------------------------------------------------------------
+// Add options for reusing the interpolation of algebraic multigrid preconditioners.
+void
+pylith::utils::_PetscOptions::addReuseAMGInterpolation(PetscOptions* options) {
+    assert(options);
+
+    // GAMG for the entire problem or for a field split, e.g., '-fieldsplit_displacement_pc_type gamg'.
+    const std::string pcTypeSuffix("pc_type");
+    std::vector<std::string> prefixes;
+    for (PetscOptions::options_t::const_iterator iter = options->_options.begin(); iter != options->_options.end(); ++iter) {
+        const std::string& name = iter->first;
+        if ((name.size() < pcTypeSuffix.size()) ||
+            (0 != name.compare(name.size()-pcTypeSuffix.size(), pcTypeSuffix.size(), pcTypeSuffix))) {
+            continue;
+        } // if
+        if (iter->second == "gamg") {
+            prefixes.push_back(name.substr(0, name.size()-pcTypeSuffix.size()));
+        } // if
+    } // for
+
+    for (size_t i = 0; i < prefixes.size(); ++i) {
+        options->add((prefixes[i] + "pc_gamg_reuse_interpolation").c_str(), "true");
+    } // for
+} // addReuseAMGInterpolation
+
+
+// ------------------------------------------------------------------------------------------------
+// Add options for L-BFGS quasi-Newton method with lagged Jacobian as initial Hessian.
+void
+pylith::utils::_PetscOptions::addQuasiNewton(PetscOptions* options) {
+    assert(options);
+
+    // The Jacobian is only formed at the first iteration and when the L-BFGS update is restarted.
+    options->add("-snes_type", "qn");
+    options->add("-snes_qn_type", "lbfgs");
+    options->add("-snes_qn_m", "10");
+    options->add("-snes_qn_scale_type", "jacobian");
+    options->add("-snes_qn_restart_type", "powell");
+    options->add("-snes_linesearch_type", "l2");
+    options->add("-snes_max_it", "200");
+} // addQuasiNewton
+
+
 // End of file
@@ -42,6 +42,14 @@ public:
     static const int PARALLEL;
     static const int INITIAL_GUESS;
     static const int TESTING;
+    static const int SINGLE_PRECISION_PC;
+    static const int REUSE_AMG_INTERPOLATION;
+
+    enum NonlinearSolverEnum {
+        NEWTON, // Newton's method with line search.
+        NEWTON_ANDERSON, // Anderson acceleration with Newton's method with lagged Jacobian as nonlinear preconditioner.
+        QUASI_NEWTON, // L-BFGS quasi-Newton method with lagged Jacobian as initial Hessian.
+    }; // NonlinearSolverEnum
 
     // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
 public:
@@ -51,11 +59,15 @@ public:
      * @param[in] solution Solution field for problem.
      * @param[in] material Solution field.
      * @param[in] flags Flags for turning on defaults for PETSc options.
+     * @param[in] nonlinearSolver Type of nonlinear solver.
+     * @param[in] initialGuessSize Number of previous solutions retained in the initial guess basis.
      */
     static
     void set(const pylith::topology::Field& solution,
              const pylith::materials::Material* material,
-             const int flags);
+             const int flags,
+             const NonlinearSolverEnum nonlinearSolver=NEWTON,
+             const size_t initialGuessSize=8);
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
@@ -31,6 +31,7 @@
 // Constructor
 pylith::utils::PyreComponent::PyreComponent(void) :
     _name(""),
+    _debug(NULL),
     _identifier("unknown") { // constructor
     if (!Py_IsInitialized()) {
         throw std::logic_error("Python must be initialized to use PyreComponent in C++.");
@@ -40,7 +41,9 @@ pylith::utils::PyreComponent::PyreComponent(void) :
 
 // ----------------------------------------------------------------------
 // Destructor
-pylith::utils::PyreComponent::~PyreComponent(void) {}
+pylith::utils::PyreComponent::~PyreComponent(void) {
+    delete _debug;_debug = NULL;
+} // destructor
 
 
 // ----------------------------------------------------------------------
@@ -51,6 +54,7 @@ pylith::utils::PyreComponent::setName(const char* value) {
         throw std::logic_error("Cannot set name of Pyre component to empty string.");
     } // if
     _name = value;
+    delete _debug;_debug = NULL;
 } // setName
 
 
@@ -62,6 +66,17 @@ pylith::utils::PyreComponent::getName(void) const {
 } // getName
 
 
+// ----------------------------------------------------------------------
+// Get debug journal of component.
+pythia::journal::debug_t&
+pylith::utils::PyreComponent::getDebugJournal(void) const {
+    if (!_debug) {
+        _debug = new pythia::journal::debug_t(_name.c_str());
+    } // if
+    return *_debug;
+} // getDebugJournal
+
+
 // ----------------------------------------------------------------------
 // Set component identifier (identifies object in component hierarchy).
 void
@@ -28,6 +28,8 @@
 // Include directives ---------------------------------------------------
 #include "utilsfwd.hh" // forward declarations
 
+#include "pythia/journal/diagnostics.h" // HASA debug_t
+
 #include <string> // HASA std::string
 
 // PyreComponent ----------------------------------------------------------
@@ -60,6 +62,14 @@ public:
      */
     const char* getName(void) const;
 
+    /** Get debug journal of component.
+     *
+     * The journal is created on first use after the name is set, so it is not looked up by name every time it is used.
+     *
+     * @returns Debug journal.
+     */
+    pythia::journal::debug_t& getDebugJournal(void) const;
+
     /** Set component identifier (identifies object in component hierarchy).
      *
      * @param value Component identifier.
@@ -76,6 +86,7 @@ public:
 private:
 
     std::string _name; ///< Name of component (used in journals).
+    mutable pythia::journal::debug_t* _debug; ///< Debug journal of component.
     std::string _identifier; ///< Identifier for object in component hierarchy.
 
     // PRIVATE METHODS //////////////////////////////////////////////////////
@@ -0,0 +1,332 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "SetupProfiler.hh" // Implementation of class methods
+
+#include "error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petscsys.h" // USES PetscMemoryGetCurrentUsage()
+#include "petsctime.h" // USES PetscTime()
+
+#include <algorithm> // USES std::min(), std::max(), std::count()
+#include <cassert> // USES assert()
+#include <cstdlib> // USES atof(), atoi()
+#include <iomanip> // USES std::setw()
+#include <map> // USES std::map
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::logic_error
+#include <vector> // USES std::vector
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class _SetupProfiler {
+public:
+
+            /// Accumulated cost of a phase.
+            struct Phase {
+                std::string path; ///< Names of enclosing phases and phase separated by pathSeparator.
+                int count; ///< Number of times phase was completed.
+                double time; ///< Accumulated wall time (s).
+                double memory; ///< Accumulated change in resident set size (bytes).
+            }; // Phase
+
+            /// Phase in progress.
+            struct Active {
+                std::string name; ///< Name of phase.
+                size_t index; ///< Index of phase in phases.
+                double startTime; ///< Wall time at beginning of phase.
+                double startMemory; ///< Resident set size at beginning of phase.
+            }; // Active
+
+            /// Statistics of phase over processes.
+            struct Stats {
+                int count;
+                int numProcs;
+                double timeMin;
+                double timeMax;
+                double timeSum;
+                double memoryMax;
+                double memorySum;
+            }; // Stats
+
+            static const char pathSeparator; ///< Separator between names of nested phases.
+            static std::vector<Phase> phases; ///< Phases in order of first occurrence.
+            static std::map<std::string, size_t> indices; ///< Index of phase for each path.
+            static std::vector<Active> active; ///< Stack of phases in progress.
+
+            /** Get current resident set size of process.
+             *
+             * @returns Resident set size (bytes).
+             */
+            static
+            double getMemory(void);
+
+            /** Get index of first path after all descendants of the parent of a path.
+             *
+             * @param[in] paths Ordered paths.
+             * @param[in] path Path to insert.
+             * @returns Index at which to insert path.
+             */
+            static
+            size_t getInsertIndex(const std::vector<std::string>& paths,
+                                  const std::string& path);
+
+        }; // _SetupProfiler
+    } // utils
+} // pylith
+
+const char pylith::utils::_SetupProfiler::pathSeparator = '\t';
+std::vector<pylith::utils::_SetupProfiler::Phase> pylith::utils::_SetupProfiler::phases;
+std::map<std::string, size_t> pylith::utils::_SetupProfiler::indices;
+std::vector<pylith::utils::_SetupProfiler::Active> pylith::utils::_SetupProfiler::active;
+
+// ----------------------------------------------------------------------
+// Begin setup phase.
+void
+pylith::utils::SetupProfiler::begin(const char* phase) {
+    assert(phase);
+
+    std::string path = _SetupProfiler::active.size() ? _SetupProfiler::phases[_SetupProfiler::active.back().index].path + _SetupProfiler::pathSeparator : "";
+    path += phase;
+
+    std::map<std::string, size_t>::const_iterator iter = _SetupProfiler::indices.find(path);
+    size_t index = 0;
+    if (iter == _SetupProfiler::indices.end()) {
+        _SetupProfiler::Phase entry;
+        entry.path = path;
+        entry.count = 0;
+        entry.time = 0.0;
+        entry.memory = 0.0;
+        index = _SetupProfiler::phases.size();
+        _SetupProfiler::phases.push_back(entry);
+        _SetupProfiler::indices[path] = index;
+    } else {
+        index = iter->second;
+    } // if/else
+
+    _SetupProfiler::Active current;
+    current.name = phase;
+    current.index = index;
+    current.startMemory = _SetupProfiler::getMemory();
+    PetscLogDouble time = 0.0;
+    PetscTime(&time);
+    current.startTime = time;
+    _SetupProfiler::active.push_back(current);
+} // begin
+
+
+// ----------------------------------------------------------------------
+// End setup phase.
+void
+pylith::utils::SetupProfiler::end(const char* phase) {
+    assert(phase);
+
+    PetscLogDouble time = 0.0;
+    PetscTime(&time);
+    if (_SetupProfiler::active.empty() || (_SetupProfiler::active.back().name != phase)) {
+        std::ostringstream msg;
+        msg << "Cannot end setup phase '" << phase << "'. Current setup phase is '"
+            << (_SetupProfiler::active.empty() ? "" : _SetupProfiler::active.back().name) << "'.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    const _SetupProfiler::Active& current = _SetupProfiler::active.back();
+    _SetupProfiler::Phase& entry = _SetupProfiler::phases[current.index];
+    entry.count += 1;
+    entry.time += time - current.startTime;
+    entry.memory += _SetupProfiler::getMemory() - current.startMemory;
+    _SetupProfiler::active.pop_back();
+} // end
+
+
+// ----------------------------------------------------------------------
+// Get number of setup phases currently in progress.
+size_t
+pylith::utils::SetupProfiler::getDepth(void) {
+    return _SetupProfiler::active.size();
+} // getDepth
+
+
+// ----------------------------------------------------------------------
+// Create report of setup phases over all processes.
+std::string
+pylith::utils::SetupProfiler::report(const char* title,
+                                     MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+
+    // Serialize completed phases as lines with alternating paths and values. Phases in progress are reported in a
+    // later report.
+    std::ostringstream buffer;
+    buffer << std::setprecision(17);
+    for (size_t i = 0; i < _SetupProfiler::phases.size(); ++i) {
+        const _SetupProfiler::Phase& entry = _SetupProfiler::phases[i];
+        if (entry.count > 0) {
+            buffer << entry.path << "\n" << entry.count << " " << entry.time << " " << entry.memory << "\n";
+        } // if
+    } // for
+    const std::string& localString = buffer.str();
+
+    // Keep phases in progress, so they can be ended and reported later.
+    std::vector<_SetupProfiler::Phase> activePhases;
+    for (size_t i = 0; i < _SetupProfiler::active.size(); ++i) {
+        _SetupProfiler::Phase entry = _SetupProfiler::phases[_SetupProfiler::active[i].index];
+        entry.count = 0;
+        entry.time = 0.0;
+        entry.memory = 0.0;
+        _SetupProfiler::active[i].index = i;
+        activePhases.push_back(entry);
+    } // for
+    _SetupProfiler::phases = activePhases;
+    _SetupProfiler::indices.clear();
+    for (size_t i = 0; i < _SetupProfiler::phases.size(); ++i) {
+        _SetupProfiler::indices[_SetupProfiler::phases[i].path] = i;
+    } // for
+
+    int commRank = 0, commSize = 1;
+    MPI_Comm_rank(comm, &commRank);
+    MPI_Comm_size(comm, &commSize);
+    int localSize = localString.size();
+    std::vector<int> sizes(commRank ? 0 : commSize);
+    PetscErrorCode err = MPI_Gather(&localSize, 1, MPI_INT, commRank ? NULL : &sizes[0], 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    std::vector<int> offsets(commRank ? 0 : commSize+1, 0);
+    for (int i = 0; i < int(sizes.size()); ++i) {
+        offsets[i+1] = offsets[i] + sizes[i];
+    } // for
+    std::vector<char> allChars(commRank ? 1 : std::max(offsets[commSize], 1));
+    err = MPI_Gatherv(const_cast<char*>(localString.c_str()), localSize, MPI_CHAR, &allChars[0],
+                      commRank ? NULL : &sizes[0], commRank ? NULL : &offsets[0], MPI_CHAR, 0, comm);PYLITH_CHECK_ERROR(err);
+    if (commRank) {
+        PYLITH_METHOD_RETURN(std::string(""));
+    } // if
+
+    std::vector<std::string> paths;
+    std::map<std::string, _SetupProfiler::Stats> stats;
+    for (int iRank = 0; iRank < commSize; ++iRank) {
+        std::istringstream sin(std::string(&allChars[offsets[iRank]], sizes[iRank]));
+        std::string path, values;
+        while (std::getline(sin, path) && std::getline(sin, values)) {
+            std::istringstream vin(values);
+            int count = 0;
+            double time = 0.0, memory = 0.0;
+            vin >> count >> time >> memory;
+            std::map<std::string, _SetupProfiler::Stats>::iterator iter = stats.find(path);
+            if (iter == stats.end()) {
+                // Phases only on other processes are listed with their siblings.
+                paths.insert(paths.begin() + _SetupProfiler::getInsertIndex(paths, path), path);
+                _SetupProfiler::Stats& entry = stats[path];
+                entry.count = count;
+                entry.numProcs = 1;
+                entry.timeMin = time;
+                entry.timeMax = time;
+                entry.timeSum = time;
+                entry.memoryMax = memory;
+                entry.memorySum = memory;
+            } else {
+                _SetupProfiler::Stats& entry = iter->second;
+                entry.count = std::max(entry.count, count);
+                entry.numProcs += 1;
+                entry.timeMin = std::min(entry.timeMin, time);
+                entry.timeMax = std::max(entry.timeMax, time);
+                entry.timeSum += time;
+                entry.memoryMax = std::max(entry.memoryMax, memory);
+                entry.memorySum += memory;
+            } // if/else
+        } // while
+    } // for
+
+    const size_t indent = 2;
+    size_t nameWidth = 5;
+    double totalTime = 0.0;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        const size_t depth = std::count(paths[i].begin(), paths[i].end(), _SetupProfiler::pathSeparator);
+        const size_t nameLength = paths[i].size() - (paths[i].rfind(_SetupProfiler::pathSeparator) + 1);
+        nameWidth = std::max(nameWidth, indent*depth + nameLength);
+        if (!depth) {
+            totalTime += stats[paths[i]].timeMax;
+        } // if
+    } // for
+
+    const double mb = 1024.0*1024.0;
+    std::ostringstream msg;
+    msg << "Setup profile for '" << title << "' over " << commSize << " process(es):\n"
+        << "  " << std::left << std::setw(nameWidth) << "Phase" << std::right
+        << std::setw(7) << "calls"
+        << std::setw(11) << "min (s)" << std::setw(11) << "mean (s)" << std::setw(11) << "max (s)"
+        << std::setw(8) << "%total"
+        << std::setw(13) << "mean dM (MB)" << std::setw(13) << "max dM (MB)" << "\n";
+    msg << std::fixed;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        const _SetupProfiler::Stats& entry = stats[paths[i]];
+        const size_t depth = std::count(paths[i].begin(), paths[i].end(), _SetupProfiler::pathSeparator);
+        const std::string name = std::string(indent*depth, ' ') + paths[i].substr(paths[i].rfind(_SetupProfiler::pathSeparator) + 1);
+        // Processes without the phase contribute zero.
+        const double timeMin = (entry.numProcs < commSize) ? 0.0 : entry.timeMin;
+        const double percent = (totalTime > 0.0) ? 100.0 * entry.timeMax / totalTime : 0.0;
+        msg << "  " << std::left << std::setw(nameWidth) << name << std::right
+            << std::setw(7) << entry.count
+            << std::setprecision(3)
+            << std::setw(11) << timeMin
+            << std::setw(11) << entry.timeSum/commSize
+            << std::setw(11) << entry.timeMax
+            << std::setprecision(1)
+            << std::setw(8) << percent
+            << std::setprecision(2)
+            << std::setw(13) << entry.memorySum/commSize/mb
+            << std::setw(13) << entry.memoryMax/mb << "\n";
+    } // for
+
+    PYLITH_METHOD_RETURN(msg.str());
+} // report
+
+
+// ----------------------------------------------------------------------
+// Get current resident set size of process.
+double
+pylith::utils::_SetupProfiler::getMemory(void) {
+    PetscLogDouble mem = 0.0;
+    PetscMemoryGetCurrentUsage(&mem);
+    return mem;
+} // getMemory
+
+
+// ----------------------------------------------------------------------
+// Get index of first path after all descendants of the parent of a path.
+size_t
+pylith::utils::_SetupProfiler::getInsertIndex(const std::vector<std::string>& paths,
+                                              const std::string& path) {
+    const size_t pos = path.rfind(pathSeparator);
+    if (std::string::npos == pos) {
+        return paths.size();
+    } // if
+
+    const std::string parent = path.substr(0, pos);
+    const std::string prefix = parent + pathSeparator;
+    size_t index = paths.size();
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if ((paths[i] == parent) || (0 == paths[i].compare(0, prefix.size(), prefix))) {
+            index = i + 1;
+        } // if
+    } // for
+    return index;
+} // getInsertIndex
+
+
+// End of file
@@ -0,0 +1,92 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/SetupProfiler.hh
+ *
+ * @brief Wall time and memory breakdown of the setup phases of a simulation.
+ *
+ * Setup phases (reading, distributing, and refining the mesh, querying spatial databases, creating and initializing
+ * integrators and constraints, and setting up the solver) are bracketed by calls to begin() and end(). Phases may be
+ * nested; a phase is identified by its name together with the names of the enclosing phases, and repeated phases
+ * with the same identity are accumulated. The report contains the wall time and the change in resident set size of
+ * each phase over all processes, so that the dominant setup costs are visible without a PETSc log.
+ */
+
+#if !defined(pylith_utils_setupprofiler_hh)
+#define pylith_utils_setupprofiler_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include "petscsys.h" // USES MPI_Comm, PETSC_COMM_WORLD
+#include <string> // USES std::string
+
+// SetupProfiler ----------------------------------------------------------
+/// @brief Wall time and memory breakdown of the setup phases of a simulation.
+class pylith::utils::SetupProfiler { // SetupProfiler
+    friend class TestSetupProfiler; // unit testing
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /** Begin setup phase.
+     *
+     * @param[in] phase Name of phase.
+     */
+    static
+    void begin(const char* phase);
+
+    /** End setup phase.
+     *
+     * @param[in] phase Name of phase (must match name of most recently begun phase).
+     */
+    static
+    void end(const char* phase);
+
+    /** Get number of setup phases currently in progress.
+     *
+     * @returns Nesting depth.
+     */
+    static
+    size_t getDepth(void);
+
+    /** Create report of setup phases over all processes and clear the completed phases.
+     *
+     * Collective over the communicator.
+     *
+     * @param[in] title Title of report.
+     * @param[in] comm MPI communicator.
+     * @returns Report on rank 0, empty string on other ranks.
+     */
+    static
+    std::string report(const char* title,
+                       MPI_Comm comm=PETSC_COMM_WORLD);
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    SetupProfiler(void); ///< Not implemented
+    SetupProfiler(const SetupProfiler&); ///< Not implemented
+    const SetupProfiler& operator=(const SetupProfiler&); ///< Not implemented
+
+}; // SetupProfiler
+
+#endif // pylith_utils_setupprofiler_hh
+
+// End of file
@@ -29,6 +29,7 @@
 #define pylith_utils_array_hh
 
 #include "arrayfwd.hh"
+#include "AlignedBuffer.hh" // USES AlignedBuffer
 
 #endif // pylith_utils_array_hh
 
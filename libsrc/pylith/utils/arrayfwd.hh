@@ -26,6 +26,10 @@
  * For simple types (i.e., int and PylithScalar) std::valarray provides some
  * features that std::vector does not have, such as operating on the
  * whole array at once.
+ *
+ * Large temporary arrays used during setup, such as buffers for reading
+ * meshes, use AlignedBuffer, which has aligned storage and does not
+ * initialize values when resized.
  */
 
 #if !defined(pylith_utils_arrayfwd_hh)
@@ -66,6 +70,16 @@ namespace pylith {
     /// Alias for std::valarray<PylithScalar>
     typedef std::valarray<PylithScalar> scalar_array;
 
+    namespace utils {
+        template<typename T> class AlignedBuffer;
+    } // utils
+
+    /// Alias for AlignedBuffer<PylithInt>
+    typedef utils::AlignedBuffer<PylithInt> int_buffer;
+
+    /// Alias for AlignedBuffer<PylithScalar>
+    typedef utils::AlignedBuffer<PylithScalar> scalar_buffer;
+
 } // pylith
 
 #endif // pylith_utils_arrayfwd_hh
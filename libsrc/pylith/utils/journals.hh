@@ -30,10 +30,11 @@
 
 #define PYLITH_COMPONENT_DEBUG(msg) \
     do { \
-        pythia::journal::debug_t debug(PyreComponent::getName()); \
-        debug << pythia::journal::at(__HERE__) \
-              << "Component '"<<PyreComponent::getIdentifier()<<"': " \
-              << msg << pythia::journal::endl; \
+        pythia::journal::debug_t& debug = PyreComponent::getDebugJournal(); \
+        if (debug.state()) { \
+            debug << pythia::journal::at(__HERE__) \
+                  << "Component '"<<PyreComponent::getIdentifier()<<"': " \
+                  << msg << pythia::journal::endl; } \
     } while (0)
 
 #define PYLITH_COMPONENT_INFO_ROOT(msg) \
@@ -80,9 +81,10 @@
 
 #define PYLITH_JOURNAL_DEBUG(msg) \
     do { \
-        pythia::journal::debug_t debug(GenericComponent::getName()); \
-        debug << pythia::journal::at(__HERE__) \
-              << msg << pythia::journal::endl; \
+        pythia::journal::debug_t& debug = GenericComponent::getDebugJournal(); \
+        if (debug.state()) { \
+            debug << pythia::journal::at(__HERE__) \
+                  << msg << pythia::journal::endl; } \
     } while (0)
 
 #define PYLITH_JOURNAL_INFO_ROOT(msg) \
@@ -122,6 +124,25 @@
         throw std::logic_error(firewall.str().c_str()); \
     } while (0)
 
+// Debug journals in residual, Jacobian, and poststep callbacks. Configuring with --disable-callback-debug defines
+// PYLITH_DISABLE_CALLBACK_DEBUG and removes them.
+#if defined(PYLITH_DISABLE_CALLBACK_DEBUG)
+#define PYLITH_COMPONENT_DEBUG_CALLBACK(msg) do {} while (0)
+#define PYLITH_JOURNAL_DEBUG_CALLBACK(msg) do {} while (0)
+#define PYLITH_DEBUG_CALLBACK(channel, msg) do {} while (0)
+#else
+#define PYLITH_COMPONENT_DEBUG_CALLBACK(msg) PYLITH_COMPONENT_DEBUG(msg)
+#define PYLITH_JOURNAL_DEBUG_CALLBACK(msg) PYLITH_JOURNAL_DEBUG(msg)
+// Journal channel is resolved on the first call, so the channel name must be the same for every call.
+#define PYLITH_DEBUG_CALLBACK(channel, msg) \
+    do { \
+        static pythia::journal::debug_t debug(channel); \
+        if (debug.state()) { \
+            debug << pythia::journal::at(__HERE__) \
+                  << msg << pythia::journal::endl; } \
+    } while (0)
+#endif
+
 #endif // pylith_utils_journals_hh
 
 // End of file
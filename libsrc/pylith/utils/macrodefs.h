@@ -29,6 +29,22 @@
 #define CALL_MEMBER_FN(object,ptrToMember)  ((object).*(ptrToMember))
 #endif
 
+/* Compile a function for several instruction sets and select the best one for the CPU when the library is loaded
+ * (function multiversioning via ifunc). Requires GCC 6+ or Clang 14+ on x86_64 ELF platforms. Only apply to
+ * functions with a single out-of-line definition in libpylith (see fekernels/KernelMultiversion.hh); inline
+ * functions would get an ifunc resolver in every object that uses them.
+ */
+#if !defined(PYLITH_KERNEL_MULTIVERSION)
+#if defined(PYLITH_USE_KERNEL_MULTIVERSIONING) && defined(__x86_64__) && defined(__ELF__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define PYLITH_KERNEL_MULTIVERSION __attribute__((target_clones("avx512f", "avx2", "default")))
+#endif
+#endif
+#if !defined(PYLITH_KERNEL_MULTIVERSION)
+#define PYLITH_KERNEL_MULTIVERSION
+#endif
+#endif
+
 #endif // pylith_utils_macro_defs_h
 
 
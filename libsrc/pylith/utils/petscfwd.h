@@ -34,6 +34,9 @@ typedef struct _p_Mat* PetscMat;
 /// forward declaration for PETSc Vec
 typedef struct _p_Vec* PetscVec;
 
+/// forward declaration for PETSc MatNullSpace
+typedef struct _p_MatNullSpace* PetscMatNullSpace;
+
 /// forward declaration for PETSc VecScatter
 typedef struct _p_VecScatter* PetscVecScatter;
 
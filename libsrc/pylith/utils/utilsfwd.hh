@@ -33,9 +33,16 @@ namespace pylith {
         class PetscDefaults;
 
         class EventLogger;
+        class MemoryLogger;
+        class SetupProfiler;
+        class HardwareCounters;
+        class NodeSharedBuffer;
+        template<typename T> class AlignedBuffer;
         class GenericComponent;
         class PyreComponent;
 
+        class Expression;
+
         class PylithVersion;
         class PetscVersion;
         class DependenciesVersion;
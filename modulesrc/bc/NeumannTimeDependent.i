@@ -84,6 +84,20 @@ public:
              */
             bool useTimeHistory(void) const;
 
+            /** Set name of HDF5 file with time slices of amplitude.
+             *
+             * The time slices replace the initial value term, so they cannot be used together with it.
+             *
+             * @param[in] value Name of HDF5 file (empty for no time slices).
+             */
+            void setTimeSlicesFilename(const char* value);
+
+            /** Get flag associated with using time slices for the amplitude in time history expression.
+             *
+             * @returns True if using time slices, false otherwise.
+             */
+            bool useTimeSlices(void) const;
+
             /** Set name of scale associated with Neumann boundary
              * condition (e.g., 'pressure' for elasticity).
              *
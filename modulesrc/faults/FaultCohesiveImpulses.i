@@ -59,6 +59,22 @@ public:
              */
             void setThreshold(const double value);
 
+            /** Set spatial database with patches for impulses.
+             *
+             * When a spatial database is given, each impulse is unit slip over all points in a patch (coarse basis)
+             * rather than at a single point. The database provides the integer patch identifier, 'patch_id', at each
+             * point; points with a negative identifier do not belong to any patch.
+             *
+             * @param[in] db Spatial database with patch identifiers.
+             */
+            void setPatchDB(spatialdata::spatialdb::SpatialDB* db);
+
+            /** Are impulses applied over patches that every process contributes to?
+             *
+             * @returns True if using patch impulses, false otherwise.
+             */
+            bool hasImpulsePatches(void) const;
+
             /** Get the total number of impulses that will be applied.
              *
              * @returns Number of impulses.
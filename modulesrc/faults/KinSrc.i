@@ -49,6 +49,14 @@ public:
              */
             PylithReal getOriginTime(void) const;
 
+            /** Get time when slip reaches its final value at all points of the fault on this process.
+             *
+             * After this time the slip is constant and the slip rate and slip acceleration are zero.
+             *
+             * @returns Time when slip reaches final value (PYLITH_MAXSCALAR if slip never reaches a final value).
+             */
+            PylithReal getFinalSlipTime(void) const;
+
             /** Get auxiliary field associated with the kinematic source.
              *
              * @return field Auxiliary field for the kinematic source.
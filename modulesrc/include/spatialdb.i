@@ -0,0 +1,46 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+// Declaration of spatialdata::spatialdb::SpatialDB base class so that SWIG knows about the inheritance of spatial
+// databases implemented in PyLith. Use with %import; the wrappers are in the spatialdata module.
+namespace spatialdata {
+    namespace spatialdb {
+        class SpatialDB {
+public:
+
+            SpatialDB(void);
+
+            virtual ~SpatialDB(void);
+
+            void setDescription(const char* label);
+
+            const char* getDescription(void) const;
+
+            virtual void open(void) = 0;
+
+            virtual void close(void) = 0;
+
+        }; // SpatialDB
+    } // spatialdb
+} // spatialdata
+
+namespace spatialdata {
+    namespace geocoords {
+        class CoordSys;
+    } // geocoords
+} // spatialdata
+
+// End of file
@@ -48,6 +48,34 @@ public:
              */
             bool useBodyForce(void) const;
 
+            /** Eliminate pressure in each cell (static condensation)?
+             *
+             * @param[in] value Flag indicating to eliminate pressure in each cell.
+             */
+            void useStaticCondensation(const bool value);
+
+            /** Eliminate pressure in each cell (static condensation)?
+             *
+             * @returns True if eliminating pressure in each cell, false otherwise.
+             */
+            bool useStaticCondensation(void) const;
+
+            /** Use pressure mass matrix preconditioner?
+             *
+             * Adds preconditioner kernels equal to the Jacobian kernels except for the pressure block, which is the pressure
+             * mass matrix weighted by 1/shear_modulus + 1/bulk_modulus, an approximation of the Schur complement for the
+             * pressure. Only used with the quasistatic formulation.
+             *
+             * @param[in] value Flag indicating to use pressure mass matrix preconditioner.
+             */
+            void usePressureMassPreconditioner(const bool value);
+
+            /** Use pressure mass matrix preconditioner?
+             *
+             * @returns True if using pressure mass matrix preconditioner, false otherwise.
+             */
+            bool usePressureMassPreconditioner(void) const;
+
             /** Set bulk rheology.
              *
              * @param[in] rheology Bulk rheology for elasticity.
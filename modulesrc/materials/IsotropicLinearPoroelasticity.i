@@ -141,6 +141,10 @@ public:
   // Get Specific storage kernel for LHS Jacobian F(t,s, \dot{s}).
   PetscPointJac getKernelJf0pp(const spatialdata::geocoords::CoordSys* coordsys) const;
 
+  // ---------------------------------------------------------------------------------------------------------------------
+  // Get specific storage kernel with fixed-stress stabilization for LHS Jacobian preconditioner F(t,s, \dot{s}).
+  PetscPointJac getKernelJf0ppFixedStress(const spatialdata::geocoords::CoordSys* coordsys) const;
+
   // ---------------------------------------------------------------------------------------------------------------------
   // Get Darcy Conductivity kernel for LHS Jacobian
   PetscPointJac getKernelJf3pp(const spatialdata::geocoords::CoordSys* coordsys) const;
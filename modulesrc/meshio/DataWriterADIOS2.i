@@ -0,0 +1,109 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/DataWriterADIOS2.i
+ *
+ * @brief Python interface to C++ DataWriterADIOS2 object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::DataWriterADIOS2 : public DataWriter {
+            // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            DataWriterADIOS2(void);
+
+            /// Destructor
+            ~DataWriterADIOS2(void);
+
+            /** Make copy of this object.
+             *
+             * @returns Copy of this.
+             */
+            DataWriter* clone(void) const;
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set filename (BP engines) or stream name (SST engine).
+             *
+             * @param filename Name of ADIOS2 file or stream.
+             */
+            void filename(const char* filename);
+
+            /** Set ADIOS2 engine.
+             *
+             * @param value Name of ADIOS2 engine ("BP5", "BP4", or "SST").
+             */
+            void setEngine(const char* value);
+
+            /** Set parameter of ADIOS2 engine.
+             *
+             * @param key Name of parameter.
+             * @param value Value of parameter.
+             */
+            void setEngineParameter(const char* key,
+                                    const char* value);
+
+            /** Prepare for writing files.
+             *
+             * @param mesh Finite-element mesh.
+             * @param isInfo True if only writing info values.
+             */
+            void open(const pylith::topology::Mesh& mesh,
+                      const bool isInfo);
+
+            /// Close output files.
+            void close(void);
+
+            /** Prepare file for data at a new time step.
+             *
+             * @param t Time stamp for new data
+             * @param mesh Finite-element mesh.
+             */
+            void openTimeStep(const PylithScalar t,
+                              const pylith::topology::Mesh& mesh);
+
+            /// Cleanup after writing data for a time step.
+            void closeTimeStep(void);
+
+            /** Write field over vertices to file.
+             *
+             * @param[in] t Time associated with field.
+             * @param[in] subfield Subfield with basis order 1.
+             */
+            void writeVertexField(const PylithScalar t,
+                                  const pylith::meshio::OutputSubfield& field);
+
+            /** Write field over cells to file.
+             *
+             * @param[in] t Time associated with field.
+             * @param[in] subfield Subfield with basis order 0.
+             */
+            void writeCellField(const PylithScalar t,
+                                const pylith::meshio::OutputSubfield& subfield);
+
+        }; // DataWriterADIOS2
+
+    } // meshio
+} // pylith
+
+// End of file
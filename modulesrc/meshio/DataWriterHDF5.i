@@ -25,6 +25,16 @@
 namespace pylith {
     namespace meshio {
         class pylith::meshio::DataWriterHDF5 : public DataWriter {
+            // PUBLIC ENUM /////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            enum CompressionEnum {
+                COMPRESSION_NONE, // No compression.
+                COMPRESSION_DEFLATE, // Deflate (gzip) compression.
+                COMPRESSION_ZSTD, // Zstandard compression (requires HDF5 filter plugin).
+                COMPRESSION_SZIP, // Szip compression.
+            }; // CompressionEnum
+
             // PUBLIC METHODS /////////////////////////////////////////////////
 public:
 
@@ -49,6 +59,43 @@ public:
              */
             void filename(const char* filename);
 
+            /** Set flag for using collective MPI-IO when writing datasets.
+             *
+             * @param[in] value True if using collective MPI-IO, false otherwise.
+             */
+            void useCollectiveIO(const bool value);
+
+            /** Set compression filter for field datasets.
+             *
+             * @param[in] value Compression filter.
+             * @param[in] level Compression level (deflate: 1-9, zstd: 1-22, szip: pixels per block).
+             */
+            void setCompression(const CompressionEnum value,
+                                const int level);
+
+            /** Set shape of chunks for field datasets.
+             *
+             * @param[in] numTimeSteps Number of time steps in a chunk.
+             * @param[in] numPoints Number of points in a chunk (0 means all points).
+             */
+            void setChunkShape(const size_t numTimeSteps,
+                               const size_t numPoints);
+
+            /** Set number of bits retained in the mantissa of floating point values.
+             *
+             * @param[in] value Number of bits retained in the mantissa (0 means retain all bits).
+             */
+            void setMantissaBits(const int value);
+
+            /** Set flag for writing the mesh topology and geometry once to a shared HDF5 file.
+             *
+             * The first writer opened for a mesh writes the topology and geometry to `<filename>_mesh.h5`; files of all
+             * writers for the same mesh reference these datasets via HDF5 external links.
+             *
+             * @param[in] value True if using shared mesh file, false if writing mesh to each file.
+             */
+            void setSharedMesh(const bool value);
+
             /** Generate filename for HDF5 file.
              *
              * Appends _info if only writing parameters.
@@ -49,6 +49,54 @@ public:
              */
             void filename(const char* filename);
 
+            /** Set number of processes that aggregate their data onto a single writer process.
+             *
+             * @param[in] value Number of processes per writer process (0 means write through process 0 using PETSc).
+             */
+            void setAggregationRatio(const int value);
+
+            /** Get number of processes that aggregate their data onto a single writer process.
+             *
+             * @returns Number of processes per writer process (0 means write through process 0 using PETSc).
+             */
+            int getAggregationRatio(void) const;
+
+            /** Set number of time steps preallocated in external datasets.
+             *
+             * @param[in] value Number of time steps in each preallocated block (0 means extend datasets every time step).
+             */
+            void setNumStepsPreallocated(const int value);
+
+            /** Get number of time steps preallocated in external datasets.
+             *
+             * @returns Number of time steps in each preallocated block (0 means extend datasets every time step).
+             */
+            int getNumStepsPreallocated(void) const;
+
+            /** Set node-local directory for staging external datasets.
+             *
+             * @param[in] value Name of staging directory (empty means write directly to external files).
+             */
+            void setStagingDir(const char* value);
+
+            /** Get node-local directory for staging external datasets.
+             *
+             * @returns Name of staging directory (empty means write directly to external files).
+             */
+            const char* getStagingDir(void) const;
+
+            /** Set flag for writing external datasets using nonblocking MPI-IO from double buffers.
+             *
+             * @param[in] value True if writes of external datasets should overlap with the computation.
+             */
+            void setUseAsyncWrites(const bool value);
+
+            /** Get flag for writing external datasets using nonblocking MPI-IO from double buffers.
+             *
+             * @returns True if writes of external datasets overlap with the computation.
+             */
+            bool getUseAsyncWrites(void) const;
+
             /** Generate filename for HDF5 file.
              *
              * Appends _info if only writing parameters.
@@ -0,0 +1,98 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/DataWriterHDF5GreensFns.i
+ *
+ * @brief Python interface to C++ DataWriterHDF5GreensFns object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::DataWriterHDF5GreensFns : public DataWriterHDF5 {
+            // PUBLIC METHODS /////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            DataWriterHDF5GreensFns(void);
+
+            /// Destructor
+            ~DataWriterHDF5GreensFns(void);
+
+            /** Make copy of this object.
+             *
+             * @returns Copy of this.
+             */
+            DataWriter* clone(void) const;
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set number of impulses buffered in memory before writing them as a block.
+             *
+             * @param[in] value Number of impulses in each block.
+             */
+            void setBlockSize(const size_t value);
+
+            /** Get number of impulses buffered in memory before writing them as a block.
+             *
+             * @returns Number of impulses in each block.
+             */
+            size_t getBlockSize(void) const;
+
+            /** Open output file.
+             *
+             * @param mesh Finite-element mesh.
+             * @param isInfo True if only writing info values.
+             */
+            void open(const pylith::topology::Mesh& mesh,
+                      const bool isInfo);
+
+            /// Close output files.
+            void close(void);
+
+            /** Prepare file for data at a new impulse.
+             *
+             * @param[in] t Time stamp (impulse index) for new data.
+             * @param[in] mesh PETSc mesh object.
+             */
+            void openTimeStep(const PylithScalar t,
+                              const pylith::topology::Mesh& mesh);
+
+            /** Write field over vertices to file.
+             *
+             * @param[in] t Time associated with field.
+             * @param[in] subfield Subfield with basis order 1.
+             */
+            void writeVertexField(const PylithScalar t,
+                                  const pylith::meshio::OutputSubfield& subfield);
+
+            /** Write field over cells to file.
+             *
+             * @param[in] t Time associated with field.
+             * @param[in] subfield Subfield with basis order 0.
+             */
+            void writeCellField(const PylithScalar t,
+                                const pylith::meshio::OutputSubfield& subfield);
+
+        }; // DataWriterHDF5GreensFns
+
+    } // meshio
+} // pylith
+
+// End of file
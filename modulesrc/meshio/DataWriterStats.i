@@ -0,0 +1,99 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/DataWriterStats.i
+ *
+ * @brief Python interface to C++ DataWriterStats object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::DataWriterStats : public DataWriter {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            DataWriterStats(void);
+
+            /// Destructor
+            ~DataWriterStats(void);
+
+            /** Make copy of this object.
+             *
+             * @returns Copy of this.
+             */
+            DataWriter* clone(void) const;
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set filename for ASCII file.
+             *
+             * @param[in] filename Name of file.
+             */
+            void setFilename(const char* filename);
+
+            /** Get filename for ASCII file.
+             *
+             * @returns Name of file.
+             */
+            const char* getFilename(void) const;
+
+            /** Set precision of floating point values in output.
+             *
+             * @param[in] value Precision for floating point values.
+             */
+            void setPrecision(const int value);
+
+            /** Open output file.
+             *
+             * @param[in] mesh Finite-element mesh.
+             * @param[in] isInfo True if only writing info values.
+             */
+            void open(const pylith::topology::Mesh& mesh,
+                      const bool isInfo);
+
+            /// Close output file.
+            void close(void);
+
+            /// Cleanup after writing data for a time step.
+            void closeTimeStep(void);
+
+            /** Write statistics of field over vertices to file.
+             *
+             * @param[in] t Time associated with field.
+             * @param[in] subfield Subfield with basis order 1.
+             */
+            void writeVertexField(const PylithScalar t,
+                                  const pylith::meshio::OutputSubfield& subfield);
+
+            /** Write statistics of field over cells to file.
+             *
+             * @param[in] t Time associated with field.
+             * @param[in] subfield Subfield with basis order 0.
+             */
+            void writeCellField(const PylithScalar t,
+                                const pylith::meshio::OutputSubfield& subfield);
+
+        }; // DataWriterStats
+
+    } // meshio
+} // pylith
+
+// End of file
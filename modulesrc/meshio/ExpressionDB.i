@@ -0,0 +1,96 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/ExpressionDB.i
+ *
+ * @brief Python interface to C++ ExpressionDB object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::ExpressionDB : public spatialdata::spatialdb::SpatialDB {
+            // PUBLIC METHODS /////////////////////////////////////////////
+public:
+
+            /// Constructor
+            ExpressionDB(void);
+
+            /// Destructor
+            ~ExpressionDB(void);
+
+            /** Set names of values in database.
+             *
+             * @param[in] names Array of names of values.
+             * @param[in] numNames Number of values.
+             */
+            %apply(const char* const* string_list, const int list_len) {
+                (const char* const* names,
+                 const int numNames)
+            };
+            void setValueNames(const char* const* names,
+                               const int numNames);
+
+            %clear(const char* const* names, const int numNames);
+
+            /** Set expressions for values in database.
+             *
+             * @param[in] expressions Array of expressions, one for each value.
+             * @param[in] numExpressions Number of expressions.
+             */
+            %apply(const char* const* string_list, const int list_len) {
+                (const char* const* expressions,
+                 const int numExpressions)
+            };
+            void setExpressions(const char* const* expressions,
+                                const int numExpressions);
+
+            %clear(const char* const* expressions, const int numExpressions);
+
+            /** Set units of values in database.
+             *
+             * @param[in] units Array of units, one for each value.
+             * @param[in] numUnits Number of units.
+             */
+            %apply(const char* const* string_list, const int list_len) {
+                (const char* const* units,
+                 const int numUnits)
+            };
+            void setUnits(const char* const* units,
+                          const int numUnits);
+
+            %clear(const char* const* units, const int numUnits);
+
+            /** Set coordinate system associated with the coordinates in the expressions.
+             *
+             * @param[in] cs Coordinate system.
+             */
+            void setCoordSys(const spatialdata::geocoords::CoordSys& cs);
+
+            /// Open the database and prepare for querying.
+            void open(void);
+
+            /// Close the database.
+            void close(void);
+
+        }; // ExpressionDB
+
+    } // meshio
+} // pylith
+
+// End of file
@@ -0,0 +1,88 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/GriddedHDF5DB.i
+ *
+ * @brief Python interface to C++ GriddedHDF5DB object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::GriddedHDF5DB : public spatialdata::spatialdb::SpatialDB {
+            // PUBLIC ENUMS ///////////////////////////////////////////////
+public:
+
+            enum QueryEnum {
+                NEAREST=0, ///< Nearest grid point.
+                LINEAR=1, ///< Linear interpolation.
+            };
+
+            // PUBLIC METHODS /////////////////////////////////////////////
+public:
+
+            /// Constructor
+            GriddedHDF5DB(void);
+
+            /// Destructor
+            ~GriddedHDF5DB(void);
+
+            /** Set filename containing data.
+             *
+             * @param[in] value Name of HDF5 file.
+             */
+            void setFilename(const char* value);
+
+            /** Set query type.
+             *
+             * @param[in] value Query type.
+             */
+            void setQueryType(const QueryEnum value);
+
+            /** Set number of grid cells along each axis in blocks read from the file.
+             *
+             * @param[in] value Number of grid cells along each axis.
+             */
+            void setBlockSize(const int value);
+
+            /** Set flag for reading values for the entire grid into memory shared by the processes on each compute node.
+             *
+             * The block size is ignored when shared memory is used.
+             *
+             * @param[in] value True if values are stored in shared memory, false otherwise.
+             */
+            void setSharedMemory(const bool value);
+
+            /** Set coordinate system associated with grid coordinates.
+             *
+             * @param[in] cs Coordinate system.
+             */
+            void setCoordSys(const spatialdata::geocoords::CoordSys& cs);
+
+            /// Open the database and prepare for querying.
+            void open(void);
+
+            /// Close the database.
+            void close(void);
+
+        }; // GriddedHDF5DB
+
+    } // meshio
+} // pylith
+
+// End of file
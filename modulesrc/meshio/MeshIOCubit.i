@@ -56,6 +56,12 @@ public:
              */
             void setUseNodesetNames(const bool flag);
 
+            /** Set flag on whether to read mesh in parallel.
+             *
+             * @param flag True to read contiguous chunks of the vertices and cells on each process.
+             */
+            void setUseParallelRead(const bool flag);
+
             // PROTECTED METHODS ////////////////////////////////////////////////////
 protected:
 
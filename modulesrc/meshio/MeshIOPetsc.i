@@ -26,6 +26,14 @@ namespace pylith {
     namespace meshio {
         class MeshIOPetsc: public MeshIO
         { // MeshIOPetsc
+          // PUBLIC ENUMS ///////////////////////////////////////////////////
+public:
+
+            enum HDF5LayoutEnum {
+                HDF5_PETSC, ///< PETSc DMPlex HDF5 storage layout (written by PyLith).
+                HDF5_XDMF, ///< Legacy PETSc DMPlex HDF5 layout with XDMF-compatible topology and geometry.
+            }; // HDF5LayoutEnum
+
           // PUBLIC METHODS /////////////////////////////////////////////////
 public:
 
@@ -62,6 +70,30 @@ public:
              */
             const char* getPrefix(void) const;
 
+            /** Set layout of PETSc DMPlex HDF5 file.
+             *
+             * @param value Layout of HDF5 file.
+             */
+            void setHDF5Layout(const HDF5LayoutEnum value);
+
+            /** Get layout of PETSc DMPlex HDF5 file.
+             *
+             * @returns Layout of HDF5 file.
+             */
+            HDF5LayoutEnum getHDF5Layout(void) const;
+
+            /** Convert labels in PETSc DMPlex HDF5 file from Gmsh conventions to PyLith conventions.
+             *
+             * @param value True if labels follow Gmsh conventions, false otherwise.
+             */
+            void setFixGmshLabels(const bool value);
+
+            /** Convert labels in PETSc DMPlex HDF5 file from Gmsh conventions to PyLith conventions?
+             *
+             * @returns True if labels follow Gmsh conventions, false otherwise.
+             */
+            bool getFixGmshLabels(void) const;
+
             // PROTECTED METHODS //////////////////////////////////////////////
 protected:
 
@@ -0,0 +1,92 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+
+/**
+ * @file modulesrc/meshio/OutputPhysicsCoulombStress.i
+ *
+ * @brief Python interface to C++ OutputPhysicsCoulombStress object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class OutputPhysicsCoulombStress : public pylith::meshio::OutputPhysicsPoints {
+            // PUBLIC METHODS ///////////////////////////////////////////////
+public:
+
+            /// Constructor
+            OutputPhysicsCoulombStress(void);
+
+            /// Destructor
+            virtual ~OutputPhysicsCoulombStress(void);
+
+            /// Deallocate PETSc and local data structures.
+            virtual
+            void deallocate(void);
+
+            /** Set orientation and effective coefficient of friction of receiver faults at points.
+             *
+             * The values at each point are the strike, dip, and rake (radians) followed by the effective coefficient
+             * of friction. The points are in the same order as in setPoints().
+             *
+             * @param[in] values Array of receiver values [numPoints * numValues].
+             * @param[in] numPoints Number of points.
+             * @param[in] numValues Number of values at each point (must be 4).
+             */
+            %apply(double* IN_ARRAY2, int DIM1, int DIM2) {
+	            (const PylithReal* values,
+	            const int numPoints,
+	            const int numValues)
+	        };
+            void setReceivers(const PylithReal* values,
+                              const int numPoints,
+                              const int numValues);
+            %clear(const PylithReal* values, const int numPoints, const int numValues);
+
+            /** Verify configuration.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Check whether observer needs update at time t.
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @returns True if observer needs the derived field at time t, false otherwise.
+             */
+            bool needsUpdate(const PylithReal t,
+                             const PylithInt tindex) const;
+
+            /** Receive update (subject of observer).
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             * @param[in] infoOnly Flag is true if this update is before solution is available (e.g., after
+             * initialization).
+             */
+            void update(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution,
+                        const bool infoOnly);
+
+        }; // OutputPhysicsCoulombStress
+
+    } // meshio
+} // pylith
+
+// End of file
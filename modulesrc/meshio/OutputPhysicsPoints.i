@@ -0,0 +1,97 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/OutputPhysicsPoints.i
+ *
+ * @brief Python interface to C++ OutputPhysicsPoints object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class OutputPhysicsPoints : public pylith::meshio::OutputPhysics {
+            // PUBLIC METHODS ///////////////////////////////////////////////
+public:
+
+            /// Constructor
+            OutputPhysicsPoints(void);
+
+            /// Destructor
+            virtual ~OutputPhysicsPoints(void);
+
+            /// Deallocate PETSc and local data structures.
+            virtual
+            void deallocate(void);
+
+            /** Set coordinates and names of points.
+             *
+             * @param[in] points Array of coordinates [numPoints * spaceDim].
+             * @param[in] numPoints Number of points.
+             * @param[in] spaceDim Spatial dimension for coordinates.
+             * @param[in] pointNames Array with point names.
+             * @param[in] numPointNames Number of point banes.
+             */
+            %apply(double* IN_ARRAY2, int DIM1, int DIM2) {
+	            (const PylithReal* pointCoords,
+	            const int numPoints,
+	            const int spaceDim)
+	        };
+            %apply(const char* const* string_list, const int list_len){
+	            (const char* const* pointNames, const int numPointNames)
+	        };
+            void setPoints(const PylithReal* pointCoords,
+                           const int numPoints,
+                           const int spaceDim,
+                           const char* const* pointNames,
+                           const int numPointNames);
+            %clear(const PylithReal* pointCoords, const int numPoints, const int spaceDim);
+            %clear(const char* const* pointNames, const int numPointNames);
+
+            /** Use sparse interpolation matrix for output of the requested subfields.
+             *
+             * @param[in] value True if using interpolation matrix, false if using DMInterpolationEvaluate().
+             */
+            void useInterpolationMatrix(const bool value);
+
+            /** Verify configuration.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Receive update (subject of observer).
+             *
+             * There is no info output at points, so updates before the solution is available are ignored.
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             * @param[in] infoOnly Flag is true if this update is before solution is available (e.g., after
+             * initialization).
+             */
+            void update(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution,
+                        const bool infoOnly);
+
+        }; // OutputPhysicsPoints
+
+    } // meshio
+} // pylith
+
+// End of file
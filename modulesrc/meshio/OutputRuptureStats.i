@@ -0,0 +1,102 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/OutputRuptureStats.i
+ *
+ * @brief Python interface to C++ OutputRuptureStats object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::OutputRuptureStats :
+            public pylith::problems::ObserverPhysics,
+            public pylith::utils::PyreComponent {
+            // PUBLIC METHODS ///////////////////////////////////////////////
+public:
+
+            /// Constructor
+            OutputRuptureStats(void);
+
+            /// Destructor
+            virtual ~OutputRuptureStats(void);
+
+            /// Deallocate PETSc and local data structures.
+            virtual
+            void deallocate(void);
+
+            /** Set output trigger for how often to compute the statistics.
+             *
+             * @param[in] trigger Output trigger.
+             */
+            void setTrigger(pylith::meshio::OutputTrigger* const trigger);
+
+            /** Set spatial database with density and shear wave speed.
+             *
+             * @param[in] db Spatial database with elastic properties.
+             */
+            void setPropertiesDB(spatialdata::spatialdb::SpatialDB* db);
+
+            /** Set name of fault used for the variable in the output file.
+             *
+             * @param[in] value Name of fault.
+             */
+            void setFaultName(const char* value);
+
+            /** Set filename for output.
+             *
+             * @param[in] value Name of output file.
+             */
+            void setFilename(const char* value);
+
+            /** Get filename for output.
+             *
+             * @returns Name of output file.
+             */
+            const char* getFilename(void) const;
+
+            /** Set time scale.
+             *
+             * @param[in] value Time scale for dimensionalizing time.
+             */
+            void setTimeScale(const PylithReal value);
+
+            /** Verify configuration.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Receive update (subject of observer).
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             * @param[in] infoOnly Flag is true if this update is before solution is available (e.g., after initialization).
+             */
+            void update(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution,
+                        const bool infoOnly);
+
+        }; // OutputRuptureStats
+
+    } // meshio
+} // pylith
+
+// End of file
@@ -0,0 +1,82 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/OutputSolnLineOfSight.i
+ *
+ * @brief Python interface to C++ OutputSolnLineOfSight object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class OutputSolnLineOfSight : public pylith::meshio::OutputSolnPoints {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor.
+            OutputSolnLineOfSight(void);
+
+            /// Destructor
+            virtual ~OutputSolnLineOfSight(void);
+
+            /** Set line-of-sight directions and names of satellite tracks.
+             *
+             * Each direction is a vector in the mesh coordinate system pointing from the ground to the satellite; it is
+             * normalized to a unit vector.
+             *
+             * @param[in] directions Array of line-of-sight directions [numTracks * spaceDim].
+             * @param[in] numTracks Number of satellite tracks.
+             * @param[in] spaceDim Spatial dimension for directions.
+             * @param[in] trackNames Array with names of satellite tracks.
+             * @param[in] numTrackNames Number of names of satellite tracks.
+             */
+            %apply(double* IN_ARRAY2, int DIM1, int DIM2) {
+	            (const PylithReal* directions,
+	            const int numTracks,
+	            const int spaceDim)
+	        };
+            %apply(const char* const* string_list, const int list_len){
+	            (const char* const* trackNames, const int numTrackNames)
+	        };
+            void setLineOfSight(const PylithReal* directions,
+                                const int numTracks,
+                                const int spaceDim,
+                                const char* const* trackNames,
+                                const int numTrackNames);
+            %clear(const PylithReal* directions, const int numTracks, const int spaceDim);
+            %clear(const char* const* trackNames, const int numTrackNames);
+
+            // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+            /** Write solution at time step.
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             */
+            void _writeSolnStep(const PylithReal t,
+                                const PylithInt tindex,
+                                const pylith::topology::Field& solution);
+
+        }; // OutputSolnLineOfSight
+
+    } // meshio
+} // pylith
+
+// End of file
@@ -58,6 +58,15 @@ public:
             %clear(const PylithReal* pointCoords, const int numPoints, const int spaceDim);
             %clear(const char* const* pointNames, const int numPointNames);
 
+            /** Use sparse interpolation matrix for output of the requested subfields.
+             *
+             * The basis functions are tabulated at the points once, so interpolation at each output step is a single
+             * sparse matrix-vector product rather than a point-by-point evaluation of all solution subfields.
+             *
+             * @param[in] value True if using interpolation matrix, false if using DMInterpolationEvaluate().
+             */
+            void useInterpolationMatrix(const bool value);
+
             // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////
 protected:
 
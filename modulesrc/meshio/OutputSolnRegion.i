@@ -0,0 +1,96 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/OutputSolnRegion.i
+ *
+ * @brief Python interface to C++ OutputSolnRegion object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class OutputSolnRegion: public pylith::meshio::OutputSoln {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor.
+            OutputSolnRegion(void);
+
+            /// Destructor
+            virtual ~OutputSolnRegion(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set name of label identifier restricting cells in region.
+             *
+             * @param[in] value Name of label for cells (empty for all cells).
+             */
+            void setLabelName(const char* value);
+
+            /** Set value of label identifier restricting cells in region.
+             *
+             * @param[in] value Value of label for cells.
+             */
+            void setLabelValue(const int value);
+
+            /** Set bounding box of region.
+             *
+             * @param[in] bbox Array of bounds [xmin, xmax, ymin, ymax, (zmin, zmax)] (nondimensional).
+             * @param[in] size Size of array (0 for no bounding box).
+             */
+            %apply(double* IN_ARRAY1, int DIM1) {
+                (const PylithReal* bbox,
+                 const int size)
+            };
+            void setBoundingBox(const PylithReal* bbox,
+                                const int size);
+
+            %clear(const PylithReal* bbox, const int size);
+
+            /** Set decimation of cells in region.
+             *
+             * @param[in] value Keep every k-th cell in region (1 for all cells).
+             */
+            void setDecimation(const int value);
+
+            /** Verify configuration.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+            /** Write solution at time step.
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             */
+            void _writeSolnStep(const PylithReal t,
+                                const PylithInt tindex,
+                                const pylith::topology::Field& solution);
+
+        }; // OutputSolnRegion
+
+    } // meshio
+} // pylith
+
+// End of file
@@ -0,0 +1,80 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/OutputTriggerChange.i
+ *
+ * @brief Python interface to C++ OutputTriggerChange object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::OutputTriggerChange : public pylith::meshio::OutputTrigger {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            OutputTriggerChange(void);
+
+            /// Destructor
+            ~OutputTriggerChange(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Check whether we want to write output at time t.
+             *
+             * Without the solution we cannot measure the change, so we always write.
+             *
+             * @param[in] t Time of proposed write.
+             * @param[in] tindex Inxex of current time step.
+             * @returns True.
+             */
+            bool shouldWrite(const PylithReal t,
+                             const PylithInt tindex);
+
+            /** Set relative change in solution that triggers a write.
+             *
+             * @param[in] value Relative change in L2 norm.
+             */
+            void setTolerance(const double value);
+
+            /** Get relative change in solution that triggers a write.
+             *
+             * @returns Relative change in L2 norm.
+             */
+            double getTolerance(void) const;
+
+            /** Set name of subfield to monitor.
+             *
+             * @param[in] value Name of subfield (empty for entire solution).
+             */
+            void setSubfield(const char* value);
+
+            /** Get name of subfield to monitor.
+             *
+             * @returns Name of subfield (empty for entire solution).
+             */
+            const char* getSubfield(void) const;
+
+        }; // OutputTriggerChange
+
+    } // meshio
+} // pylith
+
+// End of file
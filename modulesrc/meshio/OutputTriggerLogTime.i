@@ -0,0 +1,75 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/OutputTriggerLogTime.i
+ *
+ * @brief Python interface to C++ OutputTriggerLogTime object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::OutputTriggerLogTime : public pylith::meshio::OutputTrigger {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            OutputTriggerLogTime(void);
+
+            /// Destructor
+            ~OutputTriggerLogTime(void);
+
+            /** Check whether we want to write output at time t.
+             *
+             * @param[in] t Time of proposed write.
+             * @param[in] tindex Inxex of current time step.
+             * @returns True if output should be written at time t, false otherwise.
+             */
+            bool shouldWrite(const PylithReal t,
+                             const PylithInt tindex);
+
+            /** Set elapsed time of first write after initial write.
+             *
+             * @param[in] Elapsed time since first time step.
+             */
+            void setTimeFirst(const double value);
+
+            /** Get elapsed time of first write after initial write.
+             *
+             * @returns Elapsed time since first time step.
+             */
+            double getTimeFirst(void) const;
+
+            /** Set ratio of successive elapsed times between writes.
+             *
+             * @param[in] Ratio of successive elapsed times (greater than 1).
+             */
+            void setRatio(const double value);
+
+            /** Get ratio of successive elapsed times between writes.
+             *
+             * @returns Ratio of successive elapsed times.
+             */
+            double getRatio(void) const;
+
+        }; // OutputTriggerLogTime
+
+    } // meshio
+} // pylith
+
+// End of file
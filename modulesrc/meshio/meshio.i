@@ -31,18 +31,33 @@
 #include "pylith/meshio/OutputTrigger.hh"
 #include "pylith/meshio/OutputTriggerStep.hh"
 #include "pylith/meshio/OutputTriggerTime.hh"
+#include "pylith/meshio/OutputTriggerLogTime.hh"
+#include "pylith/meshio/OutputTriggerChange.hh"
 #include "pylith/meshio/DataWriter.hh"
 #include "pylith/meshio/DataWriterVTK.hh"
+#include "pylith/meshio/DataWriterPVTU.hh"
+#if defined(ENABLE_ADIOS2)
+#include "pylith/meshio/DataWriterADIOS2.hh"
+#endif
+#include "pylith/meshio/ExpressionDB.hh"
 #if defined(ENABLE_HDF5)
 #include "pylith/meshio/DataWriterHDF5.hh"
 #include "pylith/meshio/DataWriterHDF5Ext.hh"
+#include "pylith/meshio/DataWriterHDF5GreensFns.hh"
+#include "pylith/meshio/DataWriterStats.hh"
+#include "pylith/meshio/GriddedHDF5DB.hh"
 #endif
 #include "pylith/meshio/OutputObserver.hh"
 #include "pylith/meshio/OutputSoln.hh"
 #include "pylith/meshio/OutputSolnDomain.hh"
 #include "pylith/meshio/OutputSolnBoundary.hh"
+#include "pylith/meshio/OutputSolnRegion.hh"
 #include "pylith/meshio/OutputSolnPoints.hh"
+#include "pylith/meshio/OutputSolnLineOfSight.hh"
 #include "pylith/meshio/OutputPhysics.hh"
+#include "pylith/meshio/OutputPhysicsPoints.hh"
+#include "pylith/meshio/OutputPhysicsCoulombStress.hh"
+#include "pylith/meshio/OutputRuptureStats.hh"
 
 #include "pylith/utils/arrayfwd.hh"
 %}
@@ -71,6 +86,7 @@ import_array();
 %}
 
 // Interfaces
+%import "../include/spatialdb.i"
 %include "../utils/PyreComponent.i"
 %include "../problems/ObserverSoln.i"
 %include "../problems/ObserverPhysics.i"
@@ -84,18 +100,33 @@ import_array();
 %include "OutputTrigger.i"
 %include "OutputTriggerStep.i"
 %include "OutputTriggerTime.i"
+%include "OutputTriggerLogTime.i"
+%include "OutputTriggerChange.i"
 %include "DataWriter.i"
 %include "DataWriterVTK.i"
+%include "DataWriterPVTU.i"
+#if defined(ENABLE_ADIOS2)
+%include "DataWriterADIOS2.i"
+#endif
+%include "ExpressionDB.i"
 #if defined(ENABLE_HDF5)
 %include "DataWriterHDF5.i"
 %include "DataWriterHDF5Ext.i"
+%include "DataWriterHDF5GreensFns.i"
+%include "DataWriterStats.i"
+%include "GriddedHDF5DB.i"
 #endif
 %include "OutputObserver.i"
 %include "OutputSoln.i"
 %include "OutputSolnDomain.i"
 %include "OutputSolnBoundary.i"
+%include "OutputSolnRegion.i"
 %include "OutputSolnPoints.i"
+%include "OutputSolnLineOfSight.i"
 %include "OutputPhysics.i"
+%include "OutputPhysicsPoints.i"
+%include "OutputPhysicsCoulombStress.i"
+%include "OutputRuptureStats.i"
 
 
 // End of file
@@ -0,0 +1,40 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+// ----------------------------------------------------------------------
+// Broadcast string from root process.
+
+%inline %{
+  std::string
+    bcast_string(const std::string& value,
+		 int root,
+		 MPI_Comm* comm) {
+    int rank = 0;
+    MPI_Comm_rank(*comm, &rank);
+    int length = (rank == root) ? int(value.length()) : 0;
+    MPI_Bcast(&length, 1, MPI_INT, root, *comm);
+    std::string result = (rank == root) ? value : std::string(length, ' ');
+    if (length > 0) {
+      MPI_Bcast(&result[0], length, MPI_CHAR, root, *comm);
+    } // if
+    return result;
+  } // bcast_string
+%}
+
+
+// End of file
@@ -63,6 +63,34 @@
 
 // ----------------------------------------------------------------------
 // rank()
+%inline %{
+  bool
+  mpi_initialized(void) {
+    int flag = 0;
+    MPI_Initialized(&flag);
+    return flag ? true : false;
+  } // mpi_initialized
+%}
+
+%inline %{
+  MPI_Comm*
+  mpi_comm_split(MPI_Comm* comm,
+                 int color,
+                 int key) {
+    MPI_Comm* newcomm = new MPI_Comm(MPI_COMM_NULL);
+    MPI_Comm_split(*comm, color, key, newcomm);
+    return newcomm;
+  } // mpi_comm_split
+%}
+
+%inline %{
+  void
+  petsc_set_comm_world(MPI_Comm* comm) {
+    // Must be called before PetscInitialize().
+    PETSC_COMM_WORLD = *comm;
+  } // petsc_set_comm_world
+%}
+
 %inline %{
   int
   rank(MPI_Comm* comm) {
@@ -0,0 +1,119 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/problems/CouplerBoundary.i
+ *
+ * @brief Python interface to C++ CouplerBoundary object.
+ */
+
+namespace pylith {
+    namespace problems {
+        class CouplerBoundary :
+            public pylith::problems::ObserverSoln,
+            public pylith::utils::PyreComponent {
+            // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+            /// Constructor.
+            CouplerBoundary(void);
+
+            /// Destructor
+            ~CouplerBoundary(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set problem with boundary condition receiving values.
+             *
+             * @param[in] problem Problem.
+             */
+            void setProblem(const pylith::problems::Problem* problem);
+
+            /** Set name of label identifying boundary for values sent to external code.
+             *
+             * @param[in] value Name of label.
+             */
+            void setLabelName(const char* value);
+
+            /** Set value of label identifying boundary for values sent to external code.
+             *
+             * @param[in] value Value of label.
+             */
+            void setLabelValue(const int value);
+
+            /** Set names of solution subfields sent to external code.
+             *
+             * @param[in] names Array of names of solution subfields.
+             * @param[in] numNames Length of array.
+             */
+            %apply(const char* const* string_list, const int list_len) {
+                (const char* names[],
+                 const int numNames)
+            };
+            void setSendSubfields(const char* names[],
+                                  const int numNames);
+
+            %clear(const char* names[], const int numNames);
+
+            /** Set boundary condition and subfield of its auxiliary field receiving values from external code.
+             *
+             * @param[in] identifier Identifier of boundary condition.
+             * @param[in] subfieldName Name of auxiliary subfield.
+             */
+            void setReceiveSubfield(const char* identifier,
+                                    const char* subfieldName);
+
+            /** Set name of MPI port for connecting to external code.
+             *
+             * The intercommunicator is created with MPI_Comm_connect() when the values are exchanged the first time.
+             * The external code must have the same number of processes; rank i of PyLith exchanges values with rank i
+             * of the external code.
+             *
+             * @param[in] value Name of MPI port (empty if not using an intercommunicator).
+             */
+            void setPortName(const char* value);
+
+            /** Set time scale.
+             *
+             * @param[in] value Time scale for dimensionalizing time.
+             */
+            void setTimeScale(const PylithReal value);
+
+            /** Verify observer is compatible with solution.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Receive update (subject of observer).
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             */
+            void update(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution);
+
+        }; // CouplerBoundary
+
+    } // problems
+} // pylith
+
+// End of file
@@ -62,6 +62,149 @@ public:
              */
             int getFaultLabelValue(void) const;
 
+            /** Set number of impulses solved together as a block of right-hand sides.
+             *
+             * A batch size of 1 solves each impulse separately using SNESSolve(). A batch size greater than 1 solves the
+             * impulses in blocks using KSPMatSolve() with the Jacobian formed once for all impulses.
+             *
+             * @param[in] value Number of impulses in each block.
+             */
+            void setImpulseBatchSize(const size_t value);
+
+            /** Get number of impulses solved together as a block of right-hand sides.
+             *
+             * @returns Number of impulses in each block.
+             */
+            size_t getImpulseBatchSize(void) const;
+
+            /** Set number of process groups solving impulses concurrently.
+             *
+             * Each group holds a copy of the assembled operator on a sub-communicator and solves the impulses assigned to it
+             * round-robin. A value of 1 uses all processes for every impulse.
+             *
+             * @param[in] value Number of process groups.
+             */
+            void setNumImpulseGroups(const size_t value);
+
+            /** Get number of process groups solving impulses concurrently.
+             *
+             * @returns Number of process groups.
+             */
+            size_t getNumImpulseGroups(void) const;
+
+            /** Set number of previous impulse solutions retained in the initial guess basis.
+             *
+             * Responses to nearby impulses are similar, so a larger proper orthogonal decomposition (POD) basis built from
+             * earlier solutions reduces the number of Krylov iterations. Used only when the INITIAL_GUESS PETSc defaults are
+             * turned on.
+             *
+             * @param[in] value Number of solutions in initial guess basis.
+             */
+            void setInitialGuessSize(const size_t value);
+
+            /** Get number of previous impulse solutions retained in the initial guess basis.
+             *
+             * @returns Number of solutions in initial guess basis.
+             */
+            size_t getInitialGuessSize(void) const;
+
+            /** Set number of previous impulse solutions in deflation space of preconditioner.
+             *
+             * Once the orthonormal basis of earlier impulse solutions reaches this size, the preconditioner is wrapped in a
+             * deflation preconditioner (PCDEFLATION) that removes the basis from the Krylov iterations of later impulses.
+             * Used when impulses are solved one at a time or in blocks.
+             *
+             * @param[in] value Number of solutions in deflation space (0=no deflation).
+             */
+            void setDeflationSize(const size_t value);
+
+            /** Get number of previous impulse solutions in deflation space of preconditioner.
+             *
+             * @returns Number of solutions in deflation space (0=no deflation).
+             */
+            size_t getDeflationSize(void) const;
+
+            /** Set flag for assembling right-hand side of each impulse over the cohesive cells in its support.
+             *
+             * The residual with no impulse is assembled once over all integrators. The right-hand side for each impulse adds
+             * the contribution of the cohesive cells with the impulse point in their closure, which is exact because the
+             * operator is linear. Used when impulses are solved in blocks or on groups of processes.
+             *
+             * @param[in] value True if right-hand side is localized, false otherwise.
+             */
+            void setLocalizedResidual(const bool value);
+
+            /** Get flag for assembling right-hand side of each impulse over the cohesive cells in its support.
+             *
+             * @returns True if right-hand side is localized, false otherwise.
+             */
+            bool getLocalizedResidual(void) const;
+
+            /** Add slip distribution for prediction with the surrogate model.
+             *
+             * When at least one slip distribution is given, the responses to the impulses are retained as the columns of a
+             * response matrix G, and after the impulses are solved the response to each slip distribution s is evaluated as
+             * G s without a finite-element solve. The predictions are passed to the observers following the impulses.
+             *
+             * @param[in] db Spatial database with slip distribution.
+             */
+            void addSurrogateSlip(spatialdata::spatialdb::SpatialDB* db);
+
+            /** Set rank of compressed response matrix for surrogate model.
+             *
+             * A rank of 0 retains the full response matrix. A positive rank compresses the response matrix using a
+             * randomized range finder, G ~ Q (Q^T G), with Q having the given number of orthonormal columns.
+             *
+             * @param[in] value Rank of compressed response matrix.
+             */
+            void setSurrogateRank(const size_t value);
+
+            /** Get rank of compressed response matrix for surrogate model.
+             *
+             * @returns Rank of compressed response matrix (0 = full response matrix).
+             */
+            size_t getSurrogateRank(void) const;
+
+            /** Set points for computing Green's functions using reciprocity.
+             *
+             * When points are given, the Green's functions of the displacement at the points are computed from one adjoint
+             * solve per displacement component at each point, so no forward solves are needed. The dense matrix G
+             * [numPoints*spaceDim, numImpulses] is written to a PETSc binary file.
+             *
+             * @param[in] pointCoords Array of nondimensional coordinates [numPoints * spaceDim].
+             * @param[in] numPoints Number of points.
+             * @param[in] spaceDim Spatial dimension for coordinates.
+             * @param[in] pointNames Array with point names.
+             * @param[in] numPointNames Number of point names.
+             */
+            %apply(double* IN_ARRAY2, int DIM1, int DIM2) {
+	            (const PylithReal* pointCoords,
+	            const int numPoints,
+	            const int spaceDim)
+	        };
+            %apply(const char* const* string_list, const int list_len){
+	            (const char* const* pointNames, const int numPointNames)
+	        };
+            void setReciprocalPoints(const PylithReal* pointCoords,
+                                     const int numPoints,
+                                     const int spaceDim,
+                                     const char* const* pointNames,
+                                     const int numPointNames);
+            %clear(const PylithReal* pointCoords, const int numPoints, const int spaceDim);
+            %clear(const char* const* pointNames, const int numPointNames);
+
+            /** Set name of PETSc binary file for Green's functions computed using reciprocity.
+             *
+             * @param[in] value Name of file.
+             */
+            void setReciprocalFilename(const char* value);
+
+            /** Get name of PETSc binary file for Green's functions computed using reciprocity.
+             *
+             * @returns Name of file.
+             */
+            const char* getReciprocalFilename(void) const;
+
             /** Set progress monitor.
              *
              * @param[in] monitor Progress monitor for Green's functions simulation.
@@ -0,0 +1,83 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/problems/InitialConditionFile.i
+ *
+ * @brief Python interface to C++ InitialConditionFile.
+ */
+
+namespace pylith {
+    namespace problems {
+        class InitialConditionFile : public pylith::problems::InitialCondition {
+            // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            InitialConditionFile(void);
+
+            /// Destructor
+            virtual ~InitialConditionFile(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set name of HDF5 file with solution.
+             *
+             * @param[in] value Name of HDF5 file written by DataWriterHDF5.
+             */
+            void setFilename(const char* value);
+
+            /** Get name of HDF5 file with solution.
+             *
+             * @returns Name of HDF5 file written by DataWriterHDF5.
+             */
+            const char* getFilename(void) const;
+
+            /** Set index of time step in file used for initial condition.
+             *
+             * @param[in] value Index of time step (negative values count from the last time step).
+             */
+            void setTimeStep(const int value);
+
+            /** Get index of time step in file used for initial condition.
+             *
+             * @returns Index of time step (negative values count from the last time step).
+             */
+            int getTimeStep(void) const;
+
+            /** Verify configuration is acceptable.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Set solution to values for initial condition.
+             *
+             * @param[out] solution Solution field.
+             * @param[in] normalizer Nondimensionalization.
+             */
+            void setValues(pylith::topology::Field* solution,
+                           const spatialdata::units::Nondimensional& normalizer);
+
+        }; // InitialConditionFile
+
+    } // problems
+} // pylith
+
+// End of file
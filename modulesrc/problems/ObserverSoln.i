@@ -45,6 +45,30 @@ public:
             virtual
             void setTimeScale(const PylithReal value) = 0;
 
+            /** Set name of load case observed in runs with multiple load cases.
+             *
+             * @param[in] value Name of load case (empty for first load case).
+             */
+            void setLoadCase(const char* value);
+
+            /** Get name of load case observed in runs with multiple load cases.
+             *
+             * @returns Name of load case (empty for first load case).
+             */
+            const char* getLoadCase(void) const;
+
+            /** Set flag for writing output at the next update regardless of the output trigger.
+             *
+             * @param[in] value True to write output regardless of output trigger, false otherwise.
+             */
+            void setForceOutput(const bool value);
+
+            /** Get flag for writing output at the next update regardless of the output trigger.
+             *
+             * @returns True if output is written regardless of output trigger, false otherwise.
+             */
+            bool getForceOutput(void) const;
+
             /** Verify observer is compatible with solution.
              *
              * @param[in] solution Solution field.
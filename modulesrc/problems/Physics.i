@@ -95,6 +95,14 @@ public:
              */
             void setAuxiliaryFieldDB(spatialdata::spatialdb::SpatialDB* const value);
 
+            /** Set file for caching values of auxiliary field.
+             *
+             * @param[in] filename Name of HDF5 file for cache (empty string disables cache).
+             * @param[in] dbKey Key identifying spatial database and its parameters.
+             */
+            void setAuxiliaryFieldCache(const char* filename,
+                                        const char* dbKey);
+
             /** Set discretization information for auxiliary subfield.
              *
              * @param[in] subfieldName Name of auxiliary subfield.
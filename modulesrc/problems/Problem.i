@@ -31,8 +31,24 @@ public:
             enum SolverTypeEnum {
                 LINEAR, // Linear solver.
                 NONLINEAR, // Nonlinear solver.
+                NONLINEAR_ANDERSON, // Nonlinear solver with Anderson acceleration of Newton iterations with lagged Jacobian.
+                NONLINEAR_QUASI_NEWTON, // Nonlinear solver with L-BFGS quasi-Newton method using lagged Jacobian.
             }; // SolverType
 
+            enum DeviceEnum {
+                DEVICE_NONE, // Vectors and matrices on host.
+                DEVICE_CUDA, // Vectors and matrices on CUDA device.
+                DEVICE_HIP, // Vectors and matrices on HIP device.
+                DEVICE_KOKKOS, // Vectors and matrices using Kokkos.
+            }; // DeviceEnum
+
+            enum JacobianStorageEnum {
+                JACOBIAN_AIJ, // Compressed sparse row storage of scalar entries.
+                JACOBIAN_BAIJ, // Compressed sparse row storage of dense blocks.
+                JACOBIAN_SBAIJ, // Compressed sparse row storage of dense blocks in upper triangle of symmetric matrix.
+                JACOBIAN_IS, // Unassembled storage of subdomain matrices for domain decomposition preconditioners (BDDC).
+            }; // JacobianStorageEnum
+
             // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -69,6 +85,36 @@ public:
              */
             SolverTypeEnum getSolverType(void) const;
 
+            /** Set device for solution vectors and Jacobian matrices.
+             *
+             * @param[in] value Device type.
+             */
+            void setDevice(const DeviceEnum value);
+
+            /** Get device for solution vectors and Jacobian matrices.
+             *
+             * @returns Device type.
+             */
+            DeviceEnum getDevice(void) const;
+
+            /** Set storage of assembled Jacobian matrices.
+             *
+             * Blocked storage uses blocks with the degrees of freedom at each point, such as the components of the
+             * displacement. It requires the same number of unconstrained degrees of freedom at every point, so it is
+             * ignored for problems with faults or Dirichlet boundary conditions that constrain only some components.
+             * Symmetric blocked storage also requires the quasistatic formulation with only the displacement solution
+             * subfield.
+             *
+             * @param[in] value Storage of Jacobian matrices.
+             */
+            void setJacobianStorage(const JacobianStorageEnum value);
+
+            /** Get storage of assembled Jacobian matrices.
+             *
+             * @returns Storage of Jacobian matrices.
+             */
+            JacobianStorageEnum getJacobianStorage(void) const;
+
             /** Specify which default PETSc options to use.
              *
              * @param[in] flags Flags indicating which default PETSc options to set.
@@ -87,6 +133,30 @@ public:
              */
             void setGravityField(spatialdata::spatialdb::GravityField* const g);
 
+            /** Set maximum number of cells assembled in each call to the PETSc assembly routines.
+             *
+             * @param[in] value Maximum number of cells in chunk (0 for all cells).
+             */
+            void setAssemblyChunkSize(const size_t value);
+
+            /** Set flag for caching cell geometry between assembly calls.
+             *
+             * @param[in] value True to cache cell geometry, false to recompute it in every assembly call.
+             */
+            void setCacheGeometry(const bool value);
+
+            /** Set flag for eliminating the fault Lagrange multipliers in the preconditioner.
+             *
+             * @param[in] value True to use split node preconditioner, false otherwise.
+             */
+            void setUseSplitNodeSolver(const bool value);
+
+            /** Get flag for eliminating the fault Lagrange multipliers in the preconditioner.
+             *
+             * @returns True if using split node preconditioner, false otherwise.
+             */
+            bool getUseSplitNodeSolver(void) const;
+
             /** Register observer to receive notifications.
              *
              * Observers are used for output.
@@ -107,6 +177,19 @@ public:
              */
             void setSolution(pylith::topology::Field* field);
 
+            /** Get solution field.
+             *
+             * @returns Solution field.
+             */
+            const pylith::topology::Field* getSolution(void) const;
+
+            /** Get auxiliary field of physics (material, boundary condition, or fault).
+             *
+             * @param[in] identifier Identifier of physics component.
+             * @returns Auxiliary field of physics.
+             */
+            const pylith::topology::Field* getAuxiliaryField(const char* identifier) const;
+
             /** Set materials.
              *
              * @param[in] materials Array of materials.
@@ -146,6 +229,35 @@ public:
             virtual
             void initialize(void);
 
+            /** Reset problem for another run, reusing the mesh, integrators, constraints, and solution layout.
+             *
+             * Values of the auxiliary fields are recomputed from the spatial databases, so changes to the spatial databases
+             * since initialize() are used in the next run.
+             */
+            virtual
+            void reinitialize(void);
+
+            /** Write performance of integrators to JSON file.
+             *
+             * For each integrator and instrumented operation, the report contains the number of calls, the maximum and
+             * mean elapsed time over the processes, and the throughput (cells and solution degrees of freedom integrated per
+             * second) computed from the global number of cells and degrees of freedom and the maximum elapsed time.
+             *
+             * @param[in] filename Name of JSON file (written by rank 0).
+             */
+            void writePerformanceReport(const char* filename) const;
+
+            /** Estimate computational resources for running problem.
+             *
+             * Initializes the solution, integrators, and constraints (including the auxiliary fields) but does not
+             * create the time stepping, solver, or Jacobian matrices.
+             *
+             * Collective over the processes of the solution.
+             *
+             * @returns Report on rank 0, empty string on other ranks.
+             */
+            std::string estimateResources(void);
+
         }; // Problem
 
     } // problems
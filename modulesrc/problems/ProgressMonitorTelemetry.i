@@ -0,0 +1,83 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file modulesrc/problems/ProgressMonitorTelemetry.i
+ *
+ * Python interface to C++ class ProgressMonitorTelemetry.
+ */
+
+namespace pylith {
+    namespace problems {
+        class ProgressMonitorTelemetry: public pylith::problems::ProgressMonitorTime {
+            // PUBLIC ENUMS ///////////////////////////////////////////////////////////////////////
+public:
+
+            enum FormatEnum {
+                JSON_LINES=0, ///< One JSON object per time step.
+                PROMETHEUS=1, ///< Prometheus text format with current values.
+            };
+
+            // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            ProgressMonitorTelemetry(void);
+
+            /// Destructor
+            virtual ~ProgressMonitorTelemetry(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set format of telemetry.
+             *
+             * @param[in] value Format of telemetry.
+             */
+            void setFormat(const FormatEnum value);
+
+            /** Get format of telemetry.
+             *
+             * @returns Format of telemetry.
+             */
+            FormatEnum getFormat(void) const;
+
+            /** Update progress.
+             *
+             * @param[in] current Current time.
+             * @param[in] start Starting time.
+             * @param[in] stop Ending time.
+             */
+            void update(const double current,
+                        const double start,
+                        const double stop);
+
+            // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////
+protected:
+
+            /// Open progress monitor.
+            void _open(void);
+
+            /// Close progress monitor.
+            void _close(void);
+
+        }; // class ProgressMonitorTelemetry
+
+    } // problems
+} // pylith
+
+// End of file
@@ -45,12 +45,45 @@ public:
              */
             const char* getTimeUnit(void) const;
 
+            /** Set flag for reporting solver statistics (number of Jacobians and solver iterations) with progress.
+             *
+             * @param[in] value True to report solver statistics, false otherwise.
+             */
+            void setShowSolverStatistics(const bool value);
+
+            /** Get flag for reporting solver statistics (number of Jacobians and solver iterations) with progress.
+             *
+             * @returns True if reporting solver statistics, false otherwise.
+             */
+            bool getShowSolverStatistics(void) const;
+
+            /** Set solver statistics reported with progress.
+             *
+             * @param[in] numJacobians Number of times the Jacobian has been reformed.
+             * @param[in] numSolverIterations Total number of nonlinear solver iterations.
+             */
+            void setSolverStatistics(const size_t numJacobians,
+                                     const size_t numSolverIterations);
+
+            /** Get number of times the Jacobian has been reformed.
+             *
+             * @returns Number of Jacobian reformations.
+             */
+            size_t getNumJacobians(void) const;
+
+            /** Get total number of nonlinear solver iterations.
+             *
+             * @returns Number of nonlinear solver iterations.
+             */
+            size_t getNumSolverIterations(void) const;
+
             /** Update progress.
              *
              * @param[in] current Current time.
              * @param[in] start Starting time.
              * @param[in] stop Ending time.
              */
+            virtual
             void update(const double current,
                         const double start,
                         const double stop);
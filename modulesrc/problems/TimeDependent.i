@@ -25,6 +25,20 @@
 namespace pylith {
     namespace problems {
         class TimeDependent : public pylith::problems::Problem {
+            // PUBLIC ENUM /////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            enum PredictorEnum {
+                PREDICTOR_NONE, // Use solution at previous time step.
+                PREDICTOR_LINEAR, // Linear extrapolation from two previous solutions.
+                PREDICTOR_QUADRATIC, // Quadratic extrapolation from three previous solutions.
+            }; // PredictorEnum
+
+            enum TimeSteppingEnum {
+                TIMESTEPPING_BACKWARD_EULER, // Backward Euler (first order).
+                TIMESTEPPING_BDF2, // Second order backward differentiation formula with variable time steps.
+            }; // TimeSteppingEnum
+
             // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -101,6 +115,404 @@ public:
              */
             void setShouldNotifyIC(const bool value);
 
+            /** Use matrix-free action of the LHS Jacobian with an assembled preconditioner.
+             *
+             * Only used with implicit time stepping.
+             *
+             * @param[in] value True if using matrix-free Jacobian, false otherwise.
+             */
+            void setUseMatrixFreeJacobian(const bool value);
+
+            /** Use matrix-free action of the LHS Jacobian with an assembled preconditioner?
+             *
+             * @returns True if using matrix-free Jacobian, false otherwise.
+             */
+            bool getUseMatrixFreeJacobian(void) const;
+
+            /** Form the residual of linear problems from the stored Jacobian and a cached load vector.
+             *
+             * Only used with the linear solver and quasistatic formulation when materials have linear, time-independent
+             * residuals and constrained values do not depend on time.
+             *
+             * @param[in] value True if using stored Jacobian to form residual, false otherwise.
+             */
+            void setUseLinearFastPath(const bool value);
+
+            /** Form the residual of linear problems from the stored Jacobian and a cached load vector?
+             *
+             * @returns True if using stored Jacobian to form residual, false otherwise.
+             */
+            bool getUseLinearFastPath(void) const;
+
+            /** Use fixed-stress split of poroelasticity instead of monolithic coupling of flow and mechanics.
+             *
+             * The preconditioner alternates a flow solve with the fixed-stress stabilization and a mechanics solve. Only used
+             * with the quasistatic formulation when all materials are poroelastic and the problem has no faults.
+             *
+             * @param[in] value True if using fixed-stress split, false otherwise.
+             */
+            void setUseFixedStressSplit(const bool value);
+
+            /** Use fixed-stress split of poroelasticity instead of monolithic coupling of flow and mechanics?
+             *
+             * @returns True if using fixed-stress split, false otherwise.
+             */
+            bool getUseFixedStressSplit(void) const;
+
+            /** Use pressure mass matrix as the preconditioner for the Schur complement of incompressible elasticity.
+             *
+             * The pressure block of a separate preconditioner matrix is the pressure mass matrix weighted by
+             * 1/shear_modulus + 1/bulk_modulus. Only used with the quasistatic formulation when all materials are
+             * incompressible elastic.
+             *
+             * @param[in] value True if using pressure mass matrix preconditioner, false otherwise.
+             */
+            void setUsePressureMassPreconditioner(const bool value);
+
+            /** Use pressure mass matrix as the preconditioner for the Schur complement of incompressible elasticity?
+             *
+             * @returns True if using pressure mass matrix preconditioner, false otherwise.
+             */
+            bool getUsePressureMassPreconditioner(void) const;
+
+            /** Overlap exchange of ghost values of the solution with assembly of the residual over interior cells.
+             *
+             * Cells without ghost or constrained points in their closure are integrated while the ghost values are exchanged;
+             * the remaining cells, boundary conditions, and faults are integrated after the exchange is complete.
+             *
+             * @param[in] value True if overlapping communication and assembly, false otherwise.
+             */
+            void setUseOverlappedAssembly(const bool value);
+
+            /** Overlap exchange of ghost values of the solution with assembly of the residual over interior cells?
+             *
+             * @returns True if overlapping communication and assembly, false otherwise.
+             */
+            bool getUseOverlappedAssembly(void) const;
+
+            /** Use local time stepping with explicit time stepping.
+             *
+             * Cells with a stable time step smaller than the time step are put in a fast rate group that a multirate
+             * partitioned Runge-Kutta method (PETSc TSMPRK) advances with a fraction of the time step. Only used with the
+             * dynamic formulation.
+             *
+             * @param[in] value True if using local time stepping, false otherwise.
+             */
+            void setUseLocalTimeStepping(const bool value);
+
+            /** Use local time stepping with explicit time stepping?
+             *
+             * @returns True if using local time stepping, false otherwise.
+             */
+            bool getUseLocalTimeStepping(void) const;
+
+            /** Set minimum number of time steps between Jacobian reformations requested by integrators.
+             *
+             * The Jacobian is always reformed when the time step changes. A value of 0 reforms the Jacobian
+             * whenever an integrator requests it.
+             *
+             * @param[in] value Number of time steps.
+             */
+            void setJacobianLagSteps(const size_t value);
+
+            /** Get minimum number of time steps between Jacobian reformations requested by integrators.
+             *
+             * @returns Number of time steps.
+             */
+            size_t getJacobianLagSteps(void) const;
+
+            /** Set number of nonlinear solver iterations in previous time step that triggers reforming a lagged
+             * Jacobian.
+             *
+             * A value of 0 disables this trigger.
+             *
+             * @param[in] value Number of nonlinear solver iterations.
+             */
+            void setJacobianReformIterations(const size_t value);
+
+            /** Get number of nonlinear solver iterations in previous time step that triggers reforming a lagged
+             * Jacobian.
+             *
+             * @returns Number of nonlinear solver iterations.
+             */
+            size_t getJacobianReformIterations(void) const;
+
+            /** Set predictor for initial guess of nonlinear solver in each time step.
+             *
+             * The initial guess is extrapolated in time from the solutions at the most recent time steps. Lower order
+             * extrapolation is used until enough time steps are available. Only used with the quasistatic formulation.
+             *
+             * @param[in] value Predictor for initial guess.
+             */
+            void setPredictor(const PredictorEnum value);
+
+            /** Get predictor for initial guess of nonlinear solver in each time step.
+             *
+             * @returns Predictor for initial guess.
+             */
+            PredictorEnum getPredictor(void) const;
+
+            /** Use ratios of time steps in extrapolation of initial guess.
+             *
+             * If false, the extrapolation assumes a uniform time step.
+             *
+             * @param[in] value True if using ratios of time steps, false otherwise.
+             */
+            void setPredictorUseTimeStepRatio(const bool value);
+
+            /** Use ratios of time steps in extrapolation of initial guess?
+             *
+             * @returns True if using ratios of time steps, false otherwise.
+             */
+            bool getPredictorUseTimeStepRatio(void) const;
+
+            /** Set implicit time stepping method for the quasistatic formulation.
+             *
+             * @param[in] value Time stepping method.
+             */
+            void setTimeStepping(const TimeSteppingEnum value);
+
+            /** Get implicit time stepping method for the quasistatic formulation.
+             *
+             * @returns Time stepping method.
+             */
+            TimeSteppingEnum getTimeStepping(void) const;
+
+            /** Use local truncation error estimate of the time stepping method to control the time step.
+             *
+             * @param[in] value True if controlling the time step using the error estimate, false otherwise.
+             */
+            void setUseTimeStepErrorControl(const bool value);
+
+            /** Use local truncation error estimate of the time stepping method to control the time step?
+             *
+             * @returns True if controlling the time step using the error estimate, false otherwise.
+             */
+            bool getUseTimeStepErrorControl(void) const;
+
+            /** Set reference state of materials from equilibrium at the start time before time stepping.
+             *
+             * @param[in] value True if equilibrating reference state, false otherwise.
+             */
+            void setEquilibrateReferenceState(const bool value);
+
+            /** Set reference state of materials from equilibrium at the start time before time stepping?
+             *
+             * @returns True if equilibrating reference state, false otherwise.
+             */
+            bool getEquilibrateReferenceState(void) const;
+
+            /** Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution.
+             *
+             * @param[in] value True if adapting time step, false otherwise.
+             */
+            void setAdaptTimeStep(const bool value);
+
+            /** Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution?
+             *
+             * @returns True if adapting time step, false otherwise.
+             */
+            bool getAdaptTimeStep(void) const;
+
+            /** Set maximum time step for adaptive time stepping.
+             *
+             * @param[in] value Maximum time step (dimensional).
+             */
+            void setMaxTimeStep(const double value);
+
+            /** Get maximum time step for adaptive time stepping.
+             *
+             * @returns Maximum time step (dimensional).
+             */
+            double getMaxTimeStep(void) const;
+
+            /** Set factor for geometric growth of time step.
+             *
+             * @param[in] value Ratio of consecutive time steps (>1).
+             */
+            void setTimeStepGrowthFactor(const double value);
+
+            /** Get factor for geometric growth of time step.
+             *
+             * @returns Ratio of consecutive time steps.
+             */
+            double getTimeStepGrowthFactor(void) const;
+
+            /** Set fraction of the minimum Maxwell time limiting the time step during the viscoelastic transient.
+             *
+             * @param[in] value Fraction of minimum Maxwell time.
+             */
+            void setMaxwellTimeFraction(const double value);
+
+            /** Get fraction of the minimum Maxwell time limiting the time step during the viscoelastic transient.
+             *
+             * @returns Fraction of minimum Maxwell time.
+             */
+            double getMaxwellTimeFraction(void) const;
+
+            /** Set tolerance for relative change in solution over a time step.
+             *
+             * @param[in] value Tolerance for relative change in solution.
+             */
+            void setSolutionChangeTolerance(const double value);
+
+            /** Get tolerance for relative change in solution over a time step.
+             *
+             * @returns Tolerance for relative change in solution.
+             */
+            double getSolutionChangeTolerance(void) const;
+
+            /** Use estimate of stable time step for explicit time stepping as the initial time step.
+             *
+             * The stable time step is estimated as the minimum over cells of the distance between vertices divided by the
+             * dilatational wave speed. Only used with the dynamic and dynamic_imex formulations.
+             *
+             * @param[in] value True if using stable time step, false if using initial time step.
+             */
+            void setUseStableTimeStep(const bool value);
+
+            /** Use estimate of stable time step for explicit time stepping as the initial time step?
+             *
+             * @returns True if using stable time step, false if using initial time step.
+             */
+            bool getUseStableTimeStep(void) const;
+
+            /** Set factor applied to estimate of stable time step for explicit time stepping.
+             *
+             * @param[in] value Factor applied to estimate of stable time step.
+             */
+            void setStableTimeStepFactor(const double value);
+
+            /** Get factor applied to estimate of stable time step for explicit time stepping.
+             *
+             * @returns Factor applied to estimate of stable time step.
+             */
+            double getStableTimeStepFactor(void) const;
+
+            /** Set number of time steps between checkpoints.
+             *
+             * A value of 0 disables checkpointing.
+             *
+             * @param[in] value Number of time steps.
+             */
+            void setCheckpointInterval(const size_t value);
+
+            /** Get number of time steps between checkpoints.
+             *
+             * @returns Number of time steps.
+             */
+            size_t getCheckpointInterval(void) const;
+
+            /** Set name of HDF5 file for checkpoints.
+             *
+             * @param[in] value Name of file.
+             */
+            void setCheckpointFilename(const char* value);
+
+            /** Get name of HDF5 file for checkpoints.
+             *
+             * @returns Name of file.
+             */
+            const char* getCheckpointFilename(void) const;
+
+            /** Set threshold for load imbalance in assembly that triggers a checkpoint for repartitioning.
+             *
+             * The load imbalance is the ratio of the maximum to the mean time spent in assembly of the residual and
+             * Jacobian over the processes in a time step. A value of 0 disables monitoring of the load imbalance.
+             *
+             * @param[in] value Threshold for load imbalance (0 or >= 1).
+             */
+            void setLoadImbalanceThreshold(const double value);
+
+            /** Get threshold for load imbalance in assembly that triggers a checkpoint for repartitioning.
+             *
+             * @returns Threshold for load imbalance.
+             */
+            double getLoadImbalanceThreshold(void) const;
+
+            /** Get load imbalance in assembly for most recent time step.
+             *
+             * @returns Ratio of maximum to mean assembly time over processes (0 if not monitored).
+             */
+            double getLoadImbalance(void) const;
+
+            /** Set relative rate of change in solution for steady state.
+             *
+             * The relative rate of change in the solution over a time step is the norm of the change in the solution divided
+             * by the norm of the solution and the time step. Time stepping stops with output at the current time step when
+             * the relative rate of change is at or below this value for a number of consecutive time steps. A value of 0
+             * disables checking for steady state.
+             *
+             * @param[in] value Relative rate of change in solution (1/s, 0=disable).
+             */
+            void setSteadyStateRate(const double value);
+
+            /** Get relative rate of change in solution for steady state.
+             *
+             * @returns Relative rate of change in solution (1/s).
+             */
+            double getSteadyStateRate(void) const;
+
+            /** Set number of consecutive time steps at or below steady state rate for steady state.
+             *
+             * @param[in] value Number of time steps.
+             */
+            void setSteadyStateWindow(const size_t value);
+
+            /** Get number of consecutive time steps at or below steady state rate for steady state.
+             *
+             * @returns Number of time steps.
+             */
+            size_t getSteadyStateWindow(void) const;
+
+            /** Set names of solution subfields checked for steady state.
+             *
+             * Each subfield must satisfy the steady state criterion. The entire solution is checked if no subfields are given.
+             *
+             * @param[in] names Array of subfield names.
+             * @param[in] numNames Length of array.
+             */
+            %apply(const char* const* string_list, const int list_len) {
+                (const char* names[],
+                 const int numNames)
+            };
+            void setSteadyStateSubfields(const char* names[],
+                                         const int numNames);
+
+            %clear(const char* names[], const int numNames);
+
+            /** Set name of HDF5 checkpoint file used to restart simulation.
+             *
+             * An empty name starts the simulation from the initial conditions.
+             *
+             * @param[in] value Name of file.
+             */
+            void setRestartFilename(const char* value);
+
+            /** Get name of HDF5 checkpoint file used to restart simulation.
+             *
+             * @returns Name of file.
+             */
+            const char* getRestartFilename(void) const;
+
+            /** Use parareal iteration with time slices distributed across groups of processes.
+             *
+             * @param[in] comm Communicator connecting processes with the same rank in each group; rank is the time slice.
+             * @param[in] coarseTimeStep Time step of coarse propagator (seconds).
+             * @param[in] maxIterations Maximum number of parareal iterations.
+             * @param[in] tolerance Tolerance for relative change in solution at the end of the time slices.
+             */
+            void setParallelInTime(const MPI_Comm& comm,
+                                   const double coarseTimeStep,
+                                   const size_t maxIterations,
+                                   const double tolerance);
+
+            /** Get number of parareal iterations in most recent solve.
+             *
+             * @returns Number of parareal iterations (0 if not using parareal iteration).
+             */
+            size_t getNumPararealIterations(void) const;
+
             /** Set progress monitor.
              *
              * @param[in] monitor Progress monitor for time-dependent simulation.
@@ -110,6 +522,73 @@ public:
             /// Initialize.
             void initialize(void);
 
+            /** Reset problem for another run, reusing the mesh, integrators, Jacobian sparsity, and solver setup.
+             *
+             * Values of the auxiliary fields are recomputed from the spatial databases, the time stepping state is reset to
+             * the start time, and the solution is set from the initial conditions. The Jacobian is recomputed in the first time
+             * step, so only the numeric setup of the preconditioner is redone.
+             */
+            void reinitialize(void);
+
+            /** Add load case to run with multiple load cases sharing the LHS Jacobian and preconditioner.
+             *
+             * The auxiliary fields of the boundary conditions are recomputed from their current spatial databases and
+             * stored along with the auxiliary fields of the other integrators and constraints as the initial state of the
+             * load case. With load cases, solve() advances all of them together with a fixed time step, using one block
+             * solve (KSPMatSolve) per time step. Only linear quasistatic problems are supported.
+             *
+             * @param[in] name Name of load case.
+             * @param[in] bc Array of boundary conditions with spatial databases for the load case.
+             * @param[in] numBC Number of boundary conditions.
+             */
+            void addLoadCase(const char* name,
+                             pylith::bc::BoundaryCondition* bc[],
+                             const int numBC);
+
+            /** Get number of load cases.
+             *
+             * @returns Number of load cases (0 if solving a single problem).
+             */
+            size_t getNumLoadCases(void) const;
+
+            /** Set fault with impulses for time-dependent Green's functions.
+             *
+             * With a fault, solve() advances unit slip for each impulse through the time steps as load cases and
+             * computes the responses to the slip histories by convolution. Only linear quasistatic problems are
+             * supported.
+             *
+             * @param[in] labelName Name of label for fault (empty to solve a single problem).
+             * @param[in] labelValue Value of label for fault.
+             */
+            void setImpulseFault(const char* labelName,
+                                 const int labelValue);
+
+            /** Set number of impulses advanced together with one block solve per time step.
+             *
+             * @param[in] value Number of impulses.
+             */
+            void setImpulseBatchSize(const size_t value);
+
+            /** Set rank of compressed responses to impulses.
+             *
+             * @param[in] value Rank of spatial basis shared by the responses at all time steps (0=full responses).
+             */
+            void setResponseRank(const size_t value);
+
+            /** Add slip history for prediction with time-dependent Green's functions.
+             *
+             * @param[in] db Spatial database with slip distribution.
+             * @param[in] th Time history of slip amplitude.
+             */
+            void addSlipHistory(spatialdata::spatialdb::SpatialDB* db,
+                                spatialdata::spatialdb::TimeHistory* th);
+
+            /** Get number of impulses for time-dependent Green's functions.
+             *
+             * @returns Number of impulses (0 if solving a single problem).
+             */
+            size_t getNumImpulses(void) const;
+
             /** Solve time dependent problem.
              */
             void solve(void);
@@ -201,6 +680,36 @@ public:
                                               PetscVec residualVec,
                                               void* context);
 
+            /** Callback static method for computing RHS residual, G(t,s), for slow rate group of local time stepping.
+             *
+             * @param[in] ts PETSc time stepper for slow rate group.
+             * @param[in] t Current time.
+             * @param[in] solutionVec PETSc Vec for solution.
+             * @param[out] residualvec PETSc Vec for residual of slow rate group.
+             * @param[in] context User context (TimeDependent).
+             */
+            static
+            PetscErrorCode computeRHSResidualSlow(PetscTS ts,
+                                                  PetscReal t,
+                                                  PetscVec solutionVec,
+                                                  PetscVec residualVec,
+                                                  void* context);
+
+            /** Callback static method for computing RHS residual, G(t,s), for fast rate group of local time stepping.
+             *
+             * @param[in] ts PETSc time stepper for fast rate group.
+             * @param[in] t Current time.
+             * @param[in] solutionVec PETSc Vec for solution.
+             * @param[out] residualvec PETSc Vec for residual of fast rate group.
+             * @param[in] context User context (TimeDependent).
+             */
+            static
+            PetscErrorCode computeRHSResidualFast(PetscTS ts,
+                                                  PetscReal t,
+                                                  PetscVec solutionVec,
+                                                  PetscVec residualVec,
+                                                  void* context);
+
             /** Callback static method for computing residual for LHS, F(t,s,\dot{s}).
              *
              * @param[in] ts PETSc time stepper.
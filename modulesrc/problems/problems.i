@@ -26,12 +26,15 @@
 #include "pylith/problems/GreensFns.hh"
 #include "pylith/problems/Physics.hh"
 #include "pylith/problems/ObserverSoln.hh"
+#include "pylith/problems/CouplerBoundary.hh"
 #include "pylith/problems/ObserverPhysics.hh"
 #include "pylith/problems/InitialCondition.hh"
 #include "pylith/problems/InitialConditionDomain.hh"
+#include "pylith/problems/InitialConditionFile.hh"
 #include "pylith/problems/InitialConditionPatch.hh"
 #include "pylith/problems/ProgressMonitor.hh"
 #include "pylith/problems/ProgressMonitorTime.hh"
+#include "pylith/problems/ProgressMonitorTelemetry.hh"
 #include "pylith/problems/ProgressMonitorStep.hh"
 %}
 
@@ -45,6 +48,7 @@
  } // exception
 
 %include "typemaps.i"
+%include "std_string.i"
 %include "../include/physicsarray.i"
 %include "../include/outputarray.i"
 %include "../include/chararray.i"
@@ -67,12 +71,15 @@
 %include "GreensFns.i"
 %include "Physics.i"
 %include "ObserverSoln.i"
+%include "CouplerBoundary.i"
 %include "ObserverPhysics.i"
 %include "InitialCondition.i"
 %include "InitialConditionDomain.i"
+%include "InitialConditionFile.i"
 %include "InitialConditionPatch.i"
 %include "ProgressMonitor.i"
 %include "ProgressMonitorTime.i"
+%include "ProgressMonitorTelemetry.i"
 %include "ProgressMonitorStep.i"
 
 // End of file
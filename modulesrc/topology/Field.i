@@ -130,6 +130,47 @@ public:
              */
             PetscInt getStorageSize(void) const;
 
+            /** Get values of the local vector without copying them.
+             *
+             * The array points to the storage of the local vector, so it is valid until the field is deallocated.
+             * Values are ordered by the local section and include constrained degrees of freedom. Changing values
+             * through the array does not increase the PETSc object state of the local vector.
+             *
+             * @param[out] values Array of values in local vector.
+             * @param[out] numValues Number of values in local vector.
+             */
+            %apply(double** ARGOUTVIEW_ARRAY1, int* DIM1) {
+                (PylithScalar** values,
+                 int* numValues)
+            };
+            void getLocalArray(PylithScalar** values,
+                               int* numValues) const;
+
+            %clear(PylithScalar** values, int* numValues);
+
+            /** Get layout of subfield in the local vector.
+             *
+             * @param[in] name Name of subfield.
+             * @param[out] offsets Offset of subfield in local vector for each point in chart [chartSize].
+             * @param[in] numOffsets Size of offsets array.
+             * @param[out] numDof Number of degrees of freedom of subfield for each point in chart [chartSize].
+             * @param[in] numNumDof Size of numDof array.
+             */
+            %apply(int* INPLACE_ARRAY1, int DIM1) {
+                (int* offsets,
+                 const int numOffsets),
+                (int* numDof,
+                 const int numNumDof)
+            };
+            void getSubfieldLayout(const char* name,
+                                   int* offsets,
+                                   const int numOffsets,
+                                   int* numDof,
+                                   const int numNumDof) const;
+
+            %clear(int* offsets, const int numOffsets);
+            %clear(int* numDof, const int numNumDof);
+
             /** Create discretization for field.
              *
              * @important Should be called for all fields after
@@ -159,7 +200,7 @@ public:
              * @param[in] dimension Dimension of points for discretization.
              * @param[in] isFaultOnly True if subfield is limited to fault degrees of freedom.
              * @param[in] cellBasis Type of basis functions to use (e.g., simplex, tensor, or default).
-             * @param[in] feSpace Finite-element space (POLYNOMIAL_SPACE or POINT_SPACE).
+             * @param[in] feSpace Finite-element space (POLYNOMIAL_SPACE, POINT_SPACE, or GLL_SPACE).
              * @param[in] isBasisContinuous True if basis is continuous.
              */
             %apply(const char* const* string_list, const int list_len) {
@@ -219,6 +260,25 @@ public:
             void scatterVectorToLocal(const PetscVec vector,
                                       InsertMode mode=INSERT_VALUES) const;
 
+            /** Start scattering global information across processors to update the local view of the field.
+             *
+             * Values of points owned by this process are available in the local vector on return; ghost values are available
+             * after scatterVectorToLocalEnd().
+             *
+             * @param[in] vector PETSc vector used in update.
+             * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+             */
+            void scatterVectorToLocalBegin(const PetscVec vector,
+                                           InsertMode mode=INSERT_VALUES) const;
+
+            /** Finish scattering global information across processors to update the local view of the field.
+             *
+             * @param[in] vector PETSc vector used in update.
+             * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+             */
+            void scatterVectorToLocalEnd(const PetscVec vector,
+                                         InsertMode mode=INSERT_VALUES) const;
+
             /** Scatter section information across processors to update the
              * output view of the field.
              *
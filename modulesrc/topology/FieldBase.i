@@ -42,6 +42,7 @@ public:
             enum SpaceEnum {
                 POLYNOMIAL_SPACE=0, ///< Polynomial finite-element space.
                 POINT_SPACE=1, ///< Point finite-element space.
+                GLL_SPACE=2, ///< Polynomial space with Gauss-Lobatto-Legendre nodes and collocated quadrature (spectral element).
             }; // SpaceEnum
 
             enum CellBasis {
@@ -85,6 +85,26 @@ public:
              */
             int getDimension(void) const;
 
+            /** Get coordinates of vertices in the local coordinate vector without copying them.
+             *
+             * The array points to the storage of the local coordinate vector, so it is valid until the mesh is
+             * deallocated. Coordinates are nondimensional.
+             *
+             * @param[out] coordinates Array of vertex coordinates [numVertices*spaceDim].
+             * @param[out] numVertices Number of vertices.
+             * @param[out] spaceDim Spatial dimension of coordinates.
+             */
+            %apply(double** ARGOUTVIEW_ARRAY2, int* DIM1, int* DIM2) {
+                (PylithScalar** coordinates,
+                 int* numVertices,
+                 int* spaceDim)
+            };
+            void getCoordinatesArray(PylithScalar** coordinates,
+                                     int* numVertices,
+                                     int* spaceDim) const;
+
+            %clear(PylithScalar** coordinates, int* numVertices, int* spaceDim);
+
             /** Get MPI communicator associated with mesh.
              *
              * @returns MPI communicator.
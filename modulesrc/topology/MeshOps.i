@@ -33,6 +33,44 @@
 			    const spatialdata::units::Nondimensional& normalizer) {
     pylith::topology::MeshOps::nondimensionalize(mesh, normalizer);
   } // nondimensionalize
+
+  /** Check topology, geometry, and labels of a distributed mesh.
+   *
+   * @param mesh Finite-element mesh.
+   * @param maxReport Maximum number of offending cells to list in the error message.
+   */
+  void
+  MeshOps_checkDistributedTopology(const pylith::topology::Mesh& mesh,
+				   const size_t maxReport=10) {
+    pylith::topology::MeshOps::checkDistributedTopology(mesh, maxReport);
+  } // checkDistributedTopology
+
+  /** Save prepared mesh (distributed with cohesive cells) to PETSc DMPlex HDF5 file.
+   *
+   * @param mesh Finite-element mesh.
+   * @param filename Name of HDF5 file.
+   * @param key Key identifying the input and parameters used to prepare the mesh.
+   */
+  void
+  MeshOps_savePrepared(const pylith::topology::Mesh& mesh,
+		       const char* filename,
+		       const char* key) {
+    pylith::topology::MeshOps::savePrepared(mesh, filename, key);
+  } // savePrepared
+
+  /** Load prepared mesh from PETSc DMPlex HDF5 file if it matches the key and number of processes.
+   *
+   * @param mesh Finite-element mesh.
+   * @param filename Name of HDF5 file.
+   * @param key Key identifying the input and parameters used to prepare the mesh.
+   * @returns True if the mesh was loaded, false otherwise.
+   */
+  bool
+  MeshOps_loadPrepared(pylith::topology::Mesh* mesh,
+		       const char* filename,
+		       const char* key) {
+    return pylith::topology::MeshOps::loadPrepared(mesh, filename, key);
+  } // loadPrepared
 %}
 
 // End of file
@@ -0,0 +1,65 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/topology/RefineAdaptive.hh
+ *
+ * @brief Python interface to C++ PyLith RefineAdaptive object.
+ */
+
+namespace pylith {
+  namespace topology {
+
+    // RefineAdaptive ---------------------------------------------------
+    class pylith::topology::RefineAdaptive
+    { // RefineAdaptive
+
+      // PUBLIC MEMBERS /////////////////////////////////////////////////
+    public :
+
+      /// Constructor
+      RefineAdaptive(void);
+
+      /// Destructor
+      ~RefineAdaptive(void);
+
+      /** Set label marking points near which cells are refined.
+       *
+       * @param name Name of label.
+       * @param value Value of label.
+       */
+      void setLabel(const char* name,
+		    const int value);
+
+      /** Refine mesh.
+       *
+       * @param newMesh Refined mesh (result).
+       * @param mesh Mesh to refine.
+       * @param levels Number of levels to refine.
+       */
+      void refine(Mesh* const newMesh,
+		  const Mesh& mesh,
+		  const int levels =1);
+
+    }; // RefineAdaptive
+
+  } // topology
+} // pylith
+
+
+// End of file
@@ -37,6 +37,14 @@ namespace pylith {
       
       /// Destructor
       ~RefineUniform(void);
+
+      /** Set flag for keeping the coarse meshes as the coarse DMs of the refined mesh.
+       *
+       * The coarse meshes provide the hierarchy for geometric multigrid (PCMG).
+       *
+       * @param value True if keeping coarse meshes, false otherwise.
+       */
+      void setKeepCoarseLevels(const bool value);
       
       /** Refine mesh.
        *
@@ -32,13 +32,22 @@ namespace pylith {
       // PUBLIC METHODS /////////////////////////////////////////////////
     public :
 
-      /** Reorder vertices and cells of mesh using PETSc routines
-       * implementing reverse Cuthill-McKee algorithm.
+      /// Algorithm for ordering the cells.
+      enum OrderingEnum {
+	RCM=0, ///< PETSc reverse Cuthill-McKee over the entire mesh.
+	RCM_MATERIAL=1, ///< Reverse Cuthill-McKee within each material.
+	HILBERT=2, ///< Hilbert space-filling curve on cell centroids within each material.
+	MORTON=3, ///< Morton (Z-order) space-filling curve on cell centroids within each material.
+      }; // OrderingEnum
+
+      /** Reorder vertices and cells of mesh.
        *
        * @param mesh PyLith finite-element mesh.
+       * @param ordering Algorithm for ordering the cells.
        */
       static
-      void reorder(topology::Mesh* mesh);
+      void reorder(topology::Mesh* mesh,
+		   const OrderingEnum ordering=RCM);
 
     }; // ReverseCuthillMcKee
 
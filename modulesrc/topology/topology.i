@@ -27,6 +27,7 @@
 #include "pylith/topology/Field.hh"
 #include "pylith/topology/Distributor.hh"
 #include "pylith/topology/RefineUniform.hh"
+#include "pylith/topology/RefineAdaptive.hh"
 #include "pylith/topology/ReverseCuthillMcKee.hh"
 %}
 
@@ -60,6 +61,7 @@ import_array();
 %include "Field.i"
 %include "Distributor.i"
 %include "RefineUniform.i"
+%include "RefineAdaptive.i"
 %include "ReverseCuthillMcKee.i"
 
 // End of file
@@ -106,6 +106,35 @@ namespace pylith {
       /// Log stage end.
       void stagePop(void);
 
+      /** Start recording timeline trace of events and stages on each process.
+       *
+       * Collective over PETSC_COMM_WORLD.
+       *
+       * @param[in] bufferSize Maximum number of records (beginning or end of an event or stage) on each process.
+       */
+      static
+      void enableTrace(const size_t bufferSize);
+
+      /// Stop recording timeline trace and discard records.
+      static
+      void disableTrace(void);
+
+      /** Is timeline trace being recorded?
+       *
+       * @returns True if recording timeline trace, false otherwise.
+       */
+      static
+      bool isTraceEnabled(void);
+
+      /** Write timeline trace of all processes to file in Chrome trace event (JSON) format.
+       *
+       * Collective over PETSC_COMM_WORLD.
+       *
+       * @param[in] filename Name of file.
+       */
+      static
+      void writeTrace(const char* filename);
+
     }; // EventLogger
 
   } // utils
@@ -0,0 +1,59 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/utils/HardwareCounters.i
+ *
+ * @brief Python interface to C++ HardwareCounters.
+ */
+
+namespace pylith {
+    namespace utils {
+        class HardwareCounters {
+            // PUBLIC MEMBERS /////////////////////////////////////////////////
+public:
+
+            /** Start counting.
+             *
+             * @returns True if counters are available, false otherwise.
+             */
+            static
+            bool initialize(void);
+
+            /// Stop counting and release counters.
+            static
+            void deallocate(void);
+
+            /** Are counters active?
+             *
+             * @returns True if counters are active, false otherwise.
+             */
+            static
+            bool isActive(void);
+
+            // NOT IMPLEMENTED //////////////////////////////////////////////
+private:
+
+            HardwareCounters(void); ///< Not implemented
+
+        }; // HardwareCounters
+
+    } // utils
+} // pylith
+
+// End of file
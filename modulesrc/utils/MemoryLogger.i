@@ -0,0 +1,65 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/utils/MemoryLogger.i
+ *
+ * @brief Python interface to C++ MemoryLogger.
+ */
+
+namespace pylith {
+    namespace utils {
+        class MemoryLogger {
+            // PUBLIC MEMBERS /////////////////////////////////////////////////
+public:
+
+            /** Get memory currently recorded on this process.
+             *
+             * @returns Number of bytes.
+             */
+            static
+            size_t getCurrentBytes(void);
+
+            /** Get peak memory recorded on this process since the last report.
+             *
+             * @returns Number of bytes.
+             */
+            static
+            size_t getPeakBytes(void);
+
+            /** Create report of memory usage over all processes and reset the peak of the recorded memory.
+             *
+             * Collective over PETSC_COMM_WORLD.
+             *
+             * @param[in] stage Name of stage.
+             * @returns Report on rank 0, empty string on other ranks.
+             */
+            static
+            std::string report(const char* stage);
+
+            // NOT IMPLEMENTED //////////////////////////////////////////////
+private:
+
+            MemoryLogger(void); ///< Not implemented
+
+        }; // MemoryLogger
+
+    } // utils
+} // pylith
+
+// End of file
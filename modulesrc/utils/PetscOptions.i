@@ -34,6 +34,8 @@ public:
             static const int PARALLEL;
             static const int INITIAL_GUESS;
             static const int TESTING;
+            static const int SINGLE_PRECISION_PC;
+            static const int REUSE_AMG_INTERPOLATION;
 
             // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////
 private:
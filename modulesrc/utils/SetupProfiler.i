@@ -0,0 +1,72 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/utils/SetupProfiler.i
+ *
+ * @brief Python interface to C++ SetupProfiler.
+ */
+
+namespace pylith {
+    namespace utils {
+        class SetupProfiler {
+            // PUBLIC MEMBERS /////////////////////////////////////////////////
+public:
+
+            /** Begin setup phase.
+             *
+             * @param[in] phase Name of phase.
+             */
+            static
+            void begin(const char* phase);
+
+            /** End setup phase.
+             *
+             * @param[in] phase Name of phase (must match name of most recently begun phase).
+             */
+            static
+            void end(const char* phase);
+
+            /** Get number of setup phases currently in progress.
+             *
+             * @returns Nesting depth.
+             */
+            static
+            size_t getDepth(void);
+
+            /** Create report of setup phases over all processes and clear the completed phases.
+             *
+             * Collective over PETSC_COMM_WORLD.
+             *
+             * @param[in] title Title of report.
+             * @returns Report on rank 0, empty string on other ranks.
+             */
+            static
+            std::string report(const char* title);
+
+            // NOT IMPLEMENTED //////////////////////////////////////////////
+private:
+
+            SetupProfiler(void); ///< Not implemented
+
+        }; // SetupProfiler
+
+    } // utils
+} // pylith
+
+// End of file
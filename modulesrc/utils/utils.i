@@ -22,6 +22,9 @@
 // Header files for module C++ code
 %{
 #include "pylith/utils/EventLogger.hh"
+#include "pylith/utils/MemoryLogger.hh"
+#include "pylith/utils/SetupProfiler.hh"
+#include "pylith/utils/HardwareCounters.hh"
 #include "pylith/utils/PyreComponent.hh"
 #include "pylith/utils/PetscOptions.hh"
 #include "pylith/utils/PylithVersion.hh"
@@ -57,7 +60,11 @@ import_array();
 
 // Interfaces
 %include "pylith_general.i"
+%include "std_string.i"
 %include "EventLogger.i"
+%include "MemoryLogger.i"
+%include "SetupProfiler.i"
+%include "HardwareCounters.i"
 %include "PyreComponent.i"
 %include "PetscOptions.i"
 %include "PylithVersion.i"
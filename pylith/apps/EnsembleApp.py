@@ -0,0 +1,197 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/apps/EnsembleApp.py
+#
+# @brief Python application for running an ensemble of PyLith simulations in a single MPI job.
+#
+# The processes are split into groups of `group_size` processes. Each group reads, distributes, and adjusts the
+# topology of the mesh once and then runs its share of the ensemble members back-to-back in the same process, so
+# Python startup, PETSc/MPI initialization, and meshing are amortized over the members. Each member is configured
+# from the .cfg files on the command line followed by the member's .cfg file, so the member .cfg files only contain
+# the parameters that differ among members (for example, spatial databases for auxiliary fields and boundary
+# conditions).
+
+from .PyLithApp import PyLithApp
+
+
+class EnsembleApp(PyLithApp):
+    """Python application for running an ensemble of PyLith simulations in a single MPI job.
+
+    All ensemble members share the mesh, so parameters affecting the mesh (mesh generator, interfaces, and scales
+    for nondimensionalization) must not differ among members.
+    """
+
+    import pythia.pyre.inventory
+
+    members = pythia.pyre.inventory.list("members", default=[])
+    members.meta['tip'] = "Parameter files (.cfg) for ensemble members (may contain wildcards)."
+
+    groupSize = pythia.pyre.inventory.int("group_size", default=1, validator=pythia.pyre.inventory.greater(0))
+    groupSize.meta['tip'] = "Number of processes used to run each ensemble member."
+
+    # PUBLIC METHODS /////////////////////////////////////////////////////
+
+    def __init__(self, name="pylithapp"):
+        """Constructor.
+        """
+        PyLithApp.__init__(self, name)
+        self._loggingPrefix = "Ensemble "
+        self.baseArgs = []
+        self.groupComm = None
+        self.groupIndex = 0
+        self.numGroups = 1
+        return
+
+    def getArgv(self, *args, **kwds):
+        """Keep parameter files from the command line for configuring the ensemble members.
+        """
+        argv = PyLithApp.getArgv(self, *args, **kwds)
+        self.baseArgs = [arg for arg in argv if arg.endswith(".cfg")]
+        return argv
+
+    def onComputeNodes(self, *args, **kwds):
+        """Split processes into groups and run the application on each group.
+
+        PETSC_COMM_WORLD must be set to the communicator for the group before PETSc is initialized.
+        """
+        from pylith.mpi.Communicator import mpi_comm_world, mpi_comm_split, petsc_set_comm_world
+        comm = mpi_comm_world()
+        if comm.size % self.groupSize:
+            raise ValueError(f"Number of processes ({comm.size}) must be a multiple of the group size "
+                             f"({self.groupSize}) for running an ensemble.")
+        self.numGroups = comm.size // self.groupSize
+        self.groupIndex = comm.rank // self.groupSize
+        self.groupComm = mpi_comm_split(comm, self.groupIndex, comm.rank)
+        petsc_set_comm_world(self.groupComm)
+
+        PyLithApp.onComputeNodes(self, *args, **kwds)
+        return
+
+    def main(self, *args, **kwds):
+        """Create mesh once and run ensemble members assigned to this group.
+        """
+        if self.pdbOn:
+            import pdb
+            pdb.set_trace()
+
+        members = self._getMembers()
+        from pylith.mpi.Communicator import mpi_is_root, petsc_comm_world
+        if mpi_is_root():
+            self._info.log(f"Running {len(members)} ensemble member(s) on {self.numGroups} group(s) of "
+                           f"{self.groupSize} process(es).")
+
+        self._setupLogging()
+
+        self._eventLogger.stagePush("Meshing")
+        mesh = self._createMesh()
+        self._eventLogger.stagePop()
+        self._logMemory("Meshing")
+
+        isGroupRoot = petsc_comm_world().rank == 0
+        lengthScale = self.problem.normalizer.getLengthScale()
+        for index in range(self.groupIndex, len(members), self.numGroups):
+            if isGroupRoot:
+                self._info.log(f"Running ensemble member {index+1} of {len(members)} ('{members[index]}') "
+                               f"on group {self.groupIndex}.")
+            member = EnsembleMemberApp(self.baseArgs + [members[index]], mesh, lengthScale, self._eventLogger)
+            member.run()
+            del member
+
+        mesh.cleanup()
+        return
+
+    # PRIVATE METHODS ////////////////////////////////////////////////////
+
+    def _getMembers(self):
+        """Get sorted list of parameter files for ensemble members.
+        """
+        import glob
+        members = []
+        for pattern in self.members:
+            filenames = sorted(glob.glob(pattern))
+            if not filenames:
+                raise IOError(f"Could not find parameter file(s) '{pattern}' for ensemble members.")
+            members += filenames
+        if not members:
+            raise ValueError("No ensemble members. Set 'members' to the parameter files for the ensemble members.")
+        return members
+
+
+class EnsembleMemberApp(PyLithApp):
+    """PyLith application for one ensemble member.
+
+    The member runs in the process of the ensemble application, reusing the initialized PETSc, the mesh, and the
+    event logger of the ensemble application.
+    """
+
+    def __init__(self, args, mesh, lengthScale, eventLogger, name="pylithapp"):
+        """Constructor.
+
+        Args:
+            args (list of str)
+                Command line arguments for member.
+            mesh (pylith.topology.Mesh)
+                Mesh shared by ensemble members.
+            lengthScale (float)
+                Length scale used to nondimensionalize the mesh.
+            eventLogger (pylith.utils.EventLogger)
+                Event logger of ensemble application.
+        """
+        PyLithApp.__init__(self, name)
+        self.pylithargs = args
+        self.sharedMesh = mesh
+        self.lengthScale = lengthScale
+        self.sharedEventLogger = eventLogger
+        return
+
+    def onLoginNode(self, *args, **kwds):
+        """Run the member in this process instead of scheduling a job.
+        """
+        self.main(*args, **kwds)
+        self.cleanup()
+        return
+
+    def getArgv(self, *args, **kwds):
+        """Use only the arguments for the member.
+        """
+        return self.pylithargs
+
+    # PRIVATE METHODS ////////////////////////////////////////////////////
+
+    def _getParameterComm(self):
+        """Read parameter files within the group running the member.
+        """
+        from pylith.mpi.Communicator import petsc_comm_world
+        return petsc_comm_world()
+
+    def _createMesh(self):
+        """Use mesh shared by ensemble members.
+        """
+        lengthScale = self.problem.normalizer.getLengthScale()
+        if abs(lengthScale - self.lengthScale) > 1.0e-8 * self.lengthScale:
+            raise ValueError(f"Length scale ({lengthScale}) of ensemble member does not match length scale "
+                             f"({self.lengthScale}) used to nondimensionalize the shared mesh.")
+        self.mesher = None
+        return self.sharedMesh
+
+    def _setupLogging(self):
+        """Use event logger of ensemble application.
+        """
+        self._eventLogger = self.sharedEventLogger
+        return
+
+
+# End of file
@@ -0,0 +1,100 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/apps/ParallelInTimeApp.py
+#
+# @brief Python application for solving a time-dependent problem with parareal iteration over groups of processes.
+#
+# The processes are split into groups of `group_size` processes. Each group solves the entire spatial problem for one
+# time slice. A second communicator connects the processes with the same rank in each group, and the time-dependent
+# problem uses it to exchange the solution and state variables at the ends of the time slices.
+
+from .PyLithApp import PyLithApp
+
+
+class ParallelInTimeApp(PyLithApp):
+    """Python application for solving a time-dependent problem with parareal iteration over groups of processes.
+
+    Each group writes output for its time slice to files with the simulation name followed by `-sliceN`.
+    """
+
+    import pythia.pyre.inventory
+    from pythia.pyre.units.time import year
+
+    groupSize = pythia.pyre.inventory.int("group_size", default=1, validator=pythia.pyre.inventory.greater(0))
+    groupSize.meta['tip'] = "Number of processes used to solve each time slice."
+
+    coarseDt = pythia.pyre.inventory.dimensional("coarse_dt", default=10.0 * year,
+                                                 validator=pythia.pyre.inventory.greater(0.0 * year))
+    coarseDt.meta['tip'] = "Time step of coarse propagator."
+
+    maxIterations = pythia.pyre.inventory.int("max_iterations", default=10, validator=pythia.pyre.inventory.greaterEqual(0))
+    maxIterations.meta['tip'] = "Maximum number of parareal iterations."
+
+    tolerance = pythia.pyre.inventory.float("tolerance", default=1.0e-6, validator=pythia.pyre.inventory.greater(0.0))
+    tolerance.meta['tip'] = "Tolerance for relative change in solution at the end of the time slices."
+
+    # PUBLIC METHODS /////////////////////////////////////////////////////
+
+    def __init__(self, name="pylithapp"):
+        """Constructor.
+        """
+        PyLithApp.__init__(self, name)
+        self._loggingPrefix = "ParallelInTime "
+        self.timeComm = None
+        self.groupIndex = 0
+        self.numGroups = 1
+        return
+
+    def onComputeNodes(self, *args, **kwds):
+        """Split processes into groups and create communicator for time slices.
+
+        PETSC_COMM_WORLD must be set to the communicator for the group before PETSc is initialized.
+        """
+        from pylith.mpi.Communicator import mpi_comm_world, mpi_comm_split, petsc_set_comm_world
+        comm = mpi_comm_world()
+        if comm.size % self.groupSize:
+            raise ValueError(f"Number of processes ({comm.size}) must be a multiple of the group size "
+                             f"({self.groupSize}) for parareal iteration.")
+        self.numGroups = comm.size // self.groupSize
+        self.groupIndex = comm.rank // self.groupSize
+        groupComm = mpi_comm_split(comm, self.groupIndex, comm.rank)
+        self.timeComm = mpi_comm_split(comm, comm.rank % self.groupSize, self.groupIndex)
+        petsc_set_comm_world(groupComm)
+
+        PyLithApp.onComputeNodes(self, *args, **kwds)
+        return
+
+    def main(self, *args, **kwds):
+        """Configure problem for time slice of this group and run the application.
+        """
+        import os
+        from pylith.problems.TimeDependent import TimeDependent
+        if not isinstance(self.problem, TimeDependent):
+            raise ValueError("Parareal iteration requires a time-dependent problem.")
+
+        suffix = f"-slice{self.groupIndex}"
+        self.problem.defaults.simName += suffix
+        root, ext = os.path.splitext(self.problem.progressMonitor.filename)
+        self.problem.progressMonitor.filename = root + suffix + ext
+        if self.groupIndex > 0:
+            self.problem.shouldNotifyIC = False
+        self.problem.setParallelInTime(self.timeComm, self.coarseDt, self.maxIterations, self.tolerance)
+
+        PyLithApp.main(self, *args, **kwds)
+        return
+
+
+# End of file
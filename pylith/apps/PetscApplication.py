@@ -45,6 +45,34 @@ class PetscApplication(Application):
         Application.__init__(self, name)
         return
 
+    def readParameterFiles(self, registry, context):
+        """Read parameter (.cfg) files given on the command line.
+
+        When running in parallel, the root process reads the files and broadcasts their contents, so the other
+        processes do not read the files from the filesystem. Every process parses the contents, so the settings keep
+        the file and line where they were set.
+        """
+        comm = self._getParameterComm()
+        cfgFiles = [arg for arg in self.argv if arg.endswith(".cfg")]
+        if comm is None or comm.size == 1 or not cfgFiles:
+            Application.readParameterFiles(self, registry, context)
+            return
+
+        import pythia.pyre.parsing.locators
+        locator = pythia.pyre.parsing.locators.commandLine()
+        self.argv = [arg for arg in self.argv if not arg.endswith(".cfg")]
+        for filename, contents, error in bcastParameterFiles(cfgFiles, comm):
+            if error:
+                context.error(IOError(error), locator=locator)
+                continue
+            paramRegistry = parseParameterFile(filename, contents).getFacility(self.name)
+            if paramRegistry:
+                self.updateConfiguration(paramRegistry)
+
+        # Parameter files in other formats.
+        Application.readParameterFiles(self, registry, context)
+        return
+
     def onComputeNodes(self, *args, **kwds):
         """Run the application in parallel on the compute nodes.
         """
@@ -110,5 +138,71 @@ class PetscApplication(Application):
         """
         return
 
+    def _getParameterComm(self):
+        """Get communicator for reading parameter files.
+
+        Returns (pylith.mpi.Communicator)
+            Communicator or None if MPI has not been initialized.
+        """
+        from pylith.mpi import mpi
+        if not mpi.mpi_initialized():
+            return None
+        from pylith.mpi.Communicator import mpi_comm_world
+        return mpi_comm_world()
+
+
+# ----------------------------------------------------------------------
+def parseParameterFile(filename, contents):
+    """Parse contents of parameter (.cfg) file.
+
+    Args:
+        filename (str)
+            Name of parameter file (used in locators of settings).
+        contents (str)
+            Contents of parameter file.
+
+    Returns (pythia.pyre.inventory.odb.Registry)
+        Root of registry with settings.
+    """
+    import io
+    import pythia.pyre.inventory
+    from pythia.pyre.inventory.cfg.Parser import Parser
+
+    root = pythia.pyre.inventory.registry("root")
+    parser = Parser(root)
+    parser.read_file(io.StringIO(contents), filename)
+    return root
+
+
+# ----------------------------------------------------------------------
+def bcastParameterFiles(filenames, comm):
+    """Read parameter (.cfg) files on the root process and broadcast their contents.
+
+    Args:
+        filenames (list of str)
+            Names of parameter files.
+        comm (pylith.mpi.Communicator)
+            Communicator.
+
+    Returns (list of tuple)
+        Name, contents, and error message (empty if file was read) for each parameter file.
+    """
+    import json
+    from pylith.mpi import mpi
+
+    root = 0
+    value = ""
+    if comm.rank == root:
+        files = []
+        for filename in filenames:
+            try:
+                with open(filename, "r") as fin:
+                    files.append((filename, fin.read(), ""))
+            except IOError as err:
+                files.append((filename, "", f"Could not read parameter file '{filename}': {err}"))
+        value = json.dumps(files)
+    value = mpi.bcast_string(value, root, comm.handle)
+    return [tuple(entry) for entry in json.loads(value)]
+
 
 # End of file
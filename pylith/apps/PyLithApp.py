@@ -39,6 +39,21 @@ class PyLithApp(PetscApplication):
     initializeOnly = pythia.pyre.inventory.bool("initialize_only", default=False)
     initializeOnly.meta['tip'] = "Stop simulation after initializing problem."
 
+    estimateResources = pythia.pyre.inventory.bool("estimate_resources", default=False)
+    estimateResources.meta['tip'] = "Report estimated degrees of freedom, Jacobian nonzeros, memory, and output volume and stop before creating the solver."
+
+    prefetchDBs = pythia.pyre.inventory.bool("prefetch_spatial_databases", default=False)
+    prefetchDBs.meta['tip'] = "Open spatial databases on processes other than the root process before creating the mesh."
+
+    logMemory = pythia.pyre.inventory.bool("log_memory", default=False)
+    logMemory.meta['tip'] = "Report memory used by fields, matrices, and buffers at the end of each stage."
+
+    traceFilename = pythia.pyre.inventory.str("trace_filename", default="")
+    traceFilename.meta['tip'] = "Name of file for timeline trace of PyLith events and stages on each process in Chrome trace format (empty=no trace)."
+
+    traceBufferSize = pythia.pyre.inventory.int("trace_buffer_size", default=1000000, validator=pythia.pyre.inventory.greater(0))
+    traceBufferSize.meta['tip'] = "Maximum number of records in timeline trace on each process (oldest records are discarded)."
+
     from pylith.utils.SimulationMetadata import SimulationMetadata
     metadata = pythia.pyre.inventory.facility(
         "metadata", family="simulation_metadata", factory=SimulationMetadata)
@@ -87,43 +102,70 @@ class PyLithApp(PetscApplication):
         self._debug.log(resourceUsageString())
 
         self._setupLogging()
+        if self.traceFilename:
+            from pylith.utils.utils import EventLogger as ModuleEventLogger
+            ModuleEventLogger.enableTrace(self.traceBufferSize)
+
+        from pylith.utils.utils import SetupProfiler
 
         # Create mesh (adjust to account for interfaces (faults) if necessary)
         self._eventLogger.stagePush("Meshing")
-        interfaces = None
-        if "interfaces" in dir(self.problem):
-            interfaces = self.problem.interfaces.components()
-        self.mesher.preinitialize(self.problem)
-        mesh = self.mesher.create(self.problem, interfaces)
-        del interfaces
-        self.mesher = None
+        SetupProfiler.begin("Meshing")
+        if self.prefetchDBs:
+            self._prefetchSpatialDBs()
+        mesh = self._createMesh()
+        SetupProfiler.end("Meshing")
         self._debug.log(resourceUsageString())
         self._eventLogger.stagePop()
+        self._logMemory("Meshing")
 
         # Setup problem, verify configuration, and then initialize
         self._eventLogger.stagePush("Setup")
+        SetupProfiler.begin("Preinitialize problem")
         self.problem.preinitialize(mesh)
+        SetupProfiler.end("Preinitialize problem")
         self._debug.log(resourceUsageString())
 
+        SetupProfiler.begin("Verify configuration")
         self.problem.verifyConfiguration()
+        SetupProfiler.end("Verify configuration")
+
+        # If estimating resources, stop before creating the solver and Jacobian matrices
+        if self.estimateResources:
+            self.problem.estimateResources()
+            self._eventLogger.stagePop()
+            self._logMemory("Setup")
+            self._logSetupProfile()
+            self._writeTrace()
+            return
 
+        SetupProfiler.begin("Initialize problem")
         self.problem.initialize()
+        SetupProfiler.end("Initialize problem")
         self._debug.log(resourceUsageString())
 
         self._eventLogger.stagePop()
+        self._logMemory("Setup")
+        self._logSetupProfile()
 
         # If initializing only, stop before running problem
         if self.initializeOnly:
+            self._writeTrace()
             return
 
         # Run problem
+        self._eventLogger.stagePush("Run")
         self.problem.run(self)
         self._debug.log(resourceUsageString())
+        self._eventLogger.stagePop()
+        self._logMemory("Run")
 
         # Cleanup
         self._eventLogger.stagePush("Finalize")
         self.problem.finalize()
         self._eventLogger.stagePop()
+        self._logMemory("Finalize")
+        self._writeTrace()
 
         return
 
@@ -237,6 +279,52 @@ class PyLithApp(PetscApplication):
         PetscApplication._configure(self)
         return
 
+    def _createMesh(self):
+        """Create mesh, adjusting topology for interfaces (faults) if necessary.
+        """
+        interfaces = None
+        if "interfaces" in dir(self.problem):
+            interfaces = self.problem.interfaces.components()
+        self.mesher.preinitialize(self.problem)
+        mesh = self.mesher.create(self.problem, interfaces)
+        del interfaces
+        self.mesher = None
+        return mesh
+
+    def _prefetchSpatialDBs(self):
+        """Open spatial databases on processes other than the root process.
+
+        The root process reads the mesh and creates the cohesive cells on the serial mesh while the other processes
+        wait for the mesh to be distributed, so they use this time to read the spatial databases. Opening a
+        database that is already open does not read it again, so the databases stay open until they are first
+        used and closed during initialization. Databases that are opened collectively (shared memory) are skipped.
+        """
+        from pylith.mpi.Communicator import mpi_comm_world
+        comm = mpi_comm_world()
+        if comm.size == 1 or comm.rank == 0:
+            return
+
+        from spatialdata.spatialdb.SpatialDBObj import SpatialDBObj
+        dbs = {}
+        visited = set()
+
+        def collect(obj):
+            if id(obj) in visited:
+                return
+            visited.add(id(obj))
+            if isinstance(obj, SpatialDBObj) and not getattr(obj, "sharedMemory", False):
+                dbs[id(obj)] = obj
+            for name in obj.inventory.facilityNames():
+                component = obj.inventory.getTraitDescriptor(name).value
+                if component is not None and hasattr(component, "inventory"):
+                    collect(component)
+
+        collect(self.problem)
+        for db in dbs.values():
+            self._debug.log("Prefetching spatial database '%s'." % db.getDescription())
+            db.open()
+        return
+
     def _setupLogging(self):
         """Setup event logging.
         """
@@ -248,6 +336,40 @@ class PyLithApp(PetscApplication):
         self._eventLogger = logger
         return
 
+    def _writeTrace(self):
+        """Write timeline trace of events and stages.
+        """
+        if not self.traceFilename:
+            return
+
+        from pylith.utils.utils import EventLogger as ModuleEventLogger
+        ModuleEventLogger.writeTrace(self.traceFilename)  # collective
+        ModuleEventLogger.disableTrace()
+        return
+
+    def _logMemory(self, stage):
+        """Report memory usage at end of stage.
+        """
+        if not self.logMemory:
+            return
+
+        from pylith.utils.utils import MemoryLogger
+        from pylith.mpi.Communicator import mpi_is_root
+        report = MemoryLogger.report(stage)  # collective
+        if mpi_is_root():
+            self._info.log(report)
+        return
+
+    def _logSetupProfile(self):
+        """Report wall time and change in memory of each setup phase.
+        """
+        from pylith.utils.utils import SetupProfiler
+        from pylith.mpi.Communicator import mpi_is_root
+        report = SetupProfiler.report("Meshing and Setup")  # collective
+        if mpi_is_root():
+            self._info.log(report)
+        return
+
 
 # ======================================================================
 # Local version of InfoApp that only configures itself. Workaround for
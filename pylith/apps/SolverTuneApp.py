@@ -0,0 +1,345 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# Application for selecting solver settings by running short trials of a simulation.
+#
+# Each trial runs PyLith with the simulation parameter files, a solver preset (a .cfg file with PETSc solver
+# settings, such as those in share/settings), and optionally values of solver parameters that differ from the preset.
+# The trials are limited to a few time steps; the time per step comes from the PETSc log (CSV format) and the
+# number of linear and nonlinear iterations from the converged reasons written by PETSc.
+
+import argparse
+import configparser
+import csv
+import json
+import os
+import re
+import subprocess
+import sys
+
+
+# Default sweeps of solver parameters. Each sweep applies to solver options in the preset matching the suffix and
+# value; the parameters are set using the options prefix of the matching option.
+DEFAULT_SWEEPS = [
+    # Algebraic multigrid threshold for dropping weak connections.
+    {"suffix": "pc_type", "value": "gamg", "values": [{"pc_gamg_threshold": "0.01"}, {"pc_gamg_threshold": "0.05"}]},
+    # Multigrid smoother.
+    {"suffix": "pc_type", "value": "gamg", "values": [
+        {"mg_levels_ksp_type": "chebyshev", "mg_levels_pc_type": "jacobi"},
+        {"mg_levels_ksp_type": "richardson", "mg_levels_pc_type": "sor"},
+    ]},
+    # Schur complement factorization type.
+    {"suffix": "pc_fieldsplit_schur_factorization_type", "value": None, "values": [
+        {"pc_fieldsplit_schur_factorization_type": "full"},
+        {"pc_fieldsplit_schur_factorization_type": "upper"},
+        {"pc_fieldsplit_schur_factorization_type": "lower"},
+        {"pc_fieldsplit_schur_factorization_type": "diag"},
+    ]},
+    {"suffix": "pc_fieldsplit_schur_fact_type", "value": None, "values": [
+        {"pc_fieldsplit_schur_fact_type": "full"},
+        {"pc_fieldsplit_schur_fact_type": "upper"},
+        {"pc_fieldsplit_schur_fact_type": "lower"},
+        {"pc_fieldsplit_schur_fact_type": "diag"},
+    ]},
+]
+
+LINEAR_CONVERGED = re.compile(r"^\s*Linear solve (converged|did not converge) due to (\S+) iterations (\d+)")
+NONLINEAR_CONVERGED = re.compile(r"^\s*Nonlinear solve (converged|did not converge) due to (\S+) iterations (\d+)")
+
+
+def readPetscOptions(filename):
+    """Read PETSc options from the [pylithapp.petsc] section of a .cfg file.
+
+    Args:
+        filename (str)
+            Name of .cfg file.
+
+    Returns (dict)
+        PETSc options and their values.
+    """
+    parser = configparser.ConfigParser(interpolation=None, strict=False, comment_prefixes=("#", ";"),
+                                       inline_comment_prefixes=("#",))
+    parser.optionxform = str
+    parser.read(filename)
+    if not parser.has_section("pylithapp.petsc"):
+        return {}
+    return dict(parser.items("pylithapp.petsc"))
+
+
+def createVariants(options, sweeps):
+    """Create variants of solver options by changing one solver parameter of the preset at a time.
+
+    Args:
+        options (dict)
+            PETSc options of preset.
+        sweeps (list of dict)
+            Sweeps with 'suffix' (None for sweeps without options prefix) and 'value' (None for any value) of matching
+            options and 'values', the list of parameter values (dict with option suffix and value) to try.
+
+    Returns (list of dict)
+        PETSc options that differ from the preset for each variant. The first variant is the preset itself.
+    """
+    variants = [{}]
+    for sweep in sweeps:
+        if sweep["suffix"] is None:
+            prefixes = [""]
+        else:
+            prefixes = [key[:-len(sweep["suffix"])] for key, value in sorted(options.items())
+                        if key.endswith(sweep["suffix"]) and (sweep["value"] is None or value.strip() == sweep["value"])]
+        for prefix in prefixes:
+            for sweepValues in sweep["values"]:
+                variant = {prefix + suffix: sweepValue for suffix, sweepValue in sweepValues.items()}
+                if all(options.get(k, None) == v for k, v in variant.items()):
+                    continue
+                if variant not in variants:
+                    variants.append(variant)
+    return variants
+
+
+def parseSweep(arg):
+    """Parse sweep given on command line as OPTION=VALUE1,VALUE2,...
+
+    Args:
+        arg (str)
+            Command line argument.
+
+    Returns (dict)
+        Sweep applying to all presets.
+    """
+    if not "=" in arg:
+        raise ValueError(f"Could not parse sweep '{arg}'. Expected OPTION=VALUE1,VALUE2,...")
+    key, values = arg.split("=", 1)
+    return {"suffix": None, "value": None, "values": [{key.strip(): value.strip()} for value in values.split(",") if value.strip()]}
+
+
+def parseLog(filename):
+    """Get time and number of solves in Run stage from PETSc log in CSV format.
+
+    Args:
+        filename (str)
+            Name of PETSc log file.
+
+    Returns (dict)
+        Time of Run stage (maximum over processes) and number of steps.
+    """
+    runTime = 0.0
+    counts = {}
+    with open(filename, "r") as fin:
+        for row in csv.DictReader(fin):
+            if row["Stage Name"].strip() != "Run":
+                continue
+            event = row["Event Name"].strip()
+            if event == "summary":
+                runTime = max(runTime, float(row["Time"]))
+            elif event in ["TSStep", "SNESSolve", "KSPSolve"]:
+                counts[event] = max(counts.get(event, 0), int(float(row["Count"])))
+    numSteps = counts.get("TSStep", 0) or counts.get("SNESSolve", 0) or counts.get("KSPSolve", 0)
+    return {"run_time": runTime, "num_steps": numSteps}
+
+
+def parseConvergence(lines):
+    """Get iterations and convergence from the converged reasons of the outer linear and nonlinear solvers.
+
+    Args:
+        lines (iterable of str)
+            Output of PyLith.
+
+    Returns (dict)
+        Number of linear and nonlinear solves and iterations, and whether all solves converged.
+    """
+    info = {"linear_solves": 0, "linear_iterations": 0, "nonlinear_solves": 0, "nonlinear_iterations": 0,
+            "converged": True}
+    for line in lines:
+        for regex, label in [(LINEAR_CONVERGED, "linear"), (NONLINEAR_CONVERGED, "nonlinear")]:
+            match = regex.match(line)
+            if match:
+                info[label + "_solves"] += 1
+                info[label + "_iterations"] += int(match.group(3))
+                if match.group(1) != "converged":
+                    info["converged"] = False
+    return info
+
+
+class SolverTuneApp():
+    """Application for selecting solver settings by running short trials of a simulation.
+    """
+
+    def main(self, **kwargs):
+        """Main entry point.
+        """
+        args = argparse.Namespace(**kwargs) if kwargs else self._parse_command_line()
+
+        sweeps = [] if args.no_default_sweeps else list(DEFAULT_SWEEPS)
+        sweeps += [parseSweep(sweep) for sweep in args.sweeps]
+
+        os.makedirs(args.work_dir, exist_ok=True)
+        trials = []
+        for preset in args.presets:
+            options = readPetscOptions(preset)
+            for variant in createVariants(options, sweeps):
+                trials.append(self._run_trial(args, preset, variant, len(trials)))
+
+        converged = [trial for trial in trials if trial["converged"] and trial["num_steps"] > 0]
+        best = min(converged, key=lambda trial: trial["time_per_step"]) if converged else None
+        self._print_summary(trials, best)
+
+        with open(args.summary, "w") as fout:
+            json.dump({"trials": trials, "best": best["name"] if best else None}, fout, indent=2)
+            fout.write("\n")
+        if best is None:
+            raise RuntimeError("None of the trials converged. See the logs in '{}'.".format(args.work_dir))
+        self._write_cfg(args.output_cfg, best)
+
+    def _run_trial(self, args, preset, variant, index):
+        """Run PyLith for one trial.
+
+        Args:
+            args (argparse.Namespace)
+                Command line arguments.
+            preset (str)
+                Filename of solver preset.
+            variant (dict)
+                PETSc options that differ from the preset.
+            index (int)
+                Index of trial.
+
+        Returns (dict)
+            Trial settings and measurements.
+        """
+        name = "trial{:03d}_{}".format(index, os.path.splitext(os.path.basename(preset))[0])
+        logFilename = os.path.abspath(os.path.join(args.work_dir, name + "-log.csv"))
+        outFilename = os.path.abspath(os.path.join(args.work_dir, name + ".log"))
+
+        cmd = [args.pylith] + args.cfgs + [preset] + [f"--petsc.{key}={value}" for key, value in sorted(variant.items())]
+        cmd += [
+            f"--nodes={args.nodes}",
+            f"--petsc.log_view=:{logFilename}:ascii_csv",
+            "--petsc.ksp_converged_reason=true",
+            "--petsc.snes_converged_reason=true",
+        ]
+        if args.num_steps > 0:
+            cmd += [f"--problem.max_timesteps={args.num_steps}"]
+        cmd += args.pylith_args
+
+        description = ", ".join([f"{key}={value}" for key, value in sorted(variant.items())]) or "preset"
+        print(f"Running {name} ({description}) ...")
+        sys.stdout.flush()
+        with open(outFilename, "w") as fout:
+            status = subprocess.call(cmd, stdout=fout, stderr=subprocess.STDOUT)
+
+        trial = {
+            "name": name,
+            "preset": os.path.abspath(preset),
+            "options": variant,
+            "status": status,
+            "run_time": 0.0,
+            "num_steps": 0,
+        }
+        with open(outFilename, "r") as fin:
+            trial.update(parseConvergence(fin))
+        if status or not os.path.isfile(logFilename):
+            trial["converged"] = False
+        else:
+            trial.update(parseLog(logFilename))
+        numSteps = max(trial["num_steps"], 1)
+        trial["time_per_step"] = trial["run_time"] / numSteps
+        trial["linear_iterations_per_solve"] = trial["linear_iterations"] / max(trial["linear_solves"], 1)
+        trial["nonlinear_iterations_per_step"] = trial["nonlinear_iterations"] / numSteps
+        return trial
+
+    def _write_cfg(self, filename, best):
+        """Write parameter file with solver settings of best trial.
+
+        Args:
+            filename (str)
+                Name of parameter file.
+            best (dict)
+                Best trial.
+        """
+        with open(best["preset"], "r") as fin:
+            presetLines = fin.readlines()
+        with open(filename, "w") as fout:
+            fout.write("# Solver settings selected by pylith_solvertune from trial '{}'.\n".format(best["name"]))
+            fout.write("# Preset: {}\n".format(best["preset"]))
+            fout.write("# Time per step: {:.4g} s; linear iterations per solve: {:.1f}\n".format(
+                best["time_per_step"], best["linear_iterations_per_solve"]))
+            fout.write("\n")
+            fout.writelines(presetLines)
+            if best["options"]:
+                fout.write("\n# Solver parameters changed from preset.\n")
+                fout.write("[pylithapp.petsc]\n")
+                for key, value in sorted(best["options"].items()):
+                    fout.write(f"{key} = {value}\n")
+            fout.write("\n# End of file\n")
+        print(f"Wrote solver settings of trial {best['name']} to '{filename}'.")
+
+    def _print_summary(self, trials, best):
+        """Print table of trials.
+        """
+        print("{:40s} {:>10s} {:>6s} {:>14s} {:>12s} {:>10s}".format("trial", "converged", "steps", "time/step (s)",
+              "linear its", "nonlinear"))
+        for trial in trials:
+            marker = " *" if best and trial["name"] == best["name"] else ""
+            print("{:40s} {:>10s} {:6d} {:14.4g} {:12.1f} {:10.1f}{}".format(
+                trial["name"], "yes" if trial["converged"] else "no", trial["num_steps"], trial["time_per_step"],
+                trial["linear_iterations_per_solve"], trial["nonlinear_iterations_per_step"], marker))
+
+    def _parse_command_line(self):
+        """Parse command line arguments.
+
+        Returns (argsparse.Namespace)
+           Command line arguments.
+        """
+        DESCRIPTION = (
+            "Application for selecting solver settings by running short trials of a simulation with solver presets "
+            "and variations of their parameters."
+        )
+
+        parser = argparse.ArgumentParser(description=DESCRIPTION,
+                                         formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+                                         epilog="Additional arguments after '--' are passed to PyLith.")
+        parser.add_argument("cfgs", action="store", nargs="+", help="Simulation parameter files.")
+        parser.add_argument("--presets", action="store", dest="presets", nargs="+", required=True,
+                            help="Parameter files with solver settings.")
+        parser.add_argument("--sweep", action="append", dest="sweeps", default=[],
+                            help="Additional sweep of PETSc option for all presets as OPTION=VALUE1,VALUE2,...")
+        parser.add_argument("--no-default-sweeps", action="store_true", dest="no_default_sweeps",
+                            help="Do not sweep multigrid threshold, multigrid smoother, and Schur factorization type.")
+        parser.add_argument("--num-steps", action="store", dest="num_steps", type=int, default=5,
+                            help="Number of time steps in each trial (0=do not limit).")
+        parser.add_argument("--nodes", action="store", dest="nodes", type=int, default=1,
+                            help="Number of processes to use when running PyLith.")
+        parser.add_argument("--work-dir", action="store", dest="work_dir", default="solvertune",
+                            help="Directory for logs of trials.")
+        parser.add_argument("--output-cfg", action="store", dest="output_cfg", default="solver_tuned.cfg",
+                            help="Filename for parameter file with best solver settings.")
+        parser.add_argument("--summary", action="store", dest="summary", default="solvertune.json",
+                            help="Filename for summary of trials (JSON).")
+        parser.add_argument("--pylith", action="store", dest="pylith", default="pylith", help="PyLith executable.")
+        argv = sys.argv[1:]
+        extra = []
+        if "--" in argv:
+            extra = argv[argv.index("--")+1:]
+            argv = argv[:argv.index("--")]
+        args = parser.parse_args(argv)
+        args.pylith_args = extra
+        if args.nodes < 1:
+            parser.error("Number of processes must be positive.")
+        if args.num_steps < 0:
+            parser.error("Number of time steps must be nonnegative.")
+        return args
+
+
+# End of file
@@ -22,6 +22,8 @@
 
 __all__ = ['PyLithApp',
            'PetscApplication',
+           'EnsembleApp',
+           'ParallelInTimeApp',
            ]
 
 
@@ -34,9 +34,8 @@ class AbsorbingDampers(BoundaryCondition, ModuleAbsorbingDampers):
             db_auxiliary_field.values = [density, vs, vp]
             db_auxiliary_field.data = [2500*kg/m**3, 1.0*km/s, 1.732*km/s]
 
-            auxiliary_subfields.density.basis_order = 0
-            auxiliary_subfields.vp.basis_order = 0
-            auxiliary_subfields.vs.basis_order = 0            
+            auxiliary_subfields.p_wave_impedance.basis_order = 0
+            auxiliary_subfields.s_wave_impedance.basis_order = 0
             """,
     }
 
@@ -27,9 +27,8 @@ class AuxSubfieldsAbsorbingDampers(PetscComponent):
     DOC_CONFIG = {
         "cfg": """
             [absorbing_dampers_auxiliary_subfields]
-            density.basis_order = 0
-            vp.basis_order = 0
-            vs.basis_order = 0            
+            p_wave_impedance.basis_order = 0
+            s_wave_impedance.basis_order = 0
             """,
     }
 
@@ -37,14 +36,22 @@ class AuxSubfieldsAbsorbingDampers(PetscComponent):
 
     from pylith.topology.Subfield import Subfield
 
+    pWaveImpedance = pythia.pyre.inventory.facility("p_wave_impedance", family="auxiliary_subfield", factory=Subfield)
+    pWaveImpedance.meta['tip'] = "Dilatational (P) wave impedance (density times Vp) subfield."
+
+    sWaveImpedance = pythia.pyre.inventory.facility("s_wave_impedance", family="auxiliary_subfield", factory=Subfield)
+    sWaveImpedance.meta['tip'] = "Shear (S) wave impedance (density times Vs) subfield."
+
+    # Subfields replaced by the impedances in v3.1. They are kept so that parameter files setting their
+    # discretization generate an error with instructions for updating the parameter file.
     density = pythia.pyre.inventory.facility("density", family="auxiliary_subfield", factory=Subfield)
-    density.meta['tip'] = "Mass density subfield."
+    density.meta['tip'] = "Removed; use 'p_wave_impedance' and 's_wave_impedance'."
 
     vs = pythia.pyre.inventory.facility("vs", family="auxiliary_subfield", factory=Subfield)
-    vs.meta['tip'] = "Shear (S) wave speed subfield."
+    vs.meta['tip'] = "Removed; use 's_wave_impedance'."
 
     vp = pythia.pyre.inventory.facility("vp", family="auxiliary_subfield", factory=Subfield)
-    vp.meta['tip'] = "Dilatational (P) wave speed subfield."
+    vp.meta['tip'] = "Removed; use 'p_wave_impedance'."
 
     # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -60,6 +67,29 @@ class AuxSubfieldsAbsorbingDampers(PetscComponent):
         PetscComponent._configure(self)
         return
 
+    def _validate(self, context):
+        """Reject settings for the density, vs, and vp subfields, which were replaced by the impedances.
+        """
+        from pythia.pyre.inventory.Item import Item
+
+        replacements = {
+            "density": ["p_wave_impedance", "s_wave_impedance"],
+            "vs": ["s_wave_impedance"],
+            "vp": ["p_wave_impedance"],
+        }
+        for name, newNames in replacements.items():
+            subfield = getattr(self.inventory, name)
+            for trait in subfield.inventory.properties():
+                descriptor = subfield.getTraitDescriptor(trait.name)
+                if hasattr(descriptor.locator, "source") and descriptor.locator.source == "default":
+                    continue
+                newSettings = " and ".join([f"'auxiliary_subfields.{newName}.{trait.name}'" for newName in newNames])
+                error = ValueError(
+                    f"The '{name}' auxiliary subfield of absorbing dampers was replaced by the P and S wave impedances. "
+                    f"Replace 'auxiliary_subfields.{name}.{trait.name}' with {newSettings}. "
+                    "The spatial database for the auxiliary field still provides density, vp, and vs.")
+                context.error(error, items=[Item(trait, descriptor)])
+
 
 # FACTORIES ////////////////////////////////////////////////////////////
 
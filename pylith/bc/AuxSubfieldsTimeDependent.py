@@ -38,6 +38,9 @@ class AuxSubfieldsTimeDependent(PetscComponent):
     :$t_1(x)$: `rate_start`
     :$f_2(x)$: `time_history_amplitude`
     :$t_2(x)$: `time_history_start`
+
+    Time slices of a space-time field, $f_0(x,t)$, in the `time_slices_amplitude` subfield replace `initial_amplitude`
+    in time-dependent Neumann boundary conditions.
     """
     DOC_CONFIG = {
         "cfg": """
@@ -47,6 +50,7 @@ class AuxSubfieldsTimeDependent(PetscComponent):
             rate_start_time.basis_order = 1
             time_history_amplitude.basis_order = 1
             time_history_start_time.basis_order = 1
+            time_slices_amplitude.basis_order = 1
             """,
     }
 
@@ -70,6 +74,10 @@ class AuxSubfieldsTimeDependent(PetscComponent):
     timeHistoryStart = pythia.pyre.inventory.facility("time_history_start_time", family="auxiliary_subfield", factory=Subfield)
     timeHistoryStart.meta['tip'] = "Time history starting time, t_2(s), subfield."
 
+    timeSlicesAmplitude = pythia.pyre.inventory.facility(
+        "time_slices_amplitude", family="auxiliary_subfield", factory=Subfield)
+    timeSlicesAmplitude.meta['tip'] = "Time slices amplitude, f_0(x,t), subfield."
+
     # PUBLIC METHODS /////////////////////////////////////////////////////
 
     def __init__(self, name="auxfieldstimedependent"):
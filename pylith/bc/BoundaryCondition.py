@@ -25,6 +25,14 @@ def validateLabel(value):
     return value
 
 
+def loadCaseDBFactory(name):
+    """Factory for spatial databases of load cases.
+    """
+    from pythia.pyre.inventory import facility
+    from spatialdata.spatialdb.SimpleDB import SimpleDB
+    return facility(name, family="spatial_database", factory=SimpleDB)
+
+
 class BoundaryCondition(Physics, ModuleBoundaryCondition):
     """
     Abstract base class for boundary conditions.
@@ -41,6 +49,10 @@ class BoundaryCondition(Physics, ModuleBoundaryCondition):
     labelValue = pythia.pyre.inventory.int("label_value", default=1)
     labelValue.meta['tip'] = "Value of label identifying boundary (tag of physical group in Gmsh files)."
 
+    from pylith.utils.EmptyBin import EmptyBin
+    loadCaseDBs = pythia.pyre.inventory.facilityArray("load_case_dbs", itemFactory=loadCaseDBFactory, factory=EmptyBin)
+    loadCaseDBs.meta['tip'] = "Databases for auxiliary field of load cases (names of items are names of load cases)."
+
     def __init__(self, name="boundarycondition"):
         """Constructor.
         """
@@ -57,6 +69,22 @@ class BoundaryCondition(Physics, ModuleBoundaryCondition):
         ModuleBoundaryCondition.setLabelValue(self, self.labelValue)
         return
 
+    def hasLoadCases(self):
+        """Check whether boundary condition has databases for load cases.
+        """
+        return len(self.loadCaseDBs.components()) > 0
+
+    def setLoadCase(self, name):
+        """Set database for auxiliary field to database for load case, or the default database if the boundary
+        condition does not have a database for the load case.
+        """
+        db = self.auxiliaryFieldDB
+        for item in self.loadCaseDBs.components():
+            if item.aliases[-1] == name:
+                db = item
+                break
+        ModuleBoundaryCondition.setAuxiliaryFieldDB(self, db)
+
     def _configure(self):
         """Setup members using inventory.
         """
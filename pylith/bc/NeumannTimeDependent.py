@@ -55,6 +55,12 @@ class NeumannTimeDependent(BoundaryCondition, ModuleNeumannTimeDependent):
     :::{seealso}
     See [`AuxSubfieldsTimeDependent` Component](AuxSubfieldsTimeDependent.md) for the functional form of the time depenence.
     :::
+
+    Spatially varying loads that evolve in time, such as ice sheets or reservoir pressure, can be given as time slices
+    in an HDF5 file with `time_slices_filename` (see {ref}`sec-user-file-formats-time-slices-hdf5`).
+    The values between slices are interpolated linearly in time and replace the initial term, so `use_initial` must
+    be False.
+    Only the two slices bracketing the current time are held in memory.
     """
     DOC_CONFIG = {
         "cfg": """
@@ -96,6 +102,9 @@ class NeumannTimeDependent(BoundaryCondition, ModuleNeumannTimeDependent):
     dbTimeHistory = pythia.pyre.inventory.facility("time_history", factory=NullComponent, family="temporal_database")
     dbTimeHistory.meta['tip'] = "Time history with normalized amplitude as a function of time."
 
+    timeSlicesFilename = pythia.pyre.inventory.str("time_slices_filename", default="")
+    timeSlicesFilename.meta['tip'] = "Name of HDF5 file with time slices of amplitude that replace the initial term (empty for no time slices)."
+
     refDir1 = pythia.pyre.inventory.list("ref_dir_1", default=[0.0, 0.0, 1.0], validator=validateDir)
     refDir1.meta['tip'] = "First choice for reference direction to discriminate among tangential directions in 3D."
 
@@ -130,6 +139,7 @@ class NeumannTimeDependent(BoundaryCondition, ModuleNeumannTimeDependent):
         ModuleNeumannTimeDependent.useTimeHistory(self, self.useTimeHistory)
         if not isinstance(self.dbTimeHistory, NullComponent):
             ModuleNeumannTimeDependent.setTimeHistoryDB(self, self.dbTimeHistory)
+        ModuleNeumannTimeDependent.setTimeSlicesFilename(self, self.timeSlicesFilename)
         return
 
     def _validate(self, context):
@@ -140,6 +150,10 @@ class NeumannTimeDependent(BoundaryCondition, ModuleNeumannTimeDependent):
         if not self.inventory.useTimeHistory and not isinstance(self.inventory.dbTimeHistory, NullComponent):
             self._warning.log(
                 f"Time history for time-dependent Neumann boundary condition '{self.aliases[-1]}' not enabled. Ignoring provided time history database.")
+        if self.inventory.timeSlicesFilename and self.inventory.useInitial:
+            trait = self.inventory.getTrait("use_initial")
+            self._validationError(context, trait,
+                f"Time slices replace the initial term in time-dependent Neumann boundary condition '{self.aliases[-1]}'. Set 'use_initial' to False.")
 
     def _validationError(self, context, trait, msg):
         from pythia.pyre.inventory.Item import Item
@@ -84,6 +84,9 @@ class FaultCohesiveImpulses(FaultCohesive, ModuleFaultCohesiveImpulses):
     impulseDOF = pythia.pyre.inventory.list("impulse_dof", default=[], validator=validateDOF)
     impulseDOF.meta['tip'] = "Indices of impulse components; 0=fault opening, 1=left lateral, 2=reverse (3D only)."
 
+    patchDB = pythia.pyre.inventory.facility("db_patches", family="spatial_database", factory=NullComponent)
+    patchDB.meta['tip'] = "Spatial database with integer 'patch_id' for applying each impulse as uniform slip over a patch (negative=no impulse)."
+
     def __init__(self, name="faultcohesiveimpulses"):
         """
         Initialize configuration.
@@ -104,6 +107,9 @@ class FaultCohesiveImpulses(FaultCohesive, ModuleFaultCohesiveImpulses):
         ModuleFaultCohesiveImpulses.setThreshold(self, self.threshold.value)
         impulseDOF = numpy.array(self.impulseDOF, dtype=numpy.intc)
         ModuleFaultCohesiveImpulses.setImpulseDOF(self, impulseDOF)
+        from pylith.utils.NullComponent import NullComponent
+        if not isinstance(self.patchDB, NullComponent):
+            ModuleFaultCohesiveImpulses.setPatchDB(self, self.patchDB)
   
 
     def verifyConfiguration(self):
@@ -45,6 +45,9 @@ class IncompressibleElasticity(Material, ModuleIncompressibleElasticity):
     useBodyForce = pythia.pyre.inventory.bool("use_body_force", default=False)
     useBodyForce.meta['tip'] = "Include body force term in elasticity equation."
 
+    useStaticCondensation = pythia.pyre.inventory.bool("use_static_condensation", default=False)
+    useStaticCondensation.meta['tip'] = "Eliminate pressure in each cell (requires discontinuous pressure with basis order 0)."
+
     rheology = pythia.pyre.inventory.facility("bulk_rheology", family="incompressible_elasticity_rheology", factory=IsotropicLinearIncompElasticity)
     rheology.meta['tip'] = "Bulk rheology for elastic material."
 
@@ -67,6 +70,7 @@ class IncompressibleElasticity(Material, ModuleIncompressibleElasticity):
         Material.preinitialize(self, problem)
         self.rheology.addAuxiliarySubfields(self, problem)
         ModuleIncompressibleElasticity.useBodyForce(self, self.useBodyForce)
+        ModuleIncompressibleElasticity.useStaticCondensation(self, self.useStaticCondensation)
 
     def _createModuleObj(self):
         """Create handle to C++ IncompressibleElasticity.
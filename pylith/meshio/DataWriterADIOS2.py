@@ -0,0 +1,106 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+
+from .DataWriter import DataWriter
+from .meshio import DataWriterADIOS2 as ModuleDataWriterADIOS2
+
+
+def validateParameters(value):
+    """Validate ADIOS2 engine parameters.
+    """
+    for entry in value:
+        key, sep, _ = entry.partition("=")
+        if not sep or not key.strip():
+            raise ValueError(f"Could not parse ADIOS2 engine parameter '{entry}'. Expected 'KEY=VALUE'.")
+    return value
+
+
+class DataWriterADIOS2(DataWriter, ModuleDataWriterADIOS2):
+    """
+    Writer of solution, auxiliary, and derived subfields using ADIOS2.
+
+    Each process writes the cells it owns as local blocks of ADIOS2 variables; the ADIOS2 engine aggregates the blocks and writes them, optionally asynchronously.
+    The BP5 and BP4 engines write `.bp` files that follow the ADIOS2 VTX schema and can be opened directly in ParaView.
+    The SST engine streams each time step to staging readers, such as in-situ analysis scripts or ParaView/Catalyst, without going through the file system.
+
+    Requires PyLith to be configured with `--enable-adios2`.
+
+    Implements `DataWriter`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [data_writer]
+            filename = domain_solution.bp
+            engine = BP5
+            engine_parameters = [NumAggregators=4, AsyncWrite=true]
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    filename = pythia.pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Name of ADIOS2 file (BP engines) or stream (SST engine)."
+
+    engine = pythia.pyre.inventory.str("engine", default="BP5", validator=pythia.pyre.inventory.choice(["BP5", "BP4", "SST"]))
+    engine.meta['tip'] = "ADIOS2 engine."
+
+    engineParameters = pythia.pyre.inventory.list("engine_parameters", default=[], validator=validateParameters)
+    engineParameters.meta['tip'] = "ADIOS2 engine parameters as KEY=VALUE (for example, NumAggregators=4, AsyncWrite=true)."
+
+    def __init__(self, name="datawriteradios2"):
+        """Constructor.
+        """
+        DataWriter.__init__(self, name)
+        ModuleDataWriterADIOS2.__init__(self)
+
+    def preinitialize(self):
+        """Initialize writer.
+        """
+        DataWriter.preinitialize(self)
+
+        ModuleDataWriterADIOS2.setEngine(self, self.engine)
+        for entry in self.engineParameters:
+            key, _, value = entry.partition("=")
+            ModuleDataWriterADIOS2.setEngineParameter(self, key.strip(), value.strip())
+
+    def setFilename(self, outputDir, simName, label):
+        """Set filename from default options and inventory. If filename is given in inventory, use it,
+        otherwise create filename from default options.
+        """
+        filename = self.filename or DataWriter.mkfilename(outputDir, simName, label, "bp")
+        self.mkpath(filename)
+        ModuleDataWriterADIOS2.filename(self, filename)
+
+    def _configure(self):
+        """Configure object.
+        """
+        DataWriter._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object."""
+        ModuleDataWriterADIOS2.__init__(self)
+        return
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def data_writer():
+    """Factory associated with DataWriter.
+    """
+    return DataWriterADIOS2()
+
+
+# End of file
@@ -27,6 +27,10 @@ class DataWriterHDF5(DataWriter, ModuleDataWriterHDF5):
         "cfg": """
             [data_writer]
             filename = domain_solution.h5
+            compression = deflate
+            compression_level = 6
+            chunk_num_steps = 64
+            chunk_num_points = 512
         """
     }
     
@@ -36,6 +40,28 @@ class DataWriterHDF5(DataWriter, ModuleDataWriterHDF5):
     filename = pythia.pyre.inventory.str("filename", default="")
     filename.meta['tip'] = "Name of HDF5 file."
 
+    collectiveIO = pythia.pyre.inventory.bool("collective_io", default=False)
+    collectiveIO.meta['tip'] = "Use collective MPI-IO so the MPI-IO layer can aggregate writes onto a subset of processes."
+
+    compression = pythia.pyre.inventory.str("compression", default="none",
+                                            validator=pythia.pyre.inventory.choice(["none", "deflate", "zstd", "szip"]))
+    compression.meta['tip'] = "Compression filter for field datasets ('zstd' requires the HDF5 filter plugin)."
+
+    compressionLevel = pythia.pyre.inventory.int("compression_level", default=6, validator=pythia.pyre.inventory.greater(0))
+    compressionLevel.meta['tip'] = "Compression level (deflate: 1-9, zstd: 1-22, szip: pixels per block)."
+
+    chunkNumSteps = pythia.pyre.inventory.int("chunk_num_steps", default=1, validator=pythia.pyre.inventory.greater(0))
+    chunkNumSteps.meta['tip'] = "Number of time steps in each chunk of field datasets; values are buffered in memory for this many time steps (use > 1 for fast time series extraction)."
+
+    chunkNumPoints = pythia.pyre.inventory.int("chunk_num_points", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    chunkNumPoints.meta['tip'] = "Number of points in each chunk of field datasets (0 means all points)."
+
+    mantissaBits = pythia.pyre.inventory.int("mantissa_bits", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    mantissaBits.meta['tip'] = "Number of bits retained in mantissa of floating point values (0 means lossless)."
+
+    sharedMesh = pythia.pyre.inventory.bool("shared_mesh", default=False)
+    sharedMesh.meta['tip'] = "Write mesh topology and geometry once to a shared '_mesh.h5' file referenced via HDF5 external links."
+
     def __init__(self, name="datawriterhdf5"):
         """Constructor.
         """
@@ -46,6 +72,18 @@ class DataWriterHDF5(DataWriter, ModuleDataWriterHDF5):
         """Initialize writer.
         """
         DataWriter.preinitialize(self)
+        ModuleDataWriterHDF5.useCollectiveIO(self, self.collectiveIO)
+
+        mapCompression = {
+            "none": ModuleDataWriterHDF5.COMPRESSION_NONE,
+            "deflate": ModuleDataWriterHDF5.COMPRESSION_DEFLATE,
+            "zstd": ModuleDataWriterHDF5.COMPRESSION_ZSTD,
+            "szip": ModuleDataWriterHDF5.COMPRESSION_SZIP,
+        }
+        ModuleDataWriterHDF5.setCompression(self, mapCompression[self.compression], self.compressionLevel)
+        ModuleDataWriterHDF5.setChunkShape(self, self.chunkNumSteps, self.chunkNumPoints)
+        ModuleDataWriterHDF5.setMantissaBits(self, self.mantissaBits)
+        ModuleDataWriterHDF5.setSharedMesh(self, self.sharedMesh)
 
     def setFilename(self, outputDir, simName, label):
         """Set filename from default options and inventory. If filename is given in inventory, use it,
@@ -27,6 +27,10 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
         "cfg": """
             [data_writer]
             filename = domain_solution.h5
+            aggregation_ratio = 32
+            num_steps_preallocated = 100
+            staging_dir = /local/scratch/pylith
+            async_writes = False
         """
     }
 
@@ -35,6 +39,18 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
     filename = pythia.pyre.inventory.str("filename", default="")
     filename.meta['tip'] = "Name of HDF5 file."
 
+    aggregationRatio = pythia.pyre.inventory.int("aggregation_ratio", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    aggregationRatio.meta['tip'] = "Number of processes per writer process for external datasets (0 means write through process 0)."
+
+    numStepsPreallocated = pythia.pyre.inventory.int("num_steps_preallocated", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    numStepsPreallocated.meta['tip'] = "Number of time steps in each preallocated block of external datasets (0 means extend datasets every time step)."
+
+    stagingDir = pythia.pyre.inventory.str("staging_dir", default="")
+    stagingDir.meta['tip'] = "Node-local directory for staging external datasets that are drained to the external files in the background (empty means write directly)."
+
+    asyncWrites = pythia.pyre.inventory.bool("async_writes", default=False)
+    asyncWrites.meta['tip'] = "Write external datasets using nonblocking MPI-IO so writing overlaps with the computation."
+
     def __init__(self, name="datawriterhdf5"):
         """Constructor.
         """
@@ -44,6 +60,10 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
         """Initialize writer.
         """
         DataWriter.preinitialize(self)
+        ModuleDataWriterHDF5Ext.setAggregationRatio(self, self.aggregationRatio)
+        ModuleDataWriterHDF5Ext.setNumStepsPreallocated(self, self.numStepsPreallocated)
+        ModuleDataWriterHDF5Ext.setStagingDir(self, self.stagingDir)
+        ModuleDataWriterHDF5Ext.setUseAsyncWrites(self, self.asyncWrites)
 
     def setFilename(self, outputDir, simName, label):
         """Set filename from default options and inventory. If filename is given in inventory, use it,
@@ -0,0 +1,80 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .DataWriter import DataWriter
+from .meshio import DataWriterHDF5GreensFns as ModuleDataWriterHDF5GreensFns
+
+
+class DataWriterHDF5GreensFns(DataWriter, ModuleDataWriterHDF5GreensFns):
+    """
+    Writer of Green's functions to an HDF5 file with one matrix [impulse, value] per subfield.
+
+    Impulses are buffered in memory and written in blocks to a single chunked dataset per subfield, so
+    inversion codes can read the Green's functions matrix directly. No Xdmf file is generated.
+
+    Implements `DataWriter`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [data_writer]
+            filename = greensfns_points.h5
+            block_size = 128
+        """
+    }
+    
+
+    import pythia.pyre.inventory
+
+    filename = pythia.pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Name of HDF5 file."
+
+    blockSize = pythia.pyre.inventory.int("block_size", default=64, validator=pythia.pyre.inventory.greater(0))
+    blockSize.meta['tip'] = "Number of impulses buffered in memory before writing them to the file as a block."
+
+    def __init__(self, name="datawriterhdf5greensfns"):
+        """Constructor.
+        """
+        DataWriter.__init__(self, name)
+        ModuleDataWriterHDF5GreensFns.__init__(self)
+
+    def preinitialize(self):
+        """Initialize writer.
+        """
+        DataWriter.preinitialize(self)
+        ModuleDataWriterHDF5GreensFns.setBlockSize(self, self.blockSize)
+
+    def setFilename(self, outputDir, simName, label):
+        """Set filename from default options and inventory. If filename is given in inventory, use it,
+        otherwise create filename from default options.
+        """
+        filename = self.filename or DataWriter.mkfilename(outputDir, simName, label, "h5")
+        self.mkpath(filename)
+        ModuleDataWriterHDF5GreensFns.filename(self, filename)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object."""
+        ModuleDataWriterHDF5GreensFns.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def data_writer():
+    """Factory associated with DataWriter.
+    """
+    return DataWriterHDF5GreensFns()
+
+
+# End of file
@@ -0,0 +1,93 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+
+from .DataWriter import DataWriter
+from .meshio import DataWriterPVTU as ModuleDataWriterPVTU
+
+
+class DataWriterPVTU(DataWriter, ModuleDataWriterPVTU):
+    """
+    Writer of solution, auxiliary, and derived subfields to partitioned XML VTK files.
+
+    Each process writes its own piece (`.vtu`) of each time step in parallel with raw binary appended data.
+    Process 0 writes the parallel VTK file (`.pvtu`) for each time step referencing the pieces and a collection file (`.pvd`) with the times of the time steps.
+    Open the `.pvd` file in ParaView or VisIt to view all of the time steps.
+
+    Implements `DataWriter`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [data_writer]
+            filename = domain_solution.pvtu
+            time_format = %0.2f
+            time_constant = 1.0*year
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    filename = pythia.pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Name of parallel VTK file."
+
+    timeFormat = pythia.pyre.inventory.str("time_format", default="%f")
+    timeFormat.meta['tip'] = "C style format string for time stamp in filename."
+
+    from pythia.pyre.units.time import second
+    timeConstant = pythia.pyre.inventory.dimensional("time_constant", default=1.0 * second, validator=pythia.pyre.inventory.greater(0.0 * second))
+    timeConstant.meta['tip'] = "Values used to normalize time stamp in filename."
+
+    def __init__(self, name="datawriterpvtu"):
+        """Constructor.
+        """
+        DataWriter.__init__(self, name)
+        ModuleDataWriterPVTU.__init__(self)
+
+    def preinitialize(self):
+        """Initialize writer.
+        """
+        DataWriter.preinitialize(self)
+
+        ModuleDataWriterPVTU.timeFormat(self, self.timeFormat)
+        ModuleDataWriterPVTU.timeConstant(self, self.timeConstant.value)
+
+    def setFilename(self, outputDir, simName, label):
+        """Set filename from default options and inventory. If filename is given in inventory, use it,
+        otherwise create filename from default options.
+        """
+        filename = self.filename or DataWriter.mkfilename(outputDir, simName, label, "pvtu")
+        self.mkpath(filename)
+        ModuleDataWriterPVTU.filename(self, filename)
+
+    def _configure(self):
+        """Configure object.
+        """
+        DataWriter._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object."""
+        ModuleDataWriterPVTU.__init__(self)
+        return
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def data_writer():
+    """Factory associated with DataWriter.
+    """
+    return DataWriterPVTU()
+
+
+# End of file
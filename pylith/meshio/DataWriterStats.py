@@ -0,0 +1,83 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+
+from .DataWriter import DataWriter
+from .meshio import DataWriterStats as ModuleDataWriterStats
+
+
+class DataWriterStats(DataWriter, ModuleDataWriterStats):
+    """
+    Writer of global statistics (min, max, and L2 norm of each component) of solution, auxiliary, and derived
+    subfields to an ASCII file.
+
+    The statistics are computed in parallel with a single global reduction per subfield, so they can be written at
+    every time step with negligible cost and file size. Each line of the file contains the time, subfield name,
+    component name, minimum, maximum, and L2 norm (square root of the sum of squares of the values).
+
+    Implements `DataWriter`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [data_writer]
+            filename = domain_stats.txt
+            float_precision = 8
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    filename = pythia.pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Name of ASCII file for statistics."
+
+    precision = pythia.pyre.inventory.int("float_precision", default=6, validator=pythia.pyre.inventory.greater(0))
+    precision.meta['tip'] = "Precision of floating point values in output."
+
+    def __init__(self, name="datawriterstats"):
+        """Constructor.
+        """
+        DataWriter.__init__(self, name)
+        ModuleDataWriterStats.__init__(self)
+
+    def preinitialize(self):
+        """Initialize writer.
+        """
+        DataWriter.preinitialize(self)
+
+        ModuleDataWriterStats.setPrecision(self, self.precision)
+
+    def setFilename(self, outputDir, simName, label):
+        """Set filename from default options and inventory. If filename is given in inventory, use it,
+        otherwise create filename from default options.
+        """
+        filename = self.filename or DataWriter.mkfilename(outputDir, simName, label, "txt")
+        self.mkpath(filename)
+        ModuleDataWriterStats.setFilename(self, filename)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object."""
+        ModuleDataWriterStats.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def data_writer():
+    """Factory associated with DataWriter.
+    """
+    return DataWriterStats()
+
+
+# End of file
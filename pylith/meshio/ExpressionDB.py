@@ -0,0 +1,118 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/meshio/ExpressionDB.py
+#
+# @brief Python object for spatial database with values given by analytical expressions of the coordinates.
+#
+# Factory: spatial_database
+
+from spatialdata.spatialdb.SpatialDBObj import SpatialDBObj
+from .meshio import ExpressionDB as ModuleExpressionDB
+
+
+class ExpressionDB(SpatialDBObj, ModuleExpressionDB):
+    """
+    Spatial database with values given by analytical expressions of the coordinates `x`, `y`, and `z`.
+
+    Expressions contain numbers, the coordinates, the constants `pi` and `e`, the operators `+ - * / ^`, comparisons
+    `< <= > >= == !=`, logical operators `&& || !`, and the functions `sin`, `cos`, `tan`, `asin`, `acos`, `atan`,
+    `atan2`, `sinh`, `cosh`, `tanh`, `exp`, `log`, `log10`, `sqrt`, `abs`, `floor`, `ceil`, `min`, `max`, `pow`, and
+    `if(condition, a, b)`. Coordinates not present in the spatial dimension of the domain are zero.
+
+    The expressions are compiled once and evaluated for many points together, which is much faster than
+    interpolating the values from a `SimpleDB` or `SimpleGridDB` file.
+
+    Implements `SpatialDB`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.problem.materials.crust]
+            db_auxiliary_field = pylith.meshio.ExpressionDB
+            db_auxiliary_field.description = Material properties varying with depth
+            db_auxiliary_field.values = [density, vs, vp]
+            db_auxiliary_field.expressions = [2500 - 0.05*z, 3000 - 0.1*z, sqrt(3)*(3000 - 0.1*z)]
+            db_auxiliary_field.units = [kg/m**3, m/s, m/s]
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    values = pythia.pyre.inventory.list("values", default=[])
+    values.meta['tip'] = "Names of values in spatial database."
+
+    expressions = pythia.pyre.inventory.list("expressions", default=[])
+    expressions.meta['tip'] = "Expressions of coordinates x, y, and z for values (one for each value)."
+
+    units = pythia.pyre.inventory.list("units", default=[])
+    units.meta['tip'] = "Units of values (one for each value)."
+
+    from spatialdata.geocoords.CSCart import CSCart
+    coordsys = pythia.pyre.inventory.facility("coordsys", family="coordsys", factory=CSCart)
+    coordsys.meta['tip'] = "Coordinate system of coordinates in expressions."
+
+    def __init__(self, name="expressiondb"):
+        """Constructor.
+        """
+        SpatialDBObj.__init__(self, name)
+
+    def _configure(self):
+        """Set members based on inventory.
+        """
+        SpatialDBObj._configure(self)
+        self.expressions = self._joinArguments(self.expressions)
+        if len(self.expressions) != len(self.values):
+            raise ValueError(f"Number of expressions ({len(self.expressions)}) must match number of values "
+                             f"({len(self.values)}) in expression spatial database '{self.description}'.")
+        if len(self.units) != len(self.values):
+            raise ValueError(f"Number of units ({len(self.units)}) must match number of values "
+                             f"({len(self.values)}) in expression spatial database '{self.description}'.")
+        ModuleExpressionDB.setValueNames(self, self.values)
+        ModuleExpressionDB.setExpressions(self, self.expressions)
+        ModuleExpressionDB.setUnits(self, self.units)
+        ModuleExpressionDB.setCoordSys(self, self.coordsys)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleExpressionDB.__init__(self)
+
+    @staticmethod
+    def _joinArguments(items):
+        """Join items split at commas separating arguments of functions.
+
+        Pyre splits lists at every comma, including the commas within parentheses of expressions like `max(x, y)`.
+        """
+        expressions = []
+        current = None
+        for item in items:
+            current = item if current is None else current + "," + item
+            if current.count("(") <= current.count(")"):
+                expressions.append(current.strip())
+                current = None
+        if current is not None:
+            expressions.append(current.strip())
+        return expressions
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def spatial_database():
+    """Factory associated with ExpressionDB.
+    """
+    return ExpressionDB()
+
+
+# End of file
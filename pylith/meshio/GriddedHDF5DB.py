@@ -0,0 +1,133 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/meshio/GriddedHDF5DB.py
+#
+# @brief Python object for spatial database with values on a logically rectangular grid stored in an HDF5 file.
+#
+# Factory: spatial_database
+
+from spatialdata.spatialdb.SpatialDBObj import SpatialDBObj
+from .meshio import GriddedHDF5DB as ModuleGriddedHDF5DB
+
+
+class GriddedHDF5DB(SpatialDBObj, ModuleGriddedHDF5DB):
+    """
+    Spatial database with values on a logically rectangular grid stored in an HDF5 file.
+
+    The grid coordinates along each axis are 1D datasets `/coordinates/x`, `/coordinates/y`, and `/coordinates/z`
+    (as needed for the spatial dimension) with strictly increasing values. Each value is a dataset `/values/NAME`
+    with dimensions (numX, numY, numZ) and a string attribute `units`. Use `write()` to create a file.
+
+    The grid is read in blocks as query points fall within them, so each process only reads the part of the grid
+    covering its part of the domain. This is much faster than `SimpleDB` and `SimpleGridDB` for large 3D models.
+    With `shared_memory` turned on, the entire grid is read once per compute node into memory shared by all of the
+    processes on the node, so the memory use does not grow with the number of processes per node.
+
+    Implements `SpatialDB`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.problem.materials.crust]
+            db_auxiliary_field = pylith.meshio.GriddedHDF5DB
+            db_auxiliary_field.description = Velocity model
+            db_auxiliary_field.filename = cvm.h5
+            db_auxiliary_field.query_type = linear
+            db_auxiliary_field.coordsys = spatialdata.geocoords.CSGeo
+            db_auxiliary_field.coordsys.crs_string = EPSG:4326
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    filename = pythia.pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Name of HDF5 file for database."
+
+    queryType = pythia.pyre.inventory.str("query_type", default="linear",
+                                          validator=pythia.pyre.inventory.choice(["nearest", "linear"]))
+    queryType.meta['tip'] = "Type of query to perform."
+
+    blockSize = pythia.pyre.inventory.int("block_size", default=32, validator=pythia.pyre.inventory.greater(0))
+    blockSize.meta['tip'] = "Number of grid cells along each axis in blocks read from the file."
+
+    sharedMemory = pythia.pyre.inventory.bool("shared_memory", default=False)
+    sharedMemory.meta['tip'] = "Read entire grid once per compute node into memory shared by the processes on the node."
+
+    from spatialdata.geocoords.CSCart import CSCart
+    coordsys = pythia.pyre.inventory.facility("coordsys", family="coordsys", factory=CSCart)
+    coordsys.meta['tip'] = "Coordinate system of grid coordinates."
+
+    def __init__(self, name="griddedhdf5db"):
+        """Constructor.
+        """
+        SpatialDBObj.__init__(self, name)
+
+    def _configure(self):
+        """Set members based on inventory.
+        """
+        SpatialDBObj._configure(self)
+        ModuleGriddedHDF5DB.setFilename(self, self.filename)
+        ModuleGriddedHDF5DB.setQueryType(self, self._parseQueryString(self.queryType))
+        ModuleGriddedHDF5DB.setBlockSize(self, self.blockSize)
+        ModuleGriddedHDF5DB.setSharedMemory(self, self.sharedMemory)
+        ModuleGriddedHDF5DB.setCoordSys(self, self.coordsys)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleGriddedHDF5DB.__init__(self)
+
+    def _parseQueryString(self, label):
+        if label.lower() == "nearest":
+            value = ModuleGriddedHDF5DB.NEAREST
+        elif label.lower() == "linear":
+            value = ModuleGriddedHDF5DB.LINEAR
+        else:
+            raise ValueError("Unknown value for query type '%s'." % label)
+        return value
+
+
+def write(filename, data):
+    """Write gridded HDF5 spatial database.
+
+    Args:
+        filename: Name of HDF5 file.
+        data: Dictionary with the coordinates of the grid along each axis ('x', 'y', 'z' as needed for the spatial
+            dimension) and 'values', a list of dictionaries with 'name', 'units', and 'data'. The data for each value
+            has shape (numX, numY, numZ) or is the flattened array in that order.
+    """
+    import h5py
+    import numpy
+
+    axes = [axis for axis in ["x", "y", "z"] if axis in data]
+    shape = tuple([len(data[axis]) for axis in axes])
+    with h5py.File(filename, "w") as h5:
+        for axis in axes:
+            h5.create_dataset(f"coordinates/{axis}", data=numpy.array(data[axis], dtype=numpy.float64))
+        for value in data["values"]:
+            dataset = h5.create_dataset(f"values/{value['name']}",
+                                        data=numpy.array(value["data"], dtype=numpy.float64).reshape(shape))
+            dataset.attrs["units"] = numpy.string_(value.get("units", "none"))
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def spatial_database():
+    """Factory associated with GriddedHDF5DB.
+    """
+    return GriddedHDF5DB()
+
+
+# End of file
@@ -51,6 +51,7 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
             [pylithapp.mesh_generator.reader]
             filename = mesh_quad.exo
             use_nodeset_names = True
+            use_parallel_read = False
             coordsys.space_dim = 2
         """
     }
@@ -63,6 +64,9 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
     useNames = pythia.pyre.inventory.bool("use_nodeset_names", default=True)
     useNames.meta['tip'] = "Use nodeset names instead of ids."
 
+    useParallelRead = pythia.pyre.inventory.bool("use_parallel_read", default=False)
+    useParallelRead.meta['tip'] = "Read contiguous chunks of the vertices and cells on each process."
+
     from spatialdata.geocoords.CSCart import CSCart
     coordsys = pythia.pyre.inventory.facility("coordsys", family="coordsys", factory=CSCart)
     coordsys.meta['tip'] = "Coordinate system associated with mesh."
@@ -77,6 +81,7 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
         MeshIOObj.preinitialize(self)
         ModuleMeshIOCubit.setFilename(self, self.filename)
         ModuleMeshIOCubit.setUseNodesetNames(self, self.useNames)
+        ModuleMeshIOCubit.setUseParallelRead(self, self.useParallelRead)
 
     def _configure(self):
         """Set members based using inventory.
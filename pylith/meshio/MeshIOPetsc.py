@@ -21,6 +21,7 @@ class MeshIOPetsc(MeshIOObj, ModuleMeshIOPetsc):
     """
     Python object for a variety of reading/writing finite-element meshes using PETSc.
     Currently, the primary use of this object is to import meshes from Gmsh.
+    It also reads and writes meshes in the PETSc DMPlex HDF5 format (extension `.h5`), which is read in parallel.
 
     :::{warning}
     The coordinate system associated with the mesh must be a Cartesian coordinate system, such as a generic Cartesian coordinate system or a geographic projection.
@@ -37,6 +38,12 @@ class MeshIOPetsc(MeshIOObj, ModuleMeshIOPetsc):
     prefix = pythia.pyre.inventory.str("options_prefix", default="")
     prefix.meta['tip'] = "Name of PETSc options prefix for this mesh."
 
+    hdf5Layout = pythia.pyre.inventory.str("hdf5_layout", default="petsc", validator=pythia.pyre.inventory.choice(["petsc", "xdmf"]))
+    hdf5Layout.meta['tip'] = "Layout of PETSc DMPlex HDF5 file ['petsc' (written by PyLith), 'xdmf' (legacy PETSc layout)]."
+
+    fixGmshLabels = pythia.pyre.inventory.bool("fix_gmsh_labels", default=False)
+    fixGmshLabels.meta['tip'] = "Convert labels in PETSc DMPlex HDF5 file from Gmsh conventions (for files converted from Gmsh by PETSc)."
+
     from spatialdata.geocoords.CSCart import CSCart
     coordsys = pythia.pyre.inventory.facility("coordsys", family="coordsys", factory=CSCart)
     coordsys.meta['tip'] = "Coordinate system associated with mesh."
@@ -51,6 +58,12 @@ class MeshIOPetsc(MeshIOObj, ModuleMeshIOPetsc):
         MeshIOObj.preinitialize(self)
         ModuleMeshIOPetsc.setFilename(self, self.filename)
         ModuleMeshIOPetsc.setPrefix(self, self.prefix)
+        layouts = {
+            "petsc": ModuleMeshIOPetsc.HDF5_PETSC,
+            "xdmf": ModuleMeshIOPetsc.HDF5_XDMF,
+        }
+        ModuleMeshIOPetsc.setHDF5Layout(self, layouts[self.hdf5Layout])
+        ModuleMeshIOPetsc.setFixGmshLabels(self, self.fixGmshLabels)
 
     def _configure(self):
         """Set members based using inventory.
@@ -35,6 +35,9 @@ class OutputObserver(PetscComponent, ModuleOutputObserver):
     outputBasisOrder = pythia.pyre.inventory.int("output_basis_order", default=1, validator=pythia.pyre.inventory.choice([0,1]))
     outputBasisOrder.meta['tip'] = "Basis order for output."
 
+    loadCase = pythia.pyre.inventory.str("load_case", default="")
+    loadCase.meta['tip'] = "Name of load case written by observer in runs with multiple load cases (empty for first load case)."
+
     def __init__(self, name="outputobserver"):
         """Constructor.
         """
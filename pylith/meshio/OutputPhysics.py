@@ -67,6 +67,7 @@ class OutputPhysics(OutputObserver, ModuleOutputPhysics):
         OutputObserver.preinitialize(self, problem)
         ModuleOutputPhysics.setInfoFields(self, self.infoFields)
         ModuleOutputPhysics.setDataFields(self, self.dataFields)
+        ModuleOutputPhysics.setLoadCase(self, self.loadCase)
 
         self.writer.setFilename(problem.defaults.outputDir, problem.defaults.simName, identifier)
 
@@ -0,0 +1,109 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pythia.pyre/meshio/OutputPhysicsCoulombStress.py
+#
+# @brief Python object for managing output of Coulomb failure stress change on receiver faults at points.
+#
+# Factory: observer
+
+from .OutputPhysicsPoints import OutputPhysicsPoints
+from .meshio import OutputPhysicsCoulombStress as ModuleOutputPhysicsCoulombStress
+
+
+class OutputPhysicsCoulombStress(OutputPhysicsPoints, ModuleOutputPhysicsCoulombStress):
+    """
+    Output of Coulomb failure stress change on receiver faults at discrete points in a material.
+
+    The Cauchy stress is interpolated to the points, and the change in stress relative to the stress at the start of the simulation is resolved onto the receiver fault at each point.
+    The spatial database for the receivers provides the strike, dip, and rake (degrees, with x east, y north, and z up) and the effective coefficient of friction (`friction_coefficient`) at each point.
+    The output contains the Coulomb failure stress change (`coulomb_stress_change`), which is the change in shear stress in the rake direction (`shear_stress_change`) plus the effective coefficient of friction times the change in normal stress (`normal_stress_change`, tension is positive).
+    The `data_fields` property is not used.
+    Only points in cells of the material are included in the output.
+    This observer requires a 3D domain.
+
+    Implements `OutputObserver`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.problem.materials.elastic.observers.receivers]
+            # List of points on receiver faults.
+            reader = pylith.meshio.PointsList
+            reader.filename = receivers.txt
+
+            # Strike, dip, rake, and friction_coefficient of receiver faults.
+            db_receivers = spatialdata.spatialdb.SimpleDB
+            db_receivers.description = Receiver faults
+            db_receivers.iohandler.filename = receivers.spatialdb
+
+            # Write output to HDF5 file with name `receivers.h5`.
+            writer = pylith.meshio.DataWriterHDF5
+            writer.filename = receivers.h5
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    from spatialdata.spatialdb.SimpleDB import SimpleDB
+    receiversDB = pythia.pyre.inventory.facility("db_receivers", family="spatial_database", factory=SimpleDB)
+    receiversDB.meta['tip'] = "Spatial database with strike, dip, rake (degrees), and friction_coefficient of receiver faults."
+
+    def __init__(self, name="outputphysicscoulombstress"):
+        """Constructor.
+        """
+        OutputPhysicsPoints.__init__(self, name)
+
+    def preinitialize(self, problem, identifier):
+        """Do mimimal initialization.
+        """
+        OutputPhysicsPoints.preinitialize(self, problem, identifier)
+
+        import numpy
+        stationNames, stationCoords = self.reader.read()
+
+        # Convert to mesh coordinate system
+        from spatialdata.geocoords.Converter import convert
+        cs = problem.mesh().getCoordSys()
+        convert(stationCoords, cs, self.reader.coordsys)
+
+        numPoints = stationCoords.shape[0]
+        values = numpy.zeros((numPoints, 4), dtype=numpy.float64)
+        err = numpy.zeros((numPoints,), dtype=numpy.intc)
+        self.receiversDB.open()
+        self.receiversDB.setQueryValues(["strike", "dip", "rake", "friction_coefficient"])
+        self.receiversDB.multiquery(values, err, stationCoords, cs)
+        self.receiversDB.close()
+        if numpy.any(err):
+            missing = [name for name, flag in zip(stationNames, err) if flag]
+            raise ValueError(f"Could not find receiver fault values for points {missing} in spatial database "
+                             f"'{self.receiversDB.description}' for Coulomb stress output '{self.aliases[-1]}'.")
+        values[:, 0:3] = numpy.radians(values[:, 0:3])
+        ModuleOutputPhysicsCoulombStress.setReceivers(self, values)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleOutputPhysicsCoulombStress.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def observer():
+    """Factory associated with OutputObserver.
+    """
+    return OutputPhysicsCoulombStress()
+
+
+# End of file
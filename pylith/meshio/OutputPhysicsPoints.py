@@ -0,0 +1,94 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pythia.pyre/meshio/OutputPhysicsPoints.py
+#
+# @brief Python object for managing output of derived fields of physics at points.
+#
+# Factory: observer
+
+from .OutputPhysics import OutputPhysics
+from .meshio import OutputPhysicsPoints as ModuleOutputPhysicsPoints
+
+
+class OutputPhysicsPoints(OutputPhysics, ModuleOutputPhysicsPoints):
+    """
+    Output of derived subfields of a material (for example, stress and strain) at discrete points in the domain.
+
+    Only points in cells of the material are included in the output.
+
+    Implements `OutputObserver`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.problem.materials.elastic.observers.stations]
+            data_fields = [cauchy_stress, cauchy_strain]
+
+            # List of points where we want output.
+            reader = pylith.meshio.PointsList
+            reader.filename = strainmeters.txt
+
+            # Write output to HDF5 file with name `strainmeters.h5`.
+            writer = pylith.meshio.DataWriterHDF5
+            writer.filename = strainmeters.h5
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    from .PointsList import PointsList
+    reader = pythia.pyre.inventory.facility("reader", factory=PointsList, family="points_list")
+    reader.meta['tip'] = "Reader for points list."
+
+    useInterpolationMatrix = pythia.pyre.inventory.bool("use_interpolation_matrix", default=True)
+    useInterpolationMatrix.meta['tip'] = "Interpolate requested subfields using basis functions tabulated once at the points (sparse matrix-vector product)."
+
+    def __init__(self, name="outputphysicspoints"):
+        """Constructor.
+        """
+        OutputPhysics.__init__(self, name)
+
+    def preinitialize(self, problem, identifier):
+        """Do mimimal initialization.
+        """
+        OutputPhysics.preinitialize(self, problem, identifier)
+
+        stationNames, stationCoords = self.reader.read()
+
+        # Convert to mesh coordinate system
+        from spatialdata.geocoords.Converter import convert
+        convert(stationCoords, problem.mesh().getCoordSys(), self.reader.coordsys)
+
+        # Nondimensionalize
+        stationCoords /= problem.normalizer.lengthScale.value
+
+        ModuleOutputPhysicsPoints.setPoints(self, stationCoords, stationNames)
+        ModuleOutputPhysicsPoints.useInterpolationMatrix(self, self.useInterpolationMatrix)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleOutputPhysicsPoints.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def observer():
+    """Factory associated with OutputObserver.
+    """
+    return OutputPhysicsPoints()
+
+
+# End of file
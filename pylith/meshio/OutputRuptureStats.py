@@ -0,0 +1,118 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/meshio/OutputRuptureStats.py
+#
+# @brief Python object for computing earthquake source statistics on a fault during a simulation.
+#
+# Factory: observer
+
+from pylith.utils.PetscComponent import PetscComponent
+from .meshio import OutputRuptureStats as ModuleOutputRuptureStats
+
+
+def validateFilename(value):
+    """Validate filename for output.
+    """
+    if len(value) > 0 and not value.endswith(".py"):
+        raise ValueError("Filename for rupture statistics must have a '.py' suffix.")
+    return value
+
+
+class OutputRuptureStats(PetscComponent, ModuleOutputRuptureStats):
+    """
+    Compute rupture area, potency, and seismic moment for a fault with prescribed slip at each output step.
+
+    The statistics are the same as those computed by `pylith_eqinfo` from the fault output, but they are computed
+    during the simulation with parallel reductions over the fault, so the slip does not need to be written to the
+    fault output. The file is a Python module with the `RuptureStats` object used by `pylith_eqinfo`.
+
+    Implements `ObserverPhysics`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.problem.interfaces.fault]
+            observers = [domain, rupture_stats]
+            observers.rupture_stats = pylith.meshio.OutputRuptureStats
+
+            [pylithapp.problem.interfaces.fault.observers.rupture_stats]
+            trigger.num_skip = 0
+            db_properties = spatialdata.spatialdb.SimpleDB
+            db_properties.description = Elastic properties
+            db_properties.iohandler.filename = mat_elastic.spatialdb
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    from .OutputTriggerStep import OutputTriggerStep
+    trigger = pythia.pyre.inventory.facility("trigger", family="output_trigger", factory=OutputTriggerStep)
+    trigger.meta['tip'] = "Trigger defining how often statistics are computed."
+
+    from spatialdata.spatialdb.SimpleDB import SimpleDB
+    dbProperties = pythia.pyre.inventory.facility("db_properties", family="spatial_database", factory=SimpleDB)
+    dbProperties.meta['tip'] = "Spatial database with density and shear wave speed (vs) for shear modulus."
+
+    filename = pythia.pyre.inventory.str("filename", default="", validator=validateFilename)
+    filename.meta['tip'] = "Name of output file (default is constructed from simulation name and fault name)."
+
+    def __init__(self, name="outputrupturestats"):
+        """Constructor.
+        """
+        PetscComponent.__init__(self, name, facility="observer")
+
+    def preinitialize(self, problem, identifier):
+        """Do mimimal initialization.
+        """
+        import os
+
+        self._createModuleObj()
+        ModuleOutputRuptureStats.setIdentifier(self, self.aliases[-1])
+
+        self.trigger.preinitialize()
+        ModuleOutputRuptureStats.setTrigger(self, self.trigger)
+        ModuleOutputRuptureStats.setPropertiesDB(self, self.dbProperties)
+
+        ModuleOutputRuptureStats.setFaultName(self, identifier.replace("-", "_"))
+        filename = self.filename or os.path.join(problem.defaults.outputDir,
+                                                 "{}-{}_rupture_stats.py".format(problem.defaults.simName, identifier))
+        self._mkpath(filename)
+        ModuleOutputRuptureStats.setFilename(self, filename)
+
+    def _mkpath(self, filename):
+        """Create path for output file.
+        """
+        import os
+        from pylith.mpi.Communicator import mpi_is_root
+
+        relpath = os.path.dirname(filename)
+        if relpath and not os.path.exists(relpath) and mpi_is_root():
+            os.makedirs(relpath)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleOutputRuptureStats.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def observer():
+    """Factory associated with OutputRuptureStats.
+    """
+    return OutputRuptureStats()
+
+
+# End of file
@@ -39,6 +39,7 @@ class OutputSoln(OutputObserver, ModuleOutputSoln):
         """
         OutputObserver.preinitialize(self, problem)
         ModuleOutputSoln.setOutputSubfields(self, self.dataFields)
+        ModuleOutputSoln.setLoadCase(self, self.loadCase)
 
     def _configure(self):
         """Set members based using inventory.
@@ -0,0 +1,120 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .OutputSolnPoints import OutputSolnPoints
+from .meshio import OutputSolnLineOfSight as ModuleOutputSolnLineOfSight
+
+
+def validateDirections(value):
+    """Validate line-of-sight directions.
+    """
+    try:
+        nums = [float(v) for v in value]
+    except:
+        raise ValueError(f"Could not convert line-of-sight directions '{value}' to floating point values.")
+    return nums
+
+
+class OutputSolnLineOfSight(OutputSolnPoints, ModuleOutputSolnLineOfSight):
+    """
+    Output of displacement projected onto line-of-sight directions of satellite tracks at points on the ground surface.
+
+    The displacement is interpolated to the points and projected onto the unit vector pointing from the ground to the satellite for each track, so the volume of output scales with the number of points and tracks rather than the size of the mesh.
+    Use `pylith.meshio.PointsList` for points from quadtree decimation of interferograms or `pylith.meshio.PointsGrid` for a regular grid of points.
+    The line-of-sight directions are in the mesh coordinate system and are normalized to unit vectors.
+    Other solution subfields are included in the output only if they are listed in `data_fields`.
+
+    :::{tip}
+    Most output information can be configured at the problem level using the [`ProblemDefaults` Component](../problems/ProblemDefaults.md).
+    :::
+
+    Implements `OutputSoln`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [observer]
+            label = insar
+
+            # Line-of-sight directions (east, north, up) from the ground to the satellite.
+            track_names = [ascending, descending]
+            line_of_sight = [-0.62, -0.11, 0.78, 0.62, -0.11, 0.78]
+
+            # Points from quadtree decimation of the interferograms.
+            reader = pylith.meshio.PointsList
+            reader.filename = insar_quadtree.txt
+
+            # Write output to HDF5 file with name `insar.h5`.
+            writer = pylith.meshio.DataWriterHDF5
+            writer.filename = insar.h5
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    label = pythia.pyre.inventory.str("label", default="los")
+    label.meta['tip'] = "Label identifier for points (used in constructing default filenames)."
+
+    dataFields = pythia.pyre.inventory.list("data_fields", default=["none"])
+    dataFields.meta['tip'] = "Names of solution subfields to include in output in addition to the line-of-sight displacement."
+
+    trackNames = pythia.pyre.inventory.list("track_names", default=[])
+    trackNames.meta['tip'] = "Names of satellite tracks."
+
+    directions = pythia.pyre.inventory.list("line_of_sight", default=[], validator=validateDirections)
+    directions.meta['tip'] = "Line-of-sight directions from ground to satellite for each track [x, y, (z), ...] in mesh coordinate system."
+
+    # PUBLIC METHODS /////////////////////////////////////////////////////
+
+    def __init__(self, name="outputsolnlineofsight"):
+        """Constructor.
+        """
+        OutputSolnPoints.__init__(self, name)
+        return
+
+    def preinitialize(self, problem):
+        """Do mimimal initialization.
+        """
+        OutputSolnPoints.preinitialize(self, problem)
+
+        import numpy
+        spaceDim = problem.mesh().getCoordSys().getSpaceDim()
+        numTracks = len(self.trackNames)
+        if numTracks == 0:
+            raise ValueError(f"No satellite tracks specified for line-of-sight output '{self.aliases[-1]}'.")
+        if len(self.directions) != numTracks * spaceDim:
+            raise ValueError(f"Expected {numTracks * spaceDim} values ({spaceDim} for each of {numTracks} tracks) for "
+                             f"line-of-sight directions. Found {len(self.directions)} values.")
+        directions = numpy.array(self.directions, dtype=numpy.float64).reshape((numTracks, spaceDim))
+        ModuleOutputSolnLineOfSight.setLineOfSight(self, directions, self.trackNames)
+        return
+
+    # PRIVATE METHODS ////////////////////////////////////////////////////
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleOutputSolnLineOfSight.__init__(self)
+        return
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def observer():
+    """Factory associated with OutputSoln.
+    """
+    return OutputSolnLineOfSight()
+
+
+# End of file
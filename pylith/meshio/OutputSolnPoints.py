@@ -58,6 +58,9 @@ class OutputSolnPoints(OutputSoln, ModuleOutputSolnPoints):
     reader = pythia.pyre.inventory.facility("reader", factory=PointsList, family="points_list")
     reader.meta['tip'] = "Reader for points list."
 
+    useInterpolationMatrix = pythia.pyre.inventory.bool("use_interpolation_matrix", default=True)
+    useInterpolationMatrix.meta['tip'] = "Interpolate requested subfields using basis functions tabulated once at the points (sparse matrix-vector product)."
+
     # PUBLIC METHODS /////////////////////////////////////////////////////
 
     def __init__(self, name="outputsolnpoints"):
@@ -81,6 +84,7 @@ class OutputSolnPoints(OutputSoln, ModuleOutputSolnPoints):
         stationCoords /= problem.normalizer.lengthScale.value
 
         ModuleOutputSolnPoints.setPoints(self, stationCoords, stationNames)
+        ModuleOutputSolnPoints.useInterpolationMatrix(self, self.useInterpolationMatrix)
 
         identifier = self.aliases[-1]
         self.writer.setFilename(problem.defaults.outputDir, problem.defaults.simName, identifier)
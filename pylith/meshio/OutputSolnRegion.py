@@ -0,0 +1,117 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .OutputSoln import OutputSoln
+from .meshio import OutputSolnRegion as ModuleOutputSolnRegion
+
+
+def validateBoundingBox(value):
+    """Validate bounding box for region of interest.
+    """
+    if len(value) not in [0, 4, 6]:
+        raise ValueError("Bounding box must be empty or contain [xmin, xmax, ymin, ymax] (2D) or "
+                         "[xmin, xmax, ymin, ymax, zmin, zmax] (3D).")
+    try:
+        bbox = [float(v) for v in value]
+    except:
+        raise ValueError(f"Could not convert bounding box '{value}' to floating point values.")
+    for i in range(0, len(bbox), 2):
+        if bbox[i] > bbox[i+1]:
+            raise ValueError(f"Minimum ({bbox[i]}) must not exceed maximum ({bbox[i+1]}) in bounding box.")
+    return value
+
+
+class OutputSolnRegion(OutputSoln, ModuleOutputSolnRegion):
+    """
+    Output of solution subfields over a region of interest.
+
+    The region contains the cells with centroids inside the bounding box and, if a label is given, with the label value.
+    Decimation keeps every k-th cell in the region to further reduce the volume of output.
+
+    :::{tip}
+    Most output information can be configured at the problem level using the [`ProblemDefaults` Component](../problems/ProblemDefaults.md).
+    :::
+
+    Implements `OutputSoln`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [observer]
+            data_fields = [displacement]
+
+            # Cells in material with label value 1 within 5 km of the fault at x=0.
+            bounding_box = [-5.0e+3, 5.0e+3, -20.0e+3, 0.0]
+            label = material-id
+            label_value = 1
+
+            # Write every second cell.
+            decimation = 2
+
+            # Write output to HDF5 file with name `near_fault.h5`.
+            writer = pylith.meshio.DataWriterHDF5
+            writer.filename = near_fault.h5
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    bbox = pythia.pyre.inventory.list("bounding_box", default=[], validator=validateBoundingBox)
+    bbox.meta['tip'] = "Bounding box of region [xmin, xmax, ymin, ymax, (zmin, zmax)] in mesh coordinates (m) (empty for entire domain)."
+
+    labelName = pythia.pyre.inventory.str("label", default="")
+    labelName.meta['tip'] = "Name of label identifier for cells in region (empty for all cells)."
+
+    labelValue = pythia.pyre.inventory.int("label_value", default=1)
+    labelValue.meta['tip'] = "Value of label identifier for cells in region."
+
+    decimation = pythia.pyre.inventory.int("decimation", default=1, validator=pythia.pyre.inventory.greaterEqual(1))
+    decimation.meta['tip'] = "Keep every k-th cell in region."
+
+    def __init__(self, name="outputsolnregion"):
+        """Constructor.
+        """
+        OutputSoln.__init__(self, name)
+
+    def preinitialize(self, problem):
+        """Do mimimal initialization.
+        """
+        OutputSoln.preinitialize(self, problem)
+
+        import numpy
+        bbox = numpy.array([float(v) for v in self.bbox], dtype=numpy.float64)
+        bbox /= problem.normalizer.lengthScale.value
+        ModuleOutputSolnRegion.setBoundingBox(self, bbox)
+        ModuleOutputSolnRegion.setLabelName(self, self.labelName)
+        ModuleOutputSolnRegion.setLabelValue(self, self.labelValue)
+        ModuleOutputSolnRegion.setDecimation(self, self.decimation)
+
+        identifier = self.aliases[-1]
+        self.writer.setFilename(problem.defaults.outputDir, problem.defaults.simName, identifier)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleOutputSolnRegion.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def observer():
+    """Factory associated with OutputSoln.
+    """
+    return OutputSolnRegion()
+
+
+# End of file
@@ -0,0 +1,73 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+
+from .OutputTrigger import OutputTrigger
+from .meshio import OutputTriggerChange as ModuleOutputTriggerChange
+
+
+class OutputTriggerChange(OutputTrigger, ModuleOutputTriggerChange):
+    """
+    Define when output is written in terms of the relative change in the solution since the most recent write.
+
+    The change is the L2 norm of the difference between the current solution (or subfield) and the solution at the most recent write, relative to the L2 norm of the solution at the most recent write.
+    The solution is always written at the first time step.
+
+    Implements `OutputTrigger`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [output_trigger]
+            tolerance = 0.05
+            subfield = displacement
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    tolerance = pythia.pyre.inventory.float("tolerance", default=0.01, validator=pythia.pyre.inventory.greaterEqual(0.0))
+    tolerance.meta['tip'] = "Relative change in L2 norm of solution that triggers a write."
+
+    subfield = pythia.pyre.inventory.str("subfield", default="")
+    subfield.meta['tip'] = "Name of solution subfield to monitor (empty for entire solution)."
+
+    def __init__(self, name="outputtriggerchange"):
+        """Constructor.
+        """
+        OutputTrigger.__init__(self, name)
+
+    def preinitialize(self):
+        """Setup output trigger.
+        """
+        ModuleOutputTriggerChange.__init__(self)
+        ModuleOutputTriggerChange.setIdentifier(self, self.aliases[-1])
+        ModuleOutputTriggerChange.setTolerance(self, self.tolerance)
+        ModuleOutputTriggerChange.setSubfield(self, self.subfield)
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        OutputTrigger._configure(self)
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def output_trigger():
+    """Factory associated with OutputTriggerChange.
+    """
+    return OutputTriggerChange()
+
+
+# End of file
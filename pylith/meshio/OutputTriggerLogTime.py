@@ -0,0 +1,75 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+
+from .OutputTrigger import OutputTrigger
+from .meshio import OutputTriggerLogTime as ModuleOutputTriggerLogTime
+
+
+class OutputTriggerLogTime(OutputTrigger, ModuleOutputTriggerLogTime):
+    """
+    Define when output is written on a logarithmic schedule of elapsed simulation time.
+
+    Output is written at the first time step and then when the time elapsed since the first time step reaches `elapsed_time_first`, `elapsed_time_first*ratio`, `elapsed_time_first*ratio**2`, and so on.
+    This is well suited for postseismic deformation, where the solution changes rapidly early and slowly later.
+
+    Implements `OutputTrigger`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [output_trigger]
+            elapsed_time_first = 0.9999*day
+            ratio = 2.0
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    from pythia.pyre.units.time import s
+    timeFirst = pythia.pyre.inventory.dimensional("elapsed_time_first", default=1.0*s,
+                                                  validator=pythia.pyre.inventory.greater(0.0*s))
+    timeFirst.meta['tip'] = "Elapsed time since first time step of first write after initial write."
+
+    ratio = pythia.pyre.inventory.float("ratio", default=2.0, validator=pythia.pyre.inventory.greater(1.0))
+    ratio.meta['tip'] = "Ratio of successive elapsed times of writes."
+
+    def __init__(self, name="outputtriggerlogtime"):
+        """Constructor.
+        """
+        OutputTrigger.__init__(self, name)
+
+    def preinitialize(self):
+        """Setup output trigger.
+        """
+        ModuleOutputTriggerLogTime.__init__(self)
+        ModuleOutputTriggerLogTime.setIdentifier(self, self.aliases[-1])
+        ModuleOutputTriggerLogTime.setTimeFirst(self, self.timeFirst)
+        ModuleOutputTriggerLogTime.setRatio(self, self.ratio)
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        OutputTrigger._configure(self)
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def output_trigger():
+    """Factory associated with OutputTriggerLogTime.
+    """
+    return OutputTriggerLogTime()
+
+
+# End of file
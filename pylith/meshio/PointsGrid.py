@@ -0,0 +1,126 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from pythia.pyre.components.Component import Component
+
+
+def validateBoundingBox(value):
+    """Validate bounding box of grid.
+    """
+    if len(value) not in [2, 4]:
+        raise ValueError("Bounding box must contain [xmin, xmax] (2D) or [xmin, xmax, ymin, ymax] (3D).")
+    try:
+        bbox = [float(v) for v in value]
+    except:
+        raise ValueError(f"Could not convert bounding box '{value}' to floating point values.")
+    for i in range(0, len(bbox), 2):
+        if bbox[i] > bbox[i+1]:
+            raise ValueError(f"Minimum ({bbox[i]}) must not exceed maximum ({bbox[i+1]}) in bounding box.")
+    return bbox
+
+
+def validateNumPoints(value):
+    """Validate number of points along each direction of grid.
+    """
+    if len(value) not in [1, 2]:
+        raise ValueError("Number of points must contain [nx] (2D) or [nx, ny] (3D).")
+    try:
+        nums = [int(v) for v in value]
+    except:
+        raise ValueError(f"Could not convert number of points '{value}' to integers.")
+    if min(nums) < 1:
+        raise ValueError(f"Number of points along each direction must be positive. Found {nums}.")
+    return nums
+
+
+class PointsGrid(Component):
+    """
+    Regular grid of points on a horizontal surface, such as the ground surface.
+
+    In 2D the points lie along the x axis at y equal to the elevation; in 3D they lie on a grid in x and y at z equal to the elevation.
+    The points are named by their grid indices.
+
+    :::{seealso}
+    See [`OutputSolnPoints` Component](OutputSolnPoints.md) and [`OutputSolnLineOfSight` Component](OutputSolnLineOfSight.md).
+    :::
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [points]
+            bounding_box = [-50.0e+3, 50.0e+3, -40.0e+3, 40.0e+3]
+            num_points = [101, 81]
+            elevation = 0.0
+
+            coordsys = spatialdata.geocoords.CSCart
+            coordsys.space_dim = 3
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    bbox = pythia.pyre.inventory.list("bounding_box", default=[], validator=validateBoundingBox)
+    bbox.meta['tip'] = "Bounding box of grid [xmin, xmax, (ymin, ymax)] in coordinate system of points."
+
+    numPoints = pythia.pyre.inventory.list("num_points", default=[], validator=validateNumPoints)
+    numPoints.meta['tip'] = "Number of points along each direction of grid [nx, (ny)]."
+
+    elevation = pythia.pyre.inventory.float("elevation", default=0.0)
+    elevation.meta['tip'] = "Elevation (y in 2D, z in 3D) of grid in coordinate system of points."
+
+    from spatialdata.geocoords.CSCart import CSCart
+    coordsys = pythia.pyre.inventory.facility("coordsys", family="coordsys", factory=CSCart)
+    coordsys.meta['tip'] = "Coordinate system associated with points."
+
+    def __init__(self, name="pointsgrid"):
+        """Constructor.
+        """
+        Component.__init__(self, name)
+
+    def read(self):
+        """Create points on grid.
+        """
+        import numpy
+
+        numDims = len(self.numPoints)
+        if 2 * numDims != len(self.bbox):
+            raise ValueError(f"Bounding box {self.bbox} does not match number of points {self.numPoints} for grid.")
+
+        axes = [numpy.linspace(self.bbox[2*i], self.bbox[2*i+1], self.numPoints[i]) for i in range(numDims)]
+        grid = numpy.meshgrid(*axes, indexing="ij")
+        npoints = grid[0].size
+        points = numpy.zeros((npoints, numDims+1), dtype=numpy.float64)
+        for i in range(numDims):
+            points[:,i] = grid[i].ravel()
+        points[:,numDims] = self.elevation
+
+        indices = [index.ravel() for index in numpy.meshgrid(*[numpy.arange(n) for n in self.numPoints], indexing="ij")]
+        stations = ["_".join([f"{index[ipoint]:04d}" for index in indices]) for ipoint in range(npoints)]
+        return stations, points
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        Component._configure(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def points_list():
+    """Factory associated with PointsGrid.
+    """
+    return PointsGrid()
+
+
+# End of file
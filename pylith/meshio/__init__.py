@@ -24,18 +24,30 @@ __all__ = [
     "MeshIOCubit",
     "DataWriter",
     "DataWriterVTK",
+    "DataWriterPVTU",
+    "DataWriterADIOS2",
     "DataWriterHDF5Ext",
     "DataWriterHDF5",
+    "DataWriterStats",
+    "GriddedHDF5DB",
     "OutputObserver",
     "OutputPhysics",
+    "OutputPhysicsPoints",
+    "OutputPhysicsCoulombStress",
+    "OutputRuptureStats",
     "OutputSoln",
     "OutputSolnBoundary",
+    "OutputSolnRegion",
     "OutputSolnDomain",
     "OutputSolnPoints",
+    "OutputSolnLineOfSight",
     "OutputTrigger",
     "OutputTriggerStep",
     "OutputTriggerTime",
+    "OutputTriggerLogTime",
+    "OutputTriggerChange",
     "PointsList",
+    "PointsGrid",
     "Xdmf",
 ]
 
@@ -103,6 +103,23 @@ def mpi_comm_self():
     return _mpi_self
 
 
+# ----------------------------------------------------------------------
+def mpi_comm_split(comm, color, key):
+    """Python wrapper around MPI_Comm_split().
+    """
+    return Communicator(mpimodule.mpi_comm_split(comm.handle, color, key))
+
+
+# ----------------------------------------------------------------------
+def petsc_set_comm_world(comm):
+    """Set PETSC_COMM_WORLD to communicator. Must be called before PETSc is initialized.
+    """
+    global _petsc_world
+    mpimodule.petsc_set_comm_world(comm.handle)
+    _petsc_world = None
+    return
+
+
 # ----------------------------------------------------------------------
 def mpi_is_root():
     """Returns True if root process, otherwise False.
@@ -0,0 +1,112 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from pylith.utils.PetscComponent import PetscComponent
+from .problems import CouplerBoundary as ModuleCouplerBoundary
+
+
+def validateLabel(value):
+    """Validate label for group/nodeset/pset.
+    """
+    if not value.strip():
+        raise ValueError("Label for group/nodeset/pset in mesh not specified.")
+    return value
+
+
+class CouplerBoundary(PetscComponent, ModuleCouplerBoundary):
+    """
+    Exchange of boundary values with an external code in memory at every time step.
+
+    The solution subfields in `data_fields` are projected to the boundary `label` and sent to the external code.
+    The values received from the external code replace the auxiliary subfield `receive_subfield` of the boundary condition `boundary_condition` and are used in the next time step.
+    The values are exchanged over an MPI intercommunicator created with `MPI_Comm_connect()` using `port_name`, so the external code must open the port and accept the connection with the same number of processes.
+    Codes linked with PyLith can instead register a callback with `CouplerBoundary::setExchangeFn()` in C++.
+
+    Implements `ObserverSoln`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.problem]
+            solution_observers = [domain, coupler]
+            solution_observers.coupler = pylith.problems.CouplerBoundary
+
+            [pylithapp.problem.solution_observers.coupler]
+            label = boundary_ypos
+            data_fields = [displacement]
+            boundary_condition = bc_ypos
+            receive_subfield = initial_amplitude
+            port_name = tag#0$description#surface-model$port#5000
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    labelName = pythia.pyre.inventory.str("label", default="", validator=validateLabel)
+    labelName.meta['tip'] = "Name of label identifier for boundary with values sent to external code."
+
+    labelValue = pythia.pyre.inventory.int("label_value", default=1)
+    labelValue.meta['tip'] = "Value of label identifier for boundary (tag of physical group in Gmsh files)."
+
+    dataFields = pythia.pyre.inventory.list("data_fields", default=["displacement"])
+    dataFields.meta['tip'] = "Names of solution subfields sent to external code."
+
+    bcIdentifier = pythia.pyre.inventory.str("boundary_condition", default="")
+    bcIdentifier.meta['tip'] = "Name of boundary condition receiving values from external code (empty for none)."
+
+    recvSubfield = pythia.pyre.inventory.str("receive_subfield", default="initial_amplitude")
+    recvSubfield.meta['tip'] = "Name of auxiliary subfield of boundary condition receiving values."
+
+    portName = pythia.pyre.inventory.str("port_name", default="")
+    portName.meta['tip'] = "Name of MPI port opened by external code."
+
+    def __init__(self, name="couplerboundary"):
+        """Constructor.
+        """
+        PetscComponent.__init__(self, name, facility="observer")
+
+    def preinitialize(self, problem):
+        """Do mimimal initialization.
+        """
+        self._createModuleObj()
+        identifier = self.aliases[-1]
+        ModuleCouplerBoundary.setIdentifier(self, identifier)
+        ModuleCouplerBoundary.setProblem(self, problem)
+        ModuleCouplerBoundary.setLabelName(self, self.labelName)
+        ModuleCouplerBoundary.setLabelValue(self, self.labelValue)
+        ModuleCouplerBoundary.setSendSubfields(self, self.dataFields)
+        if self.bcIdentifier:
+            ModuleCouplerBoundary.setReceiveSubfield(self, self.bcIdentifier, self.recvSubfield)
+        ModuleCouplerBoundary.setPortName(self, self.portName)
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        PetscComponent._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleCouplerBoundary.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def observer():
+    """Factory associated with CouplerBoundary.
+    """
+    return CouplerBoundary()
+
+
+# End of file
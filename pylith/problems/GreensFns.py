@@ -23,6 +23,14 @@ from .Problem import Problem
 from .problems import GreensFns as ModuleGreensFns
 
 
+def slipFactory(name):
+    """Factory for slip distributions of surrogate model.
+    """
+    from pythia.pyre.inventory import facility
+    from spatialdata.spatialdb.SimpleDB import SimpleDB
+    return facility(name, family="spatial_database", factory=SimpleDB)
+
+
 class GreensFns(Problem, ModuleGreensFns):
     """
     Static Green's function problem type with each Green's function corresponding to a fault slip impulses.
@@ -38,6 +46,9 @@ class GreensFns(Problem, ModuleGreensFns):
             label = fault
             label_value = 1
 
+            # Solve for impulses in blocks of 16 right-hand sides.
+            impulse_batch_size = 16
+
             # Set appropriate default solver settings.
             set_solver_defaults = True
 
@@ -76,6 +87,38 @@ class GreensFns(Problem, ModuleGreensFns):
     faultLabelValue = pythia.pyre.inventory.int("label_value", default=1)
     faultLabelValue.meta['tip'] = "Value of label identifier for fault surface on which to impose impulses."
 
+    impulseBatchSize = pythia.pyre.inventory.int("impulse_batch_size", default=1, validator=pythia.pyre.inventory.greater(0))
+    impulseBatchSize.meta['tip'] = "Number of impulses solved together as a block of right-hand sides (1=solve impulses one at a time)."
+
+    numImpulseGroups = pythia.pyre.inventory.int("impulse_groups", default=1, validator=pythia.pyre.inventory.greater(0))
+    numImpulseGroups.meta['tip'] = "Number of process groups solving impulses concurrently, each with a copy of the operator (1=all processes solve each impulse)."
+
+    initialGuessSize = pythia.pyre.inventory.int("initial_guess_size", default=8, validator=pythia.pyre.inventory.greater(0))
+    initialGuessSize.meta['tip'] = "Number of previous impulse solutions retained in the initial guess basis (requires petsc_defaults.initial_guess)."
+
+    deflationSize = pythia.pyre.inventory.int("deflation_size", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    deflationSize.meta['tip'] = "Number of impulse solutions in deflation space of preconditioner (0 for no deflation)."
+
+    localizedResidual = pythia.pyre.inventory.bool("localized_residual", default=False)
+    localizedResidual.meta['tip'] = "Assemble right-hand side of each impulse over the fault cells in its support (requires impulse_batch_size > 1 or impulse_groups > 1)."
+
+    from pylith.utils.EmptyBin import EmptyBin
+    surrogateSlip = pythia.pyre.inventory.facilityArray("surrogate_slip", itemFactory=slipFactory, factory=EmptyBin)
+    surrogateSlip.meta['tip'] = "Slip distributions evaluated with the response matrix of the impulses (surrogate model) after solving the impulses."
+
+    surrogateRank = pythia.pyre.inventory.int("surrogate_rank", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    surrogateRank.meta['tip'] = "Rank of compressed response matrix for surrogate model (0=full response matrix)."
+
+    reciprocal = pythia.pyre.inventory.bool("reciprocal", default=False)
+    reciprocal.meta['tip'] = "Compute Green's functions of displacement at points using one adjoint solve per observation (efficient when there are fewer observations than impulses)."
+
+    from pylith.meshio.PointsList import PointsList
+    reciprocalPoints = pythia.pyre.inventory.facility("reciprocal_points", factory=PointsList, family="points_list")
+    reciprocalPoints.meta['tip'] = "Reader for points with observations for reciprocal Green's functions."
+
+    reciprocalFilename = pythia.pyre.inventory.str("reciprocal_filename", default="")
+    reciprocalFilename.meta['tip'] = "Name of PETSc binary file for reciprocal Green's functions (default is OUTPUT_DIR/SIM_NAME-reciprocal.bin)."
+
     from .ProgressMonitorStep import ProgressMonitorStep
     progressMonitor = pythia.pyre.inventory.facility(
         "progress_monitor", family="progress_monitor", factory=ProgressMonitorStep)
@@ -99,6 +142,16 @@ class GreensFns(Problem, ModuleGreensFns):
 
         ModuleGreensFns.setFaultLabelName(self, self.faultLabelName)
         ModuleGreensFns.setFaultLabelValue(self, self.faultLabelValue)
+        ModuleGreensFns.setImpulseBatchSize(self, self.impulseBatchSize)
+        ModuleGreensFns.setNumImpulseGroups(self, self.numImpulseGroups)
+        ModuleGreensFns.setInitialGuessSize(self, self.initialGuessSize)
+        ModuleGreensFns.setDeflationSize(self, self.deflationSize)
+        ModuleGreensFns.setLocalizedResidual(self, self.localizedResidual)
+        for db in self.surrogateSlip.components():
+            ModuleGreensFns.addSurrogateSlip(self, db)
+        ModuleGreensFns.setSurrogateRank(self, self.surrogateRank)
+        if self.reciprocal:
+            self._setupReciprocal(mesh)
 
         self.progressMonitor.preinitialize()
         ModuleGreensFns.setProgressMonitor(self, self.progressMonitor)
@@ -112,6 +165,25 @@ class GreensFns(Problem, ModuleGreensFns):
 
         ModuleGreensFns.solve(self)
 
+    def _setupReciprocal(self, mesh):
+        """Set points and output file for reciprocal Green's functions.
+        """
+        pointNames, pointCoords = self.reciprocalPoints.read()
+
+        # Convert to mesh coordinate system
+        from spatialdata.geocoords.Converter import convert
+        convert(pointCoords, mesh.getCoordSys(), self.reciprocalPoints.coordsys)
+
+        # Nondimensionalize
+        pointCoords /= self.normalizer.lengthScale.value
+        ModuleGreensFns.setReciprocalPoints(self, pointCoords, pointNames)
+
+        filename = self.reciprocalFilename
+        if not filename:
+            import os
+            filename = os.path.join(self.defaults.outputDir, "{}-reciprocal.bin".format(self.defaults.simName))
+        ModuleGreensFns.setReciprocalFilename(self, filename)
+
     def _configure(self):
         """Set members based using inventory.
         """
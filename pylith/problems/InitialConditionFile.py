@@ -0,0 +1,83 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from pylith.problems.InitialCondition import InitialCondition
+from .problems import InitialConditionFile as ModuleInitialCondition
+
+
+class InitialConditionFile(InitialCondition, ModuleInitialCondition):
+    """
+    Initial conditions for the solution over the entire domain from the solution in an HDF5 file written by `DataWriterHDF5`.
+
+    If the vertices in the file match the vertices of the mesh on each process (same mesh and number of processes), the values are copied directly.
+    Otherwise, the values are interpolated from the mesh in the file.
+
+    Implements `InitialCondition`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            # Use the solution at the last time step of a previous simulation as the initial condition.
+            [pylithapp.problem]
+            ic = [domain]
+            ic.domain = pylith.problems.InitialConditionFile
+
+            [pylithapp.problem.ic.domain]
+            subfields = [displacement, velocity]
+            filename = output/step01-domain.h5
+            time_step = -1
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    filename = pythia.pyre.inventory.str("filename", default="")
+    filename.meta["tip"] = "Name of HDF5 file with solution written by DataWriterHDF5."
+
+    timeStep = pythia.pyre.inventory.int("time_step", default=-1)
+    timeStep.meta["tip"] = "Index of time step in file (negative values count from the last time step)."
+
+    def __init__(self, name="initialconditionfile"):
+        """Constructor.
+        """
+        InitialCondition.__init__(self, name)
+
+    def preinitialize(self, problem):
+        """Setup initial conditions.
+        """
+        InitialCondition.preinitialize(self, problem)
+
+        ModuleInitialCondition.setFilename(self, self.filename)
+        ModuleInitialCondition.setTimeStep(self, self.timeStep)
+
+    def _configure(self):
+        """Setup members using inventory.
+        """
+        InitialCondition._configure(self)
+
+    def _createModuleObj(self):
+        """Call constructor for module object for access to C++ object.
+        """
+        ModuleInitialCondition.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def initial_conditions():
+    """Factory associated with InitialConditionFile.
+    """
+    return InitialConditionFile()
+
+
+# End of file
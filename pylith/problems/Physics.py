@@ -50,6 +50,9 @@ class Physics(PetscComponent, ModulePhysics):
         "db_auxiliary_field", family="spatial_database", factory=SimpleDB)
     auxiliaryFieldDB.meta['tip'] = "Database for physical property parameters."
 
+    auxiliaryFieldCache = pythia.pyre.inventory.str("auxiliary_field_cache", default="")
+    auxiliaryFieldCache.meta['tip'] = "Name of HDF5 file for caching values of auxiliary field (empty for no cache)."
+
     from pylith.problems.SingleObserver import SinglePhysicsObserver
     observers = pythia.pyre.inventory.facilityArray(
         "observers", itemFactory=observerFactory, factory=SinglePhysicsObserver)
@@ -70,6 +73,9 @@ class Physics(PetscComponent, ModulePhysics):
 
         if not isinstance(self.auxiliaryFieldDB, NullComponent):
             ModulePhysics.setAuxiliaryFieldDB(self, self.auxiliaryFieldDB)
+            if self.auxiliaryFieldCache:
+                dbKey = self._getDBKey(self.auxiliaryFieldDB)
+                ModulePhysics.setAuxiliaryFieldCache(self, self.auxiliaryFieldCache, dbKey)
 
         for subfield in self.auxiliarySubfields.components():
             fieldName = subfield.aliases[-1]
@@ -103,5 +109,30 @@ class Physics(PetscComponent, ModulePhysics):
         raise NotImplementedError(
             "Please implement _createModuleOb() in derived class.")
 
+    def _getDBKey(self, db):
+        """Get key identifying spatial database, its parameters, and the contents of its data files.
+        """
+        import hashlib
+        import os
+
+        key = hashlib.sha256()
+        key.update(str(db.__class__).encode())
+        omit = ["help", "help-components", "help-persistence", "help-properties", "typos", "weaver"]
+        facilityNames = db.inventory.facilityNames()
+        for name in sorted(db.inventory.propertyNames()):
+            if name in omit:
+                continue
+            value = db.inventory.getTraitDescriptor(name).value
+            key.update(name.encode())
+            if name in facilityNames:
+                key.update(self._getDBKey(value).encode())
+                continue
+            key.update(str(value).encode())
+            if isinstance(value, str) and os.path.isfile(value):
+                with open(value, "rb") as fin:
+                    for chunk in iter(lambda: fin.read(1 << 20), b""):
+                        key.update(chunk)
+        return key.hexdigest()
+
 
 # End of file
@@ -75,8 +75,31 @@ class Problem(PetscComponent, ModuleProblem):
     formulation.meta['tip'] = "Formulation for equations."
 
     solverChoice = pythia.pyre.inventory.str("solver", default="nonlinear",
-                                      validator=pythia.pyre.inventory.choice(["linear", "nonlinear"]))
-    solverChoice.meta['tip'] = "Type of solver to use ['linear', 'nonlinear']."
+                                      validator=pythia.pyre.inventory.choice(["linear", "nonlinear", "nonlinear_anderson", "nonlinear_quasi_newton"]))
+    solverChoice.meta['tip'] = "Type of solver to use ['linear', 'nonlinear', 'nonlinear_anderson', 'nonlinear_quasi_newton']."
+
+    device = pythia.pyre.inventory.str("device", default="none",
+                                validator=pythia.pyre.inventory.choice(["none", "cuda", "hip", "kokkos"]))
+    device.meta['tip'] = "Device for solution vectors and Jacobian matrices ['none', 'cuda', 'hip', 'kokkos']."
+
+    jacobianStorage = pythia.pyre.inventory.str("jacobian_storage", default="aij",
+                                         validator=pythia.pyre.inventory.choice(["aij", "baij", "sbaij", "is"]))
+    jacobianStorage.meta['tip'] = "Storage of Jacobian matrices ['aij', 'baij', 'sbaij' (symmetric), 'is' (unassembled subdomains for BDDC)]; blocks use degrees of freedom at each point."
+
+    assemblyChunkSize = pythia.pyre.inventory.int("assembly_chunk_size", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    assemblyChunkSize.meta['tip'] = "Maximum number of cells assembled in each call to PETSc assembly routines (0 for all cells)."
+
+    cacheGeometry = pythia.pyre.inventory.bool("cache_geometry", default=True)
+    cacheGeometry.meta['tip'] = "Reuse cell geometry of materials between residual and Jacobian evaluations until the coordinates change."
+
+    splitNodeSolver = pythia.pyre.inventory.bool("split_node_solver", default=False)
+    splitNodeSolver.meta['tip'] = "Eliminate fault Lagrange multipliers for prescribed slip in the preconditioner and solve for the displacement with CG and algebraic multigrid."
+
+    performanceReportFilename = pythia.pyre.inventory.str("performance_report_filename", default="")
+    performanceReportFilename.meta['tip'] = "Name of JSON file for report of assembly performance of each material, boundary condition, and fault (empty=no report)."
+
+    hardwareCounters = pythia.pyre.inventory.bool("hardware_counters", default=False)
+    hardwareCounters.meta['tip'] = "Include hardware counters (cycles, instructions, last level cache misses) in performance report (requires Linux perf events)."
 
     petscDefaults = pythia.pyre.inventory.facility("petsc_defaults", family="petsc_defaults", factory=PetscDefaults)
     petscDefaults.meta['tip'] = "Flags controlling which default PETSc options to use."
@@ -138,13 +161,42 @@ class Problem(PetscComponent, ModuleProblem):
             ModuleProblem.setSolverType(self, ModuleProblem.LINEAR)
         elif self.solverChoice == "nonlinear":
             ModuleProblem.setSolverType(self, ModuleProblem.NONLINEAR)
+        elif self.solverChoice == "nonlinear_anderson":
+            ModuleProblem.setSolverType(self, ModuleProblem.NONLINEAR_ANDERSON)
+        elif self.solverChoice == "nonlinear_quasi_newton":
+            ModuleProblem.setSolverType(self, ModuleProblem.NONLINEAR_QUASI_NEWTON)
         else:
             raise ValueError("Unknown solver choice '%s'." % self.solverChoice)
         ModuleProblem.setPetscDefaults(self, self.petscDefaults.flags());
+        devices = {
+            "none": ModuleProblem.DEVICE_NONE,
+            "cuda": ModuleProblem.DEVICE_CUDA,
+            "hip": ModuleProblem.DEVICE_HIP,
+            "kokkos": ModuleProblem.DEVICE_KOKKOS,
+        }
+        ModuleProblem.setDevice(self, devices[self.device])
+        storages = {
+            "aij": ModuleProblem.JACOBIAN_AIJ,
+            "baij": ModuleProblem.JACOBIAN_BAIJ,
+            "sbaij": ModuleProblem.JACOBIAN_SBAIJ,
+            "is": ModuleProblem.JACOBIAN_IS,
+        }
+        ModuleProblem.setJacobianStorage(self, storages[self.jacobianStorage])
+        ModuleProblem.setAssemblyChunkSize(self, self.assemblyChunkSize)
+        ModuleProblem.setCacheGeometry(self, self.cacheGeometry)
+        ModuleProblem.setUseSplitNodeSolver(self, self.splitNodeSolver)
         ModuleProblem.setNormalizer(self, self.normalizer)
         if not isinstance(self.gravityField, NullComponent):
             ModuleProblem.setGravityField(self, self.gravityField)
 
+        # The quadrature order must be the same for all subfields, so the automatic quadrature order is the lowest
+        # order that is consistent with every solution subfield.
+        if self.defaults.quadOrder == 0:
+            basisOrders = [subfield.basisOrder for subfield in self.solution.subfields.components()]
+            self.defaults.quadOrder = max([1] + basisOrders)
+            if mpi_is_root():
+                self._info.log("Using quadrature order {} from basis order of solution subfields.".format(self.defaults.quadOrder))
+
         # Do minimal setup of solution.
         self.solution.preinitialize(self, mesh)
         ModuleProblem.setSolution(self, self.solution.field)
@@ -189,8 +241,39 @@ class Problem(PetscComponent, ModuleProblem):
         if mpi_is_root():
             self._info.log(f"Initializing {self.name} problem with {self.formulation} formulation.")
 
+        if self.hardwareCounters:
+            from pylith.utils.utils import HardwareCounters
+            if not HardwareCounters.initialize():
+                self._warning.log(
+                    "Hardware counters are not available. PyLith must be configured with --enable-hardware-counters "
+                    "and the operating system must permit access to perf events.")
+
         ModuleProblem.initialize(self)
 
+    def estimateResources(self):
+        """Initialize solution, integrators, and constraints and report estimated resources for running problem.
+        """
+        from pylith.mpi.Communicator import mpi_is_root
+        if mpi_is_root():
+            self._info.log(f"Estimating resources for {self.name} problem with {self.formulation} formulation.")
+
+        report = ModuleProblem.estimateResources(self)  # collective
+        if mpi_is_root():
+            self._info.log(report)
+
+    def reinitialize(self):
+        """Reset problem for another run, reusing the mesh, integrators, Jacobian sparsity, and solver setup.
+
+        Values of the auxiliary fields are recomputed from the spatial databases, so spatial databases changed since
+        initialize() (for example, a SimpleDB reading a different file) are used in the next run. Observers are
+        not reset, so output from consecutive runs goes to the same files.
+        """
+        from pylith.mpi.Communicator import mpi_is_root
+        if mpi_is_root():
+            self._info.log(f"Reinitializing {self.name} problem.")
+
+        ModuleProblem.reinitialize(self)
+
     def run(self, app):
         """Solve the problem.
         """
@@ -202,6 +285,11 @@ class Problem(PetscComponent, ModuleProblem):
         from pylith.mpi.Communicator import mpi_is_root
         if mpi_is_root():
             self._info.log("Finalizing problem.")
+        if self.performanceReportFilename:
+            ModuleProblem.writePerformanceReport(self, self.performanceReportFilename)
+        if self.hardwareCounters:
+            from pylith.utils.utils import HardwareCounters
+            HardwareCounters.deallocate()
 
     def checkpoint(self):
         """Save problem state for restart.
@@ -46,8 +46,8 @@ class ProblemDefaults(Component):
     simName = pythia.pyre.inventory.str("name", default="", validator=validateName)
     simName.meta['tip'] = "Name for the problem (used with output_directory for default output filenames)."
 
-    quadOrder = pythia.pyre.inventory.int("quadrature_order", default=1, validator=pythia.pyre.inventory.greater(0))
-    quadOrder.meta['tip'] = "Finite-element quadrature order."
+    quadOrder = pythia.pyre.inventory.int("quadrature_order", default=1, validator=pythia.pyre.inventory.greaterEqual(0))
+    quadOrder.meta['tip'] = "Finite-element quadrature order (0=use largest basis order of solution subfields)."
 
     outputBasisOrder = pythia.pyre.inventory.int("output_basis_order", default=1, validator=pythia.pyre.inventory.choice([0,1]))
     outputBasisOrder.meta['tip'] = "Default basis order for output."
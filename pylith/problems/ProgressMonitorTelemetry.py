@@ -0,0 +1,79 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .ProgressMonitorTime import ProgressMonitorTime
+from .problems import ProgressMonitorTelemetry as ModuleProgressMonitorTelemetry
+
+
+class ProgressMonitorTelemetry(ProgressMonitorTime, ModuleProgressMonitorTelemetry):
+    """
+    Progress monitor for time-dependent problem writing machine-readable solver statistics at every time step.
+
+    The statistics include the nonlinear and linear solver iterations and residual norms, the elapsed time of the
+    residual, Jacobian, preconditioner setup, solve, and output (maximum over processes), and the memory high-water
+    mark. With the `json_lines` format one JSON object is appended to the file at every time step; with the
+    `prometheus` format the file contains the current values in the Prometheus text exposition format and is
+    replaced at every time step.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.timedependent]
+            progress_monitor = pylith.problems.ProgressMonitorTelemetry
+
+            [pylithapp.timedependent.progress_monitor]
+            filename = output/step01-progress.jsonl
+            format = json_lines
+            t_units = year
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    filename = pythia.pyre.inventory.str("filename", default="progress.jsonl")
+    filename.meta['tip'] = "Name of output file."
+
+    format = pythia.pyre.inventory.str("format", default="json_lines", validator=pythia.pyre.inventory.choice(["json_lines", "prometheus"]))
+    format.meta['tip'] = "Format of telemetry."
+
+    def __init__(self, name="progressmonitortelemetry"):
+        """Constructor.
+        """
+        ProgressMonitorTime.__init__(self, name)
+
+    def preinitialize(self):
+        """Do minimal initialization.
+        """
+        ProgressMonitorTime.preinitialize(self)
+        mapFormat = {
+            "json_lines": ModuleProgressMonitorTelemetry.JSON_LINES,
+            "prometheus": ModuleProgressMonitorTelemetry.PROMETHEUS,
+        }
+        ModuleProgressMonitorTelemetry.setFormat(self, mapFormat[self.format])
+
+    def _createModuleObj(self):
+        """Create handle to corresponding C++ object.
+        """
+        ModuleProgressMonitorTelemetry.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def progress_monitor():
+    """Factory associated with ProgressMonitorTelemetry.
+    """
+    return ProgressMonitorTelemetry()
+
+
+# End of file
@@ -34,6 +34,9 @@ class ProgressMonitorTime(ProgressMonitor, ModuleProgressMonitorTime):
     tUnits = pythia.pyre.inventory.str("t_units", default="year")
     tUnits.meta['tip'] = "Units used for simulation time in output."
 
+    showSolverStatistics = pythia.pyre.inventory.bool("solver_statistics", default=False)
+    showSolverStatistics.meta['tip'] = "Report number of Jacobian reformations and nonlinear solver iterations."
+
     def __init__(self, name="progressmonitortime"):
         """Constructor.
         """
@@ -44,6 +47,7 @@ class ProgressMonitorTime(ProgressMonitor, ModuleProgressMonitorTime):
         """
         ProgressMonitor.preinitialize(self)
         ModuleProgressMonitorTime.setTimeUnit(self, self.tUnits)
+        ModuleProgressMonitorTime.setShowSolverStatistics(self, self.showSolverStatistics)
 
     def _createModuleObj(self):
         """Create handle to corresponding C++ object.
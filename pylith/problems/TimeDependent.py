@@ -25,6 +25,22 @@ def icFactory(name):
     return facility(name, family="initial_conditions", factory=InitialConditionDomain)
 
 
+def slipFactory(name):
+    """Factory for slip distributions of slip histories.
+    """
+    from pythia.pyre.inventory import facility
+    from spatialdata.spatialdb.SimpleDB import SimpleDB
+    return facility(name, family="spatial_database", factory=SimpleDB)
+
+
+def timeHistoryFactory(name):
+    """Factory for time histories of slip histories.
+    """
+    from pythia.pyre.inventory import facility
+    from spatialdata.spatialdb.TimeHistory import TimeHistory
+    return facility(name, family="temporal_database", factory=TimeHistory)
+
+
 class TimeDependent(Problem, ModuleTimeDependent):
     """
     Static, quasistatic, or dynamic time-dependent problem.
@@ -94,6 +110,112 @@ class TimeDependent(Problem, ModuleTimeDependent):
     shouldNotifyIC = pythia.pyre.inventory.bool("notify_observers_ic", default=False)
     shouldNotifyIC.meta["tip"] = "Notify observers of solution with initial conditions."
 
+    useMatrixFreeJacobian = pythia.pyre.inventory.bool("matrix_free_jacobian", default=False)
+    useMatrixFreeJacobian.meta["tip"] = "Use matrix-free action of the Jacobian with an assembled preconditioner (implicit time stepping)."
+
+    useLinearFastPath = pythia.pyre.inventory.bool("linear_fast_path", default=False)
+    useLinearFastPath.meta["tip"] = "Form residual of linear quasistatic problems from stored Jacobian and cached load vector."
+
+    useFixedStressSplit = pythia.pyre.inventory.bool("fixed_stress_split", default=False)
+    useFixedStressSplit.meta["tip"] = "Use fixed-stress split of flow and mechanics in poroelasticity instead of monolithic coupling."
+
+    usePressureMassPreconditioner = pythia.pyre.inventory.bool("pressure_mass_preconditioner", default=False)
+    usePressureMassPreconditioner.meta["tip"] = "Use weighted pressure mass matrix as preconditioner for the Schur complement in incompressible elasticity."
+
+    useOverlappedAssembly = pythia.pyre.inventory.bool("overlap_assembly", default=False)
+    useOverlappedAssembly.meta["tip"] = "Overlap exchange of ghost values of the solution with residual assembly over interior cells."
+
+    useLocalTimeStepping = pythia.pyre.inventory.bool("local_time_stepping", default=False)
+    useLocalTimeStepping.meta["tip"] = "Advance cells with stable time steps smaller than the time step with a fraction of the time step (explicit time stepping)."
+
+    jacobianLagSteps = pythia.pyre.inventory.int("jacobian_lag_steps", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    jacobianLagSteps.meta["tip"] = "Minimum number of time steps between Jacobian reformations requested by materials (0=reform whenever requested)."
+
+    jacobianReformIterations = pythia.pyre.inventory.int("jacobian_reform_iterations", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    jacobianReformIterations.meta["tip"] = "Reform lagged Jacobian when nonlinear solver iterations in previous time step exceed this value (0=disable)."
+
+    predictor = pythia.pyre.inventory.str("predictor", default="none",
+                                          validator=pythia.pyre.inventory.choice(["none", "linear", "quadratic"]))
+    predictor.meta["tip"] = "Extrapolate solutions at previous time steps for initial guess of nonlinear solver (quasistatic)."
+
+    predictorUseDtRatio = pythia.pyre.inventory.bool("predictor_dt_ratio", default=True)
+    predictorUseDtRatio.meta["tip"] = "Use ratios of time steps in predictor (False=assume uniform time step)."
+
+    timeStepping = pythia.pyre.inventory.str("time_stepping", default="backward_euler",
+                                             validator=pythia.pyre.inventory.choice(["backward_euler", "bdf2"]))
+    timeStepping.meta["tip"] = "Implicit time stepping method (quasistatic)."
+
+    useDtErrorControl = pythia.pyre.inventory.bool("dt_error_control", default=False)
+    useDtErrorControl.meta["tip"] = "Control time step using error estimate of time stepping method (requires BDF2)."
+
+    equilibrateReferenceState = pythia.pyre.inventory.bool("equilibrate_reference_state", default=False)
+    equilibrateReferenceState.meta["tip"] = "Set reference state of materials from equilibrium at start time before time stepping (quasistatic)."
+
+    adaptDt = pythia.pyre.inventory.bool("adapt_dt", default=False)
+    adaptDt.meta["tip"] = "Adapt time step using viscoelastic relaxation (Maxwell) times and change in solution."
+
+    dtMax = pythia.pyre.inventory.dimensional("max_dt", default=1.0e+4 * year,
+                                       validator=pythia.pyre.inventory.greater(0.0 * year))
+    dtMax.meta['tip'] = "Maximum time step with adaptive time stepping."
+
+    dtGrowthFactor = pythia.pyre.inventory.float("dt_growth_factor", default=1.5, validator=pythia.pyre.inventory.greater(1.0))
+    dtGrowthFactor.meta['tip'] = "Maximum ratio of consecutive time steps with adaptive time stepping."
+
+    maxwellTimeFraction = pythia.pyre.inventory.float("maxwell_time_fraction", default=0.2, validator=pythia.pyre.inventory.greater(0.0))
+    maxwellTimeFraction.meta['tip'] = "Maximum time step as a fraction of the minimum Maxwell time during the first Maxwell time."
+
+    solutionChangeTolerance = pythia.pyre.inventory.float("solution_change_tolerance", default=0.05, validator=pythia.pyre.inventory.greater(0.0))
+    solutionChangeTolerance.meta['tip'] = "Target relative change in solution over a time step with adaptive time stepping."
+
+    useStableDt = pythia.pyre.inventory.bool("use_stable_dt", default=False)
+    useStableDt.meta['tip'] = "Use estimate of stable time step for explicit time stepping instead of initial time step."
+
+    stableDtFactor = pythia.pyre.inventory.float("stable_dt_factor", default=1.0, validator=pythia.pyre.inventory.greater(0.0))
+    stableDtFactor.meta['tip'] = "Factor applied to estimate of stable time step for explicit time stepping."
+
+    checkpointInterval = pythia.pyre.inventory.int("checkpoint_interval", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    checkpointInterval.meta['tip'] = "Number of time steps between checkpoints (0=no checkpoints)."
+
+    checkpointFilename = pythia.pyre.inventory.str("checkpoint_filename", default="")
+    checkpointFilename.meta['tip'] = "Name of HDF5 file for checkpoints (default is OUTPUT_DIR/SIM_NAME-checkpoint.h5)."
+
+    loadImbalanceThreshold = pythia.pyre.inventory.float("load_imbalance_threshold", default=0.0, validator=pythia.pyre.inventory.greaterEqual(0.0))
+    loadImbalanceThreshold.meta['tip'] = "Ratio of maximum to mean assembly time over processes that triggers a checkpoint for repartitioning (0=disable)."
+
+    steadyStateRate = pythia.pyre.inventory.dimensional("steady_state_rate", default=0.0 / year,
+                                                 validator=pythia.pyre.inventory.greaterEqual(0.0 / year))
+    steadyStateRate.meta['tip'] = "Relative rate of change in solution below which the solution is at steady state and time stepping stops (0=disable)."
+
+    steadyStateWindow = pythia.pyre.inventory.int("steady_state_window", default=5, validator=pythia.pyre.inventory.greater(0))
+    steadyStateWindow.meta['tip'] = "Number of consecutive time steps with relative rate of change in solution below steady state rate for steady state."
+
+    steadyStateSubfields = pythia.pyre.inventory.list("steady_state_subfields", default=[])
+    steadyStateSubfields.meta['tip'] = "Names of solution subfields checked for steady state (default is entire solution)."
+
+    restartFilename = pythia.pyre.inventory.str("restart_filename", default="")
+    restartFilename.meta['tip'] = "Name of HDF5 checkpoint file used to restart the simulation (empty=start from initial conditions)."
+
+    loadCases = pythia.pyre.inventory.list("load_cases", default=[])
+    loadCases.meta['tip'] = "Names of load cases advanced together with one block solve per time step (linear quasistatic problems)."
+
+    impulseLabel = pythia.pyre.inventory.str("impulse_label", default="")
+    impulseLabel.meta['tip'] = "Name of label for fault with impulses for time-dependent Green's functions (empty=solve a single problem)."
+
+    impulseLabelValue = pythia.pyre.inventory.int("impulse_label_value", default=100)
+    impulseLabelValue.meta['tip'] = "Value of label for fault with impulses for time-dependent Green's functions."
+
+    impulseBatchSize = pythia.pyre.inventory.int("impulse_batch_size", default=1, validator=pythia.pyre.inventory.greater(0))
+    impulseBatchSize.meta['tip'] = "Number of impulses advanced together with one block solve per time step for time-dependent Green's functions."
+
+    responseRank = pythia.pyre.inventory.int("response_rank", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    responseRank.meta['tip'] = "Rank of spatial basis shared by the responses to impulses at all time steps (0=full responses)."
+
+    slipDistributions = pythia.pyre.inventory.facilityArray("slip_distributions", itemFactory=slipFactory, factory=EmptyBin)
+    slipDistributions.meta['tip'] = "Slip distributions of slip histories predicted by convolution with the time-dependent Green's functions."
+
+    slipTimeHistories = pythia.pyre.inventory.facilityArray("slip_time_histories", itemFactory=timeHistoryFactory, factory=EmptyBin)
+    slipTimeHistories.meta['tip'] = "Time histories of slip amplitude of slip histories, in the same order as slip_distributions."
+
     from .ProgressMonitorTime import ProgressMonitorTime
     progressMonitor = pythia.pyre.inventory.facility(
         "progress_monitor", family="progress_monitor", factory=ProgressMonitorTime)
@@ -103,6 +225,22 @@ class TimeDependent(Problem, ModuleTimeDependent):
         """Constructor.
         """
         Problem.__init__(self, name)
+        self.parallelInTime = None
+
+    def setParallelInTime(self, comm, coarseDt, maxIterations, tolerance):
+        """Use parareal iteration with one time slice per group of processes.
+
+        Args:
+            comm (pylith.mpi.Communicator)
+                Communicator connecting processes with the same rank in each group.
+            coarseDt (pythia.pyre.units.unit)
+                Time step of coarse propagator.
+            maxIterations (int)
+                Maximum number of parareal iterations.
+            tolerance (float)
+                Tolerance for relative change in solution at the end of the time slices.
+        """
+        self.parallelInTime = (comm, coarseDt, maxIterations, tolerance)
 
     def preinitialize(self, mesh):
         """Setup integrators for each element family (material/quadrature,
@@ -120,6 +258,55 @@ class TimeDependent(Problem, ModuleTimeDependent):
         ModuleTimeDependent.setInitialTimeStep(self, self.dtInitial.value)
         ModuleTimeDependent.setMaxTimeSteps(self, self.maxTimeSteps)
         ModuleTimeDependent.setShouldNotifyIC(self, self.shouldNotifyIC)
+        ModuleTimeDependent.setUseMatrixFreeJacobian(self, self.useMatrixFreeJacobian)
+        ModuleTimeDependent.setUseLinearFastPath(self, self.useLinearFastPath)
+        ModuleTimeDependent.setUseFixedStressSplit(self, self.useFixedStressSplit)
+        ModuleTimeDependent.setUsePressureMassPreconditioner(self, self.usePressureMassPreconditioner)
+        ModuleTimeDependent.setUseOverlappedAssembly(self, self.useOverlappedAssembly)
+        ModuleTimeDependent.setUseLocalTimeStepping(self, self.useLocalTimeStepping)
+        ModuleTimeDependent.setJacobianLagSteps(self, self.jacobianLagSteps)
+        ModuleTimeDependent.setJacobianReformIterations(self, self.jacobianReformIterations)
+        predictors = {
+            "none": ModuleTimeDependent.PREDICTOR_NONE,
+            "linear": ModuleTimeDependent.PREDICTOR_LINEAR,
+            "quadratic": ModuleTimeDependent.PREDICTOR_QUADRATIC,
+        }
+        ModuleTimeDependent.setPredictor(self, predictors[self.predictor])
+        ModuleTimeDependent.setPredictorUseTimeStepRatio(self, self.predictorUseDtRatio)
+        timeSteppings = {
+            "backward_euler": ModuleTimeDependent.TIMESTEPPING_BACKWARD_EULER,
+            "bdf2": ModuleTimeDependent.TIMESTEPPING_BDF2,
+        }
+        ModuleTimeDependent.setTimeStepping(self, timeSteppings[self.timeStepping])
+        ModuleTimeDependent.setUseTimeStepErrorControl(self, self.useDtErrorControl)
+        ModuleTimeDependent.setEquilibrateReferenceState(self, self.equilibrateReferenceState)
+        ModuleTimeDependent.setAdaptTimeStep(self, self.adaptDt)
+        ModuleTimeDependent.setMaxTimeStep(self, self.dtMax.value)
+        ModuleTimeDependent.setTimeStepGrowthFactor(self, self.dtGrowthFactor)
+        ModuleTimeDependent.setMaxwellTimeFraction(self, self.maxwellTimeFraction)
+        ModuleTimeDependent.setSolutionChangeTolerance(self, self.solutionChangeTolerance)
+        ModuleTimeDependent.setUseStableTimeStep(self, self.useStableDt)
+        ModuleTimeDependent.setStableTimeStepFactor(self, self.stableDtFactor)
+        if self.checkpointInterval > 0 or self.loadImbalanceThreshold > 0.0:
+            import os
+            filename = self.checkpointFilename or os.path.join(
+                self.defaults.outputDir, "{}-checkpoint.h5".format(self.defaults.simName))
+            self._mkpath(filename)
+            ModuleTimeDependent.setCheckpointFilename(self, filename)
+        ModuleTimeDependent.setCheckpointInterval(self, self.checkpointInterval)
+        ModuleTimeDependent.setLoadImbalanceThreshold(self, self.loadImbalanceThreshold)
+        ModuleTimeDependent.setSteadyStateRate(self, self.steadyStateRate.value)
+        ModuleTimeDependent.setSteadyStateWindow(self, self.steadyStateWindow)
+        ModuleTimeDependent.setSteadyStateSubfields(self, self.steadyStateSubfields)
+        ModuleTimeDependent.setRestartFilename(self, self.restartFilename)
+        if self.parallelInTime:
+            comm, coarseDt, maxIterations, tolerance = self.parallelInTime
+            ModuleTimeDependent.setParallelInTime(self, comm.handle, coarseDt.value, maxIterations, tolerance)
+        ModuleTimeDependent.setImpulseFault(self, self.impulseLabel, self.impulseLabelValue)
+        ModuleTimeDependent.setImpulseBatchSize(self, self.impulseBatchSize)
+        ModuleTimeDependent.setResponseRank(self, self.responseRank)
+        for db, th in zip(self.slipDistributions.components(), self.slipTimeHistories.components()):
+            ModuleTimeDependent.addSlipHistory(self, db, th)
 
         # Preinitialize initial conditions.
         for ic in self.ic.components():
@@ -129,6 +316,21 @@ class TimeDependent(Problem, ModuleTimeDependent):
         self.progressMonitor.preinitialize()
         ModuleTimeDependent.setProgressMonitor(self, self.progressMonitor)
 
+    def initialize(self):
+        """Initialize integrators and constraints and add load cases.
+        """
+        Problem.initialize(self)
+
+        if self.loadCases:
+            from pylith.mpi.Communicator import mpi_is_root
+            if mpi_is_root():
+                self._info.log(f"Adding {len(self.loadCases)} load cases.")
+            bcs = [bc for bc in self.bc.components() if bc.hasLoadCases()]
+            for name in self.loadCases:
+                for bc in bcs:
+                    bc.setLoadCase(name)
+                ModuleTimeDependent.addLoadCase(self, name, bcs)
+
     def run(self, app):
         """Solve time dependent problem.
         """
@@ -138,12 +340,26 @@ class TimeDependent(Problem, ModuleTimeDependent):
 
         ModuleTimeDependent.solve(self)
 
+    def _mkpath(self, filename):
+        """Create path for checkpoint file.
+        """
+        import os
+        from pylith.mpi.Communicator import mpi_is_root
+        relpath = os.path.dirname(filename)
+        if relpath and not os.path.exists(relpath) and mpi_is_root():
+            os.makedirs(relpath)
+
     def _configure(self):
         """Set members based using inventory.
         """
         Problem._configure(self)
         if self.startTime > self.endTime:
             raise ValueError("End time {} must be later than start time {}.".format(self.startTime, self.endTime))
+        if len(set(self.loadCases)) != len(self.loadCases):
+            raise ValueError("Found duplicate names in load cases {}.".format(self.loadCases))
+        if len(self.slipDistributions.components()) != len(self.slipTimeHistories.components()):
+            raise ValueError("Number of slip distributions ({}) must match number of slip time histories ({}).".format(
+                len(self.slipDistributions.components()), len(self.slipTimeHistories.components())))
 
     def _createModuleObj(self):
         """Create handle to C++ object.
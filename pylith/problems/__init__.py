@@ -21,8 +21,10 @@
 __all__ = [
     "Problem",
     "TimeDependent",
+    "CouplerBoundary",
     "InitialCondition",
     "InitialConditionDomain",
+    "InitialConditionFile",
     "InitialConditionPatch",
     "Physics",
     "Solution",
@@ -114,11 +114,11 @@ class FullTestCase(unittest.TestCase):
                 with self.subTest(filename=filename):
                     check_data(self, filename, check, mesh_entity, check.mesh.ENTITIES[mesh_entity])
 
-    def run_pylith(self, testName, args, generatedb=None, nprocs=1):
+    def run_pylith(self, testName, args, generatedb=None, nprocs=1, appClass=PyLithApp):
         if self.RUN_PYLITH:
             if self.VERBOSITY > 0:
                 print("Running Pylith with args '{}' ...".format(" ".join(args)))
-            run_pylith(testName, args, generatedb, nprocs)
+            run_pylith(testName, args, generatedb, nprocs, appClass)
         return
 
     @staticmethod
@@ -287,6 +287,98 @@ class HDF5SizeChecker(HDF5Checker):
         self.testcase.assertEqual(ncompsE, ncomps, msg="Mismatch in number of components")
 
 
+# -------------------------------------------------------------------------------------------------
+class HDF5Comparer(object):
+    """Compare output of a simulation with output of another simulation of the same problem, such as a
+    simulation restarted from a checkpoint or run on a different number of processes.
+
+    Points are matched by their coordinates and time steps are matched by their times, so the order of the
+    points and the time steps written may differ.
+    """
+
+    def __init__(self, filename, filenameE, testcase):
+        """Constructor.
+
+        Args:
+            filename (str)
+                Name of HDF5 file with output to check.
+            filenameE (str)
+                Name of HDF5 file with expected output.
+            testcase (unittest.TestCase)
+                Test case.
+        """
+        import h5py
+
+        self.h5 = h5py.File(filename, "r")
+        self.h5E = h5py.File(filenameE, "r")
+        self.testcase = testcase
+
+    def checkVertexField(self, fieldName, tolerance, zero_tolerance):
+        field, fieldE = self._getFields("vertex_fields", fieldName)
+        pointMap = self._matchPoints(self._getVertices(self.h5), self._getVertices(self.h5E))
+        self._checkField(fieldE[:, pointMap, :], field, tolerance, zero_tolerance)
+
+    def checkCellField(self, fieldName, tolerance, zero_tolerance):
+        field, fieldE = self._getFields("cell_fields", fieldName)
+        pointMap = self._matchPoints(self._getCellCentroids(self.h5), self._getCellCentroids(self.h5E))
+        self._checkField(fieldE[:, pointMap, :], field, tolerance, zero_tolerance)
+
+    def _getFields(self, group, fieldName):
+        """Get values of field for time steps in both files.
+        """
+        for h5 in (self.h5, self.h5E):
+            self.testcase.assertTrue(group in h5.keys(), f"Missing '{group}' in '{h5.filename}'.")
+            self.testcase.assertTrue(fieldName in h5[group].keys(),
+                                     f"Could not find field '{fieldName}' in {group} of '{h5.filename}'.")
+        times = self.h5["time"][:].ravel()
+        timesE = self.h5E["time"][:].ravel()
+        steps = []
+        stepsE = []
+        for step, t in enumerate(times):
+            match = numpy.flatnonzero(numpy.abs(timesE - t) <= 1.0e-6 * max(abs(t), 1.0))
+            if len(match) > 0:
+                steps.append(step)
+                stepsE.append(match[0])
+        self.testcase.assertTrue(len(steps) > 0, f"No common time steps in '{self.h5.filename}' and '{self.h5E.filename}'.")
+        return self.h5[group][fieldName][steps, :, :], self.h5E[group][fieldName][stepsE, :, :]
+
+    @staticmethod
+    def _getVertices(h5):
+        return h5["geometry/vertices"][:]
+
+    @staticmethod
+    def _getCellCentroids(h5):
+        vertices = h5["geometry/vertices"][:]
+        cells = h5["viz/topology/cells"][:].astype(numpy.int64)
+        return numpy.mean(vertices[cells, :], axis=1)
+
+    def _matchPoints(self, points, pointsE):
+        """Get indices of points in expected output matching the points in output.
+        """
+        self.testcase.assertEqual(pointsE.shape, points.shape, msg="Mismatch in number of points")
+        extent = numpy.max(numpy.ptp(pointsE, axis=0))
+        pointsR = numpy.round(points / (1.0e-8 * extent)).astype(numpy.int64)
+        pointsER = numpy.round(pointsE / (1.0e-8 * extent)).astype(numpy.int64)
+        order = numpy.lexsort(pointsR.T[::-1])
+        orderE = numpy.lexsort(pointsER.T[::-1])
+        self.testcase.assertTrue(numpy.all(pointsR[order] == pointsER[orderE]), msg="Mismatch in point coordinates")
+        pointMap = numpy.zeros(len(points), dtype=numpy.int64)
+        pointMap[order] = orderE
+        return pointMap
+
+    def _checkField(self, fieldE, field, tolerance, zero_tolerance):
+        self.testcase.assertEqual(fieldE.shape, field.shape, msg="Mismatch in shape of field")
+        scale = numpy.mean(numpy.abs(fieldE).ravel())
+        vtolerance = scale*tolerance if scale > zero_tolerance else tolerance
+        okay = numpy.abs(field - fieldE) < vtolerance
+        msg = []
+        if not numpy.all(okay):
+            msg += [f"Expected values (not okay): {fieldE[~okay]}"]
+            msg += [f"Computed values (not okay): {field[~okay]}"]
+            msg += [f"Tolerance: {vtolerance}"]
+        self.testcase.assertTrue(numpy.all(okay), msg="\n".join(msg))
+
+
 # -------------------------------------------------------------------------------------------------
 def check_data(testcase, filename, check, mesh_entity, mesh):
     """Check vertex and cell fields in specified file.
@@ -329,7 +421,27 @@ def check_sizes(testcase, filename, check, mesh_entity, mesh):
 
 
 # -------------------------------------------------------------------------------------------------
-def run_pylith(appName, cfgfiles=[], dbClass=None, nprocs=1):
+def check_same_output(testcase, filename, filenameE, vertex_fields=[], cell_fields=[], tolerance=1.0e-6,
+                      zero_tolerance=1.0e-10):
+    """Check that vertex and cell fields in filename match those in filenameE at the common time steps.
+    """
+    if not has_h5py():
+        return
+
+    comparer = HDF5Comparer(filename, filenameE, testcase)
+
+    for field in vertex_fields:
+        with testcase.subTest(vertex_field=field):
+            comparer.checkVertexField(field, tolerance, zero_tolerance)
+
+    for field in cell_fields:
+        with testcase.subTest(cell_field=field):
+            comparer.checkCellField(field, tolerance, zero_tolerance)
+    return
+
+
+# -------------------------------------------------------------------------------------------------
+def run_pylith(appName, cfgfiles=[], dbClass=None, nprocs=1, appClass=PyLithApp):
     """Helper function to generate spatial databases and run PyLith.
     """
     # Skip running if already run.
@@ -363,7 +475,7 @@ def run_pylith(appName, cfgfiles=[], dbClass=None, nprocs=1):
                   (appNumProcs, nprocs, appNumProcs))
 
     # Run Pylith
-    app = PyLithApp()
+    app = appClass()
     app.nodes = appNumProcs
     setattr(run_pylith, str(appName), True)
     app.run(argv=["pylith"] + cfgfiles)
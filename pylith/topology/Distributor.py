@@ -25,6 +25,7 @@ class Distributor(PetscComponent, ModuleDistributor):
         "cfg": """
             [pylithapp.mesh_generator.distributor]
             partitioner = parmetis
+            use_cell_weights = True
         """
     }
 
@@ -34,8 +35,11 @@ class Distributor(PetscComponent, ModuleDistributor):
                                      validator=pythia.pyre.inventory.choice(["chaco", "metis", "parmetis", "simple"]))
     partitioner.meta['tip'] = "Name of mesh partitioner."
 
+    useCellWeights = pythia.pyre.inventory.bool("use_cell_weights", default=False)
+    useCellWeights.meta['tip'] = "Weight cells by estimated computational cost (material, basis order, cohesive cells) in partitioning."
+
     writePartition = pythia.pyre.inventory.bool("write_partition", default=False)
-    writePartition.meta['tip'] = "Write partition information to file."
+    writePartition.meta['tip'] = "Write partition information to file and report partition quality."
 
     from pylith.meshio.DataWriterHDF5 import DataWriterHDF5
     dataWriter = pythia.pyre.inventory.facility("data_writer", factory=DataWriterHDF5, family="data_writer")
@@ -63,7 +67,9 @@ class Distributor(PetscComponent, ModuleDistributor):
             partitionerName = "parmetis"
         else:
             partitionerName = self.partitioner
-        ModuleDistributor.distribute(newMesh, mesh, problem.interfaces.components(), partitionerName)
+        faults = problem.interfaces.components()
+        materialIds, materialWeights, faultWeights = self._getCellWeights(mesh, problem)
+        ModuleDistributor.distribute(newMesh, mesh, faults, partitionerName, materialIds, materialWeights, faultWeights)
 
         mesh.cleanup()
 
@@ -79,6 +85,56 @@ class Distributor(PetscComponent, ModuleDistributor):
         """
         PetscComponent._configure(self)
 
+    def _getCellWeights(self, mesh, problem):
+        """Estimate relative computational cost of cells in each material and of cohesive cells in each fault.
+
+        The cost of a cell is estimated from the number of solution and auxiliary field values in the cell, which
+        scales the work in the pointwise kernels and in assembly. Cohesive cells include the solution on both sides
+        of the fault and the fault Lagrange multiplier. Weights are integers with a minimum of 1.
+        """
+        import numpy
+
+        if not self.useCellWeights:
+            empty = numpy.zeros(0, dtype=numpy.int32)
+            return (empty, empty.copy(), empty.copy())
+
+        from math import comb
+        VECTOR_FIELDS = ["displacement", "velocity", "lagrange_multiplier_fault"]
+
+        def numValues(subfields, cellDim, spaceDim):
+            value = 0
+            for subfield in subfields:
+                numBasis = comb(max(subfield.basisOrder, 0) + cellDim, cellDim)
+                numComponents = spaceDim if getattr(subfield, "fieldName", None) in VECTOR_FIELDS else 1
+                value += numComponents * numBasis
+            return value
+
+        dim = mesh.getDimension()
+        solnSubfields = problem.solution.subfields.components()
+        domainSubfields = [s for s in solnSubfields if s.fieldName != "lagrange_multiplier_fault"]
+        faultSubfields = [s for s in solnSubfields if s.fieldName == "lagrange_multiplier_fault"]
+
+        materialIds = []
+        materialCosts = []
+        for material in problem.materials.components():
+            auxSubfields = list(material.auxiliarySubfields.components())
+            rheology = getattr(material, "rheology", None)
+            if rheology is not None:
+                auxSubfields += list(rheology.auxiliarySubfields.components())
+            materialIds.append(material.labelValue)
+            materialCosts.append(numValues(domainSubfields, dim, dim) + numValues(auxSubfields, dim, 1))
+
+        faultCosts = []
+        for fault in problem.interfaces.components():
+            auxSubfields = list(fault.auxiliarySubfields.components())
+            faultCosts.append(2 * numValues(domainSubfields, dim - 1, dim) + numValues(faultSubfields, dim - 1, dim)
+                              + numValues(auxSubfields, dim - 1, 1))
+
+        minCost = min(materialCosts + faultCosts) if len(materialCosts + faultCosts) > 0 else 1
+        def toWeights(costs):
+            return numpy.array([max(1, int(round(10.0 * cost / minCost))) for cost in costs], dtype=numpy.int32)
+        return (numpy.array(materialIds, dtype=numpy.int32), toWeights(materialCosts), toWeights(faultCosts))
+
     def _setupLogging(self):
         """Setup event logging.
         """
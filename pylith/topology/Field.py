@@ -26,6 +26,22 @@ class Field(ModuleField):
         """
         ModuleField.__init__(self, mesh)
 
+    def getSubfieldLayout(self, name):
+        """Get offset and number of degrees of freedom of subfield in the local vector for each point in the chart.
+
+        Combined with the array from getLocalArray(), which shares memory with the local vector, the values of
+        subfield `name` at point `p` are `values[offsets[p]:offsets[p]+numDof[p]]`.
+
+        Returns:
+            Tuple of NumPy arrays (offsets, numDof).
+        """
+        import numpy
+        chartSize = ModuleField.getChartSize(self)
+        offsets = numpy.zeros(chartSize, dtype=numpy.intc)
+        numDof = numpy.zeros(chartSize, dtype=numpy.intc)
+        ModuleField.getSubfieldLayout(self, name, offsets, numDof)
+        return (offsets, numDof)
+
     def cleanup(self):
         """Deallocate PETSc and local data structures.
         """
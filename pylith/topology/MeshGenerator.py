@@ -43,8 +43,11 @@ class MeshGenerator(PetscComponent):
         """
         PetscComponent._configure(self)
 
-    def _adjustTopology(self, mesh, interfaces, problem):
+    def _adjustTopology(self, mesh, interfaces, problem, createCohesiveCells=True):
         """Adjust topology for interface implementation.
+
+        If `createCohesiveCells` is False, the mesh already contains the cohesive cells (for example, a prepared
+        mesh), so only the interfaces are set up.
         """
         logEvent = "%sadjTopo" % self._loggingPrefix
         self._eventLogger.eventBegin(logEvent)
@@ -57,11 +60,12 @@ class MeshGenerator(PetscComponent):
                 labelValue = material.labelValue
                 cohesiveLabelValue = max(cohesiveLabelValue, labelValue+1)
             for interface in interfaces:
-                if mpi_is_root():
+                if mpi_is_root() and createCohesiveCells:
                     self._info.log("Adjusting topology for fault '%s'." % interface.labelName)
                 interface.preinitialize(problem)
                 interface.setCohesiveLabelValue(cohesiveLabelValue)
-                interface.adjustTopology(mesh)
+                if createCohesiveCells:
+                    interface.adjustTopology(mesh)
                 cohesiveLabelValue += 1
 
         self._eventLogger.eventEnd(logEvent)
@@ -26,7 +26,11 @@ class MeshImporter(MeshGenerator):
         "cfg": """
             [pylithapp.meshimporter]
             reorder_mesh = True
+            reorder_method = rcm
             check_topology = True
+            insert_faults_after_distribution = False
+            export_filename = ""
+            prepared_mesh_filename = ""
             reader = pylith.meshio.MeshIOCubit
             refiner = pylith.topology.RefineUniform
         """
@@ -37,8 +41,21 @@ class MeshImporter(MeshGenerator):
     reorderMesh = pythia.pyre.inventory.bool("reorder_mesh", default=True)
     reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
 
+    reorderMethod = pythia.pyre.inventory.str("reorder_method", default="rcm",
+                                              validator=pythia.pyre.inventory.choice(["rcm", "rcm_material", "hilbert", "morton"]))
+    reorderMethod.meta['tip'] = "Algorithm for reordering mesh ['rcm', 'rcm_material', 'hilbert', 'morton']."
+
     checkTopology = pythia.pyre.inventory.bool("check_topology", default=True)
-    checkTopology.meta['tip'] = "Check topology of imported mesh."
+    checkTopology.meta['tip'] = "Check topology of imported mesh (after distribution in parallel runs)."
+
+    insertFaultsAfterDistribution = pythia.pyre.inventory.bool("insert_faults_after_distribution", default=False)
+    insertFaultsAfterDistribution.meta['tip'] = "Create cohesive cells for faults in parallel after distributing the mesh."
+
+    exportFilename = pythia.pyre.inventory.str("export_filename", default="")
+    exportFilename.meta['tip'] = "Name of PETSc DMPlex HDF5 file (extension '.h5') for writing the mesh after reading it (default is no export)."
+
+    preparedMeshFilename = pythia.pyre.inventory.str("prepared_mesh_filename", default="")
+    preparedMeshFilename.meta['tip'] = "Name of HDF5 file for caching the prepared (reordered, distributed, and refined with cohesive cells) mesh (default is no caching)."
 
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pythia.pyre.inventory.facility("reader", family="mesh_io", factory=MeshIOAscii)
@@ -78,8 +95,25 @@ class MeshImporter(MeshGenerator):
         logEvent = "%screate" % self._loggingPrefix
         self._eventLogger.eventBegin(logEvent)
 
-        # Read mesh
-        mesh = self.reader.read(self.checkTopology)
+        # Reuse prepared mesh if it was created from the same input and parameters.
+        if self.preparedMeshFilename:
+            preparedKey = self._getPreparedMeshKey(faults)
+            mesh = self._loadPreparedMesh(preparedKey)
+            if mesh:
+                if isRoot:
+                    self._info.log("Using prepared mesh from '%s'." % self.preparedMeshFilename)
+                self._adjustTopology(mesh, faults, problem, createCohesiveCells=False)
+
+                from pylith.topology.topology import MeshOps_nondimensionalize
+                MeshOps_nondimensionalize(mesh, problem.normalizer)
+                self._eventLogger.eventEnd(logEvent)
+                return mesh
+
+        # Read mesh. In parallel runs the topology is checked after distribution, so each process checks only its
+        # own portion of the mesh.
+        from pylith.mpi.Communicator import petsc_comm_world
+        comm = petsc_comm_world()
+        mesh = self.reader.read(self.checkTopology and comm.size == 1)
 
         # Reorder mesh
         if self.reorderMesh:
@@ -87,36 +121,69 @@ class MeshImporter(MeshGenerator):
             self._eventLogger.eventBegin(logEvent2)
             self._debug.log(resourceUsageString())
             if isRoot:
-                self._info.log("Reordering cells and vertices.")
+                self._info.log("Reordering cells and vertices using '%s' ordering." % self.reorderMethod)
             from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
             ordering = ReverseCuthillMcKee()
-            ordering.reorder(mesh)
+            ordering.reorder(mesh, self.reorderMethod)
             self._eventLogger.eventEnd(logEvent2)
 
-        # Adjust topology
-        self._debug.log(resourceUsageString())
-        if isRoot:
-            self._info.log("Adjusting topology.")
-        self._adjustTopology(mesh, faults, problem)
+        # Export mesh to PETSc DMPlex HDF5 file, which can be read in parallel by MeshIOPetsc.
+        if self.exportFilename:
+            if isRoot:
+                self._info.log("Exporting mesh to '%s'." % self.exportFilename)
+            from pylith.meshio.MeshIOPetsc import MeshIOPetsc
+            exporter = MeshIOPetsc()
+            exporter.preinitialize()
+            exporter.setFilename(self.exportFilename)
+            exporter.write(mesh)
+
+        # Adjust topology and distribute mesh. Cohesive cells are created either on the serial mesh before
+        # distribution or on each process's partition after distribution. Refiners that do not support cohesive
+        # cells refine the mesh before the cohesive cells are created.
+        refineBeforeFaults = self.refiner.REFINE_BEFORE_FAULTS
+        insertFaultsAfter = (self.insertFaultsAfterDistribution or refineBeforeFaults) and comm.size > 1
+        if not insertFaultsAfter and not refineBeforeFaults:
+            self._debug.log(resourceUsageString())
+            if isRoot:
+                self._info.log("Adjusting topology.")
+            self._adjustTopology(mesh, faults, problem)
 
-        # Distribute mesh
-        from pylith.mpi.Communicator import mpi_comm_world
-        comm = mpi_comm_world()
         if comm.size > 1:
             if isRoot:
                 self._info.log("Distributing mesh.")
             mesh = self.distributor.distribute(mesh, problem)
             mesh.memLoggingStage = "DistributedMesh"
 
+        if refineBeforeFaults:
+            mesh = self._refine(mesh)
+
+        if insertFaultsAfter or refineBeforeFaults:
+            self._debug.log(resourceUsageString())
+            if isRoot:
+                self._info.log("Adjusting topology of distributed mesh." if comm.size > 1 else "Adjusting topology.")
+            self._adjustTopology(mesh, faults, problem)
+
         # Refine mesh (if necessary)
-        newMesh = self.refiner.refine(mesh)
-        if not newMesh == mesh:
-            mesh.cleanup()
-            newMesh.memLoggingStage = "RefinedMesh"
+        if refineBeforeFaults:
+            newMesh = mesh
+        else:
+            newMesh = self._refine(mesh)
 
         # Can't reorder mesh again, because we do not have routine to
         # unmix normal and hybrid cells.
 
+        if self.checkTopology and comm.size > 1:
+            if isRoot:
+                self._info.log("Checking topology of distributed mesh.")
+            from pylith.topology.topology import MeshOps_checkDistributedTopology
+            MeshOps_checkDistributedTopology(newMesh)
+
+        if self.preparedMeshFilename:
+            if isRoot:
+                self._info.log("Saving prepared mesh to '%s'." % self.preparedMeshFilename)
+            from pylith.topology.topology import MeshOps_savePrepared
+            MeshOps_savePrepared(newMesh, self.preparedMeshFilename, preparedKey)
+
         # Nondimensionalize mesh (coordinates of vertices).
         from pylith.topology.topology import MeshOps_nondimensionalize
         MeshOps_nondimensionalize(newMesh, problem.normalizer)
@@ -129,6 +196,67 @@ class MeshImporter(MeshGenerator):
         """
         MeshGenerator._configure(self)
 
+    def _refine(self, mesh):
+        """Refine mesh using refiner.
+
+        @returns Refined mesh (`mesh` if the refiner does not refine the mesh).
+        """
+        newMesh = self.refiner.refine(mesh)
+        if not newMesh == mesh:
+            mesh.cleanup()
+            newMesh.memLoggingStage = "RefinedMesh"
+        return newMesh
+
+    def _getPreparedMeshKey(self, faults):
+        """Get key identifying the input mesh file and the parameters used to prepare the mesh.
+
+        The key is only computed on the root process, because only the root process compares it with the key in
+        the prepared mesh file.
+        """
+        from pylith.mpi.Communicator import petsc_comm_world
+        if petsc_comm_world().rank > 0:
+            return ""
+
+        import hashlib
+        import os
+        digest = hashlib.sha256()
+        filename = getattr(self.reader, "filename", "")
+        if filename and os.path.isfile(filename):
+            with open(filename, "rb") as fin:
+                for chunk in iter(lambda: fin.read(16*1024**2), b""):
+                    digest.update(chunk)
+        params = {
+            "reader": "%s:%s" % (self.reader.__class__.__name__, filename),
+            "num_procs": petsc_comm_world().size,
+            "reorder_mesh": self.reorderMesh,
+            "reorder_method": self.reorderMethod,
+            "insert_faults_after_distribution": self.insertFaultsAfterDistribution,
+            "partitioner": self.distributor.partitioner,
+            "use_cell_weights": self.distributor.useCellWeights,
+            "refiner": "%s:%d:%s:%d" % (self.refiner.__class__.__name__, getattr(self.refiner, "levels", 0),
+                                        getattr(self.refiner, "labelName", ""), getattr(self.refiner, "labelValue", 0)),
+            "faults": [(fault.labelName, fault.labelValue, fault.edgeName, fault.edgeValue) for fault in (faults or [])],
+        }
+        digest.update(repr(sorted(params.items())).encode("utf-8"))
+        return digest.hexdigest()
+
+    def _loadPreparedMesh(self, key):
+        """Load prepared mesh if it exists and matches the key and number of processes.
+
+        @returns Mesh if prepared mesh was loaded, None otherwise.
+        """
+        from pylith.mpi.Communicator import petsc_comm_world
+        from pylith.topology.Mesh import Mesh
+        from pylith.topology.topology import MeshOps_loadPrepared
+
+        coordsys = self.reader.coordsys
+        mesh = Mesh(dim=coordsys.getSpaceDim(), comm=petsc_comm_world())
+        mesh.setCoordSys(coordsys)
+        if not MeshOps_loadPrepared(mesh, self.preparedMeshFilename, key):
+            return None
+        mesh.memLoggingStage = "PreparedMesh"
+        return mesh
+
     def _setupLogging(self):
         """Setup event logging.
         """
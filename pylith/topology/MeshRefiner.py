@@ -21,6 +21,9 @@ class MeshRefiner(PetscComponent):
     Abstract base class for refining a mesh in parallel.
     """
 
+    # True if the refiner does not support cohesive cells, so the mesh must be refined before inserting faults.
+    REFINE_BEFORE_FAULTS = False
+
     def __init__(self, name="refiner"):
         """Constructor.
         """
@@ -0,0 +1,116 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .MeshRefiner import MeshRefiner
+from .topology import RefineAdaptive as ModuleRefineAdaptive
+
+
+def validateLabel(value):
+    """Validate label for group of points.
+    """
+    if 0 == len(value):
+        raise ValueError("Label for group of points for adaptive mesh refinement not specified.")
+    return value
+
+
+class RefineAdaptive(MeshRefiner, ModuleRefineAdaptive):
+    """
+    Local mesh refinement in parallel of cells sharing a point with a group of points, such as a fault surface or
+    the buried edges of a fault.
+
+    Each level refines the cells adjacent to the group on the mesh from the previous level, so the cell size
+    decreases by a factor of two per level near the group. Requires simplex cells (triangles or tetrahedra). The
+    mesh is refined before the cohesive cells for the faults are created.
+
+    Implements `MeshRefiner`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            # Refine mesh twice near the buried edges of the fault.
+            [pylithapp.mesh_generator]
+            refiner = pylith.topology.RefineAdaptive
+
+            [pylithapp.mesh_generator.refiner]
+            label = fault_edges
+            label_value = 1
+            levels = 2
+        """
+    }
+
+    REFINE_BEFORE_FAULTS = True
+
+    import pythia.pyre.inventory
+
+    labelName = pythia.pyre.inventory.str("label", default="", validator=validateLabel)
+    labelName.meta['tip'] = "Name of label for group of points near which cells are refined."
+
+    labelValue = pythia.pyre.inventory.int("label_value", default=1)
+    labelValue.meta['tip'] = "Value of label for group of points near which cells are refined."
+
+    levels = pythia.pyre.inventory.int("levels", default=1, validator=pythia.pyre.inventory.greaterEqual(1))
+    levels.meta['tip'] = "Number of refinement levels."
+
+    def __init__(self, name="refineadaptive"):
+        """Constructor.
+        """
+        MeshRefiner.__init__(self, name)
+
+    def preinitialize(self):
+        """Do minimal initialization."""
+        MeshRefiner.preinitialize(self)
+
+        self._createModuleObj()
+        ModuleRefineAdaptive.setLabel(self, self.labelName, self.labelValue)
+
+    def refine(self, mesh):
+        """Refine mesh.
+        """
+        self._setupLogging()
+        logEvent = "%srefine" % self._loggingPrefix
+        self._eventLogger.eventBegin(logEvent)
+
+        from pylith.mpi.Communicator import mpi_is_root
+        if mpi_is_root():
+            self._info.log("Refining mesh near '%s' using adaptive refinement." % self.labelName)
+
+        from .Mesh import Mesh
+        newMesh = Mesh()
+        newMesh.setCoordSys(mesh.getCoordSys())
+        ModuleRefineAdaptive.refine(self, newMesh, mesh, self.levels)
+        mesh.cleanup()
+
+        self._eventLogger.eventEnd(logEvent)
+        return newMesh
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        MeshRefiner._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleRefineAdaptive.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def mesh_refiner():
+    """Factory associated with RefineAdaptive.
+    """
+    return RefineAdaptive()
+
+
+# End of file
@@ -28,6 +28,7 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
             # Refine mesh twice to reduce size of cell edges by a factor of 4.
             [pylithapp.mesh_generator.refiner]
             levels = 2
+            keep_coarse_levels = False
         """
     }
 
@@ -36,6 +37,9 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
     levels = pythia.pyre.inventory.int("levels", default=1, validator=pythia.pyre.inventory.greaterEqual(1))
     levels.meta['tip'] = "Number of refinement levels."
 
+    keepCoarseLevels = pythia.pyre.inventory.bool("keep_coarse_levels", default=False)
+    keepCoarseLevels.meta['tip'] = "Keep coarse meshes for geometric multigrid preconditioner."
+
     def __init__(self, name="refineuniform"):
         """Constructor.
         """
@@ -46,6 +50,7 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
         MeshRefiner.preinitialize(self)
 
         self._createModuleObj()
+        ModuleRefineUniform.setKeepCoarseLevels(self, self.keepCoarseLevels)
 
     def refine(self, mesh):
         """Refine mesh.
@@ -18,18 +18,30 @@ from .topology import ReverseCuthillMcKee as ModuleReverseCuthillMcKee
 
 class ReverseCuthillMcKee(ModuleReverseCuthillMcKee):
     """
-    Interface to PETSc reverse Cuthill-McKee reordering of mesh cells and vertices.
+    Interface to reordering of mesh cells and vertices.
+
+    Orderings:
+      - rcm: PETSc reverse Cuthill-McKee over the entire mesh.
+      - rcm_material: Reverse Cuthill-McKee within each material.
+      - hilbert: Hilbert space-filling curve on cell centroids within each material.
+      - morton: Morton (Z-order) space-filling curve on cell centroids within each material.
     """
+    ORDERINGS = {
+        "rcm": ModuleReverseCuthillMcKee.RCM,
+        "rcm_material": ModuleReverseCuthillMcKee.RCM_MATERIAL,
+        "hilbert": ModuleReverseCuthillMcKee.HILBERT,
+        "morton": ModuleReverseCuthillMcKee.MORTON,
+    }
 
     def __init__(self):
         """Constructor.
         """
         return
 
-    def reorder(self, mesh):
-        """Set communicator.
+    def reorder(self, mesh, ordering="rcm"):
+        """Reorder cells and vertices of mesh using ordering.
         """
-        ModuleReverseCuthillMcKee.reorder(mesh)
+        ModuleReverseCuthillMcKee.reorder(mesh, self.ORDERINGS[ordering])
 
 
 # End of file
@@ -40,8 +40,8 @@ class Subfield(Component):
     isBasisContinuous.meta['tip'] = "Is basis continuous?"
 
     feSpaceStr = pythia.pyre.inventory.str("finite_element_space", default="polynomial",
-                                    validator=pythia.pyre.inventory.choice(["polynomial", "point"]))
-    feSpaceStr.meta['tip'] = "Finite-element space (polynomial or point). Point space corresponds to delta functions at quadrature points."
+                                    validator=pythia.pyre.inventory.choice(["polynomial", "point", "gll"]))
+    feSpaceStr.meta['tip'] = "Finite-element space (polynomial, point, or gll). Point space corresponds to delta functions at quadrature points. GLL space uses Gauss-Lobatto-Legendre nodes with collocated quadrature (quadrilateral and hexahedral cells)."
 
     # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -71,6 +71,7 @@ class Subfield(Component):
         mapSpace = {
             "polynomial": FieldBase.POLYNOMIAL_SPACE,
             "point": FieldBase.POINT_SPACE,
+            "gll": FieldBase.GLL_SPACE,
         }
         self.feSpace = mapSpace[self.inventory.feSpaceStr]
         return
@@ -27,6 +27,7 @@ __all__ = [
     "MeshImporter",
     "MeshRefiner",
     "RefineUniform",
+    "RefineAdaptive",
     "ReverseCuthillMcKee",
     "Subfield",
 ]
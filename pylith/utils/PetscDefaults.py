@@ -29,6 +29,8 @@ class PetscDefaults(Component):
             parallel = False
             initial_guess = True
             testing = False
+            single_precision_pc = False
+            reuse_amg_interpolation = False
         """
     }
 
@@ -49,6 +51,12 @@ class PetscDefaults(Component):
     testing = pythia.pyre.inventory.bool("testing", default=False)
     testing.meta["tip"] = "Use default PETSc testing options."
 
+    singlePrecisionPC = pythia.pyre.inventory.bool("single_precision_pc", default=False)
+    singlePrecisionPC.meta["tip"] = "Factor and apply direct solver preconditioners in single precision (requires MUMPS)."
+
+    reuseAMGInterpolation = pythia.pyre.inventory.bool("reuse_amg_interpolation", default=False)
+    reuseAMGInterpolation.meta["tip"] = "Reuse algebraic multigrid interpolation when the Jacobian is rebuilt."
+
     def __init__(self, name="petscdefaults"):
         """Constructor.
         """
@@ -67,6 +75,10 @@ class PetscDefaults(Component):
             value |= ModuleDefaults.INITIAL_GUESS
         if self.testing:
             value |= ModuleDefaults.TESTING
+        if self.singlePrecisionPC:
+            value |= ModuleDefaults.SINGLE_PRECISION_PC
+        if self.reuseAMGInterpolation:
+            value |= ModuleDefaults.REUSE_AMG_INTERPOLATION
         return value
 
 
@@ -19,18 +19,23 @@
 # ----------------------------------------------------------------------
 def resourceUsage():
     """Get CPU time (hh:mm:ss) and memory use (MB).
+
+    Uses getrusage() and /proc rather than running `ps`, because spawning a process on every rank is slow at scale.
     """
+    import resource
+    import sys
+
+    usage = resource.getrusage(resource.RUSAGE_SELF)
+    seconds = int(usage.ru_utime + usage.ru_stime)
+    cputime = "%02d:%02d:%02d" % (seconds // 3600, (seconds // 60) % 60, seconds % 60)
 
+    # Current resident set size on Linux, otherwise maximum resident set size (bytes on macOS, kilobytes elsewhere).
     try:
-        import os
-        import commands
-        cmd = "ps -p %d -o cputime,rss" % os.getpid()
-        info = commands.getoutput(cmd).split()
-        cputime = info[2]
-        memory = float(info[3])/1024.0
-    except:
-        cputime = "n/a"
-        memory = 0
+        with open("/proc/self/statm", "r") as fin:
+            memory = float(fin.read().split()[1]) * resource.getpagesize() / 1024.0**2
+    except (OSError, IndexError, ValueError):
+        scale = 1024.0**2 if sys.platform == "darwin" else 1024.0
+        memory = usage.ru_maxrss / scale
     return (cputime, memory)
 
 
@@ -0,0 +1,723 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** Benchmark of output through the data writers.
+ *
+ * A box mesh is created on process 0, distributed with `Distributor`, and refined uniformly with `RefineUniform`,
+ * as in a simulation. A vertex field (displacement, velocity, pressure) and a cell field (Cauchy stress and strain)
+ * with values that change every time step are written through each data writer for a number of time steps. Times
+ * are wall-clock times on process 0 between barriers, so they include waiting for the slowest process.
+ *
+ * The step time includes openTimeStep(), writing all subfields, and closeTimeStep(); it excludes projecting the
+ * fields to the output subfields. DataWriterHDF5 appends each time step to its Xdmf file in closeTimeStep(), so the
+ * cost of its Xdmf file is included in the step time. For DataWriterHDF5Ext, the Xdmf time is the time to generate
+ * the Xdmf file after closing the HDF5 file (requires the PyLith Python modules).
+ *
+ * Usage: mpiexec -n NPROCS benchmark_datawriters [--dim=N] [--cells=N] [--refine=N] [--steps=N]
+ *            [--writers=LIST] [--output-dir=DIR] [--staging-dir=DIR] [--aggregation-ratio=N] [--partitioner=NAME]
+ *            [--json=FILENAME] [--keep]
+ */
+
+#include <portinfo>
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps::deallocate()
+#include "pylith/topology/Distributor.hh" // USES Distributor
+#include "pylith/topology/RefineUniform.hh" // USES RefineUniform
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/meshio/DataWriterHDF5.hh" // USES DataWriterHDF5
+#include "pylith/meshio/DataWriterHDF5Ext.hh" // USES DataWriterHDF5Ext
+#include "pylith/meshio/DataWriterVTK.hh" // USES DataWriterVTK
+#if defined(ENABLE_ADIOS2)
+#include "pylith/meshio/DataWriterADIOS2.hh" // USES DataWriterADIOS2
+#endif
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/meshio/Xdmf.hh" // USES Xdmf
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <getopt.h> // USES getopt_long()
+#include <algorithm> // USES std::max()
+#include <cmath> // USES sin()
+#include <cstdio> // USES remove()
+#include <cstdlib> // USES atoi()
+#include <fstream> // USES std::ofstream
+#include <iomanip> // USES std::setw()
+#include <iostream> // USES std::cout
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+class _BenchmarkDataWriters {
+public:
+
+    /// Parameters of benchmark.
+    struct Parameters {
+        int dim; ///< Spatial dimension of mesh.
+        int numCells; ///< Number of cells along each side of coarse mesh.
+        int refineLevels; ///< Number of levels of uniform refinement.
+        int numSteps; ///< Number of output time steps.
+        int aggregationRatio; ///< Number of processes per writer process for aggregated HDF5Ext output.
+        std::string writers; ///< Comma separated list of writers.
+        std::string outputDir; ///< Directory for output files.
+        std::string stagingDir; ///< Node-local directory for staged HDF5Ext output.
+        std::string partitioner; ///< Name of PETSc partitioner.
+        std::string jsonFilename; ///< Name of file for results in JSON format.
+        bool keepFiles; ///< Keep output files.
+    };
+
+    /// Timing of a data writer.
+    struct Result {
+        std::string writer; ///< Name of writer.
+        double openTime; ///< Time to open writer (s).
+        double stepTime; ///< Average time to write a time step (s).
+        double closeTime; ///< Time to close writer (s).
+        double xdmfTime; ///< Time to generate Xdmf file after closing (s, negative if not applicable).
+        double bandwidth; ///< Rate of writing field values over time steps (GB/s).
+    };
+
+    /// Mesh and fields written by the data writers.
+    struct Data {
+        pylith::topology::Mesh* mesh;
+        pylith::topology::Field* vertexField;
+        pylith::topology::Field* cellField;
+        std::vector<pylith::meshio::OutputSubfield*> vertexSubfields;
+        std::vector<pylith::meshio::OutputSubfield*> cellSubfields;
+        size_t bytesPerStep; ///< Number of bytes of field values written in each time step.
+    };
+
+    /** Create distributed, refined mesh and fields.
+     *
+     * @param[out] data Mesh and fields.
+     * @param[in] params Parameters of benchmark.
+     */
+    static
+    void createData(Data* data,
+                    const Parameters& params);
+
+    /** Deallocate mesh and fields.
+     *
+     * @param[inout] data Mesh and fields.
+     */
+    static
+    void destroyData(Data* data);
+
+    /** Set values of fields for a time step and project them to the output subfields.
+     *
+     * @param[inout] data Mesh and fields.
+     * @param[in] step Time step index.
+     */
+    static
+    void updateFields(Data* data,
+                      const int step);
+
+    /** Run benchmark of a data writer.
+     *
+     * @param[in] name Name of writer.
+     * @param[inout] data Mesh and fields.
+     * @param[in] params Parameters of benchmark.
+     * @returns Timing of data writer.
+     */
+    static
+    Result run(const std::string& name,
+               Data* data,
+               const Parameters& params);
+
+    /** Write results in JSON format.
+     *
+     * @param[in] filename Name of file.
+     * @param[in] results Timing of data writers.
+     * @param[in] params Parameters of benchmark.
+     * @param[in] data Mesh and fields.
+     * @param[in] numProcs Number of processes.
+     */
+    static
+    void writeJSON(const std::string& filename,
+                   const std::vector<Result>& results,
+                   const Parameters& params,
+                   const Data& data,
+                   const int numProcs);
+
+private:
+
+    /** Create data writer.
+     *
+     * @param[in] name Name of writer.
+     * @param[in] params Parameters of benchmark.
+     * @param[out] filenames Names of HDF5 and Xdmf files written (HDF5 file first).
+     * @returns Data writer (caller is responsible for deleting it).
+     */
+    static
+    pylith::meshio::DataWriter* _createWriter(const std::string& name,
+                                              const Parameters& params,
+                                              std::vector<std::string>* filenames);
+
+    /** Add subfield to field.
+     *
+     * @param[inout] field Field.
+     * @param[in] name Name of subfield.
+     * @param[in] vectorFieldType Type of subfield.
+     * @param[in] basisOrder Basis order of discretization.
+     */
+    static
+    void _addSubfield(pylith::topology::Field* field,
+                      const char* name,
+                      const pylith::topology::FieldBase::VectorFieldEnum vectorFieldType,
+                      const int basisOrder);
+
+    /// Get wall-clock time on process 0 after all processes reach this point.
+    static
+    double _wtime(void);
+
+}; // _BenchmarkDataWriters
+
+// ------------------------------------------------------------------------------------------------
+int
+main(int argc,
+     char* argv[]) {
+    _BenchmarkDataWriters::Parameters params;
+    params.dim = 3;
+    params.numCells = 8;
+    params.refineLevels = 0;
+    params.numSteps = 10;
+    params.aggregationRatio = 4;
+    params.writers = "hdf5,hdf5_collective,hdf5_deflate,hdf5ext,hdf5ext_aggregate,hdf5ext_prealloc,hdf5ext_async,vtk";
+    params.outputDir = ".";
+    params.partitioner = "parmetis";
+    params.keepFiles = false;
+
+    static struct option options[] = {
+        {"dim", required_argument, NULL, 'd'},
+        {"cells", required_argument, NULL, 'c'},
+        {"refine", required_argument, NULL, 'r'},
+        {"steps", required_argument, NULL, 's'},
+        {"writers", required_argument, NULL, 'w'},
+        {"output-dir", required_argument, NULL, 'o'},
+        {"staging-dir", required_argument, NULL, 'g'},
+        {"aggregation-ratio", required_argument, NULL, 'a'},
+        {"partitioner", required_argument, NULL, 'p'},
+        {"json", required_argument, NULL, 'j'},
+        {"keep", no_argument, NULL, 'k'},
+        {"help", no_argument, NULL, 'h'},
+        {0, 0, 0, 0}
+    };
+    int c = 0;
+    while ((c = getopt_long(argc, argv, "d:c:r:s:w:o:g:a:p:j:kh", options, NULL)) != -1) {
+        switch (c) {
+        case 'd':
+            params.dim = (2 == atoi(optarg)) ? 2 : 3;
+            break;
+        case 'c':
+            params.numCells = std::max(atoi(optarg), 1);
+            break;
+        case 'r':
+            params.refineLevels = std::max(atoi(optarg), 0);
+            break;
+        case 's':
+            params.numSteps = std::max(atoi(optarg), 1);
+            break;
+        case 'w':
+            params.writers = optarg;
+            break;
+        case 'o':
+            params.outputDir = optarg;
+            break;
+        case 'g':
+            params.stagingDir = optarg;
+            break;
+        case 'a':
+            params.aggregationRatio = std::max(atoi(optarg), 1);
+            break;
+        case 'p':
+            params.partitioner = optarg;
+            break;
+        case 'j':
+            params.jsonFilename = optarg;
+            break;
+        case 'k':
+            params.keepFiles = true;
+            break;
+        case 'h':
+        default:
+            std::cout << "Usage: " << argv[0] << " [options]\n"
+                      << "  --dim=N                Spatial dimension, 2 or 3 (default: 3).\n"
+                      << "  --cells=N              Number of cells along each side of coarse mesh (default: 8).\n"
+                      << "  --refine=N             Number of levels of uniform refinement after distribution (default: 0).\n"
+                      << "  --steps=N              Number of output time steps (default: 10).\n"
+                      << "  --writers=LIST         Comma separated list of writers (default: all except hdf5ext_staging).\n"
+                      << "                         hdf5, hdf5_collective, hdf5_deflate, hdf5ext, hdf5ext_aggregate,\n"
+                      << "                         hdf5ext_prealloc, hdf5ext_async, hdf5ext_staging, vtk"
+#if defined(ENABLE_ADIOS2)
+                      << ", adios2"
+#endif
+                      << ".\n"
+                      << "  --output-dir=DIR       Directory for output files (default: .).\n"
+                      << "  --staging-dir=DIR      Node-local directory for hdf5ext_staging.\n"
+                      << "  --aggregation-ratio=N  Processes per writer process for hdf5ext_aggregate and hdf5ext_async (default: 4).\n"
+                      << "  --partitioner=NAME     PETSc partitioner (default: parmetis).\n"
+                      << "  --json=FILENAME        Write results to FILENAME in JSON format.\n"
+                      << "  --keep                 Keep output files.\n"
+                      << "PETSc options may be given in the PETSC_OPTIONS environment variable.\n";
+            return ('h' == c) ? 0 : 1;
+        } // switch
+    } // while
+
+    int petscArgc = 1;
+    char** petscArgv = argv;
+    PetscErrorCode err = PetscInitialize(&petscArgc, &petscArgv, NULL, NULL);CHKERRQ(err);
+
+    PetscMPIInt commRank = 0, commSize = 1;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &commRank);
+    MPI_Comm_size(PETSC_COMM_WORLD, &commSize);
+
+    int status = 0;
+    try {
+        _BenchmarkDataWriters::Data data;
+        _BenchmarkDataWriters::createData(&data, params);
+
+        if (!commRank) {
+            std::cout << "Cells: " << pylith::topology::MeshOps::getNumCells(*data.mesh) << " on process 0, "
+                      << "processes: " << commSize << ", time steps: " << params.numSteps << ", "
+                      << "field values per time step: " << double(data.bytesPerStep) / (1024.0*1024.0) << " MiB\n";
+            std::cout << std::left << std::setw(20) << "writer" << std::right
+                      << std::setw(12) << "open (s)" << std::setw(12) << "step (s)" << std::setw(12) << "close (s)"
+                      << std::setw(12) << "xdmf (s)" << std::setw(12) << "GB/s" << std::endl;
+        } // if
+
+        std::vector<_BenchmarkDataWriters::Result> results;
+        std::istringstream writers(params.writers);
+        std::string name;
+        while (std::getline(writers, name, ',')) {
+            if (name.empty()) {
+                continue;
+            } // if
+            const _BenchmarkDataWriters::Result& result = _BenchmarkDataWriters::run(name, &data, params);
+            if (!commRank) {
+                std::cout << std::left << std::setw(20) << result.writer << std::right << std::fixed << std::setprecision(4)
+                          << std::setw(12) << result.openTime << std::setw(12) << result.stepTime
+                          << std::setw(12) << result.closeTime;
+                if (result.xdmfTime >= 0.0) {
+                    std::cout << std::setw(12) << result.xdmfTime;
+                } else {
+                    std::cout << std::setw(12) << "-";
+                } // if/else
+                std::cout << std::setprecision(3) << std::setw(12) << result.bandwidth << std::endl;
+            } // if
+            results.push_back(result);
+        } // while
+
+        if (!params.jsonFilename.empty() && !commRank) {
+            _BenchmarkDataWriters::writeJSON(params.jsonFilename, results, params, data, commSize);
+        } // if
+
+        _BenchmarkDataWriters::destroyData(&data);
+    } catch (const std::exception& err) {
+        std::cerr << "Error: " << err.what() << std::endl;
+        status = 1;
+    } // try/catch
+
+    pylith::topology::FieldOps::deallocate();
+    err = PetscFinalize();CHKERRQ(err);
+
+    return status;
+} // main
+
+
+// ------------------------------------------------------------------------------------------------
+// Create distributed, refined mesh and fields.
+void
+_BenchmarkDataWriters::createData(Data* data,
+                                  const Parameters& params) {
+    PYLITH_METHOD_BEGIN;
+    assert(data);
+
+    // Box mesh on process 0 created through the PETSc options database (avoids differences in the arguments of
+    // DMPlexCreateBoxMesh() among PETSc versions).
+    std::ostringstream faces;
+    for (int i = 0; i < params.dim; ++i) {
+        faces << (i > 0 ? "," : "") << params.numCells;
+    } // for
+    std::ostringstream dim;
+    dim << params.dim;
+    PetscErrorCode err = 0;
+    err = PetscOptionsSetValue(NULL, "-benchmark_dm_plex_dim", dim.str().c_str());PYLITH_CHECK_ERROR(err);
+    err = PetscOptionsSetValue(NULL, "-benchmark_dm_plex_simplex", "1");PYLITH_CHECK_ERROR(err);
+    err = PetscOptionsSetValue(NULL, "-benchmark_dm_plex_box_faces", faces.str().c_str());PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmMesh = NULL;
+    err = DMCreate(PETSC_COMM_WORLD, &dmMesh);PYLITH_CHECK_ERROR(err);
+    err = DMSetType(dmMesh, DMPLEX);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetOptionsPrefix((PetscObject) dmMesh, "benchmark_");PYLITH_CHECK_ERROR(err);
+    err = DMPlexDistributeSetDefault(dmMesh, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    err = DMSetFromOptions(dmMesh);PYLITH_CHECK_ERROR(err);
+
+    // Single material, as in a simulation with one material.
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMCreateLabel(dmMesh, pylith::topology::Mesh::cells_label_name);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        err = DMSetLabelValue(dmMesh, pylith::topology::Mesh::cells_label_name, cell, 1);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(params.dim);
+
+    pylith::topology::Mesh meshSerial;
+    meshSerial.setDM(dmMesh);
+    meshSerial.setCoordSys(&cs);
+
+    pylith::topology::Mesh meshDist;
+    pylith::topology::Distributor::distribute(&meshDist, meshSerial, NULL, 0, params.partitioner.c_str(),
+                                              NULL, 0, NULL, 0, NULL, 0);
+
+    data->mesh = new pylith::topology::Mesh;
+    if (params.refineLevels > 0) {
+        pylith::topology::RefineUniform refiner;
+        refiner.refine(data->mesh, meshDist, params.refineLevels);
+    } else {
+        PetscDM dmDist = NULL;
+        err = DMClone(meshDist.getDM(), &dmDist);PYLITH_CHECK_ERROR(err);
+        data->mesh->setDM(dmDist);
+    } // if/else
+    data->mesh->setCoordSys(&cs);
+
+    // Vertex field with subfields of solution and cell field with subfields of derived fields.
+    data->vertexField = new pylith::topology::Field(*data->mesh);
+    data->vertexField->setLabel("solution");
+    _addSubfield(data->vertexField, "displacement", pylith::topology::FieldBase::VECTOR, 1);
+    _addSubfield(data->vertexField, "velocity", pylith::topology::FieldBase::VECTOR, 1);
+    _addSubfield(data->vertexField, "pressure", pylith::topology::FieldBase::SCALAR, 1);
+
+    data->cellField = new pylith::topology::Field(*data->mesh);
+    data->cellField->setLabel("derived");
+    _addSubfield(data->cellField, "cauchy_stress", pylith::topology::FieldBase::TENSOR, 0);
+    _addSubfield(data->cellField, "cauchy_strain", pylith::topology::FieldBase::TENSOR, 0);
+
+    pylith::topology::Field* fields[2] = { data->vertexField, data->cellField };
+    data->bytesPerStep = 0;
+    for (int i = 0; i < 2; ++i) {
+        fields[i]->subfieldsSetup();
+        fields[i]->createDiscretization();
+        fields[i]->allocate();
+        fields[i]->createOutputVector();
+        PetscInt size = 0;
+        err = VecGetSize(fields[i]->getOutputVector(), &size);PYLITH_CHECK_ERROR(err);
+        data->bytesPerStep += size * sizeof(PylithScalar);
+    } // for
+
+    const pylith::string_vector& vertexNames = data->vertexField->getSubfieldNames();
+    for (size_t i = 0; i < vertexNames.size(); ++i) {
+        data->vertexSubfields.push_back(pylith::meshio::OutputSubfield::create(*data->vertexField, *data->mesh,
+                                                                               vertexNames[i].c_str(), 1));
+    } // for
+    const pylith::string_vector& cellNames = data->cellField->getSubfieldNames();
+    for (size_t i = 0; i < cellNames.size(); ++i) {
+        data->cellSubfields.push_back(pylith::meshio::OutputSubfield::create(*data->cellField, *data->mesh,
+                                                                             cellNames[i].c_str(), 0));
+    } // for
+
+    PYLITH_METHOD_END;
+} // createData
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate mesh and fields.
+void
+_BenchmarkDataWriters::destroyData(Data* data) {
+    assert(data);
+
+    for (size_t i = 0; i < data->vertexSubfields.size(); ++i) {
+        delete data->vertexSubfields[i];data->vertexSubfields[i] = NULL;
+    } // for
+    for (size_t i = 0; i < data->cellSubfields.size(); ++i) {
+        delete data->cellSubfields[i];data->cellSubfields[i] = NULL;
+    } // for
+    delete data->vertexField;data->vertexField = NULL;
+    delete data->cellField;data->cellField = NULL;
+    delete data->mesh;data->mesh = NULL;
+} // destroyData
+
+
+// ------------------------------------------------------------------------------------------------
+// Set values of fields for a time step and project them to the output subfields.
+void
+_BenchmarkDataWriters::updateFields(Data* data,
+                                    const int step) {
+    PYLITH_METHOD_BEGIN;
+    assert(data);
+
+    // Smooth values that vary in space and time, so compression behaves as for simulation output.
+    pylith::topology::Field* fields[2] = { data->vertexField, data->cellField };
+    PetscErrorCode err = 0;
+    for (int iField = 0; iField < 2; ++iField) {
+        PetscVec localVec = fields[iField]->getLocalVector();
+        PetscInt size = 0;
+        PylithScalar* values = NULL;
+        err = VecGetLocalSize(localVec, &size);PYLITH_CHECK_ERROR(err);
+        err = VecGetArray(localVec, &values);PYLITH_CHECK_ERROR(err);
+        const PylithScalar amplitude = 1.0e-3 * (1.0 + step);
+        for (PetscInt i = 0; i < size; ++i) {
+            values[i] = amplitude * sin(1.0e-3 * i + 0.1 * step + iField);
+        } // for
+        err = VecRestoreArray(localVec, &values);PYLITH_CHECK_ERROR(err);
+        fields[iField]->scatterLocalToOutput();
+    } // for
+
+    for (size_t i = 0; i < data->vertexSubfields.size(); ++i) {
+        data->vertexSubfields[i]->project(data->vertexField->getOutputVector());
+    } // for
+    for (size_t i = 0; i < data->cellSubfields.size(); ++i) {
+        data->cellSubfields[i]->project(data->cellField->getOutputVector());
+    } // for
+
+    PYLITH_METHOD_END;
+} // updateFields
+
+
+// ------------------------------------------------------------------------------------------------
+// Run benchmark of a data writer.
+_BenchmarkDataWriters::Result
+_BenchmarkDataWriters::run(const std::string& name,
+                           Data* data,
+                           const Parameters& params) {
+    PYLITH_METHOD_BEGIN;
+    assert(data);
+    assert(data->mesh);
+
+    std::vector<std::string> filenames;
+    pylith::meshio::DataWriter* writer = _createWriter(name, params, &filenames);assert(writer);
+
+    Result result;
+    result.writer = name;
+    result.xdmfTime = -1.0;
+
+    const bool isInfo = false;
+    double tStart = _wtime();
+    writer->open(*data->mesh, isInfo);
+    result.openTime = _wtime() - tStart;
+
+    double stepTime = 0.0;
+    for (int step = 0; step < params.numSteps; ++step) {
+        updateFields(data, step);
+        const PylithScalar t = step;
+
+        tStart = _wtime();
+        writer->openTimeStep(t, *data->mesh);
+        for (size_t i = 0; i < data->vertexSubfields.size(); ++i) {
+            writer->writeVertexField(t, *data->vertexSubfields[i]);
+        } // for
+        for (size_t i = 0; i < data->cellSubfields.size(); ++i) {
+            writer->writeCellField(t, *data->cellSubfields[i]);
+        } // for
+        writer->closeTimeStep();
+        stepTime += _wtime() - tStart;
+    } // for
+    result.stepTime = stepTime / params.numSteps;
+    result.bandwidth = (stepTime > 0.0) ? 1.0e-9 * double(data->bytesPerStep) * params.numSteps / stepTime : 0.0;
+
+    tStart = _wtime();
+    writer->close();
+    result.closeTime = _wtime() - tStart;
+
+    PetscMPIInt commRank = 0;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &commRank);
+    pylith::meshio::DataWriterHDF5Ext* writerExt = dynamic_cast<pylith::meshio::DataWriterHDF5Ext*>(writer);
+    if (writerExt && !commRank) {
+        tStart = MPI_Wtime();
+        try {
+            pylith::meshio::Xdmf::write(writerExt->hdf5Filename().c_str());
+            result.xdmfTime = MPI_Wtime() - tStart;
+        } catch (const std::exception& err) {
+            std::cerr << "Could not generate Xdmf file for writer '" << name << "': " << err.what() << std::endl;
+        } // try/catch
+    } // if
+    if (!params.keepFiles && !commRank) {
+        if (writerExt) {
+            // External datasets of subfields.
+            const std::string& filenameH5 = filenames[0];
+            const std::string& prefix = filenameH5.substr(0, filenameH5.length()-3) + "_";
+            std::vector<pylith::meshio::OutputSubfield*> subfields(data->vertexSubfields);
+            subfields.insert(subfields.end(), data->cellSubfields.begin(), data->cellSubfields.end());
+            for (size_t i = 0; i < subfields.size(); ++i) {
+                const std::string& filenameDat = prefix + subfields[i]->getDescription().label + ".dat";
+                filenames.push_back(filenameDat);
+                filenames.push_back(filenameDat + ".info");
+            } // for
+        } // if
+        for (size_t i = 0; i < filenames.size(); ++i) {
+            remove(filenames[i].c_str());
+        } // for
+    } // if
+    delete writer;writer = NULL;
+
+    PYLITH_METHOD_RETURN(result);
+} // run
+
+
+// ------------------------------------------------------------------------------------------------
+// Write results in JSON format.
+void
+_BenchmarkDataWriters::writeJSON(const std::string& filename,
+                                 const std::vector<Result>& results,
+                                 const Parameters& params,
+                                 const Data& data,
+                                 const int numProcs) {
+    std::ofstream fout(filename.c_str());
+    if (!fout.is_open() || !fout.good()) {
+        std::cerr << "Could not open file '" << filename << "' for benchmark results." << std::endl;
+        return;
+    } // if
+
+    fout << "{\n"
+         << "  \"num_procs\": " << numProcs << ",\n"
+         << "  \"dim\": " << params.dim << ",\n"
+         << "  \"num_cells_coarse\": " << params.numCells << ",\n"
+         << "  \"refine_levels\": " << params.refineLevels << ",\n"
+         << "  \"num_steps\": " << params.numSteps << ",\n"
+         << "  \"bytes_per_step\": " << data.bytesPerStep << ",\n"
+         << "  \"writers\": [\n";
+    fout << std::setprecision(6);
+    for (size_t i = 0; i < results.size(); ++i) {
+        fout << "    {\"writer\": \"" << results[i].writer << "\", \"open_time\": " << results[i].openTime
+             << ", \"step_time\": " << results[i].stepTime << ", \"close_time\": " << results[i].closeTime
+             << ", \"xdmf_time\": " << results[i].xdmfTime << ", \"bandwidth_gbps\": " << results[i].bandwidth
+             << "}" << (i+1 < results.size() ? "," : "") << "\n";
+    } // for
+    fout << "  ]\n"
+         << "}\n";
+} // writeJSON
+
+
+// ------------------------------------------------------------------------------------------------
+// Create data writer.
+pylith::meshio::DataWriter*
+_BenchmarkDataWriters::_createWriter(const std::string& name,
+                                     const Parameters& params,
+                                     std::vector<std::string>* filenames) {
+    assert(filenames);
+
+    const std::string& basename = params.outputDir + "/benchmark_" + name;
+    if (0 == name.find("hdf5ext")) {
+        pylith::meshio::DataWriterHDF5Ext* writer = new pylith::meshio::DataWriterHDF5Ext;
+        writer->filename((basename + ".h5").c_str());
+        if ("hdf5ext_aggregate" == name) {
+            writer->setAggregationRatio(params.aggregationRatio);
+        } else if ("hdf5ext_prealloc" == name) {
+            writer->setNumStepsPreallocated(params.numSteps);
+        } else if ("hdf5ext_async" == name) {
+            writer->setAggregationRatio(params.aggregationRatio);
+            writer->setUseAsyncWrites(true);
+        } else if ("hdf5ext_staging" == name) {
+            if (params.stagingDir.empty()) {
+                delete writer;writer = NULL;
+                throw std::runtime_error("Writer 'hdf5ext_staging' requires --staging-dir.");
+            } // if
+            writer->setStagingDir(params.stagingDir.c_str());
+        } else if ("hdf5ext" != name) {
+            delete writer;writer = NULL;
+            throw std::runtime_error("Unknown writer '" + name + "'.");
+        } // if/else
+        filenames->push_back(basename + ".h5");
+        filenames->push_back(basename + ".xmf");
+        return writer;
+    } else if (0 == name.find("hdf5")) {
+        pylith::meshio::DataWriterHDF5* writer = new pylith::meshio::DataWriterHDF5;
+        writer->filename((basename + ".h5").c_str());
+        if ("hdf5_collective" == name) {
+            writer->useCollectiveIO(true);
+        } else if ("hdf5_deflate" == name) {
+            writer->setCompression(pylith::meshio::DataWriterHDF5::COMPRESSION_DEFLATE, 4);
+        } else if ("hdf5" != name) {
+            delete writer;writer = NULL;
+            throw std::runtime_error("Unknown writer '" + name + "'.");
+        } // if/else
+        filenames->push_back(basename + ".h5");
+        filenames->push_back(basename + ".xmf");
+        return writer;
+    } else if ("vtk" == name) {
+        pylith::meshio::DataWriterVTK* writer = new pylith::meshio::DataWriterVTK;
+        writer->filename((basename + ".vtk").c_str());
+        writer->timeFormat("%04.0f");
+        return writer;
+#if defined(ENABLE_ADIOS2)
+    } else if ("adios2" == name) {
+        pylith::meshio::DataWriterADIOS2* writer = new pylith::meshio::DataWriterADIOS2;
+        writer->filename((basename + ".bp").c_str());
+        return writer;
+#endif
+    } // if/else
+
+    throw std::runtime_error("Unknown writer '" + name + "'.");
+} // _createWriter
+
+
+// ------------------------------------------------------------------------------------------------
+// Add subfield to field.
+void
+_BenchmarkDataWriters::_addSubfield(pylith::topology::Field* field,
+                                    const char* name,
+                                    const pylith::topology::FieldBase::VectorFieldEnum vectorFieldType,
+                                    const int basisOrder) {
+    assert(field);
+
+    const int spaceDim = field->getSpaceDim();
+    const char* vectorComponents[3] = { "_x", "_y", "_z" };
+    const char* tensorComponents2D[3] = { "_xx", "_yy", "_xy" };
+    const char* tensorComponents3D[6] = { "_xx", "_yy", "_zz", "_xy", "_yz", "_xz" };
+
+    pylith::topology::Field::Description description;
+    description.label = name;
+    description.vectorFieldType = vectorFieldType;
+    switch (vectorFieldType) {
+    case pylith::topology::FieldBase::VECTOR:
+        for (int i = 0; i < spaceDim; ++i) {
+            description.componentNames.push_back(std::string(name) + vectorComponents[i]);
+        } // for
+        break;
+    case pylith::topology::FieldBase::TENSOR:
+        for (int i = 0; i < ((3 == spaceDim) ? 6 : 3); ++i) {
+            description.componentNames.push_back(std::string(name) +
+                                                 ((3 == spaceDim) ? tensorComponents3D[i] : tensorComponents2D[i]));
+        } // for
+        break;
+    default:
+        description.componentNames.push_back(name);
+    } // switch
+    description.numComponents = description.componentNames.size();
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    const pylith::topology::FieldBase::Discretization discretization(basisOrder, basisOrder);
+    field->subfieldAdd(description, discretization);
+} // _addSubfield
+
+
+// ------------------------------------------------------------------------------------------------
+// Get wall-clock time on process 0 after all processes reach this point.
+double
+_BenchmarkDataWriters::_wtime(void) {
+    MPI_Barrier(PETSC_COMM_WORLD);
+    return MPI_Wtime();
+} // _wtime
+
+
+// End of file
@@ -0,0 +1,570 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** Micro-benchmark of pointwise functions (fekernels).
+ *
+ * Each kernel is called through a function pointer, as in the PETSc assembly routines, over a synthetic batch of
+ * quadrature points. The solution, its time derivative and gradient, and the auxiliary field and its gradient at
+ * each point are stored contiguously with every subfield padded to the largest subfield (GenMaxwell viscous
+ * strain), so the same layout works for all kernels. Values are smooth and positive, so the kernels follow the
+ * same code paths as in a simulation (for example, positive elastic moduli and porosity less than 1).
+ *
+ * Usage: benchmark_fekernels [--points=N] [--trials=N] [--filter=STRING] [--json=FILENAME] [--list]
+ */
+
+#include <portinfo>
+
+#include "pylith/fekernels/Elasticity.hh" // USES Elasticity
+#include "pylith/fekernels/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity*
+#include "pylith/fekernels/IsotropicLinearMaxwell.hh" // USES IsotropicLinearMaxwell*
+#include "pylith/fekernels/IsotropicLinearGenMaxwell.hh" // USES IsotropicLinearGenMaxwell*
+#include "pylith/fekernels/IsotropicPowerLaw.hh" // USES IsotropicPowerLaw*
+#include "pylith/fekernels/IsotropicLinearPoroelasticity.hh" // USES IsotropicLinearPoroelasticity*
+#include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+
+#include "petscds.h" // USES PetscPointFunc, PetscPointJac, PetscBdPointFunc, PetscBdPointJac
+
+#include <getopt.h> // USES getopt_long()
+#include <algorithm> // USES std::min()
+#include <chrono> // USES std::chrono
+#include <cmath> // USES sqrt()
+#include <cstdlib> // USES atoi()
+#include <fstream> // USES std::ofstream
+#include <iomanip> // USES std::setw()
+#include <iostream> // USES std::cout
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+class _BenchmarkFEKernels {
+public:
+
+    /// Type of pointwise function.
+    enum KernelEnum {
+        RESIDUAL=0, ///< PetscPointFunc
+        JACOBIAN=1, ///< PetscPointJac
+        RESIDUAL_BOUNDARY=2, ///< PetscBdPointFunc
+        JACOBIAN_BOUNDARY=3, ///< PetscBdPointJac
+    };
+
+    /// Pointwise function and the layout of the fields it expects.
+    struct Case {
+        const char* family; ///< Name of kernel family.
+        const char* name; ///< Name of kernel.
+        KernelEnum type; ///< Type of pointwise function.
+        PylithInt dim; ///< Spatial dimension passed to kernel.
+        PylithInt numS; ///< Number of solution subfields.
+        PylithInt numA; ///< Number of auxiliary subfields.
+        PetscPointFunc residual;
+        PetscPointJac jacobian;
+        PetscBdPointFunc residualBoundary;
+        PetscBdPointJac jacobianBoundary;
+    };
+
+    /// Timing of a pointwise function.
+    struct Result {
+        const Case* kernel;
+        double nsPerPoint; ///< Minimum over trials of elapsed time per point.
+        double checksum; ///< Sum of kernel output (keeps compiler from removing calls).
+    };
+
+    static const PylithInt maxSubfieldSize; ///< Number of values per subfield at a point.
+    static const PylithInt maxOutputSize; ///< Maximum number of values computed by a kernel at a point.
+    static const PylithInt spaceDim; ///< Dimension of coordinates.
+
+    /** Get pointwise functions to benchmark.
+     *
+     * @returns Array of kernels.
+     */
+    static
+    std::vector<Case> getCases(void);
+
+    /** Run benchmark of a pointwise function.
+     *
+     * @param[in] kernel Pointwise function.
+     * @param[in] numPoints Number of quadrature points in batch.
+     * @param[in] numTrials Number of passes over the batch.
+     * @returns Timing of pointwise function.
+     */
+    static
+    Result run(const Case& kernel,
+               const size_t numPoints,
+               const size_t numTrials);
+
+    /** Write results in JSON format.
+     *
+     * @param[in] filename Name of file.
+     * @param[in] results Timing of pointwise functions.
+     * @param[in] numPoints Number of quadrature points in batch.
+     * @param[in] numTrials Number of passes over the batch.
+     */
+    static
+    void writeJSON(const std::string& filename,
+                   const std::vector<Result>& results,
+                   const size_t numPoints,
+                   const size_t numTrials);
+
+private:
+
+    static
+    Case _residual(const char* family,
+                   const char* name,
+                   const PylithInt dim,
+                   const PylithInt numS,
+                   const PylithInt numA,
+                   PetscPointFunc kernel);
+
+    static
+    Case _jacobian(const char* family,
+                   const char* name,
+                   const PylithInt dim,
+                   const PylithInt numS,
+                   const PylithInt numA,
+                   PetscPointJac kernel);
+
+    static
+    Case _residualBoundary(const char* family,
+                           const char* name,
+                           const PylithInt dim,
+                           const PylithInt numS,
+                           const PylithInt numA,
+                           PetscBdPointFunc kernel);
+
+    static
+    Case _jacobianBoundary(const char* family,
+                           const char* name,
+                           const PylithInt dim,
+                           const PylithInt numS,
+                           const PylithInt numA,
+                           PetscBdPointJac kernel);
+
+}; // _BenchmarkFEKernels
+
+const PylithInt _BenchmarkFEKernels::maxSubfieldSize = 18;
+const PylithInt _BenchmarkFEKernels::maxOutputSize = 81;
+const PylithInt _BenchmarkFEKernels::spaceDim = 3;
+
+// ------------------------------------------------------------------------------------------------
+int
+main(int argc,
+     char* argv[]) {
+    size_t numPoints = 4096;
+    size_t numTrials = 200;
+    std::string filter;
+    std::string jsonFilename;
+    bool listOnly = false;
+
+    static struct option options[] = {
+        {"points", required_argument, NULL, 'p'},
+        {"trials", required_argument, NULL, 't'},
+        {"filter", required_argument, NULL, 'f'},
+        {"json", required_argument, NULL, 'j'},
+        {"list", no_argument, NULL, 'l'},
+        {"help", no_argument, NULL, 'h'},
+        {0, 0, 0, 0}
+    };
+    int c = 0;
+    while ((c = getopt_long(argc, argv, "p:t:f:j:lh", options, NULL)) != -1) {
+        switch (c) {
+        case 'p':
+            numPoints = std::max(atoi(optarg), 1);
+            break;
+        case 't':
+            numTrials = std::max(atoi(optarg), 1);
+            break;
+        case 'f':
+            filter = optarg;
+            break;
+        case 'j':
+            jsonFilename = optarg;
+            break;
+        case 'l':
+            listOnly = true;
+            break;
+        case 'h':
+        default:
+            std::cout << "Usage: " << argv[0] << " [--points=N] [--trials=N] [--filter=STRING] [--json=FILENAME] [--list]\n"
+                      << "  --points=N       Number of quadrature points in batch (default: 4096).\n"
+                      << "  --trials=N       Number of passes over the batch; minimum time is reported (default: 200).\n"
+                      << "  --filter=STRING  Only run kernels with STRING in 'family::name'.\n"
+                      << "  --json=FILENAME  Write results to FILENAME in JSON format.\n"
+                      << "  --list           List kernels without running them.\n";
+            return ('h' == c) ? 0 : 1;
+        } // switch
+    } // while
+
+    const std::vector<_BenchmarkFEKernels::Case>& cases = _BenchmarkFEKernels::getCases();
+    std::vector<_BenchmarkFEKernels::Result> results;
+    std::cout << std::left << std::setw(44) << "family" << std::setw(42) << "kernel" << std::right
+              << std::setw(5) << "dim" << std::setw(14) << "ns/point" << std::setw(14) << "Mpoints/s" << std::endl;
+    for (size_t i = 0; i < cases.size(); ++i) {
+        const std::string& label = std::string(cases[i].family) + "::" + cases[i].name;
+        if (!filter.empty() && (label.find(filter) == std::string::npos)) {
+            continue;
+        } // if
+        std::cout << std::left << std::setw(44) << cases[i].family << std::setw(42) << cases[i].name << std::right
+                  << std::setw(5) << cases[i].dim;
+        if (listOnly) {
+            std::cout << std::endl;
+            continue;
+        } // if
+        const _BenchmarkFEKernels::Result& result = _BenchmarkFEKernels::run(cases[i], numPoints, numTrials);
+        std::cout << std::fixed << std::setprecision(2) << std::setw(14) << result.nsPerPoint
+                  << std::setw(14) << 1.0e+3 / result.nsPerPoint << std::endl;
+        results.push_back(result);
+    } // for
+
+    if (!jsonFilename.empty() && !listOnly) {
+        _BenchmarkFEKernels::writeJSON(jsonFilename, results, numPoints, numTrials);
+    } // if
+
+    return 0;
+} // main
+
+
+// ------------------------------------------------------------------------------------------------
+// Get pointwise functions to benchmark.
+std::vector<_BenchmarkFEKernels::Case>
+_BenchmarkFEKernels::getCases(void) {
+    std::vector<Case> cases;
+
+    // Number of auxiliary subfields follows the auxiliary field of the corresponding material without optional
+    // subfields (body force, gravity), and with reference stress and strain for the refState kernels.
+    typedef pylith::fekernels::Elasticity Elasticity;
+    cases.push_back(_residual("Elasticity", "f0v", 2, 2, 3, Elasticity::f0v));
+    cases.push_back(_jacobian("Elasticity", "Jf0vv", 2, 2, 3, Elasticity::Jf0vv));
+    cases.push_back(_residual("Elasticity", "g0v_gravbodyforce", 2, 1, 5, Elasticity::g0v_gravbodyforce));
+    cases.push_back(_residual("Elasticity", "f0v", 3, 2, 3, Elasticity::f0v));
+    cases.push_back(_jacobian("Elasticity", "Jf0vv", 3, 2, 3, Elasticity::Jf0vv));
+    cases.push_back(_residual("Elasticity", "g0v_gravbodyforce", 3, 1, 5, Elasticity::g0v_gravbodyforce));
+
+    typedef pylith::fekernels::IsotropicLinearElasticityPlaneStrain ElasticityPlaneStrain;
+    cases.push_back(_residual("IsotropicLinearElasticityPlaneStrain", "f1v_infinitesimalStrain", 2, 1, 3,
+                              ElasticityPlaneStrain::f1v_infinitesimalStrain));
+    cases.push_back(_residual("IsotropicLinearElasticityPlaneStrain", "f1v_infinitesimalStrain_refState", 2, 1, 5,
+                              ElasticityPlaneStrain::f1v_infinitesimalStrain_refState));
+    cases.push_back(_jacobian("IsotropicLinearElasticityPlaneStrain", "Jf3vu_infinitesimalStrain", 2, 1, 3,
+                              ElasticityPlaneStrain::Jf3vu_infinitesimalStrain));
+    typedef pylith::fekernels::IsotropicLinearElasticity3D Elasticity3D;
+    cases.push_back(_residual("IsotropicLinearElasticity3D", "f1v_infinitesimalStrain", 3, 1, 3,
+                              Elasticity3D::f1v_infinitesimalStrain));
+    cases.push_back(_residual("IsotropicLinearElasticity3D", "f1v_infinitesimalStrain_refState", 3, 1, 5,
+                              Elasticity3D::f1v_infinitesimalStrain_refState));
+    cases.push_back(_jacobian("IsotropicLinearElasticity3D", "Jf3vu_infinitesimalStrain", 3, 1, 3,
+                              Elasticity3D::Jf3vu_infinitesimalStrain));
+
+    typedef pylith::fekernels::IsotropicLinearMaxwellPlaneStrain MaxwellPlaneStrain;
+    cases.push_back(_residual("IsotropicLinearMaxwellPlaneStrain", "f1v_infinitesimalStrain", 2, 1, 6,
+                              MaxwellPlaneStrain::f1v_infinitesimalStrain));
+    cases.push_back(_residual("IsotropicLinearMaxwellPlaneStrain", "f1v_infinitesimalStrain_refState", 2, 1, 8,
+                              MaxwellPlaneStrain::f1v_infinitesimalStrain_refState));
+    cases.push_back(_jacobian("IsotropicLinearMaxwellPlaneStrain", "Jf3vu_infinitesimalStrain", 2, 1, 6,
+                              MaxwellPlaneStrain::Jf3vu_infinitesimalStrain));
+    typedef pylith::fekernels::IsotropicLinearMaxwell3D Maxwell3D;
+    cases.push_back(_residual("IsotropicLinearMaxwell3D", "f1v_infinitesimalStrain", 3, 1, 6,
+                              Maxwell3D::f1v_infinitesimalStrain));
+    cases.push_back(_residual("IsotropicLinearMaxwell3D", "f1v_infinitesimalStrain_refState", 3, 1, 8,
+                              Maxwell3D::f1v_infinitesimalStrain_refState));
+    cases.push_back(_jacobian("IsotropicLinearMaxwell3D", "Jf3vu_infinitesimalStrain", 3, 1, 6,
+                              Maxwell3D::Jf3vu_infinitesimalStrain));
+
+    typedef pylith::fekernels::IsotropicLinearGenMaxwellPlaneStrain GenMaxwellPlaneStrain;
+    cases.push_back(_residual("IsotropicLinearGenMaxwellPlaneStrain", "f1v_infinitesimalStrain", 2, 1, 7,
+                              GenMaxwellPlaneStrain::f1v_infinitesimalStrain));
+    cases.push_back(_residual("IsotropicLinearGenMaxwellPlaneStrain", "f1v_infinitesimalStrain_refState", 2, 1, 9,
+                              GenMaxwellPlaneStrain::f1v_infinitesimalStrain_refState));
+    cases.push_back(_jacobian("IsotropicLinearGenMaxwellPlaneStrain", "Jf3vu_infinitesimalStrain", 2, 1, 7,
+                              GenMaxwellPlaneStrain::Jf3vu_infinitesimalStrain));
+    typedef pylith::fekernels::IsotropicLinearGenMaxwell3D GenMaxwell3D;
+    cases.push_back(_residual("IsotropicLinearGenMaxwell3D", "f1v_infinitesimalStrain", 3, 1, 7,
+                              GenMaxwell3D::f1v_infinitesimalStrain));
+    cases.push_back(_residual("IsotropicLinearGenMaxwell3D", "f1v_infinitesimalStrain_refState", 3, 1, 9,
+                              GenMaxwell3D::f1v_infinitesimalStrain_refState));
+    cases.push_back(_jacobian("IsotropicLinearGenMaxwell3D", "Jf3vu_infinitesimalStrain", 3, 1, 7,
+                              GenMaxwell3D::Jf3vu_infinitesimalStrain));
+
+    typedef pylith::fekernels::IsotropicPowerLawPlaneStrain PowerLawPlaneStrain;
+    cases.push_back(_residual("IsotropicPowerLawPlaneStrain", "f1v_infinitesimalStrain", 2, 1, 8,
+                              PowerLawPlaneStrain::f1v_infinitesimalStrain));
+    cases.push_back(_residual("IsotropicPowerLawPlaneStrain", "f1v_infinitesimalStrain_refState", 2, 1, 10,
+                              PowerLawPlaneStrain::f1v_infinitesimalStrain_refState));
+    cases.push_back(_jacobian("IsotropicPowerLawPlaneStrain", "Jf3vu_infinitesimalStrain", 2, 1, 8,
+                              PowerLawPlaneStrain::Jf3vu_infinitesimalStrain));
+    cases.push_back(_jacobian("IsotropicPowerLawPlaneStrain", "Jf3vu_infinitesimalStrain_refState", 2, 1, 10,
+                              PowerLawPlaneStrain::Jf3vu_infinitesimalStrain_refState));
+    typedef pylith::fekernels::IsotropicPowerLaw3D PowerLaw3D;
+    cases.push_back(_residual("IsotropicPowerLaw3D", "f1v_infinitesimalStrain", 3, 1, 8,
+                              PowerLaw3D::f1v_infinitesimalStrain));
+    cases.push_back(_residual("IsotropicPowerLaw3D", "f1v_infinitesimalStrain_refState", 3, 1, 10,
+                              PowerLaw3D::f1v_infinitesimalStrain_refState));
+    cases.push_back(_jacobian("IsotropicPowerLaw3D", "Jf3vu_infinitesimalStrain", 3, 1, 8,
+                              PowerLaw3D::Jf3vu_infinitesimalStrain));
+    cases.push_back(_jacobian("IsotropicPowerLaw3D", "Jf3vu_infinitesimalStrain_refState", 3, 1, 10,
+                              PowerLaw3D::Jf3vu_infinitesimalStrain_refState));
+
+    // Poroelasticity: solution [disp, pressure, trace_strain], auxiliary field [solid_density, fluid_density,
+    // fluid_viscosity, porosity, shear_modulus, drained_bulk_modulus, biot_coefficient, biot_modulus, permeability].
+    typedef pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain PoroelasticityPlaneStrain;
+    cases.push_back(_residual("IsotropicLinearPoroelasticityPlaneStrain", "f0p_implicit", 2, 3, 9,
+                              PoroelasticityPlaneStrain::f0p_implicit));
+    cases.push_back(_residual("IsotropicLinearPoroelasticityPlaneStrain", "f1u", 2, 3, 9,
+                              PoroelasticityPlaneStrain::f1u));
+    cases.push_back(_residual("IsotropicLinearPoroelasticityPlaneStrain", "f1p", 2, 3, 9,
+                              PoroelasticityPlaneStrain::f1p));
+    cases.push_back(_residual("IsotropicLinearPoroelasticityPlaneStrain", "f1p_tensor_permeability", 2, 3, 9,
+                              PoroelasticityPlaneStrain::f1p_tensor_permeability));
+    cases.push_back(_jacobian("IsotropicLinearPoroelasticityPlaneStrain", "Jf2up", 2, 3, 9,
+                              PoroelasticityPlaneStrain::Jf2up));
+    cases.push_back(_jacobian("IsotropicLinearPoroelasticityPlaneStrain", "Jf3pp", 2, 3, 9,
+                              PoroelasticityPlaneStrain::Jf3pp));
+    cases.push_back(_jacobian("IsotropicLinearPoroelasticityPlaneStrain", "Jf0pp", 2, 3, 9,
+                              PoroelasticityPlaneStrain::Jf0pp));
+    typedef pylith::fekernels::IsotropicLinearPoroelasticity3D Poroelasticity3D;
+    cases.push_back(_residual("IsotropicLinearPoroelasticity3D", "f0p_implicit", 3, 3, 9,
+                              Poroelasticity3D::f0p_implicit));
+    cases.push_back(_residual("IsotropicLinearPoroelasticity3D", "f1u", 3, 3, 9,
+                              Poroelasticity3D::f1u));
+    cases.push_back(_residual("IsotropicLinearPoroelasticity3D", "f1p", 3, 3, 9,
+                              Poroelasticity3D::f1p));
+    cases.push_back(_residual("IsotropicLinearPoroelasticity3D", "f1p_tensor_permeability", 3, 3, 9,
+                              Poroelasticity3D::f1p_tensor_permeability));
+    cases.push_back(_jacobian("IsotropicLinearPoroelasticity3D", "Jf2up", 3, 3, 9,
+                              Poroelasticity3D::Jf2up));
+    cases.push_back(_jacobian("IsotropicLinearPoroelasticity3D", "Jf3pp", 3, 3, 9,
+                              Poroelasticity3D::Jf3pp));
+    cases.push_back(_jacobian("IsotropicLinearPoroelasticity3D", "Jf0pp", 3, 3, 9,
+                              Poroelasticity3D::Jf0pp));
+    typedef pylith::fekernels::IsotropicLinearPoroelasticityFlow<2, false, false, false, false> PoroelasticityFlow2D;
+    cases.push_back(_residual("IsotropicLinearPoroelasticityFlow<2>", "f0p_implicit", 2, 3, 9,
+                              PoroelasticityFlow2D::f0p_implicit));
+    cases.push_back(_residual("IsotropicLinearPoroelasticityFlow<2>", "f1p", 2, 3, 9,
+                              PoroelasticityFlow2D::f1p));
+    cases.push_back(_jacobian("IsotropicLinearPoroelasticityFlow<2>", "Jf3pp", 2, 3, 9,
+                              PoroelasticityFlow2D::Jf3pp));
+    typedef pylith::fekernels::IsotropicLinearPoroelasticityFlow<3, false, false, false, false> PoroelasticityFlow3D;
+    cases.push_back(_residual("IsotropicLinearPoroelasticityFlow<3>", "f0p_implicit", 3, 3, 9,
+                              PoroelasticityFlow3D::f0p_implicit));
+    cases.push_back(_residual("IsotropicLinearPoroelasticityFlow<3>", "f1p", 3, 3, 9,
+                              PoroelasticityFlow3D::f1p));
+    cases.push_back(_jacobian("IsotropicLinearPoroelasticityFlow<3>", "Jf3pp", 3, 3, 9,
+                              PoroelasticityFlow3D::Jf3pp));
+
+    // Fault: dimension passed to kernels is the dimension of the fault; solution [disp, lagrange_multiplier],
+    // auxiliary field [slip].
+    typedef pylith::fekernels::FaultCohesiveKin FaultCohesiveKin;
+    cases.push_back(_residualBoundary("FaultCohesiveKin", "f0u_neg", 2, 2, 1, FaultCohesiveKin::f0u_neg));
+    cases.push_back(_residualBoundary("FaultCohesiveKin", "f0u_pos", 2, 2, 1, FaultCohesiveKin::f0u_pos));
+    cases.push_back(_residualBoundary("FaultCohesiveKin", "f0l_slip", 2, 2, 1, FaultCohesiveKin::f0l_slip));
+    cases.push_back(_jacobianBoundary("FaultCohesiveKin", "Jf0ul_neg", 2, 2, 1, FaultCohesiveKin::Jf0ul_neg));
+    cases.push_back(_jacobianBoundary("FaultCohesiveKin", "Jf0ul_pos", 2, 2, 1, FaultCohesiveKin::Jf0ul_pos));
+    cases.push_back(_jacobianBoundary("FaultCohesiveKin", "Jf0lu", 2, 2, 1, FaultCohesiveKin::Jf0lu));
+
+    return cases;
+} // getCases
+
+
+// ------------------------------------------------------------------------------------------------
+// Run benchmark of a pointwise function.
+_BenchmarkFEKernels::Result
+_BenchmarkFEKernels::run(const Case& kernel,
+                         const size_t numPoints,
+                         const size_t numTrials) {
+    const PylithInt dim = kernel.dim;
+    const PylithInt numS = kernel.numS;
+    const PylithInt numA = kernel.numA;
+
+    std::vector<PylithInt> sOff(numS+1), sOff_x(numS+1), aOff(numA+1), aOff_x(numA+1);
+    for (PylithInt i = 0; i <= numS; ++i) {
+        sOff[i] = i*maxSubfieldSize;
+        sOff_x[i] = i*maxSubfieldSize*spaceDim;
+    } // for
+    for (PylithInt i = 0; i <= numA; ++i) {
+        aOff[i] = i*maxSubfieldSize;
+        aOff_x[i] = i*maxSubfieldSize*spaceDim;
+    } // for
+
+    // Smooth values that vary from point to point.
+    const size_t sizeS = sOff[numS], sizeS_x = sOff_x[numS];
+    const size_t sizeA = aOff[numA], sizeA_x = aOff_x[numA];
+    std::vector<PylithScalar> s(numPoints*sizeS), s_t(numPoints*sizeS), s_x(numPoints*sizeS_x);
+    std::vector<PylithScalar> a(numPoints*sizeA), a_x(numPoints*sizeA_x);
+    std::vector<PylithReal> x(numPoints*spaceDim), n(numPoints*spaceDim);
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        const double phase = double(iPoint) / double(numPoints);
+        for (size_t i = 0; i < sizeS; ++i) {
+            s[iPoint*sizeS+i] = 1.0e-3 * (1.0 + phase + 0.01*i);
+            s_t[iPoint*sizeS+i] = 1.0e-4 * (1.0 + phase + 0.02*i);
+        } // for
+        for (size_t i = 0; i < sizeS_x; ++i) {
+            s_x[iPoint*sizeS_x+i] = 1.0e-4 * (1.0 + phase + 0.03*i);
+        } // for
+        for (size_t i = 0; i < sizeA; ++i) {
+            a[iPoint*sizeA+i] = 0.5 + 0.2*phase + 0.001*i;
+        } // for
+        for (size_t i = 0; i < sizeA_x; ++i) {
+            a_x[iPoint*sizeA_x+i] = 1.0e-3 * (1.0 + phase);
+        } // for
+        for (PylithInt i = 0; i < spaceDim; ++i) {
+            x[iPoint*spaceDim+i] = phase + i;
+        } // for
+        const double norm = sqrt(1.0 + 0.04*phase*phase);
+        n[iPoint*spaceDim+0] = 1.0 / norm;
+        n[iPoint*spaceDim+1] = 0.2*phase / norm;
+        n[iPoint*spaceDim+2] = 0.0;
+    } // for
+
+    // Time step for material kernels and reference directions for fault kernels.
+    const bool isFault = (RESIDUAL_BOUNDARY == kernel.type) || (JACOBIAN_BOUNDARY == kernel.type);
+    const PylithScalar constantsMaterial[1] = { 0.01 };
+    const PylithScalar constantsFault[6] = { 0.0, 0.0, 1.0, 0.0, 1.0, 0.0 };
+    const PylithInt numConstants = isFault ? 6 : 1;
+    const PylithScalar* kernelConstants = isFault ? constantsFault : constantsMaterial;
+    const PylithReal t = 1.0;
+    const PylithReal s_tshift = 10.0;
+
+    std::vector<PylithScalar> output(numPoints*maxOutputSize);
+    double minElapsed = 0.0;
+    for (size_t iTrial = 0; iTrial < numTrials; ++iTrial) {
+        std::fill(output.begin(), output.end(), 0.0);
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+            const PylithScalar* sP = &s[iPoint*sizeS];
+            const PylithScalar* s_tP = &s_t[iPoint*sizeS];
+            const PylithScalar* s_xP = &s_x[iPoint*sizeS_x];
+            const PylithScalar* aP = &a[iPoint*sizeA];
+            const PylithScalar* a_xP = &a_x[iPoint*sizeA_x];
+            const PylithReal* xP = &x[iPoint*spaceDim];
+            const PylithReal* nP = &n[iPoint*spaceDim];
+            PylithScalar* outputP = &output[iPoint*maxOutputSize];
+            switch (kernel.type) {
+            case RESIDUAL:
+                kernel.residual(dim, numS, numA, &sOff[0], &sOff_x[0], sP, s_tP, s_xP, &aOff[0], &aOff_x[0], aP,
+                                NULL, a_xP, t, xP, numConstants, kernelConstants, outputP);
+                break;
+            case JACOBIAN:
+                kernel.jacobian(dim, numS, numA, &sOff[0], &sOff_x[0], sP, s_tP, s_xP, &aOff[0], &aOff_x[0], aP,
+                                NULL, a_xP, t, s_tshift, xP, numConstants, kernelConstants, outputP);
+                break;
+            case RESIDUAL_BOUNDARY:
+                kernel.residualBoundary(dim, numS, numA, &sOff[0], &sOff_x[0], sP, s_tP, s_xP, &aOff[0], &aOff_x[0], aP,
+                                        NULL, a_xP, t, xP, nP, numConstants, kernelConstants, outputP);
+                break;
+            case JACOBIAN_BOUNDARY:
+                kernel.jacobianBoundary(dim, numS, numA, &sOff[0], &sOff_x[0], sP, s_tP, s_xP, &aOff[0], &aOff_x[0], aP,
+                                        NULL, a_xP, t, s_tshift, xP, nP, numConstants, kernelConstants, outputP);
+                break;
+            } // switch
+        } // for
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        minElapsed = (0 == iTrial) ? elapsed.count() : std::min(minElapsed, elapsed.count());
+    } // for
+
+    Result result;
+    result.kernel = &kernel;
+    result.nsPerPoint = 1.0e+9 * minElapsed / numPoints;
+    result.checksum = 0.0;
+    for (size_t i = 0; i < output.size(); ++i) {
+        result.checksum += output[i];
+    } // for
+
+    return result;
+} // run
+
+
+// ------------------------------------------------------------------------------------------------
+// Write results in JSON format.
+void
+_BenchmarkFEKernels::writeJSON(const std::string& filename,
+                               const std::vector<Result>& results,
+                               const size_t numPoints,
+                               const size_t numTrials) {
+    std::ofstream fout(filename.c_str());
+    if (!fout.is_open() || !fout.good()) {
+        std::cerr << "Could not open file '" << filename << "' for benchmark results." << std::endl;
+        return;
+    } // if
+
+    fout << "{\n"
+         << "  \"num_points\": " << numPoints << ",\n"
+         << "  \"num_trials\": " << numTrials << ",\n"
+         << "  \"kernels\": [\n";
+    fout << std::setprecision(6);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Case& kernel = *results[i].kernel;
+        fout << "    {\"family\": \"" << kernel.family << "\", \"name\": \"" << kernel.name << "\", \"dim\": " << kernel.dim
+             << ", \"ns_per_point\": " << results[i].nsPerPoint
+             << ", \"checksum\": " << results[i].checksum << "}" << (i+1 < results.size() ? "," : "") << "\n";
+    } // for
+    fout << "  ]\n"
+         << "}\n";
+} // writeJSON
+
+
+// ------------------------------------------------------------------------------------------------
+_BenchmarkFEKernels::Case
+_BenchmarkFEKernels::_residual(const char* family,
+                               const char* name,
+                               const PylithInt dim,
+                               const PylithInt numS,
+                               const PylithInt numA,
+                               PetscPointFunc kernel) {
+    Case value = { family, name, RESIDUAL, dim, numS, numA, kernel, NULL, NULL, NULL };
+    return value;
+} // _residual
+
+
+// ------------------------------------------------------------------------------------------------
+_BenchmarkFEKernels::Case
+_BenchmarkFEKernels::_jacobian(const char* family,
+                               const char* name,
+                               const PylithInt dim,
+                               const PylithInt numS,
+                               const PylithInt numA,
+                               PetscPointJac kernel) {
+    Case value = { family, name, JACOBIAN, dim, numS, numA, NULL, kernel, NULL, NULL };
+    return value;
+} // _jacobian
+
+
+// ------------------------------------------------------------------------------------------------
+_BenchmarkFEKernels::Case
+_BenchmarkFEKernels::_residualBoundary(const char* family,
+                                       const char* name,
+                                       const PylithInt dim,
+                                       const PylithInt numS,
+                                       const PylithInt numA,
+                                       PetscBdPointFunc kernel) {
+    Case value = { family, name, RESIDUAL_BOUNDARY, dim, numS, numA, NULL, NULL, kernel, NULL };
+    return value;
+} // _residualBoundary
+
+
+// ------------------------------------------------------------------------------------------------
+_BenchmarkFEKernels::Case
+_BenchmarkFEKernels::_jacobianBoundary(const char* family,
+                                       const char* name,
+                                       const PylithInt dim,
+                                       const PylithInt numS,
+                                       const PylithInt numA,
+                                       PetscBdPointJac kernel) {
+    Case value = { family, name, JACOBIAN_BOUNDARY, dim, numS, numA, NULL, NULL, NULL, kernel };
+    return value;
+} // _jacobianBoundary
+
+
+// End of file
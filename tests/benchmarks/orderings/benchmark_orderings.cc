@@ -0,0 +1,272 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/** Benchmark of mesh reordering with ReverseCuthillMcKee.
+ *
+ * The mesh is read from a PyLith ASCII mesh file, optionally refined uniformly, and, if a fault label is given,
+ * cohesive cells are inserted. For each ordering we report the bandwidth of the Jacobian for a scalar field with
+ * basis order 1 and the time for one pass of gathering and scattering the values in the closure of each cell, as
+ * in residual assembly. The time is the minimum over the repeats.
+ *
+ * Usage: benchmark_orderings --mesh=FILENAME [--fault=LABEL] [--refine=N] [--repeat=N]
+ */
+
+#include <portinfo>
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps::deallocate()
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/RefineUniform.hh" // USES RefineUniform
+#include "pylith/topology/ReverseCuthillMcKee.hh" // USES ReverseCuthillMcKee
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "tests/src/FaultCohesiveStub.hh" // USES FaultCohesiveStub
+
+#include "petsctime.h" // USES PetscTime()
+
+#include <getopt.h> // USES getopt_long()
+#include <algorithm> // USES std::max()
+#include <cstdlib> // USES atoi()
+#include <iomanip> // USES std::setw()
+#include <iostream> // USES std::cout
+#include <stdexcept> // USES std::runtime_error
+#include <string> // USES std::string
+
+// ------------------------------------------------------------------------------------------------
+class _BenchmarkOrderings {
+public:
+
+    /// Parameters of benchmark.
+    struct Parameters {
+        std::string meshFilename; ///< Name of PyLith ASCII mesh file.
+        std::string faultLabel; ///< Name of label for fault surface (empty if no fault).
+        int refineLevels; ///< Number of levels of uniform refinement.
+        int numRepeat; ///< Number of closure passes to time.
+    }; // Parameters
+
+    /// Results for one ordering.
+    struct Result {
+        PetscInt numCells; ///< Number of cells (including cohesive cells).
+        PetscInt bandwidth; ///< Bandwidth of Jacobian.
+        PetscLogDouble passTime; ///< Minimum time for one closure pass.
+    }; // Result
+
+    /** Create mesh and apply ordering.
+     *
+     * @param[in] params Parameters of benchmark.
+     * @param[in] ordering Index of ordering (0 for original order, otherwise ReverseCuthillMcKee::OrderingEnum + 1).
+     * @returns Result for ordering.
+     */
+    static
+    Result run(const Parameters& params,
+               const int ordering);
+
+private:
+
+    /** Create mesh.
+     *
+     * @param[in] params Parameters of benchmark.
+     * @returns Mesh (caller is responsible for deleting it).
+     */
+    static
+    pylith::topology::Mesh* _createMesh(const Parameters& params);
+
+}; // _BenchmarkOrderings
+
+// ------------------------------------------------------------------------------------------------
+int
+main(int argc,
+     char* argv[]) {
+    _BenchmarkOrderings::Parameters params;
+    params.refineLevels = 0;
+    params.numRepeat = 10;
+
+    static struct option options[] = {
+        {"mesh", required_argument, NULL, 'm'},
+        {"fault", required_argument, NULL, 'f'},
+        {"refine", required_argument, NULL, 'r'},
+        {"repeat", required_argument, NULL, 'n'},
+        {"help", no_argument, NULL, 'h'},
+        {0, 0, 0, 0}
+    };
+    int c = 0;
+    while ((c = getopt_long(argc, argv, "m:f:r:n:h", options, NULL)) != -1) {
+        switch (c) {
+        case 'm':
+            params.meshFilename = optarg;
+            break;
+        case 'f':
+            params.faultLabel = optarg;
+            break;
+        case 'r':
+            params.refineLevels = std::max(atoi(optarg), 0);
+            break;
+        case 'n':
+            params.numRepeat = std::max(atoi(optarg), 1);
+            break;
+        case 'h':
+        default:
+            std::cout << "Usage: " << argv[0] << " [options]\n"
+                      << "  --mesh=FILENAME  PyLith ASCII mesh file (required).\n"
+                      << "  --fault=LABEL    Insert cohesive cells for fault surface with label LABEL.\n"
+                      << "  --refine=N       Number of levels of uniform refinement (default: 0).\n"
+                      << "  --repeat=N       Number of closure passes to time (default: 10).\n"
+                      << "PETSc options may be given in the PETSC_OPTIONS environment variable.\n";
+            return ('h' == c) ? 0 : 1;
+        } // switch
+    } // while
+    if (params.meshFilename.empty()) {
+        std::cerr << "Error: Missing --mesh=FILENAME." << std::endl;
+        return 1;
+    } // if
+
+    int petscArgc = 1;
+    char** petscArgv = argv;
+    PetscErrorCode err = PetscInitialize(&petscArgc, &petscArgv, NULL, NULL);CHKERRQ(err);
+
+    const int numOrderings = 5;
+    const char* orderingNames[numOrderings] = { "none", "rcm", "rcm_material", "hilbert", "morton" };
+
+    int status = 0;
+    try {
+        std::cout << std::left << std::setw(16) << "ordering" << std::right
+                  << std::setw(12) << "cells" << std::setw(12) << "bandwidth" << std::setw(16) << "pass time (s)"
+                  << std::endl;
+        for (int i = 0; i < numOrderings; ++i) {
+            const _BenchmarkOrderings::Result& result = _BenchmarkOrderings::run(params, i);
+            std::cout << std::left << std::setw(16) << orderingNames[i] << std::right
+                      << std::setw(12) << result.numCells << std::setw(12) << result.bandwidth
+                      << std::scientific << std::setprecision(3) << std::setw(16) << result.passTime
+                      << std::defaultfloat << std::endl;
+        } // for
+    } catch (const std::exception& err) {
+        std::cerr << "Error: " << err.what() << std::endl;
+        status = 1;
+    } // try/catch
+
+    pylith::topology::FieldOps::deallocate();
+    err = PetscFinalize();CHKERRQ(err);
+
+    return status;
+} // main
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh and apply ordering.
+_BenchmarkOrderings::Result
+_BenchmarkOrderings::run(const Parameters& params,
+                         const int ordering) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh* mesh = _createMesh(params);assert(mesh);
+    if (ordering > 0) {
+        pylith::topology::ReverseCuthillMcKee::reorder(mesh, pylith::topology::ReverseCuthillMcKee::OrderingEnum(ordering-1));
+    } // if
+
+    pylith::topology::Field field(*mesh);
+    pylith::topology::Field::Description description;
+    description.label = "solution";
+    description.vectorFieldType = pylith::topology::FieldBase::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = "field";
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    pylith::topology::Field::Discretization discretization;
+    discretization.basisOrder = 1;
+    discretization.quadOrder = 1;
+    field.subfieldAdd(description, discretization);
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+
+    Result result;
+    result.numCells = pylith::topology::MeshOps::getNumCells(*mesh);
+
+    PetscErrorCode err = 0;
+    PetscDM dmField = field.getDM();
+    PetscMat matrix = NULL;
+    err = DMCreateMatrix(dmField, &matrix);PYLITH_CHECK_ERROR(err);
+    err = MatComputeBandwidth(matrix, 0.0, &result.bandwidth);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&matrix);PYLITH_CHECK_ERROR(err);
+
+    // Gather values from the closure of each cell and scatter them back, as in residual assembly.
+    PetscVec solutionVec = field.getLocalVector();
+    PetscVec residualVec = NULL;
+    err = VecDuplicate(solutionVec, &residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(solutionVec, 1.0);PYLITH_CHECK_ERROR(err);
+    err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::Stratum cellsStratum(dmField, pylith::topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    result.passTime = 0.0;
+    for (int iRepeat = 0; iRepeat < params.numRepeat; ++iRepeat) {
+        PetscLogDouble tStart = 0.0, tEnd = 0.0;
+        err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            PetscScalar* values = NULL;
+            PetscInt numValues = 0;
+            err = DMPlexVecGetClosure(dmField, NULL, solutionVec, cell, &numValues, &values);PYLITH_CHECK_ERROR(err);
+            err = DMPlexVecSetClosure(dmField, NULL, residualVec, cell, values, ADD_VALUES);PYLITH_CHECK_ERROR(err);
+            err = DMPlexVecRestoreClosure(dmField, NULL, solutionVec, cell, &numValues, &values);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+        result.passTime = (0 == iRepeat) ? tEnd - tStart : std::min(result.passTime, tEnd - tStart);
+    } // for
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+
+    delete mesh;mesh = NULL;
+
+    PYLITH_METHOD_RETURN(result);
+} // run
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh.
+pylith::topology::Mesh*
+_BenchmarkOrderings::_createMesh(const Parameters& params) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh* mesh = new pylith::topology::Mesh;assert(mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename(params.meshFilename.c_str());
+    iohandler.read(mesh);
+
+    if (params.refineLevels > 0) {
+        pylith::topology::Mesh* meshRefined = new pylith::topology::Mesh;assert(meshRefined);
+        pylith::topology::RefineUniform refiner;
+        refiner.refine(meshRefined, *mesh, params.refineLevels);
+        delete mesh;mesh = meshRefined;
+    } // if
+
+    if (!params.faultLabel.empty()) {
+        pylith::faults::FaultCohesiveStub fault;
+        fault.setCohesiveLabelValue(100);
+        fault.setSurfaceLabelName(params.faultLabel.c_str());
+        fault.adjustTopology(mesh);
+    } // if
+
+    PYLITH_METHOD_RETURN(mesh);
+} // _createMesh
+
+
+// End of file
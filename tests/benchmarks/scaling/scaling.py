@@ -0,0 +1,275 @@
+#!/usr/bin/env nemesis
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file tests/benchmarks/scaling/scaling.py
+#
+# @brief Strong and weak scaling benchmarks based on the full-scale tests.
+#
+# Each run copies the directory of a full-scale test to a work directory, refines the mesh of the test uniformly
+# to obtain the problem size, and runs PyLith with the PETSc log written in CSV format. The summary contains the
+# elapsed time of the PyLith logging stages (Meshing, Setup, Run, Output, Finalize) and of assembly and solve
+# within the Run stage, together with the size of the problem from the PyLith performance report.
+
+import argparse
+import csv
+import json
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+
+class Case(object):
+    """Benchmark case based on a full-scale test.
+    """
+
+    def __init__(self, name, directory, cfgs, generatedb=None):
+        """Constructor.
+
+        Args:
+            name: Name of benchmark case.
+            directory: Directory of full-scale test relative to tests/fullscale.
+            cfgs: Configuration files with '{cell}' substituted by the cell type.
+            generatedb: Module with GenerateDB class for spatial databases.
+        """
+        self.name = name
+        self.directory = directory
+        self.cfgs = cfgs
+        self.generatedb = generatedb
+
+
+CASES = {
+    "nofaults-3d": Case("nofaults-3d", os.path.join("linearelasticity", "nofaults-3d"),
+                        ["axialdisp.cfg", "axialdisp_{cell}.cfg"], "axialdisp_gendb"),
+    "faults-3d": Case("faults-3d", os.path.join("linearelasticity", "faults-3d"),
+                      ["twoblocks.cfg", "twoblocks_{cell}.cfg"]),
+    "viscoelasticity": Case("viscoelasticity", os.path.join("viscoelasticity", "nofaults-3d"),
+                            ["axialtraction_maxwell.cfg", "axialtraction_maxwell_{cell}.cfg"],
+                            "axialtraction_maxwell_gendb"),
+    "poroelasticity": Case("poroelasticity", os.path.join("poroelasticity", "cryer"),
+                           ["cryer.cfg", "cryer_{cell}.cfg"]),
+}
+
+# PyLith logging stages in order of execution.
+STAGES = ["Meshing", "Setup", "Run", "Output", "Finalize"]
+
+# PETSc events within the Run stage that make up assembly and solve.
+ASSEMBLY_EVENTS = ["SNESFunctionEval", "SNESJacobianEval"]
+SOLVE_EVENTS = ["KSPSolve"]
+
+# Number of refinement levels that increases the number of cells by the number of processes in 3D.
+REFINE_FACTOR = 8
+
+
+class ScalingApp(object):
+    """Application for running scaling benchmarks.
+    """
+
+    def main(self):
+        """Run benchmarks.
+        """
+        args = self._parse_command_line()
+        if args.list:
+            for name in sorted(CASES):
+                print(name)
+            return
+
+        runs = []
+        for name in args.cases:
+            for nprocs in args.nprocs:
+                levels = args.levels
+                if args.mode == "weak":
+                    levels += self._weak_levels(nprocs, args.nprocs[0])
+                runs.append(self._run(CASES[name], args, nprocs, levels))
+
+        summary = {
+            "mode": args.mode,
+            "cell": args.cell,
+            "runs": runs,
+        }
+        with open(args.output, "w") as fout:
+            json.dump(summary, fout, indent=2)
+            fout.write("\n")
+        self._print_summary(runs)
+
+    def _parse_command_line(self):
+        """Parse command line arguments.
+        """
+        dirDefault = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "fullscale")
+        parser = argparse.ArgumentParser(description="Run strong and weak scaling benchmarks based on the full-scale tests.",
+                                         epilog="Additional arguments after '--' are passed to PyLith.")
+        parser.add_argument("--cases", action="store", dest="cases", nargs="+", choices=sorted(CASES),
+                            default=sorted(CASES), help="Benchmark cases.")
+        parser.add_argument("--cell", action="store", dest="cell", choices=["tet", "hex"], default="tet",
+                            help="Cell type of mesh.")
+        parser.add_argument("--mode", action="store", dest="mode", choices=["strong", "weak"], default="strong",
+                            help="Keep problem size fixed (strong) or proportional to number of processes (weak).")
+        parser.add_argument("--nprocs", action="store", dest="nprocs", type=int, nargs="+", default=[1, 2, 4, 8],
+                            help="Numbers of processes.")
+        parser.add_argument("--levels", action="store", dest="levels", type=int, default=1,
+                            help="Number of uniform refinement levels (for the first number of processes in weak scaling).")
+        parser.add_argument("--fullscale-dir", action="store", dest="fullscale_dir", default=dirDefault,
+                            help="Directory with full-scale tests.")
+        parser.add_argument("--work-dir", action="store", dest="work_dir", default="scaling-runs",
+                            help="Directory for runs.")
+        parser.add_argument("--output", action="store", dest="output", default="scaling.json",
+                            help="Filename for summary (JSON).")
+        parser.add_argument("--pylith", action="store", dest="pylith", default="pylith",
+                            help="PyLith executable.")
+        parser.add_argument("--list", action="store_true", dest="list", help="List benchmark cases and exit.")
+        argv = sys.argv[1:]
+        extra = []
+        if "--" in argv:
+            extra = argv[argv.index("--")+1:]
+            argv = argv[:argv.index("--")]
+        args = parser.parse_args(argv)
+        args.pylith_args = extra
+
+        if min(args.nprocs) < 1:
+            parser.error("Number of processes must be positive.")
+        if args.levels < 0:
+            parser.error("Number of refinement levels must be nonnegative.")
+        return args
+
+    def _weak_levels(self, nprocs, nprocsBase):
+        """Get additional refinement levels for weak scaling.
+
+        Each level of uniform refinement increases the number of cells by a factor of 8 in 3D, so the number of
+        processes must increase by a factor of 8 per level for the number of cells per process to remain the same.
+        """
+        levels = 0
+        ratio = nprocs // nprocsBase
+        while ratio >= REFINE_FACTOR:
+            ratio //= REFINE_FACTOR
+            levels += 1
+        if nprocs != nprocsBase * REFINE_FACTOR**levels:
+            print("WARNING: Number of processes {} is not {} times a power of {}; cells per process will differ."
+                  .format(nprocs, nprocsBase, REFINE_FACTOR))
+        return levels
+
+    def _run(self, case, args, nprocs, levels):
+        """Run PyLith for one benchmark case.
+        """
+        name = "{}_{}-np{}-l{}".format(case.name, args.cell, nprocs, levels)
+        workdir = os.path.abspath(os.path.join(args.work_dir, name))
+        if os.path.exists(workdir):
+            shutil.rmtree(workdir)
+        shutil.copytree(os.path.join(args.fullscale_dir, case.directory), workdir)
+
+        if case.generatedb:
+            sys.path.insert(0, workdir)
+            cwd = os.getcwd()
+            os.chdir(workdir)
+            try:
+                module = __import__(case.generatedb)
+                module.GenerateDB().run()
+            finally:
+                os.chdir(cwd)
+                sys.path.remove(workdir)
+                for module in [case.generatedb] + [m for m in sys.modules if m.endswith("_soln")]:
+                    sys.modules.pop(module, None)
+
+        logFilename = name + "-log.csv"
+        reportFilename = name + "-performance.json"
+        cmd = [args.pylith] + [cfg.format(cell=args.cell) for cfg in case.cfgs] + [
+            "--nodes={}".format(nprocs),
+            "--problem.petsc_defaults.testing=False",
+            "--petsc.log_view=:{}:ascii_csv".format(logFilename),
+            "--problem.performance_report_filename={}".format(reportFilename),
+        ]
+        if levels > 0:
+            cmd += [
+                "--mesh_generator.refiner=pylith.topology.RefineUniform",
+                "--mesh_generator.refiner.levels={}".format(levels),
+            ]
+        cmd += args.pylith_args
+
+        print("Running {} ...".format(name))
+        sys.stdout.flush()
+        with open(os.path.join(workdir, name + ".log"), "w") as flog:
+            tStart = time.time()
+            status = subprocess.call(cmd, cwd=workdir, stdout=flog, stderr=subprocess.STDOUT)
+            elapsed = time.time() - tStart
+        if status:
+            raise RuntimeError("Run '{}' failed with status {}. See '{}' for details.".format(
+                name, status, os.path.join(workdir, name + ".log")))
+
+        run = {
+            "name": name,
+            "case": case.name,
+            "nprocs": nprocs,
+            "levels": levels,
+            "wall_time": elapsed,
+        }
+        run.update(self._parse_log(os.path.join(workdir, logFilename)))
+        run.update(self._parse_report(os.path.join(workdir, reportFilename)))
+        return run
+
+    def _parse_log(self, filename):
+        """Get time of stages and events from PETSc log in CSV format.
+
+        The times are the maximum over the processes.
+        """
+        stages = {}
+        events = {}
+        with open(filename, "r") as fin:
+            for row in csv.DictReader(fin):
+                stage = row["Stage Name"].strip()
+                event = row["Event Name"].strip()
+                value = float(row["Time"])
+                if event == "summary":
+                    stages[stage] = max(stages.get(stage, 0.0), value)
+                elif stage == "Run":
+                    events[event] = max(events.get(event, 0.0), value)
+
+        return {
+            "stages": {stage: stages.get(stage, 0.0) for stage in STAGES},
+            "assembly": sum([events.get(event, 0.0) for event in ASSEMBLY_EVENTS]),
+            "solve": sum([events.get(event, 0.0) for event in SOLVE_EVENTS]),
+        }
+
+    def _parse_report(self, filename):
+        """Get size of problem from PyLith performance report.
+        """
+        with open(filename, "r") as fin:
+            report = json.load(fin)
+        integrators = report.get("integrators", [])
+        sizes = [{"name": integrator["name"], "num_cells": integrator["num_cells"], "num_dof": integrator["num_dof"]}
+                 for integrator in integrators]
+        return {
+            "num_dof": max([integrator["num_dof"] for integrator in integrators] + [0]),
+            "integrators": sizes,
+        }
+
+    def _print_summary(self, runs):
+        """Print table of times.
+        """
+        columns = STAGES + ["assembly", "solve"]
+        print("{:40s} {:>6s} {:>10s}".format("run", "nprocs", "num_dof") + "".join(["{:>10s}".format(c) for c in columns]))
+        for run in runs:
+            times = [run["stages"][stage] for stage in STAGES] + [run["assembly"], run["solve"]]
+            print("{:40s} {:6d} {:10d}".format(run["name"], run["nprocs"], run["num_dof"]) +
+                  "".join(["{:10.3f}".format(t) for t in times]))
+
+
+# ----------------------------------------------------------------------
+if __name__ == "__main__":
+    ScalingApp().main()
+
+
+# End of file
@@ -94,6 +94,19 @@ class TestTri(TestCase):
         return
 
 
+# -------------------------------------------------------------------------------------------------
+class TestTriMass(TestCase):
+
+    def setUp(self):
+        self.name = "gravity_incompressible_mass_tri"
+        self.mesh = meshes.Tri()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name, ["gravity_incompressible.cfg", "gravity_incompressible_tri.cfg",
+                                              "gravity_incompressible_mass_tri.cfg"])
+        return
+
+
 # -------------------------------------------------------------------------------------------------
 class TestQuadIC(TestCase):
 
@@ -123,6 +136,7 @@ def test_cases():
     return [
         TestQuad,
         TestTri,
+        TestTriMass,
         TestQuadIC,
         TestTriIC,
     ]
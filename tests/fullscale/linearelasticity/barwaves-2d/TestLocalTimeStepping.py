@@ -0,0 +1,92 @@
+#!/usr/bin/env nemesis
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file tests/fullscale/linearelasticity/barwaves-2d/TestLocalTimeStepping.py
+#
+# @brief Test suite for local time stepping with a P wave through a bar with a refined patch.
+#
+# The solution with local time stepping must match the solution using a single time step for all cells that is
+# stable in the refined patch. The methods differ in how the rate groups are coupled, so the tolerance reflects the
+# truncation error of the second order time stepping methods rather than roundoff.
+
+import unittest
+
+from pylith.testing.FullTestApp import (FullTestCase, check_same_output)
+
+
+# -------------------------------------------------------------------------------------------------
+class TestCase(FullTestCase):
+
+    NAME_GLOBAL = "globalstep"
+    TOLERANCE = 2.0e-2
+
+    def setUp(self):
+        self.run_pylith(self.NAME_GLOBAL, ["globalstep.cfg"])
+        self.run_pylith(self.name, self.args, nprocs=self.nprocs)
+        return
+
+    def test_domain(self):
+        check_same_output(self, f"output/{self.name}-domain.h5", f"output/{self.NAME_GLOBAL}-domain.h5",
+                          vertex_fields=["displacement", "velocity"], tolerance=self.TOLERANCE)
+
+
+# -------------------------------------------------------------------------------------------------
+class TestSerial(TestCase):
+
+    def setUp(self):
+        self.name = "localstep"
+        self.args = ["localstep.cfg"]
+        self.nprocs = 1
+        super().setUp()
+
+
+# -------------------------------------------------------------------------------------------------
+class TestParallel(TestCase):
+    """Refined patch split across processes, so the rate groups must agree for points shared among processes.
+    """
+
+    def setUp(self):
+        self.name = "localstep_np2"
+        self.args = [
+            "localstep.cfg",
+            f"--problem.defaults.name={self.name}",
+            f"--dump_parameters.filename=output/{self.name}-parameters.json",
+            f"--problem.progress_monitor.filename=output/{self.name}-progress.txt",
+        ]
+        self.nprocs = 2
+        super().setUp()
+
+
+# -------------------------------------------------------------------------------------------------
+def test_cases():
+    return [
+        TestSerial,
+        TestParallel,
+    ]
+
+
+# -------------------------------------------------------------------------------------------------
+if __name__ == '__main__':
+    FullTestCase.parse_args()
+
+    suite = unittest.TestSuite()
+    for test in test_cases():
+        suite.addTest(unittest.makeSuite(test))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
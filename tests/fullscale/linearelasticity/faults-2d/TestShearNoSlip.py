@@ -108,11 +108,24 @@ class TestTriGmsh(TestCase):
         return
 
 
+# -------------------------------------------------------------------------------------------------
+class TestTriGmshBDDC(TestCase):
+
+    def setUp(self):
+        self.name = "shearnoslip_tri_bddc"
+        self.mesh = meshes.TriGmsh()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name, ["shearnoslip.cfg", "shearnoslip_tri.cfg", "shearnoslip_tri_bddc.cfg"])
+        return
+
+
 # -------------------------------------------------------------------------------------------------
 def test_cases():
     return [
         TestQuadGmsh,
         TestTriGmsh,
+        TestTriGmshBDDC,
     ]
 
 
@@ -16,8 +16,12 @@
 # ----------------------------------------------------------------------
 
 import unittest
+import os
 
-from pylith.testing.FullTestApp import (FullTestCase, Check)
+import numpy
+
+from pylith.testing import has_h5py
+from pylith.testing.FullTestApp import (FullTestCase, Check, check_same_output)
 
 import meshes
 import twoblocks_soln
@@ -108,11 +112,196 @@ class TestTetGmsh(TestCase):
         return
 
 
+# -------------------------------------------------------------------------------------------------
+class TestInsertAfter(TestCase):
+    """Insert cohesive cells after distributing the mesh and compare against inserting them before distributing
+    the mesh.
+
+    We do not compare the output over the domain, because vertices on the two sides of the fault have the same
+    coordinates.
+    """
+
+    def test_same_output(self):
+        mesh_entities = {
+            "points": ["displacement"],
+            "bc_xneg": ["displacement"],
+            "bc_xpos": ["displacement"],
+            "fault": ["slip", "lagrange_multiplier_fault"],
+        }
+        for mesh_entity, fields in mesh_entities.items():
+            with self.subTest(mesh_entity=mesh_entity):
+                check_same_output(self, f"output/{self.name}-{mesh_entity}.h5",
+                                  f"output/{self.name_before}-{mesh_entity}.h5", vertex_fields=fields)
+        check_same_output(self, f"output/{self.name}-mat_elastic.h5", f"output/{self.name_before}-mat_elastic.h5",
+                          cell_fields=["cauchy_strain", "cauchy_stress"])
+
+
+# -------------------------------------------------------------------------------------------------
+class TestHexGmshInsertAfter(TestInsertAfter):
+
+    def setUp(self):
+        self.name = "twoblocks_hex_insertafter"
+        self.name_before = "twoblocks_hex"
+        self.mesh = meshes.HexGmsh()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name_before, ["twoblocks.cfg", "twoblocks_hex.cfg"], nprocs=2)
+        TestCase.run_pylith(self, self.name, ["twoblocks.cfg", "twoblocks_hex.cfg", "twoblocks_hex_insertafter.cfg"],
+                            nprocs=2)
+        return
+
+
+# -------------------------------------------------------------------------------------------------
+class TestTetGmshInsertAfter(TestInsertAfter):
+
+    def setUp(self):
+        self.name = "twoblocks_tet_insertafter"
+        self.name_before = "twoblocks_tet"
+        self.mesh = meshes.TetGmsh()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name_before, ["twoblocks.cfg", "twoblocks_tet.cfg"], nprocs=3)
+        TestCase.run_pylith(self, self.name, ["twoblocks.cfg", "twoblocks_tet.cfg", "twoblocks_tet_insertafter.cfg"],
+                            nprocs=3)
+        return
+
+
+# -------------------------------------------------------------------------------------------------
+class TestHexGmshPreparedMesh(TestCase):
+    """Cache the prepared mesh and reuse it.
+
+    The first run prepares the mesh and saves it (miss), the second run uses the saved mesh (hit), and a run with
+    a different number of processes prepares the mesh again and overwrites the saved mesh (miss).
+    """
+    PREPARED_FILENAME = "output/twoblocks_hex_prepared-mesh.h5"
+    mtimes = None
+
+    def setUp(self):
+        self.name = "twoblocks_hex_prepared_hit"
+        self.name_before = "twoblocks_hex"
+        self.mesh = meshes.HexGmsh()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name_before, ["twoblocks.cfg", "twoblocks_hex.cfg"], nprocs=2)
+        if TestHexGmshPreparedMesh.mtimes is None:
+            if os.path.isfile(self.PREPARED_FILENAME):
+                os.remove(self.PREPARED_FILENAME)
+            mtimes = {}
+            for name, nprocs in (("miss", 2), ("hit", 2), ("rewrite", 3)):
+                runName = f"twoblocks_hex_prepared_{name}"
+                TestCase.run_pylith(self, runName, self._args(runName), nprocs=nprocs)
+                mtimes[name] = os.stat(self.PREPARED_FILENAME).st_mtime_ns \
+                    if os.path.isfile(self.PREPARED_FILENAME) else None
+            TestHexGmshPreparedMesh.mtimes = mtimes
+        return
+
+    def _args(self, name):
+        return [
+            "twoblocks.cfg",
+            "twoblocks_hex.cfg",
+            f"--mesh_generator.prepared_mesh_filename={self.PREPARED_FILENAME}",
+            f"--problem.defaults.name={name}",
+            f"--dump_parameters.filename=output/{name}-parameters.json",
+            f"--problem.progress_monitor.filename=output/{name}-progress.txt",
+        ]
+
+    def test_cache(self):
+        mtimes = TestHexGmshPreparedMesh.mtimes
+        self.assertIsNotNone(mtimes["miss"], msg="Prepared mesh not saved on miss.")
+        self.assertEqual(mtimes["miss"], mtimes["hit"], msg="Prepared mesh overwritten on hit.")
+        self.assertNotEqual(mtimes["hit"], mtimes["rewrite"], msg="Prepared mesh not overwritten on miss.")
+
+    def test_same_output(self):
+        mesh_entities = {
+            "points": ["displacement"],
+            "bc_xneg": ["displacement"],
+            "fault": ["slip", "lagrange_multiplier_fault"],
+        }
+        for name in ["miss", "hit", "rewrite"]:
+            runName = f"twoblocks_hex_prepared_{name}"
+            for mesh_entity, fields in mesh_entities.items():
+                with self.subTest(run=name, mesh_entity=mesh_entity):
+                    check_same_output(self, f"output/{runName}-{mesh_entity}.h5",
+                                      f"output/{self.name_before}-{mesh_entity}.h5", vertex_fields=fields)
+
+
+# -------------------------------------------------------------------------------------------------
+class TestTetGmshPartition(TestCase):
+    """Distribute the mesh over more processes than the other tests, so more fault faces lie on partition boundaries
+    and the overlap for the fault must provide the cells on both sides of each of them, and write the partition.
+    """
+    NUM_PROCS = 4
+
+    def setUp(self):
+        self.name = "twoblocks_tet_partition"
+        self.mesh = meshes.TetGmsh()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name, [
+            "twoblocks.cfg",
+            "twoblocks_tet.cfg",
+            "--mesh_generator.distributor.write_partition=True",
+            f"--problem.defaults.name={self.name}",
+            f"--dump_parameters.filename=output/{self.name}-parameters.json",
+            f"--problem.progress_monitor.filename=output/{self.name}-progress.txt",
+            ], nprocs=self.NUM_PROCS)
+        return
+
+    def test_partition(self):
+        if not has_h5py():
+            return
+        import h5py
+
+        h5 = h5py.File(f"output/{self.name}-partition.h5", "r")
+        ranks = numpy.unique(h5["cell_fields/partition"][:])
+        h5.close()
+        self.assertTrue(ranks.size > 1)
+        self.assertEqual(0, ranks[0])
+
+
+# -------------------------------------------------------------------------------------------------
+class TestTetGmshCellWeights(TestCase):
+    """Partition the mesh using cell weights estimated from the cost of the materials and the fault.
+    """
+    NUM_PROCS = 2
+
+    def setUp(self):
+        self.name = "twoblocks_tet_cellweights"
+        self.mesh = meshes.TetGmsh()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name, [
+            "twoblocks.cfg",
+            "twoblocks_tet.cfg",
+            "--mesh_generator.distributor.use_cell_weights=True",
+            "--mesh_generator.distributor.write_partition=True",
+            f"--problem.defaults.name={self.name}",
+            f"--dump_parameters.filename=output/{self.name}-parameters.json",
+            f"--problem.progress_monitor.filename=output/{self.name}-progress.txt",
+            ], nprocs=self.NUM_PROCS)
+        return
+
+    def test_partition(self):
+        if not has_h5py():
+            return
+        import h5py
+
+        h5 = h5py.File(f"output/{self.name}-partition.h5", "r")
+        ranks = numpy.unique(h5["cell_fields/partition"][:])
+        h5.close()
+        numpy.testing.assert_array_equal(numpy.arange(self.NUM_PROCS), ranks)
+
+
 # -------------------------------------------------------------------------------------------------
 def test_cases():
     return [
         TestHexGmsh,
         TestTetGmsh,
+        TestHexGmshInsertAfter,
+        TestTetGmshInsertAfter,
+        TestHexGmshPreparedMesh,
+        TestTetGmshPartition,
+        TestTetGmshCellWeights,
     ]
 
 
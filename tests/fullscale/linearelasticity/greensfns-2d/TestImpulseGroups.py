@@ -0,0 +1,85 @@
+#!/usr/bin/env nemesis
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file tests/fullscale/linearelasticity/greensfns-2d/TestImpulseGroups.py
+#
+# @brief Test suite for solving Green's functions impulses concurrently on groups of processes.
+#
+# We run the left-lateral problem on two processes with all processes solving each impulse and with two process
+# groups. The responses to the impulses must match.
+
+import unittest
+
+from pylith.testing.FullTestApp import (FullTestCase, check_same_output)
+
+
+# -------------------------------------------------------------------------------------------------
+def _run_args(name, extra=[]):
+    """Command line arguments for a run of the left-lateral problem.
+    """
+    args = [
+        "leftlateral_b1.cfg",
+        "leftlateral_b1_tri.cfg",
+        f"--problem.defaults.name={name}",
+        f"--dump_parameters.filename=output/{name}-parameters.json",
+        f"--problem.progress_monitor.filename=output/{name}-progress.txt",
+    ]
+    return args + extra
+
+
+# -------------------------------------------------------------------------------------------------
+class TestCase(FullTestCase):
+
+    NAME_SINGLE = "leftlateral_b1_tri_single"
+    NAME = "leftlateral_b1_tri_groups"
+    NUM_PROCS = 2
+
+    def setUp(self):
+        self.name = self.NAME
+        FullTestCase.run_pylith(self, self.NAME_SINGLE, _run_args(self.NAME_SINGLE), nprocs=self.NUM_PROCS)
+        FullTestCase.run_pylith(self, self.NAME, _run_args(self.NAME, [
+            "--problem.impulse_groups=2",
+        ]), nprocs=self.NUM_PROCS)
+        return
+
+    def test_domain(self):
+        check_same_output(self, f"output/{self.NAME}-domain.h5", f"output/{self.NAME_SINGLE}-domain.h5",
+                          vertex_fields=["displacement"])
+
+    def test_fault(self):
+        check_same_output(self, f"output/{self.NAME}-fault.h5", f"output/{self.NAME_SINGLE}-fault.h5",
+                          vertex_fields=["slip"])
+
+
+# -------------------------------------------------------------------------------------------------
+def test_cases():
+    return [
+        TestCase,
+    ]
+
+
+# -------------------------------------------------------------------------------------------------
+if __name__ == '__main__':
+    FullTestCase.parse_args()
+
+    suite = unittest.TestSuite()
+    for test in test_cases():
+        suite.addTest(unittest.makeSuite(test))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
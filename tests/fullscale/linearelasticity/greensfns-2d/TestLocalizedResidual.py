@@ -0,0 +1,106 @@
+#!/usr/bin/env nemesis
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file tests/fullscale/linearelasticity/greensfns-2d/TestLocalizedResidual.py
+#
+# @brief Test suite for assembling the right-hand side of Green's functions impulses over the fault cells in the
+# support of each impulse.
+#
+# We run the left-lateral problem with the default residual assembly and with the localized residual for batches of
+# impulses and for process groups. The responses to the impulses must match.
+
+import unittest
+
+from pylith.testing.FullTestApp import (FullTestCase, check_same_output)
+
+
+# -------------------------------------------------------------------------------------------------
+def _run_args(name, extra=[]):
+    """Command line arguments for a run of the left-lateral problem.
+    """
+    args = [
+        "leftlateral_b1.cfg",
+        "leftlateral_b1_tri.cfg",
+        f"--problem.defaults.name={name}",
+        f"--dump_parameters.filename=output/{name}-parameters.json",
+        f"--problem.progress_monitor.filename=output/{name}-progress.txt",
+    ]
+    return args + extra
+
+
+# -------------------------------------------------------------------------------------------------
+class TestCase(FullTestCase):
+
+    NAME_DEFAULT = None
+    NAME = None
+    NUM_PROCS = 1
+    ARGS = []
+
+    def setUp(self):
+        self.name = self.NAME
+        FullTestCase.run_pylith(self, self.NAME_DEFAULT, _run_args(self.NAME_DEFAULT), nprocs=self.NUM_PROCS)
+        FullTestCase.run_pylith(self, self.NAME, _run_args(self.NAME, self.ARGS + [
+            "--problem.localized_residual=True",
+        ]), nprocs=self.NUM_PROCS)
+        return
+
+    def test_domain(self):
+        check_same_output(self, f"output/{self.NAME}-domain.h5", f"output/{self.NAME_DEFAULT}-domain.h5",
+                          vertex_fields=["displacement"])
+
+    def test_fault(self):
+        check_same_output(self, f"output/{self.NAME}-fault.h5", f"output/{self.NAME_DEFAULT}-fault.h5",
+                          vertex_fields=["slip"])
+
+
+# -------------------------------------------------------------------------------------------------
+class TestBatch(TestCase):
+
+    NAME_DEFAULT = "leftlateral_b1_tri_default"
+    NAME = "leftlateral_b1_tri_localized_batch"
+    NUM_PROCS = 1
+    ARGS = ["--problem.impulse_batch_size=4"]
+
+
+# -------------------------------------------------------------------------------------------------
+class TestGroups(TestCase):
+
+    NAME_DEFAULT = "leftlateral_b1_tri_default_np2"
+    NAME = "leftlateral_b1_tri_localized_groups"
+    NUM_PROCS = 2
+    ARGS = ["--problem.impulse_groups=2"]
+
+
+# -------------------------------------------------------------------------------------------------
+def test_cases():
+    return [
+        TestBatch,
+        TestGroups,
+    ]
+
+
+# -------------------------------------------------------------------------------------------------
+if __name__ == '__main__':
+    FullTestCase.parse_args()
+
+    suite = unittest.TestSuite()
+    for test in test_cases():
+        suite.addTest(unittest.makeSuite(test))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
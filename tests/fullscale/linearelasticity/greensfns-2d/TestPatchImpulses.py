@@ -0,0 +1,126 @@
+#!/usr/bin/env nemesis
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file tests/fullscale/linearelasticity/greensfns-2d/TestPatchImpulses.py
+#
+# @brief Test suite for Green's functions impulses applied as uniform slip over patches.
+#
+# We run the left-lateral problem with an impulse at each fault point and with all fault points in a single
+# patch. Because the problem is linear and the slip basis functions sum to one, the response to the patch impulse
+# must match the sum of the responses to the point impulses.
+
+import unittest
+
+import numpy
+
+from pylith.testing import has_h5py
+from pylith.testing.FullTestApp import FullTestCase
+
+
+# -------------------------------------------------------------------------------------------------
+def _run_args(name, extra=[]):
+    """Command line arguments for a run of the left-lateral problem.
+    """
+    args = [
+        "leftlateral_b1.cfg",
+        "leftlateral_b1_tri.cfg",
+        f"--problem.defaults.name={name}",
+        f"--dump_parameters.filename=output/{name}-parameters.json",
+        f"--problem.progress_monitor.filename=output/{name}-progress.txt",
+    ]
+    return args + extra
+
+
+# -------------------------------------------------------------------------------------------------
+class TestCase(FullTestCase):
+
+    NAME_POINTS = "leftlateral_b1_tri_points"
+    NAME = "leftlateral_b1_tri_patch"
+    NUM_PROCS = 1
+
+    def setUp(self):
+        self.name = self.NAME
+        FullTestCase.run_pylith(self, self.NAME_POINTS, _run_args(self.NAME_POINTS), nprocs=self.NUM_PROCS)
+        FullTestCase.run_pylith(self, self.NAME, _run_args(self.NAME, [
+            "--problem.interfaces.fault.db_patches=spatialdata.spatialdb.UniformDB",
+            "--problem.interfaces.fault.db_patches.description=Fault patches",
+            "--problem.interfaces.fault.db_patches.values=[patch_id]",
+            "--problem.interfaces.fault.db_patches.data=[0]",
+        ]), nprocs=self.NUM_PROCS)
+        return
+
+    def test_domain(self):
+        self._check_sum(f"output/{self.NAME}-domain.h5", f"output/{self.NAME_POINTS}-domain.h5", "displacement")
+
+    def test_fault(self):
+        self._check_sum(f"output/{self.NAME}-fault.h5", f"output/{self.NAME_POINTS}-fault.h5", "slip")
+
+    def _check_sum(self, filename, filenamePoints, fieldName):
+        if not has_h5py():
+            return
+        import h5py
+
+        h5 = h5py.File(filename, "r")
+        values = h5[f"vertex_fields/{fieldName}"][:]
+        h5.close()
+        h5 = h5py.File(filenamePoints, "r")
+        valuesPoints = h5[f"vertex_fields/{fieldName}"][:]
+        h5.close()
+
+        self.assertEqual(1, values.shape[0])
+        self.assertTrue(valuesPoints.shape[0] > 1)
+        valuesE = numpy.sum(valuesPoints, axis=0)
+
+        tolerance = 1.0e-6
+        zero_tolerance = 1.0e-10
+        scale = max(numpy.max(numpy.abs(valuesE)), zero_tolerance)
+        okay = numpy.abs(values[0] - valuesE) < tolerance * scale
+        if not numpy.all(okay):
+            maskBad = ~okay
+            print(f"Mismatch in field '{fieldName}' of patch impulse in '{filename}'.")
+            print(f"Expected values (not okay): {valuesE[maskBad]}")
+            print(f"Computed values (not okay): {values[0][maskBad]}")
+        self.assertTrue(numpy.all(okay))
+
+
+# -------------------------------------------------------------------------------------------------
+class TestParallel(TestCase):
+
+    NAME_POINTS = "leftlateral_b1_tri_points_np2"
+    NAME = "leftlateral_b1_tri_patch_np2"
+    NUM_PROCS = 2
+
+
+# -------------------------------------------------------------------------------------------------
+def test_cases():
+    return [
+        TestCase,
+        TestParallel,
+    ]
+
+
+# -------------------------------------------------------------------------------------------------
+if __name__ == '__main__':
+    FullTestCase.parse_args()
+
+    suite = unittest.TestSuite()
+    for test in test_cases():
+        suite.addTest(unittest.makeSuite(test))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
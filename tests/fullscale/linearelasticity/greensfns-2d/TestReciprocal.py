@@ -0,0 +1,134 @@
+#!/usr/bin/env nemesis
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file tests/fullscale/linearelasticity/greensfns-2d/TestReciprocal.py
+#
+# @brief Test suite for computing Green's functions using reciprocity.
+#
+# We run the left-lateral problem solving each impulse with output at the stations and computing the Green's
+# functions at the same stations using reciprocity. The Green's functions must match.
+
+import unittest
+
+import numpy
+
+from pylith.testing import has_h5py
+from pylith.testing.FullTestApp import FullTestCase
+
+STATIONS = ["ST.1", "ST.2", "ST.3"]
+MAT_FILE_CLASSID = 1211216
+MATRIX_BINARY_FORMAT_DENSE = -1
+
+
+# -------------------------------------------------------------------------------------------------
+def _run_args(name, extra=[]):
+    """Command line arguments for a run of the left-lateral problem.
+    """
+    args = [
+        "leftlateral_b1.cfg",
+        "leftlateral_b1_tri.cfg",
+        f"--problem.defaults.name={name}",
+        f"--dump_parameters.filename=output/{name}-parameters.json",
+        f"--problem.progress_monitor.filename=output/{name}-progress.txt",
+    ]
+    return args + extra
+
+
+# -------------------------------------------------------------------------------------------------
+def _read_dense_matrix(filename):
+    """Read dense matrix from PETSc binary file (32-bit integers, double precision scalars).
+    """
+    with open(filename, "rb") as fin:
+        classid, nrows, ncols, format = numpy.fromfile(fin, dtype=">i4", count=4)
+        if classid != MAT_FILE_CLASSID or format != MATRIX_BINARY_FORMAT_DENSE:
+            raise IOError(f"File '{filename}' does not contain a dense PETSc matrix.")
+        values = numpy.fromfile(fin, dtype=">f8", count=nrows*ncols)
+    return values.reshape((nrows, ncols))
+
+
+# -------------------------------------------------------------------------------------------------
+class TestCase(FullTestCase):
+
+    NAME_FORWARD = "leftlateral_b1_tri_forward"
+    NAME = "leftlateral_b1_tri_reciprocal"
+    SPACE_DIM = 2
+
+    def setUp(self):
+        self.name = self.NAME
+        FullTestCase.run_pylith(self, self.NAME_FORWARD, _run_args(self.NAME_FORWARD, [
+            "--problem.solution_observers=[points]",
+            "--problem.solution_observers.points=pylith.meshio.OutputSolnPoints",
+            "--problem.solution_observers.points.data_fields=[displacement]",
+            "--problem.solution_observers.points.reader.filename=stations.txt",
+            "--problem.solution_observers.points.reader.coordsys.space_dim=2",
+        ]))
+        FullTestCase.run_pylith(self, self.NAME, _run_args(self.NAME, [
+            "--problem.reciprocal=True",
+            "--problem.reciprocal_points.filename=stations.txt",
+            "--problem.reciprocal_points.coordsys.space_dim=2",
+            f"--problem.reciprocal_filename=output/{self.NAME}.bin",
+        ]))
+        return
+
+    def test_greensfns(self):
+        if not has_h5py():
+            return
+        import h5py
+
+        h5 = h5py.File(f"output/{self.NAME_FORWARD}-points.h5", "r")
+        stations = [name.decode() if isinstance(name, bytes) else name for name in h5["stations"][:]]
+        forward = h5["vertex_fields/displacement"][:]
+        h5.close()
+        numImpulses = forward.shape[0]
+
+        reciprocal = _read_dense_matrix(f"output/{self.NAME}.bin")
+        self.assertEqual((len(STATIONS)*self.SPACE_DIM, numImpulses), reciprocal.shape)
+
+        tolerance = 1.0e-6
+        zero_tolerance = 1.0e-10
+        for iStation, name in enumerate(STATIONS):
+            with self.subTest(station=name):
+                valuesE = forward[:, stations.index(name), :]
+                values = reciprocal[iStation*self.SPACE_DIM:(iStation+1)*self.SPACE_DIM, :].transpose()
+                scale = max(numpy.max(numpy.abs(valuesE)), zero_tolerance)
+                okay = numpy.abs(values - valuesE) < tolerance * scale
+                if not numpy.all(okay):
+                    maskBad = ~okay
+                    print(f"Mismatch in Green's functions at station {name}.")
+                    print(f"Expected values (not okay): {valuesE[maskBad]}")
+                    print(f"Computed values (not okay): {values[maskBad]}")
+                self.assertTrue(numpy.all(okay))
+
+
+# -------------------------------------------------------------------------------------------------
+def test_cases():
+    return [
+        TestCase,
+    ]
+
+
+# -------------------------------------------------------------------------------------------------
+if __name__ == '__main__':
+    FullTestCase.parse_args()
+
+    suite = unittest.TestSuite()
+    for test in test_cases():
+        suite.addTest(unittest.makeSuite(test))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
@@ -39,6 +39,22 @@ class TestApp(TestDriver):
         for test in TestLeftLateral.test_cases():
             suite.addTest(unittest.makeSuite(test))
 
+        import TestImpulseGroups
+        for test in TestImpulseGroups.test_cases():
+            suite.addTest(unittest.makeSuite(test))
+
+        import TestLocalizedResidual
+        for test in TestLocalizedResidual.test_cases():
+            suite.addTest(unittest.makeSuite(test))
+
+        import TestPatchImpulses
+        for test in TestPatchImpulses.test_cases():
+            suite.addTest(unittest.makeSuite(test))
+
+        import TestReciprocal
+        for test in TestReciprocal.test_cases():
+            suite.addTest(unittest.makeSuite(test))
+
         return suite
 
 
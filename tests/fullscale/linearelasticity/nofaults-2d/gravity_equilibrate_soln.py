@@ -0,0 +1,62 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file tests/fullscale/linearelasticity/nofaults-2d/gravity_equilibrate_soln.py
+#
+# @brief Analytical solution to gravitational body forces with equilibrated reference state.
+#
+# The materials start with a zero reference state. Equilibrating the reference state
+# sets the reference stress to the stress of the gravity test (no initial stress), so
+# time stepping gives zero displacement and zero strain with the same stress.
+#
+#       ----------
+#       |        |
+# Ux=0  |        | Ux=0
+#       |        |
+#       |        |
+#       ----------
+#         Uy=0
+#
+# Dirichlet boundary conditions
+# Ux(+-4000,0) = 0
+# Uy(x,-4000) = 0
+
+import numpy
+
+import gravity_soln
+
+
+# ----------------------------------------------------------------------
+class AnalyticalSoln(gravity_soln.AnalyticalSoln):
+    """Analytical solution to gravitational body forces with equilibrated reference state.
+    """
+
+    def __init__(self):
+        gravity_soln.AnalyticalSoln.__init__(self)
+        self.fields.update({
+            "displacement": self.zero_vector,
+            "cauchy_strain": self.zero_tensor,
+            "cauchy_stress": self.stress,
+            "reference_stress": self.zero_tensor,
+            "reference_strain": self.zero_tensor,
+        })
+        return
+
+    def zero_tensor(self, locs):
+        (npts, dim) = locs.shape
+        return numpy.zeros((1, npts, self.TENSOR_SIZE), dtype=numpy.float64)
+
+
+# End of file
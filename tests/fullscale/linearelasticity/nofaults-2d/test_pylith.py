@@ -55,6 +55,10 @@ class TestApp(TestDriver):
         for test in TestGravityRefState.test_cases():
             suite.addTest(unittest.makeSuite(test))
 
+        import TestGravityEquilibrate
+        for test in TestGravityEquilibrate.test_cases():
+            suite.addTest(unittest.makeSuite(test))
+
         return suite
 
 
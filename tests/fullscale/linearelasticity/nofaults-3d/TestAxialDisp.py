@@ -21,7 +21,7 @@
 
 import unittest
 
-from pylith.testing.FullTestApp import (FullTestCase, Check, check_data)
+from pylith.testing.FullTestApp import (FullTestCase, Check, check_data, check_same_output)
 
 import meshes
 import axialdisp_soln
@@ -68,8 +68,8 @@ class TestCase(FullTestCase):
             ),
         ]
 
-    def run_pylith(self, testName, args):
-        FullTestCase.run_pylith(self, testName, args, axialdisp_gendb.GenerateDB)
+    def run_pylith(self, testName, args, nprocs=1):
+        FullTestCase.run_pylith(self, testName, args, axialdisp_gendb.GenerateDB, nprocs)
 
 
 # -------------------------------------------------------------------------------------------------
@@ -96,11 +96,79 @@ class TestTet(TestCase):
         return
 
 
+# -------------------------------------------------------------------------------------------------
+class TestParallelRead(TestCase):
+    """Read the Exodus II file in parallel on 2 processes. The output must match the serial read.
+    """
+
+    def run_parallel_read(self, cell):
+        nameSerial = f"axialdisp_{cell}"
+        TestCase.run_pylith(self, nameSerial, ["axialdisp.cfg", f"axialdisp_{cell}.cfg"])
+
+        args = [
+            "axialdisp.cfg",
+            f"axialdisp_{cell}.cfg",
+            "--mesh_generator.reader.use_parallel_read=True",
+            f"--problem.defaults.name={self.name}",
+            f"--dump_parameters.filename=output/{self.name}-parameters.json",
+            f"--problem.progress_monitor.filename=output/{self.name}-progress.txt",
+        ]
+        TestCase.run_pylith(self, self.name, args, nprocs=2)
+        self.nameSerial = nameSerial
+        self.cell = cell
+
+    def test_parameter_sources(self):
+        """Settings from parameter files broadcast from the root process must keep their file and line.
+        """
+        import json
+        with open(f"output/{self.name}-parameters.json", "r") as fin:
+            parameters = json.load(fin)
+        reader = parameters["application"]["components"]["mesh_generator"]["components"]["reader"]
+        setFrom = reader["properties"]["filename"]["setFrom"]
+        self.assertIn(f"axialdisp_{self.cell}.cfg", setFrom)
+
+    def test_same_output(self):
+        for mesh_entity in ["domain", "groundsurf", "bc_xpos"]:
+            with self.subTest(mesh_entity=mesh_entity):
+                check_same_output(self, f"output/{self.name}-{mesh_entity}.h5",
+                                  f"output/{self.nameSerial}-{mesh_entity}.h5", vertex_fields=["displacement"])
+        for material in ["upper_crust", "lower_crust"]:
+            with self.subTest(mesh_entity=material):
+                check_same_output(self, f"output/{self.name}-{material}.h5", f"output/{self.nameSerial}-{material}.h5",
+                                  cell_fields=["cauchy_strain", "cauchy_stress"])
+
+
+# -------------------------------------------------------------------------------------------------
+class TestHexParallelRead(TestParallelRead):
+
+    def setUp(self):
+        self.name = "axialdisp_hex_parallelread"
+        self.mesh = meshes.Hex()
+        super().setUp()
+
+        self.run_parallel_read("hex")
+        return
+
+
+# -------------------------------------------------------------------------------------------------
+class TestTetParallelRead(TestParallelRead):
+
+    def setUp(self):
+        self.name = "axialdisp_tet_parallelread"
+        self.mesh = meshes.Tet()
+        super().setUp()
+
+        self.run_parallel_read("tet")
+        return
+
+
 # -------------------------------------------------------------------------------------------------
 def test_cases():
     return [
         TestHex,
         TestTet,
+        TestHexParallelRead,
+        TestTetParallelRead,
     ]
 
 
@@ -24,7 +24,7 @@
 
 import unittest
 
-from pylith.testing.FullTestApp import (FullTestCase, Check, check_data)
+from pylith.testing.FullTestApp import (FullTestCase, Check, check_data, check_same_output)
 
 import meshes
 import terzaghi_soln
@@ -127,11 +127,43 @@ class TestTri(TestCase):
         TestCase.run_pylith(self, self.name, ["terzaghi.cfg", "terzaghi_tri.cfg"])
 
 
+# -------------------------------------------------------------------------------------------------
+class TestTriBlock(TestCase):
+
+    def setUp(self):
+        self.name = "terzaghi_tri_block"
+        self.mesh = meshes.Tri()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name, ["terzaghi.cfg", "terzaghi_tri.cfg", "terzaghi_tri_block.cfg"])
+
+
+# -------------------------------------------------------------------------------------------------
+class TestQuadFixedStress(TestCase):
+    """Solve using the fixed-stress split. The solution must match the one using the default preconditioner.
+    """
+
+    def setUp(self):
+        self.name = "terzaghi_quad_fixedstress"
+        self.name_monolithic = "terzaghi_quad"
+        self.mesh = meshes.Quad()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name_monolithic, ["terzaghi.cfg", "terzaghi_quad.cfg"])
+        TestCase.run_pylith(self, self.name, ["terzaghi.cfg", "terzaghi_quad.cfg", "terzaghi_quad_fixedstress.cfg"])
+
+    def test_same_output(self):
+        check_same_output(self, f"output/{self.name}-domain.h5", f"output/{self.name_monolithic}-domain.h5",
+                          vertex_fields=["displacement", "pressure"])
+
+
 # -------------------------------------------------------------------------------------------------
 def test_cases():
     return [
         TestQuad,
         TestTri,
+        TestTriBlock,
+        TestQuadFixedStress,
     ]
 
 
@@ -0,0 +1,123 @@
+#!/usr/bin/env nemesis
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file tests/fullscale/viscoelasticity/nofaults-2d/TestCheckpointRestart.py
+#
+# @brief Test suite for restarting from a checkpoint with a Maxwell material and 2-D axial extension (Neumann BC).
+#
+# We run the problem without interruption, run the first half of the problem writing a checkpoint, and restart
+# from the checkpoint using 1 and 2 processes. The output of the restarted runs must match the uninterrupted run.
+
+import unittest
+
+from pylith.testing.FullTestApp import (FullTestCase, check_same_output)
+
+import axialtraction_maxwell_gendb
+
+
+# -------------------------------------------------------------------------------------------------
+def _run_args(name, extra=[]):
+    """Command line arguments for a run of the checkpoint/restart problem.
+    """
+    args = [
+        "axialtraction_maxwell.cfg",
+        "axialtraction_maxwell_checkpoint.cfg",
+        f"--problem.defaults.name={name}",
+        f"--dump_parameters.filename=output/{name}-parameters.json",
+        f"--problem.progress_monitor.filename=output/{name}-progress.txt",
+    ]
+    return args + extra
+
+
+# -------------------------------------------------------------------------------------------------
+class TestCase(FullTestCase):
+
+    NAME_FULL = "axialtraction_maxwell_checkpoint_full"
+    NAME_FIRST = "axialtraction_maxwell_checkpoint_first"
+    CHECKPOINT = f"output/{NAME_FIRST}-checkpoint.h5"
+
+    def setUp(self):
+        # Uninterrupted run over the entire time period.
+        self.run_pylith(self.NAME_FULL, _run_args(self.NAME_FULL))
+
+        # First half of the time period (20 time steps), writing a checkpoint every 10 time steps.
+        self.run_pylith(self.NAME_FIRST, _run_args(self.NAME_FIRST, [
+            "--problem.end_time=0.5*year",
+            "--problem.checkpoint_interval=10",
+        ]))
+
+        # Restart from the checkpoint and finish the time period.
+        self.run_pylith(self.name, _run_args(self.name, [
+            f"--problem.restart_filename={self.CHECKPOINT}",
+        ]), nprocs=self.nprocs)
+        return
+
+    def run_pylith(self, testName, args, nprocs=1):
+        FullTestCase.run_pylith(self, testName, args, axialtraction_maxwell_gendb.GenerateDB, nprocs)
+
+    def test_domain(self):
+        check_same_output(self, f"output/{self.name}-domain.h5", f"output/{self.NAME_FULL}-domain.h5",
+                          vertex_fields=["displacement"])
+
+    def test_material(self):
+        check_same_output(self, f"output/{self.name}-viscomat.h5", f"output/{self.NAME_FULL}-viscomat.h5",
+                          vertex_fields=["displacement", "cauchy_strain", "cauchy_stress", "viscous_strain"])
+
+    def test_boundary(self):
+        check_same_output(self, f"output/{self.name}-bc_xpos.h5", f"output/{self.NAME_FULL}-bc_xpos.h5",
+                          vertex_fields=["displacement"])
+
+
+# -------------------------------------------------------------------------------------------------
+class TestSerial(TestCase):
+
+    def setUp(self):
+        self.name = "axialtraction_maxwell_checkpoint_restart"
+        self.nprocs = 1
+        super().setUp()
+
+
+# -------------------------------------------------------------------------------------------------
+class TestParallel(TestCase):
+    """Restart on a different number of processes than the run that wrote the checkpoint.
+    """
+
+    def setUp(self):
+        self.name = "axialtraction_maxwell_checkpoint_restart_np2"
+        self.nprocs = 2
+        super().setUp()
+
+
+# -------------------------------------------------------------------------------------------------
+def test_cases():
+    return [
+        TestSerial,
+        TestParallel,
+    ]
+
+
+# -------------------------------------------------------------------------------------------------
+if __name__ == '__main__':
+    FullTestCase.parse_args()
+
+    suite = unittest.TestSuite()
+    for test in test_cases():
+        suite.addTest(unittest.makeSuite(test))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
@@ -0,0 +1,97 @@
+#!/usr/bin/env nemesis
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file tests/fullscale/viscoelasticity/nofaults-2d/TestParallelInTime.py
+#
+# @brief Test suite for parareal iteration with a Maxwell material and 2-D axial extension (Neumann BC).
+#
+# We run the problem sequentially and with parareal iteration using two time slices of one process each. With two
+# time slices, one iteration gives the sequential solution, so the output of each time slice must match the output
+# of the sequential run at the same time steps.
+
+import unittest
+
+from pylith.testing.FullTestApp import (FullTestCase, check_same_output)
+from pylith.apps.ParallelInTimeApp import ParallelInTimeApp
+
+import axialtraction_maxwell_gendb
+
+
+# -------------------------------------------------------------------------------------------------
+def _run_args(name, extra=[]):
+    """Command line arguments for a run of the parareal problem.
+    """
+    args = [
+        "axialtraction_maxwell.cfg",
+        "axialtraction_maxwell_parareal.cfg",
+        f"--problem.defaults.name={name}",
+        f"--dump_parameters.filename=output/{name}-parameters.json",
+        f"--problem.progress_monitor.filename=output/{name}-progress.txt",
+    ]
+    return args + extra
+
+
+# -------------------------------------------------------------------------------------------------
+class TestCase(FullTestCase):
+
+    NAME_SEQUENTIAL = "axialtraction_maxwell_parareal_sequential"
+    NAME = "axialtraction_maxwell_parareal"
+    NUM_SLICES = 2
+
+    def setUp(self):
+        self.name = self.NAME
+        FullTestCase.run_pylith(self, self.NAME_SEQUENTIAL, _run_args(self.NAME_SEQUENTIAL),
+                                axialtraction_maxwell_gendb.GenerateDB)
+        FullTestCase.run_pylith(self, self.NAME, _run_args(self.NAME, [
+            "--group_size=1",
+            "--coarse_dt=0.25*year",
+            "--tolerance=1.0e-10",
+        ]), axialtraction_maxwell_gendb.GenerateDB, nprocs=self.NUM_SLICES, appClass=ParallelInTimeApp)
+        return
+
+    def test_domain(self):
+        for slice in range(self.NUM_SLICES):
+            with self.subTest(slice=slice):
+                check_same_output(self, f"output/{self.NAME}-slice{slice}-domain.h5",
+                                  f"output/{self.NAME_SEQUENTIAL}-domain.h5", vertex_fields=["displacement"])
+
+    def test_material(self):
+        for slice in range(self.NUM_SLICES):
+            with self.subTest(slice=slice):
+                check_same_output(self, f"output/{self.NAME}-slice{slice}-viscomat.h5",
+                                  f"output/{self.NAME_SEQUENTIAL}-viscomat.h5",
+                                  vertex_fields=["displacement", "cauchy_strain", "cauchy_stress", "viscous_strain"])
+
+
+# -------------------------------------------------------------------------------------------------
+def test_cases():
+    return [
+        TestCase,
+    ]
+
+
+# -------------------------------------------------------------------------------------------------
+if __name__ == '__main__':
+    FullTestCase.parse_args()
+
+    suite = unittest.TestSuite()
+    for test in test_cases():
+        suite.addTest(unittest.makeSuite(test))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
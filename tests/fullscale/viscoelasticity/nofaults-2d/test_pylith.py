@@ -46,6 +46,14 @@ class TestApp(TestDriver):
         for test in TestAxialStrainGenMaxwell.test_cases():
             suite.addTest(unittest.makeSuite(test))
 
+        import TestCheckpointRestart
+        for test in TestCheckpointRestart.test_cases():
+            suite.addTest(unittest.makeSuite(test))
+
+        import TestParallelInTime
+        for test in TestParallelInTime.test_cases():
+            suite.addTest(unittest.makeSuite(test))
+
         return suite
 
 
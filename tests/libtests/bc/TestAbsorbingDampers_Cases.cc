@@ -46,6 +46,10 @@ namespace pylith {
                 return "Pa";
             } // pressure_units
 
+            static const char* impedance_units(void) {
+                return "kg/(m**2*s)";
+            } // impedance_units
+
             /// Spatial database user functions for auxiliary subfields.
 
             static double density(const double x,
@@ -63,6 +67,16 @@ namespace pylith {
                 return vs(x,y)*sqrt(3.0);
             } // vp
 
+            static double p_wave_impedance(const double x,
+                                           const double y) {
+                return density(x,y)*vp(x,y);
+            } // p_wave_impedance
+
+            static double s_wave_impedance(const double x,
+                                           const double y) {
+                return density(x,y)*vs(x,y);
+            } // s_wave_impedance
+
             // Solution field at time t.
 
             static double disp_x(const double x,
@@ -112,17 +126,15 @@ protected:
                 _data->field = "velocity";
                 _data->vectorFieldType = pylith::topology::Field::VECTOR;
 
-                _data->numAuxSubfields = 3;
-                static const char* auxSubfields[3] = {
-                    "density",
-                    "vp",
-                    "vs",
+                _data->numAuxSubfields = 2;
+                static const char* auxSubfields[2] = {
+                    "p_wave_impedance",
+                    "s_wave_impedance",
                 };
                 _data->auxSubfields = const_cast<const char**>(auxSubfields);
-                static const pylith::topology::Field::Discretization auxDiscretizations[3] = {
-                    pylith::topology::Field::Discretization(0, 1), // density
-                    pylith::topology::Field::Discretization(0, 1), // vp
-                    pylith::topology::Field::Discretization(0, 1), // vs
+                static const pylith::topology::Field::Discretization auxDiscretizations[2] = {
+                    pylith::topology::Field::Discretization(0, 1), // p_wave_impedance
+                    pylith::topology::Field::Discretization(0, 1), // s_wave_impedance
                 };
                 _data->auxDiscretizations = const_cast<pylith::topology::Field::Discretization*>(auxDiscretizations);
 
@@ -131,6 +143,9 @@ protected:
                 _data->auxDB->addValue("density", density, density_units());
                 _data->auxDB->addValue("vp", vp, vel_units());
                 _data->auxDB->addValue("vs", vs, vel_units());
+                // Impedances for checking values of auxiliary subfields computed from density and wave speeds.
+                _data->auxDB->addValue("p_wave_impedance", p_wave_impedance, impedance_units());
+                _data->auxDB->addValue("s_wave_impedance", s_wave_impedance, impedance_units());
 
                 _data->t = 1.23;
                 _data->solnNumSubfields = 3;
@@ -37,6 +37,8 @@
 #include "catch2/matchers/catch_matchers_exception.hpp"
 
 #include <stdexcept>
+#include <fstream> // USES std::ifstream
+#include <cstdio> // USES std::remove()
 
 namespace pylith {
     namespace feassemble {
@@ -66,8 +68,41 @@ public:
     /// Test setValuesFromDB().
     void testSetValuesFromDB(void);
 
+    /// Test setCache() and getCacheFilename().
+    void testCache(void);
+
+    /// Test setValuesFromDB() with cache.
+    void testSetValuesFromCache(void);
+
 private:
 
+    /** Set values of auxiliary field with density and velocity subfields using spatial database and cache.
+     *
+     * @param[inout] field Auxiliary field.
+     * @param[in] db Spatial database with auxiliary field values.
+     * @param[in] normalizer Scales for nondimensionalization.
+     * @param[in] cacheFilename Name of cache file.
+     * @param[in] dbKey Key identifying spatial database.
+     */
+    static
+    void _setValues(pylith::topology::Field* field,
+                    spatialdata::spatialdb::SpatialDB* db,
+                    const spatialdata::units::Nondimensional& normalizer,
+                    const char* cacheFilename,
+                    const char* dbKey);
+
+    /** Compute norm of difference between field and values in spatial database.
+     *
+     * @param[in] field Auxiliary field.
+     * @param[in] db Spatial database with auxiliary field values.
+     * @param[in] normalizer Scales for nondimensionalization.
+     * @returns L2 norm of difference.
+     */
+    static
+    PylithReal _computeDiffNorm(const pylith::topology::Field& field,
+                                spatialdata::spatialdb::SpatialDB* db,
+                                const spatialdata::units::Nondimensional& normalizer);
+
     pylith::feassemble::AuxiliaryFactory* _factory; ///< Test subject.
 
 public:
@@ -95,6 +130,16 @@ public:
         return "m/s";
     } // velocity_units
 
+    static double density_uniform(const double x,
+                                  const double y) {
+        return 2500.0;
+    } // density_uniform
+
+    static double velocity_uniform(const double x,
+                                   const double y) {
+        return 0.2;
+    } // velocity_uniform
+
 }; // class TestAuxiliaryFactory
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -313,6 +358,156 @@ pylith::feassemble::TestAuxiliaryFactory::testSetValuesFromDB(void) {
 } // testSetValuesFromDB
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Test setCache() and getCacheFilename().
+void
+pylith::feassemble::TestAuxiliaryFactory::testCache(void) {
+    assert(_factory);
+    CHECK(std::string("") == _factory->getCacheFilename());
+
+    _factory->setCache("auxfactory_cache.h5", "db-key");
+    CHECK(std::string("auxfactory_cache.h5") == _factory->getCacheFilename());
+    CHECK(std::string("db-key") == _factory->_cacheDBKey);
+
+    _factory->setCache(NULL, NULL);
+    CHECK(std::string("") == _factory->getCacheFilename());
+    CHECK(std::string("") == _factory->_cacheDBKey);
+} // testCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test setValuesFromDB() with cache.
+void
+pylith::feassemble::TestAuxiliaryFactory::testSetValuesFromCache(void) {
+    const int spaceDim = 2;
+    spatialdata::units::Nondimensional normalizer;
+    normalizer.setLengthScale(10.0);
+    normalizer.setDensityScale(2.0);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+
+    spatialdata::spatialdb::UserFunctionDB dbA;
+    dbA.addValue("density", TestAuxiliaryFactory::density, TestAuxiliaryFactory::density_units());
+    dbA.addValue("velocity_x", TestAuxiliaryFactory::velocity_x, TestAuxiliaryFactory::velocity_units());
+    dbA.addValue("velocity_y", TestAuxiliaryFactory::velocity_y, TestAuxiliaryFactory::velocity_units());
+    dbA.setCoordSys(cs);
+
+    spatialdata::spatialdb::UserFunctionDB dbB;
+    dbB.addValue("density", TestAuxiliaryFactory::density_uniform, TestAuxiliaryFactory::density_units());
+    dbB.addValue("velocity_x", TestAuxiliaryFactory::velocity_uniform, TestAuxiliaryFactory::velocity_units());
+    dbB.addValue("velocity_y", TestAuxiliaryFactory::velocity_uniform, TestAuxiliaryFactory::velocity_units());
+    dbB.setCoordSys(cs);
+
+    pylith::topology::Mesh mesh;
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri.mesh");
+    iohandler.read(&mesh);
+    mesh.setCoordSys(&cs);
+    pylith::topology::MeshOps::nondimensionalize(&mesh, normalizer);
+
+    const char* cacheFilename = "auxfactory_cache.h5";
+    std::remove(cacheFilename);
+    const PylithReal tolerance = 1.0e-6;
+
+    { // Cache does not exist, so query database A and write cache.
+        pylith::topology::Field field(mesh);
+        _setValues(&field, &dbA, normalizer, cacheFilename, "db-A");
+        std::ifstream fin(cacheFilename);
+        CHECK(fin.good());
+        CHECK_THAT(_computeDiffNorm(field, &dbA, normalizer), Catch::Matchers::WithinAbs(0.0, tolerance));
+    } // Query database A
+
+    { // Key matches, so values come from cache (database A) and database B is not queried.
+        pylith::topology::Field field(mesh);
+        _setValues(&field, &dbB, normalizer, cacheFilename, "db-A");
+        CHECK_THAT(_computeDiffNorm(field, &dbA, normalizer), Catch::Matchers::WithinAbs(0.0, tolerance));
+    } // Read cache
+
+    { // Key differs, so query database B and rewrite cache.
+        pylith::topology::Field field(mesh);
+        _setValues(&field, &dbB, normalizer, cacheFilename, "db-B");
+        CHECK_THAT(_computeDiffNorm(field, &dbB, normalizer), Catch::Matchers::WithinAbs(0.0, tolerance));
+    } // Query database B
+
+    { // Scales differ, so key differs and database A is queried.
+        spatialdata::units::Nondimensional normalizerOther;
+        normalizerOther.setLengthScale(normalizer.getLengthScale());
+        normalizerOther.setDensityScale(4.0);
+
+        pylith::topology::Field field(mesh);
+        _setValues(&field, &dbA, normalizerOther, cacheFilename, "db-B");
+        CHECK_THAT(_computeDiffNorm(field, &dbA, normalizerOther), Catch::Matchers::WithinAbs(0.0, tolerance));
+    } // Query database A with different scales
+} // testSetValuesFromCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set values of auxiliary field with density and velocity subfields using spatial database and cache.
+void
+pylith::feassemble::TestAuxiliaryFactory::_setValues(pylith::topology::Field* field,
+                                                     spatialdata::spatialdb::SpatialDB* db,
+                                                     const spatialdata::units::Nondimensional& normalizer,
+                                                     const char* cacheFilename,
+                                                     const char* dbKey) {
+    assert(field);
+
+    pylith::topology::Field::Description descriptionDensity;
+    descriptionDensity.label = "density";
+    descriptionDensity.alias = "density";
+    descriptionDensity.vectorFieldType = pylith::topology::Field::SCALAR;
+    descriptionDensity.numComponents = 1;
+    descriptionDensity.componentNames.resize(1);
+    descriptionDensity.componentNames[0] = "density";
+    descriptionDensity.scale = normalizer.getDensityScale();
+
+    pylith::topology::Field::Description descriptionVelocity;
+    descriptionVelocity.label = "velocity";
+    descriptionVelocity.alias = "velocity";
+    descriptionVelocity.vectorFieldType = pylith::topology::Field::VECTOR;
+    descriptionVelocity.numComponents = 2;
+    descriptionVelocity.componentNames.resize(2);
+    descriptionVelocity.componentNames[0] = "velocity_x";
+    descriptionVelocity.componentNames[1] = "velocity_y";
+    descriptionVelocity.scale = normalizer.getLengthScale() / normalizer.getTimeScale();
+
+    const int spaceDim = 2;
+    AuxiliaryFactory factory;
+    factory.setQueryDB(db);
+    factory.setCache(cacheFilename, dbKey);
+    factory.initialize(field, normalizer, spaceDim);
+    field->subfieldAdd(descriptionDensity, pylith::topology::Field::Discretization(1, 2));
+    factory.setSubfieldQuery("density");
+    field->subfieldAdd(descriptionVelocity, pylith::topology::Field::Discretization(2, 2));
+    factory.setSubfieldQuery("velocity");
+    field->subfieldsSetup();
+    field->createDiscretization();
+    field->allocate();
+
+    factory.setValuesFromDB();
+} // _setValues
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute norm of difference between field and values in spatial database.
+PylithReal
+pylith::feassemble::TestAuxiliaryFactory::_computeDiffNorm(const pylith::topology::Field& field,
+                                                           spatialdata::spatialdb::SpatialDB* db,
+                                                           const spatialdata::units::Nondimensional& normalizer) {
+    PylithReal norm = 0.0;
+    PylithReal t = 0.0;
+    const PetscDM dmField = field.getDM();assert(dmField);
+    pylith::topology::FieldQuery query(field);
+    query.initializeWithDefaultQueries();
+    query.openDB(db, normalizer.getLengthScale());
+    PetscErrorCode err = DMPlexComputeL2DiffLocal(dmField, t, query._functions, (void**)query._contextPtrs,
+                                                  field.getLocalVector(), &norm);assert(!err);
+    query.closeDB(db);
+
+    return norm;
+} // _computeDiffNorm
+
+
 // ------------------------------------------------------------------------------------------------
 TEST_CASE("TestAuxiliaryFactory::testQueryDB", "[TestAuxiliaryFactory]") {
     pylith::feassemble::TestAuxiliaryFactory().testQueryDB();
@@ -326,5 +521,11 @@ TEST_CASE("TestAuxiliaryFactory::testInitialize", "[TestAuxiliaryFactory]") {
 TEST_CASE("TestAuxiliaryFactory::testSetValuesFromDB", "[TestAuxiliaryFactory]") {
     pylith::feassemble::TestAuxiliaryFactory().testSetValuesFromDB();
 }
+TEST_CASE("TestAuxiliaryFactory::testCache", "[TestAuxiliaryFactory]") {
+    pylith::feassemble::TestAuxiliaryFactory().testCache();
+}
+TEST_CASE("TestAuxiliaryFactory::testSetValuesFromCache", "[TestAuxiliaryFactory]") {
+    pylith::feassemble::TestAuxiliaryFactory().testSetValuesFromCache();
+}
 
 // End of file
@@ -0,0 +1,399 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/fekernels/IsotropicLinearElasticity.hh" // Test subject
+
+#include "pylith/fekernels/Elasticity.hh" // USES Elasticity
+#include "pylith/fekernels/Tensor.hh" // USES Tensor
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <petscds.h> // USES PetscPointFunc
+
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+    namespace fekernels {
+        class TestIsotropicLinearElasticityKernels;
+    } // fekernels
+} // pylith
+
+class pylith::fekernels::TestIsotropicLinearElasticityKernels {
+public:
+
+    /// Test IsotropicLinearElasticityDim<2>::f1v_infinitesimalStrain() matches Tensor kernels.
+    void testF1vPlaneStrain(void);
+
+    /// Test IsotropicLinearElasticityDim<3>::f1v_infinitesimalStrain() matches Tensor kernels.
+    void testF1v3D(void);
+
+    /// Test IsotropicLinearElasticityDim<2>::f1v_infinitesimalStrain_refState() matches Tensor kernels.
+    void testF1vRefStatePlaneStrain(void);
+
+    /// Test IsotropicLinearElasticityDim<3>::f1v_infinitesimalStrain_refState() matches Tensor kernels.
+    void testF1vRefState3D(void);
+
+    /// Test IsotropicLinearElasticityDim<2>::Jf3vu_infinitesimalStrain() matches explicit elastic constants.
+    void testJf3vuPlaneStrain(void);
+
+    /// Test IsotropicLinearElasticityDim<3>::Jf3vu_infinitesimalStrain() matches explicit elastic constants.
+    void testJf3vu3D(void);
+
+private:
+
+    /// Pointwise solution and auxiliary fields for kernels.
+    struct Fields {
+        std::vector<PylithInt> sOff;
+        std::vector<PylithInt> sOff_x;
+        std::vector<PylithScalar> s;
+        std::vector<PylithScalar> s_t;
+        std::vector<PylithScalar> s_x;
+        std::vector<PylithInt> aOff;
+        std::vector<PylithInt> aOff_x;
+        std::vector<PylithScalar> a;
+        std::vector<PylithScalar> x;
+    };
+
+    /** Create solution field (displacement) and auxiliary fields (density, [refstress, refstrain,] shear modulus,
+     * bulk modulus).
+     *
+     * @param[in] dim Spatial dimension.
+     * @param[in] refState True to include reference stress and reference strain.
+     * @returns Pointwise fields.
+     */
+    static
+    Fields _createFields(const PylithInt dim,
+                         const bool refState);
+
+    /** Compute f1 using Elasticity::f1v() with Tensor strain and stress functions.
+     *
+     * @param[in] fields Pointwise fields.
+     * @param[in] dim Spatial dimension.
+     * @param[in] refState True to include reference stress and reference strain.
+     * @param[inout] f1 Residual [dim*dim].
+     */
+    static
+    void _f1vTensor(const Fields& fields,
+                    const PylithInt dim,
+                    const bool refState,
+                    PylithScalar f1[]);
+
+    /** Check f1 from templated kernel against f1 from Tensor kernels.
+     *
+     * @param[in] dim Spatial dimension.
+     * @param[in] refState True to include reference stress and reference strain.
+     */
+    static
+    void _checkF1v(const PylithInt dim,
+                   const bool refState);
+
+}; // class TestIsotropicLinearElasticityKernels
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestIsotropicLinearElasticityKernels::testF1vPlaneStrain", "[TestIsotropicLinearElasticityKernels]") {
+    pylith::fekernels::TestIsotropicLinearElasticityKernels().testF1vPlaneStrain();
+}
+TEST_CASE("TestIsotropicLinearElasticityKernels::testF1v3D", "[TestIsotropicLinearElasticityKernels]") {
+    pylith::fekernels::TestIsotropicLinearElasticityKernels().testF1v3D();
+}
+TEST_CASE("TestIsotropicLinearElasticityKernels::testF1vRefStatePlaneStrain", "[TestIsotropicLinearElasticityKernels]") {
+    pylith::fekernels::TestIsotropicLinearElasticityKernels().testF1vRefStatePlaneStrain();
+}
+TEST_CASE("TestIsotropicLinearElasticityKernels::testF1vRefState3D", "[TestIsotropicLinearElasticityKernels]") {
+    pylith::fekernels::TestIsotropicLinearElasticityKernels().testF1vRefState3D();
+}
+TEST_CASE("TestIsotropicLinearElasticityKernels::testJf3vuPlaneStrain", "[TestIsotropicLinearElasticityKernels]") {
+    pylith::fekernels::TestIsotropicLinearElasticityKernels().testJf3vuPlaneStrain();
+}
+TEST_CASE("TestIsotropicLinearElasticityKernels::testJf3vu3D", "[TestIsotropicLinearElasticityKernels]") {
+    pylith::fekernels::TestIsotropicLinearElasticityKernels().testJf3vu3D();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test IsotropicLinearElasticityDim<2>::f1v_infinitesimalStrain() matches Tensor kernels.
+void
+pylith::fekernels::TestIsotropicLinearElasticityKernels::testF1vPlaneStrain(void) {
+    _checkF1v(2, false);
+} // testF1vPlaneStrain
+
+
+// ------------------------------------------------------------------------------------------------
+// Test IsotropicLinearElasticityDim<3>::f1v_infinitesimalStrain() matches Tensor kernels.
+void
+pylith::fekernels::TestIsotropicLinearElasticityKernels::testF1v3D(void) {
+    _checkF1v(3, false);
+} // testF1v3D
+
+
+// ------------------------------------------------------------------------------------------------
+// Test IsotropicLinearElasticityDim<2>::f1v_infinitesimalStrain_refState() matches Tensor kernels.
+void
+pylith::fekernels::TestIsotropicLinearElasticityKernels::testF1vRefStatePlaneStrain(void) {
+    _checkF1v(2, true);
+} // testF1vRefStatePlaneStrain
+
+
+// ------------------------------------------------------------------------------------------------
+// Test IsotropicLinearElasticityDim<3>::f1v_infinitesimalStrain_refState() matches Tensor kernels.
+void
+pylith::fekernels::TestIsotropicLinearElasticityKernels::testF1vRefState3D(void) {
+    _checkF1v(3, true);
+} // testF1vRefState3D
+
+
+// ------------------------------------------------------------------------------------------------
+// Test IsotropicLinearElasticityDim<2>::Jf3vu_infinitesimalStrain() matches explicit elastic constants.
+void
+pylith::fekernels::TestIsotropicLinearElasticityKernels::testJf3vuPlaneStrain(void) {
+    const PylithInt dim = 2;
+    const Fields fields = _createFields(dim, false);
+    const PylithInt numS = fields.sOff.size();
+    const PylithInt numA = fields.aOff.size();
+
+    const PylithReal shearModulus = fields.a[fields.aOff[numA-2]];
+    const PylithReal bulkModulus = fields.a[fields.aOff[numA-1]];
+    const PylithReal lambda = bulkModulus - 2.0/3.0*shearModulus;
+    const PylithReal C1111 = lambda + 2.0*shearModulus;
+    const PylithReal C2222 = C1111;
+    const PylithReal C1122 = lambda;
+    const PylithReal C1212 = shearModulus;
+
+    // Kernel accumulates into Jf3, so start from nonzero values.
+    const size_t size = 16;
+    PylithScalar Jf3[size];
+    PylithScalar Jf3E[size];
+    for (size_t i = 0; i < size; ++i) {
+        Jf3[i] = Jf3E[i] = 0.1 * i;
+    } // for
+    Jf3E[ 0] -= C1111; // j0000
+    Jf3E[ 3] -= C1212; // j0011
+    Jf3E[ 5] -= C1122; // j0101
+    Jf3E[ 6] -= C1212; // j0110, C1221
+    Jf3E[ 9] -= C1212; // j1001, C2112
+    Jf3E[10] -= C1122; // j1010, C2211
+    Jf3E[12] -= C1212; // j1100, C2121
+    Jf3E[15] -= C2222; // j1111
+
+    const PylithReal t = 0.0;
+    const PylithReal s_tshift = 0.0;
+    IsotropicLinearElasticityDim<2>::Jf3vu_infinitesimalStrain(
+        dim, numS, numA, &fields.sOff[0], &fields.sOff_x[0], &fields.s[0], &fields.s_t[0], &fields.s_x[0],
+        &fields.aOff[0], &fields.aOff_x[0], &fields.a[0], NULL, NULL, t, s_tshift, &fields.x[0], 0, NULL, Jf3);
+
+    const PylithReal tolerance = 1.0e-14 * bulkModulus;
+    for (size_t i = 0; i < size; ++i) {
+        INFO("Jf3[" << i << "]");
+        CHECK_THAT(Jf3[i], Catch::Matchers::WithinAbs(Jf3E[i], tolerance));
+    } // for
+} // testJf3vuPlaneStrain
+
+
+// ------------------------------------------------------------------------------------------------
+// Test IsotropicLinearElasticityDim<3>::Jf3vu_infinitesimalStrain() matches explicit elastic constants.
+void
+pylith::fekernels::TestIsotropicLinearElasticityKernels::testJf3vu3D(void) {
+    const PylithInt dim = 3;
+    const Fields fields = _createFields(dim, false);
+    const PylithInt numS = fields.sOff.size();
+    const PylithInt numA = fields.aOff.size();
+
+    const PylithReal shearModulus = fields.a[fields.aOff[numA-2]];
+    const PylithReal bulkModulus = fields.a[fields.aOff[numA-1]];
+    const PylithReal lambda = bulkModulus - 2.0/3.0*shearModulus;
+    const PylithReal C1111 = lambda + 2.0*shearModulus;
+    const PylithReal C1122 = lambda;
+    const PylithReal C1212 = shearModulus;
+
+    // Kernel accumulates into Jf3, so start from nonzero values.
+    const size_t size = 81;
+    PylithScalar Jf3[size];
+    PylithScalar Jf3E[size];
+    for (size_t i = 0; i < size; ++i) {
+        Jf3[i] = Jf3E[i] = 0.1 * i;
+    } // for
+    Jf3E[ 0] -= C1111; // j0000
+    Jf3E[ 4] -= C1212; // j0011
+    Jf3E[ 8] -= C1212; // j0022
+    Jf3E[10] -= C1122; // j0101
+    Jf3E[12] -= C1212; // j0110
+    Jf3E[20] -= C1122; // j0202
+    Jf3E[24] -= C1212; // j0220
+    Jf3E[28] -= C1212; // j1001
+    Jf3E[30] -= C1122; // j1010
+    Jf3E[36] -= C1212; // j1100
+    Jf3E[40] -= C1111; // j1111
+    Jf3E[44] -= C1212; // j1122
+    Jf3E[50] -= C1122; // j1212
+    Jf3E[52] -= C1212; // j1221
+    Jf3E[56] -= C1212; // j2002
+    Jf3E[60] -= C1122; // j2020
+    Jf3E[68] -= C1212; // j2112
+    Jf3E[70] -= C1122; // j2121
+    Jf3E[72] -= C1212; // j2200
+    Jf3E[76] -= C1212; // j2211
+    Jf3E[80] -= C1111; // j2222
+
+    const PylithReal t = 0.0;
+    const PylithReal s_tshift = 0.0;
+    IsotropicLinearElasticityDim<3>::Jf3vu_infinitesimalStrain(
+        dim, numS, numA, &fields.sOff[0], &fields.sOff_x[0], &fields.s[0], &fields.s_t[0], &fields.s_x[0],
+        &fields.aOff[0], &fields.aOff_x[0], &fields.a[0], NULL, NULL, t, s_tshift, &fields.x[0], 0, NULL, Jf3);
+
+    const PylithReal tolerance = 1.0e-14 * bulkModulus;
+    for (size_t i = 0; i < size; ++i) {
+        INFO("Jf3[" << i << "]");
+        CHECK_THAT(Jf3[i], Catch::Matchers::WithinAbs(Jf3E[i], tolerance));
+    } // for
+} // testJf3vu3D
+
+
+// ------------------------------------------------------------------------------------------------
+// Create solution field (displacement) and auxiliary fields.
+pylith::fekernels::TestIsotropicLinearElasticityKernels::Fields
+pylith::fekernels::TestIsotropicLinearElasticityKernels::_createFields(const PylithInt dim,
+                                                                       const bool refState) {
+    Fields fields;
+
+    // Solution: displacement with nonsymmetric gradient.
+    fields.sOff.push_back(0);
+    fields.sOff_x.push_back(0);
+    fields.s.resize(dim);
+    fields.s_t.resize(dim);
+    fields.s_x.resize(dim*dim);
+    for (PylithInt i = 0; i < dim; ++i) {
+        fields.s[i] = 0.2 * (i+1);
+        for (PylithInt j = 0; j < dim; ++j) {
+            fields.s_x[i*dim+j] = 1.0e-4 * (1.0 + 0.7*i - 1.3*j + 0.4*i*j);
+        } // for
+    } // for
+    fields.x.resize(dim, 0.5);
+
+    // Auxiliary: density, [reference stress, reference strain,] shear modulus, bulk modulus.
+    const PylithInt tensorSize = (3 == dim) ? 6 : 4;
+    fields.a.push_back(2500.0);
+    if (refState) {
+        const PylithReal refStress[6] = { -2.0e+6, -1.5e+6, -3.0e+6, 0.4e+6, -0.3e+6, 0.2e+6 };
+        const PylithReal refStrain[6] = { 1.0e-5, -2.0e-5, 0.5e-5, 0.3e-5, 0.8e-5, -0.6e-5 };
+        for (PylithInt i = 0; i < tensorSize; ++i) {
+            fields.a.push_back(refStress[i]);
+        } // for
+        for (PylithInt i = 0; i < tensorSize; ++i) {
+            fields.a.push_back(refStrain[i]);
+        } // for
+    } // if
+    fields.a.push_back(3.0e+10);
+    fields.a.push_back(5.2e+10);
+
+    const PylithInt numA = refState ? 5 : 3;
+    fields.aOff.resize(numA);
+    fields.aOff_x.resize(numA);
+    PylithInt offset = 0;
+    for (PylithInt i = 0; i < numA; ++i) {
+        fields.aOff[i] = offset;
+        fields.aOff_x[i] = dim*offset;
+        offset += (refState && ((1 == i) || (2 == i))) ? tensorSize : 1;
+    } // for
+
+    return fields;
+} // _createFields
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute f1 using Elasticity::f1v() with Tensor strain and stress functions.
+void
+pylith::fekernels::TestIsotropicLinearElasticityKernels::_f1vTensor(const Fields& fields,
+                                                                    const PylithInt dim,
+                                                                    const bool refState,
+                                                                    PylithScalar f1[]) {
+    const PylithInt numS = fields.sOff.size();
+    const PylithInt numA = fields.aOff.size();
+    const PylithReal t = 0.0;
+    const pylith::fekernels::TensorOps& tensorOps = (3 == dim) ? Tensor::ops3D : Tensor::ops2D;
+
+    Elasticity::StrainContext strainContext;
+    Elasticity::setStrainContext(&strainContext, dim, numS, &fields.sOff[0], &fields.sOff_x[0], &fields.s[0],
+                                 &fields.s_t[0], &fields.s_x[0], &fields.x[0]);
+
+    IsotropicLinearElasticity::Context rheologyContext;
+    if (refState) {
+        IsotropicLinearElasticity::setContext_refState(
+            &rheologyContext, dim, numS, numA, &fields.sOff[0], &fields.sOff_x[0], &fields.s[0], &fields.s_t[0],
+            &fields.s_x[0], &fields.aOff[0], &fields.aOff_x[0], &fields.a[0], NULL, NULL, t, &fields.x[0], 0, NULL,
+            tensorOps);
+    } else {
+        IsotropicLinearElasticity::setContext(
+            &rheologyContext, dim, numS, numA, &fields.sOff[0], &fields.sOff_x[0], &fields.s[0], &fields.s_t[0],
+            &fields.s_x[0], &fields.aOff[0], &fields.aOff_x[0], &fields.a[0], NULL, NULL, t, &fields.x[0], 0, NULL,
+            tensorOps);
+    } // if/else
+
+    Elasticity::strainfn_type strainFn = (3 == dim) ?
+                                         Elasticity3D::infinitesimalStrain :
+                                         ElasticityPlaneStrain::infinitesimalStrain;
+    Elasticity::stressfn_type stressFn = refState ?
+                                         IsotropicLinearElasticity::cauchyStress_refState :
+                                         IsotropicLinearElasticity::cauchyStress;
+    Elasticity::f1v(strainContext, &rheologyContext, strainFn, stressFn, tensorOps, f1);
+} // _f1vTensor
+
+
+// ------------------------------------------------------------------------------------------------
+// Check f1 from templated kernel against f1 from Tensor kernels.
+void
+pylith::fekernels::TestIsotropicLinearElasticityKernels::_checkF1v(const PylithInt dim,
+                                                                   const bool refState) {
+    const Fields fields = _createFields(dim, refState);
+    const PylithInt numS = fields.sOff.size();
+    const PylithInt numA = fields.aOff.size();
+    const PylithReal t = 0.0;
+
+    // Kernels accumulate into f1, so start from nonzero values.
+    std::vector<PylithScalar> f1(dim*dim);
+    std::vector<PylithScalar> f1E(dim*dim);
+    for (PylithInt i = 0; i < dim*dim; ++i) {
+        f1[i] = f1E[i] = 1.0e+5 * (i+1);
+    } // for
+    _f1vTensor(fields, dim, refState, &f1E[0]);
+
+    PetscPointFunc kernel = NULL;
+    if (2 == dim) {
+        kernel = refState ?
+                 IsotropicLinearElasticityDim<2>::f1v_infinitesimalStrain_refState :
+                 IsotropicLinearElasticityDim<2>::f1v_infinitesimalStrain;
+    } else {
+        kernel = refState ?
+                 IsotropicLinearElasticityDim<3>::f1v_infinitesimalStrain_refState :
+                 IsotropicLinearElasticityDim<3>::f1v_infinitesimalStrain;
+    } // if/else
+    kernel(dim, numS, numA, &fields.sOff[0], &fields.sOff_x[0], &fields.s[0], &fields.s_t[0], &fields.s_x[0],
+           &fields.aOff[0], &fields.aOff_x[0], &fields.a[0], NULL, NULL, t, &fields.x[0], 0, NULL, &f1[0]);
+
+    const PylithReal tolerance = 1.0e-12 * 1.0e+7;
+    for (PylithInt i = 0; i < dim*dim; ++i) {
+        INFO("Dimension " << dim << ", reference state " << refState << ", f1[" << i << "]");
+        CHECK_THAT(f1[i], Catch::Matchers::WithinAbs(f1E[i], tolerance));
+    } // for
+} // _checkF1v
+
+
+// End of file
@@ -0,0 +1,231 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/fekernels/IsotropicLinearMaxwell.hh" // Test subject
+
+#include "pylith/fekernels/Tensor.hh" // USES Tensor
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <cmath> // USES exp(), sin(), cos(), log()
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+    namespace fekernels {
+        class TestIsotropicLinearMaxwellKernels;
+    } // fekernels
+} // pylith
+
+class pylith::fekernels::TestIsotropicLinearMaxwellKernels {
+public:
+
+    /// Test viscousStrain() is exact for total strain varying linearly in time.
+    void testViscousStrainLinear(void);
+
+    /// Test viscousStrain() converges at second order for uniform time steps.
+    void testViscousStrainConvergenceUniform(void);
+
+    /// Test viscousStrain() converges at second order for variable time steps (as used by BDF2).
+    void testViscousStrainConvergenceVariable(void);
+
+private:
+
+    /** Integrate viscous strain for shear strain e0*sin(omega*t) using time steps.
+     *
+     * @param[in] timeSteps Time steps.
+     * @returns Viscous strain (xy component) at end of last time step.
+     */
+    static
+    double _integrateSine(const std::vector<double>& timeSteps);
+
+    /** Analytical viscous strain (xy component) for shear strain e0*sin(omega*t).
+     *
+     * @param[in] t Time.
+     * @returns Viscous strain (xy component).
+     */
+    static
+    double _viscousStrainSine(const double t);
+
+    /** Split each time step in half.
+     *
+     * @param[in] timeSteps Time steps.
+     * @returns Refined time steps.
+     */
+    static
+    std::vector<double> _refine(const std::vector<double>& timeSteps);
+
+    static const double _maxwellTime; ///< Maxwell time.
+    static const double _strainAmplitude; ///< Amplitude of shear strain.
+    static const double _strainFrequency; ///< Angular frequency of shear strain.
+
+}; // class TestIsotropicLinearMaxwellKernels
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestIsotropicLinearMaxwellKernels::testViscousStrainLinear", "[TestIsotropicLinearMaxwellKernels]") {
+    pylith::fekernels::TestIsotropicLinearMaxwellKernels().testViscousStrainLinear();
+}
+TEST_CASE("TestIsotropicLinearMaxwellKernels::testViscousStrainConvergenceUniform", "[TestIsotropicLinearMaxwellKernels]") {
+    pylith::fekernels::TestIsotropicLinearMaxwellKernels().testViscousStrainConvergenceUniform();
+}
+TEST_CASE("TestIsotropicLinearMaxwellKernels::testViscousStrainConvergenceVariable", "[TestIsotropicLinearMaxwellKernels]") {
+    pylith::fekernels::TestIsotropicLinearMaxwellKernels().testViscousStrainConvergenceVariable();
+}
+
+const double pylith::fekernels::TestIsotropicLinearMaxwellKernels::_maxwellTime = 2.0;
+const double pylith::fekernels::TestIsotropicLinearMaxwellKernels::_strainAmplitude = 1.0e-4;
+const double pylith::fekernels::TestIsotropicLinearMaxwellKernels::_strainFrequency = 1.5;
+
+// ------------------------------------------------------------------------------------------------
+// Test viscousStrain() is exact for total strain varying linearly in time.
+void
+pylith::fekernels::TestIsotropicLinearMaxwellKernels::testViscousStrainLinear(void) {
+    // Total strain: exx = rate*t, exy = 0.5*rate*t.
+    const double rate = 2.0e-5;
+    const double timeSteps[4] = { 0.1, 0.7, 0.25, 1.9 };
+
+    pylith::fekernels::Tensor viscousStrain;
+    pylith::fekernels::Tensor totalStrain;
+    double t = 0.0;
+    for (size_t i = 0; i < 4; ++i) {
+        t += timeSteps[i];
+        pylith::fekernels::Tensor strain;
+        strain.xx = rate * t;
+        strain.xy = 0.5 * rate * t;
+
+        pylith::fekernels::Tensor viscousStrainNew;
+        pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(_maxwellTime, viscousStrain, totalStrain, strain,
+                                                                 timeSteps[i], &viscousStrainNew);
+        viscousStrain = viscousStrainNew;
+        totalStrain = strain;
+
+        const double factor = _maxwellTime * (1.0 - exp(-t / _maxwellTime));
+        const double tolerance = 1.0e-14;
+        INFO("Time step " << i);
+        CHECK_THAT(viscousStrain.xx, Catch::Matchers::WithinAbs(2.0/3.0 * rate * factor, tolerance));
+        CHECK_THAT(viscousStrain.yy, Catch::Matchers::WithinAbs(-1.0/3.0 * rate * factor, tolerance));
+        CHECK_THAT(viscousStrain.zz, Catch::Matchers::WithinAbs(-1.0/3.0 * rate * factor, tolerance));
+        CHECK_THAT(viscousStrain.xy, Catch::Matchers::WithinAbs(0.5 * rate * factor, tolerance));
+    } // for
+} // testViscousStrainLinear
+
+
+// ------------------------------------------------------------------------------------------------
+// Test viscousStrain() converges at second order for uniform time steps.
+void
+pylith::fekernels::TestIsotropicLinearMaxwellKernels::testViscousStrainConvergenceUniform(void) {
+    const double duration = 2.0 * _maxwellTime;
+    const size_t numSteps = 10;
+    std::vector<double> timeSteps(numSteps, duration / numSteps);
+
+    const double valueE = _viscousStrainSine(duration);
+    double errorPrev = fabs(_integrateSine(timeSteps) - valueE);
+    for (size_t iRefine = 0; iRefine < 3; ++iRefine) {
+        timeSteps = _refine(timeSteps);
+        const double error = fabs(_integrateSine(timeSteps) - valueE);
+        const double rate = log(errorPrev / error) / log(2.0);
+        INFO("Number of time steps " << timeSteps.size() << ", error " << error);
+        CHECK(rate > 1.9);
+        errorPrev = error;
+    } // for
+} // testViscousStrainConvergenceUniform
+
+
+// ------------------------------------------------------------------------------------------------
+// Test viscousStrain() converges at second order for variable time steps (as used by BDF2).
+void
+pylith::fekernels::TestIsotropicLinearMaxwellKernels::testViscousStrainConvergenceVariable(void) {
+    // Time steps grow and shrink with ratios of consecutive steps between 0.5 and 2.
+    const size_t numSteps = 8;
+    const double weights[numSteps] = { 1.0, 2.0, 1.0, 0.5, 1.0, 1.5, 3.0, 1.5 };
+    double sum = 0.0;
+    for (size_t i = 0; i < numSteps; ++i) {
+        sum += weights[i];
+    } // for
+    const double duration = 2.0 * _maxwellTime;
+    std::vector<double> timeSteps(numSteps);
+    for (size_t i = 0; i < numSteps; ++i) {
+        timeSteps[i] = duration * weights[i] / sum;
+    } // for
+
+    const double valueE = _viscousStrainSine(duration);
+    double errorPrev = fabs(_integrateSine(timeSteps) - valueE);
+    for (size_t iRefine = 0; iRefine < 3; ++iRefine) {
+        timeSteps = _refine(timeSteps);
+        const double error = fabs(_integrateSine(timeSteps) - valueE);
+        const double rate = log(errorPrev / error) / log(2.0);
+        INFO("Number of time steps " << timeSteps.size() << ", error " << error);
+        CHECK(rate > 1.8);
+        errorPrev = error;
+    } // for
+} // testViscousStrainConvergenceVariable
+
+
+// ------------------------------------------------------------------------------------------------
+// Integrate viscous strain for shear strain e0*sin(omega*t) using time steps.
+double
+pylith::fekernels::TestIsotropicLinearMaxwellKernels::_integrateSine(const std::vector<double>& timeSteps) {
+    pylith::fekernels::Tensor viscousStrain;
+    pylith::fekernels::Tensor totalStrain;
+    double t = 0.0;
+    for (size_t i = 0; i < timeSteps.size(); ++i) {
+        t += timeSteps[i];
+        pylith::fekernels::Tensor strain;
+        strain.xy = _strainAmplitude * sin(_strainFrequency * t);
+
+        pylith::fekernels::Tensor viscousStrainNew;
+        pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(_maxwellTime, viscousStrain, totalStrain, strain,
+                                                                 timeSteps[i], &viscousStrainNew);
+        viscousStrain = viscousStrainNew;
+        totalStrain = strain;
+    } // for
+
+    return viscousStrain.xy;
+} // _integrateSine
+
+
+// ------------------------------------------------------------------------------------------------
+// Analytical viscous strain (xy component) for shear strain e0*sin(omega*t).
+double
+pylith::fekernels::TestIsotropicLinearMaxwellKernels::_viscousStrainSine(const double t) {
+    // Solution of d(viscousStrain)/dt = d(strain)/dt - viscousStrain/maxwellTime with zero initial value.
+    const double a = 1.0 / _maxwellTime;
+    const double w = _strainFrequency;
+    return _strainAmplitude * w * (a*cos(w*t) + w*sin(w*t) - a*exp(-a*t)) / (a*a + w*w);
+} // _viscousStrainSine
+
+
+// ------------------------------------------------------------------------------------------------
+// Split each time step in half.
+std::vector<double>
+pylith::fekernels::TestIsotropicLinearMaxwellKernels::_refine(const std::vector<double>& timeSteps) {
+    std::vector<double> refined(2*timeSteps.size());
+    for (size_t i = 0; i < timeSteps.size(); ++i) {
+        refined[2*i+0] = 0.5 * timeSteps[i];
+        refined[2*i+1] = 0.5 * timeSteps[i];
+    } // for
+
+    return refined;
+} // _refine
+
+
+// End of file
@@ -0,0 +1,593 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/fekernels/IsotropicPowerLaw.hh" // Test subject
+
+#include "pylith/fekernels/Tensor.hh" // USES Tensor
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <cassert> // USES assert()
+#include <cmath> // USES sqrt(), pow(), nextafter()
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+    namespace fekernels {
+        class TestIsotropicPowerLawKernels;
+    } // fekernels
+} // pylith
+
+class pylith::fekernels::TestIsotropicPowerLawKernels {
+public:
+
+    /// Test _effectiveStressSolve() matches bracketing followed by Newton's method with bisection.
+    void testEffectiveStressBracketed(void);
+
+    /// Test _newton() and _effectiveStressSolve() with predictors far from the root.
+    void testPoorPredictor(void);
+
+    /// Test _effectiveStressSolve() is independent of the scale of the nondimensionalization.
+    void testEffectiveStressScaling(void);
+
+    /// Test IsotropicPowerLawPlaneStrain::_elasticConstants() matches tangent with unshared compliance terms.
+    void testElasticConstantsPlaneStrain(void);
+
+    /// Test IsotropicPowerLaw3D::_elasticConstants() matches tangent with unshared compliance terms.
+    void testElasticConstants3D(void);
+
+    /// Test _effectiveStress() returns the same roots as _effectiveStressSolve() with repeated and evicted keys.
+    void testEffectiveStressCache(void);
+
+private:
+
+    /// Parameters of root-finding problem for effective stress.
+    struct Params {
+        PylithReal j2InitialGuess;
+        PylithReal stressScale;
+        PylithReal ae;
+        PylithReal b;
+        PylithReal c;
+        PylithReal d;
+        PylithReal dt;
+        PylithReal j2T;
+        PylithReal powerLawExponent;
+        PylithReal powerLawRefStrainRate;
+        PylithReal powerLawRefStress;
+    };
+
+    /** Create parameters of root-finding problem the same way as IsotropicPowerLaw::deviatoricStress().
+     *
+     * @param[in] shearModulus Shear modulus.
+     * @param[in] dt Time step.
+     * @param[in] powerLawExponent Power-law exponent.
+     * @param[in] strainScale Magnitude of deviatoric strain relative to viscous strain.
+     * @param[in] stressScale Magnitude of deviatoric stress at previous time step relative to shear modulus.
+     * @returns Parameters of root-finding problem.
+     */
+    static
+    Params _createParams(const PylithReal shearModulus,
+                         const PylithReal dt,
+                         const PylithReal powerLawExponent,
+                         const PylithReal strainScale,
+                         const PylithReal stressScale);
+
+    /** Solve for effective stress using bracketing followed by Newton's method with bisection.
+     *
+     * This is the solver used before the safeguarded Newton iteration from the predictor.
+     *
+     * @param[in] params Parameters of root-finding problem.
+     * @returns Effective stress.
+     */
+    static
+    PylithReal _solveBracketed(const Params& params);
+
+    /// Create parameters for all combinations of material properties, time steps, and deformation.
+    static
+    std::vector<Params> _createCases(void);
+
+    /** Create rheology context and deviatoric stress at t+dt for root-finding problem.
+     *
+     * @param[out] context Rheology context.
+     * @param[out] devStressTpdt Deviatoric stress at t+dt.
+     * @param[out] j2Tpdt Effective stress at t+dt.
+     * @param[in] params Parameters of root-finding problem.
+     */
+    static
+    void _createTangentState(IsotropicPowerLaw::Context* context,
+                             pylith::fekernels::Tensor* devStressTpdt,
+                             PylithReal* j2Tpdt,
+                             const Params& params);
+
+    /** Compute tangent with gamma from pow() and a separate compliance denominator for each entry.
+     *
+     * This is the tangent used before the compliance terms were shared among entries.
+     *
+     * @param[in] context Rheology context.
+     * @param[in] devStressTpdt Deviatoric stress at t+dt.
+     * @param[in] j2T Effective stress at t.
+     * @param[in] j2Tpdt Effective stress at t+dt.
+     * @returns Unique components of tangent for 3D (plane strain uses the xx, yy, and xy components).
+     */
+    static
+    IsotropicPowerLaw3D::ElasticConstants _elasticConstantsUnshared(const IsotropicPowerLaw::Context& context,
+                                                                    const pylith::fekernels::Tensor& devStressTpdt,
+                                                                    const PylithReal j2T,
+                                                                    const PylithReal j2Tpdt);
+
+}; // class TestIsotropicPowerLawKernels
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestIsotropicPowerLawKernels::testEffectiveStressBracketed", "[TestIsotropicPowerLawKernels]") {
+    pylith::fekernels::TestIsotropicPowerLawKernels().testEffectiveStressBracketed();
+}
+TEST_CASE("TestIsotropicPowerLawKernels::testPoorPredictor", "[TestIsotropicPowerLawKernels]") {
+    pylith::fekernels::TestIsotropicPowerLawKernels().testPoorPredictor();
+}
+TEST_CASE("TestIsotropicPowerLawKernels::testEffectiveStressScaling", "[TestIsotropicPowerLawKernels]") {
+    pylith::fekernels::TestIsotropicPowerLawKernels().testEffectiveStressScaling();
+}
+TEST_CASE("TestIsotropicPowerLawKernels::testElasticConstantsPlaneStrain", "[TestIsotropicPowerLawKernels]") {
+    pylith::fekernels::TestIsotropicPowerLawKernels().testElasticConstantsPlaneStrain();
+}
+TEST_CASE("TestIsotropicPowerLawKernels::testElasticConstants3D", "[TestIsotropicPowerLawKernels]") {
+    pylith::fekernels::TestIsotropicPowerLawKernels().testElasticConstants3D();
+}
+TEST_CASE("TestIsotropicPowerLawKernels::testEffectiveStressCache", "[TestIsotropicPowerLawKernels]") {
+    pylith::fekernels::TestIsotropicPowerLawKernels().testEffectiveStressCache();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test _effectiveStressSolve() matches bracketing followed by Newton's method with bisection.
+void
+pylith::fekernels::TestIsotropicPowerLawKernels::testEffectiveStressBracketed(void) {
+    const std::vector<Params> cases = _createCases();
+    size_t numCompared = 0;
+    for (size_t iCase = 0; iCase < cases.size(); ++iCase) {
+        const Params& p = cases[iCase];
+
+        PylithReal effStressE = 0.0;
+        try {
+            effStressE = _solveBracketed(p);
+        } catch (const std::runtime_error&) {
+            continue; // Bracketed solver failed, so there is nothing to compare against.
+        } // try/catch
+        ++numCompared;
+
+        const PylithReal effStress = IsotropicPowerLaw::_effectiveStressSolve(
+            p.j2InitialGuess, p.stressScale, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+            p.powerLawRefStrainRate, p.powerLawRefStress);
+
+        INFO("Case " << iCase << ", n=" << p.powerLawExponent << ", dt=" << p.dt << ", b=" << p.b
+                     << ", j2T=" << p.j2T);
+        const PylithReal tolerance = 1.0e-10;
+        CHECK_THAT(effStress, Catch::Matchers::WithinAbs(effStressE, tolerance * effStressE));
+    } // for
+    CHECK(numCompared > cases.size() / 2);
+} // testEffectiveStressBracketed
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _newton() and _effectiveStressSolve() with predictors far from the root.
+void
+pylith::fekernels::TestIsotropicPowerLawKernels::testPoorPredictor(void) {
+    const std::vector<Params> cases = _createCases();
+    const size_t numFactors = 4;
+    const PylithReal factors[numFactors] = { 1.0e-3, 0.2, 5.0, 1.0e+3 };
+    for (size_t iCase = 0; iCase < cases.size(); ++iCase) {
+        const Params& p = cases[iCase];
+        const PylithReal effStressE = IsotropicPowerLaw::_effectiveStressSolve(
+            p.j2InitialGuess, p.stressScale, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+            p.powerLawRefStrainRate, p.powerLawRefStress);
+
+        for (size_t iFactor = 0; iFactor < numFactors; ++iFactor) {
+            INFO("Case " << iCase << ", n=" << p.powerLawExponent << ", dt=" << p.dt << ", b=" << p.b
+                         << ", j2T=" << p.j2T << ", predictor factor=" << factors[iFactor]);
+            const PylithReal tolerance = 1.0e-10;
+
+            // Newton's method either converges to the root or reports failure.
+            PylithReal effStress = factors[iFactor] * effStressE;
+            const bool converged = IsotropicPowerLaw::_newton(
+                &effStress, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent, p.powerLawRefStrainRate,
+                p.powerLawRefStress);
+            if (converged) {
+                CHECK_THAT(effStress, Catch::Matchers::WithinAbs(effStressE, tolerance * effStressE));
+            } // if
+
+            // Falls back to bracketing followed by Newton's method with bisection when Newton's method fails.
+            effStress = IsotropicPowerLaw::_effectiveStressSolve(
+                factors[iFactor] * effStressE, p.stressScale, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+                p.powerLawRefStrainRate, p.powerLawRefStress);
+            CHECK_THAT(effStress, Catch::Matchers::WithinAbs(effStressE, tolerance * effStressE));
+        } // for
+    } // for
+} // testPoorPredictor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _effectiveStressSolve() is independent of the scale of the nondimensionalization.
+void
+pylith::fekernels::TestIsotropicPowerLawKernels::testEffectiveStressScaling(void) {
+    const std::vector<Params> cases = _createCases();
+    const size_t numScales = 3;
+    const PylithReal scales[numScales] = { 1.0e-6, 1.0e-3, 1.0e+3 };
+    for (size_t iCase = 0; iCase < cases.size(); ++iCase) {
+        const Params& p = cases[iCase];
+        const PylithReal effStressE = IsotropicPowerLaw::_effectiveStressSolve(
+            p.j2InitialGuess, p.stressScale, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+            p.powerLawRefStrainRate, p.powerLawRefStress);
+
+        for (size_t iScale = 0; iScale < numScales; ++iScale) {
+            // Scale stresses by s; strains and the reference strain rate are unchanged.
+            const PylithReal s = scales[iScale];
+            const PylithReal effStress = IsotropicPowerLaw::_effectiveStressSolve(
+                s*p.j2InitialGuess, s*p.stressScale, p.ae/s, p.b, s*p.c, s*p.d, p.dt, s*p.j2T,
+                p.powerLawExponent, p.powerLawRefStrainRate, s*p.powerLawRefStress);
+
+            INFO("Case " << iCase << ", n=" << p.powerLawExponent << ", dt=" << p.dt << ", b=" << p.b
+                         << ", j2T=" << p.j2T << ", stress scale=" << s);
+            const PylithReal tolerance = 1.0e-10;
+            CHECK_THAT(effStress / s, Catch::Matchers::WithinAbs(effStressE, tolerance * effStressE));
+        } // for
+    } // for
+} // testEffectiveStressScaling
+
+
+// ------------------------------------------------------------------------------------------------
+// Test IsotropicPowerLawPlaneStrain::_elasticConstants() matches tangent with unshared compliance terms.
+void
+pylith::fekernels::TestIsotropicPowerLawKernels::testElasticConstantsPlaneStrain(void) {
+    const std::vector<Params> cases = _createCases();
+    for (size_t iCase = 0; iCase < cases.size(); ++iCase) {
+        const Params& p = cases[iCase];
+        IsotropicPowerLaw::Context context;
+        pylith::fekernels::Tensor devStressTpdt;
+        PylithReal j2Tpdt = 0.0;
+        _createTangentState(&context, &devStressTpdt, &j2Tpdt, p);
+
+        IsotropicPowerLawPlaneStrain::ElasticConstants elasticityMat;
+        IsotropicPowerLawPlaneStrain::_elasticConstants(&elasticityMat, context, devStressTpdt, p.j2T, j2Tpdt);
+        const IsotropicPowerLaw3D::ElasticConstants elasticityMatE =
+            _elasticConstantsUnshared(context, devStressTpdt, p.j2T, j2Tpdt);
+
+        INFO("Case " << iCase << ", n=" << p.powerLawExponent << ", dt=" << p.dt << ", b=" << p.b
+                     << ", j2T=" << p.j2T);
+        const PylithReal tolerance = 1.0e-12 * context.bulkModulus;
+        CHECK_THAT(elasticityMat.C1111, Catch::Matchers::WithinAbs(elasticityMatE.C1111, tolerance));
+        CHECK_THAT(elasticityMat.C1122, Catch::Matchers::WithinAbs(elasticityMatE.C1122, tolerance));
+        CHECK_THAT(elasticityMat.C1212, Catch::Matchers::WithinAbs(elasticityMatE.C1212, tolerance));
+        CHECK_THAT(elasticityMat.C2211, Catch::Matchers::WithinAbs(elasticityMatE.C2211, tolerance));
+        CHECK_THAT(elasticityMat.C2222, Catch::Matchers::WithinAbs(elasticityMatE.C2222, tolerance));
+    } // for
+} // testElasticConstantsPlaneStrain
+
+
+// ------------------------------------------------------------------------------------------------
+// Test IsotropicPowerLaw3D::_elasticConstants() matches tangent with unshared compliance terms.
+void
+pylith::fekernels::TestIsotropicPowerLawKernels::testElasticConstants3D(void) {
+    const std::vector<Params> cases = _createCases();
+    for (size_t iCase = 0; iCase < cases.size(); ++iCase) {
+        const Params& p = cases[iCase];
+        IsotropicPowerLaw::Context context;
+        pylith::fekernels::Tensor devStressTpdt;
+        PylithReal j2Tpdt = 0.0;
+        _createTangentState(&context, &devStressTpdt, &j2Tpdt, p);
+
+        IsotropicPowerLaw3D::ElasticConstants elasticityMat;
+        IsotropicPowerLaw3D::_elasticConstants(&elasticityMat, context, devStressTpdt, p.j2T, j2Tpdt);
+        const IsotropicPowerLaw3D::ElasticConstants elasticityMatE =
+            _elasticConstantsUnshared(context, devStressTpdt, p.j2T, j2Tpdt);
+
+        INFO("Case " << iCase << ", n=" << p.powerLawExponent << ", dt=" << p.dt << ", b=" << p.b
+                     << ", j2T=" << p.j2T);
+        const PylithReal tolerance = 1.0e-12 * context.bulkModulus;
+        CHECK_THAT(elasticityMat.C1111, Catch::Matchers::WithinAbs(elasticityMatE.C1111, tolerance));
+        CHECK_THAT(elasticityMat.C1122, Catch::Matchers::WithinAbs(elasticityMatE.C1122, tolerance));
+        CHECK_THAT(elasticityMat.C1212, Catch::Matchers::WithinAbs(elasticityMatE.C1212, tolerance));
+        CHECK_THAT(elasticityMat.C1313, Catch::Matchers::WithinAbs(elasticityMatE.C1313, tolerance));
+        CHECK_THAT(elasticityMat.C2211, Catch::Matchers::WithinAbs(elasticityMatE.C2211, tolerance));
+        CHECK_THAT(elasticityMat.C2222, Catch::Matchers::WithinAbs(elasticityMatE.C2222, tolerance));
+        CHECK_THAT(elasticityMat.C2323, Catch::Matchers::WithinAbs(elasticityMatE.C2323, tolerance));
+        CHECK_THAT(elasticityMat.C3311, Catch::Matchers::WithinAbs(elasticityMatE.C3311, tolerance));
+        CHECK_THAT(elasticityMat.C3333, Catch::Matchers::WithinAbs(elasticityMatE.C3333, tolerance));
+    } // for
+} // testElasticConstants3D
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _effectiveStress() returns the same roots as _effectiveStressSolve() with repeated and evicted keys.
+void
+pylith::fekernels::TestIsotropicPowerLawKernels::testEffectiveStressCache(void) {
+    // Perturb the cases to get more keys than cache entries, so some entries are evicted and refilled.
+    const std::vector<Params> baseCases = _createCases();
+    const size_t numCacheEntries = IsotropicPowerLaw::EffectiveStressCache::numEntries;
+    const size_t numPerturbations = 2 * numCacheEntries / baseCases.size() + 1;
+    std::vector<Params> cases;
+    for (size_t iCase = 0; iCase < baseCases.size(); ++iCase) {
+        for (size_t iPerturb = 0; iPerturb < numPerturbations; ++iPerturb) {
+            Params p = baseCases[iCase];
+            p.b *= 1.0 + 1.0e-3 * iPerturb;
+            cases.push_back(p);
+        } // for
+    } // for
+    REQUIRE(cases.size() > numCacheEntries);
+
+    std::vector<PylithReal> effStressE(cases.size());
+    for (size_t iCase = 0; iCase < cases.size(); ++iCase) {
+        const Params& p = cases[iCase];
+        effStressE[iCase] = IsotropicPowerLaw::_effectiveStressSolve(
+            p.j2InitialGuess, p.stressScale, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+            p.powerLawRefStrainRate, p.powerLawRefStress);
+    } // for
+
+    // Forward pass fills the cache, repeated call hits it, and reverse pass mixes hits with evicted keys.
+    size_t numMismatch = 0;
+    for (size_t iPass = 0; iPass < 3; ++iPass) {
+        for (size_t i = 0; i < cases.size(); ++i) {
+            const size_t iCase = (2 == iPass) ? cases.size() - 1 - i : i;
+            const Params& p = cases[iCase];
+            const PylithReal effStress = IsotropicPowerLaw::_effectiveStress(
+                p.j2InitialGuess, p.stressScale, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+                p.powerLawRefStrainRate, p.powerLawRefStress);
+            if (effStress != effStressE[iCase]) {
+                ++numMismatch;
+            } // if
+        } // for
+    } // for
+    CHECK(0 == numMismatch);
+
+    // A cached root is never returned for parameters that differ in a single bit.
+    for (size_t iCase = 0; iCase < baseCases.size(); ++iCase) {
+        const Params& p = baseCases[iCase];
+        const PylithReal effStressCached = IsotropicPowerLaw::_effectiveStress(
+            p.j2InitialGuess, p.stressScale, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+            p.powerLawRefStrainRate, p.powerLawRefStress);
+        const PylithReal bNext = nextafter(p.b, 2.0 * p.b);
+        const PylithReal effStress = IsotropicPowerLaw::_effectiveStress(
+            p.j2InitialGuess, p.stressScale, p.ae, bNext, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+            p.powerLawRefStrainRate, p.powerLawRefStress);
+        const PylithReal effStressNextE = IsotropicPowerLaw::_effectiveStressSolve(
+            p.j2InitialGuess, p.stressScale, p.ae, bNext, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+            p.powerLawRefStrainRate, p.powerLawRefStress);
+
+        INFO("Case " << iCase << ", n=" << p.powerLawExponent << ", dt=" << p.dt << ", b=" << p.b
+                     << ", j2T=" << p.j2T);
+        CHECK(effStressNextE == effStress);
+        const PylithReal tolerance = 1.0e-10;
+        CHECK_THAT(effStress, Catch::Matchers::WithinAbs(effStressCached, tolerance * effStressCached));
+    } // for
+} // testEffectiveStressCache
+
+
+// ------------------------------------------------------------------------------------------------
+// Create parameters of root-finding problem the same way as IsotropicPowerLaw::deviatoricStress().
+pylith::fekernels::TestIsotropicPowerLawKernels::Params
+pylith::fekernels::TestIsotropicPowerLawKernels::_createParams(const PylithReal shearModulus,
+                                                               const PylithReal dt,
+                                                               const PylithReal powerLawExponent,
+                                                               const PylithReal strainScale,
+                                                               const PylithReal stressScale) {
+    const PylithReal alpha = IsotropicPowerLaw::powerLawAlpha;
+
+    Params p;
+    p.powerLawExponent = powerLawExponent;
+    p.powerLawRefStress = 1.0e-3 * shearModulus;
+    p.powerLawRefStrainRate = 1.0e-2;
+    p.dt = dt;
+    p.ae = 1.0 / (2.0 * shearModulus);
+    p.stressScale = shearModulus;
+
+    pylith::fekernels::Tensor devStress;
+    devStress.xx = 0.8 * stressScale * shearModulus;
+    devStress.yy = -0.3 * stressScale * shearModulus;
+    devStress.zz = -0.5 * stressScale * shearModulus;
+    devStress.xy = 0.6 * stressScale * shearModulus;
+
+    pylith::fekernels::Tensor strainPP;
+    strainPP.xx = 1.1 * strainScale;
+    strainPP.yy = -0.4 * strainScale;
+    strainPP.zz = -0.7 * strainScale;
+    strainPP.xy = 0.9 * strainScale;
+
+    const PylithReal timeFac = dt * (1.0 - alpha);
+    p.j2T = sqrt(0.5 * pylith::fekernels::TensorOps::scalarProduct(devStress, devStress));
+    p.j2InitialGuess = p.j2T;
+    p.b = 0.5 * pylith::fekernels::TensorOps::scalarProduct(strainPP, strainPP);
+    p.c = pylith::fekernels::TensorOps::scalarProduct(strainPP, devStress) * timeFac;
+    p.d = timeFac * p.j2T;
+
+    return p;
+} // _createParams
+
+
+// ------------------------------------------------------------------------------------------------
+// Solve for effective stress using bracketing followed by Newton's method with bisection.
+PylithReal
+pylith::fekernels::TestIsotropicPowerLawKernels::_solveBracketed(const Params& p) {
+    const PylithReal xMin = 1.0e-10;
+
+    PylithReal xL = 0.0;
+    PylithReal xR = 0.0;
+    if (p.j2InitialGuess > xMin) {
+        xL = 0.5 * p.j2InitialGuess;
+        xR = 1.5 * p.j2InitialGuess;
+    } else {
+        xL = 0.5 * p.stressScale;
+        xR = 1.5 * p.stressScale;
+    } // else
+
+    IsotropicPowerLaw::_bracket(&xL, &xR, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+                                p.powerLawRefStrainRate, p.powerLawRefStress);
+    return IsotropicPowerLaw::_search(xL, xR, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+                                      p.powerLawRefStrainRate, p.powerLawRefStress);
+} // _solveBracketed
+
+
+// ------------------------------------------------------------------------------------------------
+// Create parameters for all combinations of material properties, time steps, and deformation.
+std::vector<pylith::fekernels::TestIsotropicPowerLawKernels::Params>
+pylith::fekernels::TestIsotropicPowerLawKernels::_createCases(void) {
+    const size_t numExponents = 3;
+    const PylithReal exponents[numExponents] = { 1.0, 3.5, 5.0 };
+    const size_t numTimeSteps = 3;
+    const PylithReal timeSteps[numTimeSteps] = { 1.0e-2, 1.0, 1.0e+2 };
+    const size_t numStrainScales = 3;
+    const PylithReal strainScales[numStrainScales] = { 1.0e-6, 1.0e-4, 1.0e-3 };
+    const size_t numStressScales = 3;
+    const PylithReal stressScales[numStressScales] = { 0.0, 1.0e-5, 1.0e-3 };
+    const PylithReal shearModulus = 1.0;
+
+    std::vector<Params> cases;
+    for (size_t iExp = 0; iExp < numExponents; ++iExp) {
+        for (size_t iDt = 0; iDt < numTimeSteps; ++iDt) {
+            for (size_t iStrain = 0; iStrain < numStrainScales; ++iStrain) {
+                for (size_t iStress = 0; iStress < numStressScales; ++iStress) {
+                    cases.push_back(_createParams(shearModulus, timeSteps[iDt], exponents[iExp], strainScales[iStrain],
+                                                  stressScales[iStress]));
+                } // for
+            } // for
+        } // for
+    } // for
+
+    return cases;
+} // _createCases
+
+
+// ------------------------------------------------------------------------------------------------
+// Create rheology context and deviatoric stress at t+dt for root-finding problem.
+void
+pylith::fekernels::TestIsotropicPowerLawKernels::_createTangentState(IsotropicPowerLaw::Context* context,
+                                                                     pylith::fekernels::Tensor* devStressTpdt,
+                                                                     PylithReal* j2Tpdt,
+                                                                     const Params& p) {
+    assert(context);
+    assert(devStressTpdt);
+    assert(j2Tpdt);
+
+    const PylithReal shearModulus = 1.0 / (2.0 * p.ae);
+    context->bulkModulus = 5.0 / 3.0 * shearModulus;
+    context->shearModulus = shearModulus;
+    context->powerLawRefStress = p.powerLawRefStress;
+    context->powerLawRefStrainRate = p.powerLawRefStrainRate;
+    context->powerLawExponent = p.powerLawExponent;
+    context->dt = p.dt;
+
+    // Deviatoric stress at t with effective stress j2T and all components nonzero.
+    const PylithReal devStressT[6] = { 0.8, -0.3, -0.5, 0.6, 0.4, -0.2 };
+    const PylithReal devStressTpdtDir[6] = { 0.7, 0.1, -0.8, -0.5, 0.3, 0.9 };
+    PylithReal j2TUnit = 0.0, j2TpdtUnit = 0.0;
+    for (size_t i = 0; i < 6; ++i) {
+        const PylithReal weight = (i < 3) ? 0.5 : 1.0;
+        j2TUnit += weight * devStressT[i] * devStressT[i];
+        j2TpdtUnit += weight * devStressTpdtDir[i] * devStressTpdtDir[i];
+    } // for
+    j2TUnit = sqrt(j2TUnit);
+    j2TpdtUnit = sqrt(j2TpdtUnit);
+
+    *j2Tpdt = IsotropicPowerLaw::_effectiveStressSolve(
+        p.j2InitialGuess, p.stressScale, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+        p.powerLawRefStrainRate, p.powerLawRefStress);
+
+    const PylithReal scaleT = p.j2T / j2TUnit;
+    context->devStress.xx = scaleT * devStressT[0];
+    context->devStress.yy = scaleT * devStressT[1];
+    context->devStress.zz = scaleT * devStressT[2];
+    context->devStress.xy = scaleT * devStressT[3];
+    context->devStress.yz = scaleT * devStressT[4];
+    context->devStress.xz = scaleT * devStressT[5];
+
+    const PylithReal scaleTpdt = *j2Tpdt / j2TpdtUnit;
+    devStressTpdt->xx = scaleTpdt * devStressTpdtDir[0];
+    devStressTpdt->yy = scaleTpdt * devStressTpdtDir[1];
+    devStressTpdt->zz = scaleTpdt * devStressTpdtDir[2];
+    devStressTpdt->xy = scaleTpdt * devStressTpdtDir[3];
+    devStressTpdt->yz = scaleTpdt * devStressTpdtDir[4];
+    devStressTpdt->xz = scaleTpdt * devStressTpdtDir[5];
+} // _createTangentState
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute tangent with gamma from pow() and a separate compliance denominator for each entry.
+pylith::fekernels::IsotropicPowerLaw3D::ElasticConstants
+pylith::fekernels::TestIsotropicPowerLawKernels::_elasticConstantsUnshared(const IsotropicPowerLaw::Context& context,
+                                                                           const pylith::fekernels::Tensor& devStressTpdt,
+                                                                           const PylithReal j2T,
+                                                                           const PylithReal j2Tpdt) {
+    const PylithReal powerLawAlpha = IsotropicPowerLaw::powerLawAlpha;
+    const PylithReal powerLawRefStrainRate = context.powerLawRefStrainRate;
+    const PylithReal powerLawRefStress = context.powerLawRefStress;
+    const PylithReal powerLawExponent = context.powerLawExponent;
+    const PylithReal dt = context.dt;
+    const pylith::fekernels::Tensor& devStressT = context.devStress;
+
+    const PylithReal j2Tau = powerLawAlpha * j2Tpdt + (1.0 - powerLawAlpha) * j2T;
+    const PylithReal gammaTau = powerLawRefStrainRate * pow((j2Tau / powerLawRefStress), (powerLawExponent - 1.0)) / powerLawRefStress;
+
+    const PylithReal bulkModulus = context.bulkModulus;
+    const PylithReal shearModulus = context.shearModulus;
+
+    IsotropicPowerLaw3D::ElasticConstants elasticityMat;
+    if ((j2Tpdt == 0.0) && (j2Tau == 0.0)) {
+        elasticityMat.C1111 = bulkModulus + 4.0 * shearModulus / 3.0;
+        elasticityMat.C1122 = bulkModulus - 2.0 * shearModulus / 3.0;
+        elasticityMat.C1212 = shearModulus;
+        elasticityMat.C1313 = shearModulus;
+        elasticityMat.C2211 = elasticityMat.C1122;
+        elasticityMat.C2222 = elasticityMat.C1111;
+        elasticityMat.C2323 = elasticityMat.C1212;
+        elasticityMat.C3311 = elasticityMat.C1122;
+        elasticityMat.C3333 = elasticityMat.C1111;
+    } else {
+        const PylithReal ae = 1.0 / (2.0 * shearModulus);
+        const PylithReal denom = 2.0 * j2Tau * j2Tpdt;
+        const PylithReal factor1 = powerLawAlpha * dt * gammaTau;
+        const PylithReal factor2 = factor1 * (powerLawExponent - 1.0) / denom;
+        const PylithReal factor3 = powerLawAlpha * factor2;
+        const PylithReal factor4 = factor2 * (1.0 - powerLawAlpha);
+
+        elasticityMat.C1111 = bulkModulus + 2 / (3 * (factor3 * devStressTpdt.xx * devStressTpdt.xx + factor1 +
+                                                      factor4 * devStressTpdt.xx * devStressT.xx + ae));
+        elasticityMat.C1122 = bulkModulus - 1 / (3 * (factor3 * devStressTpdt.xx * devStressTpdt.xx + factor1 +
+                                                      factor4 * devStressTpdt.xx * devStressT.xx + ae));
+        elasticityMat.C1212 = 1 / (2 * (factor3 * devStressTpdt.xy * devStressTpdt.xy + factor1 +
+                                        factor4 * devStressTpdt.xy * devStressT.xy + ae));
+        elasticityMat.C1313 = 1 / (2 * (factor3 * devStressTpdt.xz * devStressTpdt.xz + factor1 +
+                                        factor4 * devStressTpdt.xz * devStressT.xz + ae));
+        elasticityMat.C2211 = bulkModulus - 1 / (3 * (factor3 * devStressTpdt.yy * devStressTpdt.yy + factor1 +
+                                                      factor4 * devStressTpdt.yy * devStressT.yy + ae));
+        elasticityMat.C2222 = bulkModulus + 2 / (3 * (factor3 * devStressTpdt.yy * devStressTpdt.yy + factor1 +
+                                                      factor4 * devStressTpdt.yy * devStressT.yy + ae));
+        elasticityMat.C2323 = 1 / (2 * (factor3 * devStressTpdt.yz * devStressTpdt.yz + factor1 +
+                                        factor4 * devStressTpdt.yz * devStressT.yz + ae));
+        elasticityMat.C3311 = bulkModulus - 1 / (3 * (factor3 * devStressTpdt.zz * devStressTpdt.zz + factor1 +
+                                                      factor4 * devStressTpdt.zz * devStressT.zz + ae));
+        elasticityMat.C3333 = bulkModulus + 2 / (3 * (factor3 * devStressTpdt.zz * devStressTpdt.zz + factor1 +
+                                                      factor4 * devStressTpdt.zz * devStressT.zz + ae));
+    } // if/else
+
+    return elasticityMat;
+} // _elasticConstantsUnshared
+
+
+// End of file
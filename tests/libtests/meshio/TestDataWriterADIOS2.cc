@@ -0,0 +1,316 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/DataWriterADIOS2.hh" // Test subject
+
+#include "FieldFactory.hh" // USES FieldFactory
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <adios2.h> // USES adios2::ADIOS
+
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestDataWriterADIOS2;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestDataWriterADIOS2 : public pylith::utils::GenericComponent {
+public:
+
+    /// Test setEngine(), setEngineParameter(), and names of files.
+    static
+    void testAccessors(void);
+
+    /// Test open() setting up geometry of cells owned by process.
+    static
+    void testOpen(void);
+
+    /// Test writeVertexField() and reading time steps back from BP file.
+    static
+    void testWriteVertexField(void);
+
+private:
+
+    /** Read mesh.
+     *
+     * @param[out] mesh Finite-element mesh.
+     */
+    static
+    void _initializeMesh(pylith::topology::Mesh* mesh);
+
+}; // class TestDataWriterADIOS2
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestDataWriterADIOS2::testAccessors", "[TestDataWriterADIOS2]") {
+    pylith::meshio::TestDataWriterADIOS2::testAccessors();
+}
+TEST_CASE("TestDataWriterADIOS2::testOpen", "[TestDataWriterADIOS2]") {
+    pylith::meshio::TestDataWriterADIOS2::testOpen();
+}
+TEST_CASE("TestDataWriterADIOS2::testWriteVertexField", "[TestDataWriterADIOS2]") {
+    pylith::meshio::TestDataWriterADIOS2::testWriteVertexField();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setEngine(), setEngineParameter(), and names of files.
+void
+pylith::meshio::TestDataWriterADIOS2::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterADIOS2 writer;
+    CHECK(std::string("BP5") == writer._engine);
+    CHECK(std::string("output.bp") == writer._filename);
+
+    // Engine names are case insensitive.
+    writer.setEngine("sst");
+    CHECK(std::string("SST") == writer._engine);
+    writer.setEngine("bp4");
+    CHECK(std::string("BP4") == writer._engine);
+    CHECK_THROWS_AS(writer.setEngine("HDF5"), std::runtime_error);
+    CHECK(std::string("BP4") == writer._engine);
+
+    writer.setEngineParameter("NumAggregators", "2");
+    writer.setEngineParameter("AsyncWrite", "true");
+    writer.setEngineParameter("NumAggregators", "4");
+    REQUIRE(2 == writer._engineParameters.size());
+    CHECK(std::string("4") == writer._engineParameters["NumAggregators"]);
+    CHECK(std::string("true") == writer._engineParameters["AsyncWrite"]);
+
+    writer.filename("output/domain.bp");
+    CHECK(std::string("output/domain.bp") == writer._adios2Filename());
+    writer._isInfo = true;
+    CHECK(std::string("output/domain_info.bp") == writer._adios2Filename());
+    writer.filename("domain");
+    CHECK(std::string("domain_info.bp") == writer._adios2Filename());
+    writer._isInfo = false;
+
+    // Copy keeps settings.
+    DataWriterADIOS2* copy = dynamic_cast<DataWriterADIOS2*>(writer.clone());
+    REQUIRE(copy);
+    CHECK(std::string("BP4") == copy->_engine);
+    CHECK(std::string("domain") == copy->_filename);
+    CHECK(writer._engineParameters == copy->_engineParameters);
+    delete copy;copy = NULL;
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test open() setting up geometry of cells owned by process.
+void
+pylith::meshio::TestDataWriterADIOS2::testOpen(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    _initializeMesh(&mesh);
+    const size_t numVertices = pylith::topology::MeshOps::getNumVertices(mesh);
+    const size_t numCells = pylith::topology::MeshOps::getNumCells(mesh);
+    const size_t numCorners = 3;
+    const uint32_t vtkTriangle = 5;
+
+    DataWriterADIOS2 writer;
+    writer.filename("adios2_open.bp");
+    writer.open(mesh, false);
+    CHECK(writer._adios);
+
+    CHECK(numVertices == writer._vertices.size());
+    CHECK(3*numVertices == writer._coordinates.size());
+    REQUIRE(numCells == writer._cells.size());
+    REQUIRE(numCells == writer._cellTypes.size());
+    REQUIRE(numCells*(1+numCorners) == writer._connectivity.size());
+    for (size_t iCell = 0; iCell < numCells; ++iCell) {
+        INFO("Checking cell " << iCell << ".");
+        CHECK(vtkTriangle == writer._cellTypes[iCell]);
+        CHECK(int64_t(numCorners) == writer._connectivity[iCell*(1+numCorners)]);
+        for (size_t iCorner = 1; iCorner <= numCorners; ++iCorner) {
+            const int64_t index = writer._connectivity[iCell*(1+numCorners)+iCorner];
+            CHECK(index >= 0);
+            CHECK(index < int64_t(numVertices));
+        } // for
+    } // for
+    for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+        CHECK(0.0 == writer._coordinates[3*iVertex+2]);
+    } // for
+
+    writer.close();
+    CHECK(!writer._adios);
+    CHECK(writer._vertices.empty());
+    CHECK(writer._cells.empty());
+
+    PYLITH_METHOD_END;
+} // testOpen
+
+
+// ------------------------------------------------------------------------------------------------
+// Test writeVertexField() and reading time steps back from BP file.
+void
+pylith::meshio::TestDataWriterADIOS2::testWriteVertexField(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    _initializeMesh(&mesh);
+    const size_t numVertices = pylith::topology::MeshOps::getNumVertices(mesh);
+    const size_t numCells = pylith::topology::MeshOps::getNumCells(mesh);
+
+    pylith::topology::Field field(mesh);
+    FieldFactory factory(field);
+    factory.addVector(pylith::topology::Field::Discretization(1, 1));
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+    field.createOutputVector();
+
+    const char* filename = "adios2_vertex.bp";
+    DataWriterADIOS2 writer;
+    writer.filename(filename);
+    writer.setEngine("BP5");
+    writer.setTimeScale(2.0);
+    writer.open(mesh, false);
+
+    const size_t numTimeSteps = 2;
+    PetscErrorCode err = 0;
+    for (size_t iStep = 0; iStep < numTimeSteps; ++iStep) {
+        const PylithScalar t = 1.0 + iStep;
+        const PylithScalar value = 3.0 + iStep;
+        err = VecSet(field.getLocalVector(), value);PYLITH_CHECK_ERROR(err);
+        field.scatterLocalToOutput();
+
+        writer.openTimeStep(t, mesh);
+        OutputSubfield* subfield = OutputSubfield::create(field, mesh, "vector", 1);assert(subfield);
+        subfield->project(field.getOutputVector());
+        writer.writeVertexField(t, *subfield);
+        delete subfield;subfield = NULL;
+
+        // Vector fields in 2D are padded to 3 components.
+        REQUIRE(1 == writer._vertexFields.size());
+        const DataWriterADIOS2::DataArray& array = writer._vertexFields[0];
+        CHECK(std::string("vector") == array.name);
+        REQUIRE(3 == array.numComponents);
+        REQUIRE(3*numVertices == array.values.size());
+        for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+            INFO("Checking vertex " << iVertex << " at time step " << iStep << ".");
+            CHECK(value == array.values[3*iVertex+0]);
+            CHECK(value == array.values[3*iVertex+1]);
+            CHECK(0.0 == array.values[3*iVertex+2]);
+        } // for
+
+        writer.closeTimeStep();
+        CHECK(writer._vertexFields.empty());
+        CHECK(iStep+1 == writer._numTimeSteps);
+    } // for
+    writer.close();
+
+    // Read time steps back from file.
+    adios2::ADIOS adios(mesh.getComm());
+    adios2::IO io = adios.DeclareIO("reader");
+    io.SetEngine("BP5");
+    adios2::Engine reader = io.Open(filename, adios2::Mode::Read);
+
+    size_t iStep = 0;
+    while (adios2::StepStatus::OK == reader.BeginStep()) {
+        INFO("Checking time step " << iStep << " in file.");
+        REQUIRE(iStep < numTimeSteps);
+
+        if (0 == iStep) {
+            adios2::Attribute<std::string> schema = io.InquireAttribute<std::string>("vtk.xml");
+            REQUIRE(schema);
+            CHECK(schema.Data()[0].find("<DataArray Name=\"vector\" />") != std::string::npos);
+
+            adios2::Variable<PylithScalar> verticesVar = io.InquireVariable<PylithScalar>("vertices");
+            REQUIRE(verticesVar);
+            verticesVar.SetBlockSelection(0);
+            std::vector<PylithScalar> vertices;
+            reader.Get(verticesVar, vertices, adios2::Mode::Sync);
+            CHECK(3*numVertices == vertices.size());
+
+            adios2::Variable<uint32_t> typesVar = io.InquireVariable<uint32_t>("types");
+            REQUIRE(typesVar);
+            typesVar.SetBlockSelection(0);
+            std::vector<uint32_t> types;
+            reader.Get(typesVar, types, adios2::Mode::Sync);
+            CHECK(numCells == types.size());
+        } // if
+
+        adios2::Variable<PylithScalar> timeVar = io.InquireVariable<PylithScalar>("time");
+        REQUIRE(timeVar);
+        PylithScalar t = 0.0;
+        reader.Get(timeVar, t, adios2::Mode::Sync);
+        CHECK(2.0*(1.0+iStep) == t);
+
+        adios2::Variable<PylithScalar> fieldVar = io.InquireVariable<PylithScalar>("vector");
+        REQUIRE(fieldVar);
+        fieldVar.SetBlockSelection(0);
+        std::vector<PylithScalar> values;
+        reader.Get(fieldVar, values, adios2::Mode::Sync);
+        REQUIRE(3*numVertices == values.size());
+        const PylithScalar value = 3.0 + iStep;
+        for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+            INFO("Checking vertex " << iVertex << ".");
+            CHECK(value == values[3*iVertex+0]);
+            CHECK(value == values[3*iVertex+1]);
+            CHECK(0.0 == values[3*iVertex+2]);
+        } // for
+
+        reader.EndStep();
+        ++iStep;
+    } // while
+    reader.Close();
+    CHECK(numTimeSteps == iStep);
+
+    PYLITH_METHOD_END;
+} // testWriteVertexField
+
+
+// ------------------------------------------------------------------------------------------------
+// Read mesh.
+void
+pylith::meshio::TestDataWriterADIOS2::_initializeMesh(pylith::topology::Mesh* mesh) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(mesh->getDimension());
+    mesh->setCoordSys(&cs);
+
+    PYLITH_METHOD_END;
+} // _initializeMesh
+
+
+// End of file
@@ -26,11 +26,38 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/meshio/DataWriterHDF5Ext.hh" // USES DataWriterHDF5Ext
 #include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/meshio/HDF5.hh" // USES HDF5
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD*
 
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
 
+#include <fstream> // USES std::ifstream
+#include <algorithm> // USES std::reverse
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _TestDataWriterHDF5ExtMesh {
+public:
+
+            /** Read values from external dataset file.
+             *
+             * @param[in] filename Name of external dataset file.
+             * @param[in] isBigEndian True if values are big-endian, false if they use native byte order.
+             * @param[out] values Values in file.
+             */
+            static
+            void readValues(const std::string& filename,
+                            const bool isBigEndian,
+                            std::vector<PylithScalar>* values);
+
+        }; // _TestDataWriterHDF5ExtMesh
+    } // meshio
+} // pylith
+
+
 // ------------------------------------------------------------------------------------------------
 // Constructor.
 pylith::meshio::TestDataWriterHDF5ExtMesh::TestDataWriterHDF5ExtMesh(TestDataWriterHDF5ExtMesh_Data* data) :
@@ -62,6 +89,15 @@ pylith::meshio::TestDataWriterHDF5ExtMesh::testAccessors(void) {
     writer.filename(filename);
     CHECK(std::string(filename) == writer._filename);
 
+    CHECK(false == writer.getUseAsyncWrites());
+    writer.setUseAsyncWrites(true);
+    CHECK(true == writer.getUseAsyncWrites());
+
+    CHECK(0 == writer.getNumStepsPreallocated());
+    writer.setNumStepsPreallocated(4);
+    CHECK(4 == writer.getNumStepsPreallocated());
+    CHECK_THROWS_AS(writer.setNumStepsPreallocated(-1), std::runtime_error);
+
     PYLITH_METHOD_END;
 } // testAccessors
 
@@ -220,6 +256,146 @@ pylith::meshio::TestDataWriterHDF5ExtMesh::testWriteCellField(void) {
 } // testWriteCellField
 
 
+// ------------------------------------------------------------------------------------------------
+// Test asynchronous writes match synchronous writes.
+void
+pylith::meshio::TestDataWriterHDF5ExtMesh::testAsyncWrites(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(_data);
+
+    topology::Field vertexField(*_mesh);
+    _createVertexField(&vertexField);
+    const pylith::string_vector& subfieldNames = vertexField.getSubfieldNames();
+    const size_t numFields = subfieldNames.size();
+
+    // Write several time steps with different values, so that the double buffers are reused.
+    const int numTimeSteps = 5;
+    const char* filenames[2] = { "mesh_sync.h5", "mesh_async.h5" };
+    for (int iWriter = 0; iWriter < 2; ++iWriter) {
+        DataWriterHDF5Ext writer;
+        writer.filename(filenames[iWriter]);
+        writer.setUseAsyncWrites(1 == iWriter);
+
+        const bool isInfo = false;
+        writer.open(*_mesh, isInfo);
+        for (int iStep = 0; iStep < numTimeSteps; ++iStep) {
+            const PylithScalar t = _data->time * (1 + iStep);
+            writer.openTimeStep(t, *_mesh);
+            for (size_t i = 0; i < numFields; ++i) {
+                OutputSubfield* subfield = OutputSubfield::create(vertexField, *_mesh, subfieldNames[i].c_str(), 1);
+                assert(subfield);
+                subfield->project(vertexField.getOutputVector());
+                PetscErrorCode err = VecScale(subfield->getVector(), 1.0 + iStep);PYLITH_CHECK_ERROR(err);
+                writer.writeVertexField(t, *subfield);
+                delete subfield;subfield = NULL;
+            } // for
+            writer.closeTimeStep();
+        } // for
+        writer.close();
+    } // for
+
+    // Values in external datasets must match. Synchronous writes are big-endian.
+    const PylithScalar tolerance = 1.0e-12;
+    for (size_t i = 0; i < numFields; ++i) {
+        std::vector<PylithScalar> values[2];
+        for (int iWriter = 0; iWriter < 2; ++iWriter) {
+            DataWriterHDF5Ext writer;
+            writer.filename(filenames[iWriter]);
+            _TestDataWriterHDF5ExtMesh::readValues(writer._datasetFilename(subfieldNames[i].c_str()), 0 == iWriter,
+                                                   &values[iWriter]);
+        } // for
+        INFO("Field: " << subfieldNames[i]);
+        CHECK(values[0].size() > 0);
+        REQUIRE(values[0].size() == values[1].size());
+        for (size_t iValue = 0; iValue < values[0].size(); ++iValue) {
+            CHECK_THAT(values[1][iValue], Catch::Matchers::WithinAbs(values[0][iValue], tolerance));
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // testAsyncWrites
+
+
+// ------------------------------------------------------------------------------------------------
+// Test writes to preallocated external datasets match writes that extend datasets every time step.
+void
+pylith::meshio::TestDataWriterHDF5ExtMesh::testPreallocatedWrites(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(_data);
+
+    topology::Field vertexField(*_mesh);
+    _createVertexField(&vertexField);
+    const pylith::string_vector& subfieldNames = vertexField.getSubfieldNames();
+    const size_t numFields = subfieldNames.size();
+
+    // Write more time steps than fit in one preallocated block, so the datasets are extended.
+    const int numTimeSteps = 5;
+    const int numStepsPreallocated = 2;
+    const char* filenames[2] = { "mesh_extend.h5", "mesh_prealloc.h5" };
+    for (int iWriter = 0; iWriter < 2; ++iWriter) {
+        DataWriterHDF5Ext writer;
+        writer.filename(filenames[iWriter]);
+        writer.setNumStepsPreallocated((1 == iWriter) ? numStepsPreallocated : 0);
+
+        const bool isInfo = false;
+        writer.open(*_mesh, isInfo);
+        for (int iStep = 0; iStep < numTimeSteps; ++iStep) {
+            const PylithScalar t = _data->time * (1 + iStep);
+            writer.openTimeStep(t, *_mesh);
+            for (size_t i = 0; i < numFields; ++i) {
+                OutputSubfield* subfield = OutputSubfield::create(vertexField, *_mesh, subfieldNames[i].c_str(), 1);
+                assert(subfield);
+                subfield->project(vertexField.getOutputVector());
+                PetscErrorCode err = VecScale(subfield->getVector(), 1.0 + iStep);PYLITH_CHECK_ERROR(err);
+                writer.writeVertexField(t, *subfield);
+                delete subfield;subfield = NULL;
+            } // for
+            writer.closeTimeStep();
+        } // for
+        writer.close();
+    } // for
+
+    // HDF5 datasets are sized in whole blocks of time steps; the time stamps give the number of time steps written.
+    HDF5 h5(filenames[1], H5F_ACC_RDONLY);
+    hsize_t* dims = NULL;
+    int ndims = 0;
+    h5.getDatasetDims(&dims, &ndims, "/", "time");
+    REQUIRE(ndims > 0);
+    CHECK(hsize_t(numTimeSteps) == dims[0]);
+    for (size_t i = 0; i < numFields; ++i) {
+        h5.getDatasetDims(&dims, &ndims, "/vertex_fields", subfieldNames[i].c_str());
+        REQUIRE(3 == ndims);
+        CHECK(0 == dims[0] % numStepsPreallocated);
+        CHECK(dims[0] >= hsize_t(numTimeSteps));
+    } // for
+    delete[] dims;dims = NULL;
+    h5.close();
+
+    // Values written must match. Extending datasets uses big-endian values, and preallocated files may be larger
+    // than the values written.
+    const PylithScalar tolerance = 1.0e-12;
+    for (size_t i = 0; i < numFields; ++i) {
+        std::vector<PylithScalar> values[2];
+        for (int iWriter = 0; iWriter < 2; ++iWriter) {
+            DataWriterHDF5Ext writer;
+            writer.filename(filenames[iWriter]);
+            _TestDataWriterHDF5ExtMesh::readValues(writer._datasetFilename(subfieldNames[i].c_str()), 0 == iWriter,
+                                                   &values[iWriter]);
+        } // for
+        INFO("Field: " << subfieldNames[i]);
+        CHECK(values[0].size() > 0);
+        REQUIRE(values[0].size() <= values[1].size());
+        for (size_t iValue = 0; iValue < values[0].size(); ++iValue) {
+            CHECK_THAT(values[1][iValue], Catch::Matchers::WithinAbs(values[0][iValue], tolerance));
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // testPreallocatedWrites
+
+
 // ------------------------------------------------------------------------------------------------
 // Get test data.
 pylith::meshio::TestDataWriter_Data*
@@ -229,3 +405,33 @@ pylith::meshio::TestDataWriterHDF5ExtMesh::_getData(void) {
 
 
 // End of file
+
+
+// ------------------------------------------------------------------------------------------------
+// Read values from external dataset file.
+void
+pylith::meshio::_TestDataWriterHDF5ExtMesh::readValues(const std::string& filename,
+                                                       const bool isBigEndian,
+                                                       std::vector<PylithScalar>* values) {
+    assert(values);
+
+    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
+    REQUIRE(fin.is_open());
+    fin.seekg(0, std::ios::end);
+    const size_t numValues = size_t(fin.tellg()) / sizeof(PylithScalar);
+    fin.seekg(0, std::ios::beg);
+    values->resize(numValues);
+    if (numValues > 0) {
+        fin.read(reinterpret_cast<char*>(&(*values)[0]), numValues*sizeof(PylithScalar));
+    } // if
+    REQUIRE(fin.good());
+
+    const int one = 1;
+    const bool isHostLittleEndian = 1 == *reinterpret_cast<const char*>(&one);
+    if (isBigEndian && isHostLittleEndian) {
+        for (size_t i = 0; i < numValues; ++i) {
+            char* bytes = reinterpret_cast<char*>(&(*values)[i]);
+            std::reverse(bytes, bytes + sizeof(PylithScalar));
+        } // for
+    } // if
+} // readValues
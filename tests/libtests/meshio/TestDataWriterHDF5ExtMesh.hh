@@ -72,6 +72,12 @@ public:
     /// Test writeCellField.
     void testWriteCellField(void);
 
+    /// Test asynchronous writes match synchronous writes.
+    void testAsyncWrites(void);
+
+    /// Test writes to preallocated external datasets match writes that extend datasets every time step.
+    void testPreallocatedWrites(void);
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -65,6 +65,12 @@ TEST_CASE("TestDataWriterHDF5ExtMesh::Tri::testWriteVertexField", "[DataWriter][
 TEST_CASE("TestDataWriterHDF5ExtMesh::Tri::testWriteCellField", "[DataWriter][HDF5Ext][Mesh][Tri][testWriteCellField]") {
     pylith::meshio::TestDataWriterHDF5ExtMesh(pylith::meshio::TestDataWriterHDF5ExtMesh_Cases::Tri()).testWriteCellField();
 }
+TEST_CASE("TestDataWriterHDF5ExtMesh::Tri::testAsyncWrites", "[DataWriter][HDF5Ext][Mesh][Tri][testAsyncWrites]") {
+    pylith::meshio::TestDataWriterHDF5ExtMesh(pylith::meshio::TestDataWriterHDF5ExtMesh_Cases::Tri()).testAsyncWrites();
+}
+TEST_CASE("TestDataWriterHDF5ExtMesh::Tri::testPreallocatedWrites", "[DataWriter][HDF5Ext][Mesh][Tri][testPreallocatedWrites]") {
+    pylith::meshio::TestDataWriterHDF5ExtMesh(pylith::meshio::TestDataWriterHDF5ExtMesh_Cases::Tri()).testPreallocatedWrites();
+}
 
 TEST_CASE("TestDataWriterHDF5ExtMesh::Quad::testOpenClose", "[DataWriter][HDF5Ext][Mesh][Quad][testOpenClose]") {
     pylith::meshio::TestDataWriterHDF5ExtMesh(pylith::meshio::TestDataWriterHDF5ExtMesh_Cases::Quad()).testOpenClose();
@@ -0,0 +1,170 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/DataWriterHDF5GreensFns.hh" // Test subject
+
+#include "FieldFactory.hh" // USES FieldFactory
+
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestDataWriterHDF5GreensFns;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestDataWriterHDF5GreensFns : public pylith::utils::GenericComponent {
+public:
+
+    /// Test setBlockSize() and getBlockSize().
+    static
+    void testAccessors(void);
+
+    /// Test writing impulses as rows of matrix over several blocks.
+    static
+    void testWriteVertexField(void);
+
+}; // class TestDataWriterHDF5GreensFns
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestDataWriterHDF5GreensFns::testAccessors", "[TestDataWriterHDF5GreensFns]") {
+    pylith::meshio::TestDataWriterHDF5GreensFns::testAccessors();
+}
+TEST_CASE("TestDataWriterHDF5GreensFns::testWriteVertexField", "[TestDataWriterHDF5GreensFns]") {
+    pylith::meshio::TestDataWriterHDF5GreensFns::testWriteVertexField();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setBlockSize() and getBlockSize().
+void
+pylith::meshio::TestDataWriterHDF5GreensFns::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterHDF5GreensFns writer;
+    CHECK(size_t(64) == writer.getBlockSize());
+
+    writer.setBlockSize(5);
+    CHECK(size_t(5) == writer.getBlockSize());
+
+    CHECK_THROWS_AS(writer.setBlockSize(0), std::runtime_error);
+    CHECK(size_t(5) == writer.getBlockSize());
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test writing impulses as rows of matrix over several blocks.
+void
+pylith::meshio::TestDataWriterHDF5GreensFns::testWriteVertexField(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(&mesh);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(mesh.getDimension());
+    mesh.setCoordSys(&cs);
+
+    pylith::topology::Field field(mesh);
+    FieldFactory factory(field);
+    factory.addVector(pylith::topology::Field::Discretization(1, 1));
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+    field.createOutputVector();
+
+    const char* filename = "greensfns.h5";
+    const size_t numImpulses = 5;
+    DataWriterHDF5GreensFns writer;
+    writer.filename(filename);
+    writer.setBlockSize(2); // Two full blocks and one partial block written when closing.
+
+    // Row i of the matrix holds the value 1+i for all points and components.
+    PetscErrorCode err = 0;
+    PetscInt numColumns = 0;
+    writer.open(mesh, false);
+    for (size_t i = 0; i < numImpulses; ++i) {
+        const PylithScalar t = i;
+        err = VecSet(field.getLocalVector(), 1.0+i);PYLITH_CHECK_ERROR(err);
+        field.scatterLocalToOutput();
+
+        writer.openTimeStep(t, mesh);
+        OutputSubfield* subfield = OutputSubfield::create(field, mesh, "vector", 1);assert(subfield);
+        subfield->project(field.getOutputVector());
+        err = VecGetSize(subfield->getVector(), &numColumns);PYLITH_CHECK_ERROR(err);
+        writer.writeVertexField(t, *subfield);
+        delete subfield;subfield = NULL;
+        writer.closeTimeStep();
+    } // for
+    writer.close();
+
+    HDF5 h5(filename, H5F_ACC_RDONLY);
+    REQUIRE(h5.hasDataset("/greens_functions/vector"));
+    hsize_t* dims = NULL;
+    int ndims = 0;
+    h5.getDatasetDims(&dims, &ndims, "/greens_functions", "vector");
+    REQUIRE(2 == ndims);
+    CHECK(hsize_t(numImpulses) == dims[0]);
+    CHECK(hsize_t(numColumns) == dims[1]);
+    delete[] dims;dims = NULL;
+
+    int fiberDim = 0;
+    h5.readAttribute("/greens_functions/vector", "fiber_dim", &fiberDim, H5T_NATIVE_INT);
+    CHECK(mesh.getDimension() == fiberDim);
+    int basisOrder = -1;
+    h5.readAttribute("/greens_functions/vector", "basis_order", &basisOrder, H5T_NATIVE_INT);
+    CHECK(1 == basisOrder);
+    CHECK(std::string("vector") == h5.readAttribute("/greens_functions/vector", "vector_field_type"));
+
+    std::vector<PylithScalar> row(numColumns);
+    const hsize_t count[2] = { 1, hsize_t(numColumns) };
+    const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    for (size_t i = 0; i < numImpulses; ++i) {
+        const hsize_t offset[2] = { i, 0 };
+        h5.readDatasetHyperslab("/greens_functions", "vector", &row[0], offset, count, 2, scalartype);
+        INFO("Checking row " << i << " of Green's functions matrix.");
+        for (PetscInt j = 0; j < numColumns; ++j) {
+            CHECK(PylithScalar(1.0+i) == row[j]);
+        } // for
+    } // for
+    h5.close();
+
+    PYLITH_METHOD_END;
+} // testWriteVertexField
+
+
+// End of file
@@ -24,11 +24,15 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/meshio/DataWriterHDF5.hh" // USES DataWriterHDF5
 #include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/meshio/HDF5.hh" // USES HDF5
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
 
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+
 // ------------------------------------------------------------------------------------------------
 // Constructor.
 pylith::meshio::TestDataWriterHDF5Mesh::TestDataWriterHDF5Mesh(TestDataWriterHDF5Mesh_Data* data) :
@@ -60,6 +64,24 @@ pylith::meshio::TestDataWriterHDF5Mesh::testAccessors(void) {
     writer.filename(filename);
     CHECK(std::string(filename) == writer._filename);
 
+    CHECK(!writer._useFilteredDatasets());
+
+    writer.setCompression(DataWriterHDF5::COMPRESSION_DEFLATE, 4);
+    CHECK(DataWriterHDF5::COMPRESSION_DEFLATE == writer._compression);
+    CHECK(4 == writer._compressionLevel);
+    CHECK(writer._useFilteredDatasets());
+    CHECK_THROWS_AS(writer.setCompression(DataWriterHDF5::COMPRESSION_DEFLATE, 10), std::runtime_error);
+    CHECK_THROWS_AS(writer.setCompression(DataWriterHDF5::COMPRESSION_SZIP, 7), std::runtime_error);
+
+    writer.setChunkShape(64, 512);
+    CHECK(size_t(64) == writer._chunkNumTimeSteps);
+    CHECK(size_t(512) == writer._chunkNumPoints);
+    CHECK_THROWS_AS(writer.setChunkShape(0, 512), std::runtime_error);
+
+    writer.setMantissaBits(16);
+    CHECK(16 == writer._mantissaBits);
+    CHECK_THROWS_AS(writer.setMantissaBits(-1), std::runtime_error);
+
     PYLITH_METHOD_END;
 } // testAccessors
 
@@ -193,6 +215,121 @@ pylith::meshio::TestDataWriterHDF5Mesh::testWriteCellField(void) {
 } // testWriteCellField
 
 
+// ------------------------------------------------------------------------------------------------
+// Test buffered writes of time steps to chunked datasets match unbuffered writes.
+void
+pylith::meshio::TestDataWriterHDF5Mesh::testBufferedWrites(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(_data);
+
+    pylith::topology::Field vertexField(*_mesh);
+    _createVertexField(&vertexField);
+    const pylith::string_vector& subfieldNames = vertexField.getSubfieldNames();
+    const size_t numFields = subfieldNames.size();
+
+    // Number of time steps is not a multiple of the number of time steps in a chunk, so the last block is written at
+    // close().
+    const int numTimeSteps = 5;
+    const size_t chunkNumTimeSteps = 2;
+    const char* filenames[2] = { "mesh_unbuffered.h5", "mesh_buffered.h5" };
+    for (int iWriter = 0; iWriter < 2; ++iWriter) {
+        DataWriterHDF5 writer;
+        writer.filename(filenames[iWriter]);
+        if (1 == iWriter) {
+            writer.setChunkShape(chunkNumTimeSteps, 1);
+        } // if
+
+        const bool isInfo = false;
+        writer.open(*_mesh, isInfo);
+        for (int iStep = 0; iStep < numTimeSteps; ++iStep) {
+            const PylithScalar t = _data->time * (1 + iStep);
+            writer.openTimeStep(t, *_mesh);
+            for (size_t i = 0; i < numFields; ++i) {
+                OutputSubfield* subfield = OutputSubfield::create(vertexField, *_mesh, subfieldNames[i].c_str(), 1);
+                assert(subfield);
+                subfield->project(vertexField.getOutputVector());
+                PetscErrorCode err = VecScale(subfield->getVector(), 1.0 + iStep);PYLITH_CHECK_ERROR(err);
+                writer.writeVertexField(t, *subfield);
+                delete subfield;subfield = NULL;
+            } // for
+            writer.closeTimeStep();
+
+            if (1 == iWriter) {
+                // Time steps are buffered until the chunks are full.
+                const size_t numStepsBuffered = (iStep+1) % chunkNumTimeSteps;
+                CHECK(numFields == writer._buffers.size());
+                for (size_t i = 0; i < numFields; ++i) {
+                    const std::string fullName = std::string("/vertex_fields/") + subfieldNames[i];
+                    REQUIRE(writer._buffers.count(fullName) > 0);
+                    INFO("Field: " << subfieldNames[i] << ", time step: " << iStep);
+                    CHECK(numStepsBuffered == writer._buffers[fullName].numSteps);
+                } // for
+            } // if
+        } // for
+        writer.close();
+        CHECK(writer._buffers.empty());
+    } // for
+
+    // Buffered time steps must be flushed at close() and values written must match.
+    HDF5 h5Unbuffered(filenames[0], H5F_ACC_RDONLY);
+    HDF5 h5Buffered(filenames[1], H5F_ACC_RDONLY);
+    const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    const PylithScalar tolerance = 1.0e-12;
+    for (size_t i = 0; i < numFields; ++i) {
+        INFO("Field: " << subfieldNames[i]);
+        hsize_t* dims = NULL;
+        int ndims = 0;
+        h5Unbuffered.getDatasetDims(&dims, &ndims, "/vertex_fields", subfieldNames[i].c_str());
+        REQUIRE(3 == ndims);
+        const hsize_t dimsE[3] = { dims[0], dims[1], dims[2] };
+        CHECK(hsize_t(numTimeSteps) == dimsE[0]);
+        h5Buffered.getDatasetDims(&dims, &ndims, "/vertex_fields", subfieldNames[i].c_str());
+        REQUIRE(3 == ndims);
+        for (int iDim = 0; iDim < ndims; ++iDim) {
+            CHECK(dimsE[iDim] == dims[iDim]);
+        } // for
+        delete[] dims;dims = NULL;
+
+        const hsize_t offset[3] = { 0, 0, 0 };
+        const size_t numValues = dimsE[0] * dimsE[1] * dimsE[2];
+        std::vector<PylithScalar> valuesE(numValues);
+        std::vector<PylithScalar> values(numValues);
+        h5Unbuffered.readDatasetHyperslab("/vertex_fields", subfieldNames[i].c_str(), &valuesE[0], offset, dimsE, 3,
+                                          scalartype);
+        h5Buffered.readDatasetHyperslab("/vertex_fields", subfieldNames[i].c_str(), &values[0], offset, dimsE, 3,
+                                        scalartype);
+        for (size_t iValue = 0; iValue < numValues; ++iValue) {
+            CHECK_THAT(values[iValue], Catch::Matchers::WithinAbs(valuesE[iValue], tolerance));
+        } // for
+    } // for
+    h5Unbuffered.close();
+    h5Buffered.close();
+
+    // Chunks span multiple time steps and a single point (point-major layout).
+    hid_t h5 = H5Fopen(filenames[1], H5F_ACC_RDONLY, H5P_DEFAULT);
+    REQUIRE(h5 >= 0);
+    for (size_t i = 0; i < numFields; ++i) {
+        INFO("Field: " << subfieldNames[i]);
+        const std::string fullName = std::string("/vertex_fields/") + subfieldNames[i];
+        hid_t dataset = H5Dopen2(h5, fullName.c_str(), H5P_DEFAULT);
+        REQUIRE(dataset >= 0);
+        hid_t property = H5Dget_create_plist(dataset);
+        REQUIRE(property >= 0);
+        REQUIRE(H5D_CHUNKED == H5Pget_layout(property));
+        hsize_t dimsChunk[3];
+        REQUIRE(3 == H5Pget_chunk(property, 3, dimsChunk));
+        CHECK(hsize_t(chunkNumTimeSteps) == dimsChunk[0]);
+        CHECK(hsize_t(1) == dimsChunk[1]);
+        H5Pclose(property);
+        H5Dclose(dataset);
+    } // for
+    H5Fclose(h5);
+
+    PYLITH_METHOD_END;
+} // testBufferedWrites
+
+
 // ------------------------------------------------------------------------------------------------
 // Get test data.
 pylith::meshio::TestDataWriter_Data*
@@ -68,6 +68,9 @@ public:
     /// Test writeCellField.
     void testWriteCellField(void);
 
+    /// Test buffered writes of time steps to chunked datasets match unbuffered writes.
+    void testBufferedWrites(void);
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
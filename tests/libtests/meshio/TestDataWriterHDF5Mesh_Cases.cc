@@ -62,6 +62,9 @@ TEST_CASE("TestDataWriterHDF5Mesh::Tri::testWriteVertexField", "[DataWriter][HDF
 TEST_CASE("TestDataWriterHDF5Mesh::Tri::testWriteCellField", "[DataWriter][HDF5][Mesh][Tri][testWriteCellField]") {
     pylith::meshio::TestDataWriterHDF5Mesh(pylith::meshio::TestDataWriterHDF5Mesh_Cases::Tri()).testWriteCellField();
 }
+TEST_CASE("TestDataWriterHDF5Mesh::Tri::testBufferedWrites", "[DataWriter][HDF5][Mesh][Tri][testBufferedWrites]") {
+    pylith::meshio::TestDataWriterHDF5Mesh(pylith::meshio::TestDataWriterHDF5Mesh_Cases::Tri()).testBufferedWrites();
+}
 
 TEST_CASE("TestDataWriterHDF5Mesh::Quad::testOpenClose", "[DataWriter][HDF5][Mesh][Quad][testOpenClose]") {
     pylith::meshio::TestDataWriterHDF5Mesh(pylith::meshio::TestDataWriterHDF5Mesh_Cases::Quad()).testOpenClose();
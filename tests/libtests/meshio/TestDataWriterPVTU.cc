@@ -0,0 +1,282 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/DataWriterPVTU.hh" // Test subject
+
+#include "FieldFactory.hh" // USES FieldFactory
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <fstream> // USES std::ifstream
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestDataWriterPVTU;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestDataWriterPVTU : public pylith::utils::GenericComponent {
+public:
+
+    /// Test timeConstant() and names of files.
+    static
+    void testFilenames(void);
+
+    /// Test open() setting up geometry of cells owned by process.
+    static
+    void testOpen(void);
+
+    /// Test writeVertexField() and files written for each time step.
+    static
+    void testWriteVertexField(void);
+
+private:
+
+    /** Read mesh.
+     *
+     * @param[out] mesh Finite-element mesh.
+     */
+    static
+    void _initializeMesh(pylith::topology::Mesh* mesh);
+
+    /** Read contents of file.
+     *
+     * @param[in] filename Name of file.
+     * @returns Contents of file.
+     */
+    static
+    std::string _readFile(const std::string& filename);
+
+}; // class TestDataWriterPVTU
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestDataWriterPVTU::testFilenames", "[TestDataWriterPVTU]") {
+    pylith::meshio::TestDataWriterPVTU::testFilenames();
+}
+TEST_CASE("TestDataWriterPVTU::testOpen", "[TestDataWriterPVTU]") {
+    pylith::meshio::TestDataWriterPVTU::testOpen();
+}
+TEST_CASE("TestDataWriterPVTU::testWriteVertexField", "[TestDataWriterPVTU]") {
+    pylith::meshio::TestDataWriterPVTU::testWriteVertexField();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test timeConstant() and names of files.
+void
+pylith::meshio::TestDataWriterPVTU::testFilenames(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterPVTU writer;
+    CHECK_THROWS_AS(writer.timeConstant(0.0), std::runtime_error);
+    CHECK_THROWS_AS(writer.timeConstant(-1.0), std::runtime_error);
+
+    writer.filename("output/domain.pvtu");
+    writer.timeFormat("%05.2f");
+    writer.timeConstant(2.0);
+    CHECK(std::string("output/domain") == writer._baseFilename());
+    CHECK(std::string("output/domain_t0150.pvtu") == writer._pvtuFilename(3.0));
+
+    writer.filename("domain");
+    CHECK(std::string("domain") == writer._baseFilename());
+
+    CHECK(std::string("output/domain_t0150_p3.vtu") == DataWriterPVTU::_vtuFilename("output/domain_t0150.pvtu", 3));
+
+    PYLITH_METHOD_END;
+} // testFilenames
+
+
+// ------------------------------------------------------------------------------------------------
+// Test open() setting up geometry of cells owned by process.
+void
+pylith::meshio::TestDataWriterPVTU::testOpen(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    _initializeMesh(&mesh);
+    const size_t numVertices = pylith::topology::MeshOps::getNumVertices(mesh);
+    const size_t numCells = pylith::topology::MeshOps::getNumCells(mesh);
+    const size_t numCorners = 3;
+    const unsigned char vtkTriangle = 5;
+
+    DataWriterPVTU writer;
+    writer.filename("pvtu_open.pvtu");
+    writer.open(mesh, false);
+
+    CHECK(numVertices == writer._vertices.size());
+    CHECK(3*numVertices == writer._coordinates.size());
+    REQUIRE(numCells == writer._cells.size());
+    REQUIRE(numCells == writer._offsets.size());
+    REQUIRE(numCells == writer._cellTypes.size());
+    CHECK(numCells*numCorners == writer._connectivity.size());
+    for (size_t iCell = 0; iCell < numCells; ++iCell) {
+        INFO("Checking cell " << iCell << ".");
+        CHECK(PylithInt((iCell+1)*numCorners) == writer._offsets[iCell]);
+        CHECK(vtkTriangle == writer._cellTypes[iCell]);
+    } // for
+    for (size_t i = 0; i < writer._connectivity.size(); ++i) {
+        CHECK(writer._connectivity[i] >= 0);
+        CHECK(writer._connectivity[i] < PylithInt(numVertices));
+    } // for
+    for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+        CHECK(0.0 == writer._coordinates[3*iVertex+2]);
+    } // for
+
+    writer.close();
+    CHECK(writer._vertices.empty());
+    CHECK(writer._cells.empty());
+
+    PYLITH_METHOD_END;
+} // testOpen
+
+
+// ------------------------------------------------------------------------------------------------
+// Test writeVertexField() and files written for each time step.
+void
+pylith::meshio::TestDataWriterPVTU::testWriteVertexField(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    _initializeMesh(&mesh);
+    const size_t numVertices = pylith::topology::MeshOps::getNumVertices(mesh);
+
+    pylith::topology::Field field(mesh);
+    FieldFactory factory(field);
+    factory.addVector(pylith::topology::Field::Discretization(1, 1));
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+    field.createOutputVector();
+
+    DataWriterPVTU writer;
+    writer.filename("pvtu_vertex.pvtu");
+    writer.timeFormat("%3.1f");
+    writer.open(mesh, false);
+
+    const size_t numTimeSteps = 2;
+    const char* stepFilenames[numTimeSteps] = { "pvtu_vertex_t10.pvtu", "pvtu_vertex_t20.pvtu" };
+    PetscErrorCode err = 0;
+    for (size_t iStep = 0; iStep < numTimeSteps; ++iStep) {
+        const PylithScalar t = 1.0 + iStep;
+        const PylithScalar value = 3.0 + iStep;
+        err = VecSet(field.getLocalVector(), value);PYLITH_CHECK_ERROR(err);
+        field.scatterLocalToOutput();
+
+        writer.openTimeStep(t, mesh);
+        OutputSubfield* subfield = OutputSubfield::create(field, mesh, "vector", 1);assert(subfield);
+        subfield->project(field.getOutputVector());
+        writer.writeVertexField(t, *subfield);
+        delete subfield;subfield = NULL;
+
+        // Vector fields in 2D are padded to 3 components.
+        REQUIRE(1 == writer._vertexFields.size());
+        const DataWriterPVTU::DataArray& array = writer._vertexFields[0];
+        CHECK(std::string("vector") == array.name);
+        REQUIRE(3 == array.numComponents);
+        REQUIRE(3*numVertices == array.values.size());
+        for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+            INFO("Checking vertex " << iVertex << " at time step " << iStep << ".");
+            CHECK(value == array.values[3*iVertex+0]);
+            CHECK(value == array.values[3*iVertex+1]);
+            CHECK(0.0 == array.values[3*iVertex+2]);
+        } // for
+
+        writer.closeTimeStep();
+        CHECK(writer._vertexFields.empty());
+
+        const std::string& pvtu = _readFile(stepFilenames[iStep]);
+        CHECK(pvtu.find("<VTKFile type=\"PUnstructuredGrid\"") != std::string::npos);
+        CHECK(pvtu.find("Name=\"vector\" NumberOfComponents=\"3\"") != std::string::npos);
+        std::ostringstream piece;
+        piece << "<Piece Source=\"" << DataWriterPVTU::_vtuFilename(stepFilenames[iStep], 0) << "\"/>";
+        CHECK(pvtu.find(piece.str()) != std::string::npos);
+
+        const std::string& vtu = _readFile(DataWriterPVTU::_vtuFilename(stepFilenames[iStep], 0));
+        std::ostringstream pieceSize;
+        pieceSize << "<Piece NumberOfPoints=\"" << numVertices << "\" NumberOfCells=\""
+                  << pylith::topology::MeshOps::getNumCells(mesh) << "\">";
+        CHECK(vtu.find(pieceSize.str()) != std::string::npos);
+        CHECK(vtu.find("<AppendedData encoding=\"raw\">") != std::string::npos);
+    } // for
+    writer.close();
+
+    // Collection lists every time step.
+    const std::string& pvd = _readFile("pvtu_vertex.pvd");
+    for (size_t iStep = 0; iStep < numTimeSteps; ++iStep) {
+        std::ostringstream dataset;
+        dataset << "<DataSet timestep=\"" << 1.0+iStep << "\" group=\"\" part=\"0\" file=\"" << stepFilenames[iStep] << "\"/>";
+        INFO("Checking time step " << iStep << " in collection.");
+        CHECK(pvd.find(dataset.str()) != std::string::npos);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testWriteVertexField
+
+
+// ------------------------------------------------------------------------------------------------
+// Read mesh.
+void
+pylith::meshio::TestDataWriterPVTU::_initializeMesh(pylith::topology::Mesh* mesh) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(mesh->getDimension());
+    mesh->setCoordSys(&cs);
+
+    PYLITH_METHOD_END;
+} // _initializeMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Read contents of file.
+std::string
+pylith::meshio::TestDataWriterPVTU::_readFile(const std::string& filename) {
+    PYLITH_METHOD_BEGIN;
+
+    std::ifstream fin(filename.c_str());
+    INFO("Opening file '" << filename << "'.");
+    REQUIRE(fin.is_open());
+    std::ostringstream contents;
+    contents << fin.rdbuf();
+    fin.close();
+
+    PYLITH_METHOD_RETURN(contents.str());
+} // _readFile
+
+
+// End of file
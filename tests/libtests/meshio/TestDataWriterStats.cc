@@ -0,0 +1,211 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/DataWriterStats.hh" // Test subject
+
+#include "FieldFactory.hh" // USES FieldFactory
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <algorithm> // USES std::min(), std::max()
+#include <cfloat> // USES DBL_MAX
+#include <cmath> // USES sqrt()
+#include <fstream> // USES std::ifstream
+#include <string> // USES std::string, std::getline()
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestDataWriterStats;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestDataWriterStats : public pylith::utils::GenericComponent {
+public:
+
+    /// Test setFilename(), getFilename(), and setPrecision().
+    static
+    void testAccessors(void);
+
+    /// Test writeVertexField() for a vector field over two time steps.
+    static
+    void testWriteVertexField(void);
+
+}; // class TestDataWriterStats
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestDataWriterStats::testAccessors", "[TestDataWriterStats]") {
+    pylith::meshio::TestDataWriterStats::testAccessors();
+}
+TEST_CASE("TestDataWriterStats::testWriteVertexField", "[TestDataWriterStats]") {
+    pylith::meshio::TestDataWriterStats::testWriteVertexField();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setFilename(), getFilename(), and setPrecision().
+void
+pylith::meshio::TestDataWriterStats::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterStats writer;
+    CHECK(std::string("") == std::string(writer.getFilename()));
+    CHECK(6 == writer._precision);
+
+    writer.setFilename("stats.txt");
+    CHECK(std::string("stats.txt") == std::string(writer.getFilename()));
+
+    writer.setPrecision(10);
+    CHECK(10 == writer._precision);
+    CHECK_THROWS_AS(writer.setPrecision(0), std::runtime_error);
+    CHECK(10 == writer._precision);
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test writeVertexField() for a vector field over two time steps.
+void
+pylith::meshio::TestDataWriterStats::testWriteVertexField(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(&mesh);
+    spatialdata::geocoords::CSCart cs;
+    const int spaceDim = mesh.getDimension();
+    cs.setSpaceDim(spaceDim);
+    mesh.setCoordSys(&cs);
+
+    pylith::topology::Field field(mesh);
+    FieldFactory factory(field);
+    factory.addVector(pylith::topology::Field::Discretization(1, 1));
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+    field.createOutputVector();
+
+    const char* filename = "stats.txt";
+    const PylithScalar timeScale = 2.0;
+    const size_t numTimeSteps = 2;
+    DataWriterStats writer;
+    writer.setFilename(filename);
+    writer.setPrecision(14);
+    writer.setTimeScale(timeScale);
+
+    // Expected values per time step and component: min, max, L2 norm.
+    std::vector<PylithScalar> statsE(numTimeSteps*spaceDim*3);
+
+    PetscErrorCode err = 0;
+    writer.open(mesh, false);
+    for (size_t iStep = 0; iStep < numTimeSteps; ++iStep) {
+        const PylithScalar t = 1.0 + iStep;
+
+        // Values alternate in sign and grow with the index, so each component has a distinct min, max, and norm.
+        PetscScalar* values = NULL;
+        PetscInt numValues = 0;
+        err = VecGetLocalSize(field.getLocalVector(), &numValues);PYLITH_CHECK_ERROR(err);
+        err = VecGetArray(field.getLocalVector(), &values);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numValues; ++i) {
+            values[i] = ((i % 2) ? -1.0 : 1.0) * t * (1.0 + i);
+        } // for
+        err = VecRestoreArray(field.getLocalVector(), &values);PYLITH_CHECK_ERROR(err);
+        field.scatterLocalToOutput();
+
+        writer.openTimeStep(t, mesh);
+        OutputSubfield* subfield = OutputSubfield::create(field, mesh, "vector", 1);assert(subfield);
+        subfield->project(field.getOutputVector());
+
+        PylithScalar* statsStep = &statsE[iStep*spaceDim*3];
+        for (int iComponent = 0; iComponent < spaceDim; ++iComponent) {
+            statsStep[3*iComponent+0] = DBL_MAX;
+            statsStep[3*iComponent+1] = -DBL_MAX;
+            statsStep[3*iComponent+2] = 0.0;
+        } // for
+        const PetscScalar* subfieldValues = NULL;
+        PetscInt numSubfieldValues = 0;
+        err = VecGetLocalSize(subfield->getVector(), &numSubfieldValues);PYLITH_CHECK_ERROR(err);
+        err = VecGetArrayRead(subfield->getVector(), &subfieldValues);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numSubfieldValues; ++i) {
+            const int iComponent = i % spaceDim;
+            statsStep[3*iComponent+0] = std::min(statsStep[3*iComponent+0], subfieldValues[i]);
+            statsStep[3*iComponent+1] = std::max(statsStep[3*iComponent+1], subfieldValues[i]);
+            statsStep[3*iComponent+2] += subfieldValues[i]*subfieldValues[i];
+        } // for
+        err = VecRestoreArrayRead(subfield->getVector(), &subfieldValues);PYLITH_CHECK_ERROR(err);
+        for (int iComponent = 0; iComponent < spaceDim; ++iComponent) {
+            statsStep[3*iComponent+2] = sqrt(statsStep[3*iComponent+2]);
+        } // for
+
+        writer.writeVertexField(t, *subfield);
+        delete subfield;subfield = NULL;
+        writer.closeTimeStep();
+    } // for
+    writer.close();
+
+    std::ifstream fin(filename);
+    REQUIRE(fin.is_open());
+    std::string header;
+    std::getline(fin, header);
+    CHECK(std::string("# time subfield component min max l2_norm") == header);
+
+    const char* componentNames[3] = { "vector_x", "vector_y", "vector_z" };
+    const PylithScalar tolerance = 1.0e-10;
+    for (size_t iStep = 0; iStep < numTimeSteps; ++iStep) {
+        for (int iComponent = 0; iComponent < spaceDim; ++iComponent) {
+            PylithScalar t = 0.0, minValue = 0.0, maxValue = 0.0, l2Norm = 0.0;
+            std::string label, component;
+            fin >> t >> label >> component >> minValue >> maxValue >> l2Norm;
+            REQUIRE(fin.good());
+
+            INFO("Checking component " << componentNames[iComponent] << " at time step " << iStep << ".");
+            const PylithScalar* statsComponent = &statsE[(iStep*spaceDim+iComponent)*3];
+            CHECK_THAT(t, Catch::Matchers::WithinRel(timeScale*(1.0+iStep), tolerance));
+            CHECK(std::string("vector") == label);
+            CHECK(std::string(componentNames[iComponent]) == component);
+            CHECK_THAT(minValue, Catch::Matchers::WithinRel(statsComponent[0], tolerance));
+            CHECK_THAT(maxValue, Catch::Matchers::WithinRel(statsComponent[1], tolerance));
+            CHECK_THAT(l2Norm, Catch::Matchers::WithinRel(statsComponent[2], tolerance));
+        } // for
+    } // for
+    std::string extra;
+    fin >> extra;
+    CHECK(fin.eof());
+    fin.close();
+
+    PYLITH_METHOD_END;
+} // testWriteVertexField
+
+
+// End of file
@@ -62,6 +62,25 @@ pylith::meshio::TestMeshIOPetsc::testFilename(void) {
 } // testFilename
 
 
+// ------------------------------------------------------------------------------------------------
+// Test setHDF5Layout() and setFixGmshLabels().
+void
+pylith::meshio::TestMeshIOPetsc::testHDF5Options(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_io);
+
+    CHECK(MeshIOPetsc::HDF5_PETSC == _io->getHDF5Layout());
+    _io->setHDF5Layout(MeshIOPetsc::HDF5_XDMF);
+    CHECK(MeshIOPetsc::HDF5_XDMF == _io->getHDF5Layout());
+
+    CHECK(!_io->getFixGmshLabels());
+    _io->setFixGmshLabels(true);
+    CHECK(_io->getFixGmshLabels());
+
+    PYLITH_METHOD_END;
+} // testHDF5Options
+
+
 // ------------------------------------------------------------------------------------------------
 // Test read().
 void
@@ -48,6 +48,9 @@ public:
     /// Test filename()
     void testFilename(void);
 
+    /// Test setHDF5Layout() and setFixGmshLabels().
+    void testHDF5Options(void);
+
     /// Test read().
     void testRead(void);
 
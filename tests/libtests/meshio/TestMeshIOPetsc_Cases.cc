@@ -55,6 +55,9 @@ public:
 TEST_CASE("TestMeshIOPetsc::testFilename", "[TestMeshIOPetsc][testFilename]") {
     pylith::meshio::TestMeshIOPetsc(pylith::meshio::TestMeshIOPetsc_Cases::GmshBoxTriAscii()).testFilename();
 }
+TEST_CASE("TestMeshIOPetsc::testHDF5Options", "[TestMeshIOPetsc][testHDF5Options]") {
+    pylith::meshio::TestMeshIOPetsc(pylith::meshio::TestMeshIOPetsc_Cases::GmshBoxTriAscii()).testHDF5Options();
+}
 
 TEST_CASE("TestMeshIOPetsc::GmshBoxTriAscii::testRead", "[TestMeshIOPetsc][Gmsh][Tri][ASCII][testRead]") {
     pylith::meshio::TestMeshIOPetsc(pylith::meshio::TestMeshIOPetsc_Cases::GmshBoxTriAscii()).testRead();
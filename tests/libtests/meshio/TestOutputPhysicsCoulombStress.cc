@@ -0,0 +1,324 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/OutputPhysicsCoulombStress.hh" // Test subject
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/meshio/OutputTriggerStep.hh" // USES OutputTriggerStep
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputPhysicsCoulombStress;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestOutputPhysicsCoulombStress : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestOutputPhysicsCoulombStress(void);
+
+    /// Destructor.
+    ~TestOutputPhysicsCoulombStress(void);
+
+    /// Test setReceivers().
+    void testSetReceivers(void);
+
+    /// Test needsUpdate().
+    void testNeedsUpdate(void);
+
+    /// Test _computeCoulombStress() relative to reference stress.
+    void testComputeCoulombStress(void);
+
+private:
+
+    /// Create mesh and field with Cauchy stress subfield at vertices.
+    void _initialize(void);
+
+    /** Set stress at vertices to reference stress plus stress change.
+     *
+     * @param[in] stressChange Change in stress (xx, yy, zz, xy, yz, xz) relative to reference stress.
+     */
+    void _setStress(const PylithScalar* stressChange);
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _pointField; ///< Field with Cauchy stress subfield.
+
+}; // class TestOutputPhysicsCoulombStress
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputPhysicsCoulombStress::testSetReceivers", "[TestOutputPhysicsCoulombStress]") {
+    pylith::meshio::TestOutputPhysicsCoulombStress().testSetReceivers();
+}
+TEST_CASE("TestOutputPhysicsCoulombStress::testNeedsUpdate", "[TestOutputPhysicsCoulombStress]") {
+    pylith::meshio::TestOutputPhysicsCoulombStress().testNeedsUpdate();
+}
+TEST_CASE("TestOutputPhysicsCoulombStress::testComputeCoulombStress", "[TestOutputPhysicsCoulombStress]") {
+    pylith::meshio::TestOutputPhysicsCoulombStress().testComputeCoulombStress();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::TestOutputPhysicsCoulombStress::TestOutputPhysicsCoulombStress(void) :
+    _mesh(NULL),
+    _pointField(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::TestOutputPhysicsCoulombStress::~TestOutputPhysicsCoulombStress(void) {
+    delete _pointField;_pointField = NULL;
+    delete _mesh;_mesh = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setReceivers().
+void
+pylith::meshio::TestOutputPhysicsCoulombStress::testSetReceivers(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputPhysicsCoulombStress output;
+    output.setIdentifier("coulomb");
+
+    const int numPoints = 2;
+    const int spaceDim = 3;
+    const PylithReal pointCoords[numPoints*spaceDim] = {
+        0.0, 0.0, 0.2,
+        0.1, -0.1, 0.3,
+    };
+    const char* pointNames[numPoints] = { "R0", "R1" };
+    output.setPoints(pointCoords, numPoints, spaceDim, pointNames, numPoints);
+
+    const int numValues = 4;
+    const PylithReal receivers[numPoints*numValues] = {
+        0.5, 1.0, 0.0, 0.4,
+        1.5, 0.7, -0.5, 0.6,
+    };
+
+    // Wrong number of values at each point.
+    CHECK_THROWS_AS(output.setReceivers(receivers, numPoints, 3), std::runtime_error);
+
+    // Number of receivers does not match number of points.
+    CHECK_THROWS_AS(output.setReceivers(receivers, 1, numValues), std::runtime_error);
+    CHECK(output._receivers.size() == 0);
+
+    output.setReceivers(receivers, numPoints, numValues);
+    REQUIRE(size_t(numPoints*numValues) == output._receivers.size());
+    for (int i = 0; i < numPoints*numValues; ++i) {
+        INFO("Checking receiver value " << i << ".");
+        CHECK(receivers[i] == output._receivers[i]);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testSetReceivers
+
+
+// ------------------------------------------------------------------------------------------------
+// Test needsUpdate().
+void
+pylith::meshio::TestOutputPhysicsCoulombStress::testNeedsUpdate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputTriggerStep trigger;
+    trigger.setNumStepsSkip(2);
+    CHECK(trigger.shouldWrite(0.0, 0));
+
+    OutputPhysicsCoulombStress output;
+    output.setTrigger(&trigger);
+
+    // Reference stress is always needed.
+    CHECK(!output._hasRefStress);
+    CHECK(output.needsUpdate(0.1, 1));
+
+    // After the reference stress is set, the trigger decides.
+    output._hasRefStress = true;
+    CHECK(!output.needsUpdate(0.1, 1));
+    CHECK(!output.needsUpdate(0.2, 2));
+    CHECK(output.needsUpdate(0.3, 3));
+
+    PYLITH_METHOD_END;
+} // testNeedsUpdate
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _computeCoulombStress() relative to reference stress.
+void
+pylith::meshio::TestOutputPhysicsCoulombStress::testComputeCoulombStress(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    PetscDM dmPoints = _pointField->getDM();assert(dmPoints);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(dmPoints, 0, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    const size_t numPoints = pEnd - pStart;
+    REQUIRE(numPoints > 0);
+
+    // Even points have a vertical receiver fault striking north (strike=0, dip=90 deg, rake=0) and odd points have a
+    // horizontal receiver fault with slip to the east.
+    const PylithReal friction = 0.4;
+    OutputPhysicsCoulombStress output;
+    output._normalDir.resize(3*numPoints);
+    output._slipDir.resize(3*numPoints);
+    output._friction.resize(numPoints);
+    output._refStress.resize(6*numPoints);
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        const bool isVertical = 0 == iPoint % 2;
+        const PylithReal normalDir[3] = { isVertical ? 1.0 : 0.0, 0.0, isVertical ? 0.0 : 1.0 };
+        const PylithReal slipDir[3] = { isVertical ? 0.0 : 1.0, isVertical ? 1.0 : 0.0, 0.0 };
+        for (size_t i = 0; i < 3; ++i) {
+            output._normalDir[3*iPoint+i] = normalDir[i];
+            output._slipDir[3*iPoint+i] = slipDir[i];
+        } // for
+        output._friction[iPoint] = friction;
+    } // for
+
+    const pylith::topology::Field::SubfieldInfo& stressInfo = _pointField->getSubfieldInfo("cauchy_stress");
+    output._coulombField = new pylith::topology::Field(*_mesh);assert(output._coulombField);
+    const char* subfieldNames[3] = { "coulomb_stress_change", "shear_stress_change", "normal_stress_change" };
+    for (size_t i = 0; i < 3; ++i) {
+        pylith::topology::Field::Description description(subfieldNames[i], subfieldNames[i],
+                                                         pylith::string_vector(1, subfieldNames[i]), 1,
+                                                         pylith::topology::Field::SCALAR);
+        output._coulombField->subfieldAdd(description, stressInfo.fe);
+    } // for
+    output._coulombField->subfieldsSetup();
+    output._coulombField->createDiscretization();
+    output._coulombField->allocate();
+
+    // First update sets the reference stress, so there is no change.
+    const PylithScalar zero[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    _setStress(zero);
+    output._computeCoulombStress(*_pointField);
+    CHECK(output._hasRefStress);
+
+    const PylithReal tolerance = 1.0e-12;
+    {
+        pylith::topology::VecVisitorMesh coulombVisitor(*output._coulombField);
+        const PetscScalar* coulombArray = coulombVisitor.localArray();
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            const PetscInt off = coulombVisitor.sectionOffset(point);
+            INFO("Checking reference stress change at point " << point << ".");
+            for (size_t i = 0; i < 3; ++i) {
+                CHECK_THAT(coulombArray[off+i], Catch::Matchers::WithinAbs(0.0, tolerance));
+            } // for
+        } // for
+    } // block
+
+    // Stress change (xx, yy, zz, xy, yz, xz) resolved onto receivers.
+    const PylithScalar stressChange[6] = { -3.0, 1.0, 5.0, 2.0, 7.0, 11.0 };
+    _setStress(stressChange);
+    output._computeCoulombStress(*_pointField);
+
+    pylith::topology::VecVisitorMesh coulombVisitor(*output._coulombField);
+    const PetscScalar* coulombArray = coulombVisitor.localArray();
+    for (PetscInt point = pStart, iPoint = 0; point < pEnd; ++point, ++iPoint) {
+        const bool isVertical = 0 == iPoint % 2;
+        const PylithReal shearStressE = isVertical ? stressChange[3] : stressChange[5];
+        const PylithReal normalStressE = isVertical ? stressChange[0] : stressChange[2];
+        const PetscInt off = coulombVisitor.sectionOffset(point);
+        REQUIRE(3 == coulombVisitor.sectionDof(point));
+        INFO("Checking stress change at point " << point << ".");
+        CHECK_THAT(coulombArray[off+0], Catch::Matchers::WithinAbs(shearStressE + friction*normalStressE, tolerance));
+        CHECK_THAT(coulombArray[off+1], Catch::Matchers::WithinAbs(shearStressE, tolerance));
+        CHECK_THAT(coulombArray[off+2], Catch::Matchers::WithinAbs(normalStressE, tolerance));
+    } // for
+
+    PYLITH_METHOD_END;
+} // testComputeCoulombStress
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh and field with Cauchy stress subfield at vertices.
+void
+pylith::meshio::TestOutputPhysicsCoulombStress::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tet4.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    delete _pointField;_pointField = new pylith::topology::Field(*_mesh);assert(_pointField);
+    _pointField->setLabel("derived field at points");
+    const char* componentNames[6] = {
+        "cauchy_stress_xx", "cauchy_stress_yy", "cauchy_stress_zz",
+        "cauchy_stress_xy", "cauchy_stress_yz", "cauchy_stress_xz",
+    };
+    pylith::string_vector names(componentNames, componentNames+6);
+    pylith::topology::Field::Description description("cauchy_stress", "cauchy_stress", names, 6,
+                                                     pylith::topology::Field::TENSOR);
+    _pointField->subfieldAdd(description, pylith::topology::Field::Discretization(1, 1, _mesh->getDimension()));
+    _pointField->subfieldsSetup();
+    _pointField->createDiscretization();
+    _pointField->allocate();
+    _pointField->zeroLocal();
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Set stress at vertices to reference stress plus stress change.
+void
+pylith::meshio::TestOutputPhysicsCoulombStress::_setStress(const PylithScalar* stressChange) {
+    PYLITH_METHOD_BEGIN;
+    assert(_pointField);
+    assert(stressChange);
+
+    // Reference stress differs among points, so stress changes are only recovered if it is subtracted.
+    const PylithScalar refStress[6] = { -10.0, -12.0, -30.0, 1.0, -2.0, 3.0 };
+
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(_pointField->getDM(), 0, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    pylith::topology::VecVisitorMesh stressVisitor(*_pointField, "cauchy_stress");
+    PetscScalar* stressArray = stressVisitor.localArray();
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt off = stressVisitor.sectionOffset(point);
+        assert(6 == stressVisitor.sectionDof(point));
+        for (size_t i = 0; i < 6; ++i) {
+            stressArray[off+i] = (1.0 + point) * refStress[i] + stressChange[i];
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setStress
+
+
+// End of file
@@ -0,0 +1,311 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/OutputRuptureStats.hh" // Test subject
+
+#include "tests/src/PhysicsImplementationStub.hh" // USES PhysicsImplementationStub
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <cmath> // USES log10()
+#include <cstdio> // USES snprintf()
+#include <fstream> // USES std::ifstream
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputRuptureStats;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestOutputRuptureStats : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestOutputRuptureStats(void);
+
+    /// Destructor.
+    ~TestOutputRuptureStats(void);
+
+    /// Test setFilename(), getFilename(), setFaultName(), and setTimeScale().
+    void testAccessors(void);
+
+    /// Test _setupCells() and _computeStats().
+    void testComputeStats(void);
+
+    /// Test _write().
+    void testWrite(void);
+
+private:
+
+    /// Create mesh, auxiliary field with slip subfield, and spatial database with elastic properties.
+    void _initialize(void);
+
+    /** Set slip uniformly over auxiliary field.
+     *
+     * @param[in] slipX Slip in x direction.
+     * @param[in] slipY Slip in y direction.
+     */
+    void _setSlip(const PylithReal slipX,
+                  const PylithReal slipY);
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _auxiliaryField; ///< Auxiliary field with slip.
+    spatialdata::spatialdb::UniformDB* _propertiesDB; ///< Spatial database with density and shear wave speed.
+
+}; // class TestOutputRuptureStats
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputRuptureStats::testAccessors", "[TestOutputRuptureStats]") {
+    pylith::meshio::TestOutputRuptureStats().testAccessors();
+}
+TEST_CASE("TestOutputRuptureStats::testComputeStats", "[TestOutputRuptureStats]") {
+    pylith::meshio::TestOutputRuptureStats().testComputeStats();
+}
+TEST_CASE("TestOutputRuptureStats::testWrite", "[TestOutputRuptureStats]") {
+    pylith::meshio::TestOutputRuptureStats().testWrite();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::TestOutputRuptureStats::TestOutputRuptureStats(void) :
+    _mesh(NULL),
+    _auxiliaryField(NULL),
+    _propertiesDB(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::TestOutputRuptureStats::~TestOutputRuptureStats(void) {
+    delete _auxiliaryField;_auxiliaryField = NULL;
+    delete _mesh;_mesh = NULL;
+    delete _propertiesDB;_propertiesDB = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setFilename(), getFilename(), setFaultName(), and setTimeScale().
+void
+pylith::meshio::TestOutputRuptureStats::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputRuptureStats output;
+    CHECK(std::string("rupture_stats.py") == std::string(output.getFilename()));
+    CHECK(std::string("fault") == output._faultName);
+    CHECK(1.0 == output._timeScale);
+
+    output.setFilename("stats.py");
+    CHECK(std::string("stats.py") == std::string(output.getFilename()));
+
+    output.setFaultName("mainshock");
+    CHECK(std::string("mainshock") == output._faultName);
+
+    output.setTimeScale(5.0);
+    CHECK(5.0 == output._timeScale);
+    CHECK_THROWS_AS(output.setTimeScale(0.0), std::runtime_error);
+    CHECK(5.0 == output._timeScale);
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _setupCells() and _computeStats().
+void
+pylith::meshio::TestOutputRuptureStats::testComputeStats(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    OutputRuptureStats output;
+    output.setPropertiesDB(_propertiesDB);
+    output.setTimeScale(2.0);
+    output._setupCells(*_auxiliaryField);
+
+    // Mesh has two triangles with unit area.
+    const PylithReal tolerance = 1.0e-12;
+    const PylithReal shearModulus = 2500.0 * 2000.0 * 2000.0;
+    REQUIRE(2 == output._cells.size());
+    REQUIRE(2 == output._cellsArea.size());
+    REQUIRE(2 == output._cellsShearModulus.size());
+    for (size_t iCell = 0; iCell < 2; ++iCell) {
+        CHECK_THAT(output._cellsArea[iCell], Catch::Matchers::WithinRel(1.0, tolerance));
+        CHECK_THAT(output._cellsShearModulus[iCell], Catch::Matchers::WithinRel(shearModulus, tolerance));
+    } // for
+
+    // No slip does not contribute to the rupture area.
+    _setSlip(0.0, 0.0);
+    output._computeStats(0.5, *_auxiliaryField);
+
+    // Slip magnitude of 5 over area of 2.
+    _setSlip(3.0, 4.0);
+    output._computeStats(1.5, *_auxiliaryField);
+
+    REQUIRE(2 == output._timestamp.size());
+    CHECK_THAT(output._timestamp[0], Catch::Matchers::WithinRel(1.0, tolerance));
+    CHECK(0.0 == output._ruptureArea[0]);
+    CHECK(0.0 == output._potency[0]);
+    CHECK(0.0 == output._moment[0]);
+
+    CHECK_THAT(output._timestamp[1], Catch::Matchers::WithinRel(3.0, tolerance));
+    CHECK_THAT(output._ruptureArea[1], Catch::Matchers::WithinRel(2.0, tolerance));
+    CHECK_THAT(output._potency[1], Catch::Matchers::WithinRel(10.0, tolerance));
+    CHECK_THAT(output._moment[1], Catch::Matchers::WithinRel(10.0*shearModulus, tolerance));
+
+    PYLITH_METHOD_END;
+} // testComputeStats
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _write().
+void
+pylith::meshio::TestOutputRuptureStats::testWrite(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::feassemble::PhysicsImplementationStub physics;
+    OutputRuptureStats output;
+    output.setPhysicsImplementation(&physics);
+    output.setFilename("rupture_stats.py");
+    output.setFaultName("fault");
+
+    const PylithReal moment = 1.0e+11;
+    output._timestamp.push_back(0.0);
+    output._ruptureArea.push_back(0.0);
+    output._potency.push_back(0.0);
+    output._moment.push_back(0.0);
+    output._timestamp.push_back(1.0);
+    output._ruptureArea.push_back(2.0);
+    output._potency.push_back(10.0);
+    output._moment.push_back(moment);
+    output._write();
+
+    // Moment magnitude of zero moment is written as a large negative value.
+    const size_t numArrays = 6;
+    const char* names[numArrays] = { "timestamp", "ruparea", "potency", "moment", "avgslip", "mommag" };
+    const PylithReal values[numArrays][2] = {
+        { 0.0, 1.0 },
+        { 0.0, 2.0 },
+        { 0.0, 10.0 },
+        { 0.0, moment },
+        { 0.0, 5.0 },
+        { -1.0e+30, 2.0 / 3.0 * (log10(moment) - 9.05) },
+    };
+
+    std::ifstream fin("rupture_stats.py");
+    REQUIRE(fin.is_open());
+    std::string line;
+    std::getline(fin, line);
+    CHECK(std::string("class RuptureStats(object):") == line);
+    std::getline(fin, line);
+    CHECK(std::string("    pass") == line);
+    std::getline(fin, line);
+    CHECK(std::string("fault = RuptureStats()") == line);
+    for (size_t i = 0; i < numArrays; ++i) {
+        char buffer[2][32];
+        snprintf(buffer[0], sizeof(buffer[0]), "%14.6e", values[i][0]);
+        snprintf(buffer[1], sizeof(buffer[1]), "%14.6e", values[i][1]);
+        std::ostringstream lineE;
+        lineE << "fault." << names[i] << " = [" << buffer[0] << ", " << buffer[1] << "]";
+
+        std::getline(fin, line);
+        INFO("Checking time series '" << names[i] << "'.");
+        CHECK(lineE.str() == line);
+    } // for
+    fin.close();
+
+    PYLITH_METHOD_END;
+} // testWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh, auxiliary field with slip subfield, and spatial database with elastic properties.
+void
+pylith::meshio::TestOutputRuptureStats::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    delete _auxiliaryField;_auxiliaryField = new pylith::topology::Field(*_mesh);assert(_auxiliaryField);
+    _auxiliaryField->setLabel("auxiliary field");
+    const char* componentNames[2] = { "slip_x", "slip_y" };
+    pylith::string_vector names(componentNames, componentNames+2);
+    pylith::topology::Field::Description description("slip", "slip", names, 2, pylith::topology::Field::VECTOR);
+    pylith::topology::Field::Discretization discretization(1, 1, _mesh->getDimension());
+    _auxiliaryField->subfieldAdd(description, discretization);
+    _auxiliaryField->subfieldsSetup();
+    _auxiliaryField->createDiscretization();
+    _auxiliaryField->allocate();
+    _auxiliaryField->zeroLocal();
+
+    const char* dbNames[2] = { "density", "vs" };
+    const char* dbUnits[2] = { "kg/m**3", "m/s" };
+    const double dbValues[2] = { 2500.0, 2000.0 };
+    delete _propertiesDB;_propertiesDB = new spatialdata::spatialdb::UniformDB;assert(_propertiesDB);
+    _propertiesDB->setDescription("elastic properties");
+    _propertiesDB->setData(dbNames, dbUnits, dbValues, 2);
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Set slip uniformly over auxiliary field.
+void
+pylith::meshio::TestOutputRuptureStats::_setSlip(const PylithReal slipX,
+                                                 const PylithReal slipY) {
+    PYLITH_METHOD_BEGIN;
+    assert(_auxiliaryField);
+
+    PetscErrorCode err = 0;
+    PetscScalar* values = NULL;
+    PetscInt numValues = 0;
+    err = VecGetLocalSize(_auxiliaryField->getLocalVector(), &numValues);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(_auxiliaryField->getLocalVector(), &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numValues; i += 2) {
+        values[i+0] = slipX;
+        values[i+1] = slipY;
+    } // for
+    err = VecRestoreArray(_auxiliaryField->getLocalVector(), &values);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setSlip
+
+
+// End of file
@@ -0,0 +1,260 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/OutputSolnLineOfSight.hh" // Test subject
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputSolnLineOfSight;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestOutputSolnLineOfSight : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestOutputSolnLineOfSight(void);
+
+    /// Destructor.
+    ~TestOutputSolnLineOfSight(void);
+
+    /// Test setLineOfSight().
+    void testSetLineOfSight(void);
+
+    /// Test _createLineOfSightField().
+    void testCreateLineOfSightField(void);
+
+    /// Test _projectLineOfSight().
+    void testProjectLineOfSight(void);
+
+private:
+
+    /// Create mesh and field with displacement at vertices, (1+p, 2-2p) at point p.
+    void _initialize(void);
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _pointSoln; ///< Solution field with displacement subfield.
+
+}; // class TestOutputSolnLineOfSight
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputSolnLineOfSight::testSetLineOfSight", "[TestOutputSolnLineOfSight]") {
+    pylith::meshio::TestOutputSolnLineOfSight().testSetLineOfSight();
+}
+TEST_CASE("TestOutputSolnLineOfSight::testCreateLineOfSightField", "[TestOutputSolnLineOfSight]") {
+    pylith::meshio::TestOutputSolnLineOfSight().testCreateLineOfSightField();
+}
+TEST_CASE("TestOutputSolnLineOfSight::testProjectLineOfSight", "[TestOutputSolnLineOfSight]") {
+    pylith::meshio::TestOutputSolnLineOfSight().testProjectLineOfSight();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::TestOutputSolnLineOfSight::TestOutputSolnLineOfSight(void) :
+    _mesh(NULL),
+    _pointSoln(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::TestOutputSolnLineOfSight::~TestOutputSolnLineOfSight(void) {
+    delete _pointSoln;_pointSoln = NULL;
+    delete _mesh;_mesh = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setLineOfSight().
+void
+pylith::meshio::TestOutputSolnLineOfSight::testSetLineOfSight(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnLineOfSight output;
+    output.setIdentifier("insar");
+
+    const int numTracks = 2;
+    const int spaceDim = 3;
+    const PylithReal directions[numTracks*spaceDim] = {
+        3.0, 0.0, 4.0,
+        -1.0, 2.0, 2.0,
+    };
+    const char* trackNames[numTracks] = { "ascending", "descending" };
+    output.setLineOfSight(directions, numTracks, spaceDim, trackNames, numTracks);
+
+    // Directions are normalized to unit vectors.
+    const PylithReal directionsE[numTracks*spaceDim] = {
+        0.6, 0.0, 0.8,
+        -1.0/3.0, 2.0/3.0, 2.0/3.0,
+    };
+    const PylithReal tolerance = 1.0e-12;
+    REQUIRE(size_t(numTracks*spaceDim) == output._directions.size());
+    for (int i = 0; i < numTracks*spaceDim; ++i) {
+        INFO("Checking direction component " << i << ".");
+        CHECK_THAT(output._directions[i], Catch::Matchers::WithinAbs(directionsE[i], tolerance));
+    } // for
+    REQUIRE(size_t(numTracks) == output._trackNames.size());
+    CHECK(std::string("ascending") == output._trackNames[0]);
+    CHECK(std::string("descending") == output._trackNames[1]);
+
+    // Number of directions does not match number of names.
+    CHECK_THROWS_AS(output.setLineOfSight(directions, numTracks, spaceDim, trackNames, 1), std::runtime_error);
+
+    // No tracks.
+    CHECK_THROWS_AS(output.setLineOfSight(directions, 0, spaceDim, trackNames, 0), std::runtime_error);
+
+    // Direction with zero length.
+    const PylithReal directionsZero[spaceDim] = { 0.0, 0.0, 0.0 };
+    CHECK_THROWS_AS(output.setLineOfSight(directionsZero, 1, spaceDim, trackNames, 1), std::runtime_error);
+
+    PYLITH_METHOD_END;
+} // testSetLineOfSight
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _createLineOfSightField().
+void
+pylith::meshio::TestOutputSolnLineOfSight::testCreateLineOfSightField(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    OutputSolnLineOfSight output;
+    const char* trackNames[2] = { "ascending", "descending" };
+
+    // Directions must match spatial dimension of displacement.
+    const PylithReal directions3D[3] = { 0.0, 0.0, 1.0 };
+    output.setLineOfSight(directions3D, 1, 3, trackNames, 1);
+    CHECK_THROWS_AS(output._createLineOfSightField(*_pointSoln), std::runtime_error);
+
+    const PylithReal directions[4] = { 1.0, 0.0, 0.0, 1.0 };
+    output.setLineOfSight(directions, 2, 2, trackNames, 2);
+    output._createLineOfSightField(*_pointSoln);
+    REQUIRE(output._losField);
+
+    const pylith::topology::Field::SubfieldInfo& info = output._losField->getSubfieldInfo("line_of_sight_displacement");
+    CHECK(pylith::topology::Field::OTHER == info.description.vectorFieldType);
+    CHECK(2.0 == info.description.scale);
+    REQUIRE(2 == info.description.numComponents);
+    REQUIRE(2 == info.description.componentNames.size());
+    CHECK(std::string("line_of_sight_displacement_ascending") == info.description.componentNames[0]);
+    CHECK(std::string("line_of_sight_displacement_descending") == info.description.componentNames[1]);
+    CHECK(1 == info.fe.basisOrder);
+
+    PYLITH_METHOD_END;
+} // testCreateLineOfSightField
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _projectLineOfSight().
+void
+pylith::meshio::TestOutputSolnLineOfSight::testProjectLineOfSight(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    OutputSolnLineOfSight output;
+    const int numTracks = 2;
+    const PylithReal directions[numTracks*2] = { 3.0, 4.0, -1.0, 0.0 };
+    const char* trackNames[numTracks] = { "ascending", "descending" };
+    output.setLineOfSight(directions, numTracks, 2, trackNames, numTracks);
+    output._createLineOfSightField(*_pointSoln);
+    output._projectLineOfSight(*_pointSoln);
+
+    PetscDM dmPoints = _pointSoln->getDM();assert(dmPoints);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(dmPoints, 0, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    REQUIRE(pEnd > pStart);
+
+    const PylithReal tolerance = 1.0e-12;
+    pylith::topology::VecVisitorMesh losVisitor(*output._losField);
+    const PetscScalar* losArray = losVisitor.localArray();
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PylithReal dispX = 1.0 + point;
+        const PylithReal dispY = 2.0 - 2.0*point;
+        const PetscInt off = losVisitor.sectionOffset(point);
+        REQUIRE(numTracks == losVisitor.sectionDof(point));
+        INFO("Checking line-of-sight displacement at point " << point << ".");
+        CHECK_THAT(losArray[off+0], Catch::Matchers::WithinAbs(0.6*dispX + 0.8*dispY, tolerance));
+        CHECK_THAT(losArray[off+1], Catch::Matchers::WithinAbs(-dispX, tolerance));
+    } // for
+
+    PYLITH_METHOD_END;
+} // testProjectLineOfSight
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh and field with displacement at vertices, (1+p, 2-2p) at point p.
+void
+pylith::meshio::TestOutputSolnLineOfSight::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    delete _pointSoln;_pointSoln = new pylith::topology::Field(*_mesh);assert(_pointSoln);
+    _pointSoln->setLabel("solution at points");
+    const char* componentNames[2] = { "displacement_x", "displacement_y" };
+    pylith::string_vector names(componentNames, componentNames+2);
+    pylith::topology::Field::Description description("displacement", "displacement", names, 2,
+                                                     pylith::topology::Field::VECTOR, 2.0);
+    _pointSoln->subfieldAdd(description, pylith::topology::Field::Discretization(1, 1, _mesh->getDimension()));
+    _pointSoln->subfieldsSetup();
+    _pointSoln->createDiscretization();
+    _pointSoln->allocate();
+    _pointSoln->zeroLocal();
+
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(_pointSoln->getDM(), 0, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    pylith::topology::VecVisitorMesh dispVisitor(*_pointSoln, "displacement");
+    PetscScalar* dispArray = dispVisitor.localArray();
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt off = dispVisitor.sectionOffset(point);
+        assert(2 == dispVisitor.sectionDof(point));
+        dispArray[off+0] = 1.0 + point;
+        dispArray[off+1] = 2.0 - 2.0*point;
+    } // for
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// End of file
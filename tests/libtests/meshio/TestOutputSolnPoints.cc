@@ -18,352 +18,290 @@
 
 #include <portinfo>
 
-#include "TestOutputSolnPoints.hh" // Implementation of class methods
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
 
-#include "pylith/meshio/OutputSolnPoints.hh"
+#include "pylith/meshio/OutputSolnPoints.hh" // Test subject
 
+#include "pylith/meshio/PointInterpolator.hh" // USES PointInterpolator
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
-#include "pylith/topology/Stratum.hh" // USES Stratum
-#include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
-#include "pylith/meshio/MeshIOCubit.hh" // USES MeshIOCubit
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
-#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "data/OutputSolnPointsDataTri3.hh"
-#include "data/OutputSolnPointsDataQuad4.hh"
-#include "data/OutputSolnPointsDataTet4.hh"
-#include "data/OutputSolnPointsDataHex8.hh"
-
-#include <string.h> // USES strcmp()
-
-// ----------------------------------------------------------------------
-CPPUNIT_TEST_SUITE_REGISTRATION(pylith::meshio::TestOutputSolnPoints);
-
-// ----------------------------------------------------------------------
-// Test constructor
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputSolnPoints;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestOutputSolnPoints : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestOutputSolnPoints(void);
+
+    /// Destructor.
+    ~TestOutputSolnPoints(void);
+
+    /// Test setPoints() and _getOutputPointCounts().
+    void testSetPoints(void);
+
+    /// Test solution at points matches DMInterpolationSetUp() and DMInterpolationEvaluate() with interpolation matrix.
+    void testInterpolateMatrix(void);
+
+    /// Test solution at points matches DMInterpolationSetUp() and DMInterpolationEvaluate() without interpolation matrix.
+    void testInterpolateEvaluate(void);
+
+private:
+
+    /// Create mesh and solution with subfields displacement and fluid_pressure that vary with position.
+    void _initialize(void);
+
+    /** Check solution at points against interpolation with DMInterpolationSetUp() and DMInterpolationEvaluate().
+     *
+     * This is how the solution was interpolated to the points before point location was factored out into
+     * PointInterpolator, so the output must be unchanged.
+     *
+     * @param[in] useInterpolationMatrix Use interpolation matrix.
+     */
+    void _checkInterpolation(const bool useInterpolationMatrix);
+
+    static const int _numPoints; ///< Number of points.
+    static const int _spaceDim; ///< Spatial dimension.
+    static const PylithReal _points[]; ///< Coordinates of points.
+    static const char* _pointNames[]; ///< Names of points.
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _solution; ///< Solution field.
+
+}; // class TestOutputSolnPoints
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputSolnPoints::testSetPoints", "[TestOutputSolnPoints]") {
+    pylith::meshio::TestOutputSolnPoints().testSetPoints();
+}
+TEST_CASE("TestOutputSolnPoints::testInterpolateMatrix", "[TestOutputSolnPoints]") {
+    pylith::meshio::TestOutputSolnPoints().testInterpolateMatrix();
+}
+TEST_CASE("TestOutputSolnPoints::testInterpolateEvaluate", "[TestOutputSolnPoints]") {
+    pylith::meshio::TestOutputSolnPoints().testInterpolateEvaluate();
+}
+
+const int pylith::meshio::TestOutputSolnPoints::_numPoints = 5;
+const int pylith::meshio::TestOutputSolnPoints::_spaceDim = 2;
+const PylithReal pylith::meshio::TestOutputSolnPoints::_points[5*2] = {
+    0.3, 0.5,
+    -0.5, 0.1,
+    0.4, -0.2,
+    -0.2, -0.3,
+    0.1, 0.05,
+};
+const char* pylith::meshio::TestOutputSolnPoints::_pointNames[5] = { "AAA", "BBB", "CCC", "DDD", "EEE" };
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::TestOutputSolnPoints::TestOutputSolnPoints(void) :
+    _mesh(NULL),
+    _solution(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::TestOutputSolnPoints::~TestOutputSolnPoints(void) {
+    delete _solution;_solution = NULL;
+    delete _mesh;_mesh = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setPoints() and _getOutputPointCounts().
 void
-pylith::meshio::TestOutputSolnPoints::testConstructor(void) { // testConstructor
+pylith::meshio::TestOutputSolnPoints::testSetPoints(void) {
     PYLITH_METHOD_BEGIN;
 
-    OutputSolnPoints output;
-
-    PYLITH_METHOD_END;
-} // testConstructor
-
-
-// ----------------------------------------------------------------------
-// Test setupInterpolator for tri3 mesh.
-void
-pylith::meshio::TestOutputSolnPoints::testSetupInterpolatorTri3(void) { // testSetupInterpolatorTri3
-    PYLITH_METHOD_BEGIN;
+    _initialize();
 
     OutputSolnPoints output;
-    OutputSolnPointsDataTri3 data;
+    output.setPoints(_points, _numPoints, _spaceDim, _pointNames, _numPoints);
+    REQUIRE(output._interpolator);
+    CHECK(size_t(_numPoints) == output._interpolator->getNumPoints());
 
-    _testSetupInterpolator(data);
+    PylithReal numVertices = 0.0, numCells = 0.0;
+    output._getOutputPointCounts(&numVertices, &numCells, *_solution);
+    CHECK(_numPoints == numVertices);
+    CHECK(_numPoints == numCells);
 
     PYLITH_METHOD_END;
-} // testSetupInterpolatorTri3
+} // testSetPoints
 
 
-// ----------------------------------------------------------------------
-// Test interpolation for tri3 mesh.
+// ------------------------------------------------------------------------------------------------
+// Test solution at points matches DMInterpolationSetUp() and DMInterpolationEvaluate() with interpolation matrix.
 void
-pylith::meshio::TestOutputSolnPoints::testInterpolateTri3(void) { // testInterpolateTri3
+pylith::meshio::TestOutputSolnPoints::testInterpolateMatrix(void) {
     PYLITH_METHOD_BEGIN;
 
-    OutputSolnPoints output;
-    OutputSolnPointsDataTri3 data;
-
-    _testInterpolate(data);
+    _initialize();
+    _checkInterpolation(true);
 
     PYLITH_METHOD_END;
-} // testInterpolateTri3
+} // testInterpolateMatrix
 
 
-// ----------------------------------------------------------------------
-// Test setupInterpolator for quad4 mesh.
+// ------------------------------------------------------------------------------------------------
+// Test solution at points matches DMInterpolationSetUp() and DMInterpolationEvaluate() without interpolation matrix.
 void
-pylith::meshio::TestOutputSolnPoints::testSetupInterpolatorQuad4(void) { // testSetupInterpolatorQuad4
+pylith::meshio::TestOutputSolnPoints::testInterpolateEvaluate(void) {
     PYLITH_METHOD_BEGIN;
 
-    OutputSolnPoints output;
-    OutputSolnPointsDataQuad4 data;
-
-    _testSetupInterpolator(data);
+    _initialize();
+    _checkInterpolation(false);
 
     PYLITH_METHOD_END;
-} // testSetupInterpolatorQuad4
+} // testInterpolateEvaluate
 
 
-// ----------------------------------------------------------------------
-// Test interpolation for quad4 mesh.
+// ------------------------------------------------------------------------------------------------
+// Create mesh and solution with subfields that vary with position.
 void
-pylith::meshio::TestOutputSolnPoints::testInterpolateQuad4(void) { // testInterpolateQuad4
+pylith::meshio::TestOutputSolnPoints::_initialize(void) {
     PYLITH_METHOD_BEGIN;
 
-    OutputSolnPoints output;
-    OutputSolnPointsDataQuad4 data;
-
-    _testInterpolate(data);
-
-    PYLITH_METHOD_END;
-} // testInterpolateQuad4
-
-
-// ----------------------------------------------------------------------
-// Test setupInterpolator for tet4 mesh.
-void
-pylith::meshio::TestOutputSolnPoints::testSetupInterpolatorTet4(void) { // testSetupInterpolatorTet4
-    PYLITH_METHOD_BEGIN;
-
-    OutputSolnPoints output;
-    OutputSolnPointsDataTet4 data;
-
-    _testSetupInterpolator(data);
-
-    PYLITH_METHOD_END;
-} // testSetupInterpolatorTet4
-
-
-// ----------------------------------------------------------------------
-// Test interpolation for tet4 mesh.
-void
-pylith::meshio::TestOutputSolnPoints::testInterpolateTet4(void) { // testInterpolateTet4
-    PYLITH_METHOD_BEGIN;
-
-    OutputSolnPoints output;
-    OutputSolnPointsDataTet4 data;
-
-    _testInterpolate(data);
-
-    PYLITH_METHOD_END;
-} // testInterpolateTet4
-
-
-// ----------------------------------------------------------------------
-// Test setupInterpolator for hex8 mesh.
-void
-pylith::meshio::TestOutputSolnPoints::testSetupInterpolatorHex8(void) { // testSetupInterpolatorHex8
-    PYLITH_METHOD_BEGIN;
-
-    OutputSolnPoints output;
-    OutputSolnPointsDataHex8 data;
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(_mesh);
 
-    _testSetupInterpolator(data);
-
-    PYLITH_METHOD_END;
-} // testSetupInterpolatorHex8
-
-
-// ----------------------------------------------------------------------
-// Test interpolation for hex8 mesh.
-void
-pylith::meshio::TestOutputSolnPoints::testInterpolateHex8(void) { // testInterpolateHex8
-    PYLITH_METHOD_BEGIN;
-
-    OutputSolnPoints output;
-    OutputSolnPointsDataHex8 data;
-
-    _testInterpolate(data);
-
-    PYLITH_METHOD_END;
-} // testInterpolateHex8
-
-
-// ----------------------------------------------------------------------
-// Test setupInterpolator().
-void
-pylith::meshio::TestOutputSolnPoints::_testSetupInterpolator(const OutputSolnPointsData& data) { // _testSetupInterpolator
-    PYLITH_METHOD_BEGIN;
-
-    const int numPoints = data.numPoints;
-    const int spaceDim = data.spaceDim;
-
-    const int numVerticesE = numPoints;
-    const int numCellsE = numPoints;
-    const int numCornersE = 1;
-
-    topology::Mesh mesh;
     spatialdata::geocoords::CSCart cs;
-    spatialdata::units::Nondimensional normalizer;
-
-    cs.setSpaceDim(spaceDim);
-    mesh.setCoordSys(&cs);
-    MeshIOCubit iohandler;
-    iohandler.filename(data.meshFilename);
-    iohandler.read(&mesh);
-
-    OutputSolnPoints output;
-    CPPUNIT_ASSERT(data.points);
-    output.setupInterpolator(&mesh, data.points, numPoints, spaceDim, data.names, numPoints, normalizer);
-
-    PetscDM dmMesh = output.pointsMesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
-
-    // Check vertices
-    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
-    const PetscInt vStart = verticesStratum.begin();
-    const PetscInt vEnd = verticesStratum.end();
-    CPPUNIT_ASSERT_EQUAL(numVerticesE, verticesStratum.size());
-    for (PetscInt v = vStart, index = 0; v < vEnd; ++v, ++index) {
-        const int vertexE = numCellsE + index;
-        CPPUNIT_ASSERT_EQUAL(vertexE, v);
-    } // for
-
-    // Check cells
-    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
-    const PetscInt cStart = cellsStratum.begin();
-    const PetscInt cEnd = cellsStratum.end();
-    PetscErrorCode err = 0;
-    CPPUNIT_ASSERT_EQUAL(numCellsE, cellsStratum.size());
-    for (PetscInt c = cStart, index = 0; c < cEnd; ++c) {
-        const PetscInt *cone = NULL;
-        PetscInt coneSize = 0;
-
-        err = DMPlexGetConeSize(dmMesh, c, &coneSize);PYLITH_CHECK_ERROR(err);
-        err = DMPlexGetCone(dmMesh, c, &cone);PYLITH_CHECK_ERROR(err);
-
-        CPPUNIT_ASSERT_EQUAL(numCornersE, coneSize);
-
-        for (PetscInt p = 0; p < coneSize; ++p, ++index) {
-            const int coneE = numCellsE+index;
-            CPPUNIT_ASSERT_EQUAL(coneE, cone[p]);
-        } // for
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    delete _solution;_solution = new pylith::topology::Field(*_mesh);assert(_solution);
+    _solution->setLabel("solution");
+    const char* dispComponents[2] = { "displacement_x", "displacement_y" };
+    pylith::topology::Field::Description dispDescription("displacement", "displacement",
+                                                         pylith::string_vector(dispComponents, dispComponents+2), 2,
+                                                         pylith::topology::Field::VECTOR, 1.0);
+    _solution->subfieldAdd(dispDescription, pylith::topology::Field::Discretization(1, 1, _mesh->getDimension()));
+    pylith::topology::Field::Description pressureDescription("fluid_pressure", "fluid_pressure",
+                                                             pylith::string_vector(1, "fluid_pressure"), 1,
+                                                             pylith::topology::Field::SCALAR, 1.0);
+    _solution->subfieldAdd(pressureDescription, pylith::topology::Field::Discretization(1, 1, _mesh->getDimension()));
+    _solution->subfieldsSetup();
+    _solution->createDiscretization();
+    _solution->allocate();
+    _solution->zeroLocal();
+
+    PetscDM dm = _solution->getDM();assert(dm);
+    PetscInt vStart = 0, vEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::CoordsVisitor coordsVisitor(dm);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();
+    pylith::topology::VecVisitorMesh dispVisitor(*_solution, "displacement");
+    PetscScalar* dispArray = dispVisitor.localArray();
+    pylith::topology::VecVisitorMesh pressureVisitor(*_solution, "fluid_pressure");
+    PetscScalar* pressureArray = pressureVisitor.localArray();
+    for (PetscInt vertex = vStart; vertex < vEnd; ++vertex) {
+        const PetscInt coff = coordsVisitor.sectionOffset(vertex);
+        const PylithReal x = coordsArray[coff+0];
+        const PylithReal y = coordsArray[coff+1];
+
+        const PetscInt doff = dispVisitor.sectionOffset(vertex);
+        dispArray[doff+0] = 1.0 + 2.0*x - y + 0.1*vertex;
+        dispArray[doff+1] = -0.5 + x + 3.0*y;
+
+        const PetscInt poff = pressureVisitor.sectionOffset(vertex);
+        pressureArray[poff] = 4.0 - x + 0.5*y - 0.2*vertex;
     } // for
 
     PYLITH_METHOD_END;
-} // _testSetupInterpolator
+} // _initialize
 
 
-// ----------------------------------------------------------------------
-// Test interpolation.
+// ------------------------------------------------------------------------------------------------
+// Check solution at points against interpolation with DMInterpolationSetUp() and DMInterpolationEvaluate().
 void
-pylith::meshio::TestOutputSolnPoints::_testInterpolate(const OutputSolnPointsData& data) { // _testInterpolate
+pylith::meshio::TestOutputSolnPoints::_checkInterpolation(const bool useInterpolationMatrix) {
     PYLITH_METHOD_BEGIN;
+    assert(_solution);
 
-    const int numPoints = data.numPoints;
-    const int spaceDim = data.spaceDim;
-
-    topology::Mesh mesh;
-    spatialdata::geocoords::CSCart cs;
-    spatialdata::units::Nondimensional normalizer;
-
-    cs.setSpaceDim(spaceDim);
-    mesh.setCoordSys(&cs);
-    MeshIOCubit iohandler;
-    iohandler.filename(data.meshFilename);
-    iohandler.read(&mesh);
-
+    // Interpolate solution as OutputSolnPoints::_writeSolnStep() does with data_fields = [all].
     OutputSolnPoints output;
-    CPPUNIT_ASSERT(data.points);
-    output.setupInterpolator(&mesh, data.points, numPoints, spaceDim, data.names, numPoints, normalizer);
-
-    // Create field with data.
-    const char* fieldName = "data_field";
-    const int fiberDim = data.fiberDim;
-    pylith::topology::Field field(mesh);
-    field.newSection(topology::FieldBase::VERTICES_FIELD, fiberDim);
-    field.allocate();
-    field.setLabel(fieldName);
-    this->_calcField(&field, data);
-
-    // Create field for interpolated data.
-    pylith::topology::Field fieldInterp(output.pointsMesh());
-    fieldInterp.newSection(topology::FieldBase::VERTICES_FIELD, fiberDim);
-    fieldInterp.allocate();
-    fieldInterp.setLabel(field.getLabel());
-    fieldInterp.vectorFieldType(field.vectorFieldType());
-    fieldInterp.scale(field.scale());
-
-    // Create field to populate with expected data.
-    pylith::topology::Field fieldInterpE(fieldInterp.mesh());
-    fieldInterpE.cloneSection(fieldInterp);
-    fieldInterpE.allocate();
-    this->_calcField(&fieldInterpE, data);
-
-    PetscDM pointsMeshDM = output.pointsMesh().dmMesh();CPPUNIT_ASSERT(pointsMeshDM);
-    PetscErrorCode err;
-    err = DMInterpolationSetDof(output._interpolator, fiberDim);PYLITH_CHECK_ERROR(err);
-    err = DMInterpolationEvaluate(output._interpolator, field.dmMesh(), field.localVector(), fieldInterp.localVector());PYLITH_CHECK_ERROR(err);
-
-    // Check interpolated field
-    topology::Stratum verticesStratum(pointsMeshDM, topology::Stratum::DEPTH, 0);
-    const PetscInt vStart = verticesStratum.begin();
-    const PetscInt vEnd = verticesStratum.end();
-
-    topology::VecVisitorMesh fieldInterpVisitor(fieldInterp);
-    PetscScalar* fieldInterpArray = fieldInterpVisitor.localArray();CPPUNIT_ASSERT(fieldInterpArray);
-
-    topology::VecVisitorMesh fieldInterpEVisitor(fieldInterpE);
-    PetscScalar* fieldInterpEArray = fieldInterpEVisitor.localArray();CPPUNIT_ASSERT(fieldInterpEArray);
-
-    const double tolerance = 1.0e-6;
-    for (PetscInt v = vStart; v < vEnd; ++v) {
-        const PetscInt off = fieldInterpVisitor.sectionOffset(v);
-        CPPUNIT_ASSERT_EQUAL(fiberDim, fieldInterpVisitor.sectionDof(v));
-
-        const PetscInt offE = fieldInterpEVisitor.sectionOffset(v);
-        CPPUNIT_ASSERT_EQUAL(fiberDim, fieldInterpEVisitor.sectionDof(v));
-
-        for (PetscInt d = 0; d < fiberDim; ++d) {
-            const PylithScalar valueE = fieldInterpEArray[offE+d];
-            const PylithScalar value = fieldInterpArray[off+d];
-            if (fabs(valueE) > 1.0) {
-                CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,  value / valueE, tolerance);
-            } else {
-                CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, value, tolerance);
-            } // else
-        } // for
+    output.setPoints(_points, _numPoints, _spaceDim, _pointNames, _numPoints);
+    output.useInterpolationMatrix(useInterpolationMatrix);
+    REQUIRE(output._interpolator);
+    output._interpolator->setup(*_solution, _solution->getSubfieldNames());
+    output._interpolator->interpolate(*_solution);
+    CHECK(useInterpolationMatrix == (NULL != output._interpolator->getInterpolationMatrix()));
+
+    // Point names follow the order of the points.
+    const pylith::string_vector& pointNames = output._interpolator->getPointNames();
+    REQUIRE(size_t(_numPoints) == pointNames.size());
+    for (int i = 0; i < _numPoints; ++i) {
+        CHECK(std::string(_pointNames[i]) == pointNames[i]);
     } // for
 
-    PYLITH_METHOD_END;
-} // _testInterpolate
-
-
-// ----------------------------------------------------------------------
-void
-pylith::meshio::TestOutputSolnPoints::_calcField(pylith::topology::Field* field,
-                                                 const OutputSolnPointsData& data) { // _calcField
-    PYLITH_METHOD_BEGIN;
-
-    CPPUNIT_ASSERT(field);
-
-    const pylith::topology::Mesh& mesh = field->mesh();
-    pylith::topology::Stratum verticesStratum(mesh.dmMesh(), topology::Stratum::DEPTH, 0);
-    const PetscInt vStart = verticesStratum.begin();
-    const PetscInt vEnd = verticesStratum.end();
-
-    pylith::topology::VecVisitorMesh fieldVisitor(*field);
-    PylithScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
-
-    pylith::topology::CoordsVisitor coordsVisitor(mesh.dmMesh());
-    PylithScalar* coordsArray = coordsVisitor.localArray();CPPUNIT_ASSERT(coordsArray);
-
-    const PetscInt fiberDim = data.fiberDim;
-    const PetscInt spaceDim = data.spaceDim;
-
-    for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
-        const PetscInt foff = fieldVisitor.sectionOffset(v);
-        CPPUNIT_ASSERT_EQUAL(fiberDim, fieldVisitor.sectionDof(v));
-
-        const PetscInt coff = coordsVisitor.sectionOffset(v);
-        CPPUNIT_ASSERT_EQUAL(spaceDim, coordsVisitor.sectionDof(v));
-
-        for (PetscInt d = 0; d < fiberDim; ++d, ++index) {
-            PylithScalar value = 0.0;
-            for (PetscInt iv = 0; iv < spaceDim; ++iv) {
-                const PetscInt ic = d*spaceDim + iv;
-                value += data.coefs[ic]*coordsArray[coff+iv];
-            } // for
-            fieldArray[foff+d] = value;
-        } // for
+    // Expected values from DMInterpolationSetUp() and DMInterpolationEvaluate().
+    const PetscInt numDof = 3;
+    PetscErrorCode err = 0;
+    DMInterpolationInfo interpolatorE = NULL;
+    err = DMInterpolationCreate(_mesh->getComm(), &interpolatorE);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDim(interpolatorE, _spaceDim);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationAddPoints(interpolatorE, _numPoints, (PetscReal*) _points);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetUp(interpolatorE, _solution->getDM(), PETSC_TRUE, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDof(interpolatorE, numDof);PYLITH_CHECK_ERROR(err);
+    PetscVec valuesVecE = NULL;
+    err = DMInterpolationGetVector(interpolatorE, &valuesVecE);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationEvaluate(interpolatorE, _solution->getDM(), _solution->getLocalVector(),
+                                  valuesVecE);PYLITH_CHECK_ERROR(err);
+
+    PetscInt sizeE = 0;
+    err = VecGetLocalSize(valuesVecE, &sizeE);PYLITH_CHECK_ERROR(err);
+    REQUIRE(_numPoints*numDof == sizeE);
+    const PetscScalar* valuesE = NULL;
+    err = VecGetArrayRead(valuesVecE, &valuesE);PYLITH_CHECK_ERROR(err);
+
+    const pylith::topology::Field& pointSoln = output._interpolator->getPointField();
+    const pylith::int_vector& indices = output._interpolator->getPointIndices();
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(pointSoln.getDM(), 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    REQUIRE(size_t(vEnd - vStart) == indices.size());
+    REQUIRE(_numPoints == vEnd - vStart);
+
+    pylith::topology::VecVisitorMesh dispVisitor(pointSoln, "displacement");
+    const PetscScalar* dispArray = dispVisitor.localArray();
+    pylith::topology::VecVisitorMesh pressureVisitor(pointSoln, "fluid_pressure");
+    const PetscScalar* pressureArray = pressureVisitor.localArray();
+
+    const PylithReal tolerance = 1.0e-12;
+    for (PetscInt vertex = vStart, iPoint = 0; vertex < vEnd; ++vertex, ++iPoint) {
+        const PetscScalar* pointValuesE = &valuesE[indices[iPoint]*numDof];
+
+        INFO("Checking solution at point " << _pointNames[indices[iPoint]] << ".");
+        const PetscInt doff = dispVisitor.sectionOffset(vertex);
+        REQUIRE(2 == dispVisitor.sectionDof(vertex));
+        CHECK_THAT(dispArray[doff+0], Catch::Matchers::WithinAbs(pointValuesE[0], tolerance));
+        CHECK_THAT(dispArray[doff+1], Catch::Matchers::WithinAbs(pointValuesE[1], tolerance));
+        const PetscInt poff = pressureVisitor.sectionOffset(vertex);
+        REQUIRE(1 == pressureVisitor.sectionDof(vertex));
+        CHECK_THAT(pressureArray[poff], Catch::Matchers::WithinAbs(pointValuesE[2], tolerance));
     } // for
+    err = VecRestoreArrayRead(valuesVecE, &valuesE);PYLITH_CHECK_ERROR(err);
+
+    err = DMInterpolationRestoreVector(interpolatorE, &valuesVecE);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationDestroy(&interpolatorE);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
-} // _calcField
+} // _checkInterpolation
 
 
 // End of file
@@ -0,0 +1,364 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/OutputSolnRegion.hh" // Test subject
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <stdexcept> // USES std::runtime_error, std::invalid_argument
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputSolnRegion;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestOutputSolnRegion : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestOutputSolnRegion(void);
+
+    /// Destructor.
+    ~TestOutputSolnRegion(void);
+
+    /// Test setBoundingBox(), setLabelName(), setLabelValue(), and setDecimation().
+    void testAccessors(void);
+
+    /// Test verifyConfiguration().
+    void testVerifyConfiguration(void);
+
+    /// Test _createRegionMesh() without restricting cells.
+    void testRegionAll(void);
+
+    /// Test _createRegionMesh() with label.
+    void testRegionLabel(void);
+
+    /// Test _createRegionMesh() with bounding box.
+    void testRegionBoundingBox(void);
+
+    /// Test _createRegionMesh() with decimation.
+    void testRegionDecimation(void);
+
+    /// Test _createRegionMesh() with region that does not contain any cells.
+    void testRegionEmpty(void);
+
+private:
+
+    /// Create mesh and solution field.
+    void _initialize(void);
+
+    /** Check cells in region mesh.
+     *
+     * @param[in] output Solution region observer with region mesh.
+     * @param[in] numCellsE Expected number of cells in region.
+     * @param[in] centroidXE Expected x coordinate of centroid of first cell in region.
+     */
+    void _checkRegion(const OutputSolnRegion& output,
+                      const PetscInt numCellsE,
+                      const PylithReal centroidXE);
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _solution; ///< Solution field.
+
+}; // class TestOutputSolnRegion
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputSolnRegion::testAccessors", "[TestOutputSolnRegion]") {
+    pylith::meshio::TestOutputSolnRegion().testAccessors();
+}
+TEST_CASE("TestOutputSolnRegion::testVerifyConfiguration", "[TestOutputSolnRegion]") {
+    pylith::meshio::TestOutputSolnRegion().testVerifyConfiguration();
+}
+TEST_CASE("TestOutputSolnRegion::testRegionAll", "[TestOutputSolnRegion]") {
+    pylith::meshio::TestOutputSolnRegion().testRegionAll();
+}
+TEST_CASE("TestOutputSolnRegion::testRegionLabel", "[TestOutputSolnRegion]") {
+    pylith::meshio::TestOutputSolnRegion().testRegionLabel();
+}
+TEST_CASE("TestOutputSolnRegion::testRegionBoundingBox", "[TestOutputSolnRegion]") {
+    pylith::meshio::TestOutputSolnRegion().testRegionBoundingBox();
+}
+TEST_CASE("TestOutputSolnRegion::testRegionDecimation", "[TestOutputSolnRegion]") {
+    pylith::meshio::TestOutputSolnRegion().testRegionDecimation();
+}
+TEST_CASE("TestOutputSolnRegion::testRegionEmpty", "[TestOutputSolnRegion]") {
+    pylith::meshio::TestOutputSolnRegion().testRegionEmpty();
+}
+
+// Cell 0 (material-id 1) has centroid (-1/3, 0); cell 1 (material-id 0) has centroid (+1/3, 0).
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::TestOutputSolnRegion::TestOutputSolnRegion(void) :
+    _mesh(NULL),
+    _solution(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::TestOutputSolnRegion::~TestOutputSolnRegion(void) {
+    delete _solution;_solution = NULL;
+    delete _mesh;_mesh = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setBoundingBox(), setLabelName(), setLabelValue(), and setDecimation().
+void
+pylith::meshio::TestOutputSolnRegion::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnRegion output;
+    output.setIdentifier("region");
+    CHECK(output._bbox.size() == 0);
+    CHECK(std::string("") == output._labelName);
+    CHECK(1 == output._labelValue);
+    CHECK(1 == output._decimation);
+
+    const PylithReal bbox[4] = { -1.0, 0.5, -2.0, 3.0 };
+    output.setBoundingBox(bbox, 4);
+    REQUIRE(size_t(4) == output._bbox.size());
+    for (size_t i = 0; i < 4; ++i) {
+        CHECK(bbox[i] == output._bbox[i]);
+    } // for
+    output.setBoundingBox(NULL, 0);
+    CHECK(output._bbox.size() == 0);
+    CHECK_THROWS_AS(output.setBoundingBox(bbox, 3), std::invalid_argument);
+
+    output.setLabelName("material-id");
+    CHECK(std::string("material-id") == output._labelName);
+
+    output.setLabelValue(4);
+    CHECK(4 == output._labelValue);
+
+    output.setDecimation(3);
+    CHECK(3 == output._decimation);
+    CHECK_THROWS_AS(output.setDecimation(0), std::invalid_argument);
+    CHECK(3 == output._decimation);
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test verifyConfiguration().
+void
+pylith::meshio::TestOutputSolnRegion::testVerifyConfiguration(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    OutputSolnRegion output;
+    output.setIdentifier("region");
+    output.verifyConfiguration(*_solution);
+
+    output.setLabelName(pylith::topology::Mesh::cells_label_name);
+    output.verifyConfiguration(*_solution);
+
+    output.setLabelName("abc");
+    CHECK_THROWS_AS(output.verifyConfiguration(*_solution), std::runtime_error);
+    output.setLabelName("");
+
+    const PylithReal bbox[6] = { -1.0, 1.0, -1.0, 1.0, -1.0, 1.0 };
+    output.setBoundingBox(bbox, 6);
+    CHECK_THROWS_AS(output.verifyConfiguration(*_solution), std::runtime_error);
+
+    output.setBoundingBox(bbox, 4);
+    output.verifyConfiguration(*_solution);
+
+    PYLITH_METHOD_END;
+} // testVerifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _createRegionMesh() without restricting cells.
+void
+pylith::meshio::TestOutputSolnRegion::testRegionAll(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    OutputSolnRegion output;
+    output.setIdentifier("region");
+    output._createRegionMesh(*_mesh);
+    _checkRegion(output, 2, -1.0/3.0);
+
+    PYLITH_METHOD_END;
+} // testRegionAll
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _createRegionMesh() with label.
+void
+pylith::meshio::TestOutputSolnRegion::testRegionLabel(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    OutputSolnRegion output;
+    output.setIdentifier("region");
+    output.setLabelName(pylith::topology::Mesh::cells_label_name);
+    output.setLabelValue(0);
+    output._createRegionMesh(*_mesh);
+    _checkRegion(output, 1, +1.0/3.0);
+
+    PYLITH_METHOD_END;
+} // testRegionLabel
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _createRegionMesh() with bounding box.
+void
+pylith::meshio::TestOutputSolnRegion::testRegionBoundingBox(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    OutputSolnRegion output;
+    output.setIdentifier("region");
+    const PylithReal bbox[4] = { -1.0, 0.0, -1.0, 1.0 };
+    output.setBoundingBox(bbox, 4);
+    output._createRegionMesh(*_mesh);
+    _checkRegion(output, 1, -1.0/3.0);
+
+    PYLITH_METHOD_END;
+} // testRegionBoundingBox
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _createRegionMesh() with decimation.
+void
+pylith::meshio::TestOutputSolnRegion::testRegionDecimation(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    OutputSolnRegion output;
+    output.setIdentifier("region");
+    output.setDecimation(2);
+    output._createRegionMesh(*_mesh);
+    _checkRegion(output, 1, -1.0/3.0);
+
+    PYLITH_METHOD_END;
+} // testRegionDecimation
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _createRegionMesh() with region that does not contain any cells.
+void
+pylith::meshio::TestOutputSolnRegion::testRegionEmpty(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    { // Bounding box outside domain.
+        OutputSolnRegion output;
+        output.setIdentifier("region");
+        const PylithReal bbox[4] = { 2.0, 3.0, 2.0, 3.0 };
+        output.setBoundingBox(bbox, 4);
+        CHECK_THROWS_AS(output._createRegionMesh(*_mesh), std::runtime_error);
+        CHECK(!output._regionMesh);
+    } // Bounding box outside domain.
+
+    { // Bounding box and label without common cells.
+        OutputSolnRegion output;
+        output.setIdentifier("region");
+        const PylithReal bbox[4] = { 0.0, 1.0, -1.0, 1.0 };
+        output.setBoundingBox(bbox, 4);
+        output.setLabelName(pylith::topology::Mesh::cells_label_name);
+        output.setLabelValue(1);
+        CHECK_THROWS_AS(output._createRegionMesh(*_mesh), std::runtime_error);
+        CHECK(!output._regionMesh);
+    } // Bounding box and label without common cells.
+
+    PYLITH_METHOD_END;
+} // testRegionEmpty
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh and solution field.
+void
+pylith::meshio::TestOutputSolnRegion::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    delete _solution;_solution = new pylith::topology::Field(*_mesh);assert(_solution);
+    _solution->setLabel("solution");
+    const char* componentNames[2] = { "displacement_x", "displacement_y" };
+    pylith::string_vector names(componentNames, componentNames+2);
+    pylith::topology::Field::Description description("displacement", "displacement", names, 2,
+                                                     pylith::topology::Field::VECTOR, 1.0);
+    _solution->subfieldAdd(description, pylith::topology::Field::Discretization(1, 1, _mesh->getDimension()));
+    _solution->subfieldsSetup();
+    _solution->createDiscretization();
+    _solution->allocate();
+    _solution->zeroLocal();
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Check cells in region mesh.
+void
+pylith::meshio::TestOutputSolnRegion::_checkRegion(const OutputSolnRegion& output,
+                                                   const PetscInt numCellsE,
+                                                   const PylithReal centroidXE) {
+    PYLITH_METHOD_BEGIN;
+
+    REQUIRE(output._regionMesh);
+    PetscDM dmRegion = output._regionMesh->getDM();REQUIRE(dmRegion);
+
+    PetscInt cStart = 0, cEnd = 0;
+    PetscErrorCode err = DMPlexGetHeightStratum(dmRegion, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    REQUIRE(numCellsE == cEnd - cStart);
+    CHECK(_mesh->getDimension() == output._regionMesh->getDimension());
+
+    PylithReal centroid[3];
+    err = DMPlexComputeCellGeometryFVM(dmRegion, cStart, NULL, centroid, NULL);PYLITH_CHECK_ERROR(err);
+    const PylithReal tolerance = 1.0e-12;
+    CHECK_THAT(centroid[0], Catch::Matchers::WithinAbs(centroidXE, tolerance));
+    CHECK_THAT(centroid[1], Catch::Matchers::WithinAbs(0.0, tolerance));
+
+    PYLITH_METHOD_END;
+} // _checkRegion
+
+
+// End of file
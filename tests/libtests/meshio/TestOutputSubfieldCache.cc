@@ -0,0 +1,177 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/OutputSubfieldCache.hh" // USES OutputSubfieldCache
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include "catch2/catch_test_macros.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputSubfieldCache;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestOutputSubfieldCache : public pylith::utils::GenericComponent {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test get() and put().
+    static
+    void testGetPut(void);
+
+    /// Test getDM(), putDM(), and getVector().
+    static
+    void testBuffers(void);
+
+}; // TestOutputSubfieldCache
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputSubfieldCache::testGetPut", "[TestOutputSubfieldCache][testGetPut]") {
+    pylith::meshio::TestOutputSubfieldCache::testGetPut();
+}
+TEST_CASE("TestOutputSubfieldCache::testBuffers", "[TestOutputSubfieldCache][testBuffers]") {
+    pylith::meshio::TestOutputSubfieldCache::testBuffers();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test get() and put().
+void
+pylith::meshio::TestOutputSubfieldCache::testGetPut(void) {
+    PetscErrorCode err;
+    PetscVec fieldVector = NULL, vector = NULL;
+    PetscDM dm = NULL;
+    err = VecCreateSeq(PETSC_COMM_SELF, 4, &fieldVector);PYLITH_CHECK_ERROR(err);
+    err = VecCreateSeq(PETSC_COMM_SELF, 2, &vector);PYLITH_CHECK_ERROR(err);
+    err = DMShellCreate(PETSC_COMM_SELF, &dm);PYLITH_CHECK_ERROR(err);
+
+    OutputSubfieldCache::Key key;
+    key.name = "displacement";
+    key.basisOrder = 1;
+    key.meshId = 1;
+    key.labelName = "";
+    key.labelValue = 0;
+
+    OutputSubfieldCache cache;
+    PetscDM dmCached = NULL;
+    PetscVec vectorCached = NULL;
+    CHECK(false == cache.get(key, fieldVector, &dmCached, &vectorCached));
+
+    cache.put(key, fieldVector, dm, vector);
+    CHECK(true == cache.get(key, fieldVector, &dmCached, &vectorCached));
+    CHECK(dm == dmCached);
+    CHECK(vector == vectorCached);
+
+    OutputSubfieldCache::Key keyOther = key;
+    keyOther.basisOrder = 0;
+    CHECK(false == cache.get(keyOther, fieldVector, &dmCached, &vectorCached));
+
+    // Changing field vector invalidates projection.
+    err = VecSet(fieldVector, 1.0);PYLITH_CHECK_ERROR(err);
+    CHECK(false == cache.get(key, fieldVector, &dmCached, &vectorCached));
+
+    // Changing projected vector invalidates projection.
+    cache.put(key, fieldVector, dm, vector);
+    CHECK(true == cache.get(key, fieldVector, &dmCached, &vectorCached));
+    err = VecSet(vector, 2.0);PYLITH_CHECK_ERROR(err);
+    CHECK(false == cache.get(key, fieldVector, &dmCached, &vectorCached));
+
+    // Cache holds references.
+    err = VecDestroy(&vector);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dm);PYLITH_CHECK_ERROR(err);
+    cache.deallocate();
+    err = VecDestroy(&fieldVector);PYLITH_CHECK_ERROR(err);
+} // testGetPut
+
+
+// ------------------------------------------------------------------------------------------------
+// Test getDM(), putDM(), and getVector().
+void
+pylith::meshio::TestOutputSubfieldCache::testBuffers(void) {
+    PetscErrorCode err;
+    PetscVec shellVector = NULL, fieldVector = NULL;
+    PetscDM dm = NULL;
+    err = VecCreateSeq(PETSC_COMM_SELF, 4, &fieldVector);PYLITH_CHECK_ERROR(err);
+    err = VecCreateSeq(PETSC_COMM_SELF, 2, &shellVector);PYLITH_CHECK_ERROR(err);
+    err = DMShellCreate(PETSC_COMM_SELF, &dm);PYLITH_CHECK_ERROR(err);
+    err = DMShellSetGlobalVector(dm, shellVector);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&shellVector);PYLITH_CHECK_ERROR(err);
+
+    OutputSubfieldCache::Layout layout;
+    layout.name = "displacement";
+    layout.meshId = 1;
+    layout.numComponents = 2;
+    layout.discretization = pylith::topology::FieldBase::Discretization(1, 1);
+
+    OutputSubfieldCache::Layout layoutOther = layout;
+    layoutOther.name = "velocity";
+
+    OutputSubfieldCache cache;
+    CHECK(!cache.getDM(layout));
+    cache.putDM(layout, dm);
+    CHECK(dm == cache.getDM(layout));
+    CHECK(!cache.getDM(layoutOther));
+
+    // Vector returned to pool is reused.
+    PetscVec vectorA = cache.getVector(layout);
+    REQUIRE(vectorA);
+    PetscVec vectorB = cache.getVector(layout);
+    CHECK(vectorA != vectorB);
+    PetscVec vectorTmp = vectorA;
+    err = VecDestroy(&vectorA);PYLITH_CHECK_ERROR(err);
+    vectorA = cache.getVector(layout);
+    CHECK(vectorTmp == vectorA);
+
+    // Vector held outside pool and cache is not reused.
+    PetscVec vectorHeld = vectorB;
+    err = PetscObjectReference((PetscObject)vectorHeld);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&vectorB);PYLITH_CHECK_ERROR(err);
+    vectorB = cache.getVector(layout);
+    CHECK(vectorHeld != vectorB);
+    CHECK(vectorA != vectorB);
+
+    // Vector held only by projection in cache is reused.
+    OutputSubfieldCache::Key key;
+    key.name = "displacement";
+    key.basisOrder = 1;
+    key.meshId = 1;
+    key.labelName = "";
+    key.labelValue = 0;
+    cache.put(key, fieldVector, dm, vectorA);
+    vectorTmp = vectorA;
+    err = VecDestroy(&vectorA);PYLITH_CHECK_ERROR(err);
+    vectorA = cache.getVector(layout);
+    CHECK(vectorTmp == vectorA);
+
+    // Pool holds references.
+    err = VecDestroy(&vectorA);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&vectorB);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&vectorHeld);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dm);PYLITH_CHECK_ERROR(err);
+    cache.deallocate();
+    err = VecDestroy(&fieldVector);PYLITH_CHECK_ERROR(err);
+} // testBuffers
+
+
+// End of file
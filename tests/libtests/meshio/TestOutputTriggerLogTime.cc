@@ -0,0 +1,106 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/OutputTriggerLogTime.hh" // USES OutputTriggerLogTime
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <stdexcept> // USES std::invalid_argument
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputTriggerLogTime;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestOutputTriggerLogTime : public pylith::utils::GenericComponent {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test setTimeFirst(), getTimeFirst(), setRatio(), and getRatio().
+    static
+    void testAccessors(void);
+
+    /// Test shouldWrite().
+    static
+    void testShouldWrite(void);
+
+}; // TestOutputTriggerLogTime
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputTriggerLogTime::testAccessors", "[TestOutputTriggerLogTime][testAccessors]") {
+    pylith::meshio::TestOutputTriggerLogTime::testAccessors();
+}
+TEST_CASE("TestOutputTriggerLogTime::testShouldWrite", "[TestOutputTriggerLogTime][testShouldWrite]") {
+    pylith::meshio::TestOutputTriggerLogTime::testShouldWrite();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setTimeFirst(), getTimeFirst(), setRatio(), and getRatio().
+void
+pylith::meshio::TestOutputTriggerLogTime::testAccessors(void) {
+    const double tolerance = 1.0e-6;
+
+    OutputTriggerLogTime trigger;
+
+    CHECK_THAT(trigger.getTimeFirst(), Catch::Matchers::WithinAbs(1.0, tolerance)); // default
+    CHECK_THAT(trigger.getRatio(), Catch::Matchers::WithinAbs(2.0, tolerance)); // default
+
+    trigger.setTimeFirst(0.25);
+    CHECK_THAT(trigger.getTimeFirst(), Catch::Matchers::WithinAbs(0.25, tolerance));
+    trigger.setRatio(3.0);
+    CHECK_THAT(trigger.getRatio(), Catch::Matchers::WithinAbs(3.0, tolerance));
+
+    CHECK_THROWS_AS(trigger.setTimeFirst(0.0), std::invalid_argument);
+    CHECK_THROWS_AS(trigger.setRatio(1.0), std::invalid_argument);
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test shouldWrite().
+void
+pylith::meshio::TestOutputTriggerLogTime::testShouldWrite(void) {
+    OutputTriggerLogTime trigger;
+    trigger.setTimeFirst(0.0999);
+    trigger.setRatio(2.0);
+
+    // Writes at elapsed times of 0, 0.1, 0.2, 0.4, and 0.8.
+    const PylithReal dt = 0.1;
+    PylithReal t = 1.0;
+    PylithInt tindex = 0;
+    CHECK(true == trigger.shouldWrite(t, tindex++));t += dt; // 0.0
+    CHECK(true == trigger.shouldWrite(t, tindex++));t += dt; // 0.1
+    CHECK(true == trigger.shouldWrite(t, tindex++));t += dt; // 0.2
+    CHECK(false == trigger.shouldWrite(t, tindex++));t += dt; // 0.3
+    CHECK(true == trigger.shouldWrite(t, tindex++));t += dt; // 0.4
+    CHECK(false == trigger.shouldWrite(t, tindex++));t += dt; // 0.5
+    CHECK(false == trigger.shouldWrite(t, tindex++));t += dt; // 0.6
+    CHECK(false == trigger.shouldWrite(t, tindex++));t += dt; // 0.7
+    CHECK(true == trigger.shouldWrite(t, tindex++));t += dt; // 0.8
+    CHECK(false == trigger.shouldWrite(t, tindex++));t += dt; // 0.9
+} // testShouldWrite
+
+
+// End of file
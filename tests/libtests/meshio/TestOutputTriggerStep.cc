@@ -44,6 +44,14 @@ public:
     static
     void testShouldWrite(void);
 
+    /// Test willWrite().
+    static
+    void testWillWrite(void);
+
+    /// Test getOutputFraction().
+    static
+    void testOutputFraction(void);
+
 }; // TestOutputTriggerStep
 
 // ------------------------------------------------------------------------------------------------
@@ -53,6 +61,12 @@ TEST_CASE("TestOutputTriggerStep::testNumStepsSkip", "[TestOutputTriggerStep][te
 TEST_CASE("TestOutputTriggerStep::testShouldWrite", "[TestOutputTriggerStep][testShouldWrite]") {
     pylith::meshio::TestOutputTriggerStep::testShouldWrite();
 }
+TEST_CASE("TestOutputTriggerStep::testWillWrite", "[TestOutputTriggerStep][testWillWrite]") {
+    pylith::meshio::TestOutputTriggerStep::testWillWrite();
+}
+TEST_CASE("TestOutputTriggerStep::testOutputFraction", "[TestOutputTriggerStep][testOutputFraction]") {
+    pylith::meshio::TestOutputTriggerStep::testOutputFraction();
+}
 
 // ------------------------------------------------------------------------------------------------
 // Test setNumStepsSkip() and getNumStepsSkip().
@@ -102,4 +116,33 @@ pylith::meshio::TestOutputTriggerStep::testShouldWrite(void) {
 } // testShouldWrite
 
 
+// ------------------------------------------------------------------------------------------------
+// Test willWrite().
+void
+pylith::meshio::TestOutputTriggerStep::testWillWrite(void) {
+    OutputTriggerStep trigger;
+    trigger.setNumStepsSkip(2);
+
+    const PylithReal dt = 0.1;
+    PylithReal t = 0.0;
+    for (PylithInt tindex = 0; tindex < 10; ++tindex, t += dt) {
+        const bool willWrite = trigger.willWrite(t, tindex);
+        CHECK(willWrite == trigger.willWrite(t, tindex)); // Does not change state.
+        CHECK(willWrite == trigger.shouldWrite(t, tindex));
+    } // for
+} // testWillWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Test getOutputFraction().
+void
+pylith::meshio::TestOutputTriggerStep::testOutputFraction(void) {
+    OutputTriggerStep trigger;
+    CHECK(1.0 == trigger.getOutputFraction());
+
+    trigger.setNumStepsSkip(3);
+    CHECK(0.25 == trigger.getOutputFraction());
+} // testOutputFraction
+
+
 // End of file
@@ -0,0 +1,462 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/PointInterpolator.hh" // Test subject
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestPointInterpolator;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestPointInterpolator : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestPointInterpolator(void);
+
+    /// Destructor.
+    ~TestPointInterpolator(void);
+
+    /// Test setPoints().
+    void testSetPoints(void);
+
+    /// Test setup() and interpolate() with interpolation matrix.
+    void testInterpolateMatrix(void);
+
+    /// Test setup() and interpolate() with DMInterpolationEvaluate().
+    void testInterpolateEvaluate(void);
+
+    /// Test setLabel() drops points not in cells with label value.
+    void testSetLabel(void);
+
+    /// Test setup() with point outside mesh.
+    void testPointNotFound(void);
+
+    /// Test setup() with points on the boundary of the bounding box of the mesh vertices.
+    void testPointsOnBoundary(void);
+
+private:
+
+    /** Create mesh and field with subfields displacement (vector) and fluid_pressure (scalar) that vary linearly
+     * with the coordinates.
+     */
+    void _initialize(void);
+
+    /** Check values of interpolated field at points.
+     *
+     * @param[in] interpolator Point interpolator.
+     * @param[in] checkPressure Check fluid_pressure subfield in addition to displacement subfield.
+     */
+    void _checkInterpolation(const PointInterpolator& interpolator,
+                             const bool checkPressure);
+
+    /** Compute field at location.
+     *
+     * @param[out] values Array of values [disp_x, disp_y, fluid_pressure].
+     * @param[in] x Coordinates of location.
+     */
+    static
+    void _computeField(PylithReal values[],
+                       const PylithReal x[]);
+
+    static const int _numPoints; ///< Number of points.
+    static const int _spaceDim; ///< Spatial dimension.
+    static const PylithReal _points[]; ///< Coordinates of points.
+    static const char* _pointNames[]; ///< Names of points.
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _field; ///< Field to interpolate.
+
+}; // class TestPointInterpolator
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestPointInterpolator::testSetPoints", "[TestPointInterpolator]") {
+    pylith::meshio::TestPointInterpolator().testSetPoints();
+}
+TEST_CASE("TestPointInterpolator::testInterpolateMatrix", "[TestPointInterpolator]") {
+    pylith::meshio::TestPointInterpolator().testInterpolateMatrix();
+}
+TEST_CASE("TestPointInterpolator::testInterpolateEvaluate", "[TestPointInterpolator]") {
+    pylith::meshio::TestPointInterpolator().testInterpolateEvaluate();
+}
+TEST_CASE("TestPointInterpolator::testSetLabel", "[TestPointInterpolator]") {
+    pylith::meshio::TestPointInterpolator().testSetLabel();
+}
+TEST_CASE("TestPointInterpolator::testPointNotFound", "[TestPointInterpolator]") {
+    pylith::meshio::TestPointInterpolator().testPointNotFound();
+}
+TEST_CASE("TestPointInterpolator::testPointsOnBoundary", "[TestPointInterpolator]") {
+    pylith::meshio::TestPointInterpolator().testPointsOnBoundary();
+}
+
+// Points p0 and p2 are in cell 0 (material-id 1); points p1 and p3 are in cell 1 (material-id 0).
+const int pylith::meshio::TestPointInterpolator::_numPoints = 4;
+const int pylith::meshio::TestPointInterpolator::_spaceDim = 2;
+const PylithReal pylith::meshio::TestPointInterpolator::_points[4*2] = {
+    -0.5, 0.1,
+    0.4, -0.2,
+    -0.2, -0.3,
+    0.3, 0.5,
+};
+const char* pylith::meshio::TestPointInterpolator::_pointNames[4] = { "p0", "p1", "p2", "p3" };
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::TestPointInterpolator::TestPointInterpolator(void) :
+    _mesh(NULL),
+    _field(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::TestPointInterpolator::~TestPointInterpolator(void) {
+    delete _field;_field = NULL;
+    delete _mesh;_mesh = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setPoints().
+void
+pylith::meshio::TestPointInterpolator::testSetPoints(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PointInterpolator interpolator;
+    interpolator.setPoints(_points, _numPoints, _spaceDim, _pointNames, _numPoints);
+    CHECK(!interpolator.isSetup());
+    CHECK(size_t(_numPoints) == interpolator.getNumPoints());
+
+    const pylith::string_vector& names = interpolator.getPointNames();
+    const pylith::int_vector& indices = interpolator.getPointIndices();
+    REQUIRE(size_t(_numPoints) == names.size());
+    REQUIRE(size_t(_numPoints) == indices.size());
+    for (int i = 0; i < _numPoints; ++i) {
+        CHECK(std::string(_pointNames[i]) == names[i]);
+        CHECK(i == indices[i]);
+    } // for
+    REQUIRE(size_t(_numPoints*_spaceDim) == interpolator._pointCoords.size());
+    for (int i = 0; i < _numPoints*_spaceDim; ++i) {
+        CHECK(_points[i] == interpolator._pointCoords[i]);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testSetPoints
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setup() and interpolate() with interpolation matrix.
+void
+pylith::meshio::TestPointInterpolator::testInterpolateMatrix(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    PointInterpolator interpolator;
+    interpolator.setPoints(_points, _numPoints, _spaceDim, _pointNames, _numPoints);
+    interpolator.useInterpolationMatrix(true);
+
+    // Only the requested subfields are in the interpolation matrix.
+    pylith::string_vector subfieldNames(1, "displacement");
+    interpolator.setup(*_field, subfieldNames);
+    CHECK(interpolator.isSetup());
+    REQUIRE(interpolator.getInterpolationMatrix());
+
+    interpolator.interpolate(*_field);
+    _checkInterpolation(interpolator, false);
+
+    // Interpolation matrix is reused.
+    interpolator.interpolate(*_field);
+    _checkInterpolation(interpolator, false);
+
+    PYLITH_METHOD_END;
+} // testInterpolateMatrix
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setup() and interpolate() with DMInterpolationEvaluate().
+void
+pylith::meshio::TestPointInterpolator::testInterpolateEvaluate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    PointInterpolator interpolator;
+    interpolator.setPoints(_points, _numPoints, _spaceDim, _pointNames, _numPoints);
+    interpolator.useInterpolationMatrix(false);
+
+    // All subfields are interpolated.
+    interpolator.setup(*_field, _field->getSubfieldNames());
+    CHECK(interpolator.isSetup());
+    CHECK(!interpolator.getInterpolationMatrix());
+
+    interpolator.interpolate(*_field);
+    _checkInterpolation(interpolator, true);
+
+    PYLITH_METHOD_END;
+} // testInterpolateEvaluate
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setLabel() drops points not in cells with label value.
+void
+pylith::meshio::TestPointInterpolator::testSetLabel(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    PointInterpolator interpolator;
+    interpolator.setPoints(_points, _numPoints, _spaceDim, _pointNames, _numPoints);
+    interpolator.setLabel(pylith::topology::Mesh::cells_label_name, 1);
+    interpolator.setup(*_field, _field->getSubfieldNames());
+
+    // Only points p0 and p2 are in cells with material-id 1.
+    const pylith::string_vector& names = interpolator.getPointNames();
+    const pylith::int_vector& indices = interpolator.getPointIndices();
+    REQUIRE(size_t(2) == interpolator.getNumPoints());
+    REQUIRE(size_t(2) == indices.size());
+    CHECK(std::string("p0") == names[0]);
+    CHECK(0 == indices[0]);
+    CHECK(std::string("p2") == names[1]);
+    CHECK(2 == indices[1]);
+
+    interpolator.interpolate(*_field);
+    _checkInterpolation(interpolator, true);
+
+    // No cells have label value, so all points are dropped without error.
+    interpolator.setPoints(_points, _numPoints, _spaceDim, _pointNames, _numPoints);
+    interpolator.setLabel(pylith::topology::Mesh::cells_label_name, 5);
+    interpolator.setup(*_field, _field->getSubfieldNames());
+    CHECK(size_t(0) == interpolator.getNumPoints());
+
+    PYLITH_METHOD_END;
+} // testSetLabel
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setup() with point outside mesh.
+void
+pylith::meshio::TestPointInterpolator::testPointNotFound(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    const int numPoints = 2;
+    const PylithReal points[numPoints*2] = {
+        -0.5, 0.1,
+        2.0, 2.0,
+    };
+    const char* pointNames[numPoints] = { "inside", "outside" };
+
+    PointInterpolator interpolator;
+    interpolator.setPoints(points, numPoints, _spaceDim, pointNames, numPoints);
+    CHECK_THROWS_AS(interpolator.setup(*_field, _field->getSubfieldNames()), std::runtime_error);
+
+    PYLITH_METHOD_END;
+} // testPointNotFound
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setup() with points on the boundary of the bounding box of the mesh vertices.
+void
+pylith::meshio::TestPointInterpolator::testPointsOnBoundary(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    // Points at the extreme vertices and on edges of the mesh must be candidates for point location.
+    const int numPoints = 4;
+    const PylithReal points[numPoints*2] = {
+        1.0, 0.0,
+        0.0, -1.0,
+        0.5, 0.5,
+        -0.5, -0.5,
+    };
+    const char* pointNames[numPoints] = { "xmax", "ymin", "edge_ne", "edge_sw" };
+
+    PointInterpolator interpolator;
+    interpolator.setPoints(points, numPoints, _spaceDim, pointNames, numPoints);
+    interpolator.setup(*_field, _field->getSubfieldNames());
+
+    const pylith::string_vector& names = interpolator.getPointNames();
+    const pylith::int_vector& indices = interpolator.getPointIndices();
+    REQUIRE(size_t(numPoints) == interpolator.getNumPoints());
+    REQUIRE(size_t(numPoints) == indices.size());
+    for (int i = 0; i < numPoints; ++i) {
+        CHECK(std::string(pointNames[indices[i]]) == names[i]);
+    } // for
+
+    interpolator.interpolate(*_field);
+    const pylith::topology::Field& pointField = interpolator.getPointField();
+    PetscInt vStart = 0, vEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(pointField.getDM(), 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    REQUIRE(numPoints == vEnd - vStart);
+
+    pylith::topology::VecVisitorMesh dispVisitor(pointField, "displacement");
+    const PetscScalar* dispArray = dispVisitor.localArray();
+    const PylithReal tolerance = 1.0e-12;
+    for (PetscInt vertex = vStart, iPoint = 0; vertex < vEnd; ++vertex, ++iPoint) {
+        PylithReal valuesE[3];
+        _computeField(valuesE, &points[indices[iPoint]*_spaceDim]);
+
+        INFO("Checking interpolated field at point " << pointNames[indices[iPoint]] << ".");
+        const PetscInt doff = dispVisitor.sectionOffset(vertex);
+        CHECK_THAT(dispArray[doff+0], Catch::Matchers::WithinAbs(valuesE[0], tolerance));
+        CHECK_THAT(dispArray[doff+1], Catch::Matchers::WithinAbs(valuesE[1], tolerance));
+    } // for
+
+    PYLITH_METHOD_END;
+} // testPointsOnBoundary
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh and field with subfields that vary linearly with the coordinates.
+void
+pylith::meshio::TestPointInterpolator::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    delete _field;_field = new pylith::topology::Field(*_mesh);assert(_field);
+    _field->setLabel("solution");
+    const char* dispComponents[2] = { "displacement_x", "displacement_y" };
+    pylith::topology::Field::Description dispDescription("displacement", "displacement",
+                                                         pylith::string_vector(dispComponents, dispComponents+2), 2,
+                                                         pylith::topology::Field::VECTOR, 1.0);
+    _field->subfieldAdd(dispDescription, pylith::topology::Field::Discretization(1, 1, _mesh->getDimension()));
+    pylith::topology::Field::Description pressureDescription("fluid_pressure", "fluid_pressure",
+                                                             pylith::string_vector(1, "fluid_pressure"), 1,
+                                                             pylith::topology::Field::SCALAR, 1.0);
+    _field->subfieldAdd(pressureDescription, pylith::topology::Field::Discretization(1, 1, _mesh->getDimension()));
+    _field->subfieldsSetup();
+    _field->createDiscretization();
+    _field->allocate();
+    _field->zeroLocal();
+
+    PetscDM dm = _field->getDM();assert(dm);
+    PetscInt vStart = 0, vEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::CoordsVisitor coordsVisitor(dm);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();
+    pylith::topology::VecVisitorMesh dispVisitor(*_field, "displacement");
+    PetscScalar* dispArray = dispVisitor.localArray();
+    pylith::topology::VecVisitorMesh pressureVisitor(*_field, "fluid_pressure");
+    PetscScalar* pressureArray = pressureVisitor.localArray();
+    for (PetscInt vertex = vStart; vertex < vEnd; ++vertex) {
+        const PetscInt coff = coordsVisitor.sectionOffset(vertex);
+        assert(_spaceDim == coordsVisitor.sectionDof(vertex));
+        PylithReal values[3];
+        _computeField(values, &coordsArray[coff]);
+
+        const PetscInt doff = dispVisitor.sectionOffset(vertex);
+        assert(2 == dispVisitor.sectionDof(vertex));
+        dispArray[doff+0] = values[0];
+        dispArray[doff+1] = values[1];
+
+        const PetscInt poff = pressureVisitor.sectionOffset(vertex);
+        assert(1 == pressureVisitor.sectionDof(vertex));
+        pressureArray[poff] = values[2];
+    } // for
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Check values of interpolated field at points.
+void
+pylith::meshio::TestPointInterpolator::_checkInterpolation(const PointInterpolator& interpolator,
+                                                           const bool checkPressure) {
+    PYLITH_METHOD_BEGIN;
+
+    const pylith::topology::Field& pointField = interpolator.getPointField();
+    const pylith::int_vector& indices = interpolator.getPointIndices();
+
+    PetscInt vStart = 0, vEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(pointField.getDM(), 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    REQUIRE(size_t(vEnd - vStart) == indices.size());
+
+    pylith::topology::VecVisitorMesh dispVisitor(pointField, "displacement");
+    const PetscScalar* dispArray = dispVisitor.localArray();
+    pylith::topology::VecVisitorMesh pressureVisitor(pointField, "fluid_pressure");
+    const PetscScalar* pressureArray = pressureVisitor.localArray();
+
+    // Linear field is reproduced exactly by linear basis functions.
+    const PylithReal tolerance = 1.0e-12;
+    for (PetscInt vertex = vStart, iPoint = 0; vertex < vEnd; ++vertex, ++iPoint) {
+        PylithReal valuesE[3];
+        _computeField(valuesE, &_points[indices[iPoint]*_spaceDim]);
+
+        INFO("Checking interpolated field at point " << _pointNames[indices[iPoint]] << ".");
+        const PetscInt doff = dispVisitor.sectionOffset(vertex);
+        REQUIRE(2 == dispVisitor.sectionDof(vertex));
+        CHECK_THAT(dispArray[doff+0], Catch::Matchers::WithinAbs(valuesE[0], tolerance));
+        CHECK_THAT(dispArray[doff+1], Catch::Matchers::WithinAbs(valuesE[1], tolerance));
+        if (checkPressure) {
+            const PetscInt poff = pressureVisitor.sectionOffset(vertex);
+            REQUIRE(1 == pressureVisitor.sectionDof(vertex));
+            CHECK_THAT(pressureArray[poff], Catch::Matchers::WithinAbs(valuesE[2], tolerance));
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // _checkInterpolation
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute field at location.
+void
+pylith::meshio::TestPointInterpolator::_computeField(PylithReal values[],
+                                                     const PylithReal x[]) {
+    assert(values);
+    assert(x);
+
+    values[0] = 1.0 + 2.0*x[0] - x[1];
+    values[1] = -0.5 + x[0] + 3.0*x[1];
+    values[2] = 4.0 - x[0] + 0.5*x[1];
+} // _computeField
+
+
+// End of file
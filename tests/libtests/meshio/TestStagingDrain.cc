@@ -0,0 +1,129 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/StagingDrain.hh" // USES StagingDrain
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <fstream> // USES std::ofstream, std::ifstream
+#include <cstdio> // USES remove()
+#include <string> // USES std::string
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestStagingDrain;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestStagingDrain : public pylith::utils::GenericComponent {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test stagedFilename().
+    static
+    void testStagedFilename(void);
+
+    /// Test add() and wait().
+    static
+    void testDrain(void);
+
+    /// Test wait() with missing final file.
+    static
+    void testError(void);
+
+}; // TestStagingDrain
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestStagingDrain::testStagedFilename", "[TestStagingDrain][testStagedFilename]") {
+    pylith::meshio::TestStagingDrain::testStagedFilename();
+}
+TEST_CASE("TestStagingDrain::testDrain", "[TestStagingDrain][testDrain]") {
+    pylith::meshio::TestStagingDrain::testDrain();
+}
+TEST_CASE("TestStagingDrain::testError", "[TestStagingDrain][testError]") {
+    pylith::meshio::TestStagingDrain::testError();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test stagedFilename().
+void
+pylith::meshio::TestStagingDrain::testStagedFilename(void) {
+    CHECK(std::string("/tmp/nvme/out_disp.dat.p3.12") ==
+          StagingDrain::stagedFilename("/tmp/nvme", "output/lustre/out_disp.dat", 3, 12));
+    CHECK(std::string("./out.dat.p0.0") == StagingDrain::stagedFilename(".", "out.dat", 0, 0));
+} // testStagedFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Test add() and wait().
+void
+pylith::meshio::TestStagingDrain::testDrain(void) {
+    const char* finalFilename = "stagingdrain_final.dat";
+    { std::ofstream fout(finalFilename); } // Create empty final file.
+
+    // Blocks from two "processes" for two "time steps", added out of order.
+    const char* blocks[4] = { "aaaa", "bbb", "cccc", "ddd" };
+    const uint64_t offsets[4] = { 0, 4, 7, 11 };
+    const int order[4] = { 1, 3, 0, 2 };
+
+    StagingDrain drain;
+    for (int i = 0; i < 4; ++i) {
+        const int iBlock = order[i];
+        const std::string& staged = StagingDrain::stagedFilename(".", finalFilename, iBlock % 2, iBlock / 2);
+        { std::ofstream fout(staged.c_str()); fout << blocks[iBlock]; }
+        drain.add(staged, finalFilename, offsets[iBlock]);
+    } // for
+    drain.wait();
+    CHECK(size_t(0) == drain.getNumPending());
+
+    std::ifstream fin(finalFilename);
+    std::string contents;
+    std::getline(fin, contents);
+    CHECK(std::string("aaaabbbccccddd") == contents);
+
+    // Staged files are removed after they are drained.
+    for (int iBlock = 0; iBlock < 4; ++iBlock) {
+        const std::string& staged = StagingDrain::stagedFilename(".", finalFilename, iBlock % 2, iBlock / 2);
+        CHECK(!std::ifstream(staged.c_str()).good());
+    } // for
+    std::remove(finalFilename);
+} // testDrain
+
+
+// ------------------------------------------------------------------------------------------------
+// Test wait() with missing final file.
+void
+pylith::meshio::TestStagingDrain::testError(void) {
+    const std::string& staged = StagingDrain::stagedFilename(".", "stagingdrain_error.dat", 0, 0);
+    { std::ofstream fout(staged.c_str()); fout << "abc"; }
+
+    StagingDrain drain;
+    drain.add(staged, "nonexistent_dir/stagingdrain_error.dat", 0);
+    CHECK_THROWS_AS(drain.wait(), std::runtime_error);
+    CHECK_NOTHROW(drain.wait()); // Error is reported once.
+    std::remove(staged.c_str());
+} // testError
+
+
+// End of file
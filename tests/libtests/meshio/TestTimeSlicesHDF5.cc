@@ -0,0 +1,400 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/TimeSlicesHDF5.hh" // Test subject
+
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <stdexcept> // USES std::runtime_error, std::logic_error
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestTimeSlicesHDF5;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestTimeSlicesHDF5 : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestTimeSlicesHDF5(void);
+
+    /// Destructor.
+    ~TestTimeSlicesHDF5(void);
+
+    /// Test open() and update().
+    void testUpdate(void);
+
+    /// Test open() with inconsistent files.
+    void testOpenErrors(void);
+
+    /// Test update() before open().
+    void testUpdateNotOpen(void);
+
+private:
+
+    /// Create mesh and field with amplitude subfield.
+    void _initialize(void);
+
+    /** Write time slices file.
+     *
+     * @param[in] filename Name of HDF5 file.
+     * @param[in] times Times of slices (s).
+     * @param[in] numTimes Number of slices.
+     * @param[in] numPoints Number of points (leading points of _points).
+     * @param[in] numComponents Number of components.
+     */
+    static
+    void _writeFile(const char* filename,
+                    const PylithReal* times,
+                    const size_t numTimes,
+                    const size_t numPoints,
+                    const size_t numComponents);
+
+    /** Value of component of amplitude at point for slice.
+     *
+     * @param[in] slice Index of slice.
+     * @param[in] x Coordinates of point (m).
+     * @param[in] component Index of component.
+     * @returns Value of amplitude (kPa).
+     */
+    static
+    PylithReal _computeValue(const size_t slice,
+                             const PylithReal x[],
+                             const size_t component);
+
+    /** Check amplitude subfield.
+     *
+     * @param[in] slice0 Index of slice at or before time.
+     * @param[in] slice1 Index of slice after time.
+     * @param[in] w1 Weight of slice after time.
+     */
+    void _checkAmplitude(const size_t slice0,
+                         const size_t slice1,
+                         const PylithReal w1);
+
+    static const size_t _numPoints; ///< Number of points in file.
+    static const PylithReal _points[]; ///< Coordinates of points in file (km).
+    static const PylithReal _lengthScale; ///< Length scale.
+    static const PylithReal _timeScale; ///< Time scale.
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _field; ///< Field with amplitude subfield.
+    spatialdata::units::Nondimensional* _normalizer; ///< Scales for nondimensionalization.
+
+}; // class TestTimeSlicesHDF5
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestTimeSlicesHDF5::testUpdate", "[TestTimeSlicesHDF5]") {
+    pylith::meshio::TestTimeSlicesHDF5().testUpdate();
+}
+TEST_CASE("TestTimeSlicesHDF5::testOpenErrors", "[TestTimeSlicesHDF5]") {
+    pylith::meshio::TestTimeSlicesHDF5().testOpenErrors();
+}
+TEST_CASE("TestTimeSlicesHDF5::testUpdateNotOpen", "[TestTimeSlicesHDF5]") {
+    pylith::meshio::TestTimeSlicesHDF5().testUpdateNotOpen();
+}
+
+// Vertices of tri3 mesh in a different order than in the mesh.
+const size_t pylith::meshio::TestTimeSlicesHDF5::_numPoints = 4;
+const PylithReal pylith::meshio::TestTimeSlicesHDF5::_points[4*2] = {
+    +1.0e-3, 0.0,
+    0.0, +1.0e-3,
+    -1.0e-3, 0.0,
+    0.0, -1.0e-3,
+};
+const PylithReal pylith::meshio::TestTimeSlicesHDF5::_lengthScale = 1.0;
+const PylithReal pylith::meshio::TestTimeSlicesHDF5::_timeScale = 2.0;
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::TestTimeSlicesHDF5::TestTimeSlicesHDF5(void) :
+    _mesh(NULL),
+    _field(NULL),
+    _normalizer(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::TestTimeSlicesHDF5::~TestTimeSlicesHDF5(void) {
+    delete _field;_field = NULL;
+    delete _mesh;_mesh = NULL;
+    delete _normalizer;_normalizer = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test open() and update().
+void
+pylith::meshio::TestTimeSlicesHDF5::testUpdate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    // Nondimensional times are 0.0, 0.5, 1.5.
+    const size_t numTimes = 3;
+    const PylithReal times[numTimes] = { 0.0, 1.0, 3.0 };
+    _writeFile("time_slices.h5", times, numTimes, _numPoints, 2);
+
+    TimeSlicesHDF5 slices;
+    slices.setFilename("time_slices.h5");
+    CHECK(std::string("time_slices.h5") == slices.getFilename());
+    slices.open(*_field, "amplitude", *_normalizer);
+    REQUIRE(numTimes == slices._times.size());
+    CHECK_THAT(slices._times[1], Catch::Matchers::WithinAbs(0.5, 1.0e-14));
+    CHECK_THAT(slices._valueScale, Catch::Matchers::WithinAbs(1.0e+3, 1.0e-10));
+
+    { // Before first slice.
+        INFO("Time before first slice.");
+        slices.update(_field, -1.0);
+        _checkAmplitude(0, 0, 0.0);
+    } // Before first slice.
+
+    { // Between first and second slices.
+        INFO("Time between first and second slices.");
+        slices.update(_field, 0.125);
+        CHECK(size_t(0) == slices._sliceIndices[0]);
+        CHECK(size_t(1) == slices._sliceIndices[1]);
+        _checkAmplitude(0, 1, 0.25);
+    } // Between first and second slices.
+
+    { // Between second and third slices; upper slice becomes lower slice.
+        INFO("Time between second and third slices.");
+        slices.update(_field, 1.25);
+        CHECK(size_t(1) == slices._sliceIndices[0]);
+        CHECK(size_t(2) == slices._sliceIndices[1]);
+        _checkAmplitude(1, 2, 0.75);
+    } // Between second and third slices.
+
+    { // After last slice.
+        INFO("Time after last slice.");
+        slices.update(_field, 4.0);
+        _checkAmplitude(2, 2, 0.0);
+    } // After last slice.
+
+    slices.close();
+    CHECK(!slices._h5);
+    CHECK(slices._times.empty());
+
+    PYLITH_METHOD_END;
+} // testUpdate
+
+
+// ------------------------------------------------------------------------------------------------
+// Test open() with inconsistent files.
+void
+pylith::meshio::TestTimeSlicesHDF5::testOpenErrors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    const size_t numTimes = 3;
+    const PylithReal times[numTimes] = { 0.0, 1.0, 3.0 };
+
+    TimeSlicesHDF5 slices;
+    slices.setFilename("time_slices_errors.h5");
+
+    { // Missing vertex.
+        _writeFile("time_slices_errors.h5", times, numTimes, _numPoints-1, 2);
+        CHECK_THROWS_AS(slices.open(*_field, "amplitude", *_normalizer), std::runtime_error);
+    } // Missing vertex.
+
+    { // Wrong number of components.
+        _writeFile("time_slices_errors.h5", times, numTimes, _numPoints, 3);
+        CHECK_THROWS_AS(slices.open(*_field, "amplitude", *_normalizer), std::runtime_error);
+    } // Wrong number of components.
+
+    { // Times not increasing.
+        const PylithReal timesBad[numTimes] = { 0.0, 3.0, 1.0 };
+        _writeFile("time_slices_errors.h5", timesBad, numTimes, _numPoints, 2);
+        CHECK_THROWS_AS(slices.open(*_field, "amplitude", *_normalizer), std::runtime_error);
+    } // Times not increasing.
+
+    PYLITH_METHOD_END;
+} // testOpenErrors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test update() before open().
+void
+pylith::meshio::TestTimeSlicesHDF5::testUpdateNotOpen(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    TimeSlicesHDF5 slices;
+    slices.setFilename("time_slices.h5");
+    CHECK_THROWS_AS(slices.update(_field, 0.0), std::logic_error);
+
+    PYLITH_METHOD_END;
+} // testUpdateNotOpen
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh and field with amplitude subfield.
+void
+pylith::meshio::TestTimeSlicesHDF5::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _normalizer;_normalizer = new spatialdata::units::Nondimensional;assert(_normalizer);
+    _normalizer->setLengthScale(_lengthScale);
+    _normalizer->setTimeScale(_timeScale);
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    delete _field;_field = new pylith::topology::Field(*_mesh);assert(_field);
+    _field->setLabel("auxiliary field");
+    const char* componentNames[2] = { "amplitude_x", "amplitude_y" };
+    pylith::topology::Field::Description description("amplitude", "amplitude",
+                                                     pylith::string_vector(componentNames, componentNames+2), 2,
+                                                     pylith::topology::Field::VECTOR, 1.0);
+    _field->subfieldAdd(description, pylith::topology::Field::Discretization(1, 1, _mesh->getDimension()));
+    _field->subfieldsSetup();
+    _field->createDiscretization();
+    _field->allocate();
+    _field->zeroLocal();
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Write time slices file.
+void
+pylith::meshio::TestTimeSlicesHDF5::_writeFile(const char* filename,
+                                               const PylithReal* times,
+                                               const size_t numTimes,
+                                               const size_t numPoints,
+                                               const size_t numComponents) {
+    PYLITH_METHOD_BEGIN;
+    assert(times);
+
+    HDF5 h5(filename, H5F_ACC_TRUNC);
+
+    const hsize_t dimsTime[1] = { numTimes };
+    const hsize_t dimsTimeChunk[1] = { 1 };
+    h5.createDataset("/", "time", dimsTime, dimsTimeChunk, 1, H5T_NATIVE_DOUBLE);
+    for (size_t i = 0; i < numTimes; ++i) {
+        h5.writeDatasetChunk("/", "time", &times[i], dimsTime, dimsTimeChunk, 1, i, H5T_NATIVE_DOUBLE);
+    } // for
+    h5.writeAttribute("/time", "units", "s");
+
+    h5.createGroup("/geometry");
+    const hsize_t dimsVertices[2] = { numPoints, 2 };
+    h5.createDataset("/geometry", "vertices", dimsVertices, dimsVertices, 2, H5T_NATIVE_DOUBLE);
+    h5.writeDatasetChunk("/geometry", "vertices", _points, dimsVertices, dimsVertices, 2, 0, H5T_NATIVE_DOUBLE);
+    h5.writeAttribute("/geometry/vertices", "units", "km");
+
+    h5.createGroup("/vertex_fields");
+    const hsize_t dimsAmplitude[3] = { numTimes, numPoints, numComponents };
+    const hsize_t dimsAmplitudeChunk[3] = { 1, numPoints, numComponents };
+    h5.createDataset("/vertex_fields", "amplitude", dimsAmplitude, dimsAmplitudeChunk, 3, H5T_NATIVE_DOUBLE);
+    std::vector<PylithReal> values(numPoints*numComponents);
+    for (size_t i = 0; i < numTimes; ++i) {
+        for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+            const PylithReal x[2] = { 1.0e+3*_points[iPoint*2+0], 1.0e+3*_points[iPoint*2+1] };
+            for (size_t iComponent = 0; iComponent < numComponents; ++iComponent) {
+                values[iPoint*numComponents+iComponent] = _computeValue(i, x, iComponent);
+            } // for
+        } // for
+        h5.writeDatasetChunk("/vertex_fields", "amplitude", &values[0], dimsAmplitude, dimsAmplitudeChunk, 3, i,
+                             H5T_NATIVE_DOUBLE);
+    } // for
+    h5.writeAttribute("/vertex_fields/amplitude", "units", "kPa");
+
+    h5.close();
+
+    PYLITH_METHOD_END;
+} // _writeFile
+
+
+// ------------------------------------------------------------------------------------------------
+// Value of component of amplitude at point for slice.
+PylithReal
+pylith::meshio::TestTimeSlicesHDF5::_computeValue(const size_t slice,
+                                                  const PylithReal x[],
+                                                  const size_t component) {
+    assert(x);
+
+    return (1.0 + slice) * (2.0 + x[0] + 3.0*x[1]) + 10.0*component - 4.0*slice*slice;
+} // _computeValue
+
+
+// ------------------------------------------------------------------------------------------------
+// Check amplitude subfield.
+void
+pylith::meshio::TestTimeSlicesHDF5::_checkAmplitude(const size_t slice0,
+                                                    const size_t slice1,
+                                                    const PylithReal w1) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+
+    PetscDM dm = _field->getDM();assert(dm);
+    PetscInt vStart = 0, vEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::CoordsVisitor coordsVisitor(dm);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();
+    pylith::topology::VecVisitorMesh amplitudeVisitor(*_field, "amplitude");
+    const PetscScalar* amplitudeArray = amplitudeVisitor.localArray();
+
+    const PylithReal tolerance = 1.0e-10;
+    for (PetscInt vertex = vStart; vertex < vEnd; ++vertex) {
+        const PetscInt coff = coordsVisitor.sectionOffset(vertex);
+        const PylithReal x[2] = { coordsArray[coff+0] * _lengthScale, coordsArray[coff+1] * _lengthScale };
+
+        const PetscInt off = amplitudeVisitor.sectionOffset(vertex);
+        REQUIRE(2 == amplitudeVisitor.sectionDof(vertex));
+        for (size_t iComponent = 0; iComponent < 2; ++iComponent) {
+            const PylithReal valueE = 1.0e+3 * ((1.0-w1) * _computeValue(slice0, x, iComponent) +
+                                                w1 * _computeValue(slice1, x, iComponent));
+            INFO("Checking component " << iComponent << " at vertex (" << x[0] << ", " << x[1] << ").");
+            CHECK_THAT(amplitudeArray[off+iComponent], Catch::Matchers::WithinAbs(valueE, tolerance));
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _checkAmplitude
+
+
+// End of file
@@ -0,0 +1,296 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/XdmfWriter.hh" // USES XdmfWriter
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include <fstream> // USES std::ifstream
+#include <sstream> // USES std::ostringstream
+#include <string> // USES std::string
+#include <cstdio> // USES std::remove()
+#include <stdexcept> // USES std::runtime_error
+
+#include "catch2/catch_test_macros.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestXdmfWriter;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestXdmfWriter : public pylith::utils::GenericComponent {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test open() with invalid spatial dimension.
+    static
+    void testOpenBadDim(void);
+
+    /// Test writeTimeStep() with no fields.
+    static
+    void testWriteNoFields(void);
+
+    /// Test writeTimeStep() for consecutive time steps.
+    static
+    void testWriteTimeSteps(void);
+
+    /// Test setMeshFilename().
+    static
+    void testMeshFilename(void);
+
+    /// Test _getCellType() and _getDatasetName().
+    static
+    void testAccessors(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Read file into string.
+     *
+     * @param[in] filename Name of file.
+     * @returns Contents of file.
+     */
+    static
+    std::string _readFile(const char* filename);
+
+    /** Count occurrences of string.
+     *
+     * @param[in] text Text to search.
+     * @param[in] value String to count.
+     * @returns Number of occurrences.
+     */
+    static
+    size_t _count(const std::string& text,
+                  const std::string& value);
+
+    /** Check whether text ends with closing tags of Xdmf file.
+     *
+     * @param[in] text Contents of Xdmf file.
+     * @returns True if text ends with closing tags.
+     */
+    static
+    bool _hasClosingTags(const std::string& text);
+
+}; // class TestXdmfWriter
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestXdmfWriter::testOpenBadDim", "[TestXdmfWriter]") {
+    pylith::meshio::TestXdmfWriter::testOpenBadDim();
+}
+TEST_CASE("TestXdmfWriter::testWriteNoFields", "[TestXdmfWriter]") {
+    pylith::meshio::TestXdmfWriter::testWriteNoFields();
+}
+TEST_CASE("TestXdmfWriter::testWriteTimeSteps", "[TestXdmfWriter]") {
+    pylith::meshio::TestXdmfWriter::testWriteTimeSteps();
+}
+TEST_CASE("TestXdmfWriter::testMeshFilename", "[TestXdmfWriter]") {
+    pylith::meshio::TestXdmfWriter::testMeshFilename();
+}
+TEST_CASE("TestXdmfWriter::testAccessors", "[TestXdmfWriter]") {
+    pylith::meshio::TestXdmfWriter::testAccessors();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test open() with invalid spatial dimension.
+void
+pylith::meshio::TestXdmfWriter::testOpenBadDim(void) {
+    PYLITH_METHOD_BEGIN;
+
+    XdmfWriter writer;
+    CHECK_THROWS_AS(writer.open("xdmfwriter_line.h5", 2, 2, 1, 3, 1), std::runtime_error);
+
+    PYLITH_METHOD_END;
+} // testOpenBadDim
+
+
+// ------------------------------------------------------------------------------------------------
+// Test writeTimeStep() with no fields.
+void
+pylith::meshio::TestXdmfWriter::testWriteNoFields(void) {
+    PYLITH_METHOD_BEGIN;
+
+    std::remove("xdmfwriter_empty.xmf");
+
+    XdmfWriter writer;
+    writer.open("xdmfwriter_empty.h5", 2, 3, 2, 4, 2);
+    writer.writeTimeStep();
+    writer.close();
+
+    std::ifstream fin("xdmfwriter_empty.xmf");
+    CHECK(!fin.is_open());
+
+    PYLITH_METHOD_END;
+} // testWriteNoFields
+
+
+// ------------------------------------------------------------------------------------------------
+// Test writeTimeStep() for consecutive time steps.
+void
+pylith::meshio::TestXdmfWriter::testWriteTimeSteps(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const size_t numCells = 2;
+    const size_t numCorners = 3;
+    const size_t numVertices = 4;
+
+    XdmfWriter writer;
+    writer.open("xdmfwriter_tri.h5", numCells, numCorners, 2, numVertices, 2);
+
+    writer.addField(0.0, "displacement", XdmfWriter::VERTEX_FIELD, "vector", 0, numVertices, 2);
+    writer.addField(0.0, "cauchy_stress", XdmfWriter::CELL_FIELD, "tensor", 0, numCells, 4);
+    CHECK(size_t(2) == writer._fields.size());
+    writer.writeTimeStep();
+    CHECK(writer._fields.empty());
+
+    // File must be valid after each time step.
+    std::string xdmf = _readFile("xdmfwriter_tri.xmf");
+    CHECK(0 == xdmf.find("<?xml version=\"1.0\" ?>"));
+    CHECK(std::string::npos != xdmf.find("<!ENTITY HeavyData \"xdmfwriter_tri.h5\">"));
+    CHECK(std::string::npos != xdmf.find("<!ENTITY MeshData \"xdmfwriter_tri.h5\">"));
+    CHECK(std::string::npos != xdmf.find("Dimensions=\"2 3\""));
+    CHECK(std::string::npos != xdmf.find("TopologyType=\"Triangle\" NumberOfElements=\"2\""));
+    CHECK(std::string::npos != xdmf.find("&HeavyData;:/vertex_fields/displacement"));
+    CHECK(std::string::npos != xdmf.find("&HeavyData;:/cell_fields/cauchy_stress"));
+    CHECK(std::string::npos != xdmf.find("Attribute Name=\"cauchy_stress_xx\""));
+    CHECK(std::string::npos != xdmf.find("Attribute Name=\"cauchy_stress_xy\""));
+    CHECK(size_t(1) == _count(xdmf, "<Grid Name=\"domain\""));
+    CHECK(size_t(1) == _count(xdmf, "<Xdmf>"));
+    CHECK(_hasClosingTags(xdmf));
+
+    writer.addField(2.0, "displacement", XdmfWriter::VERTEX_FIELD, "vector", 1, numVertices, 2);
+    writer.writeTimeStep();
+    writer.close();
+
+    xdmf = _readFile("xdmfwriter_tri.xmf");
+    char tstamp[64];
+    snprintf(tstamp, sizeof(tstamp), "%16.8e", 2.0);
+    CHECK(std::string::npos != xdmf.find(std::string("<Time Value=\"") + tstamp + "\"/>"));
+    CHECK(std::string::npos != xdmf.find("1 0 0    1 1 1    1 4 1"));
+    CHECK(std::string::npos != xdmf.find("Dimensions=\"2 4 2\""));
+    CHECK(size_t(2) == _count(xdmf, "<Grid Name=\"domain\""));
+    CHECK(size_t(1) == _count(xdmf, "</Domain>"));
+    CHECK(size_t(1) == _count(xdmf, "</Xdmf>"));
+    CHECK(_hasClosingTags(xdmf));
+
+    PYLITH_METHOD_END;
+} // testWriteTimeSteps
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setMeshFilename().
+void
+pylith::meshio::TestXdmfWriter::testMeshFilename(void) {
+    PYLITH_METHOD_BEGIN;
+
+    XdmfWriter writer;
+    writer.open("xdmfwriter_tet-fault.h5", 1, 4, 3, 4, 3);
+    writer.setMeshFilename("xdmfwriter_tet-mesh.h5");
+    writer.addField(1.0, "slip", XdmfWriter::VERTEX_FIELD, "vector", 0, 4, 3);
+    writer.writeTimeStep();
+    writer.close();
+
+    const std::string& xdmf = _readFile("xdmfwriter_tet-fault.xmf");
+    CHECK(std::string::npos != xdmf.find("<!ENTITY HeavyData \"xdmfwriter_tet-fault.h5\">"));
+    CHECK(std::string::npos != xdmf.find("<!ENTITY MeshData \"xdmfwriter_tet-mesh.h5\">"));
+    CHECK(std::string::npos != xdmf.find("&MeshData;:/geometry/vertices"));
+    CHECK(std::string::npos != xdmf.find("TopologyType=\"Tetrahedron\""));
+    CHECK(_hasClosingTags(xdmf));
+
+    PYLITH_METHOD_END;
+} // testMeshFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _getCellType() and _getDatasetName().
+void
+pylith::meshio::TestXdmfWriter::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const struct {
+        int cellDim;
+        size_t numCorners;
+        const char* cellType;
+    } cases[7] = {
+        { 0, 1, "Polyvertex" },
+        { 1, 2, "Polyline" },
+        { 2, 3, "Triangle" },
+        { 2, 4, "Quadrilateral" },
+        { 3, 4, "Tetrahedron" },
+        { 3, 8, "Hexahedron" },
+        { 2, 6, "Unknown" },
+    };
+    XdmfWriter writer;
+    for (size_t i = 0; i < 7; ++i) {
+        writer._cellDim = cases[i].cellDim;
+        writer._numCorners = cases[i].numCorners;
+        CHECK(std::string(cases[i].cellType) == writer._getCellType());
+    } // for
+
+    XdmfWriter::FieldInfo field;
+    field.name = "pressure";
+    field.center = XdmfWriter::VERTEX_FIELD;
+    CHECK(std::string("/vertex_fields/pressure") == writer._getDatasetName(field));
+    field.center = XdmfWriter::CELL_FIELD;
+    CHECK(std::string("/cell_fields/pressure") == writer._getDatasetName(field));
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Read file into string.
+std::string
+pylith::meshio::TestXdmfWriter::_readFile(const char* filename) {
+    std::ifstream fin(filename);
+    REQUIRE(fin.is_open());
+    std::ostringstream contents;
+    contents << fin.rdbuf();
+    return contents.str();
+} // _readFile
+
+
+// ------------------------------------------------------------------------------------------------
+// Count occurrences of string.
+size_t
+pylith::meshio::TestXdmfWriter::_count(const std::string& text,
+                                       const std::string& value) {
+    size_t count = 0;
+    for (size_t pos = text.find(value); pos != std::string::npos; pos = text.find(value, pos+value.length())) {
+        ++count;
+    } // for
+    return count;
+} // _count
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether text ends with closing tags of Xdmf file.
+bool
+pylith::meshio::TestXdmfWriter::_hasClosingTags(const std::string& text) {
+    const std::string closingTags("    </Grid>\n  </Domain>\n</Xdmf>\n");
+    return text.length() >= closingTags.length() &&
+           0 == text.compare(text.length()-closingTags.length(), closingTags.length(), closingTags);
+} // _hasClosingTags
+
+
+// End of file
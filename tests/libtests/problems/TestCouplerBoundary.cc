@@ -0,0 +1,316 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/problems/CouplerBoundary.hh" // Test subject
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class TestCouplerBoundary;
+    } // problems
+} // pylith
+
+class pylith::problems::TestCouplerBoundary : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestCouplerBoundary(void);
+
+    /// Destructor.
+    ~TestCouplerBoundary(void);
+
+    /// Test setTimeScale() and verifyConfiguration().
+    void testVerifyConfiguration(void);
+
+    /// Test update() sending boundary values through exchange function.
+    void testUpdateSend(void);
+
+    /// Test _packReceive() and _unpackReceive() with scaled auxiliary subfield.
+    void testPackReceive(void);
+
+private:
+
+    /// Create mesh and solution field with displacement subfield.
+    void _initialize(void);
+
+    /** Record arguments and double received values.
+     *
+     * Matches CouplerBoundary::exchangefn_type.
+     */
+    static
+    void _exchange(void* context,
+                   const PylithReal t,
+                   const PylithInt tindex,
+                   const PylithScalar* sendValues,
+                   const PylithInt numSendValues,
+                   PylithScalar* recvValues,
+                   const PylithInt numRecvValues);
+
+    /// Arguments recorded by exchange function.
+    struct ExchangeContext {
+        int numCalls;
+        PylithReal t;
+        PylithInt tindex;
+        std::vector<PylithScalar> sendValues;
+    };
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _solution; ///< Solution field.
+
+}; // class TestCouplerBoundary
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestCouplerBoundary::testVerifyConfiguration", "[TestCouplerBoundary]") {
+    pylith::problems::TestCouplerBoundary().testVerifyConfiguration();
+}
+TEST_CASE("TestCouplerBoundary::testUpdateSend", "[TestCouplerBoundary]") {
+    pylith::problems::TestCouplerBoundary().testUpdateSend();
+}
+TEST_CASE("TestCouplerBoundary::testPackReceive", "[TestCouplerBoundary]") {
+    pylith::problems::TestCouplerBoundary().testPackReceive();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::problems::TestCouplerBoundary::TestCouplerBoundary(void) :
+    _mesh(NULL),
+    _solution(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::problems::TestCouplerBoundary::~TestCouplerBoundary(void) {
+    delete _solution;_solution = NULL;
+    delete _mesh;_mesh = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setTimeScale() and verifyConfiguration().
+void
+pylith::problems::TestCouplerBoundary::testVerifyConfiguration(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    CouplerBoundary coupler;
+    CHECK_THROWS_AS(coupler.setTimeScale(0.0), std::invalid_argument);
+    coupler.setTimeScale(4.0);
+    CHECK(4.0 == coupler._timeScale);
+
+    // Neither exchange function nor MPI port.
+    coupler.setLabelName("boundary");
+    CHECK_THROWS_AS(coupler.verifyConfiguration(*_solution), std::runtime_error);
+
+    ExchangeContext context;
+    context.numCalls = 0;
+    coupler.setExchangeFn(_exchange, &context);
+    CHECK_NOTHROW(coupler.verifyConfiguration(*_solution));
+
+    // Missing label.
+    coupler.setLabelName("unknown");
+    CHECK_THROWS_AS(coupler.verifyConfiguration(*_solution), std::runtime_error);
+    coupler.setLabelName("boundary");
+
+    // Missing solution subfield.
+    const char* sendBad[1] = { "velocity" };
+    coupler.setSendSubfields(sendBad, 1);
+    CHECK_THROWS_AS(coupler.verifyConfiguration(*_solution), std::runtime_error);
+    const char* sendGood[1] = { "displacement" };
+    coupler.setSendSubfields(sendGood, 1);
+    CHECK_NOTHROW(coupler.verifyConfiguration(*_solution));
+
+    // Receiving values requires the problem.
+    coupler.setReceiveSubfield("bc_xpos", "initial_amplitude");
+    CHECK_THROWS_AS(coupler.verifyConfiguration(*_solution), std::logic_error);
+
+    PYLITH_METHOD_END;
+} // testVerifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Test update() sending boundary values through exchange function.
+void
+pylith::problems::TestCouplerBoundary::testUpdateSend(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    ExchangeContext context;
+    context.numCalls = 0;
+
+    const char* sendSubfields[1] = { "displacement" };
+    CouplerBoundary coupler;
+    coupler.setLabelName("boundary");
+    coupler.setSendSubfields(sendSubfields, 1);
+    coupler.setExchangeFn(_exchange, &context);
+    coupler.setTimeScale(10.0);
+
+    const size_t numSteps = 2;
+    PetscErrorCode err = 0;
+    for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+        const PylithScalar value = 1.5 + iStep;
+        err = VecSet(_solution->getLocalVector(), value);PYLITH_CHECK_ERROR(err);
+        _solution->scatterLocalToOutput();
+
+        coupler.update(0.5*(1+iStep), iStep+3, *_solution);
+        REQUIRE(coupler._boundaryMesh);
+        const size_t numBoundaryVertices = pylith::topology::MeshOps::getNumVertices(*coupler._boundaryMesh);
+        CHECK(8 == numBoundaryVertices);
+
+        CHECK(int(iStep+1) == context.numCalls);
+        CHECK(10.0*0.5*(1+iStep) == context.t);
+        CHECK(PylithInt(iStep+3) == context.tindex);
+        REQUIRE(2*numBoundaryVertices == context.sendValues.size());
+        for (size_t i = 0; i < context.sendValues.size(); ++i) {
+            INFO("Checking value " << i << " sent at step " << iStep << ".");
+            CHECK(value == context.sendValues[i]);
+        } // for
+        CHECK(coupler._recvValues.empty());
+    } // for
+
+    PYLITH_METHOD_END;
+} // testUpdateSend
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _packReceive() and _unpackReceive() with scaled auxiliary subfield.
+void
+pylith::problems::TestCouplerBoundary::testPackReceive(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    const PylithReal scale = 2.0;
+    pylith::topology::Field auxiliaryField(*_mesh);
+    auxiliaryField.setLabel("auxiliary field");
+    const char* componentNames[2] = { "initial_amplitude_x", "initial_amplitude_y" };
+    pylith::string_vector names(componentNames, componentNames+2);
+    pylith::topology::Field::Description description("initial_amplitude", "initial_amplitude", names, 2,
+                                                     pylith::topology::Field::VECTOR, scale);
+    auxiliaryField.subfieldAdd(description, pylith::topology::Field::Discretization(1, 1, _mesh->getDimension()));
+    auxiliaryField.subfieldsSetup();
+    auxiliaryField.createDiscretization();
+    auxiliaryField.allocate();
+
+    const PylithScalar value = 0.75;
+    PetscErrorCode err = VecSet(auxiliaryField.getLocalVector(), value);PYLITH_CHECK_ERROR(err);
+
+    CouplerBoundary coupler;
+    coupler.setReceiveSubfield("bc", "initial_amplitude");
+
+    // Values passed to the external code are dimensioned.
+    coupler._packReceive(auxiliaryField);
+    const size_t numVertices = pylith::topology::MeshOps::getNumVertices(*_mesh);
+    REQUIRE(2*numVertices == coupler._recvValues.size());
+    for (size_t i = 0; i < coupler._recvValues.size(); ++i) {
+        INFO("Checking packed value " << i << ".");
+        CHECK(value*scale == coupler._recvValues[i]);
+    } // for
+
+    // External code doubles the values, which are nondimensionalized when unpacked.
+    ExchangeContext context;
+    context.numCalls = 0;
+    _exchange(&context, 0.0, 0, NULL, 0, coupler._recvValues.data(), coupler._recvValues.size());
+    coupler._unpackReceive(&auxiliaryField);
+
+    const PetscScalar* values = NULL;
+    PetscInt numValues = 0;
+    err = VecGetLocalSize(auxiliaryField.getLocalVector(), &numValues);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(auxiliaryField.getLocalVector(), &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numValues; ++i) {
+        INFO("Checking unpacked value " << i << ".");
+        CHECK(2.0*value == values[i]);
+    } // for
+    err = VecRestoreArrayRead(auxiliaryField.getLocalVector(), &values);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testPackReceive
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh and solution field with displacement subfield.
+void
+pylith::problems::TestCouplerBoundary::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    delete _solution;_solution = new pylith::topology::Field(*_mesh);assert(_solution);
+    _solution->setLabel("solution");
+    const char* componentNames[2] = { "displacement_x", "displacement_y" };
+    pylith::string_vector names(componentNames, componentNames+2);
+    pylith::topology::Field::Description description("displacement", "displacement", names, 2,
+                                                     pylith::topology::Field::VECTOR);
+    _solution->subfieldAdd(description, pylith::topology::Field::Discretization(1, 1, _mesh->getDimension()));
+    _solution->subfieldsSetup();
+    _solution->createDiscretization();
+    _solution->allocate();
+    _solution->zeroLocal();
+    _solution->createOutputVector();
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Record arguments and double received values.
+void
+pylith::problems::TestCouplerBoundary::_exchange(void* context,
+                                                 const PylithReal t,
+                                                 const PylithInt tindex,
+                                                 const PylithScalar* sendValues,
+                                                 const PylithInt numSendValues,
+                                                 PylithScalar* recvValues,
+                                                 const PylithInt numRecvValues) {
+    ExchangeContext* exchangeContext = (ExchangeContext*) context;assert(exchangeContext);
+    ++exchangeContext->numCalls;
+    exchangeContext->t = t;
+    exchangeContext->tindex = tindex;
+    exchangeContext->sendValues.assign(sendValues, sendValues+numSendValues);
+    for (PylithInt i = 0; i < numRecvValues; ++i) {
+        recvValues[i] *= 2.0;
+    } // for
+} // _exchange
+
+
+// End of file
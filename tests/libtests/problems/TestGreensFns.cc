@@ -0,0 +1,274 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/problems/GreensFns.hh" // Test subject
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+    namespace problems {
+        class TestGreensFns;
+    } // problems
+} // pylith
+
+class pylith::problems::TestGreensFns : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestGreensFns(void);
+
+    /// Destructor.
+    ~TestGreensFns(void);
+
+    /// Test _compressResponse() reproduces response matrix with rank of surrogate model.
+    void testCompressResponse(void);
+
+    /// Test _compressResponse() keeps full response matrix when rank is not less than number of impulses.
+    void testCompressResponseFull(void);
+
+    /// Test _addDeflationVector() builds orthonormal basis of impulse solutions.
+    void testDeflationSpace(void);
+
+private:
+
+    /** Create response matrix G = U V^T with rank 2.
+     *
+     * @returns Response matrix.
+     */
+    PetscMat _createResponse(void);
+
+    static const PetscInt _numRows; ///< Number of rows (solution degrees of freedom) of response matrix.
+    static const PetscInt _numImpulses; ///< Number of columns (impulses) of response matrix.
+
+    pylith::problems::GreensFns* _problem; ///< Test subject.
+
+}; // class TestGreensFns
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestGreensFns::testCompressResponse", "[TestGreensFns]") {
+    pylith::problems::TestGreensFns().testCompressResponse();
+}
+TEST_CASE("TestGreensFns::testCompressResponseFull", "[TestGreensFns]") {
+    pylith::problems::TestGreensFns().testCompressResponseFull();
+}
+TEST_CASE("TestGreensFns::testDeflationSpace", "[TestGreensFns]") {
+    pylith::problems::TestGreensFns().testDeflationSpace();
+}
+
+const PetscInt pylith::problems::TestGreensFns::_numRows = 8;
+const PetscInt pylith::problems::TestGreensFns::_numImpulses = 5;
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::problems::TestGreensFns::TestGreensFns(void) :
+    _problem(new pylith::problems::GreensFns) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::problems::TestGreensFns::~TestGreensFns(void) {
+    delete _problem;_problem = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _compressResponse() reproduces response matrix with rank of surrogate model.
+void
+pylith::problems::TestGreensFns::testCompressResponse(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    PetscMat responseMat = _createResponse();
+    PetscErrorCode err = MatDuplicate(responseMat, MAT_COPY_VALUES, &_problem->_responseMat);PYLITH_CHECK_ERROR(err);
+    _problem->_surrogateRank = 2;
+    _problem->_compressResponse();
+    REQUIRE(_problem->_responseCoefMat);
+    REQUIRE(_problem->_responseMat);
+
+    PetscInt numRows = 0, numCols = 0;
+    err = MatGetSize(_problem->_responseMat, &numRows, &numCols);PYLITH_CHECK_ERROR(err);
+    CHECK(_numRows == numRows);
+    CHECK(2 == numCols);
+    err = MatGetSize(_problem->_responseCoefMat, &numRows, &numCols);PYLITH_CHECK_ERROR(err);
+    CHECK(2 == numRows);
+    CHECK(_numImpulses == numCols);
+
+    // Basis Q is orthonormal.
+    PetscMat productMat = NULL;
+    err = MatTransposeMatMult(_problem->_responseMat, _problem->_responseMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT,
+                              &productMat);PYLITH_CHECK_ERROR(err);
+    const PylithReal tolerance = 1.0e-10;
+    for (PetscInt i = 0; i < 2; ++i) {
+        for (PetscInt j = 0; j < 2; ++j) {
+            PetscScalar value = 0.0;
+            err = MatGetValue(productMat, i, j, &value);PYLITH_CHECK_ERROR(err);
+            INFO("Q^T Q (" << i << "," << j << ")");
+            CHECK_THAT(PetscRealPart(value), Catch::Matchers::WithinAbs(i == j ? 1.0 : 0.0, tolerance));
+        } // for
+    } // for
+    err = MatDestroy(&productMat);PYLITH_CHECK_ERROR(err);
+
+    // Compressed response Q B matches uncompressed response G.
+    err = MatMatMult(_problem->_responseMat, _problem->_responseCoefMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT,
+                     &productMat);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < _numRows; ++i) {
+        for (PetscInt j = 0; j < _numImpulses; ++j) {
+            PetscScalar valueE = 0.0, value = 0.0;
+            err = MatGetValue(responseMat, i, j, &valueE);PYLITH_CHECK_ERROR(err);
+            err = MatGetValue(productMat, i, j, &value);PYLITH_CHECK_ERROR(err);
+            INFO("Response (" << i << "," << j << ")");
+            CHECK_THAT(PetscRealPart(value), Catch::Matchers::WithinAbs(PetscRealPart(valueE), tolerance));
+        } // for
+    } // for
+    err = MatDestroy(&productMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&responseMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testCompressResponse
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _compressResponse() keeps full response matrix when rank is not less than number of impulses.
+void
+pylith::problems::TestGreensFns::testCompressResponseFull(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    PetscMat responseMat = _createResponse();
+    PetscErrorCode err = MatDuplicate(responseMat, MAT_COPY_VALUES, &_problem->_responseMat);PYLITH_CHECK_ERROR(err);
+    _problem->_surrogateRank = _numImpulses;
+    _problem->_compressResponse();
+    CHECK(!_problem->_responseCoefMat);
+
+    PetscBool isEqual = PETSC_FALSE;
+    err = MatEqual(responseMat, _problem->_responseMat, &isEqual);PYLITH_CHECK_ERROR(err);
+    CHECK(isEqual);
+    err = MatDestroy(&responseMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testCompressResponseFull
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _addDeflationVector() builds orthonormal basis of impulse solutions.
+void
+pylith::problems::TestGreensFns::testDeflationSpace(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    PetscMat responseMat = _createResponse();
+    PetscVec solutionVec = NULL;
+    PetscErrorCode err = MatCreateVecs(responseMat, NULL, &solutionVec);PYLITH_CHECK_ERROR(err);
+
+    // No deflation space.
+    err = MatGetColumnVector(responseMat, solutionVec, 0);PYLITH_CHECK_ERROR(err);
+    CHECK(!_problem->_addDeflationVector(solutionVec));
+    CHECK(!_problem->_deflationMat);
+
+    _problem->_deflationSize = 2;
+    CHECK(!_problem->_addDeflationVector(solutionVec));
+    CHECK(size_t(1) == _problem->_deflationNumVectors);
+
+    // Solution in span of basis is skipped.
+    err = VecScale(solutionVec, 3.0);PYLITH_CHECK_ERROR(err);
+    CHECK(!_problem->_addDeflationVector(solutionVec));
+    CHECK(size_t(1) == _problem->_deflationNumVectors);
+
+    err = MatGetColumnVector(responseMat, solutionVec, 1);PYLITH_CHECK_ERROR(err);
+    CHECK(_problem->_addDeflationVector(solutionVec));
+    CHECK(size_t(2) == _problem->_deflationNumVectors);
+    REQUIRE(_problem->_deflationMat);
+
+    // Basis is full.
+    err = MatGetColumnVector(responseMat, solutionVec, 2);PYLITH_CHECK_ERROR(err);
+    CHECK(!_problem->_addDeflationVector(solutionVec));
+    CHECK(size_t(2) == _problem->_deflationNumVectors);
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+
+    // Basis W is orthonormal.
+    PetscMat productMat = NULL;
+    err = MatTransposeMatMult(_problem->_deflationMat, _problem->_deflationMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT,
+                              &productMat);PYLITH_CHECK_ERROR(err);
+    const PylithReal tolerance = 1.0e-10;
+    for (PetscInt i = 0; i < 2; ++i) {
+        for (PetscInt j = 0; j < 2; ++j) {
+            PetscScalar value = 0.0;
+            err = MatGetValue(productMat, i, j, &value);PYLITH_CHECK_ERROR(err);
+            INFO("W^T W (" << i << "," << j << ")");
+            CHECK_THAT(PetscRealPart(value), Catch::Matchers::WithinAbs(i == j ? 1.0 : 0.0, tolerance));
+        } // for
+    } // for
+    err = MatDestroy(&productMat);PYLITH_CHECK_ERROR(err);
+
+    // Response G has rank 2, so projection W W^T G matches G.
+    PetscMat coefMat = NULL;
+    err = MatTransposeMatMult(_problem->_deflationMat, responseMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT,
+                              &coefMat);PYLITH_CHECK_ERROR(err);
+    err = MatMatMult(_problem->_deflationMat, coefMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT,
+                     &productMat);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < _numRows; ++i) {
+        for (PetscInt j = 0; j < _numImpulses; ++j) {
+            PetscScalar valueE = 0.0, value = 0.0;
+            err = MatGetValue(responseMat, i, j, &valueE);PYLITH_CHECK_ERROR(err);
+            err = MatGetValue(productMat, i, j, &value);PYLITH_CHECK_ERROR(err);
+            INFO("Projected response (" << i << "," << j << ")");
+            CHECK_THAT(PetscRealPart(value), Catch::Matchers::WithinAbs(PetscRealPart(valueE), 1.0e-8));
+        } // for
+    } // for
+    err = MatDestroy(&productMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&coefMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&responseMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testDeflationSpace
+
+
+// ------------------------------------------------------------------------------------------------
+// Create response matrix G = U V^T with rank 2.
+PetscMat
+pylith::problems::TestGreensFns::_createResponse(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscMat responseMat = NULL;
+    PetscErrorCode err = MatCreateDense(PETSC_COMM_WORLD, PETSC_DECIDE, PETSC_DECIDE, _numRows, _numImpulses, NULL,
+                                        &responseMat);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < _numRows; ++i) {
+        for (PetscInt j = 0; j < _numImpulses; ++j) {
+            const PetscScalar value = (1.0 + i) * (2.0 - 0.5*j) + (0.1*i*i - 1.0) * (1.0 + 0.3*j*j);
+            err = MatSetValue(responseMat, i, j, value, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+    err = MatAssemblyBegin(responseMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(responseMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(responseMat);
+} // _createResponse
+
+
+// End of file
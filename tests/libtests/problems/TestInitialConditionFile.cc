@@ -0,0 +1,421 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/problems/InitialConditionFile.hh" // Test subject
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/meshio/DataWriterHDF5.hh" // USES DataWriterHDF5
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class TestInitialConditionFile;
+    } // problems
+} // pylith
+
+class pylith::problems::TestInitialConditionFile : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestInitialConditionFile(void);
+
+    /// Destructor.
+    ~TestInitialConditionFile(void);
+
+    /// Test setFilename(), getFilename(), setTimeStep(), and getTimeStep().
+    void testAccessors(void);
+
+    /// Test verifyConfiguration().
+    void testVerifyConfiguration(void);
+
+    /// Test setValues() copying values at matching vertices.
+    void testSetValuesDirect(void);
+
+    /// Test setValues() interpolating values to points of a higher order discretization.
+    void testSetValuesInterpolate(void);
+
+    /// Test setValues() with missing field or time step in file.
+    void testSetValuesErrors(void);
+
+private:
+
+    /// Read mesh and write HDF5 file with linear displacement field at two time steps.
+    void _initialize(void);
+
+    /** Create solution field with displacement subfield.
+     *
+     * @param[in] basisOrder Order of basis functions for displacement.
+     * @returns Solution field with zero values.
+     */
+    pylith::topology::Field* _createSolution(const int basisOrder);
+
+    /** Set or check displacement subfield against linear field.
+     *
+     * @param[inout] solution Solution field.
+     * @param[in] scale Scale factor for linear field.
+     * @param[in] isCheck True to check values, false to set values.
+     */
+    static
+    void _linearField(pylith::topology::Field* solution,
+                      const PylithReal scale,
+                      const bool isCheck);
+
+    static const char* _filename; ///< Name of HDF5 file with solution.
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+
+}; // class TestInitialConditionFile
+const char* pylith::problems::TestInitialConditionFile::_filename = "initial_condition.h5";
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestInitialConditionFile::testAccessors", "[TestInitialConditionFile]") {
+    pylith::problems::TestInitialConditionFile().testAccessors();
+}
+TEST_CASE("TestInitialConditionFile::testVerifyConfiguration", "[TestInitialConditionFile]") {
+    pylith::problems::TestInitialConditionFile().testVerifyConfiguration();
+}
+TEST_CASE("TestInitialConditionFile::testSetValuesDirect", "[TestInitialConditionFile]") {
+    pylith::problems::TestInitialConditionFile().testSetValuesDirect();
+}
+TEST_CASE("TestInitialConditionFile::testSetValuesInterpolate", "[TestInitialConditionFile]") {
+    pylith::problems::TestInitialConditionFile().testSetValuesInterpolate();
+}
+TEST_CASE("TestInitialConditionFile::testSetValuesErrors", "[TestInitialConditionFile]") {
+    pylith::problems::TestInitialConditionFile().testSetValuesErrors();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::problems::TestInitialConditionFile::TestInitialConditionFile(void) :
+    _mesh(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::problems::TestInitialConditionFile::~TestInitialConditionFile(void) {
+    delete _mesh;_mesh = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setFilename(), getFilename(), setTimeStep(), and getTimeStep().
+void
+pylith::problems::TestInitialConditionFile::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    InitialConditionFile ic;
+    CHECK(std::string("") == std::string(ic.getFilename()));
+    CHECK(-1 == ic.getTimeStep());
+
+    ic.setFilename("solution.h5");
+    CHECK(std::string("solution.h5") == std::string(ic.getFilename()));
+    CHECK_THROWS_AS(ic.setFilename(""), std::runtime_error);
+    CHECK(std::string("solution.h5") == std::string(ic.getFilename()));
+
+    ic.setTimeStep(3);
+    CHECK(3 == ic.getTimeStep());
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test verifyConfiguration().
+void
+pylith::problems::TestInitialConditionFile::testVerifyConfiguration(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    const char* subfields[1] = { "displacement" };
+    InitialConditionFile ic;
+    ic.setSubfields(subfields, 1);
+    ic.setFilename(_filename);
+
+    pylith::topology::Field* solutionP1 = _createSolution(1);
+    CHECK_NOTHROW(ic.verifyConfiguration(*solutionP1));
+    delete solutionP1;solutionP1 = NULL;
+
+    pylith::topology::Field* solutionP2 = _createSolution(2);
+    CHECK_NOTHROW(ic.verifyConfiguration(*solutionP2));
+    delete solutionP2;solutionP2 = NULL;
+
+    // Values are set at points, so basis order 0 has no points with degrees of freedom to match.
+    pylith::topology::Field* solutionP0 = _createSolution(0);
+    CHECK_THROWS_AS(ic.verifyConfiguration(*solutionP0), std::runtime_error);
+    delete solutionP0;solutionP0 = NULL;
+
+    PYLITH_METHOD_END;
+} // testVerifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setValues() copying values at matching vertices.
+void
+pylith::problems::TestInitialConditionFile::testSetValuesDirect(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    const char* subfields[1] = { "displacement" };
+    InitialConditionFile ic;
+    ic.setSubfields(subfields, 1);
+    ic.setFilename(_filename);
+
+    spatialdata::units::Nondimensional normalizer;
+    normalizer.setLengthScale(1.0);
+
+    // Default time step is the last one.
+    pylith::topology::Field* solution = _createSolution(1);
+    ic.setValues(solution, normalizer);
+    _linearField(solution, 1.0, true);
+
+    // First time step.
+    solution->zeroLocal();
+    ic.setTimeStep(0);
+    ic.setValues(solution, normalizer);
+    _linearField(solution, 0.5, true);
+    delete solution;solution = NULL;
+
+    PYLITH_METHOD_END;
+} // testSetValuesDirect
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setValues() interpolating values to points of a higher order discretization.
+void
+pylith::problems::TestInitialConditionFile::testSetValuesInterpolate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    const char* subfields[1] = { "displacement" };
+    InitialConditionFile ic;
+    ic.setSubfields(subfields, 1);
+    ic.setFilename(_filename);
+
+    spatialdata::units::Nondimensional normalizer;
+    normalizer.setLengthScale(1.0);
+
+    // Basis order 2 has degrees of freedom at edges, which must be interpolated from the vertices in the file. The
+    // field is linear, so interpolation is exact.
+    pylith::topology::Field* solution = _createSolution(2);
+    ic.setValues(solution, normalizer);
+    _linearField(solution, 1.0, true);
+    delete solution;solution = NULL;
+
+    PYLITH_METHOD_END;
+} // testSetValuesInterpolate
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setValues() with missing field or time step in file.
+void
+pylith::problems::TestInitialConditionFile::testSetValuesErrors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+
+    spatialdata::units::Nondimensional normalizer;
+    normalizer.setLengthScale(1.0);
+    pylith::topology::Field* solution = _createSolution(1);
+
+    { // Time step not in file.
+        const char* subfields[1] = { "displacement" };
+        InitialConditionFile ic;
+        ic.setSubfields(subfields, 1);
+        ic.setFilename(_filename);
+        ic.setTimeStep(2);
+        CHECK_THROWS_AS(ic.setValues(solution, normalizer), std::runtime_error);
+        ic.setTimeStep(-3);
+        CHECK_THROWS_AS(ic.setValues(solution, normalizer), std::runtime_error);
+    } // Time step not in file.
+
+    { // Missing file.
+        const char* subfields[1] = { "displacement" };
+        InitialConditionFile ic;
+        ic.setSubfields(subfields, 1);
+        ic.setFilename("missing.h5");
+        CHECK_THROWS_AS(ic.setValues(solution, normalizer), std::runtime_error);
+    } // Missing file.
+
+    delete solution;solution = NULL;
+
+    PYLITH_METHOD_END;
+} // testSetValuesErrors
+
+
+// ------------------------------------------------------------------------------------------------
+// Read mesh and write HDF5 file with linear displacement field at two time steps.
+void
+pylith::problems::TestInitialConditionFile::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    pylith::topology::Field* solution = _createSolution(1);assert(solution);
+    solution->createOutputVector();
+
+    pylith::meshio::DataWriterHDF5 writer;
+    writer.filename(_filename);
+    writer.open(*_mesh, false);
+    const PylithReal scales[2] = { 0.5, 1.0 };
+    for (int iStep = 0; iStep < 2; ++iStep) {
+        const PylithReal t = iStep;
+        _linearField(solution, scales[iStep], false);
+        solution->scatterLocalToOutput();
+
+        writer.openTimeStep(t, *_mesh);
+        pylith::meshio::OutputSubfield* subfield = pylith::meshio::OutputSubfield::create(*solution, *_mesh, "displacement", 1);
+        assert(subfield);
+        subfield->project(solution->getOutputVector());
+        writer.writeVertexField(t, *subfield);
+        delete subfield;subfield = NULL;
+        writer.closeTimeStep();
+    } // for
+    writer.close();
+    delete solution;solution = NULL;
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Create solution field with displacement subfield.
+pylith::topology::Field*
+pylith::problems::TestInitialConditionFile::_createSolution(const int basisOrder) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+
+    pylith::topology::Field* solution = new pylith::topology::Field(*_mesh);assert(solution);
+    solution->setLabel("solution");
+
+    const char* componentNames[2] = { "displacement_x", "displacement_y" };
+    pylith::string_vector names(componentNames, componentNames+2);
+    pylith::topology::Field::Description description("displacement", "displacement", names, 2,
+                                                     pylith::topology::Field::VECTOR);
+    const int quadOrder = basisOrder > 0 ? basisOrder : 1;
+    pylith::topology::Field::Discretization discretization(basisOrder, quadOrder, _mesh->getDimension());
+    solution->subfieldAdd(description, discretization);
+    solution->subfieldsSetup();
+    solution->createDiscretization();
+    solution->allocate();
+    solution->zeroLocal();
+
+    PYLITH_METHOD_RETURN(solution);
+} // _createSolution
+
+
+// ------------------------------------------------------------------------------------------------
+// Set or check displacement subfield against linear field.
+void
+pylith::problems::TestInitialConditionFile::_linearField(pylith::topology::Field* solution,
+                                                         const PylithReal scale,
+                                                         const bool isCheck) {
+    PYLITH_METHOD_BEGIN;
+    assert(solution);
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution->getDM();
+    PetscSection solnSection = solution->getLocalSection();
+    const PetscInt index = solution->getSubfieldInfo("displacement").index;
+
+    PetscVec coordsVec = NULL;
+    PetscSection coordsSection = NULL;
+    const PetscScalar* coordsArray = NULL;
+    err = DMGetCoordinatesLocal(dmSoln, &coordsVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoordinateSection(dmSoln, &coordsSection);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+
+    PetscInt pStart = 0, pEnd = 0, vStart = 0, vEnd = 0;
+    err = PetscSectionGetChart(solnSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dmSoln, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscScalar* solnArray = NULL;
+    err = VecGetArray(solution->getLocalVector(), &solnArray);PYLITH_CHECK_ERROR(err);
+    const PylithReal tolerance = 1.0e-10;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, off = 0;
+        err = PetscSectionGetFieldDof(solnSection, point, index, &dof);PYLITH_CHECK_ERROR(err);
+        if (!dof) { continue; }
+        err = PetscSectionGetFieldOffset(solnSection, point, index, &off);PYLITH_CHECK_ERROR(err);
+        REQUIRE(2 == dof);
+
+        // Location of degrees of freedom is the centroid of the vertices in the closure of the point.
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0, numVertices = 0;
+        PylithReal xyz[2] = { 0.0, 0.0 };
+        err = DMPlexGetTransitiveClosure(dmSoln, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iClosure = 0; iClosure < 2*closureSize; iClosure += 2) {
+            const PetscInt vertex = closure[iClosure];
+            if ((vertex < vStart) || (vertex >= vEnd)) { continue; }
+            PetscInt coordsOff = 0;
+            err = PetscSectionGetOffset(coordsSection, vertex, &coordsOff);PYLITH_CHECK_ERROR(err);
+            xyz[0] += PetscRealPart(coordsArray[coordsOff+0]);
+            xyz[1] += PetscRealPart(coordsArray[coordsOff+1]);
+            ++numVertices;
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmSoln, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        assert(numVertices > 0);
+        xyz[0] /= numVertices;
+        xyz[1] /= numVertices;
+
+        const PylithReal valuesE[2] = {
+            scale * (1.0 + 2.0e-3*xyz[0] - 1.0e-3*xyz[1]),
+            scale * (-0.5 + 0.5e-3*xyz[0] + 3.0e-3*xyz[1]),
+        };
+        for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+            if (isCheck) {
+                INFO("Checking component " << iDof << " of point " << point << ".");
+                CHECK_THAT(PetscRealPart(solnArray[off+iDof]), Catch::Matchers::WithinAbs(valuesE[iDof], tolerance));
+            } else {
+                solnArray[off+iDof] = valuesE[iDof];
+            } // if/else
+        } // for
+    } // for
+    err = VecRestoreArray(solution->getLocalVector(), &solnArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _linearField
+
+
+// End of file
@@ -62,6 +62,12 @@ public:
     /// Test notifyObservers().
     void testNotifyObservers(void);
 
+    /// Test setLoadCase().
+    void testLoadCase(void);
+
+    /// Test setSuppressOutput().
+    void testSuppressOutput(void);
+
     // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -90,6 +96,12 @@ TEST_CASE("TestObservesSoln::testVerifyObservers", "[TestObserversSoln]") {
 TEST_CASE("TestObservesSoln::testNotifyObservers", "[TestObserversSoln]") {
     pylith::problems::TestObserversSoln().testNotifyObservers();
 }
+TEST_CASE("TestObservesSoln::testLoadCase", "[TestObserversSoln]") {
+    pylith::problems::TestObserversSoln().testLoadCase();
+}
+TEST_CASE("TestObservesSoln::testSuppressOutput", "[TestObserversSoln]") {
+    pylith::problems::TestObserversSoln().testSuppressOutput();
+}
 
 // ------------------------------------------------------------------------------------------------
 // Constructor.
@@ -191,4 +203,68 @@ pylith::problems::TestObserversSoln::testNotifyObservers(void) {
 } // testNotifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Test setLoadCase().
+void
+pylith::problems::TestObserversSoln::testLoadCase(void) {
+    assert(_observers);
+
+    pylith::testing::StubMethodTracker tracker;
+    const PylithReal t = 1.0;
+    const PylithInt tindex = 1;
+    pylith::topology::Mesh mesh;
+    pylith::topology::Field solution(mesh);
+    observerB.setLoadCase("b");
+
+    // Observer without load case gets first load case.
+    tracker.clear();
+    _observers->setLoadCase("a", true);
+    _observers->notifyObservers(t, tindex, solution);
+    CHECK(size_t(1) == tracker.getMethodCount("pylith::problems::ObserverPhysicsStub::update"));
+
+    tracker.clear();
+    _observers->setLoadCase("b", false);
+    _observers->notifyObservers(t, tindex, solution);
+    CHECK(size_t(1) == tracker.getMethodCount("pylith::problems::ObserverPhysicsStub::update"));
+
+    tracker.clear();
+    _observers->setLoadCase("c", false);
+    _observers->notifyObservers(t, tindex, solution);
+    CHECK(size_t(0) == tracker.getMethodCount("pylith::problems::ObserverPhysicsStub::update"));
+
+    // All observers get updates without load cases.
+    tracker.clear();
+    _observers->setLoadCase("", true);
+    _observers->notifyObservers(t, tindex, solution);
+    CHECK(size_t(2) == tracker.getMethodCount("pylith::problems::ObserverPhysicsStub::update"));
+
+    observerB.setLoadCase("");
+} // testLoadCase
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setSuppressOutput().
+void
+pylith::problems::TestObserversSoln::testSuppressOutput(void) {
+    assert(_observers);
+
+    pylith::testing::StubMethodTracker tracker;
+    const PylithReal t = 1.0;
+    const PylithInt tindex = 1;
+    pylith::topology::Mesh mesh;
+    pylith::topology::Field solution(mesh);
+
+    tracker.clear();
+    _observers->setSuppressOutput(true);
+    CHECK(!_observers->needsUpdate(t, tindex));
+    _observers->notifyObservers(t, tindex, solution);
+    CHECK(size_t(0) == tracker.getMethodCount("pylith::problems::ObserverPhysicsStub::update"));
+
+    tracker.clear();
+    _observers->setSuppressOutput(false);
+    _observers->notifyObservers(t, tindex, solution);
+    CHECK(size_t(2) == tracker.getMethodCount("pylith::problems::ObserverPhysicsStub::update"));
+} // testSuppressOutput
+
+
 // End of file
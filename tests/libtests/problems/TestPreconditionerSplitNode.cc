@@ -0,0 +1,379 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/problems/PreconditionerSplitNode.hh" // Test subject
+#include "tests/src/FaultCohesiveStub.hh" // USES FaultCohesiveStub
+
+#include "pylith/problems/SolutionFactory.hh" // USES SolutionFactory
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "petscksp.h" // USES PetscPC
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <cmath> // USES sin()
+
+// ------------------------------------------------------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+    namespace problems {
+        class TestPreconditionerSplitNode;
+    } // problems
+} // pylith
+
+class pylith::problems::TestPreconditionerSplitNode : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestPreconditionerSplitNode(void);
+
+    /// Destructor.
+    ~TestPreconditionerSplitNode(void);
+
+    /// Test initialize().
+    void testInitialize(void);
+
+    /// Test _createNearNullSpace().
+    void testNearNullSpace(void);
+
+    /// Test apply() recovers the solution of the saddle point system.
+    void testApply(void);
+
+private:
+
+    /// Create mesh with fault and solution with displacement and fault Lagrange multiplier subfields.
+    void _initialize(void);
+
+    pylith::topology::Mesh* _mesh; ///< Mesh with fault.
+    pylith::faults::FaultCohesiveStub* _fault; ///< Fault.
+    pylith::topology::Field* _solution; ///< Solution field.
+    pylith::problems::PreconditionerSplitNode* _preconditioner; ///< Test subject.
+
+}; // class TestPreconditionerSplitNode
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestPreconditionerSplitNode::testInitialize", "[TestPreconditionerSplitNode]") {
+    pylith::problems::TestPreconditionerSplitNode().testInitialize();
+}
+TEST_CASE("TestPreconditionerSplitNode::testNearNullSpace", "[TestPreconditionerSplitNode]") {
+    pylith::problems::TestPreconditionerSplitNode().testNearNullSpace();
+}
+TEST_CASE("TestPreconditionerSplitNode::testApply", "[TestPreconditionerSplitNode]") {
+    pylith::problems::TestPreconditionerSplitNode().testApply();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::problems::TestPreconditionerSplitNode::TestPreconditionerSplitNode(void) :
+    _mesh(NULL),
+    _fault(NULL),
+    _solution(NULL),
+    _preconditioner(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::problems::TestPreconditionerSplitNode::~TestPreconditionerSplitNode(void) {
+    delete _preconditioner;_preconditioner = NULL;
+    delete _solution;_solution = NULL;
+    delete _fault;_fault = NULL;
+    delete _mesh;_mesh = NULL;
+} // tearDown
+
+
+// ------------------------------------------------------------------------------------------------
+// Test initialize().
+void
+pylith::problems::TestPreconditionerSplitNode::testInitialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    assert(_preconditioner);
+
+    // Two fault vertices in 2D: 6 vertices (12 displacement dof) and 4 Lagrange multiplier dof after splitting.
+    const PetscInt numDisp = 12;
+    const PetscInt numLagrange = 4;
+
+    PetscErrorCode err = 0;
+    PetscInt numRows = 0, numCols = 0;
+    err = MatGetSize(_preconditioner->_projectMat, &numRows, &numCols);PYLITH_CHECK_ERROR(err);
+    CHECK(numLagrange == numRows);
+    CHECK(numDisp == numCols);
+
+    err = MatGetSize(_preconditioner->_expandMat, &numRows, &numCols);PYLITH_CHECK_ERROR(err);
+    CHECK(numDisp == numRows);
+    CHECK(numDisp - numLagrange == numCols);
+    CHECK(numDisp - numLagrange == _preconditioner->getNumReducedDof());
+
+    // Each row of P selects one positive side displacement dof; each row of Z selects one reduced dof.
+    PetscVec onesVec = NULL, sumVec = NULL;
+    PetscReal minValue = 0.0, maxValue = 0.0;
+    err = MatCreateVecs(_preconditioner->_projectMat, &onesVec, &sumVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(onesVec, 1.0);PYLITH_CHECK_ERROR(err);
+    err = MatMult(_preconditioner->_projectMat, onesVec, sumVec);PYLITH_CHECK_ERROR(err);
+    err = VecMin(sumVec, NULL, &minValue);PYLITH_CHECK_ERROR(err);
+    err = VecMax(sumVec, NULL, &maxValue);PYLITH_CHECK_ERROR(err);
+    CHECK(1.0 == minValue);
+    CHECK(1.0 == maxValue);
+    err = VecDestroy(&onesVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&sumVec);PYLITH_CHECK_ERROR(err);
+
+    err = MatCreateVecs(_preconditioner->_expandMat, &onesVec, &sumVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(onesVec, 1.0);PYLITH_CHECK_ERROR(err);
+    err = MatMult(_preconditioner->_expandMat, onesVec, sumVec);PYLITH_CHECK_ERROR(err);
+    err = VecMin(sumVec, NULL, &minValue);PYLITH_CHECK_ERROR(err);
+    err = VecMax(sumVec, NULL, &maxValue);PYLITH_CHECK_ERROR(err);
+    CHECK(1.0 == minValue);
+    CHECK(1.0 == maxValue);
+
+    // P Z maps each Lagrange multiplier to the reduced dof of the negative side, which is not on the positive side.
+    PetscMat projectExpandMat = NULL;
+    PetscVec lagrangeVec = NULL, reducedVec = NULL;
+    PetscReal norm = 0.0;
+    err = MatMatMult(_preconditioner->_projectMat, _preconditioner->_expandMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT,
+                     &projectExpandMat);PYLITH_CHECK_ERROR(err);
+    err = MatCreateVecs(projectExpandMat, &reducedVec, &lagrangeVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(lagrangeVec, 1.0);PYLITH_CHECK_ERROR(err);
+    err = MatMultTranspose(projectExpandMat, lagrangeVec, reducedVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(reducedVec, NORM_1, &norm);PYLITH_CHECK_ERROR(err);
+    CHECK(PetscReal(numLagrange) == norm);
+    err = VecMax(reducedVec, NULL, &maxValue);PYLITH_CHECK_ERROR(err);
+    CHECK(1.0 == maxValue);
+
+    err = MatDestroy(&projectExpandMat);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&lagrangeVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&reducedVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&onesVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&sumVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testInitialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _createNearNullSpace().
+void
+pylith::problems::TestPreconditionerSplitNode::testNearNullSpace(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    assert(_preconditioner);
+    assert(_solution);
+
+    PetscErrorCode err = 0;
+    MatNullSpace nullSpace = NULL;
+    const PetscInt dispField = _solution->getSubfieldInfo("displacement").index;
+    err = DMPlexCreateRigidBody(_solution->getDM(), dispField, &nullSpace);PYLITH_CHECK_ERROR(err);
+    _preconditioner->_createNearNullSpace(nullSpace);
+    err = MatNullSpaceDestroy(&nullSpace);PYLITH_CHECK_ERROR(err);
+    REQUIRE(_preconditioner->_nullSpace);
+
+    // Translation and rotation in 2D. Expanding the reduced translations gives uniform displacements.
+    PetscBool hasConstant = PETSC_FALSE;
+    PetscInt numModes = 0;
+    const PetscVec* modes = NULL;
+    err = MatNullSpaceGetVecs(_preconditioner->_nullSpace, &hasConstant, &numModes, &modes);PYLITH_CHECK_ERROR(err);
+    REQUIRE(3 == numModes);
+
+    PetscVec dispVec = NULL;
+    PetscReal norm = 0.0;
+    err = MatCreateVecs(_preconditioner->_expandMat, NULL, &dispVec);PYLITH_CHECK_ERROR(err);
+    err = MatMult(_preconditioner->_expandMat, modes[0], dispVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(dispVec, NORM_2, &norm);PYLITH_CHECK_ERROR(err);
+    CHECK(norm > 0.0);
+    for (PetscInt i = 0; i < numModes; ++i) {
+        err = VecNorm(modes[i], NORM_2, &norm);PYLITH_CHECK_ERROR(err);
+        CHECK(std::fabs(norm - 1.0) < 1.0e-12);
+        for (PetscInt j = 0; j < i; ++j) {
+            PetscScalar dot = 0.0;
+            err = VecDot(modes[i], modes[j], &dot);PYLITH_CHECK_ERROR(err);
+            CHECK(std::fabs(PetscRealPart(dot)) < 1.0e-12);
+        } // for
+    } // for
+    err = VecDestroy(&dispVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testNearNullSpace
+
+
+// ------------------------------------------------------------------------------------------------
+// Test apply() recovers the solution of the saddle point system.
+void
+pylith::problems::TestPreconditionerSplitNode::testApply(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    assert(_preconditioner);
+    assert(_solution);
+
+    // Saddle point system J = [K B^T; B 0] with symmetric positive definite K = 2 I + Z Z^T and constraint
+    // B u = u+ - u-, so B Z = 0. The negative side is selected by P Z Z^T (I - P^T P).
+    PetscErrorCode err = 0;
+    PetscMat expandMat = _preconditioner->_expandMat;
+    PetscMat projectMat = _preconditioner->_projectMat;
+    PetscMat projectTMat = _preconditioner->_projectTMat;
+    PetscMat dispMat = NULL, expandTMat = NULL, posMat = NULL, restrictMat = NULL, tmpMat = NULL, negMat = NULL;
+    PetscMat constraintMat = NULL;
+    err = MatMatTransposeMult(expandMat, expandMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &dispMat);PYLITH_CHECK_ERROR(err);
+    err = MatShift(dispMat, 2.0);PYLITH_CHECK_ERROR(err);
+    err = MatTranspose(expandMat, MAT_INITIAL_MATRIX, &expandTMat);PYLITH_CHECK_ERROR(err);
+    err = MatMatMult(projectTMat, projectMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &posMat);PYLITH_CHECK_ERROR(err);
+    err = MatMatMult(expandTMat, posMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &tmpMat);PYLITH_CHECK_ERROR(err);
+    err = MatDuplicate(expandTMat, MAT_COPY_VALUES, &restrictMat);PYLITH_CHECK_ERROR(err);
+    err = MatAXPY(restrictMat, -1.0, tmpMat, DIFFERENT_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&tmpMat);PYLITH_CHECK_ERROR(err);
+    err = MatMatMatMult(projectMat, expandMat, restrictMat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &negMat);PYLITH_CHECK_ERROR(err);
+    err = MatDuplicate(projectMat, MAT_COPY_VALUES, &constraintMat);PYLITH_CHECK_ERROR(err);
+    err = MatAXPY(constraintMat, -1.0, negMat, DIFFERENT_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numDisp = 0, numLagrange = 0;
+    const PetscInt *dispIndices = NULL, *lagrangeIndices = NULL;
+    err = ISGetSize(_preconditioner->_displacementIS, &numDisp);PYLITH_CHECK_ERROR(err);
+    err = ISGetSize(_preconditioner->_lagrangeIS, &numLagrange);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(_preconditioner->_displacementIS, &dispIndices);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(_preconditioner->_lagrangeIS, &lagrangeIndices);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt size = numDisp + numLagrange;
+    PetscMat jacobianMat = NULL;
+    err = MatCreateSeqAIJ(PETSC_COMM_SELF, size, size, size, NULL, &jacobianMat);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iRow = 0; iRow < numDisp; ++iRow) {
+        PetscInt numEntries = 0;
+        const PetscInt* cols = NULL;
+        const PetscScalar* values = NULL;
+        err = MatGetRow(dispMat, iRow, &numEntries, &cols, &values);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numEntries; ++i) {
+            err = MatSetValue(jacobianMat, dispIndices[iRow], dispIndices[cols[i]], values[i], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = MatRestoreRow(dispMat, iRow, &numEntries, &cols, &values);PYLITH_CHECK_ERROR(err);
+    } // for
+    for (PetscInt iRow = 0; iRow < numLagrange; ++iRow) {
+        PetscInt numEntries = 0;
+        const PetscInt* cols = NULL;
+        const PetscScalar* values = NULL;
+        err = MatGetRow(constraintMat, iRow, &numEntries, &cols, &values);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numEntries; ++i) {
+            err = MatSetValue(jacobianMat, lagrangeIndices[iRow], dispIndices[cols[i]], values[i], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+            err = MatSetValue(jacobianMat, dispIndices[cols[i]], lagrangeIndices[iRow], values[i], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = MatRestoreRow(constraintMat, iRow, &numEntries, &cols, &values);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = MatAssemblyBegin(jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = ISRestoreIndices(_preconditioner->_displacementIS, &dispIndices);PYLITH_CHECK_ERROR(err);
+    err = ISRestoreIndices(_preconditioner->_lagrangeIS, &lagrangeIndices);PYLITH_CHECK_ERROR(err);
+
+    PetscPC pc = NULL;
+    err = PCCreate(PETSC_COMM_SELF, &pc);PYLITH_CHECK_ERROR(err);
+    err = PCSetType(pc, PCSHELL);PYLITH_CHECK_ERROR(err);
+    _preconditioner->setShell(pc);
+    err = PCSetOperators(pc, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = PCSetUp(pc);PYLITH_CHECK_ERROR(err);
+
+    // Apply preconditioner to r = J x and compare with x. Apply twice to check reuse of the operators.
+    PetscVec solnVec = NULL, residualVec = NULL, updateVec = NULL;
+    err = MatCreateVecs(jacobianMat, &solnVec, &residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solnVec, &updateVec);PYLITH_CHECK_ERROR(err);
+    PetscScalar* solnArray = NULL;
+    err = VecGetArray(solnVec, &solnArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < size; ++i) {
+        solnArray[i] = sin(1.0 + 0.7*i);
+    } // for
+    err = VecRestoreArray(solnVec, &solnArray);PYLITH_CHECK_ERROR(err);
+    err = MatMult(jacobianMat, solnVec, residualVec);PYLITH_CHECK_ERROR(err);
+
+    const PetscReal tolerance = 1.0e-6;
+    for (int iApply = 0; iApply < 2; ++iApply) {
+        if (iApply > 0) {
+            err = PCSetOperators(pc, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+            err = PCSetUp(pc);PYLITH_CHECK_ERROR(err);
+        } // if
+        PetscReal norm = 0.0;
+        err = PCApply(pc, residualVec, updateVec);PYLITH_CHECK_ERROR(err);
+        err = VecAXPY(updateVec, -1.0, solnVec);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(updateVec, NORM_INFINITY, &norm);PYLITH_CHECK_ERROR(err);
+        CHECK(norm < tolerance);
+    } // for
+
+    err = PCDestroy(&pc);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solnVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&updateVec);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&constraintMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&negMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&restrictMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&posMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&expandTMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&dispMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testApply
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh with fault and solution with displacement and fault Lagrange multiplier subfields.
+void
+pylith::problems::TestPreconditionerSplitNode::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri_fault.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    delete _fault;_fault = new pylith::faults::FaultCohesiveStub();assert(_fault);
+    _fault->setCohesiveLabelName(pylith::topology::Mesh::cells_label_name);
+    _fault->setCohesiveLabelValue(100);
+    _fault->setSurfaceLabelName("fault");
+    _fault->setSurfaceLabelValue(1);
+    _fault->adjustTopology(_mesh);
+
+    spatialdata::units::Nondimensional normalizer;
+    delete _solution;_solution = new pylith::topology::Field(*_mesh);assert(_solution);
+    _solution->setLabel("solution");
+    pylith::problems::SolutionFactory factory(*_solution, normalizer);
+    const int spaceDim = _mesh->getDimension();
+    factory.addDisplacement(pylith::topology::Field::Discretization(1, 1, spaceDim));
+    factory.addLagrangeMultiplierFault(pylith::topology::Field::Discretization(1, 1, spaceDim-1, -1, true));
+    _solution->subfieldsSetup();
+    _solution->createDiscretization();
+    _solution->allocate();
+    _solution->createGlobalVector();
+
+    delete _preconditioner;_preconditioner = new PreconditionerSplitNode();assert(_preconditioner);
+    _preconditioner->initialize(*_solution);
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// End of file
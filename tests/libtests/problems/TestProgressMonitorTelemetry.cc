@@ -0,0 +1,276 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/problems/ProgressMonitorTelemetry.hh" // Test subject
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petscts.h" // USES PetscTS
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <fstream> // USES std::ifstream
+#include <sstream> // USES std::ostringstream
+#include <string> // USES std::string
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class TestProgressMonitorTelemetry;
+    } // problems
+} // pylith
+
+class pylith::problems::TestProgressMonitorTelemetry : public pylith::utils::GenericComponent {
+public:
+
+    /// Test getFormat(), setFormat(), and default filename.
+    static
+    void testAccessors(void);
+
+    /// Test update().
+    static
+    void testUpdate(void);
+
+    /// Test updateStep() writing JSON Lines.
+    static
+    void testWriteJSONLines(void);
+
+    /// Test updateStep() writing Prometheus text format.
+    static
+    void testWritePrometheus(void);
+
+private:
+
+    /** Read contents of file.
+     *
+     * @param[in] filename Name of file.
+     * @returns Contents of file.
+     */
+    static
+    std::string _readFile(const std::string& filename);
+
+}; // class TestProgressMonitorTelemetry
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestProgressMonitorTelemetry::testAccessors", "[TestProgressMonitorTelemetry]") {
+    pylith::problems::TestProgressMonitorTelemetry::testAccessors();
+}
+TEST_CASE("TestProgressMonitorTelemetry::testUpdate", "[TestProgressMonitorTelemetry]") {
+    pylith::problems::TestProgressMonitorTelemetry::testUpdate();
+}
+TEST_CASE("TestProgressMonitorTelemetry::testWriteJSONLines", "[TestProgressMonitorTelemetry]") {
+    pylith::problems::TestProgressMonitorTelemetry::testWriteJSONLines();
+}
+TEST_CASE("TestProgressMonitorTelemetry::testWritePrometheus", "[TestProgressMonitorTelemetry]") {
+    pylith::problems::TestProgressMonitorTelemetry::testWritePrometheus();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test getFormat(), setFormat(), and default filename.
+void
+pylith::problems::TestProgressMonitorTelemetry::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    ProgressMonitorTelemetry monitor;
+    CHECK(ProgressMonitorTelemetry::JSON_LINES == monitor.getFormat());
+    CHECK(std::string("progress.jsonl") == std::string(monitor.getFilename()));
+
+    monitor.setFormat(ProgressMonitorTelemetry::PROMETHEUS);
+    CHECK(ProgressMonitorTelemetry::PROMETHEUS == monitor.getFormat());
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test update().
+void
+pylith::problems::TestProgressMonitorTelemetry::testUpdate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const double tolerance = 1.0e-12;
+    ProgressMonitorTelemetry monitor;
+    CHECK(0.0 == monitor._percentComplete);
+
+    // Every call is recorded, independent of the update percent.
+    monitor.update(1.5, 1.0, 11.0);
+    CHECK_THAT(monitor._percentComplete, Catch::Matchers::WithinAbs(5.0, tolerance));
+    monitor.update(6.0, 1.0, 11.0);
+    CHECK_THAT(monitor._percentComplete, Catch::Matchers::WithinAbs(50.0, tolerance));
+
+    // Empty time interval.
+    monitor.update(1.0, 1.0, 1.0);
+    CHECK(0.0 == monitor._percentComplete);
+
+    PYLITH_METHOD_END;
+} // testUpdate
+
+
+// ------------------------------------------------------------------------------------------------
+// Test updateStep() writing JSON Lines.
+void
+pylith::problems::TestProgressMonitorTelemetry::testWriteJSONLines(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const char* filename = "progress_telemetry.jsonl";
+    ProgressMonitorTelemetry monitor;
+    monitor.setFilename(filename);
+    monitor.open();
+
+    PetscTS ts = NULL;
+    PetscErrorCode err = TSCreate(PETSC_COMM_WORLD, &ts);PYLITH_CHECK_ERROR(err);
+
+    const size_t numSteps = 2;
+    const double start = 0.0;
+    const double stop = 10.0;
+    const double dt = 0.5;
+    const double outputTime = 0.25;
+    for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+        const double t = 2.0 + 2.0*iStep;
+        monitor.update(t, start, stop);
+        monitor.setSolverStatistics(3+iStep, 17+iStep);
+        monitor.updateStep(t, dt, 4+iStep, ts, outputTime);
+    } // for
+    CHECK(monitor._eventsSetup);
+    monitor.close();
+    err = TSDestroy(&ts);PYLITH_CHECK_ERROR(err);
+
+    std::ifstream fin(filename);
+    REQUIRE(fin.is_open());
+    std::string line;
+    for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+        INFO("Checking record of time step " << iStep << ".");
+        std::getline(fin, line);
+        REQUIRE(fin.good());
+        CHECK(0 == line.find("{\"timestamp\": \""));
+        CHECK('}' == line.back());
+
+        std::ostringstream fields;
+        fields << "\"t\": " << 2.0+2.0*iStep
+               << ", \"t_units\": \"second\""
+               << ", \"time_step\": " << 4+iStep
+               << ", \"dt\": " << dt
+               << ", \"percent_complete\": " << 20.0+20.0*iStep
+               << ", \"snes_iterations\": 0";
+        CHECK(line.find(fields.str()) != std::string::npos);
+
+        std::ostringstream totals;
+        totals << "\"num_jacobians\": " << 3+iStep << ", \"num_solver_iterations\": " << 17+iStep;
+        CHECK(line.find(totals.str()) != std::string::npos);
+
+        std::ostringstream output;
+        output << "\"output\": " << outputTime << "}";
+        CHECK(line.find(output.str()) != std::string::npos);
+        for (size_t i = 0; i < 4; ++i) {
+            INFO("Checking operation " << ProgressMonitorTelemetry::_operationNames[i] << ".");
+            CHECK(line.find(std::string("\"") + ProgressMonitorTelemetry::_operationNames[i] + "\": ") != std::string::npos);
+        } // for
+
+        const std::string memoryKey = "\"memory_max\": ";
+        const size_t memoryPos = line.find(memoryKey);
+        REQUIRE(memoryPos != std::string::npos);
+        CHECK(std::stod(line.substr(memoryPos + memoryKey.size())) > 0.0);
+    } // for
+    std::getline(fin, line);
+    CHECK(fin.eof());
+    fin.close();
+
+    PYLITH_METHOD_END;
+} // testWriteJSONLines
+
+
+// ------------------------------------------------------------------------------------------------
+// Test updateStep() writing Prometheus text format.
+void
+pylith::problems::TestProgressMonitorTelemetry::testWritePrometheus(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const std::string filename = "progress_telemetry.prom";
+    ProgressMonitorTelemetry monitor;
+    monitor.setFormat(ProgressMonitorTelemetry::PROMETHEUS);
+    monitor.setFilename(filename.c_str());
+    monitor.open();
+    CHECK(!monitor._sout.is_open());
+
+    PetscTS ts = NULL;
+    PetscErrorCode err = TSCreate(PETSC_COMM_WORLD, &ts);PYLITH_CHECK_ERROR(err);
+
+    // File is replaced at every time step, so only the values of the last step remain.
+    monitor.update(2.0, 0.0, 10.0);
+    monitor.setSolverStatistics(2, 9);
+    monitor.updateStep(2.0, 0.5, 4, ts, 0.125);
+    monitor.update(5.0, 0.0, 10.0);
+    monitor.setSolverStatistics(3, 17);
+    monitor.updateStep(5.0, 0.5, 5, ts, 0.25);
+    monitor.close();
+    err = TSDestroy(&ts);PYLITH_CHECK_ERROR(err);
+
+    const std::string& contents = _readFile(filename);
+    const size_t numMetrics = 8;
+    const char* metrics[numMetrics] = {
+        "# TYPE pylith_simulation_time gauge\npylith_simulation_time 5\n",
+        "# TYPE pylith_time_step gauge\npylith_time_step 5\n",
+        "pylith_percent_complete 50\n",
+        "pylith_snes_iterations 0\n",
+        "# TYPE pylith_jacobians_total counter\npylith_jacobians_total 3\n",
+        "# TYPE pylith_solver_iterations_total counter\npylith_solver_iterations_total 17\n",
+        "pylith_step_seconds{operation=\"output\"} 0.25\n",
+        "# TYPE pylith_memory_max_bytes gauge\npylith_memory_max_bytes ",
+    };
+    for (size_t i = 0; i < numMetrics; ++i) {
+        INFO("Checking metric '" << metrics[i] << "'.");
+        CHECK(contents.find(metrics[i]) != std::string::npos);
+    } // for
+    for (size_t i = 0; i < 4; ++i) {
+        std::ostringstream operation;
+        operation << "pylith_step_seconds{operation=\"" << ProgressMonitorTelemetry::_operationNames[i] << "\"} ";
+        INFO("Checking operation " << ProgressMonitorTelemetry::_operationNames[i] << ".");
+        CHECK(contents.find(operation.str()) != std::string::npos);
+    } // for
+
+    // Temporary file is renamed.
+    std::ifstream fin((filename + ".tmp").c_str());
+    CHECK(!fin.is_open());
+
+    PYLITH_METHOD_END;
+} // testWritePrometheus
+
+
+// ------------------------------------------------------------------------------------------------
+// Read contents of file.
+std::string
+pylith::problems::TestProgressMonitorTelemetry::_readFile(const std::string& filename) {
+    PYLITH_METHOD_BEGIN;
+
+    std::ifstream fin(filename.c_str());
+    INFO("Opening file '" << filename << "'.");
+    REQUIRE(fin.is_open());
+    std::ostringstream contents;
+    contents << fin.rdbuf();
+    fin.close();
+
+    PYLITH_METHOD_RETURN(contents.str());
+} // _readFile
+
+
+// End of file
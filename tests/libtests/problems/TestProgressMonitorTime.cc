@@ -29,6 +29,8 @@
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
 
+#include <sstream> // USES std::istringstream
+
 /// Namespace for pylith package
 namespace pylith {
     namespace problems {
@@ -55,6 +57,9 @@ public:
     /// Test update().
     void testUpdate(void);
 
+    /// Test update() with solver statistics.
+    void testUpdateSolverStatistics(void);
+
 private:
 
     pylith::problems::ProgressMonitorTime* _monitor; ///< Test subject.
@@ -71,6 +76,9 @@ TEST_CASE("TestProgressMonitorTime::testOpenClose", "[TestProgressMonitorTime]")
 TEST_CASE("TestProgressMonitorTime::testUpdate", "[TestProgressMonitorTime]") {
     pylith::problems::TestProgressMonitorTime().testUpdate();
 }
+TEST_CASE("TestProgressMonitorTime::testUpdateSolverStatistics", "[TestProgressMonitorTime]") {
+    pylith::problems::TestProgressMonitorTime().testUpdateSolverStatistics();
+}
 
 // ------------------------------------------------------------------------------------------------
 // Setup testing data.
@@ -100,6 +108,19 @@ pylith::problems::TestProgressMonitorTime::testAccessors(void) {
     _monitor->setTimeUnit(unit.c_str());
     CHECK(unit == std::string(_monitor->getTimeUnit()));
 
+    CHECK(!_monitor->getShowSolverStatistics());
+    _monitor->setShowSolverStatistics(true);
+    CHECK(_monitor->getShowSolverStatistics());
+
+    CHECK(size_t(0) == _monitor->getNumJacobians());
+    CHECK(size_t(0) == _monitor->getNumSolverIterations());
+
+    const size_t numJacobians = 3;
+    const size_t numSolverIterations = 17;
+    _monitor->setSolverStatistics(numJacobians, numSolverIterations);
+    CHECK(numJacobians == _monitor->getNumJacobians());
+    CHECK(numSolverIterations == _monitor->getNumSolverIterations());
+
     PYLITH_METHOD_END;
 } // testAccessors
 
@@ -163,4 +184,44 @@ pylith::problems::TestProgressMonitorTime::testUpdate(void) {
 } // testUpdate
 
 
+// ------------------------------------------------------------------------------------------------
+// Test update() with solver statistics.
+void
+pylith::problems::TestProgressMonitorTime::testUpdateSolverStatistics(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_monitor);
+
+    const char* filename = "progress_time_statistics.txt";
+    const size_t numJacobians = 3;
+    const size_t numSolverIterations = 17;
+
+    _monitor->setFilename(filename);
+    _monitor->setShowSolverStatistics(true);
+    _monitor->open();
+    _monitor->setSolverStatistics(numJacobians, numSolverIterations);
+    _monitor->update(1.0, 1.0, 11.0);
+    _monitor->close();
+
+    // Check output
+    std::ifstream fin(filename);
+    REQUIRE(fin.is_open());
+
+    const int maxlen = 1024;
+    char buffer[maxlen];
+    fin.getline(buffer, maxlen);
+    CHECK(std::string(buffer).find("# Jacobians") != std::string::npos);
+    CHECK(std::string(buffer).find("# Solver its") != std::string::npos);
+    fin.getline(buffer, maxlen);
+    REQUIRE(fin.good());
+    std::istringstream sline(std::string(buffer).substr(std::string(buffer).length()-27));
+    size_t numJacobiansValue = 0, numSolverIterationsValue = 0;
+    sline >> numJacobiansValue >> numSolverIterationsValue;
+    CHECK(numJacobians == numJacobiansValue);
+    CHECK(numSolverIterations == numSolverIterationsValue);
+    fin.close();
+
+    PYLITH_METHOD_END;
+} // testUpdateSolverStatistics
+
+
 // End of file
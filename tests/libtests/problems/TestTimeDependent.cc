@@ -0,0 +1,717 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/problems/TimeDependentTimeStep.hh" // Test subject
+#include "pylith/problems/TimeDependentSteadyState.hh" // Test subject
+#include "pylith/problems/TimeDependentCheckpoint.hh" // Test subject
+#include "pylith/problems/TimeDependentGreensFns.hh" // Test subject
+
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
+#include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <cmath> // USES pow()
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+    namespace problems {
+        class TestTimeDependent;
+    } // problems
+} // pylith
+
+class pylith::problems::TestTimeDependent : public pylith::utils::GenericComponent {
+public:
+
+    /// Constructor.
+    TestTimeDependent(void);
+
+    /// Destructor.
+    ~TestTimeDependent(void);
+
+    /// Test _getMinMaxwellTime() with generalized Maxwell auxiliary subfield.
+    void testMinMaxwellTimeGeneralized(void);
+
+    /// Test _getMinMaxwellTime() with power-law auxiliary subfields.
+    void testMinMaxwellTimePowerLaw(void);
+
+    /// Test _getMinMaxwellTime() without viscoelastic auxiliary subfields.
+    void testMinMaxwellTimeElastic(void);
+
+    /// Test TimeDependentSteadyState accessors.
+    void testSteadyStateAccessors(void);
+
+    /// Test TimeDependentSteadyState::isSteadyState() for entire solution.
+    void testSteadyStateSolution(void);
+
+    /// Test TimeDependentSteadyState::isSteadyState() for solution subfields.
+    void testSteadyStateSubfields(void);
+
+    /// Test TimeDependentCheckpoint accessors for load imbalance.
+    void testLoadImbalanceAccessors(void);
+
+    /// Test TimeDependentCheckpoint::_checkLoadBalance().
+    void testCheckLoadBalance(void);
+
+    /// Test TimeDependentGreensFns accessors.
+    void testGreensFnsAccessors(void);
+
+    /// Test TimeDependentGreensFns::_computeSlipIncrements().
+    void testSlipIncrements(void);
+
+private:
+
+    /// Create mesh.
+    void _initializeMesh(void);
+
+    /** Add scalar or vector subfield to auxiliary field.
+     *
+     * @param[in] name Name of subfield.
+     * @param[in] componentNames Names of components.
+     * @param[in] numComponents Number of components.
+     */
+    void _addSubfield(const char* name,
+                      const char* componentNames[],
+                      const size_t numComponents);
+
+    /// Setup and allocate auxiliary field.
+    void _allocate(void);
+
+    /** Set values of subfield uniformly over domain.
+     *
+     * @param[in] name Name of subfield.
+     * @param[in] values Values of components.
+     */
+    void _setSubfield(const char* name,
+                      const PylithReal* values);
+
+    /** Set solution for steady state check with uniform subfields displacement and fluid_pressure.
+     *
+     * @param[in] displacement Value of displacement components.
+     * @param[in] pressure Value of fluid pressure.
+     */
+    void _setSolution(const PylithReal displacement,
+                      const PylithReal pressure);
+
+    pylith::topology::Mesh* _mesh; ///< Mesh.
+    pylith::topology::Field* _auxiliaryField; ///< Auxiliary field.
+
+}; // class TestTimeDependent
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestTimeDependent::testMinMaxwellTimeGeneralized", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent().testMinMaxwellTimeGeneralized();
+}
+TEST_CASE("TestTimeDependent::testMinMaxwellTimePowerLaw", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent().testMinMaxwellTimePowerLaw();
+}
+TEST_CASE("TestTimeDependent::testMinMaxwellTimeElastic", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent().testMinMaxwellTimeElastic();
+}
+TEST_CASE("TestTimeDependent::testSteadyStateAccessors", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent().testSteadyStateAccessors();
+}
+TEST_CASE("TestTimeDependent::testSteadyStateSolution", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent().testSteadyStateSolution();
+}
+TEST_CASE("TestTimeDependent::testSteadyStateSubfields", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent().testSteadyStateSubfields();
+}
+TEST_CASE("TestTimeDependent::testLoadImbalanceAccessors", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent().testLoadImbalanceAccessors();
+}
+TEST_CASE("TestTimeDependent::testCheckLoadBalance", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent().testCheckLoadBalance();
+}
+TEST_CASE("TestTimeDependent::testGreensFnsAccessors", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent().testGreensFnsAccessors();
+}
+TEST_CASE("TestTimeDependent::testSlipIncrements", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent().testSlipIncrements();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::problems::TestTimeDependent::TestTimeDependent(void) :
+    _mesh(NULL),
+    _auxiliaryField(NULL) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::problems::TestTimeDependent::~TestTimeDependent(void) {
+    delete _auxiliaryField;_auxiliaryField = NULL;
+    delete _mesh;_mesh = NULL;
+} // tearDown
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _getMinMaxwellTime() with generalized Maxwell auxiliary subfield.
+void
+pylith::problems::TestTimeDependent::testMinMaxwellTimeGeneralized(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initializeMesh();
+    const char* maxwellNames[3] = { "maxwell_time_1", "maxwell_time_2", "maxwell_time_3" };
+    _addSubfield("maxwell_time", maxwellNames, 3);
+    _allocate();
+
+    // Minimum is in a component other than the first one.
+    const PylithReal maxwellTime[3] = { 4.0, 0.5, 2.0 };
+    _setSubfield("maxwell_time", maxwellTime);
+
+    bool isStressDependent = true;
+    const PylithReal maxwellTimeMin = TimeDependentTimeStep::_getMinMaxwellTime(*_auxiliaryField, &isStressDependent);
+    CHECK_THAT(maxwellTimeMin, Catch::Matchers::WithinRel(maxwellTime[1], 1.0e-12));
+    CHECK(!isStressDependent);
+
+    PYLITH_METHOD_END;
+} // testMinMaxwellTimeGeneralized
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _getMinMaxwellTime() with power-law auxiliary subfields.
+void
+pylith::problems::TestTimeDependent::testMinMaxwellTimePowerLaw(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initializeMesh();
+    const char* shearModulusNames[1] = { "shear_modulus" };
+    const char* strainRateNames[1] = { "power_law_reference_strain_rate" };
+    const char* refStressNames[1] = { "power_law_reference_stress" };
+    const char* exponentNames[1] = { "power_law_exponent" };
+    const char* stressNames[4] = {
+        "deviatoric_stress_xx", "deviatoric_stress_yy", "deviatoric_stress_zz", "deviatoric_stress_xy",
+    };
+    _addSubfield("shear_modulus", shearModulusNames, 1);
+    _addSubfield("power_law_reference_strain_rate", strainRateNames, 1);
+    _addSubfield("power_law_reference_stress", refStressNames, 1);
+    _addSubfield("power_law_exponent", exponentNames, 1);
+    _addSubfield("deviatoric_stress", stressNames, 4);
+    _allocate();
+
+    const PylithReal shearModulus = 3.0;
+    const PylithReal refStrainRate = 0.25;
+    const PylithReal refStress = 2.0;
+    const PylithReal exponent = 3.0;
+    _setSubfield("shear_modulus", &shearModulus);
+    _setSubfield("power_law_reference_strain_rate", &refStrainRate);
+    _setSubfield("power_law_reference_stress", &refStress);
+    _setSubfield("power_law_exponent", &exponent);
+
+    bool isStressDependent = false;
+
+    // Zero stress gives infinite Maxwell time.
+    const PylithReal stressZero[4] = { 0.0, 0.0, 0.0, 0.0 };
+    _setSubfield("deviatoric_stress", stressZero);
+    PylithReal maxwellTimeMin = TimeDependentTimeStep::_getMinMaxwellTime(*_auxiliaryField, &isStressDependent);
+    CHECK(PYLITH_MAXSCALAR == maxwellTimeMin);
+    CHECK(isStressDependent);
+
+    // j2 = sqrt(0.5*(1+1+4+2*1)) = 2, so Maxwell time = 2/(2*3*0.25) * (2/2)^2 = 4/3.
+    const PylithReal stress[4] = { 1.0, 1.0, -2.0, 1.0 };
+    _setSubfield("deviatoric_stress", stress);
+    maxwellTimeMin = TimeDependentTimeStep::_getMinMaxwellTime(*_auxiliaryField, &isStressDependent);
+    CHECK_THAT(maxwellTimeMin, Catch::Matchers::WithinRel(4.0/3.0, 1.0e-12));
+
+    // Doubling the stress decreases the Maxwell time by a factor of 2^(n-1).
+    const PylithReal stressDouble[4] = { 2.0, 2.0, -4.0, 2.0 };
+    _setSubfield("deviatoric_stress", stressDouble);
+    maxwellTimeMin = TimeDependentTimeStep::_getMinMaxwellTime(*_auxiliaryField, &isStressDependent);
+    CHECK_THAT(maxwellTimeMin, Catch::Matchers::WithinRel(4.0/3.0 / pow(2.0, exponent-1.0), 1.0e-12));
+    CHECK(isStressDependent);
+
+    PYLITH_METHOD_END;
+} // testMinMaxwellTimePowerLaw
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _getMinMaxwellTime() without viscoelastic auxiliary subfields.
+void
+pylith::problems::TestTimeDependent::testMinMaxwellTimeElastic(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initializeMesh();
+    const char* shearModulusNames[1] = { "shear_modulus" };
+    _addSubfield("shear_modulus", shearModulusNames, 1);
+    _allocate();
+    const PylithReal shearModulus = 3.0;
+    _setSubfield("shear_modulus", &shearModulus);
+
+    bool isStressDependent = true;
+    const PylithReal maxwellTimeMin = TimeDependentTimeStep::_getMinMaxwellTime(*_auxiliaryField, &isStressDependent);
+    CHECK(PYLITH_MAXSCALAR == maxwellTimeMin);
+    CHECK(!isStressDependent);
+
+    PYLITH_METHOD_END;
+} // testMinMaxwellTimeElastic
+
+
+// ------------------------------------------------------------------------------------------------
+// Test TimeDependentSteadyState accessors.
+void
+pylith::problems::TestTimeDependent::testSteadyStateAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    TimeDependent problem;
+    TimeDependentSteadyState steadyState(problem);
+    CHECK(!steadyState.isEnabled());
+    CHECK(0.0 == steadyState.getSteadyStateRate());
+    CHECK(size_t(5) == steadyState.getSteadyStateWindow());
+
+    steadyState.setSteadyStateRate(1.0e-6);
+    CHECK(steadyState.isEnabled());
+    CHECK(1.0e-6 == steadyState.getSteadyStateRate());
+    CHECK_THROWS_AS(steadyState.setSteadyStateRate(-1.0), std::runtime_error);
+    CHECK(1.0e-6 == steadyState.getSteadyStateRate());
+
+    steadyState.setSteadyStateWindow(3);
+    CHECK(size_t(3) == steadyState.getSteadyStateWindow());
+    CHECK_THROWS_AS(steadyState.setSteadyStateWindow(0), std::runtime_error);
+    CHECK(size_t(3) == steadyState.getSteadyStateWindow());
+
+    const char* names[2] = { "displacement", "fluid_pressure" };
+    steadyState.setSteadyStateSubfields(names, 2);
+    REQUIRE(size_t(2) == steadyState._steadyStateSubfields.size());
+    CHECK(std::string("fluid_pressure") == steadyState._steadyStateSubfields[1]);
+
+    PYLITH_METHOD_END;
+} // testSteadyStateAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test TimeDependentSteadyState::isSteadyState() for entire solution.
+void
+pylith::problems::TestTimeDependent::testSteadyStateSolution(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initializeMesh();
+    const char* dispNames[2] = { "displacement_x", "displacement_y" };
+    _addSubfield("displacement", dispNames, 2);
+    const char* pressureNames[1] = { "fluid_pressure" };
+    _addSubfield("fluid_pressure", pressureNames, 1);
+    _allocate();
+
+    spatialdata::units::Nondimensional normalizer;
+    normalizer.setTimeScale(2.0);
+    TimeDependent problem;
+    problem.setNormalizer(normalizer);
+    problem.setSolution(_auxiliaryField);
+
+    // Relative rate of change is (relative change)/(dt*timeScale).
+    TimeDependentSteadyState steadyState(problem);
+    steadyState.setSteadyStateRate(1.0e-3);
+    steadyState.setSteadyStateWindow(2);
+    const PylithReal dt = 0.5;
+    PetscVec solutionVec = _auxiliaryField->getGlobalVector();
+
+    // First call only stores solution.
+    _setSolution(1.0, 2.0);
+    CHECK(!steadyState.isSteadyState(dt, 0, solutionVec));
+
+    // Relative change of 1.0e-4 for all subfields is below rate.
+    _setSolution(1.0001, 2.0002);
+    CHECK(!steadyState.isSteadyState(dt, 1, solutionVec));
+    CHECK(size_t(1) == steadyState._steadyStateNumSteps);
+
+    // Window of consecutive time steps below rate.
+    _setSolution(1.0001, 2.0002);
+    CHECK(steadyState.isSteadyState(dt, 2, solutionVec));
+
+    // Relative change of 1.0e-2 is above rate and resets count.
+    _setSolution(1.0102, 2.0204);
+    CHECK(!steadyState.isSteadyState(dt, 3, solutionVec));
+    CHECK(size_t(0) == steadyState._steadyStateNumSteps);
+
+    // Longer time step lowers rate for same change.
+    _setSolution(1.0203, 2.0406);
+    CHECK(!steadyState.isSteadyState(100.0*dt, 4, solutionVec));
+    CHECK(size_t(1) == steadyState._steadyStateNumSteps);
+
+    steadyState.reinitialize();
+    CHECK(size_t(0) == steadyState._steadyStateNumSteps);
+
+    PYLITH_METHOD_END;
+} // testSteadyStateSolution
+
+
+// ------------------------------------------------------------------------------------------------
+// Test TimeDependentSteadyState::isSteadyState() for solution subfields.
+void
+pylith::problems::TestTimeDependent::testSteadyStateSubfields(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initializeMesh();
+    const char* dispNames[2] = { "displacement_x", "displacement_y" };
+    _addSubfield("displacement", dispNames, 2);
+    const char* pressureNames[1] = { "fluid_pressure" };
+    _addSubfield("fluid_pressure", pressureNames, 1);
+    _allocate();
+
+    spatialdata::units::Nondimensional normalizer;
+    normalizer.setTimeScale(1.0);
+    TimeDependent problem;
+    problem.setNormalizer(normalizer);
+    problem.setSolution(_auxiliaryField);
+    PetscVec solutionVec = _auxiliaryField->getGlobalVector();
+    const PylithReal dt = 1.0;
+
+    { // Only fluid pressure checked; displacement changes a lot.
+        TimeDependentSteadyState steadyState(problem);
+        steadyState.setSteadyStateRate(1.0e-3);
+        steadyState.setSteadyStateWindow(1);
+        const char* names[1] = { "fluid_pressure" };
+        steadyState.setSteadyStateSubfields(names, 1);
+
+        _setSolution(1.0, 4.0);
+        CHECK(!steadyState.isSteadyState(dt, 0, solutionVec));
+        _setSolution(2.0, 4.0);
+        CHECK(steadyState.isSteadyState(dt, 1, solutionVec));
+    } // Only fluid pressure checked.
+
+    { // Every subfield checked must be below rate; zero subfield does not prevent steady state.
+        TimeDependentSteadyState steadyState(problem);
+        steadyState.setSteadyStateRate(1.0e-3);
+        steadyState.setSteadyStateWindow(1);
+        const char* names[2] = { "displacement", "fluid_pressure" };
+        steadyState.setSteadyStateSubfields(names, 2);
+
+        _setSolution(1.0, 0.0);
+        CHECK(!steadyState.isSteadyState(dt, 0, solutionVec));
+        _setSolution(2.0, 0.0);
+        CHECK(!steadyState.isSteadyState(dt, 1, solutionVec));
+        _setSolution(2.0, 0.0);
+        CHECK(steadyState.isSteadyState(dt, 2, solutionVec));
+        _setSolution(2.0, 1.0e-8);
+        CHECK(!steadyState.isSteadyState(dt, 3, solutionVec));
+    } // Every subfield checked.
+
+    { // Unknown subfield.
+        TimeDependentSteadyState steadyState(problem);
+        steadyState.setSteadyStateRate(1.0e-3);
+        const char* names[1] = { "velocity" };
+        steadyState.setSteadyStateSubfields(names, 1);
+        CHECK_THROWS_AS(steadyState.isSteadyState(dt, 0, solutionVec), std::runtime_error);
+    } // Unknown subfield.
+
+    PYLITH_METHOD_END;
+} // testSteadyStateSubfields
+
+
+// ------------------------------------------------------------------------------------------------
+// Test TimeDependentCheckpoint accessors for load imbalance.
+void
+pylith::problems::TestTimeDependent::testLoadImbalanceAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    TimeDependent problem;
+    TimeDependentCheckpoint checkpoint(problem);
+    CHECK(0.0 == checkpoint.getLoadImbalanceThreshold());
+    CHECK(0.0 == checkpoint.getLoadImbalance());
+    CHECK(!checkpoint.isEnabled());
+
+    checkpoint.setLoadImbalanceThreshold(1.5);
+    CHECK(1.5 == checkpoint.getLoadImbalanceThreshold());
+    CHECK(checkpoint.isEnabled());
+    CHECK(!checkpoint.isRestart());
+
+    CHECK_THROWS_AS(checkpoint.setLoadImbalanceThreshold(0.5), std::runtime_error);
+    CHECK_THROWS_AS(checkpoint.setLoadImbalanceThreshold(-1.0), std::runtime_error);
+    CHECK(1.5 == checkpoint.getLoadImbalanceThreshold());
+
+    checkpoint.setLoadImbalanceThreshold(1.0);
+    CHECK(1.0 == checkpoint.getLoadImbalanceThreshold());
+    checkpoint.setLoadImbalanceThreshold(0.0);
+    CHECK(!checkpoint.isEnabled());
+
+    // TimeDependent forwards to its checkpoint object.
+    problem.setLoadImbalanceThreshold(2.0);
+    CHECK(2.0 == problem.getLoadImbalanceThreshold());
+    CHECK(0.0 == problem.getLoadImbalance());
+    CHECK_THROWS_AS(problem.setLoadImbalanceThreshold(0.9), std::runtime_error);
+
+    PYLITH_METHOD_END;
+} // testLoadImbalanceAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test TimeDependentCheckpoint::_checkLoadBalance().
+void
+pylith::problems::TestTimeDependent::testCheckLoadBalance(void) {
+    PYLITH_METHOD_BEGIN;
+
+    TimeDependent problem;
+    TimeDependentCheckpoint checkpoint(problem);
+    checkpoint.setLoadImbalanceThreshold(1.2);
+
+    PetscVec solutionVec = NULL;
+    PetscErrorCode err = VecCreateSeq(PETSC_COMM_SELF, 4, &solutionVec);PYLITH_CHECK_ERROR(err);
+
+    // Assembly time accumulates over the time step and is reset by the check. With one process the maximum equals
+    // the mean, so the assembly is balanced and no checkpoint is written.
+    checkpoint.addAssemblyTime(0.25);
+    checkpoint.addAssemblyTime(0.5);
+    CHECK(0.75 == checkpoint._assemblyTime);
+    checkpoint._checkLoadBalance(1.0, 0.1, 10, solutionVec);
+    CHECK(1.0 == checkpoint.getLoadImbalance());
+    CHECK(0.0 == checkpoint._assemblyTime);
+    CHECK(!checkpoint._isLoadImbalanced);
+
+    // No assembly in time step is treated as balanced.
+    checkpoint._checkLoadBalance(1.1, 0.1, 11, solutionVec);
+    CHECK(1.0 == checkpoint.getLoadImbalance());
+
+    // Balanced time step rearms the checkpoint after an imbalanced time step.
+    checkpoint._isLoadImbalanced = true;
+    checkpoint.addAssemblyTime(0.5);
+    checkpoint._checkLoadBalance(1.2, 0.1, 12, solutionVec);
+    CHECK(!checkpoint._isLoadImbalanced);
+
+    // reinitialize() resets the state for another run.
+    checkpoint.addAssemblyTime(0.5);
+    checkpoint._isLoadImbalanced = true;
+    checkpoint.reinitialize();
+    CHECK(0.0 == checkpoint._assemblyTime);
+    CHECK(!checkpoint._isLoadImbalanced);
+
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testCheckLoadBalance
+
+
+// ------------------------------------------------------------------------------------------------
+// Test TimeDependentGreensFns accessors.
+void
+pylith::problems::TestTimeDependent::testGreensFnsAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    TimeDependent problem;
+    TimeDependentGreensFns greensFns(problem);
+    CHECK(std::string("") == greensFns.getImpulseFaultLabelName());
+    CHECK(100 == greensFns.getImpulseFaultLabelValue());
+    CHECK(size_t(1) == greensFns.getImpulseBatchSize());
+    CHECK(size_t(0) == greensFns.getResponseRank());
+    CHECK(size_t(0) == greensFns.getNumImpulses());
+    CHECK(!greensFns.isEnabled());
+    greensFns.verifyConfiguration();
+
+    greensFns.setImpulseFault("fault", 200);
+    CHECK(std::string("fault") == greensFns.getImpulseFaultLabelName());
+    CHECK(200 == greensFns.getImpulseFaultLabelValue());
+    CHECK(greensFns.isEnabled());
+
+    greensFns.setImpulseBatchSize(4);
+    CHECK(size_t(4) == greensFns.getImpulseBatchSize());
+    CHECK_THROWS_AS(greensFns.setImpulseBatchSize(0), std::runtime_error);
+    CHECK(size_t(4) == greensFns.getImpulseBatchSize());
+
+    greensFns.setResponseRank(3);
+    CHECK(size_t(3) == greensFns.getResponseRank());
+
+    spatialdata::spatialdb::UniformDB db;
+    spatialdata::spatialdb::TimeHistory th;
+    greensFns.addSlipHistory(&db, &th);
+    CHECK(size_t(1) == greensFns._slipDBs.size());
+    CHECK(size_t(1) == greensFns._slipTimeHistories.size());
+    CHECK_THROWS_AS(greensFns.addSlipHistory(NULL, &th), std::runtime_error);
+    CHECK_THROWS_AS(greensFns.addSlipHistory(&db, NULL), std::runtime_error);
+
+    // Problem without fault with impulses.
+    CHECK_THROWS_AS(greensFns.verifyConfiguration(), std::runtime_error);
+
+    greensFns.setImpulseFault("", 100);
+    CHECK(!greensFns.isEnabled());
+
+    // TimeDependent forwards to its Green's functions object.
+    problem.setImpulseFault("fault", 200);
+    problem.setImpulseBatchSize(2);
+    problem.setResponseRank(5);
+    problem.addSlipHistory(&db, &th);
+    REQUIRE(problem._greensFns);
+    CHECK(problem._greensFns->isEnabled());
+    CHECK(size_t(2) == problem._greensFns->getImpulseBatchSize());
+    CHECK(size_t(5) == problem._greensFns->getResponseRank());
+    CHECK(size_t(1) == problem._greensFns->_slipDBs.size());
+    CHECK(size_t(0) == problem.getNumImpulses());
+    CHECK_THROWS_AS(problem.setImpulseBatchSize(0), std::runtime_error);
+
+    PYLITH_METHOD_END;
+} // testGreensFnsAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test TimeDependentGreensFns::_computeSlipIncrements().
+void
+pylith::problems::TestTimeDependent::testSlipIncrements(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Amplitude ramps from 0 at t=0 to 5 at t=10 and is constant afterwards.
+    spatialdata::spatialdb::TimeHistory th;
+    th.setFilename("data/slip_history.timedb");
+
+    const PylithReal timeScale = 2.5;
+    const PylithReal dt = 2.0;
+    const size_t numSteps = 3;
+    const PylithReal tolerance = 1.0e-12;
+
+    pylith::scalar_array increments;
+    TimeDependentGreensFns::_computeSlipIncrements(&increments, &th, 0.0, dt, numSteps, timeScale);
+    REQUIRE(numSteps == increments.size());
+    const PylithReal incrementsE[3] = { 2.5, 2.5, 0.0 };
+    for (size_t i = 0; i < numSteps; ++i) {
+        CHECK_THAT(increments[i], Catch::Matchers::WithinAbs(incrementsE[i], tolerance));
+    } // for
+
+    // Slip before the first time step is zero, so the first increment is the full amplitude.
+    TimeDependentGreensFns::_computeSlipIncrements(&increments, &th, 2.0, dt, numSteps, timeScale);
+    REQUIRE(numSteps == increments.size());
+    const PylithReal incrementsStartE[3] = { 5.0, 0.0, 0.0 };
+    for (size_t i = 0; i < numSteps; ++i) {
+        CHECK_THAT(increments[i], Catch::Matchers::WithinAbs(incrementsStartE[i], tolerance));
+    } // for
+
+    PYLITH_METHOD_END;
+} // testSlipIncrements
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh.
+void
+pylith::problems::TestTimeDependent::_initializeMesh(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;assert(_mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_mesh->getDimension());
+    _mesh->setCoordSys(&cs);
+
+    delete _auxiliaryField;_auxiliaryField = new pylith::topology::Field(*_mesh);assert(_auxiliaryField);
+    _auxiliaryField->setLabel("auxiliary field");
+
+    PYLITH_METHOD_END;
+} // _initializeMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Add subfield to auxiliary field.
+void
+pylith::problems::TestTimeDependent::_addSubfield(const char* name,
+                                                  const char* componentNames[],
+                                                  const size_t numComponents) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(_auxiliaryField);
+
+    pylith::string_vector names(numComponents);
+    for (size_t i = 0; i < numComponents; ++i) {
+        names[i] = componentNames[i];
+    } // for
+    const pylith::topology::Field::VectorFieldEnum fieldType = (1 == numComponents) ?
+                                                               pylith::topology::Field::SCALAR :
+                                                               pylith::topology::Field::OTHER;
+    pylith::topology::Field::Description description(name, name, names, numComponents, fieldType);
+    pylith::topology::Field::Discretization discretization(0, 1, _mesh->getDimension());
+    _auxiliaryField->subfieldAdd(description, discretization);
+
+    PYLITH_METHOD_END;
+} // _addSubfield
+
+
+// ------------------------------------------------------------------------------------------------
+// Setup and allocate auxiliary field.
+void
+pylith::problems::TestTimeDependent::_allocate(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_auxiliaryField);
+
+    _auxiliaryField->subfieldsSetup();
+    _auxiliaryField->createDiscretization();
+    _auxiliaryField->allocate();
+    _auxiliaryField->zeroLocal();
+
+    PYLITH_METHOD_END;
+} // _allocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set values of subfield uniformly over domain.
+void
+pylith::problems::TestTimeDependent::_setSubfield(const char* name,
+                                                  const PylithReal* values) {
+    PYLITH_METHOD_BEGIN;
+    assert(_auxiliaryField);
+
+    const size_t numComponents = _auxiliaryField->getSubfieldInfo(name).description.numComponents;
+    PetscSection auxiliarySection = _auxiliaryField->getLocalSection();assert(auxiliarySection);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(auxiliarySection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    pylith::topology::VecVisitorMesh auxiliaryVisitor(*_auxiliaryField, name);
+    PylithScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt off = auxiliaryVisitor.sectionOffset(point);
+        const PetscInt dof = auxiliaryVisitor.sectionDof(point);
+        for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+            auxiliaryArray[off+iDof] = values[iDof % numComponents];
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setSubfield
+
+
+// ------------------------------------------------------------------------------------------------
+// Set solution for steady state check with uniform subfields displacement and fluid_pressure.
+void
+pylith::problems::TestTimeDependent::_setSolution(const PylithReal displacement,
+                                                  const PylithReal pressure) {
+    PYLITH_METHOD_BEGIN;
+    assert(_auxiliaryField);
+
+    const PylithReal dispValues[2] = { displacement, -displacement };
+    _setSubfield("displacement", dispValues);
+    _setSubfield("fluid_pressure", &pressure);
+    _auxiliaryField->scatterLocalToVector(_auxiliaryField->getGlobalVector());
+
+    PYLITH_METHOD_END;
+} // _setSolution
+
+
+// End of file
@@ -138,6 +138,53 @@ pylith::topology::TestFieldMesh::testCopyConstructor(void) {
 } // testCopyConstructor
 
 
+// ------------------------------------------------------------------------------------------------
+// Test constructor for field sharing layout.
+void
+pylith::topology::TestFieldMesh::testSharedLayoutConstructor(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+
+    PetscErrorCode err = 0;
+
+    const std::string& label = "field A";
+    Field field(*_field, label.c_str());
+
+    // DM and section are shared, so the name of the DM is unchanged.
+    CHECK(_field->getDM() == field.getDM());
+    CHECK(_field->getLocalSection() == field.getLocalSection());
+    CHECK(label == std::string(field.getLabel()));
+
+    const char *name = NULL;
+    err = PetscObjectGetName((PetscObject)field.getDM(), &name);assert(!err);
+    CHECK(std::string(_field->getLabel()) == std::string(name));
+
+    PetscVec vec = field.getLocalVector();assert(vec);
+    CHECK(vec != _field->getLocalVector());
+    err = PetscObjectGetName((PetscObject) vec, &name);assert(!err);
+    CHECK(label == std::string(name));
+
+    PetscInt vecSize = 0;
+    err = VecGetSize(vec, &vecSize);assert(!err);
+    CHECK(_field->getStorageSize() == vecSize);
+
+    // Global vector is created on first access.
+    PetscVec globalVec = field.getGlobalVector();
+    REQUIRE(globalVec);
+    CHECK(globalVec == field.getGlobalVector());
+    err = PetscObjectGetName((PetscObject) globalVec, &name);assert(!err);
+    CHECK(label == std::string(name));
+
+    field.deallocate();
+
+    // Source field remains valid after the shared field is destroyed.
+    CHECK(_field->getDM());
+    CHECK(_field->getLocalSection());
+
+    PYLITH_METHOD_END;
+} // testSharedLayoutConstructor
+
+
 // ------------------------------------------------------------------------------------------------
 // Test mesh().
 void
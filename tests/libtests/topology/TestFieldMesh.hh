@@ -56,6 +56,9 @@ public:
     /// Test copy constructor.
     void testCopyConstructor(void);
 
+    /// Test constructor for field sharing layout.
+    void testSharedLayoutConstructor(void);
+
     /// Test mesh().
     void testMesh(void);
 
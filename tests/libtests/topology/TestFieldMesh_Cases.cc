@@ -44,6 +44,9 @@ TEST_CASE("TestFieldMesh::Quad::testConstructor", "[TestFieldMesh][Quad][testCon
 TEST_CASE("TestFieldMesh::Quad::testCopyConstructor", "[TestFieldMesh][Quad][testCopyConstructor]") {
     pylith::topology::TestFieldMesh(pylith::topology::TestFieldMesh_Cases::Quad()).testCopyConstructor();
 }
+TEST_CASE("TestFieldMesh::Quad::testSharedLayoutConstructor", "[TestFieldMesh][Quad][testSharedLayoutConstructor]") {
+    pylith::topology::TestFieldMesh(pylith::topology::TestFieldMesh_Cases::Quad()).testSharedLayoutConstructor();
+}
 TEST_CASE("TestFieldMesh::Quad::testMesh", "[TestFieldMesh][Quad][testMesh]") {
     pylith::topology::TestFieldMesh(pylith::topology::TestFieldMesh_Cases::Quad()).testMesh();
 }
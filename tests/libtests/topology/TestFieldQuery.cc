@@ -50,6 +50,24 @@ namespace pylith {
             }
 
 
+            int
+            converterCode(PylithScalar valueSubfield[],
+                          const PylithInt numComponents,
+                          const double dbValues[],
+                          const PylithInt dbIndices[]) {
+                return 1;
+            }
+
+
+            std::string
+            converterMsg(const int code,
+                         const PylithInt numComponents,
+                         const double dbValues[],
+                         const PylithInt dbIndices[]) {
+                return std::string("Hello");
+            }
+
+
         } // _TestFieldQuery
     } // topology
 } // pylith
@@ -171,6 +189,26 @@ pylith::topology::TestFieldQuery::testSetQuery(void) {
         CHECK((spatialdata::spatialdb::SpatialDB*)NULL == info.db);
     }
 
+    { // Test with spatial database values and converter functions with error codes.
+        const char* subfieldName = "ij";
+        const size_t numDBValues = 2;
+        const char* dbValues[numDBValues] = { "one", "two" };
+        const pylith::topology::FieldQuery::Converter converter(&_TestFieldQuery::converterCode, NULL,
+                                                                &_TestFieldQuery::converterMsg);
+        _query->setQuery(subfieldName, dbValues, numDBValues, converter);
+
+        const pylith::topology::FieldQuery::SubfieldQuery& info = _query->_subfieldQueries[subfieldName];
+        REQUIRE(numDBValues == info.queryValues.size());
+        for (size_t i = 0; i < numDBValues; ++i) {
+            CHECK(std::string(dbValues[i]) == info.queryValues[i]);
+        } // for
+        CHECK(pylith::topology::FieldQuery::convertfn_type(NULL) == info.converter);
+        CHECK(&_TestFieldQuery::converterCode == info.converterFns.point);
+        CHECK(pylith::topology::FieldQuery::convertarrayfn_type(NULL) == info.converterFns.array);
+        CHECK(&_TestFieldQuery::converterMsg == info.converterFns.message);
+        CHECK((spatialdata::spatialdb::SpatialDB*)NULL == info.db);
+    }
+
     { // Test with defaults.
         const char* subfieldName = "displacement";
         const size_t numDBValuesE = 2;
@@ -233,22 +271,86 @@ pylith::topology::TestFieldQuery::testQuery(void) {
     // _field->view("FIELD"); // :DEBUG:
 
     // Compute difference with respect to direct queries to database.
-    // Unfortunately, this also uses a FieldQuery object.
-    PylithReal norm = 0.0;
-    const PylithReal t = 0.0;
-    pylith::topology::FieldQuery query(*_field);
-    query.initializeWithDefaultQueries();
-    query.openDB(_data->auxDB, _data->normalizer->getLengthScale());
-    PetscErrorCode err = DMPlexComputeL2DiffLocal(_field->getDM(), t, query._functions, (void**)query._contextPtrs,
-                                                  _field->getLocalVector(), &norm);REQUIRE(!err);
-    query.closeDB(_data->auxDB);
     const PylithReal tolerance = 1.0e-6;
-    CHECK_THAT(norm, Catch::Matchers::WithinAbs(0.0, tolerance));
+    CHECK_THAT(_computeDiffNorm(), Catch::Matchers::WithinAbs(0.0, tolerance));
 
     PYLITH_METHOD_END;
 } // testQuery
 
 
+// ----------------------------------------------------------------------
+// Test repeated batch queries with queryDB().
+void
+pylith::topology::TestFieldQuery::testQueryRepeat(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_query);
+    assert(_field);
+    assert(_data);
+    assert(_data->normalizer);
+
+    _query->initializeWithDefaultQueries();
+
+    _query->openDB(_data->auxDB, _data->normalizer->getLengthScale());
+    for (int iQuery = 0; iQuery < 2; ++iQuery) {
+        PetscErrorCode err = VecSet(_field->getLocalVector(), FILL_VALUE);REQUIRE(!err);
+        _query->queryDB();
+
+        // Batch buffers are released after each query.
+        const size_t numSubfields = _field->getSubfieldNames().size();
+        for (size_t i = 0; i < numSubfields; ++i) {
+            INFO("Query " << iQuery << ", subfield " << i);
+            const pylith::topology::FieldQuery::DBQueryContext& context = _query->_contexts[i];
+            CHECK(context.batchCoordinates.empty());
+            CHECK(context.batchValues.empty());
+            CHECK(context.batchErrors.empty());
+            CHECK(size_t(0) == context.batchCursor);
+        } // for
+    } // for
+    _query->closeDB(_data->auxDB);
+
+    // Compute difference with respect to direct queries to database.
+    const PylithReal tolerance = 1.0e-6;
+    CHECK_THAT(_computeDiffNorm(), Catch::Matchers::WithinAbs(0.0, tolerance));
+
+    PYLITH_METHOD_END;
+} // testQueryRepeat
+
+
+// ----------------------------------------------------------------------
+// Test queryDBLabel().
+void
+pylith::topology::TestFieldQuery::testQueryLabel(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_query);
+    assert(_field);
+    assert(_data);
+    assert(_data->normalizer);
+
+    // Label all cells, so that the query over the label covers the entire domain.
+    const char* labelName = "material-id";
+    const PylithInt labelValue = 3;
+    PetscDM dmField = _field->getDM();
+    PetscErrorCode err = DMCreateLabel(dmField, labelName);REQUIRE(!err);
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmField, 0, &cStart, &cEnd);REQUIRE(!err);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        err = DMSetLabelValue(dmField, labelName, cell, labelValue);REQUIRE(!err);
+    } // for
+
+    _query->initializeWithDefaultQueries();
+
+    _query->openDB(_data->auxDB, _data->normalizer->getLengthScale());
+    _query->queryDBLabel(labelName, labelValue);
+    _query->closeDB(_data->auxDB);
+
+    // Compute difference with respect to direct queries to database.
+    const PylithReal tolerance = 1.0e-6;
+    CHECK_THAT(_computeDiffNorm(), Catch::Matchers::WithinAbs(0.0, tolerance));
+
+    PYLITH_METHOD_END;
+} // testQueryLabel
+
+
 // ----------------------------------------------------------------------
 // Test queryDB() with NULL database.
 void
@@ -360,6 +462,29 @@ pylith::topology::TestFieldQuery::_initialize(void) {
 } // _initialize
 
 
+// ----------------------------------------------------------------------
+// Compute norm of difference between field and direct queries of spatial database at individual points.
+PylithReal
+pylith::topology::TestFieldQuery::_computeDiffNorm(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+    assert(_data);
+    assert(_data->normalizer);
+
+    // Unfortunately, this also uses a FieldQuery object.
+    PylithReal norm = 0.0;
+    const PylithReal t = 0.0;
+    pylith::topology::FieldQuery query(*_field);
+    query.initializeWithDefaultQueries();
+    query.openDB(_data->auxDB, _data->normalizer->getLengthScale());
+    PetscErrorCode err = DMPlexComputeL2DiffLocal(_field->getDM(), t, query._functions, (void**)query._contextPtrs,
+                                                  _field->getLocalVector(), &norm);REQUIRE(!err);
+    query.closeDB(_data->auxDB);
+
+    PYLITH_METHOD_RETURN(norm);
+} // _computeDiffNorm
+
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::topology::TestFieldQuery_Data::TestFieldQuery_Data(void) :
@@ -68,6 +68,12 @@ public:
     /// Test queryDB() with NULL database.
     void testQueryNull(void);
 
+    /// Test repeated batch queries with queryDB().
+    void testQueryRepeat(void);
+
+    /// Test queryDBLabel().
+    void testQueryLabel(void);
+
     /// Test validatorPositive().
     void testValidatorPositive(void);
 
@@ -80,6 +86,12 @@ private:
     /// Initialize mesh and test field.
     void _initialize(void);
 
+    /** Compute norm of difference between field and direct queries of spatial database at individual points.
+     *
+     * @returns L2 norm of difference.
+     */
+    PylithReal _computeDiffNorm(void);
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
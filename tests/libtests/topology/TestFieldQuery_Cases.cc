@@ -117,6 +117,12 @@ TEST_CASE("TestFieldQuery::Quad::testQuery", "[TestFieldQuery][Tri][testQuery]")
 TEST_CASE("TestFieldQuery::Quad::testQueryNull", "[TestFieldQuery][Tri][testQueryNull]") {
     pylith::topology::TestFieldQuery(pylith::topology::TestFieldQuery_Cases::Tri()).testQueryNull();
 }
+TEST_CASE("TestFieldQuery::Quad::testQueryRepeat", "[TestFieldQuery][Tri][testQueryRepeat]") {
+    pylith::topology::TestFieldQuery(pylith::topology::TestFieldQuery_Cases::Tri()).testQueryRepeat();
+}
+TEST_CASE("TestFieldQuery::Quad::testQueryLabel", "[TestFieldQuery][Tri][testQueryLabel]") {
+    pylith::topology::TestFieldQuery(pylith::topology::TestFieldQuery_Cases::Tri()).testQueryLabel();
+}
 TEST_CASE("TestFieldQuery::Quad::testValidatorPositive", "[TestFieldQuery][Tri][testValidatorPositive]") {
     pylith::topology::TestFieldQuery(pylith::topology::TestFieldQuery_Cases::Tri()).testValidatorPositive();
 }
@@ -26,6 +26,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "tests/src/FaultCohesiveStub.hh" // USES FaultCohesiveStub
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -55,6 +56,10 @@ public:
     static
     void testCheckTopology(void);
 
+    /// Test checkDistributedTopology().
+    static
+    void testCheckDistributedTopology(void);
+
     /// Test isSimplexMesh().
     static
     void testIsSimplexMesh(void);
@@ -63,6 +68,10 @@ public:
     static
     void testCheckMaterialIds(void);
 
+    /// Test savePrepared() and loadPrepared().
+    static
+    void testPrepared(void);
+
 }; // class TestMeshOps
 
 // ------------------------------------------------------------------------------------------------
@@ -72,12 +81,18 @@ TEST_CASE("TestMeshOps::testNondimensionalize", "[TestMeshOps]") {
 TEST_CASE("TestMeshOps::testCheckTopology", "[TestMeshOps]") {
     pylith::topology::TestMeshOps().testCheckTopology();
 }
+TEST_CASE("TestMeshOps::testCheckDistributedTopology", "[TestMeshOps]") {
+    pylith::topology::TestMeshOps().testCheckDistributedTopology();
+}
 TEST_CASE("TestMeshOps::testIsSimplexMesh", "[TestMeshOps]") {
     pylith::topology::TestMeshOps().testIsSimplexMesh();
 }
 TEST_CASE("TestMeshOps::testCheckMaterialIds", "[TestMeshOps]") {
     pylith::topology::TestMeshOps().testCheckMaterialIds();
 }
+TEST_CASE("TestMeshOps::testPrepared", "[TestMeshOps]") {
+    pylith::topology::TestMeshOps().testPrepared();
+}
 
 // ------------------------------------------------------------------------------------------------
 // Test nondimensionalize().
@@ -159,6 +174,48 @@ pylith::topology::TestMeshOps::testCheckTopology(void) {
 } // testCheckTopology
 
 
+// ------------------------------------------------------------------------------------------------
+// Test checkDistributedTopology().
+void
+pylith::topology::TestMeshOps::testCheckDistributedTopology(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int numFiles = 4;
+    const char* filenames[numFiles] = {
+        "data/tri3.mesh",
+        "data/fourquad4.mesh",
+        "data/twotet4.mesh",
+        "data/twohex8.mesh",
+    };
+
+    for (int i = 0; i < numFiles; ++i) {
+        const char* filename = filenames[i];
+        Mesh mesh;
+        meshio::MeshIOAscii iohandler;
+        iohandler.setFilename(filename);
+        iohandler.read(&mesh);
+        MeshOps::checkDistributedTopology(mesh);
+    } // for
+
+    { // Cell without material id.
+        Mesh mesh;
+        meshio::MeshIOAscii iohandler;
+        iohandler.setFilename("data/fourquad4.mesh");
+        iohandler.read(&mesh);
+
+        PetscDMLabel materialsLabel = NULL;
+        PetscInt matId = -1;
+        PetscErrorCode err;
+        err = DMGetLabel(mesh.getDM(), pylith::topology::Mesh::cells_label_name, &materialsLabel);PYLITH_CHECK_ERROR(err);
+        err = DMLabelGetValue(materialsLabel, 0, &matId);PYLITH_CHECK_ERROR(err);
+        err = DMLabelClearValue(materialsLabel, 0, matId);PYLITH_CHECK_ERROR(err);
+        REQUIRE_THROWS_AS(MeshOps::checkDistributedTopology(mesh), std::runtime_error);
+    } // Cell without material id.
+
+    PYLITH_METHOD_END;
+} // testCheckDistributedTopology
+
+
 // ------------------------------------------------------------------------------------------------
 // Test isSimplexMesh().
 void
@@ -213,4 +270,91 @@ pylith::topology::TestMeshOps::testCheckMaterialIds(void) {
 } // testCheckMaterialIds
 
 
+// ------------------------------------------------------------------------------------------------
+// Test savePrepared() and loadPrepared().
+void
+pylith::topology::TestMeshOps::testPrepared(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const char* filename = "mesh_prepared.h5";
+
+    Mesh mesh;
+    meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/fourquad4.mesh");
+    iohandler.read(&mesh);
+
+    pylith::faults::FaultCohesiveStub fault;
+    fault.setCohesiveLabelValue(100);
+    fault.setSurfaceLabelName("fault");
+    fault.adjustTopology(&mesh);
+
+    MeshOps::savePrepared(mesh, filename, "key-a");
+
+    { // Miss: file does not exist.
+        Mesh meshLoad(mesh.getDimension());
+        CHECK_FALSE(MeshOps::loadPrepared(&meshLoad, "mesh_prepared_none.h5", "key-a"));
+    } // Miss: file does not exist.
+
+    { // Miss: key does not match.
+        Mesh meshLoad(mesh.getDimension());
+        CHECK_FALSE(MeshOps::loadPrepared(&meshLoad, filename, "key-b"));
+    } // Miss: key does not match.
+
+    { // Hit: mesh must match saved mesh, including cohesive cells.
+        Mesh meshLoad(mesh.getDimension());
+        REQUIRE(MeshOps::loadPrepared(&meshLoad, filename, "key-a"));
+
+        CHECK(MeshOps::getNumVertices(mesh) == MeshOps::getNumVertices(meshLoad));
+        CHECK(MeshOps::getNumCells(mesh) == MeshOps::getNumCells(meshLoad));
+
+        PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+        PetscDM dmLoad = meshLoad.getDM();assert(dmLoad);
+        PetscErrorCode err = PETSC_SUCCESS;
+        const int numLabels = 2;
+        const char* labelNames[numLabels] = { pylith::topology::Mesh::cells_label_name, "fault" };
+        for (int iLabel = 0; iLabel < numLabels; ++iLabel) {
+            PetscBool hasLabel = PETSC_FALSE;
+            err = DMHasLabel(dmLoad, labelNames[iLabel], &hasLabel);PYLITH_CHECK_ERROR(err);
+            INFO("Checking label '" << labelNames[iLabel] << "'.");
+            REQUIRE(hasLabel);
+            PetscInt numValues = 0, numValuesE = 0;
+            err = DMGetLabelSize(dmMesh, labelNames[iLabel], &numValuesE);PYLITH_CHECK_ERROR(err);
+            err = DMGetLabelSize(dmLoad, labelNames[iLabel], &numValues);PYLITH_CHECK_ERROR(err);
+            CHECK(numValuesE == numValues);
+        } // for
+        const PetscInt matIds[3] = { 1, 2, 100 };
+        for (int i = 0; i < 3; ++i) {
+            PetscInt numCells = 0, numCellsE = 0;
+            err = DMGetStratumSize(dmMesh, pylith::topology::Mesh::cells_label_name, matIds[i], &numCellsE);PYLITH_CHECK_ERROR(err);
+            err = DMGetStratumSize(dmLoad, pylith::topology::Mesh::cells_label_name, matIds[i], &numCells);PYLITH_CHECK_ERROR(err);
+            INFO("Checking number of cells with material id " << matIds[i] << ".");
+            CHECK(numCellsE == numCells);
+        } // for
+
+        // Coordinates of vertices must match (in any order).
+        PetscVec coordsVec = NULL, coordsLoadVec = NULL;
+        PylithReal norm = 0.0, normLoad = 0.0, sum = 0.0, sumLoad = 0.0;
+        err = DMGetCoordinatesLocal(dmMesh, &coordsVec);PYLITH_CHECK_ERROR(err);
+        err = DMGetCoordinatesLocal(dmLoad, &coordsLoadVec);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(coordsVec, NORM_2, &norm);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(coordsLoadVec, NORM_2, &normLoad);PYLITH_CHECK_ERROR(err);
+        err = VecSum(coordsVec, &sum);PYLITH_CHECK_ERROR(err);
+        err = VecSum(coordsLoadVec, &sumLoad);PYLITH_CHECK_ERROR(err);
+        const PylithReal tolerance = 1.0e-12;
+        CHECK_THAT(normLoad, Catch::Matchers::WithinAbs(norm, tolerance));
+        CHECK_THAT(sumLoad, Catch::Matchers::WithinAbs(sum, tolerance));
+    } // Hit: mesh must match saved mesh, including cohesive cells.
+
+    { // Miss: cache overwritten with new key.
+        MeshOps::savePrepared(mesh, filename, "key-b");
+        Mesh meshLoad(mesh.getDimension());
+        CHECK_FALSE(MeshOps::loadPrepared(&meshLoad, filename, "key-a"));
+        Mesh meshLoadB(mesh.getDimension());
+        CHECK(MeshOps::loadPrepared(&meshLoadB, filename, "key-b"));
+    } // Miss: cache overwritten with new key.
+
+    PYLITH_METHOD_END;
+} // testPrepared
+
+
 // End of file
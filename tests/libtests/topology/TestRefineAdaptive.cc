@@ -0,0 +1,201 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/topology/RefineAdaptive.hh" // USES RefineAdaptive
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include <stdexcept> // USES std::runtime_error
+
+#include "catch2/catch_test_macros.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class TestRefineAdaptive;
+    } // topology
+} // pylith
+
+class pylith::topology::TestRefineAdaptive : public pylith::utils::GenericComponent {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test setLabel().
+    static
+    void testSetLabel(void);
+
+    /// Test refine() with invalid label or mesh.
+    static
+    void testRefineErrors(void);
+
+    /// Test refine() near a group of vertices.
+    static
+    void testRefine(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Get number of cells in mesh, checking each cell has a material id.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @returns Number of cells.
+     */
+    static
+    PetscInt _getNumCells(const Mesh& mesh);
+
+}; // class TestRefineAdaptive
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestRefineAdaptive::testSetLabel", "[TestRefineAdaptive]") {
+    pylith::topology::TestRefineAdaptive::testSetLabel();
+}
+TEST_CASE("TestRefineAdaptive::testRefineErrors", "[TestRefineAdaptive]") {
+    pylith::topology::TestRefineAdaptive::testRefineErrors();
+}
+TEST_CASE("TestRefineAdaptive::testRefine", "[TestRefineAdaptive]") {
+    pylith::topology::TestRefineAdaptive::testRefine();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setLabel().
+void
+pylith::topology::TestRefineAdaptive::testSetLabel(void) {
+    PYLITH_METHOD_BEGIN;
+
+    RefineAdaptive refiner;
+    CHECK(std::string("") == refiner._labelName);
+    CHECK(1 == refiner._labelValue);
+
+    refiner.setLabel("fault", 3);
+    CHECK(std::string("fault") == refiner._labelName);
+    CHECK(3 == refiner._labelValue);
+
+    PYLITH_METHOD_END;
+} // testSetLabel
+
+
+// ------------------------------------------------------------------------------------------------
+// Test refine() with invalid label or mesh.
+void
+pylith::topology::TestRefineAdaptive::testRefineErrors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Mesh meshTri;
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/fourtri3.mesh");
+    iohandler.read(&meshTri);
+
+    RefineAdaptive refiner;
+    Mesh newMesh;
+
+    // Zero levels leaves the refined mesh untouched.
+    refiner.refine(&newMesh, meshTri, 0);
+    CHECK(!newMesh.getDM());
+
+    // Label not set.
+    CHECK_THROWS_AS(refiner.refine(&newMesh, meshTri, 1), std::runtime_error);
+
+    // Label not in mesh.
+    refiner.setLabel("unknown", 1);
+    CHECK_THROWS_AS(refiner.refine(&newMesh, meshTri, 1), std::runtime_error);
+
+    // Mesh without simplex cells.
+    Mesh meshQuad;
+    iohandler.setFilename("data/fourquad4.mesh");
+    iohandler.read(&meshQuad);
+    refiner.setLabel("edge 2", 1);
+    CHECK_THROWS_AS(refiner.refine(&newMesh, meshQuad, 1), std::runtime_error);
+
+    PYLITH_METHOD_END;
+} // testRefineErrors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test refine() near a group of vertices.
+void
+pylith::topology::TestRefineAdaptive::testRefine(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Mesh mesh;
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/fourtri3.mesh");
+    iohandler.read(&mesh);
+    const PetscInt numCellsOrig = _getNumCells(mesh);
+    REQUIRE(4 == numCellsOrig);
+
+    // Vertices in 'edge 2' touch three of the four cells. Uniform refinement would split each triangle into four, so
+    // local refinement must produce more cells than the original mesh but fewer than uniform refinement.
+    RefineAdaptive refiner;
+    refiner.setLabel("edge 2", 1);
+
+    Mesh meshOne;
+    refiner.refine(&meshOne, mesh, 1);
+    CHECK(mesh.getDimension() == meshOne.getDimension());
+    const PetscInt numCellsOne = _getNumCells(meshOne);
+    CHECK(numCellsOne > numCellsOrig);
+    CHECK(numCellsOne < 4*numCellsOrig);
+
+    // Refined mesh keeps the label, so a second level refines further near the same feature.
+    PetscBool hasLabel = PETSC_FALSE;
+    PetscErrorCode err = DMHasLabel(meshOne.getDM(), "edge 2", &hasLabel);PYLITH_CHECK_ERROR(err);
+    CHECK(hasLabel);
+
+    Mesh meshTwo;
+    refiner.refine(&meshTwo, mesh, 2);
+    const PetscInt numCellsTwo = _getNumCells(meshTwo);
+    CHECK(numCellsTwo > numCellsOne);
+    CHECK(numCellsTwo < 16*numCellsOrig);
+
+    // Original mesh is not modified.
+    CHECK(numCellsOrig == _getNumCells(mesh));
+
+    PYLITH_METHOD_END;
+} // testRefine
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of cells in mesh, checking each cell has a material id.
+PetscInt
+pylith::topology::TestRefineAdaptive::_getNumCells(const Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+
+    PetscErrorCode err = 0;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscInt matId = -1;
+        err = DMGetLabelValue(dmMesh, pylith::topology::Mesh::cells_label_name, c, &matId);PYLITH_CHECK_ERROR(err);
+        INFO("Checking material id of cell " << c << ".");
+        CHECK(((1 == matId) || (2 == matId)));
+    } // for
+
+    PYLITH_METHOD_RETURN(cellsStratum.size());
+} // _getNumCells
+
+
+// End of file
@@ -24,16 +24,20 @@
 #include "tests/src/FaultCohesiveStub.hh" // USES FaultCohesiveStub
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 
 #include "pylith/utils/array.hh" // USES int_array
 
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
 #include <strings.h> // USES strcasecmp()
 #include <stdexcept> // USES std::logic_error
 
 #include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
 
 // ------------------------------------------------------------------------------------------------
 // Setup testing data.
@@ -193,6 +197,89 @@ pylith::topology::TestRefineUniform::testRefine(void) {
 } // testRefine
 
 
+// ------------------------------------------------------------------------------------------------
+// Test refine() keeping coarse meshes for geometric multigrid.
+void
+pylith::topology::TestRefineUniform::testKeepCoarseLevels(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_data);
+
+    Mesh mesh(_data->cellDim);
+    _initializeMesh(&mesh);
+    PetscErrorCode err = 0;
+
+    { // Coarse meshes are not kept by default.
+        RefineUniform refiner;
+        CHECK(!refiner._keepCoarseLevels);
+        Mesh newMesh(_data->cellDim);
+        refiner.refine(&newMesh, mesh, 1);
+        PetscDM dmCoarse = NULL;
+        err = DMGetCoarseDM(newMesh.getDM(), &dmCoarse);REQUIRE(!err);
+        CHECK(!dmCoarse);
+    } // Default
+
+    // Two levels of refinement give a hierarchy of three meshes, with the original mesh as the coarsest one.
+    RefineUniform refiner;
+    refiner.setKeepCoarseLevels(true);
+    CHECK(refiner._keepCoarseLevels);
+    Mesh newMesh(_data->cellDim);
+    refiner.refine(&newMesh, mesh, 2);
+
+    PetscDM dmLevels[3] = { NULL, NULL, newMesh.getDM() };
+    err = DMGetCoarseDM(dmLevels[2], &dmLevels[1]);REQUIRE(!err);
+    REQUIRE(dmLevels[1]);
+    err = DMGetCoarseDM(dmLevels[1], &dmLevels[0]);REQUIRE(!err);
+    CHECK(mesh.getDM() == dmLevels[0]);
+    PetscDM dmCoarsest = NULL;
+    err = DMGetCoarseDM(dmLevels[0], &dmCoarsest);REQUIRE(!err);
+    CHECK(!dmCoarsest);
+
+    PetscInt numCellsPrev = 0;
+    for (int iLevel = 0; iLevel < 3; ++iLevel) {
+        INFO("Level " << iLevel);
+        pylith::topology::Stratum cellsStratum(dmLevels[iLevel], topology::Stratum::HEIGHT, 0);
+        CHECK(cellsStratum.size() > numCellsPrev);
+        numCellsPrev = cellsStratum.size();
+    } // for
+
+    // Nondimensionalizing the fine mesh also nondimensionalizes the coarse meshes.
+    PetscVec coordVec = NULL;
+    err = DMGetCoordinatesLocal(dmLevels[1], &coordVec);REQUIRE(!err);
+    REQUIRE(coordVec);
+    PetscInt coordSize = 0;
+    err = VecGetLocalSize(coordVec, &coordSize);REQUIRE(!err);
+    pylith::scalar_array coordsOrig(coordSize);
+    const PetscScalar* coordsArray = NULL;
+    err = VecGetArrayRead(coordVec, &coordsArray);REQUIRE(!err);
+    for (PetscInt i = 0; i < coordSize; ++i) {
+        coordsOrig[i] = coordsArray[i];
+    } // for
+    err = VecRestoreArrayRead(coordVec, &coordsArray);REQUIRE(!err);
+
+    const PylithReal lengthScale = 10.0;
+    spatialdata::units::Nondimensional normalizer;
+    normalizer.setLengthScale(lengthScale);
+    pylith::topology::MeshOps::nondimensionalize(&newMesh, normalizer);
+
+    for (int iLevel = 0; iLevel < 3; ++iLevel) {
+        INFO("Level " << iLevel);
+        PetscReal scale = 0.0;
+        err = DMPlexGetScale(dmLevels[iLevel], PETSC_UNIT_LENGTH, &scale);REQUIRE(!err);
+        CHECK_THAT(scale, Catch::Matchers::WithinAbs(lengthScale, 1.0e-12));
+    } // for
+
+    err = DMGetCoordinatesLocal(dmLevels[1], &coordVec);REQUIRE(!err);
+    err = VecGetArrayRead(coordVec, &coordsArray);REQUIRE(!err);
+    const PylithReal tolerance = 1.0e-12;
+    for (PetscInt i = 0; i < coordSize; ++i) {
+        CHECK_THAT(coordsArray[i], Catch::Matchers::WithinAbs(coordsOrig[i] / lengthScale, tolerance));
+    } // for
+    err = VecRestoreArrayRead(coordVec, &coordsArray);REQUIRE(!err);
+
+    PYLITH_METHOD_END;
+} // testKeepCoarseLevels
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::topology::TestRefineUniform::_initializeMesh(Mesh* const mesh) {
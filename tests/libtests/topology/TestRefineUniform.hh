@@ -52,6 +52,9 @@ public:
     /// Test refine().
     void testRefine(void);
 
+    /// Test refine() keeping coarse meshes for geometric multigrid.
+    void testKeepCoarseLevels(void);
+
     // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -58,6 +58,12 @@ TEST_CASE("TestRefineUniform::Tri_2xNoFault::testRefine", "[TestRefineUniform][T
 TEST_CASE("TestRefineUniform::Tri_2xFault::testRefine", "[TestRefineUniform][Tri][Fault]") {
     pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Tri_2xFault()).testRefine();
 }
+TEST_CASE("TestRefineUniform::Tri_2xNoFault::testKeepCoarseLevels", "[TestRefineUniform][Tri][NoFault]") {
+    pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Tri_2xNoFault()).testKeepCoarseLevels();
+}
+TEST_CASE("TestRefineUniform::Tri_2xFault::testKeepCoarseLevels", "[TestRefineUniform][Tri][Fault]") {
+    pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Tri_2xFault()).testKeepCoarseLevels();
+}
 
 TEST_CASE("TestRefineUniform::Quad_2xNoFault::testRefine", "[TestRefineUniform][Quad][NoFault]") {
     pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Quad_2xNoFault()).testRefine();
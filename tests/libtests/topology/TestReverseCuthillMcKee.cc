@@ -75,7 +75,7 @@ pylith::topology::TestReverseCuthillMcKee::testReorder(void) {
     Mesh meshOrig;
     meshOrig.setDM(dmOrig);
 
-    ReverseCuthillMcKee::reorder(_mesh);
+    ReverseCuthillMcKee::reorder(_mesh, _data->ordering);
 
     const PetscDM& dmMesh = _mesh->getDM();assert(dmMesh);
 
@@ -158,22 +158,7 @@ pylith::topology::TestReverseCuthillMcKee::testReorder(void) {
 
     // Verify reduction in Jacobian bandwidth
     Field fieldOrig(meshOrig);
-    Field::Description description;
-    description.label = "solution";
-    description.vectorFieldType = FieldBase::SCALAR;
-    description.numComponents = 1;
-    description.componentNames.resize(1);
-    description.componentNames[0] = "field";
-    description.scale = 1.0;
-    description.validator = NULL;
-
-    Field::Discretization discretization;
-    discretization.basisOrder = 1;
-    discretization.quadOrder = 1;
-    fieldOrig.subfieldAdd(description, discretization);
-    fieldOrig.subfieldsSetup();
-    fieldOrig.createDiscretization();
-    fieldOrig.allocate();
+    _setupField(&fieldOrig);
     PetscMat matrix = NULL;
     PetscInt bandwidthOrig = 0;
     err = DMCreateMatrix(fieldOrig.getDM(), &matrix);REQUIRE(!err);
@@ -181,10 +166,7 @@ pylith::topology::TestReverseCuthillMcKee::testReorder(void) {
     err = MatDestroy(&matrix);REQUIRE(!err);
 
     Field field(*_mesh);
-    field.subfieldAdd(description, discretization);
-    field.subfieldsSetup();
-    field.createDiscretization();
-    field.allocate();
+    _setupField(&field);
     PetscInt bandwidth = 0;
     err = DMCreateMatrix(field.getDM(), &matrix);REQUIRE(!err);
     err = MatComputeBandwidth(matrix, 0.0, &bandwidth);REQUIRE(!err);
@@ -192,7 +174,10 @@ pylith::topology::TestReverseCuthillMcKee::testReorder(void) {
 
     REQUIRE(bandwidthOrig > 0);
     REQUIRE(bandwidth > 0);
-    REQUIRE(bandwidth <= bandwidthOrig);
+    if (ReverseCuthillMcKee::RCM == _data->ordering) {
+        // Other orderings do not minimize the bandwidth.
+        REQUIRE(bandwidth <= bandwidthOrig);
+    } // if
 
     PYLITH_METHOD_END;
 } // testReorder
@@ -224,11 +209,40 @@ pylith::topology::TestReverseCuthillMcKee::_initialize() {
 } // _initialize
 
 
+// ------------------------------------------------------------------------------------------------
+// Create field with scalar subfield with basis order 1.
+void
+pylith::topology::TestReverseCuthillMcKee::_setupField(Field* field) {
+    PYLITH_METHOD_BEGIN;
+    assert(field);
+
+    Field::Description description;
+    description.label = "solution";
+    description.vectorFieldType = FieldBase::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = "field";
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    Field::Discretization discretization;
+    discretization.basisOrder = 1;
+    discretization.quadOrder = 1;
+    field->subfieldAdd(description, discretization);
+    field->subfieldsSetup();
+    field->createDiscretization();
+    field->allocate();
+
+    PYLITH_METHOD_END;
+} // _setupField
+
+
 // ------------------------------------------------------------------------------------------------
 // Constructor
 pylith::topology::TestReverseCuthillMcKee_Data::TestReverseCuthillMcKee_Data(void) :
     filename(NULL),
-    faultLabel(NULL) {}
+    faultLabel(NULL),
+    ordering(ReverseCuthillMcKee::RCM) {}
 
 
 // ------------------------------------------------------------------------------------------------
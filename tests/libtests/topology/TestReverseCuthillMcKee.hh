@@ -30,6 +30,7 @@
 #include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
 
 #include "pylith/topology/topologyfwd.hh" // USES Mesh
+#include "pylith/topology/ReverseCuthillMcKee.hh" // USES ReverseCuthillMcKee::OrderingEnum
 
 namespace pylith {
     namespace topology {
@@ -64,6 +65,13 @@ private:
     /// Setup mesh.
     void _initialize();
 
+    /** Create field with scalar subfield with basis order 1.
+     *
+     * @param[out] field Field to setup.
+     */
+    static
+    void _setupField(Field* field);
+
 }; // class TestReverseCuthillMcKee
 
 // ------------------------------------------------------------------------------------------------
@@ -82,6 +90,7 @@ public:
 
     const char* filename; ///< Name of mesh file.
     const char* faultLabel; ///< Label for fault (use NULL for no fault).
+    ReverseCuthillMcKee::OrderingEnum ordering; ///< Algorithm for ordering cells.
 
 };  // TestReverseCuthillMcKee_Data
 
@@ -49,6 +49,14 @@ public:
 
     static TestReverseCuthillMcKee_Data* Hex_Fault(void);
 
+    static TestReverseCuthillMcKee_Data* Tri_Fault_RCMMaterial(void);
+
+    static TestReverseCuthillMcKee_Data* Quad_NoFault_Morton(void);
+
+    static TestReverseCuthillMcKee_Data* Tet_Fault_Hilbert(void);
+
+    static TestReverseCuthillMcKee_Data* Hex_NoFault_Hilbert(void);
+
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -80,6 +88,19 @@ TEST_CASE("TestReverseCuthillMcKee::Hex_NoFault::testReorder", "[TestReverseCuth
     pylith::topology::TestReverseCuthillMcKee(pylith::topology::TestReverseCuthillMcKee_Cases::Hex_Fault()).testReorder();
 }
 
+TEST_CASE("TestReverseCuthillMcKee::Tri_Fault_RCMMaterial::testReorder", "[TestReverseCuthillMcKee][Tri][Fault][RCMMaterial][testReorder]") {
+    pylith::topology::TestReverseCuthillMcKee(pylith::topology::TestReverseCuthillMcKee_Cases::Tri_Fault_RCMMaterial()).testReorder();
+}
+TEST_CASE("TestReverseCuthillMcKee::Quad_NoFault_Morton::testReorder", "[TestReverseCuthillMcKee][Quad][NoFault][Morton][testReorder]") {
+    pylith::topology::TestReverseCuthillMcKee(pylith::topology::TestReverseCuthillMcKee_Cases::Quad_NoFault_Morton()).testReorder();
+}
+TEST_CASE("TestReverseCuthillMcKee::Tet_Fault_Hilbert::testReorder", "[TestReverseCuthillMcKee][Tet][Fault][Hilbert][testReorder]") {
+    pylith::topology::TestReverseCuthillMcKee(pylith::topology::TestReverseCuthillMcKee_Cases::Tet_Fault_Hilbert()).testReorder();
+}
+TEST_CASE("TestReverseCuthillMcKee::Hex_NoFault_Hilbert::testReorder", "[TestReverseCuthillMcKee][Hex][NoFault][Hilbert][testReorder]") {
+    pylith::topology::TestReverseCuthillMcKee(pylith::topology::TestReverseCuthillMcKee_Cases::Hex_NoFault_Hilbert()).testReorder();
+}
+
 // ------------------------------------------------------------------------------------------------
 pylith::topology::TestReverseCuthillMcKee_Data*
 pylith::topology::TestReverseCuthillMcKee_Cases::Tri_NoFault(void) {
@@ -176,4 +197,56 @@ pylith::topology::TestReverseCuthillMcKee_Cases::Hex_Fault(void) {
 }   // Hex_fault
 
 
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestReverseCuthillMcKee_Data*
+pylith::topology::TestReverseCuthillMcKee_Cases::Tri_Fault_RCMMaterial(void) {
+    TestReverseCuthillMcKee_Data* data = new TestReverseCuthillMcKee_Data();assert(data);
+
+    data->filename = "data/reorder_tri3.mesh";
+    data->faultLabel = "fault";
+    data->ordering = ReverseCuthillMcKee::RCM_MATERIAL;
+
+    return data;
+}   // Tri_Fault_RCMMaterial
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestReverseCuthillMcKee_Data*
+pylith::topology::TestReverseCuthillMcKee_Cases::Quad_NoFault_Morton(void) {
+    TestReverseCuthillMcKee_Data* data = new TestReverseCuthillMcKee_Data();assert(data);
+
+    data->filename = "data/reorder_quad4.mesh";
+    data->faultLabel = NULL;
+    data->ordering = ReverseCuthillMcKee::MORTON;
+
+    return data;
+}   // Quad_NoFault_Morton
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestReverseCuthillMcKee_Data*
+pylith::topology::TestReverseCuthillMcKee_Cases::Tet_Fault_Hilbert(void) {
+    TestReverseCuthillMcKee_Data* data = new TestReverseCuthillMcKee_Data();assert(data);
+
+    data->filename = "data/reorder_tet4.mesh";
+    data->faultLabel = "fault";
+    data->ordering = ReverseCuthillMcKee::HILBERT;
+
+    return data;
+}   // Tet_Fault_Hilbert
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestReverseCuthillMcKee_Data*
+pylith::topology::TestReverseCuthillMcKee_Cases::Hex_NoFault_Hilbert(void) {
+    TestReverseCuthillMcKee_Data* data = new TestReverseCuthillMcKee_Data();assert(data);
+
+    data->filename = "data/reorder_hex8.mesh";
+    data->faultLabel = NULL;
+    data->ordering = ReverseCuthillMcKee::HILBERT;
+
+    return data;
+}   // Hex_NoFault_Hilbert
+
+
 // End of file
@@ -22,7 +22,9 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/MeshOps.hh" // USES createLowerDimMesh()
 #include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorSubmesh.hh" // USES SubmeshIS
 #include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder::buildMesh()
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 
@@ -137,6 +139,36 @@ pylith::topology::TestSubmesh::testCreateLowerDimMesh(void) {
         CHECK(_data->submeshCells[iC] == c);
     } // for
 
+    // Check maps between points of submesh and points of mesh.
+    PetscIS subpointIS = NULL;
+    const PetscInt* subpoints = NULL;
+    PetscInt numSubpoints = 0;
+    PetscErrorCode err = DMPlexGetSubpointIS(dmMesh, &subpointIS);PYLITH_CHECK_ERROR(err);assert(subpointIS);
+    err = ISGetLocalSize(subpointIS, &numSubpoints);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+    PetscInt numPoints = 0, pStart = 0, pEnd = 0;
+    const PetscInt* subpointToPoint = _testMesh->getSubpointToPointMap(&numPoints);
+    const PetscInt* pointToSubpoint = _testMesh->getPointToSubpointMap(&pStart, &pEnd);
+    REQUIRE(numSubpoints == numPoints);
+    REQUIRE(subpointToPoint);
+    REQUIRE(pointToSubpoint);
+    SubmeshIS submeshIS(*_testMesh);
+    for (PetscInt subpoint = 0; subpoint < numSubpoints; ++subpoint) {
+        CHECK(subpoints[subpoint] == subpointToPoint[subpoint]);
+        CHECK(subpoint == pointToSubpoint[subpoints[subpoint]-pStart]);
+        CHECK(subpoint == submeshIS.subpoint(subpoints[subpoint]));
+    } // for
+    CHECK(pEnd-pStart >= numSubpoints);
+    CHECK(-1 == submeshIS.subpoint(pEnd));
+    err = ISRestoreIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+
+    // Check that lower dimension mesh for same label shares DM and has maps.
+    Mesh* sharedMesh = MeshOps::createLowerDimMesh(*_domainMesh, _data->groupLabel, labelValue);assert(sharedMesh);
+    CHECK(dmMesh == sharedMesh->getDM());
+    CHECK(sharedMesh->getSubpointToPointMap(&numPoints));
+    CHECK(numSubpoints == numPoints);
+    delete sharedMesh;sharedMesh = NULL;
+
     delete _testMesh;_testMesh = NULL;
     REQUIRE_THROWS_AS(MeshOps::createLowerDimMesh(*_domainMesh, "zzyyxx", labelValue), std::runtime_error);
     REQUIRE_THROWS_AS(MeshOps::createLowerDimMesh(*_domainMesh, _data->groupLabel, labelValue+99), std::runtime_error);
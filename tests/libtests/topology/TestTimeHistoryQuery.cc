@@ -0,0 +1,324 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/topology/TimeHistoryQuery.hh" // USES TimeHistoryQuery
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class TestTimeHistoryQuery;
+    } // topology
+} // pylith
+
+class pylith::topology::TestTimeHistoryQuery : public pylith::utils::GenericComponent {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    TestTimeHistoryQuery(void);
+
+    /// Destructor.
+    ~TestTimeHistoryQuery(void);
+
+    /// Test update().
+    void testUpdate(void);
+
+    /// Test rebuilding table when field is modified by another object.
+    void testRebuild(void);
+
+    /// Test deallocate().
+    void testDeallocate(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Create mesh and field with time history start time and value subfields.
+    void _initialize(void);
+
+    /** Set start times at vertices.
+     *
+     * @param[in] startTimes Start times (nondimensional) at vertices [numVertices].
+     */
+    void _setStartTimes(const PylithScalar* startTimes);
+
+    /** Check time history values at vertices.
+     *
+     * @param[in] valuesE Expected values at vertices [numVertices].
+     */
+    void _checkValues(const PylithScalar* valuesE) const;
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    Mesh* _mesh; ///< Finite-element mesh.
+    Field* _field; ///< Field with time history start time and value subfields.
+    spatialdata::spatialdb::TimeHistory* _dbTimeHistory; ///< Time history database.
+
+    static const size_t _numVertices; ///< Number of vertices in mesh.
+    static const PylithReal _timeScale; ///< Time scale for dimensionalizing time.
+
+}; // class TestTimeHistoryQuery
+
+const size_t pylith::topology::TestTimeHistoryQuery::_numVertices = 4;
+const PylithReal pylith::topology::TestTimeHistoryQuery::_timeScale = 2.0;
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestTimeHistoryQuery::testUpdate", "[TestTimeHistoryQuery]") {
+    pylith::topology::TestTimeHistoryQuery().testUpdate();
+}
+TEST_CASE("TestTimeHistoryQuery::testRebuild", "[TestTimeHistoryQuery]") {
+    pylith::topology::TestTimeHistoryQuery().testRebuild();
+}
+TEST_CASE("TestTimeHistoryQuery::testDeallocate", "[TestTimeHistoryQuery]") {
+    pylith::topology::TestTimeHistoryQuery().testDeallocate();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::topology::TestTimeHistoryQuery::TestTimeHistoryQuery(void) :
+    _mesh(NULL),
+    _field(NULL),
+    _dbTimeHistory(NULL) {
+    _initialize();
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::topology::TestTimeHistoryQuery::~TestTimeHistoryQuery(void) {
+    if (_dbTimeHistory) {
+        _dbTimeHistory->close();
+    } // if
+    delete _dbTimeHistory;_dbTimeHistory = NULL;
+    delete _field;_field = NULL;
+    delete _mesh;_mesh = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test update().
+void
+pylith::topology::TestTimeHistoryQuery::testUpdate(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+    assert(_dbTimeHistory);
+
+    // Two vertices share a start time, and one vertex starts after the current time.
+    const PylithScalar startTimes[4] = { 0.0, 1.0, 1.0, 3.0 };
+    _setStartTimes(startTimes);
+
+    TimeHistoryQuery query("time_history_start_time", "time_history_value");
+    CHECK(!query._isCurrent(*_field));
+
+    // Time history is a ramp, value(t) = 0.5*t, with t in dimensioned time.
+    query.update(_field, 2.0, _timeScale, _dbTimeHistory);
+    CHECK(query._isCurrent(*_field));
+    CHECK(size_t(3) == query._startTimes.size());
+    CHECK(_numVertices == query._valueOffsets.size());
+    CHECK(_numVertices == query._startTimeIndices.size());
+    const PylithScalar valuesA[4] = { 2.0, 1.0, 1.0, 0.0 };
+    _checkValues(valuesA);
+
+    // Update at a later time.
+    query.update(_field, 4.0, _timeScale, _dbTimeHistory);
+    CHECK(query._isCurrent(*_field));
+    const PylithScalar valuesB[4] = { 4.0, 3.0, 3.0, 1.0 };
+    _checkValues(valuesB);
+
+    PYLITH_METHOD_END;
+} // testUpdate
+
+
+// ------------------------------------------------------------------------------------------------
+// Test rebuilding table when field is modified by another object.
+void
+pylith::topology::TestTimeHistoryQuery::testRebuild(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+    assert(_dbTimeHistory);
+
+    const PylithScalar startTimesA[4] = { 0.0, 0.0, 0.0, 0.0 };
+    _setStartTimes(startTimesA);
+
+    TimeHistoryQuery query("time_history_start_time", "time_history_value");
+    query.update(_field, 2.0, _timeScale, _dbTimeHistory);
+    CHECK(size_t(1) == query._startTimes.size());
+    const PylithScalar valuesA[4] = { 2.0, 2.0, 2.0, 2.0 };
+    _checkValues(valuesA);
+
+    // Changing the start times (e.g., restoring a checkpoint) invalidates the table.
+    const PylithScalar startTimesB[4] = { 2.0, 1.0, 0.0, 1.0 };
+    _setStartTimes(startTimesB);
+    CHECK(!query._isCurrent(*_field));
+
+    query.update(_field, 2.0, _timeScale, _dbTimeHistory);
+    CHECK(query._isCurrent(*_field));
+    CHECK(size_t(3) == query._startTimes.size());
+    const PylithScalar valuesB[4] = { 0.0, 1.0, 2.0, 1.0 };
+    _checkValues(valuesB);
+
+    PYLITH_METHOD_END;
+} // testRebuild
+
+
+// ------------------------------------------------------------------------------------------------
+// Test deallocate().
+void
+pylith::topology::TestTimeHistoryQuery::testDeallocate(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+    assert(_dbTimeHistory);
+
+    const PylithScalar startTimes[4] = { 0.0, 1.0, 1.0, 3.0 };
+    _setStartTimes(startTimes);
+
+    TimeHistoryQuery query("time_history_start_time", "time_history_value");
+    query.update(_field, 2.0, _timeScale, _dbTimeHistory);
+    CHECK(query._isCurrent(*_field));
+
+    query.deallocate();
+    CHECK(!query._isCurrent(*_field));
+    CHECK(query._startTimes.empty());
+    CHECK(query._valueOffsets.empty());
+    CHECK(query._startTimeIndices.empty());
+
+    // Table is rebuilt on the next update.
+    query.update(_field, 2.0, _timeScale, _dbTimeHistory);
+    const PylithScalar valuesE[4] = { 2.0, 1.0, 1.0, 0.0 };
+    _checkValues(valuesE);
+
+    PYLITH_METHOD_END;
+} // testDeallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh and field with time history start time and value subfields.
+void
+pylith::topology::TestTimeHistoryQuery::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int cellDim = 2;
+    const int spaceDim = 2;
+    const int numVertices = 4;
+    const int numCells = 2;
+    const int numCorners = 3;
+    const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+        -1.0, 0.0,
+        0.0, -1.0,
+        0.0, +1.0,
+        +1.0, 0.0,
+    };
+    const int cellsValues[numCells*numCorners] = {
+        0, 1, 2,
+        2, 1, 3,
+    };
+    scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+    int_array cells(cellsValues, numCells*numCorners);
+
+    delete _mesh;_mesh = new Mesh;assert(_mesh);
+    pylith::meshio::MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners,
+                                           cellDim);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    _mesh->setCoordSys(&cs);
+
+    delete _field;_field = new Field(*_mesh);assert(_field);
+    _field->setLabel("auxiliary field");
+    _field->subfieldAdd(FieldBase::Description("time_history_start_time", "time_history_start_time",
+                                               pylith::string_vector(1, "time_history_start_time"), 1,
+                                               FieldBase::SCALAR), FieldBase::Discretization(1, 1));
+    _field->subfieldAdd(FieldBase::Description("time_history_value", "time_history_value",
+                                               pylith::string_vector(1, "time_history_value"), 1,
+                                               FieldBase::SCALAR), FieldBase::Discretization(1, 1));
+    _field->subfieldsSetup();
+    _field->createDiscretization();
+    _field->allocate();
+    _field->zeroLocal();
+
+    delete _dbTimeHistory;_dbTimeHistory = new spatialdata::spatialdb::TimeHistory;assert(_dbTimeHistory);
+    _dbTimeHistory->setDescription("ramp");
+    _dbTimeHistory->setFilename("data/timehistory.timedb");
+    _dbTimeHistory->open();
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Set start times at vertices.
+void
+pylith::topology::TestTimeHistoryQuery::_setStartTimes(const PylithScalar* startTimes) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+    assert(startTimes);
+
+    PetscInt vStart = 0, vEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(_field->getDM(), 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    REQUIRE(_numVertices == size_t(vEnd - vStart));
+
+    VecVisitorMesh visitor(*_field, "time_history_start_time");
+    PetscScalar* fieldArray = visitor.localArray();assert(fieldArray);
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+        fieldArray[visitor.sectionOffset(v)] = startTimes[v-vStart];
+    } // for
+    visitor.clear();
+
+    PYLITH_METHOD_END;
+} // _setStartTimes
+
+
+// ------------------------------------------------------------------------------------------------
+// Check time history values at vertices.
+void
+pylith::topology::TestTimeHistoryQuery::_checkValues(const PylithScalar* valuesE) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+    assert(valuesE);
+
+    PetscInt vStart = 0, vEnd = 0;
+    PetscErrorCode err = DMPlexGetDepthStratum(_field->getDM(), 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+    VecVisitorMesh visitor(*_field, "time_history_value");
+    const PetscScalar* fieldArray = visitor.localArray();assert(fieldArray);
+    const PylithReal tolerance = 1.0e-10;
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+        INFO("Vertex " << v-vStart);
+        CHECK_THAT(fieldArray[visitor.sectionOffset(v)], Catch::Matchers::WithinAbs(valuesE[v-vStart], tolerance));
+    } // for
+
+    PYLITH_METHOD_END;
+} // _checkValues
+
+
+// End of file
@@ -0,0 +1,345 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/topology/VisitorMesh.hh" // USES VecScatterPlanMesh
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class TestVecScatterPlanMesh;
+    } // topology
+} // pylith
+
+class pylith::topology::TestVecScatterPlanMesh : public pylith::utils::GenericComponent {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    TestVecScatterPlanMesh(void);
+
+    /// Destructor.
+    ~TestVecScatterPlanMesh(void);
+
+    /// Test initialize(), size(), and indices().
+    void testInitialize(void);
+
+    /// Test gather().
+    void testGather(void);
+
+    /// Test scatter().
+    void testScatter(void);
+
+    /// Test isCurrent() and clear().
+    void testIsCurrent(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Create mesh and field with displacement and pressure subfields.
+    void _initialize(void);
+
+    /** Compute expected indices into local array of field.
+     *
+     * @param[in] subfieldNames Names of subfields in order of plan.
+     * @param[in] numSubfields Number of subfields.
+     * @returns Indices into local array of field.
+     */
+    int_array _expectedIndices(const char* const* subfieldNames,
+                               const size_t numSubfields) const;
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    Mesh* _mesh; ///< Finite-element mesh.
+    Field* _field; ///< Field with displacement and pressure subfields.
+
+}; // class TestVecScatterPlanMesh
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestVecScatterPlanMesh::testInitialize", "[TestVecScatterPlanMesh]") {
+    pylith::topology::TestVecScatterPlanMesh().testInitialize();
+}
+TEST_CASE("TestVecScatterPlanMesh::testGather", "[TestVecScatterPlanMesh]") {
+    pylith::topology::TestVecScatterPlanMesh().testGather();
+}
+TEST_CASE("TestVecScatterPlanMesh::testScatter", "[TestVecScatterPlanMesh]") {
+    pylith::topology::TestVecScatterPlanMesh().testScatter();
+}
+TEST_CASE("TestVecScatterPlanMesh::testIsCurrent", "[TestVecScatterPlanMesh]") {
+    pylith::topology::TestVecScatterPlanMesh().testIsCurrent();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::topology::TestVecScatterPlanMesh::TestVecScatterPlanMesh(void) :
+    _mesh(NULL),
+    _field(NULL) {
+    _initialize();
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::topology::TestVecScatterPlanMesh::~TestVecScatterPlanMesh(void) {
+    delete _field;_field = NULL;
+    delete _mesh;_mesh = NULL;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test initialize(), size(), and indices().
+void
+pylith::topology::TestVecScatterPlanMesh::testInitialize(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+
+    // Subfields in reverse order, so values for a point are not contiguous in the local array.
+    const PetscInt subfieldIndices[2] = {
+        _field->getSubfieldInfo("pressure").index,
+        _field->getSubfieldInfo("displacement").index,
+    };
+    const char* subfieldNames[2] = { "pressure", "displacement" };
+
+    VecScatterPlanMesh plan;
+    plan.initialize(*_field, subfieldIndices, 2);
+
+    const int_array& indicesE = _expectedIndices(subfieldNames, 2);
+    const int_array& indices = plan.indices();
+    const size_t numVertices = 4;
+    const size_t numValuesPerVertex = 3;
+    REQUIRE(numVertices*numValuesPerVertex == indicesE.size());
+    REQUIRE(indicesE.size() == plan.size());
+    for (size_t i = 0; i < indicesE.size(); ++i) {
+        CHECK(indicesE[i] == indices[i]);
+    } // for
+
+    VecScatterPlanMesh planEmpty;
+    planEmpty.initialize(*_field, NULL, 0);
+    CHECK(size_t(0) == planEmpty.size());
+
+    PYLITH_METHOD_END;
+} // testInitialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Test gather().
+void
+pylith::topology::TestVecScatterPlanMesh::testGather(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+
+    const PetscInt subfieldIndices[2] = {
+        _field->getSubfieldInfo("pressure").index,
+        _field->getSubfieldInfo("displacement").index,
+    };
+    VecScatterPlanMesh plan;
+    plan.initialize(*_field, subfieldIndices, 2);
+
+    VecVisitorMesh fieldVisitor(*_field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();assert(fieldArray);
+    PetscInt fieldSize = 0;
+    PetscErrorCode err = VecGetLocalSize(_field->getLocalVector(), &fieldSize);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < fieldSize; ++i) {
+        fieldArray[i] = 1.0 + 0.5*i;
+    } // for
+
+    scalar_array values(plan.size());
+    plan.gather(&values[0], fieldArray);
+
+    const int_array& indices = plan.indices();
+    const PylithReal tolerance = 1.0e-10;
+    for (size_t i = 0; i < plan.size(); ++i) {
+        CHECK_THAT(values[i], Catch::Matchers::WithinAbs(fieldArray[indices[i]], tolerance));
+    } // for
+
+    PYLITH_METHOD_END;
+} // testGather
+
+
+// ------------------------------------------------------------------------------------------------
+// Test scatter().
+void
+pylith::topology::TestVecScatterPlanMesh::testScatter(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+
+    // Scatter only the pressure, so the displacement must not change.
+    const PetscInt subfieldIndex = _field->getSubfieldInfo("pressure").index;
+    VecScatterPlanMesh plan;
+    plan.initialize(*_field, &subfieldIndex, 1);
+    const size_t numVertices = 4;
+    REQUIRE(numVertices == plan.size());
+
+    _field->zeroLocal();
+    scalar_array values(plan.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = 2.0 + 1.5*i;
+    } // for
+
+    VecVisitorMesh fieldVisitor(*_field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();assert(fieldArray);
+    plan.scatter(fieldArray, &values[0]);
+
+    const char* subfieldNames[1] = { "pressure" };
+    const int_array& indicesE = _expectedIndices(subfieldNames, 1);
+    PetscInt fieldSize = 0;
+    PetscErrorCode err = VecGetLocalSize(_field->getLocalVector(), &fieldSize);PYLITH_CHECK_ERROR(err);
+    scalar_array fieldValuesE(0.0, fieldSize);
+    for (size_t i = 0; i < indicesE.size(); ++i) {
+        fieldValuesE[indicesE[i]] = values[i];
+    } // for
+
+    const PylithReal tolerance = 1.0e-10;
+    for (PetscInt i = 0; i < fieldSize; ++i) {
+        CHECK_THAT(fieldArray[i], Catch::Matchers::WithinAbs(fieldValuesE[i], tolerance));
+    } // for
+
+    PYLITH_METHOD_END;
+} // testScatter
+
+
+// ------------------------------------------------------------------------------------------------
+// Test isCurrent() and clear().
+void
+pylith::topology::TestVecScatterPlanMesh::testIsCurrent(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+    assert(_mesh);
+
+    VecScatterPlanMesh plan;
+    CHECK(!plan.isCurrent(*_field));
+
+    const PetscInt subfieldIndex = _field->getSubfieldInfo("displacement").index;
+    plan.initialize(*_field, &subfieldIndex, 1);
+    CHECK(plan.isCurrent(*_field));
+
+    // Field with a different layout.
+    Field fieldOther(*_mesh);
+    fieldOther.setLabel("other");
+    fieldOther.subfieldAdd(FieldBase::Description("pressure", "pressure", pylith::string_vector(1, "pressure"), 1,
+                                                  FieldBase::SCALAR), FieldBase::Discretization(1, 1));
+    fieldOther.subfieldsSetup();
+    fieldOther.createDiscretization();
+    fieldOther.allocate();
+    CHECK(!plan.isCurrent(fieldOther));
+
+    plan.clear();
+    CHECK(!plan.isCurrent(*_field));
+    CHECK(size_t(0) == plan.size());
+
+    PYLITH_METHOD_END;
+} // testIsCurrent
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh and field with displacement and pressure subfields.
+void
+pylith::topology::TestVecScatterPlanMesh::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int cellDim = 2;
+    const int spaceDim = 2;
+    const int numVertices = 4;
+    const int numCells = 2;
+    const int numCorners = 3;
+    const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+        -1.0, 0.0,
+        0.0, -1.0,
+        0.0, +1.0,
+        +1.0, 0.0,
+    };
+    const int cellsValues[numCells*numCorners] = {
+        0, 1, 2,
+        2, 1, 3,
+    };
+    scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+    int_array cells(cellsValues, numCells*numCorners);
+
+    delete _mesh;_mesh = new Mesh;assert(_mesh);
+    pylith::meshio::MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners,
+                                           cellDim);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    _mesh->setCoordSys(&cs);
+
+    pylith::string_vector dispComponents(2);
+    dispComponents[0] = "displacement_x";
+    dispComponents[1] = "displacement_y";
+
+    delete _field;_field = new Field(*_mesh);assert(_field);
+    _field->setLabel("solution");
+    _field->subfieldAdd(FieldBase::Description("displacement", "displacement", dispComponents, 2, FieldBase::VECTOR),
+                        FieldBase::Discretization(1, 1));
+    _field->subfieldAdd(FieldBase::Description("pressure", "pressure", pylith::string_vector(1, "pressure"), 1,
+                                               FieldBase::SCALAR), FieldBase::Discretization(1, 1));
+    _field->subfieldsSetup();
+    _field->createDiscretization();
+    _field->allocate();
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute expected indices into local array of field.
+pylith::int_array
+pylith::topology::TestVecScatterPlanMesh::_expectedIndices(const char* const* subfieldNames,
+                                                           const size_t numSubfields) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_field);
+
+    PetscSection section = _field->getLocalSection();assert(section);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    std::vector<int> indices;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        for (size_t iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
+            VecVisitorMesh subfieldVisitor(*_field, subfieldNames[iSubfield]);
+            const PetscInt off = subfieldVisitor.sectionOffset(point);
+            const PetscInt dof = subfieldVisitor.sectionDof(point);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                indices.push_back(off + iDof);
+            } // for
+        } // for
+    } // for
+
+    int_array indicesArray(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indicesArray[i] = indices[i];
+    } // for
+
+    PYLITH_METHOD_RETURN(indicesArray);
+} // _expectedIndices
+
+
+// End of file
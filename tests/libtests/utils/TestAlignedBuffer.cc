@@ -0,0 +1,159 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/AlignedBuffer.hh" // USES AlignedBuffer
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <stdint.h> // USES uintptr_t
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class TestAlignedBuffer;
+    }
+}
+
+class pylith::utils::TestAlignedBuffer {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test resize() and reserve().
+    static
+    void testResize(void);
+
+    /// Test assign(), push_back(), and clear().
+    static
+    void testValues(void);
+
+    /// Test swap().
+    static
+    void testSwap(void);
+
+}; // class TestAlignedBuffer
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestAlignedBuffer::testResize", "[TestAlignedBuffer]") {
+    pylith::utils::TestAlignedBuffer::testResize();
+}
+TEST_CASE("TestAlignedBuffer::testValues", "[TestAlignedBuffer]") {
+    pylith::utils::TestAlignedBuffer::testValues();
+}
+TEST_CASE("TestAlignedBuffer::testSwap", "[TestAlignedBuffer]") {
+    pylith::utils::TestAlignedBuffer::testSwap();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test resize() and reserve().
+void
+pylith::utils::TestAlignedBuffer::testResize(void) {
+    AlignedBuffer<double> buffer;
+    CHECK(0 == buffer.size());
+    CHECK(0 == buffer.capacity());
+    CHECK(!buffer.data());
+
+    buffer.resize(10);
+    CHECK(10 == buffer.size());
+    CHECK(10 <= buffer.capacity());
+    CHECK(0 == uintptr_t(buffer.data()) % AlignedBuffer<double>::ALIGNMENT);
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = 1.5*i;
+    } // for
+
+    // Growing keeps existing values.
+    buffer.resize(100);
+    CHECK(100 == buffer.size());
+    CHECK(0 == uintptr_t(buffer.data()) % AlignedBuffer<double>::ALIGNMENT);
+    for (size_t i = 0; i < 10; ++i) {
+        CHECK(1.5*i == buffer[i]);
+    } // for
+
+    // Shrinking keeps storage.
+    const size_t capacity = buffer.capacity();
+    buffer.resize(4);
+    CHECK(4 == buffer.size());
+    CHECK(capacity == buffer.capacity());
+
+    buffer.reserve(500);
+    CHECK(4 == buffer.size());
+    CHECK(500 == buffer.capacity());
+    CHECK(3.0 == buffer[2]);
+
+    buffer.deallocate();
+    CHECK(0 == buffer.size());
+    CHECK(0 == buffer.capacity());
+
+    AlignedBuffer<int> bufferSize(7);
+    CHECK(7 == bufferSize.size());
+} // testResize
+
+
+// ------------------------------------------------------------------------------------------------
+// Test assign(), push_back(), and clear().
+void
+pylith::utils::TestAlignedBuffer::testValues(void) {
+    AlignedBuffer<int> buffer;
+    buffer.assign(5, 3);
+    REQUIRE(5 == buffer.size());
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        CHECK(3 == buffer[i]);
+    } // for
+
+    for (int i = 0; i < 20; ++i) {
+        buffer.push_back(i);
+    } // for
+    REQUIRE(25 == buffer.size());
+    for (int i = 0; i < 20; ++i) {
+        CHECK(i == buffer[5+i]);
+    } // for
+
+    // Clearing keeps storage.
+    const size_t capacity = buffer.capacity();
+    const int* values = buffer.data();
+    buffer.clear();
+    CHECK(0 == buffer.size());
+    CHECK(capacity == buffer.capacity());
+    buffer.resize(capacity);
+    CHECK(values == buffer.data());
+} // testValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Test swap().
+void
+pylith::utils::TestAlignedBuffer::testSwap(void) {
+    AlignedBuffer<int> bufferA;
+    bufferA.assign(3, 1);
+    AlignedBuffer<int> bufferB;
+    bufferB.assign(8, 2);
+    const int* valuesA = bufferA.data();
+    const int* valuesB = bufferB.data();
+
+    bufferA.swap(bufferB);
+    CHECK(8 == bufferA.size());
+    CHECK(3 == bufferB.size());
+    CHECK(valuesB == bufferA.data());
+    CHECK(valuesA == bufferB.data());
+    CHECK(2 == bufferA[7]);
+    CHECK(1 == bufferB[0]);
+} // testSwap
+
+
+// End of file
@@ -26,6 +26,11 @@
 
 #include "catch2/catch_test_macros.hpp"
 
+#include <stdexcept> // USES std::runtime_error
+#include <fstream> // USES std::ifstream
+#include <sstream> // USES std::ostringstream
+#include <cstdio> // USES std::remove()
+
 // ------------------------------------------------------------------------------------------------
 namespace pylith {
     namespace utils {
@@ -61,6 +66,10 @@ public:
     static
     void testEventLogging(void);
 
+    /// Test getEvent() and Event::begin(), Event::end().
+    static
+    void testEventHandle(void);
+
     /// Test registerStage().
     static
     void testRegisterStage(void);
@@ -73,6 +82,10 @@ public:
     static
     void testStageLogging(void);
 
+    /// Test enableTrace(), writeTrace(), and disableTrace().
+    static
+    void testTrace(void);
+
 }; // class TestEventLogging
 
 // ------------------------------------------------------------------------------------------------
@@ -94,6 +107,9 @@ TEST_CASE("TestEventLogger::testGetEventId", "[TestEventLogger]") {
 TEST_CASE("TestEventLogger::testEventLogging", "[TestEventLogger]") {
     pylith::utils::TestEventLogger::testEventLogging();
 }
+TEST_CASE("TestEventLogger::testEventHandle", "[TestEventLogger]") {
+    pylith::utils::TestEventLogger::testEventHandle();
+}
 TEST_CASE("TestEventLogger::testRegisterStage", "[TestEventLogger]") {
     pylith::utils::TestEventLogger::testRegisterStage();
 }
@@ -103,6 +119,9 @@ TEST_CASE("TestEventLogger::testGetStageId", "[TestEventLogger]") {
 TEST_CASE("TestEventLogger::testStageLogging", "[TestEventLogger]") {
     pylith::utils::TestEventLogger::testStageLogging();
 }
+TEST_CASE("TestEventLogger::testTrace", "[TestEventLogger]") {
+    pylith::utils::TestEventLogger::testTrace();
+}
 
 // ------------------------------------------------------------------------------------------------
 // Test constructor.
@@ -246,6 +265,42 @@ pylith::utils::TestEventLogger::testEventLogging(void) {
 } // testEventLogging
 
 
+// ------------------------------------------------------------------------------------------------
+// Test getEvent() and Event::begin(), Event::end().
+void
+pylith::utils::TestEventLogger::testEventHandle(void) {
+    PYLITH_METHOD_BEGIN;
+
+    EventLogger::Event eventNone;
+    CHECK(!eventNone.isRegistered());
+
+    EventLogger logger;
+    logger.setClassName("my class");
+    logger.initialize();
+
+    const int numEvents = 2;
+    const char* events[numEvents] = { "event A", "event B" };
+    int ids[numEvents];
+    for (int i = 0; i < numEvents; ++i) {
+        ids[i] = logger.registerEvent(events[i]);
+    }
+
+    const EventLogger::Event eventA = logger.getEvent(events[0]);
+    const EventLogger::Event eventB = logger.getEvent(events[1]);
+    CHECK(eventA.isRegistered());
+    CHECK(ids[0] == eventA.getId());
+    CHECK(ids[1] == eventB.getId());
+    CHECK_THROWS_AS(logger.getEvent("event X"), std::runtime_error);
+
+    eventA.begin();
+    eventB.begin();
+    eventB.end();
+    eventA.end();
+
+    PYLITH_METHOD_END;
+} // testEventHandle
+
+
 // ------------------------------------------------------------------------------------------------
 // Test registerStage().
 void
@@ -346,4 +401,58 @@ pylith::utils::TestEventLogger::testStageLogging(void) {
 } // testStageLogging
 
 
+// ------------------------------------------------------------------------------------------------
+// Test enableTrace(), writeTrace(), and disableTrace().
+void
+pylith::utils::TestEventLogger::testTrace(void) {
+    PYLITH_METHOD_BEGIN;
+
+    EventLogger logger;
+    logger.setClassName("trace class");
+    logger.initialize();
+    const int event = logger.registerEvent("trace event");
+    const int stage = logger.registerStage("trace stage");
+    CHECK(!EventLogger::isTraceEnabled());
+    CHECK_THROWS_AS(EventLogger::enableTrace(0), std::runtime_error);
+
+    // Buffer holds 6 of the 8 records, so the beginning of the stage and the first event are overwritten.
+    EventLogger::enableTrace(6);
+    CHECK(EventLogger::isTraceEnabled());
+    logger.stagePush(stage);
+    const EventLogger::Event& handle = logger.getEvent("trace event");
+    handle.begin();
+    handle.end();
+    logger.eventBegin(event);
+    logger.eventEnd(event);
+    logger.stagePop();
+    EventLogger::stagePushShared("trace shared stage");
+    EventLogger::stagePopShared();
+
+    const char* filename = "trace_eventlogger.json";
+    EventLogger::writeTrace(filename, PETSC_COMM_WORLD);
+    EventLogger::disableTrace();
+    CHECK(!EventLogger::isTraceEnabled());
+
+    int rank = 0;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    if (0 == rank) {
+        std::ifstream fin(filename);
+        REQUIRE(fin.is_open());
+        std::ostringstream contents;
+        contents << fin.rdbuf();
+        const std::string& trace = contents.str();
+        CHECK(std::string::npos != trace.find("\"traceEvents\""));
+        CHECK(std::string::npos != trace.find("\"name\": \"trace shared stage\", \"cat\": \"stage\", \"ph\": \"B\""));
+        CHECK(std::string::npos != trace.find("\"name\": \"trace shared stage\", \"cat\": \"stage\", \"ph\": \"E\""));
+        CHECK(std::string::npos != trace.find("\"name\": \"trace event\", \"cat\": \"event\", \"ph\": \"B\""));
+        // End of stage without beginning in the buffer is dropped.
+        CHECK(std::string::npos == trace.find("\"name\": \"trace stage\""));
+        fin.close();
+        std::remove(filename);
+    } // if
+
+    PYLITH_METHOD_END;
+} // testTrace
+
+
 // End of file
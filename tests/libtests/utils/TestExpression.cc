@@ -0,0 +1,265 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/Expression.hh" // USES Expression
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <cmath> // USES sin(), exp(), etc
+#include <vector> // USES std::vector
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class TestExpression;
+    }
+}
+
+class pylith::utils::TestExpression {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test operators, precedence, and constants.
+    static
+    void testOperators(void);
+
+    /// Test functions.
+    static
+    void testFunctions(void);
+
+    /// Test evaluation over many points.
+    static
+    void testPoints(void);
+
+    /// Test evaluation of operations on constants at compile time.
+    static
+    void testConstantFolding(void);
+
+    /// Test errors in expressions.
+    static
+    void testErrors(void);
+
+}; // class TestExpression
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestExpression::testOperators", "[TestExpression]") {
+    pylith::utils::TestExpression::testOperators();
+}
+TEST_CASE("TestExpression::testFunctions", "[TestExpression]") {
+    pylith::utils::TestExpression::testFunctions();
+}
+TEST_CASE("TestExpression::testPoints", "[TestExpression]") {
+    pylith::utils::TestExpression::testPoints();
+}
+TEST_CASE("TestExpression::testConstantFolding", "[TestExpression]") {
+    pylith::utils::TestExpression::testConstantFolding();
+}
+TEST_CASE("TestExpression::testErrors", "[TestExpression]") {
+    pylith::utils::TestExpression::testErrors();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test operators, precedence, and constants.
+void
+pylith::utils::TestExpression::testOperators(void) {
+    const char* variables[3] = { "x", "y", "z" };
+    const double xyz[3] = { 2.0, -3.0, 0.5 };
+    const double tolerance = 1.0e-14;
+
+    struct Case {
+        const char* expression;
+        double value;
+    };
+    const Case cases[] = {
+        { "1.5", 1.5 },
+        { "2.5e+3", 2500.0 },
+        { ".5*x", 1.0 },
+        { "x + y*z", 0.5 },
+        { "(x + y)*z", -0.5 },
+        { "x - y - z", 4.5 },
+        { "x / y / z", -4.0/3.0 },
+        { "-x^2", -4.0 },
+        { "x^-1", 0.5 },
+        { "2^3^2", 512.0 },
+        { "-y + +z", 3.5 },
+        { "x > y", 1.0 },
+        { "x <= y", 0.0 },
+        { "x >= 2", 1.0 },
+        { "x < 2", 0.0 },
+        { "x == 2", 1.0 },
+        { "x != 2", 0.0 },
+        { "x > 0 && y > 0", 0.0 },
+        { "x > 0 || y > 0", 1.0 },
+        { "!(x > 0)", 0.0 },
+        { "1 + 2 < 4", 1.0 },
+        { "pi", M_PI },
+        { "e", M_E },
+        { "  x*   y  ", -6.0 },
+    };
+    const size_t numCases = sizeof(cases) / sizeof(Case);
+
+    Expression expression;
+    for (size_t i = 0; i < numCases; ++i) {
+        INFO("Expression '" << cases[i].expression << "'");
+        expression.compile(cases[i].expression, variables, 3);
+        CHECK(std::string(cases[i].expression) == expression.getExpression());
+        CHECK(3 == expression.getNumVariables());
+        CHECK_THAT(expression.evaluate(xyz), Catch::Matchers::WithinAbs(cases[i].value, tolerance));
+    } // for
+} // testOperators
+
+
+// ------------------------------------------------------------------------------------------------
+// Test functions.
+void
+pylith::utils::TestExpression::testFunctions(void) {
+    const char* variables[2] = { "t", "depth" };
+    const double values[2] = { 0.3, -2.0 };
+    const double tolerance = 1.0e-14;
+
+    struct Case {
+        const char* expression;
+        double value;
+    };
+    const Case cases[] = {
+        { "sin(t)", sin(0.3) },
+        { "cos(t)", cos(0.3) },
+        { "tan(t)", tan(0.3) },
+        { "asin(t)", asin(0.3) },
+        { "acos(t)", acos(0.3) },
+        { "atan(t)", atan(0.3) },
+        { "atan2(t, depth)", atan2(0.3, -2.0) },
+        { "sinh(t)", sinh(0.3) },
+        { "cosh(t)", cosh(0.3) },
+        { "tanh(t)", tanh(0.3) },
+        { "exp(depth)", exp(-2.0) },
+        { "log(t)", log(0.3) },
+        { "log10(t)", log10(0.3) },
+        { "sqrt(t)", sqrt(0.3) },
+        { "abs(depth)", 2.0 },
+        { "floor(depth*t)", -1.0 },
+        { "ceil(depth*t)", 0.0 },
+        { "min(t, depth)", -2.0 },
+        { "max(t, depth)", 0.3 },
+        { "pow(depth, 2)", 4.0 },
+        { "if(depth < -1, 1.0e+3*depth, t)", -2000.0 },
+        { "if(depth > -1, 1.0e+3*depth, t)", 0.3 },
+        { "2*exp(-t/5)*sin(pi*depth/4)", 2.0*exp(-0.3/5.0)*sin(M_PI*-2.0/4.0) },
+    };
+    const size_t numCases = sizeof(cases) / sizeof(Case);
+
+    Expression expression;
+    for (size_t i = 0; i < numCases; ++i) {
+        INFO("Expression '" << cases[i].expression << "'");
+        expression.compile(cases[i].expression, variables, 2);
+        CHECK_THAT(expression.evaluate(values), Catch::Matchers::WithinAbs(cases[i].value, tolerance));
+    } // for
+} // testFunctions
+
+
+// ------------------------------------------------------------------------------------------------
+// Test evaluation over many points.
+void
+pylith::utils::TestExpression::testPoints(void) {
+    const char* variables[2] = { "x", "y" };
+    const size_t numPoints = 1000; // more than one block
+    const size_t spaceDim = 2;
+    const size_t valuesStride = 3;
+
+    std::vector<double> coordinates(numPoints*spaceDim);
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        coordinates[iPoint*spaceDim+0] = 0.01*iPoint;
+        coordinates[iPoint*spaceDim+1] = 5.0 - 0.02*iPoint;
+    } // for
+
+    Expression expression;
+    expression.compile("if(y > 0, x*y, -x) + 3", variables, 2);
+    std::vector<double> values(numPoints*valuesStride, -1.0);
+    expression.evaluate(&values[1], valuesStride, &coordinates[0], spaceDim, numPoints);
+
+    const double tolerance = 1.0e-12;
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        const double x = coordinates[iPoint*spaceDim+0];
+        const double y = coordinates[iPoint*spaceDim+1];
+        const double valueE = ((y > 0) ? x*y : -x) + 3.0;
+        CHECK(-1.0 == values[iPoint*valuesStride+0]);
+        CHECK_THAT(values[iPoint*valuesStride+1], Catch::Matchers::WithinAbs(valueE, tolerance));
+        CHECK(-1.0 == values[iPoint*valuesStride+2]);
+    } // for
+} // testPoints
+
+
+// ------------------------------------------------------------------------------------------------
+// Test evaluation of operations on constants at compile time.
+void
+pylith::utils::TestExpression::testConstantFolding(void) {
+    const char* variables[1] = { "x" };
+    Expression expression;
+
+    expression.compile("2*pi*sqrt(4) + max(1, 3)", variables, 1);
+    REQUIRE(1 == expression._program.size());
+    CHECK(Expression::PUSH_CONSTANT == expression._program[0].op);
+    CHECK_THAT(expression._program[0].value, Catch::Matchers::WithinAbs(4.0*M_PI+3.0, 1.0e-14));
+    CHECK(1 == expression._stackSize);
+
+    expression.compile("x*(2*3)", variables, 1);
+    REQUIRE(3 == expression._program.size());
+    CHECK(Expression::PUSH_VARIABLE == expression._program[0].op);
+    CHECK(Expression::PUSH_CONSTANT == expression._program[1].op);
+    CHECK(6.0 == expression._program[1].value);
+    CHECK(Expression::MULTIPLY == expression._program[2].op);
+    CHECK(2 == expression._stackSize);
+} // testConstantFolding
+
+
+// ------------------------------------------------------------------------------------------------
+// Test errors in expressions.
+void
+pylith::utils::TestExpression::testErrors(void) {
+    const char* variables[2] = { "x", "y" };
+    const char* expressions[] = {
+        "",
+        "x +",
+        "(x + y",
+        "x y",
+        "2*z",
+        "foo(x)",
+        "sin(x, y)",
+        "if(x, y)",
+        "max(x)",
+        "x $ y",
+    };
+    const size_t numExpressions = sizeof(expressions) / sizeof(const char*);
+
+    Expression expression;
+    for (size_t i = 0; i < numExpressions; ++i) {
+        INFO("Expression '" << expressions[i] << "'");
+        CHECK_THROWS_AS(expression.compile(expressions[i], variables, 2), std::runtime_error);
+    } // for
+
+    // Expression must be compiled before evaluating.
+    const double xy[2] = { 0.0, 0.0 };
+    CHECK_THROWS_AS(expression.evaluate(xy), std::logic_error);
+} // testErrors
+
+
+// End of file
@@ -0,0 +1,114 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/HardwareCounters.hh" // USES HardwareCounters
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <string> // USES std::string
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class TestHardwareCounters;
+    }
+}
+
+class pylith::utils::TestHardwareCounters {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test initialize(), read(), and deallocate().
+    static
+    void testRead(void);
+
+    /// Test getCacheLineSize() and getCounterName().
+    static
+    void testAccessors(void);
+
+}; // class TestHardwareCounters
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestHardwareCounters::testRead", "[TestHardwareCounters]") {
+    pylith::utils::TestHardwareCounters::testRead();
+}
+TEST_CASE("TestHardwareCounters::testAccessors", "[TestHardwareCounters]") {
+    pylith::utils::TestHardwareCounters::testAccessors();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test initialize(), read(), and deallocate().
+void
+pylith::utils::TestHardwareCounters::testRead(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Counters may not be available (build configuration or operating system settings), so only check consistency.
+    const bool isAvailable = HardwareCounters::initialize();
+    CHECK(isAvailable == HardwareCounters::isActive());
+
+    double valuesBegin[HardwareCounters::NUM_COUNTERS];
+    HardwareCounters::read(valuesBegin);
+    volatile double sum = 0.0;
+    for (int i = 0; i < 100000; ++i) {
+        sum += 0.5*i;
+    } // for
+    double valuesEnd[HardwareCounters::NUM_COUNTERS];
+    HardwareCounters::read(valuesEnd);
+    for (int i = 0; i < HardwareCounters::NUM_COUNTERS; ++i) {
+        if (isAvailable) {
+            CHECK(valuesEnd[i] >= valuesBegin[i]);
+        } else {
+            CHECK(0.0 == valuesBegin[i]);
+            CHECK(0.0 == valuesEnd[i]);
+        } // if/else
+    } // for
+    if (isAvailable) {
+        CHECK(valuesEnd[HardwareCounters::INSTRUCTIONS] > valuesBegin[HardwareCounters::INSTRUCTIONS]);
+    } // if
+
+    HardwareCounters::deallocate();
+    CHECK(!HardwareCounters::isActive());
+    HardwareCounters::read(valuesEnd);
+    for (int i = 0; i < HardwareCounters::NUM_COUNTERS; ++i) {
+        CHECK(0.0 == valuesEnd[i]);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testRead
+
+
+// ------------------------------------------------------------------------------------------------
+// Test getCacheLineSize() and getCounterName().
+void
+pylith::utils::TestHardwareCounters::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CHECK(HardwareCounters::getCacheLineSize() > 0);
+    CHECK(std::string("cycles") == HardwareCounters::getCounterName(HardwareCounters::CYCLES));
+    CHECK(std::string("instructions") == HardwareCounters::getCounterName(HardwareCounters::INSTRUCTIONS));
+    CHECK(std::string("llc_misses") == HardwareCounters::getCounterName(HardwareCounters::LLC_MISSES));
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// End of file
@@ -0,0 +1,154 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/MemoryLogger.hh" // USES MemoryLogger
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <string> // USES std::string
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class TestMemoryLogger;
+    }
+}
+
+class pylith::utils::TestMemoryLogger {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test record() and release().
+    static
+    void testRecord(void);
+
+    /// Test getPeakBytes().
+    static
+    void testPeak(void);
+
+    /// Test setGroup() and report().
+    static
+    void testReport(void);
+
+}; // class TestMemoryLogger
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestMemoryLogger::testRecord", "[TestMemoryLogger]") {
+    pylith::utils::TestMemoryLogger::testRecord();
+}
+TEST_CASE("TestMemoryLogger::testPeak", "[TestMemoryLogger]") {
+    pylith::utils::TestMemoryLogger::testPeak();
+}
+TEST_CASE("TestMemoryLogger::testReport", "[TestMemoryLogger]") {
+    pylith::utils::TestMemoryLogger::testReport();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test record() and release().
+void
+pylith::utils::TestMemoryLogger::testRecord(void) {
+    PYLITH_METHOD_BEGIN;
+
+    int ownerA = 0, ownerB = 0;
+    const size_t bytesStart = MemoryLogger::getCurrentBytes();
+
+    MemoryLogger::record(&ownerA, "field A", "displacement", 100);
+    MemoryLogger::record(&ownerA, "field A", "pressure", 20);
+    MemoryLogger::record(&ownerB, "field B", "displacement", 300);
+    CHECK(bytesStart + 420 == MemoryLogger::getCurrentBytes());
+
+    // Recording the same item replaces the previous value.
+    MemoryLogger::record(&ownerA, "field A", "displacement", 50);
+    CHECK(bytesStart + 370 == MemoryLogger::getCurrentBytes());
+
+    MemoryLogger::release(&ownerA);
+    CHECK(bytesStart + 300 == MemoryLogger::getCurrentBytes());
+
+    MemoryLogger::release(&ownerB);
+    CHECK(bytesStart == MemoryLogger::getCurrentBytes());
+
+    // Releasing an unknown owner is a no-op.
+    MemoryLogger::release(&ownerB);
+    CHECK(bytesStart == MemoryLogger::getCurrentBytes());
+
+    PYLITH_METHOD_END;
+} // testRecord
+
+
+// ------------------------------------------------------------------------------------------------
+// Test getPeakBytes().
+void
+pylith::utils::TestMemoryLogger::testPeak(void) {
+    PYLITH_METHOD_BEGIN;
+
+    int owner = 0;
+    MemoryLogger::report("start", PETSC_COMM_WORLD); // Reset peak.
+    const size_t bytesStart = MemoryLogger::getCurrentBytes();
+    CHECK(bytesStart == MemoryLogger::getPeakBytes());
+
+    MemoryLogger::record(&owner, "buffers", "work", 1000);
+    MemoryLogger::release(&owner);
+    CHECK(bytesStart == MemoryLogger::getCurrentBytes());
+    CHECK(bytesStart + 1000 == MemoryLogger::getPeakBytes());
+
+    // Report resets peak to current value.
+    MemoryLogger::report("stage", PETSC_COMM_WORLD);
+    CHECK(bytesStart == MemoryLogger::getPeakBytes());
+
+    PYLITH_METHOD_END;
+} // testPeak
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setGroup() and report().
+void
+pylith::utils::TestMemoryLogger::testReport(void) {
+    PYLITH_METHOD_BEGIN;
+
+    int ownerA = 0, ownerB = 0;
+    MemoryLogger::record(&ownerA, "auxiliary field", "density", 2*1024*1024);
+    MemoryLogger::setGroup(&ownerA, "auxiliary field elasticity");
+    MemoryLogger::record(&ownerA, "auxiliary field", "shear_modulus", 1024*1024);
+    MemoryLogger::record(&ownerB, "solution", "displacement", 3*1024*1024);
+
+    int rank = 0;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    const std::string& report = MemoryLogger::report("Setup", PETSC_COMM_WORLD);
+    if (0 == rank) {
+        CHECK(std::string::npos != report.find("stage 'Setup'"));
+        CHECK(std::string::npos != report.find("Process resident set size"));
+        CHECK(std::string::npos != report.find("auxiliary field elasticity: density"));
+        CHECK(std::string::npos != report.find("auxiliary field elasticity: shear_modulus"));
+        CHECK(std::string::npos != report.find("solution: displacement"));
+        CHECK(std::string::npos == report.find("auxiliary field: density"));
+    } else {
+        CHECK(report.empty());
+    } // if/else
+
+    MemoryLogger::release(&ownerA);
+    MemoryLogger::release(&ownerB);
+
+    PYLITH_METHOD_END;
+} // testReport
+
+
+// End of file
@@ -0,0 +1,92 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/NodeSharedBuffer.hh" // USES NodeSharedBuffer
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "catch2/catch_test_macros.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class TestNodeSharedBuffer;
+    }
+}
+
+class pylith::utils::TestNodeSharedBuffer {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test allocate(), synchronize(), and deallocate().
+    static
+    void testAllocate(void);
+
+}; // class TestNodeSharedBuffer
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestNodeSharedBuffer::testAllocate", "[TestNodeSharedBuffer]") {
+    pylith::utils::TestNodeSharedBuffer::testAllocate();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test allocate(), synchronize(), and deallocate().
+void
+pylith::utils::TestNodeSharedBuffer::testAllocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    NodeSharedBuffer buffer;
+    CHECK(!buffer.data());
+    CHECK(0 == buffer.size());
+
+    const size_t numValues = 1000;
+    buffer.allocate(numValues*sizeof(double), PETSC_COMM_WORLD);
+    CHECK(numValues*sizeof(double) == buffer.size());
+    REQUIRE(buffer.data());
+
+    MPI_Comm nodeComm = MPI_COMM_NULL;
+    MPI_Comm_split_type(PETSC_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodeComm);
+    int nodeRank = 0;
+    MPI_Comm_rank(nodeComm, &nodeRank);
+    MPI_Comm_free(&nodeComm);
+    CHECK((0 == nodeRank) == buffer.isLoader());
+
+    if (buffer.isLoader()) {
+        double* values = static_cast<double*>(buffer.data());
+        for (size_t i = 0; i < numValues; ++i) {
+            values[i] = 2.0*i;
+        } // for
+    } // if
+    buffer.synchronize();
+    const double* values = static_cast<const double*>(buffer.data());
+    for (size_t i = 0; i < numValues; ++i) {
+        CHECK(2.0*i == values[i]);
+    } // for
+
+    buffer.deallocate();
+    CHECK(!buffer.data());
+    CHECK(0 == buffer.size());
+    CHECK(!buffer.isLoader());
+
+    PYLITH_METHOD_END;
+} // testAllocate
+
+
+// End of file
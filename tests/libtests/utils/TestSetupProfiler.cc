@@ -0,0 +1,127 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "pylith/utils/SetupProfiler.hh" // USES SetupProfiler
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <string> // USES std::string
+#include <stdexcept> // USES std::logic_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class TestSetupProfiler;
+    }
+}
+
+class pylith::utils::TestSetupProfiler {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test begin(), end(), and getDepth().
+    static
+    void testPhases(void);
+
+    /// Test report().
+    static
+    void testReport(void);
+
+}; // class TestSetupProfiler
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestSetupProfiler::testPhases", "[TestSetupProfiler]") {
+    pylith::utils::TestSetupProfiler::testPhases();
+}
+TEST_CASE("TestSetupProfiler::testReport", "[TestSetupProfiler]") {
+    pylith::utils::TestSetupProfiler::testReport();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test begin(), end(), and getDepth().
+void
+pylith::utils::TestSetupProfiler::testPhases(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const size_t depthStart = SetupProfiler::getDepth();
+
+    SetupProfiler::begin("Read mesh");
+    CHECK(depthStart + 1 == SetupProfiler::getDepth());
+    SetupProfiler::begin("Create cohesive cells");
+    CHECK(depthStart + 2 == SetupProfiler::getDepth());
+    SetupProfiler::end("Create cohesive cells");
+    CHECK(depthStart + 1 == SetupProfiler::getDepth());
+
+    // Ending phase other than current phase is an error.
+    CHECK_THROWS_AS(SetupProfiler::end("Distribute mesh"), std::logic_error);
+    CHECK(depthStart + 1 == SetupProfiler::getDepth());
+
+    SetupProfiler::end("Read mesh");
+    CHECK(depthStart == SetupProfiler::getDepth());
+
+    SetupProfiler::report("phases", PETSC_COMM_WORLD); // Clear phases.
+
+    PYLITH_METHOD_END;
+} // testPhases
+
+
+// ------------------------------------------------------------------------------------------------
+// Test report().
+void
+pylith::utils::TestSetupProfiler::testReport(void) {
+    PYLITH_METHOD_BEGIN;
+
+    SetupProfiler::report("start", PETSC_COMM_WORLD); // Clear phases.
+
+    SetupProfiler::begin("Initialize problem");
+    for (int i = 0; i < 3; ++i) {
+        SetupProfiler::begin("Query spatial databases");
+        SetupProfiler::end("Query spatial databases");
+    } // for
+    SetupProfiler::end("Initialize problem");
+    SetupProfiler::begin("Setup solver");
+
+    int rank = 0;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    const std::string& report = SetupProfiler::report("Setup", PETSC_COMM_WORLD);
+    if (0 == rank) {
+        CHECK(std::string::npos != report.find("profile for 'Setup'"));
+        CHECK(std::string::npos != report.find("\n  Initialize problem "));
+        CHECK(std::string::npos != report.find("\n    Query spatial databases      3"));
+        CHECK(std::string::npos == report.find("Setup solver")); // In progress
+    } else {
+        CHECK(report.empty());
+    } // if/else
+
+    // Completed phases are cleared by report; phases in progress are kept.
+    SetupProfiler::end("Setup solver");
+    const std::string& reportNext = SetupProfiler::report("Next", PETSC_COMM_WORLD);
+    if (0 == rank) {
+        CHECK(std::string::npos != reportNext.find("Setup solver"));
+        CHECK(std::string::npos == reportNext.find("Initialize problem"));
+    } // if
+
+    PYLITH_METHOD_END;
+} // testReport
+
+
+// End of file
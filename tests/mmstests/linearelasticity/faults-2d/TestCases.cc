@@ -38,6 +38,9 @@ TEST_CASE("TwoBlocksStatic::TriP1::testJacobianTaylorSeries", "[TwoBlocksStatic]
 TEST_CASE("TwoBlocksStatic::TriP1::testJacobianFiniteDiff", "[TwoBlocksStatic][TriP1][Jacobian finite difference]") {
     pylith::TestFaultKin(pylith::TwoBlocksStatic::TriP1()).testJacobianFiniteDiff();
 }
+TEST_CASE("TwoBlocksStatic::TriP1::testOverlappedAssembly", "[TwoBlocksStatic][TriP1][overlapped assembly]") {
+    pylith::TestFaultKin(pylith::TwoBlocksStatic::TriP1()).testOverlappedAssembly();
+}
 
 // TriP2
 TEST_CASE("TwoBlocksStatic::TriP2::testDiscretization", "[TwoBlocksStatic][TriP2][discretization]") {
@@ -23,6 +23,33 @@
 
 #include "catch2/catch_test_macros.hpp"
 
+namespace pylith {
+    // Time-dependent body force that is zero at the start time; only used to check the linear fast path is excluded.
+    static
+    void timeDependentBodyForce(const PylithInt dim,
+                                const PylithInt numS,
+                                const PylithInt numA,
+                                const PylithInt sOff[],
+                                const PylithInt sOff_x[],
+                                const PylithScalar s[],
+                                const PylithScalar s_t[],
+                                const PylithScalar s_x[],
+                                const PylithInt aOff[],
+                                const PylithInt aOff_x[],
+                                const PylithScalar a[],
+                                const PylithScalar a_t[],
+                                const PylithScalar a_x[],
+                                const PylithReal t,
+                                const PylithScalar x[],
+                                const PylithInt numConstants,
+                                const PylithScalar constants[],
+                                PylithScalar f0[]) {
+        for (PylithInt i = 0; i < dim; ++i) {
+            f0[i] += 0.0 * t;
+        } // for
+    } // timeDependentBodyForce
+} // pylith
+
 // ------------------------------------------------------------------------------------------------
 #include "UniformStrain2D.hh"
 // TriP1
@@ -38,6 +65,26 @@ TEST_CASE("UniformStrain2D::TriP1::testJacobianTaylorSeries", "[UniformStrain2D]
 TEST_CASE("UniformStrain2D::TriP1::testJacobianFiniteDiff", "[UniformStrain2D][TriP1][Jacobian finite difference]") {
     pylith::TestLinearElasticity(pylith::UniformStrain2D::TriP1()).testJacobianFiniteDiff();
 }
+TEST_CASE("UniformStrain2D::TriP1::testLinearFastPath", "[UniformStrain2D][TriP1][linear fast path]") {
+    pylith::TestLinearElasticity(pylith::UniformStrain2D::TriP1()).testLinearFastPath();
+}
+TEST_CASE("UniformStrain2D::TriP1::testLinearFastPathExcluded", "[UniformStrain2D][TriP1][linear fast path]") {
+    pylith::TestLinearElasticity_Data* data = pylith::UniformStrain2D::TriP1();assert(data);
+    std::vector<pylith::feassemble::IntegratorDomain::ResidualKernels> mmsKernels(1);
+    mmsKernels[0] = pylith::feassemble::IntegratorDomain::ResidualKernels("displacement", pylith::feassemble::Integrator::LHS,
+                                                                          pylith::timeDependentBodyForce, NULL);
+    data->material.setMMSBodyForceKernels(mmsKernels);
+    pylith::TestLinearElasticity(data).testLinearFastPathExcluded();
+}
+TEST_CASE("UniformStrain2D::TriP1::testReinitialize", "[UniformStrain2D][TriP1][reinitialize]") {
+    pylith::TestLinearElasticity(pylith::UniformStrain2D::TriP1()).testReinitialize();
+}
+TEST_CASE("UniformStrain2D::TriP1::testJacobianAction", "[UniformStrain2D][TriP1][Jacobian action]") {
+    pylith::TestLinearElasticity(pylith::UniformStrain2D::TriP1()).testJacobianAction();
+}
+TEST_CASE("UniformStrain2D::TriP1::testOverlappedAssembly", "[UniformStrain2D][TriP1][overlapped assembly]") {
+    pylith::TestLinearElasticity(pylith::UniformStrain2D::TriP1()).testOverlappedAssembly();
+}
 
 // TriP2
 TEST_CASE("UniformStrain2D::TriP2::testDiscretization", "[UniformStrain2D][TriP2][discretization]") {
@@ -80,6 +127,12 @@ TEST_CASE("UniformStrain2D::QuadQ1::testJacobianTaylorSeries", "[UniformStrain2D
 TEST_CASE("UniformStrain2D::QuadQ1::testJacobianFiniteDiff", "[UniformStrain2D][QuadQ1][Jacobian finite difference]") {
     pylith::TestLinearElasticity(pylith::UniformStrain2D::QuadQ1()).testJacobianFiniteDiff();
 }
+TEST_CASE("UniformStrain2D::QuadQ1::testJacobianAction", "[UniformStrain2D][QuadQ1][Jacobian action]") {
+    pylith::TestLinearElasticity(pylith::UniformStrain2D::QuadQ1()).testJacobianAction();
+}
+TEST_CASE("UniformStrain2D::QuadQ1::testOverlappedAssembly", "[UniformStrain2D][QuadQ1][overlapped assembly]") {
+    pylith::TestLinearElasticity(pylith::UniformStrain2D::QuadQ1()).testOverlappedAssembly();
+}
 
 // QuadQ2
 TEST_CASE("UniformStrain2D::QuadQ2::testDiscretization", "[UniformStrain2D][QuadQ2][discretization]") {
@@ -410,4 +463,9 @@ TEST_CASE("PlanePWave2D::QuadQ4::testResidual", "[PlanePWave2D][QuadQ4][residual
     pylith::TestLinearElasticity(pylith::PlanePWave2D::QuadQ4()).testResidual();
 }
 
+// QuadQ1Distorted (cells with different stable time steps)
+TEST_CASE("PlanePWave2D::QuadQ1Distorted::testLocalTimeStepping", "[PlanePWave2D][QuadQ1Distorted][local time stepping]") {
+    pylith::TestLinearElasticity(pylith::PlanePWave2D::QuadQ1Distorted()).testLocalTimeStepping();
+}
+
 // End of file
@@ -0,0 +1,49 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/apps/TestEnsembleApp.py
+#
+# @brief Unit testing of Python EnsembleApp object.
+
+import unittest
+
+from pylith.apps.EnsembleApp import (EnsembleApp, EnsembleMemberApp)
+from pylith.testing.UnitTestApp import configureComponent
+
+
+class TestEnsembleApp(unittest.TestCase):
+    """Unit testing of EnsembleApp object.
+    """
+
+    def test_constructor(self):
+        app = EnsembleApp()
+        self.assertEqual(1, app.numGroups)
+        self.assertEqual(0, app.groupIndex)
+
+    def test_member_argv(self):
+        args = ["base.cfg", "member_001.cfg"]
+        member = EnsembleMemberApp(args, mesh=None, lengthScale=1.0, eventLogger=None)
+        self.assertEqual(args, member.getArgv())
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestEnsembleApp))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
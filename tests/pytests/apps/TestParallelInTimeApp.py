@@ -0,0 +1,44 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/apps/TestParallelInTimeApp.py
+#
+# @brief Unit testing of Python ParallelInTimeApp object.
+
+import unittest
+
+from pylith.apps.ParallelInTimeApp import ParallelInTimeApp
+
+
+class TestParallelInTimeApp(unittest.TestCase):
+    """Unit testing of ParallelInTimeApp object.
+    """
+
+    def test_constructor(self):
+        app = ParallelInTimeApp()
+        self.assertEqual(1, app.numGroups)
+        self.assertEqual(0, app.groupIndex)
+        self.assertIsNone(app.timeComm)
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestParallelInTimeApp))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
@@ -21,7 +21,7 @@
 
 import unittest
 
-from pylith.apps.PetscApplication import PetscApplication
+from pylith.apps.PetscApplication import (PetscApplication, parseParameterFile, bcastParameterFiles)
 from pylith.testing.UnitTestApp import configureComponent
 
 
@@ -32,6 +32,62 @@ class TestPetscApplication(unittest.TestCase):
     def test_constructor(self):
         app = PetscApplication()
 
+    CFG = (
+        "[pylithapp]\n"
+        "dump_parameters.filename = output/step01-parameters.json\n"
+        "\n"
+        "# Comment\n"
+        "[pylithapp.problem]\n"
+        "formulation = dynamic\n"
+        "bc = [bc_xneg,\n"
+        "      bc_xpos]\n"
+        "\n"
+        "[pylithinfo]\n"
+        "verbose = True\n"
+    )
+
+    def test_parseParameterFile(self):
+        root = parseParameterFile("step01.cfg", self.CFG)
+        app = root.getFacility("pylithapp")
+        self.assertTrue(app)
+        problem = app.getFacility("problem")
+        self.assertTrue(problem)
+        descriptor = problem.properties["formulation"]
+        self.assertEqual("dynamic", descriptor.value)
+        locator = str(descriptor.locator)
+        self.assertIn("step01.cfg", locator)
+        self.assertIn("6", locator)
+        self.assertEqual("[bc_xneg,\nbc_xpos]", problem.properties["bc"].value.replace(" ", ""))
+
+    def test_bcastParameterFiles(self):
+        """Broadcast contents of parameter files over PETSC_COMM_WORLD.
+
+        Run the tests with mpiexec to test the broadcast across processes.
+        """
+        import os
+        import tempfile
+        from pylith.mpi.Communicator import petsc_comm_world
+
+        comm = petsc_comm_world()
+        filename = ""
+        if comm.rank == 0:
+            with tempfile.NamedTemporaryFile(mode="w", suffix=".cfg", delete=False) as fout:
+                fout.write(self.CFG)
+            filename = fout.name
+        from pylith.mpi import mpi
+        filename = mpi.bcast_string(filename, 0, comm.handle)
+        try:
+            files = bcastParameterFiles([filename, "missing.cfg"], comm)
+        finally:
+            comm.barrier()
+            if comm.rank == 0:
+                os.remove(filename)
+        self.assertEqual(2, len(files))
+        self.assertEqual((filename, self.CFG, ""), files[0])
+        self.assertEqual("missing.cfg", files[1][0])
+        self.assertEqual("", files[1][1])
+        self.assertIn("missing.cfg", files[1][2])
+
 
 if __name__ == "__main__":
     suite = unittest.TestSuite()
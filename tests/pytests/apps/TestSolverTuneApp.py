@@ -0,0 +1,76 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/apps/TestSolverTuneApp.py
+#
+# @brief Unit testing of Python SolverTuneApp functions.
+
+import unittest
+
+from pylith.apps.SolverTuneApp import (createVariants, parseSweep, parseConvergence, DEFAULT_SWEEPS)
+
+
+class TestSolverTuneApp(unittest.TestCase):
+    """Unit testing of SolverTuneApp functions.
+    """
+
+    def test_createVariants(self):
+        options = {
+            "pc_type": "fieldsplit",
+            "fs_pc_fieldsplit_schur_factorization_type": "upper",
+            "fs_fieldsplit_displacement_pc_type": "gamg",
+        }
+        variants = createVariants(options, DEFAULT_SWEEPS)
+        self.assertEqual({}, variants[0])
+        self.assertIn({"fs_fieldsplit_displacement_pc_gamg_threshold": "0.05"}, variants)
+        self.assertIn({"fs_pc_fieldsplit_schur_factorization_type": "full"}, variants)
+        self.assertNotIn({"fs_pc_fieldsplit_schur_factorization_type": "upper"}, variants)
+        self.assertEqual(1+2+2+3, len(variants))
+
+        self.assertEqual([{}], createVariants({"pc_type": "lu"}, DEFAULT_SWEEPS))
+
+    def test_parseSweep(self):
+        sweep = parseSweep("ksp_rtol=1.0e-8,1.0e-10")
+        self.assertEqual([{}, {"ksp_rtol": "1.0e-10"}], createVariants({"ksp_rtol": "1.0e-8"}, [sweep]))
+        with self.assertRaises(ValueError):
+            parseSweep("ksp_rtol")
+
+    def test_parseConvergence(self):
+        lines = [
+            "  Linear solve converged due to CONVERGED_ATOL iterations 12",
+            "    Linear fs_fieldsplit_displacement_ solve converged due to CONVERGED_RTOL iterations 3",
+            "  Linear solve converged due to CONVERGED_RTOL iterations 8",
+            "Nonlinear solve converged due to CONVERGED_FNORM_ABS iterations 2",
+        ]
+        info = parseConvergence(lines)
+        self.assertEqual(2, info["linear_solves"])
+        self.assertEqual(20, info["linear_iterations"])
+        self.assertEqual(1, info["nonlinear_solves"])
+        self.assertEqual(2, info["nonlinear_iterations"])
+        self.assertTrue(info["converged"])
+
+        info = parseConvergence(["Linear solve did not converge due to DIVERGED_ITS iterations 1000"])
+        self.assertFalse(info["converged"])
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestSolverTuneApp))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
@@ -1,13 +1,19 @@
 from .TestPetscApplication import TestPetscApplication
 from .TestPyLithApp import TestPyLithApp
+from .TestEnsembleApp import TestEnsembleApp
+from .TestParallelInTimeApp import TestParallelInTimeApp
 from .TestEqInfoApp import TestEqInfoApp
+from .TestSolverTuneApp import TestSolverTuneApp
 
 
 def test_classes():
     return [
         TestPetscApplication,
         TestPyLithApp,
+        TestEnsembleApp,
+        TestParallelInTimeApp,
         TestEqInfoApp,
+        TestSolverTuneApp,
     ]
 
 
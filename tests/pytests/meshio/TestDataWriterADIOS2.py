@@ -0,0 +1,41 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/meshio/TestDataWriterADIOS2.py
+#
+# @brief Unit testing of Python DataWriterADIOS2 object.
+
+import unittest
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.meshio.DataWriterADIOS2 import (DataWriterADIOS2, data_writer)
+
+
+class TestDataWriterADIOS2(TestComponent):
+    """Unit testing of DataWriterADIOS2 object.
+    """
+    _class = DataWriterADIOS2
+    _factory = data_writer
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestDataWriterADIOS2))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
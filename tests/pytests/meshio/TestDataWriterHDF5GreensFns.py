@@ -0,0 +1,41 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/meshio/TestDataWriterHDF5GreensFns.py
+#
+# @brief Unit testing of Python DataWriterHDF5GreensFns object.
+
+import unittest
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.meshio.DataWriterHDF5GreensFns import (DataWriterHDF5GreensFns, data_writer)
+
+
+class TestDataWriterHDF5GreensFns(TestComponent):
+    """Unit testing of DataWriterHDF5GreensFns object.
+    """
+    _class = DataWriterHDF5GreensFns
+    _factory = data_writer
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestDataWriterHDF5GreensFns))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
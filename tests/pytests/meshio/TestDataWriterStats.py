@@ -0,0 +1,41 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/meshio/TestDataWriterStats.py
+#
+# @brief Unit testing of Python DataWriterStats object.
+
+import unittest
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.meshio.DataWriterStats import (DataWriterStats, data_writer)
+
+
+class TestDataWriterStats(TestComponent):
+    """Unit testing of DataWriterStats object.
+    """
+    _class = DataWriterStats
+    _factory = data_writer
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestDataWriterStats))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
@@ -0,0 +1,90 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/meshio/TestExpressionDB.py
+#
+# @brief Unit testing of Python ExpressionDB object.
+
+import unittest
+
+import numpy
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.meshio.ExpressionDB import (ExpressionDB, spatial_database)
+
+
+class TestExpressionDB(TestComponent):
+    """Unit testing of ExpressionDB object.
+    """
+    _class = ExpressionDB
+    _factory = spatial_database
+
+    def test_query(self):
+        """Check query of values with units.
+        """
+        from spatialdata.geocoords.CSCart import CSCart
+        cs = CSCart()
+        cs.inventory.spaceDim = 2
+        cs._configure()
+
+        db = ExpressionDB()
+        db.inventory.values = ["one", "two"]
+        # Pyre splits lists at the commas separating arguments of functions.
+        db.inventory.expressions = ["2 + 3*x - y", "if(x > 1", " x + y", " 0)"]
+        db.inventory.units = ["none", "km"]
+        db.inventory.coordsys = cs
+        db._configure()
+        self.assertEqual(["2 + 3*x - y", "if(x > 1, x + y, 0)"], db.expressions)
+
+        points = numpy.array([[0.5, -1.0], [2.5, 3.5], [3.0, 4.0], [0.0, -2.0]], dtype=numpy.float64)
+        valuesE = numpy.array([2.0 + 3.0 * points[:, 0] - points[:, 1],
+                               1.0e+3 * numpy.where(points[:, 0] > 1, points[:, 0] + points[:, 1], 0.0)]).T
+        values = numpy.zeros(valuesE.shape, dtype=numpy.float64)
+        err = numpy.zeros((points.shape[0],), dtype=numpy.int32)
+        db.open()
+        db.setQueryValues(["two", "one"])
+        db.multiquery(values, err, points, cs)
+        db.close()
+        self.assertEqual(0, numpy.sum(err))
+        numpy.testing.assert_allclose(valuesE[:, ::-1], values, rtol=1.0e-12)
+
+    def test_errors(self):
+        """Check errors in configuration and expressions.
+        """
+        db = ExpressionDB()
+        db.inventory.values = ["one", "two"]
+        db.inventory.expressions = ["x"]
+        db.inventory.units = ["none", "none"]
+        with self.assertRaises(ValueError):
+            db._configure()
+
+        db = ExpressionDB()
+        db.inventory.values = ["one"]
+        db.inventory.expressions = ["2*w"]
+        db.inventory.units = ["none"]
+        db._configure()
+        with self.assertRaises(RuntimeError):
+            db.open()
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestExpressionDB))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
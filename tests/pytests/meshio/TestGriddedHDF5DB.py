@@ -0,0 +1,135 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/meshio/TestGriddedHDF5DB.py
+#
+# @brief Unit testing of Python GriddedHDF5DB object.
+
+import os
+import unittest
+
+import numpy
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.meshio.GriddedHDF5DB import (GriddedHDF5DB, spatial_database, write)
+
+
+class TestGriddedHDF5DB(TestComponent):
+    """Unit testing of GriddedHDF5DB object.
+    """
+    _class = GriddedHDF5DB
+    _factory = spatial_database
+
+    FILENAME = "griddedhdf5db_test.h5"
+
+    def tearDown(self):
+        if os.path.exists(self.FILENAME):
+            os.remove(self.FILENAME)
+
+    def test_query(self):
+        """Write small grid with linear variation in values and check linear and nearest queries.
+        """
+        x = numpy.array([0.0, 1.0, 3.0], dtype=numpy.float64)
+        y = numpy.array([-2.0, 0.0, 2.0, 4.0], dtype=numpy.float64)
+        xx, yy = numpy.meshgrid(x, y, indexing="ij")
+        write(self.FILENAME, {
+            "x": x,
+            "y": y,
+            "values": [
+                {"name": "one", "units": "none", "data": 2.0 + 3.0 * xx - yy},
+                {"name": "two", "units": "km", "data": xx + yy},
+            ],
+        })
+
+        from spatialdata.geocoords.CSCart import CSCart
+        cs = CSCart()
+        cs.inventory.spaceDim = 2
+        cs._configure()
+
+        db = GriddedHDF5DB()
+        db.inventory.filename = self.FILENAME
+        db.inventory.blockSize = 1
+        db.inventory.coordsys = cs
+        db._configure()
+
+        points = numpy.array([[0.5, -1.0], [2.5, 3.5], [3.0, 4.0], [0.0, -2.0]], dtype=numpy.float64)
+        valuesE = numpy.array([2.0 + 3.0 * points[:, 0] - points[:, 1], 1.0e+3 * (points[:, 0] + points[:, 1])]).T
+        values = numpy.zeros(valuesE.shape, dtype=numpy.float64)
+        err = numpy.zeros((points.shape[0],), dtype=numpy.int32)
+        db.open()
+        db.setQueryValues(["one", "two"])
+        db.multiquery(values, err, points, cs)
+        db.close()
+        self.assertEqual(0, numpy.sum(err))
+        numpy.testing.assert_allclose(valuesE, values, rtol=1.0e-12)
+
+        # Points outside grid.
+        pointsOutside = numpy.array([[-0.1, 0.0], [1.0, 4.1]], dtype=numpy.float64)
+        values = numpy.zeros((2, 2), dtype=numpy.float64)
+        err = numpy.zeros((2,), dtype=numpy.int32)
+        db.open()
+        db.setQueryValues(["one", "two"])
+        db.multiquery(values, err, pointsOutside, cs)
+        db.close()
+        self.assertTrue(numpy.all(err != 0))
+
+    def test_shared_memory(self):
+        """Write small 3D grid and check linear queries with values in shared memory.
+        """
+        x = numpy.array([0.0, 1.0, 3.0], dtype=numpy.float64)
+        y = numpy.array([-2.0, 0.0, 2.0, 4.0], dtype=numpy.float64)
+        z = numpy.array([-5.0, 0.0], dtype=numpy.float64)
+        xx, yy, zz = numpy.meshgrid(x, y, z, indexing="ij")
+        write(self.FILENAME, {
+            "x": x,
+            "y": y,
+            "z": z,
+            "values": [
+                {"name": "one", "units": "none", "data": 2.0 + 3.0 * xx - yy + 0.5 * zz},
+            ],
+        })
+
+        from spatialdata.geocoords.CSCart import CSCart
+        cs = CSCart()
+        cs.inventory.spaceDim = 3
+        cs._configure()
+
+        db = GriddedHDF5DB()
+        db.inventory.filename = self.FILENAME
+        db.inventory.sharedMemory = True
+        db.inventory.coordsys = cs
+        db._configure()
+
+        points = numpy.array([[0.5, -1.0, -1.0], [2.5, 3.5, -4.0], [3.0, 4.0, 0.0]], dtype=numpy.float64)
+        valuesE = numpy.array([2.0 + 3.0 * points[:, 0] - points[:, 1] + 0.5 * points[:, 2]]).T
+        values = numpy.zeros(valuesE.shape, dtype=numpy.float64)
+        err = numpy.zeros((points.shape[0],), dtype=numpy.int32)
+        db.open()
+        db.setQueryValues(["one"])
+        db.multiquery(values, err, points, cs)
+        db.close()
+        self.assertEqual(0, numpy.sum(err))
+        numpy.testing.assert_allclose(valuesE, values, rtol=1.0e-12)
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestGriddedHDF5DB))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
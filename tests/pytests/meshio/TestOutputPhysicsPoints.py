@@ -0,0 +1,41 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/meshio/TestOutputPhysicsPoints.py
+#
+# @brief Unit testing of Python OutputPhysicsPoints object.
+
+import unittest
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.meshio.OutputPhysicsPoints import (OutputPhysicsPoints, observer)
+
+
+class TestOutputPhysicsPoints(TestComponent):
+    """Unit testing of OutputPhysicsPoints object.
+    """
+    _class = OutputPhysicsPoints
+    _factory = observer
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestOutputPhysicsPoints))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
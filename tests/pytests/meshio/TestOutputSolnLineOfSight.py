@@ -0,0 +1,41 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/meshio/TestOutputSolnLineOfSight.py
+#
+# @brief Unit testing of Python OutputSolnLineOfSight object.
+
+import unittest
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.meshio.OutputSolnLineOfSight import (OutputSolnLineOfSight, observer)
+
+
+class TestOutputSolnLineOfSight(TestComponent):
+    """Unit testing of OutputSolnLineOfSight object.
+    """
+    _class = OutputSolnLineOfSight
+    _factory = observer
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestOutputSolnLineOfSight))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
@@ -0,0 +1,41 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/meshio/TestOutputTriggerChange.py
+#
+# @brief Unit testing of Python OutputTriggerChange object.
+
+import unittest
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.meshio.OutputTriggerChange import (OutputTriggerChange, output_trigger)
+
+
+class TestOutputTriggerChange(TestComponent):
+    """Unit testing of OutputTriggerChange object.
+    """
+    _class = OutputTriggerChange
+    _factory = output_trigger
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestOutputTriggerChange))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
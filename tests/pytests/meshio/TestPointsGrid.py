@@ -0,0 +1,41 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/meshio/TestPointsGrid.py
+#
+# @brief Unit testing of Python PointsGrid object.
+
+import unittest
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.meshio.PointsGrid import (PointsGrid, points_list)
+
+
+class TestPointsGrid(TestComponent):
+    """Unit testing of PointsGrid object.
+    """
+    _class = PointsGrid
+    _factory = points_list
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestPointsGrid))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
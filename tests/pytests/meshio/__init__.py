@@ -1,16 +1,27 @@
 from .TestDataWriter import TestDataWriter
 from .TestDataWriterVTK import TestDataWriterVTK
+from .TestDataWriterPVTU import TestDataWriterPVTU
+from .TestDataWriterStats import TestDataWriterStats
+from .TestExpressionDB import TestExpressionDB
 from .TestMeshIOAscii import TestMeshIOAscii
 from .TestOutputObserver import TestOutputObserver
 from .TestOutputPhysics import TestOutputPhysics
+from .TestOutputPhysicsCoulombStress import TestOutputPhysicsCoulombStress
+from .TestOutputPhysicsPoints import TestOutputPhysicsPoints
+from .TestOutputRuptureStats import TestOutputRuptureStats
 from .TestOutputSoln import TestOutputSoln
 from .TestOutputSolnDomain import TestOutputSolnDomain
 from .TestOutputSolnBoundary import TestOutputSolnBoundary
 from .TestOutputSolnPoints import TestOutputSolnPoints
+from .TestOutputSolnLineOfSight import TestOutputSolnLineOfSight
+from .TestOutputSolnRegion import TestOutputSolnRegion
 from .TestOutputTrigger import TestOutputTrigger
 from .TestOutputTriggerStep import TestOutputTriggerStep
 from .TestOutputTriggerTime import TestOutputTriggerTime
+from .TestOutputTriggerLogTime import TestOutputTriggerLogTime
+from .TestOutputTriggerChange import TestOutputTriggerChange
 from .TestPointsList import TestPointsList
+from .TestPointsGrid import TestPointsGrid
 
 
 def has_h5py():
@@ -22,6 +33,11 @@ def has_h5py():
     return flag
 
 
+def has_adios2():
+    from pylith.meshio import meshio
+    return hasattr(meshio, "DataWriterADIOS2")
+
+
 def has_netcdf():
     flag = True
     try:
@@ -35,17 +51,33 @@ def test_classes():
     classes = [
         TestDataWriter,
         TestDataWriterVTK,
+        TestDataWriterPVTU,
+        TestDataWriterStats,
+        TestExpressionDB,
         TestOutputObserver,
         TestOutputPhysics,
+        TestOutputPhysicsCoulombStress,
+        TestOutputPhysicsPoints,
+        TestOutputRuptureStats,
         TestOutputSoln,
         TestOutputSolnDomain,
         TestOutputSolnBoundary,
         TestOutputSolnPoints,
+        TestOutputSolnLineOfSight,
+        TestOutputSolnRegion,
         TestOutputTrigger,
         TestOutputTriggerStep,
         TestOutputTriggerTime,
+        TestOutputTriggerLogTime,
+        TestOutputTriggerChange,
         TestPointsList,
+        TestPointsGrid,
     ]
+    if has_adios2():
+        from .TestDataWriterADIOS2 import TestDataWriterADIOS2
+        classes += [
+            TestDataWriterADIOS2,
+        ]
     if has_netcdf():
         from .TestMeshIOCubit import TestMeshIOCubit
         classes += [
@@ -54,10 +86,14 @@ def test_classes():
     if has_h5py():
         from .TestDataWriterHDF5 import TestDataWriterHDF5
         from .TestDataWriterHDF5Ext import TestDataWriterHDF5Ext
+        from .TestDataWriterHDF5GreensFns import TestDataWriterHDF5GreensFns
+        from .TestGriddedHDF5DB import TestGriddedHDF5DB
         from .TestXdmf import TestXdmf
         classes += [
             TestDataWriterHDF5,
             TestDataWriterHDF5Ext,
+            TestDataWriterHDF5GreensFns,
+            TestGriddedHDF5DB,
             TestXdmf,
         ]
     return classes
@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+
+## @file tests/pytests/mpi/TestBcast.py
+
+## @brief Unit testing of MPI broadcast functions.
+
+import unittest
+
+import pylith.mpi.mpi as mpi
+
+# ----------------------------------------------------------------------
+class TestBcast(unittest.TestCase):
+  """Unit testing of MPI broadcast functions.
+  """
+  
+
+  def test_bcast_string(self):
+    value = "[pylithapp.problem]\nformulation = dynamic"
+    result = mpi.bcast_string(value, 0, mpi.petsc_comm_world())
+    self.assertEqual(value, result)
+
+    result = mpi.bcast_string("", 0, mpi.petsc_comm_world())
+    self.assertEqual("", result)
+    return
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestBcast))
+
+    from pylith.utils.PetscManager import PetscManager
+    petsc = PetscManager()
+    petsc.initialize()
+
+    success = unittest.TextTestRunner(verbosity=2).run(suite).wasSuccessful()
+
+    petsc.finalize()
+
+
+# End of file 
@@ -1,11 +1,13 @@
 from .TestCommunicator import TestCommunicator
 from .TestReduce import TestReduce
+from .TestBcast import TestBcast
 
 
 def test_classes():
     classes = [
         TestCommunicator,
         TestReduce,
+        TestBcast,
     ]
     return classes
 
@@ -0,0 +1,41 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/problems/TestProgressMonitorTelemetry.py
+#
+# @brief Unit testing of Python ProgressMonitorTelemetry object.
+
+import unittest
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.problems.ProgressMonitorTelemetry import (ProgressMonitorTelemetry, progress_monitor)
+
+
+class TestProgressMonitorTelemetry(TestComponent):
+    """Unit testing of ProgressMonitorTelemetry object.
+    """
+    _class = ProgressMonitorTelemetry
+    _factory = progress_monitor
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestProgressMonitorTelemetry))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
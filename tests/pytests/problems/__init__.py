@@ -1,5 +1,7 @@
+from .TestCouplerBoundary import TestCouplerBoundary
 from .TestInitialCondition import TestInitialCondition
 from .TestInitialConditionDomain import TestInitialConditionDomain
+from .TestInitialConditionFile import TestInitialConditionFile
 from .TestInitialConditionPatch import TestInitialConditionPatch
 from .TestPhysics import TestPhysics
 from .TestProblem import TestProblem
@@ -7,6 +9,7 @@ from .TestTimeDependent import TestTimeDependent
 from .TestProblemDefaults import TestProblemDefaults
 from .TestProgressMonitor import TestProgressMonitor
 from .TestProgressMonitorTime import TestProgressMonitorTime
+from .TestProgressMonitorTelemetry import TestProgressMonitorTelemetry
 from .TestSingleObserver import (TestSinglePhysicsObserver, TestSingleSolnObserver)
 from .TestSolution import TestSolution
 from .TestSolnDisp import TestSolnDisp
@@ -27,8 +30,10 @@ from .TestSubfieldVelocity import TestSubfieldVelocity
 
 def test_classes():
     classes = [
+        TestCouplerBoundary,
         TestInitialCondition,
         TestInitialConditionDomain,
+        TestInitialConditionFile,
         TestInitialConditionPatch,
         TestPhysics,
         TestProblem,
@@ -36,6 +41,7 @@ def test_classes():
         TestProblemDefaults,
         TestProgressMonitorTime,
         TestProgressMonitorTime,
+        TestProgressMonitorTelemetry,
         TestSingleSolnObserver,
         TestSinglePhysicsObserver,
         TestSolution,
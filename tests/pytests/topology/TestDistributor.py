@@ -20,17 +20,85 @@
 # @brief Unit testing of Python Distributor object.
 
 import unittest
+from types import SimpleNamespace
+
+import numpy
 
 from pylith.testing.UnitTestApp import TestComponent
 from pylith.topology.Distributor import (Distributor, mesh_distributor)
 
 
+class Components(object):
+    """Container of components with the same interface as a Pyre facility array.
+    """
+
+    def __init__(self, components):
+        self._components = components
+
+    def components(self):
+        return self._components
+
+
+class MeshStub(object):
+    """Mesh with only the dimension.
+    """
+
+    def getDimension(self):
+        return 2
+
+
 class TestDistributor(TestComponent):
     """Unit testing of Distributor object.
     """
     _class = Distributor
     _factory = mesh_distributor
 
+    def test_cell_weights_disabled(self):
+        distributor = Distributor()
+        distributor.useCellWeights = False
+        materialIds, materialWeights, faultWeights = distributor._getCellWeights(MeshStub(), self._problem())
+        self.assertEqual(0, materialIds.size)
+        self.assertEqual(0, materialWeights.size)
+        self.assertEqual(0, faultWeights.size)
+
+    def test_cell_weights(self):
+        distributor = Distributor()
+        distributor.useCellWeights = True
+        materialIds, materialWeights, faultWeights = distributor._getCellWeights(MeshStub(), self._problem())
+
+        # Costs are 9 and 15 for the materials and 13 for the fault; weights are scaled so the minimum cost is 10.
+        numpy.testing.assert_array_equal([1, 2], materialIds)
+        numpy.testing.assert_array_equal([10, 17], materialWeights)
+        numpy.testing.assert_array_equal([14], faultWeights)
+        self.assertEqual(numpy.int32, materialIds.dtype)
+        self.assertEqual(numpy.int32, materialWeights.dtype)
+        self.assertEqual(numpy.int32, faultWeights.dtype)
+
+    def _problem(self):
+        """Create problem with two materials and one fault in 2D.
+
+        material 1: 6 solution values (displacement, basis order 1), 3 auxiliary values (basis order 0).
+        material 2: Same as material 1 plus 6 auxiliary values (2 subfields, basis order 1) in the rheology.
+        fault: 2*4 displacement values, 4 Lagrange multiplier values, and 1 auxiliary value.
+        """
+        def subfield(name, basisOrder):
+            return SimpleNamespace(fieldName=name, basisOrder=basisOrder)
+
+        solution = SimpleNamespace(subfields=Components([
+            subfield("displacement", 1),
+            subfield("lagrange_multiplier_fault", 1),
+        ]))
+        auxElastic = Components([SimpleNamespace(basisOrder=0) for i in range(3)])
+        materialA = SimpleNamespace(labelValue=1, auxiliarySubfields=auxElastic)
+        materialB = SimpleNamespace(labelValue=2, auxiliarySubfields=auxElastic, rheology=SimpleNamespace(
+            auxiliarySubfields=Components([SimpleNamespace(basisOrder=1) for i in range(2)])))
+        fault = SimpleNamespace(auxiliarySubfields=Components([SimpleNamespace(basisOrder=0)]))
+        return SimpleNamespace(
+            solution=solution,
+            materials=Components([materialA, materialB]),
+            interfaces=Components([fault]),
+        )
+
 
 if __name__ == "__main__":
     suite = unittest.TestSuite()
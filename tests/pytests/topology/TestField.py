@@ -34,6 +34,12 @@ class TestField(unittest.TestCase):
         field = Field(mesh)
         self.assertTrue(not field is None)
 
+    def test_getLocalArray(self):
+        mesh = Mesh()
+        field = Field(mesh)
+        with self.assertRaises(RuntimeError):
+            field.getLocalArray()
+
 
 if __name__ == "__main__":
     suite = unittest.TestSuite()
@@ -5,6 +5,7 @@ from .TestMeshGenerator import TestMeshGenerator
 from .TestMeshImporter import TestMeshImporter
 from .TestMeshRefiner import TestMeshRefiner
 from .TestRefineUniform import TestRefineUniform
+from .TestRefineAdaptive import TestRefineAdaptive
 from .TestReverseCuthillMcKee import TestReverseCuthillMcKee
 from .TestSubfield import TestSubfield
 
@@ -18,6 +19,7 @@ def test_classes():
         TestMeshImporter,
         TestMeshRefiner,
         TestRefineUniform,
+        TestRefineAdaptive,
         TestReverseCuthillMcKee,
         TestSubfield,
     ]
@@ -21,6 +21,8 @@
 #include "tests/src/MMSTest.hh" // implementation of class methods
 #include "pylith/problems/TimeDependent.hh" // USES TimeDependent
 #include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/feassemble/IntegratorDomain.hh" // USES IntegratorDomain
+#include "pylith/feassemble/Constraint.hh" // USES Constraint
 #include "pylith/utils/PetscOptions.hh" // USES PetscOptions
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
@@ -35,6 +37,8 @@
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
 
+#include <algorithm> // USES std::min_element(), std::max_element()
+
 // ------------------------------------------------------------------------------------------------
 // Constructor.
 pylith::testing::MMSTest::MMSTest(void) :
@@ -46,7 +50,8 @@ pylith::testing::MMSTest::MMSTest(void) :
     _jacobianConvergenceRate(0.0),
     _tolerance(1.0e-9),
     _isJacobianLinear(false),
-    _allowZeroResidual(false) {
+    _allowZeroResidual(false),
+    _solverType(pylith::problems::Problem::NONLINEAR) {
     GenericComponent::setName("mmstest"); // Override in child class for finer control of journal output.
 
     assert(_problem);
@@ -209,6 +214,393 @@ pylith::testing::MMSTest::testJacobianFiniteDiff(void) {
 } // testJacobianFiniteDiff
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify rate groups for local time stepping.
+void
+pylith::testing::MMSTest::testLocalTimeStepping(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    _initialize();
+    REQUIRE(pylith::problems::Physics::DYNAMIC == _problem->getFormulation());
+
+    const pylith::topology::Field* solution = _problem->getSolution();assert(solution);
+    PetscDM dm = solution->getDM();assert(dm);
+    PetscTS ts = _problem->getPetscTS();assert(ts);
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PetscInt> cells;
+    std::vector<PylithReal> dtStable;
+    for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+        const pylith::feassemble::IntegratorDomain* integrator =
+            dynamic_cast<pylith::feassemble::IntegratorDomain*>(_problem->_integrators[i]);
+        if (!integrator) { continue; }
+        std::vector<PetscInt> integratorCells;
+        std::vector<PylithReal> integratorDtStable;
+        integrator->computeStableTimeSteps(&integratorCells, &integratorDtStable);
+        cells.insert(cells.end(), integratorCells.begin(), integratorCells.end());
+        dtStable.insert(dtStable.end(), integratorDtStable.begin(), integratorDtStable.end());
+    } // for
+    REQUIRE(cells.size() > 0);
+
+    // Use a time step between the smallest and largest stable time steps, so cells fall in both rate groups.
+    const PylithReal dtStableMinE = *std::min_element(dtStable.begin(), dtStable.end());
+    const PylithReal dtStableMaxE = *std::max_element(dtStable.begin(), dtStable.end());
+    INFO("Local time stepping test requires cells with different stable time steps.");
+    REQUIRE(dtStableMinE < dtStableMaxE);
+    const PylithReal dt = 0.5 * (dtStableMinE + dtStableMaxE);
+    err = TSSetTimeStep(ts, dt);PYLITH_CHECK_ERROR(err);
+
+    std::vector<int> isFastPointE(pEnd-pStart, 0);
+    for (size_t iCell = 0; iCell < cells.size(); ++iCell) {
+        if (dtStable[iCell] >= dt) { continue; }
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        err = DMPlexGetTransitiveClosure(dm, cells[iCell], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+            isFastPointE[closure[2*iPoint]-pStart] = 1;
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dm, cells[iCell], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PylithReal dtStableMin = 0.0;
+    REQUIRE(_problem->_setupLocalTimeStepping(&dtStableMin));
+    CHECK(dtStableMinE == dtStableMin);
+
+    // Rate groups must partition the unconstrained degrees of freedom.
+    PetscSection globalSection = NULL;
+    err = DMGetGlobalSection(dm, &globalSection);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> indicesE[2]; // slow, fast
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, cdof = 0, off = 0;
+        err = PetscSectionGetDof(globalSection, point, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof <= 0) { continue; }
+        err = PetscSectionGetConstraintDof(globalSection, point, &cdof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(globalSection, point, &off);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iDof = 0; iDof < dof-cdof; ++iDof) {
+            indicesE[isFastPointE[point-pStart]].push_back(off+iDof);
+        } // for
+    } // for
+    const char* splitNames[2] = { "slow", "fast" };
+    for (size_t iGroup = 0; iGroup < 2; ++iGroup) {
+        PetscIS splitIS = NULL;
+        PetscInt splitSize = 0;
+        const PetscInt* splitIndices = NULL;
+        err = TSRHSSplitGetIS(ts, splitNames[iGroup], &splitIS);PYLITH_CHECK_ERROR(err);
+        REQUIRE(splitIS);
+        err = ISGetLocalSize(splitIS, &splitSize);PYLITH_CHECK_ERROR(err);
+        INFO("Checking degrees of freedom in " << splitNames[iGroup] << " rate group.");
+        REQUIRE(size_t(splitSize) == indicesE[iGroup].size());
+        err = ISGetIndices(splitIS, &splitIndices);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < splitSize; ++i) {
+            CHECK(indicesE[iGroup][i] == splitIndices[i]);
+        } // for
+        err = ISRestoreIndices(splitIS, &splitIndices);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Residual for fast rate group must match full residual for degrees of freedom in fast rate group.
+    const PylithReal t = _problem->getStartTime();
+    err = DMComputeExactSolution(dm, t, _solutionExactVec, _solutionDotExactVec);PYLITH_CHECK_ERROR(err);
+    PetscVec residualVec = NULL;
+    PetscVec residualFastVec = NULL;
+    err = VecDuplicate(_solutionExactVec, &residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(_solutionExactVec, &residualFastVec);PYLITH_CHECK_ERROR(err);
+    _problem->_computeRHSResidual(residualVec, t, dt, _solutionExactVec, false);
+    _problem->_computeRHSResidual(residualFastVec, t, dt, _solutionExactVec, true);
+
+    PetscIS fastIS = NULL;
+    PetscVec fastVec = NULL;
+    PetscVec fastFastVec = NULL;
+    PylithReal norm = 0.0;
+    PylithReal normDiff = 0.0;
+    err = TSRHSSplitGetIS(ts, "fast", &fastIS);PYLITH_CHECK_ERROR(err);
+    err = VecGetSubVector(residualVec, fastIS, &fastVec);PYLITH_CHECK_ERROR(err);
+    err = VecGetSubVector(residualFastVec, fastIS, &fastFastVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(fastVec, NORM_2, &norm);PYLITH_CHECK_ERROR(err);
+    err = VecAXPY(fastFastVec, -1.0, fastVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(fastFastVec, NORM_2, &normDiff);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreSubVector(residualFastVec, fastIS, &fastFastVec);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreSubVector(residualVec, fastIS, &fastVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualFastVec);PYLITH_CHECK_ERROR(err);
+
+    REQUIRE(norm > 0.0);
+    INFO("|G_fast(s) - G(s)| == " << normDiff << " over fast rate group with |G(s)| == " << norm);
+    CHECK_THAT(normDiff, Catch::Matchers::WithinAbs(0.0, 1.0e-12*norm));
+
+    PYLITH_METHOD_END;
+} // testLocalTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify residual from linear fast path.
+void
+pylith::testing::MMSTest::testLinearFastPath(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    _initializeLinearFastPath();
+    REQUIRE(_problem->_canUseLinearFastPath());
+    _problem->_useLinearFastPath = true;
+
+    PetscTS ts = _problem->getPetscTS();assert(ts);
+    PetscErrorCode err = PETSC_SUCCESS;
+    const PylithReal t = _problem->getStartTime();
+    PylithReal dt = 0.0;
+    err = TSGetTimeStep(ts, &dt);PYLITH_CHECK_ERROR(err);
+
+    // Form Jacobian in the matrix used by the time stepper.
+    PetscMat jacobianMat = NULL;
+    err = DMCreateMatrix(_problem->getPetscDM(), &jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = TSSetIJacobian(ts, jacobianMat, jacobianMat, pylith::problems::TimeDependent::computeLHSJacobian,
+                         (void*)_problem);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err); // TS holds reference.
+    err = TSGetIJacobian(ts, &jacobianMat, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    err = DMComputeExactSolution(_problem->getPetscDM(), t, _solutionExactVec, _solutionDotExactVec);PYLITH_CHECK_ERROR(err);
+    _problem->computeLHSJacobian(jacobianMat, jacobianMat, t, dt, 1.0/dt, _solutionExactVec, _solutionDotExactVec);
+    REQUIRE(_problem->_numJacobians > 0);
+
+    // Use random solution so J*s does not vanish.
+    PetscVec solutionVec = NULL;
+    PetscRandom random = NULL;
+    err = VecDuplicate(_solutionExactVec, &solutionVec);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomCreate(PETSC_COMM_WORLD, &random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomSetSeed(random, 43);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomSeed(random);PYLITH_CHECK_ERROR(err);
+    err = VecSetRandom(solutionVec, random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomDestroy(&random);PYLITH_CHECK_ERROR(err);
+
+    PetscVec residualVec = NULL;
+    PetscVec residualFastVec = NULL;
+    err = VecDuplicate(solutionVec, &residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &residualFastVec);PYLITH_CHECK_ERROR(err);
+    _problem->_useLinearFastPath = false;
+    _problem->computeLHSResidual(residualVec, t, dt, solutionVec, _solutionDotExactVec);
+    _problem->_useLinearFastPath = true;
+    _problem->computeLHSResidual(residualFastVec, t, dt, solutionVec, _solutionDotExactVec);
+    REQUIRE(_problem->_linearLoad); // Residual must come from the fast path.
+
+    PylithReal norm = 0.0;
+    PylithReal normDiff = 0.0;
+    err = VecNorm(residualVec, NORM_2, &norm);PYLITH_CHECK_ERROR(err);
+    err = VecAXPY(residualFastVec, -1.0, residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(residualFastVec, NORM_2, &normDiff);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualFastVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+
+    REQUIRE(norm > 0.0);
+    INFO("|F_linear(s) - F(s)| == " << normDiff << " with |F(s)| == " << norm);
+    CHECK_THAT(normDiff, Catch::Matchers::WithinAbs(0.0, 1.0e-10*norm));
+
+    // Time-dependent residual in any material must disable the fast path.
+    for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+        pylith::feassemble::IntegratorDomain* integrator =
+            dynamic_cast<pylith::feassemble::IntegratorDomain*>(_problem->_integrators[i]);
+        if (!integrator) { continue; }
+        REQUIRE(integrator->hasTimeIndependentLHSResidual());
+        integrator->setTimeDependentLHSResidual(true);
+        CHECK_FALSE(integrator->hasTimeIndependentLHSResidual());
+        CHECK_FALSE(_problem->_canUseLinearFastPath());
+        integrator->setTimeDependentLHSResidual(false);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testLinearFastPath
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify linear fast path is not used when material residuals depend on time.
+void
+pylith::testing::MMSTest::testLinearFastPathExcluded(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    _initializeLinearFastPath();
+    CHECK_FALSE(_problem->_useLinearFastPath);
+    CHECK_FALSE(_problem->_canUseLinearFastPath());
+
+    PYLITH_METHOD_END;
+} // testLinearFastPathExcluded
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify matrix-free action of LHS Jacobian.
+void
+pylith::testing::MMSTest::testJacobianAction(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    _initialize();
+    REQUIRE(pylith::problems::Physics::DYNAMIC != _problem->getFormulation());
+    for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+        assert(_problem->_integrators[i]);
+        REQUIRE(_problem->_integrators[i]->hasLHSJacobianAction());
+    } // for
+
+    PetscTS ts = _problem->getPetscTS();assert(ts);
+    PetscErrorCode err = PETSC_SUCCESS;
+    const PylithReal t = _problem->getStartTime();
+    PylithReal dt = 0.0;
+    err = TSGetTimeStep(ts, &dt);PYLITH_CHECK_ERROR(err);
+
+    // Assemble Jacobian; the action uses the state from this evaluation.
+    PetscMat jacobianMat = NULL;
+    err = DMCreateMatrix(_problem->getPetscDM(), &jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = DMComputeExactSolution(_problem->getPetscDM(), t, _solutionExactVec, _solutionDotExactVec);PYLITH_CHECK_ERROR(err);
+    _problem->computeLHSJacobian(jacobianMat, jacobianMat, t, dt, 1.0/dt, _solutionExactVec, _solutionDotExactVec);
+    REQUIRE(_problem->_numJacobians > 0);
+
+    // Use random vector so all entries of the Jacobian contribute.
+    PetscVec vectorVec = NULL;
+    PetscRandom random = NULL;
+    err = VecDuplicate(_solutionExactVec, &vectorVec);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomCreate(PETSC_COMM_WORLD, &random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomSetSeed(random, 47);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomSeed(random);PYLITH_CHECK_ERROR(err);
+    err = VecSetRandom(vectorVec, random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomDestroy(&random);PYLITH_CHECK_ERROR(err);
+
+    PetscVec productVec = NULL;
+    PetscVec actionVec = NULL;
+    err = VecDuplicate(vectorVec, &productVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(vectorVec, &actionVec);PYLITH_CHECK_ERROR(err);
+    err = MatMult(jacobianMat, vectorVec, productVec);PYLITH_CHECK_ERROR(err);
+    _problem->computeLHSJacobianAction(actionVec, vectorVec);
+
+    PylithReal norm = 0.0;
+    PylithReal normDiff = 0.0;
+    err = VecNorm(productVec, NORM_2, &norm);PYLITH_CHECK_ERROR(err);
+    err = VecAXPY(actionVec, -1.0, productVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(actionVec, NORM_2, &normDiff);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&actionVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&productVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&vectorVec);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+
+    REQUIRE(norm > 0.0);
+    INFO("|J_action(v) - J*v| == " << normDiff << " with |J*v| == " << norm);
+    CHECK_THAT(normDiff, Catch::Matchers::WithinAbs(0.0, 1.0e-10*norm));
+
+    PYLITH_METHOD_END;
+} // testJacobianAction
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify residual from overlapped assembly.
+void
+pylith::testing::MMSTest::testOverlappedAssembly(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    _initialize();
+
+    PetscTS ts = _problem->getPetscTS();assert(ts);
+    PetscErrorCode err = PETSC_SUCCESS;
+    const PylithReal t = _problem->getStartTime();
+    PylithReal dt = 0.0;
+    err = TSGetTimeStep(ts, &dt);PYLITH_CHECK_ERROR(err);
+    err = DMComputeExactSolution(_problem->getPetscDM(), t, _solutionExactVec, _solutionDotExactVec);PYLITH_CHECK_ERROR(err);
+
+    // Use random solution so all cells contribute to the residual. Separate copies ensure the local solution is
+    // updated for each evaluation.
+    PetscVec solutionVec = NULL;
+    PetscVec solutionOverlapVec = NULL;
+    PetscRandom random = NULL;
+    err = VecDuplicate(_solutionExactVec, &solutionVec);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomCreate(PETSC_COMM_WORLD, &random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomSetSeed(random, 53);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomSeed(random);PYLITH_CHECK_ERROR(err);
+    err = VecSetRandom(solutionVec, random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomDestroy(&random);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &solutionOverlapVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(solutionVec, solutionOverlapVec);PYLITH_CHECK_ERROR(err);
+
+    PetscVec residualVec = NULL;
+    PetscVec residualOverlapVec = NULL;
+    err = VecDuplicate(solutionVec, &residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &residualOverlapVec);PYLITH_CHECK_ERROR(err);
+    _problem->setUseOverlappedAssembly(true);
+    _problem->computeLHSResidual(residualOverlapVec, t, dt, solutionOverlapVec, _solutionDotExactVec);
+    _problem->setUseOverlappedAssembly(false);
+    _problem->computeLHSResidual(residualVec, t, dt, solutionVec, _solutionDotExactVec);
+
+    PylithReal norm = 0.0;
+    PylithReal normDiff = 0.0;
+    err = VecNorm(residualVec, NORM_2, &norm);PYLITH_CHECK_ERROR(err);
+    err = VecAXPY(residualOverlapVec, -1.0, residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(residualOverlapVec, NORM_2, &normDiff);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualOverlapVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionOverlapVec);PYLITH_CHECK_ERROR(err);
+
+    REQUIRE(norm > 0.0);
+    INFO("|F_overlap(s) - F(s)| == " << normDiff << " with |F(s)| == " << norm);
+    CHECK_THAT(normDiff, Catch::Matchers::WithinAbs(0.0, 1.0e-12*norm));
+
+    PYLITH_METHOD_END;
+} // testOverlappedAssembly
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify consecutive runs with reinitialize() give the same solution.
+void
+pylith::testing::MMSTest::testReinitialize(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    _initialize();
+
+    PetscTS ts = _problem->getPetscTS();assert(ts);
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscVec solutionVec = NULL;
+    PetscVec solutionFirstVec = NULL;
+    PylithReal tStart = 0.0;
+    err = TSGetTime(ts, &tStart);PYLITH_CHECK_ERROR(err);
+
+    _problem->solve();
+    PylithReal tEnd = 0.0;
+    PetscInt numSteps = 0;
+    err = TSGetTime(ts, &tEnd);PYLITH_CHECK_ERROR(err);
+    err = TSGetStepNumber(ts, &numSteps);PYLITH_CHECK_ERROR(err);
+    REQUIRE(tEnd > tStart);
+    err = TSGetSolution(ts, &solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &solutionFirstVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(solutionVec, solutionFirstVec);PYLITH_CHECK_ERROR(err);
+
+    _problem->reinitialize();
+    PylithReal t = 0.0;
+    PetscInt step = -1;
+    err = TSGetTime(ts, &t);PYLITH_CHECK_ERROR(err);
+    err = TSGetStepNumber(ts, &step);PYLITH_CHECK_ERROR(err);
+    CHECK(tStart == t);
+    CHECK(0 == step);
+
+    _problem->solve();
+    err = TSGetTime(ts, &t);PYLITH_CHECK_ERROR(err);
+    err = TSGetStepNumber(ts, &step);PYLITH_CHECK_ERROR(err);
+    CHECK(tEnd == t);
+    CHECK(numSteps == step);
+
+    PylithReal norm = 0.0;
+    PylithReal normDiff = 0.0;
+    err = TSGetSolution(ts, &solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(solutionFirstVec, NORM_2, &norm);PYLITH_CHECK_ERROR(err);
+    err = VecAXPY(solutionFirstVec, -1.0, solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(solutionFirstVec, NORM_2, &normDiff);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionFirstVec);PYLITH_CHECK_ERROR(err);
+
+    REQUIRE(norm > 0.0);
+    INFO("|s_second - s_first| == " << normDiff << " with |s_first| == " << norm);
+    CHECK_THAT(normDiff, Catch::Matchers::WithinAbs(0.0, 1.0e-12*norm));
+
+    PYLITH_METHOD_END;
+} // testReinitialize
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize objects for test.
 void
@@ -216,7 +608,7 @@ pylith::testing::MMSTest::_initialize(void) {
     PYLITH_METHOD_BEGIN;
     assert(_problem);
 
-    _problem->setSolverType(pylith::problems::Problem::NONLINEAR);
+    _problem->setSolverType(_solverType);
     _problem->setMaxTimeSteps(1);
     _problem->preinitialize(*_mesh);
     _problem->verifyConfiguration();
@@ -248,4 +640,27 @@ pylith::testing::MMSTest::_initialize(void) {
 } // _initialize
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Initialize objects for test of linear fast path.
+void
+pylith::testing::MMSTest::_initializeLinearFastPath(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    _solverType = pylith::problems::Problem::LINEAR;
+    _problem->setUseLinearFastPath(true);
+    _initialize();
+    REQUIRE(pylith::problems::Physics::QUASISTATIC == _problem->getFormulation());
+
+    // Constraints given by user functions are assumed to depend on time. The exact solution does not, so we mark
+    // them time independent to isolate the materials.
+    for (size_t i = 0; i < _problem->_constraints.size(); ++i) {
+        assert(_problem->_constraints[i]);
+        _problem->_constraints[i]->setTimeDependent(false);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _initializeLinearFastPath
+
+
 // End of file
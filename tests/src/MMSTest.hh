@@ -30,6 +30,7 @@
 #include "testingfwd.hh" // forward declaration
 
 #include "pylith/problems/problemsfwd.hh" // HOLDSA TimeDependent
+#include "pylith/problems/Problem.hh" // USES Problem::SolverTypeEnum
 #include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh
 
 #include "pylith/utils/petscfwd.h" // HASA PetscVec
@@ -72,6 +73,50 @@ public:
      */
     void testJacobianFiniteDiff(void);
 
+    /** Verify rate groups for local time stepping.
+     *
+     * Cells that are not stable with the time step and the points in their closure go in the fast rate group. The
+     * residual over the cells integrated for the fast rate group must match the full residual for the degrees of
+     * freedom in the fast rate group.
+     */
+    void testLocalTimeStepping(void);
+
+    /** Verify residual from linear fast path.
+     *
+     * The residual formed from the stored Jacobian and cached load vector, F(s) = J*s + b, must match the assembled
+     * residual. Marking a material integrator as having a time-dependent residual must disable the fast path.
+     *
+     * Requires a linear, quasistatic problem with a solution that does not depend on time.
+     */
+    void testLinearFastPath(void);
+
+    /** Verify linear fast path is not used when material residuals depend on time.
+     *
+     * Requires a linear, quasistatic problem with materials that have time-dependent MMS body forces.
+     */
+    void testLinearFastPathExcluded(void);
+
+    /** Verify matrix-free action of LHS Jacobian.
+     *
+     * The action J*v computed by the integrators must match the product of the assembled Jacobian and v.
+     *
+     * Requires an implicit problem with integrators that can compute the action of the LHS Jacobian.
+     */
+    void testJacobianAction(void);
+
+    /** Verify residual from overlapped assembly.
+     *
+     * The residual assembled over interior cells while ghost values are exchanged and then over boundary cells must
+     * match the residual assembled over all cells after the exchange.
+     */
+    void testOverlappedAssembly(void);
+
+    /** Verify consecutive runs with reinitialize() give the same solution.
+     *
+     * Requires a problem whose initial solution is given by the initial conditions.
+     */
+    void testReinitialize(void);
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -81,6 +126,9 @@ protected:
     /// Set exact solution and time derivative of solution in domain.
     virtual void _setExactSolution(void) = 0;
 
+    /// Initialize objects for test of linear fast path.
+    void _initializeLinearFastPath(void);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -93,6 +141,7 @@ protected:
     PylithReal _tolerance; ///< Tolerance for discretization and residual test.
     bool _isJacobianLinear; ///< Jacobian is should be linear.
     bool _allowZeroResidual; ///< Allow residual to be exactly zero.
+    pylith::problems::Problem::SolverTypeEnum _solverType; ///< Type of solver for problem.
 
 }; // MMSTest
 